@@ -3,9 +3,11 @@
 #include <filesystem>
 
 #include <Tools.h>
+#include <Trace.h>
 
 #include "API/UE/Math/ColorList.h"
 #include "../Offsets.h"
+#include "../OffsetsBenchmark.h"
 #include "../PDBReader/PDBReader.h"
 #include "../PluginManager/PluginManager.h"
 #include "../Hooks.h"
@@ -14,6 +16,8 @@
 #include "HooksImpl.h"
 #include "ApiUtils.h"
 
+ARK_TRACE_DEFINE_PROVIDER("ArkServerApi", (0x4e881066, 0x4a7b, 0x42db, 0xa1, 0xc7, 0x60, 0x0f, 0x83, 0x78, 0x9a, 0x1f));
+
 namespace API
 {
 	constexpr float api_version = 3.0;
@@ -31,6 +35,9 @@ namespace API
 		Log::GetLog()->info("ARK: Server Api V{:.1f}", GetVersion());
 		Log::GetLog()->info("Loading...\n");
 
+		// Stays registered for the lifetime of the process, the api is never unloaded
+		Trace::Register();
+
 		PdbReader pdb_reader;
 
 		std::unordered_map<std::string, intptr_t> offsets_dump;
@@ -101,6 +108,10 @@ namespace API
 		GetCommands()->AddConsoleCommand("plugins.unload", &UnloadPluginCmd);
 		GetCommands()->AddRconCommand("plugins.load", &LoadPluginRcon);
 		GetCommands()->AddRconCommand("plugins.unload", &UnloadPluginRcon);
+		GetCommands()->AddConsoleCommand("hooks.profile", &HookProfileCmd);
+		GetCommands()->AddRconCommand("hooks.profile", &HookProfileRcon);
+		GetCommands()->AddConsoleCommand("api.benchmark.offsets", &OffsetsBenchmarkCmd);
+		GetCommands()->AddRconCommand("api.benchmark.offsets", &OffsetsBenchmarkRcon);
 	}
 
 	FString ArkBaseApi::LoadPlugin(FString* cmd)
@@ -157,6 +168,90 @@ namespace API
 		return L"Plugin not found";
 	}
 
+	// "hooks.profile [on [sample_every] | off | reset]", the counters of every hooked function without arguments
+	FString ArkBaseApi::HookProfile(FString* cmd)
+	{
+		TArray<FString> parsed;
+		cmd->ParseIntoArray(parsed, L" ", true);
+
+		auto& hooks = ArkApi::GetHooks();
+
+		if (!parsed.IsValidIndex(1))
+		{
+			return FString(hooks.GetHookProfile(false).c_str());
+		}
+
+		const std::string option = parsed[1].ToString();
+
+		if (option == "on")
+		{
+			unsigned sample_every = 64;
+
+			try
+			{
+				if (parsed.IsValidIndex(2))
+				{
+					sample_every = static_cast<unsigned>(std::max(1ul, std::stoul(*parsed[2])));
+				}
+			}
+			catch (const std::exception& error)
+			{
+				Log::GetLog()->warn("({}) {}", __FUNCTION__, error.what());
+				return "Invalid sample rate";
+			}
+
+			hooks.SetHookProfiling(sample_every);
+			Log::GetLog()->info("Hook profiling on, timing 1 in {} calls", sample_every);
+
+			return FString::Format("Hook profiling on, timing 1 in {} calls", sample_every);
+		}
+
+		if (option == "off")
+		{
+			hooks.SetHookProfiling(0);
+			return "Hook profiling off";
+		}
+
+		if (option == "reset")
+		{
+			return FString(hooks.GetHookProfile(true).c_str());
+		}
+
+		return "Usage: hooks.profile [on [sample_every] | off | reset]";
+	}
+
+	// "api.benchmark.offsets [rounds] [prefix]", field lookups by name against resolved slots, for test servers
+	FString ArkBaseApi::OffsetsBenchmark(FString* cmd)
+	{
+		TArray<FString> parsed;
+		cmd->ParseIntoArray(parsed, L" ", true);
+
+		unsigned rounds = 10;
+		std::string prefix;
+
+		try
+		{
+			if (parsed.IsValidIndex(1))
+			{
+				rounds = static_cast<unsigned>(std::min(1000ul, std::max(1ul, std::stoul(*parsed[1]))));
+			}
+		}
+		catch (const std::exception& error)
+		{
+			Log::GetLog()->warn("({}) {}", __FUNCTION__, error.what());
+			return "Usage: api.benchmark.offsets [rounds] [prefix]";
+		}
+
+		if (parsed.IsValidIndex(2))
+		{
+			prefix = parsed[2].ToString();
+		}
+
+		Log::GetLog()->info("Running offsets benchmark with {} rounds", rounds);
+
+		return FString(RunOffsetsBenchmark(rounds, prefix).c_str());
+	}
+
 	// Command Callbacks
 	void ArkBaseApi::LoadPluginCmd(APlayerController* player_controller, FString* cmd, bool /*unused*/)
 	{
@@ -170,6 +265,18 @@ namespace API
 		ArkApi::GetApiUtils().SendServerMessage(shooter_controller, FColorList::Green, *UnloadPlugin(cmd));
 	}
 
+	void ArkBaseApi::HookProfileCmd(APlayerController* player_controller, FString* cmd, bool /*unused*/)
+	{
+		auto* shooter_controller = static_cast<AShooterPlayerController*>(player_controller);
+		ArkApi::GetApiUtils().SendServerMessage(shooter_controller, FColorList::Green, *HookProfile(cmd));
+	}
+
+	void ArkBaseApi::OffsetsBenchmarkCmd(APlayerController* player_controller, FString* cmd, bool /*unused*/)
+	{
+		auto* shooter_controller = static_cast<AShooterPlayerController*>(player_controller);
+		ArkApi::GetApiUtils().SendServerMessage(shooter_controller, FColorList::Green, *OffsetsBenchmark(cmd));
+	}
+
 	// RCON Command Callbacks
 	void ArkBaseApi::LoadPluginRcon(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld* /*unused*/)
 	{
@@ -183,4 +290,18 @@ namespace API
 		FString reply = UnloadPlugin(&rcon_packet->Body);
 		rcon_connection->SendMessageW(rcon_packet->Id, 0, &reply);
 	}
+
+	void ArkBaseApi::HookProfileRcon(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet,
+	                                 UWorld* /*unused*/)
+	{
+		FString reply = HookProfile(&rcon_packet->Body);
+		rcon_connection->SendMessageW(rcon_packet->Id, 0, &reply);
+	}
+
+	void ArkBaseApi::OffsetsBenchmarkRcon(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet,
+	                                      UWorld* /*unused*/)
+	{
+		FString reply = OffsetsBenchmark(&rcon_packet->Body);
+		rcon_connection->SendMessageW(rcon_packet->Id, 0, &reply);
+	}
 } // namespace API
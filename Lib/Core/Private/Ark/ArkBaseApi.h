@@ -25,14 +25,22 @@ namespace API
 		// Callbacks
 		static FString LoadPlugin(FString* cmd);
 		static FString UnloadPlugin(FString* cmd);
+		static FString HookProfile(FString* cmd);
+		static FString OffsetsBenchmark(FString* cmd);
 
 		static void LoadPluginCmd(APlayerController* /*player_controller*/, FString* /*cmd*/, bool /*unused*/);
 		static void UnloadPluginCmd(APlayerController* /*player_controller*/, FString* /*cmd*/, bool /*unused*/);
+		static void HookProfileCmd(APlayerController* /*player_controller*/, FString* /*cmd*/, bool /*unused*/);
+		static void OffsetsBenchmarkCmd(APlayerController* /*player_controller*/, FString* /*cmd*/, bool /*unused*/);
 
 		static void LoadPluginRcon(RCONClientConnection* /*rcon_connection*/, RCONPacket* /*rcon_packet*/,
 		                           UWorld* /*unused*/);
 		static void UnloadPluginRcon(RCONClientConnection* /*rcon_connection*/, RCONPacket* /*rcon_packet*/,
 		                             UWorld* /*unused*/);
+		static void HookProfileRcon(RCONClientConnection* /*rcon_connection*/, RCONPacket* /*rcon_packet*/,
+		                            UWorld* /*unused*/);
+		static void OffsetsBenchmarkRcon(RCONClientConnection* /*rcon_connection*/, RCONPacket* /*rcon_packet*/,
+		                                 UWorld* /*unused*/);
 
 		std::unique_ptr<ArkApi::ICommands> commands_;
 		std::unique_ptr<ArkApi::IHooks> hooks_;
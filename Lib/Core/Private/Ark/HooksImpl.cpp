@@ -7,6 +7,7 @@
 #include "../IBaseApi.h"
 
 #include <Logger/Logger.h>
+#include <Trace.h>
 
 namespace ArkApi
 {
@@ -19,6 +20,8 @@ namespace ArkApi
 		EChatSendMode::Type);
 	DECLARE_HOOK(APlayerController_ConsoleCommand, FString*, APlayerController*, FString*, FString*, bool);
 	DECLARE_HOOK(RCONClientConnection_ProcessRCONPacket, void, RCONClientConnection*, RCONPacket*, UWorld*);
+	DECLARE_HOOK(RCONClientConnection_Tick, void, RCONClientConnection*, long double, UWorld*);
+	DECLARE_HOOK(RCONClientConnection_Close, void, RCONClientConnection*);
 	DECLARE_HOOK(AGameState_DefaultTimer, void, AGameState*);
 	DECLARE_HOOK(AShooterGameMode_BeginPlay, void, AShooterGameMode*);
 
@@ -26,6 +29,9 @@ namespace ArkApi
 	{
 		auto& hooks = API::game_api->GetHooks();
 
+		// One thread freeze for all of them
+		hooks->BeginBatch();
+
 		hooks->SetHook("UEngine.Init", &Hook_UEngine_Init, &UEngine_Init_original);
 		hooks->SetHook("UWorld.InitWorld", &Hook_UWorld_InitWorld, &UWorld_InitWorld_original);
 		hooks->SetHook("UWorld.Tick", &Hook_UWorld_Tick, &UWorld_Tick_original);
@@ -38,10 +44,16 @@ namespace ArkApi
 		               &APlayerController_ConsoleCommand_original);
 		hooks->SetHook("RCONClientConnection.ProcessRCONPacket", &Hook_RCONClientConnection_ProcessRCONPacket,
 		               &RCONClientConnection_ProcessRCONPacket_original);
+		hooks->SetHook("RCONClientConnection.Tick", &Hook_RCONClientConnection_Tick,
+		               &RCONClientConnection_Tick_original);
+		hooks->SetHook("RCONClientConnection.Close", &Hook_RCONClientConnection_Close,
+		               &RCONClientConnection_Close_original);
 		hooks->SetHook("AGameState.DefaultTimer", &Hook_AGameState_DefaultTimer, &AGameState_DefaultTimer_original);
 		hooks->SetHook("AShooterGameMode.BeginPlay", &Hook_AShooterGameMode_BeginPlay,
 		               &AShooterGameMode_BeginPlay_original);
 
+		hooks->ApplyBatch();
+
 		Log::GetLog()->info("Initialized hooks\n");
 	}
 
@@ -70,6 +82,8 @@ namespace ArkApi
 
 	void Hook_UWorld_Tick(DWORD64 world, DWORD64 tick_type, float delta_seconds)
 	{
+		ARK_TRACE_ZONE("ArkApi::Hook_UWorld_Tick");
+
 		dynamic_cast<Commands&>(*API::game_api->GetCommands()).CheckOnTickCallbacks(delta_seconds);
 
 		UWorld_Tick_original(world, tick_type, delta_seconds);
@@ -131,8 +145,27 @@ namespace ArkApi
 		RCONClientConnection_ProcessRCONPacket_original(_this, packet, in_world);
 	}
 
+	void Hook_RCONClientConnection_Tick(RCONClientConnection* _this, long double world_time, UWorld* in_world)
+	{
+		RCONClientConnection_Tick_original(_this, world_time, in_world);
+
+		if (!_this->IsClosedField())
+		{
+			dynamic_cast<Commands&>(*API::game_api->GetCommands()).SendDeferredRconReplies(_this);
+		}
+	}
+
+	void Hook_RCONClientConnection_Close(RCONClientConnection* _this)
+	{
+		dynamic_cast<Commands&>(*API::game_api->GetCommands()).DropDeferredRconReplies(_this);
+
+		RCONClientConnection_Close_original(_this);
+	}
+
 	void Hook_AGameState_DefaultTimer(AGameState* _this)
 	{
+		ARK_TRACE_ZONE("ArkApi::Hook_AGameState_DefaultTimer");
+
 		dynamic_cast<Commands&>(*API::game_api->GetCommands()).CheckOnTimerCallbacks();
 
 		AGameState_DefaultTimer_original(_this);
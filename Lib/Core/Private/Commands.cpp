@@ -2,35 +2,43 @@
 
 #include "IBaseApi.h"
 
+#include <Trace.h>
+
 namespace ArkApi
 {
 	void Commands::AddChatCommand(const FString& command,
 	                              const std::function<void(AShooterPlayerController*, FString*, EChatSendMode::Type)>&
 	                              callback)
 	{
-		chat_commands_.push_back(std::make_shared<ChatCommand>(command, callback));
+		AddCommand(command, std::make_shared<ChatCommand>(command, callback), chat_commands_, chat_index_);
 	}
 
 	void Commands::AddConsoleCommand(const FString& command,
 	                                 const std::function<void(APlayerController*, FString*, bool)>& callback)
 	{
-		console_commands_.push_back(std::make_shared<ConsoleCommand>(command, callback));
+		AddCommand(command, std::make_shared<ConsoleCommand>(command, callback), console_commands_, console_index_);
 	}
 
 	void Commands::AddRconCommand(const FString& command,
 	                              const std::function<void(RCONClientConnection*, RCONPacket*, UWorld*)>& callback)
 	{
-		rcon_commands_.push_back(std::make_shared<RconCommand>(command, callback));
+		AddCommand(command, std::make_shared<RconCommand>(command, callback), rcon_commands_, rcon_index_);
 	}
 
 	void Commands::AddOnTickCallback(const FString& id, const std::function<void(float)>& callback)
 	{
-		on_tick_callbacks_.push_back(std::make_shared<OnTickCallback>(id, callback));
+		on_tick_callbacks_.emplace_back(id, callback);
 	}
 
 	void Commands::AddOnTimerCallback(const FString& id, const std::function<void()>& callback)
 	{
-		on_timer_callbacks_.push_back(std::make_shared<OnTimerCallback>(id, callback));
+		on_timer_callbacks_.emplace_back(id, callback);
+	}
+
+	void Commands::AddOnTimerCallbackEvery(const FString& id, unsigned interval_seconds,
+	                                       const std::function<void()>& callback)
+	{
+		on_timer_callbacks_.emplace_back(id, callback, interval_seconds);
 	}
 
 	void Commands::AddOnChatMessageCallback(const FString& id,
@@ -40,29 +48,37 @@ namespace ArkApi
 		on_chat_message_callbacks_.push_back(std::make_shared<OnChatMessageCallback>(id, callback));
 	}
 
+	void Commands::AddOnChatMessageCallbackWithPrefix(const FString& id, const FString& prefix,
+	                                                  const std::function<bool(AShooterPlayerController*, FString*,
+	                                                                           EChatSendMode::Type, bool, bool)>&
+	                                                  callback)
+	{
+		on_chat_message_callbacks_.push_back(std::make_shared<OnChatMessageCallback>(id, callback, prefix));
+	}
+
 	bool Commands::RemoveChatCommand(const FString& command)
 	{
-		return RemoveCommand<ChatCommand>(command, chat_commands_);
+		return RemoveCommand<ChatCommand>(command, chat_commands_, chat_index_);
 	}
 
 	bool Commands::RemoveConsoleCommand(const FString& command)
 	{
-		return RemoveCommand<ConsoleCommand>(command, console_commands_);
+		return RemoveCommand<ConsoleCommand>(command, console_commands_, console_index_);
 	}
 
 	bool Commands::RemoveRconCommand(const FString& command)
 	{
-		return RemoveCommand<RconCommand>(command, rcon_commands_);
+		return RemoveCommand<RconCommand>(command, rcon_commands_, rcon_index_);
 	}
 
 	bool Commands::RemoveOnTickCallback(const FString& id)
 	{
-		return RemoveCommand<OnTickCallback>(id, on_tick_callbacks_);
+		return RemoveCallback<OnTickCallback>(id, on_tick_callbacks_);
 	}
 
 	bool Commands::RemoveOnTimerCallback(const FString& id)
 	{
-		return RemoveCommand<OnTimerCallback>(id, on_timer_callbacks_);
+		return RemoveCallback<OnTimerCallback>(id, on_timer_callbacks_);
 	}
 
 	bool Commands::RemoveOnChatMessageCallback(const FString& id)
@@ -70,37 +86,82 @@ namespace ArkApi
 		return RemoveCommand<OnChatMessageCallback>(id, on_chat_message_callbacks_);
 	}
 
+	bool Commands::SetOnTickCallbackEnabled(const FString& id, bool enabled)
+	{
+		OnTickCallback* data = FindCallback<OnTickCallback>(id, on_tick_callbacks_);
+		if (data == nullptr)
+		{
+			return false;
+		}
+
+		data->enabled = enabled;
+
+		return true;
+	}
+
+	bool Commands::SetOnTimerCallbackEnabled(const FString& id, bool enabled)
+	{
+		OnTimerCallback* data = FindCallback<OnTimerCallback>(id, on_timer_callbacks_);
+		if (data == nullptr)
+		{
+			return false;
+		}
+
+		data->enabled = enabled;
+		data->countdown = data->interval;
+
+		return true;
+	}
+
 	bool Commands::CheckChatCommands(AShooterPlayerController* shooter_player_controller, FString* message,
 	                                 EChatSendMode::Type mode)
 	{
-		return CheckCommands<ChatCommand>(*message, chat_commands_, shooter_player_controller, message, mode);
+		return CheckCommands<ChatCommand>(*message, chat_index_, shooter_player_controller, message, mode);
 	}
 
 	bool Commands::CheckConsoleCommands(APlayerController* a_player_controller, FString* cmd, bool write_to_log)
 	{
-		return CheckCommands<ConsoleCommand>(*cmd, console_commands_, a_player_controller, cmd, write_to_log);
+		return CheckCommands<ConsoleCommand>(*cmd, console_index_, a_player_controller, cmd, write_to_log);
 	}
 
 	bool Commands::CheckRconCommands(RCONClientConnection* rcon_client_connection, RCONPacket* rcon_packet,
 	                                 UWorld* u_world)
 	{
-		return CheckCommands<RconCommand>(rcon_packet->Body, rcon_commands_, rcon_client_connection, rcon_packet,
+		return CheckCommands<RconCommand>(rcon_packet->Body, rcon_index_, rcon_client_connection, rcon_packet,
 		                                  u_world);
 	}
 
 	void Commands::CheckOnTickCallbacks(float delta_seconds)
 	{
-		for (const auto& data : on_tick_callbacks_)
+		ARK_TRACE_ZONE("ArkApi::CheckOnTickCallbacks");
+
+		// By index, a callback may add or remove callbacks
+		for (size_t i = 0; i < on_tick_callbacks_.size(); ++i)
 		{
-			data->callback(delta_seconds);
+			const OnTickCallback& data = on_tick_callbacks_[i];
+			if (data.enabled)
+			{
+				data.callback(delta_seconds);
+			}
 		}
 	}
 
 	void Commands::CheckOnTimerCallbacks()
 	{
-		for (const auto& data : on_timer_callbacks_)
+		ARK_TRACE_ZONE("ArkApi::CheckOnTimerCallbacks");
+
+		PruneDeferredRconReplies();
+
+		for (size_t i = 0; i < on_timer_callbacks_.size(); ++i)
 		{
-			data->callback();
+			OnTimerCallback& data = on_timer_callbacks_[i];
+			if (!data.enabled || --data.countdown != 0)
+			{
+				continue;
+			}
+
+			data.countdown = data.interval;
+			data.callback();
 		}
 	}
 
@@ -114,12 +175,137 @@ namespace ArkApi
 		bool prevent_default = false;
 		for (const auto& data : on_chat_message_callbacks_)
 		{
+			if (!data->prefix.IsEmpty() && !message->StartsWith(data->prefix, ESearchCase::IgnoreCase))
+			{
+				continue;
+			}
+
 			prevent_default |= data->callback(player_controller, message, mode, spam_check, command_executed);
 		}
 
 		return prevent_default;
 	}
 
+	uint64 Commands::DeferRconReply(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet)
+	{
+		std::lock_guard<std::mutex> lock(deferred_mutex_);
+
+		const uint64 reply_id = next_deferred_reply_id_++;
+		deferred_replies_.emplace(reply_id, DeferredRconReply{
+			                          rcon_connection, rcon_packet->Id, std::chrono::steady_clock::now()
+		                          });
+
+		return reply_id;
+	}
+
+	bool Commands::SendDeferredRconReply(uint64 reply_id, const FString& message)
+	{
+		std::lock_guard<std::mutex> lock(deferred_mutex_);
+
+		const auto iter = deferred_replies_.find(reply_id);
+		if (iter == deferred_replies_.end() || iter->second.ready)
+		{
+			return false;
+		}
+
+		if (message.IsEmpty())
+		{
+			deferred_replies_.erase(iter);
+			return true;
+		}
+
+		iter->second.ready = true;
+		iter->second.message = message;
+		++ready_deferred_replies_;
+
+		return true;
+	}
+
+	void Commands::SendDeferredRconReplies(RCONClientConnection* rcon_connection)
+	{
+		if (ready_deferred_replies_.load() == 0)
+		{
+			return;
+		}
+
+		std::vector<DeferredRconReply> ready;
+
+		{
+			std::lock_guard<std::mutex> lock(deferred_mutex_);
+
+			for (auto iter = deferred_replies_.begin(); iter != deferred_replies_.end();)
+			{
+				if (iter->second.connection == rcon_connection && iter->second.ready)
+				{
+					ready.push_back(std::move(iter->second));
+					iter = deferred_replies_.erase(iter);
+					--ready_deferred_replies_;
+				}
+				else
+				{
+					++iter;
+				}
+			}
+		}
+
+		// Sent without the lock, the message may be another command's reply to defer
+		for (DeferredRconReply& reply : ready)
+		{
+			rcon_connection->SendMessageW(reply.packet_id, 0, &reply.message);
+		}
+	}
+
+	void Commands::DropDeferredRconReplies(RCONClientConnection* rcon_connection)
+	{
+		std::lock_guard<std::mutex> lock(deferred_mutex_);
+
+		for (auto iter = deferred_replies_.begin(); iter != deferred_replies_.end();)
+		{
+			if (iter->second.connection == rcon_connection)
+			{
+				if (iter->second.ready)
+				{
+					--ready_deferred_replies_;
+				}
+
+				iter = deferred_replies_.erase(iter);
+			}
+			else
+			{
+				++iter;
+			}
+		}
+	}
+
+	void Commands::PruneDeferredRconReplies()
+	{
+		std::lock_guard<std::mutex> lock(deferred_mutex_);
+
+		if (deferred_replies_.empty())
+		{
+			return;
+		}
+
+		const auto cutoff = std::chrono::steady_clock::now() - max_deferred_reply_age_;
+
+		for (auto iter = deferred_replies_.begin(); iter != deferred_replies_.end();)
+		{
+			if (iter->second.deferred_at < cutoff)
+			{
+				if (iter->second.ready)
+				{
+					--ready_deferred_replies_;
+				}
+
+				iter = deferred_replies_.erase(iter);
+			}
+			else
+			{
+				++iter;
+			}
+		}
+	}
+
 	// Free function
 	ICommands& GetCommands()
 	{
@@ -3,7 +3,13 @@
 #include <ICommands.h>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cwctype>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -43,6 +49,17 @@ namespace ArkApi
 		bool RemoveOnTimerCallback(const FString& id) override;
 		bool RemoveOnChatMessageCallback(const FString& id) override;
 
+		void AddOnTimerCallbackEvery(const FString& id, unsigned interval_seconds,
+		                             const std::function<void()>& callback) override;
+		bool SetOnTickCallbackEnabled(const FString& id, bool enabled) override;
+		bool SetOnTimerCallbackEnabled(const FString& id, bool enabled) override;
+		void AddOnChatMessageCallbackWithPrefix(const FString& id, const FString& prefix,
+		                                        const std::function<bool(AShooterPlayerController*, FString*,
+		                                                                 EChatSendMode::Type, bool, bool)>& callback)
+		override;
+		uint64 DeferRconReply(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet) override;
+		bool SendDeferredRconReply(uint64 reply_id, const FString& message) override;
+
 		bool CheckChatCommands(AShooterPlayerController* shooter_player_controller, FString* message,
 		                       EChatSendMode::Type mode);
 		bool CheckConsoleCommands(APlayerController* a_player_controller, FString* cmd, bool write_to_log);
@@ -53,6 +70,16 @@ namespace ArkApi
 		bool CheckOnChatMessageCallbacks(AShooterPlayerController* player_controller, FString* message,
 		                                 EChatSendMode::Type mode, bool spam_check, bool command_executed);
 
+		/**
+		 * \brief Sends the deferred replies of the connection that are ready, called from its tick
+		 */
+		void SendDeferredRconReplies(RCONClientConnection* rcon_connection);
+
+		/**
+		 * \brief Forgets the deferred replies of a connection that is being closed
+		 */
+		void DropDeferredRconReplies(RCONClientConnection* rcon_connection);
+
 	private:
 		template <typename T>
 		struct Command
@@ -71,10 +98,43 @@ namespace ArkApi
 		using ConsoleCommand = Command<void(APlayerController*, FString*, bool)>;
 		using RconCommand = Command<void(RCONClientConnection*, RCONPacket*, UWorld*)>;
 
-		using OnTickCallback = Command<void(float)>;
-		using OnTimerCallback = Command<void()>;
-		using OnChatMessageCallback = Command<bool
-			(AShooterPlayerController*, FString*, EChatSendMode::Type, bool, bool)>;
+		// Stored by value so dispatch walks one contiguous array
+		template <typename T>
+		struct Callback
+		{
+			Callback(FString id, std::function<T> callback, unsigned interval = 1)
+				: id(std::move(id)),
+				  callback(std::move(callback)),
+				  interval(std::max(1u, interval)),
+				  countdown(this->interval)
+			{
+			}
+
+			FString id;
+			std::function<T> callback;
+			unsigned interval;
+			// Timer calls left until the next one, only used by timer callbacks
+			unsigned countdown;
+			bool enabled{true};
+		};
+
+		using OnTickCallback = Callback<void(float)>;
+		using OnTimerCallback = Callback<void()>;
+		struct OnChatMessageCallback : Command<bool
+				(AShooterPlayerController*, FString*, EChatSendMode::Type, bool, bool)>
+		{
+			OnChatMessageCallback(FString id,
+			                      std::function<bool(AShooterPlayerController*, FString*, EChatSendMode::Type, bool,
+			                                         bool)> callback,
+			                      FString prefix = FString())
+				: Command(std::move(id), std::move(callback)),
+				  prefix(std::move(prefix))
+			{
+			}
+
+			// Checked before the callback is called, empty matches every message
+			FString prefix;
+		};
 
 		template <typename T>
 		bool RemoveCommand(const FString& command, std::vector<std::shared_ptr<T>>& commands)
@@ -95,38 +155,159 @@ namespace ArkApi
 			return false;
 		}
 
-		template <typename T, typename... Args>
-		bool CheckCommands(const FString& message, const std::vector<std::shared_ptr<T>>& commands, Args&&... args)
+		template <typename T>
+		static T* FindCallback(const FString& id, std::vector<T>& callbacks)
 		{
-			TArray<FString> parsed;
-			message.ParseIntoArray(parsed, L" ", true);
+			const auto iter = std::find_if(callbacks.begin(), callbacks.end(), [&id](const T& data) -> bool
+			{
+				return data.id == id;
+			});
+
+			return iter != callbacks.end() ? &*iter : nullptr;
+		}
 
-			if (!parsed.IsValidIndex(0))
+		template <typename T>
+		static bool RemoveCallback(const FString& id, std::vector<T>& callbacks)
+		{
+			const auto iter = std::find_if(callbacks.begin(), callbacks.end(), [&id](const T& data) -> bool
+			{
+				return data.id == id;
+			});
+
+			if (iter != callbacks.end())
+			{
+				callbacks.erase(iter);
+
+				return true;
+			}
+
+			return false;
+		}
+
+		template <typename T>
+		using CommandIndex = std::unordered_map<std::wstring, std::shared_ptr<T>>;
+
+		// Lower case copy of [begin, end), the key commands are indexed by
+		static std::wstring FoldCase(const wchar_t* begin, const wchar_t* end)
+		{
+			std::wstring key(begin, end);
+			std::transform(key.begin(), key.end(), key.begin(), [](wchar_t c)
+			{
+				return static_cast<wchar_t>(std::towlower(c));
+			});
+
+			return key;
+		}
+
+		static std::wstring FoldCase(const FString& text)
+		{
+			const wchar_t* begin = *text;
+			return FoldCase(begin, begin + wcslen(begin));
+		}
+
+		template <typename T>
+		void AddCommand(const FString& command, std::shared_ptr<T> data, std::vector<std::shared_ptr<T>>& commands,
+		                CommandIndex<T>& index)
+		{
+			// The first command registered under a name keeps handling it, as with the old linear scan
+			index.emplace(FoldCase(command), data);
+			commands.push_back(std::move(data));
+		}
+
+		template <typename T>
+		bool RemoveCommand(const FString& command, std::vector<std::shared_ptr<T>>& commands, CommandIndex<T>& index)
+		{
+			if (!RemoveCommand(command, commands))
 			{
 				return false;
 			}
 
-			const FString command_text = parsed[0];
+			const std::wstring key = FoldCase(command);
+			index.erase(key);
 
-			for (const auto& command : commands)
+			// Another plugin may have registered the same name
+			for (const auto& data : commands)
 			{
-				if (command_text.Compare(command->command, ESearchCase::IgnoreCase) == 0)
+				if (FoldCase(data->command) == key)
 				{
-					command->callback(std::forward<Args>(args)...);
-
-					return true;
+					index.emplace(key, data);
+					break;
 				}
 			}
 
-			return false;
+			return true;
+		}
+
+		template <typename T, typename... Args>
+		bool CheckCommands(const FString& message, const CommandIndex<T>& index, Args&&... args)
+		{
+			if (index.empty())
+			{
+				return false;
+			}
+
+			// First space separated token, without splitting the rest of the message
+			const wchar_t* begin = *message;
+			while (*begin == L' ')
+			{
+				++begin;
+			}
+
+			const wchar_t* end = begin;
+			while (*end != L'\0' && *end != L' ')
+			{
+				++end;
+			}
+
+			if (begin == end)
+			{
+				return false;
+			}
+
+			const auto iter = index.find(FoldCase(begin, end));
+			if (iter == index.end())
+			{
+				return false;
+			}
+
+			// Keeps the command alive if the callback removes it
+			const std::shared_ptr<T> command = iter->second;
+			command->callback(std::forward<Args>(args)...);
+
+			return true;
 		}
 
 		std::vector<std::shared_ptr<ChatCommand>> chat_commands_;
 		std::vector<std::shared_ptr<ConsoleCommand>> console_commands_;
 		std::vector<std::shared_ptr<RconCommand>> rcon_commands_;
 
-		std::vector<std::shared_ptr<OnTickCallback>> on_tick_callbacks_;
-		std::vector<std::shared_ptr<OnTimerCallback>> on_timer_callbacks_;
+		CommandIndex<ChatCommand> chat_index_;
+		CommandIndex<ConsoleCommand> console_index_;
+		CommandIndex<RconCommand> rcon_index_;
+
+		std::vector<OnTickCallback> on_tick_callbacks_;
+		std::vector<OnTimerCallback> on_timer_callbacks_;
 		std::vector<std::shared_ptr<OnChatMessageCallback>> on_chat_message_callbacks_;
+
+		struct DeferredRconReply
+		{
+			RCONClientConnection* connection;
+			int packet_id;
+			std::chrono::steady_clock::time_point deferred_at;
+			bool ready{false};
+			FString message;
+		};
+
+		// Drops replies that never became ready, or whose connection went away without Close
+		void PruneDeferredRconReplies();
+
+		// A deferred reply is only ever sent from its connection's tick, the one place the connection is known to be alive
+		static constexpr std::chrono::minutes max_deferred_reply_age_{10};
+
+		std::mutex deferred_mutex_;
+		std::unordered_map<uint64, DeferredRconReply> deferred_replies_;
+		uint64 next_deferred_reply_id_{1};
+		// Lets the connection ticks skip the lock while nothing is ready
+		std::atomic<int> ready_deferred_replies_{0};
 	};
 } // namespace ArkApi
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace API
+{
+	/**
+	 * \brief Immutable string keyed table with a minimal perfect hash (hash and displace)
+	 *
+	 * Built once from a map, afterwards a lookup is one hash of the key, two array reads and one key compare.
+	 * Misses never change the table, so it can be read from any thread.
+	 */
+	template <typename T>
+	class FlatHashTable
+	{
+	public:
+		FlatHashTable() = default;
+
+		explicit FlatHashTable(const std::unordered_map<std::string, T>& source)
+		{
+			Build(source);
+		}
+
+		/**
+		 * \brief Finds the value of a key
+		 * \return Pointer to the value, nullptr if the key is not in the table
+		 */
+		const T* Find(std::string_view key) const
+		{
+			if (entries_.empty())
+				return nullptr;
+
+			const uint64_t hash = Hash(key);
+			const int32_t index = slots_[SlotOf(hash, seeds_[BucketOf(hash)])];
+
+			if (index < 0)
+				return nullptr;
+
+			const Entry& entry = entries_[index];
+			if (entry.hash != hash || std::string_view(keys_.data() + entry.key_offset, entry.key_size) != key)
+				return nullptr;
+
+			return &entry.value;
+		}
+
+		size_t Size() const
+		{
+			return entries_.size();
+		}
+
+		/**
+		 * \brief Calls func(key) for every key, in no particular order
+		 */
+		template <typename Func>
+		void ForEachKey(Func&& func) const
+		{
+			for (const Entry& entry : entries_)
+			{
+				func(std::string_view(keys_.data() + entry.key_offset, entry.key_size));
+			}
+		}
+
+		static uint64_t Hash(std::string_view key)
+		{
+			uint64_t hash = 14695981039346656037ull;
+
+			for (const char c : key)
+			{
+				hash ^= static_cast<unsigned char>(c);
+				hash *= 1099511628211ull;
+			}
+
+			return hash;
+		}
+
+	private:
+		struct Entry
+		{
+			uint64_t hash;
+			uint32_t key_offset;
+			uint32_t key_size;
+			T value;
+		};
+
+		// Keys per bucket on average, lower builds faster but takes more seeds
+		static constexpr size_t keys_per_bucket_ = 4;
+		static constexpr uint32_t max_seed_ = 1u << 20;
+
+		// splitmix64 finalizer, FNV-1a alone leaves similar names in neighbouring buckets
+		static uint64_t Mix(uint64_t x)
+		{
+			x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+			x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+			return x ^ (x >> 31);
+		}
+
+		size_t BucketOf(uint64_t hash) const
+		{
+			return static_cast<size_t>(Mix(hash) % seeds_.size());
+		}
+
+		size_t SlotOf(uint64_t hash, uint32_t seed) const
+		{
+			return static_cast<size_t>(Mix(hash + (static_cast<uint64_t>(seed) + 1) * 0x9E3779B97F4A7C15ull) % slots_.size());
+		}
+
+		void Build(const std::unordered_map<std::string, T>& source)
+		{
+			entries_.clear();
+			entries_.reserve(source.size());
+			keys_.clear();
+
+			for (const auto& item : source)
+			{
+				entries_.push_back({Hash(item.first), static_cast<uint32_t>(keys_.size()),
+				                    static_cast<uint32_t>(item.first.size()), item.second});
+				keys_ += item.first;
+			}
+
+			if (entries_.empty())
+				return;
+
+			// A very unlucky set can exhaust the seeds of a bucket, retry with more free slots
+			size_t slot_count = entries_.size() + entries_.size() / 8 + 1;
+
+			for (int attempt = 0; attempt < 8; ++attempt, slot_count += slot_count / 4 + 1)
+			{
+				if (TryPlace(slot_count))
+					return;
+			}
+
+			// Only two keys with the same 64 bit hash get here
+			throw std::runtime_error("Failed to build offsets table");
+		}
+
+		bool TryPlace(size_t slot_count)
+		{
+			const size_t bucket_count = std::max<size_t>(1, entries_.size() / keys_per_bucket_);
+
+			seeds_.assign(bucket_count, 0);
+			slots_.assign(slot_count, -1);
+
+			std::vector<std::vector<int32_t>> buckets(bucket_count);
+			for (size_t i = 0; i < entries_.size(); ++i)
+			{
+				buckets[BucketOf(entries_[i].hash)].push_back(static_cast<int32_t>(i));
+			}
+
+			// Largest buckets first, while most slots are still free
+			std::vector<size_t> order(bucket_count);
+			std::iota(order.begin(), order.end(), 0);
+			std::sort(order.begin(), order.end(), [&buckets](size_t a, size_t b)
+			{
+				return buckets[a].size() > buckets[b].size();
+			});
+
+			std::vector<size_t> placed;
+
+			for (const size_t bucket : order)
+			{
+				if (buckets[bucket].empty())
+					break;
+
+				bool found = false;
+
+				for (uint32_t seed = 0; seed < max_seed_ && !found; ++seed)
+				{
+					placed.clear();
+					found = true;
+
+					for (const int32_t index : buckets[bucket])
+					{
+						const size_t slot = SlotOf(entries_[index].hash, seed);
+
+						if (slots_[slot] >= 0 || std::find(placed.begin(), placed.end(), slot) != placed.end())
+						{
+							found = false;
+							break;
+						}
+
+						placed.push_back(slot);
+					}
+
+					if (found)
+					{
+						seeds_[bucket] = seed;
+
+						for (size_t i = 0; i < placed.size(); ++i)
+						{
+							slots_[placed[i]] = buckets[bucket][i];
+						}
+					}
+				}
+
+				if (!found)
+					return false;
+			}
+
+			return true;
+		}
+
+		std::vector<Entry> entries_;
+		std::string keys_;
+		std::vector<uint32_t> seeds_;
+		std::vector<int32_t> slots_;
+	};
+} // namespace API
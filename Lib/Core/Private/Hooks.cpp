@@ -1,5 +1,7 @@
 #include "Hooks.h"
 
+#include <algorithm>
+#include <filesystem>
 #include <string>
 
 #include <Logger/Logger.h>
@@ -10,6 +12,23 @@
 
 namespace API
 {
+	// File name of the plugin or module a handler or detour is compiled into
+	static std::string ModuleNameOf(LPVOID address)
+	{
+		HMODULE module = nullptr;
+
+		if (!GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+		                        static_cast<LPCSTR>(address), &module))
+		{
+			return "unknown";
+		}
+
+		char path[MAX_PATH];
+		const DWORD length = GetModuleFileNameA(module, path, MAX_PATH);
+
+		return length > 0 ? std::filesystem::path(std::string(path, length)).stem().string() : "unknown";
+	}
+
 	Hooks::Hooks()
 	{
 		if (MH_Initialize() != MH_OK)
@@ -42,7 +61,7 @@ namespace API
 			return false;
 		}
 
-		if (MH_EnableHook(new_target) != MH_OK)
+		if ((batch_depth_ > 0 ? MH_QueueEnableHook(new_target) : MH_EnableHook(new_target)) != MH_OK)
 		{
 			Log::GetLog()->error("Failed to enable hook for {}", func_name);
 			return false;
@@ -74,6 +93,15 @@ namespace API
 			return false;
 		}
 
+		if (batch_depth_ > 0)
+		{
+			// Unhooked with the other removals in ApplyBatch
+			removed_hooks_[func_name].push_back(*iter);
+			hook_vector.erase(iter);
+
+			return true;
+		}
+
 		// Remove all hooks placed on this function
 		for (const auto& hook : hook_vector)
 		{
@@ -98,6 +126,244 @@ namespace API
 
 		return true;
 	}
+
+	bool Hooks::AddHookHandlerInternal(const std::string& func_name, LPVOID detour, LPVOID handler,
+	                                   ArkApi::HookHandlers** handlers)
+	{
+		auto iter = multiplexed_.find(func_name);
+
+		if (iter == multiplexed_.end())
+		{
+			Multiplexed multiplexed{std::make_unique<ArkApi::HookHandlers>(), {}, detour};
+			multiplexed.handlers->handlers.push_back(handler);
+			multiplexed.handlers->stats.emplace_back();
+			multiplexed.handlers->sample_every = profile_sample_every_;
+
+			// Set before the detour can run
+			*handlers = multiplexed.handlers.get();
+
+			if (!SetHookInternal(func_name, detour, &multiplexed.handlers->original))
+			{
+				*handlers = nullptr;
+				return false;
+			}
+
+			multiplexed.owners.push_back({handler, detour});
+			multiplexed_.emplace(func_name, std::move(multiplexed));
+
+			return true;
+		}
+
+		Multiplexed& multiplexed = iter->second;
+
+		*handlers = multiplexed.handlers.get();
+		multiplexed.handlers->handlers.push_back(handler);
+		multiplexed.handlers->stats.emplace_back();
+		multiplexed.owners.push_back({handler, detour});
+
+		return true;
+	}
+
+	bool Hooks::RemoveHookHandler(const std::string& func_name, LPVOID handler)
+	{
+		const auto iter = multiplexed_.find(func_name);
+		if (iter == multiplexed_.end())
+		{
+			Log::GetLog()->warn("Failed to find hook handler");
+			return false;
+		}
+
+		Multiplexed& multiplexed = iter->second;
+
+		const auto owner = std::find_if(multiplexed.owners.begin(), multiplexed.owners.end(),
+		                                [handler](const HandlerOwner& data) -> bool
+		                                {
+			                                return data.handler == handler;
+		                                });
+
+		if (owner == multiplexed.owners.end())
+		{
+			Log::GetLog()->warn("Failed to find hook handler");
+			return false;
+		}
+
+		auto& list = multiplexed.handlers->handlers;
+		const auto position = std::find(list.begin(), list.end(), handler);
+
+		multiplexed.handlers->stats.erase(multiplexed.handlers->stats.begin() + (position - list.begin()));
+		list.erase(position);
+		multiplexed.owners.erase(owner);
+
+		if (multiplexed.owners.empty())
+		{
+			const bool result = DisableHook(func_name, multiplexed.installed_detour);
+			multiplexed_.erase(iter);
+
+			return result;
+		}
+
+		const bool detour_in_use = std::any_of(multiplexed.owners.begin(), multiplexed.owners.end(),
+		                                       [&multiplexed](const HandlerOwner& data) -> bool
+		                                       {
+			                                       return data.detour == multiplexed.installed_detour;
+		                                       });
+
+		if (detour_in_use)
+		{
+			return true;
+		}
+
+		// The plugin whose detour is installed is going away, move the hook to the detour of a remaining one
+		if (!DisableHook(func_name, multiplexed.installed_detour))
+		{
+			return false;
+		}
+
+		multiplexed.installed_detour = multiplexed.owners.front().detour;
+
+		return SetHookInternal(func_name, multiplexed.installed_detour, &multiplexed.handlers->original);
+	}
+
+	void Hooks::BeginBatch()
+	{
+		++batch_depth_;
+	}
+
+	bool Hooks::ApplyBatch()
+	{
+		if (batch_depth_ == 0)
+		{
+			Log::GetLog()->warn("ApplyBatch called without BeginBatch");
+			return false;
+		}
+
+		if (batch_depth_ > 1)
+		{
+			--batch_depth_;
+			return true;
+		}
+
+		bool result = true;
+
+		if (!removed_hooks_.empty())
+		{
+			// Disable every hook on the changed functions with one freeze, removing disabled hooks doesn't freeze
+			for (const auto& removed : removed_hooks_)
+			{
+				for (const auto& hook : removed.second)
+				{
+					MH_QueueDisableHook(hook->target);
+				}
+
+				for (const auto& hook : all_hooks_[removed.first])
+				{
+					MH_QueueDisableHook(hook->target);
+				}
+			}
+
+			if (MH_ApplyQueued() != MH_OK)
+			{
+				Log::GetLog()->error("Failed to disable queued hooks");
+				result = false;
+			}
+
+			for (const auto& removed : removed_hooks_)
+			{
+				auto& hook_vector = all_hooks_[removed.first];
+
+				for (const auto& hook : removed.second)
+				{
+					MH_RemoveHook(hook->target);
+				}
+
+				for (const auto& hook : hook_vector)
+				{
+					MH_RemoveHook(hook->target);
+				}
+
+				auto hook_vec(move(hook_vector));
+				hook_vector.clear();
+
+				// Queued again below, batch_depth_ is still 1
+				for (const auto& hook : hook_vec)
+				{
+					result &= SetHookInternal(removed.first, hook->detour, hook->original);
+				}
+			}
+
+			removed_hooks_.clear();
+		}
+
+		batch_depth_ = 0;
+
+		if (MH_ApplyQueued() != MH_OK)
+		{
+			Log::GetLog()->error("Failed to enable queued hooks");
+			result = false;
+		}
+
+		return result;
+	}
+
+	void Hooks::SetHookProfiling(unsigned sample_every)
+	{
+		profile_sample_every_ = sample_every;
+
+		for (auto& multiplexed : multiplexed_)
+		{
+			multiplexed.second.handlers->sample_every = sample_every;
+		}
+	}
+
+	std::string Hooks::GetHookProfile(bool reset)
+	{
+		std::string profile = "function,plugin,kind,calls,handled,sampled,avg_ns,max_ns";
+
+		const auto add_row = [&profile](const std::string& func_name, const std::string& plugin, const char* kind,
+		                                const ArkApi::HookHandlerStats& stats)
+		{
+			profile += "\n" + func_name + "," + plugin + "," + kind
+				+ "," + std::to_string(stats.calls)
+				+ "," + std::to_string(stats.handled)
+				+ "," + std::to_string(stats.sampled)
+				+ "," + std::to_string(stats.sampled > 0 ? stats.sampled_ns / stats.sampled : 0)
+				+ "," + std::to_string(stats.max_ns);
+		};
+
+		for (auto& multiplexed : multiplexed_)
+		{
+			ArkApi::HookHandlers& handlers = *multiplexed.second.handlers;
+
+			for (size_t i = 0; i < handlers.handlers.size(); ++i)
+			{
+				add_row(multiplexed.first, ModuleNameOf(handlers.handlers[i]), "handler", handlers.stats[i]);
+			}
+
+			add_row(multiplexed.first, "game", "original", handlers.original_stats);
+
+			if (reset)
+			{
+				std::fill(handlers.stats.begin(), handlers.stats.end(), ArkApi::HookHandlerStats());
+				handlers.original_stats = ArkApi::HookHandlerStats();
+			}
+		}
+
+		// Called straight from the chain, the API never sees these calls
+		for (const auto& hooks : all_hooks_)
+		{
+			const auto multiplexed = multiplexed_.find(hooks.first);
+
+			for (const auto& hook : hooks.second)
+			{
+				if (multiplexed == multiplexed_.end() || hook->detour != multiplexed->second.installed_detour)
+				{
+					profile += "\n" + hooks.first + "," + ModuleNameOf(hook->detour) + ",detour,,,,,";
+				}
+			}
+		}
+
+		return profile;
+	}
 } // namespace API
 
 // Free function
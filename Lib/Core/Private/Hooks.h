@@ -23,6 +23,16 @@ namespace API
 
 		bool DisableHook(const std::string& func_name, LPVOID detour) override;
 
+		bool AddHookHandlerInternal(const std::string& func_name, LPVOID detour, LPVOID handler,
+		                            ArkApi::HookHandlers** handlers) override;
+		bool RemoveHookHandler(const std::string& func_name, LPVOID handler) override;
+
+		void BeginBatch() override;
+		bool ApplyBatch() override;
+
+		void SetHookProfiling(unsigned sample_every) override;
+		std::string GetHookProfile(bool reset) override;
+
 	private:
 		struct Hook
 		{
@@ -38,6 +48,29 @@ namespace API
 			LPVOID* original;
 		};
 
+		struct HandlerOwner
+		{
+			LPVOID handler;
+			// HookMultiplexer::Detour compiled into the plugin that added the handler
+			LPVOID detour;
+		};
+
+		struct Multiplexed
+		{
+			std::unique_ptr<ArkApi::HookHandlers> handlers;
+			std::vector<HandlerOwner> owners;
+			LPVOID installed_detour;
+		};
+
 		std::unordered_map<std::string, std::vector<std::shared_ptr<Hook>>> all_hooks_;
+		std::unordered_map<std::string, Multiplexed> multiplexed_;
+
+		// Hooks are queued instead of enabled one by one while above 0
+		int batch_depth_{0};
+		// Hooks disabled during the batch, still created in MinHook until ApplyBatch
+		std::unordered_map<std::string, std::vector<std::shared_ptr<Hook>>> removed_hooks_;
+
+		// Given to every multiplexed hook, the ones added later too
+		unsigned profile_sample_every_{0};
 	};
 } // namespace API
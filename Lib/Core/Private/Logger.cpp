@@ -1,15 +1,35 @@
 #include <Logger/Logger.h>
 #include <Tools.h>
 
+#include "MappedRingSink.h"
+
+namespace
+{
+	// Records waiting for the flusher, a few seconds of a raid's worth of messages from every plugin
+	constexpr size_t log_ring_capacity = 4 * 1024 * 1024;
+
+	spdlog::sink_ptr CreateFileSink()
+	{
+		const std::string base_path = API::Tools::GetCurrentDir() + "/logs/ArkApi_" + std::to_string(GetCurrentProcessId());
+
+		auto file_sink = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(
+			spdlog::sinks::default_daily_file_name_calculator::calc_filename(base_path + ".log"), 1024 * 1024, 5);
+
+		// Plugin threads only copy into the ring, the file is written by its flusher
+		auto ring_sink = std::make_shared<API::MappedRingSink>(base_path + ".ring", log_ring_capacity, file_sink);
+
+		if (ring_sink->IsMapped())
+			return ring_sink;
+
+		return file_sink;
+	}
+}
+
 std::vector<spdlog::sink_ptr>& GetLogSinks()
 {
 	static std::vector<spdlog::sink_ptr> sinks{
 		std::make_shared<spdlog::sinks::wincolor_stdout_sink_mt>(),
-		std::make_shared<spdlog::sinks::rotating_file_sink_mt>(
-			spdlog::sinks::default_daily_file_name_calculator::
-			calc_filename(
-				API::Tools::GetCurrentDir() + "/logs/ArkApi_" + std::to_string(GetCurrentProcessId()) + ".log"),
-			1024 * 1024, 5)
+		CreateFileSink()
 	};
 
 	return sinks;
@@ -0,0 +1,244 @@
+#include "MappedRingSink.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace API
+{
+	MappedRingSink::MappedRingSink(const std::string& path, size_t capacity, spdlog::sink_ptr target)
+		: target_(std::move(target)),
+		  capacity_(capacity)
+	{
+		const uint64_t file_size = sizeof(Header) + capacity_;
+
+		file_ = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS,
+		                    FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file_ == INVALID_HANDLE_VALUE)
+			return;
+
+		mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READWRITE, static_cast<DWORD>(file_size >> 32),
+		                              static_cast<DWORD>(file_size), nullptr);
+		if (!mapping_)
+			return;
+
+		auto* view = static_cast<char*>(MapViewOfFile(mapping_, FILE_MAP_ALL_ACCESS, 0, 0, 0));
+		if (!view)
+			return;
+
+		header_ = new(view) Header{magic_, version_, capacity_, {0}, {0}, {0}};
+		data_ = view + sizeof(Header);
+
+		thread_ = std::thread(&MappedRingSink::Run, this);
+	}
+
+	MappedRingSink::~MappedRingSink()
+	{
+		if (!header_)
+		{
+			if (mapping_)
+				CloseHandle(mapping_);
+			if (file_ != INVALID_HANDLE_VALUE)
+				CloseHandle(file_);
+			return;
+		}
+
+		stop_ = true;
+		Wake();
+
+		// Destroyed with the static sinks on process exit, where the flusher may already be gone, so it is not joined
+		std::unique_lock<std::mutex> lock(wake_mutex_);
+		const bool finished = done_cv_.wait_for(lock, std::chrono::seconds(1), [this] { return done_; });
+		lock.unlock();
+
+		thread_.detach();
+
+		// A flusher that is still running keeps its mapping, the process is going away anyway
+		if (finished)
+		{
+			FlushViewOfFile(header_, 0);
+			UnmapViewOfFile(header_);
+			CloseHandle(mapping_);
+			CloseHandle(file_);
+		}
+	}
+
+	bool MappedRingSink::IsMapped() const
+	{
+		return header_ != nullptr;
+	}
+
+	uint64_t MappedRingSink::RecordSize(size_t text_size)
+	{
+		return (sizeof(RecordHeader) + text_size + 7) & ~static_cast<uint64_t>(7);
+	}
+
+	void MappedRingSink::CopyIn(uint64_t position, const void* data, size_t size)
+	{
+		const uint64_t offset = position % capacity_;
+		const size_t first = static_cast<size_t>(std::min<uint64_t>(size, capacity_ - offset));
+
+		memcpy(data_ + offset, data, first);
+		memcpy(data_, static_cast<const char*>(data) + first, size - first);
+	}
+
+	void MappedRingSink::CopyOut(uint64_t position, void* data, size_t size) const
+	{
+		const uint64_t offset = position % capacity_;
+		const size_t first = static_cast<size_t>(std::min<uint64_t>(size, capacity_ - offset));
+
+		memcpy(data, data_ + offset, first);
+		memcpy(static_cast<char*>(data) + first, data_, size - first);
+	}
+
+	void MappedRingSink::log(const spdlog::details::log_msg& msg)
+	{
+		if (!header_)
+		{
+			target_->log(msg);
+			return;
+		}
+
+		const size_t text_size = msg.formatted.size();
+		const uint64_t record_size = RecordSize(text_size);
+
+		// Would never fit
+		if (record_size > capacity_ / 2)
+		{
+			header_->dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		std::unique_lock<std::mutex> lock(write_mutex_);
+
+		uint64_t head = header_->head.load(std::memory_order_relaxed);
+
+		if (head + record_size - header_->tail.load(std::memory_order_acquire) > capacity_)
+		{
+			Wake();
+
+			const bool waited = msg.level >= spdlog::level::warn && space_cv_.wait_for(lock, full_wait_, [this, record_size]
+			{
+				return header_->head.load(std::memory_order_relaxed) + record_size
+					- header_->tail.load(std::memory_order_acquire) <= capacity_;
+			});
+
+			if (!waited)
+			{
+				header_->dropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			head = header_->head.load(std::memory_order_relaxed);
+		}
+
+		const RecordHeader record{static_cast<uint32_t>(text_size), static_cast<uint32_t>(msg.level)};
+
+		CopyIn(head, &record, sizeof(record));
+		CopyIn(head + sizeof(record), msg.formatted.data(), text_size);
+
+		header_->head.store(head + record_size, std::memory_order_release);
+		lock.unlock();
+
+		// A burst wakes the flusher early instead of waiting for the interval
+		if (head + record_size - header_->tail.load(std::memory_order_relaxed) > capacity_ / 2)
+		{
+			Wake();
+		}
+	}
+
+	void MappedRingSink::flush()
+	{
+		// Records are in the mapping already, the flusher writes them out within flush_interval_
+		if (!header_)
+		{
+			target_->flush();
+		}
+	}
+
+	void MappedRingSink::Wake()
+	{
+		{
+			std::lock_guard<std::mutex> lock(wake_mutex_);
+			wake_ = true;
+		}
+		wake_cv_.notify_one();
+	}
+
+	void MappedRingSink::Run()
+	{
+		while (!stop_)
+		{
+			{
+				std::unique_lock<std::mutex> lock(wake_mutex_);
+				wake_cv_.wait_for(lock, flush_interval_, [this] { return wake_; });
+				wake_ = false;
+			}
+
+			Drain();
+		}
+
+		// Whatever was logged before the stop
+		Drain();
+
+		std::lock_guard<std::mutex> lock(wake_mutex_);
+		done_ = true;
+		done_cv_.notify_all();
+	}
+
+	void MappedRingSink::Drain()
+	{
+		static const std::string logger_name = "ArkApi";
+
+		uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+		const uint64_t head = header_->head.load(std::memory_order_acquire);
+
+		if (tail == head && header_->dropped.load(std::memory_order_relaxed) == 0)
+			return;
+
+		std::string text;
+
+		try
+		{
+			while (tail < head)
+			{
+				RecordHeader record{};
+				CopyOut(tail, &record, sizeof(record));
+
+				text.resize(record.size);
+				CopyOut(tail + sizeof(record), text.data(), record.size);
+
+				// The text was formatted by the logger already, targets write it as it is
+				spdlog::details::log_msg msg(&logger_name, static_cast<spdlog::level::level_enum>(record.level));
+				msg.formatted.write("{}", text);
+				target_->log(msg);
+
+				tail += RecordSize(record.size);
+			}
+
+			const uint64_t dropped = header_->dropped.exchange(0, std::memory_order_relaxed);
+
+			if (dropped > 0)
+			{
+				spdlog::details::log_msg msg(&logger_name, spdlog::level::warn);
+				msg.formatted.write("[{}][warning] Log ring was full, {} records were dropped{}", logger_name, dropped,
+				                    spdlog::details::os::eol);
+				target_->log(msg);
+			}
+
+			target_->flush();
+		}
+		catch (const std::exception&)
+		{
+			// A target that can't write loses the batch, the ring must keep moving
+		}
+
+		header_->tail.store(head, std::memory_order_release);
+
+		// Taken once so a writer that just found the ring full is already waiting when it is told
+		{
+			std::lock_guard<std::mutex> lock(write_mutex_);
+		}
+		space_cv_.notify_all();
+	}
+} // namespace API
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <Logger/Logger.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace API
+{
+	/**
+	 * \brief Sink that copies formatted records into a memory-mapped ring file, written out to target by a background thread
+	 *
+	 * Logging threads only copy the record into the mapping, the disk writes and flushes all happen on the flusher thread,
+	 * so a burst of messages never waits on the log file. When the ring is full, records below warn are dropped right away
+	 * and warnings and errors wait up to full_wait_ for the flusher to make room, the number dropped is written to target
+	 * once there is room again. Records not flushed yet are still in the ring file after a crash.
+	 */
+	class MappedRingSink : public spdlog::sinks::sink
+	{
+	public:
+		MappedRingSink(const std::string& path, size_t capacity, spdlog::sink_ptr target);
+		~MappedRingSink() override;
+
+		MappedRingSink(const MappedRingSink&) = delete;
+		MappedRingSink(MappedRingSink&&) = delete;
+		MappedRingSink& operator=(const MappedRingSink&) = delete;
+		MappedRingSink& operator=(MappedRingSink&&) = delete;
+
+		// False when the ring file could not be mapped, records then go to target directly
+		bool IsMapped() const;
+
+		void log(const spdlog::details::log_msg& msg) override;
+
+		// The logger calls it after every info record, the ring is written out on the flusher's schedule instead
+		void flush() override;
+
+	private:
+		// Start of the mapping, the cursors count bytes written and flushed since the file was created
+		struct Header
+		{
+			uint32_t magic;
+			uint32_t version;
+			uint64_t capacity;
+			std::atomic<uint64_t> head;
+			std::atomic<uint64_t> tail;
+			std::atomic<uint64_t> dropped;
+		};
+
+		// In front of every record, the record is padded to a multiple of 8 bytes
+		struct RecordHeader
+		{
+			uint32_t size;
+			uint32_t level;
+		};
+
+		static constexpr uint32_t magic_ = 0x4C4B5241; // "ARKL"
+		static constexpr uint32_t version_ = 1;
+		static constexpr std::chrono::milliseconds flush_interval_{100};
+		static constexpr std::chrono::milliseconds full_wait_{20};
+
+		static uint64_t RecordSize(size_t text_size);
+
+		void CopyIn(uint64_t position, const void* data, size_t size);
+		void CopyOut(uint64_t position, void* data, size_t size) const;
+
+		void Wake();
+		void Run();
+		// Flusher thread, everything between tail and head to target
+		void Drain();
+
+		spdlog::sink_ptr target_;
+
+		HANDLE file_ = INVALID_HANDLE_VALUE;
+		HANDLE mapping_ = nullptr;
+		Header* header_ = nullptr;
+		char* data_ = nullptr;
+		uint64_t capacity_ = 0;
+
+		// Held only while a record is copied in
+		std::mutex write_mutex_;
+		std::mutex wake_mutex_;
+		std::condition_variable wake_cv_;
+		std::condition_variable space_cv_;
+		std::condition_variable done_cv_;
+		std::atomic<bool> stop_{false};
+		bool wake_ = false;
+		bool done_ = false;
+		std::thread thread_;
+	};
+} // namespace API
@@ -43,38 +43,65 @@ namespace API
 	void Offsets::Init(std::unordered_map<std::string, intptr_t>&& offsets_dump,
 	                   std::unordered_map<std::string, BitField>&& bitfields_dump)
 	{
-		offsets_dump_.swap(offsets_dump);
-		bitfields_dump_.swap(bitfields_dump);
+		offsets_dump_ = FlatHashTable<intptr_t>(offsets_dump);
+		bitfields_dump_ = FlatHashTable<BitField>(bitfields_dump);
 	}
 
-	DWORD64 Offsets::GetAddress(const void* base, const std::string& name)
+	intptr_t Offsets::GetOffset(std::string_view name) const
 	{
-		return reinterpret_cast<DWORD64>(base) + static_cast<DWORD64>(offsets_dump_[name]);
+		const intptr_t* offset = offsets_dump_.Find(name);
+		return offset ? *offset : 0;
 	}
 
-	LPVOID Offsets::GetAddress(const std::string& name)
+	DWORD64 Offsets::GetAddress(const void* base, std::string_view name)
 	{
-		return reinterpret_cast<LPVOID>(module_base_ + static_cast<DWORD64>(offsets_dump_[name]));
+		return reinterpret_cast<DWORD64>(base) + static_cast<DWORD64>(GetOffset(name));
 	}
 
-	LPVOID Offsets::GetDataAddress(const std::string& name)
+	LPVOID Offsets::GetAddress(std::string_view name)
 	{
-		return reinterpret_cast<LPVOID>(data_base_ + static_cast<DWORD64>(offsets_dump_[name]));
+		return reinterpret_cast<LPVOID>(module_base_ + static_cast<DWORD64>(GetOffset(name)));
 	}
 
-	BitField Offsets::GetBitField(const void* base, const std::string& name)
+	LPVOID Offsets::GetDataAddress(std::string_view name)
+	{
+		return reinterpret_cast<LPVOID>(data_base_ + static_cast<DWORD64>(GetOffset(name)));
+	}
+
+	BitField Offsets::GetBitField(const void* base, std::string_view name)
 	{
 		return GetBitFieldInternal(base, name);
 	}
 
-	BitField Offsets::GetBitField(LPVOID base, const std::string& name)
+	BitField Offsets::GetBitField(LPVOID base, std::string_view name)
 	{
 		return GetBitFieldInternal(base, name);
 	}
 
-	BitField Offsets::GetBitFieldInternal(const void* base, const std::string& name)
+	std::vector<std::string_view> Offsets::GetNames() const
+	{
+		std::vector<std::string_view> names;
+		names.reserve(offsets_dump_.Size());
+
+		offsets_dump_.ForEachKey([&names](std::string_view name) { names.push_back(name); });
+
+		return names;
+	}
+
+	std::vector<std::string_view> Offsets::GetBitFieldNames() const
+	{
+		std::vector<std::string_view> names;
+		names.reserve(bitfields_dump_.Size());
+
+		bitfields_dump_.ForEachKey([&names](std::string_view name) { names.push_back(name); });
+
+		return names;
+	}
+
+	BitField Offsets::GetBitFieldInternal(const void* base, std::string_view name)
 	{
-		const auto bf = bitfields_dump_[name];
+		const BitField* found = bitfields_dump_.Find(name);
+		const auto bf = found ? *found : BitField();
 		auto cf = BitField();
 		cf.bit_position = bf.bit_position;
 		cf.length = bf.length;
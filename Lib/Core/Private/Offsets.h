@@ -2,7 +2,11 @@
 
 #include <API/Base.h>
 
+#include <string_view>
 #include <unordered_map>
+#include <vector>
+
+#include "FlatHashTable.h"
 
 namespace API
 {
@@ -19,24 +23,30 @@ namespace API
 		void Init(std::unordered_map<std::string, intptr_t>&& offsets_dump,
 		          std::unordered_map<std::string, BitField>&& bitfields_dump);
 
-		DWORD64 GetAddress(const void* base, const std::string& name);
-		LPVOID GetAddress(const std::string& name);
+		DWORD64 GetAddress(const void* base, std::string_view name);
+		LPVOID GetAddress(std::string_view name);
+
+		LPVOID GetDataAddress(std::string_view name);
 
-		LPVOID GetDataAddress(const std::string& name);
+		BitField GetBitField(const void* base, std::string_view name);
+		BitField GetBitField(LPVOID base, std::string_view name);
 
-		BitField GetBitField(const void* base, const std::string& name);
-		BitField GetBitField(LPVOID base, const std::string& name);
+		// Every name in the dumps, they stay valid as long as the offsets are loaded
+		std::vector<std::string_view> GetNames() const;
+		std::vector<std::string_view> GetBitFieldNames() const;
 
 	private:
 		Offsets();
 		~Offsets() = default;
 
-		BitField GetBitFieldInternal(const void* base, const std::string& name);
+		intptr_t GetOffset(std::string_view name) const;
+		BitField GetBitFieldInternal(const void* base, std::string_view name);
 
 		DWORD64 module_base_;
 		DWORD64 data_base_;
 
-		std::unordered_map<std::string, intptr_t> offsets_dump_;
-		std::unordered_map<std::string, BitField> bitfields_dump_;
+		// Read only after Init, lookups of unknown names return 0 without inserting them
+		FlatHashTable<intptr_t> offsets_dump_;
+		FlatHashTable<BitField> bitfields_dump_;
 	};
 } // namespace API
@@ -0,0 +1,192 @@
+#include "OffsetsBenchmark.h"
+
+#include <API/Fields.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "Offsets.h"
+
+namespace API
+{
+	struct OffsetsBenchmarkCase
+	{
+		const char* name;
+		size_t ops;
+		uint64_t ns;
+	};
+
+	// Summed into by every case, so the compiler can't drop the lookups
+	volatile DWORD64 offsets_benchmark_sink = 0;
+
+	template <typename Func>
+	OffsetsBenchmarkCase TimeOffsetsCase(const char* name, unsigned rounds, size_t ops_per_round, Func&& func)
+	{
+		DWORD64 sum = 0;
+		const auto start = std::chrono::steady_clock::now();
+
+		for (unsigned round = 0; round < rounds; ++round)
+		{
+			sum += func();
+		}
+
+		const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+		offsets_benchmark_sink = offsets_benchmark_sink + sum;
+
+		return {name, ops_per_round * rounds, static_cast<uint64_t>(ns)};
+	}
+
+	std::string RunOffsetsBenchmark(unsigned rounds, const std::string& prefix)
+	{
+		auto& offsets = Offsets::Get();
+
+		std::vector<std::string_view> names;
+		std::vector<std::string_view> bitfield_names;
+
+		for (const auto name : offsets.GetNames())
+		{
+			if (name.compare(0, prefix.size(), prefix) == 0)
+				names.push_back(name);
+		}
+
+		for (const auto name : offsets.GetBitFieldNames())
+		{
+			if (name.compare(0, prefix.size(), prefix) == 0)
+				bitfield_names.push_back(name);
+		}
+
+		if (names.empty())
+			return "No offsets match " + prefix;
+
+		// Same order every run, so two builds can be compared
+		std::mt19937_64 random(42);
+		std::shuffle(names.begin(), names.end(), random);
+		std::shuffle(bitfield_names.begin(), bitfield_names.end(), random);
+
+		const std::vector<std::string> strings(names.begin(), names.end());
+		const std::vector<std::string> bitfield_strings(bitfield_names.begin(), bitfield_names.end());
+
+		// What GetCachedFieldOffset keeps per accessor after the first call
+		std::vector<std::atomic<intptr_t>> slots(names.size());
+		for (size_t i = 0; i < names.size(); ++i)
+		{
+			slots[i].store(static_cast<intptr_t>(offsets.GetAddress(nullptr, names[i])), std::memory_order_relaxed);
+		}
+
+		std::vector<BitField> bitfields;
+		bitfields.reserve(bitfield_names.size());
+		for (const auto name : bitfield_names)
+		{
+			bitfields.push_back(offsets.GetBitField(static_cast<const void*>(nullptr), name));
+		}
+
+		// Never dereferenced, only added to
+		const void* base = reinterpret_cast<const void*>(0x10000);
+		const size_t count = names.size();
+
+		std::vector<OffsetsBenchmarkCase> cases;
+
+		// The accessors before the offset slots, a std::string made from the literal on every read
+		cases.push_back(TimeOffsetsCase("string_from_literal", rounds, count, [&strings, base]()
+		{
+			DWORD64 sum = 0;
+			for (const auto& name : strings)
+			{
+				sum += ::GetAddress(base, std::string(name.c_str()));
+			}
+			return sum;
+		}));
+
+		cases.push_back(TimeOffsetsCase("string_lookup", rounds, count, [&strings, base]()
+		{
+			DWORD64 sum = 0;
+			for (const auto& name : strings)
+			{
+				sum += ::GetAddress(base, name);
+			}
+			return sum;
+		}));
+
+		cases.push_back(TimeOffsetsCase("view_lookup", rounds, count, [&offsets, &names, base]()
+		{
+			DWORD64 sum = 0;
+			for (const auto name : names)
+			{
+				sum += offsets.GetAddress(base, name);
+			}
+			return sum;
+		}));
+
+		cases.push_back(TimeOffsetsCase("resolved_slot", rounds, count, [&slots, base]()
+		{
+			DWORD64 sum = 0;
+			for (const auto& slot : slots)
+			{
+				sum += reinterpret_cast<DWORD64>(base) + slot.load(std::memory_order_relaxed);
+			}
+			return sum;
+		}));
+
+		// The generated accessors themselves, fields plugins read on every damage hit
+		cases.push_back(TimeOffsetsCase("accessor", rounds, count, [count, base]()
+		{
+			DWORD64 sum = 0;
+			for (size_t i = 0; i < count; i += 4)
+			{
+				sum += reinterpret_cast<DWORD64>(::GetNativePointerField<int*, FieldNameHash("AActor.TargetingTeam")>(base, "AActor.TargetingTeam"));
+				sum += reinterpret_cast<DWORD64>(::GetNativePointerField<void**, FieldNameHash("AController.PlayerState")>(base, "AController.PlayerState"));
+				sum += reinterpret_cast<DWORD64>(::GetNativePointerField<void**, FieldNameHash("APawn.Controller")>(base, "APawn.Controller"));
+				sum += reinterpret_cast<DWORD64>(::GetNativePointerField<void**, FieldNameHash("APrimalCharacter.MyCharacterStatusComponent")>(base, "APrimalCharacter.MyCharacterStatusComponent"));
+			}
+			return sum;
+		}));
+
+		if (!bitfield_strings.empty())
+		{
+			cases.push_back(TimeOffsetsCase("bitfield_lookup", rounds, bitfield_strings.size(), [&bitfield_strings, base]()
+			{
+				DWORD64 sum = 0;
+				for (const auto& name : bitfield_strings)
+				{
+					sum += ::GetBitField(base, name).offset;
+				}
+				return sum;
+			}));
+
+			cases.push_back(TimeOffsetsCase("bitfield_resolved", rounds, bitfields.size(), [&bitfields, base]()
+			{
+				DWORD64 sum = 0;
+				for (const auto& bitfield : bitfields)
+				{
+					sum += reinterpret_cast<DWORD64>(base) + bitfield.offset;
+				}
+				return sum;
+			}));
+		}
+
+		const auto ns_per_op = [](const OffsetsBenchmarkCase& result)
+		{
+			return result.ops > 0 ? static_cast<double>(result.ns) / static_cast<double>(result.ops) : 0.0;
+		};
+
+		const double resolved = ns_per_op(cases[3]);
+
+		std::string reply = "case,names,ops,ns_per_op,vs_resolved_slot";
+
+		for (const auto& result : cases)
+		{
+			const double per_op = ns_per_op(result);
+
+			reply += "\n" + std::string(result.name)
+				+ "," + std::to_string(count)
+				+ "," + std::to_string(result.ops)
+				+ "," + std::to_string(per_op)
+				+ "," + std::to_string(resolved > 0 ? per_op / resolved : 0.0);
+		}
+
+		return reply;
+	}
+} // namespace API
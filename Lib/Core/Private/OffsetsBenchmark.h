@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string>
+
+namespace API
+{
+	/**
+	 * \brief Times field lookups by name against the resolved slots the generated accessors read, as CSV
+	 *
+	 * Every name in the offsets dump that starts with prefix is looked up rounds times, in a shuffled order so the
+	 * table isn't read front to back. Runs on the calling thread, with the server waiting.
+	 */
+	std::string RunOffsetsBenchmark(unsigned rounds, const std::string& prefix);
+} // namespace API
@@ -1,13 +1,17 @@
 #include "PDBReader.h"
 
+#include <algorithm>
 #include <comdef.h>
+#include <exception>
 #include <fstream>
+#include <thread>
 
 #include <Logger/Logger.h>
 #include <Tools.h>
 
 #include "../Private/Helpers.h"
 #include "../Private/Offsets.h"
+#include "PdbCache.h"
 
 namespace API
 {
@@ -53,17 +57,31 @@ namespace API
 			throw;
 		}
 
-		Log::GetLog()->info("Dumping structures..");
-		DumpStructs(symbol);
+		GUID guid{};
+		DWORD age = 0;
+		symbol->get_guid(&guid);
+		symbol->get_age(&age);
 
-		Log::GetLog()->info("Dumping functions..");
-		DumpFreeFunctions(symbol);
+		const PdbCache cache(Tools::GetCurrentDir() + "/OffsetsCache.bin");
+		const PdbCacheKey cache_key = PdbCache::MakeKey(guid, age, config_.dump());
 
-		Log::GetLog()->info("Dumping globals..");
-		DumpGlobalVariables(symbol);
+		if (cache.Load(cache_key, offsets_dump_, bitfields_dump_))
+		{
+			Cleanup(symbol, dia_session);
+
+			Log::GetLog()->info("Loaded {} offsets from cache\n", offsets_dump_->size() + bitfields_dump_->size());
+			return;
+		}
+
+		const unsigned part_count = std::clamp(std::thread::hardware_concurrency(), 1u, 8u);
+
+		Log::GetLog()->info("Dumping structures, functions and globals on {} threads..", part_count);
+		DumpParallel(path, symbol, part_count);
 
 		Cleanup(symbol, dia_session);
 
+		cache.Save(cache_key, *offsets_dump_, *bitfields_dump_);
+
 		Log::GetLog()->info("Successfully read information from PDB\n");
 	}
 
@@ -128,6 +146,115 @@ namespace API
 		class_factory->Release();
 	}
 
+	void PdbReader::DumpParallel(const std::wstring& path, IDiaSymbol* g_symbol, unsigned part_count)
+	{
+		struct Part
+		{
+			std::unordered_map<std::string, intptr_t> offsets;
+			std::unordered_map<std::string, BitField> bitfields;
+			std::exception_ptr error;
+		};
+
+		std::vector<Part> parts(part_count);
+
+		const auto dump_part = [this, &parts, part_count](unsigned index, IDiaSymbol* symbol)
+		{
+			PdbReader reader;
+			reader.config_ = config_;
+			reader.offsets_dump_ = &parts[index].offsets;
+			reader.bitfields_dump_ = &parts[index].bitfields;
+			reader.part_index_ = index;
+			reader.part_count_ = part_count;
+
+			reader.DumpStructs(symbol);
+			reader.DumpFreeFunctions(symbol);
+			reader.DumpGlobalVariables(symbol);
+		};
+
+		// DIA sessions can't be shared between threads, every worker opens the pdb on its own
+		std::vector<std::thread> workers;
+		workers.reserve(part_count - 1);
+
+		for (unsigned index = 1; index < part_count; ++index)
+		{
+			workers.emplace_back([&path, &parts, &dump_part, index]()
+			{
+				IDiaDataSource* data_source = nullptr;
+				IDiaSession* dia_session = nullptr;
+				IDiaSymbol* symbol = nullptr;
+
+				try
+				{
+					LoadDataFromPdb(path, &data_source, &dia_session, &symbol);
+					dump_part(index, symbol);
+				}
+				catch (...)
+				{
+					parts[index].error = std::current_exception();
+				}
+
+				if (symbol != nullptr)
+				{
+					symbol->Release();
+				}
+
+				if (dia_session != nullptr)
+				{
+					dia_session->Release();
+				}
+
+				if (data_source != nullptr)
+				{
+					data_source->Release();
+				}
+			});
+		}
+
+		try
+		{
+			dump_part(0, g_symbol);
+		}
+		catch (...)
+		{
+			parts[0].error = std::current_exception();
+		}
+
+		for (auto& worker : workers)
+		{
+			worker.join();
+		}
+
+		for (auto& part : parts)
+		{
+			if (part.error)
+			{
+				std::rethrow_exception(part.error);
+			}
+
+			offsets_dump_->insert(part.offsets.begin(), part.offsets.end());
+			bitfields_dump_->insert(part.bitfields.begin(), part.bitfields.end());
+		}
+	}
+
+	std::pair<LONG, LONG> PdbReader::GetPartRange(IDiaEnumSymbols* enum_symbols) const
+	{
+		LONG count = 0;
+		if (FAILED(enum_symbols->get_Count(&count)))
+		{
+			throw std::runtime_error("Failed to count symbols");
+		}
+
+		const LONG first = static_cast<LONG>(static_cast<int64_t>(count) * part_index_ / part_count_);
+		const LONG last = static_cast<LONG>(static_cast<int64_t>(count) * (part_index_ + 1) / part_count_);
+
+		if (first > 0 && FAILED(enum_symbols->Skip(first)))
+		{
+			throw std::runtime_error("Failed to skip symbols");
+		}
+
+		return {first, last};
+	}
+
 	bool PdbReader::ReadConfig()
 	{
 		const std::string config_path = Tools::GetCurrentDir() + "/config.json";
@@ -155,8 +282,10 @@ namespace API
 			throw std::runtime_error("Failed to find symbols");
 		}
 
+		auto [index, last] = GetPartRange(enum_symbols);
+
 		ULONG celt = 0;
-		while (SUCCEEDED(enum_symbols->Next(1, &symbol, &celt)) && celt == 1)
+		while (index++ < last && SUCCEEDED(enum_symbols->Next(1, &symbol, &celt)) && celt == 1)
 		{
 			BSTR bstr_name;
 			if (symbol->get_name(&bstr_name) != S_OK)
@@ -194,8 +323,10 @@ namespace API
 			throw std::runtime_error("Failed to find symbols");
 		}
 
+		auto [index, last] = GetPartRange(enum_symbols);
+
 		ULONG celt = 0;
-		while (SUCCEEDED(enum_symbols->Next(1, &symbol, &celt)) && celt == 1)
+		while (index++ < last && SUCCEEDED(enum_symbols->Next(1, &symbol, &celt)) && celt == 1)
 		{
 			BSTR bstr_name;
 			if (symbol->get_name(&bstr_name) != S_OK)
@@ -238,8 +369,10 @@ namespace API
 			throw std::runtime_error("Failed to find symbols");
 		}
 
+		auto [index, last] = GetPartRange(enum_symbols);
+
 		ULONG celt = 0;
-		while (SUCCEEDED(enum_symbols->Next(1, &symbol, &celt)) && celt == 1)
+		while (index++ < last && SUCCEEDED(enum_symbols->Next(1, &symbol, &celt)) && celt == 1)
 		{
 			BSTR bstr_name;
 			if (symbol->get_name(&bstr_name) != S_OK)
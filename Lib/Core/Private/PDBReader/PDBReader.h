@@ -22,6 +22,8 @@ namespace API
 		static void LoadDataFromPdb(const std::wstring& /*path*/, IDiaDataSource** /*dia_source*/, IDiaSession**
 		                            /*session*/, IDiaSymbol** /*symbol*/);
 		bool ReadConfig();
+		void DumpParallel(const std::wstring& /*path*/, IDiaSymbol* /*g_symbol*/, unsigned /*part_count*/);
+		std::pair<LONG, LONG> GetPartRange(IDiaEnumSymbols* /*enum_symbols*/) const;
 		void DumpStructs(IDiaSymbol* /*g_symbol*/);
 		void DumpFreeFunctions(IDiaSymbol* /*g_symbol*/);
 		void DumpGlobalVariables(IDiaSymbol* /*g_symbol*/);
@@ -35,5 +37,9 @@ namespace API
 		std::unordered_map<std::string, BitField>* bitfields_dump_{nullptr};
 
 		nlohmann::json config_;
+
+		// Slice of every symbol enumeration handled by this reader
+		unsigned part_index_{0};
+		unsigned part_count_{1};
 	};
 } // namespace API
@@ -0,0 +1,233 @@
+#include "PdbCache.h"
+
+#include <filesystem>
+#include <fstream>
+
+#include <Logger/Logger.h>
+
+namespace API
+{
+	namespace
+	{
+		constexpr char cache_magic[8] = {'A', 'P', 'I', 'P', 'D', 'B', 'C', 0};
+		constexpr uint32_t cache_version = 1;
+
+#pragma pack(push, 1)
+		struct CacheHeader
+		{
+			char magic[8];
+			uint32_t version;
+			GUID guid;
+			DWORD age;
+			uint64_t config_hash;
+			uint64_t offsets_count;
+			uint64_t bitfields_count;
+		};
+
+		// Each record is followed by name_size bytes of the name
+		struct OffsetRecord
+		{
+			uint32_t name_size;
+			int64_t offset;
+		};
+
+		struct BitFieldRecord
+		{
+			uint32_t name_size;
+			BitField bit_field;
+		};
+#pragma pack(pop)
+
+		// Unmaps and closes the handles on every return path of Load
+		struct MappedFile
+		{
+			HANDLE file{INVALID_HANDLE_VALUE};
+			HANDLE mapping{nullptr};
+			const char* view{nullptr};
+			uint64_t size{0};
+
+			~MappedFile()
+			{
+				if (view != nullptr)
+					UnmapViewOfFile(view);
+				if (mapping != nullptr)
+					CloseHandle(mapping);
+				if (file != INVALID_HANDLE_VALUE)
+					CloseHandle(file);
+			}
+		};
+
+		template <typename Record>
+		bool ReadRecord(const char*& cursor, const char* end, Record& record, std::string& name)
+		{
+			if (static_cast<size_t>(end - cursor) < sizeof(Record))
+				return false;
+
+			memcpy(&record, cursor, sizeof(Record));
+			cursor += sizeof(Record);
+
+			if (static_cast<size_t>(end - cursor) < record.name_size)
+				return false;
+
+			name.assign(cursor, record.name_size);
+			cursor += record.name_size;
+
+			return true;
+		}
+	} // namespace
+
+	PdbCache::PdbCache(std::string path)
+		: path_(std::move(path))
+	{
+	}
+
+	PdbCacheKey PdbCache::MakeKey(const GUID& guid, DWORD age, const std::string& config_dump)
+	{
+		// FNV-1a of the merged config, its arrays are sorted so the same names give the same hash
+		uint64_t hash = 14695981039346656037ull;
+
+		for (const char c : config_dump)
+		{
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 1099511628211ull;
+		}
+
+		return PdbCacheKey{guid, age, hash};
+	}
+
+	bool PdbCache::Load(const PdbCacheKey& key, std::unordered_map<std::string, intptr_t>* offsets_dump,
+	                    std::unordered_map<std::string, BitField>* bitfields_dump) const
+	{
+		MappedFile mapped;
+
+		mapped.file = CreateFileA(path_.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+		                          FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (mapped.file == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+
+		LARGE_INTEGER file_size;
+		if (!GetFileSizeEx(mapped.file, &file_size) || static_cast<uint64_t>(file_size.QuadPart) < sizeof(CacheHeader))
+		{
+			return false;
+		}
+
+		mapped.size = static_cast<uint64_t>(file_size.QuadPart);
+
+		mapped.mapping = CreateFileMappingA(mapped.file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapped.mapping == nullptr)
+		{
+			return false;
+		}
+
+		mapped.view = static_cast<const char*>(MapViewOfFile(mapped.mapping, FILE_MAP_READ, 0, 0, 0));
+		if (mapped.view == nullptr)
+		{
+			return false;
+		}
+
+		CacheHeader header;
+		memcpy(&header, mapped.view, sizeof(CacheHeader));
+
+		if (memcmp(header.magic, cache_magic, sizeof(cache_magic)) != 0 || header.version != cache_version)
+		{
+			return false;
+		}
+
+		if (header.guid != key.guid || header.age != key.age || header.config_hash != key.config_hash)
+		{
+			Log::GetLog()->info("Offsets cache is outdated, reading pdb");
+			return false;
+		}
+
+		const char* cursor = mapped.view + sizeof(CacheHeader);
+		const char* end = mapped.view + mapped.size;
+
+		std::unordered_map<std::string, intptr_t> offsets;
+		std::unordered_map<std::string, BitField> bitfields;
+
+		offsets.reserve(static_cast<size_t>(header.offsets_count));
+		bitfields.reserve(static_cast<size_t>(header.bitfields_count));
+
+		std::string name;
+
+		for (uint64_t i = 0; i < header.offsets_count; ++i)
+		{
+			OffsetRecord record;
+			if (!ReadRecord(cursor, end, record, name))
+			{
+				Log::GetLog()->warn("Offsets cache is truncated, reading pdb");
+				return false;
+			}
+
+			offsets.emplace(name, static_cast<intptr_t>(record.offset));
+		}
+
+		for (uint64_t i = 0; i < header.bitfields_count; ++i)
+		{
+			BitFieldRecord record;
+			if (!ReadRecord(cursor, end, record, name))
+			{
+				Log::GetLog()->warn("Offsets cache is truncated, reading pdb");
+				return false;
+			}
+
+			bitfields.emplace(name, record.bit_field);
+		}
+
+		offsets_dump->swap(offsets);
+		bitfields_dump->swap(bitfields);
+
+		return true;
+	}
+
+	void PdbCache::Save(const PdbCacheKey& key, const std::unordered_map<std::string, intptr_t>& offsets_dump,
+	                    const std::unordered_map<std::string, BitField>& bitfields_dump) const
+	{
+		const std::string temp_path = path_ + ".tmp";
+
+		CacheHeader header{};
+		memcpy(header.magic, cache_magic, sizeof(cache_magic));
+		header.version = cache_version;
+		header.guid = key.guid;
+		header.age = key.age;
+		header.config_hash = key.config_hash;
+		header.offsets_count = offsets_dump.size();
+		header.bitfields_count = bitfields_dump.size();
+
+		{
+			std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+			file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+			for (const auto& item : offsets_dump)
+			{
+				const OffsetRecord record{static_cast<uint32_t>(item.first.size()), static_cast<int64_t>(item.second)};
+				file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+				file.write(item.first.data(), item.first.size());
+			}
+
+			for (const auto& item : bitfields_dump)
+			{
+				const BitFieldRecord record{static_cast<uint32_t>(item.first.size()), item.second};
+				file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+				file.write(item.first.data(), item.first.size());
+			}
+
+			if (!file)
+			{
+				Log::GetLog()->warn("Failed to write offsets cache {}", temp_path);
+				return;
+			}
+		}
+
+		// A crash while writing leaves the old cache or none, never a partial one
+		std::error_code error;
+		std::filesystem::rename(temp_path, path_, error);
+
+		if (error)
+		{
+			Log::GetLog()->warn("Failed to replace offsets cache {} - {}", path_, error.message());
+		}
+	}
+} // namespace API
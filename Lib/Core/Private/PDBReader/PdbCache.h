@@ -0,0 +1,48 @@
+#pragma once
+
+#include <API/Base.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+namespace API
+{
+	/**
+	 * \brief Identifies one pdb build and the set of names dumped from it
+	 */
+	struct PdbCacheKey
+	{
+		GUID guid;
+		DWORD age;
+		uint64_t config_hash;
+	};
+
+	/**
+	 * \brief Binary file with the offsets and bitfields of the last pdb read
+	 *
+	 * Valid only while the pdb guid/age and the merged pdb config are unchanged, a game update or a plugin
+	 * asking for new names rebuilds it.
+	 */
+	class PdbCache
+	{
+	public:
+		explicit PdbCache(std::string path);
+
+		static PdbCacheKey MakeKey(const GUID& guid, DWORD age, const std::string& config_dump);
+
+		/**
+		 * \brief Maps the cache file and fills the dumps from it
+		 * \return False if the file is missing, damaged or was written for another key
+		 */
+		bool Load(const PdbCacheKey& key, std::unordered_map<std::string, intptr_t>* offsets_dump,
+		          std::unordered_map<std::string, BitField>* bitfields_dump) const;
+
+		void Save(const PdbCacheKey& key, const std::unordered_map<std::string, intptr_t>& offsets_dump,
+		          const std::unordered_map<std::string, BitField>& bitfields_dump) const;
+
+	private:
+		std::string path_;
+	};
+} // namespace API
@@ -1,10 +1,13 @@
 #include "PluginManager.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
 
 #include <Logger/Logger.h>
+#include <ThreadPool.h>
+#include <Timer.h>
 #include <Tools.h>
 
 #include "../Helpers.h"
@@ -12,11 +15,7 @@
 
 namespace API
 {
-	PluginManager::PluginManager()
-	{
-		//commands.AddOnTimerCallback(L"PluginManager.DetectPluginChangesTimerCallback",
-		//                          &DetectPluginChangesTimerCallback);
-	}
+	PluginManager::PluginManager() = default;
 
 	PluginManager& PluginManager::Get()
 	{
@@ -98,6 +97,8 @@ namespace API
 
 		const std::string dir_path = Tools::GetCurrentDir() + "/" + game_api->GetApiName() + "/Plugins";
 
+		std::vector<std::string> plugin_names;
+
 		for (const auto& dir_name : fs::directory_iterator(dir_path))
 		{
 			const auto& path = dir_name.path();
@@ -121,6 +122,24 @@ namespace API
 					copy_file(new_full_dll_path, full_dll_path, fs::copy_options::overwrite_existing);
 					fs::remove(new_full_dll_path);
 				}
+			}
+			catch (const std::exception& error)
+			{
+				Log::GetLog()->warn("({}) {}", __FUNCTION__, error.what());
+			}
+
+			plugin_names.push_back(filename);
+		}
+
+		// Plugin_Init runs one plugin at a time in dependency order, Plugin_InitAsync of several plugins at once
+		defer_async_init_ = true;
+
+		for (const std::string& filename : SortPluginsByDependencies(plugin_names))
+		{
+			try
+			{
+				// A plugin may use its dependencies from Plugin_Init, so they have to be fully initialized
+				WaitForAsyncInits(ReadPluginInfo(filename)["Dependencies"].get<std::vector<std::string>>());
 
 				std::stringstream stream;
 
@@ -138,6 +157,9 @@ namespace API
 			}
 		}
 
+		WaitForAsyncInits({});
+		defer_async_init_ = false;
+
 		CheckPluginsDependencies();
 
 		// Set auto plugins reloading
@@ -148,6 +170,8 @@ namespace API
 		{
 			reload_sleep_seconds_ = settings["settings"].value("AutomaticPluginReloadSeconds", 5);
 			save_world_before_reload_ = settings["settings"].value("SaveWorldBeforePluginReload", true);
+
+			StartChangeWatcher();
 		}
 
 		Log::GetLog()->info("Loaded all plugins\n");
@@ -195,6 +219,14 @@ namespace API
 			pfn_init();
 		}
 
+		// Plugin_InitAsync (if found) is the part of the init that doesn't touch the game, it must not add hooks or commands
+		using pfnPluginInitAsync = void(__fastcall*)();
+		const auto pfn_init_async = reinterpret_cast<pfnPluginInitAsync>(GetProcAddress(h_module, "Plugin_InitAsync"));
+		if (pfn_init_async != nullptr)
+		{
+			RunAsyncInit(plugin_name, pfn_init_async);
+		}
+
 		return loaded_plugins_.emplace_back(std::make_shared<Plugin>(h_module, plugin_name, plugin_info["FullName"],
 		                                                             plugin_info["Description"], plugin_info["Version"],
 		                                                             plugin_info["MinApiVersion"],
@@ -228,6 +260,10 @@ namespace API
 			pfn_unload();
 		}
 
+		// Nothing may call into the plugin once its code is unmapped
+		Timer::Get().RemoveTasks(plugin_name);
+		ThreadPool::Get().Cancel(plugin_name);
+
 		const BOOL result = FreeLibrary((*iter)->h_module);
 		if (result == 0)
 		{
@@ -289,6 +325,107 @@ namespace API
 		}
 	}
 
+	std::vector<std::string> PluginManager::SortPluginsByDependencies(const std::vector<std::string>& plugin_names)
+	{
+		std::unordered_map<std::string, std::vector<std::string>> dependencies;
+
+		for (const std::string& plugin_name : plugin_names)
+		{
+			dependencies[plugin_name] = ReadPluginInfo(plugin_name)["Dependencies"].get<std::vector<std::string>>();
+		}
+
+		std::vector<std::string> sorted;
+		std::unordered_set<std::string> placed;
+		std::vector<std::string> remaining = plugin_names;
+
+		while (!remaining.empty())
+		{
+			const size_t before = remaining.size();
+
+			remaining.erase(std::remove_if(remaining.begin(), remaining.end(), [&](const std::string& plugin_name)
+			{
+				// Missing dependencies are reported by CheckPluginsDependencies
+				for (const std::string& dependency : dependencies[plugin_name])
+				{
+					if (dependencies.count(dependency) != 0 && placed.count(dependency) == 0)
+					{
+						return false;
+					}
+				}
+
+				sorted.push_back(plugin_name);
+				placed.insert(plugin_name);
+				return true;
+			}), remaining.end());
+
+			if (remaining.size() == before)
+			{
+				for (const std::string& plugin_name : remaining)
+				{
+					Log::GetLog()->error("Plugin {} is part of a dependency cycle, it is loaded last", plugin_name);
+					sorted.push_back(plugin_name);
+				}
+				break;
+			}
+		}
+
+		return sorted;
+	}
+
+	void PluginManager::RunAsyncInit(const std::string& plugin_name, void(__fastcall* pfn_init_async)())
+	{
+		// Reloads run it right away, the game waits for the reload anyway
+		if (!defer_async_init_)
+		{
+			pfn_init_async();
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(init_mutex_);
+			pending_inits_.insert(plugin_name);
+		}
+
+		ThreadPool::Get().Submit(plugin_name, [this, plugin_name, pfn_init_async]()
+		{
+			// The pool catches what the plugin throws, the plugin counts as initialized either way
+			struct Done
+			{
+				PluginManager* manager;
+				const std::string& plugin_name;
+
+				~Done()
+				{
+					{
+						std::lock_guard<std::mutex> lock(manager->init_mutex_);
+						manager->pending_inits_.erase(plugin_name);
+					}
+					manager->init_cv_.notify_all();
+				}
+			} done{this, plugin_name};
+
+			pfn_init_async();
+		});
+	}
+
+	void PluginManager::WaitForAsyncInits(const std::vector<std::string>& plugin_names)
+	{
+		std::unique_lock<std::mutex> lock(init_mutex_);
+
+		init_cv_.wait(lock, [this, &plugin_names]
+		{
+			if (plugin_names.empty())
+			{
+				return pending_inits_.empty();
+			}
+
+			return std::none_of(plugin_names.begin(), plugin_names.end(), [this](const std::string& plugin_name)
+			{
+				return pending_inits_.count(plugin_name) != 0;
+			});
+		});
+	}
+
 	std::vector<std::shared_ptr<Plugin>>::const_iterator PluginManager::FindPlugin(const std::string& plugin_name)
 	{
 		const auto iter = std::find_if(loaded_plugins_.begin(), loaded_plugins_.end(),
@@ -305,6 +442,94 @@ namespace API
 		return FindPlugin(plugin_name) != loaded_plugins_.end();
 	}
 
+	void PluginManager::StartChangeWatcher()
+	{
+		if (watcher_thread_.joinable())
+		{
+			return;
+		}
+
+		const std::wstring dir_path = Tools::Utf8Decode(Tools::GetCurrentDir() + "/" + game_api->GetApiName() + "/Plugins");
+
+		const HANDLE directory = CreateFileW(dir_path.c_str(), FILE_LIST_DIRECTORY,
+		                                     FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+		                                     FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+		if (directory == INVALID_HANDLE_VALUE)
+		{
+			Log::GetLog()->error("({}) Could not watch the plugins folder, error {}", __FUNCTION__, GetLastError());
+			return;
+		}
+
+		// The api is never unloaded, so the thread lives as long as the process
+		watcher_thread_ = std::thread(&PluginManager::WatchPluginChanges, this, directory);
+		watcher_thread_.detach();
+
+		game_api->GetCommands()->AddOnTimerCallback(L"PluginManager.DetectPluginChangesTimerCallback",
+		                                            &DetectPluginChangesTimerCallback);
+	}
+
+	void PluginManager::WatchPluginChanges(HANDLE directory)
+	{
+		alignas(DWORD) char buffer[16 * 1024];
+
+		while (true)
+		{
+			DWORD bytes = 0;
+			if (!ReadDirectoryChangesW(directory, buffer, sizeof(buffer), TRUE,
+			                           FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE,
+			                           &bytes, nullptr, nullptr))
+			{
+				Log::GetLog()->error("({}) Stopped watching the plugins folder, error {}", __FUNCTION__, GetLastError());
+				break;
+			}
+
+			QueueChangedPlugins(buffer, bytes);
+		}
+
+		CloseHandle(directory);
+	}
+
+	void PluginManager::QueueChangedPlugins(const char* buffer, DWORD bytes)
+	{
+		const time_t now = time(nullptr);
+
+		std::lock_guard<std::mutex> lock(changes_mutex_);
+
+		// Too many changes for the buffer, the names are lost
+		if (bytes == 0)
+		{
+			rescan_plugins_ = true;
+			return;
+		}
+
+		for (DWORD offset = 0;;)
+		{
+			const auto* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(buffer + offset);
+			const std::wstring_view name(info->FileName, info->FileNameLength / sizeof(WCHAR));
+
+			// Only <plugin>\<plugin>.dll.ArkApi
+			const size_t separator = name.find(L'\\');
+			if (separator != std::wstring_view::npos)
+			{
+				const std::wstring_view folder = name.substr(0, separator);
+				const std::wstring_view file = name.substr(separator + 1);
+				const std::wstring expected = std::wstring(folder) + L".dll.ArkApi";
+
+				if (file.size() == expected.size() && _wcsnicmp(file.data(), expected.c_str(), expected.size()) == 0)
+				{
+					changed_plugins_[Tools::Utf8Encode(std::wstring(folder))] = now;
+				}
+			}
+
+			if (info->NextEntryOffset == 0)
+			{
+				break;
+			}
+
+			offset += info->NextEntryOffset;
+		}
+	}
+
 	void PluginManager::DetectPluginChangesTimerCallback()
 	{
 		auto& pluginManager = Get();
@@ -315,7 +540,7 @@ namespace API
 			return;
 		}
 
-		pluginManager.next_reload_check_ = now + pluginManager.reload_sleep_seconds_;
+		pluginManager.next_reload_check_ = now + 1;
 
 		pluginManager.DetectPluginChanges();
 	}
@@ -324,53 +549,90 @@ namespace API
 	{
 		namespace fs = std::filesystem;
 
-		// Prevents saving world multiple times if multiple plugins are queued to be reloaded
-		bool save_world = save_world_before_reload_;
+		const time_t now = time(nullptr);
+		std::vector<std::string> plugin_names;
+		bool rescan;
 
-		for (const auto& dir_name : fs::directory_iterator(
-			     Tools::GetCurrentDir() + "/" + game_api->GetApiName() + "/Plugins"))
 		{
-			const auto& path = dir_name.path();
-			if (!is_directory(path))
+			std::lock_guard<std::mutex> lock(changes_mutex_);
+
+			// A file is copied in several writes, it is only picked up once it was left alone for the reload delay
+			for (auto iter = changed_plugins_.begin(); iter != changed_plugins_.end();)
 			{
-				continue;
+				if (now - iter->second >= reload_sleep_seconds_)
+				{
+					plugin_names.push_back(iter->first);
+					iter = changed_plugins_.erase(iter);
+				}
+				else
+				{
+					++iter;
+				}
 			}
 
-			const auto filename = path.filename().stem().generic_string();
-
-			const std::string plugin_folder = path.generic_string() + "/";
-
-			const std::string plugin_file_path = plugin_folder + filename + ".dll";
-			const std::string new_plugin_file_path = plugin_folder + filename + ".dll.ArkApi";
+			rescan = rescan_plugins_;
+			rescan_plugins_ = false;
+		}
 
-			if (fs::exists(new_plugin_file_path) && FindPlugin(filename) != loaded_plugins_.end())
+		if (rescan)
+		{
+			for (const auto& dir_name : fs::directory_iterator(
+				     Tools::GetCurrentDir() + "/" + game_api->GetApiName() + "/Plugins"))
 			{
-				// Save the world in case the unload/load procedure causes crash
-				if (save_world)
+				if (is_directory(dir_name.path()))
 				{
-					//Log::GetLog()->info("Saving world before reloading plugins ...");
-					//ArkApi::GetApiUtils().GetShooterGameMode()->SaveWorld();
-					//Log::GetLog()->info("World saved.");
-					save_world = false; // do not save again if multiple plugins are reloaded in this loop
+					plugin_names.push_back(dir_name.path().filename().stem().generic_string());
 				}
+			}
+		}
 
-				try
-				{
-					UnloadPlugin(filename);
+		// Prevents saving world multiple times if multiple plugins are queued to be reloaded
+		bool save_world = save_world_before_reload_;
 
-					copy_file(new_plugin_file_path, plugin_file_path, fs::copy_options::overwrite_existing);
-					fs::remove(new_plugin_file_path);
+		for (const auto& plugin_name : plugin_names)
+		{
+			ReloadChangedPlugin(plugin_name, save_world);
+		}
+	}
 
-					LoadPlugin(filename);
-				}
-				catch (const std::exception& error)
-				{
-					Log::GetLog()->warn("({}) {}", __FUNCTION__, error.what());
-					continue;
-				}
+	void PluginManager::ReloadChangedPlugin(const std::string& plugin_name, bool& save_world)
+	{
+		namespace fs = std::filesystem;
 
-				Log::GetLog()->info("Reloaded plugin - {}", filename);
-			}
+		const std::string plugin_folder = Tools::GetCurrentDir() + "/" + game_api->GetApiName() + "/Plugins/" + plugin_name + "/";
+
+		const std::string plugin_file_path = plugin_folder + plugin_name + ".dll";
+		const std::string new_plugin_file_path = plugin_folder + plugin_name + ".dll.ArkApi";
+
+		if (!fs::exists(new_plugin_file_path) || FindPlugin(plugin_name) == loaded_plugins_.end())
+		{
+			return;
+		}
+
+		// Save the world in case the unload/load procedure causes crash
+		if (save_world)
+		{
+			//Log::GetLog()->info("Saving world before reloading plugins ...");
+			//ArkApi::GetApiUtils().GetShooterGameMode()->SaveWorld();
+			//Log::GetLog()->info("World saved.");
+			save_world = false; // do not save again if multiple plugins are reloaded in this loop
+		}
+
+		try
+		{
+			UnloadPlugin(plugin_name);
+
+			copy_file(new_plugin_file_path, plugin_file_path, fs::copy_options::overwrite_existing);
+			fs::remove(new_plugin_file_path);
+
+			LoadPlugin(plugin_name);
+		}
+		catch (const std::exception& error)
+		{
+			Log::GetLog()->warn("({}) {}", __FUNCTION__, error.what());
+			return;
 		}
+
+		Log::GetLog()->info("Reloaded plugin - {}", plugin_name);
 	}
 } // namespace API
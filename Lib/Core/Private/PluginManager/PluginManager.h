@@ -1,7 +1,12 @@
 #pragma once
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 #include <windows.h>
@@ -88,15 +93,52 @@ namespace API
 
 		void CheckPluginsDependencies();
 
+		/**
+		 * \brief Orders plugin folders so every plugin comes after the plugins in its Dependencies
+		 * \param plugin_names Plugin folders in directory order, kept for plugins that don't depend on each other
+		 */
+		static std::vector<std::string> SortPluginsByDependencies(const std::vector<std::string>& plugin_names);
+
+		/**
+		 * \brief Runs Plugin_InitAsync on the thread pool while all plugins are loaded, right away otherwise
+		 */
+		void RunAsyncInit(const std::string& plugin_name, void(__fastcall* pfn_init_async)());
+
+		/**
+		 * \brief Waits until Plugin_InitAsync of the given plugins returned, of every plugin when empty
+		 */
+		void WaitForAsyncInits(const std::vector<std::string>& plugin_names);
+
 		static void DetectPluginChangesTimerCallback();
 		void DetectPluginChanges();
+		void ReloadChangedPlugin(const std::string& plugin_name, bool& save_world);
+
+		/**
+		 * \brief Starts the thread watching the plugins folder for new .dll.ArkApi files
+		 */
+		void StartChangeWatcher();
+		void WatchPluginChanges(HANDLE directory);
+		void QueueChangedPlugins(const char* buffer, DWORD bytes);
 
 		std::vector<std::shared_ptr<Plugin>> loaded_plugins_;
 
+		// Plugin_InitAsync still running on the thread pool
+		bool defer_async_init_{false};
+		std::mutex init_mutex_;
+		std::condition_variable init_cv_;
+		std::unordered_set<std::string> pending_inits_;
+
 		// Plugins auto reloading
 		bool enable_plugin_reload_{false};
 		int reload_sleep_seconds_{5};
 		bool save_world_before_reload_{true};
 		time_t next_reload_check_{0};
+
+		// Filled by the watcher thread, plugin name -> time of its last change
+		std::mutex changes_mutex_;
+		std::unordered_map<std::string, time_t> changed_plugins_;
+		// The notification buffer overflowed, every plugin folder has to be checked
+		bool rescan_plugins_{false};
+		std::thread watcher_thread_;
 	};
 } // namespace API
@@ -11,6 +11,13 @@ namespace API
 	{
 		curl_global_init(CURL_GLOBAL_DEFAULT);
 
+		// Finished connections stay in the multi handle's cache for reuse
+		curl_multi_setopt(curl_, CURLMOPT_MAX_HOST_CONNECTIONS, max_host_connections_);
+#if LIBCURL_VERSION_NUM >= 0x072F00
+		// HTTP/2 hosts get one multiplexed connection
+		curl_multi_setopt(curl_, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+#endif
+
 		game_api->GetCommands()->AddOnTimerCallback("RequestsUpdate",
 		                                            std::bind(&Requests::Update, this));
 	}
@@ -19,6 +26,14 @@ namespace API
 	{
 		game_api->GetCommands()->RemoveOnTimerCallback("RequestsUpdate");
 
+		for (auto& request : requests_)
+		{
+			curl_multi_remove_handle(curl_, request.first);
+			curl_easy_cleanup(request.first);
+			curl_slist_free_all(request.second->headers);
+		}
+
+		curl_multi_cleanup(curl_);
 		curl_global_cleanup();
 	}
 
@@ -28,103 +43,118 @@ namespace API
 		return instance;
 	}
 
-	bool Requests::CreateGetRequest(const std::string& url, const std::function<void(bool, std::string)>& callback,
-	                                std::vector<std::string> headers)
+	CURL* Requests::CreateRequest(const std::string& url, const std::function<void(bool, std::string)>& callback,
+	                              const std::vector<std::string>& headers)
 	{
 		CURL* handle = curl_easy_init();
 		if (!handle)
 		{
-			return false;
+			return nullptr;
 		}
 
-		requests_[handle] = std::make_unique<Request>(callback);
-
-		curl_slist* chunk = nullptr;
+		auto& request = requests_[handle];
+		request = std::make_unique<Request>(callback);
 
 		for (const std::string& header : headers)
 		{
-			chunk = curl_slist_append(chunk, header.c_str());
+			request->headers = curl_slist_append(request->headers, header.c_str());
 		}
 
-		curl_easy_setopt(handle, CURLOPT_HTTPHEADER, chunk);
+		curl_easy_setopt(handle, CURLOPT_HTTPHEADER, request->headers);
 		curl_easy_setopt(handle, CURLOPT_URL, url.c_str());
 		curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, &Requests::WriteCallback);
-		curl_easy_setopt(handle, CURLOPT_WRITEDATA, &requests_[handle]->read_buffer);
+		curl_easy_setopt(handle, CURLOPT_WRITEDATA, &request->read_buffer);
 		curl_easy_setopt(handle, CURLOPT_SSL_VERIFYPEER, 0);
 		curl_easy_setopt(handle, CURLOPT_TIMEOUT, 120L);
 
-		curl_multi_add_handle(curl_, handle);
-
-		const CURLMcode res = curl_multi_perform(curl_, &handles_count_);
+		curl_easy_setopt(handle, CURLOPT_TCP_KEEPALIVE, 1L);
+#if LIBCURL_VERSION_NUM >= 0x072F00
+		// HTTP/2 over TLS where the server offers it, waiting for a multiplexed connection instead of opening another
+		curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+		curl_easy_setopt(handle, CURLOPT_PIPEWAIT, 1L);
+#endif
 
-		return res == CURLM_OK;
+		return handle;
 	}
 
-	bool Requests::CreatePostRequest(const std::string& url, const std::function<void(bool, std::string)>& callback,
-	                                 const std::string& post_data, std::vector<std::string> headers)
+	bool Requests::StartRequest(CURL* handle)
 	{
-		CURL* handle = curl_easy_init();
-		if (!handle)
+		if (in_flight_ >= max_in_flight_)
 		{
+			pending_.push_back(handle);
+			return true;
+		}
+
+		if (curl_multi_add_handle(curl_, handle) != CURLM_OK)
+		{
+			// Reported through the return value, not the callback
+			curl_slist_free_all(requests_[handle]->headers);
+			requests_.erase(handle);
+			curl_easy_cleanup(handle);
 			return false;
 		}
 
-		requests_[handle] = std::make_unique<Request>(callback);
+		++in_flight_;
 
-		curl_slist* chunk = nullptr;
+		return curl_multi_perform(curl_, &handles_count_) == CURLM_OK;
+	}
 
-		for (const std::string& header : headers)
-		{
-			chunk = curl_slist_append(chunk, header.c_str());
-		}
+	void Requests::FinishRequest(CURL* handle, bool success)
+	{
+		const auto iter = requests_.find(handle);
+		if (iter == requests_.end())
+			return;
 
-		curl_easy_setopt(handle, CURLOPT_HTTPHEADER, chunk);
-		curl_easy_setopt(handle, CURLOPT_URL, url.c_str());
-		curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, &Requests::WriteCallback);
-		curl_easy_setopt(handle, CURLOPT_WRITEDATA, &requests_[handle]->read_buffer);
-		curl_easy_setopt(handle, CURLOPT_POST, 1);
-		curl_easy_setopt(handle, CURLOPT_POSTFIELDS, post_data.c_str());
-		curl_easy_setopt(handle, CURLOPT_SSL_VERIFYPEER, 0);
-		curl_easy_setopt(handle, CURLOPT_TIMEOUT, 120L);
+		// Removed before the callback runs, so it may start new requests
+		std::unique_ptr<Request> request = std::move(iter->second);
+		requests_.erase(iter);
 
-		curl_multi_add_handle(curl_, handle);
+		curl_easy_cleanup(handle);
+		curl_slist_free_all(request->headers);
 
-		const CURLMcode res = curl_multi_perform(curl_, &handles_count_);
+		request->callback(success, move(request->read_buffer));
+	}
 
-		return res == CURLM_OK;
+	bool Requests::CreateGetRequest(const std::string& url, const std::function<void(bool, std::string)>& callback,
+	                                std::vector<std::string> headers)
+	{
+		CURL* handle = CreateRequest(url, callback, headers);
+		if (!handle)
+		{
+			return false;
+		}
+
+		return StartRequest(handle);
 	}
 
-	bool Requests::CreateDeleteRequest(const std::string& url, const std::function<void(bool, std::string)>& callback,
-	                                   std::vector<std::string> headers)
+	bool Requests::CreatePostRequest(const std::string& url, const std::function<void(bool, std::string)>& callback,
+	                                 const std::string& post_data, std::vector<std::string> headers)
 	{
-		CURL* handle = curl_easy_init();
+		CURL* handle = CreateRequest(url, callback, headers);
 		if (!handle)
 		{
 			return false;
 		}
 
-		requests_[handle] = std::make_unique<Request>(callback);
+		// Copied, the request may wait in pending_ long after the caller's string is gone
+		curl_easy_setopt(handle, CURLOPT_POSTFIELDSIZE, static_cast<long>(post_data.size()));
+		curl_easy_setopt(handle, CURLOPT_COPYPOSTFIELDS, post_data.c_str());
 
-		curl_slist* chunk = nullptr;
+		return StartRequest(handle);
+	}
 
-		for (const std::string& header : headers)
+	bool Requests::CreateDeleteRequest(const std::string& url, const std::function<void(bool, std::string)>& callback,
+	                                   std::vector<std::string> headers)
+	{
+		CURL* handle = CreateRequest(url, callback, headers);
+		if (!handle)
 		{
-			chunk = curl_slist_append(chunk, header.c_str());
+			return false;
 		}
 
-		curl_easy_setopt(handle, CURLOPT_HTTPHEADER, chunk);
-		curl_easy_setopt(handle, CURLOPT_URL, url.c_str());
-		curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, &Requests::WriteCallback);
-		curl_easy_setopt(handle, CURLOPT_WRITEDATA, &requests_[handle]->read_buffer);
 		curl_easy_setopt(handle, CURLOPT_CUSTOMREQUEST, "DELETE");
-		curl_easy_setopt(handle, CURLOPT_SSL_VERIFYPEER, 0);
-		curl_easy_setopt(handle, CURLOPT_TIMEOUT, 120L);
-
-		curl_multi_add_handle(curl_, handle);
-
-		const CURLMcode res = curl_multi_perform(curl_, &handles_count_);
 
-		return res == CURLM_OK;
+		return StartRequest(handle);
 	}
 
 	size_t Requests::WriteCallback(void* contents, size_t size, size_t nmemb, void* userp)
@@ -136,26 +166,56 @@ namespace API
 		return size * nmemb;
 	}
 
+	// Runs on the game thread from the timer, so every callback does too
 	void Requests::Update()
 	{
-		if (handles_count_ == 0)
+		if (in_flight_ == 0)
 			return;
 
 		curl_multi_perform(curl_, &handles_count_);
 
+		// Collect first, callbacks may add requests which would change the message queue
+		std::vector<std::pair<CURL*, bool>> done;
+
 		int msgq;
-		CURLMsg* m = curl_multi_info_read(curl_, &msgq);
-		if (m && m->msg == CURLMSG_DONE)
+		while (CURLMsg* m = curl_multi_info_read(curl_, &msgq))
+		{
+			if (m->msg == CURLMSG_DONE)
+			{
+				done.emplace_back(m->easy_handle, m->data.result == CURLE_OK);
+			}
+		}
+
+		for (const auto& finished : done)
 		{
-			CURL* handle = m->easy_handle;
+			curl_multi_remove_handle(curl_, finished.first);
+			--in_flight_;
+		}
 
-			auto& request = requests_[handle];
-			request->callback(m->data.result == CURLE_OK, move(request->read_buffer));
+		// Fill the freed slots before the callbacks add more
+		while (in_flight_ < max_in_flight_ && !pending_.empty())
+		{
+			CURL* handle = pending_.front();
+			pending_.pop_front();
+
+			if (curl_multi_add_handle(curl_, handle) == CURLM_OK)
+			{
+				++in_flight_;
+			}
+			else
+			{
+				FinishRequest(handle, false);
+			}
+		}
 
-			requests_.erase(handle);
+		if (!done.empty())
+		{
+			curl_multi_perform(curl_, &handles_count_);
+		}
 
-			curl_multi_remove_handle(curl_, handle);
-			curl_easy_cleanup(handle);
+		for (const auto& finished : done)
+		{
+			FinishRequest(finished.first, finished.second);
 		}
 	}
 } // namespace API
@@ -0,0 +1,162 @@
+#include <ThreadPool.h>
+
+#include <algorithm>
+
+#include <windows.h>
+
+#include <Logger/Logger.h>
+
+namespace API
+{
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stop_ = true;
+		}
+		queue_cv_.notify_all();
+
+		// Destroyed during DLL unload, joining here would wait on the loader lock
+		for (auto& worker : workers_)
+		{
+			worker.detach();
+		}
+	}
+
+	ThreadPool& ThreadPool::Get()
+	{
+		static ThreadPool instance;
+		return instance;
+	}
+
+	void ThreadPool::StartWorkers()
+	{
+		// Tasks are few and mostly blocking on IO, a small fixed pool is enough
+		const unsigned count = std::clamp(std::thread::hardware_concurrency() / 2, 2u, 4u);
+
+		for (unsigned i = 0; i < count; ++i)
+		{
+			workers_.emplace_back(&ThreadPool::Run, this);
+		}
+	}
+
+	void ThreadPool::Submit(const std::string& owner, const std::function<void()>& task)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+
+			const auto iter = owners_.find(owner);
+			if (stop_ || (iter != owners_.end() && iter->second.cancelled))
+			{
+				return;
+			}
+
+			if (workers_.empty())
+			{
+				StartWorkers();
+			}
+
+			queue_.push_back({owner, task});
+		}
+		queue_cv_.notify_one();
+	}
+
+	void ThreadPool::Cancel(const std::string& owner)
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+
+		queue_.erase(std::remove_if(queue_.begin(), queue_.end(), [&owner](const Task& task)
+		{
+			return task.owner == owner;
+		}), queue_.end());
+
+		const auto iter = owners_.find(owner);
+		if (iter == owners_.end())
+		{
+			return;
+		}
+
+		iter->second.cancelled = true;
+
+		idle_cv_.wait(lock, [this, &owner] { return owners_[owner].running == 0; });
+
+		// A reloaded plugin starts clean
+		owners_.erase(owner);
+	}
+
+	bool ThreadPool::IsCancelled(const std::string& owner)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		const auto iter = owners_.find(owner);
+		return iter != owners_.end() && iter->second.cancelled;
+	}
+
+	void ThreadPool::SetWorkerPriority(int priority, unsigned long long affinity_mask)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		priority_ = priority;
+		affinity_mask_ = affinity_mask;
+		++priority_version_;
+	}
+
+	void ThreadPool::Run()
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+
+		unsigned applied_version = 0;
+
+		while (true)
+		{
+			queue_cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+
+			if (stop_)
+			{
+				break;
+			}
+
+			Task task = std::move(queue_.front());
+			queue_.pop_front();
+			++owners_[task.owner].running;
+
+			const bool apply_priority = applied_version != priority_version_;
+			const int priority = priority_;
+			const unsigned long long affinity_mask = affinity_mask_;
+			applied_version = priority_version_;
+
+			lock.unlock();
+
+			if (apply_priority)
+			{
+				SetThreadPriority(GetCurrentThread(), priority);
+
+				// 0 puts a worker that was masked before back on every core of the process
+				DWORD_PTR process_mask = 0;
+				DWORD_PTR system_mask = 0;
+				GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask);
+
+				if (SetThreadAffinityMask(GetCurrentThread(), affinity_mask != 0 ? static_cast<DWORD_PTR>(affinity_mask) : process_mask) == 0)
+				{
+					Log::GetLog()->warn("Thread pool could not set affinity mask {:#x}", affinity_mask);
+				}
+			}
+
+			try
+			{
+				task.callback();
+			}
+			catch (const std::exception& exception)
+			{
+				Log::GetLog()->error("Thread pool task of {} failed - {}", task.owner, exception.what());
+			}
+
+			lock.lock();
+
+			if (--owners_[task.owner].running == 0)
+			{
+				idle_cv_.notify_all();
+			}
+		}
+	}
+} // namespace API
@@ -1,10 +1,40 @@
 #include <Timer.h>
+#include <ThreadPool.h>
+#include <Trace.h>
+
+#include <filesystem>
+#include <intrin.h>
+#include <windows.h>
 
 #include "../IBaseApi.h"
 
 namespace API
 {
+	namespace
+	{
+		// Name of the plugin whose code is at address, plugins are named after their dll
+		std::string GetOwnerName(void* address)
+		{
+			HMODULE h_module = nullptr;
+			if (!GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+			                        static_cast<LPCSTR>(address), &h_module))
+			{
+				return {};
+			}
+
+			char path[MAX_PATH];
+			if (GetModuleFileNameA(h_module, path, MAX_PATH) == 0)
+			{
+				return {};
+			}
+
+			return std::filesystem::path(path).stem().string();
+		}
+	} // namespace
+
 	Timer::Timer()
+		: start_time_(std::chrono::steady_clock::now()),
+		  current_tick_(0)
 	{
 		game_api->GetCommands()->AddOnTimerCallback("TimerUpdate", std::bind(&Timer::Update, this));
 	}
@@ -22,88 +52,167 @@ namespace API
 
 	void Timer::DelayExecuteInternal(const std::function<void()>& callback, int delay_seconds)
 	{
-		const auto now = std::chrono::system_clock::now();
-		const auto exec_time = now + std::chrono::seconds(delay_seconds);
+		// Not before the next tick, the current one is already being executed
+		const uint64_t exec_tick = std::max(GetElapsedTicks() + std::max(delay_seconds, 0), current_tick_ + 1);
 
-		timer_funcs_.emplace_back(std::make_unique<TimerFunc>(exec_time, callback, true, 1, 0));
+		Schedule(std::make_unique<TimerFunc>(exec_tick, callback, true, 1, 0, GetOwnerName(_ReturnAddress()), false));
 	}
 
 	void Timer::RecurringExecuteInternal(const std::function<void()>& callback, int execution_interval,
 	                                     int execution_counter, bool async)
 	{
-		if (async)
+		Schedule(std::make_unique<TimerFunc>(std::max(GetElapsedTicks(), current_tick_ + 1), callback, false,
+		                                     execution_counter, execution_interval, GetOwnerName(_ReturnAddress()),
+		                                     async));
+	}
+
+	void Timer::RemoveTasks(const std::string& owner)
+	{
+		const auto is_owned = [&owner](const std::unique_ptr<TimerFunc>& data)
 		{
-			std::thread([callback, execution_interval, execution_counter]()
+			return data->owner == owner;
+		};
+
+		for (auto& wheel : wheels_)
+		{
+			for (auto& slot : wheel)
 			{
-				if (execution_counter == -1)
-				{
-					for (;;)
-					{
-						callback();
-						std::this_thread::sleep_for(std::chrono::seconds(execution_interval));
-					}
-				}
+				slot.erase(std::remove_if(slot.begin(), slot.end(), is_owned), slot.end());
+			}
+		}
 
-				for (int i = 0; i < execution_counter; ++i)
-				{
-					callback();
-					std::this_thread::sleep_for(std::chrono::seconds(execution_interval));
-				}
-			}).detach();
+		overflow_.erase(std::remove_if(overflow_.begin(), overflow_.end(), is_owned), overflow_.end());
+	}
+
+	uint64_t Timer::GetElapsedTicks() const
+	{
+		return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start_time_).
+			count();
+	}
+
+	void Timer::Schedule(std::unique_ptr<TimerFunc> func)
+	{
+		// Missed while cascading, run on this tick
+		if (func->expire_tick < current_tick_)
+		{
+			func->expire_tick = current_tick_;
+		}
+
+		// The highest bits that differ from the current tick pick the level
+		const uint64_t diff = func->expire_tick ^ current_tick_;
+
+		for (unsigned level = 0; level < wheel_levels; ++level)
+		{
+			if (diff >> (wheel_bits * (level + 1)) == 0)
+			{
+				const uint64_t slot = (func->expire_tick >> (wheel_bits * level)) & wheel_mask;
+				wheels_[level][slot].push_back(move(func));
+				return;
+			}
+		}
+
+		overflow_.push_back(move(func));
+	}
+
+	void Timer::Cascade(unsigned level)
+	{
+		Slot funcs;
+
+		if (level < wheel_levels)
+		{
+			const uint64_t slot = (current_tick_ >> (wheel_bits * level)) & wheel_mask;
+			funcs.swap(wheels_[level][slot]);
 		}
 		else
 		{
-			const auto now = std::chrono::system_clock::now();
-			timer_funcs_.emplace_back(
-				std::make_unique<TimerFunc>(now, callback, false, execution_counter, execution_interval));
+			funcs.swap(overflow_);
+		}
+
+		// Each one lands at least one level lower
+		for (auto& func : funcs)
+		{
+			Schedule(move(func));
 		}
 	}
 
-	void Timer::Update()
+	void Timer::Advance(uint64_t now_tick)
 	{
-		if (timer_funcs_.empty())
+		++current_tick_;
+
+		// Crossed into a new block of a higher level, spread it over the levels below, highest first
+		unsigned crossed = 0;
+
+		while (crossed < wheel_levels && (current_tick_ & ((1ull << (wheel_bits * (crossed + 1))) - 1)) == 0)
 		{
-			return;
+			++crossed;
 		}
 
-		const auto now = std::chrono::system_clock::now();
+		for (unsigned level = crossed; level > 0; --level)
+		{
+			Cascade(level);
+		}
 
-		bool remove = false;
+		Slot due;
+		due.swap(wheels_[0][current_tick_ & wheel_mask]);
 
-		for (const auto& data : timer_funcs_)
+		for (auto& data : due)
 		{
-			if (now >= data->next_time)
+			if (!data->exec_once)
 			{
-				if (data->exec_once)
+				if (data->execution_counter == 0)
 				{
-					remove = true;
+					continue;
 				}
-				else
-				{
-					if (data->execution_counter != -1 && data->execution_counter > 0)
-					{
-						--data->execution_counter;
-					}
-					else if (data->execution_counter != -1)
-					{
-						remove = true;
-						continue;
-					}
 
-					data->next_time = now + std::chrono::seconds(data->execution_interval);
+				if (data->execution_counter > 0)
+				{
+					--data->execution_counter;
 				}
+			}
 
+			if (data->async)
+			{
+				// Previous execution still running, skip this one
+				if (!data->busy->exchange(true))
+				{
+					ThreadPool::Get().Submit(data->owner, [callback = data->callback, busy = data->busy]()
+					{
+						try
+						{
+							callback();
+						}
+						catch (...)
+						{
+							*busy = false;
+							throw;
+						}
+						*busy = false;
+					});
+				}
+			}
+			else
+			{
 				data->callback();
 			}
+
+			if (!data->exec_once)
+			{
+				// From the real time, a late server does not replay missed executions
+				data->expire_tick = std::max(now_tick + std::max(data->execution_interval, 0), current_tick_ + 1);
+				Schedule(move(data));
+			}
 		}
+	}
+
+	void Timer::Update()
+	{
+		ARK_TRACE_ZONE("API::Timer::Update");
 
-		if (remove)
+		const uint64_t now_tick = GetElapsedTicks();
+
+		while (current_tick_ < now_tick)
 		{
-			timer_funcs_.erase(std::remove_if(timer_funcs_.begin(), timer_funcs_.end(), [&now](const auto& data)
-			{
-				return (now >= data->next_time && data->exec_once) ||
-					(!data->exec_once && data->execution_counter == 0);
-			}), timer_funcs_.end());
+			Advance(now_tick);
 		}
 	}
 } // namespace API
@@ -1,5 +1,8 @@
 #include <Tools.h>
 
+#include <algorithm>
+#include <emmintrin.h>
+
 #include "../IBaseApi.h"
 #include "../PluginManager/PluginManager.h"
 
@@ -41,38 +44,112 @@ namespace ArkApi::Tools
 		return str;
 	}
 
-	std::string Utf8Encode(const std::wstring& wstr)
+	static_assert(sizeof(wchar_t) == 2, "UTF-16 wchar_t expected");
+
+	// Widens the leading ASCII run of src into dst, 16 bytes at a time, returns how many characters it was
+	static size_t WidenAscii(const char* src, size_t size, wchar_t* dst)
 	{
-		if (wstr.empty())
+		const __m128i zero = _mm_setzero_si128();
+		size_t i = 0;
+
+		for (; i + 16 <= size; i += 16)
 		{
-			return std::string();
-		}
+			const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
 
-		const int size_needed = WideCharToMultiByte(CP_UTF8, 0, wstr.data(), static_cast<int>(wstr.size()), nullptr, 0,
-		                                            nullptr, nullptr);
+			if (_mm_movemask_epi8(chunk) != 0)
+				break;
 
-		std::string str(size_needed, 0);
-		WideCharToMultiByte(CP_UTF8, 0, wstr.data(), static_cast<int>(wstr.size()), str.data(), size_needed, nullptr,
-		                    nullptr);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi8(chunk, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), _mm_unpackhi_epi8(chunk, zero));
+		}
 
-		return str;
+		for (; i < size && static_cast<unsigned char>(src[i]) < 0x80; ++i)
+		{
+			dst[i] = static_cast<wchar_t>(src[i]);
+		}
+
+		return i;
 	}
 
-	std::wstring Utf8Decode(const std::string& str)
+	// Narrows the leading ASCII run of src into dst, 16 characters at a time, returns how many characters it was
+	static size_t NarrowAscii(const wchar_t* src, size_t size, char* dst)
 	{
-		if (str.empty())
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i non_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+		size_t i = 0;
+
+		for (; i + 16 <= size; i += 16)
+		{
+			const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+			const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+			const __m128i bits = _mm_and_si128(_mm_or_si128(low, high), non_ascii);
+
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(bits, zero)) != 0xFFFF)
+				break;
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(low, high));
+		}
+
+		for (; i < size && src[i] < 0x80; ++i)
 		{
-			return std::wstring();
+			dst[i] = static_cast<char>(src[i]);
 		}
 
-		const int size_needed = MultiByteToWideChar(CP_UTF8, 0, str.data(), static_cast<int>(str.size()), nullptr, 0);
+		return i;
+	}
+
+	std::string Utf8Encode(const std::wstring& wstr)
+	{
+		std::string str;
+		Utf8Encode(wstr, str);
+
+		return str;
+	}
+
+	void Utf8Encode(std::wstring_view wstr, std::string& out)
+	{
+		out.resize(wstr.size());
+
+		const size_t ascii = NarrowAscii(wstr.data(), wstr.size(), out.data());
 
-		std::wstring wstr(size_needed, 0);
-		MultiByteToWideChar(CP_UTF8, 0, str.data(), static_cast<int>(str.size()), wstr.data(), size_needed);
+		if (ascii == wstr.size())
+			return;
+
+		// The rest in one call, a UTF-16 unit never takes more than 3 bytes
+		const size_t rest = wstr.size() - ascii;
+		out.resize(ascii + rest * 3);
+
+		const int written = WideCharToMultiByte(CP_UTF8, 0, wstr.data() + ascii, static_cast<int>(rest), out.data() + ascii,
+		                                        static_cast<int>(rest * 3), nullptr, nullptr);
+
+		out.resize(ascii + std::max(0, written));
+	}
+
+	std::wstring Utf8Decode(const std::string& str)
+	{
+		std::wstring wstr;
+		Utf8Decode(str, wstr);
 
 		return wstr;
 	}
 
+	void Utf8Decode(std::string_view str, std::wstring& out)
+	{
+		// A byte never decodes to more than one UTF-16 unit
+		out.resize(str.size());
+
+		const size_t ascii = WidenAscii(str.data(), str.size(), out.data());
+
+		if (ascii == str.size())
+			return;
+
+		const size_t rest = str.size() - ascii;
+		const int written = MultiByteToWideChar(CP_UTF8, 0, str.data() + ascii, static_cast<int>(rest), out.data() + ascii,
+		                                        static_cast<int>(rest));
+
+		out.resize(ascii + std::max(0, written));
+	}
+
 	bool IsPluginLoaded(const std::string& plugin_name)
 	{
 		return API::PluginManager::Get().IsPluginLoaded(plugin_name);
@@ -229,21 +229,21 @@ struct FConfigCacheIni
 
 struct USceneComponent : UActorComponent
 {
-	FTransform& ComponentToWorldField() { return *GetNativePointerField<FTransform*>(this, "USceneComponent.ComponentToWorld"); }
-	TEnumAsByte<enum EComponentMobility::Type>& MobilityField() { return *GetNativePointerField<TEnumAsByte<enum EComponentMobility::Type>*>(this, "USceneComponent.Mobility"); }
-	FBoxSphereBounds& BoundsField() { return *GetNativePointerField<FBoxSphereBounds*>(this, "USceneComponent.Bounds"); }
-	USceneComponent * AttachParentField() { return *GetNativePointerField<USceneComponent **>(this, "USceneComponent.AttachParent"); }
-	FName& AttachSocketNameField() { return *GetNativePointerField<FName*>(this, "USceneComponent.AttachSocketName"); }
-	TArray<USceneComponent *> AttachChildrenField() { return *GetNativePointerField<TArray<USceneComponent *>*>(this, "USceneComponent.AttachChildren"); }
-	FVector& RelativeLocationField() { return *GetNativePointerField<FVector*>(this, "USceneComponent.RelativeLocation"); }
-	FRotator& RelativeRotationField() { return *GetNativePointerField<FRotator*>(this, "USceneComponent.RelativeRotation"); }
-	TEnumAsByte<enum EDetailMode>& DetailModeField() { return *GetNativePointerField<TEnumAsByte<enum EDetailMode>*>(this, "USceneComponent.DetailMode"); }
-	int& AttachmentChangedIncrementerField() { return *GetNativePointerField<int*>(this, "USceneComponent.AttachmentChangedIncrementer"); }
-	bool& NetUpdateTransformField() { return *GetNativePointerField<bool*>(this, "USceneComponent.NetUpdateTransform"); }
-	USceneComponent * NetOldAttachParentField() { return *GetNativePointerField<USceneComponent **>(this, "USceneComponent.NetOldAttachParent"); }
-	FName& NetOldAttachSocketNameField() { return *GetNativePointerField<FName*>(this, "USceneComponent.NetOldAttachSocketName"); }
-	FVector& RelativeScale3DField() { return *GetNativePointerField<FVector*>(this, "USceneComponent.RelativeScale3D"); }
-	FVector& ComponentVelocityField() { return *GetNativePointerField<FVector*>(this, "USceneComponent.ComponentVelocity"); }
+	FTransform& ComponentToWorldField() { return *GetNativePointerField<FTransform*, API::FieldNameHash("USceneComponent.ComponentToWorld")>(this, "USceneComponent.ComponentToWorld"); }
+	TEnumAsByte<enum EComponentMobility::Type>& MobilityField() { return *GetNativePointerField<TEnumAsByte<enum EComponentMobility::Type>*, API::FieldNameHash("USceneComponent.Mobility")>(this, "USceneComponent.Mobility"); }
+	FBoxSphereBounds& BoundsField() { return *GetNativePointerField<FBoxSphereBounds*, API::FieldNameHash("USceneComponent.Bounds")>(this, "USceneComponent.Bounds"); }
+	USceneComponent * AttachParentField() { return *GetNativePointerField<USceneComponent **, API::FieldNameHash("USceneComponent.AttachParent")>(this, "USceneComponent.AttachParent"); }
+	FName& AttachSocketNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("USceneComponent.AttachSocketName")>(this, "USceneComponent.AttachSocketName"); }
+	TArray<USceneComponent *> AttachChildrenField() { return *GetNativePointerField<TArray<USceneComponent *>*, API::FieldNameHash("USceneComponent.AttachChildren")>(this, "USceneComponent.AttachChildren"); }
+	FVector& RelativeLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("USceneComponent.RelativeLocation")>(this, "USceneComponent.RelativeLocation"); }
+	FRotator& RelativeRotationField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("USceneComponent.RelativeRotation")>(this, "USceneComponent.RelativeRotation"); }
+	TEnumAsByte<enum EDetailMode>& DetailModeField() { return *GetNativePointerField<TEnumAsByte<enum EDetailMode>*, API::FieldNameHash("USceneComponent.DetailMode")>(this, "USceneComponent.DetailMode"); }
+	int& AttachmentChangedIncrementerField() { return *GetNativePointerField<int*, API::FieldNameHash("USceneComponent.AttachmentChangedIncrementer")>(this, "USceneComponent.AttachmentChangedIncrementer"); }
+	bool& NetUpdateTransformField() { return *GetNativePointerField<bool*, API::FieldNameHash("USceneComponent.NetUpdateTransform")>(this, "USceneComponent.NetUpdateTransform"); }
+	USceneComponent * NetOldAttachParentField() { return *GetNativePointerField<USceneComponent **, API::FieldNameHash("USceneComponent.NetOldAttachParent")>(this, "USceneComponent.NetOldAttachParent"); }
+	FName& NetOldAttachSocketNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("USceneComponent.NetOldAttachSocketName")>(this, "USceneComponent.NetOldAttachSocketName"); }
+	FVector& RelativeScale3DField() { return *GetNativePointerField<FVector*, API::FieldNameHash("USceneComponent.RelativeScale3D")>(this, "USceneComponent.RelativeScale3D"); }
+	FVector& ComponentVelocityField() { return *GetNativePointerField<FVector*, API::FieldNameHash("USceneComponent.ComponentVelocity")>(this, "USceneComponent.ComponentVelocity"); }
 
 	// Bit fields
 
@@ -335,36 +335,36 @@ struct USceneComponent : UActorComponent
 
 struct UPrimitiveComponent : USceneComponent
 {
-	float& MinDrawDistanceField() { return *GetNativePointerField<float*>(this, "UPrimitiveComponent.MinDrawDistance"); }
-	float& MassiveLODSizeOnScreenField() { return *GetNativePointerField<float*>(this, "UPrimitiveComponent.MassiveLODSizeOnScreen"); }
-	float& LDMaxDrawDistanceField() { return *GetNativePointerField<float*>(this, "UPrimitiveComponent.LDMaxDrawDistance"); }
-	float& CachedMaxDrawDistanceField() { return *GetNativePointerField<float*>(this, "UPrimitiveComponent.CachedMaxDrawDistance"); }
-	TEnumAsByte<enum ESceneDepthPriorityGroup>& DepthPriorityGroupField() { return *GetNativePointerField<TEnumAsByte<enum ESceneDepthPriorityGroup>*>(this, "UPrimitiveComponent.DepthPriorityGroup"); }
-	TEnumAsByte<enum ESceneDepthPriorityGroup>& ViewOwnerDepthPriorityGroupField() { return *GetNativePointerField<TEnumAsByte<enum ESceneDepthPriorityGroup>*>(this, "UPrimitiveComponent.ViewOwnerDepthPriorityGroup"); }
-	int& CustomDepthStencilValueField() { return *GetNativePointerField<int*>(this, "UPrimitiveComponent.CustomDepthStencilValue"); }
-	int& ObjectLayerField() { return *GetNativePointerField<int*>(this, "UPrimitiveComponent.ObjectLayer"); }
-	TEnumAsByte<enum EIndirectLightingCacheQuality>& IndirectLightingCacheQualityField() { return *GetNativePointerField<TEnumAsByte<enum EIndirectLightingCacheQuality>*>(this, "UPrimitiveComponent.IndirectLightingCacheQuality"); }
-	bool& bHasCachedStaticLightingField() { return *GetNativePointerField<bool*>(this, "UPrimitiveComponent.bHasCachedStaticLighting"); }
-	bool& bStaticLightingBuildEnqueuedField() { return *GetNativePointerField<bool*>(this, "UPrimitiveComponent.bStaticLightingBuildEnqueued"); }
-	int& TranslucencySortPriorityField() { return *GetNativePointerField<int*>(this, "UPrimitiveComponent.TranslucencySortPriority"); }
-	int& VisibilityIdField() { return *GetNativePointerField<int*>(this, "UPrimitiveComponent.VisibilityId"); }
-	float& LastPhysxSleepTimeField() { return *GetNativePointerField<float*>(this, "UPrimitiveComponent.LastPhysxSleepTime"); }
-	unsigned int& GameThread_OverlapIncrementorField() { return *GetNativePointerField<unsigned int*>(this, "UPrimitiveComponent.GameThread_OverlapIncrementor"); }
-	unsigned int& GameThread_OverlapIndexMaskField() { return *GetNativePointerField<unsigned int*>(this, "UPrimitiveComponent.GameThread_OverlapIndexMask"); }
-	int& InternalOctreeMaskField() { return *GetNativePointerField<int*>(this, "UPrimitiveComponent.InternalOctreeMask"); }
-	float& LpvBiasMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimitiveComponent.LpvBiasMultiplier"); }
-	float& OverrideStepHeightField() { return *GetNativePointerField<float*>(this, "UPrimitiveComponent.OverrideStepHeight"); }
-	FBodyInstance& BodyInstanceField() { return *GetNativePointerField<FBodyInstance*>(this, "UPrimitiveComponent.BodyInstance"); }
-	float& LastCheckedAllCollideableDescendantsTimeField() { return *GetNativePointerField<float*>(this, "UPrimitiveComponent.LastCheckedAllCollideableDescendantsTime"); }
-	float& BoundsScaleField() { return *GetNativePointerField<float*>(this, "UPrimitiveComponent.BoundsScale"); }
-	long double& LastSubmitTimeField() { return *GetNativePointerField<long double*>(this, "UPrimitiveComponent.LastSubmitTime"); }
-	long double& LastRenderTimeField() { return *GetNativePointerField<long double*>(this, "UPrimitiveComponent.LastRenderTime"); }
-	long double& LastRenderTimeIgnoreShadowField() { return *GetNativePointerField<long double*>(this, "UPrimitiveComponent.LastRenderTimeIgnoreShadow"); }
-	TEnumAsByte<enum ECanBeCharacterBase>& CanCharacterStepUpOnField() { return *GetNativePointerField<TEnumAsByte<enum ECanBeCharacterBase>*>(this, "UPrimitiveComponent.CanCharacterStepUpOn"); }
-	TArray<TWeakObjectPtr<AActor>>& MoveIgnoreActorsField() { return *GetNativePointerField<TArray<TWeakObjectPtr<AActor>>*>(this, "UPrimitiveComponent.MoveIgnoreActors"); }
-	unsigned int& ProxyMeshIDField() { return *GetNativePointerField<unsigned int*>(this, "UPrimitiveComponent.ProxyMeshID"); }
-	bool& bIsProxyMeshParentField() { return *GetNativePointerField<bool*>(this, "UPrimitiveComponent.bIsProxyMeshParent"); }
-	bool& bHasActiveProxyMeshChildrenField() { return *GetNativePointerField<bool*>(this, "UPrimitiveComponent.bHasActiveProxyMeshChildren"); }
+	float& MinDrawDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimitiveComponent.MinDrawDistance")>(this, "UPrimitiveComponent.MinDrawDistance"); }
+	float& MassiveLODSizeOnScreenField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimitiveComponent.MassiveLODSizeOnScreen")>(this, "UPrimitiveComponent.MassiveLODSizeOnScreen"); }
+	float& LDMaxDrawDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimitiveComponent.LDMaxDrawDistance")>(this, "UPrimitiveComponent.LDMaxDrawDistance"); }
+	float& CachedMaxDrawDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimitiveComponent.CachedMaxDrawDistance")>(this, "UPrimitiveComponent.CachedMaxDrawDistance"); }
+	TEnumAsByte<enum ESceneDepthPriorityGroup>& DepthPriorityGroupField() { return *GetNativePointerField<TEnumAsByte<enum ESceneDepthPriorityGroup>*, API::FieldNameHash("UPrimitiveComponent.DepthPriorityGroup")>(this, "UPrimitiveComponent.DepthPriorityGroup"); }
+	TEnumAsByte<enum ESceneDepthPriorityGroup>& ViewOwnerDepthPriorityGroupField() { return *GetNativePointerField<TEnumAsByte<enum ESceneDepthPriorityGroup>*, API::FieldNameHash("UPrimitiveComponent.ViewOwnerDepthPriorityGroup")>(this, "UPrimitiveComponent.ViewOwnerDepthPriorityGroup"); }
+	int& CustomDepthStencilValueField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimitiveComponent.CustomDepthStencilValue")>(this, "UPrimitiveComponent.CustomDepthStencilValue"); }
+	int& ObjectLayerField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimitiveComponent.ObjectLayer")>(this, "UPrimitiveComponent.ObjectLayer"); }
+	TEnumAsByte<enum EIndirectLightingCacheQuality>& IndirectLightingCacheQualityField() { return *GetNativePointerField<TEnumAsByte<enum EIndirectLightingCacheQuality>*, API::FieldNameHash("UPrimitiveComponent.IndirectLightingCacheQuality")>(this, "UPrimitiveComponent.IndirectLightingCacheQuality"); }
+	bool& bHasCachedStaticLightingField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimitiveComponent.bHasCachedStaticLighting")>(this, "UPrimitiveComponent.bHasCachedStaticLighting"); }
+	bool& bStaticLightingBuildEnqueuedField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimitiveComponent.bStaticLightingBuildEnqueued")>(this, "UPrimitiveComponent.bStaticLightingBuildEnqueued"); }
+	int& TranslucencySortPriorityField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimitiveComponent.TranslucencySortPriority")>(this, "UPrimitiveComponent.TranslucencySortPriority"); }
+	int& VisibilityIdField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimitiveComponent.VisibilityId")>(this, "UPrimitiveComponent.VisibilityId"); }
+	float& LastPhysxSleepTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimitiveComponent.LastPhysxSleepTime")>(this, "UPrimitiveComponent.LastPhysxSleepTime"); }
+	unsigned int& GameThread_OverlapIncrementorField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("UPrimitiveComponent.GameThread_OverlapIncrementor")>(this, "UPrimitiveComponent.GameThread_OverlapIncrementor"); }
+	unsigned int& GameThread_OverlapIndexMaskField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("UPrimitiveComponent.GameThread_OverlapIndexMask")>(this, "UPrimitiveComponent.GameThread_OverlapIndexMask"); }
+	int& InternalOctreeMaskField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimitiveComponent.InternalOctreeMask")>(this, "UPrimitiveComponent.InternalOctreeMask"); }
+	float& LpvBiasMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimitiveComponent.LpvBiasMultiplier")>(this, "UPrimitiveComponent.LpvBiasMultiplier"); }
+	float& OverrideStepHeightField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimitiveComponent.OverrideStepHeight")>(this, "UPrimitiveComponent.OverrideStepHeight"); }
+	FBodyInstance& BodyInstanceField() { return *GetNativePointerField<FBodyInstance*, API::FieldNameHash("UPrimitiveComponent.BodyInstance")>(this, "UPrimitiveComponent.BodyInstance"); }
+	float& LastCheckedAllCollideableDescendantsTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimitiveComponent.LastCheckedAllCollideableDescendantsTime")>(this, "UPrimitiveComponent.LastCheckedAllCollideableDescendantsTime"); }
+	float& BoundsScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimitiveComponent.BoundsScale")>(this, "UPrimitiveComponent.BoundsScale"); }
+	long double& LastSubmitTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimitiveComponent.LastSubmitTime")>(this, "UPrimitiveComponent.LastSubmitTime"); }
+	long double& LastRenderTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimitiveComponent.LastRenderTime")>(this, "UPrimitiveComponent.LastRenderTime"); }
+	long double& LastRenderTimeIgnoreShadowField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimitiveComponent.LastRenderTimeIgnoreShadow")>(this, "UPrimitiveComponent.LastRenderTimeIgnoreShadow"); }
+	TEnumAsByte<enum ECanBeCharacterBase>& CanCharacterStepUpOnField() { return *GetNativePointerField<TEnumAsByte<enum ECanBeCharacterBase>*, API::FieldNameHash("UPrimitiveComponent.CanCharacterStepUpOn")>(this, "UPrimitiveComponent.CanCharacterStepUpOn"); }
+	TArray<TWeakObjectPtr<AActor>>& MoveIgnoreActorsField() { return *GetNativePointerField<TArray<TWeakObjectPtr<AActor>>*, API::FieldNameHash("UPrimitiveComponent.MoveIgnoreActors")>(this, "UPrimitiveComponent.MoveIgnoreActors"); }
+	unsigned int& ProxyMeshIDField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("UPrimitiveComponent.ProxyMeshID")>(this, "UPrimitiveComponent.ProxyMeshID"); }
+	bool& bIsProxyMeshParentField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimitiveComponent.bIsProxyMeshParent")>(this, "UPrimitiveComponent.bIsProxyMeshParent"); }
+	bool& bHasActiveProxyMeshChildrenField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimitiveComponent.bHasActiveProxyMeshChildren")>(this, "UPrimitiveComponent.bHasActiveProxyMeshChildren"); }
 
 	// Bit fields
 
@@ -534,7 +534,7 @@ struct UPrimitiveComponent : USceneComponent
 
 struct UShapeComponent : UPrimitiveComponent
 {
-	UMaterialInterface * ShapeMaterialField() { return *GetNativePointerField<UMaterialInterface **>(this, "UShapeComponent.ShapeMaterial"); }
+	UMaterialInterface * ShapeMaterialField() { return *GetNativePointerField<UMaterialInterface **, API::FieldNameHash("UShapeComponent.ShapeMaterial")>(this, "UShapeComponent.ShapeMaterial"); }
 
 	// Bit fields
 
@@ -562,65 +562,65 @@ struct USphereComponent : UShapeComponent
 
 struct AActor : UObject
 {
-	float& CustomTimeDilationField() { return *GetNativePointerField<float*>(this, "AActor.CustomTimeDilation"); }
-	float& ClientReplicationSendNowThresholdField() { return *GetNativePointerField<float*>(this, "AActor.ClientReplicationSendNowThreshold"); }
-	TEnumAsByte<enum ENetRole>& RemoteRoleField() { return *GetNativePointerField<TEnumAsByte<enum ENetRole>*>(this, "AActor.RemoteRole"); }
-	AActor * OwnerField() { return *GetNativePointerField<AActor **>(this, "AActor.Owner"); }
-	long double& LastReplicatedMovementField() { return *GetNativePointerField<long double*>(this, "AActor.LastReplicatedMovement"); }
-	TEnumAsByte<enum ENetRole>& RoleField() { return *GetNativePointerField<TEnumAsByte<enum ENetRole>*>(this, "AActor.Role"); }
-	TEnumAsByte<enum ENetDormancy>& NetDormancyField() { return *GetNativePointerField<TEnumAsByte<enum ENetDormancy>*>(this, "AActor.NetDormancy"); }
-	TArray<TWeakObjectPtr<UActorComponent>>& ReplicatedComponentsField() { return *GetNativePointerField<TArray<TWeakObjectPtr<UActorComponent>>*>(this, "AActor.ReplicatedComponents"); }
-	TWeakObjectPtr<USoundBase>& LastPostProcessVolumeSoundField() { return *GetNativePointerField<TWeakObjectPtr<USoundBase>*>(this, "AActor.LastPostProcessVolumeSound"); }
-	int& DefaultStasisComponentOctreeFlagsField() { return *GetNativePointerField<int*>(this, "AActor.DefaultStasisComponentOctreeFlags"); }
-	UPrimitiveComponent * StasisCheckComponentField() { return *GetNativePointerField<UPrimitiveComponent **>(this, "AActor.StasisCheckComponent"); }
-	TArray<AActor *> NetworkSpatializationChildrenField() { return *GetNativePointerField<TArray<AActor *>*>(this, "AActor.NetworkSpatializationChildren"); }
-	AActor * NetworkSpatializationParentField() { return *GetNativePointerField<AActor **>(this, "AActor.NetworkSpatializationParent"); }
-	float& NetworkAndStasisRangeMultiplierField() { return *GetNativePointerField<float*>(this, "AActor.NetworkAndStasisRangeMultiplier"); }
-	long double& UnstasisLastInRangeTimeField() { return *GetNativePointerField<long double*>(this, "AActor.UnstasisLastInRangeTime"); }
-	long double& LastPreReplicationTimeField() { return *GetNativePointerField<long double*>(this, "AActor.LastPreReplicationTime"); }
-	long double& LastEnterStasisTimeField() { return *GetNativePointerField<long double*>(this, "AActor.LastEnterStasisTime"); }
-	long double& LastExitStasisTimeField() { return *GetNativePointerField<long double*>(this, "AActor.LastExitStasisTime"); }
-	FName& CustomTagField() { return *GetNativePointerField<FName*>(this, "AActor.CustomTag"); }
-	int& CustomDataField() { return *GetNativePointerField<int*>(this, "AActor.CustomData"); }
-	float& ReplicationIntervalMultiplierField() { return *GetNativePointerField<float*>(this, "AActor.ReplicationIntervalMultiplier"); }
-	int& ForceImmediateReplicationFrameField() { return *GetNativePointerField<int*>(this, "AActor.ForceImmediateReplicationFrame"); }
-	char& StasisSetIndexField() { return *GetNativePointerField<char*>(this, "AActor.StasisSetIndex"); }
-	char& RandomStartByteField() { return *GetNativePointerField<char*>(this, "AActor.RandomStartByte"); }
-	unsigned __int64& LastFrameUnStasisField() { return *GetNativePointerField<unsigned __int64*>(this, "AActor.LastFrameUnStasis"); }
-	volatile int& LastUnstasisFrameCounterField() { return *GetNativePointerField<volatile int*>(this, "AActor.LastUnstasisFrameCounter"); }
-	TArray<TWeakObjectPtr<UActorComponent>>& StasisUnRegisteredComponentsField() { return *GetNativePointerField<TArray<TWeakObjectPtr<UActorComponent>>*>(this, "AActor.StasisUnRegisteredComponents"); }
-	float& NetCullDistanceSquaredField() { return *GetNativePointerField<float*>(this, "AActor.NetCullDistanceSquared"); }
-	float& NetCullDistanceSquaredDormantField() { return *GetNativePointerField<float*>(this, "AActor.NetCullDistanceSquaredDormant"); }
-	int& NetTagField() { return *GetNativePointerField<int*>(this, "AActor.NetTag"); }
-	long double& NetUpdateTimeField() { return *GetNativePointerField<long double*>(this, "AActor.NetUpdateTime"); }
-	float& NetUpdateFrequencyField() { return *GetNativePointerField<float*>(this, "AActor.NetUpdateFrequency"); }
-	float& NetPriorityField() { return *GetNativePointerField<float*>(this, "AActor.NetPriority"); }
-	long double& LastNetUpdateTimeField() { return *GetNativePointerField<long double*>(this, "AActor.LastNetUpdateTime"); }
-	FName& NetDriverNameField() { return *GetNativePointerField<FName*>(this, "AActor.NetDriverName"); }
-	int& TargetingTeamField() { return *GetNativePointerField<int*>(this, "AActor.TargetingTeam"); }
-	float& OverrideStasisComponentRadiusField() { return *GetNativePointerField<float*>(this, "AActor.OverrideStasisComponentRadius"); }
-	APawn * InstigatorField() { return *GetNativePointerField<APawn **>(this, "AActor.Instigator"); }
-	long double& CreationTimeField() { return *GetNativePointerField<long double*>(this, "AActor.CreationTime"); }
-	long double& OriginalCreationTimeField() { return *GetNativePointerField<long double*>(this, "AActor.OriginalCreationTime"); }
-	TArray<AActor *> ChildrenField() { return *GetNativePointerField<TArray<AActor *>*>(this, "AActor.Children"); }
-	unsigned int& AnimUpdateRateShiftTagField() { return *GetNativePointerField<unsigned int*>(this, "AActor.AnimUpdateRateShiftTag"); }
-	unsigned int& AnimUpdateRateFrameCountField() { return *GetNativePointerField<unsigned int*>(this, "AActor.AnimUpdateRateFrameCount"); }
-	USceneComponent * RootComponentField() { return *GetNativePointerField<USceneComponent **>(this, "AActor.RootComponent"); }
-	TArray<AMatineeActor *> ControllingMatineeActorsField() { return *GetNativePointerField<TArray<AMatineeActor *>*>(this, "AActor.ControllingMatineeActors"); }
-	float& InitialLifeSpanField() { return *GetNativePointerField<float*>(this, "AActor.InitialLifeSpan"); }
-	TArray<FName>& LayersField() { return *GetNativePointerField<TArray<FName>*>(this, "AActor.Layers"); }
-	TWeakObjectPtr<AActor>& ParentComponentActorField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*>(this, "AActor.ParentComponentActor"); }
-	long double& LastRenderTimeField() { return *GetNativePointerField<long double*>(this, "AActor.LastRenderTime"); }
-	long double& LastRenderTimeIgnoreShadowField() { return *GetNativePointerField<long double*>(this, "AActor.LastRenderTimeIgnoreShadow"); }
-	TArray<FName>& TagsField() { return *GetNativePointerField<TArray<FName>*>(this, "AActor.Tags"); }
-	unsigned __int64& HiddenEditorViewsField() { return *GetNativePointerField<unsigned __int64*>(this, "AActor.HiddenEditorViews"); }
-	FVector& DefaultActorLocationField() { return *GetNativePointerField<FVector*>(this, "AActor.DefaultActorLocation"); }
-	FGuid& UniqueGuidIdField() { return *GetNativePointerField<FGuid*>(this, "AActor.UniqueGuidId"); }
-	float& ForceMaximumReplicationRateUntilTimeField() { return *GetNativePointerField<float*>(this, "AActor.ForceMaximumReplicationRateUntilTime"); }
-	long double& LastActorForceReplicationTimeField() { return *GetNativePointerField<long double*>(this, "AActor.LastActorForceReplicationTime"); }
-	TArray<UActorComponent *> OwnedComponentsField() { return *GetNativePointerField<TArray<UActorComponent *>*>(this, "AActor.OwnedComponents"); }
-	TArray<UActorComponent *> SerializedComponentsField() { return *GetNativePointerField<TArray<UActorComponent *>*>(this, "AActor.SerializedComponents"); }
-	int& LastFrameCalculcatedNetworkRangeMultiplierField() { return *GetNativePointerField<int*>(this, "AActor.LastFrameCalculcatedNetworkRangeMultiplier"); }
+	float& CustomTimeDilationField() { return *GetNativePointerField<float*, API::FieldNameHash("AActor.CustomTimeDilation")>(this, "AActor.CustomTimeDilation"); }
+	float& ClientReplicationSendNowThresholdField() { return *GetNativePointerField<float*, API::FieldNameHash("AActor.ClientReplicationSendNowThreshold")>(this, "AActor.ClientReplicationSendNowThreshold"); }
+	TEnumAsByte<enum ENetRole>& RemoteRoleField() { return *GetNativePointerField<TEnumAsByte<enum ENetRole>*, API::FieldNameHash("AActor.RemoteRole")>(this, "AActor.RemoteRole"); }
+	AActor * OwnerField() { return *GetNativePointerField<AActor **, API::FieldNameHash("AActor.Owner")>(this, "AActor.Owner"); }
+	long double& LastReplicatedMovementField() { return *GetNativePointerField<long double*, API::FieldNameHash("AActor.LastReplicatedMovement")>(this, "AActor.LastReplicatedMovement"); }
+	TEnumAsByte<enum ENetRole>& RoleField() { return *GetNativePointerField<TEnumAsByte<enum ENetRole>*, API::FieldNameHash("AActor.Role")>(this, "AActor.Role"); }
+	TEnumAsByte<enum ENetDormancy>& NetDormancyField() { return *GetNativePointerField<TEnumAsByte<enum ENetDormancy>*, API::FieldNameHash("AActor.NetDormancy")>(this, "AActor.NetDormancy"); }
+	TArray<TWeakObjectPtr<UActorComponent>>& ReplicatedComponentsField() { return *GetNativePointerField<TArray<TWeakObjectPtr<UActorComponent>>*, API::FieldNameHash("AActor.ReplicatedComponents")>(this, "AActor.ReplicatedComponents"); }
+	TWeakObjectPtr<USoundBase>& LastPostProcessVolumeSoundField() { return *GetNativePointerField<TWeakObjectPtr<USoundBase>*, API::FieldNameHash("AActor.LastPostProcessVolumeSound")>(this, "AActor.LastPostProcessVolumeSound"); }
+	int& DefaultStasisComponentOctreeFlagsField() { return *GetNativePointerField<int*, API::FieldNameHash("AActor.DefaultStasisComponentOctreeFlags")>(this, "AActor.DefaultStasisComponentOctreeFlags"); }
+	UPrimitiveComponent * StasisCheckComponentField() { return *GetNativePointerField<UPrimitiveComponent **, API::FieldNameHash("AActor.StasisCheckComponent")>(this, "AActor.StasisCheckComponent"); }
+	TArray<AActor *> NetworkSpatializationChildrenField() { return *GetNativePointerField<TArray<AActor *>*, API::FieldNameHash("AActor.NetworkSpatializationChildren")>(this, "AActor.NetworkSpatializationChildren"); }
+	AActor * NetworkSpatializationParentField() { return *GetNativePointerField<AActor **, API::FieldNameHash("AActor.NetworkSpatializationParent")>(this, "AActor.NetworkSpatializationParent"); }
+	float& NetworkAndStasisRangeMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AActor.NetworkAndStasisRangeMultiplier")>(this, "AActor.NetworkAndStasisRangeMultiplier"); }
+	long double& UnstasisLastInRangeTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AActor.UnstasisLastInRangeTime")>(this, "AActor.UnstasisLastInRangeTime"); }
+	long double& LastPreReplicationTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AActor.LastPreReplicationTime")>(this, "AActor.LastPreReplicationTime"); }
+	long double& LastEnterStasisTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AActor.LastEnterStasisTime")>(this, "AActor.LastEnterStasisTime"); }
+	long double& LastExitStasisTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AActor.LastExitStasisTime")>(this, "AActor.LastExitStasisTime"); }
+	FName& CustomTagField() { return *GetNativePointerField<FName*, API::FieldNameHash("AActor.CustomTag")>(this, "AActor.CustomTag"); }
+	int& CustomDataField() { return *GetNativePointerField<int*, API::FieldNameHash("AActor.CustomData")>(this, "AActor.CustomData"); }
+	float& ReplicationIntervalMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AActor.ReplicationIntervalMultiplier")>(this, "AActor.ReplicationIntervalMultiplier"); }
+	int& ForceImmediateReplicationFrameField() { return *GetNativePointerField<int*, API::FieldNameHash("AActor.ForceImmediateReplicationFrame")>(this, "AActor.ForceImmediateReplicationFrame"); }
+	char& StasisSetIndexField() { return *GetNativePointerField<char*, API::FieldNameHash("AActor.StasisSetIndex")>(this, "AActor.StasisSetIndex"); }
+	char& RandomStartByteField() { return *GetNativePointerField<char*, API::FieldNameHash("AActor.RandomStartByte")>(this, "AActor.RandomStartByte"); }
+	unsigned __int64& LastFrameUnStasisField() { return *GetNativePointerField<unsigned __int64*, API::FieldNameHash("AActor.LastFrameUnStasis")>(this, "AActor.LastFrameUnStasis"); }
+	volatile int& LastUnstasisFrameCounterField() { return *GetNativePointerField<volatile int*, API::FieldNameHash("AActor.LastUnstasisFrameCounter")>(this, "AActor.LastUnstasisFrameCounter"); }
+	TArray<TWeakObjectPtr<UActorComponent>>& StasisUnRegisteredComponentsField() { return *GetNativePointerField<TArray<TWeakObjectPtr<UActorComponent>>*, API::FieldNameHash("AActor.StasisUnRegisteredComponents")>(this, "AActor.StasisUnRegisteredComponents"); }
+	float& NetCullDistanceSquaredField() { return *GetNativePointerField<float*, API::FieldNameHash("AActor.NetCullDistanceSquared")>(this, "AActor.NetCullDistanceSquared"); }
+	float& NetCullDistanceSquaredDormantField() { return *GetNativePointerField<float*, API::FieldNameHash("AActor.NetCullDistanceSquaredDormant")>(this, "AActor.NetCullDistanceSquaredDormant"); }
+	int& NetTagField() { return *GetNativePointerField<int*, API::FieldNameHash("AActor.NetTag")>(this, "AActor.NetTag"); }
+	long double& NetUpdateTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AActor.NetUpdateTime")>(this, "AActor.NetUpdateTime"); }
+	float& NetUpdateFrequencyField() { return *GetNativePointerField<float*, API::FieldNameHash("AActor.NetUpdateFrequency")>(this, "AActor.NetUpdateFrequency"); }
+	float& NetPriorityField() { return *GetNativePointerField<float*, API::FieldNameHash("AActor.NetPriority")>(this, "AActor.NetPriority"); }
+	long double& LastNetUpdateTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AActor.LastNetUpdateTime")>(this, "AActor.LastNetUpdateTime"); }
+	FName& NetDriverNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("AActor.NetDriverName")>(this, "AActor.NetDriverName"); }
+	int& TargetingTeamField() { return *GetNativePointerField<int*, API::FieldNameHash("AActor.TargetingTeam")>(this, "AActor.TargetingTeam"); }
+	float& OverrideStasisComponentRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("AActor.OverrideStasisComponentRadius")>(this, "AActor.OverrideStasisComponentRadius"); }
+	APawn * InstigatorField() { return *GetNativePointerField<APawn **, API::FieldNameHash("AActor.Instigator")>(this, "AActor.Instigator"); }
+	long double& CreationTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AActor.CreationTime")>(this, "AActor.CreationTime"); }
+	long double& OriginalCreationTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AActor.OriginalCreationTime")>(this, "AActor.OriginalCreationTime"); }
+	TArray<AActor *> ChildrenField() { return *GetNativePointerField<TArray<AActor *>*, API::FieldNameHash("AActor.Children")>(this, "AActor.Children"); }
+	unsigned int& AnimUpdateRateShiftTagField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("AActor.AnimUpdateRateShiftTag")>(this, "AActor.AnimUpdateRateShiftTag"); }
+	unsigned int& AnimUpdateRateFrameCountField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("AActor.AnimUpdateRateFrameCount")>(this, "AActor.AnimUpdateRateFrameCount"); }
+	USceneComponent * RootComponentField() { return *GetNativePointerField<USceneComponent **, API::FieldNameHash("AActor.RootComponent")>(this, "AActor.RootComponent"); }
+	TArray<AMatineeActor *> ControllingMatineeActorsField() { return *GetNativePointerField<TArray<AMatineeActor *>*, API::FieldNameHash("AActor.ControllingMatineeActors")>(this, "AActor.ControllingMatineeActors"); }
+	float& InitialLifeSpanField() { return *GetNativePointerField<float*, API::FieldNameHash("AActor.InitialLifeSpan")>(this, "AActor.InitialLifeSpan"); }
+	TArray<FName>& LayersField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("AActor.Layers")>(this, "AActor.Layers"); }
+	TWeakObjectPtr<AActor>& ParentComponentActorField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*, API::FieldNameHash("AActor.ParentComponentActor")>(this, "AActor.ParentComponentActor"); }
+	long double& LastRenderTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AActor.LastRenderTime")>(this, "AActor.LastRenderTime"); }
+	long double& LastRenderTimeIgnoreShadowField() { return *GetNativePointerField<long double*, API::FieldNameHash("AActor.LastRenderTimeIgnoreShadow")>(this, "AActor.LastRenderTimeIgnoreShadow"); }
+	TArray<FName>& TagsField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("AActor.Tags")>(this, "AActor.Tags"); }
+	unsigned __int64& HiddenEditorViewsField() { return *GetNativePointerField<unsigned __int64*, API::FieldNameHash("AActor.HiddenEditorViews")>(this, "AActor.HiddenEditorViews"); }
+	FVector& DefaultActorLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AActor.DefaultActorLocation")>(this, "AActor.DefaultActorLocation"); }
+	FGuid& UniqueGuidIdField() { return *GetNativePointerField<FGuid*, API::FieldNameHash("AActor.UniqueGuidId")>(this, "AActor.UniqueGuidId"); }
+	float& ForceMaximumReplicationRateUntilTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("AActor.ForceMaximumReplicationRateUntilTime")>(this, "AActor.ForceMaximumReplicationRateUntilTime"); }
+	long double& LastActorForceReplicationTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AActor.LastActorForceReplicationTime")>(this, "AActor.LastActorForceReplicationTime"); }
+	TArray<UActorComponent *> OwnedComponentsField() { return *GetNativePointerField<TArray<UActorComponent *>*, API::FieldNameHash("AActor.OwnedComponents")>(this, "AActor.OwnedComponents"); }
+	TArray<UActorComponent *> SerializedComponentsField() { return *GetNativePointerField<TArray<UActorComponent *>*, API::FieldNameHash("AActor.SerializedComponents")>(this, "AActor.SerializedComponents"); }
+	int& LastFrameCalculcatedNetworkRangeMultiplierField() { return *GetNativePointerField<int*, API::FieldNameHash("AActor.LastFrameCalculcatedNetworkRangeMultiplier")>(this, "AActor.LastFrameCalculcatedNetworkRangeMultiplier"); }
 
 	// Bit fields
 
@@ -928,20 +928,20 @@ struct AActor : UObject
 
 struct APawn : AActor
 {
-	float& BaseEyeHeightField() { return *GetNativePointerField<float*>(this, "APawn.BaseEyeHeight"); }
-	TSubclassOf<AController>& AIControllerClassField() { return *GetNativePointerField<TSubclassOf<AController>*>(this, "APawn.AIControllerClass"); }
-	APlayerState * PlayerStateField() { return *GetNativePointerField<APlayerState **>(this, "APawn.PlayerState"); }
-	char& RemoteViewPitchField() { return *GetNativePointerField<char*>(this, "APawn.RemoteViewPitch"); }
-	AController * LastHitByField() { return *GetNativePointerField<AController **>(this, "APawn.LastHitBy"); }
-	AController * ControllerField() { return *GetNativePointerField<AController **>(this, "APawn.Controller"); }
-	float& AllowedYawErrorField() { return *GetNativePointerField<float*>(this, "APawn.AllowedYawError"); }
-	bool& bClearOnConsumeField() { return *GetNativePointerField<bool*>(this, "APawn.bClearOnConsume"); }
-	TWeakObjectPtr<AActor>& TetherActorField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*>(this, "APawn.TetherActor"); }
-	float& TetherRadiusField() { return *GetNativePointerField<float*>(this, "APawn.TetherRadius"); }
-	float& TetherHeightField() { return *GetNativePointerField<float*>(this, "APawn.TetherHeight"); }
-	FVector& ControlInputVectorField() { return *GetNativePointerField<FVector*>(this, "APawn.ControlInputVector"); }
-	FVector& LastControlInputVectorField() { return *GetNativePointerField<FVector*>(this, "APawn.LastControlInputVector"); }
-	TWeakObjectPtr<AController>& SpawnedForControllerField() { return *GetNativePointerField<TWeakObjectPtr<AController>*>(this, "APawn.SpawnedForController"); }
+	float& BaseEyeHeightField() { return *GetNativePointerField<float*, API::FieldNameHash("APawn.BaseEyeHeight")>(this, "APawn.BaseEyeHeight"); }
+	TSubclassOf<AController>& AIControllerClassField() { return *GetNativePointerField<TSubclassOf<AController>*, API::FieldNameHash("APawn.AIControllerClass")>(this, "APawn.AIControllerClass"); }
+	APlayerState * PlayerStateField() { return *GetNativePointerField<APlayerState **, API::FieldNameHash("APawn.PlayerState")>(this, "APawn.PlayerState"); }
+	char& RemoteViewPitchField() { return *GetNativePointerField<char*, API::FieldNameHash("APawn.RemoteViewPitch")>(this, "APawn.RemoteViewPitch"); }
+	AController * LastHitByField() { return *GetNativePointerField<AController **, API::FieldNameHash("APawn.LastHitBy")>(this, "APawn.LastHitBy"); }
+	AController * ControllerField() { return *GetNativePointerField<AController **, API::FieldNameHash("APawn.Controller")>(this, "APawn.Controller"); }
+	float& AllowedYawErrorField() { return *GetNativePointerField<float*, API::FieldNameHash("APawn.AllowedYawError")>(this, "APawn.AllowedYawError"); }
+	bool& bClearOnConsumeField() { return *GetNativePointerField<bool*, API::FieldNameHash("APawn.bClearOnConsume")>(this, "APawn.bClearOnConsume"); }
+	TWeakObjectPtr<AActor>& TetherActorField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*, API::FieldNameHash("APawn.TetherActor")>(this, "APawn.TetherActor"); }
+	float& TetherRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("APawn.TetherRadius")>(this, "APawn.TetherRadius"); }
+	float& TetherHeightField() { return *GetNativePointerField<float*, API::FieldNameHash("APawn.TetherHeight")>(this, "APawn.TetherHeight"); }
+	FVector& ControlInputVectorField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APawn.ControlInputVector")>(this, "APawn.ControlInputVector"); }
+	FVector& LastControlInputVectorField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APawn.LastControlInputVector")>(this, "APawn.LastControlInputVector"); }
+	TWeakObjectPtr<AController>& SpawnedForControllerField() { return *GetNativePointerField<TWeakObjectPtr<AController>*, API::FieldNameHash("APawn.SpawnedForController")>(this, "APawn.SpawnedForController"); }
 
 	// Bit fields
 
@@ -1032,14 +1032,14 @@ struct APawn : AActor
 
 struct UCheatManager
 {
-	float& DebugTraceDistanceField() { return *GetNativePointerField<float*>(this, "UCheatManager.DebugTraceDistance"); }
-	float& DebugCapsuleHalfHeightField() { return *GetNativePointerField<float*>(this, "UCheatManager.DebugCapsuleHalfHeight"); }
-	float& DebugCapsuleRadiusField() { return *GetNativePointerField<float*>(this, "UCheatManager.DebugCapsuleRadius"); }
-	float& DebugTraceDrawNormalLengthField() { return *GetNativePointerField<float*>(this, "UCheatManager.DebugTraceDrawNormalLength"); }
-	TEnumAsByte<enum ECollisionChannel>& DebugTraceChannelField() { return *GetNativePointerField<TEnumAsByte<enum ECollisionChannel>*>(this, "UCheatManager.DebugTraceChannel"); }
-	int& CurrentTraceIndexField() { return *GetNativePointerField<int*>(this, "UCheatManager.CurrentTraceIndex"); }
-	int& CurrentTracePawnIndexField() { return *GetNativePointerField<int*>(this, "UCheatManager.CurrentTracePawnIndex"); }
-	float& DumpAILogsIntervalField() { return *GetNativePointerField<float*>(this, "UCheatManager.DumpAILogsInterval"); }
+	float& DebugTraceDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("UCheatManager.DebugTraceDistance")>(this, "UCheatManager.DebugTraceDistance"); }
+	float& DebugCapsuleHalfHeightField() { return *GetNativePointerField<float*, API::FieldNameHash("UCheatManager.DebugCapsuleHalfHeight")>(this, "UCheatManager.DebugCapsuleHalfHeight"); }
+	float& DebugCapsuleRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("UCheatManager.DebugCapsuleRadius")>(this, "UCheatManager.DebugCapsuleRadius"); }
+	float& DebugTraceDrawNormalLengthField() { return *GetNativePointerField<float*, API::FieldNameHash("UCheatManager.DebugTraceDrawNormalLength")>(this, "UCheatManager.DebugTraceDrawNormalLength"); }
+	TEnumAsByte<enum ECollisionChannel>& DebugTraceChannelField() { return *GetNativePointerField<TEnumAsByte<enum ECollisionChannel>*, API::FieldNameHash("UCheatManager.DebugTraceChannel")>(this, "UCheatManager.DebugTraceChannel"); }
+	int& CurrentTraceIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("UCheatManager.CurrentTraceIndex")>(this, "UCheatManager.CurrentTraceIndex"); }
+	int& CurrentTracePawnIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("UCheatManager.CurrentTracePawnIndex")>(this, "UCheatManager.CurrentTracePawnIndex"); }
+	float& DumpAILogsIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("UCheatManager.DumpAILogsInterval")>(this, "UCheatManager.DumpAILogsInterval"); }
 
 	// Bit fields
 
@@ -1101,8 +1101,8 @@ struct UCheatManager
 
 struct UShooterCheatManager : UCheatManager
 {
-	bool& bIsRCONCheatManagerField() { return *GetNativePointerField<bool*>(this, "UShooterCheatManager.bIsRCONCheatManager"); }
-	AShooterPlayerController * MyPCField() { return *GetNativePointerField<AShooterPlayerController **>(this, "UShooterCheatManager.MyPC"); }
+	bool& bIsRCONCheatManagerField() { return *GetNativePointerField<bool*, API::FieldNameHash("UShooterCheatManager.bIsRCONCheatManager")>(this, "UShooterCheatManager.bIsRCONCheatManager"); }
+	AShooterPlayerController * MyPCField() { return *GetNativePointerField<AShooterPlayerController **, API::FieldNameHash("UShooterCheatManager.MyPC")>(this, "UShooterCheatManager.MyPC"); }
 
 	// Functions
 
@@ -1236,11 +1236,11 @@ struct UShooterCheatManager : UCheatManager
 
 struct UPlayer
 {
-	APlayerController * PlayerControllerField() { return *GetNativePointerField<APlayerController **>(this, "UPlayer.PlayerController"); }
-	int& CurrentNetSpeedField() { return *GetNativePointerField<int*>(this, "UPlayer.CurrentNetSpeed"); }
-	int& ConfiguredInternetSpeedField() { return *GetNativePointerField<int*>(this, "UPlayer.ConfiguredInternetSpeed"); }
-	int& ConfiguredLanSpeedField() { return *GetNativePointerField<int*>(this, "UPlayer.ConfiguredLanSpeed"); }
-	unsigned __int64& TransferringPlayerDataIdField() { return *GetNativePointerField<unsigned __int64*>(this, "UPlayer.TransferringPlayerDataId"); }
+	APlayerController * PlayerControllerField() { return *GetNativePointerField<APlayerController **, API::FieldNameHash("UPlayer.PlayerController")>(this, "UPlayer.PlayerController"); }
+	int& CurrentNetSpeedField() { return *GetNativePointerField<int*, API::FieldNameHash("UPlayer.CurrentNetSpeed")>(this, "UPlayer.CurrentNetSpeed"); }
+	int& ConfiguredInternetSpeedField() { return *GetNativePointerField<int*, API::FieldNameHash("UPlayer.ConfiguredInternetSpeed")>(this, "UPlayer.ConfiguredInternetSpeed"); }
+	int& ConfiguredLanSpeedField() { return *GetNativePointerField<int*, API::FieldNameHash("UPlayer.ConfiguredLanSpeed")>(this, "UPlayer.ConfiguredLanSpeed"); }
+	unsigned __int64& TransferringPlayerDataIdField() { return *GetNativePointerField<unsigned __int64*, API::FieldNameHash("UPlayer.TransferringPlayerDataId")>(this, "UPlayer.TransferringPlayerDataId"); }
 
 	// Functions
 
@@ -1249,18 +1249,18 @@ struct UPlayer
 
 struct APlayerState : AActor
 {
-	float& ScoreField() { return *GetNativePointerField<float*>(this, "APlayerState.Score"); }
-	char& PingField() { return *GetNativePointerField<char*>(this, "APlayerState.Ping"); }
-	FString& PlayerNameField() { return *GetNativePointerField<FString*>(this, "APlayerState.PlayerName"); }
-	FString& OldNameField() { return *GetNativePointerField<FString*>(this, "APlayerState.OldName"); }
-	int& PlayerIdField() { return *GetNativePointerField<int*>(this, "APlayerState.PlayerId"); }
-	int& StartTimeField() { return *GetNativePointerField<int*>(this, "APlayerState.StartTime"); }
-	float& ExactPingField() { return *GetNativePointerField<float*>(this, "APlayerState.ExactPing"); }
-	FString& SavedNetworkAddressField() { return *GetNativePointerField<FString*>(this, "APlayerState.SavedNetworkAddress"); }
-	FUniqueNetIdRepl& UniqueIdField() { return *GetNativePointerField<FUniqueNetIdRepl*>(this, "APlayerState.UniqueId"); }
-	FName& SessionNameField() { return *GetNativePointerField<FName*>(this, "APlayerState.SessionName"); }
-	char& CurPingBucketField() { return *GetNativePointerField<char*>(this, "APlayerState.CurPingBucket"); }
-	float& CurPingBucketTimestampField() { return *GetNativePointerField<float*>(this, "APlayerState.CurPingBucketTimestamp"); }
+	float& ScoreField() { return *GetNativePointerField<float*, API::FieldNameHash("APlayerState.Score")>(this, "APlayerState.Score"); }
+	char& PingField() { return *GetNativePointerField<char*, API::FieldNameHash("APlayerState.Ping")>(this, "APlayerState.Ping"); }
+	FString& PlayerNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("APlayerState.PlayerName")>(this, "APlayerState.PlayerName"); }
+	FString& OldNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("APlayerState.OldName")>(this, "APlayerState.OldName"); }
+	int& PlayerIdField() { return *GetNativePointerField<int*, API::FieldNameHash("APlayerState.PlayerId")>(this, "APlayerState.PlayerId"); }
+	int& StartTimeField() { return *GetNativePointerField<int*, API::FieldNameHash("APlayerState.StartTime")>(this, "APlayerState.StartTime"); }
+	float& ExactPingField() { return *GetNativePointerField<float*, API::FieldNameHash("APlayerState.ExactPing")>(this, "APlayerState.ExactPing"); }
+	FString& SavedNetworkAddressField() { return *GetNativePointerField<FString*, API::FieldNameHash("APlayerState.SavedNetworkAddress")>(this, "APlayerState.SavedNetworkAddress"); }
+	FUniqueNetIdRepl& UniqueIdField() { return *GetNativePointerField<FUniqueNetIdRepl*, API::FieldNameHash("APlayerState.UniqueId")>(this, "APlayerState.UniqueId"); }
+	FName& SessionNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APlayerState.SessionName")>(this, "APlayerState.SessionName"); }
+	char& CurPingBucketField() { return *GetNativePointerField<char*, API::FieldNameHash("APlayerState.CurPingBucket")>(this, "APlayerState.CurPingBucket"); }
+	float& CurPingBucketTimestampField() { return *GetNativePointerField<float*, API::FieldNameHash("APlayerState.CurPingBucketTimestamp")>(this, "APlayerState.CurPingBucketTimestamp"); }
 
 	// Bit fields
 
@@ -1297,22 +1297,22 @@ struct APlayerState : AActor
 
 struct AShooterPlayerState : APlayerState
 {
-	UPrimalPlayerData * MyPlayerDataField() { return *GetNativePointerField<UPrimalPlayerData **>(this, "AShooterPlayerState.MyPlayerData"); }
-	FPrimalPlayerDataStruct * MyPlayerDataStructField() { return GetNativePointerField<FPrimalPlayerDataStruct *>(this, "AShooterPlayerState.MyPlayerDataStruct"); }
+	UPrimalPlayerData * MyPlayerDataField() { return *GetNativePointerField<UPrimalPlayerData **, API::FieldNameHash("AShooterPlayerState.MyPlayerData")>(this, "AShooterPlayerState.MyPlayerData"); }
+	FPrimalPlayerDataStruct * MyPlayerDataStructField() { return GetNativePointerField<FPrimalPlayerDataStruct *, API::FieldNameHash("AShooterPlayerState.MyPlayerDataStruct")>(this, "AShooterPlayerState.MyPlayerDataStruct"); }
 	FieldArray<TSubclassOf<UPrimalItem>, 10> DefaultItemSlotClassesField() { return { this, "AShooterPlayerState.DefaultItemSlotClasses" }; }
 	FieldArray<char, 10> DefaultItemSlotEngramsField() { return { this, "AShooterPlayerState.DefaultItemSlotEngrams" }; }
-	FTribeData * MyTribeDataField() { return GetNativePointerField<FTribeData *>(this, "AShooterPlayerState.MyTribeData"); }
-	FTribeData * LastTribeInviteDataField() { return GetNativePointerField<FTribeData *>(this, "AShooterPlayerState.LastTribeInviteData"); }
-	int& TotalEngramPointsField() { return *GetNativePointerField<int*>(this, "AShooterPlayerState.TotalEngramPoints"); }
-	int& FreeEngramPointsField() { return *GetNativePointerField<int*>(this, "AShooterPlayerState.FreeEngramPoints"); }
-	TArray<TSubclassOf<UPrimalItem>>& EngramItemBlueprintsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "AShooterPlayerState.EngramItemBlueprints"); }
-	TSet<TSubclassOf<UPrimalItem>, DefaultKeyFuncs<TSubclassOf<UPrimalItem>, 0>, FDefaultSetAllocator>& ServerEngramItemBlueprintsSetField() { return *GetNativePointerField<TSet<TSubclassOf<UPrimalItem>, DefaultKeyFuncs<TSubclassOf<UPrimalItem>, 0>, FDefaultSetAllocator>*>(this, "AShooterPlayerState.ServerEngramItemBlueprintsSet"); }
-	long double& NextAllowedRespawnTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerState.NextAllowedRespawnTime"); }
-	float& AllowedRespawnIntervalField() { return *GetNativePointerField<float*>(this, "AShooterPlayerState.AllowedRespawnInterval"); }
-	long double& LastTimeDiedToEnemyTeamField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerState.LastTimeDiedToEnemyTeam"); }
-	int& CurrentlySelectedDinoOrderGroupField() { return *GetNativePointerField<int*>(this, "AShooterPlayerState.CurrentlySelectedDinoOrderGroup"); }
+	FTribeData * MyTribeDataField() { return GetNativePointerField<FTribeData *, API::FieldNameHash("AShooterPlayerState.MyTribeData")>(this, "AShooterPlayerState.MyTribeData"); }
+	FTribeData * LastTribeInviteDataField() { return GetNativePointerField<FTribeData *, API::FieldNameHash("AShooterPlayerState.LastTribeInviteData")>(this, "AShooterPlayerState.LastTribeInviteData"); }
+	int& TotalEngramPointsField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterPlayerState.TotalEngramPoints")>(this, "AShooterPlayerState.TotalEngramPoints"); }
+	int& FreeEngramPointsField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterPlayerState.FreeEngramPoints")>(this, "AShooterPlayerState.FreeEngramPoints"); }
+	TArray<TSubclassOf<UPrimalItem>>& EngramItemBlueprintsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("AShooterPlayerState.EngramItemBlueprints")>(this, "AShooterPlayerState.EngramItemBlueprints"); }
+	TSet<TSubclassOf<UPrimalItem>, DefaultKeyFuncs<TSubclassOf<UPrimalItem>, 0>, FDefaultSetAllocator>& ServerEngramItemBlueprintsSetField() { return *GetNativePointerField<TSet<TSubclassOf<UPrimalItem>, DefaultKeyFuncs<TSubclassOf<UPrimalItem>, 0>, FDefaultSetAllocator>*, API::FieldNameHash("AShooterPlayerState.ServerEngramItemBlueprintsSet")>(this, "AShooterPlayerState.ServerEngramItemBlueprintsSet"); }
+	long double& NextAllowedRespawnTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerState.NextAllowedRespawnTime")>(this, "AShooterPlayerState.NextAllowedRespawnTime"); }
+	float& AllowedRespawnIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterPlayerState.AllowedRespawnInterval")>(this, "AShooterPlayerState.AllowedRespawnInterval"); }
+	long double& LastTimeDiedToEnemyTeamField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerState.LastTimeDiedToEnemyTeam")>(this, "AShooterPlayerState.LastTimeDiedToEnemyTeam"); }
+	int& CurrentlySelectedDinoOrderGroupField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterPlayerState.CurrentlySelectedDinoOrderGroup")>(this, "AShooterPlayerState.CurrentlySelectedDinoOrderGroup"); }
 	FieldArray<FDinoOrderGroup, 10> DinoOrderGroupsField() { return { this, "AShooterPlayerState.DinoOrderGroups" }; }
-	long double& LastTribeRequestTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerState.LastTribeRequestTime"); }
+	long double& LastTribeRequestTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerState.LastTribeRequestTime")>(this, "AShooterPlayerState.LastTribeRequestTime"); }
 
 	// Bit fields
 
@@ -1431,13 +1431,13 @@ struct AShooterPlayerState : APlayerState
 
 struct AController : AActor
 {
-	TWeakObjectPtr<APawn>& OldPawnField() { return *GetNativePointerField<TWeakObjectPtr<APawn>*>(this, "AController.OldPawn"); }
-	ACharacter * CharacterField() { return *GetNativePointerField<ACharacter **>(this, "AController.Character"); }
-	APlayerState * PlayerStateField() { return *GetNativePointerField<APlayerState **>(this, "AController.PlayerState"); }
-	APawn * PawnField() { return *GetNativePointerField<APawn **>(this, "AController.Pawn"); }
-	FRotator& ControlRotationField() { return *GetNativePointerField<FRotator*>(this, "AController.ControlRotation"); }
-	TWeakObjectPtr<AActor>& StartSpotField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*>(this, "AController.StartSpot"); }
-	FName& StateNameField() { return *GetNativePointerField<FName*>(this, "AController.StateName"); }
+	TWeakObjectPtr<APawn>& OldPawnField() { return *GetNativePointerField<TWeakObjectPtr<APawn>*, API::FieldNameHash("AController.OldPawn")>(this, "AController.OldPawn"); }
+	ACharacter * CharacterField() { return *GetNativePointerField<ACharacter **, API::FieldNameHash("AController.Character")>(this, "AController.Character"); }
+	APlayerState * PlayerStateField() { return *GetNativePointerField<APlayerState **, API::FieldNameHash("AController.PlayerState")>(this, "AController.PlayerState"); }
+	APawn * PawnField() { return *GetNativePointerField<APawn **, API::FieldNameHash("AController.Pawn")>(this, "AController.Pawn"); }
+	FRotator& ControlRotationField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("AController.ControlRotation")>(this, "AController.ControlRotation"); }
+	TWeakObjectPtr<AActor>& StartSpotField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*, API::FieldNameHash("AController.StartSpot")>(this, "AController.StartSpot"); }
+	FName& StateNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("AController.StateName")>(this, "AController.StateName"); }
 
 	// Bit fields
 
@@ -1485,50 +1485,50 @@ struct AController : AActor
 
 struct APlayerController : AController
 {
-	UPlayer * PlayerField() { return *GetNativePointerField<UPlayer **>(this, "APlayerController.Player"); }
-	APawn * AcknowledgedPawnField() { return *GetNativePointerField<APawn **>(this, "APlayerController.AcknowledgedPawn"); }
-	float& LocalPlayerCachedLODDistanceFactorField() { return *GetNativePointerField<float*>(this, "APlayerController.LocalPlayerCachedLODDistanceFactor"); }
-	AHUD * MyHUDField() { return *GetNativePointerField<AHUD **>(this, "APlayerController.MyHUD"); }
-	APlayerCameraManager * PlayerCameraManagerField() { return *GetNativePointerField<APlayerCameraManager **>(this, "APlayerController.PlayerCameraManager"); }
-	TSubclassOf<APlayerCameraManager>& PlayerCameraManagerClassField() { return *GetNativePointerField<TSubclassOf<APlayerCameraManager>*>(this, "APlayerController.PlayerCameraManagerClass"); }
-	bool& bAutoManageActiveCameraTargetField() { return *GetNativePointerField<bool*>(this, "APlayerController.bAutoManageActiveCameraTarget"); }
-	FRotator& TargetViewRotationField() { return *GetNativePointerField<FRotator*>(this, "APlayerController.TargetViewRotation"); }
-	FRotator& BlendedTargetViewRotationField() { return *GetNativePointerField<FRotator*>(this, "APlayerController.BlendedTargetViewRotation"); }
-	TArray<AActor *> HiddenActorsField() { return *GetNativePointerField<TArray<AActor *>*>(this, "APlayerController.HiddenActors"); }
-	float& LastSpectatorStateSynchTimeField() { return *GetNativePointerField<float*>(this, "APlayerController.LastSpectatorStateSynchTime"); }
-	int& ClientCapField() { return *GetNativePointerField<int*>(this, "APlayerController.ClientCap"); }
-	long double& ServerLastReceivedSpectatorLocTimeField() { return *GetNativePointerField<long double*>(this, "APlayerController.ServerLastReceivedSpectatorLocTime"); }
-	UCheatManager * CheatManagerField() { return *GetNativePointerField<UCheatManager **>(this, "APlayerController.CheatManager"); }
-	TSubclassOf<UCheatManager>& CheatClassField() { return *GetNativePointerField<TSubclassOf<UCheatManager>*>(this, "APlayerController.CheatClass"); }
-	TArray<FName>& PendingMapChangeLevelNamesField() { return *GetNativePointerField<TArray<FName>*>(this, "APlayerController.PendingMapChangeLevelNames"); }
-	char& NetPlayerIndexField() { return *GetNativePointerField<char*>(this, "APlayerController.NetPlayerIndex"); }
-	UNetConnection * PendingSwapConnectionField() { return *GetNativePointerField<UNetConnection **>(this, "APlayerController.PendingSwapConnection"); }
-	UNetConnection * NetConnectionField() { return *GetNativePointerField<UNetConnection **>(this, "APlayerController.NetConnection"); }
-	FRotator& RotationInputField() { return *GetNativePointerField<FRotator*>(this, "APlayerController.RotationInput"); }
-	float& InputYawScaleField() { return *GetNativePointerField<float*>(this, "APlayerController.InputYawScale"); }
-	float& InputPitchScaleField() { return *GetNativePointerField<float*>(this, "APlayerController.InputPitchScale"); }
-	float& InputRollScaleField() { return *GetNativePointerField<float*>(this, "APlayerController.InputRollScale"); }
-	TEnumAsByte<enum EMouseCursor::Type>& DefaultMouseCursorField() { return *GetNativePointerField<TEnumAsByte<enum EMouseCursor::Type>*>(this, "APlayerController.DefaultMouseCursor"); }
-	TEnumAsByte<enum EMouseCursor::Type>& CurrentMouseCursorField() { return *GetNativePointerField<TEnumAsByte<enum EMouseCursor::Type>*>(this, "APlayerController.CurrentMouseCursor"); }
-	TEnumAsByte<enum ECollisionChannel>& DefaultClickTraceChannelField() { return *GetNativePointerField<TEnumAsByte<enum ECollisionChannel>*>(this, "APlayerController.DefaultClickTraceChannel"); }
-	TEnumAsByte<enum ECollisionChannel>& CurrentClickTraceChannelField() { return *GetNativePointerField<TEnumAsByte<enum ECollisionChannel>*>(this, "APlayerController.CurrentClickTraceChannel"); }
-	bool& bLockedInputUIField() { return *GetNativePointerField<bool*>(this, "APlayerController.bLockedInputUI"); }
-	TSubobjectPtr<USceneComponent>& TransformComponentField() { return *GetNativePointerField<TSubobjectPtr<USceneComponent>*>(this, "APlayerController.TransformComponent"); }
-	TWeakObjectPtr<UPrimitiveComponent>& CurrentClickablePrimitiveField() { return *GetNativePointerField<TWeakObjectPtr<UPrimitiveComponent>*>(this, "APlayerController.CurrentClickablePrimitive"); }
+	UPlayer * PlayerField() { return *GetNativePointerField<UPlayer **, API::FieldNameHash("APlayerController.Player")>(this, "APlayerController.Player"); }
+	APawn * AcknowledgedPawnField() { return *GetNativePointerField<APawn **, API::FieldNameHash("APlayerController.AcknowledgedPawn")>(this, "APlayerController.AcknowledgedPawn"); }
+	float& LocalPlayerCachedLODDistanceFactorField() { return *GetNativePointerField<float*, API::FieldNameHash("APlayerController.LocalPlayerCachedLODDistanceFactor")>(this, "APlayerController.LocalPlayerCachedLODDistanceFactor"); }
+	AHUD * MyHUDField() { return *GetNativePointerField<AHUD **, API::FieldNameHash("APlayerController.MyHUD")>(this, "APlayerController.MyHUD"); }
+	APlayerCameraManager * PlayerCameraManagerField() { return *GetNativePointerField<APlayerCameraManager **, API::FieldNameHash("APlayerController.PlayerCameraManager")>(this, "APlayerController.PlayerCameraManager"); }
+	TSubclassOf<APlayerCameraManager>& PlayerCameraManagerClassField() { return *GetNativePointerField<TSubclassOf<APlayerCameraManager>*, API::FieldNameHash("APlayerController.PlayerCameraManagerClass")>(this, "APlayerController.PlayerCameraManagerClass"); }
+	bool& bAutoManageActiveCameraTargetField() { return *GetNativePointerField<bool*, API::FieldNameHash("APlayerController.bAutoManageActiveCameraTarget")>(this, "APlayerController.bAutoManageActiveCameraTarget"); }
+	FRotator& TargetViewRotationField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APlayerController.TargetViewRotation")>(this, "APlayerController.TargetViewRotation"); }
+	FRotator& BlendedTargetViewRotationField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APlayerController.BlendedTargetViewRotation")>(this, "APlayerController.BlendedTargetViewRotation"); }
+	TArray<AActor *> HiddenActorsField() { return *GetNativePointerField<TArray<AActor *>*, API::FieldNameHash("APlayerController.HiddenActors")>(this, "APlayerController.HiddenActors"); }
+	float& LastSpectatorStateSynchTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APlayerController.LastSpectatorStateSynchTime")>(this, "APlayerController.LastSpectatorStateSynchTime"); }
+	int& ClientCapField() { return *GetNativePointerField<int*, API::FieldNameHash("APlayerController.ClientCap")>(this, "APlayerController.ClientCap"); }
+	long double& ServerLastReceivedSpectatorLocTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APlayerController.ServerLastReceivedSpectatorLocTime")>(this, "APlayerController.ServerLastReceivedSpectatorLocTime"); }
+	UCheatManager * CheatManagerField() { return *GetNativePointerField<UCheatManager **, API::FieldNameHash("APlayerController.CheatManager")>(this, "APlayerController.CheatManager"); }
+	TSubclassOf<UCheatManager>& CheatClassField() { return *GetNativePointerField<TSubclassOf<UCheatManager>*, API::FieldNameHash("APlayerController.CheatClass")>(this, "APlayerController.CheatClass"); }
+	TArray<FName>& PendingMapChangeLevelNamesField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("APlayerController.PendingMapChangeLevelNames")>(this, "APlayerController.PendingMapChangeLevelNames"); }
+	char& NetPlayerIndexField() { return *GetNativePointerField<char*, API::FieldNameHash("APlayerController.NetPlayerIndex")>(this, "APlayerController.NetPlayerIndex"); }
+	UNetConnection * PendingSwapConnectionField() { return *GetNativePointerField<UNetConnection **, API::FieldNameHash("APlayerController.PendingSwapConnection")>(this, "APlayerController.PendingSwapConnection"); }
+	UNetConnection * NetConnectionField() { return *GetNativePointerField<UNetConnection **, API::FieldNameHash("APlayerController.NetConnection")>(this, "APlayerController.NetConnection"); }
+	FRotator& RotationInputField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APlayerController.RotationInput")>(this, "APlayerController.RotationInput"); }
+	float& InputYawScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("APlayerController.InputYawScale")>(this, "APlayerController.InputYawScale"); }
+	float& InputPitchScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("APlayerController.InputPitchScale")>(this, "APlayerController.InputPitchScale"); }
+	float& InputRollScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("APlayerController.InputRollScale")>(this, "APlayerController.InputRollScale"); }
+	TEnumAsByte<enum EMouseCursor::Type>& DefaultMouseCursorField() { return *GetNativePointerField<TEnumAsByte<enum EMouseCursor::Type>*, API::FieldNameHash("APlayerController.DefaultMouseCursor")>(this, "APlayerController.DefaultMouseCursor"); }
+	TEnumAsByte<enum EMouseCursor::Type>& CurrentMouseCursorField() { return *GetNativePointerField<TEnumAsByte<enum EMouseCursor::Type>*, API::FieldNameHash("APlayerController.CurrentMouseCursor")>(this, "APlayerController.CurrentMouseCursor"); }
+	TEnumAsByte<enum ECollisionChannel>& DefaultClickTraceChannelField() { return *GetNativePointerField<TEnumAsByte<enum ECollisionChannel>*, API::FieldNameHash("APlayerController.DefaultClickTraceChannel")>(this, "APlayerController.DefaultClickTraceChannel"); }
+	TEnumAsByte<enum ECollisionChannel>& CurrentClickTraceChannelField() { return *GetNativePointerField<TEnumAsByte<enum ECollisionChannel>*, API::FieldNameHash("APlayerController.CurrentClickTraceChannel")>(this, "APlayerController.CurrentClickTraceChannel"); }
+	bool& bLockedInputUIField() { return *GetNativePointerField<bool*, API::FieldNameHash("APlayerController.bLockedInputUI")>(this, "APlayerController.bLockedInputUI"); }
+	TSubobjectPtr<USceneComponent>& TransformComponentField() { return *GetNativePointerField<TSubobjectPtr<USceneComponent>*, API::FieldNameHash("APlayerController.TransformComponent")>(this, "APlayerController.TransformComponent"); }
+	TWeakObjectPtr<UPrimitiveComponent>& CurrentClickablePrimitiveField() { return *GetNativePointerField<TWeakObjectPtr<UPrimitiveComponent>*, API::FieldNameHash("APlayerController.CurrentClickablePrimitive")>(this, "APlayerController.CurrentClickablePrimitive"); }
 	FieldArray<TWeakObjectPtr<UPrimitiveComponent>, 11> CurrentTouchablePrimitivesField() { return { this, "APlayerController.CurrentTouchablePrimitives" }; }
-	char& IgnoreMoveInputField() { return *GetNativePointerField<char*>(this, "APlayerController.IgnoreMoveInput"); }
-	char& IgnoreLookInputField() { return *GetNativePointerField<char*>(this, "APlayerController.IgnoreLookInput"); }
-	TWeakObjectPtr<USceneComponent>& AudioListenerComponentField() { return *GetNativePointerField<TWeakObjectPtr<USceneComponent>*>(this, "APlayerController.AudioListenerComponent"); }
-	FVector& AudioListenerLocationOverrideField() { return *GetNativePointerField<FVector*>(this, "APlayerController.AudioListenerLocationOverride"); }
-	FRotator& AudioListenerRotationOverrideField() { return *GetNativePointerField<FRotator*>(this, "APlayerController.AudioListenerRotationOverride"); }
-	FVector& SpawnLocationField() { return *GetNativePointerField<FVector*>(this, "APlayerController.SpawnLocation"); }
-	float& LastRetryPlayerTimeField() { return *GetNativePointerField<float*>(this, "APlayerController.LastRetryPlayerTime"); }
-	unsigned __int16& SeamlessTravelCountField() { return *GetNativePointerField<unsigned __int16*>(this, "APlayerController.SeamlessTravelCount"); }
-	unsigned __int16& LastCompletedSeamlessTravelCountField() { return *GetNativePointerField<unsigned __int16*>(this, "APlayerController.LastCompletedSeamlessTravelCount"); }
-	TArray<AActor *> AlwaysReleventNetworkActorsField() { return *GetNativePointerField<TArray<AActor *>*>(this, "APlayerController.AlwaysReleventNetworkActors"); }
-	FVector& LastReplicatedFocalLocField() { return *GetNativePointerField<FVector*>(this, "APlayerController.LastReplicatedFocalLoc"); }
-	bool& bIsDelayedNetCleanupField() { return *GetNativePointerField<bool*>(this, "APlayerController.bIsDelayedNetCleanup"); }
-	float& LastTeleportDistanceField() { return *GetNativePointerField<float*>(this, "APlayerController.LastTeleportDistance"); }
+	char& IgnoreMoveInputField() { return *GetNativePointerField<char*, API::FieldNameHash("APlayerController.IgnoreMoveInput")>(this, "APlayerController.IgnoreMoveInput"); }
+	char& IgnoreLookInputField() { return *GetNativePointerField<char*, API::FieldNameHash("APlayerController.IgnoreLookInput")>(this, "APlayerController.IgnoreLookInput"); }
+	TWeakObjectPtr<USceneComponent>& AudioListenerComponentField() { return *GetNativePointerField<TWeakObjectPtr<USceneComponent>*, API::FieldNameHash("APlayerController.AudioListenerComponent")>(this, "APlayerController.AudioListenerComponent"); }
+	FVector& AudioListenerLocationOverrideField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APlayerController.AudioListenerLocationOverride")>(this, "APlayerController.AudioListenerLocationOverride"); }
+	FRotator& AudioListenerRotationOverrideField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APlayerController.AudioListenerRotationOverride")>(this, "APlayerController.AudioListenerRotationOverride"); }
+	FVector& SpawnLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APlayerController.SpawnLocation")>(this, "APlayerController.SpawnLocation"); }
+	float& LastRetryPlayerTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APlayerController.LastRetryPlayerTime")>(this, "APlayerController.LastRetryPlayerTime"); }
+	unsigned __int16& SeamlessTravelCountField() { return *GetNativePointerField<unsigned __int16*, API::FieldNameHash("APlayerController.SeamlessTravelCount")>(this, "APlayerController.SeamlessTravelCount"); }
+	unsigned __int16& LastCompletedSeamlessTravelCountField() { return *GetNativePointerField<unsigned __int16*, API::FieldNameHash("APlayerController.LastCompletedSeamlessTravelCount")>(this, "APlayerController.LastCompletedSeamlessTravelCount"); }
+	TArray<AActor *> AlwaysReleventNetworkActorsField() { return *GetNativePointerField<TArray<AActor *>*, API::FieldNameHash("APlayerController.AlwaysReleventNetworkActors")>(this, "APlayerController.AlwaysReleventNetworkActors"); }
+	FVector& LastReplicatedFocalLocField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APlayerController.LastReplicatedFocalLoc")>(this, "APlayerController.LastReplicatedFocalLoc"); }
+	bool& bIsDelayedNetCleanupField() { return *GetNativePointerField<bool*, API::FieldNameHash("APlayerController.bIsDelayedNetCleanup")>(this, "APlayerController.bIsDelayedNetCleanup"); }
+	float& LastTeleportDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APlayerController.LastTeleportDistance")>(this, "APlayerController.LastTeleportDistance"); }
 
 	// Bit fields
 
@@ -1777,144 +1777,144 @@ struct AShooterPlayerController : APlayerController
 	FieldArray<long double, 10> LastRepeatUseConsumableTimeField() { return { this, "AShooterPlayerController.LastRepeatUseConsumableTime" }; }
 	FieldArray<long double, 10> HeldItemSlotTimeField() { return { this, "AShooterPlayerController.HeldItemSlotTime" }; }
 	FieldArray<long double, 10> LastUsedItemSlotTimesField() { return { this, "AShooterPlayerController.LastUsedItemSlotTimes" }; }
-	FVector& CurrentPlayerCharacterLocationField() { return *GetNativePointerField<FVector*>(this, "AShooterPlayerController.CurrentPlayerCharacterLocation"); }
-	int& ModifedButtonCountField() { return *GetNativePointerField<int*>(this, "AShooterPlayerController.ModifedButtonCount"); }
-	APrimalStructurePlacer * StructurePlacerField() { return *GetNativePointerField<APrimalStructurePlacer **>(this, "AShooterPlayerController.StructurePlacer"); }
-	FVector& LastDeathLocationField() { return *GetNativePointerField<FVector*>(this, "AShooterPlayerController.LastDeathLocation"); }
-	long double& LastDeathTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastDeathTime"); }
-	TWeakObjectPtr<APrimalCharacter>& LastDeathPrimalCharacterField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*>(this, "AShooterPlayerController.LastDeathPrimalCharacter"); }
-	bool& bWasDeadField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bWasDead"); }
-	long double& LastDeadCharacterDestructionTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastDeadCharacterDestructionTime"); }
-	bool& bShowGameModeHUDField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bShowGameModeHUD"); }
-	FVector2D& CurrentRadialDirection1Field() { return *GetNativePointerField<FVector2D*>(this, "AShooterPlayerController.CurrentRadialDirection1"); }
-	FVector2D& CurrentRadialDirection2Field() { return *GetNativePointerField<FVector2D*>(this, "AShooterPlayerController.CurrentRadialDirection2"); }
-	USoundCue * SelectSlotSoundField() { return *GetNativePointerField<USoundCue **>(this, "AShooterPlayerController.SelectSlotSound"); }
-	UPrimalLocalProfile * PrimalLocalProfileField() { return *GetNativePointerField<UPrimalLocalProfile **>(this, "AShooterPlayerController.PrimalLocalProfile"); }
-	bool& bPlayerSpeakingField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bPlayerSpeaking"); }
-	int& CurrentGameModeMaxNumOfRespawnsField() { return *GetNativePointerField<int*>(this, "AShooterPlayerController.CurrentGameModeMaxNumOfRespawns"); }
-	FVector& LastRawInputDirField() { return *GetNativePointerField<FVector*>(this, "AShooterPlayerController.LastRawInputDir"); }
-	unsigned __int64& TargetOrbitedPlayerIdField() { return *GetNativePointerField<unsigned __int64*>(this, "AShooterPlayerController.TargetOrbitedPlayerId"); }
-	char& TargetOrbitedTrialCountField() { return *GetNativePointerField<char*>(this, "AShooterPlayerController.TargetOrbitedTrialCount"); }
-	TWeakObjectPtr<AShooterCharacter>& LastControlledPlayerCharacterField() { return *GetNativePointerField<TWeakObjectPtr<AShooterCharacter>*>(this, "AShooterPlayerController.LastControlledPlayerCharacter"); }
-	TSubclassOf<APrimalStructurePlacer>& StructurePlacerClassField() { return *GetNativePointerField<TSubclassOf<APrimalStructurePlacer>*>(this, "AShooterPlayerController.StructurePlacerClass"); }
-	float& MaxUseDistanceField() { return *GetNativePointerField<float*>(this, "AShooterPlayerController.MaxUseDistance"); }
-	float& MaxUseCheckRadiusField() { return *GetNativePointerField<float*>(this, "AShooterPlayerController.MaxUseCheckRadius"); }
-	TArray<bool>& SavedSurvivorProfileSettingsField() { return *GetNativePointerField<TArray<bool>*>(this, "AShooterPlayerController.SavedSurvivorProfileSettings"); }
-	bool& bCachedOnlyShowOnlineTribeMembersField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bCachedOnlyShowOnlineTribeMembers"); }
-	TArray<TWeakObjectPtr<UPrimalInventoryComponent>>& RemoteViewingInventoriesField() { return *GetNativePointerField<TArray<TWeakObjectPtr<UPrimalInventoryComponent>>*>(this, "AShooterPlayerController.RemoteViewingInventories"); }
-	TWeakObjectPtr<AActor>& LastHeldUseActorField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*>(this, "AShooterPlayerController.LastHeldUseActor"); }
-	TWeakObjectPtr<UActorComponent>& LastHeldUseHitComponentField() { return *GetNativePointerField<TWeakObjectPtr<UActorComponent>*>(this, "AShooterPlayerController.LastHeldUseHitComponent"); }
-	int& LastHeldUseHitBodyIndexField() { return *GetNativePointerField<int*>(this, "AShooterPlayerController.LastHeldUseHitBodyIndex"); }
-	bool& bUsePressedFromGamepadField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bUsePressedFromGamepad"); }
-	TWeakObjectPtr<APrimalStructure>& SpawnAtBedField() { return *GetNativePointerField<TWeakObjectPtr<APrimalStructure>*>(this, "AShooterPlayerController.SpawnAtBed"); }
-	APawn * TempLastLostPawnField() { return *GetNativePointerField<APawn **>(this, "AShooterPlayerController.TempLastLostPawn"); }
-	bool& bHasLoadedProfileField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bHasLoadedProfile"); }
-	bool& bLockedInputDontRecenterMouseField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bLockedInputDontRecenterMouse"); }
-	long double& LastRespawnTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastRespawnTime"); }
-	bool& bIsFirstSpawnField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bIsFirstSpawn"); }
-	bool& bIsRespawningField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bIsRespawning"); }
-	bool& bIsVRPlayerField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bIsVRPlayer"); }
-	TSubclassOf<AHUD>& AwaitingHUDClassField() { return *GetNativePointerField<TSubclassOf<AHUD>*>(this, "AShooterPlayerController.AwaitingHUDClass"); }
-	FItemNetID& LastEquipedItemNetIDField() { return *GetNativePointerField<FItemNetID*>(this, "AShooterPlayerController.LastEquipedItemNetID"); }
-	FItemNetID& LastUnequippedItemNetIDField() { return *GetNativePointerField<FItemNetID*>(this, "AShooterPlayerController.LastUnequippedItemNetID"); }
-	__int64& LinkedPlayerIDField() { return *GetNativePointerField<__int64*>(this, "AShooterPlayerController.LinkedPlayerID"); }
-	bool& bDrawLocationField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bDrawLocation"); }
-	int& PlayerControllerNumField() { return *GetNativePointerField<int*>(this, "AShooterPlayerController.PlayerControllerNum"); }
-	FVector& LastTurnSpeedField() { return *GetNativePointerField<FVector*>(this, "AShooterPlayerController.LastTurnSpeed"); }
-	long double& LastMultiUseInteractionTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastMultiUseInteractionTime"); }
-	float& LastTimeSentCarriedRotationField() { return *GetNativePointerField<float*>(this, "AShooterPlayerController.LastTimeSentCarriedRotation"); }
-	FItemNetID& LastSteamItemIDToRemoveField() { return *GetNativePointerField<FItemNetID*>(this, "AShooterPlayerController.LastSteamItemIDToRemove"); }
-	FItemNetID& LastSteamItemIDToAddField() { return *GetNativePointerField<FItemNetID*>(this, "AShooterPlayerController.LastSteamItemIDToAdd"); }
-	bool& bConsumeItemSucceededField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bConsumeItemSucceeded"); }
-	bool& bRefreshedInvetoryForRemoveField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bRefreshedInvetoryForRemove"); }
-	bool& bServerRefreshedSteamInventoryField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bServerRefreshedSteamInventory"); }
-	bool& bServerRefreshStatusField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bServerRefreshStatus"); }
-	bool& bCloseSteamStatusSceneField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bCloseSteamStatusScene"); }
-	long double& LastSteamInventoryRefreshTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastSteamInventoryRefreshTime"); }
-	long double& LastRequesteDinoAncestorsTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastRequesteDinoAncestorsTime"); }
-	long double& LastDiedMessageTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastDiedMessageTime"); }
-	long double& LastNotifiedTorpidityIncreaseTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastNotifiedTorpidityIncreaseTime"); }
-	long double& LastInvDropRequestTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastInvDropRequestTime"); }
-	long double& LastHadPawnTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastHadPawnTime"); }
-	long double& LastChatMessageTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastChatMessageTime"); }
-	FItemNetInfo& ARKTributeItemNetInfoField() { return *GetNativePointerField<FItemNetInfo*>(this, "AShooterPlayerController.ARKTributeItemNetInfo"); }
-	bool& bServerIsPaintingField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bServerIsPainting"); }
-	bool& bServerPaintingSuccessField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bServerPaintingSuccess"); }
-	long double& LastListenServerNotifyOutOfRangeTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastListenServerNotifyOutOfRangeTime"); }
-	int& SpectatorCycleIndexField() { return *GetNativePointerField<int*>(this, "AShooterPlayerController.SpectatorCycleIndex"); }
-	bool& bPossessedAnyPawnField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bPossessedAnyPawn"); }
-	bool& bIsFastTravellingField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bIsFastTravelling"); }
-	bool& bSuppressAdminIconField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bSuppressAdminIcon"); }
-	long double& WaitingForSpawnUITimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.WaitingForSpawnUITime"); }
-	float& ChatSpamWeightField() { return *GetNativePointerField<float*>(this, "AShooterPlayerController.ChatSpamWeight"); }
-	bool& bChatSpammedField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bChatSpammed"); }
-	long double& EnteredSpectatingStateTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.EnteredSpectatingStateTime"); }
-	bool& bPreventPaintingStreamingField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bPreventPaintingStreaming"); }
-	long double& LastUsePressTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastUsePressTime"); }
-	TArray<int>& PlayerAppIDsField() { return *GetNativePointerField<TArray<int>*>(this, "AShooterPlayerController.PlayerAppIDs"); }
-	TArray<int>& NotifiedTribeWarIDsField() { return *GetNativePointerField<TArray<int>*>(this, "AShooterPlayerController.NotifiedTribeWarIDs"); }
-	TArray<FString>& NotifiedTribeWarNamesField() { return *GetNativePointerField<TArray<FString>*>(this, "AShooterPlayerController.NotifiedTribeWarNames"); }
-	int& ServerTribeLogLastLogIndexField() { return *GetNativePointerField<int*>(this, "AShooterPlayerController.ServerTribeLogLastLogIndex"); }
-	int& ServerTribeLogLastTribeIDField() { return *GetNativePointerField<int*>(this, "AShooterPlayerController.ServerTribeLogLastTribeID"); }
-	FVector& LastViewLocationField() { return *GetNativePointerField<FVector*>(this, "AShooterPlayerController.LastViewLocation"); }
-	bool& bHasGottenInitialSpawnLocationField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bHasGottenInitialSpawnLocation"); }
-	bool& bClientReceivedTribeLogField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bClientReceivedTribeLog"); }
-	TArray<FString>& CurrentTribeLogField() { return *GetNativePointerField<TArray<FString>*>(this, "AShooterPlayerController.CurrentTribeLog"); }
-	long double& LastTribeLogRequestTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastTribeLogRequestTime"); }
-	bool& bHasSurvivedOneDayField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bHasSurvivedOneDay"); }
-	bool& bHasReachedHighestPeakField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bHasReachedHighestPeak"); }
-	bool& bHasReachedLowestDepthField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bHasReachedLowestDepth"); }
-	TSet<FString, DefaultKeyFuncs<FString, 0>, FDefaultSetAllocator>& ServerCachedAchievementIDsField() { return *GetNativePointerField<TSet<FString, DefaultKeyFuncs<FString, 0>, FDefaultSetAllocator>*>(this, "AShooterPlayerController.ServerCachedAchievementIDs"); }
-	bool& bZoomingOutField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bZoomingOut"); }
-	bool& bZoomingInField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bZoomingIn"); }
-	long double& LastRPCStayAliveTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastRPCStayAliveTime"); }
-	int& PlayerBadgeGroupField() { return *GetNativePointerField<int*>(this, "AShooterPlayerController.PlayerBadgeGroup"); }
-	long double& LastMultiUseTraceTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastMultiUseTraceTime"); }
-	FVector& LastLargeMoveLocationField() { return *GetNativePointerField<FVector*>(this, "AShooterPlayerController.LastLargeMoveLocation"); }
-	long double& LastLargeMoveTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastLargeMoveTime"); }
-	long double& LastNotOnUnriddenDinoTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastNotOnUnriddenDinoTime"); }
-	long double& LastHitMarkerCharacterTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastHitMarkerCharacterTime"); }
-	bool& bLastHitMarkerCharacterAllyField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bLastHitMarkerCharacterAlly"); }
-	long double& LastHitMarkerStructureTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastHitMarkerStructureTime"); }
-	bool& bLastHitMarkerStructureAllyField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bLastHitMarkerStructureAlly"); }
-	float& DoFSettingCurrentTimerField() { return *GetNativePointerField<float*>(this, "AShooterPlayerController.DoFSettingCurrentTimer"); }
-	float& DoFSettingTargetTimerField() { return *GetNativePointerField<float*>(this, "AShooterPlayerController.DoFSettingTargetTimer"); }
-	int& LastSpawnPointIDField() { return *GetNativePointerField<int*>(this, "AShooterPlayerController.LastSpawnPointID"); }
-	int& LastSpawnRegionIndexField() { return *GetNativePointerField<int*>(this, "AShooterPlayerController.LastSpawnRegionIndex"); }
-	unsigned __int64& LastTransferredPlayerIDField() { return *GetNativePointerField<unsigned __int64*>(this, "AShooterPlayerController.LastTransferredPlayerID"); }
-	bool& bReceivedSubscribedAppsField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bReceivedSubscribedApps"); }
-	bool& bIsTransferringCharacterField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bIsTransferringCharacter"); }
-	long double& PossessedFirstPawnTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.PossessedFirstPawnTime"); }
-	int& SnapPointCycleField() { return *GetNativePointerField<int*>(this, "AShooterPlayerController.SnapPointCycle"); }
-	FVector& LastSnapPointCyclePositionField() { return *GetNativePointerField<FVector*>(this, "AShooterPlayerController.LastSnapPointCyclePosition"); }
-	int& ViewingWheelCategoryField() { return *GetNativePointerField<int*>(this, "AShooterPlayerController.ViewingWheelCategory"); }
-	long double& ForceDrawCurrentGroupsUntilTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.ForceDrawCurrentGroupsUntilTime"); }
-	long double& LastRequestedPlaceStructureTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastRequestedPlaceStructureTime"); }
-	int& PersonalDinoTameCountField() { return *GetNativePointerField<int*>(this, "AShooterPlayerController.PersonalDinoTameCount"); }
-	bool& bNextShowCharacterCreationUIDownloadField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bNextShowCharacterCreationUIDownload"); }
-	bool& bForceHideGameplayUIField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bForceHideGameplayUI"); }
-	long double& LastGamepadOpenRemoteInventoryTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastGamepadOpenRemoteInventoryTime"); }
-	bool& bIsGamepadActiveField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bIsGamepadActive"); }
-	bool& bClientIsDPCField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bClientIsDPC"); }
-	long double& LastClientRequestTribeOnlineListTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastClientRequestTribeOnlineListTime"); }
-	long double& LastClientModifiedARKInventoryTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastClientModifiedARKInventoryTime"); }
-	TArray<unsigned __int64>& ClientCachedTribeOnlineListField() { return *GetNativePointerField<TArray<unsigned __int64>*>(this, "AShooterPlayerController.ClientCachedTribeOnlineList"); }
-	bool& bPreventDefaultCharacterItemsField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bPreventDefaultCharacterItems"); }
-	float& SFXVolumeMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterPlayerController.SFXVolumeMultiplier"); }
-	long double& LastTeleportedTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastTeleportedTime"); }
-	unsigned __int64& LastConvertedPlayerIDField() { return *GetNativePointerField<unsigned __int64*>(this, "AShooterPlayerController.LastConvertedPlayerID"); }
-	FString& LastConvertedPlayerIDStringField() { return *GetNativePointerField<FString*>(this, "AShooterPlayerController.LastConvertedPlayerIDString"); }
-	long double& LastShowExtendedInfoTimeField() { return *GetNativePointerField<long double*>(this, "AShooterPlayerController.LastShowExtendedInfoTime"); }
-	bool& bHasDisplayedSplitScreenMessageField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bHasDisplayedSplitScreenMessage"); }
-	UPrimalItem * LastTransferredToRemoteInventoryItemField() { return *GetNativePointerField<UPrimalItem **>(this, "AShooterPlayerController.LastTransferredToRemoteInventoryItem"); }
-	TSet<TWeakObjectPtr<UPrimalInventoryComponent>, DefaultKeyFuncs<TWeakObjectPtr<UPrimalInventoryComponent>, 0>, FDefaultSetAllocator>& PendingResponseEquippedItemsQueueField() { return *GetNativePointerField<TSet<TWeakObjectPtr<UPrimalInventoryComponent>, DefaultKeyFuncs<TWeakObjectPtr<UPrimalInventoryComponent>, 0>, FDefaultSetAllocator>*>(this, "AShooterPlayerController.PendingResponseEquippedItemsQueue"); }
-	TSet<TWeakObjectPtr<UPrimalInventoryComponent>, DefaultKeyFuncs<TWeakObjectPtr<UPrimalInventoryComponent>, 0>, FDefaultSetAllocator>& PendingRequestEquippedItemsQueueField() { return *GetNativePointerField<TSet<TWeakObjectPtr<UPrimalInventoryComponent>, DefaultKeyFuncs<TWeakObjectPtr<UPrimalInventoryComponent>, 0>, FDefaultSetAllocator>*>(this, "AShooterPlayerController.PendingRequestEquippedItemsQueue"); }
-	bool& bIsViewingTributeInventoryField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bIsViewingTributeInventory"); }
-	bool& bDrawBlackBackgroundField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bDrawBlackBackground"); }
-	bool& bFailedToDownloadedTransferredCharacterField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bFailedToDownloadedTransferredCharacter"); }
-	TSubclassOf<APrimalBuff>& CreativeModeBuffField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*>(this, "AShooterPlayerController.CreativeModeBuff"); }
-	float& PrimalStatsCacheFlushIntervalField() { return *GetNativePointerField<float*>(this, "AShooterPlayerController.PrimalStatsCacheFlushInterval"); }
-	bool& bIsPrimalStatsTimerActiveField() { return *GetNativePointerField<bool*>(this, "AShooterPlayerController.bIsPrimalStatsTimerActive"); }
+	FVector& CurrentPlayerCharacterLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterPlayerController.CurrentPlayerCharacterLocation")>(this, "AShooterPlayerController.CurrentPlayerCharacterLocation"); }
+	int& ModifedButtonCountField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterPlayerController.ModifedButtonCount")>(this, "AShooterPlayerController.ModifedButtonCount"); }
+	APrimalStructurePlacer * StructurePlacerField() { return *GetNativePointerField<APrimalStructurePlacer **, API::FieldNameHash("AShooterPlayerController.StructurePlacer")>(this, "AShooterPlayerController.StructurePlacer"); }
+	FVector& LastDeathLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterPlayerController.LastDeathLocation")>(this, "AShooterPlayerController.LastDeathLocation"); }
+	long double& LastDeathTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastDeathTime")>(this, "AShooterPlayerController.LastDeathTime"); }
+	TWeakObjectPtr<APrimalCharacter>& LastDeathPrimalCharacterField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*, API::FieldNameHash("AShooterPlayerController.LastDeathPrimalCharacter")>(this, "AShooterPlayerController.LastDeathPrimalCharacter"); }
+	bool& bWasDeadField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bWasDead")>(this, "AShooterPlayerController.bWasDead"); }
+	long double& LastDeadCharacterDestructionTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastDeadCharacterDestructionTime")>(this, "AShooterPlayerController.LastDeadCharacterDestructionTime"); }
+	bool& bShowGameModeHUDField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bShowGameModeHUD")>(this, "AShooterPlayerController.bShowGameModeHUD"); }
+	FVector2D& CurrentRadialDirection1Field() { return *GetNativePointerField<FVector2D*, API::FieldNameHash("AShooterPlayerController.CurrentRadialDirection1")>(this, "AShooterPlayerController.CurrentRadialDirection1"); }
+	FVector2D& CurrentRadialDirection2Field() { return *GetNativePointerField<FVector2D*, API::FieldNameHash("AShooterPlayerController.CurrentRadialDirection2")>(this, "AShooterPlayerController.CurrentRadialDirection2"); }
+	USoundCue * SelectSlotSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("AShooterPlayerController.SelectSlotSound")>(this, "AShooterPlayerController.SelectSlotSound"); }
+	UPrimalLocalProfile * PrimalLocalProfileField() { return *GetNativePointerField<UPrimalLocalProfile **, API::FieldNameHash("AShooterPlayerController.PrimalLocalProfile")>(this, "AShooterPlayerController.PrimalLocalProfile"); }
+	bool& bPlayerSpeakingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bPlayerSpeaking")>(this, "AShooterPlayerController.bPlayerSpeaking"); }
+	int& CurrentGameModeMaxNumOfRespawnsField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterPlayerController.CurrentGameModeMaxNumOfRespawns")>(this, "AShooterPlayerController.CurrentGameModeMaxNumOfRespawns"); }
+	FVector& LastRawInputDirField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterPlayerController.LastRawInputDir")>(this, "AShooterPlayerController.LastRawInputDir"); }
+	unsigned __int64& TargetOrbitedPlayerIdField() { return *GetNativePointerField<unsigned __int64*, API::FieldNameHash("AShooterPlayerController.TargetOrbitedPlayerId")>(this, "AShooterPlayerController.TargetOrbitedPlayerId"); }
+	char& TargetOrbitedTrialCountField() { return *GetNativePointerField<char*, API::FieldNameHash("AShooterPlayerController.TargetOrbitedTrialCount")>(this, "AShooterPlayerController.TargetOrbitedTrialCount"); }
+	TWeakObjectPtr<AShooterCharacter>& LastControlledPlayerCharacterField() { return *GetNativePointerField<TWeakObjectPtr<AShooterCharacter>*, API::FieldNameHash("AShooterPlayerController.LastControlledPlayerCharacter")>(this, "AShooterPlayerController.LastControlledPlayerCharacter"); }
+	TSubclassOf<APrimalStructurePlacer>& StructurePlacerClassField() { return *GetNativePointerField<TSubclassOf<APrimalStructurePlacer>*, API::FieldNameHash("AShooterPlayerController.StructurePlacerClass")>(this, "AShooterPlayerController.StructurePlacerClass"); }
+	float& MaxUseDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterPlayerController.MaxUseDistance")>(this, "AShooterPlayerController.MaxUseDistance"); }
+	float& MaxUseCheckRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterPlayerController.MaxUseCheckRadius")>(this, "AShooterPlayerController.MaxUseCheckRadius"); }
+	TArray<bool>& SavedSurvivorProfileSettingsField() { return *GetNativePointerField<TArray<bool>*, API::FieldNameHash("AShooterPlayerController.SavedSurvivorProfileSettings")>(this, "AShooterPlayerController.SavedSurvivorProfileSettings"); }
+	bool& bCachedOnlyShowOnlineTribeMembersField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bCachedOnlyShowOnlineTribeMembers")>(this, "AShooterPlayerController.bCachedOnlyShowOnlineTribeMembers"); }
+	TArray<TWeakObjectPtr<UPrimalInventoryComponent>>& RemoteViewingInventoriesField() { return *GetNativePointerField<TArray<TWeakObjectPtr<UPrimalInventoryComponent>>*, API::FieldNameHash("AShooterPlayerController.RemoteViewingInventories")>(this, "AShooterPlayerController.RemoteViewingInventories"); }
+	TWeakObjectPtr<AActor>& LastHeldUseActorField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*, API::FieldNameHash("AShooterPlayerController.LastHeldUseActor")>(this, "AShooterPlayerController.LastHeldUseActor"); }
+	TWeakObjectPtr<UActorComponent>& LastHeldUseHitComponentField() { return *GetNativePointerField<TWeakObjectPtr<UActorComponent>*, API::FieldNameHash("AShooterPlayerController.LastHeldUseHitComponent")>(this, "AShooterPlayerController.LastHeldUseHitComponent"); }
+	int& LastHeldUseHitBodyIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterPlayerController.LastHeldUseHitBodyIndex")>(this, "AShooterPlayerController.LastHeldUseHitBodyIndex"); }
+	bool& bUsePressedFromGamepadField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bUsePressedFromGamepad")>(this, "AShooterPlayerController.bUsePressedFromGamepad"); }
+	TWeakObjectPtr<APrimalStructure>& SpawnAtBedField() { return *GetNativePointerField<TWeakObjectPtr<APrimalStructure>*, API::FieldNameHash("AShooterPlayerController.SpawnAtBed")>(this, "AShooterPlayerController.SpawnAtBed"); }
+	APawn * TempLastLostPawnField() { return *GetNativePointerField<APawn **, API::FieldNameHash("AShooterPlayerController.TempLastLostPawn")>(this, "AShooterPlayerController.TempLastLostPawn"); }
+	bool& bHasLoadedProfileField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bHasLoadedProfile")>(this, "AShooterPlayerController.bHasLoadedProfile"); }
+	bool& bLockedInputDontRecenterMouseField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bLockedInputDontRecenterMouse")>(this, "AShooterPlayerController.bLockedInputDontRecenterMouse"); }
+	long double& LastRespawnTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastRespawnTime")>(this, "AShooterPlayerController.LastRespawnTime"); }
+	bool& bIsFirstSpawnField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bIsFirstSpawn")>(this, "AShooterPlayerController.bIsFirstSpawn"); }
+	bool& bIsRespawningField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bIsRespawning")>(this, "AShooterPlayerController.bIsRespawning"); }
+	bool& bIsVRPlayerField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bIsVRPlayer")>(this, "AShooterPlayerController.bIsVRPlayer"); }
+	TSubclassOf<AHUD>& AwaitingHUDClassField() { return *GetNativePointerField<TSubclassOf<AHUD>*, API::FieldNameHash("AShooterPlayerController.AwaitingHUDClass")>(this, "AShooterPlayerController.AwaitingHUDClass"); }
+	FItemNetID& LastEquipedItemNetIDField() { return *GetNativePointerField<FItemNetID*, API::FieldNameHash("AShooterPlayerController.LastEquipedItemNetID")>(this, "AShooterPlayerController.LastEquipedItemNetID"); }
+	FItemNetID& LastUnequippedItemNetIDField() { return *GetNativePointerField<FItemNetID*, API::FieldNameHash("AShooterPlayerController.LastUnequippedItemNetID")>(this, "AShooterPlayerController.LastUnequippedItemNetID"); }
+	__int64& LinkedPlayerIDField() { return *GetNativePointerField<__int64*, API::FieldNameHash("AShooterPlayerController.LinkedPlayerID")>(this, "AShooterPlayerController.LinkedPlayerID"); }
+	bool& bDrawLocationField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bDrawLocation")>(this, "AShooterPlayerController.bDrawLocation"); }
+	int& PlayerControllerNumField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterPlayerController.PlayerControllerNum")>(this, "AShooterPlayerController.PlayerControllerNum"); }
+	FVector& LastTurnSpeedField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterPlayerController.LastTurnSpeed")>(this, "AShooterPlayerController.LastTurnSpeed"); }
+	long double& LastMultiUseInteractionTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastMultiUseInteractionTime")>(this, "AShooterPlayerController.LastMultiUseInteractionTime"); }
+	float& LastTimeSentCarriedRotationField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterPlayerController.LastTimeSentCarriedRotation")>(this, "AShooterPlayerController.LastTimeSentCarriedRotation"); }
+	FItemNetID& LastSteamItemIDToRemoveField() { return *GetNativePointerField<FItemNetID*, API::FieldNameHash("AShooterPlayerController.LastSteamItemIDToRemove")>(this, "AShooterPlayerController.LastSteamItemIDToRemove"); }
+	FItemNetID& LastSteamItemIDToAddField() { return *GetNativePointerField<FItemNetID*, API::FieldNameHash("AShooterPlayerController.LastSteamItemIDToAdd")>(this, "AShooterPlayerController.LastSteamItemIDToAdd"); }
+	bool& bConsumeItemSucceededField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bConsumeItemSucceeded")>(this, "AShooterPlayerController.bConsumeItemSucceeded"); }
+	bool& bRefreshedInvetoryForRemoveField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bRefreshedInvetoryForRemove")>(this, "AShooterPlayerController.bRefreshedInvetoryForRemove"); }
+	bool& bServerRefreshedSteamInventoryField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bServerRefreshedSteamInventory")>(this, "AShooterPlayerController.bServerRefreshedSteamInventory"); }
+	bool& bServerRefreshStatusField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bServerRefreshStatus")>(this, "AShooterPlayerController.bServerRefreshStatus"); }
+	bool& bCloseSteamStatusSceneField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bCloseSteamStatusScene")>(this, "AShooterPlayerController.bCloseSteamStatusScene"); }
+	long double& LastSteamInventoryRefreshTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastSteamInventoryRefreshTime")>(this, "AShooterPlayerController.LastSteamInventoryRefreshTime"); }
+	long double& LastRequesteDinoAncestorsTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastRequesteDinoAncestorsTime")>(this, "AShooterPlayerController.LastRequesteDinoAncestorsTime"); }
+	long double& LastDiedMessageTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastDiedMessageTime")>(this, "AShooterPlayerController.LastDiedMessageTime"); }
+	long double& LastNotifiedTorpidityIncreaseTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastNotifiedTorpidityIncreaseTime")>(this, "AShooterPlayerController.LastNotifiedTorpidityIncreaseTime"); }
+	long double& LastInvDropRequestTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastInvDropRequestTime")>(this, "AShooterPlayerController.LastInvDropRequestTime"); }
+	long double& LastHadPawnTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastHadPawnTime")>(this, "AShooterPlayerController.LastHadPawnTime"); }
+	long double& LastChatMessageTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastChatMessageTime")>(this, "AShooterPlayerController.LastChatMessageTime"); }
+	FItemNetInfo& ARKTributeItemNetInfoField() { return *GetNativePointerField<FItemNetInfo*, API::FieldNameHash("AShooterPlayerController.ARKTributeItemNetInfo")>(this, "AShooterPlayerController.ARKTributeItemNetInfo"); }
+	bool& bServerIsPaintingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bServerIsPainting")>(this, "AShooterPlayerController.bServerIsPainting"); }
+	bool& bServerPaintingSuccessField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bServerPaintingSuccess")>(this, "AShooterPlayerController.bServerPaintingSuccess"); }
+	long double& LastListenServerNotifyOutOfRangeTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastListenServerNotifyOutOfRangeTime")>(this, "AShooterPlayerController.LastListenServerNotifyOutOfRangeTime"); }
+	int& SpectatorCycleIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterPlayerController.SpectatorCycleIndex")>(this, "AShooterPlayerController.SpectatorCycleIndex"); }
+	bool& bPossessedAnyPawnField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bPossessedAnyPawn")>(this, "AShooterPlayerController.bPossessedAnyPawn"); }
+	bool& bIsFastTravellingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bIsFastTravelling")>(this, "AShooterPlayerController.bIsFastTravelling"); }
+	bool& bSuppressAdminIconField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bSuppressAdminIcon")>(this, "AShooterPlayerController.bSuppressAdminIcon"); }
+	long double& WaitingForSpawnUITimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.WaitingForSpawnUITime")>(this, "AShooterPlayerController.WaitingForSpawnUITime"); }
+	float& ChatSpamWeightField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterPlayerController.ChatSpamWeight")>(this, "AShooterPlayerController.ChatSpamWeight"); }
+	bool& bChatSpammedField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bChatSpammed")>(this, "AShooterPlayerController.bChatSpammed"); }
+	long double& EnteredSpectatingStateTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.EnteredSpectatingStateTime")>(this, "AShooterPlayerController.EnteredSpectatingStateTime"); }
+	bool& bPreventPaintingStreamingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bPreventPaintingStreaming")>(this, "AShooterPlayerController.bPreventPaintingStreaming"); }
+	long double& LastUsePressTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastUsePressTime")>(this, "AShooterPlayerController.LastUsePressTime"); }
+	TArray<int>& PlayerAppIDsField() { return *GetNativePointerField<TArray<int>*, API::FieldNameHash("AShooterPlayerController.PlayerAppIDs")>(this, "AShooterPlayerController.PlayerAppIDs"); }
+	TArray<int>& NotifiedTribeWarIDsField() { return *GetNativePointerField<TArray<int>*, API::FieldNameHash("AShooterPlayerController.NotifiedTribeWarIDs")>(this, "AShooterPlayerController.NotifiedTribeWarIDs"); }
+	TArray<FString>& NotifiedTribeWarNamesField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("AShooterPlayerController.NotifiedTribeWarNames")>(this, "AShooterPlayerController.NotifiedTribeWarNames"); }
+	int& ServerTribeLogLastLogIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterPlayerController.ServerTribeLogLastLogIndex")>(this, "AShooterPlayerController.ServerTribeLogLastLogIndex"); }
+	int& ServerTribeLogLastTribeIDField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterPlayerController.ServerTribeLogLastTribeID")>(this, "AShooterPlayerController.ServerTribeLogLastTribeID"); }
+	FVector& LastViewLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterPlayerController.LastViewLocation")>(this, "AShooterPlayerController.LastViewLocation"); }
+	bool& bHasGottenInitialSpawnLocationField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bHasGottenInitialSpawnLocation")>(this, "AShooterPlayerController.bHasGottenInitialSpawnLocation"); }
+	bool& bClientReceivedTribeLogField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bClientReceivedTribeLog")>(this, "AShooterPlayerController.bClientReceivedTribeLog"); }
+	TArray<FString>& CurrentTribeLogField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("AShooterPlayerController.CurrentTribeLog")>(this, "AShooterPlayerController.CurrentTribeLog"); }
+	long double& LastTribeLogRequestTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastTribeLogRequestTime")>(this, "AShooterPlayerController.LastTribeLogRequestTime"); }
+	bool& bHasSurvivedOneDayField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bHasSurvivedOneDay")>(this, "AShooterPlayerController.bHasSurvivedOneDay"); }
+	bool& bHasReachedHighestPeakField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bHasReachedHighestPeak")>(this, "AShooterPlayerController.bHasReachedHighestPeak"); }
+	bool& bHasReachedLowestDepthField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bHasReachedLowestDepth")>(this, "AShooterPlayerController.bHasReachedLowestDepth"); }
+	TSet<FString, DefaultKeyFuncs<FString, 0>, FDefaultSetAllocator>& ServerCachedAchievementIDsField() { return *GetNativePointerField<TSet<FString, DefaultKeyFuncs<FString, 0>, FDefaultSetAllocator>*, API::FieldNameHash("AShooterPlayerController.ServerCachedAchievementIDs")>(this, "AShooterPlayerController.ServerCachedAchievementIDs"); }
+	bool& bZoomingOutField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bZoomingOut")>(this, "AShooterPlayerController.bZoomingOut"); }
+	bool& bZoomingInField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bZoomingIn")>(this, "AShooterPlayerController.bZoomingIn"); }
+	long double& LastRPCStayAliveTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastRPCStayAliveTime")>(this, "AShooterPlayerController.LastRPCStayAliveTime"); }
+	int& PlayerBadgeGroupField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterPlayerController.PlayerBadgeGroup")>(this, "AShooterPlayerController.PlayerBadgeGroup"); }
+	long double& LastMultiUseTraceTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastMultiUseTraceTime")>(this, "AShooterPlayerController.LastMultiUseTraceTime"); }
+	FVector& LastLargeMoveLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterPlayerController.LastLargeMoveLocation")>(this, "AShooterPlayerController.LastLargeMoveLocation"); }
+	long double& LastLargeMoveTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastLargeMoveTime")>(this, "AShooterPlayerController.LastLargeMoveTime"); }
+	long double& LastNotOnUnriddenDinoTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastNotOnUnriddenDinoTime")>(this, "AShooterPlayerController.LastNotOnUnriddenDinoTime"); }
+	long double& LastHitMarkerCharacterTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastHitMarkerCharacterTime")>(this, "AShooterPlayerController.LastHitMarkerCharacterTime"); }
+	bool& bLastHitMarkerCharacterAllyField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bLastHitMarkerCharacterAlly")>(this, "AShooterPlayerController.bLastHitMarkerCharacterAlly"); }
+	long double& LastHitMarkerStructureTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastHitMarkerStructureTime")>(this, "AShooterPlayerController.LastHitMarkerStructureTime"); }
+	bool& bLastHitMarkerStructureAllyField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bLastHitMarkerStructureAlly")>(this, "AShooterPlayerController.bLastHitMarkerStructureAlly"); }
+	float& DoFSettingCurrentTimerField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterPlayerController.DoFSettingCurrentTimer")>(this, "AShooterPlayerController.DoFSettingCurrentTimer"); }
+	float& DoFSettingTargetTimerField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterPlayerController.DoFSettingTargetTimer")>(this, "AShooterPlayerController.DoFSettingTargetTimer"); }
+	int& LastSpawnPointIDField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterPlayerController.LastSpawnPointID")>(this, "AShooterPlayerController.LastSpawnPointID"); }
+	int& LastSpawnRegionIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterPlayerController.LastSpawnRegionIndex")>(this, "AShooterPlayerController.LastSpawnRegionIndex"); }
+	unsigned __int64& LastTransferredPlayerIDField() { return *GetNativePointerField<unsigned __int64*, API::FieldNameHash("AShooterPlayerController.LastTransferredPlayerID")>(this, "AShooterPlayerController.LastTransferredPlayerID"); }
+	bool& bReceivedSubscribedAppsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bReceivedSubscribedApps")>(this, "AShooterPlayerController.bReceivedSubscribedApps"); }
+	bool& bIsTransferringCharacterField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bIsTransferringCharacter")>(this, "AShooterPlayerController.bIsTransferringCharacter"); }
+	long double& PossessedFirstPawnTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.PossessedFirstPawnTime")>(this, "AShooterPlayerController.PossessedFirstPawnTime"); }
+	int& SnapPointCycleField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterPlayerController.SnapPointCycle")>(this, "AShooterPlayerController.SnapPointCycle"); }
+	FVector& LastSnapPointCyclePositionField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterPlayerController.LastSnapPointCyclePosition")>(this, "AShooterPlayerController.LastSnapPointCyclePosition"); }
+	int& ViewingWheelCategoryField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterPlayerController.ViewingWheelCategory")>(this, "AShooterPlayerController.ViewingWheelCategory"); }
+	long double& ForceDrawCurrentGroupsUntilTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.ForceDrawCurrentGroupsUntilTime")>(this, "AShooterPlayerController.ForceDrawCurrentGroupsUntilTime"); }
+	long double& LastRequestedPlaceStructureTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastRequestedPlaceStructureTime")>(this, "AShooterPlayerController.LastRequestedPlaceStructureTime"); }
+	int& PersonalDinoTameCountField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterPlayerController.PersonalDinoTameCount")>(this, "AShooterPlayerController.PersonalDinoTameCount"); }
+	bool& bNextShowCharacterCreationUIDownloadField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bNextShowCharacterCreationUIDownload")>(this, "AShooterPlayerController.bNextShowCharacterCreationUIDownload"); }
+	bool& bForceHideGameplayUIField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bForceHideGameplayUI")>(this, "AShooterPlayerController.bForceHideGameplayUI"); }
+	long double& LastGamepadOpenRemoteInventoryTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastGamepadOpenRemoteInventoryTime")>(this, "AShooterPlayerController.LastGamepadOpenRemoteInventoryTime"); }
+	bool& bIsGamepadActiveField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bIsGamepadActive")>(this, "AShooterPlayerController.bIsGamepadActive"); }
+	bool& bClientIsDPCField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bClientIsDPC")>(this, "AShooterPlayerController.bClientIsDPC"); }
+	long double& LastClientRequestTribeOnlineListTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastClientRequestTribeOnlineListTime")>(this, "AShooterPlayerController.LastClientRequestTribeOnlineListTime"); }
+	long double& LastClientModifiedARKInventoryTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastClientModifiedARKInventoryTime")>(this, "AShooterPlayerController.LastClientModifiedARKInventoryTime"); }
+	TArray<unsigned __int64>& ClientCachedTribeOnlineListField() { return *GetNativePointerField<TArray<unsigned __int64>*, API::FieldNameHash("AShooterPlayerController.ClientCachedTribeOnlineList")>(this, "AShooterPlayerController.ClientCachedTribeOnlineList"); }
+	bool& bPreventDefaultCharacterItemsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bPreventDefaultCharacterItems")>(this, "AShooterPlayerController.bPreventDefaultCharacterItems"); }
+	float& SFXVolumeMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterPlayerController.SFXVolumeMultiplier")>(this, "AShooterPlayerController.SFXVolumeMultiplier"); }
+	long double& LastTeleportedTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastTeleportedTime")>(this, "AShooterPlayerController.LastTeleportedTime"); }
+	unsigned __int64& LastConvertedPlayerIDField() { return *GetNativePointerField<unsigned __int64*, API::FieldNameHash("AShooterPlayerController.LastConvertedPlayerID")>(this, "AShooterPlayerController.LastConvertedPlayerID"); }
+	FString& LastConvertedPlayerIDStringField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterPlayerController.LastConvertedPlayerIDString")>(this, "AShooterPlayerController.LastConvertedPlayerIDString"); }
+	long double& LastShowExtendedInfoTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterPlayerController.LastShowExtendedInfoTime")>(this, "AShooterPlayerController.LastShowExtendedInfoTime"); }
+	bool& bHasDisplayedSplitScreenMessageField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bHasDisplayedSplitScreenMessage")>(this, "AShooterPlayerController.bHasDisplayedSplitScreenMessage"); }
+	UPrimalItem * LastTransferredToRemoteInventoryItemField() { return *GetNativePointerField<UPrimalItem **, API::FieldNameHash("AShooterPlayerController.LastTransferredToRemoteInventoryItem")>(this, "AShooterPlayerController.LastTransferredToRemoteInventoryItem"); }
+	TSet<TWeakObjectPtr<UPrimalInventoryComponent>, DefaultKeyFuncs<TWeakObjectPtr<UPrimalInventoryComponent>, 0>, FDefaultSetAllocator>& PendingResponseEquippedItemsQueueField() { return *GetNativePointerField<TSet<TWeakObjectPtr<UPrimalInventoryComponent>, DefaultKeyFuncs<TWeakObjectPtr<UPrimalInventoryComponent>, 0>, FDefaultSetAllocator>*, API::FieldNameHash("AShooterPlayerController.PendingResponseEquippedItemsQueue")>(this, "AShooterPlayerController.PendingResponseEquippedItemsQueue"); }
+	TSet<TWeakObjectPtr<UPrimalInventoryComponent>, DefaultKeyFuncs<TWeakObjectPtr<UPrimalInventoryComponent>, 0>, FDefaultSetAllocator>& PendingRequestEquippedItemsQueueField() { return *GetNativePointerField<TSet<TWeakObjectPtr<UPrimalInventoryComponent>, DefaultKeyFuncs<TWeakObjectPtr<UPrimalInventoryComponent>, 0>, FDefaultSetAllocator>*, API::FieldNameHash("AShooterPlayerController.PendingRequestEquippedItemsQueue")>(this, "AShooterPlayerController.PendingRequestEquippedItemsQueue"); }
+	bool& bIsViewingTributeInventoryField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bIsViewingTributeInventory")>(this, "AShooterPlayerController.bIsViewingTributeInventory"); }
+	bool& bDrawBlackBackgroundField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bDrawBlackBackground")>(this, "AShooterPlayerController.bDrawBlackBackground"); }
+	bool& bFailedToDownloadedTransferredCharacterField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bFailedToDownloadedTransferredCharacter")>(this, "AShooterPlayerController.bFailedToDownloadedTransferredCharacter"); }
+	TSubclassOf<APrimalBuff>& CreativeModeBuffField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*, API::FieldNameHash("AShooterPlayerController.CreativeModeBuff")>(this, "AShooterPlayerController.CreativeModeBuff"); }
+	float& PrimalStatsCacheFlushIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterPlayerController.PrimalStatsCacheFlushInterval")>(this, "AShooterPlayerController.PrimalStatsCacheFlushInterval"); }
+	bool& bIsPrimalStatsTimerActiveField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterPlayerController.bIsPrimalStatsTimerActive")>(this, "AShooterPlayerController.bIsPrimalStatsTimerActive"); }
 
 	// Bit fields
 
@@ -2477,20 +2477,20 @@ struct AShooterPlayerController : APlayerController
 
 struct ACharacter : APawn
 {
-	TSubobjectPtr<UCharacterMovementComponent>& CharacterMovementField() { return *GetNativePointerField<TSubobjectPtr<UCharacterMovementComponent>*>(this, "ACharacter.CharacterMovement"); }
-	FVector& BaseTranslationOffsetField() { return *GetNativePointerField<FVector*>(this, "ACharacter.BaseTranslationOffset"); }
-	char& ReplicatedMovementModeField() { return *GetNativePointerField<char*>(this, "ACharacter.ReplicatedMovementMode"); }
-	float& LeftDynamicActorBaseTimeField() { return *GetNativePointerField<float*>(this, "ACharacter.LeftDynamicActorBaseTime"); }
-	float& CrouchedEyeHeightField() { return *GetNativePointerField<float*>(this, "ACharacter.CrouchedEyeHeight"); }
-	float& ProneEyeHeightField() { return *GetNativePointerField<float*>(this, "ACharacter.ProneEyeHeight"); }
-	float& HarvestingDestructionMeshRangeMultiplerField() { return *GetNativePointerField<float*>(this, "ACharacter.HarvestingDestructionMeshRangeMultipler"); }
-	TArray<USoundBase *> CharacterOverrideSoundFromField() { return *GetNativePointerField<TArray<USoundBase *>*>(this, "ACharacter.CharacterOverrideSoundFrom"); }
-	TArray<USoundBase *> CharacterOverrideSoundToField() { return *GetNativePointerField<TArray<USoundBase *>*>(this, "ACharacter.CharacterOverrideSoundTo"); }
-	bool& bInBaseReplicationField() { return *GetNativePointerField<bool*>(this, "ACharacter.bInBaseReplication"); }
-	float& JumpKeyHoldTimeField() { return *GetNativePointerField<float*>(this, "ACharacter.JumpKeyHoldTime"); }
-	float& JumpMaxHoldTimeField() { return *GetNativePointerField<float*>(this, "ACharacter.JumpMaxHoldTime"); }
-	int& LastTeleportedFrameField() { return *GetNativePointerField<int*>(this, "ACharacter.LastTeleportedFrame"); }
-	long double& ForceUnfreezeSkeletalDynamicsUntilTimeField() { return *GetNativePointerField<long double*>(this, "ACharacter.ForceUnfreezeSkeletalDynamicsUntilTime"); }
+	TSubobjectPtr<UCharacterMovementComponent>& CharacterMovementField() { return *GetNativePointerField<TSubobjectPtr<UCharacterMovementComponent>*, API::FieldNameHash("ACharacter.CharacterMovement")>(this, "ACharacter.CharacterMovement"); }
+	FVector& BaseTranslationOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("ACharacter.BaseTranslationOffset")>(this, "ACharacter.BaseTranslationOffset"); }
+	char& ReplicatedMovementModeField() { return *GetNativePointerField<char*, API::FieldNameHash("ACharacter.ReplicatedMovementMode")>(this, "ACharacter.ReplicatedMovementMode"); }
+	float& LeftDynamicActorBaseTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("ACharacter.LeftDynamicActorBaseTime")>(this, "ACharacter.LeftDynamicActorBaseTime"); }
+	float& CrouchedEyeHeightField() { return *GetNativePointerField<float*, API::FieldNameHash("ACharacter.CrouchedEyeHeight")>(this, "ACharacter.CrouchedEyeHeight"); }
+	float& ProneEyeHeightField() { return *GetNativePointerField<float*, API::FieldNameHash("ACharacter.ProneEyeHeight")>(this, "ACharacter.ProneEyeHeight"); }
+	float& HarvestingDestructionMeshRangeMultiplerField() { return *GetNativePointerField<float*, API::FieldNameHash("ACharacter.HarvestingDestructionMeshRangeMultipler")>(this, "ACharacter.HarvestingDestructionMeshRangeMultipler"); }
+	TArray<USoundBase *> CharacterOverrideSoundFromField() { return *GetNativePointerField<TArray<USoundBase *>*, API::FieldNameHash("ACharacter.CharacterOverrideSoundFrom")>(this, "ACharacter.CharacterOverrideSoundFrom"); }
+	TArray<USoundBase *> CharacterOverrideSoundToField() { return *GetNativePointerField<TArray<USoundBase *>*, API::FieldNameHash("ACharacter.CharacterOverrideSoundTo")>(this, "ACharacter.CharacterOverrideSoundTo"); }
+	bool& bInBaseReplicationField() { return *GetNativePointerField<bool*, API::FieldNameHash("ACharacter.bInBaseReplication")>(this, "ACharacter.bInBaseReplication"); }
+	float& JumpKeyHoldTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("ACharacter.JumpKeyHoldTime")>(this, "ACharacter.JumpKeyHoldTime"); }
+	float& JumpMaxHoldTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("ACharacter.JumpMaxHoldTime")>(this, "ACharacter.JumpMaxHoldTime"); }
+	int& LastTeleportedFrameField() { return *GetNativePointerField<int*, API::FieldNameHash("ACharacter.LastTeleportedFrame")>(this, "ACharacter.LastTeleportedFrame"); }
+	long double& ForceUnfreezeSkeletalDynamicsUntilTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("ACharacter.ForceUnfreezeSkeletalDynamicsUntilTime")>(this, "ACharacter.ForceUnfreezeSkeletalDynamicsUntilTime"); }
 
 	// Bit fields
 
@@ -2595,244 +2595,244 @@ struct ACharacter : APawn
 
 struct APrimalCharacter : ACharacter
 {
-	FVector& OldLocationField() { return *GetNativePointerField<FVector*>(this, "APrimalCharacter.OldLocation"); }
-	FRotator& OldRotationField() { return *GetNativePointerField<FRotator*>(this, "APrimalCharacter.OldRotation"); }
-	float& EffectorInterpSpeedField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.EffectorInterpSpeed"); }
-	float& HalfLegLengthField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.HalfLegLength"); }
-	float& TwoLeggedVirtualPointDistFactorField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.TwoLeggedVirtualPointDistFactor"); }
-	float& FullIKDistanceField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.FullIKDistance"); }
-	float& IKAfterFallingTimeField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.IKAfterFallingTime"); }
-	float& SimpleIkRateField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.SimpleIkRate"); }
-	FVector& GroundCheckExtentField() { return *GetNativePointerField<FVector*>(this, "APrimalCharacter.GroundCheckExtent"); }
-	long double& LastForceAimedCharactersTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastForceAimedCharactersTime"); }
-	UAnimMontage * JumpAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalCharacter.JumpAnim"); }
-	UAnimMontage * LandedAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalCharacter.LandedAnim"); }
-	UAnimMontage * HurtAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalCharacter.HurtAnim"); }
-	UAnimMontage * HurtAnim_FlyingField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalCharacter.HurtAnim_Flying"); }
-	UAnimMontage * PinnedAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalCharacter.PinnedAnim"); }
-	USoundCue * HurtSoundField() { return *GetNativePointerField<USoundCue **>(this, "APrimalCharacter.HurtSound"); }
-	FName& RootBodyBoneNameField() { return *GetNativePointerField<FName*>(this, "APrimalCharacter.RootBodyBoneName"); }
-	TArray<APrimalBuff *> BuffsField() { return *GetNativePointerField<TArray<APrimalBuff *>*>(this, "APrimalCharacter.Buffs"); }
-	FString& TribeNameField() { return *GetNativePointerField<FString*>(this, "APrimalCharacter.TribeName"); }
-	float& WaterSubmergedDepthThresholdField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.WaterSubmergedDepthThreshold"); }
-	float& ProneWaterSubmergedDepthThresholdField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.ProneWaterSubmergedDepthThreshold"); }
-	TEnumAsByte<enum EMovementMode>& SubmergedWaterMovementModeField() { return *GetNativePointerField<TEnumAsByte<enum EMovementMode>*>(this, "APrimalCharacter.SubmergedWaterMovementMode"); }
-	TEnumAsByte<enum EMovementMode>& UnSubmergedWaterMovementModeField() { return *GetNativePointerField<TEnumAsByte<enum EMovementMode>*>(this, "APrimalCharacter.UnSubmergedWaterMovementMode"); }
-	float& SnapshotScaleField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.SnapshotScale"); }
-	TSubclassOf<UPrimalItem>& PoopItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "APrimalCharacter.PoopItemClass"); }
-	TSubclassOf<UPrimalItem>& TaxidermySkinClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "APrimalCharacter.TaxidermySkinClass"); }
-	FName& DragBoneNameField() { return *GetNativePointerField<FName*>(this, "APrimalCharacter.DragBoneName"); }
-	FName& DragSocketNameField() { return *GetNativePointerField<FName*>(this, "APrimalCharacter.DragSocketName"); }
-	float& MaxDragDistanceField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.MaxDragDistance"); }
-	float& MaxDragDistanceTimeoutField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.MaxDragDistanceTimeout"); }
-	TArray<FName>& BonesToIngoreWhileDraggedField() { return *GetNativePointerField<TArray<FName>*>(this, "APrimalCharacter.BonesToIngoreWhileDragged"); }
-	float& PreviewCameraMaxZoomMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.PreviewCameraMaxZoomMultiplier"); }
-	float& PreviewCameraDefaultZoomMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.PreviewCameraDefaultZoomMultiplier"); }
-	float& PreviewCameraDistanceScaleFactorField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.PreviewCameraDistanceScaleFactor"); }
-	USoundBase * StartDraggedSoundField() { return *GetNativePointerField<USoundBase **>(this, "APrimalCharacter.StartDraggedSound"); }
-	USoundBase * EndDraggedSoundField() { return *GetNativePointerField<USoundBase **>(this, "APrimalCharacter.EndDraggedSound"); }
-	APrimalCharacter * DraggedCharacterField() { return *GetNativePointerField<APrimalCharacter **>(this, "APrimalCharacter.DraggedCharacter"); }
-	APrimalCharacter * DraggingCharacterField() { return *GetNativePointerField<APrimalCharacter **>(this, "APrimalCharacter.DraggingCharacter"); }
-	FTransform& LocalDraggedCharacterTransformField() { return *GetNativePointerField<FTransform*>(this, "APrimalCharacter.LocalDraggedCharacterTransform"); }
-	long double& StartDraggingTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.StartDraggingTime"); }
-	long double& LastDragUpdateTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastDragUpdateTime"); }
-	float& StasisConsumerRangeMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.StasisConsumerRangeMultiplier"); }
-	AActor * ImmobilizationActorField() { return *GetNativePointerField<AActor **>(this, "APrimalCharacter.ImmobilizationActor"); }
-	int& CurrentFrameAnimPreventInputField() { return *GetNativePointerField<int*>(this, "APrimalCharacter.CurrentFrameAnimPreventInput"); }
-	float& BPTimerServerMinField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.BPTimerServerMin"); }
-	float& BPTimerServerMaxField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.BPTimerServerMax"); }
-	float& BPTimerNonDedicatedMinField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.BPTimerNonDedicatedMin"); }
-	float& BPTimerNonDedicatedMaxField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.BPTimerNonDedicatedMax"); }
-	long double& NextBPTimerServerField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.NextBPTimerServer"); }
-	long double& NextBPTimerNonDedicatedField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.NextBPTimerNonDedicated"); }
-	long double& LastCausedDamageTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastCausedDamageTime"); }
-	TArray<TSubclassOf<APrimalStructure>>& ImmobilizationTrapsToIgnoreField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*>(this, "APrimalCharacter.ImmobilizationTrapsToIgnore"); }
-	TWeakObjectPtr<APrimalDinoCharacter>& CarryingDinoField() { return *GetNativePointerField<TWeakObjectPtr<APrimalDinoCharacter>*>(this, "APrimalCharacter.CarryingDino"); }
-	FName& DediOverrideCapsuleCollisionProfileNameField() { return *GetNativePointerField<FName*>(this, "APrimalCharacter.DediOverrideCapsuleCollisionProfileName"); }
-	FName& DediOverrideMeshCollisionProfileNameField() { return *GetNativePointerField<FName*>(this, "APrimalCharacter.DediOverrideMeshCollisionProfileName"); }
-	FName& SnaredFromSocketField() { return *GetNativePointerField<FName*>(this, "APrimalCharacter.SnaredFromSocket"); }
-	TSubclassOf<APrimalStructureItemContainer>& DeathDestructionDepositInventoryClassField() { return *GetNativePointerField<TSubclassOf<APrimalStructureItemContainer>*>(this, "APrimalCharacter.DeathDestructionDepositInventoryClass"); }
-	float& DamageNotifyTeamAggroMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.DamageNotifyTeamAggroMultiplier"); }
-	float& DamageNotifyTeamAggroRangeField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.DamageNotifyTeamAggroRange"); }
-	float& DamageNotifyTeamAggroRangeFalloffField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.DamageNotifyTeamAggroRangeFalloff"); }
-	float& ReplicatedCurrentHealthField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.ReplicatedCurrentHealth"); }
-	float& ReplicatedMaxHealthField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.ReplicatedMaxHealth"); }
-	float& ReplicatedCurrentTorporField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.ReplicatedCurrentTorpor"); }
-	float& ReplicatedMaxTorporField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.ReplicatedMaxTorpor"); }
-	AShooterCharacter * LastGrapHookPullingOwnerField() { return *GetNativePointerField<AShooterCharacter **>(this, "APrimalCharacter.LastGrapHookPullingOwner"); }
-	FVector& DragOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalCharacter.DragOffset"); }
-	long double& LastIkUpdateTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastIkUpdateTime"); }
-	long double& LastUpdatedAimOffsetsTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastUpdatedAimOffsetsTime"); }
-	FVector& MeshPreRagdollRelativeLocationField() { return *GetNativePointerField<FVector*>(this, "APrimalCharacter.MeshPreRagdollRelativeLocation"); }
-	FRotator& MeshPreRagdollRelativeRotationField() { return *GetNativePointerField<FRotator*>(this, "APrimalCharacter.MeshPreRagdollRelativeRotation"); }
-	int& DraggingBodyIndexField() { return *GetNativePointerField<int*>(this, "APrimalCharacter.DraggingBodyIndex"); }
-	int& DraggedBoneIndexField() { return *GetNativePointerField<int*>(this, "APrimalCharacter.DraggedBoneIndex"); }
-	int& customBitFlagsField() { return *GetNativePointerField<int*>(this, "APrimalCharacter.customBitFlags"); }
-	float& RunningSpeedModifierField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.RunningSpeedModifier"); }
-	float& LowHealthPercentageField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.LowHealthPercentage"); }
-	float& BaseTurnRateField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.BaseTurnRate"); }
-	float& BaseLookUpRateField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.BaseLookUpRate"); }
-	UAnimMontage * DeathAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalCharacter.DeathAnim"); }
-	USoundCue * DeathSoundField() { return *GetNativePointerField<USoundCue **>(this, "APrimalCharacter.DeathSound"); }
-	USoundCue * RunLoopSoundField() { return *GetNativePointerField<USoundCue **>(this, "APrimalCharacter.RunLoopSound"); }
-	USoundCue * RunStopSoundField() { return *GetNativePointerField<USoundCue **>(this, "APrimalCharacter.RunStopSound"); }
-	TArray<USoundCue *> FootStepSoundsPhysMatField() { return *GetNativePointerField<TArray<USoundCue *>*>(this, "APrimalCharacter.FootStepSoundsPhysMat"); }
-	TArray<USoundCue *> LandedSoundsPhysMatField() { return *GetNativePointerField<TArray<USoundCue *>*>(this, "APrimalCharacter.LandedSoundsPhysMat"); }
-	FName& MeshRootSocketNameField() { return *GetNativePointerField<FName*>(this, "APrimalCharacter.MeshRootSocketName"); }
-	TWeakObjectPtr<UAudioComponent>& LastVoiceAudioComponentField() { return *GetNativePointerField<TWeakObjectPtr<UAudioComponent>*>(this, "APrimalCharacter.LastVoiceAudioComponent"); }
-	float& MaxFallSpeedField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.MaxFallSpeed"); }
-	float& FallDamageMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.FallDamageMultiplier"); }
-	UAudioComponent * RunLoopACField() { return *GetNativePointerField<UAudioComponent **>(this, "APrimalCharacter.RunLoopAC"); }
-	float& CurrentCarriedYawField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.CurrentCarriedYaw"); }
-	APrimalStructureExplosiveTransGPS * CurrentTransponderField() { return *GetNativePointerField<APrimalStructureExplosiveTransGPS **>(this, "APrimalCharacter.CurrentTransponder"); }
-	float& TargetCarriedYawField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.TargetCarriedYaw"); }
-	float& ServerTargetCarriedYawField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.ServerTargetCarriedYaw"); }
-	USoundBase * NetDynamicMusicSoundField() { return *GetNativePointerField<USoundBase **>(this, "APrimalCharacter.NetDynamicMusicSound"); }
-	TWeakObjectPtr<APrimalDinoCharacter>& MountedDinoField() { return *GetNativePointerField<TWeakObjectPtr<APrimalDinoCharacter>*>(this, "APrimalCharacter.MountedDino"); }
-	float& MountedDinoTimeField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.MountedDinoTime"); }
-	TWeakObjectPtr<APrimalDinoCharacter>& PreviousMountedDinoField() { return *GetNativePointerField<TWeakObjectPtr<APrimalDinoCharacter>*>(this, "APrimalCharacter.PreviousMountedDino"); }
-	FVector& LastForceFallCheckBaseLocationField() { return *GetNativePointerField<FVector*>(this, "APrimalCharacter.LastForceFallCheckBaseLocation"); }
-	FVector& LastHitWallSweepCheckLocationField() { return *GetNativePointerField<FVector*>(this, "APrimalCharacter.LastHitWallSweepCheckLocation"); }
-	long double& LastTimeBasedMovementHadCurrentActorField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastTimeBasedMovementHadCurrentActor"); }
-	TWeakObjectPtr<AActor>& LastBasedMovementActorRefField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*>(this, "APrimalCharacter.LastBasedMovementActorRef"); }
-	float& GrabWeightThresholdField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.GrabWeightThreshold"); }
-	float& DragWeightField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.DragWeight"); }
-	FString& DescriptiveNameField() { return *GetNativePointerField<FString*>(this, "APrimalCharacter.DescriptiveName"); }
-	TArray<FVector_NetQuantize>& ReplicatedRagdollPositionsField() { return *GetNativePointerField<TArray<FVector_NetQuantize>*>(this, "APrimalCharacter.ReplicatedRagdollPositions"); }
-	TArray<FRotator_NetQuantize>& ReplicatedRagdollRotationsField() { return *GetNativePointerField<TArray<FRotator_NetQuantize>*>(this, "APrimalCharacter.ReplicatedRagdollRotations"); }
-	TArray<FVector_NetQuantize>& LastReplicatedRagdollPositionsField() { return *GetNativePointerField<TArray<FVector_NetQuantize>*>(this, "APrimalCharacter.LastReplicatedRagdollPositions"); }
-	TArray<FRotator_NetQuantize>& LastReplicatedRagdollRotationsField() { return *GetNativePointerField<TArray<FRotator_NetQuantize>*>(this, "APrimalCharacter.LastReplicatedRagdollRotations"); }
-	FRotator& ReplicatedRootRotationField() { return *GetNativePointerField<FRotator*>(this, "APrimalCharacter.ReplicatedRootRotation"); }
-	TArray<int>& ReplicatedBonesIndiciesField() { return *GetNativePointerField<TArray<int>*>(this, "APrimalCharacter.ReplicatedBonesIndicies"); }
-	float& KillXPBaseField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.KillXPBase"); }
-	TArray<FName>& ReplicatedBonesField() { return *GetNativePointerField<TArray<FName>*>(this, "APrimalCharacter.ReplicatedBones"); }
-	float& RagdollReplicationIntervalField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.RagdollReplicationInterval"); }
-	float& ClientRotationInterpSpeedField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.ClientRotationInterpSpeed"); }
-	float& ClientLocationInterpSpeedField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.ClientLocationInterpSpeed"); }
-	float& MaxDragMovementSpeedField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.MaxDragMovementSpeed"); }
-	FRotator& CurrentAimRotField() { return *GetNativePointerField<FRotator*>(this, "APrimalCharacter.CurrentAimRot"); }
-	FVector& CurrentRootLocField() { return *GetNativePointerField<FVector*>(this, "APrimalCharacter.CurrentRootLoc"); }
-	int& LastYawSpeedWorldFrameCounterField() { return *GetNativePointerField<int*>(this, "APrimalCharacter.LastYawSpeedWorldFrameCounter"); }
-	FName& MeshPreRagdollCollisionProfileNameField() { return *GetNativePointerField<FName*>(this, "APrimalCharacter.MeshPreRagdollCollisionProfileName"); }
-	FName& CapsulePreRagdollCollisionProfileNameField() { return *GetNativePointerField<FName*>(this, "APrimalCharacter.CapsulePreRagdollCollisionProfileName"); }
-	UPrimalCharacterStatusComponent * MyCharacterStatusComponentField() { return *GetNativePointerField<UPrimalCharacterStatusComponent **>(this, "APrimalCharacter.MyCharacterStatusComponent"); }
-	float& LastTickStaminaValueField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.LastTickStaminaValue"); }
-	UPrimalInventoryComponent * MyInventoryComponentField() { return *GetNativePointerField<UPrimalInventoryComponent **>(this, "APrimalCharacter.MyInventoryComponent"); }
-	UAnimMontage * SyncedMontageField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalCharacter.SyncedMontage"); }
-	long double& LastMontageSyncTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastMontageSyncTime"); }
-	float& SyncedMontageDurationField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.SyncedMontageDuration"); }
-	float& MontageSyncIntervalField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.MontageSyncInterval"); }
-	long double& LastRunningTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastRunningTime"); }
-	FVector& TPVCameraOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalCharacter.TPVCameraOffset"); }
-	FVector& TPVCameraOffsetMultiplierField() { return *GetNativePointerField<FVector*>(this, "APrimalCharacter.TPVCameraOffsetMultiplier"); }
-	FVector& TPVCameraOrgOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalCharacter.TPVCameraOrgOffset"); }
-	float& LandedSoundMaxRangeField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.LandedSoundMaxRange"); }
-	float& FallingDamageHealthScaleBaseField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.FallingDamageHealthScaleBase"); }
-	float& FootstepsMaxRangeField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.FootstepsMaxRange"); }
-	float& MinTimeBetweenFootstepsField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.MinTimeBetweenFootsteps"); }
-	long double& LastPlayedFootstepTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastPlayedFootstepTime"); }
-	float& MinTimeBetweenFootstepsRunningField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.MinTimeBetweenFootstepsRunning"); }
-	TArray<UAnimMontage *> AnimationsPreventInputField() { return *GetNativePointerField<TArray<UAnimMontage *>*>(this, "APrimalCharacter.AnimationsPreventInput"); }
-	long double& LastNetDidLandField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastNetDidLand"); }
-	TWeakObjectPtr<AController>& LastDamageEventInstigatorField() { return *GetNativePointerField<TWeakObjectPtr<AController>*>(this, "APrimalCharacter.LastDamageEventInstigator"); }
-	int& CachedNumberOfClientRagdollCorrectionAttemptsField() { return *GetNativePointerField<int*>(this, "APrimalCharacter.CachedNumberOfClientRagdollCorrectionAttempts"); }
-	int& NumberOfClientRagdollCorrectionAttemptsField() { return *GetNativePointerField<int*>(this, "APrimalCharacter.NumberOfClientRagdollCorrectionAttempts"); }
-	float& ServerForceSleepRagdollIntervalField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.ServerForceSleepRagdollInterval"); }
-	float& ClientForceSleepRagdollIntervalField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.ClientForceSleepRagdollInterval"); }
-	float& NonRelevantServerForceSleepRagdollIntervalField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.NonRelevantServerForceSleepRagdollInterval"); }
-	TEnumAsByte<enum EShooterPhysMaterialType::Type>& TargetableDamageFXDefaultPhysMaterialField() { return *GetNativePointerField<TEnumAsByte<enum EShooterPhysMaterialType::Type>*>(this, "APrimalCharacter.TargetableDamageFXDefaultPhysMaterial"); }
-	UAnimMontage * PoopAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalCharacter.PoopAnimation"); }
-	long double& CorpseDestructionTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.CorpseDestructionTime"); }
-	float& CorpseLifespanField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.CorpseLifespan"); }
-	float& TPVStructurePlacingHeightMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.TPVStructurePlacingHeightMultiplier"); }
-	float& CorpseFadeAwayTimeField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.CorpseFadeAwayTime"); }
-	float& RagdollDeathImpulseScalerField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.RagdollDeathImpulseScaler"); }
-	USoundCue * PoopSoundField() { return *GetNativePointerField<USoundCue **>(this, "APrimalCharacter.PoopSound"); }
-	float& BaseTargetingDesirabilityField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.BaseTargetingDesirability"); }
-	float& DeadBaseTargetingDesirabilityField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.DeadBaseTargetingDesirability"); }
-	FRotator& OrbitCamRotField() { return *GetNativePointerField<FRotator*>(this, "APrimalCharacter.OrbitCamRot"); }
-	float& OrbitCamZoomField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.OrbitCamZoom"); }
-	float& OrbitCamZoomStepSizeField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.OrbitCamZoomStepSize"); }
-	float& OrbitCamMinZoomLevelField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.OrbitCamMinZoomLevel"); }
-	float& OrbitCamMaxZoomLevelField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.OrbitCamMaxZoomLevel"); }
-	FVector& LastSubmergedCheckLocField() { return *GetNativePointerField<FVector*>(this, "APrimalCharacter.LastSubmergedCheckLoc"); }
-	long double& LastTimeNotInFallingField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastTimeNotInFalling"); }
-	float& MaxCursorHUDDistanceField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.MaxCursorHUDDistance"); }
-	float& AddForwardVelocityOnJumpField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.AddForwardVelocityOnJump"); }
-	FVector& DeathActorTargetingOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalCharacter.DeathActorTargetingOffset"); }
-	FName& SocketOverrideTargetingLocationField() { return *GetNativePointerField<FName*>(this, "APrimalCharacter.SocketOverrideTargetingLocation"); }
-	FDamageEvent * CurrentDamageEventField() { return *GetNativePointerField<FDamageEvent **>(this, "APrimalCharacter.CurrentDamageEvent"); }
-	FVector& LastApproximatePhysVolumeLocationField() { return *GetNativePointerField<FVector*>(this, "APrimalCharacter.LastApproximatePhysVolumeLocation"); }
-	long double& LastTimeSubmergedField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastTimeSubmerged"); }
-	EPhysicalSurface& LastFootPhysicalSurfaceTypeField() { return *GetNativePointerField<EPhysicalSurface*>(this, "APrimalCharacter.LastFootPhysicalSurfaceType"); }
-	long double& LastFootPhysicalSurfaceCheckTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastFootPhysicalSurfaceCheckTime"); }
-	float& FootPhysicalSurfaceCheckIntervalField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.FootPhysicalSurfaceCheckInterval"); }
-	TWeakObjectPtr<APrimalCharacter>& LastHurtByNearbyPlayerField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*>(this, "APrimalCharacter.LastHurtByNearbyPlayer"); }
-	float& LastHurtByNearbyPlayerTimeField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.LastHurtByNearbyPlayerTime"); }
-	TWeakObjectPtr<APrimalCharacter>& LastAttackedNearbyPlayerField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*>(this, "APrimalCharacter.LastAttackedNearbyPlayer"); }
-	float& LastAttackedNearbyPlayerTimeField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.LastAttackedNearbyPlayerTime"); }
-	long double& LastStartFallingRagdollTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastStartFallingRagdollTime"); }
-	FVector& RagdollLastFrameLinearVelocityField() { return *GetNativePointerField<FVector*>(this, "APrimalCharacter.RagdollLastFrameLinearVelocity"); }
-	float& RagdollImpactDamageVelocityScaleField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.RagdollImpactDamageVelocityScale"); }
-	float& RagdollImpactDamageMinDecelerationSpeedField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.RagdollImpactDamageMinDecelerationSpeed"); }
-	float& StartFallingImpactRagdollTimeIntervalField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.StartFallingImpactRagdollTimeInterval"); }
-	long double& LastUnstasisTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastUnstasisTime"); }
-	FVector& PreviousRagdollLocationField() { return *GetNativePointerField<FVector*>(this, "APrimalCharacter.PreviousRagdollLocation"); }
-	int& RagdollPenetrationFailuresField() { return *GetNativePointerField<int*>(this, "APrimalCharacter.RagdollPenetrationFailures"); }
-	long double& NextBlinkTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.NextBlinkTime"); }
-	long double& BlinkTimerField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.BlinkTimer"); }
-	long double& LastInSwimmingSoundTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastInSwimmingSoundTime"); }
-	USoundCue * EnteredSwimmingSoundField() { return *GetNativePointerField<USoundCue **>(this, "APrimalCharacter.EnteredSwimmingSound"); }
-	USoundCue * EnteredSleepingSoundField() { return *GetNativePointerField<USoundCue **>(this, "APrimalCharacter.EnteredSleepingSound"); }
-	USoundCue * LeftSleepingSoundField() { return *GetNativePointerField<USoundCue **>(this, "APrimalCharacter.LeftSleepingSound"); }
-	long double& LastRelevantToPlayerTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastRelevantToPlayerTime"); }
-	long double& MeshStopForceUpdatingAtTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.MeshStopForceUpdatingAtTime"); }
-	long double& LastWalkingTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastWalkingTime"); }
-	long double& LastSpecialDamageTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastSpecialDamageTime"); }
-	float& CorpseDraggedDecayRateField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.CorpseDraggedDecayRate"); }
-	float& PoopAltItemChanceField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.PoopAltItemChance"); }
-	TSubclassOf<UPrimalItem>& PoopAltItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "APrimalCharacter.PoopAltItemClass"); }
-	TArray<TSubclassOf<APrimalBuff>>& DefaultBuffsField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalBuff>>*>(this, "APrimalCharacter.DefaultBuffs"); }
-	UTexture2D * PoopIconField() { return *GetNativePointerField<UTexture2D **>(this, "APrimalCharacter.PoopIcon"); }
-	float& RunningMaxDesiredRotDeltaField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.RunningMaxDesiredRotDelta"); }
-	long double& CorpseDestructionTimerField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.CorpseDestructionTimer"); }
-	long double& LastSkinnedTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastSkinnedTime"); }
-	float& OriginalCorpseLifespanField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.OriginalCorpseLifespan"); }
-	float& CorpseHarvestFadeTimeField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.CorpseHarvestFadeTime"); }
-	FVector& CurrentLocalRootLocField() { return *GetNativePointerField<FVector*>(this, "APrimalCharacter.CurrentLocalRootLoc"); }
-	float& RootYawField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.RootYaw"); }
-	long double& LastTimeInSwimmingField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastTimeInSwimming"); }
-	long double& LastListenRangePushTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastListenRangePushTime"); }
-	float& LastDamageAmountMaterialValueField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.LastDamageAmountMaterialValue"); }
-	float& BuffedDamageMultField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.BuffedDamageMult"); }
-	float& BuffedResistanceMultField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.BuffedResistanceMult"); }
-	float& ExtraMaxSpeedModifierField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.ExtraMaxSpeedModifier"); }
-	float& TamedDinoCallOutRangeField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.TamedDinoCallOutRange"); }
-	long double& LastBumpedDamageTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastBumpedDamageTime"); }
-	FVector& TargetPathfindingLocationOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalCharacter.TargetPathfindingLocationOffset"); }
-	long double& LastTookDamageTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastTookDamageTime"); }
-	float& ExtraReceiveDamageMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.ExtraReceiveDamageMultiplier"); }
-	float& ExtraMeleeDamageMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.ExtraMeleeDamageMultiplier"); }
-	float& LastFallingZField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.LastFallingZ"); }
-	int& NumFallZFailsField() { return *GetNativePointerField<int*>(this, "APrimalCharacter.NumFallZFails"); }
-	TArray<TWeakObjectPtr<APrimalCharacter>>& CharactersGrappledToMeField() { return *GetNativePointerField<TArray<TWeakObjectPtr<APrimalCharacter>>*>(this, "APrimalCharacter.CharactersGrappledToMe"); }
-	float& DamageTheMeleeDamageCauserPercentField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.DamageTheMeleeDamageCauserPercent"); }
-	float& DurabilityDegrateTheMeleeDamageCauserPercentField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.DurabilityDegrateTheMeleeDamageCauserPercent"); }
-	TSubclassOf<UDamageType>& DamageTheMeleeDamageCauserDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*>(this, "APrimalCharacter.DamageTheMeleeDamageCauserDamageType"); }
-	char& TribeGroupInventoryRankField() { return *GetNativePointerField<char*>(this, "APrimalCharacter.TribeGroupInventoryRank"); }
-	float& CharacterDamageImpulseMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.CharacterDamageImpulseMultiplier"); }
-	long double& ForceCheckPushThroughWallsTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.ForceCheckPushThroughWallsTime"); }
-	long double& LastStoppedEatAnimationTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastStoppedEatAnimationTime"); }
-	float& ClientRotationInterpSpeedMultiplierGroundField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.ClientRotationInterpSpeedMultiplierGround"); }
-	float& GlideGravityScaleMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.GlideGravityScaleMultiplier"); }
-	float& GlideMaxCarriedWeightField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.GlideMaxCarriedWeight"); }
-	UAnimMontage * lastPlayedMountAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalCharacter.lastPlayedMountAnim"); }
-	float& ScaleDeathHarvestHealthyByMaxHealthBaseField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.ScaleDeathHarvestHealthyByMaxHealthBase"); }
-	long double& LastForceMeshRefreshBonesTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastForceMeshRefreshBonesTime"); }
-	long double& LastStartedBeingCarriedTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastStartedBeingCarriedTime"); }
-	float& RunMinVelocityRotDotField() { return *GetNativePointerField<float*>(this, "APrimalCharacter.RunMinVelocityRotDot"); }
-	long double& LastHitDamageTimeField() { return *GetNativePointerField<long double*>(this, "APrimalCharacter.LastHitDamageTime"); }
-	TArray<TSubclassOf<APrimalBuff>>& PreventBuffClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalBuff>>*>(this, "APrimalCharacter.PreventBuffClasses"); }
+	FVector& OldLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalCharacter.OldLocation")>(this, "APrimalCharacter.OldLocation"); }
+	FRotator& OldRotationField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalCharacter.OldRotation")>(this, "APrimalCharacter.OldRotation"); }
+	float& EffectorInterpSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.EffectorInterpSpeed")>(this, "APrimalCharacter.EffectorInterpSpeed"); }
+	float& HalfLegLengthField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.HalfLegLength")>(this, "APrimalCharacter.HalfLegLength"); }
+	float& TwoLeggedVirtualPointDistFactorField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.TwoLeggedVirtualPointDistFactor")>(this, "APrimalCharacter.TwoLeggedVirtualPointDistFactor"); }
+	float& FullIKDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.FullIKDistance")>(this, "APrimalCharacter.FullIKDistance"); }
+	float& IKAfterFallingTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.IKAfterFallingTime")>(this, "APrimalCharacter.IKAfterFallingTime"); }
+	float& SimpleIkRateField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.SimpleIkRate")>(this, "APrimalCharacter.SimpleIkRate"); }
+	FVector& GroundCheckExtentField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalCharacter.GroundCheckExtent")>(this, "APrimalCharacter.GroundCheckExtent"); }
+	long double& LastForceAimedCharactersTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastForceAimedCharactersTime")>(this, "APrimalCharacter.LastForceAimedCharactersTime"); }
+	UAnimMontage * JumpAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalCharacter.JumpAnim")>(this, "APrimalCharacter.JumpAnim"); }
+	UAnimMontage * LandedAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalCharacter.LandedAnim")>(this, "APrimalCharacter.LandedAnim"); }
+	UAnimMontage * HurtAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalCharacter.HurtAnim")>(this, "APrimalCharacter.HurtAnim"); }
+	UAnimMontage * HurtAnim_FlyingField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalCharacter.HurtAnim_Flying")>(this, "APrimalCharacter.HurtAnim_Flying"); }
+	UAnimMontage * PinnedAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalCharacter.PinnedAnim")>(this, "APrimalCharacter.PinnedAnim"); }
+	USoundCue * HurtSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("APrimalCharacter.HurtSound")>(this, "APrimalCharacter.HurtSound"); }
+	FName& RootBodyBoneNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalCharacter.RootBodyBoneName")>(this, "APrimalCharacter.RootBodyBoneName"); }
+	TArray<APrimalBuff *> BuffsField() { return *GetNativePointerField<TArray<APrimalBuff *>*, API::FieldNameHash("APrimalCharacter.Buffs")>(this, "APrimalCharacter.Buffs"); }
+	FString& TribeNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalCharacter.TribeName")>(this, "APrimalCharacter.TribeName"); }
+	float& WaterSubmergedDepthThresholdField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.WaterSubmergedDepthThreshold")>(this, "APrimalCharacter.WaterSubmergedDepthThreshold"); }
+	float& ProneWaterSubmergedDepthThresholdField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.ProneWaterSubmergedDepthThreshold")>(this, "APrimalCharacter.ProneWaterSubmergedDepthThreshold"); }
+	TEnumAsByte<enum EMovementMode>& SubmergedWaterMovementModeField() { return *GetNativePointerField<TEnumAsByte<enum EMovementMode>*, API::FieldNameHash("APrimalCharacter.SubmergedWaterMovementMode")>(this, "APrimalCharacter.SubmergedWaterMovementMode"); }
+	TEnumAsByte<enum EMovementMode>& UnSubmergedWaterMovementModeField() { return *GetNativePointerField<TEnumAsByte<enum EMovementMode>*, API::FieldNameHash("APrimalCharacter.UnSubmergedWaterMovementMode")>(this, "APrimalCharacter.UnSubmergedWaterMovementMode"); }
+	float& SnapshotScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.SnapshotScale")>(this, "APrimalCharacter.SnapshotScale"); }
+	TSubclassOf<UPrimalItem>& PoopItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("APrimalCharacter.PoopItemClass")>(this, "APrimalCharacter.PoopItemClass"); }
+	TSubclassOf<UPrimalItem>& TaxidermySkinClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("APrimalCharacter.TaxidermySkinClass")>(this, "APrimalCharacter.TaxidermySkinClass"); }
+	FName& DragBoneNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalCharacter.DragBoneName")>(this, "APrimalCharacter.DragBoneName"); }
+	FName& DragSocketNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalCharacter.DragSocketName")>(this, "APrimalCharacter.DragSocketName"); }
+	float& MaxDragDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.MaxDragDistance")>(this, "APrimalCharacter.MaxDragDistance"); }
+	float& MaxDragDistanceTimeoutField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.MaxDragDistanceTimeout")>(this, "APrimalCharacter.MaxDragDistanceTimeout"); }
+	TArray<FName>& BonesToIngoreWhileDraggedField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("APrimalCharacter.BonesToIngoreWhileDragged")>(this, "APrimalCharacter.BonesToIngoreWhileDragged"); }
+	float& PreviewCameraMaxZoomMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.PreviewCameraMaxZoomMultiplier")>(this, "APrimalCharacter.PreviewCameraMaxZoomMultiplier"); }
+	float& PreviewCameraDefaultZoomMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.PreviewCameraDefaultZoomMultiplier")>(this, "APrimalCharacter.PreviewCameraDefaultZoomMultiplier"); }
+	float& PreviewCameraDistanceScaleFactorField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.PreviewCameraDistanceScaleFactor")>(this, "APrimalCharacter.PreviewCameraDistanceScaleFactor"); }
+	USoundBase * StartDraggedSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("APrimalCharacter.StartDraggedSound")>(this, "APrimalCharacter.StartDraggedSound"); }
+	USoundBase * EndDraggedSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("APrimalCharacter.EndDraggedSound")>(this, "APrimalCharacter.EndDraggedSound"); }
+	APrimalCharacter * DraggedCharacterField() { return *GetNativePointerField<APrimalCharacter **, API::FieldNameHash("APrimalCharacter.DraggedCharacter")>(this, "APrimalCharacter.DraggedCharacter"); }
+	APrimalCharacter * DraggingCharacterField() { return *GetNativePointerField<APrimalCharacter **, API::FieldNameHash("APrimalCharacter.DraggingCharacter")>(this, "APrimalCharacter.DraggingCharacter"); }
+	FTransform& LocalDraggedCharacterTransformField() { return *GetNativePointerField<FTransform*, API::FieldNameHash("APrimalCharacter.LocalDraggedCharacterTransform")>(this, "APrimalCharacter.LocalDraggedCharacterTransform"); }
+	long double& StartDraggingTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.StartDraggingTime")>(this, "APrimalCharacter.StartDraggingTime"); }
+	long double& LastDragUpdateTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastDragUpdateTime")>(this, "APrimalCharacter.LastDragUpdateTime"); }
+	float& StasisConsumerRangeMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.StasisConsumerRangeMultiplier")>(this, "APrimalCharacter.StasisConsumerRangeMultiplier"); }
+	AActor * ImmobilizationActorField() { return *GetNativePointerField<AActor **, API::FieldNameHash("APrimalCharacter.ImmobilizationActor")>(this, "APrimalCharacter.ImmobilizationActor"); }
+	int& CurrentFrameAnimPreventInputField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalCharacter.CurrentFrameAnimPreventInput")>(this, "APrimalCharacter.CurrentFrameAnimPreventInput"); }
+	float& BPTimerServerMinField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.BPTimerServerMin")>(this, "APrimalCharacter.BPTimerServerMin"); }
+	float& BPTimerServerMaxField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.BPTimerServerMax")>(this, "APrimalCharacter.BPTimerServerMax"); }
+	float& BPTimerNonDedicatedMinField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.BPTimerNonDedicatedMin")>(this, "APrimalCharacter.BPTimerNonDedicatedMin"); }
+	float& BPTimerNonDedicatedMaxField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.BPTimerNonDedicatedMax")>(this, "APrimalCharacter.BPTimerNonDedicatedMax"); }
+	long double& NextBPTimerServerField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.NextBPTimerServer")>(this, "APrimalCharacter.NextBPTimerServer"); }
+	long double& NextBPTimerNonDedicatedField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.NextBPTimerNonDedicated")>(this, "APrimalCharacter.NextBPTimerNonDedicated"); }
+	long double& LastCausedDamageTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastCausedDamageTime")>(this, "APrimalCharacter.LastCausedDamageTime"); }
+	TArray<TSubclassOf<APrimalStructure>>& ImmobilizationTrapsToIgnoreField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*, API::FieldNameHash("APrimalCharacter.ImmobilizationTrapsToIgnore")>(this, "APrimalCharacter.ImmobilizationTrapsToIgnore"); }
+	TWeakObjectPtr<APrimalDinoCharacter>& CarryingDinoField() { return *GetNativePointerField<TWeakObjectPtr<APrimalDinoCharacter>*, API::FieldNameHash("APrimalCharacter.CarryingDino")>(this, "APrimalCharacter.CarryingDino"); }
+	FName& DediOverrideCapsuleCollisionProfileNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalCharacter.DediOverrideCapsuleCollisionProfileName")>(this, "APrimalCharacter.DediOverrideCapsuleCollisionProfileName"); }
+	FName& DediOverrideMeshCollisionProfileNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalCharacter.DediOverrideMeshCollisionProfileName")>(this, "APrimalCharacter.DediOverrideMeshCollisionProfileName"); }
+	FName& SnaredFromSocketField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalCharacter.SnaredFromSocket")>(this, "APrimalCharacter.SnaredFromSocket"); }
+	TSubclassOf<APrimalStructureItemContainer>& DeathDestructionDepositInventoryClassField() { return *GetNativePointerField<TSubclassOf<APrimalStructureItemContainer>*, API::FieldNameHash("APrimalCharacter.DeathDestructionDepositInventoryClass")>(this, "APrimalCharacter.DeathDestructionDepositInventoryClass"); }
+	float& DamageNotifyTeamAggroMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.DamageNotifyTeamAggroMultiplier")>(this, "APrimalCharacter.DamageNotifyTeamAggroMultiplier"); }
+	float& DamageNotifyTeamAggroRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.DamageNotifyTeamAggroRange")>(this, "APrimalCharacter.DamageNotifyTeamAggroRange"); }
+	float& DamageNotifyTeamAggroRangeFalloffField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.DamageNotifyTeamAggroRangeFalloff")>(this, "APrimalCharacter.DamageNotifyTeamAggroRangeFalloff"); }
+	float& ReplicatedCurrentHealthField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.ReplicatedCurrentHealth")>(this, "APrimalCharacter.ReplicatedCurrentHealth"); }
+	float& ReplicatedMaxHealthField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.ReplicatedMaxHealth")>(this, "APrimalCharacter.ReplicatedMaxHealth"); }
+	float& ReplicatedCurrentTorporField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.ReplicatedCurrentTorpor")>(this, "APrimalCharacter.ReplicatedCurrentTorpor"); }
+	float& ReplicatedMaxTorporField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.ReplicatedMaxTorpor")>(this, "APrimalCharacter.ReplicatedMaxTorpor"); }
+	AShooterCharacter * LastGrapHookPullingOwnerField() { return *GetNativePointerField<AShooterCharacter **, API::FieldNameHash("APrimalCharacter.LastGrapHookPullingOwner")>(this, "APrimalCharacter.LastGrapHookPullingOwner"); }
+	FVector& DragOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalCharacter.DragOffset")>(this, "APrimalCharacter.DragOffset"); }
+	long double& LastIkUpdateTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastIkUpdateTime")>(this, "APrimalCharacter.LastIkUpdateTime"); }
+	long double& LastUpdatedAimOffsetsTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastUpdatedAimOffsetsTime")>(this, "APrimalCharacter.LastUpdatedAimOffsetsTime"); }
+	FVector& MeshPreRagdollRelativeLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalCharacter.MeshPreRagdollRelativeLocation")>(this, "APrimalCharacter.MeshPreRagdollRelativeLocation"); }
+	FRotator& MeshPreRagdollRelativeRotationField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalCharacter.MeshPreRagdollRelativeRotation")>(this, "APrimalCharacter.MeshPreRagdollRelativeRotation"); }
+	int& DraggingBodyIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalCharacter.DraggingBodyIndex")>(this, "APrimalCharacter.DraggingBodyIndex"); }
+	int& DraggedBoneIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalCharacter.DraggedBoneIndex")>(this, "APrimalCharacter.DraggedBoneIndex"); }
+	int& customBitFlagsField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalCharacter.customBitFlags")>(this, "APrimalCharacter.customBitFlags"); }
+	float& RunningSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.RunningSpeedModifier")>(this, "APrimalCharacter.RunningSpeedModifier"); }
+	float& LowHealthPercentageField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.LowHealthPercentage")>(this, "APrimalCharacter.LowHealthPercentage"); }
+	float& BaseTurnRateField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.BaseTurnRate")>(this, "APrimalCharacter.BaseTurnRate"); }
+	float& BaseLookUpRateField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.BaseLookUpRate")>(this, "APrimalCharacter.BaseLookUpRate"); }
+	UAnimMontage * DeathAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalCharacter.DeathAnim")>(this, "APrimalCharacter.DeathAnim"); }
+	USoundCue * DeathSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("APrimalCharacter.DeathSound")>(this, "APrimalCharacter.DeathSound"); }
+	USoundCue * RunLoopSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("APrimalCharacter.RunLoopSound")>(this, "APrimalCharacter.RunLoopSound"); }
+	USoundCue * RunStopSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("APrimalCharacter.RunStopSound")>(this, "APrimalCharacter.RunStopSound"); }
+	TArray<USoundCue *> FootStepSoundsPhysMatField() { return *GetNativePointerField<TArray<USoundCue *>*, API::FieldNameHash("APrimalCharacter.FootStepSoundsPhysMat")>(this, "APrimalCharacter.FootStepSoundsPhysMat"); }
+	TArray<USoundCue *> LandedSoundsPhysMatField() { return *GetNativePointerField<TArray<USoundCue *>*, API::FieldNameHash("APrimalCharacter.LandedSoundsPhysMat")>(this, "APrimalCharacter.LandedSoundsPhysMat"); }
+	FName& MeshRootSocketNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalCharacter.MeshRootSocketName")>(this, "APrimalCharacter.MeshRootSocketName"); }
+	TWeakObjectPtr<UAudioComponent>& LastVoiceAudioComponentField() { return *GetNativePointerField<TWeakObjectPtr<UAudioComponent>*, API::FieldNameHash("APrimalCharacter.LastVoiceAudioComponent")>(this, "APrimalCharacter.LastVoiceAudioComponent"); }
+	float& MaxFallSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.MaxFallSpeed")>(this, "APrimalCharacter.MaxFallSpeed"); }
+	float& FallDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.FallDamageMultiplier")>(this, "APrimalCharacter.FallDamageMultiplier"); }
+	UAudioComponent * RunLoopACField() { return *GetNativePointerField<UAudioComponent **, API::FieldNameHash("APrimalCharacter.RunLoopAC")>(this, "APrimalCharacter.RunLoopAC"); }
+	float& CurrentCarriedYawField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.CurrentCarriedYaw")>(this, "APrimalCharacter.CurrentCarriedYaw"); }
+	APrimalStructureExplosiveTransGPS * CurrentTransponderField() { return *GetNativePointerField<APrimalStructureExplosiveTransGPS **, API::FieldNameHash("APrimalCharacter.CurrentTransponder")>(this, "APrimalCharacter.CurrentTransponder"); }
+	float& TargetCarriedYawField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.TargetCarriedYaw")>(this, "APrimalCharacter.TargetCarriedYaw"); }
+	float& ServerTargetCarriedYawField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.ServerTargetCarriedYaw")>(this, "APrimalCharacter.ServerTargetCarriedYaw"); }
+	USoundBase * NetDynamicMusicSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("APrimalCharacter.NetDynamicMusicSound")>(this, "APrimalCharacter.NetDynamicMusicSound"); }
+	TWeakObjectPtr<APrimalDinoCharacter>& MountedDinoField() { return *GetNativePointerField<TWeakObjectPtr<APrimalDinoCharacter>*, API::FieldNameHash("APrimalCharacter.MountedDino")>(this, "APrimalCharacter.MountedDino"); }
+	float& MountedDinoTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.MountedDinoTime")>(this, "APrimalCharacter.MountedDinoTime"); }
+	TWeakObjectPtr<APrimalDinoCharacter>& PreviousMountedDinoField() { return *GetNativePointerField<TWeakObjectPtr<APrimalDinoCharacter>*, API::FieldNameHash("APrimalCharacter.PreviousMountedDino")>(this, "APrimalCharacter.PreviousMountedDino"); }
+	FVector& LastForceFallCheckBaseLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalCharacter.LastForceFallCheckBaseLocation")>(this, "APrimalCharacter.LastForceFallCheckBaseLocation"); }
+	FVector& LastHitWallSweepCheckLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalCharacter.LastHitWallSweepCheckLocation")>(this, "APrimalCharacter.LastHitWallSweepCheckLocation"); }
+	long double& LastTimeBasedMovementHadCurrentActorField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastTimeBasedMovementHadCurrentActor")>(this, "APrimalCharacter.LastTimeBasedMovementHadCurrentActor"); }
+	TWeakObjectPtr<AActor>& LastBasedMovementActorRefField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*, API::FieldNameHash("APrimalCharacter.LastBasedMovementActorRef")>(this, "APrimalCharacter.LastBasedMovementActorRef"); }
+	float& GrabWeightThresholdField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.GrabWeightThreshold")>(this, "APrimalCharacter.GrabWeightThreshold"); }
+	float& DragWeightField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.DragWeight")>(this, "APrimalCharacter.DragWeight"); }
+	FString& DescriptiveNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalCharacter.DescriptiveName")>(this, "APrimalCharacter.DescriptiveName"); }
+	TArray<FVector_NetQuantize>& ReplicatedRagdollPositionsField() { return *GetNativePointerField<TArray<FVector_NetQuantize>*, API::FieldNameHash("APrimalCharacter.ReplicatedRagdollPositions")>(this, "APrimalCharacter.ReplicatedRagdollPositions"); }
+	TArray<FRotator_NetQuantize>& ReplicatedRagdollRotationsField() { return *GetNativePointerField<TArray<FRotator_NetQuantize>*, API::FieldNameHash("APrimalCharacter.ReplicatedRagdollRotations")>(this, "APrimalCharacter.ReplicatedRagdollRotations"); }
+	TArray<FVector_NetQuantize>& LastReplicatedRagdollPositionsField() { return *GetNativePointerField<TArray<FVector_NetQuantize>*, API::FieldNameHash("APrimalCharacter.LastReplicatedRagdollPositions")>(this, "APrimalCharacter.LastReplicatedRagdollPositions"); }
+	TArray<FRotator_NetQuantize>& LastReplicatedRagdollRotationsField() { return *GetNativePointerField<TArray<FRotator_NetQuantize>*, API::FieldNameHash("APrimalCharacter.LastReplicatedRagdollRotations")>(this, "APrimalCharacter.LastReplicatedRagdollRotations"); }
+	FRotator& ReplicatedRootRotationField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalCharacter.ReplicatedRootRotation")>(this, "APrimalCharacter.ReplicatedRootRotation"); }
+	TArray<int>& ReplicatedBonesIndiciesField() { return *GetNativePointerField<TArray<int>*, API::FieldNameHash("APrimalCharacter.ReplicatedBonesIndicies")>(this, "APrimalCharacter.ReplicatedBonesIndicies"); }
+	float& KillXPBaseField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.KillXPBase")>(this, "APrimalCharacter.KillXPBase"); }
+	TArray<FName>& ReplicatedBonesField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("APrimalCharacter.ReplicatedBones")>(this, "APrimalCharacter.ReplicatedBones"); }
+	float& RagdollReplicationIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.RagdollReplicationInterval")>(this, "APrimalCharacter.RagdollReplicationInterval"); }
+	float& ClientRotationInterpSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.ClientRotationInterpSpeed")>(this, "APrimalCharacter.ClientRotationInterpSpeed"); }
+	float& ClientLocationInterpSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.ClientLocationInterpSpeed")>(this, "APrimalCharacter.ClientLocationInterpSpeed"); }
+	float& MaxDragMovementSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.MaxDragMovementSpeed")>(this, "APrimalCharacter.MaxDragMovementSpeed"); }
+	FRotator& CurrentAimRotField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalCharacter.CurrentAimRot")>(this, "APrimalCharacter.CurrentAimRot"); }
+	FVector& CurrentRootLocField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalCharacter.CurrentRootLoc")>(this, "APrimalCharacter.CurrentRootLoc"); }
+	int& LastYawSpeedWorldFrameCounterField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalCharacter.LastYawSpeedWorldFrameCounter")>(this, "APrimalCharacter.LastYawSpeedWorldFrameCounter"); }
+	FName& MeshPreRagdollCollisionProfileNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalCharacter.MeshPreRagdollCollisionProfileName")>(this, "APrimalCharacter.MeshPreRagdollCollisionProfileName"); }
+	FName& CapsulePreRagdollCollisionProfileNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalCharacter.CapsulePreRagdollCollisionProfileName")>(this, "APrimalCharacter.CapsulePreRagdollCollisionProfileName"); }
+	UPrimalCharacterStatusComponent * MyCharacterStatusComponentField() { return *GetNativePointerField<UPrimalCharacterStatusComponent **, API::FieldNameHash("APrimalCharacter.MyCharacterStatusComponent")>(this, "APrimalCharacter.MyCharacterStatusComponent"); }
+	float& LastTickStaminaValueField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.LastTickStaminaValue")>(this, "APrimalCharacter.LastTickStaminaValue"); }
+	UPrimalInventoryComponent * MyInventoryComponentField() { return *GetNativePointerField<UPrimalInventoryComponent **, API::FieldNameHash("APrimalCharacter.MyInventoryComponent")>(this, "APrimalCharacter.MyInventoryComponent"); }
+	UAnimMontage * SyncedMontageField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalCharacter.SyncedMontage")>(this, "APrimalCharacter.SyncedMontage"); }
+	long double& LastMontageSyncTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastMontageSyncTime")>(this, "APrimalCharacter.LastMontageSyncTime"); }
+	float& SyncedMontageDurationField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.SyncedMontageDuration")>(this, "APrimalCharacter.SyncedMontageDuration"); }
+	float& MontageSyncIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.MontageSyncInterval")>(this, "APrimalCharacter.MontageSyncInterval"); }
+	long double& LastRunningTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastRunningTime")>(this, "APrimalCharacter.LastRunningTime"); }
+	FVector& TPVCameraOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalCharacter.TPVCameraOffset")>(this, "APrimalCharacter.TPVCameraOffset"); }
+	FVector& TPVCameraOffsetMultiplierField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalCharacter.TPVCameraOffsetMultiplier")>(this, "APrimalCharacter.TPVCameraOffsetMultiplier"); }
+	FVector& TPVCameraOrgOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalCharacter.TPVCameraOrgOffset")>(this, "APrimalCharacter.TPVCameraOrgOffset"); }
+	float& LandedSoundMaxRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.LandedSoundMaxRange")>(this, "APrimalCharacter.LandedSoundMaxRange"); }
+	float& FallingDamageHealthScaleBaseField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.FallingDamageHealthScaleBase")>(this, "APrimalCharacter.FallingDamageHealthScaleBase"); }
+	float& FootstepsMaxRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.FootstepsMaxRange")>(this, "APrimalCharacter.FootstepsMaxRange"); }
+	float& MinTimeBetweenFootstepsField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.MinTimeBetweenFootsteps")>(this, "APrimalCharacter.MinTimeBetweenFootsteps"); }
+	long double& LastPlayedFootstepTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastPlayedFootstepTime")>(this, "APrimalCharacter.LastPlayedFootstepTime"); }
+	float& MinTimeBetweenFootstepsRunningField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.MinTimeBetweenFootstepsRunning")>(this, "APrimalCharacter.MinTimeBetweenFootstepsRunning"); }
+	TArray<UAnimMontage *> AnimationsPreventInputField() { return *GetNativePointerField<TArray<UAnimMontage *>*, API::FieldNameHash("APrimalCharacter.AnimationsPreventInput")>(this, "APrimalCharacter.AnimationsPreventInput"); }
+	long double& LastNetDidLandField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastNetDidLand")>(this, "APrimalCharacter.LastNetDidLand"); }
+	TWeakObjectPtr<AController>& LastDamageEventInstigatorField() { return *GetNativePointerField<TWeakObjectPtr<AController>*, API::FieldNameHash("APrimalCharacter.LastDamageEventInstigator")>(this, "APrimalCharacter.LastDamageEventInstigator"); }
+	int& CachedNumberOfClientRagdollCorrectionAttemptsField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalCharacter.CachedNumberOfClientRagdollCorrectionAttempts")>(this, "APrimalCharacter.CachedNumberOfClientRagdollCorrectionAttempts"); }
+	int& NumberOfClientRagdollCorrectionAttemptsField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalCharacter.NumberOfClientRagdollCorrectionAttempts")>(this, "APrimalCharacter.NumberOfClientRagdollCorrectionAttempts"); }
+	float& ServerForceSleepRagdollIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.ServerForceSleepRagdollInterval")>(this, "APrimalCharacter.ServerForceSleepRagdollInterval"); }
+	float& ClientForceSleepRagdollIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.ClientForceSleepRagdollInterval")>(this, "APrimalCharacter.ClientForceSleepRagdollInterval"); }
+	float& NonRelevantServerForceSleepRagdollIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.NonRelevantServerForceSleepRagdollInterval")>(this, "APrimalCharacter.NonRelevantServerForceSleepRagdollInterval"); }
+	TEnumAsByte<enum EShooterPhysMaterialType::Type>& TargetableDamageFXDefaultPhysMaterialField() { return *GetNativePointerField<TEnumAsByte<enum EShooterPhysMaterialType::Type>*, API::FieldNameHash("APrimalCharacter.TargetableDamageFXDefaultPhysMaterial")>(this, "APrimalCharacter.TargetableDamageFXDefaultPhysMaterial"); }
+	UAnimMontage * PoopAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalCharacter.PoopAnimation")>(this, "APrimalCharacter.PoopAnimation"); }
+	long double& CorpseDestructionTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.CorpseDestructionTime")>(this, "APrimalCharacter.CorpseDestructionTime"); }
+	float& CorpseLifespanField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.CorpseLifespan")>(this, "APrimalCharacter.CorpseLifespan"); }
+	float& TPVStructurePlacingHeightMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.TPVStructurePlacingHeightMultiplier")>(this, "APrimalCharacter.TPVStructurePlacingHeightMultiplier"); }
+	float& CorpseFadeAwayTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.CorpseFadeAwayTime")>(this, "APrimalCharacter.CorpseFadeAwayTime"); }
+	float& RagdollDeathImpulseScalerField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.RagdollDeathImpulseScaler")>(this, "APrimalCharacter.RagdollDeathImpulseScaler"); }
+	USoundCue * PoopSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("APrimalCharacter.PoopSound")>(this, "APrimalCharacter.PoopSound"); }
+	float& BaseTargetingDesirabilityField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.BaseTargetingDesirability")>(this, "APrimalCharacter.BaseTargetingDesirability"); }
+	float& DeadBaseTargetingDesirabilityField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.DeadBaseTargetingDesirability")>(this, "APrimalCharacter.DeadBaseTargetingDesirability"); }
+	FRotator& OrbitCamRotField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalCharacter.OrbitCamRot")>(this, "APrimalCharacter.OrbitCamRot"); }
+	float& OrbitCamZoomField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.OrbitCamZoom")>(this, "APrimalCharacter.OrbitCamZoom"); }
+	float& OrbitCamZoomStepSizeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.OrbitCamZoomStepSize")>(this, "APrimalCharacter.OrbitCamZoomStepSize"); }
+	float& OrbitCamMinZoomLevelField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.OrbitCamMinZoomLevel")>(this, "APrimalCharacter.OrbitCamMinZoomLevel"); }
+	float& OrbitCamMaxZoomLevelField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.OrbitCamMaxZoomLevel")>(this, "APrimalCharacter.OrbitCamMaxZoomLevel"); }
+	FVector& LastSubmergedCheckLocField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalCharacter.LastSubmergedCheckLoc")>(this, "APrimalCharacter.LastSubmergedCheckLoc"); }
+	long double& LastTimeNotInFallingField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastTimeNotInFalling")>(this, "APrimalCharacter.LastTimeNotInFalling"); }
+	float& MaxCursorHUDDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.MaxCursorHUDDistance")>(this, "APrimalCharacter.MaxCursorHUDDistance"); }
+	float& AddForwardVelocityOnJumpField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.AddForwardVelocityOnJump")>(this, "APrimalCharacter.AddForwardVelocityOnJump"); }
+	FVector& DeathActorTargetingOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalCharacter.DeathActorTargetingOffset")>(this, "APrimalCharacter.DeathActorTargetingOffset"); }
+	FName& SocketOverrideTargetingLocationField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalCharacter.SocketOverrideTargetingLocation")>(this, "APrimalCharacter.SocketOverrideTargetingLocation"); }
+	FDamageEvent * CurrentDamageEventField() { return *GetNativePointerField<FDamageEvent **, API::FieldNameHash("APrimalCharacter.CurrentDamageEvent")>(this, "APrimalCharacter.CurrentDamageEvent"); }
+	FVector& LastApproximatePhysVolumeLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalCharacter.LastApproximatePhysVolumeLocation")>(this, "APrimalCharacter.LastApproximatePhysVolumeLocation"); }
+	long double& LastTimeSubmergedField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastTimeSubmerged")>(this, "APrimalCharacter.LastTimeSubmerged"); }
+	EPhysicalSurface& LastFootPhysicalSurfaceTypeField() { return *GetNativePointerField<EPhysicalSurface*, API::FieldNameHash("APrimalCharacter.LastFootPhysicalSurfaceType")>(this, "APrimalCharacter.LastFootPhysicalSurfaceType"); }
+	long double& LastFootPhysicalSurfaceCheckTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastFootPhysicalSurfaceCheckTime")>(this, "APrimalCharacter.LastFootPhysicalSurfaceCheckTime"); }
+	float& FootPhysicalSurfaceCheckIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.FootPhysicalSurfaceCheckInterval")>(this, "APrimalCharacter.FootPhysicalSurfaceCheckInterval"); }
+	TWeakObjectPtr<APrimalCharacter>& LastHurtByNearbyPlayerField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*, API::FieldNameHash("APrimalCharacter.LastHurtByNearbyPlayer")>(this, "APrimalCharacter.LastHurtByNearbyPlayer"); }
+	float& LastHurtByNearbyPlayerTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.LastHurtByNearbyPlayerTime")>(this, "APrimalCharacter.LastHurtByNearbyPlayerTime"); }
+	TWeakObjectPtr<APrimalCharacter>& LastAttackedNearbyPlayerField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*, API::FieldNameHash("APrimalCharacter.LastAttackedNearbyPlayer")>(this, "APrimalCharacter.LastAttackedNearbyPlayer"); }
+	float& LastAttackedNearbyPlayerTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.LastAttackedNearbyPlayerTime")>(this, "APrimalCharacter.LastAttackedNearbyPlayerTime"); }
+	long double& LastStartFallingRagdollTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastStartFallingRagdollTime")>(this, "APrimalCharacter.LastStartFallingRagdollTime"); }
+	FVector& RagdollLastFrameLinearVelocityField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalCharacter.RagdollLastFrameLinearVelocity")>(this, "APrimalCharacter.RagdollLastFrameLinearVelocity"); }
+	float& RagdollImpactDamageVelocityScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.RagdollImpactDamageVelocityScale")>(this, "APrimalCharacter.RagdollImpactDamageVelocityScale"); }
+	float& RagdollImpactDamageMinDecelerationSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.RagdollImpactDamageMinDecelerationSpeed")>(this, "APrimalCharacter.RagdollImpactDamageMinDecelerationSpeed"); }
+	float& StartFallingImpactRagdollTimeIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.StartFallingImpactRagdollTimeInterval")>(this, "APrimalCharacter.StartFallingImpactRagdollTimeInterval"); }
+	long double& LastUnstasisTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastUnstasisTime")>(this, "APrimalCharacter.LastUnstasisTime"); }
+	FVector& PreviousRagdollLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalCharacter.PreviousRagdollLocation")>(this, "APrimalCharacter.PreviousRagdollLocation"); }
+	int& RagdollPenetrationFailuresField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalCharacter.RagdollPenetrationFailures")>(this, "APrimalCharacter.RagdollPenetrationFailures"); }
+	long double& NextBlinkTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.NextBlinkTime")>(this, "APrimalCharacter.NextBlinkTime"); }
+	long double& BlinkTimerField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.BlinkTimer")>(this, "APrimalCharacter.BlinkTimer"); }
+	long double& LastInSwimmingSoundTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastInSwimmingSoundTime")>(this, "APrimalCharacter.LastInSwimmingSoundTime"); }
+	USoundCue * EnteredSwimmingSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("APrimalCharacter.EnteredSwimmingSound")>(this, "APrimalCharacter.EnteredSwimmingSound"); }
+	USoundCue * EnteredSleepingSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("APrimalCharacter.EnteredSleepingSound")>(this, "APrimalCharacter.EnteredSleepingSound"); }
+	USoundCue * LeftSleepingSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("APrimalCharacter.LeftSleepingSound")>(this, "APrimalCharacter.LeftSleepingSound"); }
+	long double& LastRelevantToPlayerTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastRelevantToPlayerTime")>(this, "APrimalCharacter.LastRelevantToPlayerTime"); }
+	long double& MeshStopForceUpdatingAtTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.MeshStopForceUpdatingAtTime")>(this, "APrimalCharacter.MeshStopForceUpdatingAtTime"); }
+	long double& LastWalkingTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastWalkingTime")>(this, "APrimalCharacter.LastWalkingTime"); }
+	long double& LastSpecialDamageTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastSpecialDamageTime")>(this, "APrimalCharacter.LastSpecialDamageTime"); }
+	float& CorpseDraggedDecayRateField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.CorpseDraggedDecayRate")>(this, "APrimalCharacter.CorpseDraggedDecayRate"); }
+	float& PoopAltItemChanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.PoopAltItemChance")>(this, "APrimalCharacter.PoopAltItemChance"); }
+	TSubclassOf<UPrimalItem>& PoopAltItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("APrimalCharacter.PoopAltItemClass")>(this, "APrimalCharacter.PoopAltItemClass"); }
+	TArray<TSubclassOf<APrimalBuff>>& DefaultBuffsField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalBuff>>*, API::FieldNameHash("APrimalCharacter.DefaultBuffs")>(this, "APrimalCharacter.DefaultBuffs"); }
+	UTexture2D * PoopIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("APrimalCharacter.PoopIcon")>(this, "APrimalCharacter.PoopIcon"); }
+	float& RunningMaxDesiredRotDeltaField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.RunningMaxDesiredRotDelta")>(this, "APrimalCharacter.RunningMaxDesiredRotDelta"); }
+	long double& CorpseDestructionTimerField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.CorpseDestructionTimer")>(this, "APrimalCharacter.CorpseDestructionTimer"); }
+	long double& LastSkinnedTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastSkinnedTime")>(this, "APrimalCharacter.LastSkinnedTime"); }
+	float& OriginalCorpseLifespanField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.OriginalCorpseLifespan")>(this, "APrimalCharacter.OriginalCorpseLifespan"); }
+	float& CorpseHarvestFadeTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.CorpseHarvestFadeTime")>(this, "APrimalCharacter.CorpseHarvestFadeTime"); }
+	FVector& CurrentLocalRootLocField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalCharacter.CurrentLocalRootLoc")>(this, "APrimalCharacter.CurrentLocalRootLoc"); }
+	float& RootYawField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.RootYaw")>(this, "APrimalCharacter.RootYaw"); }
+	long double& LastTimeInSwimmingField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastTimeInSwimming")>(this, "APrimalCharacter.LastTimeInSwimming"); }
+	long double& LastListenRangePushTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastListenRangePushTime")>(this, "APrimalCharacter.LastListenRangePushTime"); }
+	float& LastDamageAmountMaterialValueField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.LastDamageAmountMaterialValue")>(this, "APrimalCharacter.LastDamageAmountMaterialValue"); }
+	float& BuffedDamageMultField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.BuffedDamageMult")>(this, "APrimalCharacter.BuffedDamageMult"); }
+	float& BuffedResistanceMultField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.BuffedResistanceMult")>(this, "APrimalCharacter.BuffedResistanceMult"); }
+	float& ExtraMaxSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.ExtraMaxSpeedModifier")>(this, "APrimalCharacter.ExtraMaxSpeedModifier"); }
+	float& TamedDinoCallOutRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.TamedDinoCallOutRange")>(this, "APrimalCharacter.TamedDinoCallOutRange"); }
+	long double& LastBumpedDamageTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastBumpedDamageTime")>(this, "APrimalCharacter.LastBumpedDamageTime"); }
+	FVector& TargetPathfindingLocationOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalCharacter.TargetPathfindingLocationOffset")>(this, "APrimalCharacter.TargetPathfindingLocationOffset"); }
+	long double& LastTookDamageTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastTookDamageTime")>(this, "APrimalCharacter.LastTookDamageTime"); }
+	float& ExtraReceiveDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.ExtraReceiveDamageMultiplier")>(this, "APrimalCharacter.ExtraReceiveDamageMultiplier"); }
+	float& ExtraMeleeDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.ExtraMeleeDamageMultiplier")>(this, "APrimalCharacter.ExtraMeleeDamageMultiplier"); }
+	float& LastFallingZField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.LastFallingZ")>(this, "APrimalCharacter.LastFallingZ"); }
+	int& NumFallZFailsField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalCharacter.NumFallZFails")>(this, "APrimalCharacter.NumFallZFails"); }
+	TArray<TWeakObjectPtr<APrimalCharacter>>& CharactersGrappledToMeField() { return *GetNativePointerField<TArray<TWeakObjectPtr<APrimalCharacter>>*, API::FieldNameHash("APrimalCharacter.CharactersGrappledToMe")>(this, "APrimalCharacter.CharactersGrappledToMe"); }
+	float& DamageTheMeleeDamageCauserPercentField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.DamageTheMeleeDamageCauserPercent")>(this, "APrimalCharacter.DamageTheMeleeDamageCauserPercent"); }
+	float& DurabilityDegrateTheMeleeDamageCauserPercentField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.DurabilityDegrateTheMeleeDamageCauserPercent")>(this, "APrimalCharacter.DurabilityDegrateTheMeleeDamageCauserPercent"); }
+	TSubclassOf<UDamageType>& DamageTheMeleeDamageCauserDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*, API::FieldNameHash("APrimalCharacter.DamageTheMeleeDamageCauserDamageType")>(this, "APrimalCharacter.DamageTheMeleeDamageCauserDamageType"); }
+	char& TribeGroupInventoryRankField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalCharacter.TribeGroupInventoryRank")>(this, "APrimalCharacter.TribeGroupInventoryRank"); }
+	float& CharacterDamageImpulseMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.CharacterDamageImpulseMultiplier")>(this, "APrimalCharacter.CharacterDamageImpulseMultiplier"); }
+	long double& ForceCheckPushThroughWallsTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.ForceCheckPushThroughWallsTime")>(this, "APrimalCharacter.ForceCheckPushThroughWallsTime"); }
+	long double& LastStoppedEatAnimationTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastStoppedEatAnimationTime")>(this, "APrimalCharacter.LastStoppedEatAnimationTime"); }
+	float& ClientRotationInterpSpeedMultiplierGroundField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.ClientRotationInterpSpeedMultiplierGround")>(this, "APrimalCharacter.ClientRotationInterpSpeedMultiplierGround"); }
+	float& GlideGravityScaleMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.GlideGravityScaleMultiplier")>(this, "APrimalCharacter.GlideGravityScaleMultiplier"); }
+	float& GlideMaxCarriedWeightField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.GlideMaxCarriedWeight")>(this, "APrimalCharacter.GlideMaxCarriedWeight"); }
+	UAnimMontage * lastPlayedMountAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalCharacter.lastPlayedMountAnim")>(this, "APrimalCharacter.lastPlayedMountAnim"); }
+	float& ScaleDeathHarvestHealthyByMaxHealthBaseField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.ScaleDeathHarvestHealthyByMaxHealthBase")>(this, "APrimalCharacter.ScaleDeathHarvestHealthyByMaxHealthBase"); }
+	long double& LastForceMeshRefreshBonesTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastForceMeshRefreshBonesTime")>(this, "APrimalCharacter.LastForceMeshRefreshBonesTime"); }
+	long double& LastStartedBeingCarriedTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastStartedBeingCarriedTime")>(this, "APrimalCharacter.LastStartedBeingCarriedTime"); }
+	float& RunMinVelocityRotDotField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalCharacter.RunMinVelocityRotDot")>(this, "APrimalCharacter.RunMinVelocityRotDot"); }
+	long double& LastHitDamageTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalCharacter.LastHitDamageTime")>(this, "APrimalCharacter.LastHitDamageTime"); }
+	TArray<TSubclassOf<APrimalBuff>>& PreventBuffClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalBuff>>*, API::FieldNameHash("APrimalCharacter.PreventBuffClasses")>(this, "APrimalCharacter.PreventBuffClasses"); }
 
 	// Bit fields
 
@@ -3329,214 +3329,214 @@ struct APrimalCharacter : ACharacter
 
 struct AShooterCharacter : APrimalCharacter
 {
-	TArray<FTransponderInfo>& ClientTranspondersInfoField() { return *GetNativePointerField<TArray<FTransponderInfo>*>(this, "AShooterCharacter.ClientTranspondersInfo"); }
-	UAnimMontage * SpawnIntroAnim1PField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.SpawnIntroAnim1P"); }
-	UAnimMontage * RespawnIntroAnim1PField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.RespawnIntroAnim1P"); }
-	UAnimMontage * ProneInAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.ProneInAnim"); }
-	UAnimMontage * ProneOutAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.ProneOutAnim"); }
-	UAnimMontage * StartRidingAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.StartRidingAnim"); }
-	UAnimMontage * StopRidingAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.StopRidingAnim"); }
-	UAnimMontage * TalkingAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.TalkingAnim"); }
-	UAnimMontage * VoiceTalkingAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.VoiceTalkingAnim"); }
-	TArray<UAnimMontage *> EmoteAnimsField() { return *GetNativePointerField<TArray<UAnimMontage *>*>(this, "AShooterCharacter.EmoteAnims"); }
-	UAnimMontage * FireBallistaAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.FireBallistaAnimation"); }
-	UAnimMontage * ReloadBallistaAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.ReloadBallistaAnimation"); }
-	UAnimMontage * DraggingCharacterAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.DraggingCharacterAnim"); }
-	bool& bWasProneField() { return *GetNativePointerField<bool*>(this, "AShooterCharacter.bWasProne"); }
-	bool& bIsPreviewCharacterField() { return *GetNativePointerField<bool*>(this, "AShooterCharacter.bIsPreviewCharacter"); }
-	bool& bIsVoiceTalkingField() { return *GetNativePointerField<bool*>(this, "AShooterCharacter.bIsVoiceTalking"); }
-	long double& LastStartedTalkingTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastStartedTalkingTime"); }
-	long double& DontTargetUntilTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.DontTargetUntilTime"); }
-	float& OriginalCollisionHeightField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.OriginalCollisionHeight"); }
-	float& WalkBobMagnitudeField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.WalkBobMagnitude"); }
-	float& WalkBobInterpSpeedField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.WalkBobInterpSpeed"); }
-	float& TargetingTimeField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.TargetingTime"); }
-	float& BobMaxMovementSpeedField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.BobMaxMovementSpeed"); }
-	float& WeaponBobMaxMovementSpeedField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.WeaponBobMaxMovementSpeed"); }
-	TSubclassOf<AShooterWeapon>& DefaultWeaponField() { return *GetNativePointerField<TSubclassOf<AShooterWeapon>*>(this, "AShooterCharacter.DefaultWeapon"); }
-	TSubclassOf<AShooterWeapon>& MapWeaponField() { return *GetNativePointerField<TSubclassOf<AShooterWeapon>*>(this, "AShooterCharacter.MapWeapon"); }
-	TSubclassOf<AShooterWeapon>& GPSWeaponField() { return *GetNativePointerField<TSubclassOf<AShooterWeapon>*>(this, "AShooterCharacter.GPSWeapon"); }
-	TSubclassOf<AShooterWeapon>& CompassWeaponField() { return *GetNativePointerField<TSubclassOf<AShooterWeapon>*>(this, "AShooterCharacter.CompassWeapon"); }
-	FString& PlayerNameField() { return *GetNativePointerField<FString*>(this, "AShooterCharacter.PlayerName"); }
-	TWeakObjectPtr<APrimalDinoCharacter>& RidingDinoField() { return *GetNativePointerField<TWeakObjectPtr<APrimalDinoCharacter>*>(this, "AShooterCharacter.RidingDino"); }
-	TArray<FName>& LowerBodyPartRootBonesField() { return *GetNativePointerField<TArray<FName>*>(this, "AShooterCharacter.LowerBodyPartRootBones"); }
-	UAnimMontage * DropItemAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.DropItemAnimation"); }
-	UAnimMontage * ThrowItemAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.ThrowItemAnimation"); }
-	UAnimMontage * PickupItemAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.PickupItemAnimation"); }
-	UAnimMontage * ActivateInventoryAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.ActivateInventoryAnimation"); }
-	FRotator& LastDinoAimRotationOffsetField() { return *GetNativePointerField<FRotator*>(this, "AShooterCharacter.LastDinoAimRotationOffset"); }
-	FRotator& LastAimRotOffsetField() { return *GetNativePointerField<FRotator*>(this, "AShooterCharacter.LastAimRotOffset"); }
-	UAudioComponent * LastGrapHookACField() { return *GetNativePointerField<UAudioComponent **>(this, "AShooterCharacter.LastGrapHookAC"); }
-	int& _GrapHookCableObjectCountField() { return *GetNativePointerField<int*>(this, "AShooterCharacter._GrapHookCableObjectCount"); }
-	FVector& GrapHookDefaultOffsetField() { return *GetNativePointerField<FVector*>(this, "AShooterCharacter.GrapHookDefaultOffset"); }
-	float& GrapHookCableWidthField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.GrapHookCableWidth"); }
-	UMaterialInterface * GrapHookMaterialField() { return *GetNativePointerField<UMaterialInterface **>(this, "AShooterCharacter.GrapHookMaterial"); }
-	float& LadderLateralJumpVelocityField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.LadderLateralJumpVelocity"); }
-	float& GrapHookPulledRopeDistanceField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.GrapHookPulledRopeDistance"); }
-	float& GrapHookSyncTimeField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.GrapHookSyncTime"); }
-	bool& bReleasingGrapHookField() { return *GetNativePointerField<bool*>(this, "AShooterCharacter.bReleasingGrapHook"); }
-	FString& PlatformProfileNameField() { return *GetNativePointerField<FString*>(this, "AShooterCharacter.PlatformProfileName"); }
-	FUniqueNetIdRepl& PlatformProfileIDField() { return *GetNativePointerField<FUniqueNetIdRepl*>(this, "AShooterCharacter.PlatformProfileID"); }
-	UAudioComponent * CharacterStatusStateSoundComponentField() { return *GetNativePointerField<UAudioComponent **>(this, "AShooterCharacter.CharacterStatusStateSoundComponent"); }
-	long double& LastUncrouchTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastUncrouchTime"); }
-	long double& LastUnproneTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastUnproneTime"); }
-	float& CurrentWeaponBobSpeedField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.CurrentWeaponBobSpeed"); }
-	float& WalkBobOldSpeedField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.WalkBobOldSpeed"); }
-	float& AppliedBobField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.AppliedBob"); }
-	float& BobTimeField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.BobTime"); }
-	long double& LastPressReloadTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastPressReloadTime"); }
-	FName& WeaponAttachPointField() { return *GetNativePointerField<FName*>(this, "AShooterCharacter.WeaponAttachPoint"); }
-	float& TargetingSpeedModifierField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.TargetingSpeedModifier"); }
-	USoundCue * LowHealthSoundField() { return *GetNativePointerField<USoundCue **>(this, "AShooterCharacter.LowHealthSound"); }
-	UAnimMontage * CallFollowAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.CallFollowAnim"); }
-	UAnimMontage * CallStayAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.CallStayAnim"); }
-	UAnimMontage * CallFollowAnimSingleField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.CallFollowAnimSingle"); }
-	UAnimMontage * CallStayAnimSingleField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.CallStayAnimSingle"); }
-	UAnimMontage * CallMoveToAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.CallMoveToAnim"); }
-	UAnimMontage * CallAttackAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.CallAttackAnim"); }
-	UAudioComponent * LowHealthWarningPlayerField() { return *GetNativePointerField<UAudioComponent **>(this, "AShooterCharacter.LowHealthWarningPlayer"); }
-	FItemNetID& NextWeaponItemIDField() { return *GetNativePointerField<FItemNetID*>(this, "AShooterCharacter.NextWeaponItemID"); }
-	float& WeaponBobTimeField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.WeaponBobTime"); }
-	float& CurrentAimBlendingField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.CurrentAimBlending"); }
-	long double& InterpLastCrouchProneStateChangeTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.InterpLastCrouchProneStateChangeTime"); }
-	long double& PressCrouchProneToggleTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.PressCrouchProneToggleTime"); }
-	float& CraftingMovementSpeedModifierField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.CraftingMovementSpeedModifier"); }
-	FVector& WeaponBobMagnitudesField() { return *GetNativePointerField<FVector*>(this, "AShooterCharacter.WeaponBobMagnitudes"); }
-	FVector& WeaponBobPeriodsField() { return *GetNativePointerField<FVector*>(this, "AShooterCharacter.WeaponBobPeriods"); }
-	FVector& WeaponBobOffsetsField() { return *GetNativePointerField<FVector*>(this, "AShooterCharacter.WeaponBobOffsets"); }
-	FVector& WeaponBobMagnitudes_TargetingField() { return *GetNativePointerField<FVector*>(this, "AShooterCharacter.WeaponBobMagnitudes_Targeting"); }
-	FVector& WeaponBobPeriods_TargetingField() { return *GetNativePointerField<FVector*>(this, "AShooterCharacter.WeaponBobPeriods_Targeting"); }
-	FVector& WeaponBobOffsets_TargetingField() { return *GetNativePointerField<FVector*>(this, "AShooterCharacter.WeaponBobOffsets_Targeting"); }
-	float& WeaponBobMinimumSpeedField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.WeaponBobMinimumSpeed"); }
-	float& WeaponBobSpeedBaseField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.WeaponBobSpeedBase"); }
-	float& WeaponBobSpeedBaseFallingField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.WeaponBobSpeedBaseFalling"); }
-	float& WeaponBobTargetingBlendField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.WeaponBobTargetingBlend"); }
-	TArray<FItemAttachmentInfo>& DefaultAttachmentInfosField() { return *GetNativePointerField<TArray<FItemAttachmentInfo>*>(this, "AShooterCharacter.DefaultAttachmentInfos"); }
-	USoundCue * StartCrouchSoundField() { return *GetNativePointerField<USoundCue **>(this, "AShooterCharacter.StartCrouchSound"); }
-	USoundCue * EndCrouchSoundField() { return *GetNativePointerField<USoundCue **>(this, "AShooterCharacter.EndCrouchSound"); }
-	USoundCue * StartProneSoundField() { return *GetNativePointerField<USoundCue **>(this, "AShooterCharacter.StartProneSound"); }
-	USoundCue * EndProneSoundField() { return *GetNativePointerField<USoundCue **>(this, "AShooterCharacter.EndProneSound"); }
-	TSubclassOf<AShooterWeapon>& NextInventoryWeaponField() { return *GetNativePointerField<TSubclassOf<AShooterWeapon>*>(this, "AShooterCharacter.NextInventoryWeapon"); }
-	FItemNetID& PreMapWeaponItemNetIDField() { return *GetNativePointerField<FItemNetID*>(this, "AShooterCharacter.PreMapWeaponItemNetID"); }
-	float& ServerSeatedViewRotationYawField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.ServerSeatedViewRotationYaw"); }
-	float& ServerSeatedViewRotationPitchField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.ServerSeatedViewRotationPitch"); }
-	AShooterWeapon * CurrentWeaponField() { return *GetNativePointerField<AShooterWeapon **>(this, "AShooterCharacter.CurrentWeapon"); }
-	unsigned __int64& LinkedPlayerDataIDField() { return *GetNativePointerField<unsigned __int64*>(this, "AShooterCharacter.LinkedPlayerDataID"); }
-	long double& LastTimeInFallingField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastTimeInFalling"); }
-	long double& StartedRidingTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.StartedRidingTime"); }
-	long double& TimeSinceLastControllerField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.TimeSinceLastController"); }
-	TWeakObjectPtr<AController>& LastControllerField() { return *GetNativePointerField<TWeakObjectPtr<AController>*>(this, "AShooterCharacter.LastController"); }
-	TWeakObjectPtr<AShooterPlayerController>& LastValidPlayerControllerField() { return *GetNativePointerField<TWeakObjectPtr<AShooterPlayerController>*>(this, "AShooterCharacter.LastValidPlayerController"); }
-	UAnimMontage * DrinkingAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.DrinkingAnimation"); }
-	long double& LastRequestedTribeTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastRequestedTribeTime"); }
-	unsigned __int64& LastRequestedTribeIDField() { return *GetNativePointerField<unsigned __int64*>(this, "AShooterCharacter.LastRequestedTribeID"); }
-	FString& LastRequestedTribeNameField() { return *GetNativePointerField<FString*>(this, "AShooterCharacter.LastRequestedTribeName"); }
-	TWeakObjectPtr<AShooterCharacter>& LastRequestedTribePlayerCharacterField() { return *GetNativePointerField<TWeakObjectPtr<AShooterCharacter>*>(this, "AShooterCharacter.LastRequestedTribePlayerCharacter"); }
-	float& IndoorsHyperthermiaInsulationField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.IndoorsHyperthermiaInsulation"); }
-	float& IndoorsHypothermiaInsulationField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.IndoorsHypothermiaInsulation"); }
-	float& IndoorCheckIntervalField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.IndoorCheckInterval"); }
-	long double& LastIndoorCheckTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastIndoorCheckTime"); }
-	FItemNetID& PreRidingWeaponItemNetIDField() { return *GetNativePointerField<FItemNetID*>(this, "AShooterCharacter.PreRidingWeaponItemNetID"); }
-	FItemNetID& PreInventoryWeaponItemNetIDField() { return *GetNativePointerField<FItemNetID*>(this, "AShooterCharacter.PreInventoryWeaponItemNetID"); }
-	UAnimSequence * ViewingInventoryAnimationField() { return *GetNativePointerField<UAnimSequence **>(this, "AShooterCharacter.ViewingInventoryAnimation"); }
-	UAnimSequence * DefaultDinoRidingAnimationField() { return *GetNativePointerField<UAnimSequence **>(this, "AShooterCharacter.DefaultDinoRidingAnimation"); }
-	UAnimSequence * DefaultDinoRidingMoveAnimationField() { return *GetNativePointerField<UAnimSequence **>(this, "AShooterCharacter.DefaultDinoRidingMoveAnimation"); }
-	UAnimSequence * DefaultSeatingAnimationField() { return *GetNativePointerField<UAnimSequence **>(this, "AShooterCharacter.DefaultSeatingAnimation"); }
-	UAnimSequence * DefaultShieldAnimationField() { return *GetNativePointerField<UAnimSequence **>(this, "AShooterCharacter.DefaultShieldAnimation"); }
-	UAnimMontage * ShieldCoverAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.ShieldCoverAnimation"); }
-	UAnimMontage * ShieldCoverAnimationForCrouchField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.ShieldCoverAnimationForCrouch"); }
-	float& EnemyPlayerMaxCursorHUDDistanceProneField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.EnemyPlayerMaxCursorHUDDistanceProne"); }
-	float& EnemyPlayerMaxCursorHUDDistanceCrouchedField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.EnemyPlayerMaxCursorHUDDistanceCrouched"); }
-	float& EnemyPlayerMaxCursorHUDDistanceStandingField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.EnemyPlayerMaxCursorHUDDistanceStanding"); }
-	FSaddlePassengerSeatDefinition& CurrentPassengerSeatDefinitionField() { return *GetNativePointerField<FSaddlePassengerSeatDefinition*>(this, "AShooterCharacter.CurrentPassengerSeatDefinition"); }
-	TArray<UAnimMontage *> AnimsOverrideFromField() { return *GetNativePointerField<TArray<UAnimMontage *>*>(this, "AShooterCharacter.AnimsOverrideFrom"); }
-	TArray<UAnimMontage *> AnimOverrideToField() { return *GetNativePointerField<TArray<UAnimMontage *>*>(this, "AShooterCharacter.AnimOverrideTo"); }
-	TArray<UAnimSequence *> AnimSequencesOverrideFromField() { return *GetNativePointerField<TArray<UAnimSequence *>*>(this, "AShooterCharacter.AnimSequencesOverrideFrom"); }
-	TArray<UAnimSequence *> AnimSequenceOverrideToField() { return *GetNativePointerField<TArray<UAnimSequence *>*>(this, "AShooterCharacter.AnimSequenceOverrideTo"); }
-	float& PreviousRootYawSpeedField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.PreviousRootYawSpeed"); }
+	TArray<FTransponderInfo>& ClientTranspondersInfoField() { return *GetNativePointerField<TArray<FTransponderInfo>*, API::FieldNameHash("AShooterCharacter.ClientTranspondersInfo")>(this, "AShooterCharacter.ClientTranspondersInfo"); }
+	UAnimMontage * SpawnIntroAnim1PField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.SpawnIntroAnim1P")>(this, "AShooterCharacter.SpawnIntroAnim1P"); }
+	UAnimMontage * RespawnIntroAnim1PField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.RespawnIntroAnim1P")>(this, "AShooterCharacter.RespawnIntroAnim1P"); }
+	UAnimMontage * ProneInAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.ProneInAnim")>(this, "AShooterCharacter.ProneInAnim"); }
+	UAnimMontage * ProneOutAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.ProneOutAnim")>(this, "AShooterCharacter.ProneOutAnim"); }
+	UAnimMontage * StartRidingAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.StartRidingAnim")>(this, "AShooterCharacter.StartRidingAnim"); }
+	UAnimMontage * StopRidingAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.StopRidingAnim")>(this, "AShooterCharacter.StopRidingAnim"); }
+	UAnimMontage * TalkingAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.TalkingAnim")>(this, "AShooterCharacter.TalkingAnim"); }
+	UAnimMontage * VoiceTalkingAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.VoiceTalkingAnim")>(this, "AShooterCharacter.VoiceTalkingAnim"); }
+	TArray<UAnimMontage *> EmoteAnimsField() { return *GetNativePointerField<TArray<UAnimMontage *>*, API::FieldNameHash("AShooterCharacter.EmoteAnims")>(this, "AShooterCharacter.EmoteAnims"); }
+	UAnimMontage * FireBallistaAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.FireBallistaAnimation")>(this, "AShooterCharacter.FireBallistaAnimation"); }
+	UAnimMontage * ReloadBallistaAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.ReloadBallistaAnimation")>(this, "AShooterCharacter.ReloadBallistaAnimation"); }
+	UAnimMontage * DraggingCharacterAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.DraggingCharacterAnim")>(this, "AShooterCharacter.DraggingCharacterAnim"); }
+	bool& bWasProneField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterCharacter.bWasProne")>(this, "AShooterCharacter.bWasProne"); }
+	bool& bIsPreviewCharacterField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterCharacter.bIsPreviewCharacter")>(this, "AShooterCharacter.bIsPreviewCharacter"); }
+	bool& bIsVoiceTalkingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterCharacter.bIsVoiceTalking")>(this, "AShooterCharacter.bIsVoiceTalking"); }
+	long double& LastStartedTalkingTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastStartedTalkingTime")>(this, "AShooterCharacter.LastStartedTalkingTime"); }
+	long double& DontTargetUntilTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.DontTargetUntilTime")>(this, "AShooterCharacter.DontTargetUntilTime"); }
+	float& OriginalCollisionHeightField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.OriginalCollisionHeight")>(this, "AShooterCharacter.OriginalCollisionHeight"); }
+	float& WalkBobMagnitudeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.WalkBobMagnitude")>(this, "AShooterCharacter.WalkBobMagnitude"); }
+	float& WalkBobInterpSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.WalkBobInterpSpeed")>(this, "AShooterCharacter.WalkBobInterpSpeed"); }
+	float& TargetingTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.TargetingTime")>(this, "AShooterCharacter.TargetingTime"); }
+	float& BobMaxMovementSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.BobMaxMovementSpeed")>(this, "AShooterCharacter.BobMaxMovementSpeed"); }
+	float& WeaponBobMaxMovementSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.WeaponBobMaxMovementSpeed")>(this, "AShooterCharacter.WeaponBobMaxMovementSpeed"); }
+	TSubclassOf<AShooterWeapon>& DefaultWeaponField() { return *GetNativePointerField<TSubclassOf<AShooterWeapon>*, API::FieldNameHash("AShooterCharacter.DefaultWeapon")>(this, "AShooterCharacter.DefaultWeapon"); }
+	TSubclassOf<AShooterWeapon>& MapWeaponField() { return *GetNativePointerField<TSubclassOf<AShooterWeapon>*, API::FieldNameHash("AShooterCharacter.MapWeapon")>(this, "AShooterCharacter.MapWeapon"); }
+	TSubclassOf<AShooterWeapon>& GPSWeaponField() { return *GetNativePointerField<TSubclassOf<AShooterWeapon>*, API::FieldNameHash("AShooterCharacter.GPSWeapon")>(this, "AShooterCharacter.GPSWeapon"); }
+	TSubclassOf<AShooterWeapon>& CompassWeaponField() { return *GetNativePointerField<TSubclassOf<AShooterWeapon>*, API::FieldNameHash("AShooterCharacter.CompassWeapon")>(this, "AShooterCharacter.CompassWeapon"); }
+	FString& PlayerNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterCharacter.PlayerName")>(this, "AShooterCharacter.PlayerName"); }
+	TWeakObjectPtr<APrimalDinoCharacter>& RidingDinoField() { return *GetNativePointerField<TWeakObjectPtr<APrimalDinoCharacter>*, API::FieldNameHash("AShooterCharacter.RidingDino")>(this, "AShooterCharacter.RidingDino"); }
+	TArray<FName>& LowerBodyPartRootBonesField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("AShooterCharacter.LowerBodyPartRootBones")>(this, "AShooterCharacter.LowerBodyPartRootBones"); }
+	UAnimMontage * DropItemAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.DropItemAnimation")>(this, "AShooterCharacter.DropItemAnimation"); }
+	UAnimMontage * ThrowItemAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.ThrowItemAnimation")>(this, "AShooterCharacter.ThrowItemAnimation"); }
+	UAnimMontage * PickupItemAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.PickupItemAnimation")>(this, "AShooterCharacter.PickupItemAnimation"); }
+	UAnimMontage * ActivateInventoryAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.ActivateInventoryAnimation")>(this, "AShooterCharacter.ActivateInventoryAnimation"); }
+	FRotator& LastDinoAimRotationOffsetField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("AShooterCharacter.LastDinoAimRotationOffset")>(this, "AShooterCharacter.LastDinoAimRotationOffset"); }
+	FRotator& LastAimRotOffsetField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("AShooterCharacter.LastAimRotOffset")>(this, "AShooterCharacter.LastAimRotOffset"); }
+	UAudioComponent * LastGrapHookACField() { return *GetNativePointerField<UAudioComponent **, API::FieldNameHash("AShooterCharacter.LastGrapHookAC")>(this, "AShooterCharacter.LastGrapHookAC"); }
+	int& _GrapHookCableObjectCountField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterCharacter._GrapHookCableObjectCount")>(this, "AShooterCharacter._GrapHookCableObjectCount"); }
+	FVector& GrapHookDefaultOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterCharacter.GrapHookDefaultOffset")>(this, "AShooterCharacter.GrapHookDefaultOffset"); }
+	float& GrapHookCableWidthField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.GrapHookCableWidth")>(this, "AShooterCharacter.GrapHookCableWidth"); }
+	UMaterialInterface * GrapHookMaterialField() { return *GetNativePointerField<UMaterialInterface **, API::FieldNameHash("AShooterCharacter.GrapHookMaterial")>(this, "AShooterCharacter.GrapHookMaterial"); }
+	float& LadderLateralJumpVelocityField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.LadderLateralJumpVelocity")>(this, "AShooterCharacter.LadderLateralJumpVelocity"); }
+	float& GrapHookPulledRopeDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.GrapHookPulledRopeDistance")>(this, "AShooterCharacter.GrapHookPulledRopeDistance"); }
+	float& GrapHookSyncTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.GrapHookSyncTime")>(this, "AShooterCharacter.GrapHookSyncTime"); }
+	bool& bReleasingGrapHookField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterCharacter.bReleasingGrapHook")>(this, "AShooterCharacter.bReleasingGrapHook"); }
+	FString& PlatformProfileNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterCharacter.PlatformProfileName")>(this, "AShooterCharacter.PlatformProfileName"); }
+	FUniqueNetIdRepl& PlatformProfileIDField() { return *GetNativePointerField<FUniqueNetIdRepl*, API::FieldNameHash("AShooterCharacter.PlatformProfileID")>(this, "AShooterCharacter.PlatformProfileID"); }
+	UAudioComponent * CharacterStatusStateSoundComponentField() { return *GetNativePointerField<UAudioComponent **, API::FieldNameHash("AShooterCharacter.CharacterStatusStateSoundComponent")>(this, "AShooterCharacter.CharacterStatusStateSoundComponent"); }
+	long double& LastUncrouchTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastUncrouchTime")>(this, "AShooterCharacter.LastUncrouchTime"); }
+	long double& LastUnproneTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastUnproneTime")>(this, "AShooterCharacter.LastUnproneTime"); }
+	float& CurrentWeaponBobSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.CurrentWeaponBobSpeed")>(this, "AShooterCharacter.CurrentWeaponBobSpeed"); }
+	float& WalkBobOldSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.WalkBobOldSpeed")>(this, "AShooterCharacter.WalkBobOldSpeed"); }
+	float& AppliedBobField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.AppliedBob")>(this, "AShooterCharacter.AppliedBob"); }
+	float& BobTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.BobTime")>(this, "AShooterCharacter.BobTime"); }
+	long double& LastPressReloadTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastPressReloadTime")>(this, "AShooterCharacter.LastPressReloadTime"); }
+	FName& WeaponAttachPointField() { return *GetNativePointerField<FName*, API::FieldNameHash("AShooterCharacter.WeaponAttachPoint")>(this, "AShooterCharacter.WeaponAttachPoint"); }
+	float& TargetingSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.TargetingSpeedModifier")>(this, "AShooterCharacter.TargetingSpeedModifier"); }
+	USoundCue * LowHealthSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("AShooterCharacter.LowHealthSound")>(this, "AShooterCharacter.LowHealthSound"); }
+	UAnimMontage * CallFollowAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.CallFollowAnim")>(this, "AShooterCharacter.CallFollowAnim"); }
+	UAnimMontage * CallStayAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.CallStayAnim")>(this, "AShooterCharacter.CallStayAnim"); }
+	UAnimMontage * CallFollowAnimSingleField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.CallFollowAnimSingle")>(this, "AShooterCharacter.CallFollowAnimSingle"); }
+	UAnimMontage * CallStayAnimSingleField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.CallStayAnimSingle")>(this, "AShooterCharacter.CallStayAnimSingle"); }
+	UAnimMontage * CallMoveToAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.CallMoveToAnim")>(this, "AShooterCharacter.CallMoveToAnim"); }
+	UAnimMontage * CallAttackAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.CallAttackAnim")>(this, "AShooterCharacter.CallAttackAnim"); }
+	UAudioComponent * LowHealthWarningPlayerField() { return *GetNativePointerField<UAudioComponent **, API::FieldNameHash("AShooterCharacter.LowHealthWarningPlayer")>(this, "AShooterCharacter.LowHealthWarningPlayer"); }
+	FItemNetID& NextWeaponItemIDField() { return *GetNativePointerField<FItemNetID*, API::FieldNameHash("AShooterCharacter.NextWeaponItemID")>(this, "AShooterCharacter.NextWeaponItemID"); }
+	float& WeaponBobTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.WeaponBobTime")>(this, "AShooterCharacter.WeaponBobTime"); }
+	float& CurrentAimBlendingField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.CurrentAimBlending")>(this, "AShooterCharacter.CurrentAimBlending"); }
+	long double& InterpLastCrouchProneStateChangeTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.InterpLastCrouchProneStateChangeTime")>(this, "AShooterCharacter.InterpLastCrouchProneStateChangeTime"); }
+	long double& PressCrouchProneToggleTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.PressCrouchProneToggleTime")>(this, "AShooterCharacter.PressCrouchProneToggleTime"); }
+	float& CraftingMovementSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.CraftingMovementSpeedModifier")>(this, "AShooterCharacter.CraftingMovementSpeedModifier"); }
+	FVector& WeaponBobMagnitudesField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterCharacter.WeaponBobMagnitudes")>(this, "AShooterCharacter.WeaponBobMagnitudes"); }
+	FVector& WeaponBobPeriodsField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterCharacter.WeaponBobPeriods")>(this, "AShooterCharacter.WeaponBobPeriods"); }
+	FVector& WeaponBobOffsetsField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterCharacter.WeaponBobOffsets")>(this, "AShooterCharacter.WeaponBobOffsets"); }
+	FVector& WeaponBobMagnitudes_TargetingField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterCharacter.WeaponBobMagnitudes_Targeting")>(this, "AShooterCharacter.WeaponBobMagnitudes_Targeting"); }
+	FVector& WeaponBobPeriods_TargetingField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterCharacter.WeaponBobPeriods_Targeting")>(this, "AShooterCharacter.WeaponBobPeriods_Targeting"); }
+	FVector& WeaponBobOffsets_TargetingField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterCharacter.WeaponBobOffsets_Targeting")>(this, "AShooterCharacter.WeaponBobOffsets_Targeting"); }
+	float& WeaponBobMinimumSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.WeaponBobMinimumSpeed")>(this, "AShooterCharacter.WeaponBobMinimumSpeed"); }
+	float& WeaponBobSpeedBaseField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.WeaponBobSpeedBase")>(this, "AShooterCharacter.WeaponBobSpeedBase"); }
+	float& WeaponBobSpeedBaseFallingField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.WeaponBobSpeedBaseFalling")>(this, "AShooterCharacter.WeaponBobSpeedBaseFalling"); }
+	float& WeaponBobTargetingBlendField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.WeaponBobTargetingBlend")>(this, "AShooterCharacter.WeaponBobTargetingBlend"); }
+	TArray<FItemAttachmentInfo>& DefaultAttachmentInfosField() { return *GetNativePointerField<TArray<FItemAttachmentInfo>*, API::FieldNameHash("AShooterCharacter.DefaultAttachmentInfos")>(this, "AShooterCharacter.DefaultAttachmentInfos"); }
+	USoundCue * StartCrouchSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("AShooterCharacter.StartCrouchSound")>(this, "AShooterCharacter.StartCrouchSound"); }
+	USoundCue * EndCrouchSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("AShooterCharacter.EndCrouchSound")>(this, "AShooterCharacter.EndCrouchSound"); }
+	USoundCue * StartProneSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("AShooterCharacter.StartProneSound")>(this, "AShooterCharacter.StartProneSound"); }
+	USoundCue * EndProneSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("AShooterCharacter.EndProneSound")>(this, "AShooterCharacter.EndProneSound"); }
+	TSubclassOf<AShooterWeapon>& NextInventoryWeaponField() { return *GetNativePointerField<TSubclassOf<AShooterWeapon>*, API::FieldNameHash("AShooterCharacter.NextInventoryWeapon")>(this, "AShooterCharacter.NextInventoryWeapon"); }
+	FItemNetID& PreMapWeaponItemNetIDField() { return *GetNativePointerField<FItemNetID*, API::FieldNameHash("AShooterCharacter.PreMapWeaponItemNetID")>(this, "AShooterCharacter.PreMapWeaponItemNetID"); }
+	float& ServerSeatedViewRotationYawField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.ServerSeatedViewRotationYaw")>(this, "AShooterCharacter.ServerSeatedViewRotationYaw"); }
+	float& ServerSeatedViewRotationPitchField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.ServerSeatedViewRotationPitch")>(this, "AShooterCharacter.ServerSeatedViewRotationPitch"); }
+	AShooterWeapon * CurrentWeaponField() { return *GetNativePointerField<AShooterWeapon **, API::FieldNameHash("AShooterCharacter.CurrentWeapon")>(this, "AShooterCharacter.CurrentWeapon"); }
+	unsigned __int64& LinkedPlayerDataIDField() { return *GetNativePointerField<unsigned __int64*, API::FieldNameHash("AShooterCharacter.LinkedPlayerDataID")>(this, "AShooterCharacter.LinkedPlayerDataID"); }
+	long double& LastTimeInFallingField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastTimeInFalling")>(this, "AShooterCharacter.LastTimeInFalling"); }
+	long double& StartedRidingTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.StartedRidingTime")>(this, "AShooterCharacter.StartedRidingTime"); }
+	long double& TimeSinceLastControllerField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.TimeSinceLastController")>(this, "AShooterCharacter.TimeSinceLastController"); }
+	TWeakObjectPtr<AController>& LastControllerField() { return *GetNativePointerField<TWeakObjectPtr<AController>*, API::FieldNameHash("AShooterCharacter.LastController")>(this, "AShooterCharacter.LastController"); }
+	TWeakObjectPtr<AShooterPlayerController>& LastValidPlayerControllerField() { return *GetNativePointerField<TWeakObjectPtr<AShooterPlayerController>*, API::FieldNameHash("AShooterCharacter.LastValidPlayerController")>(this, "AShooterCharacter.LastValidPlayerController"); }
+	UAnimMontage * DrinkingAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.DrinkingAnimation")>(this, "AShooterCharacter.DrinkingAnimation"); }
+	long double& LastRequestedTribeTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastRequestedTribeTime")>(this, "AShooterCharacter.LastRequestedTribeTime"); }
+	unsigned __int64& LastRequestedTribeIDField() { return *GetNativePointerField<unsigned __int64*, API::FieldNameHash("AShooterCharacter.LastRequestedTribeID")>(this, "AShooterCharacter.LastRequestedTribeID"); }
+	FString& LastRequestedTribeNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterCharacter.LastRequestedTribeName")>(this, "AShooterCharacter.LastRequestedTribeName"); }
+	TWeakObjectPtr<AShooterCharacter>& LastRequestedTribePlayerCharacterField() { return *GetNativePointerField<TWeakObjectPtr<AShooterCharacter>*, API::FieldNameHash("AShooterCharacter.LastRequestedTribePlayerCharacter")>(this, "AShooterCharacter.LastRequestedTribePlayerCharacter"); }
+	float& IndoorsHyperthermiaInsulationField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.IndoorsHyperthermiaInsulation")>(this, "AShooterCharacter.IndoorsHyperthermiaInsulation"); }
+	float& IndoorsHypothermiaInsulationField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.IndoorsHypothermiaInsulation")>(this, "AShooterCharacter.IndoorsHypothermiaInsulation"); }
+	float& IndoorCheckIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.IndoorCheckInterval")>(this, "AShooterCharacter.IndoorCheckInterval"); }
+	long double& LastIndoorCheckTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastIndoorCheckTime")>(this, "AShooterCharacter.LastIndoorCheckTime"); }
+	FItemNetID& PreRidingWeaponItemNetIDField() { return *GetNativePointerField<FItemNetID*, API::FieldNameHash("AShooterCharacter.PreRidingWeaponItemNetID")>(this, "AShooterCharacter.PreRidingWeaponItemNetID"); }
+	FItemNetID& PreInventoryWeaponItemNetIDField() { return *GetNativePointerField<FItemNetID*, API::FieldNameHash("AShooterCharacter.PreInventoryWeaponItemNetID")>(this, "AShooterCharacter.PreInventoryWeaponItemNetID"); }
+	UAnimSequence * ViewingInventoryAnimationField() { return *GetNativePointerField<UAnimSequence **, API::FieldNameHash("AShooterCharacter.ViewingInventoryAnimation")>(this, "AShooterCharacter.ViewingInventoryAnimation"); }
+	UAnimSequence * DefaultDinoRidingAnimationField() { return *GetNativePointerField<UAnimSequence **, API::FieldNameHash("AShooterCharacter.DefaultDinoRidingAnimation")>(this, "AShooterCharacter.DefaultDinoRidingAnimation"); }
+	UAnimSequence * DefaultDinoRidingMoveAnimationField() { return *GetNativePointerField<UAnimSequence **, API::FieldNameHash("AShooterCharacter.DefaultDinoRidingMoveAnimation")>(this, "AShooterCharacter.DefaultDinoRidingMoveAnimation"); }
+	UAnimSequence * DefaultSeatingAnimationField() { return *GetNativePointerField<UAnimSequence **, API::FieldNameHash("AShooterCharacter.DefaultSeatingAnimation")>(this, "AShooterCharacter.DefaultSeatingAnimation"); }
+	UAnimSequence * DefaultShieldAnimationField() { return *GetNativePointerField<UAnimSequence **, API::FieldNameHash("AShooterCharacter.DefaultShieldAnimation")>(this, "AShooterCharacter.DefaultShieldAnimation"); }
+	UAnimMontage * ShieldCoverAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.ShieldCoverAnimation")>(this, "AShooterCharacter.ShieldCoverAnimation"); }
+	UAnimMontage * ShieldCoverAnimationForCrouchField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.ShieldCoverAnimationForCrouch")>(this, "AShooterCharacter.ShieldCoverAnimationForCrouch"); }
+	float& EnemyPlayerMaxCursorHUDDistanceProneField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.EnemyPlayerMaxCursorHUDDistanceProne")>(this, "AShooterCharacter.EnemyPlayerMaxCursorHUDDistanceProne"); }
+	float& EnemyPlayerMaxCursorHUDDistanceCrouchedField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.EnemyPlayerMaxCursorHUDDistanceCrouched")>(this, "AShooterCharacter.EnemyPlayerMaxCursorHUDDistanceCrouched"); }
+	float& EnemyPlayerMaxCursorHUDDistanceStandingField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.EnemyPlayerMaxCursorHUDDistanceStanding")>(this, "AShooterCharacter.EnemyPlayerMaxCursorHUDDistanceStanding"); }
+	FSaddlePassengerSeatDefinition& CurrentPassengerSeatDefinitionField() { return *GetNativePointerField<FSaddlePassengerSeatDefinition*, API::FieldNameHash("AShooterCharacter.CurrentPassengerSeatDefinition")>(this, "AShooterCharacter.CurrentPassengerSeatDefinition"); }
+	TArray<UAnimMontage *> AnimsOverrideFromField() { return *GetNativePointerField<TArray<UAnimMontage *>*, API::FieldNameHash("AShooterCharacter.AnimsOverrideFrom")>(this, "AShooterCharacter.AnimsOverrideFrom"); }
+	TArray<UAnimMontage *> AnimOverrideToField() { return *GetNativePointerField<TArray<UAnimMontage *>*, API::FieldNameHash("AShooterCharacter.AnimOverrideTo")>(this, "AShooterCharacter.AnimOverrideTo"); }
+	TArray<UAnimSequence *> AnimSequencesOverrideFromField() { return *GetNativePointerField<TArray<UAnimSequence *>*, API::FieldNameHash("AShooterCharacter.AnimSequencesOverrideFrom")>(this, "AShooterCharacter.AnimSequencesOverrideFrom"); }
+	TArray<UAnimSequence *> AnimSequenceOverrideToField() { return *GetNativePointerField<TArray<UAnimSequence *>*, API::FieldNameHash("AShooterCharacter.AnimSequenceOverrideTo")>(this, "AShooterCharacter.AnimSequenceOverrideTo"); }
+	float& PreviousRootYawSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.PreviousRootYawSpeed")>(this, "AShooterCharacter.PreviousRootYawSpeed"); }
 	FieldArray<FLinearColor, 4> BodyColorsField() { return { this, "AShooterCharacter.BodyColors" }; }
-	char& FacialHairIndexField() { return *GetNativePointerField<char*>(this, "AShooterCharacter.FacialHairIndex"); }
-	char& HeadHairIndexField() { return *GetNativePointerField<char*>(this, "AShooterCharacter.HeadHairIndex"); }
+	char& FacialHairIndexField() { return *GetNativePointerField<char*, API::FieldNameHash("AShooterCharacter.FacialHairIndex")>(this, "AShooterCharacter.FacialHairIndex"); }
+	char& HeadHairIndexField() { return *GetNativePointerField<char*, API::FieldNameHash("AShooterCharacter.HeadHairIndex")>(this, "AShooterCharacter.HeadHairIndex"); }
 	FieldArray<float, 22> RawBoneModifiersField() { return { this, "AShooterCharacter.RawBoneModifiers" }; }
-	float& LoggedOutTargetingDesirabilityField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.LoggedOutTargetingDesirability"); }
-	bool& bIsRainWateredField() { return *GetNativePointerField<bool*>(this, "AShooterCharacter.bIsRainWatered"); }
-	long double& LastAttackTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastAttackTime"); }
-	bool& bCacheRidingDinoWeaponField() { return *GetNativePointerField<bool*>(this, "AShooterCharacter.bCacheRidingDinoWeapon"); }
-	bool& bWasLocallyControlledField() { return *GetNativePointerField<bool*>(this, "AShooterCharacter.bWasLocallyControlled"); }
-	unsigned int& UniqueNetIdTypeHashField() { return *GetNativePointerField<unsigned int*>(this, "AShooterCharacter.UniqueNetIdTypeHash"); }
-	long double& LastUseHarvestTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastUseHarvestTime"); }
-	long double& StopRidingTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.StopRidingTime"); }
-	UAnimMontage * SpawnAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.SpawnAnim"); }
-	UAnimMontage * FirstSpawnAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.FirstSpawnAnim"); }
-	long double& LocalLastViewingInventoryTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LocalLastViewingInventoryTime"); }
-	FVector& LastStasisCastPositionField() { return *GetNativePointerField<FVector*>(this, "AShooterCharacter.LastStasisCastPosition"); }
-	bool& bWasHostPlayerField() { return *GetNativePointerField<bool*>(this, "AShooterCharacter.bWasHostPlayer"); }
-	long double& LastTimeHadControllerField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastTimeHadController"); }
-	long double& LastTaggedTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastTaggedTime"); }
-	long double& LastTaggedTimeExtraField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastTaggedTimeExtra"); }
-	long double& LastTaggedTimeThirdField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastTaggedTimeThird"); }
-	float& ExtraFloatVarField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.ExtraFloatVar"); }
-	FVector& ExtraVectorVarField() { return *GetNativePointerField<FVector*>(this, "AShooterCharacter.ExtraVectorVar"); }
-	FVector& ExtraExtraVectorVarField() { return *GetNativePointerField<FVector*>(this, "AShooterCharacter.ExtraExtraVectorVar"); }
-	FName& ExtraNameVarField() { return *GetNativePointerField<FName*>(this, "AShooterCharacter.ExtraNameVar"); }
-	bool& bIsOnSeatingStructureField() { return *GetNativePointerField<bool*>(this, "AShooterCharacter.bIsOnSeatingStructure"); }
-	bool& bIsControllingBallistaField() { return *GetNativePointerField<bool*>(this, "AShooterCharacter.bIsControllingBallista"); }
-	bool& bUseBallistaAimOffsetField() { return *GetNativePointerField<bool*>(this, "AShooterCharacter.bUseBallistaAimOffset"); }
-	float& CurrentControlledBallistaYawField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.CurrentControlledBallistaYaw"); }
-	bool& bIsServerAdminField() { return *GetNativePointerField<bool*>(this, "AShooterCharacter.bIsServerAdmin"); }
-	TWeakObjectPtr<APrimalStructureSeating>& SeatingStructureField() { return *GetNativePointerField<TWeakObjectPtr<APrimalStructureSeating>*>(this, "AShooterCharacter.SeatingStructure"); }
-	int& SeatingStructureSeatNumberField() { return *GetNativePointerField<int*>(this, "AShooterCharacter.SeatingStructureSeatNumber"); }
-	long double& NextPlayerUndergroundCheckField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.NextPlayerUndergroundCheck"); }
-	int& PlayerNumUnderGroundFailField() { return *GetNativePointerField<int*>(this, "AShooterCharacter.PlayerNumUnderGroundFail"); }
-	float& LastSweepCapsuleHeightField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.LastSweepCapsuleHeight"); }
-	float& LastSweepCapsuleRadiusField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.LastSweepCapsuleRadius"); }
-	USoundBase * ThrowCharacterSoundField() { return *GetNativePointerField<USoundBase **>(this, "AShooterCharacter.ThrowCharacterSound"); }
-	float& ClientSeatedViewRotationPitchField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.ClientSeatedViewRotationPitch"); }
-	float& ClientSeatedViewRotationYawField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.ClientSeatedViewRotationYaw"); }
-	long double& LastReleaseSeatingStructureTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastReleaseSeatingStructureTime"); }
-	char& PlayerBadgeGroupField() { return *GetNativePointerField<char*>(this, "AShooterCharacter.PlayerBadgeGroup"); }
-	bool& bShouldInvertTurnInputField() { return *GetNativePointerField<bool*>(this, "AShooterCharacter.bShouldInvertTurnInput"); }
-	TWeakObjectPtr<APrimalCharacter>& LastGrappledToCharacterField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*>(this, "AShooterCharacter.LastGrappledToCharacter"); }
-	TWeakObjectPtr<APrimalCharacter>& CurrentGrappledToCharacterField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*>(this, "AShooterCharacter.CurrentGrappledToCharacter"); }
-	int& AllianceInviteRequestingTeamField() { return *GetNativePointerField<int*>(this, "AShooterCharacter.AllianceInviteRequestingTeam"); }
-	unsigned int& AllianceInviteIDField() { return *GetNativePointerField<unsigned int*>(this, "AShooterCharacter.AllianceInviteID"); }
-	FString& AllianceInviteNameField() { return *GetNativePointerField<FString*>(this, "AShooterCharacter.AllianceInviteName"); }
-	long double& AllianceInviteTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.AllianceInviteTime"); }
-	float& InventoryDragWeightScaleField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.InventoryDragWeightScale"); }
-	UAnimMontage * MountedCarryingDinoAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.MountedCarryingDinoAnimation"); }
-	UAnimMontage * CuddleAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterCharacter.CuddleAnimation"); }
-	long double& LastUpdatedAimActorsTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastUpdatedAimActorsTime"); }
-	FVector& UpdateHyperThermalInsulationPositionField() { return *GetNativePointerField<FVector*>(this, "AShooterCharacter.UpdateHyperThermalInsulationPosition"); }
-	FVector& UpdateHypoThermalInsulationPositionField() { return *GetNativePointerField<FVector*>(this, "AShooterCharacter.UpdateHypoThermalInsulationPosition"); }
-	long double& NextUpdateHyperThermalInsulationTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.NextUpdateHyperThermalInsulationTime"); }
-	long double& NextUpdateHypoThermalInsulationTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.NextUpdateHypoThermalInsulationTime"); }
-	float& LastAdditionalHypoThermalInsulationField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.LastAdditionalHypoThermalInsulation"); }
-	float& LastAdditionalHyperThermalInsulationField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.LastAdditionalHyperThermalInsulation"); }
-	float& WaterLossRateMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.WaterLossRateMultiplier"); }
-	UAnimSequence * CharacterAdditiveStandingAnimField() { return *GetNativePointerField<UAnimSequence **>(this, "AShooterCharacter.CharacterAdditiveStandingAnim"); }
-	long double& LastTryAccessInventoryFailTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastTryAccessInventoryFailTime"); }
-	long double& LastEmotePlayTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastEmotePlayTime"); }
-	float& IntervalForFullHeadHairGrowthField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.IntervalForFullHeadHairGrowth"); }
-	float& IntervalForFullFacialHairGrowthField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.IntervalForFullFacialHairGrowth"); }
-	float& PercentOfFullFacialHairGrowthField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.PercentOfFullFacialHairGrowth"); }
-	float& PercentOfFullHeadHairGrowthField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.PercentOfFullHeadHairGrowth"); }
-	FLinearColor& OriginalHairColorField() { return *GetNativePointerField<FLinearColor*>(this, "AShooterCharacter.OriginalHairColor"); }
-	long double& LastEmoteTryPlayTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastEmoteTryPlayTime"); }
-	int& IgnoreCollisionSweepUntilFrameNumberField() { return *GetNativePointerField<int*>(this, "AShooterCharacter.IgnoreCollisionSweepUntilFrameNumber"); }
-	float& ReplicatedWeightField() { return *GetNativePointerField<float*>(this, "AShooterCharacter.ReplicatedWeight"); }
-	long double& LocalDiedAtTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LocalDiedAtTime"); }
-	long double& LastNotStuckTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastNotStuckTime"); }
-	USoundBase * ProneMoveSoundField() { return *GetNativePointerField<USoundBase **>(this, "AShooterCharacter.ProneMoveSound"); }
-	long double& UploadEarliestValidTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.UploadEarliestValidTime"); }
-	long double& LastCollisionStuckTimeField() { return *GetNativePointerField<long double*>(this, "AShooterCharacter.LastCollisionStuckTime"); }
-	int& SimulatedLastFrameProcessedForceUpdateAimedActorsField() { return *GetNativePointerField<int*>(this, "AShooterCharacter.SimulatedLastFrameProcessedForceUpdateAimedActors"); }
-	FVector& OriginalLastHitWallSweepCheckLocationField() { return *GetNativePointerField<FVector*>(this, "AShooterCharacter.OriginalLastHitWallSweepCheckLocation"); }
-	int& LastCapsuleAttachmentChangedIncrementField() { return *GetNativePointerField<int*>(this, "AShooterCharacter.LastCapsuleAttachmentChangedIncrement"); }
-	int& LastMeshAttachmentChangedIncrementField() { return *GetNativePointerField<int*>(this, "AShooterCharacter.LastMeshAttachmentChangedIncrement"); }
-	int& LastCameraAttachmentChangedIncrementField() { return *GetNativePointerField<int*>(this, "AShooterCharacter.LastCameraAttachmentChangedIncrement"); }
-	bool& bPreventWeaponMovementAnimsField() { return *GetNativePointerField<bool*>(this, "AShooterCharacter.bPreventWeaponMovementAnims"); }
-	TEnumAsByte<enum EPrimalStatsValueTypes::Type>& BestInstantShotResultField() { return *GetNativePointerField<TEnumAsByte<enum EPrimalStatsValueTypes::Type>*>(this, "AShooterCharacter.BestInstantShotResult"); }
-	TWeakObjectPtr<APrimalStructure>& CurrentItemBalloonField() { return *GetNativePointerField<TWeakObjectPtr<APrimalStructure>*>(this, "AShooterCharacter.CurrentItemBalloon"); }
+	float& LoggedOutTargetingDesirabilityField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.LoggedOutTargetingDesirability")>(this, "AShooterCharacter.LoggedOutTargetingDesirability"); }
+	bool& bIsRainWateredField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterCharacter.bIsRainWatered")>(this, "AShooterCharacter.bIsRainWatered"); }
+	long double& LastAttackTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastAttackTime")>(this, "AShooterCharacter.LastAttackTime"); }
+	bool& bCacheRidingDinoWeaponField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterCharacter.bCacheRidingDinoWeapon")>(this, "AShooterCharacter.bCacheRidingDinoWeapon"); }
+	bool& bWasLocallyControlledField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterCharacter.bWasLocallyControlled")>(this, "AShooterCharacter.bWasLocallyControlled"); }
+	unsigned int& UniqueNetIdTypeHashField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("AShooterCharacter.UniqueNetIdTypeHash")>(this, "AShooterCharacter.UniqueNetIdTypeHash"); }
+	long double& LastUseHarvestTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastUseHarvestTime")>(this, "AShooterCharacter.LastUseHarvestTime"); }
+	long double& StopRidingTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.StopRidingTime")>(this, "AShooterCharacter.StopRidingTime"); }
+	UAnimMontage * SpawnAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.SpawnAnim")>(this, "AShooterCharacter.SpawnAnim"); }
+	UAnimMontage * FirstSpawnAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.FirstSpawnAnim")>(this, "AShooterCharacter.FirstSpawnAnim"); }
+	long double& LocalLastViewingInventoryTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LocalLastViewingInventoryTime")>(this, "AShooterCharacter.LocalLastViewingInventoryTime"); }
+	FVector& LastStasisCastPositionField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterCharacter.LastStasisCastPosition")>(this, "AShooterCharacter.LastStasisCastPosition"); }
+	bool& bWasHostPlayerField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterCharacter.bWasHostPlayer")>(this, "AShooterCharacter.bWasHostPlayer"); }
+	long double& LastTimeHadControllerField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastTimeHadController")>(this, "AShooterCharacter.LastTimeHadController"); }
+	long double& LastTaggedTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastTaggedTime")>(this, "AShooterCharacter.LastTaggedTime"); }
+	long double& LastTaggedTimeExtraField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastTaggedTimeExtra")>(this, "AShooterCharacter.LastTaggedTimeExtra"); }
+	long double& LastTaggedTimeThirdField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastTaggedTimeThird")>(this, "AShooterCharacter.LastTaggedTimeThird"); }
+	float& ExtraFloatVarField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.ExtraFloatVar")>(this, "AShooterCharacter.ExtraFloatVar"); }
+	FVector& ExtraVectorVarField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterCharacter.ExtraVectorVar")>(this, "AShooterCharacter.ExtraVectorVar"); }
+	FVector& ExtraExtraVectorVarField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterCharacter.ExtraExtraVectorVar")>(this, "AShooterCharacter.ExtraExtraVectorVar"); }
+	FName& ExtraNameVarField() { return *GetNativePointerField<FName*, API::FieldNameHash("AShooterCharacter.ExtraNameVar")>(this, "AShooterCharacter.ExtraNameVar"); }
+	bool& bIsOnSeatingStructureField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterCharacter.bIsOnSeatingStructure")>(this, "AShooterCharacter.bIsOnSeatingStructure"); }
+	bool& bIsControllingBallistaField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterCharacter.bIsControllingBallista")>(this, "AShooterCharacter.bIsControllingBallista"); }
+	bool& bUseBallistaAimOffsetField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterCharacter.bUseBallistaAimOffset")>(this, "AShooterCharacter.bUseBallistaAimOffset"); }
+	float& CurrentControlledBallistaYawField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.CurrentControlledBallistaYaw")>(this, "AShooterCharacter.CurrentControlledBallistaYaw"); }
+	bool& bIsServerAdminField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterCharacter.bIsServerAdmin")>(this, "AShooterCharacter.bIsServerAdmin"); }
+	TWeakObjectPtr<APrimalStructureSeating>& SeatingStructureField() { return *GetNativePointerField<TWeakObjectPtr<APrimalStructureSeating>*, API::FieldNameHash("AShooterCharacter.SeatingStructure")>(this, "AShooterCharacter.SeatingStructure"); }
+	int& SeatingStructureSeatNumberField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterCharacter.SeatingStructureSeatNumber")>(this, "AShooterCharacter.SeatingStructureSeatNumber"); }
+	long double& NextPlayerUndergroundCheckField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.NextPlayerUndergroundCheck")>(this, "AShooterCharacter.NextPlayerUndergroundCheck"); }
+	int& PlayerNumUnderGroundFailField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterCharacter.PlayerNumUnderGroundFail")>(this, "AShooterCharacter.PlayerNumUnderGroundFail"); }
+	float& LastSweepCapsuleHeightField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.LastSweepCapsuleHeight")>(this, "AShooterCharacter.LastSweepCapsuleHeight"); }
+	float& LastSweepCapsuleRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.LastSweepCapsuleRadius")>(this, "AShooterCharacter.LastSweepCapsuleRadius"); }
+	USoundBase * ThrowCharacterSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("AShooterCharacter.ThrowCharacterSound")>(this, "AShooterCharacter.ThrowCharacterSound"); }
+	float& ClientSeatedViewRotationPitchField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.ClientSeatedViewRotationPitch")>(this, "AShooterCharacter.ClientSeatedViewRotationPitch"); }
+	float& ClientSeatedViewRotationYawField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.ClientSeatedViewRotationYaw")>(this, "AShooterCharacter.ClientSeatedViewRotationYaw"); }
+	long double& LastReleaseSeatingStructureTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastReleaseSeatingStructureTime")>(this, "AShooterCharacter.LastReleaseSeatingStructureTime"); }
+	char& PlayerBadgeGroupField() { return *GetNativePointerField<char*, API::FieldNameHash("AShooterCharacter.PlayerBadgeGroup")>(this, "AShooterCharacter.PlayerBadgeGroup"); }
+	bool& bShouldInvertTurnInputField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterCharacter.bShouldInvertTurnInput")>(this, "AShooterCharacter.bShouldInvertTurnInput"); }
+	TWeakObjectPtr<APrimalCharacter>& LastGrappledToCharacterField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*, API::FieldNameHash("AShooterCharacter.LastGrappledToCharacter")>(this, "AShooterCharacter.LastGrappledToCharacter"); }
+	TWeakObjectPtr<APrimalCharacter>& CurrentGrappledToCharacterField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*, API::FieldNameHash("AShooterCharacter.CurrentGrappledToCharacter")>(this, "AShooterCharacter.CurrentGrappledToCharacter"); }
+	int& AllianceInviteRequestingTeamField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterCharacter.AllianceInviteRequestingTeam")>(this, "AShooterCharacter.AllianceInviteRequestingTeam"); }
+	unsigned int& AllianceInviteIDField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("AShooterCharacter.AllianceInviteID")>(this, "AShooterCharacter.AllianceInviteID"); }
+	FString& AllianceInviteNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterCharacter.AllianceInviteName")>(this, "AShooterCharacter.AllianceInviteName"); }
+	long double& AllianceInviteTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.AllianceInviteTime")>(this, "AShooterCharacter.AllianceInviteTime"); }
+	float& InventoryDragWeightScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.InventoryDragWeightScale")>(this, "AShooterCharacter.InventoryDragWeightScale"); }
+	UAnimMontage * MountedCarryingDinoAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.MountedCarryingDinoAnimation")>(this, "AShooterCharacter.MountedCarryingDinoAnimation"); }
+	UAnimMontage * CuddleAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterCharacter.CuddleAnimation")>(this, "AShooterCharacter.CuddleAnimation"); }
+	long double& LastUpdatedAimActorsTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastUpdatedAimActorsTime")>(this, "AShooterCharacter.LastUpdatedAimActorsTime"); }
+	FVector& UpdateHyperThermalInsulationPositionField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterCharacter.UpdateHyperThermalInsulationPosition")>(this, "AShooterCharacter.UpdateHyperThermalInsulationPosition"); }
+	FVector& UpdateHypoThermalInsulationPositionField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterCharacter.UpdateHypoThermalInsulationPosition")>(this, "AShooterCharacter.UpdateHypoThermalInsulationPosition"); }
+	long double& NextUpdateHyperThermalInsulationTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.NextUpdateHyperThermalInsulationTime")>(this, "AShooterCharacter.NextUpdateHyperThermalInsulationTime"); }
+	long double& NextUpdateHypoThermalInsulationTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.NextUpdateHypoThermalInsulationTime")>(this, "AShooterCharacter.NextUpdateHypoThermalInsulationTime"); }
+	float& LastAdditionalHypoThermalInsulationField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.LastAdditionalHypoThermalInsulation")>(this, "AShooterCharacter.LastAdditionalHypoThermalInsulation"); }
+	float& LastAdditionalHyperThermalInsulationField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.LastAdditionalHyperThermalInsulation")>(this, "AShooterCharacter.LastAdditionalHyperThermalInsulation"); }
+	float& WaterLossRateMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.WaterLossRateMultiplier")>(this, "AShooterCharacter.WaterLossRateMultiplier"); }
+	UAnimSequence * CharacterAdditiveStandingAnimField() { return *GetNativePointerField<UAnimSequence **, API::FieldNameHash("AShooterCharacter.CharacterAdditiveStandingAnim")>(this, "AShooterCharacter.CharacterAdditiveStandingAnim"); }
+	long double& LastTryAccessInventoryFailTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastTryAccessInventoryFailTime")>(this, "AShooterCharacter.LastTryAccessInventoryFailTime"); }
+	long double& LastEmotePlayTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastEmotePlayTime")>(this, "AShooterCharacter.LastEmotePlayTime"); }
+	float& IntervalForFullHeadHairGrowthField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.IntervalForFullHeadHairGrowth")>(this, "AShooterCharacter.IntervalForFullHeadHairGrowth"); }
+	float& IntervalForFullFacialHairGrowthField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.IntervalForFullFacialHairGrowth")>(this, "AShooterCharacter.IntervalForFullFacialHairGrowth"); }
+	float& PercentOfFullFacialHairGrowthField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.PercentOfFullFacialHairGrowth")>(this, "AShooterCharacter.PercentOfFullFacialHairGrowth"); }
+	float& PercentOfFullHeadHairGrowthField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.PercentOfFullHeadHairGrowth")>(this, "AShooterCharacter.PercentOfFullHeadHairGrowth"); }
+	FLinearColor& OriginalHairColorField() { return *GetNativePointerField<FLinearColor*, API::FieldNameHash("AShooterCharacter.OriginalHairColor")>(this, "AShooterCharacter.OriginalHairColor"); }
+	long double& LastEmoteTryPlayTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastEmoteTryPlayTime")>(this, "AShooterCharacter.LastEmoteTryPlayTime"); }
+	int& IgnoreCollisionSweepUntilFrameNumberField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterCharacter.IgnoreCollisionSweepUntilFrameNumber")>(this, "AShooterCharacter.IgnoreCollisionSweepUntilFrameNumber"); }
+	float& ReplicatedWeightField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterCharacter.ReplicatedWeight")>(this, "AShooterCharacter.ReplicatedWeight"); }
+	long double& LocalDiedAtTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LocalDiedAtTime")>(this, "AShooterCharacter.LocalDiedAtTime"); }
+	long double& LastNotStuckTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastNotStuckTime")>(this, "AShooterCharacter.LastNotStuckTime"); }
+	USoundBase * ProneMoveSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("AShooterCharacter.ProneMoveSound")>(this, "AShooterCharacter.ProneMoveSound"); }
+	long double& UploadEarliestValidTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.UploadEarliestValidTime")>(this, "AShooterCharacter.UploadEarliestValidTime"); }
+	long double& LastCollisionStuckTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterCharacter.LastCollisionStuckTime")>(this, "AShooterCharacter.LastCollisionStuckTime"); }
+	int& SimulatedLastFrameProcessedForceUpdateAimedActorsField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterCharacter.SimulatedLastFrameProcessedForceUpdateAimedActors")>(this, "AShooterCharacter.SimulatedLastFrameProcessedForceUpdateAimedActors"); }
+	FVector& OriginalLastHitWallSweepCheckLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterCharacter.OriginalLastHitWallSweepCheckLocation")>(this, "AShooterCharacter.OriginalLastHitWallSweepCheckLocation"); }
+	int& LastCapsuleAttachmentChangedIncrementField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterCharacter.LastCapsuleAttachmentChangedIncrement")>(this, "AShooterCharacter.LastCapsuleAttachmentChangedIncrement"); }
+	int& LastMeshAttachmentChangedIncrementField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterCharacter.LastMeshAttachmentChangedIncrement")>(this, "AShooterCharacter.LastMeshAttachmentChangedIncrement"); }
+	int& LastCameraAttachmentChangedIncrementField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterCharacter.LastCameraAttachmentChangedIncrement")>(this, "AShooterCharacter.LastCameraAttachmentChangedIncrement"); }
+	bool& bPreventWeaponMovementAnimsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterCharacter.bPreventWeaponMovementAnims")>(this, "AShooterCharacter.bPreventWeaponMovementAnims"); }
+	TEnumAsByte<enum EPrimalStatsValueTypes::Type>& BestInstantShotResultField() { return *GetNativePointerField<TEnumAsByte<enum EPrimalStatsValueTypes::Type>*, API::FieldNameHash("AShooterCharacter.BestInstantShotResult")>(this, "AShooterCharacter.BestInstantShotResult"); }
+	TWeakObjectPtr<APrimalStructure>& CurrentItemBalloonField() { return *GetNativePointerField<TWeakObjectPtr<APrimalStructure>*, API::FieldNameHash("AShooterCharacter.CurrentItemBalloon")>(this, "AShooterCharacter.CurrentItemBalloon"); }
 
 	// Bit fields
 
@@ -3851,23 +3851,23 @@ struct AShooterCharacter : APrimalCharacter
 
 struct FPrimalPersistentCharacterStatsStruct
 {
-	unsigned __int16& CharacterStatusComponent_ExtraCharacterLevelField() { return *GetNativePointerField<unsigned __int16*>(this, "FPrimalPersistentCharacterStatsStruct.CharacterStatusComponent_ExtraCharacterLevel"); }
-	float& CharacterStatusComponent_ExperiencePointsField() { return *GetNativePointerField<float*>(this, "FPrimalPersistentCharacterStatsStruct.CharacterStatusComponent_ExperiencePoints"); }
-	int& PlayerState_TotalEngramPointsField() { return *GetNativePointerField<int*>(this, "FPrimalPersistentCharacterStatsStruct.PlayerState_TotalEngramPoints"); }
-	int& CharacterStatusComponent_HighestExtraCharacterLevelField() { return *GetNativePointerField<int*>(this, "FPrimalPersistentCharacterStatsStruct.CharacterStatusComponent_HighestExtraCharacterLevel"); }
-	int& CharacterStatusComponent_LastRespecAtExtraCharacterLevelField() { return *GetNativePointerField<int*>(this, "FPrimalPersistentCharacterStatsStruct.CharacterStatusComponent_LastRespecAtExtraCharacterLevel"); }
-	TArray<unsigned int>& PerMapExplorerNoteUnlocksField() { return *GetNativePointerField<TArray<unsigned int>*>(this, "FPrimalPersistentCharacterStatsStruct.PerMapExplorerNoteUnlocks"); }
-	TArray<FName>& EmoteUnlocksField() { return *GetNativePointerField<TArray<FName>*>(this, "FPrimalPersistentCharacterStatsStruct.EmoteUnlocks"); }
-	TArray<TSubclassOf<UPrimalItem>>& PlayerState_EngramBlueprintsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "FPrimalPersistentCharacterStatsStruct.PlayerState_EngramBlueprints"); }
+	unsigned __int16& CharacterStatusComponent_ExtraCharacterLevelField() { return *GetNativePointerField<unsigned __int16*, API::FieldNameHash("FPrimalPersistentCharacterStatsStruct.CharacterStatusComponent_ExtraCharacterLevel")>(this, "FPrimalPersistentCharacterStatsStruct.CharacterStatusComponent_ExtraCharacterLevel"); }
+	float& CharacterStatusComponent_ExperiencePointsField() { return *GetNativePointerField<float*, API::FieldNameHash("FPrimalPersistentCharacterStatsStruct.CharacterStatusComponent_ExperiencePoints")>(this, "FPrimalPersistentCharacterStatsStruct.CharacterStatusComponent_ExperiencePoints"); }
+	int& PlayerState_TotalEngramPointsField() { return *GetNativePointerField<int*, API::FieldNameHash("FPrimalPersistentCharacterStatsStruct.PlayerState_TotalEngramPoints")>(this, "FPrimalPersistentCharacterStatsStruct.PlayerState_TotalEngramPoints"); }
+	int& CharacterStatusComponent_HighestExtraCharacterLevelField() { return *GetNativePointerField<int*, API::FieldNameHash("FPrimalPersistentCharacterStatsStruct.CharacterStatusComponent_HighestExtraCharacterLevel")>(this, "FPrimalPersistentCharacterStatsStruct.CharacterStatusComponent_HighestExtraCharacterLevel"); }
+	int& CharacterStatusComponent_LastRespecAtExtraCharacterLevelField() { return *GetNativePointerField<int*, API::FieldNameHash("FPrimalPersistentCharacterStatsStruct.CharacterStatusComponent_LastRespecAtExtraCharacterLevel")>(this, "FPrimalPersistentCharacterStatsStruct.CharacterStatusComponent_LastRespecAtExtraCharacterLevel"); }
+	TArray<unsigned int>& PerMapExplorerNoteUnlocksField() { return *GetNativePointerField<TArray<unsigned int>*, API::FieldNameHash("FPrimalPersistentCharacterStatsStruct.PerMapExplorerNoteUnlocks")>(this, "FPrimalPersistentCharacterStatsStruct.PerMapExplorerNoteUnlocks"); }
+	TArray<FName>& EmoteUnlocksField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("FPrimalPersistentCharacterStatsStruct.EmoteUnlocks")>(this, "FPrimalPersistentCharacterStatsStruct.EmoteUnlocks"); }
+	TArray<TSubclassOf<UPrimalItem>>& PlayerState_EngramBlueprintsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("FPrimalPersistentCharacterStatsStruct.PlayerState_EngramBlueprints")>(this, "FPrimalPersistentCharacterStatsStruct.PlayerState_EngramBlueprints"); }
 	FieldArray<char, 12> CharacterStatusComponent_NumberOfLevelUpPointsAppliedField() { return { this, "FPrimalPersistentCharacterStatsStruct.CharacterStatusComponent_NumberOfLevelUpPointsApplied" }; }
 	FieldArray<TSubclassOf<UPrimalItem>, 10> PlayerState_DefaultItemSlotClassesField() { return { this, "FPrimalPersistentCharacterStatsStruct.PlayerState_DefaultItemSlotClasses" }; }
 	FieldArray<char, 10> PlayerState_DefaultItemSlotEngramsField() { return { this, "FPrimalPersistentCharacterStatsStruct.PlayerState_DefaultItemSlotEngrams" }; }
 	FieldArray<FDinoOrderGroup, 10> DinoOrderGroupsField() { return { this, "FPrimalPersistentCharacterStatsStruct.DinoOrderGroups" }; }
-	int& CurrentlySelectedDinoOrderGroupField() { return *GetNativePointerField<int*>(this, "FPrimalPersistentCharacterStatsStruct.CurrentlySelectedDinoOrderGroup"); }
-	float& PercentageOfHeadHairGrowthField() { return *GetNativePointerField<float*>(this, "FPrimalPersistentCharacterStatsStruct.PercentageOfHeadHairGrowth"); }
-	float& PercentageOfFacialHairGrowthField() { return *GetNativePointerField<float*>(this, "FPrimalPersistentCharacterStatsStruct.PercentageOfFacialHairGrowth"); }
-	char& FacialHairIndexField() { return *GetNativePointerField<char*>(this, "FPrimalPersistentCharacterStatsStruct.FacialHairIndex"); }
-	char& HeadHairIndexField() { return *GetNativePointerField<char*>(this, "FPrimalPersistentCharacterStatsStruct.HeadHairIndex"); }
+	int& CurrentlySelectedDinoOrderGroupField() { return *GetNativePointerField<int*, API::FieldNameHash("FPrimalPersistentCharacterStatsStruct.CurrentlySelectedDinoOrderGroup")>(this, "FPrimalPersistentCharacterStatsStruct.CurrentlySelectedDinoOrderGroup"); }
+	float& PercentageOfHeadHairGrowthField() { return *GetNativePointerField<float*, API::FieldNameHash("FPrimalPersistentCharacterStatsStruct.PercentageOfHeadHairGrowth")>(this, "FPrimalPersistentCharacterStatsStruct.PercentageOfHeadHairGrowth"); }
+	float& PercentageOfFacialHairGrowthField() { return *GetNativePointerField<float*, API::FieldNameHash("FPrimalPersistentCharacterStatsStruct.PercentageOfFacialHairGrowth")>(this, "FPrimalPersistentCharacterStatsStruct.PercentageOfFacialHairGrowth"); }
+	char& FacialHairIndexField() { return *GetNativePointerField<char*, API::FieldNameHash("FPrimalPersistentCharacterStatsStruct.FacialHairIndex")>(this, "FPrimalPersistentCharacterStatsStruct.FacialHairIndex"); }
+	char& HeadHairIndexField() { return *GetNativePointerField<char*, API::FieldNameHash("FPrimalPersistentCharacterStatsStruct.HeadHairIndex")>(this, "FPrimalPersistentCharacterStatsStruct.HeadHairIndex"); }
 
 	// Functions
 
@@ -3880,26 +3880,26 @@ struct FPrimalPersistentCharacterStatsStruct
 
 struct FPrimalPlayerDataStruct
 {
-	unsigned __int64& PlayerDataIDField() { return *GetNativePointerField<unsigned __int64*>(this, "FPrimalPlayerDataStruct.PlayerDataID"); }
-	FUniqueNetIdRepl& UniqueIDField() { return *GetNativePointerField<FUniqueNetIdRepl*>(this, "FPrimalPlayerDataStruct.UniqueID"); }
-	FString& SavedNetworkAddressField() { return *GetNativePointerField<FString*>(this, "FPrimalPlayerDataStruct.SavedNetworkAddress"); }
-	FString& PlayerNameField() { return *GetNativePointerField<FString*>(this, "FPrimalPlayerDataStruct.PlayerName"); }
-	unsigned int& LocalPlayerIndexField() { return *GetNativePointerField<unsigned int*>(this, "FPrimalPlayerDataStruct.LocalPlayerIndex"); }
-	FPrimalPlayerCharacterConfigStruct& MyPlayerCharacterConfigField() { return *GetNativePointerField<FPrimalPlayerCharacterConfigStruct*>(this, "FPrimalPlayerDataStruct.MyPlayerCharacterConfig"); }
-	int& LastPinCodeUsedField() { return *GetNativePointerField<int*>(this, "FPrimalPlayerDataStruct.LastPinCodeUsed"); }
-	FPrimalPersistentCharacterStatsStruct * MyPersistentCharacterStatsField() { return GetNativePointerField<FPrimalPersistentCharacterStatsStruct *>(this, "FPrimalPlayerDataStruct.MyPersistentCharacterStats"); }
-	int& NumPersonalDinosField() { return *GetNativePointerField<int*>(this, "FPrimalPlayerDataStruct.NumPersonalDinos"); }
-	int& TribeIDField() { return *GetNativePointerField<int*>(this, "FPrimalPlayerDataStruct.TribeID"); }
-	TArray<int>& AppIDSetField() { return *GetNativePointerField<TArray<int>*>(this, "FPrimalPlayerDataStruct.AppIDSet"); }
-	int& PlayerDataVersionField() { return *GetNativePointerField<int*>(this, "FPrimalPlayerDataStruct.PlayerDataVersion"); }
-	long double& NextAllowedRespawnTimeField() { return *GetNativePointerField<long double*>(this, "FPrimalPlayerDataStruct.NextAllowedRespawnTime"); }
-	long double& LastTimeDiedToEnemyTeamField() { return *GetNativePointerField<long double*>(this, "FPrimalPlayerDataStruct.LastTimeDiedToEnemyTeam"); }
-	long double& LoginTimeField() { return *GetNativePointerField<long double*>(this, "FPrimalPlayerDataStruct.LoginTime"); }
-	long double& LastLoginTimeField() { return *GetNativePointerField<long double*>(this, "FPrimalPlayerDataStruct.LastLoginTime"); }
-	float& AllowedRespawnIntervalField() { return *GetNativePointerField<float*>(this, "FPrimalPlayerDataStruct.AllowedRespawnInterval"); }
-	float& NumOfDeathsField() { return *GetNativePointerField<float*>(this, "FPrimalPlayerDataStruct.NumOfDeaths"); }
-	int& SpawnDayNumberField() { return *GetNativePointerField<int*>(this, "FPrimalPlayerDataStruct.SpawnDayNumber"); }
-	float& SpawnDayTimeField() { return *GetNativePointerField<float*>(this, "FPrimalPlayerDataStruct.SpawnDayTime"); }
+	unsigned __int64& PlayerDataIDField() { return *GetNativePointerField<unsigned __int64*, API::FieldNameHash("FPrimalPlayerDataStruct.PlayerDataID")>(this, "FPrimalPlayerDataStruct.PlayerDataID"); }
+	FUniqueNetIdRepl& UniqueIDField() { return *GetNativePointerField<FUniqueNetIdRepl*, API::FieldNameHash("FPrimalPlayerDataStruct.UniqueID")>(this, "FPrimalPlayerDataStruct.UniqueID"); }
+	FString& SavedNetworkAddressField() { return *GetNativePointerField<FString*, API::FieldNameHash("FPrimalPlayerDataStruct.SavedNetworkAddress")>(this, "FPrimalPlayerDataStruct.SavedNetworkAddress"); }
+	FString& PlayerNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("FPrimalPlayerDataStruct.PlayerName")>(this, "FPrimalPlayerDataStruct.PlayerName"); }
+	unsigned int& LocalPlayerIndexField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("FPrimalPlayerDataStruct.LocalPlayerIndex")>(this, "FPrimalPlayerDataStruct.LocalPlayerIndex"); }
+	FPrimalPlayerCharacterConfigStruct& MyPlayerCharacterConfigField() { return *GetNativePointerField<FPrimalPlayerCharacterConfigStruct*, API::FieldNameHash("FPrimalPlayerDataStruct.MyPlayerCharacterConfig")>(this, "FPrimalPlayerDataStruct.MyPlayerCharacterConfig"); }
+	int& LastPinCodeUsedField() { return *GetNativePointerField<int*, API::FieldNameHash("FPrimalPlayerDataStruct.LastPinCodeUsed")>(this, "FPrimalPlayerDataStruct.LastPinCodeUsed"); }
+	FPrimalPersistentCharacterStatsStruct * MyPersistentCharacterStatsField() { return GetNativePointerField<FPrimalPersistentCharacterStatsStruct *, API::FieldNameHash("FPrimalPlayerDataStruct.MyPersistentCharacterStats")>(this, "FPrimalPlayerDataStruct.MyPersistentCharacterStats"); }
+	int& NumPersonalDinosField() { return *GetNativePointerField<int*, API::FieldNameHash("FPrimalPlayerDataStruct.NumPersonalDinos")>(this, "FPrimalPlayerDataStruct.NumPersonalDinos"); }
+	int& TribeIDField() { return *GetNativePointerField<int*, API::FieldNameHash("FPrimalPlayerDataStruct.TribeID")>(this, "FPrimalPlayerDataStruct.TribeID"); }
+	TArray<int>& AppIDSetField() { return *GetNativePointerField<TArray<int>*, API::FieldNameHash("FPrimalPlayerDataStruct.AppIDSet")>(this, "FPrimalPlayerDataStruct.AppIDSet"); }
+	int& PlayerDataVersionField() { return *GetNativePointerField<int*, API::FieldNameHash("FPrimalPlayerDataStruct.PlayerDataVersion")>(this, "FPrimalPlayerDataStruct.PlayerDataVersion"); }
+	long double& NextAllowedRespawnTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("FPrimalPlayerDataStruct.NextAllowedRespawnTime")>(this, "FPrimalPlayerDataStruct.NextAllowedRespawnTime"); }
+	long double& LastTimeDiedToEnemyTeamField() { return *GetNativePointerField<long double*, API::FieldNameHash("FPrimalPlayerDataStruct.LastTimeDiedToEnemyTeam")>(this, "FPrimalPlayerDataStruct.LastTimeDiedToEnemyTeam"); }
+	long double& LoginTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("FPrimalPlayerDataStruct.LoginTime")>(this, "FPrimalPlayerDataStruct.LoginTime"); }
+	long double& LastLoginTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("FPrimalPlayerDataStruct.LastLoginTime")>(this, "FPrimalPlayerDataStruct.LastLoginTime"); }
+	float& AllowedRespawnIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("FPrimalPlayerDataStruct.AllowedRespawnInterval")>(this, "FPrimalPlayerDataStruct.AllowedRespawnInterval"); }
+	float& NumOfDeathsField() { return *GetNativePointerField<float*, API::FieldNameHash("FPrimalPlayerDataStruct.NumOfDeaths")>(this, "FPrimalPlayerDataStruct.NumOfDeaths"); }
+	int& SpawnDayNumberField() { return *GetNativePointerField<int*, API::FieldNameHash("FPrimalPlayerDataStruct.SpawnDayNumber")>(this, "FPrimalPlayerDataStruct.SpawnDayNumber"); }
+	float& SpawnDayTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("FPrimalPlayerDataStruct.SpawnDayTime")>(this, "FPrimalPlayerDataStruct.SpawnDayTime"); }
 
 	// Bit fields
 
@@ -3914,10 +3914,10 @@ struct FPrimalPlayerDataStruct
 
 struct UPrimalPlayerData
 {
-	FPrimalPlayerDataStruct * MyDataField() { return GetNativePointerField<FPrimalPlayerDataStruct *>(this, "UPrimalPlayerData.MyData"); }
-	TArray<UPrimalBuffPersistentData *> MyPersistentBuffDatasField() { return *GetNativePointerField<TArray<UPrimalBuffPersistentData *>*>(this, "UPrimalPlayerData.MyPersistentBuffDatas"); }
-	bool& bIsLocalPlayerField() { return *GetNativePointerField<bool*>(this, "UPrimalPlayerData.bIsLocalPlayer"); }
-	float& LastXPWritePercentField() { return *GetNativePointerField<float*>(this, "UPrimalPlayerData.LastXPWritePercent"); }
+	FPrimalPlayerDataStruct * MyDataField() { return GetNativePointerField<FPrimalPlayerDataStruct *, API::FieldNameHash("UPrimalPlayerData.MyData")>(this, "UPrimalPlayerData.MyData"); }
+	TArray<UPrimalBuffPersistentData *> MyPersistentBuffDatasField() { return *GetNativePointerField<TArray<UPrimalBuffPersistentData *>*, API::FieldNameHash("UPrimalPlayerData.MyPersistentBuffDatas")>(this, "UPrimalPlayerData.MyPersistentBuffDatas"); }
+	bool& bIsLocalPlayerField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimalPlayerData.bIsLocalPlayer")>(this, "UPrimalPlayerData.bIsLocalPlayer"); }
+	float& LastXPWritePercentField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalPlayerData.LastXPWritePercent")>(this, "UPrimalPlayerData.LastXPWritePercent"); }
 
 	// Functions
 
@@ -3941,8 +3941,8 @@ struct UPrimalCharacterStatusComponent
 	FieldArray<float, 12> BaseLevelMaxStatusValuesField() { return { this, "UPrimalCharacterStatusComponent.BaseLevelMaxStatusValues" }; }
 	FieldArray<char, 12> NumberOfLevelUpPointsAppliedField() { return { this, "UPrimalCharacterStatusComponent.NumberOfLevelUpPointsApplied" }; }
 	FieldArray<char, 12> NumberOfLevelUpPointsAppliedTamedField() { return { this, "UPrimalCharacterStatusComponent.NumberOfLevelUpPointsAppliedTamed" }; }
-	float& TamedIneffectivenessModifierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.TamedIneffectivenessModifier"); }
-	float& MovingStaminaRecoveryRateMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.MovingStaminaRecoveryRateMultiplier"); }
+	float& TamedIneffectivenessModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.TamedIneffectivenessModifier")>(this, "UPrimalCharacterStatusComponent.TamedIneffectivenessModifier"); }
+	float& MovingStaminaRecoveryRateMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.MovingStaminaRecoveryRateMultiplier")>(this, "UPrimalCharacterStatusComponent.MovingStaminaRecoveryRateMultiplier"); }
 	FieldArray<float, 12> RecoveryRateStatusValueField() { return { this, "UPrimalCharacterStatusComponent.RecoveryRateStatusValue" }; }
 	FieldArray<float, 12> TimeToRecoverAfterDepletionStatusValueField() { return { this, "UPrimalCharacterStatusComponent.TimeToRecoverAfterDepletionStatusValue" }; }
 	FieldArray<float, 12> TimeToRecoverAfterDecreaseStatusValueField() { return { this, "UPrimalCharacterStatusComponent.TimeToRecoverAfterDecreaseStatusValue" }; }
@@ -3953,101 +3953,101 @@ struct UPrimalCharacterStatusComponent
 	FieldArray<float, 12> TamingMaxStatMultipliersField() { return { this, "UPrimalCharacterStatusComponent.TamingMaxStatMultipliers" }; }
 	FieldArray<float, 12> TamingMaxStatAdditionsField() { return { this, "UPrimalCharacterStatusComponent.TamingMaxStatAdditions" }; }
 	FieldArray<float, 12> MaxLevelUpMultiplierField() { return { this, "UPrimalCharacterStatusComponent.MaxLevelUpMultiplier" }; }
-	float& TamedLandDinoSwimSpeedLevelUpEffectivenessField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.TamedLandDinoSwimSpeedLevelUpEffectiveness"); }
-	float& TamingIneffectivenessMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.TamingIneffectivenessMultiplier"); }
-	float& DinoRiderWeightMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.DinoRiderWeightMultiplier"); }
+	float& TamedLandDinoSwimSpeedLevelUpEffectivenessField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.TamedLandDinoSwimSpeedLevelUpEffectiveness")>(this, "UPrimalCharacterStatusComponent.TamedLandDinoSwimSpeedLevelUpEffectiveness"); }
+	float& TamingIneffectivenessMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.TamingIneffectivenessMultiplier")>(this, "UPrimalCharacterStatusComponent.TamingIneffectivenessMultiplier"); }
+	float& DinoRiderWeightMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.DinoRiderWeightMultiplier")>(this, "UPrimalCharacterStatusComponent.DinoRiderWeightMultiplier"); }
 	FieldArray<char, 12> CanLevelUpValueField() { return { this, "UPrimalCharacterStatusComponent.CanLevelUpValue" }; }
 	FieldArray<char, 12> DontUseValueField() { return { this, "UPrimalCharacterStatusComponent.DontUseValue" }; }
-	float& ExperienceAutomaticConsciousIncreaseSpeedField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.ExperienceAutomaticConsciousIncreaseSpeed"); }
-	float& CheatMaxWeightField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.CheatMaxWeight"); }
-	int& CharacterStatusComponentPriorityField() { return *GetNativePointerField<int*>(this, "UPrimalCharacterStatusComponent.CharacterStatusComponentPriority"); }
-	float& SuffocationHealthPercentDecreaseSpeedField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.SuffocationHealthPercentDecreaseSpeed"); }
-	float& UnsubmergedOxygenIncreaseSpeedField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.UnsubmergedOxygenIncreaseSpeed"); }
-	float& SubmergedOxygenDecreaseSpeedField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.SubmergedOxygenDecreaseSpeed"); }
-	float& RunningStaminaConsumptionRateField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.RunningStaminaConsumptionRate"); }
-	float& WalkingStaminaConsumptionRateField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.WalkingStaminaConsumptionRate"); }
-	float& SwimmingOrFlyingStaminaConsumptionRateField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.SwimmingOrFlyingStaminaConsumptionRate"); }
-	float& JumpStaminaConsumptionField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.JumpStaminaConsumption"); }
-	float& WindedSpeedModifierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.WindedSpeedModifier"); }
-	float& WindedSpeedModifierSwimmingOrFlyingField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.WindedSpeedModifierSwimmingOrFlying"); }
-	float& InjuredSpeedModifierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.InjuredSpeedModifier"); }
-	float& HypothermicHealthDecreaseRateBaseField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.HypothermicHealthDecreaseRateBase"); }
-	float& HypothermicHealthDecreaseRatePerDegreeField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.HypothermicHealthDecreaseRatePerDegree"); }
-	float& HyperthermicHealthDecreaseRateBaseField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.HyperthermicHealthDecreaseRateBase"); }
-	float& HyperthermicHealthDecreaseRatePerDegreeField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.HyperthermicHealthDecreaseRatePerDegree"); }
-	float& XPEarnedPerStaminaConsumedField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.XPEarnedPerStaminaConsumed"); }
-	float& KillXPMultiplierPerCharacterLevelField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.KillXPMultiplierPerCharacterLevel"); }
-	float& ShareXPWithTribeRangeField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.ShareXPWithTribeRange"); }
-	int& BaseCharacterLevelField() { return *GetNativePointerField<int*>(this, "UPrimalCharacterStatusComponent.BaseCharacterLevel"); }
-	unsigned __int16& ExtraCharacterLevelField() { return *GetNativePointerField<unsigned __int16*>(this, "UPrimalCharacterStatusComponent.ExtraCharacterLevel"); }
-	float& ExperiencePointsField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.ExperiencePoints"); }
-	float& ReplicatedExperiencePointsField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.ReplicatedExperiencePoints"); }
-	TEnumAsByte<enum ELevelExperienceRampType::Type>& LevelExperienceRampTypeField() { return *GetNativePointerField<TEnumAsByte<enum ELevelExperienceRampType::Type>*>(this, "UPrimalCharacterStatusComponent.LevelExperienceRampType"); }
-	float& MaxExperiencePointsField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.MaxExperiencePoints"); }
-	float& BaseFoodConsumptionRateField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.BaseFoodConsumptionRate"); }
-	float& BaseWaterConsumptionRateField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.BaseWaterConsumptionRate"); }
-	float& FortitudeTorpidityDecreaseMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.FortitudeTorpidityDecreaseMultiplier"); }
-	float& FortitudeTorpidityIncreaseResistanceField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.FortitudeTorpidityIncreaseResistance"); }
-	float& SubmergedWaterIncreaseRateField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.SubmergedWaterIncreaseRate"); }
-	float& CrouchedWaterFoodConsumptionMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.CrouchedWaterFoodConsumptionMultiplier"); }
-	float& ProneWaterFoodConsumptionMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.ProneWaterFoodConsumptionMultiplier"); }
-	float& StaminaRecoveryDecreaseFoodMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.StaminaRecoveryDecreaseFoodMultiplier"); }
-	float& StaminaRecoveryDecreaseWaterMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.StaminaRecoveryDecreaseWaterMultiplier"); }
-	float& HealthRecoveryDecreaseFoodMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.HealthRecoveryDecreaseFoodMultiplier"); }
-	float& BabyDinoConsumingFoodRateMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.BabyDinoConsumingFoodRateMultiplier"); }
-	float& DinoTamedAdultConsumingFoodRateMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.DinoTamedAdultConsumingFoodRateMultiplier"); }
-	float& BabyGestationConsumingFoodRateMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.BabyGestationConsumingFoodRateMultiplier"); }
-	float& BabyDinoStarvationHealthDecreaseRateMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.BabyDinoStarvationHealthDecreaseRateMultiplier"); }
-	float& BabyMaxHealthPercentField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.BabyMaxHealthPercent"); }
-	float& CrouchedStaminaConsumptionMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.CrouchedStaminaConsumptionMultiplier"); }
-	float& ProneStaminaConsumptionMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.ProneStaminaConsumptionMultiplier"); }
-	float& StarvationHealthConsumptionRateField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.StarvationHealthConsumptionRate"); }
-	float& DehyrdationHealthConsumptionRateField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.DehyrdationHealthConsumptionRate"); }
-	float& StaminaConsumptionDecreaseWaterMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.StaminaConsumptionDecreaseWaterMultiplier"); }
-	float& StaminaConsumptionDecreaseFoodMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.StaminaConsumptionDecreaseFoodMultiplier"); }
-	float& HypothermiaDecreaseFoodMultiplierBaseField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.HypothermiaDecreaseFoodMultiplierBase"); }
-	float& HypothermiaDecreaseFoodMultiplierPerDegreeField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.HypothermiaDecreaseFoodMultiplierPerDegree"); }
-	float& HyperthermiaDecreaseWaterMultiplierBaseField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.HyperthermiaDecreaseWaterMultiplierBase"); }
-	float& HyperthermiaDecreaseWaterMultiplierPerDegreeField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.HyperthermiaDecreaseWaterMultiplierPerDegree"); }
-	float& HyperthermiaTemperatureThresholdField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.HyperthermiaTemperatureThreshold"); }
-	float& HypothermiaTemperatureThresholdField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.HypothermiaTemperatureThreshold"); }
-	float& TorporExitPercentThresholdField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.TorporExitPercentThreshold"); }
-	float& KnockedOutTorpidityRecoveryRateMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.KnockedOutTorpidityRecoveryRateMultiplier"); }
-	float& DehydrationTorpidityMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.DehydrationTorpidityMultiplier"); }
-	float& StarvationTorpidityMultuplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.StarvationTorpidityMultuplier"); }
-	float& StarvationTorpidityIncreaseRateField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.StarvationTorpidityIncreaseRate"); }
-	float& DehyrdationTorpidityIncreaseRateField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.DehyrdationTorpidityIncreaseRate"); }
-	float& InjuredTorpidityIncreaseMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.InjuredTorpidityIncreaseMultiplier"); }
-	float& WeightSpeedDecreasePowerField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.WeightSpeedDecreasePower"); }
-	float& WeightJumpDecreasePowerField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.WeightJumpDecreasePower"); }
-	float& PoopItemMinFoodConsumptionIntervalField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.PoopItemMinFoodConsumptionInterval"); }
-	float& PoopItemMaxFoodConsumptionIntervalField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.PoopItemMaxFoodConsumptionInterval"); }
-	float& TheMaxTorporIncreasePerBaseLevelField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.TheMaxTorporIncreasePerBaseLevel"); }
-	float& CurrentStatusValuesReplicationIntervalField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.CurrentStatusValuesReplicationInterval"); }
-	float& InsulationHyperthermiaOffsetExponentField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.InsulationHyperthermiaOffsetExponent"); }
-	float& InsulationHyperthermiaOffsetScalerField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.InsulationHyperthermiaOffsetScaler"); }
-	float& InsulationHypothermiaOffsetExponentField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.InsulationHypothermiaOffsetExponent"); }
-	float& InsulationHypothermiaOffsetScalerField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.InsulationHypothermiaOffsetScaler"); }
-	float& HypoCharacterInsulationValueField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.HypoCharacterInsulationValue"); }
-	float& HyperCharacterInsulationValueField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.HyperCharacterInsulationValue"); }
-	float& PoopItemFoodConsumptionCacheField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.PoopItemFoodConsumptionCache"); }
-	float& LastHypothermalCharacterInsulationValueField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.LastHypothermalCharacterInsulationValue"); }
-	float& LastHyperthermalCharacterInsulationValueField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.LastHyperthermalCharacterInsulationValue"); }
-	TEnumAsByte<enum EPrimalCharacterStatusValue::Type>& MaxStatusValueToAutoUpdateField() { return *GetNativePointerField<TEnumAsByte<enum EPrimalCharacterStatusValue::Type>*>(this, "UPrimalCharacterStatusComponent.MaxStatusValueToAutoUpdate"); }
-	float& GenericXPMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.GenericXPMultiplier"); }
-	float& CraftEarnXPMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.CraftEarnXPMultiplier"); }
-	float& KillEarnXPMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.KillEarnXPMultiplier"); }
-	float& GenericEarnXPMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.GenericEarnXPMultiplier"); }
-	float& SpecialEarnXPMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.SpecialEarnXPMultiplier"); }
-	float& HarvestEarnXPMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.HarvestEarnXPMultiplier"); }
-	float& DefaultHyperthermicInsulationField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.DefaultHyperthermicInsulation"); }
-	float& DefaultHypothermicInsulationField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.DefaultHypothermicInsulation"); }
-	float& MaxTamingEffectivenessBaseLevelMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.MaxTamingEffectivenessBaseLevelMultiplier"); }
-	FString& FoodStatusNameOverrideField() { return *GetNativePointerField<FString*>(this, "UPrimalCharacterStatusComponent.FoodStatusNameOverride"); }
-	UTexture2D * FoodStatusIconBackgroundOverrideField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalCharacterStatusComponent.FoodStatusIconBackgroundOverride"); }
-	UTexture2D * FoodStatusIconForegroundOverrideField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalCharacterStatusComponent.FoodStatusIconForegroundOverride"); }
-	TArray<FPrimalCharacterStatusValueModifier>& StatusValueModifiersField() { return *GetNativePointerField<TArray<FPrimalCharacterStatusValueModifier>*>(this, "UPrimalCharacterStatusComponent.StatusValueModifiers"); }
-	TArray<unsigned char>& StatusValueModifierDescriptionIndicesField() { return *GetNativePointerField<TArray<unsigned char>*>(this, "UPrimalCharacterStatusComponent.StatusValueModifierDescriptionIndices"); }
+	float& ExperienceAutomaticConsciousIncreaseSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.ExperienceAutomaticConsciousIncreaseSpeed")>(this, "UPrimalCharacterStatusComponent.ExperienceAutomaticConsciousIncreaseSpeed"); }
+	float& CheatMaxWeightField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.CheatMaxWeight")>(this, "UPrimalCharacterStatusComponent.CheatMaxWeight"); }
+	int& CharacterStatusComponentPriorityField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalCharacterStatusComponent.CharacterStatusComponentPriority")>(this, "UPrimalCharacterStatusComponent.CharacterStatusComponentPriority"); }
+	float& SuffocationHealthPercentDecreaseSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.SuffocationHealthPercentDecreaseSpeed")>(this, "UPrimalCharacterStatusComponent.SuffocationHealthPercentDecreaseSpeed"); }
+	float& UnsubmergedOxygenIncreaseSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.UnsubmergedOxygenIncreaseSpeed")>(this, "UPrimalCharacterStatusComponent.UnsubmergedOxygenIncreaseSpeed"); }
+	float& SubmergedOxygenDecreaseSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.SubmergedOxygenDecreaseSpeed")>(this, "UPrimalCharacterStatusComponent.SubmergedOxygenDecreaseSpeed"); }
+	float& RunningStaminaConsumptionRateField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.RunningStaminaConsumptionRate")>(this, "UPrimalCharacterStatusComponent.RunningStaminaConsumptionRate"); }
+	float& WalkingStaminaConsumptionRateField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.WalkingStaminaConsumptionRate")>(this, "UPrimalCharacterStatusComponent.WalkingStaminaConsumptionRate"); }
+	float& SwimmingOrFlyingStaminaConsumptionRateField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.SwimmingOrFlyingStaminaConsumptionRate")>(this, "UPrimalCharacterStatusComponent.SwimmingOrFlyingStaminaConsumptionRate"); }
+	float& JumpStaminaConsumptionField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.JumpStaminaConsumption")>(this, "UPrimalCharacterStatusComponent.JumpStaminaConsumption"); }
+	float& WindedSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.WindedSpeedModifier")>(this, "UPrimalCharacterStatusComponent.WindedSpeedModifier"); }
+	float& WindedSpeedModifierSwimmingOrFlyingField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.WindedSpeedModifierSwimmingOrFlying")>(this, "UPrimalCharacterStatusComponent.WindedSpeedModifierSwimmingOrFlying"); }
+	float& InjuredSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.InjuredSpeedModifier")>(this, "UPrimalCharacterStatusComponent.InjuredSpeedModifier"); }
+	float& HypothermicHealthDecreaseRateBaseField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.HypothermicHealthDecreaseRateBase")>(this, "UPrimalCharacterStatusComponent.HypothermicHealthDecreaseRateBase"); }
+	float& HypothermicHealthDecreaseRatePerDegreeField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.HypothermicHealthDecreaseRatePerDegree")>(this, "UPrimalCharacterStatusComponent.HypothermicHealthDecreaseRatePerDegree"); }
+	float& HyperthermicHealthDecreaseRateBaseField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.HyperthermicHealthDecreaseRateBase")>(this, "UPrimalCharacterStatusComponent.HyperthermicHealthDecreaseRateBase"); }
+	float& HyperthermicHealthDecreaseRatePerDegreeField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.HyperthermicHealthDecreaseRatePerDegree")>(this, "UPrimalCharacterStatusComponent.HyperthermicHealthDecreaseRatePerDegree"); }
+	float& XPEarnedPerStaminaConsumedField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.XPEarnedPerStaminaConsumed")>(this, "UPrimalCharacterStatusComponent.XPEarnedPerStaminaConsumed"); }
+	float& KillXPMultiplierPerCharacterLevelField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.KillXPMultiplierPerCharacterLevel")>(this, "UPrimalCharacterStatusComponent.KillXPMultiplierPerCharacterLevel"); }
+	float& ShareXPWithTribeRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.ShareXPWithTribeRange")>(this, "UPrimalCharacterStatusComponent.ShareXPWithTribeRange"); }
+	int& BaseCharacterLevelField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalCharacterStatusComponent.BaseCharacterLevel")>(this, "UPrimalCharacterStatusComponent.BaseCharacterLevel"); }
+	unsigned __int16& ExtraCharacterLevelField() { return *GetNativePointerField<unsigned __int16*, API::FieldNameHash("UPrimalCharacterStatusComponent.ExtraCharacterLevel")>(this, "UPrimalCharacterStatusComponent.ExtraCharacterLevel"); }
+	float& ExperiencePointsField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.ExperiencePoints")>(this, "UPrimalCharacterStatusComponent.ExperiencePoints"); }
+	float& ReplicatedExperiencePointsField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.ReplicatedExperiencePoints")>(this, "UPrimalCharacterStatusComponent.ReplicatedExperiencePoints"); }
+	TEnumAsByte<enum ELevelExperienceRampType::Type>& LevelExperienceRampTypeField() { return *GetNativePointerField<TEnumAsByte<enum ELevelExperienceRampType::Type>*, API::FieldNameHash("UPrimalCharacterStatusComponent.LevelExperienceRampType")>(this, "UPrimalCharacterStatusComponent.LevelExperienceRampType"); }
+	float& MaxExperiencePointsField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.MaxExperiencePoints")>(this, "UPrimalCharacterStatusComponent.MaxExperiencePoints"); }
+	float& BaseFoodConsumptionRateField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.BaseFoodConsumptionRate")>(this, "UPrimalCharacterStatusComponent.BaseFoodConsumptionRate"); }
+	float& BaseWaterConsumptionRateField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.BaseWaterConsumptionRate")>(this, "UPrimalCharacterStatusComponent.BaseWaterConsumptionRate"); }
+	float& FortitudeTorpidityDecreaseMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.FortitudeTorpidityDecreaseMultiplier")>(this, "UPrimalCharacterStatusComponent.FortitudeTorpidityDecreaseMultiplier"); }
+	float& FortitudeTorpidityIncreaseResistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.FortitudeTorpidityIncreaseResistance")>(this, "UPrimalCharacterStatusComponent.FortitudeTorpidityIncreaseResistance"); }
+	float& SubmergedWaterIncreaseRateField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.SubmergedWaterIncreaseRate")>(this, "UPrimalCharacterStatusComponent.SubmergedWaterIncreaseRate"); }
+	float& CrouchedWaterFoodConsumptionMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.CrouchedWaterFoodConsumptionMultiplier")>(this, "UPrimalCharacterStatusComponent.CrouchedWaterFoodConsumptionMultiplier"); }
+	float& ProneWaterFoodConsumptionMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.ProneWaterFoodConsumptionMultiplier")>(this, "UPrimalCharacterStatusComponent.ProneWaterFoodConsumptionMultiplier"); }
+	float& StaminaRecoveryDecreaseFoodMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.StaminaRecoveryDecreaseFoodMultiplier")>(this, "UPrimalCharacterStatusComponent.StaminaRecoveryDecreaseFoodMultiplier"); }
+	float& StaminaRecoveryDecreaseWaterMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.StaminaRecoveryDecreaseWaterMultiplier")>(this, "UPrimalCharacterStatusComponent.StaminaRecoveryDecreaseWaterMultiplier"); }
+	float& HealthRecoveryDecreaseFoodMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.HealthRecoveryDecreaseFoodMultiplier")>(this, "UPrimalCharacterStatusComponent.HealthRecoveryDecreaseFoodMultiplier"); }
+	float& BabyDinoConsumingFoodRateMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.BabyDinoConsumingFoodRateMultiplier")>(this, "UPrimalCharacterStatusComponent.BabyDinoConsumingFoodRateMultiplier"); }
+	float& DinoTamedAdultConsumingFoodRateMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.DinoTamedAdultConsumingFoodRateMultiplier")>(this, "UPrimalCharacterStatusComponent.DinoTamedAdultConsumingFoodRateMultiplier"); }
+	float& BabyGestationConsumingFoodRateMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.BabyGestationConsumingFoodRateMultiplier")>(this, "UPrimalCharacterStatusComponent.BabyGestationConsumingFoodRateMultiplier"); }
+	float& BabyDinoStarvationHealthDecreaseRateMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.BabyDinoStarvationHealthDecreaseRateMultiplier")>(this, "UPrimalCharacterStatusComponent.BabyDinoStarvationHealthDecreaseRateMultiplier"); }
+	float& BabyMaxHealthPercentField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.BabyMaxHealthPercent")>(this, "UPrimalCharacterStatusComponent.BabyMaxHealthPercent"); }
+	float& CrouchedStaminaConsumptionMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.CrouchedStaminaConsumptionMultiplier")>(this, "UPrimalCharacterStatusComponent.CrouchedStaminaConsumptionMultiplier"); }
+	float& ProneStaminaConsumptionMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.ProneStaminaConsumptionMultiplier")>(this, "UPrimalCharacterStatusComponent.ProneStaminaConsumptionMultiplier"); }
+	float& StarvationHealthConsumptionRateField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.StarvationHealthConsumptionRate")>(this, "UPrimalCharacterStatusComponent.StarvationHealthConsumptionRate"); }
+	float& DehyrdationHealthConsumptionRateField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.DehyrdationHealthConsumptionRate")>(this, "UPrimalCharacterStatusComponent.DehyrdationHealthConsumptionRate"); }
+	float& StaminaConsumptionDecreaseWaterMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.StaminaConsumptionDecreaseWaterMultiplier")>(this, "UPrimalCharacterStatusComponent.StaminaConsumptionDecreaseWaterMultiplier"); }
+	float& StaminaConsumptionDecreaseFoodMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.StaminaConsumptionDecreaseFoodMultiplier")>(this, "UPrimalCharacterStatusComponent.StaminaConsumptionDecreaseFoodMultiplier"); }
+	float& HypothermiaDecreaseFoodMultiplierBaseField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.HypothermiaDecreaseFoodMultiplierBase")>(this, "UPrimalCharacterStatusComponent.HypothermiaDecreaseFoodMultiplierBase"); }
+	float& HypothermiaDecreaseFoodMultiplierPerDegreeField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.HypothermiaDecreaseFoodMultiplierPerDegree")>(this, "UPrimalCharacterStatusComponent.HypothermiaDecreaseFoodMultiplierPerDegree"); }
+	float& HyperthermiaDecreaseWaterMultiplierBaseField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.HyperthermiaDecreaseWaterMultiplierBase")>(this, "UPrimalCharacterStatusComponent.HyperthermiaDecreaseWaterMultiplierBase"); }
+	float& HyperthermiaDecreaseWaterMultiplierPerDegreeField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.HyperthermiaDecreaseWaterMultiplierPerDegree")>(this, "UPrimalCharacterStatusComponent.HyperthermiaDecreaseWaterMultiplierPerDegree"); }
+	float& HyperthermiaTemperatureThresholdField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.HyperthermiaTemperatureThreshold")>(this, "UPrimalCharacterStatusComponent.HyperthermiaTemperatureThreshold"); }
+	float& HypothermiaTemperatureThresholdField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.HypothermiaTemperatureThreshold")>(this, "UPrimalCharacterStatusComponent.HypothermiaTemperatureThreshold"); }
+	float& TorporExitPercentThresholdField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.TorporExitPercentThreshold")>(this, "UPrimalCharacterStatusComponent.TorporExitPercentThreshold"); }
+	float& KnockedOutTorpidityRecoveryRateMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.KnockedOutTorpidityRecoveryRateMultiplier")>(this, "UPrimalCharacterStatusComponent.KnockedOutTorpidityRecoveryRateMultiplier"); }
+	float& DehydrationTorpidityMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.DehydrationTorpidityMultiplier")>(this, "UPrimalCharacterStatusComponent.DehydrationTorpidityMultiplier"); }
+	float& StarvationTorpidityMultuplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.StarvationTorpidityMultuplier")>(this, "UPrimalCharacterStatusComponent.StarvationTorpidityMultuplier"); }
+	float& StarvationTorpidityIncreaseRateField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.StarvationTorpidityIncreaseRate")>(this, "UPrimalCharacterStatusComponent.StarvationTorpidityIncreaseRate"); }
+	float& DehyrdationTorpidityIncreaseRateField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.DehyrdationTorpidityIncreaseRate")>(this, "UPrimalCharacterStatusComponent.DehyrdationTorpidityIncreaseRate"); }
+	float& InjuredTorpidityIncreaseMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.InjuredTorpidityIncreaseMultiplier")>(this, "UPrimalCharacterStatusComponent.InjuredTorpidityIncreaseMultiplier"); }
+	float& WeightSpeedDecreasePowerField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.WeightSpeedDecreasePower")>(this, "UPrimalCharacterStatusComponent.WeightSpeedDecreasePower"); }
+	float& WeightJumpDecreasePowerField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.WeightJumpDecreasePower")>(this, "UPrimalCharacterStatusComponent.WeightJumpDecreasePower"); }
+	float& PoopItemMinFoodConsumptionIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.PoopItemMinFoodConsumptionInterval")>(this, "UPrimalCharacterStatusComponent.PoopItemMinFoodConsumptionInterval"); }
+	float& PoopItemMaxFoodConsumptionIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.PoopItemMaxFoodConsumptionInterval")>(this, "UPrimalCharacterStatusComponent.PoopItemMaxFoodConsumptionInterval"); }
+	float& TheMaxTorporIncreasePerBaseLevelField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.TheMaxTorporIncreasePerBaseLevel")>(this, "UPrimalCharacterStatusComponent.TheMaxTorporIncreasePerBaseLevel"); }
+	float& CurrentStatusValuesReplicationIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.CurrentStatusValuesReplicationInterval")>(this, "UPrimalCharacterStatusComponent.CurrentStatusValuesReplicationInterval"); }
+	float& InsulationHyperthermiaOffsetExponentField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.InsulationHyperthermiaOffsetExponent")>(this, "UPrimalCharacterStatusComponent.InsulationHyperthermiaOffsetExponent"); }
+	float& InsulationHyperthermiaOffsetScalerField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.InsulationHyperthermiaOffsetScaler")>(this, "UPrimalCharacterStatusComponent.InsulationHyperthermiaOffsetScaler"); }
+	float& InsulationHypothermiaOffsetExponentField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.InsulationHypothermiaOffsetExponent")>(this, "UPrimalCharacterStatusComponent.InsulationHypothermiaOffsetExponent"); }
+	float& InsulationHypothermiaOffsetScalerField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.InsulationHypothermiaOffsetScaler")>(this, "UPrimalCharacterStatusComponent.InsulationHypothermiaOffsetScaler"); }
+	float& HypoCharacterInsulationValueField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.HypoCharacterInsulationValue")>(this, "UPrimalCharacterStatusComponent.HypoCharacterInsulationValue"); }
+	float& HyperCharacterInsulationValueField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.HyperCharacterInsulationValue")>(this, "UPrimalCharacterStatusComponent.HyperCharacterInsulationValue"); }
+	float& PoopItemFoodConsumptionCacheField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.PoopItemFoodConsumptionCache")>(this, "UPrimalCharacterStatusComponent.PoopItemFoodConsumptionCache"); }
+	float& LastHypothermalCharacterInsulationValueField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.LastHypothermalCharacterInsulationValue")>(this, "UPrimalCharacterStatusComponent.LastHypothermalCharacterInsulationValue"); }
+	float& LastHyperthermalCharacterInsulationValueField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.LastHyperthermalCharacterInsulationValue")>(this, "UPrimalCharacterStatusComponent.LastHyperthermalCharacterInsulationValue"); }
+	TEnumAsByte<enum EPrimalCharacterStatusValue::Type>& MaxStatusValueToAutoUpdateField() { return *GetNativePointerField<TEnumAsByte<enum EPrimalCharacterStatusValue::Type>*, API::FieldNameHash("UPrimalCharacterStatusComponent.MaxStatusValueToAutoUpdate")>(this, "UPrimalCharacterStatusComponent.MaxStatusValueToAutoUpdate"); }
+	float& GenericXPMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.GenericXPMultiplier")>(this, "UPrimalCharacterStatusComponent.GenericXPMultiplier"); }
+	float& CraftEarnXPMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.CraftEarnXPMultiplier")>(this, "UPrimalCharacterStatusComponent.CraftEarnXPMultiplier"); }
+	float& KillEarnXPMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.KillEarnXPMultiplier")>(this, "UPrimalCharacterStatusComponent.KillEarnXPMultiplier"); }
+	float& GenericEarnXPMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.GenericEarnXPMultiplier")>(this, "UPrimalCharacterStatusComponent.GenericEarnXPMultiplier"); }
+	float& SpecialEarnXPMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.SpecialEarnXPMultiplier")>(this, "UPrimalCharacterStatusComponent.SpecialEarnXPMultiplier"); }
+	float& HarvestEarnXPMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.HarvestEarnXPMultiplier")>(this, "UPrimalCharacterStatusComponent.HarvestEarnXPMultiplier"); }
+	float& DefaultHyperthermicInsulationField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.DefaultHyperthermicInsulation")>(this, "UPrimalCharacterStatusComponent.DefaultHyperthermicInsulation"); }
+	float& DefaultHypothermicInsulationField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.DefaultHypothermicInsulation")>(this, "UPrimalCharacterStatusComponent.DefaultHypothermicInsulation"); }
+	float& MaxTamingEffectivenessBaseLevelMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.MaxTamingEffectivenessBaseLevelMultiplier")>(this, "UPrimalCharacterStatusComponent.MaxTamingEffectivenessBaseLevelMultiplier"); }
+	FString& FoodStatusNameOverrideField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalCharacterStatusComponent.FoodStatusNameOverride")>(this, "UPrimalCharacterStatusComponent.FoodStatusNameOverride"); }
+	UTexture2D * FoodStatusIconBackgroundOverrideField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalCharacterStatusComponent.FoodStatusIconBackgroundOverride")>(this, "UPrimalCharacterStatusComponent.FoodStatusIconBackgroundOverride"); }
+	UTexture2D * FoodStatusIconForegroundOverrideField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalCharacterStatusComponent.FoodStatusIconForegroundOverride")>(this, "UPrimalCharacterStatusComponent.FoodStatusIconForegroundOverride"); }
+	TArray<FPrimalCharacterStatusValueModifier>& StatusValueModifiersField() { return *GetNativePointerField<TArray<FPrimalCharacterStatusValueModifier>*, API::FieldNameHash("UPrimalCharacterStatusComponent.StatusValueModifiers")>(this, "UPrimalCharacterStatusComponent.StatusValueModifiers"); }
+	TArray<unsigned char>& StatusValueModifierDescriptionIndicesField() { return *GetNativePointerField<TArray<unsigned char>*, API::FieldNameHash("UPrimalCharacterStatusComponent.StatusValueModifierDescriptionIndices")>(this, "UPrimalCharacterStatusComponent.StatusValueModifierDescriptionIndices"); }
 	FieldArray<float, 12> CurrentStatusValuesField() { return { this, "UPrimalCharacterStatusComponent.CurrentStatusValues" }; }
 	FieldArray<float, 12> AdditionalStatusValuesField() { return { this, "UPrimalCharacterStatusComponent.AdditionalStatusValues" }; }
 	FieldArray<float, 12> ReplicatedCurrentStatusValuesField() { return { this, "UPrimalCharacterStatusComponent.ReplicatedCurrentStatusValues" }; }
@@ -4059,37 +4059,37 @@ struct UPrimalCharacterStatusComponent
 	FieldArray<long double, 12> LastIncreasedStatusValuesTimesField() { return { this, "UPrimalCharacterStatusComponent.LastIncreasedStatusValuesTimes" }; }
 	FieldArray<long double, 12> LastMaxedStatusValuesTimesField() { return { this, "UPrimalCharacterStatusComponent.LastMaxedStatusValuesTimes" }; }
 	FieldArray<long double, 12> LastDepletedStatusValuesTimesField() { return { this, "UPrimalCharacterStatusComponent.LastDepletedStatusValuesTimes" }; }
-	float& StaminaRecoveryExtraResourceDecreaseMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.StaminaRecoveryExtraResourceDecreaseMultiplier"); }
-	float& DehydrationStaminaRecoveryRateField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.DehydrationStaminaRecoveryRate"); }
-	float& WaterConsumptionMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.WaterConsumptionMultiplier"); }
-	float& FoodConsumptionMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.FoodConsumptionMultiplier"); }
-	TArray<USoundBase *> EnteredStatusStateSoundsField() { return *GetNativePointerField<TArray<USoundBase *>*>(this, "UPrimalCharacterStatusComponent.EnteredStatusStateSounds"); }
-	TArray<USoundBase *> ExitStatusStateSoundsField() { return *GetNativePointerField<TArray<USoundBase *>*>(this, "UPrimalCharacterStatusComponent.ExitStatusStateSounds"); }
-	float& ExtraOxygenSpeedStatMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.ExtraOxygenSpeedStatMultiplier"); }
-	float& ExtraTamedHealthMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.ExtraTamedHealthMultiplier"); }
-	float& WakingTameFoodConsumptionRateMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.WakingTameFoodConsumptionRateMultiplier"); }
-	float& SwimmingStaminaRecoveryRateMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.SwimmingStaminaRecoveryRateMultiplier"); }
-	float& ExtraWaterConsumptionMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.ExtraWaterConsumptionMultiplier"); }
-	float& ExtraFoodConsumptionMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.ExtraFoodConsumptionMultiplier"); }
-	float& DefaultMaxOxygenField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.DefaultMaxOxygen"); }
-	long double& LastReplicatedCurrentStatusValuesTimeField() { return *GetNativePointerField<long double*>(this, "UPrimalCharacterStatusComponent.LastReplicatedCurrentStatusValuesTime"); }
-	float& OriginalMaxTorporField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.OriginalMaxTorpor"); }
-	float& MountedDinoDinoWeightMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.MountedDinoDinoWeightMultiplier"); }
-	float& ExtraWildDinoDamageMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.ExtraWildDinoDamageMultiplier"); }
-	float& ExtraTamedDinoDamageMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.ExtraTamedDinoDamageMultiplier"); }
-	float& WeightMultiplierWhenCarriedOrBasedField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.WeightMultiplierWhenCarriedOrBased"); }
-	float& WeightMultiplierForCarriedPassengersField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.WeightMultiplierForCarriedPassengers"); }
-	float& WeightMultiplierForPlatformPassengersInventoryField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.WeightMultiplierForPlatformPassengersInventory"); }
+	float& StaminaRecoveryExtraResourceDecreaseMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.StaminaRecoveryExtraResourceDecreaseMultiplier")>(this, "UPrimalCharacterStatusComponent.StaminaRecoveryExtraResourceDecreaseMultiplier"); }
+	float& DehydrationStaminaRecoveryRateField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.DehydrationStaminaRecoveryRate")>(this, "UPrimalCharacterStatusComponent.DehydrationStaminaRecoveryRate"); }
+	float& WaterConsumptionMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.WaterConsumptionMultiplier")>(this, "UPrimalCharacterStatusComponent.WaterConsumptionMultiplier"); }
+	float& FoodConsumptionMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.FoodConsumptionMultiplier")>(this, "UPrimalCharacterStatusComponent.FoodConsumptionMultiplier"); }
+	TArray<USoundBase *> EnteredStatusStateSoundsField() { return *GetNativePointerField<TArray<USoundBase *>*, API::FieldNameHash("UPrimalCharacterStatusComponent.EnteredStatusStateSounds")>(this, "UPrimalCharacterStatusComponent.EnteredStatusStateSounds"); }
+	TArray<USoundBase *> ExitStatusStateSoundsField() { return *GetNativePointerField<TArray<USoundBase *>*, API::FieldNameHash("UPrimalCharacterStatusComponent.ExitStatusStateSounds")>(this, "UPrimalCharacterStatusComponent.ExitStatusStateSounds"); }
+	float& ExtraOxygenSpeedStatMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.ExtraOxygenSpeedStatMultiplier")>(this, "UPrimalCharacterStatusComponent.ExtraOxygenSpeedStatMultiplier"); }
+	float& ExtraTamedHealthMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.ExtraTamedHealthMultiplier")>(this, "UPrimalCharacterStatusComponent.ExtraTamedHealthMultiplier"); }
+	float& WakingTameFoodConsumptionRateMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.WakingTameFoodConsumptionRateMultiplier")>(this, "UPrimalCharacterStatusComponent.WakingTameFoodConsumptionRateMultiplier"); }
+	float& SwimmingStaminaRecoveryRateMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.SwimmingStaminaRecoveryRateMultiplier")>(this, "UPrimalCharacterStatusComponent.SwimmingStaminaRecoveryRateMultiplier"); }
+	float& ExtraWaterConsumptionMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.ExtraWaterConsumptionMultiplier")>(this, "UPrimalCharacterStatusComponent.ExtraWaterConsumptionMultiplier"); }
+	float& ExtraFoodConsumptionMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.ExtraFoodConsumptionMultiplier")>(this, "UPrimalCharacterStatusComponent.ExtraFoodConsumptionMultiplier"); }
+	float& DefaultMaxOxygenField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.DefaultMaxOxygen")>(this, "UPrimalCharacterStatusComponent.DefaultMaxOxygen"); }
+	long double& LastReplicatedCurrentStatusValuesTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimalCharacterStatusComponent.LastReplicatedCurrentStatusValuesTime")>(this, "UPrimalCharacterStatusComponent.LastReplicatedCurrentStatusValuesTime"); }
+	float& OriginalMaxTorporField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.OriginalMaxTorpor")>(this, "UPrimalCharacterStatusComponent.OriginalMaxTorpor"); }
+	float& MountedDinoDinoWeightMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.MountedDinoDinoWeightMultiplier")>(this, "UPrimalCharacterStatusComponent.MountedDinoDinoWeightMultiplier"); }
+	float& ExtraWildDinoDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.ExtraWildDinoDamageMultiplier")>(this, "UPrimalCharacterStatusComponent.ExtraWildDinoDamageMultiplier"); }
+	float& ExtraTamedDinoDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.ExtraTamedDinoDamageMultiplier")>(this, "UPrimalCharacterStatusComponent.ExtraTamedDinoDamageMultiplier"); }
+	float& WeightMultiplierWhenCarriedOrBasedField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.WeightMultiplierWhenCarriedOrBased")>(this, "UPrimalCharacterStatusComponent.WeightMultiplierWhenCarriedOrBased"); }
+	float& WeightMultiplierForCarriedPassengersField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.WeightMultiplierForCarriedPassengers")>(this, "UPrimalCharacterStatusComponent.WeightMultiplierForCarriedPassengers"); }
+	float& WeightMultiplierForPlatformPassengersInventoryField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.WeightMultiplierForPlatformPassengersInventory")>(this, "UPrimalCharacterStatusComponent.WeightMultiplierForPlatformPassengersInventory"); }
 	FieldArray<float, 12> DinoMaxStatAddMultiplierImprintingField() { return { this, "UPrimalCharacterStatusComponent.DinoMaxStatAddMultiplierImprinting" }; }
-	float& DinoImprintingQualityField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.DinoImprintingQuality"); }
-	float& TamedBaseHealthMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.TamedBaseHealthMultiplier"); }
-	float& ExtraBabyDinoConsumingFoodRateMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalCharacterStatusComponent.ExtraBabyDinoConsumingFoodRateMultiplier"); }
-	TArray<FString>& StatusValueNameOverridesField() { return *GetNativePointerField<TArray<FString>*>(this, "UPrimalCharacterStatusComponent.StatusValueNameOverrides"); }
-	TSubclassOf<UDamageType>& RegainOxygenDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*>(this, "UPrimalCharacterStatusComponent.RegainOxygenDamageType"); }
-	bool& bInWeightLockField() { return *GetNativePointerField<bool*>(this, "UPrimalCharacterStatusComponent.bInWeightLock"); }
-	long double& LastReplicatedXPTimeField() { return *GetNativePointerField<long double*>(this, "UPrimalCharacterStatusComponent.LastReplicatedXPTime"); }
-	bool& bHasUnlockedMaxPlayerLevelAchievementThisSessionField() { return *GetNativePointerField<bool*>(this, "UPrimalCharacterStatusComponent.bHasUnlockedMaxPlayerLevelAchievementThisSession"); }
-	bool& bHasUnlockedMaxDinoLevelAchievementThisSessionField() { return *GetNativePointerField<bool*>(this, "UPrimalCharacterStatusComponent.bHasUnlockedMaxDinoLevelAchievementThisSession"); }
+	float& DinoImprintingQualityField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.DinoImprintingQuality")>(this, "UPrimalCharacterStatusComponent.DinoImprintingQuality"); }
+	float& TamedBaseHealthMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.TamedBaseHealthMultiplier")>(this, "UPrimalCharacterStatusComponent.TamedBaseHealthMultiplier"); }
+	float& ExtraBabyDinoConsumingFoodRateMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalCharacterStatusComponent.ExtraBabyDinoConsumingFoodRateMultiplier")>(this, "UPrimalCharacterStatusComponent.ExtraBabyDinoConsumingFoodRateMultiplier"); }
+	TArray<FString>& StatusValueNameOverridesField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("UPrimalCharacterStatusComponent.StatusValueNameOverrides")>(this, "UPrimalCharacterStatusComponent.StatusValueNameOverrides"); }
+	TSubclassOf<UDamageType>& RegainOxygenDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*, API::FieldNameHash("UPrimalCharacterStatusComponent.RegainOxygenDamageType")>(this, "UPrimalCharacterStatusComponent.RegainOxygenDamageType"); }
+	bool& bInWeightLockField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimalCharacterStatusComponent.bInWeightLock")>(this, "UPrimalCharacterStatusComponent.bInWeightLock"); }
+	long double& LastReplicatedXPTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimalCharacterStatusComponent.LastReplicatedXPTime")>(this, "UPrimalCharacterStatusComponent.LastReplicatedXPTime"); }
+	bool& bHasUnlockedMaxPlayerLevelAchievementThisSessionField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimalCharacterStatusComponent.bHasUnlockedMaxPlayerLevelAchievementThisSession")>(this, "UPrimalCharacterStatusComponent.bHasUnlockedMaxPlayerLevelAchievementThisSession"); }
+	bool& bHasUnlockedMaxDinoLevelAchievementThisSessionField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimalCharacterStatusComponent.bHasUnlockedMaxDinoLevelAchievementThisSession")>(this, "UPrimalCharacterStatusComponent.bHasUnlockedMaxDinoLevelAchievementThisSession"); }
 
 	// Bit fields
 
@@ -4186,508 +4186,508 @@ struct UPrimalCharacterStatusComponent
 
 struct APrimalDinoCharacter : APrimalCharacter
 {
-	TWeakObjectPtr<AActor>& ForcedMasterTargetField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*>(this, "APrimalDinoCharacter.ForcedMasterTarget"); }
-	FName& MountCharacterSocketNameField() { return *GetNativePointerField<FName*>(this, "APrimalDinoCharacter.MountCharacterSocketName"); }
-	TWeakObjectPtr<APrimalCharacter>& MountCharacterField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*>(this, "APrimalDinoCharacter.MountCharacter"); }
-	ECollisionChannel& MeshOriginalCollisionChannelField() { return *GetNativePointerField<ECollisionChannel*>(this, "APrimalDinoCharacter.MeshOriginalCollisionChannel"); }
-	FVector& RidingAttackExtraVelocityField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.RidingAttackExtraVelocity"); }
-	UAnimMontage * StartChargeAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.StartChargeAnimation"); }
-	TArray<UAnimMontage *> AttackAnimationsField() { return *GetNativePointerField<TArray<UAnimMontage *>*>(this, "APrimalDinoCharacter.AttackAnimations"); }
-	TArray<float>& AttackAnimationWeightsField() { return *GetNativePointerField<TArray<float>*>(this, "APrimalDinoCharacter.AttackAnimationWeights"); }
-	TArray<float>& AttackAnimationsTimeFromEndToConsiderFinishedField() { return *GetNativePointerField<TArray<float>*>(this, "APrimalDinoCharacter.AttackAnimationsTimeFromEndToConsiderFinished"); }
-	float& ColorizationIntensityField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ColorizationIntensity"); }
-	TArray<UMaterialInterface *> FemaleMaterialOverridesField() { return *GetNativePointerField<TArray<UMaterialInterface *>*>(this, "APrimalDinoCharacter.FemaleMaterialOverrides"); }
-	float& PaintConsumptionMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.PaintConsumptionMultiplier"); }
-	float& ChargingBlockedStopTimeThresholdField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ChargingBlockedStopTimeThreshold"); }
-	TArray<FName>& MeleeSwingSocketsField() { return *GetNativePointerField<TArray<FName>*>(this, "APrimalDinoCharacter.MeleeSwingSockets"); }
-	int& MeleeDamageAmountField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.MeleeDamageAmount"); }
-	float& MeleeDamageImpulseField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.MeleeDamageImpulse"); }
-	float& MeleeSwingRadiusField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.MeleeSwingRadius"); }
-	TArray<FDinoAttackInfo>& AttackInfosField() { return *GetNativePointerField<TArray<FDinoAttackInfo>*>(this, "APrimalDinoCharacter.AttackInfos"); }
-	char& CurrentAttackIndexField() { return *GetNativePointerField<char*>(this, "APrimalDinoCharacter.CurrentAttackIndex"); }
-	char& LastAttackIndexField() { return *GetNativePointerField<char*>(this, "APrimalDinoCharacter.LastAttackIndex"); }
-	TSubclassOf<UDamageType>& MeleeDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*>(this, "APrimalDinoCharacter.MeleeDamageType"); }
-	TSubclassOf<UDamageType>& StepActorDamageTypeOverrideField() { return *GetNativePointerField<TSubclassOf<UDamageType>*>(this, "APrimalDinoCharacter.StepActorDamageTypeOverride"); }
-	float& AttackOffsetField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.AttackOffset"); }
-	float& FleeHealthPercentageField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.FleeHealthPercentage"); }
-	float& BreakFleeHealthPercentageField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BreakFleeHealthPercentage"); }
-	FString& TamerStringField() { return *GetNativePointerField<FString*>(this, "APrimalDinoCharacter.TamerString"); }
-	FString& TamedNameField() { return *GetNativePointerField<FString*>(this, "APrimalDinoCharacter.TamedName"); }
-	FVector2D& OverlayTooltipPaddingField() { return *GetNativePointerField<FVector2D*>(this, "APrimalDinoCharacter.OverlayTooltipPadding"); }
-	FVector2D& OverlayTooltipScaleField() { return *GetNativePointerField<FVector2D*>(this, "APrimalDinoCharacter.OverlayTooltipScale"); }
-	FVector& RiderFPVCameraOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.RiderFPVCameraOffset"); }
-	FVector& LandingLocationField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.LandingLocation"); }
-	long double& StartLandingTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.StartLandingTime"); }
-	long double& LastAxisStartPressTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastAxisStartPressTime"); }
-	long double& LastMoveForwardTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastMoveForwardTime"); }
-	float& FinalNPCLevelMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.FinalNPCLevelMultiplier"); }
-	float& LandingTraceMaxDistanceField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.LandingTraceMaxDistance"); }
-	float& FlyingWanderFixedDistanceAmountField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.FlyingWanderFixedDistanceAmount"); }
-	float& FlyingWanderRandomDistanceAmountField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.FlyingWanderRandomDistanceAmount"); }
-	float& AcceptableLandingRadiusField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.AcceptableLandingRadius"); }
-	float& MaxLandingTimeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.MaxLandingTime"); }
+	TWeakObjectPtr<AActor>& ForcedMasterTargetField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*, API::FieldNameHash("APrimalDinoCharacter.ForcedMasterTarget")>(this, "APrimalDinoCharacter.ForcedMasterTarget"); }
+	FName& MountCharacterSocketNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalDinoCharacter.MountCharacterSocketName")>(this, "APrimalDinoCharacter.MountCharacterSocketName"); }
+	TWeakObjectPtr<APrimalCharacter>& MountCharacterField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*, API::FieldNameHash("APrimalDinoCharacter.MountCharacter")>(this, "APrimalDinoCharacter.MountCharacter"); }
+	ECollisionChannel& MeshOriginalCollisionChannelField() { return *GetNativePointerField<ECollisionChannel*, API::FieldNameHash("APrimalDinoCharacter.MeshOriginalCollisionChannel")>(this, "APrimalDinoCharacter.MeshOriginalCollisionChannel"); }
+	FVector& RidingAttackExtraVelocityField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.RidingAttackExtraVelocity")>(this, "APrimalDinoCharacter.RidingAttackExtraVelocity"); }
+	UAnimMontage * StartChargeAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.StartChargeAnimation")>(this, "APrimalDinoCharacter.StartChargeAnimation"); }
+	TArray<UAnimMontage *> AttackAnimationsField() { return *GetNativePointerField<TArray<UAnimMontage *>*, API::FieldNameHash("APrimalDinoCharacter.AttackAnimations")>(this, "APrimalDinoCharacter.AttackAnimations"); }
+	TArray<float>& AttackAnimationWeightsField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("APrimalDinoCharacter.AttackAnimationWeights")>(this, "APrimalDinoCharacter.AttackAnimationWeights"); }
+	TArray<float>& AttackAnimationsTimeFromEndToConsiderFinishedField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("APrimalDinoCharacter.AttackAnimationsTimeFromEndToConsiderFinished")>(this, "APrimalDinoCharacter.AttackAnimationsTimeFromEndToConsiderFinished"); }
+	float& ColorizationIntensityField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ColorizationIntensity")>(this, "APrimalDinoCharacter.ColorizationIntensity"); }
+	TArray<UMaterialInterface *> FemaleMaterialOverridesField() { return *GetNativePointerField<TArray<UMaterialInterface *>*, API::FieldNameHash("APrimalDinoCharacter.FemaleMaterialOverrides")>(this, "APrimalDinoCharacter.FemaleMaterialOverrides"); }
+	float& PaintConsumptionMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.PaintConsumptionMultiplier")>(this, "APrimalDinoCharacter.PaintConsumptionMultiplier"); }
+	float& ChargingBlockedStopTimeThresholdField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ChargingBlockedStopTimeThreshold")>(this, "APrimalDinoCharacter.ChargingBlockedStopTimeThreshold"); }
+	TArray<FName>& MeleeSwingSocketsField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("APrimalDinoCharacter.MeleeSwingSockets")>(this, "APrimalDinoCharacter.MeleeSwingSockets"); }
+	int& MeleeDamageAmountField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.MeleeDamageAmount")>(this, "APrimalDinoCharacter.MeleeDamageAmount"); }
+	float& MeleeDamageImpulseField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.MeleeDamageImpulse")>(this, "APrimalDinoCharacter.MeleeDamageImpulse"); }
+	float& MeleeSwingRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.MeleeSwingRadius")>(this, "APrimalDinoCharacter.MeleeSwingRadius"); }
+	TArray<FDinoAttackInfo>& AttackInfosField() { return *GetNativePointerField<TArray<FDinoAttackInfo>*, API::FieldNameHash("APrimalDinoCharacter.AttackInfos")>(this, "APrimalDinoCharacter.AttackInfos"); }
+	char& CurrentAttackIndexField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalDinoCharacter.CurrentAttackIndex")>(this, "APrimalDinoCharacter.CurrentAttackIndex"); }
+	char& LastAttackIndexField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalDinoCharacter.LastAttackIndex")>(this, "APrimalDinoCharacter.LastAttackIndex"); }
+	TSubclassOf<UDamageType>& MeleeDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*, API::FieldNameHash("APrimalDinoCharacter.MeleeDamageType")>(this, "APrimalDinoCharacter.MeleeDamageType"); }
+	TSubclassOf<UDamageType>& StepActorDamageTypeOverrideField() { return *GetNativePointerField<TSubclassOf<UDamageType>*, API::FieldNameHash("APrimalDinoCharacter.StepActorDamageTypeOverride")>(this, "APrimalDinoCharacter.StepActorDamageTypeOverride"); }
+	float& AttackOffsetField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.AttackOffset")>(this, "APrimalDinoCharacter.AttackOffset"); }
+	float& FleeHealthPercentageField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.FleeHealthPercentage")>(this, "APrimalDinoCharacter.FleeHealthPercentage"); }
+	float& BreakFleeHealthPercentageField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BreakFleeHealthPercentage")>(this, "APrimalDinoCharacter.BreakFleeHealthPercentage"); }
+	FString& TamerStringField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalDinoCharacter.TamerString")>(this, "APrimalDinoCharacter.TamerString"); }
+	FString& TamedNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalDinoCharacter.TamedName")>(this, "APrimalDinoCharacter.TamedName"); }
+	FVector2D& OverlayTooltipPaddingField() { return *GetNativePointerField<FVector2D*, API::FieldNameHash("APrimalDinoCharacter.OverlayTooltipPadding")>(this, "APrimalDinoCharacter.OverlayTooltipPadding"); }
+	FVector2D& OverlayTooltipScaleField() { return *GetNativePointerField<FVector2D*, API::FieldNameHash("APrimalDinoCharacter.OverlayTooltipScale")>(this, "APrimalDinoCharacter.OverlayTooltipScale"); }
+	FVector& RiderFPVCameraOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.RiderFPVCameraOffset")>(this, "APrimalDinoCharacter.RiderFPVCameraOffset"); }
+	FVector& LandingLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.LandingLocation")>(this, "APrimalDinoCharacter.LandingLocation"); }
+	long double& StartLandingTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.StartLandingTime")>(this, "APrimalDinoCharacter.StartLandingTime"); }
+	long double& LastAxisStartPressTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastAxisStartPressTime")>(this, "APrimalDinoCharacter.LastAxisStartPressTime"); }
+	long double& LastMoveForwardTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastMoveForwardTime")>(this, "APrimalDinoCharacter.LastMoveForwardTime"); }
+	float& FinalNPCLevelMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.FinalNPCLevelMultiplier")>(this, "APrimalDinoCharacter.FinalNPCLevelMultiplier"); }
+	float& LandingTraceMaxDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.LandingTraceMaxDistance")>(this, "APrimalDinoCharacter.LandingTraceMaxDistance"); }
+	float& FlyingWanderFixedDistanceAmountField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.FlyingWanderFixedDistanceAmount")>(this, "APrimalDinoCharacter.FlyingWanderFixedDistanceAmount"); }
+	float& FlyingWanderRandomDistanceAmountField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.FlyingWanderRandomDistanceAmount")>(this, "APrimalDinoCharacter.FlyingWanderRandomDistanceAmount"); }
+	float& AcceptableLandingRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.AcceptableLandingRadius")>(this, "APrimalDinoCharacter.AcceptableLandingRadius"); }
+	float& MaxLandingTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.MaxLandingTime")>(this, "APrimalDinoCharacter.MaxLandingTime"); }
 	FieldArray<float, 2> GenderSpeedMultipliersField() { return { this, "APrimalDinoCharacter.GenderSpeedMultipliers" }; }
-	float& ChargeSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ChargeSpeedMultiplier"); }
-	UAnimMontage * ChargingAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.ChargingAnim"); }
-	float& ChargingStaminaPerSecondDrainField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ChargingStaminaPerSecondDrain"); }
-	float& ChargingStopDotTresholdField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ChargingStopDotTreshold"); }
-	FVector& LastChargeLocationField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.LastChargeLocation"); }
-	long double& LastStartChargingTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastStartChargingTime"); }
-	TWeakObjectPtr<AShooterCharacter>& RiderField() { return *GetNativePointerField<TWeakObjectPtr<AShooterCharacter>*>(this, "APrimalDinoCharacter.Rider"); }
-	TWeakObjectPtr<AShooterCharacter>& PreviousRiderField() { return *GetNativePointerField<TWeakObjectPtr<AShooterCharacter>*>(this, "APrimalDinoCharacter.PreviousRider"); }
-	TSubclassOf<UPrimalItem>& SaddleItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "APrimalDinoCharacter.SaddleItemClass"); }
-	FString& SaddleSlotNameOverrideField() { return *GetNativePointerField<FString*>(this, "APrimalDinoCharacter.SaddleSlotNameOverride"); }
-	TArray<FSaddlePassengerSeatDefinition>& NoSaddlePassengerSeatsField() { return *GetNativePointerField<TArray<FSaddlePassengerSeatDefinition>*>(this, "APrimalDinoCharacter.NoSaddlePassengerSeats"); }
-	TWeakObjectPtr<APrimalCharacter>& CarriedCharacterField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*>(this, "APrimalDinoCharacter.CarriedCharacter"); }
-	TWeakObjectPtr<APrimalCharacter>& PreviousCarriedCharacterField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*>(this, "APrimalDinoCharacter.PreviousCarriedCharacter"); }
-	UAnimMontage * DinoWithPassengerAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.DinoWithPassengerAnim"); }
-	UAnimMontage * DinoWithDinoPassengerAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.DinoWithDinoPassengerAnim"); }
-	TArray<TWeakObjectPtr<APrimalCharacter>>& PassengerPerSeatField() { return *GetNativePointerField<TArray<TWeakObjectPtr<APrimalCharacter>>*>(this, "APrimalDinoCharacter.PassengerPerSeat"); }
-	TArray<APrimalCharacter *> SavedPassengerPerSeatField() { return *GetNativePointerField<TArray<APrimalCharacter *>*>(this, "APrimalDinoCharacter.SavedPassengerPerSeat"); }
-	TArray<TWeakObjectPtr<APrimalCharacter>>& PrevPassengerPerSeatField() { return *GetNativePointerField<TArray<TWeakObjectPtr<APrimalCharacter>>*>(this, "APrimalDinoCharacter.PrevPassengerPerSeat"); }
-	long double& LastClientCameraRotationServerUpdateField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastClientCameraRotationServerUpdate"); }
-	TArray<USceneComponent *> OverrideTargetComponentsField() { return *GetNativePointerField<TArray<USceneComponent *>*>(this, "APrimalDinoCharacter.OverrideTargetComponents"); }
-	int& LastPlayedAttackAnimationField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.LastPlayedAttackAnimation"); }
-	char& AttackIndexOfPlayedAnimationField() { return *GetNativePointerField<char*>(this, "APrimalDinoCharacter.AttackIndexOfPlayedAnimation"); }
-	TArray<FDinoBaseLevelWeightEntry>& DinoBaseLevelWeightEntriesField() { return *GetNativePointerField<TArray<FDinoBaseLevelWeightEntry>*>(this, "APrimalDinoCharacter.DinoBaseLevelWeightEntries"); }
-	float& OriginalCapsuleHalfHeightField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.OriginalCapsuleHalfHeight"); }
-	TArray<FVector>& LastSocketPositionsField() { return *GetNativePointerField<TArray<FVector>*>(this, "APrimalDinoCharacter.LastSocketPositions"); }
-	TSet<AActor *, DefaultKeyFuncs<AActor *, 0>, FDefaultSetAllocator> MeleeSwingHurtListField() { return *GetNativePointerField<TSet<AActor *, DefaultKeyFuncs<AActor *, 0>, FDefaultSetAllocator>*>(this, "APrimalDinoCharacter.MeleeSwingHurtList"); }
-	long double& EndAttackTargetTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.EndAttackTargetTime"); }
-	FVector& RidingFirstPersonViewLocationOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.RidingFirstPersonViewLocationOffset"); }
-	float& BabyChanceOfTwinsField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BabyChanceOfTwins"); }
-	float& BabyGestationSpeedField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BabyGestationSpeed"); }
-	float& ExtraBabyGestationSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ExtraBabyGestationSpeedMultiplier"); }
-	float& AutoFadeOutAfterTameTimeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.AutoFadeOutAfterTameTime"); }
-	float& BasedCameraSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BasedCameraSpeedMultiplier"); }
-	long double& LastEggBoostedTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastEggBoostedTime"); }
-	float& WildPercentageChanceOfBabyField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.WildPercentageChanceOfBaby"); }
-	float& WildBabyAgeWeightField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.WildBabyAgeWeight"); }
-	float& BabyGestationProgressField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BabyGestationProgress"); }
-	float& FlyerForceLimitPitchMinField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.FlyerForceLimitPitchMin"); }
-	float& FlyerForceLimitPitchMaxField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.FlyerForceLimitPitchMax"); }
-	float& LastBabyAgeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.LastBabyAge"); }
-	float& LastBabyGestationProgressField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.LastBabyGestationProgress"); }
-	float& BabyChanceOfTripletsField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BabyChanceOfTriplets"); }
-	float& BabyAgeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BabyAge"); }
-	float& MaxPercentOfCapsulHeightAllowedForIKField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.MaxPercentOfCapsulHeightAllowedForIK"); }
-	float& SlopeBiasForMaxCapsulePercentField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.SlopeBiasForMaxCapsulePercent"); }
-	float& FlyingForceRotationRateModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.FlyingForceRotationRateModifier"); }
-	TArray<FName>& HideBoneNamesField() { return *GetNativePointerField<TArray<FName>*>(this, "APrimalDinoCharacter.HideBoneNames"); }
-	FString& HideBonesStringField() { return *GetNativePointerField<FString*>(this, "APrimalDinoCharacter.HideBonesString"); }
-	FVector& WaterSurfaceExtraJumpVectorField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.WaterSurfaceExtraJumpVector"); }
-	FVector& FlyerTakeOffAdditionalVelocityField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.FlyerTakeOffAdditionalVelocity"); }
-	float& OpenDoorDelayField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.OpenDoorDelay"); }
-	float& TamedWanderHarvestIntervalField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.TamedWanderHarvestInterval"); }
-	float& TamedWanderHarvestSearchRangeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.TamedWanderHarvestSearchRange"); }
-	float& TamedWanderHarvestCollectRadiusField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.TamedWanderHarvestCollectRadius"); }
-	FVector& TamedWanderHarvestCollectOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.TamedWanderHarvestCollectOffset"); }
-	float& RootLocSwimOffsetField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RootLocSwimOffset"); }
-	float& PlayAnimBelowHealthPercentField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.PlayAnimBelowHealthPercent"); }
-	float& LeavePlayAnimBelowHealthPercentField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.LeavePlayAnimBelowHealthPercent"); }
-	float& PlatformSaddleMaxStructureBuildDistance2DField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.PlatformSaddleMaxStructureBuildDistance2D"); }
-	UAnimMontage * PlayAnimBelowHealthField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.PlayAnimBelowHealth"); }
-	USoundBase * LowHealthExitSoundField() { return *GetNativePointerField<USoundBase **>(this, "APrimalDinoCharacter.LowHealthExitSound"); }
-	USoundBase * LowHealthEnterSoundField() { return *GetNativePointerField<USoundBase **>(this, "APrimalDinoCharacter.LowHealthEnterSound"); }
-	float& SwimOffsetInterpSpeedField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.SwimOffsetInterpSpeed"); }
-	float& CurrentRootLocSwimOffsetField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.CurrentRootLocSwimOffset"); }
-	float& AIRangeMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.AIRangeMultiplier"); }
+	float& ChargeSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ChargeSpeedMultiplier")>(this, "APrimalDinoCharacter.ChargeSpeedMultiplier"); }
+	UAnimMontage * ChargingAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.ChargingAnim")>(this, "APrimalDinoCharacter.ChargingAnim"); }
+	float& ChargingStaminaPerSecondDrainField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ChargingStaminaPerSecondDrain")>(this, "APrimalDinoCharacter.ChargingStaminaPerSecondDrain"); }
+	float& ChargingStopDotTresholdField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ChargingStopDotTreshold")>(this, "APrimalDinoCharacter.ChargingStopDotTreshold"); }
+	FVector& LastChargeLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.LastChargeLocation")>(this, "APrimalDinoCharacter.LastChargeLocation"); }
+	long double& LastStartChargingTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastStartChargingTime")>(this, "APrimalDinoCharacter.LastStartChargingTime"); }
+	TWeakObjectPtr<AShooterCharacter>& RiderField() { return *GetNativePointerField<TWeakObjectPtr<AShooterCharacter>*, API::FieldNameHash("APrimalDinoCharacter.Rider")>(this, "APrimalDinoCharacter.Rider"); }
+	TWeakObjectPtr<AShooterCharacter>& PreviousRiderField() { return *GetNativePointerField<TWeakObjectPtr<AShooterCharacter>*, API::FieldNameHash("APrimalDinoCharacter.PreviousRider")>(this, "APrimalDinoCharacter.PreviousRider"); }
+	TSubclassOf<UPrimalItem>& SaddleItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("APrimalDinoCharacter.SaddleItemClass")>(this, "APrimalDinoCharacter.SaddleItemClass"); }
+	FString& SaddleSlotNameOverrideField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalDinoCharacter.SaddleSlotNameOverride")>(this, "APrimalDinoCharacter.SaddleSlotNameOverride"); }
+	TArray<FSaddlePassengerSeatDefinition>& NoSaddlePassengerSeatsField() { return *GetNativePointerField<TArray<FSaddlePassengerSeatDefinition>*, API::FieldNameHash("APrimalDinoCharacter.NoSaddlePassengerSeats")>(this, "APrimalDinoCharacter.NoSaddlePassengerSeats"); }
+	TWeakObjectPtr<APrimalCharacter>& CarriedCharacterField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*, API::FieldNameHash("APrimalDinoCharacter.CarriedCharacter")>(this, "APrimalDinoCharacter.CarriedCharacter"); }
+	TWeakObjectPtr<APrimalCharacter>& PreviousCarriedCharacterField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*, API::FieldNameHash("APrimalDinoCharacter.PreviousCarriedCharacter")>(this, "APrimalDinoCharacter.PreviousCarriedCharacter"); }
+	UAnimMontage * DinoWithPassengerAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.DinoWithPassengerAnim")>(this, "APrimalDinoCharacter.DinoWithPassengerAnim"); }
+	UAnimMontage * DinoWithDinoPassengerAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.DinoWithDinoPassengerAnim")>(this, "APrimalDinoCharacter.DinoWithDinoPassengerAnim"); }
+	TArray<TWeakObjectPtr<APrimalCharacter>>& PassengerPerSeatField() { return *GetNativePointerField<TArray<TWeakObjectPtr<APrimalCharacter>>*, API::FieldNameHash("APrimalDinoCharacter.PassengerPerSeat")>(this, "APrimalDinoCharacter.PassengerPerSeat"); }
+	TArray<APrimalCharacter *> SavedPassengerPerSeatField() { return *GetNativePointerField<TArray<APrimalCharacter *>*, API::FieldNameHash("APrimalDinoCharacter.SavedPassengerPerSeat")>(this, "APrimalDinoCharacter.SavedPassengerPerSeat"); }
+	TArray<TWeakObjectPtr<APrimalCharacter>>& PrevPassengerPerSeatField() { return *GetNativePointerField<TArray<TWeakObjectPtr<APrimalCharacter>>*, API::FieldNameHash("APrimalDinoCharacter.PrevPassengerPerSeat")>(this, "APrimalDinoCharacter.PrevPassengerPerSeat"); }
+	long double& LastClientCameraRotationServerUpdateField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastClientCameraRotationServerUpdate")>(this, "APrimalDinoCharacter.LastClientCameraRotationServerUpdate"); }
+	TArray<USceneComponent *> OverrideTargetComponentsField() { return *GetNativePointerField<TArray<USceneComponent *>*, API::FieldNameHash("APrimalDinoCharacter.OverrideTargetComponents")>(this, "APrimalDinoCharacter.OverrideTargetComponents"); }
+	int& LastPlayedAttackAnimationField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.LastPlayedAttackAnimation")>(this, "APrimalDinoCharacter.LastPlayedAttackAnimation"); }
+	char& AttackIndexOfPlayedAnimationField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalDinoCharacter.AttackIndexOfPlayedAnimation")>(this, "APrimalDinoCharacter.AttackIndexOfPlayedAnimation"); }
+	TArray<FDinoBaseLevelWeightEntry>& DinoBaseLevelWeightEntriesField() { return *GetNativePointerField<TArray<FDinoBaseLevelWeightEntry>*, API::FieldNameHash("APrimalDinoCharacter.DinoBaseLevelWeightEntries")>(this, "APrimalDinoCharacter.DinoBaseLevelWeightEntries"); }
+	float& OriginalCapsuleHalfHeightField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.OriginalCapsuleHalfHeight")>(this, "APrimalDinoCharacter.OriginalCapsuleHalfHeight"); }
+	TArray<FVector>& LastSocketPositionsField() { return *GetNativePointerField<TArray<FVector>*, API::FieldNameHash("APrimalDinoCharacter.LastSocketPositions")>(this, "APrimalDinoCharacter.LastSocketPositions"); }
+	TSet<AActor *, DefaultKeyFuncs<AActor *, 0>, FDefaultSetAllocator> MeleeSwingHurtListField() { return *GetNativePointerField<TSet<AActor *, DefaultKeyFuncs<AActor *, 0>, FDefaultSetAllocator>*, API::FieldNameHash("APrimalDinoCharacter.MeleeSwingHurtList")>(this, "APrimalDinoCharacter.MeleeSwingHurtList"); }
+	long double& EndAttackTargetTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.EndAttackTargetTime")>(this, "APrimalDinoCharacter.EndAttackTargetTime"); }
+	FVector& RidingFirstPersonViewLocationOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.RidingFirstPersonViewLocationOffset")>(this, "APrimalDinoCharacter.RidingFirstPersonViewLocationOffset"); }
+	float& BabyChanceOfTwinsField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BabyChanceOfTwins")>(this, "APrimalDinoCharacter.BabyChanceOfTwins"); }
+	float& BabyGestationSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BabyGestationSpeed")>(this, "APrimalDinoCharacter.BabyGestationSpeed"); }
+	float& ExtraBabyGestationSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ExtraBabyGestationSpeedMultiplier")>(this, "APrimalDinoCharacter.ExtraBabyGestationSpeedMultiplier"); }
+	float& AutoFadeOutAfterTameTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.AutoFadeOutAfterTameTime")>(this, "APrimalDinoCharacter.AutoFadeOutAfterTameTime"); }
+	float& BasedCameraSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BasedCameraSpeedMultiplier")>(this, "APrimalDinoCharacter.BasedCameraSpeedMultiplier"); }
+	long double& LastEggBoostedTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastEggBoostedTime")>(this, "APrimalDinoCharacter.LastEggBoostedTime"); }
+	float& WildPercentageChanceOfBabyField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.WildPercentageChanceOfBaby")>(this, "APrimalDinoCharacter.WildPercentageChanceOfBaby"); }
+	float& WildBabyAgeWeightField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.WildBabyAgeWeight")>(this, "APrimalDinoCharacter.WildBabyAgeWeight"); }
+	float& BabyGestationProgressField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BabyGestationProgress")>(this, "APrimalDinoCharacter.BabyGestationProgress"); }
+	float& FlyerForceLimitPitchMinField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.FlyerForceLimitPitchMin")>(this, "APrimalDinoCharacter.FlyerForceLimitPitchMin"); }
+	float& FlyerForceLimitPitchMaxField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.FlyerForceLimitPitchMax")>(this, "APrimalDinoCharacter.FlyerForceLimitPitchMax"); }
+	float& LastBabyAgeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.LastBabyAge")>(this, "APrimalDinoCharacter.LastBabyAge"); }
+	float& LastBabyGestationProgressField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.LastBabyGestationProgress")>(this, "APrimalDinoCharacter.LastBabyGestationProgress"); }
+	float& BabyChanceOfTripletsField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BabyChanceOfTriplets")>(this, "APrimalDinoCharacter.BabyChanceOfTriplets"); }
+	float& BabyAgeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BabyAge")>(this, "APrimalDinoCharacter.BabyAge"); }
+	float& MaxPercentOfCapsulHeightAllowedForIKField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.MaxPercentOfCapsulHeightAllowedForIK")>(this, "APrimalDinoCharacter.MaxPercentOfCapsulHeightAllowedForIK"); }
+	float& SlopeBiasForMaxCapsulePercentField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.SlopeBiasForMaxCapsulePercent")>(this, "APrimalDinoCharacter.SlopeBiasForMaxCapsulePercent"); }
+	float& FlyingForceRotationRateModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.FlyingForceRotationRateModifier")>(this, "APrimalDinoCharacter.FlyingForceRotationRateModifier"); }
+	TArray<FName>& HideBoneNamesField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("APrimalDinoCharacter.HideBoneNames")>(this, "APrimalDinoCharacter.HideBoneNames"); }
+	FString& HideBonesStringField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalDinoCharacter.HideBonesString")>(this, "APrimalDinoCharacter.HideBonesString"); }
+	FVector& WaterSurfaceExtraJumpVectorField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.WaterSurfaceExtraJumpVector")>(this, "APrimalDinoCharacter.WaterSurfaceExtraJumpVector"); }
+	FVector& FlyerTakeOffAdditionalVelocityField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.FlyerTakeOffAdditionalVelocity")>(this, "APrimalDinoCharacter.FlyerTakeOffAdditionalVelocity"); }
+	float& OpenDoorDelayField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.OpenDoorDelay")>(this, "APrimalDinoCharacter.OpenDoorDelay"); }
+	float& TamedWanderHarvestIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.TamedWanderHarvestInterval")>(this, "APrimalDinoCharacter.TamedWanderHarvestInterval"); }
+	float& TamedWanderHarvestSearchRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.TamedWanderHarvestSearchRange")>(this, "APrimalDinoCharacter.TamedWanderHarvestSearchRange"); }
+	float& TamedWanderHarvestCollectRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.TamedWanderHarvestCollectRadius")>(this, "APrimalDinoCharacter.TamedWanderHarvestCollectRadius"); }
+	FVector& TamedWanderHarvestCollectOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.TamedWanderHarvestCollectOffset")>(this, "APrimalDinoCharacter.TamedWanderHarvestCollectOffset"); }
+	float& RootLocSwimOffsetField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RootLocSwimOffset")>(this, "APrimalDinoCharacter.RootLocSwimOffset"); }
+	float& PlayAnimBelowHealthPercentField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.PlayAnimBelowHealthPercent")>(this, "APrimalDinoCharacter.PlayAnimBelowHealthPercent"); }
+	float& LeavePlayAnimBelowHealthPercentField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.LeavePlayAnimBelowHealthPercent")>(this, "APrimalDinoCharacter.LeavePlayAnimBelowHealthPercent"); }
+	float& PlatformSaddleMaxStructureBuildDistance2DField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.PlatformSaddleMaxStructureBuildDistance2D")>(this, "APrimalDinoCharacter.PlatformSaddleMaxStructureBuildDistance2D"); }
+	UAnimMontage * PlayAnimBelowHealthField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.PlayAnimBelowHealth")>(this, "APrimalDinoCharacter.PlayAnimBelowHealth"); }
+	USoundBase * LowHealthExitSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("APrimalDinoCharacter.LowHealthExitSound")>(this, "APrimalDinoCharacter.LowHealthExitSound"); }
+	USoundBase * LowHealthEnterSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("APrimalDinoCharacter.LowHealthEnterSound")>(this, "APrimalDinoCharacter.LowHealthEnterSound"); }
+	float& SwimOffsetInterpSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.SwimOffsetInterpSpeed")>(this, "APrimalDinoCharacter.SwimOffsetInterpSpeed"); }
+	float& CurrentRootLocSwimOffsetField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.CurrentRootLocSwimOffset")>(this, "APrimalDinoCharacter.CurrentRootLocSwimOffset"); }
+	float& AIRangeMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.AIRangeMultiplier")>(this, "APrimalDinoCharacter.AIRangeMultiplier"); }
 	FieldArray<char, 6> PreventColorizationRegionsField() { return { this, "APrimalDinoCharacter.PreventColorizationRegions" }; }
 	FieldArray<char, 6> AllowPaintingColorRegionsField() { return { this, "APrimalDinoCharacter.AllowPaintingColorRegions" }; }
 	FieldArray<char, 6> ColorSetIndicesField() { return { this, "APrimalDinoCharacter.ColorSetIndices" }; }
 	FieldArray<float, 6> ColorSetIntensityMultipliersField() { return { this, "APrimalDinoCharacter.ColorSetIntensityMultipliers" }; }
-	float& MeleeAttackStaminaCostField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.MeleeAttackStaminaCost"); }
-	UAnimMontage * WakingTameAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.WakingTameAnimation"); }
-	TWeakObjectPtr<AActor>& TargetField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*>(this, "APrimalDinoCharacter.Target"); }
-	TWeakObjectPtr<AActor>& TamedFollowTargetField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*>(this, "APrimalDinoCharacter.TamedFollowTarget"); }
-	float& PercentChanceFemaleField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.PercentChanceFemale"); }
-	TArray<TSubclassOf<UPrimalItem>>& DeathGiveItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "APrimalDinoCharacter.DeathGiveItemClasses"); }
-	TArray<float>& DeathGiveItemChanceToBeBlueprintField() { return *GetNativePointerField<TArray<float>*>(this, "APrimalDinoCharacter.DeathGiveItemChanceToBeBlueprint"); }
-	float& DeathGiveItemQualityMinField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.DeathGiveItemQualityMin"); }
-	float& DeathGiveItemQualityMaxField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.DeathGiveItemQualityMax"); }
-	float& DeathGiveItemRangeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.DeathGiveItemRange"); }
-	FString& DeathGiveAchievementField() { return *GetNativePointerField<FString*>(this, "APrimalDinoCharacter.DeathGiveAchievement"); }
-	USoundBase * OverrideAreaMusicField() { return *GetNativePointerField<USoundBase **>(this, "APrimalDinoCharacter.OverrideAreaMusic"); }
-	FVector& UnboardLocationOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.UnboardLocationOffset"); }
-	float& LastTimeWhileHeadingToGoalField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.LastTimeWhileHeadingToGoal"); }
-	long double& LastColorizationTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastColorizationTime"); }
-	float& RidingNetUpdateFequencyField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RidingNetUpdateFequency"); }
-	float& RiderMaxSpeedModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RiderMaxSpeedModifier"); }
-	float& RiderExtraMaxSpeedModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RiderExtraMaxSpeedModifier"); }
-	float& RiderMaxRunSpeedModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RiderMaxRunSpeedModifier"); }
-	float& RiderRotationRateModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RiderRotationRateModifier"); }
-	float& SwimmingRotationRateModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.SwimmingRotationRateModifier"); }
-	float& chargingRotationRateModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.chargingRotationRateModifier"); }
-	UAnimMontage * EnterFlightAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.EnterFlightAnim"); }
-	UAnimMontage * ExitFlightAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.ExitFlightAnim"); }
-	UAnimMontage * SleepConsumeFoodAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.SleepConsumeFoodAnim"); }
-	UAnimMontage * WakingConsumeFoodAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.WakingConsumeFoodAnim"); }
-	UAnimMontage * FallAsleepAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.FallAsleepAnim"); }
-	UAnimMontage * TamedUnsleepAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.TamedUnsleepAnim"); }
-	UAnimMontage * WildUnsleepAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.WildUnsleepAnim"); }
-	UAnimMontage * OpenDoorAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.OpenDoorAnim"); }
-	float& ControlFacePitchInterpSpeedField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ControlFacePitchInterpSpeed"); }
-	float& TamedWalkableFloorZField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.TamedWalkableFloorZ"); }
-	float& CurrentMovementAnimRateField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.CurrentMovementAnimRate"); }
-	int& MinPlayerLevelForWakingTameField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.MinPlayerLevelForWakingTame"); }
-	float& ForceNextAttackIndexField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ForceNextAttackIndex"); }
-	TSubclassOf<UPrimalInventoryComponent>& TamedInventoryComponentTemplateField() { return *GetNativePointerField<TSubclassOf<UPrimalInventoryComponent>*>(this, "APrimalDinoCharacter.TamedInventoryComponentTemplate"); }
-	float& DeathInventoryChanceToUseField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.DeathInventoryChanceToUse"); }
-	float& WakingTameFeedIntervalField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.WakingTameFeedInterval"); }
-	long double& LastWakingTameFedTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastWakingTameFedTime"); }
-	float& DeathInventoryQualityPerLevelMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.DeathInventoryQualityPerLevelMultiplier"); }
-	float& RequiredTameAffinityField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RequiredTameAffinity"); }
-	float& RequiredTameAffinityPerBaseLevelField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RequiredTameAffinityPerBaseLevel"); }
-	char& TamedAITargetingRangeField() { return *GetNativePointerField<char*>(this, "APrimalDinoCharacter.TamedAITargetingRange"); }
-	FName& PassengerBoneNameOverrideField() { return *GetNativePointerField<FName*>(this, "APrimalDinoCharacter.PassengerBoneNameOverride"); }
-	float& CurrentTameAffinityField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.CurrentTameAffinity"); }
-	float& TameIneffectivenessModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.TameIneffectivenessModifier"); }
-	float& TameIneffectivenessByAffinityField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.TameIneffectivenessByAffinity"); }
-	int& LastFrameUseLowQualityAnimationTickField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.LastFrameUseLowQualityAnimationTick"); }
-	bool& bUseBPIsValidUnStasisCasterField() { return *GetNativePointerField<bool*>(this, "APrimalDinoCharacter.bUseBPIsValidUnStasisCaster"); }
-	int& MaxSaddleStructuresHeightField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.MaxSaddleStructuresHeight"); }
-	bool& CalculateStructureHeightFromSaddleField() { return *GetNativePointerField<bool*>(this, "APrimalDinoCharacter.CalculateStructureHeightFromSaddle"); }
-	int& SaddlePivotOffsetField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.SaddlePivotOffset"); }
-	int& MaxSaddleStructuresNumField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.MaxSaddleStructuresNum"); }
-	float& TamingFoodConsumeIntervalField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.TamingFoodConsumeInterval"); }
-	float& DediForceAttackAnimTimeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.DediForceAttackAnimTime"); }
-	float& DediForceStartAttackAfterAnimTimeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.DediForceStartAttackAfterAnimTime"); }
-	float& WakingTameFoodIncreaseMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.WakingTameFoodIncreaseMultiplier"); }
-	int& TamingTeamIDField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.TamingTeamID"); }
-	int& OwningPlayerIDField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.OwningPlayerID"); }
-	FString& OwningPlayerNameField() { return *GetNativePointerField<FString*>(this, "APrimalDinoCharacter.OwningPlayerName"); }
-	long double& TamingLastFoodConsumptionTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.TamingLastFoodConsumptionTime"); }
-	unsigned int& DinoID1Field() { return *GetNativePointerField<unsigned int*>(this, "APrimalDinoCharacter.DinoID1"); }
-	unsigned int& DinoID2Field() { return *GetNativePointerField<unsigned int*>(this, "APrimalDinoCharacter.DinoID2"); }
-	FRotator& PreviousAimRotField() { return *GetNativePointerField<FRotator*>(this, "APrimalDinoCharacter.PreviousAimRot"); }
-	int& TamedAggressionLevelField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.TamedAggressionLevel"); }
-	float& TamingIneffectivenessModifierIncreaseByDamagePercentField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.TamingIneffectivenessModifierIncreaseByDamagePercent"); }
-	int& NPCSpawnerExtraLevelOffsetField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.NPCSpawnerExtraLevelOffset"); }
-	float& NPCSpawnerLevelMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.NPCSpawnerLevelMultiplier"); }
-	TWeakObjectPtr<APrimalStructureItemContainer_SupplyCrate>& LinkedSupplyCrateField() { return *GetNativePointerField<TWeakObjectPtr<APrimalStructureItemContainer_SupplyCrate>*>(this, "APrimalDinoCharacter.LinkedSupplyCrate"); }
-	float& UntamedPoopTimeMinIntervalField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.UntamedPoopTimeMinInterval"); }
-	float& UntamedPoopTimeMaxIntervalField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.UntamedPoopTimeMaxInterval"); }
-	float& MeleeHarvestDamageMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.MeleeHarvestDamageMultiplier"); }
-	float& AllowRidingMaxDistanceField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.AllowRidingMaxDistance"); }
-	float& UntamedPoopTimeCacheField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.UntamedPoopTimeCache"); }
-	TSubclassOf<UPrimalItem>& BaseEggClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "APrimalDinoCharacter.BaseEggClass"); }
-	TArray<TSubclassOf<UPrimalItem>>& EggItemsToSpawnField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "APrimalDinoCharacter.EggItemsToSpawn"); }
-	TArray<float>& EggWeightsToSpawnField() { return *GetNativePointerField<TArray<float>*>(this, "APrimalDinoCharacter.EggWeightsToSpawn"); }
-	TArray<TSubclassOf<UPrimalItem>>& FertilizedEggItemsToSpawnField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "APrimalDinoCharacter.FertilizedEggItemsToSpawn"); }
-	TArray<float>& FertilizedEggWeightsToSpawnField() { return *GetNativePointerField<TArray<float>*>(this, "APrimalDinoCharacter.FertilizedEggWeightsToSpawn"); }
-	float& EggChanceToSpawnUnstasisField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.EggChanceToSpawnUnstasis"); }
-	float& EggIntervalBetweenUnstasisChancesField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.EggIntervalBetweenUnstasisChances"); }
-	float& EggRangeMaximumNumberFromSameDinoTypeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.EggRangeMaximumNumberFromSameDinoType"); }
-	int& EggMaximumNumberFromSameDinoTypeField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.EggMaximumNumberFromSameDinoType"); }
-	float& EggRangeMaximumNumberField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.EggRangeMaximumNumber"); }
-	int& EggMaximumNumberField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.EggMaximumNumber"); }
-	FName& EggSpawnSocketNameField() { return *GetNativePointerField<FName*>(this, "APrimalDinoCharacter.EggSpawnSocketName"); }
-	UAnimMontage * EggLayingAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.EggLayingAnimation"); }
-	float& UntamedWalkingSpeedModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.UntamedWalkingSpeedModifier"); }
-	float& TamedWalkingSpeedModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.TamedWalkingSpeedModifier"); }
-	float& UntamedRunningSpeedModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.UntamedRunningSpeedModifier"); }
-	float& TamedRunningSpeedModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.TamedRunningSpeedModifier"); }
-	UAnimSequence * RiderAnimOverrideField() { return *GetNativePointerField<UAnimSequence **>(this, "APrimalDinoCharacter.RiderAnimOverride"); }
-	UAnimSequence * TurningRightRiderAnimOverrideField() { return *GetNativePointerField<UAnimSequence **>(this, "APrimalDinoCharacter.TurningRightRiderAnimOverride"); }
-	UAnimSequence * TurningLeftRiderAnimOverrideField() { return *GetNativePointerField<UAnimSequence **>(this, "APrimalDinoCharacter.TurningLeftRiderAnimOverride"); }
-	UAnimSequence * LatchedRiderAnimOverrideField() { return *GetNativePointerField<UAnimSequence **>(this, "APrimalDinoCharacter.LatchedRiderAnimOverride"); }
-	UAnimSequence * RiderMoveAnimOverrideField() { return *GetNativePointerField<UAnimSequence **>(this, "APrimalDinoCharacter.RiderMoveAnimOverride"); }
-	float& RidingAnimSpeedFactorField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RidingAnimSpeedFactor"); }
-	UAnimMontage * StartRidingAnimOverrideField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.StartRidingAnimOverride"); }
-	UAnimMontage * StopRidingAnimOverrideField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.StopRidingAnimOverride"); }
-	FName& TargetingTeamNameOverrideField() { return *GetNativePointerField<FName*>(this, "APrimalDinoCharacter.TargetingTeamNameOverride"); }
-	float& ExtraTamedSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ExtraTamedSpeedMultiplier"); }
-	float& ExtraUnTamedSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ExtraUnTamedSpeedMultiplier"); }
-	long double& LastEggSpawnChanceTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastEggSpawnChanceTime"); }
-	FName& OriginalNPCVolumeNameField() { return *GetNativePointerField<FName*>(this, "APrimalDinoCharacter.OriginalNPCVolumeName"); }
-	float& OutsideOriginalNPCVolumeStasisDestroyIntervalField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.OutsideOriginalNPCVolumeStasisDestroyInterval"); }
-	float& StasisedDestroyIntervalField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.StasisedDestroyInterval"); }
-	float& TamedAllowNamingTimeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.TamedAllowNamingTime"); }
-	float& MovementSpeedScalingRotationRatePowerField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.MovementSpeedScalingRotationRatePower"); }
-	float& AttackNoStaminaTorpidityMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.AttackNoStaminaTorpidityMultiplier"); }
-	float& DecayDestructionPeriodField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.DecayDestructionPeriod"); }
-	long double& TamedAtTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.TamedAtTime"); }
-	long double& LastInAllyRangeTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastInAllyRangeTime"); }
-	TArray<APrimalStructure *> LatchedOnStructuresField() { return *GetNativePointerField<TArray<APrimalStructure *>*>(this, "APrimalDinoCharacter.LatchedOnStructures"); }
-	int& OriginalTargetingTeamField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.OriginalTargetingTeam"); }
-	float& LocInterpolationSnapDistanceField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.LocInterpolationSnapDistance"); }
-	float& PreviousRootYawSpeedField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.PreviousRootYawSpeed"); }
-	long double& LastTimeFallingField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastTimeFalling"); }
-	float& TamedCorpseLifespanField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.TamedCorpseLifespan"); }
-	float& MateBoostDamageReceiveMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.MateBoostDamageReceiveMultiplier"); }
-	float& MateBoostDamageGiveMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.MateBoostDamageGiveMultiplier"); }
-	float& MateBoostRangeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.MateBoostRange"); }
-	FName& DinoNameTagField() { return *GetNativePointerField<FName*>(this, "APrimalDinoCharacter.DinoNameTag"); }
-	AShooterPlayerController * AttackMyTargetForPlayerControllerField() { return *GetNativePointerField<AShooterPlayerController **>(this, "APrimalDinoCharacter.AttackMyTargetForPlayerController"); }
-	float& RidingAttackExtraVelocityDelayField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RidingAttackExtraVelocityDelay"); }
-	float& StepDamageRadialDamageIntervalField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.StepDamageRadialDamageInterval"); }
-	float& StepDamageRadialDamageExtraRadiusField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.StepDamageRadialDamageExtraRadius"); }
-	float& StepDamageRadialDamageAmountGeneralField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.StepDamageRadialDamageAmountGeneral"); }
-	float& StepDamageRadialDamageAmountHarvestableField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.StepDamageRadialDamageAmountHarvestable"); }
-	long double& LastRadialStepDamageTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastRadialStepDamageTime"); }
-	TSubclassOf<UDamageType>& StepHarvestableDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*>(this, "APrimalDinoCharacter.StepHarvestableDamageType"); }
-	float& StepDamageFootDamageIntervalField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.StepDamageFootDamageInterval"); }
-	float& StepDamageFootDamageRadiusField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.StepDamageFootDamageRadius"); }
-	float& StepDamageFootDamageAmountField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.StepDamageFootDamageAmount"); }
-	TArray<FName>& StepDamageFootDamageSocketsField() { return *GetNativePointerField<TArray<FName>*>(this, "APrimalDinoCharacter.StepDamageFootDamageSockets"); }
-	float& DurationBeforeMovingStuckPawnField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.DurationBeforeMovingStuckPawn"); }
-	FVector& LastCheckedLocationField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.LastCheckedLocation"); }
-	long double& LastValidNotStuckTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastValidNotStuckTime"); }
-	UAnimMontage * StartledAnimationRightDefaultField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.StartledAnimationRightDefault"); }
-	UAnimMontage * StartledAnimationLeftField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.StartledAnimationLeft"); }
-	TArray<UAnimMontage *> StartledAnimationsField() { return *GetNativePointerField<TArray<UAnimMontage *>*>(this, "APrimalDinoCharacter.StartledAnimations"); }
-	UAnimMontage * FlyingStartledAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.FlyingStartledAnimation"); }
-	float& RandomPlayStartledAnimIntervalMinField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RandomPlayStartledAnimIntervalMin"); }
-	float& RandomPlayStartledAnimIntervalMaxField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RandomPlayStartledAnimIntervalMax"); }
-	float& StartledAnimationCooldownField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.StartledAnimationCooldown"); }
-	float& DefaultActivateAttackRangeOffsetField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.DefaultActivateAttackRangeOffset"); }
-	float& CorpseTargetingMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.CorpseTargetingMultiplier"); }
-	long double& LastFootStepDamageTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastFootStepDamageTime"); }
-	long double& LastStartledTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastStartledTime"); }
-	float& CorpseLifespanNonRelevantField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.CorpseLifespanNonRelevant"); }
-	float& MinStaminaForRiderField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.MinStaminaForRider"); }
-	float& LoseStaminaWithRiderRateField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.LoseStaminaWithRiderRate"); }
-	float& FollowingRunDistanceField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.FollowingRunDistance"); }
-	float& MaxDinoKillerTransferWeightPercentField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.MaxDinoKillerTransferWeightPercent"); }
-	float& NPCZoneVolumeCountWeightField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.NPCZoneVolumeCountWeight"); }
-	float& NPCLerpToMaxRandomBaseLevelField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.NPCLerpToMaxRandomBaseLevel"); }
-	FVector& FloatingHUDTextWorldOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.FloatingHUDTextWorldOffset"); }
-	long double& LastAttackedTargetTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastAttackedTargetTime"); }
-	long double& LastForcedLandingCheckTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastForcedLandingCheckTime"); }
-	long double& LastAllyTargetLookTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastAllyTargetLookTime"); }
-	long double& LastAttackedTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastAttackedTime"); }
-	long double& LastPlayerDinoOverlapRelevantTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastPlayerDinoOverlapRelevantTime"); }
-	FRotator& DinoAimRotationOffsetField() { return *GetNativePointerField<FRotator*>(this, "APrimalDinoCharacter.DinoAimRotationOffset"); }
-	long double& LastDinoAllyLookInterpTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastDinoAllyLookInterpTime"); }
-	FVector& LastRiderOverlappedPositionField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.LastRiderOverlappedPosition"); }
-	TWeakObjectPtr<APrimalCharacter>& AutoDragByPawnField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*>(this, "APrimalDinoCharacter.AutoDragByPawn"); }
-	long double& NextRidingFlyerUndergroundCheckField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.NextRidingFlyerUndergroundCheck"); }
-	long double& LastSetRiderTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastSetRiderTime"); }
-	TSubclassOf<UPrimalItem>& RepairRequirementsItemField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "APrimalDinoCharacter.RepairRequirementsItem"); }
-	float& RepairAmountRemainingField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RepairAmountRemaining"); }
-	float& RepairCheckIntervalField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RepairCheckInterval"); }
-	float& RepairPercentPerIntervalField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RepairPercentPerInterval"); }
-	FVector& RiderCheckTraceOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.RiderCheckTraceOffset"); }
-	FVector& RiderEjectionImpulseField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.RiderEjectionImpulse"); }
-	float& WakingTameAffinityDecreaseFoodPercentageField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.WakingTameAffinityDecreaseFoodPercentage"); }
-	float& WakingTameAllowFeedingFoodPercentageField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.WakingTameAllowFeedingFoodPercentage"); }
-	float& WakingTameFoodAffinityMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.WakingTameFoodAffinityMultiplier"); }
-	float& CheckForWildAmbientHarvestingIntervalMinField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.CheckForWildAmbientHarvestingIntervalMin"); }
-	float& CheckForWildAmbientHarvestingIntervalMaxField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.CheckForWildAmbientHarvestingIntervalMax"); }
-	float& WildAmbientHarvestingTimerField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.WildAmbientHarvestingTimer"); }
-	UAnimMontage * WildAmbientHarvestingAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.WildAmbientHarvestingAnimation"); }
-	TArray<UAnimMontage *> WildAmbientHarvestingAnimationsField() { return *GetNativePointerField<TArray<UAnimMontage *>*>(this, "APrimalDinoCharacter.WildAmbientHarvestingAnimations"); }
-	float& WildAmbientHarvestingRadiusField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.WildAmbientHarvestingRadius"); }
-	int& FlyerNumUnderGroundFailField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.FlyerNumUnderGroundFail"); }
-	int& AbsoluteBaseLevelField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.AbsoluteBaseLevel"); }
-	TArray<TEnumAsByte<enum EPrimalCharacterStatusValue::Type>>& OverrideStatPriorityOnSpawnField() { return *GetNativePointerField<TArray<TEnumAsByte<enum EPrimalCharacterStatusValue::Type>>*>(this, "APrimalDinoCharacter.OverrideStatPriorityOnSpawn"); }
-	TSubclassOf<UDamageType>& TamedHarvestDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*>(this, "APrimalDinoCharacter.TamedHarvestDamageType"); }
-	TArray<APrimalCharacter *> DraggedRagdollsField() { return *GetNativePointerField<TArray<APrimalCharacter *>*>(this, "APrimalDinoCharacter.DraggedRagdolls"); }
-	FVector& LastOverrodeRandomWanderLocationField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.LastOverrodeRandomWanderLocation"); }
-	float& ChargeBumpDamageField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ChargeBumpDamage"); }
-	TSubclassOf<UDamageType>& ChargeBumpDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*>(this, "APrimalDinoCharacter.ChargeBumpDamageType"); }
-	float& ChargeBumpImpulseField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ChargeBumpImpulse"); }
-	float& MinChargeIntervalField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.MinChargeInterval"); }
-	float& PlayerMountedLaunchFowardSpeedField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.PlayerMountedLaunchFowardSpeed"); }
-	float& PlayerMountedLaunchUpSpeedField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.PlayerMountedLaunchUpSpeed"); }
-	float& AttackOnLaunchMaximumTargetDistanceField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.AttackOnLaunchMaximumTargetDistance"); }
-	float& KeepFlightRemainingTimeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.KeepFlightRemainingTime"); }
-	UAnimMontage * MountCharacterAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.MountCharacterAnimation"); }
-	UAnimMontage * UnmountCharacterAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.UnmountCharacterAnimation"); }
-	UAnimMontage * EndChargingAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.EndChargingAnimation"); }
-	float& FlyingRunSpeedModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.FlyingRunSpeedModifier"); }
-	float& ChargingAnimDelayField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ChargingAnimDelay"); }
-	FName& RiderSocketNameField() { return *GetNativePointerField<FName*>(this, "APrimalDinoCharacter.RiderSocketName"); }
-	float& ChargingActivationRequiresStaminaField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ChargingActivationRequiresStamina"); }
-	float& ChargingActivationConsumesStaminaField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ChargingActivationConsumesStamina"); }
-	float& FlyerHardBreakingOverrideField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.FlyerHardBreakingOverride"); }
-	float& BabyScaleField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BabyScale"); }
-	float& BabySpeedMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BabySpeedMultiplier"); }
-	float& BabyPitchMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BabyPitchMultiplier"); }
-	float& BabyVolumeMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BabyVolumeMultiplier"); }
-	TWeakObjectPtr<AActor>& WanderAroundActorField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*>(this, "APrimalDinoCharacter.WanderAroundActor"); }
-	float& WanderAroundActorMaxDistanceField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.WanderAroundActorMaxDistance"); }
-	long double& ChargingStartBlockedTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.ChargingStartBlockedTime"); }
-	long double& LastChargeEndTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastChargeEndTime"); }
-	TArray<APrimalStructure *> SaddledStructuresField() { return *GetNativePointerField<TArray<APrimalStructure *>*>(this, "APrimalDinoCharacter.SaddledStructures"); }
-	TSubclassOf<APrimalBuff>& BuffGivenToBasedCharactersField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*>(this, "APrimalDinoCharacter.BuffGivenToBasedCharacters"); }
-	long double& LastTamedFlyerNearbyAllyCheckTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastTamedFlyerNearbyAllyCheckTime"); }
-	long double& LastUpdatedBabyAgeAtTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastUpdatedBabyAgeAtTime"); }
-	long double& LastUpdatedGestationAtTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastUpdatedGestationAtTime"); }
-	long double& LastUpdatedMatingAtTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastUpdatedMatingAtTime"); }
-	float& BabyAgeSpeedField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BabyAgeSpeed"); }
-	float& ExtraBabyAgeSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ExtraBabyAgeSpeedMultiplier"); }
-	float& FemaleMatingRangeAdditionField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.FemaleMatingRangeAddition"); }
-	float& FemaleMatingTimeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.FemaleMatingTime"); }
-	long double& NextAllowedMatingTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.NextAllowedMatingTime"); }
-	float& MatingProgressField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.MatingProgress"); }
-	long double& LastMatingNotificationTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastMatingNotificationTime"); }
-	APrimalDinoCharacter * MatingWithDinoField() { return *GetNativePointerField<APrimalDinoCharacter **>(this, "APrimalDinoCharacter.MatingWithDino"); }
-	UAnimMontage * MatingAnimationMaleField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.MatingAnimationMale"); }
+	float& MeleeAttackStaminaCostField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.MeleeAttackStaminaCost")>(this, "APrimalDinoCharacter.MeleeAttackStaminaCost"); }
+	UAnimMontage * WakingTameAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.WakingTameAnimation")>(this, "APrimalDinoCharacter.WakingTameAnimation"); }
+	TWeakObjectPtr<AActor>& TargetField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*, API::FieldNameHash("APrimalDinoCharacter.Target")>(this, "APrimalDinoCharacter.Target"); }
+	TWeakObjectPtr<AActor>& TamedFollowTargetField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*, API::FieldNameHash("APrimalDinoCharacter.TamedFollowTarget")>(this, "APrimalDinoCharacter.TamedFollowTarget"); }
+	float& PercentChanceFemaleField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.PercentChanceFemale")>(this, "APrimalDinoCharacter.PercentChanceFemale"); }
+	TArray<TSubclassOf<UPrimalItem>>& DeathGiveItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("APrimalDinoCharacter.DeathGiveItemClasses")>(this, "APrimalDinoCharacter.DeathGiveItemClasses"); }
+	TArray<float>& DeathGiveItemChanceToBeBlueprintField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("APrimalDinoCharacter.DeathGiveItemChanceToBeBlueprint")>(this, "APrimalDinoCharacter.DeathGiveItemChanceToBeBlueprint"); }
+	float& DeathGiveItemQualityMinField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.DeathGiveItemQualityMin")>(this, "APrimalDinoCharacter.DeathGiveItemQualityMin"); }
+	float& DeathGiveItemQualityMaxField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.DeathGiveItemQualityMax")>(this, "APrimalDinoCharacter.DeathGiveItemQualityMax"); }
+	float& DeathGiveItemRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.DeathGiveItemRange")>(this, "APrimalDinoCharacter.DeathGiveItemRange"); }
+	FString& DeathGiveAchievementField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalDinoCharacter.DeathGiveAchievement")>(this, "APrimalDinoCharacter.DeathGiveAchievement"); }
+	USoundBase * OverrideAreaMusicField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("APrimalDinoCharacter.OverrideAreaMusic")>(this, "APrimalDinoCharacter.OverrideAreaMusic"); }
+	FVector& UnboardLocationOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.UnboardLocationOffset")>(this, "APrimalDinoCharacter.UnboardLocationOffset"); }
+	float& LastTimeWhileHeadingToGoalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.LastTimeWhileHeadingToGoal")>(this, "APrimalDinoCharacter.LastTimeWhileHeadingToGoal"); }
+	long double& LastColorizationTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastColorizationTime")>(this, "APrimalDinoCharacter.LastColorizationTime"); }
+	float& RidingNetUpdateFequencyField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RidingNetUpdateFequency")>(this, "APrimalDinoCharacter.RidingNetUpdateFequency"); }
+	float& RiderMaxSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RiderMaxSpeedModifier")>(this, "APrimalDinoCharacter.RiderMaxSpeedModifier"); }
+	float& RiderExtraMaxSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RiderExtraMaxSpeedModifier")>(this, "APrimalDinoCharacter.RiderExtraMaxSpeedModifier"); }
+	float& RiderMaxRunSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RiderMaxRunSpeedModifier")>(this, "APrimalDinoCharacter.RiderMaxRunSpeedModifier"); }
+	float& RiderRotationRateModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RiderRotationRateModifier")>(this, "APrimalDinoCharacter.RiderRotationRateModifier"); }
+	float& SwimmingRotationRateModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.SwimmingRotationRateModifier")>(this, "APrimalDinoCharacter.SwimmingRotationRateModifier"); }
+	float& chargingRotationRateModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.chargingRotationRateModifier")>(this, "APrimalDinoCharacter.chargingRotationRateModifier"); }
+	UAnimMontage * EnterFlightAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.EnterFlightAnim")>(this, "APrimalDinoCharacter.EnterFlightAnim"); }
+	UAnimMontage * ExitFlightAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.ExitFlightAnim")>(this, "APrimalDinoCharacter.ExitFlightAnim"); }
+	UAnimMontage * SleepConsumeFoodAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.SleepConsumeFoodAnim")>(this, "APrimalDinoCharacter.SleepConsumeFoodAnim"); }
+	UAnimMontage * WakingConsumeFoodAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.WakingConsumeFoodAnim")>(this, "APrimalDinoCharacter.WakingConsumeFoodAnim"); }
+	UAnimMontage * FallAsleepAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.FallAsleepAnim")>(this, "APrimalDinoCharacter.FallAsleepAnim"); }
+	UAnimMontage * TamedUnsleepAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.TamedUnsleepAnim")>(this, "APrimalDinoCharacter.TamedUnsleepAnim"); }
+	UAnimMontage * WildUnsleepAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.WildUnsleepAnim")>(this, "APrimalDinoCharacter.WildUnsleepAnim"); }
+	UAnimMontage * OpenDoorAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.OpenDoorAnim")>(this, "APrimalDinoCharacter.OpenDoorAnim"); }
+	float& ControlFacePitchInterpSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ControlFacePitchInterpSpeed")>(this, "APrimalDinoCharacter.ControlFacePitchInterpSpeed"); }
+	float& TamedWalkableFloorZField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.TamedWalkableFloorZ")>(this, "APrimalDinoCharacter.TamedWalkableFloorZ"); }
+	float& CurrentMovementAnimRateField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.CurrentMovementAnimRate")>(this, "APrimalDinoCharacter.CurrentMovementAnimRate"); }
+	int& MinPlayerLevelForWakingTameField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.MinPlayerLevelForWakingTame")>(this, "APrimalDinoCharacter.MinPlayerLevelForWakingTame"); }
+	float& ForceNextAttackIndexField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ForceNextAttackIndex")>(this, "APrimalDinoCharacter.ForceNextAttackIndex"); }
+	TSubclassOf<UPrimalInventoryComponent>& TamedInventoryComponentTemplateField() { return *GetNativePointerField<TSubclassOf<UPrimalInventoryComponent>*, API::FieldNameHash("APrimalDinoCharacter.TamedInventoryComponentTemplate")>(this, "APrimalDinoCharacter.TamedInventoryComponentTemplate"); }
+	float& DeathInventoryChanceToUseField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.DeathInventoryChanceToUse")>(this, "APrimalDinoCharacter.DeathInventoryChanceToUse"); }
+	float& WakingTameFeedIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.WakingTameFeedInterval")>(this, "APrimalDinoCharacter.WakingTameFeedInterval"); }
+	long double& LastWakingTameFedTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastWakingTameFedTime")>(this, "APrimalDinoCharacter.LastWakingTameFedTime"); }
+	float& DeathInventoryQualityPerLevelMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.DeathInventoryQualityPerLevelMultiplier")>(this, "APrimalDinoCharacter.DeathInventoryQualityPerLevelMultiplier"); }
+	float& RequiredTameAffinityField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RequiredTameAffinity")>(this, "APrimalDinoCharacter.RequiredTameAffinity"); }
+	float& RequiredTameAffinityPerBaseLevelField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RequiredTameAffinityPerBaseLevel")>(this, "APrimalDinoCharacter.RequiredTameAffinityPerBaseLevel"); }
+	char& TamedAITargetingRangeField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalDinoCharacter.TamedAITargetingRange")>(this, "APrimalDinoCharacter.TamedAITargetingRange"); }
+	FName& PassengerBoneNameOverrideField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalDinoCharacter.PassengerBoneNameOverride")>(this, "APrimalDinoCharacter.PassengerBoneNameOverride"); }
+	float& CurrentTameAffinityField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.CurrentTameAffinity")>(this, "APrimalDinoCharacter.CurrentTameAffinity"); }
+	float& TameIneffectivenessModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.TameIneffectivenessModifier")>(this, "APrimalDinoCharacter.TameIneffectivenessModifier"); }
+	float& TameIneffectivenessByAffinityField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.TameIneffectivenessByAffinity")>(this, "APrimalDinoCharacter.TameIneffectivenessByAffinity"); }
+	int& LastFrameUseLowQualityAnimationTickField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.LastFrameUseLowQualityAnimationTick")>(this, "APrimalDinoCharacter.LastFrameUseLowQualityAnimationTick"); }
+	bool& bUseBPIsValidUnStasisCasterField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalDinoCharacter.bUseBPIsValidUnStasisCaster")>(this, "APrimalDinoCharacter.bUseBPIsValidUnStasisCaster"); }
+	int& MaxSaddleStructuresHeightField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.MaxSaddleStructuresHeight")>(this, "APrimalDinoCharacter.MaxSaddleStructuresHeight"); }
+	bool& CalculateStructureHeightFromSaddleField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalDinoCharacter.CalculateStructureHeightFromSaddle")>(this, "APrimalDinoCharacter.CalculateStructureHeightFromSaddle"); }
+	int& SaddlePivotOffsetField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.SaddlePivotOffset")>(this, "APrimalDinoCharacter.SaddlePivotOffset"); }
+	int& MaxSaddleStructuresNumField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.MaxSaddleStructuresNum")>(this, "APrimalDinoCharacter.MaxSaddleStructuresNum"); }
+	float& TamingFoodConsumeIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.TamingFoodConsumeInterval")>(this, "APrimalDinoCharacter.TamingFoodConsumeInterval"); }
+	float& DediForceAttackAnimTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.DediForceAttackAnimTime")>(this, "APrimalDinoCharacter.DediForceAttackAnimTime"); }
+	float& DediForceStartAttackAfterAnimTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.DediForceStartAttackAfterAnimTime")>(this, "APrimalDinoCharacter.DediForceStartAttackAfterAnimTime"); }
+	float& WakingTameFoodIncreaseMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.WakingTameFoodIncreaseMultiplier")>(this, "APrimalDinoCharacter.WakingTameFoodIncreaseMultiplier"); }
+	int& TamingTeamIDField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.TamingTeamID")>(this, "APrimalDinoCharacter.TamingTeamID"); }
+	int& OwningPlayerIDField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.OwningPlayerID")>(this, "APrimalDinoCharacter.OwningPlayerID"); }
+	FString& OwningPlayerNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalDinoCharacter.OwningPlayerName")>(this, "APrimalDinoCharacter.OwningPlayerName"); }
+	long double& TamingLastFoodConsumptionTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.TamingLastFoodConsumptionTime")>(this, "APrimalDinoCharacter.TamingLastFoodConsumptionTime"); }
+	unsigned int& DinoID1Field() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("APrimalDinoCharacter.DinoID1")>(this, "APrimalDinoCharacter.DinoID1"); }
+	unsigned int& DinoID2Field() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("APrimalDinoCharacter.DinoID2")>(this, "APrimalDinoCharacter.DinoID2"); }
+	FRotator& PreviousAimRotField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalDinoCharacter.PreviousAimRot")>(this, "APrimalDinoCharacter.PreviousAimRot"); }
+	int& TamedAggressionLevelField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.TamedAggressionLevel")>(this, "APrimalDinoCharacter.TamedAggressionLevel"); }
+	float& TamingIneffectivenessModifierIncreaseByDamagePercentField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.TamingIneffectivenessModifierIncreaseByDamagePercent")>(this, "APrimalDinoCharacter.TamingIneffectivenessModifierIncreaseByDamagePercent"); }
+	int& NPCSpawnerExtraLevelOffsetField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.NPCSpawnerExtraLevelOffset")>(this, "APrimalDinoCharacter.NPCSpawnerExtraLevelOffset"); }
+	float& NPCSpawnerLevelMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.NPCSpawnerLevelMultiplier")>(this, "APrimalDinoCharacter.NPCSpawnerLevelMultiplier"); }
+	TWeakObjectPtr<APrimalStructureItemContainer_SupplyCrate>& LinkedSupplyCrateField() { return *GetNativePointerField<TWeakObjectPtr<APrimalStructureItemContainer_SupplyCrate>*, API::FieldNameHash("APrimalDinoCharacter.LinkedSupplyCrate")>(this, "APrimalDinoCharacter.LinkedSupplyCrate"); }
+	float& UntamedPoopTimeMinIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.UntamedPoopTimeMinInterval")>(this, "APrimalDinoCharacter.UntamedPoopTimeMinInterval"); }
+	float& UntamedPoopTimeMaxIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.UntamedPoopTimeMaxInterval")>(this, "APrimalDinoCharacter.UntamedPoopTimeMaxInterval"); }
+	float& MeleeHarvestDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.MeleeHarvestDamageMultiplier")>(this, "APrimalDinoCharacter.MeleeHarvestDamageMultiplier"); }
+	float& AllowRidingMaxDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.AllowRidingMaxDistance")>(this, "APrimalDinoCharacter.AllowRidingMaxDistance"); }
+	float& UntamedPoopTimeCacheField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.UntamedPoopTimeCache")>(this, "APrimalDinoCharacter.UntamedPoopTimeCache"); }
+	TSubclassOf<UPrimalItem>& BaseEggClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("APrimalDinoCharacter.BaseEggClass")>(this, "APrimalDinoCharacter.BaseEggClass"); }
+	TArray<TSubclassOf<UPrimalItem>>& EggItemsToSpawnField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("APrimalDinoCharacter.EggItemsToSpawn")>(this, "APrimalDinoCharacter.EggItemsToSpawn"); }
+	TArray<float>& EggWeightsToSpawnField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("APrimalDinoCharacter.EggWeightsToSpawn")>(this, "APrimalDinoCharacter.EggWeightsToSpawn"); }
+	TArray<TSubclassOf<UPrimalItem>>& FertilizedEggItemsToSpawnField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("APrimalDinoCharacter.FertilizedEggItemsToSpawn")>(this, "APrimalDinoCharacter.FertilizedEggItemsToSpawn"); }
+	TArray<float>& FertilizedEggWeightsToSpawnField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("APrimalDinoCharacter.FertilizedEggWeightsToSpawn")>(this, "APrimalDinoCharacter.FertilizedEggWeightsToSpawn"); }
+	float& EggChanceToSpawnUnstasisField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.EggChanceToSpawnUnstasis")>(this, "APrimalDinoCharacter.EggChanceToSpawnUnstasis"); }
+	float& EggIntervalBetweenUnstasisChancesField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.EggIntervalBetweenUnstasisChances")>(this, "APrimalDinoCharacter.EggIntervalBetweenUnstasisChances"); }
+	float& EggRangeMaximumNumberFromSameDinoTypeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.EggRangeMaximumNumberFromSameDinoType")>(this, "APrimalDinoCharacter.EggRangeMaximumNumberFromSameDinoType"); }
+	int& EggMaximumNumberFromSameDinoTypeField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.EggMaximumNumberFromSameDinoType")>(this, "APrimalDinoCharacter.EggMaximumNumberFromSameDinoType"); }
+	float& EggRangeMaximumNumberField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.EggRangeMaximumNumber")>(this, "APrimalDinoCharacter.EggRangeMaximumNumber"); }
+	int& EggMaximumNumberField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.EggMaximumNumber")>(this, "APrimalDinoCharacter.EggMaximumNumber"); }
+	FName& EggSpawnSocketNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalDinoCharacter.EggSpawnSocketName")>(this, "APrimalDinoCharacter.EggSpawnSocketName"); }
+	UAnimMontage * EggLayingAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.EggLayingAnimation")>(this, "APrimalDinoCharacter.EggLayingAnimation"); }
+	float& UntamedWalkingSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.UntamedWalkingSpeedModifier")>(this, "APrimalDinoCharacter.UntamedWalkingSpeedModifier"); }
+	float& TamedWalkingSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.TamedWalkingSpeedModifier")>(this, "APrimalDinoCharacter.TamedWalkingSpeedModifier"); }
+	float& UntamedRunningSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.UntamedRunningSpeedModifier")>(this, "APrimalDinoCharacter.UntamedRunningSpeedModifier"); }
+	float& TamedRunningSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.TamedRunningSpeedModifier")>(this, "APrimalDinoCharacter.TamedRunningSpeedModifier"); }
+	UAnimSequence * RiderAnimOverrideField() { return *GetNativePointerField<UAnimSequence **, API::FieldNameHash("APrimalDinoCharacter.RiderAnimOverride")>(this, "APrimalDinoCharacter.RiderAnimOverride"); }
+	UAnimSequence * TurningRightRiderAnimOverrideField() { return *GetNativePointerField<UAnimSequence **, API::FieldNameHash("APrimalDinoCharacter.TurningRightRiderAnimOverride")>(this, "APrimalDinoCharacter.TurningRightRiderAnimOverride"); }
+	UAnimSequence * TurningLeftRiderAnimOverrideField() { return *GetNativePointerField<UAnimSequence **, API::FieldNameHash("APrimalDinoCharacter.TurningLeftRiderAnimOverride")>(this, "APrimalDinoCharacter.TurningLeftRiderAnimOverride"); }
+	UAnimSequence * LatchedRiderAnimOverrideField() { return *GetNativePointerField<UAnimSequence **, API::FieldNameHash("APrimalDinoCharacter.LatchedRiderAnimOverride")>(this, "APrimalDinoCharacter.LatchedRiderAnimOverride"); }
+	UAnimSequence * RiderMoveAnimOverrideField() { return *GetNativePointerField<UAnimSequence **, API::FieldNameHash("APrimalDinoCharacter.RiderMoveAnimOverride")>(this, "APrimalDinoCharacter.RiderMoveAnimOverride"); }
+	float& RidingAnimSpeedFactorField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RidingAnimSpeedFactor")>(this, "APrimalDinoCharacter.RidingAnimSpeedFactor"); }
+	UAnimMontage * StartRidingAnimOverrideField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.StartRidingAnimOverride")>(this, "APrimalDinoCharacter.StartRidingAnimOverride"); }
+	UAnimMontage * StopRidingAnimOverrideField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.StopRidingAnimOverride")>(this, "APrimalDinoCharacter.StopRidingAnimOverride"); }
+	FName& TargetingTeamNameOverrideField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalDinoCharacter.TargetingTeamNameOverride")>(this, "APrimalDinoCharacter.TargetingTeamNameOverride"); }
+	float& ExtraTamedSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ExtraTamedSpeedMultiplier")>(this, "APrimalDinoCharacter.ExtraTamedSpeedMultiplier"); }
+	float& ExtraUnTamedSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ExtraUnTamedSpeedMultiplier")>(this, "APrimalDinoCharacter.ExtraUnTamedSpeedMultiplier"); }
+	long double& LastEggSpawnChanceTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastEggSpawnChanceTime")>(this, "APrimalDinoCharacter.LastEggSpawnChanceTime"); }
+	FName& OriginalNPCVolumeNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalDinoCharacter.OriginalNPCVolumeName")>(this, "APrimalDinoCharacter.OriginalNPCVolumeName"); }
+	float& OutsideOriginalNPCVolumeStasisDestroyIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.OutsideOriginalNPCVolumeStasisDestroyInterval")>(this, "APrimalDinoCharacter.OutsideOriginalNPCVolumeStasisDestroyInterval"); }
+	float& StasisedDestroyIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.StasisedDestroyInterval")>(this, "APrimalDinoCharacter.StasisedDestroyInterval"); }
+	float& TamedAllowNamingTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.TamedAllowNamingTime")>(this, "APrimalDinoCharacter.TamedAllowNamingTime"); }
+	float& MovementSpeedScalingRotationRatePowerField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.MovementSpeedScalingRotationRatePower")>(this, "APrimalDinoCharacter.MovementSpeedScalingRotationRatePower"); }
+	float& AttackNoStaminaTorpidityMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.AttackNoStaminaTorpidityMultiplier")>(this, "APrimalDinoCharacter.AttackNoStaminaTorpidityMultiplier"); }
+	float& DecayDestructionPeriodField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.DecayDestructionPeriod")>(this, "APrimalDinoCharacter.DecayDestructionPeriod"); }
+	long double& TamedAtTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.TamedAtTime")>(this, "APrimalDinoCharacter.TamedAtTime"); }
+	long double& LastInAllyRangeTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastInAllyRangeTime")>(this, "APrimalDinoCharacter.LastInAllyRangeTime"); }
+	TArray<APrimalStructure *> LatchedOnStructuresField() { return *GetNativePointerField<TArray<APrimalStructure *>*, API::FieldNameHash("APrimalDinoCharacter.LatchedOnStructures")>(this, "APrimalDinoCharacter.LatchedOnStructures"); }
+	int& OriginalTargetingTeamField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.OriginalTargetingTeam")>(this, "APrimalDinoCharacter.OriginalTargetingTeam"); }
+	float& LocInterpolationSnapDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.LocInterpolationSnapDistance")>(this, "APrimalDinoCharacter.LocInterpolationSnapDistance"); }
+	float& PreviousRootYawSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.PreviousRootYawSpeed")>(this, "APrimalDinoCharacter.PreviousRootYawSpeed"); }
+	long double& LastTimeFallingField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastTimeFalling")>(this, "APrimalDinoCharacter.LastTimeFalling"); }
+	float& TamedCorpseLifespanField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.TamedCorpseLifespan")>(this, "APrimalDinoCharacter.TamedCorpseLifespan"); }
+	float& MateBoostDamageReceiveMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.MateBoostDamageReceiveMultiplier")>(this, "APrimalDinoCharacter.MateBoostDamageReceiveMultiplier"); }
+	float& MateBoostDamageGiveMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.MateBoostDamageGiveMultiplier")>(this, "APrimalDinoCharacter.MateBoostDamageGiveMultiplier"); }
+	float& MateBoostRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.MateBoostRange")>(this, "APrimalDinoCharacter.MateBoostRange"); }
+	FName& DinoNameTagField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalDinoCharacter.DinoNameTag")>(this, "APrimalDinoCharacter.DinoNameTag"); }
+	AShooterPlayerController * AttackMyTargetForPlayerControllerField() { return *GetNativePointerField<AShooterPlayerController **, API::FieldNameHash("APrimalDinoCharacter.AttackMyTargetForPlayerController")>(this, "APrimalDinoCharacter.AttackMyTargetForPlayerController"); }
+	float& RidingAttackExtraVelocityDelayField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RidingAttackExtraVelocityDelay")>(this, "APrimalDinoCharacter.RidingAttackExtraVelocityDelay"); }
+	float& StepDamageRadialDamageIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.StepDamageRadialDamageInterval")>(this, "APrimalDinoCharacter.StepDamageRadialDamageInterval"); }
+	float& StepDamageRadialDamageExtraRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.StepDamageRadialDamageExtraRadius")>(this, "APrimalDinoCharacter.StepDamageRadialDamageExtraRadius"); }
+	float& StepDamageRadialDamageAmountGeneralField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.StepDamageRadialDamageAmountGeneral")>(this, "APrimalDinoCharacter.StepDamageRadialDamageAmountGeneral"); }
+	float& StepDamageRadialDamageAmountHarvestableField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.StepDamageRadialDamageAmountHarvestable")>(this, "APrimalDinoCharacter.StepDamageRadialDamageAmountHarvestable"); }
+	long double& LastRadialStepDamageTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastRadialStepDamageTime")>(this, "APrimalDinoCharacter.LastRadialStepDamageTime"); }
+	TSubclassOf<UDamageType>& StepHarvestableDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*, API::FieldNameHash("APrimalDinoCharacter.StepHarvestableDamageType")>(this, "APrimalDinoCharacter.StepHarvestableDamageType"); }
+	float& StepDamageFootDamageIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.StepDamageFootDamageInterval")>(this, "APrimalDinoCharacter.StepDamageFootDamageInterval"); }
+	float& StepDamageFootDamageRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.StepDamageFootDamageRadius")>(this, "APrimalDinoCharacter.StepDamageFootDamageRadius"); }
+	float& StepDamageFootDamageAmountField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.StepDamageFootDamageAmount")>(this, "APrimalDinoCharacter.StepDamageFootDamageAmount"); }
+	TArray<FName>& StepDamageFootDamageSocketsField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("APrimalDinoCharacter.StepDamageFootDamageSockets")>(this, "APrimalDinoCharacter.StepDamageFootDamageSockets"); }
+	float& DurationBeforeMovingStuckPawnField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.DurationBeforeMovingStuckPawn")>(this, "APrimalDinoCharacter.DurationBeforeMovingStuckPawn"); }
+	FVector& LastCheckedLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.LastCheckedLocation")>(this, "APrimalDinoCharacter.LastCheckedLocation"); }
+	long double& LastValidNotStuckTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastValidNotStuckTime")>(this, "APrimalDinoCharacter.LastValidNotStuckTime"); }
+	UAnimMontage * StartledAnimationRightDefaultField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.StartledAnimationRightDefault")>(this, "APrimalDinoCharacter.StartledAnimationRightDefault"); }
+	UAnimMontage * StartledAnimationLeftField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.StartledAnimationLeft")>(this, "APrimalDinoCharacter.StartledAnimationLeft"); }
+	TArray<UAnimMontage *> StartledAnimationsField() { return *GetNativePointerField<TArray<UAnimMontage *>*, API::FieldNameHash("APrimalDinoCharacter.StartledAnimations")>(this, "APrimalDinoCharacter.StartledAnimations"); }
+	UAnimMontage * FlyingStartledAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.FlyingStartledAnimation")>(this, "APrimalDinoCharacter.FlyingStartledAnimation"); }
+	float& RandomPlayStartledAnimIntervalMinField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RandomPlayStartledAnimIntervalMin")>(this, "APrimalDinoCharacter.RandomPlayStartledAnimIntervalMin"); }
+	float& RandomPlayStartledAnimIntervalMaxField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RandomPlayStartledAnimIntervalMax")>(this, "APrimalDinoCharacter.RandomPlayStartledAnimIntervalMax"); }
+	float& StartledAnimationCooldownField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.StartledAnimationCooldown")>(this, "APrimalDinoCharacter.StartledAnimationCooldown"); }
+	float& DefaultActivateAttackRangeOffsetField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.DefaultActivateAttackRangeOffset")>(this, "APrimalDinoCharacter.DefaultActivateAttackRangeOffset"); }
+	float& CorpseTargetingMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.CorpseTargetingMultiplier")>(this, "APrimalDinoCharacter.CorpseTargetingMultiplier"); }
+	long double& LastFootStepDamageTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastFootStepDamageTime")>(this, "APrimalDinoCharacter.LastFootStepDamageTime"); }
+	long double& LastStartledTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastStartledTime")>(this, "APrimalDinoCharacter.LastStartledTime"); }
+	float& CorpseLifespanNonRelevantField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.CorpseLifespanNonRelevant")>(this, "APrimalDinoCharacter.CorpseLifespanNonRelevant"); }
+	float& MinStaminaForRiderField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.MinStaminaForRider")>(this, "APrimalDinoCharacter.MinStaminaForRider"); }
+	float& LoseStaminaWithRiderRateField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.LoseStaminaWithRiderRate")>(this, "APrimalDinoCharacter.LoseStaminaWithRiderRate"); }
+	float& FollowingRunDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.FollowingRunDistance")>(this, "APrimalDinoCharacter.FollowingRunDistance"); }
+	float& MaxDinoKillerTransferWeightPercentField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.MaxDinoKillerTransferWeightPercent")>(this, "APrimalDinoCharacter.MaxDinoKillerTransferWeightPercent"); }
+	float& NPCZoneVolumeCountWeightField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.NPCZoneVolumeCountWeight")>(this, "APrimalDinoCharacter.NPCZoneVolumeCountWeight"); }
+	float& NPCLerpToMaxRandomBaseLevelField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.NPCLerpToMaxRandomBaseLevel")>(this, "APrimalDinoCharacter.NPCLerpToMaxRandomBaseLevel"); }
+	FVector& FloatingHUDTextWorldOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.FloatingHUDTextWorldOffset")>(this, "APrimalDinoCharacter.FloatingHUDTextWorldOffset"); }
+	long double& LastAttackedTargetTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastAttackedTargetTime")>(this, "APrimalDinoCharacter.LastAttackedTargetTime"); }
+	long double& LastForcedLandingCheckTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastForcedLandingCheckTime")>(this, "APrimalDinoCharacter.LastForcedLandingCheckTime"); }
+	long double& LastAllyTargetLookTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastAllyTargetLookTime")>(this, "APrimalDinoCharacter.LastAllyTargetLookTime"); }
+	long double& LastAttackedTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastAttackedTime")>(this, "APrimalDinoCharacter.LastAttackedTime"); }
+	long double& LastPlayerDinoOverlapRelevantTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastPlayerDinoOverlapRelevantTime")>(this, "APrimalDinoCharacter.LastPlayerDinoOverlapRelevantTime"); }
+	FRotator& DinoAimRotationOffsetField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalDinoCharacter.DinoAimRotationOffset")>(this, "APrimalDinoCharacter.DinoAimRotationOffset"); }
+	long double& LastDinoAllyLookInterpTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastDinoAllyLookInterpTime")>(this, "APrimalDinoCharacter.LastDinoAllyLookInterpTime"); }
+	FVector& LastRiderOverlappedPositionField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.LastRiderOverlappedPosition")>(this, "APrimalDinoCharacter.LastRiderOverlappedPosition"); }
+	TWeakObjectPtr<APrimalCharacter>& AutoDragByPawnField() { return *GetNativePointerField<TWeakObjectPtr<APrimalCharacter>*, API::FieldNameHash("APrimalDinoCharacter.AutoDragByPawn")>(this, "APrimalDinoCharacter.AutoDragByPawn"); }
+	long double& NextRidingFlyerUndergroundCheckField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.NextRidingFlyerUndergroundCheck")>(this, "APrimalDinoCharacter.NextRidingFlyerUndergroundCheck"); }
+	long double& LastSetRiderTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastSetRiderTime")>(this, "APrimalDinoCharacter.LastSetRiderTime"); }
+	TSubclassOf<UPrimalItem>& RepairRequirementsItemField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("APrimalDinoCharacter.RepairRequirementsItem")>(this, "APrimalDinoCharacter.RepairRequirementsItem"); }
+	float& RepairAmountRemainingField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RepairAmountRemaining")>(this, "APrimalDinoCharacter.RepairAmountRemaining"); }
+	float& RepairCheckIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RepairCheckInterval")>(this, "APrimalDinoCharacter.RepairCheckInterval"); }
+	float& RepairPercentPerIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RepairPercentPerInterval")>(this, "APrimalDinoCharacter.RepairPercentPerInterval"); }
+	FVector& RiderCheckTraceOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.RiderCheckTraceOffset")>(this, "APrimalDinoCharacter.RiderCheckTraceOffset"); }
+	FVector& RiderEjectionImpulseField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.RiderEjectionImpulse")>(this, "APrimalDinoCharacter.RiderEjectionImpulse"); }
+	float& WakingTameAffinityDecreaseFoodPercentageField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.WakingTameAffinityDecreaseFoodPercentage")>(this, "APrimalDinoCharacter.WakingTameAffinityDecreaseFoodPercentage"); }
+	float& WakingTameAllowFeedingFoodPercentageField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.WakingTameAllowFeedingFoodPercentage")>(this, "APrimalDinoCharacter.WakingTameAllowFeedingFoodPercentage"); }
+	float& WakingTameFoodAffinityMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.WakingTameFoodAffinityMultiplier")>(this, "APrimalDinoCharacter.WakingTameFoodAffinityMultiplier"); }
+	float& CheckForWildAmbientHarvestingIntervalMinField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.CheckForWildAmbientHarvestingIntervalMin")>(this, "APrimalDinoCharacter.CheckForWildAmbientHarvestingIntervalMin"); }
+	float& CheckForWildAmbientHarvestingIntervalMaxField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.CheckForWildAmbientHarvestingIntervalMax")>(this, "APrimalDinoCharacter.CheckForWildAmbientHarvestingIntervalMax"); }
+	float& WildAmbientHarvestingTimerField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.WildAmbientHarvestingTimer")>(this, "APrimalDinoCharacter.WildAmbientHarvestingTimer"); }
+	UAnimMontage * WildAmbientHarvestingAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.WildAmbientHarvestingAnimation")>(this, "APrimalDinoCharacter.WildAmbientHarvestingAnimation"); }
+	TArray<UAnimMontage *> WildAmbientHarvestingAnimationsField() { return *GetNativePointerField<TArray<UAnimMontage *>*, API::FieldNameHash("APrimalDinoCharacter.WildAmbientHarvestingAnimations")>(this, "APrimalDinoCharacter.WildAmbientHarvestingAnimations"); }
+	float& WildAmbientHarvestingRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.WildAmbientHarvestingRadius")>(this, "APrimalDinoCharacter.WildAmbientHarvestingRadius"); }
+	int& FlyerNumUnderGroundFailField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.FlyerNumUnderGroundFail")>(this, "APrimalDinoCharacter.FlyerNumUnderGroundFail"); }
+	int& AbsoluteBaseLevelField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.AbsoluteBaseLevel")>(this, "APrimalDinoCharacter.AbsoluteBaseLevel"); }
+	TArray<TEnumAsByte<enum EPrimalCharacterStatusValue::Type>>& OverrideStatPriorityOnSpawnField() { return *GetNativePointerField<TArray<TEnumAsByte<enum EPrimalCharacterStatusValue::Type>>*, API::FieldNameHash("APrimalDinoCharacter.OverrideStatPriorityOnSpawn")>(this, "APrimalDinoCharacter.OverrideStatPriorityOnSpawn"); }
+	TSubclassOf<UDamageType>& TamedHarvestDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*, API::FieldNameHash("APrimalDinoCharacter.TamedHarvestDamageType")>(this, "APrimalDinoCharacter.TamedHarvestDamageType"); }
+	TArray<APrimalCharacter *> DraggedRagdollsField() { return *GetNativePointerField<TArray<APrimalCharacter *>*, API::FieldNameHash("APrimalDinoCharacter.DraggedRagdolls")>(this, "APrimalDinoCharacter.DraggedRagdolls"); }
+	FVector& LastOverrodeRandomWanderLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.LastOverrodeRandomWanderLocation")>(this, "APrimalDinoCharacter.LastOverrodeRandomWanderLocation"); }
+	float& ChargeBumpDamageField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ChargeBumpDamage")>(this, "APrimalDinoCharacter.ChargeBumpDamage"); }
+	TSubclassOf<UDamageType>& ChargeBumpDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*, API::FieldNameHash("APrimalDinoCharacter.ChargeBumpDamageType")>(this, "APrimalDinoCharacter.ChargeBumpDamageType"); }
+	float& ChargeBumpImpulseField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ChargeBumpImpulse")>(this, "APrimalDinoCharacter.ChargeBumpImpulse"); }
+	float& MinChargeIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.MinChargeInterval")>(this, "APrimalDinoCharacter.MinChargeInterval"); }
+	float& PlayerMountedLaunchFowardSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.PlayerMountedLaunchFowardSpeed")>(this, "APrimalDinoCharacter.PlayerMountedLaunchFowardSpeed"); }
+	float& PlayerMountedLaunchUpSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.PlayerMountedLaunchUpSpeed")>(this, "APrimalDinoCharacter.PlayerMountedLaunchUpSpeed"); }
+	float& AttackOnLaunchMaximumTargetDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.AttackOnLaunchMaximumTargetDistance")>(this, "APrimalDinoCharacter.AttackOnLaunchMaximumTargetDistance"); }
+	float& KeepFlightRemainingTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.KeepFlightRemainingTime")>(this, "APrimalDinoCharacter.KeepFlightRemainingTime"); }
+	UAnimMontage * MountCharacterAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.MountCharacterAnimation")>(this, "APrimalDinoCharacter.MountCharacterAnimation"); }
+	UAnimMontage * UnmountCharacterAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.UnmountCharacterAnimation")>(this, "APrimalDinoCharacter.UnmountCharacterAnimation"); }
+	UAnimMontage * EndChargingAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.EndChargingAnimation")>(this, "APrimalDinoCharacter.EndChargingAnimation"); }
+	float& FlyingRunSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.FlyingRunSpeedModifier")>(this, "APrimalDinoCharacter.FlyingRunSpeedModifier"); }
+	float& ChargingAnimDelayField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ChargingAnimDelay")>(this, "APrimalDinoCharacter.ChargingAnimDelay"); }
+	FName& RiderSocketNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalDinoCharacter.RiderSocketName")>(this, "APrimalDinoCharacter.RiderSocketName"); }
+	float& ChargingActivationRequiresStaminaField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ChargingActivationRequiresStamina")>(this, "APrimalDinoCharacter.ChargingActivationRequiresStamina"); }
+	float& ChargingActivationConsumesStaminaField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ChargingActivationConsumesStamina")>(this, "APrimalDinoCharacter.ChargingActivationConsumesStamina"); }
+	float& FlyerHardBreakingOverrideField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.FlyerHardBreakingOverride")>(this, "APrimalDinoCharacter.FlyerHardBreakingOverride"); }
+	float& BabyScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BabyScale")>(this, "APrimalDinoCharacter.BabyScale"); }
+	float& BabySpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BabySpeedMultiplier")>(this, "APrimalDinoCharacter.BabySpeedMultiplier"); }
+	float& BabyPitchMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BabyPitchMultiplier")>(this, "APrimalDinoCharacter.BabyPitchMultiplier"); }
+	float& BabyVolumeMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BabyVolumeMultiplier")>(this, "APrimalDinoCharacter.BabyVolumeMultiplier"); }
+	TWeakObjectPtr<AActor>& WanderAroundActorField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*, API::FieldNameHash("APrimalDinoCharacter.WanderAroundActor")>(this, "APrimalDinoCharacter.WanderAroundActor"); }
+	float& WanderAroundActorMaxDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.WanderAroundActorMaxDistance")>(this, "APrimalDinoCharacter.WanderAroundActorMaxDistance"); }
+	long double& ChargingStartBlockedTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.ChargingStartBlockedTime")>(this, "APrimalDinoCharacter.ChargingStartBlockedTime"); }
+	long double& LastChargeEndTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastChargeEndTime")>(this, "APrimalDinoCharacter.LastChargeEndTime"); }
+	TArray<APrimalStructure *> SaddledStructuresField() { return *GetNativePointerField<TArray<APrimalStructure *>*, API::FieldNameHash("APrimalDinoCharacter.SaddledStructures")>(this, "APrimalDinoCharacter.SaddledStructures"); }
+	TSubclassOf<APrimalBuff>& BuffGivenToBasedCharactersField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*, API::FieldNameHash("APrimalDinoCharacter.BuffGivenToBasedCharacters")>(this, "APrimalDinoCharacter.BuffGivenToBasedCharacters"); }
+	long double& LastTamedFlyerNearbyAllyCheckTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastTamedFlyerNearbyAllyCheckTime")>(this, "APrimalDinoCharacter.LastTamedFlyerNearbyAllyCheckTime"); }
+	long double& LastUpdatedBabyAgeAtTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastUpdatedBabyAgeAtTime")>(this, "APrimalDinoCharacter.LastUpdatedBabyAgeAtTime"); }
+	long double& LastUpdatedGestationAtTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastUpdatedGestationAtTime")>(this, "APrimalDinoCharacter.LastUpdatedGestationAtTime"); }
+	long double& LastUpdatedMatingAtTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastUpdatedMatingAtTime")>(this, "APrimalDinoCharacter.LastUpdatedMatingAtTime"); }
+	float& BabyAgeSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BabyAgeSpeed")>(this, "APrimalDinoCharacter.BabyAgeSpeed"); }
+	float& ExtraBabyAgeSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ExtraBabyAgeSpeedMultiplier")>(this, "APrimalDinoCharacter.ExtraBabyAgeSpeedMultiplier"); }
+	float& FemaleMatingRangeAdditionField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.FemaleMatingRangeAddition")>(this, "APrimalDinoCharacter.FemaleMatingRangeAddition"); }
+	float& FemaleMatingTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.FemaleMatingTime")>(this, "APrimalDinoCharacter.FemaleMatingTime"); }
+	long double& NextAllowedMatingTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.NextAllowedMatingTime")>(this, "APrimalDinoCharacter.NextAllowedMatingTime"); }
+	float& MatingProgressField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.MatingProgress")>(this, "APrimalDinoCharacter.MatingProgress"); }
+	long double& LastMatingNotificationTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastMatingNotificationTime")>(this, "APrimalDinoCharacter.LastMatingNotificationTime"); }
+	APrimalDinoCharacter * MatingWithDinoField() { return *GetNativePointerField<APrimalDinoCharacter **, API::FieldNameHash("APrimalDinoCharacter.MatingWithDino")>(this, "APrimalDinoCharacter.MatingWithDino"); }
+	UAnimMontage * MatingAnimationMaleField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.MatingAnimationMale")>(this, "APrimalDinoCharacter.MatingAnimationMale"); }
 	FieldArray<char, 12> GestationEggNumberOfLevelUpPointsAppliedField() { return { this, "APrimalDinoCharacter.GestationEggNumberOfLevelUpPointsApplied" }; }
-	float& GestationEggTamedIneffectivenessModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.GestationEggTamedIneffectivenessModifier"); }
+	float& GestationEggTamedIneffectivenessModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.GestationEggTamedIneffectivenessModifier")>(this, "APrimalDinoCharacter.GestationEggTamedIneffectivenessModifier"); }
 	FieldArray<char, 6> GestationEggColorSetIndicesField() { return { this, "APrimalDinoCharacter.GestationEggColorSetIndices" }; }
-	float& NewFemaleMinTimeBetweenMatingField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.NewFemaleMinTimeBetweenMating"); }
-	float& NewFemaleMaxTimeBetweenMatingField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.NewFemaleMaxTimeBetweenMating"); }
-	TArray<TSubclassOf<APrimalBuff>>& DefaultTamedBuffsField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalBuff>>*>(this, "APrimalDinoCharacter.DefaultTamedBuffs"); }
-	FVector& InterpolatedVelocityField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.InterpolatedVelocity"); }
-	FVector& OldInterpolatedLocationField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.OldInterpolatedLocation"); }
-	float& HyperThermiaInsulationField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.HyperThermiaInsulation"); }
-	float& HypoThermiaInsulationField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.HypoThermiaInsulation"); }
-	float& InsulationRangeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.InsulationRange"); }
-	float& GangOverlapRangeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.GangOverlapRange"); }
-	float& GangDamageResistanceField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.GangDamageResistance"); }
-	float& GangDamageField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.GangDamage"); }
-	int& MaxGangCountField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.MaxGangCount"); }
-	int& GangCountField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.GangCount"); }
-	long double& LastGangCheckTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastGangCheckTime"); }
-	FVector& LastGangCheckPositionField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.LastGangCheckPosition"); }
-	int& PreviousTargetingTeamField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.PreviousTargetingTeam"); }
-	int& LastRiderExitFrameCounterField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.LastRiderExitFrameCounter"); }
-	float& WildRandomScaleField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.WildRandomScale"); }
-	float& HeldJumpSlowFallingGravityZScaleField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.HeldJumpSlowFallingGravityZScale"); }
-	UAnimMontage * SlowFallingAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.SlowFallingAnim"); }
-	float& SlowFallingStaminaCostPerSecondField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.SlowFallingStaminaCostPerSecond"); }
-	float& NoRiderRotationModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.NoRiderRotationModifier"); }
-	FName& RiderFPVCameraUseSocketNameField() { return *GetNativePointerField<FName*>(this, "APrimalDinoCharacter.RiderFPVCameraUseSocketName"); }
-	FName& RiderLatchedFPVCameraUseSocketNameField() { return *GetNativePointerField<FName*>(this, "APrimalDinoCharacter.RiderLatchedFPVCameraUseSocketName"); }
-	FName& PassengerFPVCameraRootSocketField() { return *GetNativePointerField<FName*>(this, "APrimalDinoCharacter.PassengerFPVCameraRootSocket"); }
-	TArray<FName>& FPVRiderBoneNamesToHideField() { return *GetNativePointerField<TArray<FName>*>(this, "APrimalDinoCharacter.FPVRiderBoneNamesToHide"); }
-	float& ExtraRunningSpeedModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ExtraRunningSpeedModifier"); }
-	float& ScaleExtraRunningSpeedModifierMinField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ScaleExtraRunningSpeedModifierMin"); }
-	float& ScaleExtraRunningSpeedModifierMaxField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ScaleExtraRunningSpeedModifierMax"); }
-	float& ScaleExtraRunningSpeedModifierSpeedField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ScaleExtraRunningSpeedModifierSpeed"); }
-	float& LastHigherScaleExtraRunningSpeedValueField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.LastHigherScaleExtraRunningSpeedValue"); }
-	long double& LastHigherScaleExtraRunningSpeedTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastHigherScaleExtraRunningSpeedTime"); }
-	float& RiderMovementSpeedScalingRotationRatePowerMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RiderMovementSpeedScalingRotationRatePowerMultiplier"); }
-	int& LoadDestroyWildDinosUnderVersionField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.LoadDestroyWildDinosUnderVersion"); }
-	int& SaveDestroyWildDinosUnderVersionField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.SaveDestroyWildDinosUnderVersion"); }
-	float& AllowWaterSurfaceExtraJumpStaminaCostField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.AllowWaterSurfaceExtraJumpStaminaCost"); }
-	USoundBase * PlayKillLocalSoundField() { return *GetNativePointerField<USoundBase **>(this, "APrimalDinoCharacter.PlayKillLocalSound"); }
-	TWeakObjectPtr<AActor>& RiderAttackTargetField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*>(this, "APrimalDinoCharacter.RiderAttackTarget"); }
-	FVector& RiderAttackLocationField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.RiderAttackLocation"); }
-	char& TribeGroupPetOrderingRankField() { return *GetNativePointerField<char*>(this, "APrimalDinoCharacter.TribeGroupPetOrderingRank"); }
-	char& TribeGroupPetRidingRankField() { return *GetNativePointerField<char*>(this, "APrimalDinoCharacter.TribeGroupPetRidingRank"); }
-	char& FollowStoppingDistanceField() { return *GetNativePointerField<char*>(this, "APrimalDinoCharacter.FollowStoppingDistance"); }
-	FString& ImprinterNameField() { return *GetNativePointerField<FString*>(this, "APrimalDinoCharacter.ImprinterName"); }
-	unsigned __int64& ImprinterPlayerDataIDField() { return *GetNativePointerField<unsigned __int64*>(this, "APrimalDinoCharacter.ImprinterPlayerDataID"); }
-	float& BabyMinCuddleIntervalField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BabyMinCuddleInterval"); }
-	float& BabyMaxCuddleIntervalField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BabyMaxCuddleInterval"); }
-	float& BabyCuddleGracePeriodField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BabyCuddleGracePeriod"); }
-	float& BabyCuddleLoseImpringQualityPerSecondField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BabyCuddleLoseImpringQualityPerSecond"); }
-	float& BabyCuddleWalkDistanceField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BabyCuddleWalkDistance"); }
-	FVector& BabyCuddleWalkStartingLocationField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.BabyCuddleWalkStartingLocation"); }
-	long double& BabyNextCuddleTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.BabyNextCuddleTime"); }
-	TEnumAsByte<enum EBabyCuddleType::Type>& BabyCuddleTypeField() { return *GetNativePointerField<TEnumAsByte<enum EBabyCuddleType::Type>*>(this, "APrimalDinoCharacter.BabyCuddleType"); }
-	TSubclassOf<UPrimalItem>& BabyCuddleFoodField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "APrimalDinoCharacter.BabyCuddleFood"); }
-	UAnimMontage * BabyCuddledAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.BabyCuddledAnimation"); }
-	TArray<TSubclassOf<UPrimalItem>>& MyBabyCuddleFoodTypesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "APrimalDinoCharacter.MyBabyCuddleFoodTypes"); }
-	float& RiderMaxImprintingQualityDamageReductionField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RiderMaxImprintingQualityDamageReduction"); }
-	float& RiderMaxImprintingQualityDamageMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RiderMaxImprintingQualityDamageMultiplier"); }
-	float& BabyImprintingQualityTotalMaturationTimeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.BabyImprintingQualityTotalMaturationTime"); }
-	float& WakingTameMaxDistanceField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.WakingTameMaxDistance"); }
-	float& TimeBetweenTamedWakingEatAnimationsField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.TimeBetweenTamedWakingEatAnimations"); }
-	long double& LastEatAnimationTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastEatAnimationTime"); }
-	float& StepDamageFootDamageRunningMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.StepDamageFootDamageRunningMultiplier"); }
-	float& maxRangeForWeaponTriggeredTooltipField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.maxRangeForWeaponTriggeredTooltip"); }
-	float& StepRadialDamageOffsetField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.StepRadialDamageOffset"); }
-	float& ForcePawnBigPushingForTimeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ForcePawnBigPushingForTime"); }
-	float& AIDinoForceActiveUntasisingRangeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.AIDinoForceActiveUntasisingRange"); }
-	float& WildRunningRotationRateModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.WildRunningRotationRateModifier"); }
-	float& TamedRunningRotationRateModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.TamedRunningRotationRateModifier"); }
-	float& TamedSwimmingRotationRateModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.TamedSwimmingRotationRateModifier"); }
-	float& WildSwimmingRotationRateModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.WildSwimmingRotationRateModifier"); }
-	float& RiderFlyingRotationRateModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RiderFlyingRotationRateModifier"); }
-	float& NoRiderFlyingRotationRateModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.NoRiderFlyingRotationRateModifier"); }
-	float& AICombatRotationRateModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.AICombatRotationRateModifier"); }
-	float& WalkingRotationRateModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.WalkingRotationRateModifier"); }
-	float& SetAttackTargetTraceDistanceField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.SetAttackTargetTraceDistance"); }
-	float& SetAttackTargetTraceWidthField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.SetAttackTargetTraceWidth"); }
-	float& WanderRadiusMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.WanderRadiusMultiplier"); }
-	long double& RepeatPrimaryAttackLastSendTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.RepeatPrimaryAttackLastSendTime"); }
-	long double& NextTamedDinoCharacterStatusTickTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.NextTamedDinoCharacterStatusTickTime"); }
-	long double& LastTamedDinoCharacterStatusTickTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastTamedDinoCharacterStatusTickTime"); }
-	UAnimMontage * PlayerMountedCarryAnimationField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.PlayerMountedCarryAnimation"); }
-	float& HealthBarOffsetYField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.HealthBarOffsetY"); }
-	float& LimitRiderYawOnLatchedRangeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.LimitRiderYawOnLatchedRange"); }
-	float& LatchingDistanceLimitField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.LatchingDistanceLimit"); }
-	float& LatchingInitialYawField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.LatchingInitialYaw"); }
-	float& LatchingInitialPitchField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.LatchingInitialPitch"); }
-	float& LatchingInterpolatedPitchField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.LatchingInterpolatedPitch"); }
-	float& LatchedFirstPersonViewAngleField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.LatchedFirstPersonViewAngle"); }
-	float& LatchingCameraInterpolationSpeedField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.LatchingCameraInterpolationSpeed"); }
-	float& TargetLatchingInitialYawField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.TargetLatchingInitialYaw"); }
-	float& CurrentStrafeMagnitudeField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.CurrentStrafeMagnitude"); }
-	float& GainStaminaWhenLatchedRateField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.GainStaminaWhenLatchedRate"); }
-	int& LastFrameMoveRightField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.LastFrameMoveRight"); }
-	int& LastFrameMoveLeftField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.LastFrameMoveLeft"); }
-	FRotator& LastRiderMountedWeaponRotationField() { return *GetNativePointerField<FRotator*>(this, "APrimalDinoCharacter.LastRiderMountedWeaponRotation"); }
-	long double& LastRiderMountedWeaponRotationSentTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastRiderMountedWeaponRotationSentTime"); }
-	int& DeathGivesDossierIndexField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.DeathGivesDossierIndex"); }
-	float& DeathGivesDossierDelayField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.DeathGivesDossierDelay"); }
-	FName& SaddleRiderMovementTraceThruSocketNameField() { return *GetNativePointerField<FName*>(this, "APrimalDinoCharacter.SaddleRiderMovementTraceThruSocketName"); }
-	float& SwimmingRunSpeedModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.SwimmingRunSpeedModifier"); }
-	float& RidingSwimmingRunSpeedModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RidingSwimmingRunSpeedModifier"); }
-	long double& DinoDownloadedAtTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.DinoDownloadedAtTime"); }
-	FString& UploadedFromServerNameField() { return *GetNativePointerField<FString*>(this, "APrimalDinoCharacter.UploadedFromServerName"); }
-	FString& LatestUploadedFromServerNameField() { return *GetNativePointerField<FString*>(this, "APrimalDinoCharacter.LatestUploadedFromServerName"); }
-	FString& PreviousUploadedFromServerNameField() { return *GetNativePointerField<FString*>(this, "APrimalDinoCharacter.PreviousUploadedFromServerName"); }
-	FString& TamedOnServerNameField() { return *GetNativePointerField<FString*>(this, "APrimalDinoCharacter.TamedOnServerName"); }
-	TArray<FDinoAncestorsEntry>& DinoAncestorsField() { return *GetNativePointerField<TArray<FDinoAncestorsEntry>*>(this, "APrimalDinoCharacter.DinoAncestors"); }
-	TArray<FDinoAncestorsEntry>& DinoAncestorsMaleField() { return *GetNativePointerField<TArray<FDinoAncestorsEntry>*>(this, "APrimalDinoCharacter.DinoAncestorsMale"); }
-	TArray<FDinoAncestorsEntry>& NextBabyDinoAncestorsField() { return *GetNativePointerField<TArray<FDinoAncestorsEntry>*>(this, "APrimalDinoCharacter.NextBabyDinoAncestors"); }
-	TArray<FDinoAncestorsEntry>& NextBabyDinoAncestorsMaleField() { return *GetNativePointerField<TArray<FDinoAncestorsEntry>*>(this, "APrimalDinoCharacter.NextBabyDinoAncestorsMale"); }
-	int& MaxAllowedRandomMutationsField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.MaxAllowedRandomMutations"); }
-	int& RandomMutationRollsField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.RandomMutationRolls"); }
-	float& RandomMutationChanceField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RandomMutationChance"); }
-	float& RandomMutationGivePointsField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.RandomMutationGivePoints"); }
-	int& RandomMutationsMaleField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.RandomMutationsMale"); }
-	int& RandomMutationsFemaleField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.RandomMutationsFemale"); }
-	int& GestationEggRandomMutationsFemaleField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.GestationEggRandomMutationsFemale"); }
-	int& GestationEggRandomMutationsMaleField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.GestationEggRandomMutationsMale"); }
-	FName& WakingTameDistanceSocketNameField() { return *GetNativePointerField<FName*>(this, "APrimalDinoCharacter.WakingTameDistanceSocketName"); }
-	int& WakingTameConsumeEntireStackMaxQuantityField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.WakingTameConsumeEntireStackMaxQuantity"); }
-	float& AttackPlayerDesirabilityMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.AttackPlayerDesirabilityMultiplier"); }
-	long double& LastAutoHealingItemUseField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastAutoHealingItemUse"); }
-	long double& LastStartedCarryingCharacterTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastStartedCarryingCharacterTime"); }
-	float& FlyerAttachedExplosiveSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.FlyerAttachedExplosiveSpeedMultiplier"); }
-	TArray<FDinoExtraDefaultItemList>& DinoExtraDefaultInventoryItemsField() { return *GetNativePointerField<TArray<FDinoExtraDefaultItemList>*>(this, "APrimalDinoCharacter.DinoExtraDefaultInventoryItems"); }
-	TArray<TSubclassOf<UPrimalItem>>& DeathGiveEngramClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "APrimalDinoCharacter.DeathGiveEngramClasses"); }
-	float& SinglePlayerOutgoingDamageModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.SinglePlayerOutgoingDamageModifier"); }
-	float& SinglePlayerIncomingDamageModifierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.SinglePlayerIncomingDamageModifier"); }
-	int& LastTickDelayFrameCountField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.LastTickDelayFrameCount"); }
-	long double& NextTickDelayAllowTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.NextTickDelayAllowTime"); }
-	float& TickStatusTimeAccumulationField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.TickStatusTimeAccumulation"); }
-	long double& LastServerTamedTickField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastServerTamedTick"); }
-	int& LastTempDampenMovementInputAccelerationFrameField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.LastTempDampenMovementInputAccelerationFrame"); }
-	UAnimMontage * DinoLevelUpAnimationOverrideField() { return *GetNativePointerField<UAnimMontage **>(this, "APrimalDinoCharacter.DinoLevelUpAnimationOverride"); }
-	TArray<TSubclassOf<AActor>>& DamageVictimClassesIgnoreBlockingGeomtryTraceField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*>(this, "APrimalDinoCharacter.DamageVictimClassesIgnoreBlockingGeomtryTrace"); }
-	long double& LastVacuumSpaceCheckTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastVacuumSpaceCheckTime"); }
-	long double& LastGrappledTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.LastGrappledTime"); }
-	float& CloneBaseElementCostField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.CloneBaseElementCost"); }
-	float& CloneElementCostPerLevelField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.CloneElementCostPerLevel"); }
-	FName& NonDedicatedFreezeWildDinoPhysicsIfLevelUnloadedField() { return *GetNativePointerField<FName*>(this, "APrimalDinoCharacter.NonDedicatedFreezeWildDinoPhysicsIfLevelUnloaded"); }
-	TArray<FName>& NonDedicatedFreezeWildDinoPhysicsIfLevelsUnloadedField() { return *GetNativePointerField<TArray<FName>*>(this, "APrimalDinoCharacter.NonDedicatedFreezeWildDinoPhysicsIfLevelsUnloaded"); }
-	FVector& UnboardLocationTraceOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoCharacter.UnboardLocationTraceOffset"); }
-	FName& AttackLineOfSightMeshSocketNameField() { return *GetNativePointerField<FName*>(this, "APrimalDinoCharacter.AttackLineOfSightMeshSocketName"); }
-	float& AttackForceWalkDistanceMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.AttackForceWalkDistanceMultiplier"); }
-	float& AttackForceWalkRotationRateMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.AttackForceWalkRotationRateMultiplier"); }
-	int& OverrideDinoTameSoundIndexField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.OverrideDinoTameSoundIndex"); }
-	USoundBase * SwimSoundField() { return *GetNativePointerField<USoundBase **>(this, "APrimalDinoCharacter.SwimSound"); }
-	float& SwimSoundIntervalPerHundredSpeedField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.SwimSoundIntervalPerHundredSpeed"); }
-	float& SwimSoundTimeCacheField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.SwimSoundTimeCache"); }
-	TSubclassOf<AController>& TamedAIControllerOverrideField() { return *GetNativePointerField<TSubclassOf<AController>*>(this, "APrimalDinoCharacter.TamedAIControllerOverride"); }
-	int& PersonalTamedDinoCostField() { return *GetNativePointerField<int*>(this, "APrimalDinoCharacter.PersonalTamedDinoCost"); }
-	long double& UploadEarliestValidTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoCharacter.UploadEarliestValidTime"); }
-	float& StasisAutoDestroyIntervalField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.StasisAutoDestroyInterval"); }
-	float& CarryCameraYawOffsetField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.CarryCameraYawOffset"); }
-	float& ExtraDamageMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ExtraDamageMultiplier"); }
-	float& ExtraTamedBaseHealthMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.ExtraTamedBaseHealthMultiplier"); }
-	float& AttackRangeOffsetField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.AttackRangeOffset"); }
-	char& CurrentPassengerSeatIndexField() { return *GetNativePointerField<char*>(this, "APrimalDinoCharacter.CurrentPassengerSeatIndex"); }
-	float& OverrideApproachRadiusField() { return *GetNativePointerField<float*>(this, "APrimalDinoCharacter.OverrideApproachRadius"); }
-	UStaticMesh * UniqueDino_MapMarkerMeshField() { return *GetNativePointerField<UStaticMesh **>(this, "APrimalDinoCharacter.UniqueDino_MapMarkerMesh"); }
-	FColor& UniqueDino_MapMarkerColorField() { return *GetNativePointerField<FColor*>(this, "APrimalDinoCharacter.UniqueDino_MapMarkerColor"); }
+	float& NewFemaleMinTimeBetweenMatingField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.NewFemaleMinTimeBetweenMating")>(this, "APrimalDinoCharacter.NewFemaleMinTimeBetweenMating"); }
+	float& NewFemaleMaxTimeBetweenMatingField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.NewFemaleMaxTimeBetweenMating")>(this, "APrimalDinoCharacter.NewFemaleMaxTimeBetweenMating"); }
+	TArray<TSubclassOf<APrimalBuff>>& DefaultTamedBuffsField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalBuff>>*, API::FieldNameHash("APrimalDinoCharacter.DefaultTamedBuffs")>(this, "APrimalDinoCharacter.DefaultTamedBuffs"); }
+	FVector& InterpolatedVelocityField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.InterpolatedVelocity")>(this, "APrimalDinoCharacter.InterpolatedVelocity"); }
+	FVector& OldInterpolatedLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.OldInterpolatedLocation")>(this, "APrimalDinoCharacter.OldInterpolatedLocation"); }
+	float& HyperThermiaInsulationField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.HyperThermiaInsulation")>(this, "APrimalDinoCharacter.HyperThermiaInsulation"); }
+	float& HypoThermiaInsulationField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.HypoThermiaInsulation")>(this, "APrimalDinoCharacter.HypoThermiaInsulation"); }
+	float& InsulationRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.InsulationRange")>(this, "APrimalDinoCharacter.InsulationRange"); }
+	float& GangOverlapRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.GangOverlapRange")>(this, "APrimalDinoCharacter.GangOverlapRange"); }
+	float& GangDamageResistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.GangDamageResistance")>(this, "APrimalDinoCharacter.GangDamageResistance"); }
+	float& GangDamageField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.GangDamage")>(this, "APrimalDinoCharacter.GangDamage"); }
+	int& MaxGangCountField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.MaxGangCount")>(this, "APrimalDinoCharacter.MaxGangCount"); }
+	int& GangCountField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.GangCount")>(this, "APrimalDinoCharacter.GangCount"); }
+	long double& LastGangCheckTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastGangCheckTime")>(this, "APrimalDinoCharacter.LastGangCheckTime"); }
+	FVector& LastGangCheckPositionField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.LastGangCheckPosition")>(this, "APrimalDinoCharacter.LastGangCheckPosition"); }
+	int& PreviousTargetingTeamField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.PreviousTargetingTeam")>(this, "APrimalDinoCharacter.PreviousTargetingTeam"); }
+	int& LastRiderExitFrameCounterField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.LastRiderExitFrameCounter")>(this, "APrimalDinoCharacter.LastRiderExitFrameCounter"); }
+	float& WildRandomScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.WildRandomScale")>(this, "APrimalDinoCharacter.WildRandomScale"); }
+	float& HeldJumpSlowFallingGravityZScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.HeldJumpSlowFallingGravityZScale")>(this, "APrimalDinoCharacter.HeldJumpSlowFallingGravityZScale"); }
+	UAnimMontage * SlowFallingAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.SlowFallingAnim")>(this, "APrimalDinoCharacter.SlowFallingAnim"); }
+	float& SlowFallingStaminaCostPerSecondField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.SlowFallingStaminaCostPerSecond")>(this, "APrimalDinoCharacter.SlowFallingStaminaCostPerSecond"); }
+	float& NoRiderRotationModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.NoRiderRotationModifier")>(this, "APrimalDinoCharacter.NoRiderRotationModifier"); }
+	FName& RiderFPVCameraUseSocketNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalDinoCharacter.RiderFPVCameraUseSocketName")>(this, "APrimalDinoCharacter.RiderFPVCameraUseSocketName"); }
+	FName& RiderLatchedFPVCameraUseSocketNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalDinoCharacter.RiderLatchedFPVCameraUseSocketName")>(this, "APrimalDinoCharacter.RiderLatchedFPVCameraUseSocketName"); }
+	FName& PassengerFPVCameraRootSocketField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalDinoCharacter.PassengerFPVCameraRootSocket")>(this, "APrimalDinoCharacter.PassengerFPVCameraRootSocket"); }
+	TArray<FName>& FPVRiderBoneNamesToHideField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("APrimalDinoCharacter.FPVRiderBoneNamesToHide")>(this, "APrimalDinoCharacter.FPVRiderBoneNamesToHide"); }
+	float& ExtraRunningSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ExtraRunningSpeedModifier")>(this, "APrimalDinoCharacter.ExtraRunningSpeedModifier"); }
+	float& ScaleExtraRunningSpeedModifierMinField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ScaleExtraRunningSpeedModifierMin")>(this, "APrimalDinoCharacter.ScaleExtraRunningSpeedModifierMin"); }
+	float& ScaleExtraRunningSpeedModifierMaxField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ScaleExtraRunningSpeedModifierMax")>(this, "APrimalDinoCharacter.ScaleExtraRunningSpeedModifierMax"); }
+	float& ScaleExtraRunningSpeedModifierSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ScaleExtraRunningSpeedModifierSpeed")>(this, "APrimalDinoCharacter.ScaleExtraRunningSpeedModifierSpeed"); }
+	float& LastHigherScaleExtraRunningSpeedValueField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.LastHigherScaleExtraRunningSpeedValue")>(this, "APrimalDinoCharacter.LastHigherScaleExtraRunningSpeedValue"); }
+	long double& LastHigherScaleExtraRunningSpeedTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastHigherScaleExtraRunningSpeedTime")>(this, "APrimalDinoCharacter.LastHigherScaleExtraRunningSpeedTime"); }
+	float& RiderMovementSpeedScalingRotationRatePowerMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RiderMovementSpeedScalingRotationRatePowerMultiplier")>(this, "APrimalDinoCharacter.RiderMovementSpeedScalingRotationRatePowerMultiplier"); }
+	int& LoadDestroyWildDinosUnderVersionField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.LoadDestroyWildDinosUnderVersion")>(this, "APrimalDinoCharacter.LoadDestroyWildDinosUnderVersion"); }
+	int& SaveDestroyWildDinosUnderVersionField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.SaveDestroyWildDinosUnderVersion")>(this, "APrimalDinoCharacter.SaveDestroyWildDinosUnderVersion"); }
+	float& AllowWaterSurfaceExtraJumpStaminaCostField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.AllowWaterSurfaceExtraJumpStaminaCost")>(this, "APrimalDinoCharacter.AllowWaterSurfaceExtraJumpStaminaCost"); }
+	USoundBase * PlayKillLocalSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("APrimalDinoCharacter.PlayKillLocalSound")>(this, "APrimalDinoCharacter.PlayKillLocalSound"); }
+	TWeakObjectPtr<AActor>& RiderAttackTargetField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*, API::FieldNameHash("APrimalDinoCharacter.RiderAttackTarget")>(this, "APrimalDinoCharacter.RiderAttackTarget"); }
+	FVector& RiderAttackLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.RiderAttackLocation")>(this, "APrimalDinoCharacter.RiderAttackLocation"); }
+	char& TribeGroupPetOrderingRankField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalDinoCharacter.TribeGroupPetOrderingRank")>(this, "APrimalDinoCharacter.TribeGroupPetOrderingRank"); }
+	char& TribeGroupPetRidingRankField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalDinoCharacter.TribeGroupPetRidingRank")>(this, "APrimalDinoCharacter.TribeGroupPetRidingRank"); }
+	char& FollowStoppingDistanceField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalDinoCharacter.FollowStoppingDistance")>(this, "APrimalDinoCharacter.FollowStoppingDistance"); }
+	FString& ImprinterNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalDinoCharacter.ImprinterName")>(this, "APrimalDinoCharacter.ImprinterName"); }
+	unsigned __int64& ImprinterPlayerDataIDField() { return *GetNativePointerField<unsigned __int64*, API::FieldNameHash("APrimalDinoCharacter.ImprinterPlayerDataID")>(this, "APrimalDinoCharacter.ImprinterPlayerDataID"); }
+	float& BabyMinCuddleIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BabyMinCuddleInterval")>(this, "APrimalDinoCharacter.BabyMinCuddleInterval"); }
+	float& BabyMaxCuddleIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BabyMaxCuddleInterval")>(this, "APrimalDinoCharacter.BabyMaxCuddleInterval"); }
+	float& BabyCuddleGracePeriodField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BabyCuddleGracePeriod")>(this, "APrimalDinoCharacter.BabyCuddleGracePeriod"); }
+	float& BabyCuddleLoseImpringQualityPerSecondField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BabyCuddleLoseImpringQualityPerSecond")>(this, "APrimalDinoCharacter.BabyCuddleLoseImpringQualityPerSecond"); }
+	float& BabyCuddleWalkDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BabyCuddleWalkDistance")>(this, "APrimalDinoCharacter.BabyCuddleWalkDistance"); }
+	FVector& BabyCuddleWalkStartingLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.BabyCuddleWalkStartingLocation")>(this, "APrimalDinoCharacter.BabyCuddleWalkStartingLocation"); }
+	long double& BabyNextCuddleTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.BabyNextCuddleTime")>(this, "APrimalDinoCharacter.BabyNextCuddleTime"); }
+	TEnumAsByte<enum EBabyCuddleType::Type>& BabyCuddleTypeField() { return *GetNativePointerField<TEnumAsByte<enum EBabyCuddleType::Type>*, API::FieldNameHash("APrimalDinoCharacter.BabyCuddleType")>(this, "APrimalDinoCharacter.BabyCuddleType"); }
+	TSubclassOf<UPrimalItem>& BabyCuddleFoodField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("APrimalDinoCharacter.BabyCuddleFood")>(this, "APrimalDinoCharacter.BabyCuddleFood"); }
+	UAnimMontage * BabyCuddledAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.BabyCuddledAnimation")>(this, "APrimalDinoCharacter.BabyCuddledAnimation"); }
+	TArray<TSubclassOf<UPrimalItem>>& MyBabyCuddleFoodTypesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("APrimalDinoCharacter.MyBabyCuddleFoodTypes")>(this, "APrimalDinoCharacter.MyBabyCuddleFoodTypes"); }
+	float& RiderMaxImprintingQualityDamageReductionField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RiderMaxImprintingQualityDamageReduction")>(this, "APrimalDinoCharacter.RiderMaxImprintingQualityDamageReduction"); }
+	float& RiderMaxImprintingQualityDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RiderMaxImprintingQualityDamageMultiplier")>(this, "APrimalDinoCharacter.RiderMaxImprintingQualityDamageMultiplier"); }
+	float& BabyImprintingQualityTotalMaturationTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.BabyImprintingQualityTotalMaturationTime")>(this, "APrimalDinoCharacter.BabyImprintingQualityTotalMaturationTime"); }
+	float& WakingTameMaxDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.WakingTameMaxDistance")>(this, "APrimalDinoCharacter.WakingTameMaxDistance"); }
+	float& TimeBetweenTamedWakingEatAnimationsField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.TimeBetweenTamedWakingEatAnimations")>(this, "APrimalDinoCharacter.TimeBetweenTamedWakingEatAnimations"); }
+	long double& LastEatAnimationTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastEatAnimationTime")>(this, "APrimalDinoCharacter.LastEatAnimationTime"); }
+	float& StepDamageFootDamageRunningMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.StepDamageFootDamageRunningMultiplier")>(this, "APrimalDinoCharacter.StepDamageFootDamageRunningMultiplier"); }
+	float& maxRangeForWeaponTriggeredTooltipField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.maxRangeForWeaponTriggeredTooltip")>(this, "APrimalDinoCharacter.maxRangeForWeaponTriggeredTooltip"); }
+	float& StepRadialDamageOffsetField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.StepRadialDamageOffset")>(this, "APrimalDinoCharacter.StepRadialDamageOffset"); }
+	float& ForcePawnBigPushingForTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ForcePawnBigPushingForTime")>(this, "APrimalDinoCharacter.ForcePawnBigPushingForTime"); }
+	float& AIDinoForceActiveUntasisingRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.AIDinoForceActiveUntasisingRange")>(this, "APrimalDinoCharacter.AIDinoForceActiveUntasisingRange"); }
+	float& WildRunningRotationRateModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.WildRunningRotationRateModifier")>(this, "APrimalDinoCharacter.WildRunningRotationRateModifier"); }
+	float& TamedRunningRotationRateModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.TamedRunningRotationRateModifier")>(this, "APrimalDinoCharacter.TamedRunningRotationRateModifier"); }
+	float& TamedSwimmingRotationRateModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.TamedSwimmingRotationRateModifier")>(this, "APrimalDinoCharacter.TamedSwimmingRotationRateModifier"); }
+	float& WildSwimmingRotationRateModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.WildSwimmingRotationRateModifier")>(this, "APrimalDinoCharacter.WildSwimmingRotationRateModifier"); }
+	float& RiderFlyingRotationRateModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RiderFlyingRotationRateModifier")>(this, "APrimalDinoCharacter.RiderFlyingRotationRateModifier"); }
+	float& NoRiderFlyingRotationRateModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.NoRiderFlyingRotationRateModifier")>(this, "APrimalDinoCharacter.NoRiderFlyingRotationRateModifier"); }
+	float& AICombatRotationRateModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.AICombatRotationRateModifier")>(this, "APrimalDinoCharacter.AICombatRotationRateModifier"); }
+	float& WalkingRotationRateModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.WalkingRotationRateModifier")>(this, "APrimalDinoCharacter.WalkingRotationRateModifier"); }
+	float& SetAttackTargetTraceDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.SetAttackTargetTraceDistance")>(this, "APrimalDinoCharacter.SetAttackTargetTraceDistance"); }
+	float& SetAttackTargetTraceWidthField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.SetAttackTargetTraceWidth")>(this, "APrimalDinoCharacter.SetAttackTargetTraceWidth"); }
+	float& WanderRadiusMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.WanderRadiusMultiplier")>(this, "APrimalDinoCharacter.WanderRadiusMultiplier"); }
+	long double& RepeatPrimaryAttackLastSendTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.RepeatPrimaryAttackLastSendTime")>(this, "APrimalDinoCharacter.RepeatPrimaryAttackLastSendTime"); }
+	long double& NextTamedDinoCharacterStatusTickTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.NextTamedDinoCharacterStatusTickTime")>(this, "APrimalDinoCharacter.NextTamedDinoCharacterStatusTickTime"); }
+	long double& LastTamedDinoCharacterStatusTickTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastTamedDinoCharacterStatusTickTime")>(this, "APrimalDinoCharacter.LastTamedDinoCharacterStatusTickTime"); }
+	UAnimMontage * PlayerMountedCarryAnimationField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.PlayerMountedCarryAnimation")>(this, "APrimalDinoCharacter.PlayerMountedCarryAnimation"); }
+	float& HealthBarOffsetYField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.HealthBarOffsetY")>(this, "APrimalDinoCharacter.HealthBarOffsetY"); }
+	float& LimitRiderYawOnLatchedRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.LimitRiderYawOnLatchedRange")>(this, "APrimalDinoCharacter.LimitRiderYawOnLatchedRange"); }
+	float& LatchingDistanceLimitField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.LatchingDistanceLimit")>(this, "APrimalDinoCharacter.LatchingDistanceLimit"); }
+	float& LatchingInitialYawField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.LatchingInitialYaw")>(this, "APrimalDinoCharacter.LatchingInitialYaw"); }
+	float& LatchingInitialPitchField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.LatchingInitialPitch")>(this, "APrimalDinoCharacter.LatchingInitialPitch"); }
+	float& LatchingInterpolatedPitchField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.LatchingInterpolatedPitch")>(this, "APrimalDinoCharacter.LatchingInterpolatedPitch"); }
+	float& LatchedFirstPersonViewAngleField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.LatchedFirstPersonViewAngle")>(this, "APrimalDinoCharacter.LatchedFirstPersonViewAngle"); }
+	float& LatchingCameraInterpolationSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.LatchingCameraInterpolationSpeed")>(this, "APrimalDinoCharacter.LatchingCameraInterpolationSpeed"); }
+	float& TargetLatchingInitialYawField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.TargetLatchingInitialYaw")>(this, "APrimalDinoCharacter.TargetLatchingInitialYaw"); }
+	float& CurrentStrafeMagnitudeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.CurrentStrafeMagnitude")>(this, "APrimalDinoCharacter.CurrentStrafeMagnitude"); }
+	float& GainStaminaWhenLatchedRateField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.GainStaminaWhenLatchedRate")>(this, "APrimalDinoCharacter.GainStaminaWhenLatchedRate"); }
+	int& LastFrameMoveRightField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.LastFrameMoveRight")>(this, "APrimalDinoCharacter.LastFrameMoveRight"); }
+	int& LastFrameMoveLeftField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.LastFrameMoveLeft")>(this, "APrimalDinoCharacter.LastFrameMoveLeft"); }
+	FRotator& LastRiderMountedWeaponRotationField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalDinoCharacter.LastRiderMountedWeaponRotation")>(this, "APrimalDinoCharacter.LastRiderMountedWeaponRotation"); }
+	long double& LastRiderMountedWeaponRotationSentTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastRiderMountedWeaponRotationSentTime")>(this, "APrimalDinoCharacter.LastRiderMountedWeaponRotationSentTime"); }
+	int& DeathGivesDossierIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.DeathGivesDossierIndex")>(this, "APrimalDinoCharacter.DeathGivesDossierIndex"); }
+	float& DeathGivesDossierDelayField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.DeathGivesDossierDelay")>(this, "APrimalDinoCharacter.DeathGivesDossierDelay"); }
+	FName& SaddleRiderMovementTraceThruSocketNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalDinoCharacter.SaddleRiderMovementTraceThruSocketName")>(this, "APrimalDinoCharacter.SaddleRiderMovementTraceThruSocketName"); }
+	float& SwimmingRunSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.SwimmingRunSpeedModifier")>(this, "APrimalDinoCharacter.SwimmingRunSpeedModifier"); }
+	float& RidingSwimmingRunSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RidingSwimmingRunSpeedModifier")>(this, "APrimalDinoCharacter.RidingSwimmingRunSpeedModifier"); }
+	long double& DinoDownloadedAtTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.DinoDownloadedAtTime")>(this, "APrimalDinoCharacter.DinoDownloadedAtTime"); }
+	FString& UploadedFromServerNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalDinoCharacter.UploadedFromServerName")>(this, "APrimalDinoCharacter.UploadedFromServerName"); }
+	FString& LatestUploadedFromServerNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalDinoCharacter.LatestUploadedFromServerName")>(this, "APrimalDinoCharacter.LatestUploadedFromServerName"); }
+	FString& PreviousUploadedFromServerNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalDinoCharacter.PreviousUploadedFromServerName")>(this, "APrimalDinoCharacter.PreviousUploadedFromServerName"); }
+	FString& TamedOnServerNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalDinoCharacter.TamedOnServerName")>(this, "APrimalDinoCharacter.TamedOnServerName"); }
+	TArray<FDinoAncestorsEntry>& DinoAncestorsField() { return *GetNativePointerField<TArray<FDinoAncestorsEntry>*, API::FieldNameHash("APrimalDinoCharacter.DinoAncestors")>(this, "APrimalDinoCharacter.DinoAncestors"); }
+	TArray<FDinoAncestorsEntry>& DinoAncestorsMaleField() { return *GetNativePointerField<TArray<FDinoAncestorsEntry>*, API::FieldNameHash("APrimalDinoCharacter.DinoAncestorsMale")>(this, "APrimalDinoCharacter.DinoAncestorsMale"); }
+	TArray<FDinoAncestorsEntry>& NextBabyDinoAncestorsField() { return *GetNativePointerField<TArray<FDinoAncestorsEntry>*, API::FieldNameHash("APrimalDinoCharacter.NextBabyDinoAncestors")>(this, "APrimalDinoCharacter.NextBabyDinoAncestors"); }
+	TArray<FDinoAncestorsEntry>& NextBabyDinoAncestorsMaleField() { return *GetNativePointerField<TArray<FDinoAncestorsEntry>*, API::FieldNameHash("APrimalDinoCharacter.NextBabyDinoAncestorsMale")>(this, "APrimalDinoCharacter.NextBabyDinoAncestorsMale"); }
+	int& MaxAllowedRandomMutationsField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.MaxAllowedRandomMutations")>(this, "APrimalDinoCharacter.MaxAllowedRandomMutations"); }
+	int& RandomMutationRollsField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.RandomMutationRolls")>(this, "APrimalDinoCharacter.RandomMutationRolls"); }
+	float& RandomMutationChanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RandomMutationChance")>(this, "APrimalDinoCharacter.RandomMutationChance"); }
+	float& RandomMutationGivePointsField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.RandomMutationGivePoints")>(this, "APrimalDinoCharacter.RandomMutationGivePoints"); }
+	int& RandomMutationsMaleField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.RandomMutationsMale")>(this, "APrimalDinoCharacter.RandomMutationsMale"); }
+	int& RandomMutationsFemaleField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.RandomMutationsFemale")>(this, "APrimalDinoCharacter.RandomMutationsFemale"); }
+	int& GestationEggRandomMutationsFemaleField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.GestationEggRandomMutationsFemale")>(this, "APrimalDinoCharacter.GestationEggRandomMutationsFemale"); }
+	int& GestationEggRandomMutationsMaleField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.GestationEggRandomMutationsMale")>(this, "APrimalDinoCharacter.GestationEggRandomMutationsMale"); }
+	FName& WakingTameDistanceSocketNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalDinoCharacter.WakingTameDistanceSocketName")>(this, "APrimalDinoCharacter.WakingTameDistanceSocketName"); }
+	int& WakingTameConsumeEntireStackMaxQuantityField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.WakingTameConsumeEntireStackMaxQuantity")>(this, "APrimalDinoCharacter.WakingTameConsumeEntireStackMaxQuantity"); }
+	float& AttackPlayerDesirabilityMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.AttackPlayerDesirabilityMultiplier")>(this, "APrimalDinoCharacter.AttackPlayerDesirabilityMultiplier"); }
+	long double& LastAutoHealingItemUseField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastAutoHealingItemUse")>(this, "APrimalDinoCharacter.LastAutoHealingItemUse"); }
+	long double& LastStartedCarryingCharacterTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastStartedCarryingCharacterTime")>(this, "APrimalDinoCharacter.LastStartedCarryingCharacterTime"); }
+	float& FlyerAttachedExplosiveSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.FlyerAttachedExplosiveSpeedMultiplier")>(this, "APrimalDinoCharacter.FlyerAttachedExplosiveSpeedMultiplier"); }
+	TArray<FDinoExtraDefaultItemList>& DinoExtraDefaultInventoryItemsField() { return *GetNativePointerField<TArray<FDinoExtraDefaultItemList>*, API::FieldNameHash("APrimalDinoCharacter.DinoExtraDefaultInventoryItems")>(this, "APrimalDinoCharacter.DinoExtraDefaultInventoryItems"); }
+	TArray<TSubclassOf<UPrimalItem>>& DeathGiveEngramClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("APrimalDinoCharacter.DeathGiveEngramClasses")>(this, "APrimalDinoCharacter.DeathGiveEngramClasses"); }
+	float& SinglePlayerOutgoingDamageModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.SinglePlayerOutgoingDamageModifier")>(this, "APrimalDinoCharacter.SinglePlayerOutgoingDamageModifier"); }
+	float& SinglePlayerIncomingDamageModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.SinglePlayerIncomingDamageModifier")>(this, "APrimalDinoCharacter.SinglePlayerIncomingDamageModifier"); }
+	int& LastTickDelayFrameCountField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.LastTickDelayFrameCount")>(this, "APrimalDinoCharacter.LastTickDelayFrameCount"); }
+	long double& NextTickDelayAllowTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.NextTickDelayAllowTime")>(this, "APrimalDinoCharacter.NextTickDelayAllowTime"); }
+	float& TickStatusTimeAccumulationField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.TickStatusTimeAccumulation")>(this, "APrimalDinoCharacter.TickStatusTimeAccumulation"); }
+	long double& LastServerTamedTickField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastServerTamedTick")>(this, "APrimalDinoCharacter.LastServerTamedTick"); }
+	int& LastTempDampenMovementInputAccelerationFrameField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.LastTempDampenMovementInputAccelerationFrame")>(this, "APrimalDinoCharacter.LastTempDampenMovementInputAccelerationFrame"); }
+	UAnimMontage * DinoLevelUpAnimationOverrideField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("APrimalDinoCharacter.DinoLevelUpAnimationOverride")>(this, "APrimalDinoCharacter.DinoLevelUpAnimationOverride"); }
+	TArray<TSubclassOf<AActor>>& DamageVictimClassesIgnoreBlockingGeomtryTraceField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*, API::FieldNameHash("APrimalDinoCharacter.DamageVictimClassesIgnoreBlockingGeomtryTrace")>(this, "APrimalDinoCharacter.DamageVictimClassesIgnoreBlockingGeomtryTrace"); }
+	long double& LastVacuumSpaceCheckTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastVacuumSpaceCheckTime")>(this, "APrimalDinoCharacter.LastVacuumSpaceCheckTime"); }
+	long double& LastGrappledTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.LastGrappledTime")>(this, "APrimalDinoCharacter.LastGrappledTime"); }
+	float& CloneBaseElementCostField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.CloneBaseElementCost")>(this, "APrimalDinoCharacter.CloneBaseElementCost"); }
+	float& CloneElementCostPerLevelField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.CloneElementCostPerLevel")>(this, "APrimalDinoCharacter.CloneElementCostPerLevel"); }
+	FName& NonDedicatedFreezeWildDinoPhysicsIfLevelUnloadedField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalDinoCharacter.NonDedicatedFreezeWildDinoPhysicsIfLevelUnloaded")>(this, "APrimalDinoCharacter.NonDedicatedFreezeWildDinoPhysicsIfLevelUnloaded"); }
+	TArray<FName>& NonDedicatedFreezeWildDinoPhysicsIfLevelsUnloadedField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("APrimalDinoCharacter.NonDedicatedFreezeWildDinoPhysicsIfLevelsUnloaded")>(this, "APrimalDinoCharacter.NonDedicatedFreezeWildDinoPhysicsIfLevelsUnloaded"); }
+	FVector& UnboardLocationTraceOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoCharacter.UnboardLocationTraceOffset")>(this, "APrimalDinoCharacter.UnboardLocationTraceOffset"); }
+	FName& AttackLineOfSightMeshSocketNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalDinoCharacter.AttackLineOfSightMeshSocketName")>(this, "APrimalDinoCharacter.AttackLineOfSightMeshSocketName"); }
+	float& AttackForceWalkDistanceMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.AttackForceWalkDistanceMultiplier")>(this, "APrimalDinoCharacter.AttackForceWalkDistanceMultiplier"); }
+	float& AttackForceWalkRotationRateMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.AttackForceWalkRotationRateMultiplier")>(this, "APrimalDinoCharacter.AttackForceWalkRotationRateMultiplier"); }
+	int& OverrideDinoTameSoundIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.OverrideDinoTameSoundIndex")>(this, "APrimalDinoCharacter.OverrideDinoTameSoundIndex"); }
+	USoundBase * SwimSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("APrimalDinoCharacter.SwimSound")>(this, "APrimalDinoCharacter.SwimSound"); }
+	float& SwimSoundIntervalPerHundredSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.SwimSoundIntervalPerHundredSpeed")>(this, "APrimalDinoCharacter.SwimSoundIntervalPerHundredSpeed"); }
+	float& SwimSoundTimeCacheField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.SwimSoundTimeCache")>(this, "APrimalDinoCharacter.SwimSoundTimeCache"); }
+	TSubclassOf<AController>& TamedAIControllerOverrideField() { return *GetNativePointerField<TSubclassOf<AController>*, API::FieldNameHash("APrimalDinoCharacter.TamedAIControllerOverride")>(this, "APrimalDinoCharacter.TamedAIControllerOverride"); }
+	int& PersonalTamedDinoCostField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoCharacter.PersonalTamedDinoCost")>(this, "APrimalDinoCharacter.PersonalTamedDinoCost"); }
+	long double& UploadEarliestValidTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoCharacter.UploadEarliestValidTime")>(this, "APrimalDinoCharacter.UploadEarliestValidTime"); }
+	float& StasisAutoDestroyIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.StasisAutoDestroyInterval")>(this, "APrimalDinoCharacter.StasisAutoDestroyInterval"); }
+	float& CarryCameraYawOffsetField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.CarryCameraYawOffset")>(this, "APrimalDinoCharacter.CarryCameraYawOffset"); }
+	float& ExtraDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ExtraDamageMultiplier")>(this, "APrimalDinoCharacter.ExtraDamageMultiplier"); }
+	float& ExtraTamedBaseHealthMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.ExtraTamedBaseHealthMultiplier")>(this, "APrimalDinoCharacter.ExtraTamedBaseHealthMultiplier"); }
+	float& AttackRangeOffsetField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.AttackRangeOffset")>(this, "APrimalDinoCharacter.AttackRangeOffset"); }
+	char& CurrentPassengerSeatIndexField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalDinoCharacter.CurrentPassengerSeatIndex")>(this, "APrimalDinoCharacter.CurrentPassengerSeatIndex"); }
+	float& OverrideApproachRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoCharacter.OverrideApproachRadius")>(this, "APrimalDinoCharacter.OverrideApproachRadius"); }
+	UStaticMesh * UniqueDino_MapMarkerMeshField() { return *GetNativePointerField<UStaticMesh **, API::FieldNameHash("APrimalDinoCharacter.UniqueDino_MapMarkerMesh")>(this, "APrimalDinoCharacter.UniqueDino_MapMarkerMesh"); }
+	FColor& UniqueDino_MapMarkerColorField() { return *GetNativePointerField<FColor*, API::FieldNameHash("APrimalDinoCharacter.UniqueDino_MapMarkerColor")>(this, "APrimalDinoCharacter.UniqueDino_MapMarkerColor"); }
 
 	// Bit fields
 
@@ -5413,164 +5413,164 @@ struct APrimalDinoCharacter : APrimalCharacter
 
 struct AShooterWeapon : AActor
 {
-	float& EquipTimeField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.EquipTime"); }
-	UAnimMontage * OverrideProneInAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterWeapon.OverrideProneInAnim"); }
-	UAnimMontage * OverrideProneOutAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterWeapon.OverrideProneOutAnim"); }
-	UAnimMontage * OverrideJumpAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterWeapon.OverrideJumpAnim"); }
-	UAnimMontage * OverrideLandedAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterWeapon.OverrideLandedAnim"); }
-	TArray<UAnimSequence *> OverrideRiderAnimSequenceFromField() { return *GetNativePointerField<TArray<UAnimSequence *>*>(this, "AShooterWeapon.OverrideRiderAnimSequenceFrom"); }
-	TArray<UAnimSequence *> OverrideRiderAnimSequenceToField() { return *GetNativePointerField<TArray<UAnimSequence *>*>(this, "AShooterWeapon.OverrideRiderAnimSequenceTo"); }
-	float& ItemDurabilityToConsumePerMeleeHitField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.ItemDurabilityToConsumePerMeleeHit"); }
-	float& AmmoIconsCountField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.AmmoIconsCount"); }
-	float& TargetingTooltipCheckRangeField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.TargetingTooltipCheckRange"); }
-	int& PrimaryClipIconOffsetField() { return *GetNativePointerField<int*>(this, "AShooterWeapon.PrimaryClipIconOffset"); }
-	int& SecondaryClipIconOffsetField() { return *GetNativePointerField<int*>(this, "AShooterWeapon.SecondaryClipIconOffset"); }
-	FVector2D& TargetingInfoTooltipPaddingField() { return *GetNativePointerField<FVector2D*>(this, "AShooterWeapon.TargetingInfoTooltipPadding"); }
-	FVector2D& TargetingInfoTooltipScaleField() { return *GetNativePointerField<FVector2D*>(this, "AShooterWeapon.TargetingInfoTooltipScale"); }
-	bool& bOnlyPassiveDurabilityWhenAccessoryActiveField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bOnlyPassiveDurabilityWhenAccessoryActive"); }
-	bool& bDisableShooterOnElectricStormField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bDisableShooterOnElectricStorm"); }
-	FName& OverrideAttachPointField() { return *GetNativePointerField<FName*>(this, "AShooterWeapon.OverrideAttachPoint"); }
-	FVector& FPVRelativeLocationField() { return *GetNativePointerField<FVector*>(this, "AShooterWeapon.FPVRelativeLocation"); }
-	FRotator& FPVRelativeRotationField() { return *GetNativePointerField<FRotator*>(this, "AShooterWeapon.FPVRelativeRotation"); }
-	FVector& FPVRelativeLocation_TargetingField() { return *GetNativePointerField<FVector*>(this, "AShooterWeapon.FPVRelativeLocation_Targeting"); }
-	FRotator& FPVRelativeRotation_TargetingField() { return *GetNativePointerField<FRotator*>(this, "AShooterWeapon.FPVRelativeRotation_Targeting"); }
-	float& FPVEnterTargetingInterpSpeedField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.FPVEnterTargetingInterpSpeed"); }
-	float& FPVExitTargetingInterpSpeedField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.FPVExitTargetingInterpSpeed"); }
-	float& EndDoMeleeSwingTimeField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.EndDoMeleeSwingTime"); }
-	FRotator& FPVLookAtMaximumOffsetField() { return *GetNativePointerField<FRotator*>(this, "AShooterWeapon.FPVLookAtMaximumOffset"); }
-	FRotator& FPVLookAtSpeedBaseField() { return *GetNativePointerField<FRotator*>(this, "AShooterWeapon.FPVLookAtSpeedBase"); }
-	FRotator& FPVLookAtInterpSpeedField() { return *GetNativePointerField<FRotator*>(this, "AShooterWeapon.FPVLookAtInterpSpeed"); }
-	FRotator& FPVLookAtMaximumOffset_TargetingField() { return *GetNativePointerField<FRotator*>(this, "AShooterWeapon.FPVLookAtMaximumOffset_Targeting"); }
-	FRotator& FPVLookAtSpeedBase_TargetingField() { return *GetNativePointerField<FRotator*>(this, "AShooterWeapon.FPVLookAtSpeedBase_Targeting"); }
-	FRotator& FPVLookAtInterpSpeed_TargetingField() { return *GetNativePointerField<FRotator*>(this, "AShooterWeapon.FPVLookAtInterpSpeed_Targeting"); }
-	FVector& FPVImmobilizedLocationOffsetField() { return *GetNativePointerField<FVector*>(this, "AShooterWeapon.FPVImmobilizedLocationOffset"); }
-	FRotator& FPVImmobilizedRotationOffsetField() { return *GetNativePointerField<FRotator*>(this, "AShooterWeapon.FPVImmobilizedRotationOffset"); }
-	float& FPVImmobilizedInterpSpeedField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.FPVImmobilizedInterpSpeed"); }
-	bool& bUseBlueprintAnimNotificationsField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bUseBlueprintAnimNotifications"); }
-	TArray<FName>& MeleeSwingSocketsField() { return *GetNativePointerField<TArray<FName>*>(this, "AShooterWeapon.MeleeSwingSockets"); }
-	float& AllowMeleeTimeBeforeAnimationEndField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.AllowMeleeTimeBeforeAnimationEnd"); }
-	UPrimalItem * AssociatedPrimalItemField() { return *GetNativePointerField<UPrimalItem **>(this, "AShooterWeapon.AssociatedPrimalItem"); }
-	bool& bCanBeUsedAsEquipmentField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bCanBeUsedAsEquipment"); }
-	FItemNetInfo& AssociatedItemNetInfoField() { return *GetNativePointerField<FItemNetInfo*>(this, "AShooterWeapon.AssociatedItemNetInfo"); }
-	FWeaponData& WeaponConfigField() { return *GetNativePointerField<FWeaponData*>(this, "AShooterWeapon.WeaponConfig"); }
-	TSubclassOf<UPrimalItem>& WeaponAmmoItemTemplateField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "AShooterWeapon.WeaponAmmoItemTemplate"); }
-	long double& NextAllowedMeleeTimeField() { return *GetNativePointerField<long double*>(this, "AShooterWeapon.NextAllowedMeleeTime"); }
-	TArray<FVector>& LastSocketPositionsField() { return *GetNativePointerField<TArray<FVector>*>(this, "AShooterWeapon.LastSocketPositions"); }
-	TArray<AActor *> MeleeSwingHurtListField() { return *GetNativePointerField<TArray<AActor *>*>(this, "AShooterWeapon.MeleeSwingHurtList"); }
-	long double& LastFPVRenderTimeField() { return *GetNativePointerField<long double*>(this, "AShooterWeapon.LastFPVRenderTime"); }
-	FRotator& LastCameraRotationField() { return *GetNativePointerField<FRotator*>(this, "AShooterWeapon.LastCameraRotation"); }
-	FRotator& FPVAdditionalLookRotOffsetField() { return *GetNativePointerField<FRotator*>(this, "AShooterWeapon.FPVAdditionalLookRotOffset"); }
-	FVector& FPVLastLocOffsetField() { return *GetNativePointerField<FVector*>(this, "AShooterWeapon.FPVLastLocOffset"); }
-	FVector& FPVLastVROffsetField() { return *GetNativePointerField<FVector*>(this, "AShooterWeapon.FPVLastVROffset"); }
-	FVector& FPVRelativeLocationOffscreenOffsetField() { return *GetNativePointerField<FVector*>(this, "AShooterWeapon.FPVRelativeLocationOffscreenOffset"); }
-	FRotator& FPVLastRotOffsetField() { return *GetNativePointerField<FRotator*>(this, "AShooterWeapon.FPVLastRotOffset"); }
-	AShooterCharacter * MyPawnField() { return *GetNativePointerField<AShooterCharacter **>(this, "AShooterWeapon.MyPawn"); }
-	UAudioComponent * FireACField() { return *GetNativePointerField<UAudioComponent **>(this, "AShooterWeapon.FireAC"); }
-	FName& MuzzleAttachPointField() { return *GetNativePointerField<FName*>(this, "AShooterWeapon.MuzzleAttachPoint"); }
-	USoundCue * FireSoundField() { return *GetNativePointerField<USoundCue **>(this, "AShooterWeapon.FireSound"); }
-	USoundCue * AltFireSoundField() { return *GetNativePointerField<USoundCue **>(this, "AShooterWeapon.AltFireSound"); }
-	USoundCue * FireFinishSoundField() { return *GetNativePointerField<USoundCue **>(this, "AShooterWeapon.FireFinishSound"); }
-	USoundCue * OutOfAmmoSoundField() { return *GetNativePointerField<USoundCue **>(this, "AShooterWeapon.OutOfAmmoSound"); }
-	int& MeleeDamageAmountField() { return *GetNativePointerField<int*>(this, "AShooterWeapon.MeleeDamageAmount"); }
-	float& TheMeleeSwingRadiusField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.TheMeleeSwingRadius"); }
-	float& MeleeDamageImpulseField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.MeleeDamageImpulse"); }
-	UAnimMontage * WeaponMesh3PReloadAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterWeapon.WeaponMesh3PReloadAnim"); }
-	USoundCue * EquipSoundField() { return *GetNativePointerField<USoundCue **>(this, "AShooterWeapon.EquipSound"); }
-	UAnimMontage * WeaponMesh3PFireAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterWeapon.WeaponMesh3PFireAnim"); }
-	float& FPVMoveOffscreenWhenTurningMaxMoveWeaponSpeedField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.FPVMoveOffscreenWhenTurningMaxMoveWeaponSpeed"); }
-	float& FPVMoveOffscreenWhenTurningMinMoveWeaponSpeedField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.FPVMoveOffscreenWhenTurningMinMoveWeaponSpeed"); }
-	float& FPVMoveOffscreenWhenTurningMinViewRotSpeedField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.FPVMoveOffscreenWhenTurningMinViewRotSpeed"); }
-	float& FPVMoveOffscreenWhenTurningMaxViewRotSpeedField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.FPVMoveOffscreenWhenTurningMaxViewRotSpeed"); }
-	float& FPVMoveOffscreenIdleRestoreIntervalField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.FPVMoveOffscreenIdleRestoreInterval"); }
-	float& FPVMoveOffscreenIdleRestoreSpeedField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.FPVMoveOffscreenIdleRestoreSpeed"); }
-	float& FPVMoveOffscreenWhenTurningMaxOffsetField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.FPVMoveOffscreenWhenTurningMaxOffset"); }
-	long double& FPVStoppedTurningTimeField() { return *GetNativePointerField<long double*>(this, "AShooterWeapon.FPVStoppedTurningTime"); }
-	float& ItemDestructionUnequipWeaponDelayField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.ItemDestructionUnequipWeaponDelay"); }
-	EWeaponState::Type& CurrentStateField() { return *GetNativePointerField<EWeaponState::Type*>(this, "AShooterWeapon.CurrentState"); }
-	long double& LastFireTimeField() { return *GetNativePointerField<long double*>(this, "AShooterWeapon.LastFireTime"); }
-	int& CurrentAmmoField() { return *GetNativePointerField<int*>(this, "AShooterWeapon.CurrentAmmo"); }
-	int& CurrentAmmoInClipField() { return *GetNativePointerField<int*>(this, "AShooterWeapon.CurrentAmmoInClip"); }
-	bool& bReplicateCurrentAmmoInClipToNonOwnersField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bReplicateCurrentAmmoInClipToNonOwners"); }
-	bool& bUseBPAdjustAmmoPerShotField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bUseBPAdjustAmmoPerShot"); }
-	FName& FPVAccessoryToggleComponentField() { return *GetNativePointerField<FName*>(this, "AShooterWeapon.FPVAccessoryToggleComponent"); }
-	FName& TPVAccessoryToggleComponentField() { return *GetNativePointerField<FName*>(this, "AShooterWeapon.TPVAccessoryToggleComponent"); }
-	float& TimeToAutoReloadField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.TimeToAutoReload"); }
-	USoundBase * ToggleAccessorySoundField() { return *GetNativePointerField<USoundBase **>(this, "AShooterWeapon.ToggleAccessorySound"); }
-	int& FiredLastNoAmmoShotField() { return *GetNativePointerField<int*>(this, "AShooterWeapon.FiredLastNoAmmoShot"); }
-	long double& LastNotifyShotTimeField() { return *GetNativePointerField<long double*>(this, "AShooterWeapon.LastNotifyShotTime"); }
-	TSubclassOf<UDamageType>& MeleeDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*>(this, "AShooterWeapon.MeleeDamageType"); }
-	FVector& VRTargetingModelOffsetField() { return *GetNativePointerField<FVector*>(this, "AShooterWeapon.VRTargetingModelOffset"); }
-	FVector& VRTargetingAimOriginOffsetField() { return *GetNativePointerField<FVector*>(this, "AShooterWeapon.VRTargetingAimOriginOffset"); }
-	UMaterialInterface * ScopeOverlayMIField() { return *GetNativePointerField<UMaterialInterface **>(this, "AShooterWeapon.ScopeOverlayMI"); }
-	UMaterialInterface * ScopeCrosshairMIField() { return *GetNativePointerField<UMaterialInterface **>(this, "AShooterWeapon.ScopeCrosshairMI"); }
-	float& ScopeCrosshairSizeField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.ScopeCrosshairSize"); }
-	FName& ScopeCrosshairColorParameterField() { return *GetNativePointerField<FName*>(this, "AShooterWeapon.ScopeCrosshairColorParameter"); }
-	float& MinItemDurabilityPercentageForShotField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.MinItemDurabilityPercentageForShot"); }
-	float& OverrideTargetingFOVField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.OverrideTargetingFOV"); }
-	float& TargetingDelayTimeField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.TargetingDelayTime"); }
-	float& TargetingFOVInterpSpeedField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.TargetingFOVInterpSpeed"); }
-	float& AimDriftYawAngleField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.AimDriftYawAngle"); }
-	float& AimDriftPitchAngleField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.AimDriftPitchAngle"); }
-	float& AimDriftYawFrequencyField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.AimDriftYawFrequency"); }
-	float& AimDriftPitchFrequencyField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.AimDriftPitchFrequency"); }
-	UAnimMontage * AlternateInventoryEquipAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterWeapon.AlternateInventoryEquipAnim"); }
-	float& MeleeHitRandomChanceToDestroyItemField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.MeleeHitRandomChanceToDestroyItem"); }
-	float& GlobalFireCameraShakeScaleField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.GlobalFireCameraShakeScale"); }
-	float& DurabilityCostToEquipField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.DurabilityCostToEquip"); }
-	float& PassiveDurabilityCostPerIntervalField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.PassiveDurabilityCostPerInterval"); }
-	float& PassiveDurabilityCostIntervalField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.PassiveDurabilityCostInterval"); }
-	float& GlobalFireCameraShakeScaleTargetingField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.GlobalFireCameraShakeScaleTargeting"); }
-	float& MeleeCameraShakeSpeedScaleField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.MeleeCameraShakeSpeedScale"); }
-	float& ReloadCameraShakeSpeedScaleField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.ReloadCameraShakeSpeedScale"); }
-	float& MeleeConsumesStaminaField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.MeleeConsumesStamina"); }
-	float& HypoThermiaInsulationField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.HypoThermiaInsulation"); }
-	float& HyperThermiaInsulationField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.HyperThermiaInsulation"); }
-	float& InsulationRangeField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.InsulationRange"); }
-	long double& LastDurabilityConsumptionTimeField() { return *GetNativePointerField<long double*>(this, "AShooterWeapon.LastDurabilityConsumptionTime"); }
-	bool& bLastMeleeHitField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bLastMeleeHit"); }
-	bool& bLastMeleeHitStationaryField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bLastMeleeHitStationary"); }
-	bool& bClientAlreadyReloadedField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bClientAlreadyReloaded"); }
-	float& AutoReloadTimerField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.AutoReloadTimer"); }
-	bool& bConsumedDurabilityForThisMeleeHitField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bConsumedDurabilityForThisMeleeHit"); }
-	USoundCue * TargetingSoundField() { return *GetNativePointerField<USoundCue **>(this, "AShooterWeapon.TargetingSound"); }
-	USoundCue * UntargetingSoundField() { return *GetNativePointerField<USoundCue **>(this, "AShooterWeapon.UntargetingSound"); }
-	float& FPVMeleeTraceFXRangeField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.FPVMeleeTraceFXRange"); }
-	float& MeleeAttackHarvetUsableComponentsRadiusField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.MeleeAttackHarvetUsableComponentsRadius"); }
-	float& MeleeAttackUsableHarvestDamageMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.MeleeAttackUsableHarvestDamageMultiplier"); }
+	float& EquipTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.EquipTime")>(this, "AShooterWeapon.EquipTime"); }
+	UAnimMontage * OverrideProneInAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterWeapon.OverrideProneInAnim")>(this, "AShooterWeapon.OverrideProneInAnim"); }
+	UAnimMontage * OverrideProneOutAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterWeapon.OverrideProneOutAnim")>(this, "AShooterWeapon.OverrideProneOutAnim"); }
+	UAnimMontage * OverrideJumpAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterWeapon.OverrideJumpAnim")>(this, "AShooterWeapon.OverrideJumpAnim"); }
+	UAnimMontage * OverrideLandedAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterWeapon.OverrideLandedAnim")>(this, "AShooterWeapon.OverrideLandedAnim"); }
+	TArray<UAnimSequence *> OverrideRiderAnimSequenceFromField() { return *GetNativePointerField<TArray<UAnimSequence *>*, API::FieldNameHash("AShooterWeapon.OverrideRiderAnimSequenceFrom")>(this, "AShooterWeapon.OverrideRiderAnimSequenceFrom"); }
+	TArray<UAnimSequence *> OverrideRiderAnimSequenceToField() { return *GetNativePointerField<TArray<UAnimSequence *>*, API::FieldNameHash("AShooterWeapon.OverrideRiderAnimSequenceTo")>(this, "AShooterWeapon.OverrideRiderAnimSequenceTo"); }
+	float& ItemDurabilityToConsumePerMeleeHitField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.ItemDurabilityToConsumePerMeleeHit")>(this, "AShooterWeapon.ItemDurabilityToConsumePerMeleeHit"); }
+	float& AmmoIconsCountField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.AmmoIconsCount")>(this, "AShooterWeapon.AmmoIconsCount"); }
+	float& TargetingTooltipCheckRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.TargetingTooltipCheckRange")>(this, "AShooterWeapon.TargetingTooltipCheckRange"); }
+	int& PrimaryClipIconOffsetField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterWeapon.PrimaryClipIconOffset")>(this, "AShooterWeapon.PrimaryClipIconOffset"); }
+	int& SecondaryClipIconOffsetField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterWeapon.SecondaryClipIconOffset")>(this, "AShooterWeapon.SecondaryClipIconOffset"); }
+	FVector2D& TargetingInfoTooltipPaddingField() { return *GetNativePointerField<FVector2D*, API::FieldNameHash("AShooterWeapon.TargetingInfoTooltipPadding")>(this, "AShooterWeapon.TargetingInfoTooltipPadding"); }
+	FVector2D& TargetingInfoTooltipScaleField() { return *GetNativePointerField<FVector2D*, API::FieldNameHash("AShooterWeapon.TargetingInfoTooltipScale")>(this, "AShooterWeapon.TargetingInfoTooltipScale"); }
+	bool& bOnlyPassiveDurabilityWhenAccessoryActiveField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bOnlyPassiveDurabilityWhenAccessoryActive")>(this, "AShooterWeapon.bOnlyPassiveDurabilityWhenAccessoryActive"); }
+	bool& bDisableShooterOnElectricStormField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bDisableShooterOnElectricStorm")>(this, "AShooterWeapon.bDisableShooterOnElectricStorm"); }
+	FName& OverrideAttachPointField() { return *GetNativePointerField<FName*, API::FieldNameHash("AShooterWeapon.OverrideAttachPoint")>(this, "AShooterWeapon.OverrideAttachPoint"); }
+	FVector& FPVRelativeLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterWeapon.FPVRelativeLocation")>(this, "AShooterWeapon.FPVRelativeLocation"); }
+	FRotator& FPVRelativeRotationField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("AShooterWeapon.FPVRelativeRotation")>(this, "AShooterWeapon.FPVRelativeRotation"); }
+	FVector& FPVRelativeLocation_TargetingField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterWeapon.FPVRelativeLocation_Targeting")>(this, "AShooterWeapon.FPVRelativeLocation_Targeting"); }
+	FRotator& FPVRelativeRotation_TargetingField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("AShooterWeapon.FPVRelativeRotation_Targeting")>(this, "AShooterWeapon.FPVRelativeRotation_Targeting"); }
+	float& FPVEnterTargetingInterpSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.FPVEnterTargetingInterpSpeed")>(this, "AShooterWeapon.FPVEnterTargetingInterpSpeed"); }
+	float& FPVExitTargetingInterpSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.FPVExitTargetingInterpSpeed")>(this, "AShooterWeapon.FPVExitTargetingInterpSpeed"); }
+	float& EndDoMeleeSwingTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.EndDoMeleeSwingTime")>(this, "AShooterWeapon.EndDoMeleeSwingTime"); }
+	FRotator& FPVLookAtMaximumOffsetField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("AShooterWeapon.FPVLookAtMaximumOffset")>(this, "AShooterWeapon.FPVLookAtMaximumOffset"); }
+	FRotator& FPVLookAtSpeedBaseField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("AShooterWeapon.FPVLookAtSpeedBase")>(this, "AShooterWeapon.FPVLookAtSpeedBase"); }
+	FRotator& FPVLookAtInterpSpeedField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("AShooterWeapon.FPVLookAtInterpSpeed")>(this, "AShooterWeapon.FPVLookAtInterpSpeed"); }
+	FRotator& FPVLookAtMaximumOffset_TargetingField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("AShooterWeapon.FPVLookAtMaximumOffset_Targeting")>(this, "AShooterWeapon.FPVLookAtMaximumOffset_Targeting"); }
+	FRotator& FPVLookAtSpeedBase_TargetingField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("AShooterWeapon.FPVLookAtSpeedBase_Targeting")>(this, "AShooterWeapon.FPVLookAtSpeedBase_Targeting"); }
+	FRotator& FPVLookAtInterpSpeed_TargetingField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("AShooterWeapon.FPVLookAtInterpSpeed_Targeting")>(this, "AShooterWeapon.FPVLookAtInterpSpeed_Targeting"); }
+	FVector& FPVImmobilizedLocationOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterWeapon.FPVImmobilizedLocationOffset")>(this, "AShooterWeapon.FPVImmobilizedLocationOffset"); }
+	FRotator& FPVImmobilizedRotationOffsetField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("AShooterWeapon.FPVImmobilizedRotationOffset")>(this, "AShooterWeapon.FPVImmobilizedRotationOffset"); }
+	float& FPVImmobilizedInterpSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.FPVImmobilizedInterpSpeed")>(this, "AShooterWeapon.FPVImmobilizedInterpSpeed"); }
+	bool& bUseBlueprintAnimNotificationsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bUseBlueprintAnimNotifications")>(this, "AShooterWeapon.bUseBlueprintAnimNotifications"); }
+	TArray<FName>& MeleeSwingSocketsField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("AShooterWeapon.MeleeSwingSockets")>(this, "AShooterWeapon.MeleeSwingSockets"); }
+	float& AllowMeleeTimeBeforeAnimationEndField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.AllowMeleeTimeBeforeAnimationEnd")>(this, "AShooterWeapon.AllowMeleeTimeBeforeAnimationEnd"); }
+	UPrimalItem * AssociatedPrimalItemField() { return *GetNativePointerField<UPrimalItem **, API::FieldNameHash("AShooterWeapon.AssociatedPrimalItem")>(this, "AShooterWeapon.AssociatedPrimalItem"); }
+	bool& bCanBeUsedAsEquipmentField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bCanBeUsedAsEquipment")>(this, "AShooterWeapon.bCanBeUsedAsEquipment"); }
+	FItemNetInfo& AssociatedItemNetInfoField() { return *GetNativePointerField<FItemNetInfo*, API::FieldNameHash("AShooterWeapon.AssociatedItemNetInfo")>(this, "AShooterWeapon.AssociatedItemNetInfo"); }
+	FWeaponData& WeaponConfigField() { return *GetNativePointerField<FWeaponData*, API::FieldNameHash("AShooterWeapon.WeaponConfig")>(this, "AShooterWeapon.WeaponConfig"); }
+	TSubclassOf<UPrimalItem>& WeaponAmmoItemTemplateField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("AShooterWeapon.WeaponAmmoItemTemplate")>(this, "AShooterWeapon.WeaponAmmoItemTemplate"); }
+	long double& NextAllowedMeleeTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterWeapon.NextAllowedMeleeTime")>(this, "AShooterWeapon.NextAllowedMeleeTime"); }
+	TArray<FVector>& LastSocketPositionsField() { return *GetNativePointerField<TArray<FVector>*, API::FieldNameHash("AShooterWeapon.LastSocketPositions")>(this, "AShooterWeapon.LastSocketPositions"); }
+	TArray<AActor *> MeleeSwingHurtListField() { return *GetNativePointerField<TArray<AActor *>*, API::FieldNameHash("AShooterWeapon.MeleeSwingHurtList")>(this, "AShooterWeapon.MeleeSwingHurtList"); }
+	long double& LastFPVRenderTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterWeapon.LastFPVRenderTime")>(this, "AShooterWeapon.LastFPVRenderTime"); }
+	FRotator& LastCameraRotationField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("AShooterWeapon.LastCameraRotation")>(this, "AShooterWeapon.LastCameraRotation"); }
+	FRotator& FPVAdditionalLookRotOffsetField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("AShooterWeapon.FPVAdditionalLookRotOffset")>(this, "AShooterWeapon.FPVAdditionalLookRotOffset"); }
+	FVector& FPVLastLocOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterWeapon.FPVLastLocOffset")>(this, "AShooterWeapon.FPVLastLocOffset"); }
+	FVector& FPVLastVROffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterWeapon.FPVLastVROffset")>(this, "AShooterWeapon.FPVLastVROffset"); }
+	FVector& FPVRelativeLocationOffscreenOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterWeapon.FPVRelativeLocationOffscreenOffset")>(this, "AShooterWeapon.FPVRelativeLocationOffscreenOffset"); }
+	FRotator& FPVLastRotOffsetField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("AShooterWeapon.FPVLastRotOffset")>(this, "AShooterWeapon.FPVLastRotOffset"); }
+	AShooterCharacter * MyPawnField() { return *GetNativePointerField<AShooterCharacter **, API::FieldNameHash("AShooterWeapon.MyPawn")>(this, "AShooterWeapon.MyPawn"); }
+	UAudioComponent * FireACField() { return *GetNativePointerField<UAudioComponent **, API::FieldNameHash("AShooterWeapon.FireAC")>(this, "AShooterWeapon.FireAC"); }
+	FName& MuzzleAttachPointField() { return *GetNativePointerField<FName*, API::FieldNameHash("AShooterWeapon.MuzzleAttachPoint")>(this, "AShooterWeapon.MuzzleAttachPoint"); }
+	USoundCue * FireSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("AShooterWeapon.FireSound")>(this, "AShooterWeapon.FireSound"); }
+	USoundCue * AltFireSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("AShooterWeapon.AltFireSound")>(this, "AShooterWeapon.AltFireSound"); }
+	USoundCue * FireFinishSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("AShooterWeapon.FireFinishSound")>(this, "AShooterWeapon.FireFinishSound"); }
+	USoundCue * OutOfAmmoSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("AShooterWeapon.OutOfAmmoSound")>(this, "AShooterWeapon.OutOfAmmoSound"); }
+	int& MeleeDamageAmountField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterWeapon.MeleeDamageAmount")>(this, "AShooterWeapon.MeleeDamageAmount"); }
+	float& TheMeleeSwingRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.TheMeleeSwingRadius")>(this, "AShooterWeapon.TheMeleeSwingRadius"); }
+	float& MeleeDamageImpulseField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.MeleeDamageImpulse")>(this, "AShooterWeapon.MeleeDamageImpulse"); }
+	UAnimMontage * WeaponMesh3PReloadAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterWeapon.WeaponMesh3PReloadAnim")>(this, "AShooterWeapon.WeaponMesh3PReloadAnim"); }
+	USoundCue * EquipSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("AShooterWeapon.EquipSound")>(this, "AShooterWeapon.EquipSound"); }
+	UAnimMontage * WeaponMesh3PFireAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterWeapon.WeaponMesh3PFireAnim")>(this, "AShooterWeapon.WeaponMesh3PFireAnim"); }
+	float& FPVMoveOffscreenWhenTurningMaxMoveWeaponSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.FPVMoveOffscreenWhenTurningMaxMoveWeaponSpeed")>(this, "AShooterWeapon.FPVMoveOffscreenWhenTurningMaxMoveWeaponSpeed"); }
+	float& FPVMoveOffscreenWhenTurningMinMoveWeaponSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.FPVMoveOffscreenWhenTurningMinMoveWeaponSpeed")>(this, "AShooterWeapon.FPVMoveOffscreenWhenTurningMinMoveWeaponSpeed"); }
+	float& FPVMoveOffscreenWhenTurningMinViewRotSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.FPVMoveOffscreenWhenTurningMinViewRotSpeed")>(this, "AShooterWeapon.FPVMoveOffscreenWhenTurningMinViewRotSpeed"); }
+	float& FPVMoveOffscreenWhenTurningMaxViewRotSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.FPVMoveOffscreenWhenTurningMaxViewRotSpeed")>(this, "AShooterWeapon.FPVMoveOffscreenWhenTurningMaxViewRotSpeed"); }
+	float& FPVMoveOffscreenIdleRestoreIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.FPVMoveOffscreenIdleRestoreInterval")>(this, "AShooterWeapon.FPVMoveOffscreenIdleRestoreInterval"); }
+	float& FPVMoveOffscreenIdleRestoreSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.FPVMoveOffscreenIdleRestoreSpeed")>(this, "AShooterWeapon.FPVMoveOffscreenIdleRestoreSpeed"); }
+	float& FPVMoveOffscreenWhenTurningMaxOffsetField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.FPVMoveOffscreenWhenTurningMaxOffset")>(this, "AShooterWeapon.FPVMoveOffscreenWhenTurningMaxOffset"); }
+	long double& FPVStoppedTurningTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterWeapon.FPVStoppedTurningTime")>(this, "AShooterWeapon.FPVStoppedTurningTime"); }
+	float& ItemDestructionUnequipWeaponDelayField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.ItemDestructionUnequipWeaponDelay")>(this, "AShooterWeapon.ItemDestructionUnequipWeaponDelay"); }
+	EWeaponState::Type& CurrentStateField() { return *GetNativePointerField<EWeaponState::Type*, API::FieldNameHash("AShooterWeapon.CurrentState")>(this, "AShooterWeapon.CurrentState"); }
+	long double& LastFireTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterWeapon.LastFireTime")>(this, "AShooterWeapon.LastFireTime"); }
+	int& CurrentAmmoField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterWeapon.CurrentAmmo")>(this, "AShooterWeapon.CurrentAmmo"); }
+	int& CurrentAmmoInClipField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterWeapon.CurrentAmmoInClip")>(this, "AShooterWeapon.CurrentAmmoInClip"); }
+	bool& bReplicateCurrentAmmoInClipToNonOwnersField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bReplicateCurrentAmmoInClipToNonOwners")>(this, "AShooterWeapon.bReplicateCurrentAmmoInClipToNonOwners"); }
+	bool& bUseBPAdjustAmmoPerShotField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bUseBPAdjustAmmoPerShot")>(this, "AShooterWeapon.bUseBPAdjustAmmoPerShot"); }
+	FName& FPVAccessoryToggleComponentField() { return *GetNativePointerField<FName*, API::FieldNameHash("AShooterWeapon.FPVAccessoryToggleComponent")>(this, "AShooterWeapon.FPVAccessoryToggleComponent"); }
+	FName& TPVAccessoryToggleComponentField() { return *GetNativePointerField<FName*, API::FieldNameHash("AShooterWeapon.TPVAccessoryToggleComponent")>(this, "AShooterWeapon.TPVAccessoryToggleComponent"); }
+	float& TimeToAutoReloadField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.TimeToAutoReload")>(this, "AShooterWeapon.TimeToAutoReload"); }
+	USoundBase * ToggleAccessorySoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("AShooterWeapon.ToggleAccessorySound")>(this, "AShooterWeapon.ToggleAccessorySound"); }
+	int& FiredLastNoAmmoShotField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterWeapon.FiredLastNoAmmoShot")>(this, "AShooterWeapon.FiredLastNoAmmoShot"); }
+	long double& LastNotifyShotTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterWeapon.LastNotifyShotTime")>(this, "AShooterWeapon.LastNotifyShotTime"); }
+	TSubclassOf<UDamageType>& MeleeDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*, API::FieldNameHash("AShooterWeapon.MeleeDamageType")>(this, "AShooterWeapon.MeleeDamageType"); }
+	FVector& VRTargetingModelOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterWeapon.VRTargetingModelOffset")>(this, "AShooterWeapon.VRTargetingModelOffset"); }
+	FVector& VRTargetingAimOriginOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterWeapon.VRTargetingAimOriginOffset")>(this, "AShooterWeapon.VRTargetingAimOriginOffset"); }
+	UMaterialInterface * ScopeOverlayMIField() { return *GetNativePointerField<UMaterialInterface **, API::FieldNameHash("AShooterWeapon.ScopeOverlayMI")>(this, "AShooterWeapon.ScopeOverlayMI"); }
+	UMaterialInterface * ScopeCrosshairMIField() { return *GetNativePointerField<UMaterialInterface **, API::FieldNameHash("AShooterWeapon.ScopeCrosshairMI")>(this, "AShooterWeapon.ScopeCrosshairMI"); }
+	float& ScopeCrosshairSizeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.ScopeCrosshairSize")>(this, "AShooterWeapon.ScopeCrosshairSize"); }
+	FName& ScopeCrosshairColorParameterField() { return *GetNativePointerField<FName*, API::FieldNameHash("AShooterWeapon.ScopeCrosshairColorParameter")>(this, "AShooterWeapon.ScopeCrosshairColorParameter"); }
+	float& MinItemDurabilityPercentageForShotField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.MinItemDurabilityPercentageForShot")>(this, "AShooterWeapon.MinItemDurabilityPercentageForShot"); }
+	float& OverrideTargetingFOVField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.OverrideTargetingFOV")>(this, "AShooterWeapon.OverrideTargetingFOV"); }
+	float& TargetingDelayTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.TargetingDelayTime")>(this, "AShooterWeapon.TargetingDelayTime"); }
+	float& TargetingFOVInterpSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.TargetingFOVInterpSpeed")>(this, "AShooterWeapon.TargetingFOVInterpSpeed"); }
+	float& AimDriftYawAngleField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.AimDriftYawAngle")>(this, "AShooterWeapon.AimDriftYawAngle"); }
+	float& AimDriftPitchAngleField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.AimDriftPitchAngle")>(this, "AShooterWeapon.AimDriftPitchAngle"); }
+	float& AimDriftYawFrequencyField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.AimDriftYawFrequency")>(this, "AShooterWeapon.AimDriftYawFrequency"); }
+	float& AimDriftPitchFrequencyField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.AimDriftPitchFrequency")>(this, "AShooterWeapon.AimDriftPitchFrequency"); }
+	UAnimMontage * AlternateInventoryEquipAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterWeapon.AlternateInventoryEquipAnim")>(this, "AShooterWeapon.AlternateInventoryEquipAnim"); }
+	float& MeleeHitRandomChanceToDestroyItemField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.MeleeHitRandomChanceToDestroyItem")>(this, "AShooterWeapon.MeleeHitRandomChanceToDestroyItem"); }
+	float& GlobalFireCameraShakeScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.GlobalFireCameraShakeScale")>(this, "AShooterWeapon.GlobalFireCameraShakeScale"); }
+	float& DurabilityCostToEquipField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.DurabilityCostToEquip")>(this, "AShooterWeapon.DurabilityCostToEquip"); }
+	float& PassiveDurabilityCostPerIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.PassiveDurabilityCostPerInterval")>(this, "AShooterWeapon.PassiveDurabilityCostPerInterval"); }
+	float& PassiveDurabilityCostIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.PassiveDurabilityCostInterval")>(this, "AShooterWeapon.PassiveDurabilityCostInterval"); }
+	float& GlobalFireCameraShakeScaleTargetingField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.GlobalFireCameraShakeScaleTargeting")>(this, "AShooterWeapon.GlobalFireCameraShakeScaleTargeting"); }
+	float& MeleeCameraShakeSpeedScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.MeleeCameraShakeSpeedScale")>(this, "AShooterWeapon.MeleeCameraShakeSpeedScale"); }
+	float& ReloadCameraShakeSpeedScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.ReloadCameraShakeSpeedScale")>(this, "AShooterWeapon.ReloadCameraShakeSpeedScale"); }
+	float& MeleeConsumesStaminaField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.MeleeConsumesStamina")>(this, "AShooterWeapon.MeleeConsumesStamina"); }
+	float& HypoThermiaInsulationField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.HypoThermiaInsulation")>(this, "AShooterWeapon.HypoThermiaInsulation"); }
+	float& HyperThermiaInsulationField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.HyperThermiaInsulation")>(this, "AShooterWeapon.HyperThermiaInsulation"); }
+	float& InsulationRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.InsulationRange")>(this, "AShooterWeapon.InsulationRange"); }
+	long double& LastDurabilityConsumptionTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterWeapon.LastDurabilityConsumptionTime")>(this, "AShooterWeapon.LastDurabilityConsumptionTime"); }
+	bool& bLastMeleeHitField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bLastMeleeHit")>(this, "AShooterWeapon.bLastMeleeHit"); }
+	bool& bLastMeleeHitStationaryField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bLastMeleeHitStationary")>(this, "AShooterWeapon.bLastMeleeHitStationary"); }
+	bool& bClientAlreadyReloadedField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bClientAlreadyReloaded")>(this, "AShooterWeapon.bClientAlreadyReloaded"); }
+	float& AutoReloadTimerField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.AutoReloadTimer")>(this, "AShooterWeapon.AutoReloadTimer"); }
+	bool& bConsumedDurabilityForThisMeleeHitField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bConsumedDurabilityForThisMeleeHit")>(this, "AShooterWeapon.bConsumedDurabilityForThisMeleeHit"); }
+	USoundCue * TargetingSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("AShooterWeapon.TargetingSound")>(this, "AShooterWeapon.TargetingSound"); }
+	USoundCue * UntargetingSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("AShooterWeapon.UntargetingSound")>(this, "AShooterWeapon.UntargetingSound"); }
+	float& FPVMeleeTraceFXRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.FPVMeleeTraceFXRange")>(this, "AShooterWeapon.FPVMeleeTraceFXRange"); }
+	float& MeleeAttackHarvetUsableComponentsRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.MeleeAttackHarvetUsableComponentsRadius")>(this, "AShooterWeapon.MeleeAttackHarvetUsableComponentsRadius"); }
+	float& MeleeAttackUsableHarvestDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.MeleeAttackUsableHarvestDamageMultiplier")>(this, "AShooterWeapon.MeleeAttackUsableHarvestDamageMultiplier"); }
 	FieldArray<bool, 6> bColorizeRegionsField() { return { this, "AShooterWeapon.bColorizeRegions" }; }
-	UAnimMontage * TPVForcePlayAnimField() { return *GetNativePointerField<UAnimMontage **>(this, "AShooterWeapon.TPVForcePlayAnim"); }
-	bool& bPreventOpeningInventoryField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bPreventOpeningInventory"); }
-	bool& bAllowUseOnSeatingStructureField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bAllowUseOnSeatingStructure"); }
-	bool& bOnlyUseOnSeatingStructureField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bOnlyUseOnSeatingStructure"); }
-	bool& bBPDoClientCheckCanFireField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bBPDoClientCheckCanFire"); }
-	bool& bRestrictTPVCameraYawField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bRestrictTPVCameraYaw"); }
-	float& TPVCameraYawRangeField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.TPVCameraYawRange"); }
-	bool& bFoceSimulatedTickField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bFoceSimulatedTick"); }
-	bool& bWasLastFireFromGamePadField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bWasLastFireFromGamePad"); }
-	bool& bDisableWeaponCrosshairField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bDisableWeaponCrosshair"); }
-	UStaticMesh * DyePreviewMeshOverrideSMField() { return *GetNativePointerField<UStaticMesh **>(this, "AShooterWeapon.DyePreviewMeshOverrideSM"); }
-	bool& bBPOverrideAspectRatioField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bBPOverrideAspectRatio"); }
-	bool& bBPOverrideFPVMasterPoseComponentField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bBPOverrideFPVMasterPoseComponent"); }
-	bool& bForceAllowMountedWeaponryField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bForceAllowMountedWeaponry"); }
-	float& FireCameraShakeSpreadScaleExponentField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.FireCameraShakeSpreadScaleExponent"); }
-	float& FireCameraShakeSpreadScaleExponentLessThanField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.FireCameraShakeSpreadScaleExponentLessThan"); }
-	float& FireCameraShakeSpreadScaleMultiplierLessThanField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.FireCameraShakeSpreadScaleMultiplierLessThan"); }
-	float& FireCameraShakeSpreadScaleMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.FireCameraShakeSpreadScaleMultiplier"); }
-	bool& bUseFireCameraShakeScaleField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bUseFireCameraShakeScale"); }
-	bool& bForceTickWithNoControllerField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bForceTickWithNoController"); }
-	float& CurrentFiringSpreadField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.CurrentFiringSpread"); }
-	TSubclassOf<APrimalBuff>& ScopedBuffField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*>(this, "AShooterWeapon.ScopedBuff"); }
-	TWeakObjectPtr<APrimalBuff>& MyScopedBuffField() { return *GetNativePointerField<TWeakObjectPtr<APrimalBuff>*>(this, "AShooterWeapon.MyScopedBuff"); }
-	UAnimSequence * OverrideTPVShieldAnimationField() { return *GetNativePointerField<UAnimSequence **>(this, "AShooterWeapon.OverrideTPVShieldAnimation"); }
-	bool& bAllowTargetingDuringMeleeSwingField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bAllowTargetingDuringMeleeSwing"); }
-	FVector& FPVMuzzleLocationOffsetField() { return *GetNativePointerField<FVector*>(this, "AShooterWeapon.FPVMuzzleLocationOffset"); }
-	FVector& TPVMuzzleLocationOffsetField() { return *GetNativePointerField<FVector*>(this, "AShooterWeapon.TPVMuzzleLocationOffset"); }
-	bool& bForceTPV_EquippedWhileRidingField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bForceTPV_EquippedWhileRiding"); }
-	bool& bCutsEnemyGrapplingCableField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bCutsEnemyGrapplingCable"); }
-	FVector& FPVInventoryReequipOffsetField() { return *GetNativePointerField<FVector*>(this, "AShooterWeapon.FPVInventoryReequipOffset"); }
-	long double& LocalInventoryViewingSkippedEquipAnimTimeField() { return *GetNativePointerField<long double*>(this, "AShooterWeapon.LocalInventoryViewingSkippedEquipAnimTime"); }
-	float& DraggingOffsetInterpField() { return *GetNativePointerField<float*>(this, "AShooterWeapon.DraggingOffsetInterp"); }
-	bool& bForceTPVCameraOffsetField() { return *GetNativePointerField<bool*>(this, "AShooterWeapon.bForceTPVCameraOffset"); }
+	UAnimMontage * TPVForcePlayAnimField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("AShooterWeapon.TPVForcePlayAnim")>(this, "AShooterWeapon.TPVForcePlayAnim"); }
+	bool& bPreventOpeningInventoryField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bPreventOpeningInventory")>(this, "AShooterWeapon.bPreventOpeningInventory"); }
+	bool& bAllowUseOnSeatingStructureField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bAllowUseOnSeatingStructure")>(this, "AShooterWeapon.bAllowUseOnSeatingStructure"); }
+	bool& bOnlyUseOnSeatingStructureField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bOnlyUseOnSeatingStructure")>(this, "AShooterWeapon.bOnlyUseOnSeatingStructure"); }
+	bool& bBPDoClientCheckCanFireField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bBPDoClientCheckCanFire")>(this, "AShooterWeapon.bBPDoClientCheckCanFire"); }
+	bool& bRestrictTPVCameraYawField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bRestrictTPVCameraYaw")>(this, "AShooterWeapon.bRestrictTPVCameraYaw"); }
+	float& TPVCameraYawRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.TPVCameraYawRange")>(this, "AShooterWeapon.TPVCameraYawRange"); }
+	bool& bFoceSimulatedTickField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bFoceSimulatedTick")>(this, "AShooterWeapon.bFoceSimulatedTick"); }
+	bool& bWasLastFireFromGamePadField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bWasLastFireFromGamePad")>(this, "AShooterWeapon.bWasLastFireFromGamePad"); }
+	bool& bDisableWeaponCrosshairField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bDisableWeaponCrosshair")>(this, "AShooterWeapon.bDisableWeaponCrosshair"); }
+	UStaticMesh * DyePreviewMeshOverrideSMField() { return *GetNativePointerField<UStaticMesh **, API::FieldNameHash("AShooterWeapon.DyePreviewMeshOverrideSM")>(this, "AShooterWeapon.DyePreviewMeshOverrideSM"); }
+	bool& bBPOverrideAspectRatioField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bBPOverrideAspectRatio")>(this, "AShooterWeapon.bBPOverrideAspectRatio"); }
+	bool& bBPOverrideFPVMasterPoseComponentField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bBPOverrideFPVMasterPoseComponent")>(this, "AShooterWeapon.bBPOverrideFPVMasterPoseComponent"); }
+	bool& bForceAllowMountedWeaponryField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bForceAllowMountedWeaponry")>(this, "AShooterWeapon.bForceAllowMountedWeaponry"); }
+	float& FireCameraShakeSpreadScaleExponentField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.FireCameraShakeSpreadScaleExponent")>(this, "AShooterWeapon.FireCameraShakeSpreadScaleExponent"); }
+	float& FireCameraShakeSpreadScaleExponentLessThanField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.FireCameraShakeSpreadScaleExponentLessThan")>(this, "AShooterWeapon.FireCameraShakeSpreadScaleExponentLessThan"); }
+	float& FireCameraShakeSpreadScaleMultiplierLessThanField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.FireCameraShakeSpreadScaleMultiplierLessThan")>(this, "AShooterWeapon.FireCameraShakeSpreadScaleMultiplierLessThan"); }
+	float& FireCameraShakeSpreadScaleMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.FireCameraShakeSpreadScaleMultiplier")>(this, "AShooterWeapon.FireCameraShakeSpreadScaleMultiplier"); }
+	bool& bUseFireCameraShakeScaleField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bUseFireCameraShakeScale")>(this, "AShooterWeapon.bUseFireCameraShakeScale"); }
+	bool& bForceTickWithNoControllerField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bForceTickWithNoController")>(this, "AShooterWeapon.bForceTickWithNoController"); }
+	float& CurrentFiringSpreadField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.CurrentFiringSpread")>(this, "AShooterWeapon.CurrentFiringSpread"); }
+	TSubclassOf<APrimalBuff>& ScopedBuffField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*, API::FieldNameHash("AShooterWeapon.ScopedBuff")>(this, "AShooterWeapon.ScopedBuff"); }
+	TWeakObjectPtr<APrimalBuff>& MyScopedBuffField() { return *GetNativePointerField<TWeakObjectPtr<APrimalBuff>*, API::FieldNameHash("AShooterWeapon.MyScopedBuff")>(this, "AShooterWeapon.MyScopedBuff"); }
+	UAnimSequence * OverrideTPVShieldAnimationField() { return *GetNativePointerField<UAnimSequence **, API::FieldNameHash("AShooterWeapon.OverrideTPVShieldAnimation")>(this, "AShooterWeapon.OverrideTPVShieldAnimation"); }
+	bool& bAllowTargetingDuringMeleeSwingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bAllowTargetingDuringMeleeSwing")>(this, "AShooterWeapon.bAllowTargetingDuringMeleeSwing"); }
+	FVector& FPVMuzzleLocationOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterWeapon.FPVMuzzleLocationOffset")>(this, "AShooterWeapon.FPVMuzzleLocationOffset"); }
+	FVector& TPVMuzzleLocationOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterWeapon.TPVMuzzleLocationOffset")>(this, "AShooterWeapon.TPVMuzzleLocationOffset"); }
+	bool& bForceTPV_EquippedWhileRidingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bForceTPV_EquippedWhileRiding")>(this, "AShooterWeapon.bForceTPV_EquippedWhileRiding"); }
+	bool& bCutsEnemyGrapplingCableField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bCutsEnemyGrapplingCable")>(this, "AShooterWeapon.bCutsEnemyGrapplingCable"); }
+	FVector& FPVInventoryReequipOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterWeapon.FPVInventoryReequipOffset")>(this, "AShooterWeapon.FPVInventoryReequipOffset"); }
+	long double& LocalInventoryViewingSkippedEquipAnimTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterWeapon.LocalInventoryViewingSkippedEquipAnimTime")>(this, "AShooterWeapon.LocalInventoryViewingSkippedEquipAnimTime"); }
+	float& DraggingOffsetInterpField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterWeapon.DraggingOffsetInterp")>(this, "AShooterWeapon.DraggingOffsetInterp"); }
+	bool& bForceTPVCameraOffsetField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterWeapon.bForceTPVCameraOffset")>(this, "AShooterWeapon.bForceTPVCameraOffset"); }
 
 	// Bit fields
 
@@ -5834,16 +5834,16 @@ struct AShooterWeapon : AActor
 
 struct AAIController : AController
 {
-	FVector& MoveTowardTargetOffsetField() { return *GetNativePointerField<FVector*>(this, "AAIController.MoveTowardTargetOffset"); }
-	FVector& TargetFocalPositionOffsetField() { return *GetNativePointerField<FVector*>(this, "AAIController.TargetFocalPositionOffset"); }
-	float& ReachedDestinationThresholdOffsetField() { return *GetNativePointerField<float*>(this, "AAIController.ReachedDestinationThresholdOffset"); }
-	float& MovementGoalHeightField() { return *GetNativePointerField<float*>(this, "AAIController.MovementGoalHeight"); }
-	unsigned int& RequestMoveIDField() { return *GetNativePointerField<unsigned int*>(this, "AAIController.RequestMoveID"); }
-	TWeakObjectPtr<AActor>& CurrentGoalField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*>(this, "AAIController.CurrentGoal"); }
-	FVector& MoveSegmentDirectionField() { return *GetNativePointerField<FVector*>(this, "AAIController.MoveSegmentDirection"); }
-	int& MoveSegmentStartIndexField() { return *GetNativePointerField<int*>(this, "AAIController.MoveSegmentStartIndex"); }
-	int& MoveSegmentEndIndexField() { return *GetNativePointerField<int*>(this, "AAIController.MoveSegmentEndIndex"); }
-	float& CurrentAcceptanceRadiusField() { return *GetNativePointerField<float*>(this, "AAIController.CurrentAcceptanceRadius"); }
+	FVector& MoveTowardTargetOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AAIController.MoveTowardTargetOffset")>(this, "AAIController.MoveTowardTargetOffset"); }
+	FVector& TargetFocalPositionOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AAIController.TargetFocalPositionOffset")>(this, "AAIController.TargetFocalPositionOffset"); }
+	float& ReachedDestinationThresholdOffsetField() { return *GetNativePointerField<float*, API::FieldNameHash("AAIController.ReachedDestinationThresholdOffset")>(this, "AAIController.ReachedDestinationThresholdOffset"); }
+	float& MovementGoalHeightField() { return *GetNativePointerField<float*, API::FieldNameHash("AAIController.MovementGoalHeight")>(this, "AAIController.MovementGoalHeight"); }
+	unsigned int& RequestMoveIDField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("AAIController.RequestMoveID")>(this, "AAIController.RequestMoveID"); }
+	TWeakObjectPtr<AActor>& CurrentGoalField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*, API::FieldNameHash("AAIController.CurrentGoal")>(this, "AAIController.CurrentGoal"); }
+	FVector& MoveSegmentDirectionField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AAIController.MoveSegmentDirection")>(this, "AAIController.MoveSegmentDirection"); }
+	int& MoveSegmentStartIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("AAIController.MoveSegmentStartIndex")>(this, "AAIController.MoveSegmentStartIndex"); }
+	int& MoveSegmentEndIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("AAIController.MoveSegmentEndIndex")>(this, "AAIController.MoveSegmentEndIndex"); }
+	float& CurrentAcceptanceRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("AAIController.CurrentAcceptanceRadius")>(this, "AAIController.CurrentAcceptanceRadius"); }
 
 	// Bit fields
 
@@ -5895,123 +5895,123 @@ struct AAIController : AController
 
 struct APrimalDinoAIController : AAIController
 {
-	float& DieIfLeftWaterWanderMinimumWaterHeightMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.DieIfLeftWaterWanderMinimumWaterHeightMultiplier"); }
-	float& DieIfLeftWaterReachedRadiusDistanceCheckMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.DieIfLeftWaterReachedRadiusDistanceCheckMultiplier"); }
-	float& DieIfLeftWaterTargetUnsubmergedTimeoutField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.DieIfLeftWaterTargetUnsubmergedTimeout"); }
-	float& LandDinoMaxWaterTargetDepthCapsuleMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.LandDinoMaxWaterTargetDepthCapsuleMultiplier"); }
-	float& ExtraCorpseTargetingRangeField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.ExtraCorpseTargetingRange"); }
-	float& FleeFromAttackCoolDownTimeField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.FleeFromAttackCoolDownTime"); }
-	float& FleeFromAttackTimeLimitField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.FleeFromAttackTimeLimit"); }
-	float& ForceFleeUnderHealthPercentageField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.ForceFleeUnderHealthPercentage"); }
-	bool& bFleeOnCriticalHealthField() { return *GetNativePointerField<bool*>(this, "APrimalDinoAIController.bFleeOnCriticalHealth"); }
-	float& DieIfLeftWaterTargetingRequiresFreeDepthField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.DieIfLeftWaterTargetingRequiresFreeDepth"); }
-	long double& LastBlockadeCheckTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoAIController.LastBlockadeCheckTime"); }
-	long double& LastMovingAroundBlockadeTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoAIController.LastMovingAroundBlockadeTime"); }
-	float& MovingAroundBlockadeDirectionField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.MovingAroundBlockadeDirection"); }
-	FVector& MovingAroundBlockadePointField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoAIController.MovingAroundBlockadePoint"); }
-	float& LastBlockadeWidthField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.LastBlockadeWidth"); }
-	FVector& LastBlockadeHitNormalField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoAIController.LastBlockadeHitNormal"); }
-	FVector& LastBlockadeHitLocationField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoAIController.LastBlockadeHitLocation"); }
-	FVector& StartMovingAroundBlockadeLocationField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoAIController.StartMovingAroundBlockadeLocation"); }
-	AActor * LastMovingAroundBlockadeActorField() { return *GetNativePointerField<AActor **>(this, "APrimalDinoAIController.LastMovingAroundBlockadeActor"); }
-	AActor * TargetField() { return *GetNativePointerField<AActor **>(this, "APrimalDinoAIController.Target"); }
-	float& AttackDestinationOffsetField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.AttackDestinationOffset"); }
-	bool& bUseOverlapTargetCheckField() { return *GetNativePointerField<bool*>(this, "APrimalDinoAIController.bUseOverlapTargetCheck"); }
-	bool& bNotifyNeighborsWithoutDamageField() { return *GetNativePointerField<bool*>(this, "APrimalDinoAIController.bNotifyNeighborsWithoutDamage"); }
-	bool& bUseBPShouldNotifyNeighborField() { return *GetNativePointerField<bool*>(this, "APrimalDinoAIController.bUseBPShouldNotifyNeighbor"); }
-	bool& bRequireAbsoluteDamageForNeighborNotificationField() { return *GetNativePointerField<bool*>(this, "APrimalDinoAIController.bRequireAbsoluteDamageForNeighborNotification"); }
-	float& AboveDeltaZAttackRangeField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.AboveDeltaZAttackRange"); }
-	float& BelowDeltaZAttackRangeField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.BelowDeltaZAttackRange"); }
-	float& WildAboveDeltaZTargetingRangeField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.WildAboveDeltaZTargetingRange"); }
-	float& WildBelowDeltaZTargetingRangeField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.WildBelowDeltaZTargetingRange"); }
-	bool& bWildUseDeltaZTargetingForFlyerPawnOrBigDinoField() { return *GetNativePointerField<bool*>(this, "APrimalDinoAIController.bWildUseDeltaZTargetingForFlyerPawnOrBigDino"); }
-	bool& bDontWanderField() { return *GetNativePointerField<bool*>(this, "APrimalDinoAIController.bDontWander"); }
-	bool& bOnlyOverlapTargetCorpsesUnlessHasTargetField() { return *GetNativePointerField<bool*>(this, "APrimalDinoAIController.bOnlyOverlapTargetCorpsesUnlessHasTarget"); }
-	float& NaturalTargetingRangeField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.NaturalTargetingRange"); }
-	float& TamedTargetingRangeField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.TamedTargetingRange"); }
-	float& TamedCorpseFoodTargetingRangeField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.TamedCorpseFoodTargetingRange"); }
-	float& WanderRandomDistanceAmountField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.WanderRandomDistanceAmount"); }
-	float& FlyingWanderFixedDistanceAmountField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.FlyingWanderFixedDistanceAmount"); }
-	float& FlyingWanderRandomDistanceAmountField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.FlyingWanderRandomDistanceAmount"); }
-	float& MaxFlyingTargetDeltaZField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.MaxFlyingTargetDeltaZ"); }
-	float& WanderFlyingZScalerField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.WanderFlyingZScaler"); }
-	float& WanderFlyingClampZHeightAboveGroundField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.WanderFlyingClampZHeightAboveGround"); }
-	float& WanderFlyingMinZHeightAboveGroundField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.WanderFlyingMinZHeightAboveGround"); }
-	float& WanderFixedDistanceAmountField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.WanderFixedDistanceAmount"); }
-	bool& bUseAggroField() { return *GetNativePointerField<bool*>(this, "APrimalDinoAIController.bUseAggro"); }
-	float& MinAggroValueField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.MinAggroValue"); }
-	float& AggroToAddUponRemovingTargetField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.AggroToAddUponRemovingTarget"); }
-	float& AggroToAddUponAcquiringTargetField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.AggroToAddUponAcquiringTarget"); }
-	float& AggroFactorDecreaseSpeedField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.AggroFactorDecreaseSpeed"); }
-	float& AggroFactorDecreaseGracePeriodField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.AggroFactorDecreaseGracePeriod"); }
-	float& AggroFactorDamagePercentageMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.AggroFactorDamagePercentageMultiplier"); }
-	float& AggroNotifyNeighborsMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.AggroNotifyNeighborsMultiplier"); }
-	float& AggroNotifyNeighborsRangeField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.AggroNotifyNeighborsRange"); }
-	float& AggroNotifyNeighborsRangeFalloffField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.AggroNotifyNeighborsRangeFalloff"); }
-	float& TargetingDistanceReductionFactorLinearField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.TargetingDistanceReductionFactorLinear"); }
-	float& TargetingDistanceReductionFactorExponentField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.TargetingDistanceReductionFactorExponent"); }
-	float& BeyondTargetingRangeAggroAdditionField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.BeyondTargetingRangeAggroAddition"); }
-	float& AggroFactorDesirabilityMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.AggroFactorDesirabilityMultiplier"); }
-	float& AttackRangeField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.AttackRange"); }
-	float& AttackIntervalField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.AttackInterval"); }
-	float& AttackRotationRangeDegreesField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.AttackRotationRangeDegrees"); }
-	float& AttackRotationGroundSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.AttackRotationGroundSpeedMultiplier"); }
-	float& RangeTargetWildDinosMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.RangeTargetWildDinosMultiplier"); }
-	FRotator& AttackRotationRateField() { return *GetNativePointerField<FRotator*>(this, "APrimalDinoAIController.AttackRotationRate"); }
-	bool& bFocusOnTargetDuringAttackField() { return *GetNativePointerField<bool*>(this, "APrimalDinoAIController.bFocusOnTargetDuringAttack"); }
-	FVector& FlyingMoveTowardsTargetOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoAIController.FlyingMoveTowardsTargetOffset"); }
-	FVector& CombatFlyingMoveTowardsTargetOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoAIController.CombatFlyingMoveTowardsTargetOffset"); }
-	FVector& FlyingTargetFocalPositionOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoAIController.FlyingTargetFocalPositionOffset"); }
-	float& FlyingReachedDestinationThresholdOffsetField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.FlyingReachedDestinationThresholdOffset"); }
-	float& SeekingIntervalCheckToFlyField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.SeekingIntervalCheckToFly"); }
-	float& SeekingPercentChanceToFlyField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.SeekingPercentChanceToFly"); }
-	float& SeekingIntervalCheckToLandField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.SeekingIntervalCheckToLand"); }
-	float& SeekingPercentChanceToLandField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.SeekingPercentChanceToLand"); }
-	float& MinimumWanderGroundNormalZField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.MinimumWanderGroundNormalZ"); }
-	float& FollowStoppingDistanceField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.FollowStoppingDistance"); }
-	bool& bUseOverlapTargetCheckTracesField() { return *GetNativePointerField<bool*>(this, "APrimalDinoAIController.bUseOverlapTargetCheckTraces"); }
-	bool& bUseAlternateMovePointField() { return *GetNativePointerField<bool*>(this, "APrimalDinoAIController.bUseAlternateMovePoint"); }
-	bool& bTotallyIgnoreWaterTargetsField() { return *GetNativePointerField<bool*>(this, "APrimalDinoAIController.bTotallyIgnoreWaterTargets"); }
-	bool& bWaterDinoAllowUnsubmergedTargetsField() { return *GetNativePointerField<bool*>(this, "APrimalDinoAIController.bWaterDinoAllowUnsubmergedTargets"); }
-	FVector& LastCheckAttackRangePawnLocationField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoAIController.LastCheckAttackRangePawnLocation"); }
-	FVector& LastCheckAttackRangeClosestPointField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoAIController.LastCheckAttackRangeClosestPoint"); }
-	FVector& LastCheckAttackRangeTargetLocationField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoAIController.LastCheckAttackRangeTargetLocation"); }
-	AActor * LastCheckAttackRangeTargetField() { return *GetNativePointerField<AActor **>(this, "APrimalDinoAIController.LastCheckAttackRangeTarget"); }
-	TArray<float>& TamedAITargetingRangeMultipliersField() { return *GetNativePointerField<TArray<float>*>(this, "APrimalDinoAIController.TamedAITargetingRangeMultipliers"); }
-	float& MateBoostAggroNotifyNeighborsMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.MateBoostAggroNotifyNeighborsMultiplier"); }
-	TArray<TSubclassOf<APrimalDinoCharacter>>& AggroNotifyNeighborsClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalDinoCharacter>>*>(this, "APrimalDinoAIController.AggroNotifyNeighborsClasses"); }
-	float& MoveAroundBlockadeAdditionalWidthField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.MoveAroundBlockadeAdditionalWidth"); }
-	float& MoveAroundObjectMaxVelocityField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.MoveAroundObjectMaxVelocity"); }
-	float& ForcedAggroTimeCounterField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.ForcedAggroTimeCounter"); }
-	float& TamedMaxFollowDistanceField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.TamedMaxFollowDistance"); }
-	float& BaseStructureTargetingDesireField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.BaseStructureTargetingDesire"); }
-	float& LandDinoMaxFlyerTargetDeltaZField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.LandDinoMaxFlyerTargetDeltaZ"); }
-	float& NaturalMaxDepthZField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.NaturalMaxDepthZ"); }
-	TWeakObjectPtr<AActor>& ForcedAttackTargetField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*>(this, "APrimalDinoAIController.ForcedAttackTarget"); }
-	int& ForcedAttackEnemyTeamField() { return *GetNativePointerField<int*>(this, "APrimalDinoAIController.ForcedAttackEnemyTeam"); }
-	long double& LastForcedAttackEnemyTeamTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoAIController.LastForcedAttackEnemyTeamTime"); }
-	int& LastCharacterTargetTeamField() { return *GetNativePointerField<int*>(this, "APrimalDinoAIController.LastCharacterTargetTeam"); }
-	float& ForcedFleeDurationField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.ForcedFleeDuration"); }
-	float& MinAttackIntervalForFleeingField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.MinAttackIntervalForFleeing"); }
-	float& MinLocChangeIntervalForFleeingField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.MinLocChangeIntervalForFleeing"); }
-	float& PercentageTorporForFleeingField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.PercentageTorporForFleeing"); }
-	float& DamagedForceAggroIntervalField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.DamagedForceAggroInterval"); }
-	long double& ForceAggroUntilTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoAIController.ForceAggroUntilTime"); }
-	long double& LastExecutedAttackTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoAIController.LastExecutedAttackTime"); }
-	long double& LastForcedFleeTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoAIController.LastForcedFleeTime"); }
-	long double& LastFleeLocCheckTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoAIController.LastFleeLocCheckTime"); }
-	FVector& LastFleeLocCheckField() { return *GetNativePointerField<FVector*>(this, "APrimalDinoAIController.LastFleeLocCheck"); }
-	int& NumAlliesToAttackField() { return *GetNativePointerField<int*>(this, "APrimalDinoAIController.NumAlliesToAttack"); }
-	float& FindLandingPositionZOffsetField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.FindLandingPositionZOffset"); }
-	float& TamedFollowAcceptanceRadiusOffsetField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.TamedFollowAcceptanceRadiusOffset"); }
-	float& TamedFollowAcceptanceHeightOffsetField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.TamedFollowAcceptanceHeightOffset"); }
-	float& AIFlightMaxLandingZDistanceField() { return *GetNativePointerField<float*>(this, "APrimalDinoAIController.AIFlightMaxLandingZDistance"); }
-	long double& ForcedMoveToUntilTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoAIController.ForcedMoveToUntilTime"); }
-	long double& LastHadAggroEntriesTimeField() { return *GetNativePointerField<long double*>(this, "APrimalDinoAIController.LastHadAggroEntriesTime"); }
-	TArray<TSubclassOf<AActor>>& WildTargetingDesireMultiplierClassesField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*>(this, "APrimalDinoAIController.WildTargetingDesireMultiplierClasses"); }
-	TArray<float>& WildTargetingDesireMultiplierValuesField() { return *GetNativePointerField<TArray<float>*>(this, "APrimalDinoAIController.WildTargetingDesireMultiplierValues"); }
-	TArray<TSubclassOf<AActor>>& TamedTargetingDesireMultiplierClassesField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*>(this, "APrimalDinoAIController.TamedTargetingDesireMultiplierClasses"); }
-	TArray<float>& TamedTargetingDesireMultiplierValuesField() { return *GetNativePointerField<TArray<float>*>(this, "APrimalDinoAIController.TamedTargetingDesireMultiplierValues"); }
+	float& DieIfLeftWaterWanderMinimumWaterHeightMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.DieIfLeftWaterWanderMinimumWaterHeightMultiplier")>(this, "APrimalDinoAIController.DieIfLeftWaterWanderMinimumWaterHeightMultiplier"); }
+	float& DieIfLeftWaterReachedRadiusDistanceCheckMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.DieIfLeftWaterReachedRadiusDistanceCheckMultiplier")>(this, "APrimalDinoAIController.DieIfLeftWaterReachedRadiusDistanceCheckMultiplier"); }
+	float& DieIfLeftWaterTargetUnsubmergedTimeoutField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.DieIfLeftWaterTargetUnsubmergedTimeout")>(this, "APrimalDinoAIController.DieIfLeftWaterTargetUnsubmergedTimeout"); }
+	float& LandDinoMaxWaterTargetDepthCapsuleMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.LandDinoMaxWaterTargetDepthCapsuleMultiplier")>(this, "APrimalDinoAIController.LandDinoMaxWaterTargetDepthCapsuleMultiplier"); }
+	float& ExtraCorpseTargetingRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.ExtraCorpseTargetingRange")>(this, "APrimalDinoAIController.ExtraCorpseTargetingRange"); }
+	float& FleeFromAttackCoolDownTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.FleeFromAttackCoolDownTime")>(this, "APrimalDinoAIController.FleeFromAttackCoolDownTime"); }
+	float& FleeFromAttackTimeLimitField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.FleeFromAttackTimeLimit")>(this, "APrimalDinoAIController.FleeFromAttackTimeLimit"); }
+	float& ForceFleeUnderHealthPercentageField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.ForceFleeUnderHealthPercentage")>(this, "APrimalDinoAIController.ForceFleeUnderHealthPercentage"); }
+	bool& bFleeOnCriticalHealthField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalDinoAIController.bFleeOnCriticalHealth")>(this, "APrimalDinoAIController.bFleeOnCriticalHealth"); }
+	float& DieIfLeftWaterTargetingRequiresFreeDepthField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.DieIfLeftWaterTargetingRequiresFreeDepth")>(this, "APrimalDinoAIController.DieIfLeftWaterTargetingRequiresFreeDepth"); }
+	long double& LastBlockadeCheckTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoAIController.LastBlockadeCheckTime")>(this, "APrimalDinoAIController.LastBlockadeCheckTime"); }
+	long double& LastMovingAroundBlockadeTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoAIController.LastMovingAroundBlockadeTime")>(this, "APrimalDinoAIController.LastMovingAroundBlockadeTime"); }
+	float& MovingAroundBlockadeDirectionField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.MovingAroundBlockadeDirection")>(this, "APrimalDinoAIController.MovingAroundBlockadeDirection"); }
+	FVector& MovingAroundBlockadePointField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoAIController.MovingAroundBlockadePoint")>(this, "APrimalDinoAIController.MovingAroundBlockadePoint"); }
+	float& LastBlockadeWidthField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.LastBlockadeWidth")>(this, "APrimalDinoAIController.LastBlockadeWidth"); }
+	FVector& LastBlockadeHitNormalField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoAIController.LastBlockadeHitNormal")>(this, "APrimalDinoAIController.LastBlockadeHitNormal"); }
+	FVector& LastBlockadeHitLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoAIController.LastBlockadeHitLocation")>(this, "APrimalDinoAIController.LastBlockadeHitLocation"); }
+	FVector& StartMovingAroundBlockadeLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoAIController.StartMovingAroundBlockadeLocation")>(this, "APrimalDinoAIController.StartMovingAroundBlockadeLocation"); }
+	AActor * LastMovingAroundBlockadeActorField() { return *GetNativePointerField<AActor **, API::FieldNameHash("APrimalDinoAIController.LastMovingAroundBlockadeActor")>(this, "APrimalDinoAIController.LastMovingAroundBlockadeActor"); }
+	AActor * TargetField() { return *GetNativePointerField<AActor **, API::FieldNameHash("APrimalDinoAIController.Target")>(this, "APrimalDinoAIController.Target"); }
+	float& AttackDestinationOffsetField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.AttackDestinationOffset")>(this, "APrimalDinoAIController.AttackDestinationOffset"); }
+	bool& bUseOverlapTargetCheckField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalDinoAIController.bUseOverlapTargetCheck")>(this, "APrimalDinoAIController.bUseOverlapTargetCheck"); }
+	bool& bNotifyNeighborsWithoutDamageField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalDinoAIController.bNotifyNeighborsWithoutDamage")>(this, "APrimalDinoAIController.bNotifyNeighborsWithoutDamage"); }
+	bool& bUseBPShouldNotifyNeighborField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalDinoAIController.bUseBPShouldNotifyNeighbor")>(this, "APrimalDinoAIController.bUseBPShouldNotifyNeighbor"); }
+	bool& bRequireAbsoluteDamageForNeighborNotificationField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalDinoAIController.bRequireAbsoluteDamageForNeighborNotification")>(this, "APrimalDinoAIController.bRequireAbsoluteDamageForNeighborNotification"); }
+	float& AboveDeltaZAttackRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.AboveDeltaZAttackRange")>(this, "APrimalDinoAIController.AboveDeltaZAttackRange"); }
+	float& BelowDeltaZAttackRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.BelowDeltaZAttackRange")>(this, "APrimalDinoAIController.BelowDeltaZAttackRange"); }
+	float& WildAboveDeltaZTargetingRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.WildAboveDeltaZTargetingRange")>(this, "APrimalDinoAIController.WildAboveDeltaZTargetingRange"); }
+	float& WildBelowDeltaZTargetingRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.WildBelowDeltaZTargetingRange")>(this, "APrimalDinoAIController.WildBelowDeltaZTargetingRange"); }
+	bool& bWildUseDeltaZTargetingForFlyerPawnOrBigDinoField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalDinoAIController.bWildUseDeltaZTargetingForFlyerPawnOrBigDino")>(this, "APrimalDinoAIController.bWildUseDeltaZTargetingForFlyerPawnOrBigDino"); }
+	bool& bDontWanderField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalDinoAIController.bDontWander")>(this, "APrimalDinoAIController.bDontWander"); }
+	bool& bOnlyOverlapTargetCorpsesUnlessHasTargetField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalDinoAIController.bOnlyOverlapTargetCorpsesUnlessHasTarget")>(this, "APrimalDinoAIController.bOnlyOverlapTargetCorpsesUnlessHasTarget"); }
+	float& NaturalTargetingRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.NaturalTargetingRange")>(this, "APrimalDinoAIController.NaturalTargetingRange"); }
+	float& TamedTargetingRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.TamedTargetingRange")>(this, "APrimalDinoAIController.TamedTargetingRange"); }
+	float& TamedCorpseFoodTargetingRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.TamedCorpseFoodTargetingRange")>(this, "APrimalDinoAIController.TamedCorpseFoodTargetingRange"); }
+	float& WanderRandomDistanceAmountField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.WanderRandomDistanceAmount")>(this, "APrimalDinoAIController.WanderRandomDistanceAmount"); }
+	float& FlyingWanderFixedDistanceAmountField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.FlyingWanderFixedDistanceAmount")>(this, "APrimalDinoAIController.FlyingWanderFixedDistanceAmount"); }
+	float& FlyingWanderRandomDistanceAmountField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.FlyingWanderRandomDistanceAmount")>(this, "APrimalDinoAIController.FlyingWanderRandomDistanceAmount"); }
+	float& MaxFlyingTargetDeltaZField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.MaxFlyingTargetDeltaZ")>(this, "APrimalDinoAIController.MaxFlyingTargetDeltaZ"); }
+	float& WanderFlyingZScalerField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.WanderFlyingZScaler")>(this, "APrimalDinoAIController.WanderFlyingZScaler"); }
+	float& WanderFlyingClampZHeightAboveGroundField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.WanderFlyingClampZHeightAboveGround")>(this, "APrimalDinoAIController.WanderFlyingClampZHeightAboveGround"); }
+	float& WanderFlyingMinZHeightAboveGroundField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.WanderFlyingMinZHeightAboveGround")>(this, "APrimalDinoAIController.WanderFlyingMinZHeightAboveGround"); }
+	float& WanderFixedDistanceAmountField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.WanderFixedDistanceAmount")>(this, "APrimalDinoAIController.WanderFixedDistanceAmount"); }
+	bool& bUseAggroField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalDinoAIController.bUseAggro")>(this, "APrimalDinoAIController.bUseAggro"); }
+	float& MinAggroValueField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.MinAggroValue")>(this, "APrimalDinoAIController.MinAggroValue"); }
+	float& AggroToAddUponRemovingTargetField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.AggroToAddUponRemovingTarget")>(this, "APrimalDinoAIController.AggroToAddUponRemovingTarget"); }
+	float& AggroToAddUponAcquiringTargetField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.AggroToAddUponAcquiringTarget")>(this, "APrimalDinoAIController.AggroToAddUponAcquiringTarget"); }
+	float& AggroFactorDecreaseSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.AggroFactorDecreaseSpeed")>(this, "APrimalDinoAIController.AggroFactorDecreaseSpeed"); }
+	float& AggroFactorDecreaseGracePeriodField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.AggroFactorDecreaseGracePeriod")>(this, "APrimalDinoAIController.AggroFactorDecreaseGracePeriod"); }
+	float& AggroFactorDamagePercentageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.AggroFactorDamagePercentageMultiplier")>(this, "APrimalDinoAIController.AggroFactorDamagePercentageMultiplier"); }
+	float& AggroNotifyNeighborsMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.AggroNotifyNeighborsMultiplier")>(this, "APrimalDinoAIController.AggroNotifyNeighborsMultiplier"); }
+	float& AggroNotifyNeighborsRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.AggroNotifyNeighborsRange")>(this, "APrimalDinoAIController.AggroNotifyNeighborsRange"); }
+	float& AggroNotifyNeighborsRangeFalloffField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.AggroNotifyNeighborsRangeFalloff")>(this, "APrimalDinoAIController.AggroNotifyNeighborsRangeFalloff"); }
+	float& TargetingDistanceReductionFactorLinearField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.TargetingDistanceReductionFactorLinear")>(this, "APrimalDinoAIController.TargetingDistanceReductionFactorLinear"); }
+	float& TargetingDistanceReductionFactorExponentField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.TargetingDistanceReductionFactorExponent")>(this, "APrimalDinoAIController.TargetingDistanceReductionFactorExponent"); }
+	float& BeyondTargetingRangeAggroAdditionField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.BeyondTargetingRangeAggroAddition")>(this, "APrimalDinoAIController.BeyondTargetingRangeAggroAddition"); }
+	float& AggroFactorDesirabilityMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.AggroFactorDesirabilityMultiplier")>(this, "APrimalDinoAIController.AggroFactorDesirabilityMultiplier"); }
+	float& AttackRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.AttackRange")>(this, "APrimalDinoAIController.AttackRange"); }
+	float& AttackIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.AttackInterval")>(this, "APrimalDinoAIController.AttackInterval"); }
+	float& AttackRotationRangeDegreesField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.AttackRotationRangeDegrees")>(this, "APrimalDinoAIController.AttackRotationRangeDegrees"); }
+	float& AttackRotationGroundSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.AttackRotationGroundSpeedMultiplier")>(this, "APrimalDinoAIController.AttackRotationGroundSpeedMultiplier"); }
+	float& RangeTargetWildDinosMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.RangeTargetWildDinosMultiplier")>(this, "APrimalDinoAIController.RangeTargetWildDinosMultiplier"); }
+	FRotator& AttackRotationRateField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalDinoAIController.AttackRotationRate")>(this, "APrimalDinoAIController.AttackRotationRate"); }
+	bool& bFocusOnTargetDuringAttackField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalDinoAIController.bFocusOnTargetDuringAttack")>(this, "APrimalDinoAIController.bFocusOnTargetDuringAttack"); }
+	FVector& FlyingMoveTowardsTargetOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoAIController.FlyingMoveTowardsTargetOffset")>(this, "APrimalDinoAIController.FlyingMoveTowardsTargetOffset"); }
+	FVector& CombatFlyingMoveTowardsTargetOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoAIController.CombatFlyingMoveTowardsTargetOffset")>(this, "APrimalDinoAIController.CombatFlyingMoveTowardsTargetOffset"); }
+	FVector& FlyingTargetFocalPositionOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoAIController.FlyingTargetFocalPositionOffset")>(this, "APrimalDinoAIController.FlyingTargetFocalPositionOffset"); }
+	float& FlyingReachedDestinationThresholdOffsetField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.FlyingReachedDestinationThresholdOffset")>(this, "APrimalDinoAIController.FlyingReachedDestinationThresholdOffset"); }
+	float& SeekingIntervalCheckToFlyField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.SeekingIntervalCheckToFly")>(this, "APrimalDinoAIController.SeekingIntervalCheckToFly"); }
+	float& SeekingPercentChanceToFlyField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.SeekingPercentChanceToFly")>(this, "APrimalDinoAIController.SeekingPercentChanceToFly"); }
+	float& SeekingIntervalCheckToLandField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.SeekingIntervalCheckToLand")>(this, "APrimalDinoAIController.SeekingIntervalCheckToLand"); }
+	float& SeekingPercentChanceToLandField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.SeekingPercentChanceToLand")>(this, "APrimalDinoAIController.SeekingPercentChanceToLand"); }
+	float& MinimumWanderGroundNormalZField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.MinimumWanderGroundNormalZ")>(this, "APrimalDinoAIController.MinimumWanderGroundNormalZ"); }
+	float& FollowStoppingDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.FollowStoppingDistance")>(this, "APrimalDinoAIController.FollowStoppingDistance"); }
+	bool& bUseOverlapTargetCheckTracesField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalDinoAIController.bUseOverlapTargetCheckTraces")>(this, "APrimalDinoAIController.bUseOverlapTargetCheckTraces"); }
+	bool& bUseAlternateMovePointField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalDinoAIController.bUseAlternateMovePoint")>(this, "APrimalDinoAIController.bUseAlternateMovePoint"); }
+	bool& bTotallyIgnoreWaterTargetsField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalDinoAIController.bTotallyIgnoreWaterTargets")>(this, "APrimalDinoAIController.bTotallyIgnoreWaterTargets"); }
+	bool& bWaterDinoAllowUnsubmergedTargetsField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalDinoAIController.bWaterDinoAllowUnsubmergedTargets")>(this, "APrimalDinoAIController.bWaterDinoAllowUnsubmergedTargets"); }
+	FVector& LastCheckAttackRangePawnLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoAIController.LastCheckAttackRangePawnLocation")>(this, "APrimalDinoAIController.LastCheckAttackRangePawnLocation"); }
+	FVector& LastCheckAttackRangeClosestPointField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoAIController.LastCheckAttackRangeClosestPoint")>(this, "APrimalDinoAIController.LastCheckAttackRangeClosestPoint"); }
+	FVector& LastCheckAttackRangeTargetLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoAIController.LastCheckAttackRangeTargetLocation")>(this, "APrimalDinoAIController.LastCheckAttackRangeTargetLocation"); }
+	AActor * LastCheckAttackRangeTargetField() { return *GetNativePointerField<AActor **, API::FieldNameHash("APrimalDinoAIController.LastCheckAttackRangeTarget")>(this, "APrimalDinoAIController.LastCheckAttackRangeTarget"); }
+	TArray<float>& TamedAITargetingRangeMultipliersField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("APrimalDinoAIController.TamedAITargetingRangeMultipliers")>(this, "APrimalDinoAIController.TamedAITargetingRangeMultipliers"); }
+	float& MateBoostAggroNotifyNeighborsMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.MateBoostAggroNotifyNeighborsMultiplier")>(this, "APrimalDinoAIController.MateBoostAggroNotifyNeighborsMultiplier"); }
+	TArray<TSubclassOf<APrimalDinoCharacter>>& AggroNotifyNeighborsClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalDinoCharacter>>*, API::FieldNameHash("APrimalDinoAIController.AggroNotifyNeighborsClasses")>(this, "APrimalDinoAIController.AggroNotifyNeighborsClasses"); }
+	float& MoveAroundBlockadeAdditionalWidthField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.MoveAroundBlockadeAdditionalWidth")>(this, "APrimalDinoAIController.MoveAroundBlockadeAdditionalWidth"); }
+	float& MoveAroundObjectMaxVelocityField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.MoveAroundObjectMaxVelocity")>(this, "APrimalDinoAIController.MoveAroundObjectMaxVelocity"); }
+	float& ForcedAggroTimeCounterField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.ForcedAggroTimeCounter")>(this, "APrimalDinoAIController.ForcedAggroTimeCounter"); }
+	float& TamedMaxFollowDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.TamedMaxFollowDistance")>(this, "APrimalDinoAIController.TamedMaxFollowDistance"); }
+	float& BaseStructureTargetingDesireField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.BaseStructureTargetingDesire")>(this, "APrimalDinoAIController.BaseStructureTargetingDesire"); }
+	float& LandDinoMaxFlyerTargetDeltaZField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.LandDinoMaxFlyerTargetDeltaZ")>(this, "APrimalDinoAIController.LandDinoMaxFlyerTargetDeltaZ"); }
+	float& NaturalMaxDepthZField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.NaturalMaxDepthZ")>(this, "APrimalDinoAIController.NaturalMaxDepthZ"); }
+	TWeakObjectPtr<AActor>& ForcedAttackTargetField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*, API::FieldNameHash("APrimalDinoAIController.ForcedAttackTarget")>(this, "APrimalDinoAIController.ForcedAttackTarget"); }
+	int& ForcedAttackEnemyTeamField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoAIController.ForcedAttackEnemyTeam")>(this, "APrimalDinoAIController.ForcedAttackEnemyTeam"); }
+	long double& LastForcedAttackEnemyTeamTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoAIController.LastForcedAttackEnemyTeamTime")>(this, "APrimalDinoAIController.LastForcedAttackEnemyTeamTime"); }
+	int& LastCharacterTargetTeamField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoAIController.LastCharacterTargetTeam")>(this, "APrimalDinoAIController.LastCharacterTargetTeam"); }
+	float& ForcedFleeDurationField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.ForcedFleeDuration")>(this, "APrimalDinoAIController.ForcedFleeDuration"); }
+	float& MinAttackIntervalForFleeingField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.MinAttackIntervalForFleeing")>(this, "APrimalDinoAIController.MinAttackIntervalForFleeing"); }
+	float& MinLocChangeIntervalForFleeingField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.MinLocChangeIntervalForFleeing")>(this, "APrimalDinoAIController.MinLocChangeIntervalForFleeing"); }
+	float& PercentageTorporForFleeingField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.PercentageTorporForFleeing")>(this, "APrimalDinoAIController.PercentageTorporForFleeing"); }
+	float& DamagedForceAggroIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.DamagedForceAggroInterval")>(this, "APrimalDinoAIController.DamagedForceAggroInterval"); }
+	long double& ForceAggroUntilTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoAIController.ForceAggroUntilTime")>(this, "APrimalDinoAIController.ForceAggroUntilTime"); }
+	long double& LastExecutedAttackTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoAIController.LastExecutedAttackTime")>(this, "APrimalDinoAIController.LastExecutedAttackTime"); }
+	long double& LastForcedFleeTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoAIController.LastForcedFleeTime")>(this, "APrimalDinoAIController.LastForcedFleeTime"); }
+	long double& LastFleeLocCheckTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoAIController.LastFleeLocCheckTime")>(this, "APrimalDinoAIController.LastFleeLocCheckTime"); }
+	FVector& LastFleeLocCheckField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalDinoAIController.LastFleeLocCheck")>(this, "APrimalDinoAIController.LastFleeLocCheck"); }
+	int& NumAlliesToAttackField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalDinoAIController.NumAlliesToAttack")>(this, "APrimalDinoAIController.NumAlliesToAttack"); }
+	float& FindLandingPositionZOffsetField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.FindLandingPositionZOffset")>(this, "APrimalDinoAIController.FindLandingPositionZOffset"); }
+	float& TamedFollowAcceptanceRadiusOffsetField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.TamedFollowAcceptanceRadiusOffset")>(this, "APrimalDinoAIController.TamedFollowAcceptanceRadiusOffset"); }
+	float& TamedFollowAcceptanceHeightOffsetField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.TamedFollowAcceptanceHeightOffset")>(this, "APrimalDinoAIController.TamedFollowAcceptanceHeightOffset"); }
+	float& AIFlightMaxLandingZDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalDinoAIController.AIFlightMaxLandingZDistance")>(this, "APrimalDinoAIController.AIFlightMaxLandingZDistance"); }
+	long double& ForcedMoveToUntilTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoAIController.ForcedMoveToUntilTime")>(this, "APrimalDinoAIController.ForcedMoveToUntilTime"); }
+	long double& LastHadAggroEntriesTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalDinoAIController.LastHadAggroEntriesTime")>(this, "APrimalDinoAIController.LastHadAggroEntriesTime"); }
+	TArray<TSubclassOf<AActor>>& WildTargetingDesireMultiplierClassesField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*, API::FieldNameHash("APrimalDinoAIController.WildTargetingDesireMultiplierClasses")>(this, "APrimalDinoAIController.WildTargetingDesireMultiplierClasses"); }
+	TArray<float>& WildTargetingDesireMultiplierValuesField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("APrimalDinoAIController.WildTargetingDesireMultiplierValues")>(this, "APrimalDinoAIController.WildTargetingDesireMultiplierValues"); }
+	TArray<TSubclassOf<AActor>>& TamedTargetingDesireMultiplierClassesField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*, API::FieldNameHash("APrimalDinoAIController.TamedTargetingDesireMultiplierClasses")>(this, "APrimalDinoAIController.TamedTargetingDesireMultiplierClasses"); }
+	TArray<float>& TamedTargetingDesireMultiplierValuesField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("APrimalDinoAIController.TamedTargetingDesireMultiplierValues")>(this, "APrimalDinoAIController.TamedTargetingDesireMultiplierValues"); }
 
 	// Bit fields
 
@@ -6096,29 +6096,29 @@ struct APrimalDinoAIController : AAIController
 
 struct ADroppedItem : AActor
 {
-	FItemNetInfo& MyItemInfoField() { return *GetNativePointerField<FItemNetInfo*>(this, "ADroppedItem.MyItemInfo"); }
-	UPrimalItem * MyItemField() { return *GetNativePointerField<UPrimalItem **>(this, "ADroppedItem.MyItem"); }
-	float& ImpulseMagnitudeField() { return *GetNativePointerField<float*>(this, "ADroppedItem.ImpulseMagnitude"); }
-	float& ForceSleepTimerField() { return *GetNativePointerField<float*>(this, "ADroppedItem.ForceSleepTimer"); }
-	FVector& DroppedItemScaleField() { return *GetNativePointerField<FVector*>(this, "ADroppedItem.DroppedItemScale"); }
-	FVector2D& OverlayTooltipPaddingField() { return *GetNativePointerField<FVector2D*>(this, "ADroppedItem.OverlayTooltipPadding"); }
-	FVector2D& OverlayTooltipScaleField() { return *GetNativePointerField<FVector2D*>(this, "ADroppedItem.OverlayTooltipScale"); }
-	FString& DroppedByNameField() { return *GetNativePointerField<FString*>(this, "ADroppedItem.DroppedByName"); }
-	unsigned __int64& DroppedByPlayerIDField() { return *GetNativePointerField<unsigned __int64*>(this, "ADroppedItem.DroppedByPlayerID"); }
-	long double& DroppedItemDestructionTimeField() { return *GetNativePointerField<long double*>(this, "ADroppedItem.DroppedItemDestructionTime"); }
-	bool& bClientDisablePhysicsField() { return *GetNativePointerField<bool*>(this, "ADroppedItem.bClientDisablePhysics"); }
-	UStaticMesh * NetDroppedMeshOverrideField() { return *GetNativePointerField<UStaticMesh **>(this, "ADroppedItem.NetDroppedMeshOverride"); }
-	UMaterialInterface * NetDroppedMeshMaterialOverrideField() { return *GetNativePointerField<UMaterialInterface **>(this, "ADroppedItem.NetDroppedMeshMaterialOverride"); }
-	FVector& NetDroppedMeshOverrideScale3DField() { return *GetNativePointerField<FVector*>(this, "ADroppedItem.NetDroppedMeshOverrideScale3D"); }
-	float& MaxPickUpDistanceField() { return *GetNativePointerField<float*>(this, "ADroppedItem.MaxPickUpDistance"); }
-	float& PrevLinearDampingField() { return *GetNativePointerField<float*>(this, "ADroppedItem.PrevLinearDamping"); }
-	float& PrevAngularDampingField() { return *GetNativePointerField<float*>(this, "ADroppedItem.PrevAngularDamping"); }
-	long double& SpawnDropSoundTimeField() { return *GetNativePointerField<long double*>(this, "ADroppedItem.SpawnDropSoundTime"); }
-	FVector& PreviousLocationField() { return *GetNativePointerField<FVector*>(this, "ADroppedItem.PreviousLocation"); }
-	TWeakObjectPtr<AActor>& DroppedByActorField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*>(this, "ADroppedItem.DroppedByActor"); }
-	long double& PhysicsKeepAliveUntilTimeField() { return *GetNativePointerField<long double*>(this, "ADroppedItem.PhysicsKeepAliveUntilTime"); }
-	float& FreezePhysicsAfterTimeField() { return *GetNativePointerField<float*>(this, "ADroppedItem.FreezePhysicsAfterTime"); }
-	float& DroppedLifeSpanOverrideField() { return *GetNativePointerField<float*>(this, "ADroppedItem.DroppedLifeSpanOverride"); }
+	FItemNetInfo& MyItemInfoField() { return *GetNativePointerField<FItemNetInfo*, API::FieldNameHash("ADroppedItem.MyItemInfo")>(this, "ADroppedItem.MyItemInfo"); }
+	UPrimalItem * MyItemField() { return *GetNativePointerField<UPrimalItem **, API::FieldNameHash("ADroppedItem.MyItem")>(this, "ADroppedItem.MyItem"); }
+	float& ImpulseMagnitudeField() { return *GetNativePointerField<float*, API::FieldNameHash("ADroppedItem.ImpulseMagnitude")>(this, "ADroppedItem.ImpulseMagnitude"); }
+	float& ForceSleepTimerField() { return *GetNativePointerField<float*, API::FieldNameHash("ADroppedItem.ForceSleepTimer")>(this, "ADroppedItem.ForceSleepTimer"); }
+	FVector& DroppedItemScaleField() { return *GetNativePointerField<FVector*, API::FieldNameHash("ADroppedItem.DroppedItemScale")>(this, "ADroppedItem.DroppedItemScale"); }
+	FVector2D& OverlayTooltipPaddingField() { return *GetNativePointerField<FVector2D*, API::FieldNameHash("ADroppedItem.OverlayTooltipPadding")>(this, "ADroppedItem.OverlayTooltipPadding"); }
+	FVector2D& OverlayTooltipScaleField() { return *GetNativePointerField<FVector2D*, API::FieldNameHash("ADroppedItem.OverlayTooltipScale")>(this, "ADroppedItem.OverlayTooltipScale"); }
+	FString& DroppedByNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("ADroppedItem.DroppedByName")>(this, "ADroppedItem.DroppedByName"); }
+	unsigned __int64& DroppedByPlayerIDField() { return *GetNativePointerField<unsigned __int64*, API::FieldNameHash("ADroppedItem.DroppedByPlayerID")>(this, "ADroppedItem.DroppedByPlayerID"); }
+	long double& DroppedItemDestructionTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("ADroppedItem.DroppedItemDestructionTime")>(this, "ADroppedItem.DroppedItemDestructionTime"); }
+	bool& bClientDisablePhysicsField() { return *GetNativePointerField<bool*, API::FieldNameHash("ADroppedItem.bClientDisablePhysics")>(this, "ADroppedItem.bClientDisablePhysics"); }
+	UStaticMesh * NetDroppedMeshOverrideField() { return *GetNativePointerField<UStaticMesh **, API::FieldNameHash("ADroppedItem.NetDroppedMeshOverride")>(this, "ADroppedItem.NetDroppedMeshOverride"); }
+	UMaterialInterface * NetDroppedMeshMaterialOverrideField() { return *GetNativePointerField<UMaterialInterface **, API::FieldNameHash("ADroppedItem.NetDroppedMeshMaterialOverride")>(this, "ADroppedItem.NetDroppedMeshMaterialOverride"); }
+	FVector& NetDroppedMeshOverrideScale3DField() { return *GetNativePointerField<FVector*, API::FieldNameHash("ADroppedItem.NetDroppedMeshOverrideScale3D")>(this, "ADroppedItem.NetDroppedMeshOverrideScale3D"); }
+	float& MaxPickUpDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("ADroppedItem.MaxPickUpDistance")>(this, "ADroppedItem.MaxPickUpDistance"); }
+	float& PrevLinearDampingField() { return *GetNativePointerField<float*, API::FieldNameHash("ADroppedItem.PrevLinearDamping")>(this, "ADroppedItem.PrevLinearDamping"); }
+	float& PrevAngularDampingField() { return *GetNativePointerField<float*, API::FieldNameHash("ADroppedItem.PrevAngularDamping")>(this, "ADroppedItem.PrevAngularDamping"); }
+	long double& SpawnDropSoundTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("ADroppedItem.SpawnDropSoundTime")>(this, "ADroppedItem.SpawnDropSoundTime"); }
+	FVector& PreviousLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("ADroppedItem.PreviousLocation")>(this, "ADroppedItem.PreviousLocation"); }
+	TWeakObjectPtr<AActor>& DroppedByActorField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*, API::FieldNameHash("ADroppedItem.DroppedByActor")>(this, "ADroppedItem.DroppedByActor"); }
+	long double& PhysicsKeepAliveUntilTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("ADroppedItem.PhysicsKeepAliveUntilTime")>(this, "ADroppedItem.PhysicsKeepAliveUntilTime"); }
+	float& FreezePhysicsAfterTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("ADroppedItem.FreezePhysicsAfterTime")>(this, "ADroppedItem.FreezePhysicsAfterTime"); }
+	float& DroppedLifeSpanOverrideField() { return *GetNativePointerField<float*, API::FieldNameHash("ADroppedItem.DroppedLifeSpanOverride")>(this, "ADroppedItem.DroppedLifeSpanOverride"); }
 
 	// Bit fields
 
@@ -6149,14 +6149,14 @@ struct ADroppedItem : AActor
 
 struct AMatineeActor : AActor
 {
-	FName& MatineeControllerNameField() { return *GetNativePointerField<FName*>(this, "AMatineeActor.MatineeControllerName"); }
-	float& PlayRateField() { return *GetNativePointerField<float*>(this, "AMatineeActor.PlayRate"); }
-	float& ForceStartPositionField() { return *GetNativePointerField<float*>(this, "AMatineeActor.ForceStartPosition"); }
-	int& MatineeManagerPriorityField() { return *GetNativePointerField<int*>(this, "AMatineeActor.MatineeManagerPriority"); }
-	int& PreferredSplitScreenNumField() { return *GetNativePointerField<int*>(this, "AMatineeActor.PreferredSplitScreenNum"); }
-	float& InterpPositionField() { return *GetNativePointerField<float*>(this, "AMatineeActor.InterpPosition"); }
-	float& ClientSidePositionErrorToleranceField() { return *GetNativePointerField<float*>(this, "AMatineeActor.ClientSidePositionErrorTolerance"); }
-	char& ReplicationForceIsPlayingField() { return *GetNativePointerField<char*>(this, "AMatineeActor.ReplicationForceIsPlaying"); }
+	FName& MatineeControllerNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("AMatineeActor.MatineeControllerName")>(this, "AMatineeActor.MatineeControllerName"); }
+	float& PlayRateField() { return *GetNativePointerField<float*, API::FieldNameHash("AMatineeActor.PlayRate")>(this, "AMatineeActor.PlayRate"); }
+	float& ForceStartPositionField() { return *GetNativePointerField<float*, API::FieldNameHash("AMatineeActor.ForceStartPosition")>(this, "AMatineeActor.ForceStartPosition"); }
+	int& MatineeManagerPriorityField() { return *GetNativePointerField<int*, API::FieldNameHash("AMatineeActor.MatineeManagerPriority")>(this, "AMatineeActor.MatineeManagerPriority"); }
+	int& PreferredSplitScreenNumField() { return *GetNativePointerField<int*, API::FieldNameHash("AMatineeActor.PreferredSplitScreenNum")>(this, "AMatineeActor.PreferredSplitScreenNum"); }
+	float& InterpPositionField() { return *GetNativePointerField<float*, API::FieldNameHash("AMatineeActor.InterpPosition")>(this, "AMatineeActor.InterpPosition"); }
+	float& ClientSidePositionErrorToleranceField() { return *GetNativePointerField<float*, API::FieldNameHash("AMatineeActor.ClientSidePositionErrorTolerance")>(this, "AMatineeActor.ClientSidePositionErrorTolerance"); }
+	char& ReplicationForceIsPlayingField() { return *GetNativePointerField<char*, API::FieldNameHash("AMatineeActor.ReplicationForceIsPlaying")>(this, "AMatineeActor.ReplicationForceIsPlaying"); }
 
 	// Functions
 
@@ -6195,117 +6195,117 @@ struct AMatineeActor : AActor
 
 struct UCharacterMovementComponent
 {
-	ACharacter * CharacterOwnerField() { return *GetNativePointerField<ACharacter **>(this, "UCharacterMovementComponent.CharacterOwner"); }
-	float& MaxStepHeightField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.MaxStepHeight"); }
-	float& JumpZVelocityField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.JumpZVelocity"); }
-	float& JumpOffJumpZFactorField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.JumpOffJumpZFactor"); }
-	bool& bSlipOffLedgesField() { return *GetNativePointerField<bool*>(this, "UCharacterMovementComponent.bSlipOffLedges"); }
-	float& LedgeSlipCapsuleRadiusMultiplierField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.LedgeSlipCapsuleRadiusMultiplier"); }
-	float& LedgeSlipPushVelocityField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.LedgeSlipPushVelocity"); }
-	float& LedgeSlipVelocityBuildUpMultiplierField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.LedgeSlipVelocityBuildUpMultiplier"); }
-	float& WalkableFloorAngleField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.WalkableFloorAngle"); }
-	float& WalkableFloorZField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.WalkableFloorZ"); }
-	TEnumAsByte<enum EMovementMode>& MovementModeField() { return *GetNativePointerField<TEnumAsByte<enum EMovementMode>*>(this, "UCharacterMovementComponent.MovementMode"); }
-	char& CustomMovementModeField() { return *GetNativePointerField<char*>(this, "UCharacterMovementComponent.CustomMovementMode"); }
-	FVector& OldBaseLocationField() { return *GetNativePointerField<FVector*>(this, "UCharacterMovementComponent.OldBaseLocation"); }
-	FQuat& OldBaseQuatField() { return *GetNativePointerField<FQuat*>(this, "UCharacterMovementComponent.OldBaseQuat"); }
-	long double& LastNonZeroAccelField() { return *GetNativePointerField<long double*>(this, "UCharacterMovementComponent.LastNonZeroAccel"); }
-	float& CurrentLedgeSlipPushVelocityField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.CurrentLedgeSlipPushVelocity"); }
-	int& LastFrameDisabledFloorBasingField() { return *GetNativePointerField<int*>(this, "UCharacterMovementComponent.LastFrameDisabledFloorBasing"); }
-	long double& ForceBigPushingTimeField() { return *GetNativePointerField<long double*>(this, "UCharacterMovementComponent.ForceBigPushingTime"); }
-	float& GravityScaleField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.GravityScale"); }
-	float& GroundFrictionField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.GroundFriction"); }
-	float& MaxWalkSpeedField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.MaxWalkSpeed"); }
-	float& MaxWalkSpeedCrouchedField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.MaxWalkSpeedCrouched"); }
-	float& MaxWalkSpeedProneField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.MaxWalkSpeedProne"); }
-	float& MaxCustomMovementSpeedField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.MaxCustomMovementSpeed"); }
-	float& MaxSwimSpeedField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.MaxSwimSpeed"); }
-	float& MaxFlySpeedField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.MaxFlySpeed"); }
-	float& LandedPreventRequestedMoveIntervalField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.LandedPreventRequestedMoveInterval"); }
-	float& LandedPreventRequestedMoveMinVelocityMagnitudeField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.LandedPreventRequestedMoveMinVelocityMagnitude"); }
-	float& MinimumImpulseToApplyField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.MinimumImpulseToApply"); }
-	long double& LastLandedTimeField() { return *GetNativePointerField<long double*>(this, "UCharacterMovementComponent.LastLandedTime"); }
-	float& MaxAccelerationField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.MaxAcceleration"); }
-	float& MaxImpulseVelocityMagnitudeField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.MaxImpulseVelocityMagnitude"); }
-	float& MaxImpulseVelocityZField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.MaxImpulseVelocityZ"); }
-	float& BrakingDecelerationWalkingField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.BrakingDecelerationWalking"); }
-	float& BrakingDecelerationFallingField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.BrakingDecelerationFalling"); }
-	float& BrakingDecelerationSwimmingField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.BrakingDecelerationSwimming"); }
-	float& BrakingDecelerationFlyingField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.BrakingDecelerationFlying"); }
-	float& AirControlField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.AirControl"); }
-	float& AirControlBoostMultiplierField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.AirControlBoostMultiplier"); }
-	float& AirControlBoostVelocityThresholdField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.AirControlBoostVelocityThreshold"); }
-	float& FallingLateralFrictionField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.FallingLateralFriction"); }
-	float& CrouchedHalfHeightField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.CrouchedHalfHeight"); }
-	float& ProneHalfHeightField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.ProneHalfHeight"); }
-	float& BuoyancyField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.Buoyancy"); }
-	float& PerchRadiusThresholdField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.PerchRadiusThreshold"); }
-	float& PerchAdditionalHeightField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.PerchAdditionalHeight"); }
-	FRotator& RotationRateField() { return *GetNativePointerField<FRotator*>(this, "UCharacterMovementComponent.RotationRate"); }
-	UPrimitiveComponent * DeferredUpdatedMoveComponentField() { return *GetNativePointerField<UPrimitiveComponent **>(this, "UCharacterMovementComponent.DeferredUpdatedMoveComponent"); }
-	float& MaxOutOfWaterStepHeightField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.MaxOutOfWaterStepHeight"); }
-	float& OutofWaterZField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.OutofWaterZ"); }
-	float& MassField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.Mass"); }
-	float& DinoClientPositionErrorToleranceStoppedField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.DinoClientPositionErrorToleranceStopped"); }
-	float& DinoClientPositionErrorToleranceMovingFlyingField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.DinoClientPositionErrorToleranceMovingFlying"); }
-	float& PlayerClientPositionErrorToleranceOverrideField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.PlayerClientPositionErrorToleranceOverride"); }
-	float& SimulatedTickSkipDistanceSQField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.SimulatedTickSkipDistanceSQ"); }
-	bool& bEnablePhysicsInteractionField() { return *GetNativePointerField<bool*>(this, "UCharacterMovementComponent.bEnablePhysicsInteraction"); }
-	bool& bTouchForceScaledToMassField() { return *GetNativePointerField<bool*>(this, "UCharacterMovementComponent.bTouchForceScaledToMass"); }
-	bool& bPushForceScaledToMassField() { return *GetNativePointerField<bool*>(this, "UCharacterMovementComponent.bPushForceScaledToMass"); }
-	bool& bScalePushForceToVelocityField() { return *GetNativePointerField<bool*>(this, "UCharacterMovementComponent.bScalePushForceToVelocity"); }
-	float& StandingDownwardForceScaleField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.StandingDownwardForceScale"); }
-	float& InitialPushForceFactorField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.InitialPushForceFactor"); }
-	float& PushForceFactorField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.PushForceFactor"); }
-	float& PushForcePointZOffsetFactorField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.PushForcePointZOffsetFactor"); }
-	float& TouchForceFactorField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.TouchForceFactor"); }
-	float& MinTouchForceField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.MinTouchForce"); }
-	float& MaxTouchForceField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.MaxTouchForce"); }
-	float& RepulsionForceField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.RepulsionForce"); }
-	FVector& LastUpdateLocationField() { return *GetNativePointerField<FVector*>(this, "UCharacterMovementComponent.LastUpdateLocation"); }
-	FVector& MoveStartLocationField() { return *GetNativePointerField<FVector*>(this, "UCharacterMovementComponent.MoveStartLocation"); }
-	float& AnalogInputModifierField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.AnalogInputModifier"); }
-	float& BackwardsMaxSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.BackwardsMaxSpeedMultiplier"); }
-	float& BackwardsMovementDotThresholdField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.BackwardsMovementDotThreshold"); }
-	FVector& PendingForceToApplyField() { return *GetNativePointerField<FVector*>(this, "UCharacterMovementComponent.PendingForceToApply"); }
-	FVector& PendingImpulseToApplyField() { return *GetNativePointerField<FVector*>(this, "UCharacterMovementComponent.PendingImpulseToApply"); }
-	FVector& AccelerationField() { return *GetNativePointerField<FVector*>(this, "UCharacterMovementComponent.Acceleration"); }
-	float& MaxSimulationTimeStepField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.MaxSimulationTimeStep"); }
-	int& MaxSimulationIterationsField() { return *GetNativePointerField<int*>(this, "UCharacterMovementComponent.MaxSimulationIterations"); }
-	float& LedgeCheckThresholdField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.LedgeCheckThreshold"); }
-	float& JumpOutOfWaterPitchField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.JumpOutOfWaterPitch"); }
-	float& UpperImpactNormalScaleField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.UpperImpactNormalScale"); }
-	TEnumAsByte<enum EMovementMode>& DefaultLandMovementModeField() { return *GetNativePointerField<TEnumAsByte<enum EMovementMode>*>(this, "UCharacterMovementComponent.DefaultLandMovementMode"); }
-	TEnumAsByte<enum EMovementMode>& DefaultWaterMovementModeField() { return *GetNativePointerField<TEnumAsByte<enum EMovementMode>*>(this, "UCharacterMovementComponent.DefaultWaterMovementMode"); }
-	float& PreventWaterHoppingPlaneOffsetField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.PreventWaterHoppingPlaneOffset"); }
-	long double& PreventWaterHopping_LastTimeAtSurfaceField() { return *GetNativePointerField<long double*>(this, "UCharacterMovementComponent.PreventWaterHopping_LastTimeAtSurface"); }
-	float& AccelerationFollowsRotationMinDotField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.AccelerationFollowsRotationMinDot"); }
-	float& AccelerationFollowsRotationStopDistanceField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.AccelerationFollowsRotationStopDistance"); }
-	float& RotationAccelerationField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.RotationAcceleration"); }
-	float& RotationBrakingField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.RotationBraking"); }
-	float& AngleToStartRotationBrakingField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.AngleToStartRotationBraking"); }
-	float& SwimmingAccelZMultiplierField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.SwimmingAccelZMultiplier"); }
-	float& TamedSwimmingAccelZMultiplierField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.TamedSwimmingAccelZMultiplier"); }
-	bool& bHACKTickedField() { return *GetNativePointerField<bool*>(this, "UCharacterMovementComponent.bHACKTicked"); }
-	bool& bHackTestDisableRotationCodeField() { return *GetNativePointerField<bool*>(this, "UCharacterMovementComponent.bHackTestDisableRotationCode"); }
-	FVector& LastForcedNetVelocityField() { return *GetNativePointerField<FVector*>(this, "UCharacterMovementComponent.LastForcedNetVelocity"); }
-	long double& LastStepUpTimeField() { return *GetNativePointerField<long double*>(this, "UCharacterMovementComponent.LastStepUpTime"); }
-	int& BadFloorPenetrationCountField() { return *GetNativePointerField<int*>(this, "UCharacterMovementComponent.BadFloorPenetrationCount"); }
-	FVector& AvoidanceLockVelocityField() { return *GetNativePointerField<FVector*>(this, "UCharacterMovementComponent.AvoidanceLockVelocity"); }
-	float& AvoidanceLockTimerField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.AvoidanceLockTimer"); }
-	long double& LastSkippedMoveTimeField() { return *GetNativePointerField<long double*>(this, "UCharacterMovementComponent.LastSkippedMoveTime"); }
-	long double& LastSwimTimeField() { return *GetNativePointerField<long double*>(this, "UCharacterMovementComponent.LastSwimTime"); }
-	FRotator& CurrentRotationSpeedField() { return *GetNativePointerField<FRotator*>(this, "UCharacterMovementComponent.CurrentRotationSpeed"); }
-	FVector& RequestedVelocityField() { return *GetNativePointerField<FVector*>(this, "UCharacterMovementComponent.RequestedVelocity"); }
-	long double& DisableMovementPhysicsUntilTimeField() { return *GetNativePointerField<long double*>(this, "UCharacterMovementComponent.DisableMovementPhysicsUntilTime"); }
-	float& LostDeltaTimeField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.LostDeltaTime"); }
-	float& LastLostDeltaTimeField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.LastLostDeltaTime"); }
-	int& AvoidanceUIDField() { return *GetNativePointerField<int*>(this, "UCharacterMovementComponent.AvoidanceUID"); }
-	float& AvoidanceWeightField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.AvoidanceWeight"); }
-	FVector& PendingLaunchVelocityField() { return *GetNativePointerField<FVector*>(this, "UCharacterMovementComponent.PendingLaunchVelocity"); }
-	float& MinTimeBetweenTimeStampResetsField() { return *GetNativePointerField<float*>(this, "UCharacterMovementComponent.MinTimeBetweenTimeStampResets"); }
-	bool& bWasSimulatingRootMotionField() { return *GetNativePointerField<bool*>(this, "UCharacterMovementComponent.bWasSimulatingRootMotion"); }
-	FVector& LastCheckedFloorAtRelativeLocField() { return *GetNativePointerField<FVector*>(this, "UCharacterMovementComponent.LastCheckedFloorAtRelativeLoc"); }
+	ACharacter * CharacterOwnerField() { return *GetNativePointerField<ACharacter **, API::FieldNameHash("UCharacterMovementComponent.CharacterOwner")>(this, "UCharacterMovementComponent.CharacterOwner"); }
+	float& MaxStepHeightField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.MaxStepHeight")>(this, "UCharacterMovementComponent.MaxStepHeight"); }
+	float& JumpZVelocityField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.JumpZVelocity")>(this, "UCharacterMovementComponent.JumpZVelocity"); }
+	float& JumpOffJumpZFactorField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.JumpOffJumpZFactor")>(this, "UCharacterMovementComponent.JumpOffJumpZFactor"); }
+	bool& bSlipOffLedgesField() { return *GetNativePointerField<bool*, API::FieldNameHash("UCharacterMovementComponent.bSlipOffLedges")>(this, "UCharacterMovementComponent.bSlipOffLedges"); }
+	float& LedgeSlipCapsuleRadiusMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.LedgeSlipCapsuleRadiusMultiplier")>(this, "UCharacterMovementComponent.LedgeSlipCapsuleRadiusMultiplier"); }
+	float& LedgeSlipPushVelocityField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.LedgeSlipPushVelocity")>(this, "UCharacterMovementComponent.LedgeSlipPushVelocity"); }
+	float& LedgeSlipVelocityBuildUpMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.LedgeSlipVelocityBuildUpMultiplier")>(this, "UCharacterMovementComponent.LedgeSlipVelocityBuildUpMultiplier"); }
+	float& WalkableFloorAngleField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.WalkableFloorAngle")>(this, "UCharacterMovementComponent.WalkableFloorAngle"); }
+	float& WalkableFloorZField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.WalkableFloorZ")>(this, "UCharacterMovementComponent.WalkableFloorZ"); }
+	TEnumAsByte<enum EMovementMode>& MovementModeField() { return *GetNativePointerField<TEnumAsByte<enum EMovementMode>*, API::FieldNameHash("UCharacterMovementComponent.MovementMode")>(this, "UCharacterMovementComponent.MovementMode"); }
+	char& CustomMovementModeField() { return *GetNativePointerField<char*, API::FieldNameHash("UCharacterMovementComponent.CustomMovementMode")>(this, "UCharacterMovementComponent.CustomMovementMode"); }
+	FVector& OldBaseLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UCharacterMovementComponent.OldBaseLocation")>(this, "UCharacterMovementComponent.OldBaseLocation"); }
+	FQuat& OldBaseQuatField() { return *GetNativePointerField<FQuat*, API::FieldNameHash("UCharacterMovementComponent.OldBaseQuat")>(this, "UCharacterMovementComponent.OldBaseQuat"); }
+	long double& LastNonZeroAccelField() { return *GetNativePointerField<long double*, API::FieldNameHash("UCharacterMovementComponent.LastNonZeroAccel")>(this, "UCharacterMovementComponent.LastNonZeroAccel"); }
+	float& CurrentLedgeSlipPushVelocityField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.CurrentLedgeSlipPushVelocity")>(this, "UCharacterMovementComponent.CurrentLedgeSlipPushVelocity"); }
+	int& LastFrameDisabledFloorBasingField() { return *GetNativePointerField<int*, API::FieldNameHash("UCharacterMovementComponent.LastFrameDisabledFloorBasing")>(this, "UCharacterMovementComponent.LastFrameDisabledFloorBasing"); }
+	long double& ForceBigPushingTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UCharacterMovementComponent.ForceBigPushingTime")>(this, "UCharacterMovementComponent.ForceBigPushingTime"); }
+	float& GravityScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.GravityScale")>(this, "UCharacterMovementComponent.GravityScale"); }
+	float& GroundFrictionField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.GroundFriction")>(this, "UCharacterMovementComponent.GroundFriction"); }
+	float& MaxWalkSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.MaxWalkSpeed")>(this, "UCharacterMovementComponent.MaxWalkSpeed"); }
+	float& MaxWalkSpeedCrouchedField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.MaxWalkSpeedCrouched")>(this, "UCharacterMovementComponent.MaxWalkSpeedCrouched"); }
+	float& MaxWalkSpeedProneField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.MaxWalkSpeedProne")>(this, "UCharacterMovementComponent.MaxWalkSpeedProne"); }
+	float& MaxCustomMovementSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.MaxCustomMovementSpeed")>(this, "UCharacterMovementComponent.MaxCustomMovementSpeed"); }
+	float& MaxSwimSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.MaxSwimSpeed")>(this, "UCharacterMovementComponent.MaxSwimSpeed"); }
+	float& MaxFlySpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.MaxFlySpeed")>(this, "UCharacterMovementComponent.MaxFlySpeed"); }
+	float& LandedPreventRequestedMoveIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.LandedPreventRequestedMoveInterval")>(this, "UCharacterMovementComponent.LandedPreventRequestedMoveInterval"); }
+	float& LandedPreventRequestedMoveMinVelocityMagnitudeField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.LandedPreventRequestedMoveMinVelocityMagnitude")>(this, "UCharacterMovementComponent.LandedPreventRequestedMoveMinVelocityMagnitude"); }
+	float& MinimumImpulseToApplyField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.MinimumImpulseToApply")>(this, "UCharacterMovementComponent.MinimumImpulseToApply"); }
+	long double& LastLandedTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UCharacterMovementComponent.LastLandedTime")>(this, "UCharacterMovementComponent.LastLandedTime"); }
+	float& MaxAccelerationField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.MaxAcceleration")>(this, "UCharacterMovementComponent.MaxAcceleration"); }
+	float& MaxImpulseVelocityMagnitudeField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.MaxImpulseVelocityMagnitude")>(this, "UCharacterMovementComponent.MaxImpulseVelocityMagnitude"); }
+	float& MaxImpulseVelocityZField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.MaxImpulseVelocityZ")>(this, "UCharacterMovementComponent.MaxImpulseVelocityZ"); }
+	float& BrakingDecelerationWalkingField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.BrakingDecelerationWalking")>(this, "UCharacterMovementComponent.BrakingDecelerationWalking"); }
+	float& BrakingDecelerationFallingField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.BrakingDecelerationFalling")>(this, "UCharacterMovementComponent.BrakingDecelerationFalling"); }
+	float& BrakingDecelerationSwimmingField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.BrakingDecelerationSwimming")>(this, "UCharacterMovementComponent.BrakingDecelerationSwimming"); }
+	float& BrakingDecelerationFlyingField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.BrakingDecelerationFlying")>(this, "UCharacterMovementComponent.BrakingDecelerationFlying"); }
+	float& AirControlField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.AirControl")>(this, "UCharacterMovementComponent.AirControl"); }
+	float& AirControlBoostMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.AirControlBoostMultiplier")>(this, "UCharacterMovementComponent.AirControlBoostMultiplier"); }
+	float& AirControlBoostVelocityThresholdField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.AirControlBoostVelocityThreshold")>(this, "UCharacterMovementComponent.AirControlBoostVelocityThreshold"); }
+	float& FallingLateralFrictionField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.FallingLateralFriction")>(this, "UCharacterMovementComponent.FallingLateralFriction"); }
+	float& CrouchedHalfHeightField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.CrouchedHalfHeight")>(this, "UCharacterMovementComponent.CrouchedHalfHeight"); }
+	float& ProneHalfHeightField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.ProneHalfHeight")>(this, "UCharacterMovementComponent.ProneHalfHeight"); }
+	float& BuoyancyField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.Buoyancy")>(this, "UCharacterMovementComponent.Buoyancy"); }
+	float& PerchRadiusThresholdField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.PerchRadiusThreshold")>(this, "UCharacterMovementComponent.PerchRadiusThreshold"); }
+	float& PerchAdditionalHeightField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.PerchAdditionalHeight")>(this, "UCharacterMovementComponent.PerchAdditionalHeight"); }
+	FRotator& RotationRateField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("UCharacterMovementComponent.RotationRate")>(this, "UCharacterMovementComponent.RotationRate"); }
+	UPrimitiveComponent * DeferredUpdatedMoveComponentField() { return *GetNativePointerField<UPrimitiveComponent **, API::FieldNameHash("UCharacterMovementComponent.DeferredUpdatedMoveComponent")>(this, "UCharacterMovementComponent.DeferredUpdatedMoveComponent"); }
+	float& MaxOutOfWaterStepHeightField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.MaxOutOfWaterStepHeight")>(this, "UCharacterMovementComponent.MaxOutOfWaterStepHeight"); }
+	float& OutofWaterZField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.OutofWaterZ")>(this, "UCharacterMovementComponent.OutofWaterZ"); }
+	float& MassField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.Mass")>(this, "UCharacterMovementComponent.Mass"); }
+	float& DinoClientPositionErrorToleranceStoppedField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.DinoClientPositionErrorToleranceStopped")>(this, "UCharacterMovementComponent.DinoClientPositionErrorToleranceStopped"); }
+	float& DinoClientPositionErrorToleranceMovingFlyingField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.DinoClientPositionErrorToleranceMovingFlying")>(this, "UCharacterMovementComponent.DinoClientPositionErrorToleranceMovingFlying"); }
+	float& PlayerClientPositionErrorToleranceOverrideField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.PlayerClientPositionErrorToleranceOverride")>(this, "UCharacterMovementComponent.PlayerClientPositionErrorToleranceOverride"); }
+	float& SimulatedTickSkipDistanceSQField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.SimulatedTickSkipDistanceSQ")>(this, "UCharacterMovementComponent.SimulatedTickSkipDistanceSQ"); }
+	bool& bEnablePhysicsInteractionField() { return *GetNativePointerField<bool*, API::FieldNameHash("UCharacterMovementComponent.bEnablePhysicsInteraction")>(this, "UCharacterMovementComponent.bEnablePhysicsInteraction"); }
+	bool& bTouchForceScaledToMassField() { return *GetNativePointerField<bool*, API::FieldNameHash("UCharacterMovementComponent.bTouchForceScaledToMass")>(this, "UCharacterMovementComponent.bTouchForceScaledToMass"); }
+	bool& bPushForceScaledToMassField() { return *GetNativePointerField<bool*, API::FieldNameHash("UCharacterMovementComponent.bPushForceScaledToMass")>(this, "UCharacterMovementComponent.bPushForceScaledToMass"); }
+	bool& bScalePushForceToVelocityField() { return *GetNativePointerField<bool*, API::FieldNameHash("UCharacterMovementComponent.bScalePushForceToVelocity")>(this, "UCharacterMovementComponent.bScalePushForceToVelocity"); }
+	float& StandingDownwardForceScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.StandingDownwardForceScale")>(this, "UCharacterMovementComponent.StandingDownwardForceScale"); }
+	float& InitialPushForceFactorField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.InitialPushForceFactor")>(this, "UCharacterMovementComponent.InitialPushForceFactor"); }
+	float& PushForceFactorField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.PushForceFactor")>(this, "UCharacterMovementComponent.PushForceFactor"); }
+	float& PushForcePointZOffsetFactorField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.PushForcePointZOffsetFactor")>(this, "UCharacterMovementComponent.PushForcePointZOffsetFactor"); }
+	float& TouchForceFactorField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.TouchForceFactor")>(this, "UCharacterMovementComponent.TouchForceFactor"); }
+	float& MinTouchForceField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.MinTouchForce")>(this, "UCharacterMovementComponent.MinTouchForce"); }
+	float& MaxTouchForceField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.MaxTouchForce")>(this, "UCharacterMovementComponent.MaxTouchForce"); }
+	float& RepulsionForceField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.RepulsionForce")>(this, "UCharacterMovementComponent.RepulsionForce"); }
+	FVector& LastUpdateLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UCharacterMovementComponent.LastUpdateLocation")>(this, "UCharacterMovementComponent.LastUpdateLocation"); }
+	FVector& MoveStartLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UCharacterMovementComponent.MoveStartLocation")>(this, "UCharacterMovementComponent.MoveStartLocation"); }
+	float& AnalogInputModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.AnalogInputModifier")>(this, "UCharacterMovementComponent.AnalogInputModifier"); }
+	float& BackwardsMaxSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.BackwardsMaxSpeedMultiplier")>(this, "UCharacterMovementComponent.BackwardsMaxSpeedMultiplier"); }
+	float& BackwardsMovementDotThresholdField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.BackwardsMovementDotThreshold")>(this, "UCharacterMovementComponent.BackwardsMovementDotThreshold"); }
+	FVector& PendingForceToApplyField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UCharacterMovementComponent.PendingForceToApply")>(this, "UCharacterMovementComponent.PendingForceToApply"); }
+	FVector& PendingImpulseToApplyField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UCharacterMovementComponent.PendingImpulseToApply")>(this, "UCharacterMovementComponent.PendingImpulseToApply"); }
+	FVector& AccelerationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UCharacterMovementComponent.Acceleration")>(this, "UCharacterMovementComponent.Acceleration"); }
+	float& MaxSimulationTimeStepField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.MaxSimulationTimeStep")>(this, "UCharacterMovementComponent.MaxSimulationTimeStep"); }
+	int& MaxSimulationIterationsField() { return *GetNativePointerField<int*, API::FieldNameHash("UCharacterMovementComponent.MaxSimulationIterations")>(this, "UCharacterMovementComponent.MaxSimulationIterations"); }
+	float& LedgeCheckThresholdField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.LedgeCheckThreshold")>(this, "UCharacterMovementComponent.LedgeCheckThreshold"); }
+	float& JumpOutOfWaterPitchField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.JumpOutOfWaterPitch")>(this, "UCharacterMovementComponent.JumpOutOfWaterPitch"); }
+	float& UpperImpactNormalScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.UpperImpactNormalScale")>(this, "UCharacterMovementComponent.UpperImpactNormalScale"); }
+	TEnumAsByte<enum EMovementMode>& DefaultLandMovementModeField() { return *GetNativePointerField<TEnumAsByte<enum EMovementMode>*, API::FieldNameHash("UCharacterMovementComponent.DefaultLandMovementMode")>(this, "UCharacterMovementComponent.DefaultLandMovementMode"); }
+	TEnumAsByte<enum EMovementMode>& DefaultWaterMovementModeField() { return *GetNativePointerField<TEnumAsByte<enum EMovementMode>*, API::FieldNameHash("UCharacterMovementComponent.DefaultWaterMovementMode")>(this, "UCharacterMovementComponent.DefaultWaterMovementMode"); }
+	float& PreventWaterHoppingPlaneOffsetField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.PreventWaterHoppingPlaneOffset")>(this, "UCharacterMovementComponent.PreventWaterHoppingPlaneOffset"); }
+	long double& PreventWaterHopping_LastTimeAtSurfaceField() { return *GetNativePointerField<long double*, API::FieldNameHash("UCharacterMovementComponent.PreventWaterHopping_LastTimeAtSurface")>(this, "UCharacterMovementComponent.PreventWaterHopping_LastTimeAtSurface"); }
+	float& AccelerationFollowsRotationMinDotField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.AccelerationFollowsRotationMinDot")>(this, "UCharacterMovementComponent.AccelerationFollowsRotationMinDot"); }
+	float& AccelerationFollowsRotationStopDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.AccelerationFollowsRotationStopDistance")>(this, "UCharacterMovementComponent.AccelerationFollowsRotationStopDistance"); }
+	float& RotationAccelerationField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.RotationAcceleration")>(this, "UCharacterMovementComponent.RotationAcceleration"); }
+	float& RotationBrakingField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.RotationBraking")>(this, "UCharacterMovementComponent.RotationBraking"); }
+	float& AngleToStartRotationBrakingField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.AngleToStartRotationBraking")>(this, "UCharacterMovementComponent.AngleToStartRotationBraking"); }
+	float& SwimmingAccelZMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.SwimmingAccelZMultiplier")>(this, "UCharacterMovementComponent.SwimmingAccelZMultiplier"); }
+	float& TamedSwimmingAccelZMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.TamedSwimmingAccelZMultiplier")>(this, "UCharacterMovementComponent.TamedSwimmingAccelZMultiplier"); }
+	bool& bHACKTickedField() { return *GetNativePointerField<bool*, API::FieldNameHash("UCharacterMovementComponent.bHACKTicked")>(this, "UCharacterMovementComponent.bHACKTicked"); }
+	bool& bHackTestDisableRotationCodeField() { return *GetNativePointerField<bool*, API::FieldNameHash("UCharacterMovementComponent.bHackTestDisableRotationCode")>(this, "UCharacterMovementComponent.bHackTestDisableRotationCode"); }
+	FVector& LastForcedNetVelocityField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UCharacterMovementComponent.LastForcedNetVelocity")>(this, "UCharacterMovementComponent.LastForcedNetVelocity"); }
+	long double& LastStepUpTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UCharacterMovementComponent.LastStepUpTime")>(this, "UCharacterMovementComponent.LastStepUpTime"); }
+	int& BadFloorPenetrationCountField() { return *GetNativePointerField<int*, API::FieldNameHash("UCharacterMovementComponent.BadFloorPenetrationCount")>(this, "UCharacterMovementComponent.BadFloorPenetrationCount"); }
+	FVector& AvoidanceLockVelocityField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UCharacterMovementComponent.AvoidanceLockVelocity")>(this, "UCharacterMovementComponent.AvoidanceLockVelocity"); }
+	float& AvoidanceLockTimerField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.AvoidanceLockTimer")>(this, "UCharacterMovementComponent.AvoidanceLockTimer"); }
+	long double& LastSkippedMoveTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UCharacterMovementComponent.LastSkippedMoveTime")>(this, "UCharacterMovementComponent.LastSkippedMoveTime"); }
+	long double& LastSwimTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UCharacterMovementComponent.LastSwimTime")>(this, "UCharacterMovementComponent.LastSwimTime"); }
+	FRotator& CurrentRotationSpeedField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("UCharacterMovementComponent.CurrentRotationSpeed")>(this, "UCharacterMovementComponent.CurrentRotationSpeed"); }
+	FVector& RequestedVelocityField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UCharacterMovementComponent.RequestedVelocity")>(this, "UCharacterMovementComponent.RequestedVelocity"); }
+	long double& DisableMovementPhysicsUntilTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UCharacterMovementComponent.DisableMovementPhysicsUntilTime")>(this, "UCharacterMovementComponent.DisableMovementPhysicsUntilTime"); }
+	float& LostDeltaTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.LostDeltaTime")>(this, "UCharacterMovementComponent.LostDeltaTime"); }
+	float& LastLostDeltaTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.LastLostDeltaTime")>(this, "UCharacterMovementComponent.LastLostDeltaTime"); }
+	int& AvoidanceUIDField() { return *GetNativePointerField<int*, API::FieldNameHash("UCharacterMovementComponent.AvoidanceUID")>(this, "UCharacterMovementComponent.AvoidanceUID"); }
+	float& AvoidanceWeightField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.AvoidanceWeight")>(this, "UCharacterMovementComponent.AvoidanceWeight"); }
+	FVector& PendingLaunchVelocityField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UCharacterMovementComponent.PendingLaunchVelocity")>(this, "UCharacterMovementComponent.PendingLaunchVelocity"); }
+	float& MinTimeBetweenTimeStampResetsField() { return *GetNativePointerField<float*, API::FieldNameHash("UCharacterMovementComponent.MinTimeBetweenTimeStampResets")>(this, "UCharacterMovementComponent.MinTimeBetweenTimeStampResets"); }
+	bool& bWasSimulatingRootMotionField() { return *GetNativePointerField<bool*, API::FieldNameHash("UCharacterMovementComponent.bWasSimulatingRootMotion")>(this, "UCharacterMovementComponent.bWasSimulatingRootMotion"); }
+	FVector& LastCheckedFloorAtRelativeLocField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UCharacterMovementComponent.LastCheckedFloorAtRelativeLoc")>(this, "UCharacterMovementComponent.LastCheckedFloorAtRelativeLoc"); }
 
 	// Bit fields
 
@@ -6597,75 +6597,75 @@ struct APrimalWorldSettings : AWorldSettings
 
 struct ANPCZoneManager
 {
-	TArray<FLinkedZoneSpawnVolumeEntry>& LinkedZoneSpawnVolumeEntriesField() { return *GetNativePointerField<TArray<FLinkedZoneSpawnVolumeEntry>*>(this, "ANPCZoneManager.LinkedZoneSpawnVolumeEntries"); }
-	TArray<AActor *> DefaultZoneSpawnVolumeFloorsField() { return *GetNativePointerField<TArray<AActor *>*>(this, "ANPCZoneManager.DefaultZoneSpawnVolumeFloors"); }
-	TArray<FName>& DefaultZoneSpawnVolumeFloorTagsField() { return *GetNativePointerField<TArray<FName>*>(this, "ANPCZoneManager.DefaultZoneSpawnVolumeFloorTags"); }
-	TSubclassOf<UNPCSpawnEntriesContainer>& NPCSpawnEntriesContainerObjectField() { return *GetNativePointerField<TSubclassOf<UNPCSpawnEntriesContainer>*>(this, "ANPCZoneManager.NPCSpawnEntriesContainerObject"); }
-	bool& bEnabledField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bEnabled"); }
-	bool& bForceInEditorField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bForceInEditor"); }
-	bool& bNeverSpawnInWaterField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bNeverSpawnInWater"); }
-	bool& bOnlySpawnInWaterField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bOnlySpawnInWater"); }
-	bool& bAllowExtentTestField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bAllowExtentTest"); }
-	bool& bOnlyCheckMySublevelWaterField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bOnlyCheckMySublevelWater"); }
-	int& MinDesiredNumberOfNPCField() { return *GetNativePointerField<int*>(this, "ANPCZoneManager.MinDesiredNumberOfNPC"); }
-	int& SP_MinDesiredNumberOfNPCField() { return *GetNativePointerField<int*>(this, "ANPCZoneManager.SP_MinDesiredNumberOfNPC"); }
-	int& MaxNumberOfNPCField() { return *GetNativePointerField<int*>(this, "ANPCZoneManager.MaxNumberOfNPC"); }
-	float& DesiredNumberOfNPCMultiplierField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.DesiredNumberOfNPCMultiplier"); }
-	float& TheSpawnPointMinimumFloorNormalField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.TheSpawnPointMinimumFloorNormal"); }
-	float& TheNewNewEditorNumberOfNPCMultiplierField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.TheNewNewEditorNumberOfNPCMultiplier"); }
-	float& KillOffOverweightNPCStasisTimeField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.KillOffOverweightNPCStasisTime"); }
-	float& TheMaximumWorldTimeForFullIncreaseField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.TheMaximumWorldTimeForFullIncrease"); }
-	float& TheMinimumPlayerDistanceFromSpawnPointField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.TheMinimumPlayerDistanceFromSpawnPoint"); }
-	float& TheIncreaseNPCIntervalField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.TheIncreaseNPCInterval"); }
-	float& SP_TheIncreaseNPCIntervalField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.SP_TheIncreaseNPCInterval"); }
-	float& TheIncreaseNPCIntervalMaxField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.TheIncreaseNPCIntervalMax"); }
-	float& TheDecreaseNPCIntervalField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.TheDecreaseNPCInterval"); }
-	float& NPCAIRangeMultiplierField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.NPCAIRangeMultiplier"); }
-	bool& bNPCDontWanderField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bNPCDontWander"); }
-	bool& bNPCWildIgnoreWildField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bNPCWildIgnoreWild"); }
-	bool& bNPCNoKillXPField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bNPCNoKillXP"); }
-	bool& bNPCPreventSavingField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bNPCPreventSaving"); }
-	bool& bForceUntameableField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bForceUntameable"); }
-	bool& bUsesManualSpawningField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bUsesManualSpawning"); }
-	bool& bIgnoreVolumeEcompassingCheckField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bIgnoreVolumeEcompassingCheck"); }
-	bool& bSpawnAllNPCEntriesField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bSpawnAllNPCEntries"); }
-	bool& bOnlyUseInSingleplayerField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bOnlyUseInSingleplayer"); }
-	bool& bOnlyUseInDedicatedServerField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bOnlyUseInDedicatedServer"); }
-	float& NPCWanderRadiusMultiplierField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.NPCWanderRadiusMultiplier"); }
-	int& MaxNumberSpawnZoneRandomPointChecksField() { return *GetNativePointerField<int*>(this, "ANPCZoneManager.MaxNumberSpawnZoneRandomPointChecks"); }
-	int& TheNPCFullIncreaseMaximumIterationsField() { return *GetNativePointerField<int*>(this, "ANPCZoneManager.TheNPCFullIncreaseMaximumIterations"); }
-	float& TheMinimumTamedDinoDistanceFromSpawnPointField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.TheMinimumTamedDinoDistanceFromSpawnPoint"); }
-	float& TheMinimumStructureDistanceFromSpawnPointField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.TheMinimumStructureDistanceFromSpawnPoint"); }
-	float& NPCLerpToMaxRandomBaseLevelField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.NPCLerpToMaxRandomBaseLevel"); }
-	float& ManualSpawningNPCLerpToMaxRandomBaseLevelField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.ManualSpawningNPCLerpToMaxRandomBaseLevel"); }
-	int& MaximumNumberNearbyCoreStructuresField() { return *GetNativePointerField<int*>(this, "ANPCZoneManager.MaximumNumberNearbyCoreStructures"); }
-	int& AbsoluteMaximumNumberNearbyCoreStructuresField() { return *GetNativePointerField<int*>(this, "ANPCZoneManager.AbsoluteMaximumNumberNearbyCoreStructures"); }
-	bool& bAutoKillUseGlobalStasisArrayField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bAutoKillUseGlobalStasisArray"); }
-	bool& bTraceForSpawnAgainstWaterField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bTraceForSpawnAgainstWater"); }
-	bool& bNPCForcePreventExitingWaterField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bNPCForcePreventExitingWater"); }
-	bool& bUseSpawnPointOverrideRotationField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bUseSpawnPointOverrideRotation"); }
-	float& NPCLevelMultiplierField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.NPCLevelMultiplier"); }
-	int& ForceOverrideNPCBaseLevelField() { return *GetNativePointerField<int*>(this, "ANPCZoneManager.ForceOverrideNPCBaseLevel"); }
-	TArray<FNPCSpawnEntry>& NPCSpawnEntriesField() { return *GetNativePointerField<TArray<FNPCSpawnEntry>*>(this, "ANPCZoneManager.NPCSpawnEntries"); }
-	TArray<FNPCSpawnLimit>& NPCSpawnLimitsField() { return *GetNativePointerField<TArray<FNPCSpawnLimit>*>(this, "ANPCZoneManager.NPCSpawnLimits"); }
-	int& UseDesiredNumberOfNPCField() { return *GetNativePointerField<int*>(this, "ANPCZoneManager.UseDesiredNumberOfNPC"); }
-	int& NumNPCSpawnedField() { return *GetNativePointerField<int*>(this, "ANPCZoneManager.NumNPCSpawned"); }
-	int& NumSpawnFailuresField() { return *GetNativePointerField<int*>(this, "ANPCZoneManager.NumSpawnFailures"); }
-	long double& LastIncreaseNPCTimeField() { return *GetNativePointerField<long double*>(this, "ANPCZoneManager.LastIncreaseNPCTime"); }
-	long double& LastDecreaseNPCTimeField() { return *GetNativePointerField<long double*>(this, "ANPCZoneManager.LastDecreaseNPCTime"); }
-	bool& bForceRespawnDinosField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bForceRespawnDinos"); }
-	bool& bTriedFullIncreaseField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bTriedFullIncrease"); }
-	bool& bSpawnsWaterDinosField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bSpawnsWaterDinos"); }
-	bool& bSpawnsAmphibiousDinosField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bSpawnsAmphibiousDinos"); }
-	float& TheNextIncreaseNPCIntervalField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.TheNextIncreaseNPCInterval"); }
-	float& CloseStructureDistanceFromSpawnPointField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.CloseStructureDistanceFromSpawnPoint"); }
-	TArray<AActor *> SpawnPointOverridesField() { return *GetNativePointerField<TArray<AActor *>*>(this, "ANPCZoneManager.SpawnPointOverrides"); }
-	FName& NonDedicatedFreezeWildDinoPhysicsIfLevelUnloadedField() { return *GetNativePointerField<FName*>(this, "ANPCZoneManager.NonDedicatedFreezeWildDinoPhysicsIfLevelUnloaded"); }
-	TArray<FName>& NonDedicatedFreezeWildDinoPhysicsIfLevelsUnloadedField() { return *GetNativePointerField<TArray<FName>*>(this, "ANPCZoneManager.NonDedicatedFreezeWildDinoPhysicsIfLevelsUnloaded"); }
-	float& MinimumManualSpawnIntervalField() { return *GetNativePointerField<float*>(this, "ANPCZoneManager.MinimumManualSpawnInterval"); }
-	long double& LastManuallySpawnedTimeField() { return *GetNativePointerField<long double*>(this, "ANPCZoneManager.LastManuallySpawnedTime"); }
-	bool& bIgnoreNPCRandomClassReplacementsField() { return *GetNativePointerField<bool*>(this, "ANPCZoneManager.bIgnoreNPCRandomClassReplacements"); }
-	int& TheNPCDynamicIncreaseMaximumIterationsField() { return *GetNativePointerField<int*>(this, "ANPCZoneManager.TheNPCDynamicIncreaseMaximumIterations"); }
+	TArray<FLinkedZoneSpawnVolumeEntry>& LinkedZoneSpawnVolumeEntriesField() { return *GetNativePointerField<TArray<FLinkedZoneSpawnVolumeEntry>*, API::FieldNameHash("ANPCZoneManager.LinkedZoneSpawnVolumeEntries")>(this, "ANPCZoneManager.LinkedZoneSpawnVolumeEntries"); }
+	TArray<AActor *> DefaultZoneSpawnVolumeFloorsField() { return *GetNativePointerField<TArray<AActor *>*, API::FieldNameHash("ANPCZoneManager.DefaultZoneSpawnVolumeFloors")>(this, "ANPCZoneManager.DefaultZoneSpawnVolumeFloors"); }
+	TArray<FName>& DefaultZoneSpawnVolumeFloorTagsField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("ANPCZoneManager.DefaultZoneSpawnVolumeFloorTags")>(this, "ANPCZoneManager.DefaultZoneSpawnVolumeFloorTags"); }
+	TSubclassOf<UNPCSpawnEntriesContainer>& NPCSpawnEntriesContainerObjectField() { return *GetNativePointerField<TSubclassOf<UNPCSpawnEntriesContainer>*, API::FieldNameHash("ANPCZoneManager.NPCSpawnEntriesContainerObject")>(this, "ANPCZoneManager.NPCSpawnEntriesContainerObject"); }
+	bool& bEnabledField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bEnabled")>(this, "ANPCZoneManager.bEnabled"); }
+	bool& bForceInEditorField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bForceInEditor")>(this, "ANPCZoneManager.bForceInEditor"); }
+	bool& bNeverSpawnInWaterField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bNeverSpawnInWater")>(this, "ANPCZoneManager.bNeverSpawnInWater"); }
+	bool& bOnlySpawnInWaterField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bOnlySpawnInWater")>(this, "ANPCZoneManager.bOnlySpawnInWater"); }
+	bool& bAllowExtentTestField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bAllowExtentTest")>(this, "ANPCZoneManager.bAllowExtentTest"); }
+	bool& bOnlyCheckMySublevelWaterField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bOnlyCheckMySublevelWater")>(this, "ANPCZoneManager.bOnlyCheckMySublevelWater"); }
+	int& MinDesiredNumberOfNPCField() { return *GetNativePointerField<int*, API::FieldNameHash("ANPCZoneManager.MinDesiredNumberOfNPC")>(this, "ANPCZoneManager.MinDesiredNumberOfNPC"); }
+	int& SP_MinDesiredNumberOfNPCField() { return *GetNativePointerField<int*, API::FieldNameHash("ANPCZoneManager.SP_MinDesiredNumberOfNPC")>(this, "ANPCZoneManager.SP_MinDesiredNumberOfNPC"); }
+	int& MaxNumberOfNPCField() { return *GetNativePointerField<int*, API::FieldNameHash("ANPCZoneManager.MaxNumberOfNPC")>(this, "ANPCZoneManager.MaxNumberOfNPC"); }
+	float& DesiredNumberOfNPCMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.DesiredNumberOfNPCMultiplier")>(this, "ANPCZoneManager.DesiredNumberOfNPCMultiplier"); }
+	float& TheSpawnPointMinimumFloorNormalField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.TheSpawnPointMinimumFloorNormal")>(this, "ANPCZoneManager.TheSpawnPointMinimumFloorNormal"); }
+	float& TheNewNewEditorNumberOfNPCMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.TheNewNewEditorNumberOfNPCMultiplier")>(this, "ANPCZoneManager.TheNewNewEditorNumberOfNPCMultiplier"); }
+	float& KillOffOverweightNPCStasisTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.KillOffOverweightNPCStasisTime")>(this, "ANPCZoneManager.KillOffOverweightNPCStasisTime"); }
+	float& TheMaximumWorldTimeForFullIncreaseField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.TheMaximumWorldTimeForFullIncrease")>(this, "ANPCZoneManager.TheMaximumWorldTimeForFullIncrease"); }
+	float& TheMinimumPlayerDistanceFromSpawnPointField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.TheMinimumPlayerDistanceFromSpawnPoint")>(this, "ANPCZoneManager.TheMinimumPlayerDistanceFromSpawnPoint"); }
+	float& TheIncreaseNPCIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.TheIncreaseNPCInterval")>(this, "ANPCZoneManager.TheIncreaseNPCInterval"); }
+	float& SP_TheIncreaseNPCIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.SP_TheIncreaseNPCInterval")>(this, "ANPCZoneManager.SP_TheIncreaseNPCInterval"); }
+	float& TheIncreaseNPCIntervalMaxField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.TheIncreaseNPCIntervalMax")>(this, "ANPCZoneManager.TheIncreaseNPCIntervalMax"); }
+	float& TheDecreaseNPCIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.TheDecreaseNPCInterval")>(this, "ANPCZoneManager.TheDecreaseNPCInterval"); }
+	float& NPCAIRangeMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.NPCAIRangeMultiplier")>(this, "ANPCZoneManager.NPCAIRangeMultiplier"); }
+	bool& bNPCDontWanderField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bNPCDontWander")>(this, "ANPCZoneManager.bNPCDontWander"); }
+	bool& bNPCWildIgnoreWildField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bNPCWildIgnoreWild")>(this, "ANPCZoneManager.bNPCWildIgnoreWild"); }
+	bool& bNPCNoKillXPField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bNPCNoKillXP")>(this, "ANPCZoneManager.bNPCNoKillXP"); }
+	bool& bNPCPreventSavingField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bNPCPreventSaving")>(this, "ANPCZoneManager.bNPCPreventSaving"); }
+	bool& bForceUntameableField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bForceUntameable")>(this, "ANPCZoneManager.bForceUntameable"); }
+	bool& bUsesManualSpawningField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bUsesManualSpawning")>(this, "ANPCZoneManager.bUsesManualSpawning"); }
+	bool& bIgnoreVolumeEcompassingCheckField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bIgnoreVolumeEcompassingCheck")>(this, "ANPCZoneManager.bIgnoreVolumeEcompassingCheck"); }
+	bool& bSpawnAllNPCEntriesField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bSpawnAllNPCEntries")>(this, "ANPCZoneManager.bSpawnAllNPCEntries"); }
+	bool& bOnlyUseInSingleplayerField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bOnlyUseInSingleplayer")>(this, "ANPCZoneManager.bOnlyUseInSingleplayer"); }
+	bool& bOnlyUseInDedicatedServerField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bOnlyUseInDedicatedServer")>(this, "ANPCZoneManager.bOnlyUseInDedicatedServer"); }
+	float& NPCWanderRadiusMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.NPCWanderRadiusMultiplier")>(this, "ANPCZoneManager.NPCWanderRadiusMultiplier"); }
+	int& MaxNumberSpawnZoneRandomPointChecksField() { return *GetNativePointerField<int*, API::FieldNameHash("ANPCZoneManager.MaxNumberSpawnZoneRandomPointChecks")>(this, "ANPCZoneManager.MaxNumberSpawnZoneRandomPointChecks"); }
+	int& TheNPCFullIncreaseMaximumIterationsField() { return *GetNativePointerField<int*, API::FieldNameHash("ANPCZoneManager.TheNPCFullIncreaseMaximumIterations")>(this, "ANPCZoneManager.TheNPCFullIncreaseMaximumIterations"); }
+	float& TheMinimumTamedDinoDistanceFromSpawnPointField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.TheMinimumTamedDinoDistanceFromSpawnPoint")>(this, "ANPCZoneManager.TheMinimumTamedDinoDistanceFromSpawnPoint"); }
+	float& TheMinimumStructureDistanceFromSpawnPointField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.TheMinimumStructureDistanceFromSpawnPoint")>(this, "ANPCZoneManager.TheMinimumStructureDistanceFromSpawnPoint"); }
+	float& NPCLerpToMaxRandomBaseLevelField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.NPCLerpToMaxRandomBaseLevel")>(this, "ANPCZoneManager.NPCLerpToMaxRandomBaseLevel"); }
+	float& ManualSpawningNPCLerpToMaxRandomBaseLevelField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.ManualSpawningNPCLerpToMaxRandomBaseLevel")>(this, "ANPCZoneManager.ManualSpawningNPCLerpToMaxRandomBaseLevel"); }
+	int& MaximumNumberNearbyCoreStructuresField() { return *GetNativePointerField<int*, API::FieldNameHash("ANPCZoneManager.MaximumNumberNearbyCoreStructures")>(this, "ANPCZoneManager.MaximumNumberNearbyCoreStructures"); }
+	int& AbsoluteMaximumNumberNearbyCoreStructuresField() { return *GetNativePointerField<int*, API::FieldNameHash("ANPCZoneManager.AbsoluteMaximumNumberNearbyCoreStructures")>(this, "ANPCZoneManager.AbsoluteMaximumNumberNearbyCoreStructures"); }
+	bool& bAutoKillUseGlobalStasisArrayField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bAutoKillUseGlobalStasisArray")>(this, "ANPCZoneManager.bAutoKillUseGlobalStasisArray"); }
+	bool& bTraceForSpawnAgainstWaterField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bTraceForSpawnAgainstWater")>(this, "ANPCZoneManager.bTraceForSpawnAgainstWater"); }
+	bool& bNPCForcePreventExitingWaterField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bNPCForcePreventExitingWater")>(this, "ANPCZoneManager.bNPCForcePreventExitingWater"); }
+	bool& bUseSpawnPointOverrideRotationField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bUseSpawnPointOverrideRotation")>(this, "ANPCZoneManager.bUseSpawnPointOverrideRotation"); }
+	float& NPCLevelMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.NPCLevelMultiplier")>(this, "ANPCZoneManager.NPCLevelMultiplier"); }
+	int& ForceOverrideNPCBaseLevelField() { return *GetNativePointerField<int*, API::FieldNameHash("ANPCZoneManager.ForceOverrideNPCBaseLevel")>(this, "ANPCZoneManager.ForceOverrideNPCBaseLevel"); }
+	TArray<FNPCSpawnEntry>& NPCSpawnEntriesField() { return *GetNativePointerField<TArray<FNPCSpawnEntry>*, API::FieldNameHash("ANPCZoneManager.NPCSpawnEntries")>(this, "ANPCZoneManager.NPCSpawnEntries"); }
+	TArray<FNPCSpawnLimit>& NPCSpawnLimitsField() { return *GetNativePointerField<TArray<FNPCSpawnLimit>*, API::FieldNameHash("ANPCZoneManager.NPCSpawnLimits")>(this, "ANPCZoneManager.NPCSpawnLimits"); }
+	int& UseDesiredNumberOfNPCField() { return *GetNativePointerField<int*, API::FieldNameHash("ANPCZoneManager.UseDesiredNumberOfNPC")>(this, "ANPCZoneManager.UseDesiredNumberOfNPC"); }
+	int& NumNPCSpawnedField() { return *GetNativePointerField<int*, API::FieldNameHash("ANPCZoneManager.NumNPCSpawned")>(this, "ANPCZoneManager.NumNPCSpawned"); }
+	int& NumSpawnFailuresField() { return *GetNativePointerField<int*, API::FieldNameHash("ANPCZoneManager.NumSpawnFailures")>(this, "ANPCZoneManager.NumSpawnFailures"); }
+	long double& LastIncreaseNPCTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("ANPCZoneManager.LastIncreaseNPCTime")>(this, "ANPCZoneManager.LastIncreaseNPCTime"); }
+	long double& LastDecreaseNPCTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("ANPCZoneManager.LastDecreaseNPCTime")>(this, "ANPCZoneManager.LastDecreaseNPCTime"); }
+	bool& bForceRespawnDinosField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bForceRespawnDinos")>(this, "ANPCZoneManager.bForceRespawnDinos"); }
+	bool& bTriedFullIncreaseField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bTriedFullIncrease")>(this, "ANPCZoneManager.bTriedFullIncrease"); }
+	bool& bSpawnsWaterDinosField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bSpawnsWaterDinos")>(this, "ANPCZoneManager.bSpawnsWaterDinos"); }
+	bool& bSpawnsAmphibiousDinosField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bSpawnsAmphibiousDinos")>(this, "ANPCZoneManager.bSpawnsAmphibiousDinos"); }
+	float& TheNextIncreaseNPCIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.TheNextIncreaseNPCInterval")>(this, "ANPCZoneManager.TheNextIncreaseNPCInterval"); }
+	float& CloseStructureDistanceFromSpawnPointField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.CloseStructureDistanceFromSpawnPoint")>(this, "ANPCZoneManager.CloseStructureDistanceFromSpawnPoint"); }
+	TArray<AActor *> SpawnPointOverridesField() { return *GetNativePointerField<TArray<AActor *>*, API::FieldNameHash("ANPCZoneManager.SpawnPointOverrides")>(this, "ANPCZoneManager.SpawnPointOverrides"); }
+	FName& NonDedicatedFreezeWildDinoPhysicsIfLevelUnloadedField() { return *GetNativePointerField<FName*, API::FieldNameHash("ANPCZoneManager.NonDedicatedFreezeWildDinoPhysicsIfLevelUnloaded")>(this, "ANPCZoneManager.NonDedicatedFreezeWildDinoPhysicsIfLevelUnloaded"); }
+	TArray<FName>& NonDedicatedFreezeWildDinoPhysicsIfLevelsUnloadedField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("ANPCZoneManager.NonDedicatedFreezeWildDinoPhysicsIfLevelsUnloaded")>(this, "ANPCZoneManager.NonDedicatedFreezeWildDinoPhysicsIfLevelsUnloaded"); }
+	float& MinimumManualSpawnIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("ANPCZoneManager.MinimumManualSpawnInterval")>(this, "ANPCZoneManager.MinimumManualSpawnInterval"); }
+	long double& LastManuallySpawnedTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("ANPCZoneManager.LastManuallySpawnedTime")>(this, "ANPCZoneManager.LastManuallySpawnedTime"); }
+	bool& bIgnoreNPCRandomClassReplacementsField() { return *GetNativePointerField<bool*, API::FieldNameHash("ANPCZoneManager.bIgnoreNPCRandomClassReplacements")>(this, "ANPCZoneManager.bIgnoreNPCRandomClassReplacements"); }
+	int& TheNPCDynamicIncreaseMaximumIterationsField() { return *GetNativePointerField<int*, API::FieldNameHash("ANPCZoneManager.TheNPCDynamicIncreaseMaximumIterations")>(this, "ANPCZoneManager.TheNPCDynamicIncreaseMaximumIterations"); }
 
 	// Functions
 
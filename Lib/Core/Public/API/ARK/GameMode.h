@@ -13,15 +13,15 @@ struct __declspec(align(8)) FEngramEntryAutoUnlock
 
 struct UGameViewportClient
 {
-	TArray<UObject *> ViewPortWidgetsField() { return *GetNativePointerField<TArray<UObject *>*>(this, "UGameViewportClient.ViewPortWidgets"); }
-	int& MaxSplitscreenPlayersField() { return *GetNativePointerField<int*>(this, "UGameViewportClient.MaxSplitscreenPlayers"); }
-	UWorld * WorldField() { return *GetNativePointerField<UWorld **>(this, "UGameViewportClient.World"); }
-	bool& bSuppressTransitionMessageField() { return *GetNativePointerField<bool*>(this, "UGameViewportClient.bSuppressTransitionMessage"); }
-	float& ProgressFadeTimeField() { return *GetNativePointerField<float*>(this, "UGameViewportClient.ProgressFadeTime"); }
-	int& ViewModeIndexField() { return *GetNativePointerField<int*>(this, "UGameViewportClient.ViewModeIndex"); }
-	FName& CurrentBufferVisualizationModeField() { return *GetNativePointerField<FName*>(this, "UGameViewportClient.CurrentBufferVisualizationMode"); }
-	bool& bDisableSplitScreenOverrideField() { return *GetNativePointerField<bool*>(this, "UGameViewportClient.bDisableSplitScreenOverride"); }
-	TArray<bool>& IgnoreInputValuesField() { return *GetNativePointerField<TArray<bool>*>(this, "UGameViewportClient.IgnoreInputValues"); }
+	TArray<UObject *> ViewPortWidgetsField() { return *GetNativePointerField<TArray<UObject *>*, API::FieldNameHash("UGameViewportClient.ViewPortWidgets")>(this, "UGameViewportClient.ViewPortWidgets"); }
+	int& MaxSplitscreenPlayersField() { return *GetNativePointerField<int*, API::FieldNameHash("UGameViewportClient.MaxSplitscreenPlayers")>(this, "UGameViewportClient.MaxSplitscreenPlayers"); }
+	UWorld * WorldField() { return *GetNativePointerField<UWorld **, API::FieldNameHash("UGameViewportClient.World")>(this, "UGameViewportClient.World"); }
+	bool& bSuppressTransitionMessageField() { return *GetNativePointerField<bool*, API::FieldNameHash("UGameViewportClient.bSuppressTransitionMessage")>(this, "UGameViewportClient.bSuppressTransitionMessage"); }
+	float& ProgressFadeTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("UGameViewportClient.ProgressFadeTime")>(this, "UGameViewportClient.ProgressFadeTime"); }
+	int& ViewModeIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("UGameViewportClient.ViewModeIndex")>(this, "UGameViewportClient.ViewModeIndex"); }
+	FName& CurrentBufferVisualizationModeField() { return *GetNativePointerField<FName*, API::FieldNameHash("UGameViewportClient.CurrentBufferVisualizationMode")>(this, "UGameViewportClient.CurrentBufferVisualizationMode"); }
+	bool& bDisableSplitScreenOverrideField() { return *GetNativePointerField<bool*, API::FieldNameHash("UGameViewportClient.bDisableSplitScreenOverride")>(this, "UGameViewportClient.bDisableSplitScreenOverride"); }
+	TArray<bool>& IgnoreInputValuesField() { return *GetNativePointerField<TArray<bool>*, API::FieldNameHash("UGameViewportClient.IgnoreInputValues")>(this, "UGameViewportClient.IgnoreInputValues"); }
 
 	// Bit fields
 
@@ -82,83 +82,83 @@ struct UWorld : UObject
 		unsigned __int32 bCreateFXSystem : 1;
 	};
 
-	TArray<TSubclassOf<AActor>>& ActorsClassesAllowedToSaveField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*>(this, "UWorld.ActorsClassesAllowedToSave"); }
-	bool& bIsIdleField() { return *GetNativePointerField<bool*>(this, "UWorld.bIsIdle"); }
-	TArray<TWeakObjectPtr<AActor>>& LocalStasisActorsField() { return *GetNativePointerField<TArray<TWeakObjectPtr<AActor>>*>(this, "UWorld.LocalStasisActors"); }
-	TSet<FName, DefaultKeyFuncs<FName, 0>, FDefaultSetAllocator>& LevelNameHashField() { return *GetNativePointerField<TSet<FName, DefaultKeyFuncs<FName, 0>, FDefaultSetAllocator>*>(this, "UWorld.LevelNameHash"); }
-	ULevel * PersistentLevelField() { return *GetNativePointerField<ULevel **>(this, "UWorld.PersistentLevel"); }
-	AGameState * GameStateField() { return *GetNativePointerField<AGameState **>(this, "UWorld.GameState"); }
-	TArray<UObject *> ExtraReferencedObjectsField() { return *GetNativePointerField<TArray<UObject *>*>(this, "UWorld.ExtraReferencedObjects"); }
-	FString& StreamingLevelsPrefixField() { return *GetNativePointerField<FString*>(this, "UWorld.StreamingLevelsPrefix"); }
-	ULevel * CurrentLevelPendingVisibilityField() { return *GetNativePointerField<ULevel **>(this, "UWorld.CurrentLevelPendingVisibility"); }
-	TArray<FVector>& ViewLocationsRenderedLastFrameField() { return *GetNativePointerField<TArray<FVector>*>(this, "UWorld.ViewLocationsRenderedLastFrame"); }
-	AGameMode * AuthorityGameModeField() { return *GetNativePointerField<AGameMode **>(this, "UWorld.AuthorityGameMode"); }
-	TArray<ULevel *> LevelsField() { return *GetNativePointerField<TArray<ULevel *>*>(this, "UWorld.Levels"); }
-	TArray<AActor *> NetworkActorsField() { return *GetNativePointerField<TArray<AActor *>*>(this, "UWorld.NetworkActors"); }
-	ULevel * CurrentLevelField() { return *GetNativePointerField<ULevel **>(this, "UWorld.CurrentLevel"); }
-	int& FrameCounterField() { return *GetNativePointerField<int*>(this, "UWorld.FrameCounter"); }
-	bool& GamePreviewField() { return *GetNativePointerField<bool*>(this, "UWorld.GamePreview"); }
-	TMap<FString, TArray<TArray<TArray<unsigned int>>>, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, TArray<TArray<TArray<unsigned int>>>, 0> >& LocalInstancedStaticMeshComponentInstancesVisibilityStateField() { return *GetNativePointerField<TMap<FString, TArray<TArray<TArray<unsigned int>>>, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, TArray<TArray<TArray<unsigned int>>>, 0> >*>(this, "UWorld.LocalInstancedStaticMeshComponentInstancesVisibilityState"); }
-	TMap<FName, TWeakObjectPtr<UClass>, FDefaultSetAllocator, TDefaultMapKeyFuncs<FName, TWeakObjectPtr<UClass>, 0> >& PrioritizedObjectMapField() { return *GetNativePointerField<TMap<FName, TWeakObjectPtr<UClass>, FDefaultSetAllocator, TDefaultMapKeyFuncs<FName, TWeakObjectPtr<UClass>, 0> >*>(this, "UWorld.PrioritizedObjectMap"); }
-	TArray<TAutoWeakObjectPtr<AController>>& ControllerListField() { return *GetNativePointerField<TArray<TAutoWeakObjectPtr<AController>>*>(this, "UWorld.ControllerList"); }
-	TArray<TAutoWeakObjectPtr<APlayerController>>& PlayerControllerListField() { return *GetNativePointerField<TArray<TAutoWeakObjectPtr<APlayerController>>*>(this, "UWorld.PlayerControllerList"); }
-	TArray<TAutoWeakObjectPtr<APawn>>& PawnListField() { return *GetNativePointerField<TArray<TAutoWeakObjectPtr<APawn>>*>(this, "UWorld.PawnList"); }
-	TSet<TWeakObjectPtr<UActorComponent>, DefaultKeyFuncs<TWeakObjectPtr<UActorComponent>, 0>, FDefaultSetAllocator>& ComponentsThatNeedEndOfFrameUpdateField() { return *GetNativePointerField<TSet<TWeakObjectPtr<UActorComponent>, DefaultKeyFuncs<TWeakObjectPtr<UActorComponent>, 0>, FDefaultSetAllocator>*>(this, "UWorld.ComponentsThatNeedEndOfFrameUpdate"); }
-	TSet<TWeakObjectPtr<UActorComponent>, DefaultKeyFuncs<TWeakObjectPtr<UActorComponent>, 0>, FDefaultSetAllocator>& ComponentsThatNeedEndOfFrameUpdate_OnGameThreadField() { return *GetNativePointerField<TSet<TWeakObjectPtr<UActorComponent>, DefaultKeyFuncs<TWeakObjectPtr<UActorComponent>, 0>, FDefaultSetAllocator>*>(this, "UWorld.ComponentsThatNeedEndOfFrameUpdate_OnGameThread"); }
-	TMap<TWeakObjectPtr<UBlueprint>, TWeakObjectPtr<UObject>, FDefaultSetAllocator, TDefaultMapKeyFuncs<TWeakObjectPtr<UBlueprint>, TWeakObjectPtr<UObject>, 0> >& BlueprintObjectsBeingDebuggedField() { return *GetNativePointerField<TMap<TWeakObjectPtr<UBlueprint>, TWeakObjectPtr<UObject>, FDefaultSetAllocator, TDefaultMapKeyFuncs<TWeakObjectPtr<UBlueprint>, TWeakObjectPtr<UObject>, 0> >*>(this, "UWorld.BlueprintObjectsBeingDebugged"); }
-	bool& bRequiresHitProxiesField() { return *GetNativePointerField<bool*>(this, "UWorld.bRequiresHitProxies"); }
-	long double& BuildStreamingDataTimerField() { return *GetNativePointerField<long double*>(this, "UWorld.BuildStreamingDataTimer"); }
-	bool& bInTickField() { return *GetNativePointerField<bool*>(this, "UWorld.bInTick"); }
-	bool& bIsBuiltField() { return *GetNativePointerField<bool*>(this, "UWorld.bIsBuilt"); }
-	bool& bTickNewlySpawnedField() { return *GetNativePointerField<bool*>(this, "UWorld.bTickNewlySpawned"); }
-	bool& bPostTickComponentUpdateField() { return *GetNativePointerField<bool*>(this, "UWorld.bPostTickComponentUpdate"); }
-	int& PlayerNumField() { return *GetNativePointerField<int*>(this, "UWorld.PlayerNum"); }
-	float& TimeSinceLastPendingKillPurgeField() { return *GetNativePointerField<float*>(this, "UWorld.TimeSinceLastPendingKillPurge"); }
-	bool& FullPurgeTriggeredField() { return *GetNativePointerField<bool*>(this, "UWorld.FullPurgeTriggered"); }
-	bool& bShouldDelayGarbageCollectField() { return *GetNativePointerField<bool*>(this, "UWorld.bShouldDelayGarbageCollect"); }
-	bool& bIsWorldInitializedField() { return *GetNativePointerField<bool*>(this, "UWorld.bIsWorldInitialized"); }
-	int& AllowLevelLoadOverrideField() { return *GetNativePointerField<int*>(this, "UWorld.AllowLevelLoadOverride"); }
-	int& StreamingVolumeUpdateDelayField() { return *GetNativePointerField<int*>(this, "UWorld.StreamingVolumeUpdateDelay"); }
-	bool& bIsLevelStreamingFrozenField() { return *GetNativePointerField<bool*>(this, "UWorld.bIsLevelStreamingFrozen"); }
-	bool& bShouldForceUnloadStreamingLevelsField() { return *GetNativePointerField<bool*>(this, "UWorld.bShouldForceUnloadStreamingLevels"); }
-	bool& bShouldForceVisibleStreamingLevelsField() { return *GetNativePointerField<bool*>(this, "UWorld.bShouldForceVisibleStreamingLevels"); }
-	bool& bDoDelayedUpdateCullDistanceVolumesField() { return *GetNativePointerField<bool*>(this, "UWorld.bDoDelayedUpdateCullDistanceVolumes"); }
-	TEnumAsByte<enum EWorldType::Type>& WorldTypeField() { return *GetNativePointerField<TEnumAsByte<enum EWorldType::Type>*>(this, "UWorld.WorldType"); }
-	bool& bIsRunningConstructionScriptField() { return *GetNativePointerField<bool*>(this, "UWorld.bIsRunningConstructionScript"); }
-	bool& bShouldSimulatePhysicsField() { return *GetNativePointerField<bool*>(this, "UWorld.bShouldSimulatePhysics"); }
-	FName& DebugDrawTraceTagField() { return *GetNativePointerField<FName*>(this, "UWorld.DebugDrawTraceTag"); }
-	long double& LastTimeUnbuiltLightingWasEncounteredField() { return *GetNativePointerField<long double*>(this, "UWorld.LastTimeUnbuiltLightingWasEncountered"); }
-	long double& TimeSecondsField() { return *GetNativePointerField<long double*>(this, "UWorld.TimeSeconds"); }
-	long double& LoadedAtTimeSecondsField() { return *GetNativePointerField<long double*>(this, "UWorld.LoadedAtTimeSeconds"); }
-	long double& RealTimeSecondsField() { return *GetNativePointerField<long double*>(this, "UWorld.RealTimeSeconds"); }
-	long double& AudioTimeSecondsField() { return *GetNativePointerField<long double*>(this, "UWorld.AudioTimeSeconds"); }
-	float& DeltaTimeSecondsField() { return *GetNativePointerField<float*>(this, "UWorld.DeltaTimeSeconds"); }
-	float& PauseDelayField() { return *GetNativePointerField<float*>(this, "UWorld.PauseDelay"); }
-	unsigned int& StasisThisFrameField() { return *GetNativePointerField<unsigned int*>(this, "UWorld.StasisThisFrame"); }
-	unsigned int& UnStasisThisFrameField() { return *GetNativePointerField<unsigned int*>(this, "UWorld.UnStasisThisFrame"); }
-	unsigned int& StasisOssilationThisFrameField() { return *GetNativePointerField<unsigned int*>(this, "UWorld.StasisOssilationThisFrame"); }
-	unsigned int& StasisThisFrameMaxField() { return *GetNativePointerField<unsigned int*>(this, "UWorld.StasisThisFrameMax"); }
-	unsigned int& UnStasisThisFrameMaxField() { return *GetNativePointerField<unsigned int*>(this, "UWorld.UnStasisThisFrameMax"); }
-	unsigned int& StasisOssilationThisFrameMaxField() { return *GetNativePointerField<unsigned int*>(this, "UWorld.StasisOssilationThisFrameMax"); }
-	float& StasisThisFrameAvgField() { return *GetNativePointerField<float*>(this, "UWorld.StasisThisFrameAvg"); }
-	float& UnStasisThisFrameAvgField() { return *GetNativePointerField<float*>(this, "UWorld.UnStasisThisFrameAvg"); }
-	float& StasisOssilationThisFrameAvgField() { return *GetNativePointerField<float*>(this, "UWorld.StasisOssilationThisFrameAvg"); }
-	float& StasisMaxResetTimerField() { return *GetNativePointerField<float*>(this, "UWorld.StasisMaxResetTimer"); }
-	unsigned int& LastUnstasisCountField() { return *GetNativePointerField<unsigned int*>(this, "UWorld.LastUnstasisCount"); }
-	unsigned int& LoadedSaveIncrementorField() { return *GetNativePointerField<unsigned int*>(this, "UWorld.LoadedSaveIncrementor"); }
-	unsigned int& CurrentSaveIncrementorField() { return *GetNativePointerField<unsigned int*>(this, "UWorld.CurrentSaveIncrementor"); }
-	bool& bBlockAllOnNextLevelStreamingProcessField() { return *GetNativePointerField<bool*>(this, "UWorld.bBlockAllOnNextLevelStreamingProcess"); }
-	FIntVector& OriginLocationField() { return *GetNativePointerField<FIntVector*>(this, "UWorld.OriginLocation"); }
-	FIntVector& RequestedOriginLocationField() { return *GetNativePointerField<FIntVector*>(this, "UWorld.RequestedOriginLocation"); }
-	bool& bOriginOffsetThisFrameField() { return *GetNativePointerField<bool*>(this, "UWorld.bOriginOffsetThisFrame"); }
-	bool& bFlushingLevelStreamingField() { return *GetNativePointerField<bool*>(this, "UWorld.bFlushingLevelStreaming"); }
-	long double& ForceBlockLoadTimeoutField() { return *GetNativePointerField<long double*>(this, "UWorld.ForceBlockLoadTimeout"); }
-	FString& NextURLField() { return *GetNativePointerField<FString*>(this, "UWorld.NextURL"); }
-	float& NextSwitchCountdownField() { return *GetNativePointerField<float*>(this, "UWorld.NextSwitchCountdown"); }
-	TArray<FName>& PreparingLevelNamesField() { return *GetNativePointerField<TArray<FName>*>(this, "UWorld.PreparingLevelNames"); }
-	FName& CommittedPersistentLevelNameField() { return *GetNativePointerField<FName*>(this, "UWorld.CommittedPersistentLevelName"); }
-	FString& CurrentDayTimeField() { return *GetNativePointerField<FString*>(this, "UWorld.CurrentDayTime"); }
-	unsigned int& NumLightingUnbuiltObjectsField() { return *GetNativePointerField<unsigned int*>(this, "UWorld.NumLightingUnbuiltObjects"); }
+	TArray<TSubclassOf<AActor>>& ActorsClassesAllowedToSaveField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*, API::FieldNameHash("UWorld.ActorsClassesAllowedToSave")>(this, "UWorld.ActorsClassesAllowedToSave"); }
+	bool& bIsIdleField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.bIsIdle")>(this, "UWorld.bIsIdle"); }
+	TArray<TWeakObjectPtr<AActor>>& LocalStasisActorsField() { return *GetNativePointerField<TArray<TWeakObjectPtr<AActor>>*, API::FieldNameHash("UWorld.LocalStasisActors")>(this, "UWorld.LocalStasisActors"); }
+	TSet<FName, DefaultKeyFuncs<FName, 0>, FDefaultSetAllocator>& LevelNameHashField() { return *GetNativePointerField<TSet<FName, DefaultKeyFuncs<FName, 0>, FDefaultSetAllocator>*, API::FieldNameHash("UWorld.LevelNameHash")>(this, "UWorld.LevelNameHash"); }
+	ULevel * PersistentLevelField() { return *GetNativePointerField<ULevel **, API::FieldNameHash("UWorld.PersistentLevel")>(this, "UWorld.PersistentLevel"); }
+	AGameState * GameStateField() { return *GetNativePointerField<AGameState **, API::FieldNameHash("UWorld.GameState")>(this, "UWorld.GameState"); }
+	TArray<UObject *> ExtraReferencedObjectsField() { return *GetNativePointerField<TArray<UObject *>*, API::FieldNameHash("UWorld.ExtraReferencedObjects")>(this, "UWorld.ExtraReferencedObjects"); }
+	FString& StreamingLevelsPrefixField() { return *GetNativePointerField<FString*, API::FieldNameHash("UWorld.StreamingLevelsPrefix")>(this, "UWorld.StreamingLevelsPrefix"); }
+	ULevel * CurrentLevelPendingVisibilityField() { return *GetNativePointerField<ULevel **, API::FieldNameHash("UWorld.CurrentLevelPendingVisibility")>(this, "UWorld.CurrentLevelPendingVisibility"); }
+	TArray<FVector>& ViewLocationsRenderedLastFrameField() { return *GetNativePointerField<TArray<FVector>*, API::FieldNameHash("UWorld.ViewLocationsRenderedLastFrame")>(this, "UWorld.ViewLocationsRenderedLastFrame"); }
+	AGameMode * AuthorityGameModeField() { return *GetNativePointerField<AGameMode **, API::FieldNameHash("UWorld.AuthorityGameMode")>(this, "UWorld.AuthorityGameMode"); }
+	TArray<ULevel *> LevelsField() { return *GetNativePointerField<TArray<ULevel *>*, API::FieldNameHash("UWorld.Levels")>(this, "UWorld.Levels"); }
+	TArray<AActor *> NetworkActorsField() { return *GetNativePointerField<TArray<AActor *>*, API::FieldNameHash("UWorld.NetworkActors")>(this, "UWorld.NetworkActors"); }
+	ULevel * CurrentLevelField() { return *GetNativePointerField<ULevel **, API::FieldNameHash("UWorld.CurrentLevel")>(this, "UWorld.CurrentLevel"); }
+	int& FrameCounterField() { return *GetNativePointerField<int*, API::FieldNameHash("UWorld.FrameCounter")>(this, "UWorld.FrameCounter"); }
+	bool& GamePreviewField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.GamePreview")>(this, "UWorld.GamePreview"); }
+	TMap<FString, TArray<TArray<TArray<unsigned int>>>, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, TArray<TArray<TArray<unsigned int>>>, 0> >& LocalInstancedStaticMeshComponentInstancesVisibilityStateField() { return *GetNativePointerField<TMap<FString, TArray<TArray<TArray<unsigned int>>>, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, TArray<TArray<TArray<unsigned int>>>, 0> >*, API::FieldNameHash("UWorld.LocalInstancedStaticMeshComponentInstancesVisibilityState")>(this, "UWorld.LocalInstancedStaticMeshComponentInstancesVisibilityState"); }
+	TMap<FName, TWeakObjectPtr<UClass>, FDefaultSetAllocator, TDefaultMapKeyFuncs<FName, TWeakObjectPtr<UClass>, 0> >& PrioritizedObjectMapField() { return *GetNativePointerField<TMap<FName, TWeakObjectPtr<UClass>, FDefaultSetAllocator, TDefaultMapKeyFuncs<FName, TWeakObjectPtr<UClass>, 0> >*, API::FieldNameHash("UWorld.PrioritizedObjectMap")>(this, "UWorld.PrioritizedObjectMap"); }
+	TArray<TAutoWeakObjectPtr<AController>>& ControllerListField() { return *GetNativePointerField<TArray<TAutoWeakObjectPtr<AController>>*, API::FieldNameHash("UWorld.ControllerList")>(this, "UWorld.ControllerList"); }
+	TArray<TAutoWeakObjectPtr<APlayerController>>& PlayerControllerListField() { return *GetNativePointerField<TArray<TAutoWeakObjectPtr<APlayerController>>*, API::FieldNameHash("UWorld.PlayerControllerList")>(this, "UWorld.PlayerControllerList"); }
+	TArray<TAutoWeakObjectPtr<APawn>>& PawnListField() { return *GetNativePointerField<TArray<TAutoWeakObjectPtr<APawn>>*, API::FieldNameHash("UWorld.PawnList")>(this, "UWorld.PawnList"); }
+	TSet<TWeakObjectPtr<UActorComponent>, DefaultKeyFuncs<TWeakObjectPtr<UActorComponent>, 0>, FDefaultSetAllocator>& ComponentsThatNeedEndOfFrameUpdateField() { return *GetNativePointerField<TSet<TWeakObjectPtr<UActorComponent>, DefaultKeyFuncs<TWeakObjectPtr<UActorComponent>, 0>, FDefaultSetAllocator>*, API::FieldNameHash("UWorld.ComponentsThatNeedEndOfFrameUpdate")>(this, "UWorld.ComponentsThatNeedEndOfFrameUpdate"); }
+	TSet<TWeakObjectPtr<UActorComponent>, DefaultKeyFuncs<TWeakObjectPtr<UActorComponent>, 0>, FDefaultSetAllocator>& ComponentsThatNeedEndOfFrameUpdate_OnGameThreadField() { return *GetNativePointerField<TSet<TWeakObjectPtr<UActorComponent>, DefaultKeyFuncs<TWeakObjectPtr<UActorComponent>, 0>, FDefaultSetAllocator>*, API::FieldNameHash("UWorld.ComponentsThatNeedEndOfFrameUpdate_OnGameThread")>(this, "UWorld.ComponentsThatNeedEndOfFrameUpdate_OnGameThread"); }
+	TMap<TWeakObjectPtr<UBlueprint>, TWeakObjectPtr<UObject>, FDefaultSetAllocator, TDefaultMapKeyFuncs<TWeakObjectPtr<UBlueprint>, TWeakObjectPtr<UObject>, 0> >& BlueprintObjectsBeingDebuggedField() { return *GetNativePointerField<TMap<TWeakObjectPtr<UBlueprint>, TWeakObjectPtr<UObject>, FDefaultSetAllocator, TDefaultMapKeyFuncs<TWeakObjectPtr<UBlueprint>, TWeakObjectPtr<UObject>, 0> >*, API::FieldNameHash("UWorld.BlueprintObjectsBeingDebugged")>(this, "UWorld.BlueprintObjectsBeingDebugged"); }
+	bool& bRequiresHitProxiesField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.bRequiresHitProxies")>(this, "UWorld.bRequiresHitProxies"); }
+	long double& BuildStreamingDataTimerField() { return *GetNativePointerField<long double*, API::FieldNameHash("UWorld.BuildStreamingDataTimer")>(this, "UWorld.BuildStreamingDataTimer"); }
+	bool& bInTickField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.bInTick")>(this, "UWorld.bInTick"); }
+	bool& bIsBuiltField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.bIsBuilt")>(this, "UWorld.bIsBuilt"); }
+	bool& bTickNewlySpawnedField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.bTickNewlySpawned")>(this, "UWorld.bTickNewlySpawned"); }
+	bool& bPostTickComponentUpdateField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.bPostTickComponentUpdate")>(this, "UWorld.bPostTickComponentUpdate"); }
+	int& PlayerNumField() { return *GetNativePointerField<int*, API::FieldNameHash("UWorld.PlayerNum")>(this, "UWorld.PlayerNum"); }
+	float& TimeSinceLastPendingKillPurgeField() { return *GetNativePointerField<float*, API::FieldNameHash("UWorld.TimeSinceLastPendingKillPurge")>(this, "UWorld.TimeSinceLastPendingKillPurge"); }
+	bool& FullPurgeTriggeredField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.FullPurgeTriggered")>(this, "UWorld.FullPurgeTriggered"); }
+	bool& bShouldDelayGarbageCollectField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.bShouldDelayGarbageCollect")>(this, "UWorld.bShouldDelayGarbageCollect"); }
+	bool& bIsWorldInitializedField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.bIsWorldInitialized")>(this, "UWorld.bIsWorldInitialized"); }
+	int& AllowLevelLoadOverrideField() { return *GetNativePointerField<int*, API::FieldNameHash("UWorld.AllowLevelLoadOverride")>(this, "UWorld.AllowLevelLoadOverride"); }
+	int& StreamingVolumeUpdateDelayField() { return *GetNativePointerField<int*, API::FieldNameHash("UWorld.StreamingVolumeUpdateDelay")>(this, "UWorld.StreamingVolumeUpdateDelay"); }
+	bool& bIsLevelStreamingFrozenField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.bIsLevelStreamingFrozen")>(this, "UWorld.bIsLevelStreamingFrozen"); }
+	bool& bShouldForceUnloadStreamingLevelsField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.bShouldForceUnloadStreamingLevels")>(this, "UWorld.bShouldForceUnloadStreamingLevels"); }
+	bool& bShouldForceVisibleStreamingLevelsField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.bShouldForceVisibleStreamingLevels")>(this, "UWorld.bShouldForceVisibleStreamingLevels"); }
+	bool& bDoDelayedUpdateCullDistanceVolumesField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.bDoDelayedUpdateCullDistanceVolumes")>(this, "UWorld.bDoDelayedUpdateCullDistanceVolumes"); }
+	TEnumAsByte<enum EWorldType::Type>& WorldTypeField() { return *GetNativePointerField<TEnumAsByte<enum EWorldType::Type>*, API::FieldNameHash("UWorld.WorldType")>(this, "UWorld.WorldType"); }
+	bool& bIsRunningConstructionScriptField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.bIsRunningConstructionScript")>(this, "UWorld.bIsRunningConstructionScript"); }
+	bool& bShouldSimulatePhysicsField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.bShouldSimulatePhysics")>(this, "UWorld.bShouldSimulatePhysics"); }
+	FName& DebugDrawTraceTagField() { return *GetNativePointerField<FName*, API::FieldNameHash("UWorld.DebugDrawTraceTag")>(this, "UWorld.DebugDrawTraceTag"); }
+	long double& LastTimeUnbuiltLightingWasEncounteredField() { return *GetNativePointerField<long double*, API::FieldNameHash("UWorld.LastTimeUnbuiltLightingWasEncountered")>(this, "UWorld.LastTimeUnbuiltLightingWasEncountered"); }
+	long double& TimeSecondsField() { return *GetNativePointerField<long double*, API::FieldNameHash("UWorld.TimeSeconds")>(this, "UWorld.TimeSeconds"); }
+	long double& LoadedAtTimeSecondsField() { return *GetNativePointerField<long double*, API::FieldNameHash("UWorld.LoadedAtTimeSeconds")>(this, "UWorld.LoadedAtTimeSeconds"); }
+	long double& RealTimeSecondsField() { return *GetNativePointerField<long double*, API::FieldNameHash("UWorld.RealTimeSeconds")>(this, "UWorld.RealTimeSeconds"); }
+	long double& AudioTimeSecondsField() { return *GetNativePointerField<long double*, API::FieldNameHash("UWorld.AudioTimeSeconds")>(this, "UWorld.AudioTimeSeconds"); }
+	float& DeltaTimeSecondsField() { return *GetNativePointerField<float*, API::FieldNameHash("UWorld.DeltaTimeSeconds")>(this, "UWorld.DeltaTimeSeconds"); }
+	float& PauseDelayField() { return *GetNativePointerField<float*, API::FieldNameHash("UWorld.PauseDelay")>(this, "UWorld.PauseDelay"); }
+	unsigned int& StasisThisFrameField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("UWorld.StasisThisFrame")>(this, "UWorld.StasisThisFrame"); }
+	unsigned int& UnStasisThisFrameField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("UWorld.UnStasisThisFrame")>(this, "UWorld.UnStasisThisFrame"); }
+	unsigned int& StasisOssilationThisFrameField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("UWorld.StasisOssilationThisFrame")>(this, "UWorld.StasisOssilationThisFrame"); }
+	unsigned int& StasisThisFrameMaxField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("UWorld.StasisThisFrameMax")>(this, "UWorld.StasisThisFrameMax"); }
+	unsigned int& UnStasisThisFrameMaxField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("UWorld.UnStasisThisFrameMax")>(this, "UWorld.UnStasisThisFrameMax"); }
+	unsigned int& StasisOssilationThisFrameMaxField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("UWorld.StasisOssilationThisFrameMax")>(this, "UWorld.StasisOssilationThisFrameMax"); }
+	float& StasisThisFrameAvgField() { return *GetNativePointerField<float*, API::FieldNameHash("UWorld.StasisThisFrameAvg")>(this, "UWorld.StasisThisFrameAvg"); }
+	float& UnStasisThisFrameAvgField() { return *GetNativePointerField<float*, API::FieldNameHash("UWorld.UnStasisThisFrameAvg")>(this, "UWorld.UnStasisThisFrameAvg"); }
+	float& StasisOssilationThisFrameAvgField() { return *GetNativePointerField<float*, API::FieldNameHash("UWorld.StasisOssilationThisFrameAvg")>(this, "UWorld.StasisOssilationThisFrameAvg"); }
+	float& StasisMaxResetTimerField() { return *GetNativePointerField<float*, API::FieldNameHash("UWorld.StasisMaxResetTimer")>(this, "UWorld.StasisMaxResetTimer"); }
+	unsigned int& LastUnstasisCountField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("UWorld.LastUnstasisCount")>(this, "UWorld.LastUnstasisCount"); }
+	unsigned int& LoadedSaveIncrementorField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("UWorld.LoadedSaveIncrementor")>(this, "UWorld.LoadedSaveIncrementor"); }
+	unsigned int& CurrentSaveIncrementorField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("UWorld.CurrentSaveIncrementor")>(this, "UWorld.CurrentSaveIncrementor"); }
+	bool& bBlockAllOnNextLevelStreamingProcessField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.bBlockAllOnNextLevelStreamingProcess")>(this, "UWorld.bBlockAllOnNextLevelStreamingProcess"); }
+	FIntVector& OriginLocationField() { return *GetNativePointerField<FIntVector*, API::FieldNameHash("UWorld.OriginLocation")>(this, "UWorld.OriginLocation"); }
+	FIntVector& RequestedOriginLocationField() { return *GetNativePointerField<FIntVector*, API::FieldNameHash("UWorld.RequestedOriginLocation")>(this, "UWorld.RequestedOriginLocation"); }
+	bool& bOriginOffsetThisFrameField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.bOriginOffsetThisFrame")>(this, "UWorld.bOriginOffsetThisFrame"); }
+	bool& bFlushingLevelStreamingField() { return *GetNativePointerField<bool*, API::FieldNameHash("UWorld.bFlushingLevelStreaming")>(this, "UWorld.bFlushingLevelStreaming"); }
+	long double& ForceBlockLoadTimeoutField() { return *GetNativePointerField<long double*, API::FieldNameHash("UWorld.ForceBlockLoadTimeout")>(this, "UWorld.ForceBlockLoadTimeout"); }
+	FString& NextURLField() { return *GetNativePointerField<FString*, API::FieldNameHash("UWorld.NextURL")>(this, "UWorld.NextURL"); }
+	float& NextSwitchCountdownField() { return *GetNativePointerField<float*, API::FieldNameHash("UWorld.NextSwitchCountdown")>(this, "UWorld.NextSwitchCountdown"); }
+	TArray<FName>& PreparingLevelNamesField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("UWorld.PreparingLevelNames")>(this, "UWorld.PreparingLevelNames"); }
+	FName& CommittedPersistentLevelNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("UWorld.CommittedPersistentLevelName")>(this, "UWorld.CommittedPersistentLevelName"); }
+	FString& CurrentDayTimeField() { return *GetNativePointerField<FString*, API::FieldNameHash("UWorld.CurrentDayTime")>(this, "UWorld.CurrentDayTime"); }
+	unsigned int& NumLightingUnbuiltObjectsField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("UWorld.NumLightingUnbuiltObjects")>(this, "UWorld.NumLightingUnbuiltObjects"); }
 
 	// Functions
 
@@ -242,94 +242,94 @@ struct UWorld : UObject
 
 struct UEngine : UObject
 {
-	TWeakObjectPtr<AMatineeActor>& ActiveMatineeField() { return *GetNativePointerField<TWeakObjectPtr<AMatineeActor>*>(this, "UEngine.ActiveMatinee"); }
-	TArray<FString>& AdditionalFontNamesField() { return *GetNativePointerField<TArray<FString>*>(this, "UEngine.AdditionalFontNames"); }
-	TSubclassOf<UGameViewportClient>& GameViewportClientClassField() { return *GetNativePointerField<TSubclassOf<UGameViewportClient>*>(this, "UEngine.GameViewportClientClass"); }
-	TSubclassOf<ULocalPlayer>& LocalPlayerClassField() { return *GetNativePointerField<TSubclassOf<ULocalPlayer>*>(this, "UEngine.LocalPlayerClass"); }
-	TSubclassOf<AWorldSettings>& WorldSettingsClassField() { return *GetNativePointerField<TSubclassOf<AWorldSettings>*>(this, "UEngine.WorldSettingsClass"); }
-	UPrimalGlobals * GameSingletonField() { return *GetNativePointerField<UPrimalGlobals **>(this, "UEngine.GameSingleton"); }
-	TSubclassOf<APawn>& DefaultPreviewPawnClassField() { return *GetNativePointerField<TSubclassOf<APawn>*>(this, "UEngine.DefaultPreviewPawnClass"); }
-	FString& PlayOnConsoleSaveDirField() { return *GetNativePointerField<FString*>(this, "UEngine.PlayOnConsoleSaveDir"); }
-	UTexture2D * DefaultTextureField() { return *GetNativePointerField<UTexture2D **>(this, "UEngine.DefaultTexture"); }
-	UTexture2D * DefaultBSPVertexTextureField() { return *GetNativePointerField<UTexture2D **>(this, "UEngine.DefaultBSPVertexTexture"); }
-	UTexture2D * HighFrequencyNoiseTextureField() { return *GetNativePointerField<UTexture2D **>(this, "UEngine.HighFrequencyNoiseTexture"); }
-	UTexture2D * DefaultBokehTextureField() { return *GetNativePointerField<UTexture2D **>(this, "UEngine.DefaultBokehTexture"); }
-	FLinearColor& LightingOnlyBrightnessField() { return *GetNativePointerField<FLinearColor*>(this, "UEngine.LightingOnlyBrightness"); }
-	TArray<FColor>& LightComplexityColorsField() { return *GetNativePointerField<TArray<FColor>*>(this, "UEngine.LightComplexityColors"); }
-	TArray<FLinearColor>& ShaderComplexityColorsField() { return *GetNativePointerField<TArray<FLinearColor>*>(this, "UEngine.ShaderComplexityColors"); }
-	TArray<FLinearColor>& StationaryLightOverlapColorsField() { return *GetNativePointerField<TArray<FLinearColor>*>(this, "UEngine.StationaryLightOverlapColors"); }
-	float& MaxPixelShaderAdditiveComplexityCountField() { return *GetNativePointerField<float*>(this, "UEngine.MaxPixelShaderAdditiveComplexityCount"); }
-	float& MaxES2PixelShaderAdditiveComplexityCountField() { return *GetNativePointerField<float*>(this, "UEngine.MaxES2PixelShaderAdditiveComplexityCount"); }
-	float& MinLightMapDensityField() { return *GetNativePointerField<float*>(this, "UEngine.MinLightMapDensity"); }
-	float& IdealLightMapDensityField() { return *GetNativePointerField<float*>(this, "UEngine.IdealLightMapDensity"); }
-	float& MaxLightMapDensityField() { return *GetNativePointerField<float*>(this, "UEngine.MaxLightMapDensity"); }
-	float& RenderLightMapDensityGrayscaleScaleField() { return *GetNativePointerField<float*>(this, "UEngine.RenderLightMapDensityGrayscaleScale"); }
-	float& RenderLightMapDensityColorScaleField() { return *GetNativePointerField<float*>(this, "UEngine.RenderLightMapDensityColorScale"); }
-	FLinearColor& LightMapDensityVertexMappedColorField() { return *GetNativePointerField<FLinearColor*>(this, "UEngine.LightMapDensityVertexMappedColor"); }
-	FLinearColor& LightMapDensitySelectedColorField() { return *GetNativePointerField<FLinearColor*>(this, "UEngine.LightMapDensitySelectedColor"); }
-	UPhysicalMaterial * DefaultPhysMaterialField() { return *GetNativePointerField<UPhysicalMaterial **>(this, "UEngine.DefaultPhysMaterial"); }
-	UTexture2D * PreIntegratedSkinBRDFTextureField() { return *GetNativePointerField<UTexture2D **>(this, "UEngine.PreIntegratedSkinBRDFTexture"); }
-	UTexture2D * MiniFontTextureField() { return *GetNativePointerField<UTexture2D **>(this, "UEngine.MiniFontTexture"); }
-	UTexture2D * LightMapDensityTextureField() { return *GetNativePointerField<UTexture2D **>(this, "UEngine.LightMapDensityTexture"); }
-	UGameViewportClient * GameViewportField() { return *GetNativePointerField<UGameViewportClient **>(this, "UEngine.GameViewport"); }
-	TArray<FString>& DeferredCommandsField() { return *GetNativePointerField<TArray<FString>*>(this, "UEngine.DeferredCommands"); }
-	int& TickCyclesField() { return *GetNativePointerField<int*>(this, "UEngine.TickCycles"); }
-	int& GameCyclesField() { return *GetNativePointerField<int*>(this, "UEngine.GameCycles"); }
-	int& ClientCyclesField() { return *GetNativePointerField<int*>(this, "UEngine.ClientCycles"); }
-	float& NearClipPlaneField() { return *GetNativePointerField<float*>(this, "UEngine.NearClipPlane"); }
-	float& TimeBetweenPurgingPendingKillObjectsField() { return *GetNativePointerField<float*>(this, "UEngine.TimeBetweenPurgingPendingKillObjects"); }
-	float& AsyncLoadingTimeLimitField() { return *GetNativePointerField<float*>(this, "UEngine.AsyncLoadingTimeLimit"); }
-	float& PriorityAsyncLoadingExtraTimeField() { return *GetNativePointerField<float*>(this, "UEngine.PriorityAsyncLoadingExtraTime"); }
-	float& LevelStreamingActorsUpdateTimeLimitField() { return *GetNativePointerField<float*>(this, "UEngine.LevelStreamingActorsUpdateTimeLimit"); }
-	int& LevelStreamingComponentsRegistrationGranularityField() { return *GetNativePointerField<int*>(this, "UEngine.LevelStreamingComponentsRegistrationGranularity"); }
-	int& MaximumLoopIterationCountField() { return *GetNativePointerField<int*>(this, "UEngine.MaximumLoopIterationCount"); }
-	int& NumPawnsAllowedToBeSpawnedInAFrameField() { return *GetNativePointerField<int*>(this, "UEngine.NumPawnsAllowedToBeSpawnedInAFrame"); }
-	FColor& C_WorldBoxField() { return *GetNativePointerField<FColor*>(this, "UEngine.C_WorldBox"); }
-	FColor& C_BrushWireField() { return *GetNativePointerField<FColor*>(this, "UEngine.C_BrushWire"); }
-	FColor& C_AddWireField() { return *GetNativePointerField<FColor*>(this, "UEngine.C_AddWire"); }
-	FColor& C_SubtractWireField() { return *GetNativePointerField<FColor*>(this, "UEngine.C_SubtractWire"); }
-	FColor& C_SemiSolidWireField() { return *GetNativePointerField<FColor*>(this, "UEngine.C_SemiSolidWire"); }
-	FColor& C_NonSolidWireField() { return *GetNativePointerField<FColor*>(this, "UEngine.C_NonSolidWire"); }
-	FColor& C_WireBackgroundField() { return *GetNativePointerField<FColor*>(this, "UEngine.C_WireBackground"); }
-	FColor& C_ScaleBoxHiField() { return *GetNativePointerField<FColor*>(this, "UEngine.C_ScaleBoxHi"); }
-	FColor& C_VolumeCollisionField() { return *GetNativePointerField<FColor*>(this, "UEngine.C_VolumeCollision"); }
-	FColor& C_BSPCollisionField() { return *GetNativePointerField<FColor*>(this, "UEngine.C_BSPCollision"); }
-	FColor& C_OrthoBackgroundField() { return *GetNativePointerField<FColor*>(this, "UEngine.C_OrthoBackground"); }
-	FColor& C_VolumeField() { return *GetNativePointerField<FColor*>(this, "UEngine.C_Volume"); }
-	FColor& C_BrushShapeField() { return *GetNativePointerField<FColor*>(this, "UEngine.C_BrushShape"); }
-	float& StreamingDistanceFactorField() { return *GetNativePointerField<float*>(this, "UEngine.StreamingDistanceFactor"); }
-	TEnumAsByte<enum ETransitionType>& TransitionTypeField() { return *GetNativePointerField<TEnumAsByte<enum ETransitionType>*>(this, "UEngine.TransitionType"); }
-	FString& TransitionDescriptionField() { return *GetNativePointerField<FString*>(this, "UEngine.TransitionDescription"); }
-	FString& TransitionGameModeField() { return *GetNativePointerField<FString*>(this, "UEngine.TransitionGameMode"); }
-	float& MeshLODRangeField() { return *GetNativePointerField<float*>(this, "UEngine.MeshLODRange"); }
-	float& CameraRotationThresholdField() { return *GetNativePointerField<float*>(this, "UEngine.CameraRotationThreshold"); }
-	float& CameraTranslationThresholdField() { return *GetNativePointerField<float*>(this, "UEngine.CameraTranslationThreshold"); }
-	float& PrimitiveProbablyVisibleTimeField() { return *GetNativePointerField<float*>(this, "UEngine.PrimitiveProbablyVisibleTime"); }
-	float& MaxOcclusionPixelsFractionField() { return *GetNativePointerField<float*>(this, "UEngine.MaxOcclusionPixelsFraction"); }
-	int& MaxParticleResizeField() { return *GetNativePointerField<int*>(this, "UEngine.MaxParticleResize"); }
-	int& MaxParticleResizeWarnField() { return *GetNativePointerField<int*>(this, "UEngine.MaxParticleResizeWarn"); }
-	float& NetClientTicksPerSecondField() { return *GetNativePointerField<float*>(this, "UEngine.NetClientTicksPerSecond"); }
-	float& DisplayGammaField() { return *GetNativePointerField<float*>(this, "UEngine.DisplayGamma"); }
-	float& MinDesiredFrameRateField() { return *GetNativePointerField<float*>(this, "UEngine.MinDesiredFrameRate"); }
-	FLinearColor& DefaultSelectedMaterialColorField() { return *GetNativePointerField<FLinearColor*>(this, "UEngine.DefaultSelectedMaterialColor"); }
-	FLinearColor& SelectedMaterialColorField() { return *GetNativePointerField<FLinearColor*>(this, "UEngine.SelectedMaterialColor"); }
-	FLinearColor& SelectionOutlineColorField() { return *GetNativePointerField<FLinearColor*>(this, "UEngine.SelectionOutlineColor"); }
-	FLinearColor& SelectedMaterialColorOverrideField() { return *GetNativePointerField<FLinearColor*>(this, "UEngine.SelectedMaterialColorOverride"); }
-	bool& bIsOverridingSelectedColorField() { return *GetNativePointerField<bool*>(this, "UEngine.bIsOverridingSelectedColor"); }
-	unsigned int& bEnableVisualLogRecordingOnStartField() { return *GetNativePointerField<unsigned int*>(this, "UEngine.bEnableVisualLogRecordingOnStart"); }
-	int& ScreenSaverInhibitorSemaphoreField() { return *GetNativePointerField<int*>(this, "UEngine.ScreenSaverInhibitorSemaphore"); }
-	FString& MatineeCaptureNameField() { return *GetNativePointerField<FString*>(this, "UEngine.MatineeCaptureName"); }
-	FString& MatineePackageCaptureNameField() { return *GetNativePointerField<FString*>(this, "UEngine.MatineePackageCaptureName"); }
-	int& MatineeCaptureFPSField() { return *GetNativePointerField<int*>(this, "UEngine.MatineeCaptureFPS"); }
-	bool& bNoTextureStreamingField() { return *GetNativePointerField<bool*>(this, "UEngine.bNoTextureStreaming"); }
-	FString& ParticleEventManagerClassPathField() { return *GetNativePointerField<FString*>(this, "UEngine.ParticleEventManagerClassPath"); }
-	float& SelectionHighlightIntensityField() { return *GetNativePointerField<float*>(this, "UEngine.SelectionHighlightIntensity"); }
-	float& BSPSelectionHighlightIntensityField() { return *GetNativePointerField<float*>(this, "UEngine.BSPSelectionHighlightIntensity"); }
-	float& HoverHighlightIntensityField() { return *GetNativePointerField<float*>(this, "UEngine.HoverHighlightIntensity"); }
-	float& SelectionHighlightIntensityBillboardsField() { return *GetNativePointerField<float*>(this, "UEngine.SelectionHighlightIntensityBillboards"); }
-	FString& LastModDownloadTextField() { return *GetNativePointerField<FString*>(this, "UEngine.LastModDownloadText"); }
-	FString& PrimalNetAuth_MyIPStrField() { return *GetNativePointerField<FString*>(this, "UEngine.PrimalNetAuth_MyIPStr"); }
-	FString& PrimalNetAuth_TokenField() { return *GetNativePointerField<FString*>(this, "UEngine.PrimalNetAuth_Token"); }
+	TWeakObjectPtr<AMatineeActor>& ActiveMatineeField() { return *GetNativePointerField<TWeakObjectPtr<AMatineeActor>*, API::FieldNameHash("UEngine.ActiveMatinee")>(this, "UEngine.ActiveMatinee"); }
+	TArray<FString>& AdditionalFontNamesField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("UEngine.AdditionalFontNames")>(this, "UEngine.AdditionalFontNames"); }
+	TSubclassOf<UGameViewportClient>& GameViewportClientClassField() { return *GetNativePointerField<TSubclassOf<UGameViewportClient>*, API::FieldNameHash("UEngine.GameViewportClientClass")>(this, "UEngine.GameViewportClientClass"); }
+	TSubclassOf<ULocalPlayer>& LocalPlayerClassField() { return *GetNativePointerField<TSubclassOf<ULocalPlayer>*, API::FieldNameHash("UEngine.LocalPlayerClass")>(this, "UEngine.LocalPlayerClass"); }
+	TSubclassOf<AWorldSettings>& WorldSettingsClassField() { return *GetNativePointerField<TSubclassOf<AWorldSettings>*, API::FieldNameHash("UEngine.WorldSettingsClass")>(this, "UEngine.WorldSettingsClass"); }
+	UPrimalGlobals * GameSingletonField() { return *GetNativePointerField<UPrimalGlobals **, API::FieldNameHash("UEngine.GameSingleton")>(this, "UEngine.GameSingleton"); }
+	TSubclassOf<APawn>& DefaultPreviewPawnClassField() { return *GetNativePointerField<TSubclassOf<APawn>*, API::FieldNameHash("UEngine.DefaultPreviewPawnClass")>(this, "UEngine.DefaultPreviewPawnClass"); }
+	FString& PlayOnConsoleSaveDirField() { return *GetNativePointerField<FString*, API::FieldNameHash("UEngine.PlayOnConsoleSaveDir")>(this, "UEngine.PlayOnConsoleSaveDir"); }
+	UTexture2D * DefaultTextureField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UEngine.DefaultTexture")>(this, "UEngine.DefaultTexture"); }
+	UTexture2D * DefaultBSPVertexTextureField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UEngine.DefaultBSPVertexTexture")>(this, "UEngine.DefaultBSPVertexTexture"); }
+	UTexture2D * HighFrequencyNoiseTextureField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UEngine.HighFrequencyNoiseTexture")>(this, "UEngine.HighFrequencyNoiseTexture"); }
+	UTexture2D * DefaultBokehTextureField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UEngine.DefaultBokehTexture")>(this, "UEngine.DefaultBokehTexture"); }
+	FLinearColor& LightingOnlyBrightnessField() { return *GetNativePointerField<FLinearColor*, API::FieldNameHash("UEngine.LightingOnlyBrightness")>(this, "UEngine.LightingOnlyBrightness"); }
+	TArray<FColor>& LightComplexityColorsField() { return *GetNativePointerField<TArray<FColor>*, API::FieldNameHash("UEngine.LightComplexityColors")>(this, "UEngine.LightComplexityColors"); }
+	TArray<FLinearColor>& ShaderComplexityColorsField() { return *GetNativePointerField<TArray<FLinearColor>*, API::FieldNameHash("UEngine.ShaderComplexityColors")>(this, "UEngine.ShaderComplexityColors"); }
+	TArray<FLinearColor>& StationaryLightOverlapColorsField() { return *GetNativePointerField<TArray<FLinearColor>*, API::FieldNameHash("UEngine.StationaryLightOverlapColors")>(this, "UEngine.StationaryLightOverlapColors"); }
+	float& MaxPixelShaderAdditiveComplexityCountField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.MaxPixelShaderAdditiveComplexityCount")>(this, "UEngine.MaxPixelShaderAdditiveComplexityCount"); }
+	float& MaxES2PixelShaderAdditiveComplexityCountField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.MaxES2PixelShaderAdditiveComplexityCount")>(this, "UEngine.MaxES2PixelShaderAdditiveComplexityCount"); }
+	float& MinLightMapDensityField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.MinLightMapDensity")>(this, "UEngine.MinLightMapDensity"); }
+	float& IdealLightMapDensityField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.IdealLightMapDensity")>(this, "UEngine.IdealLightMapDensity"); }
+	float& MaxLightMapDensityField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.MaxLightMapDensity")>(this, "UEngine.MaxLightMapDensity"); }
+	float& RenderLightMapDensityGrayscaleScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.RenderLightMapDensityGrayscaleScale")>(this, "UEngine.RenderLightMapDensityGrayscaleScale"); }
+	float& RenderLightMapDensityColorScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.RenderLightMapDensityColorScale")>(this, "UEngine.RenderLightMapDensityColorScale"); }
+	FLinearColor& LightMapDensityVertexMappedColorField() { return *GetNativePointerField<FLinearColor*, API::FieldNameHash("UEngine.LightMapDensityVertexMappedColor")>(this, "UEngine.LightMapDensityVertexMappedColor"); }
+	FLinearColor& LightMapDensitySelectedColorField() { return *GetNativePointerField<FLinearColor*, API::FieldNameHash("UEngine.LightMapDensitySelectedColor")>(this, "UEngine.LightMapDensitySelectedColor"); }
+	UPhysicalMaterial * DefaultPhysMaterialField() { return *GetNativePointerField<UPhysicalMaterial **, API::FieldNameHash("UEngine.DefaultPhysMaterial")>(this, "UEngine.DefaultPhysMaterial"); }
+	UTexture2D * PreIntegratedSkinBRDFTextureField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UEngine.PreIntegratedSkinBRDFTexture")>(this, "UEngine.PreIntegratedSkinBRDFTexture"); }
+	UTexture2D * MiniFontTextureField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UEngine.MiniFontTexture")>(this, "UEngine.MiniFontTexture"); }
+	UTexture2D * LightMapDensityTextureField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UEngine.LightMapDensityTexture")>(this, "UEngine.LightMapDensityTexture"); }
+	UGameViewportClient * GameViewportField() { return *GetNativePointerField<UGameViewportClient **, API::FieldNameHash("UEngine.GameViewport")>(this, "UEngine.GameViewport"); }
+	TArray<FString>& DeferredCommandsField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("UEngine.DeferredCommands")>(this, "UEngine.DeferredCommands"); }
+	int& TickCyclesField() { return *GetNativePointerField<int*, API::FieldNameHash("UEngine.TickCycles")>(this, "UEngine.TickCycles"); }
+	int& GameCyclesField() { return *GetNativePointerField<int*, API::FieldNameHash("UEngine.GameCycles")>(this, "UEngine.GameCycles"); }
+	int& ClientCyclesField() { return *GetNativePointerField<int*, API::FieldNameHash("UEngine.ClientCycles")>(this, "UEngine.ClientCycles"); }
+	float& NearClipPlaneField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.NearClipPlane")>(this, "UEngine.NearClipPlane"); }
+	float& TimeBetweenPurgingPendingKillObjectsField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.TimeBetweenPurgingPendingKillObjects")>(this, "UEngine.TimeBetweenPurgingPendingKillObjects"); }
+	float& AsyncLoadingTimeLimitField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.AsyncLoadingTimeLimit")>(this, "UEngine.AsyncLoadingTimeLimit"); }
+	float& PriorityAsyncLoadingExtraTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.PriorityAsyncLoadingExtraTime")>(this, "UEngine.PriorityAsyncLoadingExtraTime"); }
+	float& LevelStreamingActorsUpdateTimeLimitField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.LevelStreamingActorsUpdateTimeLimit")>(this, "UEngine.LevelStreamingActorsUpdateTimeLimit"); }
+	int& LevelStreamingComponentsRegistrationGranularityField() { return *GetNativePointerField<int*, API::FieldNameHash("UEngine.LevelStreamingComponentsRegistrationGranularity")>(this, "UEngine.LevelStreamingComponentsRegistrationGranularity"); }
+	int& MaximumLoopIterationCountField() { return *GetNativePointerField<int*, API::FieldNameHash("UEngine.MaximumLoopIterationCount")>(this, "UEngine.MaximumLoopIterationCount"); }
+	int& NumPawnsAllowedToBeSpawnedInAFrameField() { return *GetNativePointerField<int*, API::FieldNameHash("UEngine.NumPawnsAllowedToBeSpawnedInAFrame")>(this, "UEngine.NumPawnsAllowedToBeSpawnedInAFrame"); }
+	FColor& C_WorldBoxField() { return *GetNativePointerField<FColor*, API::FieldNameHash("UEngine.C_WorldBox")>(this, "UEngine.C_WorldBox"); }
+	FColor& C_BrushWireField() { return *GetNativePointerField<FColor*, API::FieldNameHash("UEngine.C_BrushWire")>(this, "UEngine.C_BrushWire"); }
+	FColor& C_AddWireField() { return *GetNativePointerField<FColor*, API::FieldNameHash("UEngine.C_AddWire")>(this, "UEngine.C_AddWire"); }
+	FColor& C_SubtractWireField() { return *GetNativePointerField<FColor*, API::FieldNameHash("UEngine.C_SubtractWire")>(this, "UEngine.C_SubtractWire"); }
+	FColor& C_SemiSolidWireField() { return *GetNativePointerField<FColor*, API::FieldNameHash("UEngine.C_SemiSolidWire")>(this, "UEngine.C_SemiSolidWire"); }
+	FColor& C_NonSolidWireField() { return *GetNativePointerField<FColor*, API::FieldNameHash("UEngine.C_NonSolidWire")>(this, "UEngine.C_NonSolidWire"); }
+	FColor& C_WireBackgroundField() { return *GetNativePointerField<FColor*, API::FieldNameHash("UEngine.C_WireBackground")>(this, "UEngine.C_WireBackground"); }
+	FColor& C_ScaleBoxHiField() { return *GetNativePointerField<FColor*, API::FieldNameHash("UEngine.C_ScaleBoxHi")>(this, "UEngine.C_ScaleBoxHi"); }
+	FColor& C_VolumeCollisionField() { return *GetNativePointerField<FColor*, API::FieldNameHash("UEngine.C_VolumeCollision")>(this, "UEngine.C_VolumeCollision"); }
+	FColor& C_BSPCollisionField() { return *GetNativePointerField<FColor*, API::FieldNameHash("UEngine.C_BSPCollision")>(this, "UEngine.C_BSPCollision"); }
+	FColor& C_OrthoBackgroundField() { return *GetNativePointerField<FColor*, API::FieldNameHash("UEngine.C_OrthoBackground")>(this, "UEngine.C_OrthoBackground"); }
+	FColor& C_VolumeField() { return *GetNativePointerField<FColor*, API::FieldNameHash("UEngine.C_Volume")>(this, "UEngine.C_Volume"); }
+	FColor& C_BrushShapeField() { return *GetNativePointerField<FColor*, API::FieldNameHash("UEngine.C_BrushShape")>(this, "UEngine.C_BrushShape"); }
+	float& StreamingDistanceFactorField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.StreamingDistanceFactor")>(this, "UEngine.StreamingDistanceFactor"); }
+	TEnumAsByte<enum ETransitionType>& TransitionTypeField() { return *GetNativePointerField<TEnumAsByte<enum ETransitionType>*, API::FieldNameHash("UEngine.TransitionType")>(this, "UEngine.TransitionType"); }
+	FString& TransitionDescriptionField() { return *GetNativePointerField<FString*, API::FieldNameHash("UEngine.TransitionDescription")>(this, "UEngine.TransitionDescription"); }
+	FString& TransitionGameModeField() { return *GetNativePointerField<FString*, API::FieldNameHash("UEngine.TransitionGameMode")>(this, "UEngine.TransitionGameMode"); }
+	float& MeshLODRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.MeshLODRange")>(this, "UEngine.MeshLODRange"); }
+	float& CameraRotationThresholdField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.CameraRotationThreshold")>(this, "UEngine.CameraRotationThreshold"); }
+	float& CameraTranslationThresholdField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.CameraTranslationThreshold")>(this, "UEngine.CameraTranslationThreshold"); }
+	float& PrimitiveProbablyVisibleTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.PrimitiveProbablyVisibleTime")>(this, "UEngine.PrimitiveProbablyVisibleTime"); }
+	float& MaxOcclusionPixelsFractionField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.MaxOcclusionPixelsFraction")>(this, "UEngine.MaxOcclusionPixelsFraction"); }
+	int& MaxParticleResizeField() { return *GetNativePointerField<int*, API::FieldNameHash("UEngine.MaxParticleResize")>(this, "UEngine.MaxParticleResize"); }
+	int& MaxParticleResizeWarnField() { return *GetNativePointerField<int*, API::FieldNameHash("UEngine.MaxParticleResizeWarn")>(this, "UEngine.MaxParticleResizeWarn"); }
+	float& NetClientTicksPerSecondField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.NetClientTicksPerSecond")>(this, "UEngine.NetClientTicksPerSecond"); }
+	float& DisplayGammaField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.DisplayGamma")>(this, "UEngine.DisplayGamma"); }
+	float& MinDesiredFrameRateField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.MinDesiredFrameRate")>(this, "UEngine.MinDesiredFrameRate"); }
+	FLinearColor& DefaultSelectedMaterialColorField() { return *GetNativePointerField<FLinearColor*, API::FieldNameHash("UEngine.DefaultSelectedMaterialColor")>(this, "UEngine.DefaultSelectedMaterialColor"); }
+	FLinearColor& SelectedMaterialColorField() { return *GetNativePointerField<FLinearColor*, API::FieldNameHash("UEngine.SelectedMaterialColor")>(this, "UEngine.SelectedMaterialColor"); }
+	FLinearColor& SelectionOutlineColorField() { return *GetNativePointerField<FLinearColor*, API::FieldNameHash("UEngine.SelectionOutlineColor")>(this, "UEngine.SelectionOutlineColor"); }
+	FLinearColor& SelectedMaterialColorOverrideField() { return *GetNativePointerField<FLinearColor*, API::FieldNameHash("UEngine.SelectedMaterialColorOverride")>(this, "UEngine.SelectedMaterialColorOverride"); }
+	bool& bIsOverridingSelectedColorField() { return *GetNativePointerField<bool*, API::FieldNameHash("UEngine.bIsOverridingSelectedColor")>(this, "UEngine.bIsOverridingSelectedColor"); }
+	unsigned int& bEnableVisualLogRecordingOnStartField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("UEngine.bEnableVisualLogRecordingOnStart")>(this, "UEngine.bEnableVisualLogRecordingOnStart"); }
+	int& ScreenSaverInhibitorSemaphoreField() { return *GetNativePointerField<int*, API::FieldNameHash("UEngine.ScreenSaverInhibitorSemaphore")>(this, "UEngine.ScreenSaverInhibitorSemaphore"); }
+	FString& MatineeCaptureNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("UEngine.MatineeCaptureName")>(this, "UEngine.MatineeCaptureName"); }
+	FString& MatineePackageCaptureNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("UEngine.MatineePackageCaptureName")>(this, "UEngine.MatineePackageCaptureName"); }
+	int& MatineeCaptureFPSField() { return *GetNativePointerField<int*, API::FieldNameHash("UEngine.MatineeCaptureFPS")>(this, "UEngine.MatineeCaptureFPS"); }
+	bool& bNoTextureStreamingField() { return *GetNativePointerField<bool*, API::FieldNameHash("UEngine.bNoTextureStreaming")>(this, "UEngine.bNoTextureStreaming"); }
+	FString& ParticleEventManagerClassPathField() { return *GetNativePointerField<FString*, API::FieldNameHash("UEngine.ParticleEventManagerClassPath")>(this, "UEngine.ParticleEventManagerClassPath"); }
+	float& SelectionHighlightIntensityField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.SelectionHighlightIntensity")>(this, "UEngine.SelectionHighlightIntensity"); }
+	float& BSPSelectionHighlightIntensityField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.BSPSelectionHighlightIntensity")>(this, "UEngine.BSPSelectionHighlightIntensity"); }
+	float& HoverHighlightIntensityField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.HoverHighlightIntensity")>(this, "UEngine.HoverHighlightIntensity"); }
+	float& SelectionHighlightIntensityBillboardsField() { return *GetNativePointerField<float*, API::FieldNameHash("UEngine.SelectionHighlightIntensityBillboards")>(this, "UEngine.SelectionHighlightIntensityBillboards"); }
+	FString& LastModDownloadTextField() { return *GetNativePointerField<FString*, API::FieldNameHash("UEngine.LastModDownloadText")>(this, "UEngine.LastModDownloadText"); }
+	FString& PrimalNetAuth_MyIPStrField() { return *GetNativePointerField<FString*, API::FieldNameHash("UEngine.PrimalNetAuth_MyIPStr")>(this, "UEngine.PrimalNetAuth_MyIPStr"); }
+	FString& PrimalNetAuth_TokenField() { return *GetNativePointerField<FString*, API::FieldNameHash("UEngine.PrimalNetAuth_Token")>(this, "UEngine.PrimalNetAuth_Token"); }
 
 	// Functions
 
@@ -391,16 +391,16 @@ struct UEngine : UObject
 
 struct UPrimalGlobals : UObject
 {
-	UPrimalGameData * PrimalGameDataField() { return *GetNativePointerField<UPrimalGameData **>(this, "UPrimalGlobals.PrimalGameData"); }
-	UPrimalGameData * PrimalGameDataOverrideField() { return *GetNativePointerField<UPrimalGameData **>(this, "UPrimalGlobals.PrimalGameDataOverride"); }
-	bool& bAllowSingleplayerField() { return *GetNativePointerField<bool*>(this, "UPrimalGlobals.bAllowSingleplayer"); }
-	bool& bAllowNonDedicatedHostField() { return *GetNativePointerField<bool*>(this, "UPrimalGlobals.bAllowNonDedicatedHost"); }
-	TArray<FString>& UIOnlyShowMapFileNamesField() { return *GetNativePointerField<TArray<FString>*>(this, "UPrimalGlobals.UIOnlyShowMapFileNames"); }
-	TArray<FString>& UIOnlyShowModIDsField() { return *GetNativePointerField<TArray<FString>*>(this, "UPrimalGlobals.UIOnlyShowModIDs"); }
-	bool& bTotalConversionShowUnofficialServersField() { return *GetNativePointerField<bool*>(this, "UPrimalGlobals.bTotalConversionShowUnofficialServers"); }
-	FString& CreditStringField() { return *GetNativePointerField<FString*>(this, "UPrimalGlobals.CreditString"); }
-	bool& bGameMediaLoadedField() { return *GetNativePointerField<bool*>(this, "UPrimalGlobals.bGameMediaLoaded"); }
-	bool& bStartedAsyncLoadField() { return *GetNativePointerField<bool*>(this, "UPrimalGlobals.bStartedAsyncLoad"); }
+	UPrimalGameData * PrimalGameDataField() { return *GetNativePointerField<UPrimalGameData **, API::FieldNameHash("UPrimalGlobals.PrimalGameData")>(this, "UPrimalGlobals.PrimalGameData"); }
+	UPrimalGameData * PrimalGameDataOverrideField() { return *GetNativePointerField<UPrimalGameData **, API::FieldNameHash("UPrimalGlobals.PrimalGameDataOverride")>(this, "UPrimalGlobals.PrimalGameDataOverride"); }
+	bool& bAllowSingleplayerField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimalGlobals.bAllowSingleplayer")>(this, "UPrimalGlobals.bAllowSingleplayer"); }
+	bool& bAllowNonDedicatedHostField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimalGlobals.bAllowNonDedicatedHost")>(this, "UPrimalGlobals.bAllowNonDedicatedHost"); }
+	TArray<FString>& UIOnlyShowMapFileNamesField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("UPrimalGlobals.UIOnlyShowMapFileNames")>(this, "UPrimalGlobals.UIOnlyShowMapFileNames"); }
+	TArray<FString>& UIOnlyShowModIDsField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("UPrimalGlobals.UIOnlyShowModIDs")>(this, "UPrimalGlobals.UIOnlyShowModIDs"); }
+	bool& bTotalConversionShowUnofficialServersField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimalGlobals.bTotalConversionShowUnofficialServers")>(this, "UPrimalGlobals.bTotalConversionShowUnofficialServers"); }
+	FString& CreditStringField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalGlobals.CreditString")>(this, "UPrimalGlobals.CreditString"); }
+	bool& bGameMediaLoadedField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimalGlobals.bGameMediaLoaded")>(this, "UPrimalGlobals.bGameMediaLoaded"); }
+	bool& bStartedAsyncLoadField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimalGlobals.bStartedAsyncLoad")>(this, "UPrimalGlobals.bStartedAsyncLoad"); }
 
 	// Functions
 
@@ -429,27 +429,27 @@ struct ULevel : ULevelBase
 
 struct AGameMode
 {
-	FName& MatchStateField() { return *GetNativePointerField<FName*>(this, "AGameMode.MatchState"); }
-	FString& OptionsStringField() { return *GetNativePointerField<FString*>(this, "AGameMode.OptionsString"); }
-	TSubclassOf<APawn>& DefaultPawnClassField() { return *GetNativePointerField<TSubclassOf<APawn>*>(this, "AGameMode.DefaultPawnClass"); }
-	TSubclassOf<AHUD>& HUDClassField() { return *GetNativePointerField<TSubclassOf<AHUD>*>(this, "AGameMode.HUDClass"); }
-	int& NumSpectatorsField() { return *GetNativePointerField<int*>(this, "AGameMode.NumSpectators"); }
-	int& NumPlayersField() { return *GetNativePointerField<int*>(this, "AGameMode.NumPlayers"); }
-	int& NumBotsField() { return *GetNativePointerField<int*>(this, "AGameMode.NumBots"); }
-	float& MinRespawnDelayField() { return *GetNativePointerField<float*>(this, "AGameMode.MinRespawnDelay"); }
-	AGameSession * GameSessionField() { return *GetNativePointerField<AGameSession **>(this, "AGameMode.GameSession"); }
-	int& NumTravellingPlayersField() { return *GetNativePointerField<int*>(this, "AGameMode.NumTravellingPlayers"); }
-	int& CurrentIDField() { return *GetNativePointerField<int*>(this, "AGameMode.CurrentID"); }
-	FString& DefaultPlayerNameField() { return *GetNativePointerField<FString*>(this, "AGameMode.DefaultPlayerName"); }
-	TArray<APlayerStart *> PlayerStartsField() { return *GetNativePointerField<TArray<APlayerStart *>*>(this, "AGameMode.PlayerStarts"); }
-	TSubclassOf<APlayerController>& PlayerControllerClassField() { return *GetNativePointerField<TSubclassOf<APlayerController>*>(this, "AGameMode.PlayerControllerClass"); }
-	TSubclassOf<APlayerState>& PlayerStateClassField() { return *GetNativePointerField<TSubclassOf<APlayerState>*>(this, "AGameMode.PlayerStateClass"); }
-	TSubclassOf<AGameState>& GameStateClassField() { return *GetNativePointerField<TSubclassOf<AGameState>*>(this, "AGameMode.GameStateClass"); }
-	AGameState * GameStateField() { return *GetNativePointerField<AGameState **>(this, "AGameMode.GameState"); }
-	TArray<APlayerState *> InactivePlayerArrayField() { return *GetNativePointerField<TArray<APlayerState *>*>(this, "AGameMode.InactivePlayerArray"); }
-	UAntiDupeTransactionLog * AntiDupeTransactionLogField() { return *GetNativePointerField<UAntiDupeTransactionLog **>(this, "AGameMode.AntiDupeTransactionLog"); }
-	float& InactivePlayerStateLifeSpanField() { return *GetNativePointerField<float*>(this, "AGameMode.InactivePlayerStateLifeSpan"); }
-	TArray<APlayerStart *> UsedPlayerStartsField() { return *GetNativePointerField<TArray<APlayerStart *>*>(this, "AGameMode.UsedPlayerStarts"); }
+	FName& MatchStateField() { return *GetNativePointerField<FName*, API::FieldNameHash("AGameMode.MatchState")>(this, "AGameMode.MatchState"); }
+	FString& OptionsStringField() { return *GetNativePointerField<FString*, API::FieldNameHash("AGameMode.OptionsString")>(this, "AGameMode.OptionsString"); }
+	TSubclassOf<APawn>& DefaultPawnClassField() { return *GetNativePointerField<TSubclassOf<APawn>*, API::FieldNameHash("AGameMode.DefaultPawnClass")>(this, "AGameMode.DefaultPawnClass"); }
+	TSubclassOf<AHUD>& HUDClassField() { return *GetNativePointerField<TSubclassOf<AHUD>*, API::FieldNameHash("AGameMode.HUDClass")>(this, "AGameMode.HUDClass"); }
+	int& NumSpectatorsField() { return *GetNativePointerField<int*, API::FieldNameHash("AGameMode.NumSpectators")>(this, "AGameMode.NumSpectators"); }
+	int& NumPlayersField() { return *GetNativePointerField<int*, API::FieldNameHash("AGameMode.NumPlayers")>(this, "AGameMode.NumPlayers"); }
+	int& NumBotsField() { return *GetNativePointerField<int*, API::FieldNameHash("AGameMode.NumBots")>(this, "AGameMode.NumBots"); }
+	float& MinRespawnDelayField() { return *GetNativePointerField<float*, API::FieldNameHash("AGameMode.MinRespawnDelay")>(this, "AGameMode.MinRespawnDelay"); }
+	AGameSession * GameSessionField() { return *GetNativePointerField<AGameSession **, API::FieldNameHash("AGameMode.GameSession")>(this, "AGameMode.GameSession"); }
+	int& NumTravellingPlayersField() { return *GetNativePointerField<int*, API::FieldNameHash("AGameMode.NumTravellingPlayers")>(this, "AGameMode.NumTravellingPlayers"); }
+	int& CurrentIDField() { return *GetNativePointerField<int*, API::FieldNameHash("AGameMode.CurrentID")>(this, "AGameMode.CurrentID"); }
+	FString& DefaultPlayerNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("AGameMode.DefaultPlayerName")>(this, "AGameMode.DefaultPlayerName"); }
+	TArray<APlayerStart *> PlayerStartsField() { return *GetNativePointerField<TArray<APlayerStart *>*, API::FieldNameHash("AGameMode.PlayerStarts")>(this, "AGameMode.PlayerStarts"); }
+	TSubclassOf<APlayerController>& PlayerControllerClassField() { return *GetNativePointerField<TSubclassOf<APlayerController>*, API::FieldNameHash("AGameMode.PlayerControllerClass")>(this, "AGameMode.PlayerControllerClass"); }
+	TSubclassOf<APlayerState>& PlayerStateClassField() { return *GetNativePointerField<TSubclassOf<APlayerState>*, API::FieldNameHash("AGameMode.PlayerStateClass")>(this, "AGameMode.PlayerStateClass"); }
+	TSubclassOf<AGameState>& GameStateClassField() { return *GetNativePointerField<TSubclassOf<AGameState>*, API::FieldNameHash("AGameMode.GameStateClass")>(this, "AGameMode.GameStateClass"); }
+	AGameState * GameStateField() { return *GetNativePointerField<AGameState **, API::FieldNameHash("AGameMode.GameState")>(this, "AGameMode.GameState"); }
+	TArray<APlayerState *> InactivePlayerArrayField() { return *GetNativePointerField<TArray<APlayerState *>*, API::FieldNameHash("AGameMode.InactivePlayerArray")>(this, "AGameMode.InactivePlayerArray"); }
+	UAntiDupeTransactionLog * AntiDupeTransactionLogField() { return *GetNativePointerField<UAntiDupeTransactionLog **, API::FieldNameHash("AGameMode.AntiDupeTransactionLog")>(this, "AGameMode.AntiDupeTransactionLog"); }
+	float& InactivePlayerStateLifeSpanField() { return *GetNativePointerField<float*, API::FieldNameHash("AGameMode.InactivePlayerStateLifeSpan")>(this, "AGameMode.InactivePlayerStateLifeSpan"); }
+	TArray<APlayerStart *> UsedPlayerStartsField() { return *GetNativePointerField<TArray<APlayerStart *>*, API::FieldNameHash("AGameMode.UsedPlayerStarts")>(this, "AGameMode.UsedPlayerStarts"); }
 
 	// Bit fields
 
@@ -538,368 +538,368 @@ struct AGameMode
 
 struct AShooterGameMode : AGameMode
 {
-	int& LastRepopulationIndexToCheckField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.LastRepopulationIndexToCheck"); }
-	FString& AlarmNotificationKeyField() { return *GetNativePointerField<FString*>(this, "AShooterGameMode.AlarmNotificationKey"); }
-	FString& AlarmNotificationURLField() { return *GetNativePointerField<FString*>(this, "AShooterGameMode.AlarmNotificationURL"); }
-	FString& BanFileNameField() { return *GetNativePointerField<FString*>(this, "AShooterGameMode.BanFileName"); }
-	TMap<FString, FString, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, FString, 0> >& BannedMapField() { return *GetNativePointerField<TMap<FString, FString, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, FString, 0> >*>(this, "AShooterGameMode.BannedMap"); }
-	long double& LastTimeCheckedForSaveBackupField() { return *GetNativePointerField<long double*>(this, "AShooterGameMode.LastTimeCheckedForSaveBackup"); }
-	int& LastDayOfYearBackedUpField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.LastDayOfYearBackedUp"); }
-	long double& TimeLastStartedDoingRemoteBackupField() { return *GetNativePointerField<long double*>(this, "AShooterGameMode.TimeLastStartedDoingRemoteBackup"); }
-	bool& InitiatedArkTributeAvailabilityCheckField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.InitiatedArkTributeAvailabilityCheck"); }
-	URCONServer * RCONSocketField() { return *GetNativePointerField<URCONServer **>(this, "AShooterGameMode.RCONSocket"); }
-	FString& PlayersJoinNoCheckFilenameField() { return *GetNativePointerField<FString*>(this, "AShooterGameMode.PlayersJoinNoCheckFilename"); }
-	FString& PlayersExclusiveCheckFilenameField() { return *GetNativePointerField<FString*>(this, "AShooterGameMode.PlayersExclusiveCheckFilename"); }
-	int& TerrainGeneratorVersionField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.TerrainGeneratorVersion"); }
-	TArray<FUniqueNetIdUInt64>& PlayersJoinNoCheckField() { return *GetNativePointerField<TArray<FUniqueNetIdUInt64>*>(this, "AShooterGameMode.PlayersJoinNoCheck"); }
-	TArray<FUniqueNetIdUInt64>& PlayersExclusiveListField() { return *GetNativePointerField<TArray<FUniqueNetIdUInt64>*>(this, "AShooterGameMode.PlayersExclusiveList"); }
-	void * GameBackupPipeReadField() { return *GetNativePointerField<void **>(this, "AShooterGameMode.GameBackupPipeRead"); }
-	void * GameBackupPipeWriteField() { return *GetNativePointerField<void **>(this, "AShooterGameMode.GameBackupPipeWrite"); }
-	TSet<unsigned int, DefaultKeyFuncs<unsigned int, 0>, FDefaultSetAllocator>& TribesIdsField() { return *GetNativePointerField<TSet<unsigned int, DefaultKeyFuncs<unsigned int, 0>, FDefaultSetAllocator>*>(this, "AShooterGameMode.TribesIds"); }
-	TMap<int, unsigned __int64, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, unsigned __int64, 0> >& PlayersIdsField() { return *GetNativePointerField<TMap<int, unsigned __int64, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, unsigned __int64, 0> >*>(this, "AShooterGameMode.PlayersIds"); }
-	TMap<unsigned __int64, int, FDefaultSetAllocator, TDefaultMapKeyFuncs<unsigned __int64, int, 0> >& SteamIdsField() { return *GetNativePointerField<TMap<unsigned __int64, int, FDefaultSetAllocator, TDefaultMapKeyFuncs<unsigned __int64, int, 0> >*>(this, "AShooterGameMode.SteamIds"); }
-	FString& LaunchOptionsField() { return *GetNativePointerField<FString*>(this, "AShooterGameMode.LaunchOptions"); }
-	TArray<FTribeData>& TribesDataField() { return *GetNativePointerField<TArray<FTribeData>*>(this, "AShooterGameMode.TribesData"); }
-	FString& PGMapNameField() { return *GetNativePointerField<FString*>(this, "AShooterGameMode.PGMapName"); }
-	FString& PGTerrainPropertiesStringField() { return *GetNativePointerField<FString*>(this, "AShooterGameMode.PGTerrainPropertiesString"); }
-	TMap<FString, FString, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, FString, 0> >& PGTerrainPropertiesField() { return *GetNativePointerField<TMap<FString, FString, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, FString, 0> >*>(this, "AShooterGameMode.PGTerrainProperties"); }
-	bool& bAutoCreateNewPlayerDataField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAutoCreateNewPlayerData"); }
-	bool& bIsRestartingField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bIsRestarting"); }
-	bool& bProximityVoiceChatField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bProximityVoiceChat"); }
-	bool& bProximityChatField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bProximityChat"); }
-	bool& bAutoRestoreBackupsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAutoRestoreBackups"); }
-	float& DifficultyValueField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.DifficultyValue"); }
-	float& DifficultyValueMinField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.DifficultyValueMin"); }
-	float& DifficultyValueMaxField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.DifficultyValueMax"); }
-	float& ProximityRadiusField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.ProximityRadius"); }
-	float& ProximityRadiusUnconsiousScaleField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.ProximityRadiusUnconsiousScale"); }
-	TSubclassOf<UCheatManager>& CheatClassField() { return *GetNativePointerField<TSubclassOf<UCheatManager>*>(this, "AShooterGameMode.CheatClass"); }
-	bool& bIsOfficialServerField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bIsOfficialServer"); }
-	bool& bServerAllowArkDownloadField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bServerAllowArkDownload"); }
-	bool& bServerAllowThirdPersonPlayerField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bServerAllowThirdPersonPlayer"); }
-	bool& bUseExclusiveListField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bUseExclusiveList"); }
-	bool& bAlwaysNotifyPlayerLeftField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAlwaysNotifyPlayerLeft"); }
-	bool& bAlwaysNotifyPlayerJoinedField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAlwaysNotifyPlayerJoined"); }
-	bool& bServerHardcoreField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bServerHardcore"); }
-	bool& bServerPVEField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bServerPVE"); }
-	bool& bServerCrosshairField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bServerCrosshair"); }
-	bool& bServerForceNoHUDField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bServerForceNoHUD"); }
-	bool& bMapPlayerLocationField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bMapPlayerLocation"); }
-	bool& bAllowFlyerCarryPvEField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowFlyerCarryPvE"); }
-	bool& bDisableStructureDecayPvEField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bDisableStructureDecayPvE"); }
-	bool& bDisableDinoDecayPvEField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bDisableDinoDecayPvE"); }
-	bool& bEnablePvPGammaField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bEnablePvPGamma"); }
-	bool& bDisablePvEGammaField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bDisablePvEGamma"); }
-	bool& bClampResourceHarvestDamageField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bClampResourceHarvestDamage"); }
-	bool& bPreventStructurePaintingField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bPreventStructurePainting"); }
-	bool& bAllowCaveBuildingPvEField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowCaveBuildingPvE"); }
-	bool& bAdminLoggingField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAdminLogging"); }
-	bool& bPvPStructureDecayField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bPvPStructureDecay"); }
-	bool& bAutoDestroyStructuresField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAutoDestroyStructures"); }
-	bool& bForceAllStructureLockingField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bForceAllStructureLocking"); }
-	bool& bAllowDeprecatedStructuresField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowDeprecatedStructures"); }
-	bool& bPreventTribeAlliancesField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bPreventTribeAlliances"); }
-	bool& bAllowHitMarkersField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowHitMarkers"); }
-	bool& bOnlyAutoDestroyCoreStructuresField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bOnlyAutoDestroyCoreStructures"); }
-	bool& bPreventMateBoostField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bPreventMateBoost"); }
-	bool& bTribeLogDestroyedEnemyStructuresField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bTribeLogDestroyedEnemyStructures"); }
-	bool& bPvEAllowStructuresAtSupplyDropsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bPvEAllowStructuresAtSupplyDrops"); }
-	bool& bServerGameLogIncludeTribeLogsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bServerGameLogIncludeTribeLogs"); }
-	bool& bServerRCONOutputTribeLogsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bServerRCONOutputTribeLogs"); }
-	bool& bUseOptimizedHarvestingHealthField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bUseOptimizedHarvestingHealth"); }
-	bool& bClampItemSpoilingTimesField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bClampItemSpoilingTimes"); }
-	bool& bClampItemStatsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bClampItemStats"); }
-	bool& bAutoDestroyDecayedDinosField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAutoDestroyDecayedDinos"); }
-	bool& bAllowMultipleAttachedC4Field() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowMultipleAttachedC4"); }
-	bool& bAllowFlyingStaminaRecoveryField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowFlyingStaminaRecovery"); }
-	bool& bCrossARKAllowForeignDinoDownloadsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bCrossARKAllowForeignDinoDownloads"); }
-	bool& bPreventSpawnAnimationsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bPreventSpawnAnimations"); }
-	bool& bIsLegacyServerField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bIsLegacyServer"); }
-	bool& bIdlePlayerKickAllowedField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bIdlePlayerKickAllowed"); }
-	int& TheMaxStructuresInRangeField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.TheMaxStructuresInRange"); }
-	int& MaxStructuresInSmallRadiusField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.MaxStructuresInSmallRadius"); }
-	int& RCONPortField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.RCONPort"); }
-	float& DayCycleSpeedScaleField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.DayCycleSpeedScale"); }
-	float& NightTimeSpeedScaleField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.NightTimeSpeedScale"); }
-	float& DayTimeSpeedScaleField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.DayTimeSpeedScale"); }
-	float& PvEStructureDecayPeriodMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.PvEStructureDecayPeriodMultiplier"); }
-	float& StructurePreventResourceRadiusMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.StructurePreventResourceRadiusMultiplier"); }
-	float& PvEDinoDecayPeriodMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.PvEDinoDecayPeriodMultiplier"); }
-	float& ResourcesRespawnPeriodMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.ResourcesRespawnPeriodMultiplier"); }
-	float& MaxTamedDinosField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.MaxTamedDinos"); }
-	float& ListenServerTetherDistanceMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.ListenServerTetherDistanceMultiplier"); }
-	float& PerPlatformMaxStructuresMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.PerPlatformMaxStructuresMultiplier"); }
-	float& AutoDestroyOldStructuresMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.AutoDestroyOldStructuresMultiplier"); }
-	float& RCONServerGameLogBufferField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.RCONServerGameLogBuffer"); }
-	float& OxygenSwimSpeedStatMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.OxygenSwimSpeedStatMultiplier"); }
-	float& ServerAutoForceRespawnWildDinosIntervalField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.ServerAutoForceRespawnWildDinosInterval"); }
-	float& RadiusStructuresInSmallRadiusField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.RadiusStructuresInSmallRadius"); }
-	float& EnableAFKKickPlayerCountPercentField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.EnableAFKKickPlayerCountPercent"); }
-	float& KickIdlePlayersPeriodField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.KickIdlePlayersPeriod"); }
-	float& MateBoostEffectMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.MateBoostEffectMultiplier"); }
-	float& AutoSavePeriodMinutesField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.AutoSavePeriodMinutes"); }
-	float& XPMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.XPMultiplier"); }
-	FName& ActiveEventField() { return *GetNativePointerField<FName*>(this, "AShooterGameMode.ActiveEvent"); }
-	float& TribeNameChangeCooldownField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.TribeNameChangeCooldown"); }
-	bool& bAllowHideDamageSourceFromLogsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowHideDamageSourceFromLogs"); }
-	float& KillXPMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.KillXPMultiplier"); }
-	float& HarvestXPMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.HarvestXPMultiplier"); }
-	float& CraftXPMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.CraftXPMultiplier"); }
-	float& GenericXPMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.GenericXPMultiplier"); }
-	float& SpecialXPMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.SpecialXPMultiplier"); }
-	float& RandomAutoSaveSpreadField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.RandomAutoSaveSpread"); }
-	FString& SteamAPIKeyField() { return *GetNativePointerField<FString*>(this, "AShooterGameMode.SteamAPIKey"); }
-	FString& LastServerNotificationMessageField() { return *GetNativePointerField<FString*>(this, "AShooterGameMode.LastServerNotificationMessage"); }
-	long double& LastServerNotificationRecievedAtField() { return *GetNativePointerField<long double*>(this, "AShooterGameMode.LastServerNotificationRecievedAt"); }
-	long double& LastExecSaveTimeField() { return *GetNativePointerField<long double*>(this, "AShooterGameMode.LastExecSaveTime"); }
-	long double& LastTimeSavedWorldField() { return *GetNativePointerField<long double*>(this, "AShooterGameMode.LastTimeSavedWorld"); }
-	FString& LastClaimedGameCodeField() { return *GetNativePointerField<FString*>(this, "AShooterGameMode.LastClaimedGameCode"); }
-	TArray<FString>& ArkGameCodesField() { return *GetNativePointerField<TArray<FString>*>(this, "AShooterGameMode.ArkGameCodes"); }
-	bool& bIsCurrentlyRequestingKeyField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bIsCurrentlyRequestingKey"); }
-	FString& SaveDirectoryNameField() { return *GetNativePointerField<FString*>(this, "AShooterGameMode.SaveDirectoryName"); }
-	TArray<UPrimalPlayerData *> PlayerDatasField() { return *GetNativePointerField<TArray<UPrimalPlayerData *>*>(this, "AShooterGameMode.PlayerDatas"); }
-	int& NPCZoneManagerModField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.NPCZoneManagerMod"); }
-	bool& bPopulatingSpawnZonesField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bPopulatingSpawnZones"); }
-	bool& bRestartedAPlayerField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bRestartedAPlayer"); }
-	bool& bForceRespawnDinosField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bForceRespawnDinos"); }
-	bool& bFirstSaveWorldField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bFirstSaveWorld"); }
-	bool& bAllowRaidDinoFeedingField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowRaidDinoFeeding"); }
-	FDateTime& LastBackupTimeField() { return *GetNativePointerField<FDateTime*>(this, "AShooterGameMode.LastBackupTime"); }
-	FDateTime& LastSaveWorldTimeField() { return *GetNativePointerField<FDateTime*>(this, "AShooterGameMode.LastSaveWorldTime"); }
-	float& TamedDinoDamageMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.TamedDinoDamageMultiplier"); }
-	float& DinoDamageMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.DinoDamageMultiplier"); }
-	float& PlayerDamageMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.PlayerDamageMultiplier"); }
-	float& StructureDamageMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.StructureDamageMultiplier"); }
-	float& PlayerResistanceMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.PlayerResistanceMultiplier"); }
-	float& DinoResistanceMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.DinoResistanceMultiplier"); }
-	float& TamedDinoResistanceMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.TamedDinoResistanceMultiplier"); }
-	float& StructureResistanceMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.StructureResistanceMultiplier"); }
-	bool& bJoinInProgressGamesAsSpectatorField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bJoinInProgressGamesAsSpectator"); }
-	float& TamingSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.TamingSpeedMultiplier"); }
-	float& HarvestAmountMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.HarvestAmountMultiplier"); }
-	float& HarvestHealthMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.HarvestHealthMultiplier"); }
-	float& PlayerCharacterWaterDrainMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.PlayerCharacterWaterDrainMultiplier"); }
-	float& PlayerCharacterFoodDrainMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.PlayerCharacterFoodDrainMultiplier"); }
-	float& DinoCharacterFoodDrainMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.DinoCharacterFoodDrainMultiplier"); }
-	float& RaidDinoCharacterFoodDrainMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.RaidDinoCharacterFoodDrainMultiplier"); }
-	float& PlayerCharacterStaminaDrainMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.PlayerCharacterStaminaDrainMultiplier"); }
-	float& DinoCharacterStaminaDrainMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.DinoCharacterStaminaDrainMultiplier"); }
-	float& PlayerCharacterHealthRecoveryMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.PlayerCharacterHealthRecoveryMultiplier"); }
-	float& DinoCharacterHealthRecoveryMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.DinoCharacterHealthRecoveryMultiplier"); }
-	float& CarnivoreNaturalTargetingRangeMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.CarnivoreNaturalTargetingRangeMultiplier"); }
-	float& CarnivorePlayerAggroMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.CarnivorePlayerAggroMultiplier"); }
-	float& HerbivoreNaturalTargetingRangeMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.HerbivoreNaturalTargetingRangeMultiplier"); }
-	float& HerbivorePlayerAggroMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.HerbivorePlayerAggroMultiplier"); }
-	bool& AIForceTargetPlayersField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.AIForceTargetPlayers"); }
-	bool& AIForceOverlapCheckField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.AIForceOverlapCheck"); }
-	float& DinoCountMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.DinoCountMultiplier"); }
-	bool& bDisableSaveLoadField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bDisableSaveLoad"); }
-	bool& bDisableXPField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bDisableXP"); }
-	bool& bDisableDynamicMusicField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bDisableDynamicMusic"); }
-	TArray<FPlayerDeathReason>& PlayerDeathReasonsField() { return *GetNativePointerField<TArray<FPlayerDeathReason>*>(this, "AShooterGameMode.PlayerDeathReasons"); }
-	TArray<FLevelExperienceRamp>& LevelExperienceRampOverridesField() { return *GetNativePointerField<TArray<FLevelExperienceRamp>*>(this, "AShooterGameMode.LevelExperienceRampOverrides"); }
-	TArray<int>& OverridePlayerLevelEngramPointsField() { return *GetNativePointerField<TArray<int>*>(this, "AShooterGameMode.OverridePlayerLevelEngramPoints"); }
-	TArray<int>& ExcludeItemIndicesField() { return *GetNativePointerField<TArray<int>*>(this, "AShooterGameMode.ExcludeItemIndices"); }
-	//TArray<FEngramEntryOverride>& OverrideEngramEntriesField() { return *GetNativePointerField<TArray<FEngramEntryOverride>*>(this, "AShooterGameMode.OverrideEngramEntries"); }
-	//TArray<FEngramEntryOverride>& OverrideNamedEngramEntriesField() { return *GetNativePointerField<TArray<FEngramEntryOverride>*>(this, "AShooterGameMode.OverrideNamedEngramEntries"); }
-	TArray<FEngramEntryAutoUnlock>& EngramEntryAutoUnlocksField() { return *GetNativePointerField<TArray<FEngramEntryAutoUnlock>*>(this, "AShooterGameMode.EngramEntryAutoUnlocks"); }
-	TArray<FString>& PreventDinoTameClassNamesField() { return *GetNativePointerField<TArray<FString>*>(this, "AShooterGameMode.PreventDinoTameClassNames"); }
-	//TArray<FDinoSpawnWeightMultiplier>& DinoSpawnWeightMultipliersField() { return *GetNativePointerField<TArray<FDinoSpawnWeightMultiplier>*>(this, "AShooterGameMode.DinoSpawnWeightMultipliers"); }
-	//TArray<FClassMultiplier>& DinoClassResistanceMultipliersField() { return *GetNativePointerField<TArray<FClassMultiplier>*>(this, "AShooterGameMode.DinoClassResistanceMultipliers"); }
-	//TArray<FClassMultiplier>& TamedDinoClassResistanceMultipliersField() { return *GetNativePointerField<TArray<FClassMultiplier>*>(this, "AShooterGameMode.TamedDinoClassResistanceMultipliers"); }
-	//TArray<FClassMultiplier>& DinoClassDamageMultipliersField() { return *GetNativePointerField<TArray<FClassMultiplier>*>(this, "AShooterGameMode.DinoClassDamageMultipliers"); }
-	//TArray<FClassMultiplier>& TamedDinoClassDamageMultipliersField() { return *GetNativePointerField<TArray<FClassMultiplier>*>(this, "AShooterGameMode.TamedDinoClassDamageMultipliers"); }
-	//TArray<FClassMultiplier>& HarvestResourceItemAmountClassMultipliersField() { return *GetNativePointerField<TArray<FClassMultiplier>*>(this, "AShooterGameMode.HarvestResourceItemAmountClassMultipliers"); }
-//	TArray<FClassNameReplacement>& NPCReplacementsField() { return *GetNativePointerField<TArray<FClassNameReplacement>*>(this, "AShooterGameMode.NPCReplacements"); }
-	float& PvPZoneStructureDamageMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.PvPZoneStructureDamageMultiplier"); }
-	bool& bOnlyAllowSpecifiedEngramsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bOnlyAllowSpecifiedEngrams"); }
-	int& OverrideMaxExperiencePointsPlayerField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.OverrideMaxExperiencePointsPlayer"); }
-	int& OverrideMaxExperiencePointsDinoField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.OverrideMaxExperiencePointsDino"); }
-	float& GlobalSpoilingTimeMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.GlobalSpoilingTimeMultiplier"); }
-	float& GlobalItemDecompositionTimeMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.GlobalItemDecompositionTimeMultiplier"); }
-	float& GlobalCorpseDecompositionTimeMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.GlobalCorpseDecompositionTimeMultiplier"); }
-	float& MaxFallSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.MaxFallSpeedMultiplier"); }
-	bool& bAutoPvETimerField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAutoPvETimer"); }
-	bool& bAutoPvEUseSystemTimeField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAutoPvEUseSystemTime"); }
-	bool& bUsingStructureDestructionTagField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bUsingStructureDestructionTag"); }
-	FName& StructureDestructionTagField() { return *GetNativePointerField<FName*>(this, "AShooterGameMode.StructureDestructionTag"); }
-	float& AutoPvEStartTimeSecondsField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.AutoPvEStartTimeSeconds"); }
-	float& AutoPvEStopTimeSecondsField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.AutoPvEStopTimeSeconds"); }
-	int& TributeItemExpirationSecondsField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.TributeItemExpirationSeconds"); }
-	int& TributeDinoExpirationSecondsField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.TributeDinoExpirationSeconds"); }
-	int& TributeCharacterExpirationSecondsField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.TributeCharacterExpirationSeconds"); }
-	bool& PreventDownloadSurvivorsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.PreventDownloadSurvivors"); }
-	bool& PreventDownloadItemsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.PreventDownloadItems"); }
-	bool& PreventDownloadDinosField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.PreventDownloadDinos"); }
-	bool& bPreventUploadSurvivorsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bPreventUploadSurvivors"); }
-	bool& bPreventUploadItemsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bPreventUploadItems"); }
-	bool& bPreventUploadDinosField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bPreventUploadDinos"); }
-	int& MaxTributeItemsField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.MaxTributeItems"); }
-	int& MaxTributeDinosField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.MaxTributeDinos"); }
-	int& MaxTributeCharactersField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.MaxTributeCharacters"); }
-	bool& bIncreasePvPRespawnIntervalField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bIncreasePvPRespawnInterval"); }
-	float& IncreasePvPRespawnIntervalCheckPeriodField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.IncreasePvPRespawnIntervalCheckPeriod"); }
-	float& IncreasePvPRespawnIntervalMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.IncreasePvPRespawnIntervalMultiplier"); }
-	float& IncreasePvPRespawnIntervalBaseAmountField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.IncreasePvPRespawnIntervalBaseAmount"); }
-	float& ResourceNoReplenishRadiusStructuresField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.ResourceNoReplenishRadiusStructures"); }
-	float& ResourceNoReplenishRadiusPlayersField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.ResourceNoReplenishRadiusPlayers"); }
-	float& CropGrowthSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.CropGrowthSpeedMultiplier"); }
-	float& LayEggIntervalMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.LayEggIntervalMultiplier"); }
-	float& PoopIntervalMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.PoopIntervalMultiplier"); }
-	float& CropDecaySpeedMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.CropDecaySpeedMultiplier"); }
-	bool& bAllowChatFromDeadNonAdminsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowChatFromDeadNonAdmins"); }
-	bool& bAllowDisablingSpectatorField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowDisablingSpectator"); }
-	bool& bPvEDisableFriendlyFireField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bPvEDisableFriendlyFire"); }
-	bool& bFlyerPlatformAllowUnalignedDinoBasingField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bFlyerPlatformAllowUnalignedDinoBasing"); }
-	bool& bAllowUnclaimDinosField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowUnclaimDinos"); }
-	int& MaxPerTribePlatformSaddleStructureLimitField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.MaxPerTribePlatformSaddleStructureLimit"); }
-	int& MaxPlatformSaddleStructureLimitField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.MaxPlatformSaddleStructureLimit"); }
-	int& MaxDinoBaseLevelField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.MaxDinoBaseLevel"); }
-	int& MaxNumberOfPlayersInTribeField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.MaxNumberOfPlayersInTribe"); }
-	float& TribeSlotReuseCooldownField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.TribeSlotReuseCooldown"); }
-	float& MatingIntervalMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.MatingIntervalMultiplier"); }
-	float& EggHatchSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.EggHatchSpeedMultiplier"); }
-	float& BabyMatureSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.BabyMatureSpeedMultiplier"); }
-	float& BabyFoodConsumptionSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.BabyFoodConsumptionSpeedMultiplier"); }
-	int& CurrentPlatformSaddleStructuresField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.CurrentPlatformSaddleStructures"); }
+	int& LastRepopulationIndexToCheckField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.LastRepopulationIndexToCheck")>(this, "AShooterGameMode.LastRepopulationIndexToCheck"); }
+	FString& AlarmNotificationKeyField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameMode.AlarmNotificationKey")>(this, "AShooterGameMode.AlarmNotificationKey"); }
+	FString& AlarmNotificationURLField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameMode.AlarmNotificationURL")>(this, "AShooterGameMode.AlarmNotificationURL"); }
+	FString& BanFileNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameMode.BanFileName")>(this, "AShooterGameMode.BanFileName"); }
+	TMap<FString, FString, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, FString, 0> >& BannedMapField() { return *GetNativePointerField<TMap<FString, FString, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, FString, 0> >*, API::FieldNameHash("AShooterGameMode.BannedMap")>(this, "AShooterGameMode.BannedMap"); }
+	long double& LastTimeCheckedForSaveBackupField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterGameMode.LastTimeCheckedForSaveBackup")>(this, "AShooterGameMode.LastTimeCheckedForSaveBackup"); }
+	int& LastDayOfYearBackedUpField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.LastDayOfYearBackedUp")>(this, "AShooterGameMode.LastDayOfYearBackedUp"); }
+	long double& TimeLastStartedDoingRemoteBackupField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterGameMode.TimeLastStartedDoingRemoteBackup")>(this, "AShooterGameMode.TimeLastStartedDoingRemoteBackup"); }
+	bool& InitiatedArkTributeAvailabilityCheckField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.InitiatedArkTributeAvailabilityCheck")>(this, "AShooterGameMode.InitiatedArkTributeAvailabilityCheck"); }
+	URCONServer * RCONSocketField() { return *GetNativePointerField<URCONServer **, API::FieldNameHash("AShooterGameMode.RCONSocket")>(this, "AShooterGameMode.RCONSocket"); }
+	FString& PlayersJoinNoCheckFilenameField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameMode.PlayersJoinNoCheckFilename")>(this, "AShooterGameMode.PlayersJoinNoCheckFilename"); }
+	FString& PlayersExclusiveCheckFilenameField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameMode.PlayersExclusiveCheckFilename")>(this, "AShooterGameMode.PlayersExclusiveCheckFilename"); }
+	int& TerrainGeneratorVersionField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.TerrainGeneratorVersion")>(this, "AShooterGameMode.TerrainGeneratorVersion"); }
+	TArray<FUniqueNetIdUInt64>& PlayersJoinNoCheckField() { return *GetNativePointerField<TArray<FUniqueNetIdUInt64>*, API::FieldNameHash("AShooterGameMode.PlayersJoinNoCheck")>(this, "AShooterGameMode.PlayersJoinNoCheck"); }
+	TArray<FUniqueNetIdUInt64>& PlayersExclusiveListField() { return *GetNativePointerField<TArray<FUniqueNetIdUInt64>*, API::FieldNameHash("AShooterGameMode.PlayersExclusiveList")>(this, "AShooterGameMode.PlayersExclusiveList"); }
+	void * GameBackupPipeReadField() { return *GetNativePointerField<void **, API::FieldNameHash("AShooterGameMode.GameBackupPipeRead")>(this, "AShooterGameMode.GameBackupPipeRead"); }
+	void * GameBackupPipeWriteField() { return *GetNativePointerField<void **, API::FieldNameHash("AShooterGameMode.GameBackupPipeWrite")>(this, "AShooterGameMode.GameBackupPipeWrite"); }
+	TSet<unsigned int, DefaultKeyFuncs<unsigned int, 0>, FDefaultSetAllocator>& TribesIdsField() { return *GetNativePointerField<TSet<unsigned int, DefaultKeyFuncs<unsigned int, 0>, FDefaultSetAllocator>*, API::FieldNameHash("AShooterGameMode.TribesIds")>(this, "AShooterGameMode.TribesIds"); }
+	TMap<int, unsigned __int64, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, unsigned __int64, 0> >& PlayersIdsField() { return *GetNativePointerField<TMap<int, unsigned __int64, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, unsigned __int64, 0> >*, API::FieldNameHash("AShooterGameMode.PlayersIds")>(this, "AShooterGameMode.PlayersIds"); }
+	TMap<unsigned __int64, int, FDefaultSetAllocator, TDefaultMapKeyFuncs<unsigned __int64, int, 0> >& SteamIdsField() { return *GetNativePointerField<TMap<unsigned __int64, int, FDefaultSetAllocator, TDefaultMapKeyFuncs<unsigned __int64, int, 0> >*, API::FieldNameHash("AShooterGameMode.SteamIds")>(this, "AShooterGameMode.SteamIds"); }
+	FString& LaunchOptionsField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameMode.LaunchOptions")>(this, "AShooterGameMode.LaunchOptions"); }
+	TArray<FTribeData>& TribesDataField() { return *GetNativePointerField<TArray<FTribeData>*, API::FieldNameHash("AShooterGameMode.TribesData")>(this, "AShooterGameMode.TribesData"); }
+	FString& PGMapNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameMode.PGMapName")>(this, "AShooterGameMode.PGMapName"); }
+	FString& PGTerrainPropertiesStringField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameMode.PGTerrainPropertiesString")>(this, "AShooterGameMode.PGTerrainPropertiesString"); }
+	TMap<FString, FString, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, FString, 0> >& PGTerrainPropertiesField() { return *GetNativePointerField<TMap<FString, FString, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, FString, 0> >*, API::FieldNameHash("AShooterGameMode.PGTerrainProperties")>(this, "AShooterGameMode.PGTerrainProperties"); }
+	bool& bAutoCreateNewPlayerDataField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAutoCreateNewPlayerData")>(this, "AShooterGameMode.bAutoCreateNewPlayerData"); }
+	bool& bIsRestartingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bIsRestarting")>(this, "AShooterGameMode.bIsRestarting"); }
+	bool& bProximityVoiceChatField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bProximityVoiceChat")>(this, "AShooterGameMode.bProximityVoiceChat"); }
+	bool& bProximityChatField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bProximityChat")>(this, "AShooterGameMode.bProximityChat"); }
+	bool& bAutoRestoreBackupsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAutoRestoreBackups")>(this, "AShooterGameMode.bAutoRestoreBackups"); }
+	float& DifficultyValueField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.DifficultyValue")>(this, "AShooterGameMode.DifficultyValue"); }
+	float& DifficultyValueMinField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.DifficultyValueMin")>(this, "AShooterGameMode.DifficultyValueMin"); }
+	float& DifficultyValueMaxField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.DifficultyValueMax")>(this, "AShooterGameMode.DifficultyValueMax"); }
+	float& ProximityRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.ProximityRadius")>(this, "AShooterGameMode.ProximityRadius"); }
+	float& ProximityRadiusUnconsiousScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.ProximityRadiusUnconsiousScale")>(this, "AShooterGameMode.ProximityRadiusUnconsiousScale"); }
+	TSubclassOf<UCheatManager>& CheatClassField() { return *GetNativePointerField<TSubclassOf<UCheatManager>*, API::FieldNameHash("AShooterGameMode.CheatClass")>(this, "AShooterGameMode.CheatClass"); }
+	bool& bIsOfficialServerField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bIsOfficialServer")>(this, "AShooterGameMode.bIsOfficialServer"); }
+	bool& bServerAllowArkDownloadField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bServerAllowArkDownload")>(this, "AShooterGameMode.bServerAllowArkDownload"); }
+	bool& bServerAllowThirdPersonPlayerField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bServerAllowThirdPersonPlayer")>(this, "AShooterGameMode.bServerAllowThirdPersonPlayer"); }
+	bool& bUseExclusiveListField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bUseExclusiveList")>(this, "AShooterGameMode.bUseExclusiveList"); }
+	bool& bAlwaysNotifyPlayerLeftField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAlwaysNotifyPlayerLeft")>(this, "AShooterGameMode.bAlwaysNotifyPlayerLeft"); }
+	bool& bAlwaysNotifyPlayerJoinedField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAlwaysNotifyPlayerJoined")>(this, "AShooterGameMode.bAlwaysNotifyPlayerJoined"); }
+	bool& bServerHardcoreField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bServerHardcore")>(this, "AShooterGameMode.bServerHardcore"); }
+	bool& bServerPVEField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bServerPVE")>(this, "AShooterGameMode.bServerPVE"); }
+	bool& bServerCrosshairField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bServerCrosshair")>(this, "AShooterGameMode.bServerCrosshair"); }
+	bool& bServerForceNoHUDField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bServerForceNoHUD")>(this, "AShooterGameMode.bServerForceNoHUD"); }
+	bool& bMapPlayerLocationField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bMapPlayerLocation")>(this, "AShooterGameMode.bMapPlayerLocation"); }
+	bool& bAllowFlyerCarryPvEField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowFlyerCarryPvE")>(this, "AShooterGameMode.bAllowFlyerCarryPvE"); }
+	bool& bDisableStructureDecayPvEField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bDisableStructureDecayPvE")>(this, "AShooterGameMode.bDisableStructureDecayPvE"); }
+	bool& bDisableDinoDecayPvEField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bDisableDinoDecayPvE")>(this, "AShooterGameMode.bDisableDinoDecayPvE"); }
+	bool& bEnablePvPGammaField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bEnablePvPGamma")>(this, "AShooterGameMode.bEnablePvPGamma"); }
+	bool& bDisablePvEGammaField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bDisablePvEGamma")>(this, "AShooterGameMode.bDisablePvEGamma"); }
+	bool& bClampResourceHarvestDamageField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bClampResourceHarvestDamage")>(this, "AShooterGameMode.bClampResourceHarvestDamage"); }
+	bool& bPreventStructurePaintingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bPreventStructurePainting")>(this, "AShooterGameMode.bPreventStructurePainting"); }
+	bool& bAllowCaveBuildingPvEField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowCaveBuildingPvE")>(this, "AShooterGameMode.bAllowCaveBuildingPvE"); }
+	bool& bAdminLoggingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAdminLogging")>(this, "AShooterGameMode.bAdminLogging"); }
+	bool& bPvPStructureDecayField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bPvPStructureDecay")>(this, "AShooterGameMode.bPvPStructureDecay"); }
+	bool& bAutoDestroyStructuresField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAutoDestroyStructures")>(this, "AShooterGameMode.bAutoDestroyStructures"); }
+	bool& bForceAllStructureLockingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bForceAllStructureLocking")>(this, "AShooterGameMode.bForceAllStructureLocking"); }
+	bool& bAllowDeprecatedStructuresField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowDeprecatedStructures")>(this, "AShooterGameMode.bAllowDeprecatedStructures"); }
+	bool& bPreventTribeAlliancesField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bPreventTribeAlliances")>(this, "AShooterGameMode.bPreventTribeAlliances"); }
+	bool& bAllowHitMarkersField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowHitMarkers")>(this, "AShooterGameMode.bAllowHitMarkers"); }
+	bool& bOnlyAutoDestroyCoreStructuresField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bOnlyAutoDestroyCoreStructures")>(this, "AShooterGameMode.bOnlyAutoDestroyCoreStructures"); }
+	bool& bPreventMateBoostField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bPreventMateBoost")>(this, "AShooterGameMode.bPreventMateBoost"); }
+	bool& bTribeLogDestroyedEnemyStructuresField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bTribeLogDestroyedEnemyStructures")>(this, "AShooterGameMode.bTribeLogDestroyedEnemyStructures"); }
+	bool& bPvEAllowStructuresAtSupplyDropsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bPvEAllowStructuresAtSupplyDrops")>(this, "AShooterGameMode.bPvEAllowStructuresAtSupplyDrops"); }
+	bool& bServerGameLogIncludeTribeLogsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bServerGameLogIncludeTribeLogs")>(this, "AShooterGameMode.bServerGameLogIncludeTribeLogs"); }
+	bool& bServerRCONOutputTribeLogsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bServerRCONOutputTribeLogs")>(this, "AShooterGameMode.bServerRCONOutputTribeLogs"); }
+	bool& bUseOptimizedHarvestingHealthField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bUseOptimizedHarvestingHealth")>(this, "AShooterGameMode.bUseOptimizedHarvestingHealth"); }
+	bool& bClampItemSpoilingTimesField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bClampItemSpoilingTimes")>(this, "AShooterGameMode.bClampItemSpoilingTimes"); }
+	bool& bClampItemStatsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bClampItemStats")>(this, "AShooterGameMode.bClampItemStats"); }
+	bool& bAutoDestroyDecayedDinosField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAutoDestroyDecayedDinos")>(this, "AShooterGameMode.bAutoDestroyDecayedDinos"); }
+	bool& bAllowMultipleAttachedC4Field() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowMultipleAttachedC4")>(this, "AShooterGameMode.bAllowMultipleAttachedC4"); }
+	bool& bAllowFlyingStaminaRecoveryField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowFlyingStaminaRecovery")>(this, "AShooterGameMode.bAllowFlyingStaminaRecovery"); }
+	bool& bCrossARKAllowForeignDinoDownloadsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bCrossARKAllowForeignDinoDownloads")>(this, "AShooterGameMode.bCrossARKAllowForeignDinoDownloads"); }
+	bool& bPreventSpawnAnimationsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bPreventSpawnAnimations")>(this, "AShooterGameMode.bPreventSpawnAnimations"); }
+	bool& bIsLegacyServerField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bIsLegacyServer")>(this, "AShooterGameMode.bIsLegacyServer"); }
+	bool& bIdlePlayerKickAllowedField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bIdlePlayerKickAllowed")>(this, "AShooterGameMode.bIdlePlayerKickAllowed"); }
+	int& TheMaxStructuresInRangeField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.TheMaxStructuresInRange")>(this, "AShooterGameMode.TheMaxStructuresInRange"); }
+	int& MaxStructuresInSmallRadiusField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.MaxStructuresInSmallRadius")>(this, "AShooterGameMode.MaxStructuresInSmallRadius"); }
+	int& RCONPortField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.RCONPort")>(this, "AShooterGameMode.RCONPort"); }
+	float& DayCycleSpeedScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.DayCycleSpeedScale")>(this, "AShooterGameMode.DayCycleSpeedScale"); }
+	float& NightTimeSpeedScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.NightTimeSpeedScale")>(this, "AShooterGameMode.NightTimeSpeedScale"); }
+	float& DayTimeSpeedScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.DayTimeSpeedScale")>(this, "AShooterGameMode.DayTimeSpeedScale"); }
+	float& PvEStructureDecayPeriodMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.PvEStructureDecayPeriodMultiplier")>(this, "AShooterGameMode.PvEStructureDecayPeriodMultiplier"); }
+	float& StructurePreventResourceRadiusMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.StructurePreventResourceRadiusMultiplier")>(this, "AShooterGameMode.StructurePreventResourceRadiusMultiplier"); }
+	float& PvEDinoDecayPeriodMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.PvEDinoDecayPeriodMultiplier")>(this, "AShooterGameMode.PvEDinoDecayPeriodMultiplier"); }
+	float& ResourcesRespawnPeriodMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.ResourcesRespawnPeriodMultiplier")>(this, "AShooterGameMode.ResourcesRespawnPeriodMultiplier"); }
+	float& MaxTamedDinosField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.MaxTamedDinos")>(this, "AShooterGameMode.MaxTamedDinos"); }
+	float& ListenServerTetherDistanceMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.ListenServerTetherDistanceMultiplier")>(this, "AShooterGameMode.ListenServerTetherDistanceMultiplier"); }
+	float& PerPlatformMaxStructuresMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.PerPlatformMaxStructuresMultiplier")>(this, "AShooterGameMode.PerPlatformMaxStructuresMultiplier"); }
+	float& AutoDestroyOldStructuresMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.AutoDestroyOldStructuresMultiplier")>(this, "AShooterGameMode.AutoDestroyOldStructuresMultiplier"); }
+	float& RCONServerGameLogBufferField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.RCONServerGameLogBuffer")>(this, "AShooterGameMode.RCONServerGameLogBuffer"); }
+	float& OxygenSwimSpeedStatMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.OxygenSwimSpeedStatMultiplier")>(this, "AShooterGameMode.OxygenSwimSpeedStatMultiplier"); }
+	float& ServerAutoForceRespawnWildDinosIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.ServerAutoForceRespawnWildDinosInterval")>(this, "AShooterGameMode.ServerAutoForceRespawnWildDinosInterval"); }
+	float& RadiusStructuresInSmallRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.RadiusStructuresInSmallRadius")>(this, "AShooterGameMode.RadiusStructuresInSmallRadius"); }
+	float& EnableAFKKickPlayerCountPercentField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.EnableAFKKickPlayerCountPercent")>(this, "AShooterGameMode.EnableAFKKickPlayerCountPercent"); }
+	float& KickIdlePlayersPeriodField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.KickIdlePlayersPeriod")>(this, "AShooterGameMode.KickIdlePlayersPeriod"); }
+	float& MateBoostEffectMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.MateBoostEffectMultiplier")>(this, "AShooterGameMode.MateBoostEffectMultiplier"); }
+	float& AutoSavePeriodMinutesField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.AutoSavePeriodMinutes")>(this, "AShooterGameMode.AutoSavePeriodMinutes"); }
+	float& XPMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.XPMultiplier")>(this, "AShooterGameMode.XPMultiplier"); }
+	FName& ActiveEventField() { return *GetNativePointerField<FName*, API::FieldNameHash("AShooterGameMode.ActiveEvent")>(this, "AShooterGameMode.ActiveEvent"); }
+	float& TribeNameChangeCooldownField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.TribeNameChangeCooldown")>(this, "AShooterGameMode.TribeNameChangeCooldown"); }
+	bool& bAllowHideDamageSourceFromLogsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowHideDamageSourceFromLogs")>(this, "AShooterGameMode.bAllowHideDamageSourceFromLogs"); }
+	float& KillXPMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.KillXPMultiplier")>(this, "AShooterGameMode.KillXPMultiplier"); }
+	float& HarvestXPMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.HarvestXPMultiplier")>(this, "AShooterGameMode.HarvestXPMultiplier"); }
+	float& CraftXPMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.CraftXPMultiplier")>(this, "AShooterGameMode.CraftXPMultiplier"); }
+	float& GenericXPMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.GenericXPMultiplier")>(this, "AShooterGameMode.GenericXPMultiplier"); }
+	float& SpecialXPMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.SpecialXPMultiplier")>(this, "AShooterGameMode.SpecialXPMultiplier"); }
+	float& RandomAutoSaveSpreadField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.RandomAutoSaveSpread")>(this, "AShooterGameMode.RandomAutoSaveSpread"); }
+	FString& SteamAPIKeyField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameMode.SteamAPIKey")>(this, "AShooterGameMode.SteamAPIKey"); }
+	FString& LastServerNotificationMessageField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameMode.LastServerNotificationMessage")>(this, "AShooterGameMode.LastServerNotificationMessage"); }
+	long double& LastServerNotificationRecievedAtField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterGameMode.LastServerNotificationRecievedAt")>(this, "AShooterGameMode.LastServerNotificationRecievedAt"); }
+	long double& LastExecSaveTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterGameMode.LastExecSaveTime")>(this, "AShooterGameMode.LastExecSaveTime"); }
+	long double& LastTimeSavedWorldField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterGameMode.LastTimeSavedWorld")>(this, "AShooterGameMode.LastTimeSavedWorld"); }
+	FString& LastClaimedGameCodeField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameMode.LastClaimedGameCode")>(this, "AShooterGameMode.LastClaimedGameCode"); }
+	TArray<FString>& ArkGameCodesField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("AShooterGameMode.ArkGameCodes")>(this, "AShooterGameMode.ArkGameCodes"); }
+	bool& bIsCurrentlyRequestingKeyField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bIsCurrentlyRequestingKey")>(this, "AShooterGameMode.bIsCurrentlyRequestingKey"); }
+	FString& SaveDirectoryNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameMode.SaveDirectoryName")>(this, "AShooterGameMode.SaveDirectoryName"); }
+	TArray<UPrimalPlayerData *> PlayerDatasField() { return *GetNativePointerField<TArray<UPrimalPlayerData *>*, API::FieldNameHash("AShooterGameMode.PlayerDatas")>(this, "AShooterGameMode.PlayerDatas"); }
+	int& NPCZoneManagerModField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.NPCZoneManagerMod")>(this, "AShooterGameMode.NPCZoneManagerMod"); }
+	bool& bPopulatingSpawnZonesField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bPopulatingSpawnZones")>(this, "AShooterGameMode.bPopulatingSpawnZones"); }
+	bool& bRestartedAPlayerField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bRestartedAPlayer")>(this, "AShooterGameMode.bRestartedAPlayer"); }
+	bool& bForceRespawnDinosField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bForceRespawnDinos")>(this, "AShooterGameMode.bForceRespawnDinos"); }
+	bool& bFirstSaveWorldField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bFirstSaveWorld")>(this, "AShooterGameMode.bFirstSaveWorld"); }
+	bool& bAllowRaidDinoFeedingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowRaidDinoFeeding")>(this, "AShooterGameMode.bAllowRaidDinoFeeding"); }
+	FDateTime& LastBackupTimeField() { return *GetNativePointerField<FDateTime*, API::FieldNameHash("AShooterGameMode.LastBackupTime")>(this, "AShooterGameMode.LastBackupTime"); }
+	FDateTime& LastSaveWorldTimeField() { return *GetNativePointerField<FDateTime*, API::FieldNameHash("AShooterGameMode.LastSaveWorldTime")>(this, "AShooterGameMode.LastSaveWorldTime"); }
+	float& TamedDinoDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.TamedDinoDamageMultiplier")>(this, "AShooterGameMode.TamedDinoDamageMultiplier"); }
+	float& DinoDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.DinoDamageMultiplier")>(this, "AShooterGameMode.DinoDamageMultiplier"); }
+	float& PlayerDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.PlayerDamageMultiplier")>(this, "AShooterGameMode.PlayerDamageMultiplier"); }
+	float& StructureDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.StructureDamageMultiplier")>(this, "AShooterGameMode.StructureDamageMultiplier"); }
+	float& PlayerResistanceMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.PlayerResistanceMultiplier")>(this, "AShooterGameMode.PlayerResistanceMultiplier"); }
+	float& DinoResistanceMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.DinoResistanceMultiplier")>(this, "AShooterGameMode.DinoResistanceMultiplier"); }
+	float& TamedDinoResistanceMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.TamedDinoResistanceMultiplier")>(this, "AShooterGameMode.TamedDinoResistanceMultiplier"); }
+	float& StructureResistanceMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.StructureResistanceMultiplier")>(this, "AShooterGameMode.StructureResistanceMultiplier"); }
+	bool& bJoinInProgressGamesAsSpectatorField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bJoinInProgressGamesAsSpectator")>(this, "AShooterGameMode.bJoinInProgressGamesAsSpectator"); }
+	float& TamingSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.TamingSpeedMultiplier")>(this, "AShooterGameMode.TamingSpeedMultiplier"); }
+	float& HarvestAmountMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.HarvestAmountMultiplier")>(this, "AShooterGameMode.HarvestAmountMultiplier"); }
+	float& HarvestHealthMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.HarvestHealthMultiplier")>(this, "AShooterGameMode.HarvestHealthMultiplier"); }
+	float& PlayerCharacterWaterDrainMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.PlayerCharacterWaterDrainMultiplier")>(this, "AShooterGameMode.PlayerCharacterWaterDrainMultiplier"); }
+	float& PlayerCharacterFoodDrainMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.PlayerCharacterFoodDrainMultiplier")>(this, "AShooterGameMode.PlayerCharacterFoodDrainMultiplier"); }
+	float& DinoCharacterFoodDrainMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.DinoCharacterFoodDrainMultiplier")>(this, "AShooterGameMode.DinoCharacterFoodDrainMultiplier"); }
+	float& RaidDinoCharacterFoodDrainMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.RaidDinoCharacterFoodDrainMultiplier")>(this, "AShooterGameMode.RaidDinoCharacterFoodDrainMultiplier"); }
+	float& PlayerCharacterStaminaDrainMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.PlayerCharacterStaminaDrainMultiplier")>(this, "AShooterGameMode.PlayerCharacterStaminaDrainMultiplier"); }
+	float& DinoCharacterStaminaDrainMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.DinoCharacterStaminaDrainMultiplier")>(this, "AShooterGameMode.DinoCharacterStaminaDrainMultiplier"); }
+	float& PlayerCharacterHealthRecoveryMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.PlayerCharacterHealthRecoveryMultiplier")>(this, "AShooterGameMode.PlayerCharacterHealthRecoveryMultiplier"); }
+	float& DinoCharacterHealthRecoveryMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.DinoCharacterHealthRecoveryMultiplier")>(this, "AShooterGameMode.DinoCharacterHealthRecoveryMultiplier"); }
+	float& CarnivoreNaturalTargetingRangeMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.CarnivoreNaturalTargetingRangeMultiplier")>(this, "AShooterGameMode.CarnivoreNaturalTargetingRangeMultiplier"); }
+	float& CarnivorePlayerAggroMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.CarnivorePlayerAggroMultiplier")>(this, "AShooterGameMode.CarnivorePlayerAggroMultiplier"); }
+	float& HerbivoreNaturalTargetingRangeMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.HerbivoreNaturalTargetingRangeMultiplier")>(this, "AShooterGameMode.HerbivoreNaturalTargetingRangeMultiplier"); }
+	float& HerbivorePlayerAggroMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.HerbivorePlayerAggroMultiplier")>(this, "AShooterGameMode.HerbivorePlayerAggroMultiplier"); }
+	bool& AIForceTargetPlayersField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.AIForceTargetPlayers")>(this, "AShooterGameMode.AIForceTargetPlayers"); }
+	bool& AIForceOverlapCheckField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.AIForceOverlapCheck")>(this, "AShooterGameMode.AIForceOverlapCheck"); }
+	float& DinoCountMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.DinoCountMultiplier")>(this, "AShooterGameMode.DinoCountMultiplier"); }
+	bool& bDisableSaveLoadField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bDisableSaveLoad")>(this, "AShooterGameMode.bDisableSaveLoad"); }
+	bool& bDisableXPField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bDisableXP")>(this, "AShooterGameMode.bDisableXP"); }
+	bool& bDisableDynamicMusicField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bDisableDynamicMusic")>(this, "AShooterGameMode.bDisableDynamicMusic"); }
+	TArray<FPlayerDeathReason>& PlayerDeathReasonsField() { return *GetNativePointerField<TArray<FPlayerDeathReason>*, API::FieldNameHash("AShooterGameMode.PlayerDeathReasons")>(this, "AShooterGameMode.PlayerDeathReasons"); }
+	TArray<FLevelExperienceRamp>& LevelExperienceRampOverridesField() { return *GetNativePointerField<TArray<FLevelExperienceRamp>*, API::FieldNameHash("AShooterGameMode.LevelExperienceRampOverrides")>(this, "AShooterGameMode.LevelExperienceRampOverrides"); }
+	TArray<int>& OverridePlayerLevelEngramPointsField() { return *GetNativePointerField<TArray<int>*, API::FieldNameHash("AShooterGameMode.OverridePlayerLevelEngramPoints")>(this, "AShooterGameMode.OverridePlayerLevelEngramPoints"); }
+	TArray<int>& ExcludeItemIndicesField() { return *GetNativePointerField<TArray<int>*, API::FieldNameHash("AShooterGameMode.ExcludeItemIndices")>(this, "AShooterGameMode.ExcludeItemIndices"); }
+	//TArray<FEngramEntryOverride>& OverrideEngramEntriesField() { return *GetNativePointerField<TArray<FEngramEntryOverride>*, API::FieldNameHash("AShooterGameMode.OverrideEngramEntries")>(this, "AShooterGameMode.OverrideEngramEntries"); }
+	//TArray<FEngramEntryOverride>& OverrideNamedEngramEntriesField() { return *GetNativePointerField<TArray<FEngramEntryOverride>*, API::FieldNameHash("AShooterGameMode.OverrideNamedEngramEntries")>(this, "AShooterGameMode.OverrideNamedEngramEntries"); }
+	TArray<FEngramEntryAutoUnlock>& EngramEntryAutoUnlocksField() { return *GetNativePointerField<TArray<FEngramEntryAutoUnlock>*, API::FieldNameHash("AShooterGameMode.EngramEntryAutoUnlocks")>(this, "AShooterGameMode.EngramEntryAutoUnlocks"); }
+	TArray<FString>& PreventDinoTameClassNamesField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("AShooterGameMode.PreventDinoTameClassNames")>(this, "AShooterGameMode.PreventDinoTameClassNames"); }
+	//TArray<FDinoSpawnWeightMultiplier>& DinoSpawnWeightMultipliersField() { return *GetNativePointerField<TArray<FDinoSpawnWeightMultiplier>*, API::FieldNameHash("AShooterGameMode.DinoSpawnWeightMultipliers")>(this, "AShooterGameMode.DinoSpawnWeightMultipliers"); }
+	//TArray<FClassMultiplier>& DinoClassResistanceMultipliersField() { return *GetNativePointerField<TArray<FClassMultiplier>*, API::FieldNameHash("AShooterGameMode.DinoClassResistanceMultipliers")>(this, "AShooterGameMode.DinoClassResistanceMultipliers"); }
+	//TArray<FClassMultiplier>& TamedDinoClassResistanceMultipliersField() { return *GetNativePointerField<TArray<FClassMultiplier>*, API::FieldNameHash("AShooterGameMode.TamedDinoClassResistanceMultipliers")>(this, "AShooterGameMode.TamedDinoClassResistanceMultipliers"); }
+	//TArray<FClassMultiplier>& DinoClassDamageMultipliersField() { return *GetNativePointerField<TArray<FClassMultiplier>*, API::FieldNameHash("AShooterGameMode.DinoClassDamageMultipliers")>(this, "AShooterGameMode.DinoClassDamageMultipliers"); }
+	//TArray<FClassMultiplier>& TamedDinoClassDamageMultipliersField() { return *GetNativePointerField<TArray<FClassMultiplier>*, API::FieldNameHash("AShooterGameMode.TamedDinoClassDamageMultipliers")>(this, "AShooterGameMode.TamedDinoClassDamageMultipliers"); }
+	//TArray<FClassMultiplier>& HarvestResourceItemAmountClassMultipliersField() { return *GetNativePointerField<TArray<FClassMultiplier>*, API::FieldNameHash("AShooterGameMode.HarvestResourceItemAmountClassMultipliers")>(this, "AShooterGameMode.HarvestResourceItemAmountClassMultipliers"); }
+//	TArray<FClassNameReplacement>& NPCReplacementsField() { return *GetNativePointerField<TArray<FClassNameReplacement>*, API::FieldNameHash("AShooterGameMode.NPCReplacements")>(this, "AShooterGameMode.NPCReplacements"); }
+	float& PvPZoneStructureDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.PvPZoneStructureDamageMultiplier")>(this, "AShooterGameMode.PvPZoneStructureDamageMultiplier"); }
+	bool& bOnlyAllowSpecifiedEngramsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bOnlyAllowSpecifiedEngrams")>(this, "AShooterGameMode.bOnlyAllowSpecifiedEngrams"); }
+	int& OverrideMaxExperiencePointsPlayerField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.OverrideMaxExperiencePointsPlayer")>(this, "AShooterGameMode.OverrideMaxExperiencePointsPlayer"); }
+	int& OverrideMaxExperiencePointsDinoField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.OverrideMaxExperiencePointsDino")>(this, "AShooterGameMode.OverrideMaxExperiencePointsDino"); }
+	float& GlobalSpoilingTimeMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.GlobalSpoilingTimeMultiplier")>(this, "AShooterGameMode.GlobalSpoilingTimeMultiplier"); }
+	float& GlobalItemDecompositionTimeMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.GlobalItemDecompositionTimeMultiplier")>(this, "AShooterGameMode.GlobalItemDecompositionTimeMultiplier"); }
+	float& GlobalCorpseDecompositionTimeMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.GlobalCorpseDecompositionTimeMultiplier")>(this, "AShooterGameMode.GlobalCorpseDecompositionTimeMultiplier"); }
+	float& MaxFallSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.MaxFallSpeedMultiplier")>(this, "AShooterGameMode.MaxFallSpeedMultiplier"); }
+	bool& bAutoPvETimerField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAutoPvETimer")>(this, "AShooterGameMode.bAutoPvETimer"); }
+	bool& bAutoPvEUseSystemTimeField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAutoPvEUseSystemTime")>(this, "AShooterGameMode.bAutoPvEUseSystemTime"); }
+	bool& bUsingStructureDestructionTagField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bUsingStructureDestructionTag")>(this, "AShooterGameMode.bUsingStructureDestructionTag"); }
+	FName& StructureDestructionTagField() { return *GetNativePointerField<FName*, API::FieldNameHash("AShooterGameMode.StructureDestructionTag")>(this, "AShooterGameMode.StructureDestructionTag"); }
+	float& AutoPvEStartTimeSecondsField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.AutoPvEStartTimeSeconds")>(this, "AShooterGameMode.AutoPvEStartTimeSeconds"); }
+	float& AutoPvEStopTimeSecondsField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.AutoPvEStopTimeSeconds")>(this, "AShooterGameMode.AutoPvEStopTimeSeconds"); }
+	int& TributeItemExpirationSecondsField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.TributeItemExpirationSeconds")>(this, "AShooterGameMode.TributeItemExpirationSeconds"); }
+	int& TributeDinoExpirationSecondsField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.TributeDinoExpirationSeconds")>(this, "AShooterGameMode.TributeDinoExpirationSeconds"); }
+	int& TributeCharacterExpirationSecondsField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.TributeCharacterExpirationSeconds")>(this, "AShooterGameMode.TributeCharacterExpirationSeconds"); }
+	bool& PreventDownloadSurvivorsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.PreventDownloadSurvivors")>(this, "AShooterGameMode.PreventDownloadSurvivors"); }
+	bool& PreventDownloadItemsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.PreventDownloadItems")>(this, "AShooterGameMode.PreventDownloadItems"); }
+	bool& PreventDownloadDinosField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.PreventDownloadDinos")>(this, "AShooterGameMode.PreventDownloadDinos"); }
+	bool& bPreventUploadSurvivorsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bPreventUploadSurvivors")>(this, "AShooterGameMode.bPreventUploadSurvivors"); }
+	bool& bPreventUploadItemsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bPreventUploadItems")>(this, "AShooterGameMode.bPreventUploadItems"); }
+	bool& bPreventUploadDinosField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bPreventUploadDinos")>(this, "AShooterGameMode.bPreventUploadDinos"); }
+	int& MaxTributeItemsField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.MaxTributeItems")>(this, "AShooterGameMode.MaxTributeItems"); }
+	int& MaxTributeDinosField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.MaxTributeDinos")>(this, "AShooterGameMode.MaxTributeDinos"); }
+	int& MaxTributeCharactersField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.MaxTributeCharacters")>(this, "AShooterGameMode.MaxTributeCharacters"); }
+	bool& bIncreasePvPRespawnIntervalField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bIncreasePvPRespawnInterval")>(this, "AShooterGameMode.bIncreasePvPRespawnInterval"); }
+	float& IncreasePvPRespawnIntervalCheckPeriodField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.IncreasePvPRespawnIntervalCheckPeriod")>(this, "AShooterGameMode.IncreasePvPRespawnIntervalCheckPeriod"); }
+	float& IncreasePvPRespawnIntervalMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.IncreasePvPRespawnIntervalMultiplier")>(this, "AShooterGameMode.IncreasePvPRespawnIntervalMultiplier"); }
+	float& IncreasePvPRespawnIntervalBaseAmountField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.IncreasePvPRespawnIntervalBaseAmount")>(this, "AShooterGameMode.IncreasePvPRespawnIntervalBaseAmount"); }
+	float& ResourceNoReplenishRadiusStructuresField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.ResourceNoReplenishRadiusStructures")>(this, "AShooterGameMode.ResourceNoReplenishRadiusStructures"); }
+	float& ResourceNoReplenishRadiusPlayersField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.ResourceNoReplenishRadiusPlayers")>(this, "AShooterGameMode.ResourceNoReplenishRadiusPlayers"); }
+	float& CropGrowthSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.CropGrowthSpeedMultiplier")>(this, "AShooterGameMode.CropGrowthSpeedMultiplier"); }
+	float& LayEggIntervalMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.LayEggIntervalMultiplier")>(this, "AShooterGameMode.LayEggIntervalMultiplier"); }
+	float& PoopIntervalMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.PoopIntervalMultiplier")>(this, "AShooterGameMode.PoopIntervalMultiplier"); }
+	float& CropDecaySpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.CropDecaySpeedMultiplier")>(this, "AShooterGameMode.CropDecaySpeedMultiplier"); }
+	bool& bAllowChatFromDeadNonAdminsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowChatFromDeadNonAdmins")>(this, "AShooterGameMode.bAllowChatFromDeadNonAdmins"); }
+	bool& bAllowDisablingSpectatorField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowDisablingSpectator")>(this, "AShooterGameMode.bAllowDisablingSpectator"); }
+	bool& bPvEDisableFriendlyFireField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bPvEDisableFriendlyFire")>(this, "AShooterGameMode.bPvEDisableFriendlyFire"); }
+	bool& bFlyerPlatformAllowUnalignedDinoBasingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bFlyerPlatformAllowUnalignedDinoBasing")>(this, "AShooterGameMode.bFlyerPlatformAllowUnalignedDinoBasing"); }
+	bool& bAllowUnclaimDinosField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowUnclaimDinos")>(this, "AShooterGameMode.bAllowUnclaimDinos"); }
+	int& MaxPerTribePlatformSaddleStructureLimitField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.MaxPerTribePlatformSaddleStructureLimit")>(this, "AShooterGameMode.MaxPerTribePlatformSaddleStructureLimit"); }
+	int& MaxPlatformSaddleStructureLimitField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.MaxPlatformSaddleStructureLimit")>(this, "AShooterGameMode.MaxPlatformSaddleStructureLimit"); }
+	int& MaxDinoBaseLevelField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.MaxDinoBaseLevel")>(this, "AShooterGameMode.MaxDinoBaseLevel"); }
+	int& MaxNumberOfPlayersInTribeField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.MaxNumberOfPlayersInTribe")>(this, "AShooterGameMode.MaxNumberOfPlayersInTribe"); }
+	float& TribeSlotReuseCooldownField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.TribeSlotReuseCooldown")>(this, "AShooterGameMode.TribeSlotReuseCooldown"); }
+	float& MatingIntervalMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.MatingIntervalMultiplier")>(this, "AShooterGameMode.MatingIntervalMultiplier"); }
+	float& EggHatchSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.EggHatchSpeedMultiplier")>(this, "AShooterGameMode.EggHatchSpeedMultiplier"); }
+	float& BabyMatureSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.BabyMatureSpeedMultiplier")>(this, "AShooterGameMode.BabyMatureSpeedMultiplier"); }
+	float& BabyFoodConsumptionSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.BabyFoodConsumptionSpeedMultiplier")>(this, "AShooterGameMode.BabyFoodConsumptionSpeedMultiplier"); }
+	int& CurrentPlatformSaddleStructuresField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.CurrentPlatformSaddleStructures")>(this, "AShooterGameMode.CurrentPlatformSaddleStructures"); }
 	FieldArray<float, 12> PerLevelStatsMultiplier_PlayerField() { return { this, "AShooterGameMode.PerLevelStatsMultiplier_Player" }; }
 	FieldArray<float, 12> PerLevelStatsMultiplier_DinoTamedField() { return { this, "AShooterGameMode.PerLevelStatsMultiplier_DinoTamed" }; }
 	FieldArray<float, 12> PerLevelStatsMultiplier_DinoTamed_AddField() { return { this, "AShooterGameMode.PerLevelStatsMultiplier_DinoTamed_Add" }; }
 	FieldArray<float, 12> PerLevelStatsMultiplier_DinoTamed_AffinityField() { return { this, "AShooterGameMode.PerLevelStatsMultiplier_DinoTamed_Affinity" }; }
 	FieldArray<float, 12> PerLevelStatsMultiplier_DinoWildField() { return { this, "AShooterGameMode.PerLevelStatsMultiplier_DinoWild" }; }
 	FieldArray<int, 8> ItemStatClampsField() { return { this, "AShooterGameMode.ItemStatClamps" }; }
-	bool& bCustomGameModeAllowSpectatorJoinAfterMatchStartField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bCustomGameModeAllowSpectatorJoinAfterMatchStart"); }
-	bool& bGameplayLogEnabledField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bGameplayLogEnabled"); }
-	bool& bServerGameLogEnabledField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bServerGameLogEnabled"); }
-	TSubclassOf<UPrimalItem>& BonusSupplyCrateItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "AShooterGameMode.BonusSupplyCrateItemClass"); }
-	float& BonusSupplyCrateItemGiveIntervalField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.BonusSupplyCrateItemGiveInterval"); }
-	float& StructureDamageRepairCooldownField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.StructureDamageRepairCooldown"); }
-	float& CustomRecipeEffectivenessMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.CustomRecipeEffectivenessMultiplier"); }
-	float& CustomRecipeSkillMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.CustomRecipeSkillMultiplier"); }
-	FString& BonusSupplyCrateItemStringField() { return *GetNativePointerField<FString*>(this, "AShooterGameMode.BonusSupplyCrateItemString"); }
-	bool& bPvEAllowTribeWarField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bPvEAllowTribeWar"); }
-	bool& bPvEAllowTribeWarCancelField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bPvEAllowTribeWarCancel"); }
-	bool& bAllowCustomRecipesField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowCustomRecipes"); }
-	bool& bPassiveDefensesDamageRiderlessDinosField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bPassiveDefensesDamageRiderlessDinos"); }
-	long double& LastBonusSupplyCrateItemGiveTimeField() { return *GetNativePointerField<long double*>(this, "AShooterGameMode.LastBonusSupplyCrateItemGiveTime"); }
-	bool& bEnableDeathTeamSpectatorField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bEnableDeathTeamSpectator"); }
-	bool& bTribeStoreCharacterConfigurationField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bTribeStoreCharacterConfiguration"); }
-	TMap<int, TSet<int, DefaultKeyFuncs<int, 0>, FDefaultSetAllocator>, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, TSet<int, DefaultKeyFuncs<int, 0>, FDefaultSetAllocator>, 0> >& PvEActiveTribeWarsField() { return *GetNativePointerField<TMap<int, TSet<int, DefaultKeyFuncs<int, 0>, FDefaultSetAllocator>, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, TSet<int, DefaultKeyFuncs<int, 0>, FDefaultSetAllocator>, 0> >*>(this, "AShooterGameMode.PvEActiveTribeWars"); }
-	TMap<int, TSet<int, DefaultKeyFuncs<int, 0>, FDefaultSetAllocator>, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, TSet<int, DefaultKeyFuncs<int, 0>, FDefaultSetAllocator>, 0> >& TribeAlliesField() { return *GetNativePointerField<TMap<int, TSet<int, DefaultKeyFuncs<int, 0>, FDefaultSetAllocator>, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, TSet<int, DefaultKeyFuncs<int, 0>, FDefaultSetAllocator>, 0> >*>(this, "AShooterGameMode.TribeAllies"); }
-	TMap<unsigned __int64, UPrimalPlayerData *, FDefaultSetAllocator, TDefaultMapKeyFuncs<unsigned __int64, UPrimalPlayerData *, 0> > IDtoPlayerDatasField() { return *GetNativePointerField<TMap<unsigned __int64, UPrimalPlayerData *, FDefaultSetAllocator, TDefaultMapKeyFuncs<unsigned __int64, UPrimalPlayerData *, 0> >*>(this, "AShooterGameMode.IDtoPlayerDatas"); }
-	int& MaxTribeLogsField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.MaxTribeLogs"); }
-	int& MaxPersonalTamedDinosField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.MaxPersonalTamedDinos"); }
-	int& PersonalTamedDinosSaddleStructureCostField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.PersonalTamedDinosSaddleStructureCost"); }
-	TArray<FString>& CachedGameLogField() { return *GetNativePointerField<TArray<FString>*>(this, "AShooterGameMode.CachedGameLog"); }
-	bool& bDisableFriendlyFireField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bDisableFriendlyFire"); }
-	bool& bAllowInactiveTribesField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowInactiveTribes"); }
-	bool& bForceMapPlayerLocationField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bForceMapPlayerLocation"); }
-	float& DinoHarvestingDamageMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.DinoHarvestingDamageMultiplier"); }
-	float& PlayerHarvestingDamageMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.PlayerHarvestingDamageMultiplier"); }
-	float& DinoTurretDamageMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.DinoTurretDamageMultiplier"); }
-	bool& bDisableLootCratesField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bDisableLootCrates"); }
-	float& ExtinctionEventTimeIntervalField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.ExtinctionEventTimeInterval"); }
-	bool& bEnableExtraStructurePreventionVolumesField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bEnableExtraStructurePreventionVolumes"); }
-	unsigned int& NextExtinctionEventUTCField() { return *GetNativePointerField<unsigned int*>(this, "AShooterGameMode.NextExtinctionEventUTC"); }
-	bool& bForceAllowCaveFlyersField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bForceAllowCaveFlyers"); }
-	bool& bDoExtinctionEventField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bDoExtinctionEvent"); }
-	bool& bPreventOfflinePvPField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bPreventOfflinePvP"); }
-	bool& bPvPDinoDecayField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bPvPDinoDecay"); }
-	bool& bOverideStructurePlatformPreventionField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bOverideStructurePlatformPrevention"); }
-	bool& bAllowAnyoneBabyImprintCuddleField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowAnyoneBabyImprintCuddle"); }
-	bool& bDisableImprintDinoBuffField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bDisableImprintDinoBuff"); }
-	bool& bShowFloatingDamageTextField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bShowFloatingDamageText"); }
-	bool& bOnlyDecayUnsnappedCoreStructuresField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bOnlyDecayUnsnappedCoreStructures"); }
-	bool& bFastDecayUnsnappedCoreStructuresField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bFastDecayUnsnappedCoreStructures"); }
-	bool& bDestroyUnconnectedWaterPipesField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bDestroyUnconnectedWaterPipes"); }
-	bool& bAllowCrateSpawnsOnTopOfStructuresField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowCrateSpawnsOnTopOfStructures"); }
-	bool& bNotifyAdminCommandsInChatField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bNotifyAdminCommandsInChat"); }
-	bool& bRandomSupplyCratePointsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bRandomSupplyCratePoints"); }
-	float& PreventOfflinePvPIntervalField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.PreventOfflinePvPInterval"); }
-	//TArray<FItemCraftingCostOverride>& OverrideItemCraftingCostsField() { return *GetNativePointerField<TArray<FItemCraftingCostOverride>*>(this, "AShooterGameMode.OverrideItemCraftingCosts"); }
-	//TArray<FConfigItemCraftingCostOverride>& ConfigOverrideItemCraftingCostsField() { return *GetNativePointerField<TArray<FConfigItemCraftingCostOverride>*>(this, "AShooterGameMode.ConfigOverrideItemCraftingCosts"); }
-	//TArray<FConfigSupplyCrateItemsOverride>& ConfigOverrideSupplyCrateItemsField() { return *GetNativePointerField<TArray<FConfigSupplyCrateItemsOverride>*>(this, "AShooterGameMode.ConfigOverrideSupplyCrateItems"); }
-	//TArray<FConfigNPCSpawnEntriesContainer>& ConfigOverrideNPCSpawnEntriesContainerField() { return *GetNativePointerField<TArray<FConfigNPCSpawnEntriesContainer>*>(this, "AShooterGameMode.ConfigOverrideNPCSpawnEntriesContainer"); }
-	//TArray<FConfigNPCSpawnEntriesContainer>& ConfigAddNPCSpawnEntriesContainerField() { return *GetNativePointerField<TArray<FConfigNPCSpawnEntriesContainer>*>(this, "AShooterGameMode.ConfigAddNPCSpawnEntriesContainer"); }
-	//TArray<FConfigNPCSpawnEntriesContainer>& ConfigSubtractNPCSpawnEntriesContainerField() { return *GetNativePointerField<TArray<FConfigNPCSpawnEntriesContainer>*>(this, "AShooterGameMode.ConfigSubtractNPCSpawnEntriesContainer"); }
-	float& BabyImprintingStatScaleMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.BabyImprintingStatScaleMultiplier"); }
-	float& BabyCuddleIntervalMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.BabyCuddleIntervalMultiplier"); }
-	float& BabyCuddleGracePeriodMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.BabyCuddleGracePeriodMultiplier"); }
-	float& BabyCuddleLoseImprintQualitySpeedMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.BabyCuddleLoseImprintQualitySpeedMultiplier"); }
-	float& HairGrowthSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.HairGrowthSpeedMultiplier"); }
-	bool& bPreventDiseasesField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bPreventDiseases"); }
-	bool& bNonPermanentDiseasesField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bNonPermanentDiseases"); }
-	//UAllClustersInventory * AllClustersInventoryField() { return *GetNativePointerField<UAllClustersInventory **>(this, "AShooterGameMode.AllClustersInventory"); }
-	int& SaveForceRespawnDinosVersionField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.SaveForceRespawnDinosVersion"); }
-	unsigned __int64& ServerIDField() { return *GetNativePointerField<unsigned __int64*>(this, "AShooterGameMode.ServerID"); }
-	int& LoadForceRespawnDinosVersionField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.LoadForceRespawnDinosVersion"); }
-	bool& bIsLoadedServerField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bIsLoadedServer"); }
-	TArray<int>& SupportedSpawnRegionsField() { return *GetNativePointerField<TArray<int>*>(this, "AShooterGameMode.SupportedSpawnRegions"); }
-	bool& bServerUseDinoListField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bServerUseDinoList"); }
-	float& MaxAllowedRespawnIntervalField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.MaxAllowedRespawnInterval"); }
-	bool& bUseDinoLevelUpAnimationsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bUseDinoLevelUpAnimations"); }
-	bool& bDisableDinoTamingField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bDisableDinoTaming"); }
-	bool& bDisableDinoRidingField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bDisableDinoRiding"); }
-	float& MinimumDinoReuploadIntervalField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.MinimumDinoReuploadInterval"); }
-	int& SaveGameCustomVersionField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.SaveGameCustomVersion"); }
-	float& OverrideOfficialDifficultyField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.OverrideOfficialDifficulty"); }
+	bool& bCustomGameModeAllowSpectatorJoinAfterMatchStartField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bCustomGameModeAllowSpectatorJoinAfterMatchStart")>(this, "AShooterGameMode.bCustomGameModeAllowSpectatorJoinAfterMatchStart"); }
+	bool& bGameplayLogEnabledField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bGameplayLogEnabled")>(this, "AShooterGameMode.bGameplayLogEnabled"); }
+	bool& bServerGameLogEnabledField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bServerGameLogEnabled")>(this, "AShooterGameMode.bServerGameLogEnabled"); }
+	TSubclassOf<UPrimalItem>& BonusSupplyCrateItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("AShooterGameMode.BonusSupplyCrateItemClass")>(this, "AShooterGameMode.BonusSupplyCrateItemClass"); }
+	float& BonusSupplyCrateItemGiveIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.BonusSupplyCrateItemGiveInterval")>(this, "AShooterGameMode.BonusSupplyCrateItemGiveInterval"); }
+	float& StructureDamageRepairCooldownField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.StructureDamageRepairCooldown")>(this, "AShooterGameMode.StructureDamageRepairCooldown"); }
+	float& CustomRecipeEffectivenessMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.CustomRecipeEffectivenessMultiplier")>(this, "AShooterGameMode.CustomRecipeEffectivenessMultiplier"); }
+	float& CustomRecipeSkillMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.CustomRecipeSkillMultiplier")>(this, "AShooterGameMode.CustomRecipeSkillMultiplier"); }
+	FString& BonusSupplyCrateItemStringField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameMode.BonusSupplyCrateItemString")>(this, "AShooterGameMode.BonusSupplyCrateItemString"); }
+	bool& bPvEAllowTribeWarField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bPvEAllowTribeWar")>(this, "AShooterGameMode.bPvEAllowTribeWar"); }
+	bool& bPvEAllowTribeWarCancelField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bPvEAllowTribeWarCancel")>(this, "AShooterGameMode.bPvEAllowTribeWarCancel"); }
+	bool& bAllowCustomRecipesField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowCustomRecipes")>(this, "AShooterGameMode.bAllowCustomRecipes"); }
+	bool& bPassiveDefensesDamageRiderlessDinosField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bPassiveDefensesDamageRiderlessDinos")>(this, "AShooterGameMode.bPassiveDefensesDamageRiderlessDinos"); }
+	long double& LastBonusSupplyCrateItemGiveTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterGameMode.LastBonusSupplyCrateItemGiveTime")>(this, "AShooterGameMode.LastBonusSupplyCrateItemGiveTime"); }
+	bool& bEnableDeathTeamSpectatorField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bEnableDeathTeamSpectator")>(this, "AShooterGameMode.bEnableDeathTeamSpectator"); }
+	bool& bTribeStoreCharacterConfigurationField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bTribeStoreCharacterConfiguration")>(this, "AShooterGameMode.bTribeStoreCharacterConfiguration"); }
+	TMap<int, TSet<int, DefaultKeyFuncs<int, 0>, FDefaultSetAllocator>, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, TSet<int, DefaultKeyFuncs<int, 0>, FDefaultSetAllocator>, 0> >& PvEActiveTribeWarsField() { return *GetNativePointerField<TMap<int, TSet<int, DefaultKeyFuncs<int, 0>, FDefaultSetAllocator>, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, TSet<int, DefaultKeyFuncs<int, 0>, FDefaultSetAllocator>, 0> >*, API::FieldNameHash("AShooterGameMode.PvEActiveTribeWars")>(this, "AShooterGameMode.PvEActiveTribeWars"); }
+	TMap<int, TSet<int, DefaultKeyFuncs<int, 0>, FDefaultSetAllocator>, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, TSet<int, DefaultKeyFuncs<int, 0>, FDefaultSetAllocator>, 0> >& TribeAlliesField() { return *GetNativePointerField<TMap<int, TSet<int, DefaultKeyFuncs<int, 0>, FDefaultSetAllocator>, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, TSet<int, DefaultKeyFuncs<int, 0>, FDefaultSetAllocator>, 0> >*, API::FieldNameHash("AShooterGameMode.TribeAllies")>(this, "AShooterGameMode.TribeAllies"); }
+	TMap<unsigned __int64, UPrimalPlayerData *, FDefaultSetAllocator, TDefaultMapKeyFuncs<unsigned __int64, UPrimalPlayerData *, 0> > IDtoPlayerDatasField() { return *GetNativePointerField<TMap<unsigned __int64, UPrimalPlayerData *, FDefaultSetAllocator, TDefaultMapKeyFuncs<unsigned __int64, UPrimalPlayerData *, 0> >*, API::FieldNameHash("AShooterGameMode.IDtoPlayerDatas")>(this, "AShooterGameMode.IDtoPlayerDatas"); }
+	int& MaxTribeLogsField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.MaxTribeLogs")>(this, "AShooterGameMode.MaxTribeLogs"); }
+	int& MaxPersonalTamedDinosField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.MaxPersonalTamedDinos")>(this, "AShooterGameMode.MaxPersonalTamedDinos"); }
+	int& PersonalTamedDinosSaddleStructureCostField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.PersonalTamedDinosSaddleStructureCost")>(this, "AShooterGameMode.PersonalTamedDinosSaddleStructureCost"); }
+	TArray<FString>& CachedGameLogField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("AShooterGameMode.CachedGameLog")>(this, "AShooterGameMode.CachedGameLog"); }
+	bool& bDisableFriendlyFireField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bDisableFriendlyFire")>(this, "AShooterGameMode.bDisableFriendlyFire"); }
+	bool& bAllowInactiveTribesField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowInactiveTribes")>(this, "AShooterGameMode.bAllowInactiveTribes"); }
+	bool& bForceMapPlayerLocationField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bForceMapPlayerLocation")>(this, "AShooterGameMode.bForceMapPlayerLocation"); }
+	float& DinoHarvestingDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.DinoHarvestingDamageMultiplier")>(this, "AShooterGameMode.DinoHarvestingDamageMultiplier"); }
+	float& PlayerHarvestingDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.PlayerHarvestingDamageMultiplier")>(this, "AShooterGameMode.PlayerHarvestingDamageMultiplier"); }
+	float& DinoTurretDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.DinoTurretDamageMultiplier")>(this, "AShooterGameMode.DinoTurretDamageMultiplier"); }
+	bool& bDisableLootCratesField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bDisableLootCrates")>(this, "AShooterGameMode.bDisableLootCrates"); }
+	float& ExtinctionEventTimeIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.ExtinctionEventTimeInterval")>(this, "AShooterGameMode.ExtinctionEventTimeInterval"); }
+	bool& bEnableExtraStructurePreventionVolumesField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bEnableExtraStructurePreventionVolumes")>(this, "AShooterGameMode.bEnableExtraStructurePreventionVolumes"); }
+	unsigned int& NextExtinctionEventUTCField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("AShooterGameMode.NextExtinctionEventUTC")>(this, "AShooterGameMode.NextExtinctionEventUTC"); }
+	bool& bForceAllowCaveFlyersField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bForceAllowCaveFlyers")>(this, "AShooterGameMode.bForceAllowCaveFlyers"); }
+	bool& bDoExtinctionEventField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bDoExtinctionEvent")>(this, "AShooterGameMode.bDoExtinctionEvent"); }
+	bool& bPreventOfflinePvPField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bPreventOfflinePvP")>(this, "AShooterGameMode.bPreventOfflinePvP"); }
+	bool& bPvPDinoDecayField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bPvPDinoDecay")>(this, "AShooterGameMode.bPvPDinoDecay"); }
+	bool& bOverideStructurePlatformPreventionField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bOverideStructurePlatformPrevention")>(this, "AShooterGameMode.bOverideStructurePlatformPrevention"); }
+	bool& bAllowAnyoneBabyImprintCuddleField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowAnyoneBabyImprintCuddle")>(this, "AShooterGameMode.bAllowAnyoneBabyImprintCuddle"); }
+	bool& bDisableImprintDinoBuffField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bDisableImprintDinoBuff")>(this, "AShooterGameMode.bDisableImprintDinoBuff"); }
+	bool& bShowFloatingDamageTextField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bShowFloatingDamageText")>(this, "AShooterGameMode.bShowFloatingDamageText"); }
+	bool& bOnlyDecayUnsnappedCoreStructuresField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bOnlyDecayUnsnappedCoreStructures")>(this, "AShooterGameMode.bOnlyDecayUnsnappedCoreStructures"); }
+	bool& bFastDecayUnsnappedCoreStructuresField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bFastDecayUnsnappedCoreStructures")>(this, "AShooterGameMode.bFastDecayUnsnappedCoreStructures"); }
+	bool& bDestroyUnconnectedWaterPipesField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bDestroyUnconnectedWaterPipes")>(this, "AShooterGameMode.bDestroyUnconnectedWaterPipes"); }
+	bool& bAllowCrateSpawnsOnTopOfStructuresField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowCrateSpawnsOnTopOfStructures")>(this, "AShooterGameMode.bAllowCrateSpawnsOnTopOfStructures"); }
+	bool& bNotifyAdminCommandsInChatField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bNotifyAdminCommandsInChat")>(this, "AShooterGameMode.bNotifyAdminCommandsInChat"); }
+	bool& bRandomSupplyCratePointsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bRandomSupplyCratePoints")>(this, "AShooterGameMode.bRandomSupplyCratePoints"); }
+	float& PreventOfflinePvPIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.PreventOfflinePvPInterval")>(this, "AShooterGameMode.PreventOfflinePvPInterval"); }
+	//TArray<FItemCraftingCostOverride>& OverrideItemCraftingCostsField() { return *GetNativePointerField<TArray<FItemCraftingCostOverride>*, API::FieldNameHash("AShooterGameMode.OverrideItemCraftingCosts")>(this, "AShooterGameMode.OverrideItemCraftingCosts"); }
+	//TArray<FConfigItemCraftingCostOverride>& ConfigOverrideItemCraftingCostsField() { return *GetNativePointerField<TArray<FConfigItemCraftingCostOverride>*, API::FieldNameHash("AShooterGameMode.ConfigOverrideItemCraftingCosts")>(this, "AShooterGameMode.ConfigOverrideItemCraftingCosts"); }
+	//TArray<FConfigSupplyCrateItemsOverride>& ConfigOverrideSupplyCrateItemsField() { return *GetNativePointerField<TArray<FConfigSupplyCrateItemsOverride>*, API::FieldNameHash("AShooterGameMode.ConfigOverrideSupplyCrateItems")>(this, "AShooterGameMode.ConfigOverrideSupplyCrateItems"); }
+	//TArray<FConfigNPCSpawnEntriesContainer>& ConfigOverrideNPCSpawnEntriesContainerField() { return *GetNativePointerField<TArray<FConfigNPCSpawnEntriesContainer>*, API::FieldNameHash("AShooterGameMode.ConfigOverrideNPCSpawnEntriesContainer")>(this, "AShooterGameMode.ConfigOverrideNPCSpawnEntriesContainer"); }
+	//TArray<FConfigNPCSpawnEntriesContainer>& ConfigAddNPCSpawnEntriesContainerField() { return *GetNativePointerField<TArray<FConfigNPCSpawnEntriesContainer>*, API::FieldNameHash("AShooterGameMode.ConfigAddNPCSpawnEntriesContainer")>(this, "AShooterGameMode.ConfigAddNPCSpawnEntriesContainer"); }
+	//TArray<FConfigNPCSpawnEntriesContainer>& ConfigSubtractNPCSpawnEntriesContainerField() { return *GetNativePointerField<TArray<FConfigNPCSpawnEntriesContainer>*, API::FieldNameHash("AShooterGameMode.ConfigSubtractNPCSpawnEntriesContainer")>(this, "AShooterGameMode.ConfigSubtractNPCSpawnEntriesContainer"); }
+	float& BabyImprintingStatScaleMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.BabyImprintingStatScaleMultiplier")>(this, "AShooterGameMode.BabyImprintingStatScaleMultiplier"); }
+	float& BabyCuddleIntervalMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.BabyCuddleIntervalMultiplier")>(this, "AShooterGameMode.BabyCuddleIntervalMultiplier"); }
+	float& BabyCuddleGracePeriodMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.BabyCuddleGracePeriodMultiplier")>(this, "AShooterGameMode.BabyCuddleGracePeriodMultiplier"); }
+	float& BabyCuddleLoseImprintQualitySpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.BabyCuddleLoseImprintQualitySpeedMultiplier")>(this, "AShooterGameMode.BabyCuddleLoseImprintQualitySpeedMultiplier"); }
+	float& HairGrowthSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.HairGrowthSpeedMultiplier")>(this, "AShooterGameMode.HairGrowthSpeedMultiplier"); }
+	bool& bPreventDiseasesField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bPreventDiseases")>(this, "AShooterGameMode.bPreventDiseases"); }
+	bool& bNonPermanentDiseasesField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bNonPermanentDiseases")>(this, "AShooterGameMode.bNonPermanentDiseases"); }
+	//UAllClustersInventory * AllClustersInventoryField() { return *GetNativePointerField<UAllClustersInventory **, API::FieldNameHash("AShooterGameMode.AllClustersInventory")>(this, "AShooterGameMode.AllClustersInventory"); }
+	int& SaveForceRespawnDinosVersionField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.SaveForceRespawnDinosVersion")>(this, "AShooterGameMode.SaveForceRespawnDinosVersion"); }
+	unsigned __int64& ServerIDField() { return *GetNativePointerField<unsigned __int64*, API::FieldNameHash("AShooterGameMode.ServerID")>(this, "AShooterGameMode.ServerID"); }
+	int& LoadForceRespawnDinosVersionField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.LoadForceRespawnDinosVersion")>(this, "AShooterGameMode.LoadForceRespawnDinosVersion"); }
+	bool& bIsLoadedServerField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bIsLoadedServer")>(this, "AShooterGameMode.bIsLoadedServer"); }
+	TArray<int>& SupportedSpawnRegionsField() { return *GetNativePointerField<TArray<int>*, API::FieldNameHash("AShooterGameMode.SupportedSpawnRegions")>(this, "AShooterGameMode.SupportedSpawnRegions"); }
+	bool& bServerUseDinoListField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bServerUseDinoList")>(this, "AShooterGameMode.bServerUseDinoList"); }
+	float& MaxAllowedRespawnIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.MaxAllowedRespawnInterval")>(this, "AShooterGameMode.MaxAllowedRespawnInterval"); }
+	bool& bUseDinoLevelUpAnimationsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bUseDinoLevelUpAnimations")>(this, "AShooterGameMode.bUseDinoLevelUpAnimations"); }
+	bool& bDisableDinoTamingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bDisableDinoTaming")>(this, "AShooterGameMode.bDisableDinoTaming"); }
+	bool& bDisableDinoRidingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bDisableDinoRiding")>(this, "AShooterGameMode.bDisableDinoRiding"); }
+	float& MinimumDinoReuploadIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.MinimumDinoReuploadInterval")>(this, "AShooterGameMode.MinimumDinoReuploadInterval"); }
+	int& SaveGameCustomVersionField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.SaveGameCustomVersion")>(this, "AShooterGameMode.SaveGameCustomVersion"); }
+	float& OverrideOfficialDifficultyField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.OverrideOfficialDifficulty")>(this, "AShooterGameMode.OverrideOfficialDifficulty"); }
 	FieldArray<float, 12> PlayerBaseStatMultipliersField() { return { this, "AShooterGameMode.PlayerBaseStatMultipliers" }; }
-	int& NPCActiveCountTamedField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.NPCActiveCountTamed"); }
-	int& NPCActiveCountField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.NPCActiveCount"); }
-	int& NPCCountField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.NPCCount"); }
-	float& MatingSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.MatingSpeedMultiplier"); }
-	float& FastDecayIntervalField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.FastDecayInterval"); }
-	bool& bUseSingleplayerSettingsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bUseSingleplayerSettings"); }
-	bool& bUseCorpseLocatorField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bUseCorpseLocator"); }
-	bool& bDisableStructurePlacementCollisionField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bDisableStructurePlacementCollision"); }
-	bool& bForceUseInventoryAppendsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bForceUseInventoryAppends"); }
-	float& SupplyCrateLootQualityMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.SupplyCrateLootQualityMultiplier"); }
-	float& FishingLootQualityMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.FishingLootQualityMultiplier"); }
-	float& CraftingSkillBonusMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.CraftingSkillBonusMultiplier"); }
-	bool& bAllowPlatformSaddleMultiFloorsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowPlatformSaddleMultiFloors"); }
-	bool& bAllowUnlimitedRespecsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowUnlimitedRespecs"); }
-	float& FuelConsumptionIntervalMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.FuelConsumptionIntervalMultiplier"); }
-	int& DestroyTamesOverLevelClampField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.DestroyTamesOverLevelClamp"); }
-	int& MaxAlliancesPerTribeField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.MaxAlliancesPerTribe"); }
-	int& MaxTribesPerAllianceField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.MaxTribesPerAlliance"); }
-	bool& bDisableDinoDecayClaimingField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bDisableDinoDecayClaiming"); }
-	bool& bDisableNonTribePinAccessField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bDisableNonTribePinAccess"); }
-	bool& bUseTameLimitForStructuresOnlyField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bUseTameLimitForStructuresOnly"); }
-	bool& bLimitTurretsInRangeField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bLimitTurretsInRange"); }
-	float& LimitTurretsRangeField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.LimitTurretsRange"); }
-	int& LimitTurretsNumField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.LimitTurretsNum"); }
-	bool& bHardLimitTurretsInRangeField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bHardLimitTurretsInRange"); }
-	bool& bAutoUnlockAllEngramsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAutoUnlockAllEngrams"); }
-	long double& ServerLastForceRespawnWildDinosTimeField() { return *GetNativePointerField<long double*>(this, "AShooterGameMode.ServerLastForceRespawnWildDinosTime"); }
-	FString& UseStructurePreventionVolumeTagStringField() { return *GetNativePointerField<FString*>(this, "AShooterGameMode.UseStructurePreventionVolumeTagString"); }
-	float& BaseTemperatureMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.BaseTemperatureMultiplier"); }
-	bool& bForceAllowAllStructuresField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bForceAllowAllStructures"); }
-	bool& bForceAllowAscensionItemDownloadsField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bForceAllowAscensionItemDownloads"); }
-	bool& bShowCreativeModeField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bShowCreativeMode"); }
-	float& GlobalPoweredBatteryDurabilityDecreasePerSecondField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.GlobalPoweredBatteryDurabilityDecreasePerSecond"); }
-	float& SingleplayerSettingsCorpseLifespanMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.SingleplayerSettingsCorpseLifespanMultiplier"); }
-	float& UseCorpseLifeSpanMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.UseCorpseLifeSpanMultiplier"); }
-	bool& bUseBPPreSpawnedDinoField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bUseBPPreSpawnedDino"); }
-	float& PreventOfflinePvPConnectionInvincibleIntervalField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.PreventOfflinePvPConnectionInvincibleInterval"); }
-	float& TamedDinoCharacterFoodDrainMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.TamedDinoCharacterFoodDrainMultiplier"); }
-	float& WildDinoCharacterFoodDrainMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.WildDinoCharacterFoodDrainMultiplier"); }
-	float& WildDinoTorporDrainMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.WildDinoTorporDrainMultiplier"); }
-	float& PassiveTameIntervalMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.PassiveTameIntervalMultiplier"); }
-	float& TamedDinoTorporDrainMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameMode.TamedDinoTorporDrainMultiplier"); }
-	bool& bDisableWeatherFogField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bDisableWeatherFog"); }
-	FString& ArkServerMetricsKeyField() { return *GetNativePointerField<FString*>(this, "AShooterGameMode.ArkServerMetricsKey"); }
-	FString& ArkServerMetricsURLField() { return *GetNativePointerField<FString*>(this, "AShooterGameMode.ArkServerMetricsURL"); }
-	bool& bLogChatMessagesField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bLogChatMessages"); }
-	int& ChatLogFlushIntervalSecondsField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.ChatLogFlushIntervalSeconds"); }
-	int& ChatLogFileSplitIntervalSecondsField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.ChatLogFileSplitIntervalSeconds"); }
-	int& ChatLogMaxAgeInDaysField() { return *GetNativePointerField<int*>(this, "AShooterGameMode.ChatLogMaxAgeInDays"); }
-	//TArray<TSharedPtr<FJsonObject, 0>>& ChatMessageBufferField() { return *GetNativePointerField<TArray<TSharedPtr<FJsonObject, 0>>*>(this, "AShooterGameMode.ChatMessageBuffer"); }
-	FString& CurrentChatLogFilenameField() { return *GetNativePointerField<FString*>(this, "AShooterGameMode.CurrentChatLogFilename"); }
-	FDateTime& LastChatLogFlushTimeField() { return *GetNativePointerField<FDateTime*>(this, "AShooterGameMode.LastChatLogFlushTime"); }
-	FDateTime& LastChatLogFileCreateTimeField() { return *GetNativePointerField<FDateTime*>(this, "AShooterGameMode.LastChatLogFileCreateTime"); }
-	FName& UseStructurePreventionVolumeTagField() { return *GetNativePointerField<FName*>(this, "AShooterGameMode.UseStructurePreventionVolumeTag"); }
-	bool& bHasCovertedToStoreField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bHasCovertedToStore"); }
-	bool& bAllowStoredDatasField() { return *GetNativePointerField<bool*>(this, "AShooterGameMode.bAllowStoredDatas"); }
+	int& NPCActiveCountTamedField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.NPCActiveCountTamed")>(this, "AShooterGameMode.NPCActiveCountTamed"); }
+	int& NPCActiveCountField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.NPCActiveCount")>(this, "AShooterGameMode.NPCActiveCount"); }
+	int& NPCCountField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.NPCCount")>(this, "AShooterGameMode.NPCCount"); }
+	float& MatingSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.MatingSpeedMultiplier")>(this, "AShooterGameMode.MatingSpeedMultiplier"); }
+	float& FastDecayIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.FastDecayInterval")>(this, "AShooterGameMode.FastDecayInterval"); }
+	bool& bUseSingleplayerSettingsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bUseSingleplayerSettings")>(this, "AShooterGameMode.bUseSingleplayerSettings"); }
+	bool& bUseCorpseLocatorField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bUseCorpseLocator")>(this, "AShooterGameMode.bUseCorpseLocator"); }
+	bool& bDisableStructurePlacementCollisionField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bDisableStructurePlacementCollision")>(this, "AShooterGameMode.bDisableStructurePlacementCollision"); }
+	bool& bForceUseInventoryAppendsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bForceUseInventoryAppends")>(this, "AShooterGameMode.bForceUseInventoryAppends"); }
+	float& SupplyCrateLootQualityMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.SupplyCrateLootQualityMultiplier")>(this, "AShooterGameMode.SupplyCrateLootQualityMultiplier"); }
+	float& FishingLootQualityMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.FishingLootQualityMultiplier")>(this, "AShooterGameMode.FishingLootQualityMultiplier"); }
+	float& CraftingSkillBonusMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.CraftingSkillBonusMultiplier")>(this, "AShooterGameMode.CraftingSkillBonusMultiplier"); }
+	bool& bAllowPlatformSaddleMultiFloorsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowPlatformSaddleMultiFloors")>(this, "AShooterGameMode.bAllowPlatformSaddleMultiFloors"); }
+	bool& bAllowUnlimitedRespecsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowUnlimitedRespecs")>(this, "AShooterGameMode.bAllowUnlimitedRespecs"); }
+	float& FuelConsumptionIntervalMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.FuelConsumptionIntervalMultiplier")>(this, "AShooterGameMode.FuelConsumptionIntervalMultiplier"); }
+	int& DestroyTamesOverLevelClampField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.DestroyTamesOverLevelClamp")>(this, "AShooterGameMode.DestroyTamesOverLevelClamp"); }
+	int& MaxAlliancesPerTribeField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.MaxAlliancesPerTribe")>(this, "AShooterGameMode.MaxAlliancesPerTribe"); }
+	int& MaxTribesPerAllianceField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.MaxTribesPerAlliance")>(this, "AShooterGameMode.MaxTribesPerAlliance"); }
+	bool& bDisableDinoDecayClaimingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bDisableDinoDecayClaiming")>(this, "AShooterGameMode.bDisableDinoDecayClaiming"); }
+	bool& bDisableNonTribePinAccessField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bDisableNonTribePinAccess")>(this, "AShooterGameMode.bDisableNonTribePinAccess"); }
+	bool& bUseTameLimitForStructuresOnlyField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bUseTameLimitForStructuresOnly")>(this, "AShooterGameMode.bUseTameLimitForStructuresOnly"); }
+	bool& bLimitTurretsInRangeField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bLimitTurretsInRange")>(this, "AShooterGameMode.bLimitTurretsInRange"); }
+	float& LimitTurretsRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.LimitTurretsRange")>(this, "AShooterGameMode.LimitTurretsRange"); }
+	int& LimitTurretsNumField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.LimitTurretsNum")>(this, "AShooterGameMode.LimitTurretsNum"); }
+	bool& bHardLimitTurretsInRangeField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bHardLimitTurretsInRange")>(this, "AShooterGameMode.bHardLimitTurretsInRange"); }
+	bool& bAutoUnlockAllEngramsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAutoUnlockAllEngrams")>(this, "AShooterGameMode.bAutoUnlockAllEngrams"); }
+	long double& ServerLastForceRespawnWildDinosTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterGameMode.ServerLastForceRespawnWildDinosTime")>(this, "AShooterGameMode.ServerLastForceRespawnWildDinosTime"); }
+	FString& UseStructurePreventionVolumeTagStringField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameMode.UseStructurePreventionVolumeTagString")>(this, "AShooterGameMode.UseStructurePreventionVolumeTagString"); }
+	float& BaseTemperatureMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.BaseTemperatureMultiplier")>(this, "AShooterGameMode.BaseTemperatureMultiplier"); }
+	bool& bForceAllowAllStructuresField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bForceAllowAllStructures")>(this, "AShooterGameMode.bForceAllowAllStructures"); }
+	bool& bForceAllowAscensionItemDownloadsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bForceAllowAscensionItemDownloads")>(this, "AShooterGameMode.bForceAllowAscensionItemDownloads"); }
+	bool& bShowCreativeModeField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bShowCreativeMode")>(this, "AShooterGameMode.bShowCreativeMode"); }
+	float& GlobalPoweredBatteryDurabilityDecreasePerSecondField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.GlobalPoweredBatteryDurabilityDecreasePerSecond")>(this, "AShooterGameMode.GlobalPoweredBatteryDurabilityDecreasePerSecond"); }
+	float& SingleplayerSettingsCorpseLifespanMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.SingleplayerSettingsCorpseLifespanMultiplier")>(this, "AShooterGameMode.SingleplayerSettingsCorpseLifespanMultiplier"); }
+	float& UseCorpseLifeSpanMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.UseCorpseLifeSpanMultiplier")>(this, "AShooterGameMode.UseCorpseLifeSpanMultiplier"); }
+	bool& bUseBPPreSpawnedDinoField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bUseBPPreSpawnedDino")>(this, "AShooterGameMode.bUseBPPreSpawnedDino"); }
+	float& PreventOfflinePvPConnectionInvincibleIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.PreventOfflinePvPConnectionInvincibleInterval")>(this, "AShooterGameMode.PreventOfflinePvPConnectionInvincibleInterval"); }
+	float& TamedDinoCharacterFoodDrainMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.TamedDinoCharacterFoodDrainMultiplier")>(this, "AShooterGameMode.TamedDinoCharacterFoodDrainMultiplier"); }
+	float& WildDinoCharacterFoodDrainMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.WildDinoCharacterFoodDrainMultiplier")>(this, "AShooterGameMode.WildDinoCharacterFoodDrainMultiplier"); }
+	float& WildDinoTorporDrainMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.WildDinoTorporDrainMultiplier")>(this, "AShooterGameMode.WildDinoTorporDrainMultiplier"); }
+	float& PassiveTameIntervalMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.PassiveTameIntervalMultiplier")>(this, "AShooterGameMode.PassiveTameIntervalMultiplier"); }
+	float& TamedDinoTorporDrainMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameMode.TamedDinoTorporDrainMultiplier")>(this, "AShooterGameMode.TamedDinoTorporDrainMultiplier"); }
+	bool& bDisableWeatherFogField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bDisableWeatherFog")>(this, "AShooterGameMode.bDisableWeatherFog"); }
+	FString& ArkServerMetricsKeyField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameMode.ArkServerMetricsKey")>(this, "AShooterGameMode.ArkServerMetricsKey"); }
+	FString& ArkServerMetricsURLField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameMode.ArkServerMetricsURL")>(this, "AShooterGameMode.ArkServerMetricsURL"); }
+	bool& bLogChatMessagesField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bLogChatMessages")>(this, "AShooterGameMode.bLogChatMessages"); }
+	int& ChatLogFlushIntervalSecondsField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.ChatLogFlushIntervalSeconds")>(this, "AShooterGameMode.ChatLogFlushIntervalSeconds"); }
+	int& ChatLogFileSplitIntervalSecondsField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.ChatLogFileSplitIntervalSeconds")>(this, "AShooterGameMode.ChatLogFileSplitIntervalSeconds"); }
+	int& ChatLogMaxAgeInDaysField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameMode.ChatLogMaxAgeInDays")>(this, "AShooterGameMode.ChatLogMaxAgeInDays"); }
+	//TArray<TSharedPtr<FJsonObject, 0>>& ChatMessageBufferField() { return *GetNativePointerField<TArray<TSharedPtr<FJsonObject, 0>>*, API::FieldNameHash("AShooterGameMode.ChatMessageBuffer")>(this, "AShooterGameMode.ChatMessageBuffer"); }
+	FString& CurrentChatLogFilenameField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameMode.CurrentChatLogFilename")>(this, "AShooterGameMode.CurrentChatLogFilename"); }
+	FDateTime& LastChatLogFlushTimeField() { return *GetNativePointerField<FDateTime*, API::FieldNameHash("AShooterGameMode.LastChatLogFlushTime")>(this, "AShooterGameMode.LastChatLogFlushTime"); }
+	FDateTime& LastChatLogFileCreateTimeField() { return *GetNativePointerField<FDateTime*, API::FieldNameHash("AShooterGameMode.LastChatLogFileCreateTime")>(this, "AShooterGameMode.LastChatLogFileCreateTime"); }
+	FName& UseStructurePreventionVolumeTagField() { return *GetNativePointerField<FName*, API::FieldNameHash("AShooterGameMode.UseStructurePreventionVolumeTag")>(this, "AShooterGameMode.UseStructurePreventionVolumeTag"); }
+	bool& bHasCovertedToStoreField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bHasCovertedToStore")>(this, "AShooterGameMode.bHasCovertedToStore"); }
+	bool& bAllowStoredDatasField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameMode.bAllowStoredDatas")>(this, "AShooterGameMode.bAllowStoredDatas"); }
 
 	// Functions
 
@@ -1060,177 +1060,177 @@ struct ACustomGameMode : AShooterGameMode
 
 struct UPrimalGameData : UObject
 {
-	FString& ModNameField() { return *GetNativePointerField<FString*>(this, "UPrimalGameData.ModName"); }
-	FString& ModDescriptionField() { return *GetNativePointerField<FString*>(this, "UPrimalGameData.ModDescription"); }
+	FString& ModNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalGameData.ModName")>(this, "UPrimalGameData.ModName"); }
+	FString& ModDescriptionField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalGameData.ModDescription")>(this, "UPrimalGameData.ModDescription"); }
 	//FieldArray<FPrimalCharacterStatusValueDefinition, 12> StatusValueDefinitionsField() { return { this, "UPrimalGameData.StatusValueDefinitions" }; }
 	//FieldArray<FPrimalCharacterStatusStateDefinition, 14> StatusStateDefinitionsField() { return { this, "UPrimalGameData.StatusStateDefinitions" }; }
 	//FieldArray<FPrimalItemStatDefinition, 8> ItemStatDefinitionsField() { return { this, "UPrimalGameData.ItemStatDefinitions" }; }
 	//FieldArray<FPrimalItemDefinition, 9> ItemTypeDefinitionsField() { return { this, "UPrimalGameData.ItemTypeDefinitions" }; }
 	//FieldArray<FPrimalEquipmentDefinition, 11> EquipmentTypeDefinitionsField() { return { this, "UPrimalGameData.EquipmentTypeDefinitions" }; }
-	TArray<TSubclassOf<UPrimalItem>>& MasterItemListField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalGameData.MasterItemList"); }
-//	TArray<FPrimalItemQuality>& ItemQualityDefinitionsField() { return *GetNativePointerField<TArray<FPrimalItemQuality>*>(this, "UPrimalGameData.ItemQualityDefinitions"); }
-	TArray<TSubclassOf<UPrimalEngramEntry>>& EngramBlueprintClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalEngramEntry>>*>(this, "UPrimalGameData.EngramBlueprintClasses"); }
-	TArray<TSubclassOf<UPrimalEngramEntry>>& AdditionalEngramBlueprintClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalEngramEntry>>*>(this, "UPrimalGameData.AdditionalEngramBlueprintClasses"); }
-	TArray<TSubclassOf<UPrimalEngramEntry>>& RemoveEngramBlueprintClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalEngramEntry>>*>(this, "UPrimalGameData.RemoveEngramBlueprintClasses"); }
-	TArray<FString>& PlayerSpawnRegionsField() { return *GetNativePointerField<TArray<FString>*>(this, "UPrimalGameData.PlayerSpawnRegions"); }
-	USoundBase * TutorialDisplaySoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.TutorialDisplaySound"); }
-	USoundBase * Sound_StartItemDragField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_StartItemDrag"); }
-	USoundBase * Sound_StopItemDragField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_StopItemDrag"); }
-	USoundBase * Sound_CancelPlacingStructureField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_CancelPlacingStructure"); }
-	USoundBase * Sound_ChooseStructureRotationField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_ChooseStructureRotation"); }
-	USoundBase * Sound_FailPlacingStructureField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_FailPlacingStructure"); }
-	USoundBase * Sound_ConfirmPlacingStructureField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_ConfirmPlacingStructure"); }
-	USoundBase * Sound_StartPlacingStructureField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_StartPlacingStructure"); }
-	USoundBase * Sound_CorpseDecomposeField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_CorpseDecompose"); }
-	USoundBase * Sound_ApplyLevelUpField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_ApplyLevelUp"); }
-	USoundBase * Sound_ApplyLevelPointField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_ApplyLevelPoint"); }
-	USoundBase * Sound_LearnedEngramField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_LearnedEngram"); }
-	USoundBase * Sound_ReconnectToCharacterField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_ReconnectToCharacter"); }
-	USoundBase * Sound_DropAllItemsField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_DropAllItems"); }
-	USoundBase * Sound_TransferAllItemsToRemoteField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_TransferAllItemsToRemote"); }
-	USoundBase * Sound_TransferAllItemsFromRemoteField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_TransferAllItemsFromRemote"); }
-	USoundBase * Sound_TransferItemToRemoteField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_TransferItemToRemote"); }
-	USoundBase * Sound_TransferItemFromRemoteField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_TransferItemFromRemote"); }
-	USoundBase * Sound_AddItemToSlotField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_AddItemToSlot"); }
-	USoundBase * Sound_RemoveItemFromSlotField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_RemoveItemFromSlot"); }
-	USoundBase * Sound_ClearCraftQueueField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_ClearCraftQueue"); }
-	USoundBase * Sound_AddToCraftQueueField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_AddToCraftQueue"); }
-	USoundBase * Sound_SetRadioFrequencyField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_SetRadioFrequency"); }
-	USoundBase * Sound_AddPinToMapField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_AddPinToMap"); }
-	USoundBase * Sound_RemovePinFromMapField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_RemovePinFromMap"); }
-	USoundBase * Sound_ApplyDyeField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_ApplyDye"); }
-	USoundBase * Sound_ApplyPaintField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_ApplyPaint"); }
-	USoundBase * Sound_SetTextGenericField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_SetTextGeneric"); }
-	USoundBase * Sound_SplitItemStackField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_SplitItemStack"); }
-	USoundBase * Sound_MergeItemStackField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_MergeItemStack"); }
-	USoundBase * Sound_InputPinDigitField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_InputPinDigit"); }
-	USoundBase * Sound_PinValidatedField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_PinValidated"); }
-	USoundBase * Sound_PinRejectedField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_PinRejected"); }
-	USoundBase * Sound_TribeWarBeginField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_TribeWarBegin"); }
-	USoundBase * Sound_TribeWarEndField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_TribeWarEnd"); }
-	USoundBase * Sound_DropInventoryItemField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_DropInventoryItem"); }
-	USoundBase * Sound_RefillWaterContainerField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_RefillWaterContainer"); }
-	TArray<UPrimalEngramEntry *> EngramBlueprintEntriesField() { return *GetNativePointerField<TArray<UPrimalEngramEntry *>*>(this, "UPrimalGameData.EngramBlueprintEntries"); }
-	TSubclassOf<UPrimalItem>& StarterNoteItemField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "UPrimalGameData.StarterNoteItem"); }
-	TArray<TSubclassOf<UPrimalItem>>& PrimaryResourcesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalGameData.PrimaryResources"); }
-	TSubclassOf<ADroppedItem>& GenericDroppedItemTemplateField() { return *GetNativePointerField<TSubclassOf<ADroppedItem>*>(this, "UPrimalGameData.GenericDroppedItemTemplate"); }
-	UMaterialInterface * PostProcess_KnockoutBlurField() { return *GetNativePointerField<UMaterialInterface **>(this, "UPrimalGameData.PostProcess_KnockoutBlur"); }
-	TArray<UMaterialInterface *> BuffPostProcessEffectsField() { return *GetNativePointerField<TArray<UMaterialInterface *>*>(this, "UPrimalGameData.BuffPostProcessEffects"); }
-	TArray<UMaterialInterface *> AdditionalBuffPostProcessEffectsField() { return *GetNativePointerField<TArray<UMaterialInterface *>*>(this, "UPrimalGameData.AdditionalBuffPostProcessEffects"); }
-	UTexture2D * UnknownIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.UnknownIcon"); }
-	UMaterialInterface * UnknownMaterialField() { return *GetNativePointerField<UMaterialInterface **>(this, "UPrimalGameData.UnknownMaterial"); }
-	UTexture2D * WhiteTextureField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.WhiteTexture"); }
-	UTexture2D * BlueprintBackgroundField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.BlueprintBackground"); }
-	UTexture2D * BabyCuddleIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.BabyCuddleIcon"); }
-	UTexture2D * ImprintedRiderIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.ImprintedRiderIcon"); }
-	UTexture2D * WeaponAccessoryActivatedIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.WeaponAccessoryActivatedIcon"); }
-	UTexture2D * EngramBackgroundField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.EngramBackground"); }
-	UTexture2D * VoiceChatIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.VoiceChatIcon"); }
-	UTexture2D * ItemButtonRecentlySelectedBackgroundField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.ItemButtonRecentlySelectedBackground"); }
-	float& GlobalGeneralArmorDegradationMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalGameData.GlobalGeneralArmorDegradationMultiplier"); }
-	float& GlobalSpecificArmorDegradationMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalGameData.GlobalSpecificArmorDegradationMultiplier"); }
-	float& GlobalSpecificArmorRatingMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalGameData.GlobalSpecificArmorRatingMultiplier"); }
-	float& GlobalGeneralArmorRatingMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalGameData.GlobalGeneralArmorRatingMultiplier"); }
-	float& EnemyFoundationPreventionRadiusField() { return *GetNativePointerField<float*>(this, "UPrimalGameData.EnemyFoundationPreventionRadius"); }
-	TArray<UObject *> ExtraResourcesField() { return *GetNativePointerField<TArray<UObject *>*>(this, "UPrimalGameData.ExtraResources"); }
-	TArray<UObject *> BaseExtraResourcesField() { return *GetNativePointerField<TArray<UObject *>*>(this, "UPrimalGameData.BaseExtraResources"); }
-	USoundBase * CombatMusicDayField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.CombatMusicDay"); }
-	USoundBase * CombatMusicNightField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.CombatMusicNight"); }
-	USoundBase * CombatMusicDay_HeavyField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.CombatMusicDay_Heavy"); }
-	USoundBase * CombatMusicNight_HeavyField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.CombatMusicNight_Heavy"); }
-	USoundBase * LevelUpStingerSoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.LevelUpStingerSound"); }
-	TSubclassOf<AGameMode>& DefaultGameModeField() { return *GetNativePointerField<TSubclassOf<AGameMode>*>(this, "UPrimalGameData.DefaultGameMode"); }
+	TArray<TSubclassOf<UPrimalItem>>& MasterItemListField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalGameData.MasterItemList")>(this, "UPrimalGameData.MasterItemList"); }
+//	TArray<FPrimalItemQuality>& ItemQualityDefinitionsField() { return *GetNativePointerField<TArray<FPrimalItemQuality>*, API::FieldNameHash("UPrimalGameData.ItemQualityDefinitions")>(this, "UPrimalGameData.ItemQualityDefinitions"); }
+	TArray<TSubclassOf<UPrimalEngramEntry>>& EngramBlueprintClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalEngramEntry>>*, API::FieldNameHash("UPrimalGameData.EngramBlueprintClasses")>(this, "UPrimalGameData.EngramBlueprintClasses"); }
+	TArray<TSubclassOf<UPrimalEngramEntry>>& AdditionalEngramBlueprintClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalEngramEntry>>*, API::FieldNameHash("UPrimalGameData.AdditionalEngramBlueprintClasses")>(this, "UPrimalGameData.AdditionalEngramBlueprintClasses"); }
+	TArray<TSubclassOf<UPrimalEngramEntry>>& RemoveEngramBlueprintClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalEngramEntry>>*, API::FieldNameHash("UPrimalGameData.RemoveEngramBlueprintClasses")>(this, "UPrimalGameData.RemoveEngramBlueprintClasses"); }
+	TArray<FString>& PlayerSpawnRegionsField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("UPrimalGameData.PlayerSpawnRegions")>(this, "UPrimalGameData.PlayerSpawnRegions"); }
+	USoundBase * TutorialDisplaySoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.TutorialDisplaySound")>(this, "UPrimalGameData.TutorialDisplaySound"); }
+	USoundBase * Sound_StartItemDragField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_StartItemDrag")>(this, "UPrimalGameData.Sound_StartItemDrag"); }
+	USoundBase * Sound_StopItemDragField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_StopItemDrag")>(this, "UPrimalGameData.Sound_StopItemDrag"); }
+	USoundBase * Sound_CancelPlacingStructureField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_CancelPlacingStructure")>(this, "UPrimalGameData.Sound_CancelPlacingStructure"); }
+	USoundBase * Sound_ChooseStructureRotationField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_ChooseStructureRotation")>(this, "UPrimalGameData.Sound_ChooseStructureRotation"); }
+	USoundBase * Sound_FailPlacingStructureField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_FailPlacingStructure")>(this, "UPrimalGameData.Sound_FailPlacingStructure"); }
+	USoundBase * Sound_ConfirmPlacingStructureField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_ConfirmPlacingStructure")>(this, "UPrimalGameData.Sound_ConfirmPlacingStructure"); }
+	USoundBase * Sound_StartPlacingStructureField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_StartPlacingStructure")>(this, "UPrimalGameData.Sound_StartPlacingStructure"); }
+	USoundBase * Sound_CorpseDecomposeField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_CorpseDecompose")>(this, "UPrimalGameData.Sound_CorpseDecompose"); }
+	USoundBase * Sound_ApplyLevelUpField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_ApplyLevelUp")>(this, "UPrimalGameData.Sound_ApplyLevelUp"); }
+	USoundBase * Sound_ApplyLevelPointField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_ApplyLevelPoint")>(this, "UPrimalGameData.Sound_ApplyLevelPoint"); }
+	USoundBase * Sound_LearnedEngramField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_LearnedEngram")>(this, "UPrimalGameData.Sound_LearnedEngram"); }
+	USoundBase * Sound_ReconnectToCharacterField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_ReconnectToCharacter")>(this, "UPrimalGameData.Sound_ReconnectToCharacter"); }
+	USoundBase * Sound_DropAllItemsField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_DropAllItems")>(this, "UPrimalGameData.Sound_DropAllItems"); }
+	USoundBase * Sound_TransferAllItemsToRemoteField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_TransferAllItemsToRemote")>(this, "UPrimalGameData.Sound_TransferAllItemsToRemote"); }
+	USoundBase * Sound_TransferAllItemsFromRemoteField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_TransferAllItemsFromRemote")>(this, "UPrimalGameData.Sound_TransferAllItemsFromRemote"); }
+	USoundBase * Sound_TransferItemToRemoteField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_TransferItemToRemote")>(this, "UPrimalGameData.Sound_TransferItemToRemote"); }
+	USoundBase * Sound_TransferItemFromRemoteField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_TransferItemFromRemote")>(this, "UPrimalGameData.Sound_TransferItemFromRemote"); }
+	USoundBase * Sound_AddItemToSlotField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_AddItemToSlot")>(this, "UPrimalGameData.Sound_AddItemToSlot"); }
+	USoundBase * Sound_RemoveItemFromSlotField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_RemoveItemFromSlot")>(this, "UPrimalGameData.Sound_RemoveItemFromSlot"); }
+	USoundBase * Sound_ClearCraftQueueField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_ClearCraftQueue")>(this, "UPrimalGameData.Sound_ClearCraftQueue"); }
+	USoundBase * Sound_AddToCraftQueueField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_AddToCraftQueue")>(this, "UPrimalGameData.Sound_AddToCraftQueue"); }
+	USoundBase * Sound_SetRadioFrequencyField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_SetRadioFrequency")>(this, "UPrimalGameData.Sound_SetRadioFrequency"); }
+	USoundBase * Sound_AddPinToMapField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_AddPinToMap")>(this, "UPrimalGameData.Sound_AddPinToMap"); }
+	USoundBase * Sound_RemovePinFromMapField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_RemovePinFromMap")>(this, "UPrimalGameData.Sound_RemovePinFromMap"); }
+	USoundBase * Sound_ApplyDyeField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_ApplyDye")>(this, "UPrimalGameData.Sound_ApplyDye"); }
+	USoundBase * Sound_ApplyPaintField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_ApplyPaint")>(this, "UPrimalGameData.Sound_ApplyPaint"); }
+	USoundBase * Sound_SetTextGenericField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_SetTextGeneric")>(this, "UPrimalGameData.Sound_SetTextGeneric"); }
+	USoundBase * Sound_SplitItemStackField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_SplitItemStack")>(this, "UPrimalGameData.Sound_SplitItemStack"); }
+	USoundBase * Sound_MergeItemStackField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_MergeItemStack")>(this, "UPrimalGameData.Sound_MergeItemStack"); }
+	USoundBase * Sound_InputPinDigitField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_InputPinDigit")>(this, "UPrimalGameData.Sound_InputPinDigit"); }
+	USoundBase * Sound_PinValidatedField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_PinValidated")>(this, "UPrimalGameData.Sound_PinValidated"); }
+	USoundBase * Sound_PinRejectedField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_PinRejected")>(this, "UPrimalGameData.Sound_PinRejected"); }
+	USoundBase * Sound_TribeWarBeginField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_TribeWarBegin")>(this, "UPrimalGameData.Sound_TribeWarBegin"); }
+	USoundBase * Sound_TribeWarEndField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_TribeWarEnd")>(this, "UPrimalGameData.Sound_TribeWarEnd"); }
+	USoundBase * Sound_DropInventoryItemField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_DropInventoryItem")>(this, "UPrimalGameData.Sound_DropInventoryItem"); }
+	USoundBase * Sound_RefillWaterContainerField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_RefillWaterContainer")>(this, "UPrimalGameData.Sound_RefillWaterContainer"); }
+	TArray<UPrimalEngramEntry *> EngramBlueprintEntriesField() { return *GetNativePointerField<TArray<UPrimalEngramEntry *>*, API::FieldNameHash("UPrimalGameData.EngramBlueprintEntries")>(this, "UPrimalGameData.EngramBlueprintEntries"); }
+	TSubclassOf<UPrimalItem>& StarterNoteItemField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("UPrimalGameData.StarterNoteItem")>(this, "UPrimalGameData.StarterNoteItem"); }
+	TArray<TSubclassOf<UPrimalItem>>& PrimaryResourcesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalGameData.PrimaryResources")>(this, "UPrimalGameData.PrimaryResources"); }
+	TSubclassOf<ADroppedItem>& GenericDroppedItemTemplateField() { return *GetNativePointerField<TSubclassOf<ADroppedItem>*, API::FieldNameHash("UPrimalGameData.GenericDroppedItemTemplate")>(this, "UPrimalGameData.GenericDroppedItemTemplate"); }
+	UMaterialInterface * PostProcess_KnockoutBlurField() { return *GetNativePointerField<UMaterialInterface **, API::FieldNameHash("UPrimalGameData.PostProcess_KnockoutBlur")>(this, "UPrimalGameData.PostProcess_KnockoutBlur"); }
+	TArray<UMaterialInterface *> BuffPostProcessEffectsField() { return *GetNativePointerField<TArray<UMaterialInterface *>*, API::FieldNameHash("UPrimalGameData.BuffPostProcessEffects")>(this, "UPrimalGameData.BuffPostProcessEffects"); }
+	TArray<UMaterialInterface *> AdditionalBuffPostProcessEffectsField() { return *GetNativePointerField<TArray<UMaterialInterface *>*, API::FieldNameHash("UPrimalGameData.AdditionalBuffPostProcessEffects")>(this, "UPrimalGameData.AdditionalBuffPostProcessEffects"); }
+	UTexture2D * UnknownIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.UnknownIcon")>(this, "UPrimalGameData.UnknownIcon"); }
+	UMaterialInterface * UnknownMaterialField() { return *GetNativePointerField<UMaterialInterface **, API::FieldNameHash("UPrimalGameData.UnknownMaterial")>(this, "UPrimalGameData.UnknownMaterial"); }
+	UTexture2D * WhiteTextureField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.WhiteTexture")>(this, "UPrimalGameData.WhiteTexture"); }
+	UTexture2D * BlueprintBackgroundField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.BlueprintBackground")>(this, "UPrimalGameData.BlueprintBackground"); }
+	UTexture2D * BabyCuddleIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.BabyCuddleIcon")>(this, "UPrimalGameData.BabyCuddleIcon"); }
+	UTexture2D * ImprintedRiderIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.ImprintedRiderIcon")>(this, "UPrimalGameData.ImprintedRiderIcon"); }
+	UTexture2D * WeaponAccessoryActivatedIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.WeaponAccessoryActivatedIcon")>(this, "UPrimalGameData.WeaponAccessoryActivatedIcon"); }
+	UTexture2D * EngramBackgroundField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.EngramBackground")>(this, "UPrimalGameData.EngramBackground"); }
+	UTexture2D * VoiceChatIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.VoiceChatIcon")>(this, "UPrimalGameData.VoiceChatIcon"); }
+	UTexture2D * ItemButtonRecentlySelectedBackgroundField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.ItemButtonRecentlySelectedBackground")>(this, "UPrimalGameData.ItemButtonRecentlySelectedBackground"); }
+	float& GlobalGeneralArmorDegradationMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalGameData.GlobalGeneralArmorDegradationMultiplier")>(this, "UPrimalGameData.GlobalGeneralArmorDegradationMultiplier"); }
+	float& GlobalSpecificArmorDegradationMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalGameData.GlobalSpecificArmorDegradationMultiplier")>(this, "UPrimalGameData.GlobalSpecificArmorDegradationMultiplier"); }
+	float& GlobalSpecificArmorRatingMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalGameData.GlobalSpecificArmorRatingMultiplier")>(this, "UPrimalGameData.GlobalSpecificArmorRatingMultiplier"); }
+	float& GlobalGeneralArmorRatingMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalGameData.GlobalGeneralArmorRatingMultiplier")>(this, "UPrimalGameData.GlobalGeneralArmorRatingMultiplier"); }
+	float& EnemyFoundationPreventionRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalGameData.EnemyFoundationPreventionRadius")>(this, "UPrimalGameData.EnemyFoundationPreventionRadius"); }
+	TArray<UObject *> ExtraResourcesField() { return *GetNativePointerField<TArray<UObject *>*, API::FieldNameHash("UPrimalGameData.ExtraResources")>(this, "UPrimalGameData.ExtraResources"); }
+	TArray<UObject *> BaseExtraResourcesField() { return *GetNativePointerField<TArray<UObject *>*, API::FieldNameHash("UPrimalGameData.BaseExtraResources")>(this, "UPrimalGameData.BaseExtraResources"); }
+	USoundBase * CombatMusicDayField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.CombatMusicDay")>(this, "UPrimalGameData.CombatMusicDay"); }
+	USoundBase * CombatMusicNightField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.CombatMusicNight")>(this, "UPrimalGameData.CombatMusicNight"); }
+	USoundBase * CombatMusicDay_HeavyField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.CombatMusicDay_Heavy")>(this, "UPrimalGameData.CombatMusicDay_Heavy"); }
+	USoundBase * CombatMusicNight_HeavyField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.CombatMusicNight_Heavy")>(this, "UPrimalGameData.CombatMusicNight_Heavy"); }
+	USoundBase * LevelUpStingerSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.LevelUpStingerSound")>(this, "UPrimalGameData.LevelUpStingerSound"); }
+	TSubclassOf<AGameMode>& DefaultGameModeField() { return *GetNativePointerField<TSubclassOf<AGameMode>*, API::FieldNameHash("UPrimalGameData.DefaultGameMode")>(this, "UPrimalGameData.DefaultGameMode"); }
 	FieldArray<FLevelExperienceRamp, 4> LevelExperienceRampsField() { return { this, "UPrimalGameData.LevelExperienceRamps" }; }
 	FieldArray<FLevelExperienceRamp, 4> SinglePlayerLevelExperienceRampsField() { return { this, "UPrimalGameData.SinglePlayerLevelExperienceRamps" }; }
-	TArray<int>& PlayerLevelEngramPointsField() { return *GetNativePointerField<TArray<int>*>(this, "UPrimalGameData.PlayerLevelEngramPoints"); }
-	TArray<int>& PlayerLevelEngramPointsSPField() { return *GetNativePointerField<TArray<int>*>(this, "UPrimalGameData.PlayerLevelEngramPointsSP"); }
-	TArray<FString>& PreventBuildStructureReasonStringsField() { return *GetNativePointerField<TArray<FString>*>(this, "UPrimalGameData.PreventBuildStructureReasonStrings"); }
-	//TArray<FClassRemapping>& Remap_NPCField() { return *GetNativePointerField<TArray<FClassRemapping>*>(this, "UPrimalGameData.Remap_NPC"); }
-	//TArray<FClassRemapping>& Remap_SupplyCratesField() { return *GetNativePointerField<TArray<FClassRemapping>*>(this, "UPrimalGameData.Remap_SupplyCrates"); }
-	//TArray<FClassRemapping>& Remap_ResourceComponentsField() { return *GetNativePointerField<TArray<FClassRemapping>*>(this, "UPrimalGameData.Remap_ResourceComponents"); }
-	//TArray<FClassRemapping>& Remap_NPCSpawnEntriesField() { return *GetNativePointerField<TArray<FClassRemapping>*>(this, "UPrimalGameData.Remap_NPCSpawnEntries"); }
-	//TArray<FClassRemapping>& Remap_EngramsField() { return *GetNativePointerField<TArray<FClassRemapping>*>(this, "UPrimalGameData.Remap_Engrams"); }
-	//TArray<FClassRemapping>& Remap_ItemsField() { return *GetNativePointerField<TArray<FClassRemapping>*>(this, "UPrimalGameData.Remap_Items"); }
-	//TArray<FClassAddition>& AdditionalStructureEngramsField() { return *GetNativePointerField<TArray<FClassAddition>*>(this, "UPrimalGameData.AdditionalStructureEngrams"); }
-	TSubclassOf<AActor>& ActorToSpawnUponEnemyCoreStructureDeathField() { return *GetNativePointerField<TSubclassOf<AActor>*>(this, "UPrimalGameData.ActorToSpawnUponEnemyCoreStructureDeath"); }
-	TArray<TSubclassOf<APrimalStructure>>& AdditionalStructuresToPlaceField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*>(this, "UPrimalGameData.AdditionalStructuresToPlace"); }
-	TArray<FColor>& MasterColorTableField() { return *GetNativePointerField<TArray<FColor>*>(this, "UPrimalGameData.MasterColorTable"); }
-	float& EnemyCoreStructureDeathActorRadiusBuildCheckField() { return *GetNativePointerField<float*>(this, "UPrimalGameData.EnemyCoreStructureDeathActorRadiusBuildCheck"); }
-	TSubclassOf<APrimalStructureItemContainer>& DeathDestructionDepositInventoryClassField() { return *GetNativePointerField<TSubclassOf<APrimalStructureItemContainer>*>(this, "UPrimalGameData.DeathDestructionDepositInventoryClass"); }
-	UTexture2D * MateBoostIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.MateBoostIcon"); }
-	UTexture2D * EggBoostIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.EggBoostIcon"); }
-	UTexture2D * MatingIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.MatingIcon"); }
-	UTexture2D * NearFeedIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.NearFeedIcon"); }
-	UTexture2D * BuffedIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.BuffedIcon"); }
-	UTexture2D * TethererdIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.TethererdIcon"); }
-	UTexture2D * GamepadFaceButtonTopField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.GamepadFaceButtonTop"); }
-	UTexture2D * GamepadFaceButtonBottomField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.GamepadFaceButtonBottom"); }
-	UTexture2D * GamepadFaceButtonLeftField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.GamepadFaceButtonLeft"); }
-	UTexture2D * GamepadFaceButtonRightField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.GamepadFaceButtonRight"); }
-	float& TribeXPSharePercentField() { return *GetNativePointerField<float*>(this, "UPrimalGameData.TribeXPSharePercent"); }
-	int& OverrideServerPhysXSubstepsField() { return *GetNativePointerField<int*>(this, "UPrimalGameData.OverrideServerPhysXSubsteps"); }
-	float& OverrideServerPhysXSubstepsDeltaTimeField() { return *GetNativePointerField<float*>(this, "UPrimalGameData.OverrideServerPhysXSubstepsDeltaTime"); }
-	bool& bInitializedField() { return *GetNativePointerField<bool*>(this, "UPrimalGameData.bInitialized"); }
+	TArray<int>& PlayerLevelEngramPointsField() { return *GetNativePointerField<TArray<int>*, API::FieldNameHash("UPrimalGameData.PlayerLevelEngramPoints")>(this, "UPrimalGameData.PlayerLevelEngramPoints"); }
+	TArray<int>& PlayerLevelEngramPointsSPField() { return *GetNativePointerField<TArray<int>*, API::FieldNameHash("UPrimalGameData.PlayerLevelEngramPointsSP")>(this, "UPrimalGameData.PlayerLevelEngramPointsSP"); }
+	TArray<FString>& PreventBuildStructureReasonStringsField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("UPrimalGameData.PreventBuildStructureReasonStrings")>(this, "UPrimalGameData.PreventBuildStructureReasonStrings"); }
+	//TArray<FClassRemapping>& Remap_NPCField() { return *GetNativePointerField<TArray<FClassRemapping>*, API::FieldNameHash("UPrimalGameData.Remap_NPC")>(this, "UPrimalGameData.Remap_NPC"); }
+	//TArray<FClassRemapping>& Remap_SupplyCratesField() { return *GetNativePointerField<TArray<FClassRemapping>*, API::FieldNameHash("UPrimalGameData.Remap_SupplyCrates")>(this, "UPrimalGameData.Remap_SupplyCrates"); }
+	//TArray<FClassRemapping>& Remap_ResourceComponentsField() { return *GetNativePointerField<TArray<FClassRemapping>*, API::FieldNameHash("UPrimalGameData.Remap_ResourceComponents")>(this, "UPrimalGameData.Remap_ResourceComponents"); }
+	//TArray<FClassRemapping>& Remap_NPCSpawnEntriesField() { return *GetNativePointerField<TArray<FClassRemapping>*, API::FieldNameHash("UPrimalGameData.Remap_NPCSpawnEntries")>(this, "UPrimalGameData.Remap_NPCSpawnEntries"); }
+	//TArray<FClassRemapping>& Remap_EngramsField() { return *GetNativePointerField<TArray<FClassRemapping>*, API::FieldNameHash("UPrimalGameData.Remap_Engrams")>(this, "UPrimalGameData.Remap_Engrams"); }
+	//TArray<FClassRemapping>& Remap_ItemsField() { return *GetNativePointerField<TArray<FClassRemapping>*, API::FieldNameHash("UPrimalGameData.Remap_Items")>(this, "UPrimalGameData.Remap_Items"); }
+	//TArray<FClassAddition>& AdditionalStructureEngramsField() { return *GetNativePointerField<TArray<FClassAddition>*, API::FieldNameHash("UPrimalGameData.AdditionalStructureEngrams")>(this, "UPrimalGameData.AdditionalStructureEngrams"); }
+	TSubclassOf<AActor>& ActorToSpawnUponEnemyCoreStructureDeathField() { return *GetNativePointerField<TSubclassOf<AActor>*, API::FieldNameHash("UPrimalGameData.ActorToSpawnUponEnemyCoreStructureDeath")>(this, "UPrimalGameData.ActorToSpawnUponEnemyCoreStructureDeath"); }
+	TArray<TSubclassOf<APrimalStructure>>& AdditionalStructuresToPlaceField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*, API::FieldNameHash("UPrimalGameData.AdditionalStructuresToPlace")>(this, "UPrimalGameData.AdditionalStructuresToPlace"); }
+	TArray<FColor>& MasterColorTableField() { return *GetNativePointerField<TArray<FColor>*, API::FieldNameHash("UPrimalGameData.MasterColorTable")>(this, "UPrimalGameData.MasterColorTable"); }
+	float& EnemyCoreStructureDeathActorRadiusBuildCheckField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalGameData.EnemyCoreStructureDeathActorRadiusBuildCheck")>(this, "UPrimalGameData.EnemyCoreStructureDeathActorRadiusBuildCheck"); }
+	TSubclassOf<APrimalStructureItemContainer>& DeathDestructionDepositInventoryClassField() { return *GetNativePointerField<TSubclassOf<APrimalStructureItemContainer>*, API::FieldNameHash("UPrimalGameData.DeathDestructionDepositInventoryClass")>(this, "UPrimalGameData.DeathDestructionDepositInventoryClass"); }
+	UTexture2D * MateBoostIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.MateBoostIcon")>(this, "UPrimalGameData.MateBoostIcon"); }
+	UTexture2D * EggBoostIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.EggBoostIcon")>(this, "UPrimalGameData.EggBoostIcon"); }
+	UTexture2D * MatingIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.MatingIcon")>(this, "UPrimalGameData.MatingIcon"); }
+	UTexture2D * NearFeedIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.NearFeedIcon")>(this, "UPrimalGameData.NearFeedIcon"); }
+	UTexture2D * BuffedIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.BuffedIcon")>(this, "UPrimalGameData.BuffedIcon"); }
+	UTexture2D * TethererdIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.TethererdIcon")>(this, "UPrimalGameData.TethererdIcon"); }
+	UTexture2D * GamepadFaceButtonTopField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.GamepadFaceButtonTop")>(this, "UPrimalGameData.GamepadFaceButtonTop"); }
+	UTexture2D * GamepadFaceButtonBottomField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.GamepadFaceButtonBottom")>(this, "UPrimalGameData.GamepadFaceButtonBottom"); }
+	UTexture2D * GamepadFaceButtonLeftField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.GamepadFaceButtonLeft")>(this, "UPrimalGameData.GamepadFaceButtonLeft"); }
+	UTexture2D * GamepadFaceButtonRightField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.GamepadFaceButtonRight")>(this, "UPrimalGameData.GamepadFaceButtonRight"); }
+	float& TribeXPSharePercentField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalGameData.TribeXPSharePercent")>(this, "UPrimalGameData.TribeXPSharePercent"); }
+	int& OverrideServerPhysXSubstepsField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalGameData.OverrideServerPhysXSubsteps")>(this, "UPrimalGameData.OverrideServerPhysXSubsteps"); }
+	float& OverrideServerPhysXSubstepsDeltaTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalGameData.OverrideServerPhysXSubstepsDeltaTime")>(this, "UPrimalGameData.OverrideServerPhysXSubstepsDeltaTime"); }
+	bool& bInitializedField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimalGameData.bInitialized")>(this, "UPrimalGameData.bInitialized"); }
 	FieldArray<USoundBase *, 3> Sound_TamedDinosField() { return { this, "UPrimalGameData.Sound_TamedDinos" }; }
-	USoundBase * Sound_ItemStartCraftingField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_ItemStartCrafting"); }
-	USoundBase * Sound_ItemFinishCraftingField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_ItemFinishCrafting"); }
-	USoundBase * Sound_ItemStartRepairingField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_ItemStartRepairing"); }
-	USoundBase * Sound_ItemFinishRepairingField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_ItemFinishRepairing"); }
-	float& MinPaintDurationConsumptionField() { return *GetNativePointerField<float*>(this, "UPrimalGameData.MinPaintDurationConsumption"); }
-	float& MaxPaintDurationConsumptionField() { return *GetNativePointerField<float*>(this, "UPrimalGameData.MaxPaintDurationConsumption"); }
-	float& MinDinoRadiusForPaintConsumptionField() { return *GetNativePointerField<float*>(this, "UPrimalGameData.MinDinoRadiusForPaintConsumption"); }
-	float& MaxDinoRadiusForPaintConsumptionField() { return *GetNativePointerField<float*>(this, "UPrimalGameData.MaxDinoRadiusForPaintConsumption"); }
-	TSubclassOf<UPrimalItem>& SoapItemTemplateField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "UPrimalGameData.SoapItemTemplate"); }
-	UTexture2D * NameTagWildcardAdminField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.NameTagWildcardAdmin"); }
-	UTexture2D * NameTagServerAdminField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.NameTagServerAdmin"); }
-	UTexture2D * NameTagTribeAdminField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.NameTagTribeAdmin"); }
-	TArray<UTexture2D *> BadgeGroupsNameTagField() { return *GetNativePointerField<TArray<UTexture2D *>*>(this, "UPrimalGameData.BadgeGroupsNameTag"); }
-	TArray<FString>& AchievementIDsField() { return *GetNativePointerField<TArray<FString>*>(this, "UPrimalGameData.AchievementIDs"); }
-	TSet<FString, DefaultKeyFuncs<FString, 0>, FDefaultSetAllocator>& AchievementIDSetField() { return *GetNativePointerField<TSet<FString, DefaultKeyFuncs<FString, 0>, FDefaultSetAllocator>*>(this, "UPrimalGameData.AchievementIDSet"); }
-	TArray<float>& AdditionalEggWeightsToSpawnField() { return *GetNativePointerField<TArray<float>*>(this, "UPrimalGameData.AdditionalEggWeightsToSpawn"); }
-	TArray<TSubclassOf<UPrimalItem>>& AdditionalEggItemsToSpawnField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalGameData.AdditionalEggItemsToSpawn"); }
-	TArray<float>& FertilizedAdditionalEggWeightsToSpawnField() { return *GetNativePointerField<TArray<float>*>(this, "UPrimalGameData.FertilizedAdditionalEggWeightsToSpawn"); }
-	TArray<TSubclassOf<UPrimalItem>>& FertilizedAdditionalEggItemsToSpawnField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalGameData.FertilizedAdditionalEggItemsToSpawn"); }
-	FString& ItemAchievementsNameField() { return *GetNativePointerField<FString*>(this, "UPrimalGameData.ItemAchievementsName"); }
-	TArray<TSubclassOf<UPrimalItem>>& ItemAchievementsListField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalGameData.ItemAchievementsList"); }
-	TArray<TSubclassOf<UPrimalItem>>& GlobalCuddleFoodListField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalGameData.GlobalCuddleFoodList"); }
-	USoundBase * DinoIncrementedImprintingSoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.DinoIncrementedImprintingSound"); }
-	USoundBase * HitMarkerCharacterSoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.HitMarkerCharacterSound"); }
-	USoundBase * HitMarkerStructureSoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.HitMarkerStructureSound"); }
-	UMaterialInterface * PostProcess_ColorLUTField() { return *GetNativePointerField<UMaterialInterface **>(this, "UPrimalGameData.PostProcess_ColorLUT"); }
-	USoundBase * Sound_DossierUnlockedField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_DossierUnlocked"); }
-	USoundBase * Sound_ItemUseOnItemField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_ItemUseOnItem"); }
-	USoundBase * Sound_RemoveItemSkinField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_RemoveItemSkin"); }
-	USoundBase * Sound_RemoveClipAmmoField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_RemoveClipAmmo"); }
-	float& ExplorerNoteXPGainField() { return *GetNativePointerField<float*>(this, "UPrimalGameData.ExplorerNoteXPGain"); }
+	USoundBase * Sound_ItemStartCraftingField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_ItemStartCrafting")>(this, "UPrimalGameData.Sound_ItemStartCrafting"); }
+	USoundBase * Sound_ItemFinishCraftingField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_ItemFinishCrafting")>(this, "UPrimalGameData.Sound_ItemFinishCrafting"); }
+	USoundBase * Sound_ItemStartRepairingField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_ItemStartRepairing")>(this, "UPrimalGameData.Sound_ItemStartRepairing"); }
+	USoundBase * Sound_ItemFinishRepairingField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_ItemFinishRepairing")>(this, "UPrimalGameData.Sound_ItemFinishRepairing"); }
+	float& MinPaintDurationConsumptionField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalGameData.MinPaintDurationConsumption")>(this, "UPrimalGameData.MinPaintDurationConsumption"); }
+	float& MaxPaintDurationConsumptionField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalGameData.MaxPaintDurationConsumption")>(this, "UPrimalGameData.MaxPaintDurationConsumption"); }
+	float& MinDinoRadiusForPaintConsumptionField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalGameData.MinDinoRadiusForPaintConsumption")>(this, "UPrimalGameData.MinDinoRadiusForPaintConsumption"); }
+	float& MaxDinoRadiusForPaintConsumptionField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalGameData.MaxDinoRadiusForPaintConsumption")>(this, "UPrimalGameData.MaxDinoRadiusForPaintConsumption"); }
+	TSubclassOf<UPrimalItem>& SoapItemTemplateField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("UPrimalGameData.SoapItemTemplate")>(this, "UPrimalGameData.SoapItemTemplate"); }
+	UTexture2D * NameTagWildcardAdminField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.NameTagWildcardAdmin")>(this, "UPrimalGameData.NameTagWildcardAdmin"); }
+	UTexture2D * NameTagServerAdminField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.NameTagServerAdmin")>(this, "UPrimalGameData.NameTagServerAdmin"); }
+	UTexture2D * NameTagTribeAdminField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.NameTagTribeAdmin")>(this, "UPrimalGameData.NameTagTribeAdmin"); }
+	TArray<UTexture2D *> BadgeGroupsNameTagField() { return *GetNativePointerField<TArray<UTexture2D *>*, API::FieldNameHash("UPrimalGameData.BadgeGroupsNameTag")>(this, "UPrimalGameData.BadgeGroupsNameTag"); }
+	TArray<FString>& AchievementIDsField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("UPrimalGameData.AchievementIDs")>(this, "UPrimalGameData.AchievementIDs"); }
+	TSet<FString, DefaultKeyFuncs<FString, 0>, FDefaultSetAllocator>& AchievementIDSetField() { return *GetNativePointerField<TSet<FString, DefaultKeyFuncs<FString, 0>, FDefaultSetAllocator>*, API::FieldNameHash("UPrimalGameData.AchievementIDSet")>(this, "UPrimalGameData.AchievementIDSet"); }
+	TArray<float>& AdditionalEggWeightsToSpawnField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("UPrimalGameData.AdditionalEggWeightsToSpawn")>(this, "UPrimalGameData.AdditionalEggWeightsToSpawn"); }
+	TArray<TSubclassOf<UPrimalItem>>& AdditionalEggItemsToSpawnField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalGameData.AdditionalEggItemsToSpawn")>(this, "UPrimalGameData.AdditionalEggItemsToSpawn"); }
+	TArray<float>& FertilizedAdditionalEggWeightsToSpawnField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("UPrimalGameData.FertilizedAdditionalEggWeightsToSpawn")>(this, "UPrimalGameData.FertilizedAdditionalEggWeightsToSpawn"); }
+	TArray<TSubclassOf<UPrimalItem>>& FertilizedAdditionalEggItemsToSpawnField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalGameData.FertilizedAdditionalEggItemsToSpawn")>(this, "UPrimalGameData.FertilizedAdditionalEggItemsToSpawn"); }
+	FString& ItemAchievementsNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalGameData.ItemAchievementsName")>(this, "UPrimalGameData.ItemAchievementsName"); }
+	TArray<TSubclassOf<UPrimalItem>>& ItemAchievementsListField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalGameData.ItemAchievementsList")>(this, "UPrimalGameData.ItemAchievementsList"); }
+	TArray<TSubclassOf<UPrimalItem>>& GlobalCuddleFoodListField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalGameData.GlobalCuddleFoodList")>(this, "UPrimalGameData.GlobalCuddleFoodList"); }
+	USoundBase * DinoIncrementedImprintingSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.DinoIncrementedImprintingSound")>(this, "UPrimalGameData.DinoIncrementedImprintingSound"); }
+	USoundBase * HitMarkerCharacterSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.HitMarkerCharacterSound")>(this, "UPrimalGameData.HitMarkerCharacterSound"); }
+	USoundBase * HitMarkerStructureSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.HitMarkerStructureSound")>(this, "UPrimalGameData.HitMarkerStructureSound"); }
+	UMaterialInterface * PostProcess_ColorLUTField() { return *GetNativePointerField<UMaterialInterface **, API::FieldNameHash("UPrimalGameData.PostProcess_ColorLUT")>(this, "UPrimalGameData.PostProcess_ColorLUT"); }
+	USoundBase * Sound_DossierUnlockedField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_DossierUnlocked")>(this, "UPrimalGameData.Sound_DossierUnlocked"); }
+	USoundBase * Sound_ItemUseOnItemField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_ItemUseOnItem")>(this, "UPrimalGameData.Sound_ItemUseOnItem"); }
+	USoundBase * Sound_RemoveItemSkinField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_RemoveItemSkin")>(this, "UPrimalGameData.Sound_RemoveItemSkin"); }
+	USoundBase * Sound_RemoveClipAmmoField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_RemoveClipAmmo")>(this, "UPrimalGameData.Sound_RemoveClipAmmo"); }
+	float& ExplorerNoteXPGainField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalGameData.ExplorerNoteXPGain")>(this, "UPrimalGameData.ExplorerNoteXPGain"); }
 	FieldArray<UTexture2D *[3], 23> BuffTypeBackgroundsField() { return { this, "UPrimalGameData.BuffTypeBackgrounds" }; }
 	FieldArray<UTexture2D *[3], 23> BuffTypeForegroundsField() { return { this, "UPrimalGameData.BuffTypeForegrounds" }; }
-	TSubclassOf<APrimalBuff>& ExplorerNoteXPBuffField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*>(this, "UPrimalGameData.ExplorerNoteXPBuff"); }
-	TSubclassOf<APrimalBuff>& SpecialExplorerNoteXPBuffField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*>(this, "UPrimalGameData.SpecialExplorerNoteXPBuff"); }
-	UTexture2D * PerMapExplorerNoteLockedIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.PerMapExplorerNoteLockedIcon"); }
-	UTexture2D * TamedDinoUnlockedIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.TamedDinoUnlockedIcon"); }
-	UTexture2D * TamedDinoLockedIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.TamedDinoLockedIcon"); }
-	UTexture2D * DinoOrderIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.DinoOrderIcon"); }
-	TArray<TSubclassOf<AActor>>& ServerExtraWorldSingletonActorClassesField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*>(this, "UPrimalGameData.ServerExtraWorldSingletonActorClasses"); }
-	bool& bForceServerUseDinoListField() { return *GetNativePointerField<bool*>(this, "UPrimalGameData.bForceServerUseDinoList"); }
-	TArray<TSubclassOf<UPrimalGameData>>& ExtraStackedGameDataClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalGameData>>*>(this, "UPrimalGameData.ExtraStackedGameDataClasses"); }
-	TSubclassOf<UPrimalItem>& ExtraEggItemField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "UPrimalGameData.ExtraEggItem"); }
-	USoundBase * GenericWaterPostprocessAmbientSoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.GenericWaterPostprocessAmbientSound"); }
-	TSubclassOf<UPrimalPlayerData>& OverridePlayerDataClassField() { return *GetNativePointerField<TSubclassOf<UPrimalPlayerData>*>(this, "UPrimalGameData.OverridePlayerDataClass"); }
-	TArray<FName>& AllDinosAchievementNameTagsField() { return *GetNativePointerField<TArray<FName>*>(this, "UPrimalGameData.AllDinosAchievementNameTags"); }
-	USoundBase * GenericArrowPickedUpSoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.GenericArrowPickedUpSound"); }
-	UTexture2D * UnlockIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.UnlockIcon"); }
-	FColor& WheelFolderColorField() { return *GetNativePointerField<FColor*>(this, "UPrimalGameData.WheelFolderColor"); }
-	FColor& WheelBackColorField() { return *GetNativePointerField<FColor*>(this, "UPrimalGameData.WheelBackColor"); }
-	UTexture2D * MaxInventoryIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.MaxInventoryIcon"); }
-	UTexture2D * ItemSkinIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalGameData.ItemSkinIcon"); }
-	TArray<TEnumAsByte<enum ECollisionChannel>>& SkeletalPhysCustomBodyAdditionalIgnoresField() { return *GetNativePointerField<TArray<TEnumAsByte<enum ECollisionChannel>>*>(this, "UPrimalGameData.SkeletalPhysCustomBodyAdditionalIgnores"); }
-	USoundBase * ActionWheelClickSoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.ActionWheelClickSound"); }
-	USoundBase * Sound_GenericBoardPassengerField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_GenericBoardPassenger"); }
-	USoundBase * Sound_GenericUnboardPassengerField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_GenericUnboardPassenger"); }
-	USoundBase * Sound_CraftingTabToggleField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalGameData.Sound_CraftingTabToggle"); }
-	TSubclassOf<UPrimalItem>& GenericBatteryItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "UPrimalGameData.GenericBatteryItemClass"); }
-	TMap<UClass *, UPrimalEngramEntry *, FDefaultSetAllocator, TDefaultMapKeyFuncs<UClass *, UPrimalEngramEntry *, 0> > ItemEngramMapField() { return *GetNativePointerField<TMap<UClass *, UPrimalEngramEntry *, FDefaultSetAllocator, TDefaultMapKeyFuncs<UClass *, UPrimalEngramEntry *, 0> >*>(this, "UPrimalGameData.ItemEngramMap"); }
+	TSubclassOf<APrimalBuff>& ExplorerNoteXPBuffField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*, API::FieldNameHash("UPrimalGameData.ExplorerNoteXPBuff")>(this, "UPrimalGameData.ExplorerNoteXPBuff"); }
+	TSubclassOf<APrimalBuff>& SpecialExplorerNoteXPBuffField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*, API::FieldNameHash("UPrimalGameData.SpecialExplorerNoteXPBuff")>(this, "UPrimalGameData.SpecialExplorerNoteXPBuff"); }
+	UTexture2D * PerMapExplorerNoteLockedIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.PerMapExplorerNoteLockedIcon")>(this, "UPrimalGameData.PerMapExplorerNoteLockedIcon"); }
+	UTexture2D * TamedDinoUnlockedIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.TamedDinoUnlockedIcon")>(this, "UPrimalGameData.TamedDinoUnlockedIcon"); }
+	UTexture2D * TamedDinoLockedIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.TamedDinoLockedIcon")>(this, "UPrimalGameData.TamedDinoLockedIcon"); }
+	UTexture2D * DinoOrderIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.DinoOrderIcon")>(this, "UPrimalGameData.DinoOrderIcon"); }
+	TArray<TSubclassOf<AActor>>& ServerExtraWorldSingletonActorClassesField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*, API::FieldNameHash("UPrimalGameData.ServerExtraWorldSingletonActorClasses")>(this, "UPrimalGameData.ServerExtraWorldSingletonActorClasses"); }
+	bool& bForceServerUseDinoListField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimalGameData.bForceServerUseDinoList")>(this, "UPrimalGameData.bForceServerUseDinoList"); }
+	TArray<TSubclassOf<UPrimalGameData>>& ExtraStackedGameDataClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalGameData>>*, API::FieldNameHash("UPrimalGameData.ExtraStackedGameDataClasses")>(this, "UPrimalGameData.ExtraStackedGameDataClasses"); }
+	TSubclassOf<UPrimalItem>& ExtraEggItemField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("UPrimalGameData.ExtraEggItem")>(this, "UPrimalGameData.ExtraEggItem"); }
+	USoundBase * GenericWaterPostprocessAmbientSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.GenericWaterPostprocessAmbientSound")>(this, "UPrimalGameData.GenericWaterPostprocessAmbientSound"); }
+	TSubclassOf<UPrimalPlayerData>& OverridePlayerDataClassField() { return *GetNativePointerField<TSubclassOf<UPrimalPlayerData>*, API::FieldNameHash("UPrimalGameData.OverridePlayerDataClass")>(this, "UPrimalGameData.OverridePlayerDataClass"); }
+	TArray<FName>& AllDinosAchievementNameTagsField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("UPrimalGameData.AllDinosAchievementNameTags")>(this, "UPrimalGameData.AllDinosAchievementNameTags"); }
+	USoundBase * GenericArrowPickedUpSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.GenericArrowPickedUpSound")>(this, "UPrimalGameData.GenericArrowPickedUpSound"); }
+	UTexture2D * UnlockIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.UnlockIcon")>(this, "UPrimalGameData.UnlockIcon"); }
+	FColor& WheelFolderColorField() { return *GetNativePointerField<FColor*, API::FieldNameHash("UPrimalGameData.WheelFolderColor")>(this, "UPrimalGameData.WheelFolderColor"); }
+	FColor& WheelBackColorField() { return *GetNativePointerField<FColor*, API::FieldNameHash("UPrimalGameData.WheelBackColor")>(this, "UPrimalGameData.WheelBackColor"); }
+	UTexture2D * MaxInventoryIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.MaxInventoryIcon")>(this, "UPrimalGameData.MaxInventoryIcon"); }
+	UTexture2D * ItemSkinIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalGameData.ItemSkinIcon")>(this, "UPrimalGameData.ItemSkinIcon"); }
+	TArray<TEnumAsByte<enum ECollisionChannel>>& SkeletalPhysCustomBodyAdditionalIgnoresField() { return *GetNativePointerField<TArray<TEnumAsByte<enum ECollisionChannel>>*, API::FieldNameHash("UPrimalGameData.SkeletalPhysCustomBodyAdditionalIgnores")>(this, "UPrimalGameData.SkeletalPhysCustomBodyAdditionalIgnores"); }
+	USoundBase * ActionWheelClickSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.ActionWheelClickSound")>(this, "UPrimalGameData.ActionWheelClickSound"); }
+	USoundBase * Sound_GenericBoardPassengerField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_GenericBoardPassenger")>(this, "UPrimalGameData.Sound_GenericBoardPassenger"); }
+	USoundBase * Sound_GenericUnboardPassengerField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_GenericUnboardPassenger")>(this, "UPrimalGameData.Sound_GenericUnboardPassenger"); }
+	USoundBase * Sound_CraftingTabToggleField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalGameData.Sound_CraftingTabToggle")>(this, "UPrimalGameData.Sound_CraftingTabToggle"); }
+	TSubclassOf<UPrimalItem>& GenericBatteryItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("UPrimalGameData.GenericBatteryItemClass")>(this, "UPrimalGameData.GenericBatteryItemClass"); }
+	TMap<UClass *, UPrimalEngramEntry *, FDefaultSetAllocator, TDefaultMapKeyFuncs<UClass *, UPrimalEngramEntry *, 0> > ItemEngramMapField() { return *GetNativePointerField<TMap<UClass *, UPrimalEngramEntry *, FDefaultSetAllocator, TDefaultMapKeyFuncs<UClass *, UPrimalEngramEntry *, 0> >*, API::FieldNameHash("UPrimalGameData.ItemEngramMap")>(this, "UPrimalGameData.ItemEngramMap"); }
 
 	// Functions
 
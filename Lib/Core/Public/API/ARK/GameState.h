@@ -2,13 +2,13 @@
 
 struct AGameState
 {
-	TSubclassOf<AGameMode>& GameModeClassField() { return *GetNativePointerField<TSubclassOf<AGameMode>*>(this, "AGameState.GameModeClass"); }
-	AGameMode * AuthorityGameModeField() { return *GetNativePointerField<AGameMode **>(this, "AGameState.AuthorityGameMode"); }
-	FName& MatchStateField() { return *GetNativePointerField<FName*>(this, "AGameState.MatchState"); }
-	FName& PreviousMatchStateField() { return *GetNativePointerField<FName*>(this, "AGameState.PreviousMatchState"); }
-	int& ElapsedTimeField() { return *GetNativePointerField<int*>(this, "AGameState.ElapsedTime"); }
-	TArray<APlayerState *> PlayerArrayField() { return *GetNativePointerField<TArray<APlayerState *>*>(this, "AGameState.PlayerArray"); }
-	TArray<APlayerState *> InactivePlayerArrayField() { return *GetNativePointerField<TArray<APlayerState *>*>(this, "AGameState.InactivePlayerArray"); }
+	TSubclassOf<AGameMode>& GameModeClassField() { return *GetNativePointerField<TSubclassOf<AGameMode>*, API::FieldNameHash("AGameState.GameModeClass")>(this, "AGameState.GameModeClass"); }
+	AGameMode * AuthorityGameModeField() { return *GetNativePointerField<AGameMode **, API::FieldNameHash("AGameState.AuthorityGameMode")>(this, "AGameState.AuthorityGameMode"); }
+	FName& MatchStateField() { return *GetNativePointerField<FName*, API::FieldNameHash("AGameState.MatchState")>(this, "AGameState.MatchState"); }
+	FName& PreviousMatchStateField() { return *GetNativePointerField<FName*, API::FieldNameHash("AGameState.PreviousMatchState")>(this, "AGameState.PreviousMatchState"); }
+	int& ElapsedTimeField() { return *GetNativePointerField<int*, API::FieldNameHash("AGameState.ElapsedTime")>(this, "AGameState.ElapsedTime"); }
+	TArray<APlayerState *> PlayerArrayField() { return *GetNativePointerField<TArray<APlayerState *>*, API::FieldNameHash("AGameState.PlayerArray")>(this, "AGameState.PlayerArray"); }
+	TArray<APlayerState *> InactivePlayerArrayField() { return *GetNativePointerField<TArray<APlayerState *>*, API::FieldNameHash("AGameState.InactivePlayerArray")>(this, "AGameState.InactivePlayerArray"); }
 
 	// Bit fields
 
@@ -42,174 +42,174 @@ struct AGameState
 
 struct AShooterGameState : AGameState
 {
-	int& NumNPCField() { return *GetNativePointerField<int*>(this, "AShooterGameState.NumNPC"); }
-	int& NumHibernatedNPCField() { return *GetNativePointerField<int*>(this, "AShooterGameState.NumHibernatedNPC"); }
-	int& NumActiveNPCField() { return *GetNativePointerField<int*>(this, "AShooterGameState.NumActiveNPC"); }
-	int& NumDeadNPCField() { return *GetNativePointerField<int*>(this, "AShooterGameState.NumDeadNPC"); }
-	int& NumPlayerActorsField() { return *GetNativePointerField<int*>(this, "AShooterGameState.NumPlayerActors"); }
-	int& NumPlayerConnectedField() { return *GetNativePointerField<int*>(this, "AShooterGameState.NumPlayerConnected"); }
-	bool& bServerUseLocalizedChatField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bServerUseLocalizedChat"); }
-	float& LocalizedChatRadiusField() { return *GetNativePointerField<float*>(this, "AShooterGameState.LocalizedChatRadius"); }
-	float& LocalizedChatRadiusUnconsiousScaleField() { return *GetNativePointerField<float*>(this, "AShooterGameState.LocalizedChatRadiusUnconsiousScale"); }
-	float& ServerFramerateField() { return *GetNativePointerField<float*>(this, "AShooterGameState.ServerFramerate"); }
-	FString& NewStructureDestructionTagField() { return *GetNativePointerField<FString*>(this, "AShooterGameState.NewStructureDestructionTag"); }
-	int& DayNumberField() { return *GetNativePointerField<int*>(this, "AShooterGameState.DayNumber"); }
-	float& DayTimeField() { return *GetNativePointerField<float*>(this, "AShooterGameState.DayTime"); }
-	long double& NetworkTimeField() { return *GetNativePointerField<long double*>(this, "AShooterGameState.NetworkTime"); }
-	unsigned int& TimeUTCField() { return *GetNativePointerField<unsigned int*>(this, "AShooterGameState.TimeUTC"); }
-	bool& bIsOfficialServerField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bIsOfficialServer"); }
-	bool& bIsListenServerField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bIsListenServer"); }
-	bool& bIsDediServerField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bIsDediServer"); }
-	bool& bIsArkTributeAvailableField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bIsArkTributeAvailable"); }
-	bool& bIsArkDownloadsAllowedField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bIsArkDownloadsAllowed"); }
-	bool& bAllowThirdPersonPlayerField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bAllowThirdPersonPlayer"); }
-	bool& bServerHardcoreField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bServerHardcore"); }
-	bool& bServerPVEField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bServerPVE"); }
-	bool& bAutoPvEField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bAutoPvE"); }
-	bool& bServerCrosshairField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bServerCrosshair"); }
-	bool& bServerForceNoHUDField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bServerForceNoHUD"); }
-	bool& bFlyerPlatformAllowUnalignedDinoBasingField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bFlyerPlatformAllowUnalignedDinoBasing"); }
-	bool& bMapPlayerLocationField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bMapPlayerLocation"); }
-	bool& bPvEDisableFriendlyFireField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPvEDisableFriendlyFire"); }
-	bool& bPvEAllowTribeWarField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPvEAllowTribeWar"); }
-	bool& bPvEAllowTribeWarCancelField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPvEAllowTribeWarCancel"); }
-	bool& bEnablePvPGammaField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bEnablePvPGamma"); }
-	bool& bDisablePvEGammaField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bDisablePvEGamma"); }
-	int& NumTamedDinosField() { return *GetNativePointerField<int*>(this, "AShooterGameState.NumTamedDinos"); }
-	int& MaxStructuresInRangeField() { return *GetNativePointerField<int*>(this, "AShooterGameState.MaxStructuresInRange"); }
-	float& DayCycleSpeedScaleField() { return *GetNativePointerField<float*>(this, "AShooterGameState.DayCycleSpeedScale"); }
-	float& DayTimeSpeedScaleField() { return *GetNativePointerField<float*>(this, "AShooterGameState.DayTimeSpeedScale"); }
-	float& NightTimeSpeedScaleField() { return *GetNativePointerField<float*>(this, "AShooterGameState.NightTimeSpeedScale"); }
-	float& PvEStructureDecayPeriodMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameState.PvEStructureDecayPeriodMultiplier"); }
-	float& PvEDinoDecayPeriodMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameState.PvEDinoDecayPeriodMultiplier"); }
-	float& PerPlatformMaxStructuresMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameState.PerPlatformMaxStructuresMultiplier"); }
-	bool& bDisableStructureDecayPvEField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bDisableStructureDecayPvE"); }
-	bool& bDisableDinoDecayPvEField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bDisableDinoDecayPvE"); }
-	bool& bAllowCaveBuildingPvEField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bAllowCaveBuildingPvE"); }
-	bool& bPreventDownloadSurvivorsField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPreventDownloadSurvivors"); }
-	bool& bReachedPlatformStructureLimitField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bReachedPlatformStructureLimit"); }
-	bool& bAdminLoggingField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bAdminLogging"); }
-	bool& bPvPStructureDecayField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPvPStructureDecay"); }
-	bool& bPreventDownloadDinosField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPreventDownloadDinos"); }
-	bool& bPreventDownloadItemsField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPreventDownloadItems"); }
-	bool& bPreventUploadDinosField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPreventUploadDinos"); }
-	bool& bPreventUploadItemsField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPreventUploadItems"); }
-	bool& bPreventUploadSurvivorsField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPreventUploadSurvivors"); }
-	bool& bPreventMateBoostField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPreventMateBoost"); }
-	bool& bPreventStructurePaintingField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPreventStructurePainting"); }
-	bool& bAllowCharacterCreationField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bAllowCharacterCreation"); }
-	bool& bAllowSpawnPointSelectionField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bAllowSpawnPointSelection"); }
-	int& MaxTamedDinosField() { return *GetNativePointerField<int*>(this, "AShooterGameState.MaxTamedDinos"); }
-	bool& bDisableSpawnAnimationsField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bDisableSpawnAnimations"); }
-	FString& PlayerListStringField() { return *GetNativePointerField<FString*>(this, "AShooterGameState.PlayerListString"); }
-	float& GlobalSpoilingTimeMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameState.GlobalSpoilingTimeMultiplier"); }
-	float& GlobalItemDecompositionTimeMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameState.GlobalItemDecompositionTimeMultiplier"); }
-	int& MaxNumberOfPlayersInTribeField() { return *GetNativePointerField<int*>(this, "AShooterGameState.MaxNumberOfPlayersInTribe"); }
-	float& TribeSlotReuseCooldownField() { return *GetNativePointerField<float*>(this, "AShooterGameState.TribeSlotReuseCooldown"); }
-	float& GlobalCorpseDecompositionTimeMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameState.GlobalCorpseDecompositionTimeMultiplier"); }
-	float& EggHatchSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameState.EggHatchSpeedMultiplier"); }
-	FName& ActiveEventField() { return *GetNativePointerField<FName*>(this, "AShooterGameState.ActiveEvent"); }
-	bool& bAllowPaintingWithoutResourcesField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bAllowPaintingWithoutResources"); }
-	bool& bEnableExtraStructurePreventionVolumesField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bEnableExtraStructurePreventionVolumes"); }
-	//TArray<FItemCraftingCostOverride>& OverrideItemCraftingCostsField() { return *GetNativePointerField<TArray<FItemCraftingCostOverride>*>(this, "AShooterGameState.OverrideItemCraftingCosts"); }
-	long double& LastServerSaveTimeField() { return *GetNativePointerField<long double*>(this, "AShooterGameState.LastServerSaveTime"); }
-	float& ServerSaveIntervalField() { return *GetNativePointerField<float*>(this, "AShooterGameState.ServerSaveInterval"); }
-	float& TribeNameChangeCooldownField() { return *GetNativePointerField<float*>(this, "AShooterGameState.TribeNameChangeCooldown"); }
-	bool& bAllowHideDamageSourceFromLogsField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bAllowHideDamageSourceFromLogs"); }
-	UAudioComponent * DynamicMusicAudioComponentField() { return *GetNativePointerField<UAudioComponent **>(this, "AShooterGameState.DynamicMusicAudioComponent"); }
-	UAudioComponent * DynamicMusicAudioComponent2Field() { return *GetNativePointerField<UAudioComponent **>(this, "AShooterGameState.DynamicMusicAudioComponent2"); }
-	bool& bPlayingDynamicMusicField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPlayingDynamicMusic"); }
-	bool& bPlayingDynamicMusic1Field() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPlayingDynamicMusic1"); }
-	bool& bPlayingDynamicMusic2Field() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPlayingDynamicMusic2"); }
-	float& LastHadMusicTimeField() { return *GetNativePointerField<float*>(this, "AShooterGameState.LastHadMusicTime"); }
-	TArray<FLevelExperienceRamp>& LevelExperienceRampOverridesField() { return *GetNativePointerField<TArray<FLevelExperienceRamp>*>(this, "AShooterGameState.LevelExperienceRampOverrides"); }
-	//TArray<FEngramEntryOverride>& OverrideEngramEntriesField() { return *GetNativePointerField<TArray<FEngramEntryOverride>*>(this, "AShooterGameState.OverrideEngramEntries"); }
-	TArray<FString>& PreventDinoTameClassNamesField() { return *GetNativePointerField<TArray<FString>*>(this, "AShooterGameState.PreventDinoTameClassNames"); }
-	float& ListenServerTetherDistanceMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameState.ListenServerTetherDistanceMultiplier"); }
-	FString& PGMapNameField() { return *GetNativePointerField<FString*>(this, "AShooterGameState.PGMapName"); }
-	TArray<int>& SupportedSpawnRegionsField() { return *GetNativePointerField<TArray<int>*>(this, "AShooterGameState.SupportedSpawnRegions"); }
-	USoundBase * StaticOverrideMusicField() { return *GetNativePointerField<USoundBase **>(this, "AShooterGameState.StaticOverrideMusic"); }
-	bool& bEnableDeathTeamSpectatorField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bEnableDeathTeamSpectator"); }
-	FVector& PlayerFloatingHUDOffsetField() { return *GetNativePointerField<FVector*>(this, "AShooterGameState.PlayerFloatingHUDOffset"); }
-	float& PlayerFloatingHUDOffsetScreenYField() { return *GetNativePointerField<float*>(this, "AShooterGameState.PlayerFloatingHUDOffsetScreenY"); }
-	float& StructureDamageRepairCooldownField() { return *GetNativePointerField<float*>(this, "AShooterGameState.StructureDamageRepairCooldown"); }
-	bool& bForceAllStructureLockingField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bForceAllStructureLocking"); }
-	bool& bAllowCustomRecipesField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bAllowCustomRecipes"); }
-	bool& bAllowRaidDinoFeedingField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bAllowRaidDinoFeeding"); }
-	float& CustomRecipeEffectivenessMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameState.CustomRecipeEffectivenessMultiplier"); }
-	float& CustomRecipeSkillMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameState.CustomRecipeSkillMultiplier"); }
-	USoundBase * OverrideAreaMusicField() { return *GetNativePointerField<USoundBase **>(this, "AShooterGameState.OverrideAreaMusic"); }
-	FVector& OverrideAreaMusicPositionField() { return *GetNativePointerField<FVector*>(this, "AShooterGameState.OverrideAreaMusicPosition"); }
-	float& OverrideAreaMusicRangeField() { return *GetNativePointerField<float*>(this, "AShooterGameState.OverrideAreaMusicRange"); }
-	bool& bAllowUnclaimDinosField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bAllowUnclaimDinos"); }
-	float& FloatingHUDRangeField() { return *GetNativePointerField<float*>(this, "AShooterGameState.FloatingHUDRange"); }
-	float& FloatingChatRangeField() { return *GetNativePointerField<float*>(this, "AShooterGameState.FloatingChatRange"); }
-	int& ExtinctionEventTimeIntervalField() { return *GetNativePointerField<int*>(this, "AShooterGameState.ExtinctionEventTimeInterval"); }
-	float& ExtinctionEventPercentField() { return *GetNativePointerField<float*>(this, "AShooterGameState.ExtinctionEventPercent"); }
-	int& ExtinctionEventSecondsRemainingField() { return *GetNativePointerField<int*>(this, "AShooterGameState.ExtinctionEventSecondsRemaining"); }
-	bool& bDoExtinctionEventField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bDoExtinctionEvent"); }
-	bool& bPreventOfflinePvPField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPreventOfflinePvP"); }
-	bool& bPvPDinoDecayField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPvPDinoDecay"); }
-	bool& bAllowUnclaimDinosConfigField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bAllowUnclaimDinosConfig"); }
-	bool& bForceUseInventoryAppendsField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bForceUseInventoryAppends"); }
-	bool& bOverideStructurePlatformPreventionField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bOverideStructurePlatformPrevention"); }
-	TArray<int>& PreventOfflinePvPLiveTeamsField() { return *GetNativePointerField<TArray<int>*>(this, "AShooterGameState.PreventOfflinePvPLiveTeams"); }
-	TArray<int>& PreventOfflinePvPExpiringTeamsField() { return *GetNativePointerField<TArray<int>*>(this, "AShooterGameState.PreventOfflinePvPExpiringTeams"); }
-	TArray<double>& PreventOfflinePvPExpiringTimesField() { return *GetNativePointerField<TArray<double>*>(this, "AShooterGameState.PreventOfflinePvPExpiringTimes"); }
-	TMap<int, double, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, double, 0> >& PreventOfflinePvPLiveTimesField() { return *GetNativePointerField<TMap<int, double, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, double, 0> >*>(this, "AShooterGameState.PreventOfflinePvPLiveTimes"); }
-	TMap<int, double, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, double, 0> >& PreventOfflinePvPFirstLiveTimeField() { return *GetNativePointerField<TMap<int, double, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, double, 0> >*>(this, "AShooterGameState.PreventOfflinePvPFirstLiveTime"); }
-	bool& bAllowAnyoneBabyImprintCuddleField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bAllowAnyoneBabyImprintCuddle"); }
-	bool& bDisableImprintDinoBuffField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bDisableImprintDinoBuff"); }
-	int& MaxPersonalTamedDinosField() { return *GetNativePointerField<int*>(this, "AShooterGameState.MaxPersonalTamedDinos"); }
-	//TArray<FFloatingTextEntry>& FloatingTextEntriesField() { return *GetNativePointerField<TArray<FFloatingTextEntry>*>(this, "AShooterGameState.FloatingTextEntries"); }
-	bool& bIsCustomMapField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bIsCustomMap"); }
-	bool& bIsClientField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bIsClient"); }
-	bool& bIsDedicatedServerField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bIsDedicatedServer"); }
-	FString& ClusterIdField() { return *GetNativePointerField<FString*>(this, "AShooterGameState.ClusterId"); }
-	FString& AmazonS3AccessKeyIDField() { return *GetNativePointerField<FString*>(this, "AShooterGameState.AmazonS3AccessKeyID"); }
-	FString& AmazonS3SecretAccessKeyField() { return *GetNativePointerField<FString*>(this, "AShooterGameState.AmazonS3SecretAccessKey"); }
-	FString& AmazonS3BucketNameField() { return *GetNativePointerField<FString*>(this, "AShooterGameState.AmazonS3BucketName"); }
-	FString& ServerSessionNameField() { return *GetNativePointerField<FString*>(this, "AShooterGameState.ServerSessionName"); }
-	bool& bPreventTribeAlliancesField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPreventTribeAlliances"); }
-	FString& LoadForceRespawnDinosTagField() { return *GetNativePointerField<FString*>(this, "AShooterGameState.LoadForceRespawnDinosTag"); }
-	bool& bOnlyDecayUnsnappedCoreStructuresField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bOnlyDecayUnsnappedCoreStructures"); }
-	bool& bFastDecayUnsnappedCoreStructuresField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bFastDecayUnsnappedCoreStructures"); }
-	bool& bServerUseDinoListField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bServerUseDinoList"); }
-	bool& bPvEAllowStructuresAtSupplyDropsField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPvEAllowStructuresAtSupplyDrops"); }
-	bool& bAllowForceNetUpdateField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bAllowForceNetUpdate"); }
-	float& MinimumDinoReuploadIntervalField() { return *GetNativePointerField<float*>(this, "AShooterGameState.MinimumDinoReuploadInterval"); }
-	float& HairGrowthSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameState.HairGrowthSpeedMultiplier"); }
-	float& FastDecayIntervalField() { return *GetNativePointerField<float*>(this, "AShooterGameState.FastDecayInterval"); }
-	float& OxygenSwimSpeedStatMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameState.OxygenSwimSpeedStatMultiplier"); }
-	bool& bAllowMultipleAttachedC4Field() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bAllowMultipleAttachedC4"); }
-	bool& bCrossARKAllowForeignDinoDownloadsField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bCrossARKAllowForeignDinoDownloads"); }
-	long double& LastPlayedDynamicMusic1Field() { return *GetNativePointerField<long double*>(this, "AShooterGameState.LastPlayedDynamicMusic1"); }
-	long double& LastPlayedDynamicMusic2Field() { return *GetNativePointerField<long double*>(this, "AShooterGameState.LastPlayedDynamicMusic2"); }
-	bool& bUseCorpseLocatorField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bUseCorpseLocator"); }
-	bool& bDisableStructurePlacementCollisionField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bDisableStructurePlacementCollision"); }
-	bool& bUseSingleplayerSettingsField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bUseSingleplayerSettings"); }
-	bool& bAllowPlatformSaddleMultiFloorsField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bAllowPlatformSaddleMultiFloors"); }
-	bool& bPreventSpawnAnimationsField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bPreventSpawnAnimations"); }
-	int& MaxAlliancesPerTribeField() { return *GetNativePointerField<int*>(this, "AShooterGameState.MaxAlliancesPerTribe"); }
-	int& MaxTribesPerAllianceField() { return *GetNativePointerField<int*>(this, "AShooterGameState.MaxTribesPerAlliance"); }
-	bool& bIsLegacyServerField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bIsLegacyServer"); }
-	bool& bDisableDinoDecayClaimingField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bDisableDinoDecayClaiming"); }
-	FName& UseStructurePreventionVolumeTagField() { return *GetNativePointerField<FName*>(this, "AShooterGameState.UseStructurePreventionVolumeTag"); }
-	int& MaxStructuresInSmallRadiusField() { return *GetNativePointerField<int*>(this, "AShooterGameState.MaxStructuresInSmallRadius"); }
-	float& RadiusStructuresInSmallRadiusField() { return *GetNativePointerField<float*>(this, "AShooterGameState.RadiusStructuresInSmallRadius"); }
-	bool& bUseTameLimitForStructuresOnlyField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bUseTameLimitForStructuresOnly"); }
-	bool& bLimitTurretsInRangeField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bLimitTurretsInRange"); }
-	float& LimitTurretsRangeField() { return *GetNativePointerField<float*>(this, "AShooterGameState.LimitTurretsRange"); }
-	int& LimitTurretsNumField() { return *GetNativePointerField<int*>(this, "AShooterGameState.LimitTurretsNum"); }
-	bool& bForceAllowAllStructuresField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bForceAllowAllStructures"); }
-	bool& bShowCreativeModeField() { return *GetNativePointerField<bool*>(this, "AShooterGameState.bShowCreativeMode"); }
-	//TArray<FPlayerLocatorEffectMap>& PlayerLocatorEffectMapsField() { return *GetNativePointerField<TArray<FPlayerLocatorEffectMap>*>(this, "AShooterGameState.PlayerLocatorEffectMaps"); }
-	int& AmbientSoundCheckIncrementField() { return *GetNativePointerField<int*>(this, "AShooterGameState.AmbientSoundCheckIncrement"); }
-	float& PreventOfflinePvPConnectionInvincibleIntervalField() { return *GetNativePointerField<float*>(this, "AShooterGameState.PreventOfflinePvPConnectionInvincibleInterval"); }
-	float& PassiveTameIntervalMultiplierField() { return *GetNativePointerField<float*>(this, "AShooterGameState.PassiveTameIntervalMultiplier"); }
-	TArray<TSubclassOf<APrimalDinoCharacter>>& UniqueDinosField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalDinoCharacter>>*>(this, "AShooterGameState.UniqueDinos"); }
-	unsigned int& MinimumUniqueDownloadIntervalField() { return *GetNativePointerField<unsigned int*>(this, "AShooterGameState.MinimumUniqueDownloadInterval"); }
-	unsigned int& MaximumUniqueDownloadIntervalField() { return *GetNativePointerField<unsigned int*>(this, "AShooterGameState.MaximumUniqueDownloadInterval"); }
+	int& NumNPCField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.NumNPC")>(this, "AShooterGameState.NumNPC"); }
+	int& NumHibernatedNPCField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.NumHibernatedNPC")>(this, "AShooterGameState.NumHibernatedNPC"); }
+	int& NumActiveNPCField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.NumActiveNPC")>(this, "AShooterGameState.NumActiveNPC"); }
+	int& NumDeadNPCField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.NumDeadNPC")>(this, "AShooterGameState.NumDeadNPC"); }
+	int& NumPlayerActorsField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.NumPlayerActors")>(this, "AShooterGameState.NumPlayerActors"); }
+	int& NumPlayerConnectedField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.NumPlayerConnected")>(this, "AShooterGameState.NumPlayerConnected"); }
+	bool& bServerUseLocalizedChatField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bServerUseLocalizedChat")>(this, "AShooterGameState.bServerUseLocalizedChat"); }
+	float& LocalizedChatRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.LocalizedChatRadius")>(this, "AShooterGameState.LocalizedChatRadius"); }
+	float& LocalizedChatRadiusUnconsiousScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.LocalizedChatRadiusUnconsiousScale")>(this, "AShooterGameState.LocalizedChatRadiusUnconsiousScale"); }
+	float& ServerFramerateField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.ServerFramerate")>(this, "AShooterGameState.ServerFramerate"); }
+	FString& NewStructureDestructionTagField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameState.NewStructureDestructionTag")>(this, "AShooterGameState.NewStructureDestructionTag"); }
+	int& DayNumberField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.DayNumber")>(this, "AShooterGameState.DayNumber"); }
+	float& DayTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.DayTime")>(this, "AShooterGameState.DayTime"); }
+	long double& NetworkTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterGameState.NetworkTime")>(this, "AShooterGameState.NetworkTime"); }
+	unsigned int& TimeUTCField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("AShooterGameState.TimeUTC")>(this, "AShooterGameState.TimeUTC"); }
+	bool& bIsOfficialServerField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bIsOfficialServer")>(this, "AShooterGameState.bIsOfficialServer"); }
+	bool& bIsListenServerField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bIsListenServer")>(this, "AShooterGameState.bIsListenServer"); }
+	bool& bIsDediServerField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bIsDediServer")>(this, "AShooterGameState.bIsDediServer"); }
+	bool& bIsArkTributeAvailableField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bIsArkTributeAvailable")>(this, "AShooterGameState.bIsArkTributeAvailable"); }
+	bool& bIsArkDownloadsAllowedField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bIsArkDownloadsAllowed")>(this, "AShooterGameState.bIsArkDownloadsAllowed"); }
+	bool& bAllowThirdPersonPlayerField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bAllowThirdPersonPlayer")>(this, "AShooterGameState.bAllowThirdPersonPlayer"); }
+	bool& bServerHardcoreField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bServerHardcore")>(this, "AShooterGameState.bServerHardcore"); }
+	bool& bServerPVEField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bServerPVE")>(this, "AShooterGameState.bServerPVE"); }
+	bool& bAutoPvEField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bAutoPvE")>(this, "AShooterGameState.bAutoPvE"); }
+	bool& bServerCrosshairField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bServerCrosshair")>(this, "AShooterGameState.bServerCrosshair"); }
+	bool& bServerForceNoHUDField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bServerForceNoHUD")>(this, "AShooterGameState.bServerForceNoHUD"); }
+	bool& bFlyerPlatformAllowUnalignedDinoBasingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bFlyerPlatformAllowUnalignedDinoBasing")>(this, "AShooterGameState.bFlyerPlatformAllowUnalignedDinoBasing"); }
+	bool& bMapPlayerLocationField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bMapPlayerLocation")>(this, "AShooterGameState.bMapPlayerLocation"); }
+	bool& bPvEDisableFriendlyFireField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPvEDisableFriendlyFire")>(this, "AShooterGameState.bPvEDisableFriendlyFire"); }
+	bool& bPvEAllowTribeWarField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPvEAllowTribeWar")>(this, "AShooterGameState.bPvEAllowTribeWar"); }
+	bool& bPvEAllowTribeWarCancelField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPvEAllowTribeWarCancel")>(this, "AShooterGameState.bPvEAllowTribeWarCancel"); }
+	bool& bEnablePvPGammaField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bEnablePvPGamma")>(this, "AShooterGameState.bEnablePvPGamma"); }
+	bool& bDisablePvEGammaField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bDisablePvEGamma")>(this, "AShooterGameState.bDisablePvEGamma"); }
+	int& NumTamedDinosField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.NumTamedDinos")>(this, "AShooterGameState.NumTamedDinos"); }
+	int& MaxStructuresInRangeField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.MaxStructuresInRange")>(this, "AShooterGameState.MaxStructuresInRange"); }
+	float& DayCycleSpeedScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.DayCycleSpeedScale")>(this, "AShooterGameState.DayCycleSpeedScale"); }
+	float& DayTimeSpeedScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.DayTimeSpeedScale")>(this, "AShooterGameState.DayTimeSpeedScale"); }
+	float& NightTimeSpeedScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.NightTimeSpeedScale")>(this, "AShooterGameState.NightTimeSpeedScale"); }
+	float& PvEStructureDecayPeriodMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.PvEStructureDecayPeriodMultiplier")>(this, "AShooterGameState.PvEStructureDecayPeriodMultiplier"); }
+	float& PvEDinoDecayPeriodMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.PvEDinoDecayPeriodMultiplier")>(this, "AShooterGameState.PvEDinoDecayPeriodMultiplier"); }
+	float& PerPlatformMaxStructuresMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.PerPlatformMaxStructuresMultiplier")>(this, "AShooterGameState.PerPlatformMaxStructuresMultiplier"); }
+	bool& bDisableStructureDecayPvEField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bDisableStructureDecayPvE")>(this, "AShooterGameState.bDisableStructureDecayPvE"); }
+	bool& bDisableDinoDecayPvEField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bDisableDinoDecayPvE")>(this, "AShooterGameState.bDisableDinoDecayPvE"); }
+	bool& bAllowCaveBuildingPvEField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bAllowCaveBuildingPvE")>(this, "AShooterGameState.bAllowCaveBuildingPvE"); }
+	bool& bPreventDownloadSurvivorsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPreventDownloadSurvivors")>(this, "AShooterGameState.bPreventDownloadSurvivors"); }
+	bool& bReachedPlatformStructureLimitField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bReachedPlatformStructureLimit")>(this, "AShooterGameState.bReachedPlatformStructureLimit"); }
+	bool& bAdminLoggingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bAdminLogging")>(this, "AShooterGameState.bAdminLogging"); }
+	bool& bPvPStructureDecayField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPvPStructureDecay")>(this, "AShooterGameState.bPvPStructureDecay"); }
+	bool& bPreventDownloadDinosField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPreventDownloadDinos")>(this, "AShooterGameState.bPreventDownloadDinos"); }
+	bool& bPreventDownloadItemsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPreventDownloadItems")>(this, "AShooterGameState.bPreventDownloadItems"); }
+	bool& bPreventUploadDinosField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPreventUploadDinos")>(this, "AShooterGameState.bPreventUploadDinos"); }
+	bool& bPreventUploadItemsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPreventUploadItems")>(this, "AShooterGameState.bPreventUploadItems"); }
+	bool& bPreventUploadSurvivorsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPreventUploadSurvivors")>(this, "AShooterGameState.bPreventUploadSurvivors"); }
+	bool& bPreventMateBoostField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPreventMateBoost")>(this, "AShooterGameState.bPreventMateBoost"); }
+	bool& bPreventStructurePaintingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPreventStructurePainting")>(this, "AShooterGameState.bPreventStructurePainting"); }
+	bool& bAllowCharacterCreationField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bAllowCharacterCreation")>(this, "AShooterGameState.bAllowCharacterCreation"); }
+	bool& bAllowSpawnPointSelectionField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bAllowSpawnPointSelection")>(this, "AShooterGameState.bAllowSpawnPointSelection"); }
+	int& MaxTamedDinosField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.MaxTamedDinos")>(this, "AShooterGameState.MaxTamedDinos"); }
+	bool& bDisableSpawnAnimationsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bDisableSpawnAnimations")>(this, "AShooterGameState.bDisableSpawnAnimations"); }
+	FString& PlayerListStringField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameState.PlayerListString")>(this, "AShooterGameState.PlayerListString"); }
+	float& GlobalSpoilingTimeMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.GlobalSpoilingTimeMultiplier")>(this, "AShooterGameState.GlobalSpoilingTimeMultiplier"); }
+	float& GlobalItemDecompositionTimeMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.GlobalItemDecompositionTimeMultiplier")>(this, "AShooterGameState.GlobalItemDecompositionTimeMultiplier"); }
+	int& MaxNumberOfPlayersInTribeField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.MaxNumberOfPlayersInTribe")>(this, "AShooterGameState.MaxNumberOfPlayersInTribe"); }
+	float& TribeSlotReuseCooldownField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.TribeSlotReuseCooldown")>(this, "AShooterGameState.TribeSlotReuseCooldown"); }
+	float& GlobalCorpseDecompositionTimeMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.GlobalCorpseDecompositionTimeMultiplier")>(this, "AShooterGameState.GlobalCorpseDecompositionTimeMultiplier"); }
+	float& EggHatchSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.EggHatchSpeedMultiplier")>(this, "AShooterGameState.EggHatchSpeedMultiplier"); }
+	FName& ActiveEventField() { return *GetNativePointerField<FName*, API::FieldNameHash("AShooterGameState.ActiveEvent")>(this, "AShooterGameState.ActiveEvent"); }
+	bool& bAllowPaintingWithoutResourcesField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bAllowPaintingWithoutResources")>(this, "AShooterGameState.bAllowPaintingWithoutResources"); }
+	bool& bEnableExtraStructurePreventionVolumesField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bEnableExtraStructurePreventionVolumes")>(this, "AShooterGameState.bEnableExtraStructurePreventionVolumes"); }
+	//TArray<FItemCraftingCostOverride>& OverrideItemCraftingCostsField() { return *GetNativePointerField<TArray<FItemCraftingCostOverride>*, API::FieldNameHash("AShooterGameState.OverrideItemCraftingCosts")>(this, "AShooterGameState.OverrideItemCraftingCosts"); }
+	long double& LastServerSaveTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterGameState.LastServerSaveTime")>(this, "AShooterGameState.LastServerSaveTime"); }
+	float& ServerSaveIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.ServerSaveInterval")>(this, "AShooterGameState.ServerSaveInterval"); }
+	float& TribeNameChangeCooldownField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.TribeNameChangeCooldown")>(this, "AShooterGameState.TribeNameChangeCooldown"); }
+	bool& bAllowHideDamageSourceFromLogsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bAllowHideDamageSourceFromLogs")>(this, "AShooterGameState.bAllowHideDamageSourceFromLogs"); }
+	UAudioComponent * DynamicMusicAudioComponentField() { return *GetNativePointerField<UAudioComponent **, API::FieldNameHash("AShooterGameState.DynamicMusicAudioComponent")>(this, "AShooterGameState.DynamicMusicAudioComponent"); }
+	UAudioComponent * DynamicMusicAudioComponent2Field() { return *GetNativePointerField<UAudioComponent **, API::FieldNameHash("AShooterGameState.DynamicMusicAudioComponent2")>(this, "AShooterGameState.DynamicMusicAudioComponent2"); }
+	bool& bPlayingDynamicMusicField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPlayingDynamicMusic")>(this, "AShooterGameState.bPlayingDynamicMusic"); }
+	bool& bPlayingDynamicMusic1Field() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPlayingDynamicMusic1")>(this, "AShooterGameState.bPlayingDynamicMusic1"); }
+	bool& bPlayingDynamicMusic2Field() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPlayingDynamicMusic2")>(this, "AShooterGameState.bPlayingDynamicMusic2"); }
+	float& LastHadMusicTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.LastHadMusicTime")>(this, "AShooterGameState.LastHadMusicTime"); }
+	TArray<FLevelExperienceRamp>& LevelExperienceRampOverridesField() { return *GetNativePointerField<TArray<FLevelExperienceRamp>*, API::FieldNameHash("AShooterGameState.LevelExperienceRampOverrides")>(this, "AShooterGameState.LevelExperienceRampOverrides"); }
+	//TArray<FEngramEntryOverride>& OverrideEngramEntriesField() { return *GetNativePointerField<TArray<FEngramEntryOverride>*, API::FieldNameHash("AShooterGameState.OverrideEngramEntries")>(this, "AShooterGameState.OverrideEngramEntries"); }
+	TArray<FString>& PreventDinoTameClassNamesField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("AShooterGameState.PreventDinoTameClassNames")>(this, "AShooterGameState.PreventDinoTameClassNames"); }
+	float& ListenServerTetherDistanceMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.ListenServerTetherDistanceMultiplier")>(this, "AShooterGameState.ListenServerTetherDistanceMultiplier"); }
+	FString& PGMapNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameState.PGMapName")>(this, "AShooterGameState.PGMapName"); }
+	TArray<int>& SupportedSpawnRegionsField() { return *GetNativePointerField<TArray<int>*, API::FieldNameHash("AShooterGameState.SupportedSpawnRegions")>(this, "AShooterGameState.SupportedSpawnRegions"); }
+	USoundBase * StaticOverrideMusicField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("AShooterGameState.StaticOverrideMusic")>(this, "AShooterGameState.StaticOverrideMusic"); }
+	bool& bEnableDeathTeamSpectatorField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bEnableDeathTeamSpectator")>(this, "AShooterGameState.bEnableDeathTeamSpectator"); }
+	FVector& PlayerFloatingHUDOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterGameState.PlayerFloatingHUDOffset")>(this, "AShooterGameState.PlayerFloatingHUDOffset"); }
+	float& PlayerFloatingHUDOffsetScreenYField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.PlayerFloatingHUDOffsetScreenY")>(this, "AShooterGameState.PlayerFloatingHUDOffsetScreenY"); }
+	float& StructureDamageRepairCooldownField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.StructureDamageRepairCooldown")>(this, "AShooterGameState.StructureDamageRepairCooldown"); }
+	bool& bForceAllStructureLockingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bForceAllStructureLocking")>(this, "AShooterGameState.bForceAllStructureLocking"); }
+	bool& bAllowCustomRecipesField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bAllowCustomRecipes")>(this, "AShooterGameState.bAllowCustomRecipes"); }
+	bool& bAllowRaidDinoFeedingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bAllowRaidDinoFeeding")>(this, "AShooterGameState.bAllowRaidDinoFeeding"); }
+	float& CustomRecipeEffectivenessMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.CustomRecipeEffectivenessMultiplier")>(this, "AShooterGameState.CustomRecipeEffectivenessMultiplier"); }
+	float& CustomRecipeSkillMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.CustomRecipeSkillMultiplier")>(this, "AShooterGameState.CustomRecipeSkillMultiplier"); }
+	USoundBase * OverrideAreaMusicField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("AShooterGameState.OverrideAreaMusic")>(this, "AShooterGameState.OverrideAreaMusic"); }
+	FVector& OverrideAreaMusicPositionField() { return *GetNativePointerField<FVector*, API::FieldNameHash("AShooterGameState.OverrideAreaMusicPosition")>(this, "AShooterGameState.OverrideAreaMusicPosition"); }
+	float& OverrideAreaMusicRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.OverrideAreaMusicRange")>(this, "AShooterGameState.OverrideAreaMusicRange"); }
+	bool& bAllowUnclaimDinosField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bAllowUnclaimDinos")>(this, "AShooterGameState.bAllowUnclaimDinos"); }
+	float& FloatingHUDRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.FloatingHUDRange")>(this, "AShooterGameState.FloatingHUDRange"); }
+	float& FloatingChatRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.FloatingChatRange")>(this, "AShooterGameState.FloatingChatRange"); }
+	int& ExtinctionEventTimeIntervalField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.ExtinctionEventTimeInterval")>(this, "AShooterGameState.ExtinctionEventTimeInterval"); }
+	float& ExtinctionEventPercentField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.ExtinctionEventPercent")>(this, "AShooterGameState.ExtinctionEventPercent"); }
+	int& ExtinctionEventSecondsRemainingField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.ExtinctionEventSecondsRemaining")>(this, "AShooterGameState.ExtinctionEventSecondsRemaining"); }
+	bool& bDoExtinctionEventField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bDoExtinctionEvent")>(this, "AShooterGameState.bDoExtinctionEvent"); }
+	bool& bPreventOfflinePvPField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPreventOfflinePvP")>(this, "AShooterGameState.bPreventOfflinePvP"); }
+	bool& bPvPDinoDecayField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPvPDinoDecay")>(this, "AShooterGameState.bPvPDinoDecay"); }
+	bool& bAllowUnclaimDinosConfigField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bAllowUnclaimDinosConfig")>(this, "AShooterGameState.bAllowUnclaimDinosConfig"); }
+	bool& bForceUseInventoryAppendsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bForceUseInventoryAppends")>(this, "AShooterGameState.bForceUseInventoryAppends"); }
+	bool& bOverideStructurePlatformPreventionField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bOverideStructurePlatformPrevention")>(this, "AShooterGameState.bOverideStructurePlatformPrevention"); }
+	TArray<int>& PreventOfflinePvPLiveTeamsField() { return *GetNativePointerField<TArray<int>*, API::FieldNameHash("AShooterGameState.PreventOfflinePvPLiveTeams")>(this, "AShooterGameState.PreventOfflinePvPLiveTeams"); }
+	TArray<int>& PreventOfflinePvPExpiringTeamsField() { return *GetNativePointerField<TArray<int>*, API::FieldNameHash("AShooterGameState.PreventOfflinePvPExpiringTeams")>(this, "AShooterGameState.PreventOfflinePvPExpiringTeams"); }
+	TArray<double>& PreventOfflinePvPExpiringTimesField() { return *GetNativePointerField<TArray<double>*, API::FieldNameHash("AShooterGameState.PreventOfflinePvPExpiringTimes")>(this, "AShooterGameState.PreventOfflinePvPExpiringTimes"); }
+	TMap<int, double, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, double, 0> >& PreventOfflinePvPLiveTimesField() { return *GetNativePointerField<TMap<int, double, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, double, 0> >*, API::FieldNameHash("AShooterGameState.PreventOfflinePvPLiveTimes")>(this, "AShooterGameState.PreventOfflinePvPLiveTimes"); }
+	TMap<int, double, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, double, 0> >& PreventOfflinePvPFirstLiveTimeField() { return *GetNativePointerField<TMap<int, double, FDefaultSetAllocator, TDefaultMapKeyFuncs<int, double, 0> >*, API::FieldNameHash("AShooterGameState.PreventOfflinePvPFirstLiveTime")>(this, "AShooterGameState.PreventOfflinePvPFirstLiveTime"); }
+	bool& bAllowAnyoneBabyImprintCuddleField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bAllowAnyoneBabyImprintCuddle")>(this, "AShooterGameState.bAllowAnyoneBabyImprintCuddle"); }
+	bool& bDisableImprintDinoBuffField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bDisableImprintDinoBuff")>(this, "AShooterGameState.bDisableImprintDinoBuff"); }
+	int& MaxPersonalTamedDinosField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.MaxPersonalTamedDinos")>(this, "AShooterGameState.MaxPersonalTamedDinos"); }
+	//TArray<FFloatingTextEntry>& FloatingTextEntriesField() { return *GetNativePointerField<TArray<FFloatingTextEntry>*, API::FieldNameHash("AShooterGameState.FloatingTextEntries")>(this, "AShooterGameState.FloatingTextEntries"); }
+	bool& bIsCustomMapField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bIsCustomMap")>(this, "AShooterGameState.bIsCustomMap"); }
+	bool& bIsClientField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bIsClient")>(this, "AShooterGameState.bIsClient"); }
+	bool& bIsDedicatedServerField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bIsDedicatedServer")>(this, "AShooterGameState.bIsDedicatedServer"); }
+	FString& ClusterIdField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameState.ClusterId")>(this, "AShooterGameState.ClusterId"); }
+	FString& AmazonS3AccessKeyIDField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameState.AmazonS3AccessKeyID")>(this, "AShooterGameState.AmazonS3AccessKeyID"); }
+	FString& AmazonS3SecretAccessKeyField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameState.AmazonS3SecretAccessKey")>(this, "AShooterGameState.AmazonS3SecretAccessKey"); }
+	FString& AmazonS3BucketNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameState.AmazonS3BucketName")>(this, "AShooterGameState.AmazonS3BucketName"); }
+	FString& ServerSessionNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameState.ServerSessionName")>(this, "AShooterGameState.ServerSessionName"); }
+	bool& bPreventTribeAlliancesField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPreventTribeAlliances")>(this, "AShooterGameState.bPreventTribeAlliances"); }
+	FString& LoadForceRespawnDinosTagField() { return *GetNativePointerField<FString*, API::FieldNameHash("AShooterGameState.LoadForceRespawnDinosTag")>(this, "AShooterGameState.LoadForceRespawnDinosTag"); }
+	bool& bOnlyDecayUnsnappedCoreStructuresField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bOnlyDecayUnsnappedCoreStructures")>(this, "AShooterGameState.bOnlyDecayUnsnappedCoreStructures"); }
+	bool& bFastDecayUnsnappedCoreStructuresField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bFastDecayUnsnappedCoreStructures")>(this, "AShooterGameState.bFastDecayUnsnappedCoreStructures"); }
+	bool& bServerUseDinoListField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bServerUseDinoList")>(this, "AShooterGameState.bServerUseDinoList"); }
+	bool& bPvEAllowStructuresAtSupplyDropsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPvEAllowStructuresAtSupplyDrops")>(this, "AShooterGameState.bPvEAllowStructuresAtSupplyDrops"); }
+	bool& bAllowForceNetUpdateField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bAllowForceNetUpdate")>(this, "AShooterGameState.bAllowForceNetUpdate"); }
+	float& MinimumDinoReuploadIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.MinimumDinoReuploadInterval")>(this, "AShooterGameState.MinimumDinoReuploadInterval"); }
+	float& HairGrowthSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.HairGrowthSpeedMultiplier")>(this, "AShooterGameState.HairGrowthSpeedMultiplier"); }
+	float& FastDecayIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.FastDecayInterval")>(this, "AShooterGameState.FastDecayInterval"); }
+	float& OxygenSwimSpeedStatMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.OxygenSwimSpeedStatMultiplier")>(this, "AShooterGameState.OxygenSwimSpeedStatMultiplier"); }
+	bool& bAllowMultipleAttachedC4Field() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bAllowMultipleAttachedC4")>(this, "AShooterGameState.bAllowMultipleAttachedC4"); }
+	bool& bCrossARKAllowForeignDinoDownloadsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bCrossARKAllowForeignDinoDownloads")>(this, "AShooterGameState.bCrossARKAllowForeignDinoDownloads"); }
+	long double& LastPlayedDynamicMusic1Field() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterGameState.LastPlayedDynamicMusic1")>(this, "AShooterGameState.LastPlayedDynamicMusic1"); }
+	long double& LastPlayedDynamicMusic2Field() { return *GetNativePointerField<long double*, API::FieldNameHash("AShooterGameState.LastPlayedDynamicMusic2")>(this, "AShooterGameState.LastPlayedDynamicMusic2"); }
+	bool& bUseCorpseLocatorField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bUseCorpseLocator")>(this, "AShooterGameState.bUseCorpseLocator"); }
+	bool& bDisableStructurePlacementCollisionField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bDisableStructurePlacementCollision")>(this, "AShooterGameState.bDisableStructurePlacementCollision"); }
+	bool& bUseSingleplayerSettingsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bUseSingleplayerSettings")>(this, "AShooterGameState.bUseSingleplayerSettings"); }
+	bool& bAllowPlatformSaddleMultiFloorsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bAllowPlatformSaddleMultiFloors")>(this, "AShooterGameState.bAllowPlatformSaddleMultiFloors"); }
+	bool& bPreventSpawnAnimationsField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bPreventSpawnAnimations")>(this, "AShooterGameState.bPreventSpawnAnimations"); }
+	int& MaxAlliancesPerTribeField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.MaxAlliancesPerTribe")>(this, "AShooterGameState.MaxAlliancesPerTribe"); }
+	int& MaxTribesPerAllianceField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.MaxTribesPerAlliance")>(this, "AShooterGameState.MaxTribesPerAlliance"); }
+	bool& bIsLegacyServerField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bIsLegacyServer")>(this, "AShooterGameState.bIsLegacyServer"); }
+	bool& bDisableDinoDecayClaimingField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bDisableDinoDecayClaiming")>(this, "AShooterGameState.bDisableDinoDecayClaiming"); }
+	FName& UseStructurePreventionVolumeTagField() { return *GetNativePointerField<FName*, API::FieldNameHash("AShooterGameState.UseStructurePreventionVolumeTag")>(this, "AShooterGameState.UseStructurePreventionVolumeTag"); }
+	int& MaxStructuresInSmallRadiusField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.MaxStructuresInSmallRadius")>(this, "AShooterGameState.MaxStructuresInSmallRadius"); }
+	float& RadiusStructuresInSmallRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.RadiusStructuresInSmallRadius")>(this, "AShooterGameState.RadiusStructuresInSmallRadius"); }
+	bool& bUseTameLimitForStructuresOnlyField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bUseTameLimitForStructuresOnly")>(this, "AShooterGameState.bUseTameLimitForStructuresOnly"); }
+	bool& bLimitTurretsInRangeField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bLimitTurretsInRange")>(this, "AShooterGameState.bLimitTurretsInRange"); }
+	float& LimitTurretsRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.LimitTurretsRange")>(this, "AShooterGameState.LimitTurretsRange"); }
+	int& LimitTurretsNumField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.LimitTurretsNum")>(this, "AShooterGameState.LimitTurretsNum"); }
+	bool& bForceAllowAllStructuresField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bForceAllowAllStructures")>(this, "AShooterGameState.bForceAllowAllStructures"); }
+	bool& bShowCreativeModeField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameState.bShowCreativeMode")>(this, "AShooterGameState.bShowCreativeMode"); }
+	//TArray<FPlayerLocatorEffectMap>& PlayerLocatorEffectMapsField() { return *GetNativePointerField<TArray<FPlayerLocatorEffectMap>*, API::FieldNameHash("AShooterGameState.PlayerLocatorEffectMaps")>(this, "AShooterGameState.PlayerLocatorEffectMaps"); }
+	int& AmbientSoundCheckIncrementField() { return *GetNativePointerField<int*, API::FieldNameHash("AShooterGameState.AmbientSoundCheckIncrement")>(this, "AShooterGameState.AmbientSoundCheckIncrement"); }
+	float& PreventOfflinePvPConnectionInvincibleIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.PreventOfflinePvPConnectionInvincibleInterval")>(this, "AShooterGameState.PreventOfflinePvPConnectionInvincibleInterval"); }
+	float& PassiveTameIntervalMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("AShooterGameState.PassiveTameIntervalMultiplier")>(this, "AShooterGameState.PassiveTameIntervalMultiplier"); }
+	TArray<TSubclassOf<APrimalDinoCharacter>>& UniqueDinosField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalDinoCharacter>>*, API::FieldNameHash("AShooterGameState.UniqueDinos")>(this, "AShooterGameState.UniqueDinos"); }
+	unsigned int& MinimumUniqueDownloadIntervalField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("AShooterGameState.MinimumUniqueDownloadInterval")>(this, "AShooterGameState.MinimumUniqueDownloadInterval"); }
+	unsigned int& MaximumUniqueDownloadIntervalField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("AShooterGameState.MaximumUniqueDownloadInterval")>(this, "AShooterGameState.MaximumUniqueDownloadInterval"); }
 
 	// Functions
 
@@ -265,11 +265,11 @@ struct AShooterGameState : AGameState
 
 struct AGameSession
 {
-	int& MaxSpectatorsField() { return *GetNativePointerField<int*>(this, "AGameSession.MaxSpectators"); }
-	int& MaxPlayersField() { return *GetNativePointerField<int*>(this, "AGameSession.MaxPlayers"); }
-	char& MaxSplitscreensPerConnectionField() { return *GetNativePointerField<char*>(this, "AGameSession.MaxSplitscreensPerConnection"); }
-	bool& bRequiresPushToTalkField() { return *GetNativePointerField<bool*>(this, "AGameSession.bRequiresPushToTalk"); }
-	FName& SessionNameField() { return *GetNativePointerField<FName*>(this, "AGameSession.SessionName"); }
+	int& MaxSpectatorsField() { return *GetNativePointerField<int*, API::FieldNameHash("AGameSession.MaxSpectators")>(this, "AGameSession.MaxSpectators"); }
+	int& MaxPlayersField() { return *GetNativePointerField<int*, API::FieldNameHash("AGameSession.MaxPlayers")>(this, "AGameSession.MaxPlayers"); }
+	char& MaxSplitscreensPerConnectionField() { return *GetNativePointerField<char*, API::FieldNameHash("AGameSession.MaxSplitscreensPerConnection")>(this, "AGameSession.MaxSplitscreensPerConnection"); }
+	bool& bRequiresPushToTalkField() { return *GetNativePointerField<bool*, API::FieldNameHash("AGameSession.bRequiresPushToTalk")>(this, "AGameSession.bRequiresPushToTalk"); }
+	FName& SessionNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("AGameSession.SessionName")>(this, "AGameSession.SessionName"); }
 
 	// Functions
 
@@ -291,9 +291,9 @@ struct AGameSession
 
 struct AShooterGameSession : AGameSession
 {
-	TArray<UNetConnection *> FailedAuthTokenClientConnectionsField() { return *GetNativePointerField<TArray<UNetConnection *>*>(this, "AShooterGameSession.FailedAuthTokenClientConnections"); }
-	TArray<FUniqueNetIdUInt64>& FailedAuthTokenClientUniqueIDsField() { return *GetNativePointerField<TArray<FUniqueNetIdUInt64>*>(this, "AShooterGameSession.FailedAuthTokenClientUniqueIDs"); }
-	bool& bFoundSessionField() { return *GetNativePointerField<bool*>(this, "AShooterGameSession.bFoundSession"); }
+	TArray<UNetConnection *> FailedAuthTokenClientConnectionsField() { return *GetNativePointerField<TArray<UNetConnection *>*, API::FieldNameHash("AShooterGameSession.FailedAuthTokenClientConnections")>(this, "AShooterGameSession.FailedAuthTokenClientConnections"); }
+	TArray<FUniqueNetIdUInt64>& FailedAuthTokenClientUniqueIDsField() { return *GetNativePointerField<TArray<FUniqueNetIdUInt64>*, API::FieldNameHash("AShooterGameSession.FailedAuthTokenClientUniqueIDs")>(this, "AShooterGameSession.FailedAuthTokenClientUniqueIDs"); }
+	bool& bFoundSessionField() { return *GetNativePointerField<bool*, API::FieldNameHash("AShooterGameSession.bFoundSession")>(this, "AShooterGameSession.bFoundSession"); }
 
 	// Functions
 
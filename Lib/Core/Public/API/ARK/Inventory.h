@@ -91,11 +91,11 @@ struct UAssetUserData : UObject
 
 struct UActorComponent : UObject
 {
-	TArray<FName>& ComponentTagsField() { return *GetNativePointerField<TArray<FName>*>(this, "UActorComponent.ComponentTags"); }
-	FName& CustomTagField() { return *GetNativePointerField<FName*>(this, "UActorComponent.CustomTag"); }
-	int& CustomDataField() { return *GetNativePointerField<int*>(this, "UActorComponent.CustomData"); }
-	AActor * CachedOwnerField() { return *GetNativePointerField<AActor **>(this, "UActorComponent.CachedOwner"); }
-	UWorld * WorldField() { return *GetNativePointerField<UWorld **>(this, "UActorComponent.World"); }
+	TArray<FName>& ComponentTagsField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("UActorComponent.ComponentTags")>(this, "UActorComponent.ComponentTags"); }
+	FName& CustomTagField() { return *GetNativePointerField<FName*, API::FieldNameHash("UActorComponent.CustomTag")>(this, "UActorComponent.CustomTag"); }
+	int& CustomDataField() { return *GetNativePointerField<int*, API::FieldNameHash("UActorComponent.CustomData")>(this, "UActorComponent.CustomData"); }
+	AActor * CachedOwnerField() { return *GetNativePointerField<AActor **, API::FieldNameHash("UActorComponent.CachedOwner")>(this, "UActorComponent.CachedOwner"); }
+	UWorld * WorldField() { return *GetNativePointerField<UWorld **, API::FieldNameHash("UActorComponent.World")>(this, "UActorComponent.World"); }
 
 	// Bit fields
 
@@ -175,94 +175,94 @@ struct UActorComponent : UObject
 
 struct UPrimalInventoryComponent : UActorComponent
 {
-	TArray<TWeakObjectPtr<AShooterPlayerController>>& RemoteViewingInventoryPlayerControllersField() { return *GetNativePointerField<TArray<TWeakObjectPtr<AShooterPlayerController>>*>(this, "UPrimalInventoryComponent.RemoteViewingInventoryPlayerControllers"); }
-	TArray<UPrimalItem *> InventoryItemsField() { return *GetNativePointerField<TArray<UPrimalItem *>*>(this, "UPrimalInventoryComponent.InventoryItems"); }
-	TArray<UPrimalItem *> EquippedItemsField() { return *GetNativePointerField<TArray<UPrimalItem *>*>(this, "UPrimalInventoryComponent.EquippedItems"); }
-	TArray<UPrimalItem *> ItemSlotsField() { return *GetNativePointerField<TArray<UPrimalItem *>*>(this, "UPrimalInventoryComponent.ItemSlots"); }
-	TArray<UPrimalItem *> ArkTributeItemsField() { return *GetNativePointerField<TArray<UPrimalItem *>*>(this, "UPrimalInventoryComponent.ArkTributeItems"); }
-	TArray<UPrimalItem *> AllDyeColorItemsField() { return *GetNativePointerField<TArray<UPrimalItem *>*>(this, "UPrimalInventoryComponent.AllDyeColorItems"); }
-	TArray<FItemCraftQueueEntry>& ItemCraftQueueEntriesField() { return *GetNativePointerField<TArray<FItemCraftQueueEntry>*>(this, "UPrimalInventoryComponent.ItemCraftQueueEntries"); }
-	int& OverrideInventoryDefaultTabField() { return *GetNativePointerField<int*>(this, "UPrimalInventoryComponent.OverrideInventoryDefaultTab"); }
-	TArray<TEnumAsByte<enum EPrimalEquipmentType::Type>>& EquippableItemTypesField() { return *GetNativePointerField<TArray<TEnumAsByte<enum EPrimalEquipmentType::Type>>*>(this, "UPrimalInventoryComponent.EquippableItemTypes"); }
-	float& CraftingItemSpeedField() { return *GetNativePointerField<float*>(this, "UPrimalInventoryComponent.CraftingItemSpeed"); }
-	TArray<FItemMultiplier>& ItemSpoilingTimeMultipliersField() { return *GetNativePointerField<TArray<FItemMultiplier>*>(this, "UPrimalInventoryComponent.ItemSpoilingTimeMultipliers"); }
-	int& MaxInventoryItemsField() { return *GetNativePointerField<int*>(this, "UPrimalInventoryComponent.MaxInventoryItems"); }
-	float& MaxInventoryWeightField() { return *GetNativePointerField<float*>(this, "UPrimalInventoryComponent.MaxInventoryWeight"); }
-	char& TribeGroupInventoryRankField() { return *GetNativePointerField<char*>(this, "UPrimalInventoryComponent.TribeGroupInventoryRank"); }
-	int& NumSlotsField() { return *GetNativePointerField<int*>(this, "UPrimalInventoryComponent.NumSlots"); }
-	int& MaxItemCraftQueueEntriesField() { return *GetNativePointerField<int*>(this, "UPrimalInventoryComponent.MaxItemCraftQueueEntries"); }
-	FString& RemoteInventoryDescriptionStringField() { return *GetNativePointerField<FString*>(this, "UPrimalInventoryComponent.RemoteInventoryDescriptionString"); }
-	TSubclassOf<UPrimalItem>& EngramRequirementClassOverrideField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "UPrimalInventoryComponent.EngramRequirementClassOverride"); }
-	TArray<TSubclassOf<UPrimalItem>>& RemoteAddItemOnlyAllowItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalInventoryComponent.RemoteAddItemOnlyAllowItemClasses"); }
-	TArray<TSubclassOf<UPrimalItem>>& RemoteAddItemPreventItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalInventoryComponent.RemoteAddItemPreventItemClasses"); }
-	//TArray<FEventItem>& EventItemsField() { return *GetNativePointerField<TArray<FEventItem>*>(this, "UPrimalInventoryComponent.EventItems"); }
-	TArray<TSubclassOf<UPrimalItem>>& DefaultInventoryItemsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalInventoryComponent.DefaultInventoryItems"); }
-	TArray<TSubclassOf<UPrimalItem>>& DefaultInventoryItems2Field() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalInventoryComponent.DefaultInventoryItems2"); }
-	TArray<TSubclassOf<UPrimalItem>>& DefaultInventoryItems3Field() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalInventoryComponent.DefaultInventoryItems3"); }
-	TArray<TSubclassOf<UPrimalItem>>& DefaultInventoryItems4Field() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalInventoryComponent.DefaultInventoryItems4"); }
-	TArray<FString>& DefaultInventoryItemsRandomCustomStringsField() { return *GetNativePointerField<TArray<FString>*>(this, "UPrimalInventoryComponent.DefaultInventoryItemsRandomCustomStrings"); }
-	TArray<float>& DefaultInventoryItemsRandomCustomStringsWeightsField() { return *GetNativePointerField<TArray<float>*>(this, "UPrimalInventoryComponent.DefaultInventoryItemsRandomCustomStringsWeights"); }
-	TArray<TSubclassOf<UPrimalItem>>& CheatInventoryItemsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalInventoryComponent.CheatInventoryItems"); }
-	TArray<TSubclassOf<UPrimalItem>>& DefaultEquippedItemsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalInventoryComponent.DefaultEquippedItems"); }
-	TArray<TSubclassOf<UPrimalItem>>& DefaultEquippedItemSkinsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalInventoryComponent.DefaultEquippedItemSkins"); }
-	TArray<TSubclassOf<UPrimalItem>>& DefaultSlotItemsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalInventoryComponent.DefaultSlotItems"); }
-	TArray<FItemSpawnActorClassOverride>& ItemSpawnActorClassOverridesField() { return *GetNativePointerField<TArray<FItemSpawnActorClassOverride>*>(this, "UPrimalInventoryComponent.ItemSpawnActorClassOverrides"); }
-	TArray<TSubclassOf<UPrimalItem>>& OnlyAllowCraftingItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalInventoryComponent.OnlyAllowCraftingItemClasses"); }
-	TArray<unsigned char>& DefaultEngramsField() { return *GetNativePointerField<TArray<unsigned char>*>(this, "UPrimalInventoryComponent.DefaultEngrams"); }
-	TArray<unsigned char>& DefaultEngrams2Field() { return *GetNativePointerField<TArray<unsigned char>*>(this, "UPrimalInventoryComponent.DefaultEngrams2"); }
-	TArray<unsigned char>& DefaultEngrams3Field() { return *GetNativePointerField<TArray<unsigned char>*>(this, "UPrimalInventoryComponent.DefaultEngrams3"); }
-	TArray<unsigned char>& DefaultEngrams4Field() { return *GetNativePointerField<TArray<unsigned char>*>(this, "UPrimalInventoryComponent.DefaultEngrams4"); }
-	TArray<float>& DefaultInventoryQualitiesField() { return *GetNativePointerField<TArray<float>*>(this, "UPrimalInventoryComponent.DefaultInventoryQualities"); }
-	FString& InventoryNameOverrideField() { return *GetNativePointerField<FString*>(this, "UPrimalInventoryComponent.InventoryNameOverride"); }
-	float& MaxRemoteInventoryViewingDistanceField() { return *GetNativePointerField<float*>(this, "UPrimalInventoryComponent.MaxRemoteInventoryViewingDistance"); }
-	float& ActiveInventoryRefreshIntervalField() { return *GetNativePointerField<float*>(this, "UPrimalInventoryComponent.ActiveInventoryRefreshInterval"); }
-	int& AbsoluteMaxInventoryItemsField() { return *GetNativePointerField<int*>(this, "UPrimalInventoryComponent.AbsoluteMaxInventoryItems"); }
-	long double& LastInventoryRefreshTimeField() { return *GetNativePointerField<long double*>(this, "UPrimalInventoryComponent.LastInventoryRefreshTime"); }
-	TSubclassOf<ADroppedItem>& DroppedItemTemplateOverrideField() { return *GetNativePointerField<TSubclassOf<ADroppedItem>*>(this, "UPrimalInventoryComponent.DroppedItemTemplateOverride"); }
-	TArray<TSubclassOf<UPrimalItem>>& ForceAllowItemStackingsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalInventoryComponent.ForceAllowItemStackings"); }
-	FRotator& DropItemRotationOffsetField() { return *GetNativePointerField<FRotator*>(this, "UPrimalInventoryComponent.DropItemRotationOffset"); }
-	TArray<FItemCraftingConsumptionReplenishment>& ItemCraftingConsumptionReplenishmentsField() { return *GetNativePointerField<TArray<FItemCraftingConsumptionReplenishment>*>(this, "UPrimalInventoryComponent.ItemCraftingConsumptionReplenishments"); }
-	float& MaxItemCooldownTimeClearField() { return *GetNativePointerField<float*>(this, "UPrimalInventoryComponent.MaxItemCooldownTimeClear"); }
-	TArray<FItemMultiplier>& MaxItemTemplateQuantitiesField() { return *GetNativePointerField<TArray<FItemMultiplier>*>(this, "UPrimalInventoryComponent.MaxItemTemplateQuantities"); }
-	USoundBase * ItemCraftingSoundOverrideField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalInventoryComponent.ItemCraftingSoundOverride"); }
-	TArray<FActorClassAttachmentInfo>& WeaponAsEquipmentAttachmentInfosField() { return *GetNativePointerField<TArray<FActorClassAttachmentInfo>*>(this, "UPrimalInventoryComponent.WeaponAsEquipmentAttachmentInfos"); }
-	TArray<UPrimalItem *> CraftingItemsField() { return *GetNativePointerField<TArray<UPrimalItem *>*>(this, "UPrimalInventoryComponent.CraftingItems"); }
-	int& DisplayDefaultItemInventoryCountField() { return *GetNativePointerField<int*>(this, "UPrimalInventoryComponent.DisplayDefaultItemInventoryCount"); }
-	bool& bHasBeenRegisteredField() { return *GetNativePointerField<bool*>(this, "UPrimalInventoryComponent.bHasBeenRegistered"); }
-	TArray<TSubclassOf<UPrimalItem>>& LastUsedItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalInventoryComponent.LastUsedItemClasses"); }
-	TArray<double>& LastUsedItemTimesField() { return *GetNativePointerField<TArray<double>*>(this, "UPrimalInventoryComponent.LastUsedItemTimes"); }
-	int& InvUpdatedFrameField() { return *GetNativePointerField<int*>(this, "UPrimalInventoryComponent.InvUpdatedFrame"); }
-	long double& LastRefreshCheckItemTimeField() { return *GetNativePointerField<long double*>(this, "UPrimalInventoryComponent.LastRefreshCheckItemTime"); }
-	bool& bLastPreventUseItemSpoilingTimeMultipliersField() { return *GetNativePointerField<bool*>(this, "UPrimalInventoryComponent.bLastPreventUseItemSpoilingTimeMultipliers"); }
-	FItemNetID& NextItemSpoilingIDField() { return *GetNativePointerField<FItemNetID*>(this, "UPrimalInventoryComponent.NextItemSpoilingID"); }
-	FItemNetID& NextItemConsumptionIDField() { return *GetNativePointerField<FItemNetID*>(this, "UPrimalInventoryComponent.NextItemConsumptionID"); }
-	float& MinItemSetsField() { return *GetNativePointerField<float*>(this, "UPrimalInventoryComponent.MinItemSets"); }
-	float& MaxItemSetsField() { return *GetNativePointerField<float*>(this, "UPrimalInventoryComponent.MaxItemSets"); }
-	float& NumItemSetsPowerField() { return *GetNativePointerField<float*>(this, "UPrimalInventoryComponent.NumItemSetsPower"); }
-	TArray<FSupplyCrateItemSet>& ItemSetsField() { return *GetNativePointerField<TArray<FSupplyCrateItemSet>*>(this, "UPrimalInventoryComponent.ItemSets"); }
-	TArray<FSupplyCrateItemSet>& AdditionalItemSetsField() { return *GetNativePointerField<TArray<FSupplyCrateItemSet>*>(this, "UPrimalInventoryComponent.AdditionalItemSets"); }
-	TSubclassOf<UPrimalSupplyCrateItemSets>& ItemSetsOverrideField() { return *GetNativePointerField<TSubclassOf<UPrimalSupplyCrateItemSets>*>(this, "UPrimalInventoryComponent.ItemSetsOverride"); }
-	TArray<float>& SetQuantityWeightsField() { return *GetNativePointerField<TArray<float>*>(this, "UPrimalInventoryComponent.SetQuantityWeights"); }
-	TArray<float>& SetQuantityValuesField() { return *GetNativePointerField<TArray<float>*>(this, "UPrimalInventoryComponent.SetQuantityValues"); }
-	USoundBase * ItemRemovedBySoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalInventoryComponent.ItemRemovedBySound"); }
-	USoundBase * OpenInventorySoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalInventoryComponent.OpenInventorySound"); }
-	USoundBase * CloseInventorySoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalInventoryComponent.CloseInventorySound"); }
-	float& MaxInventoryAccessDistanceField() { return *GetNativePointerField<float*>(this, "UPrimalInventoryComponent.MaxInventoryAccessDistance"); }
-	TArray<FString>& ServerCustomFolderField() { return *GetNativePointerField<TArray<FString>*>(this, "UPrimalInventoryComponent.ServerCustomFolder"); }
-	TArray<TSubclassOf<UPrimalInventoryComponent>>& ForceAllowCraftingForInventoryComponentsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalInventoryComponent>>*>(this, "UPrimalInventoryComponent.ForceAllowCraftingForInventoryComponents"); }
-	TArray<FItemMultiplier>& ItemClassWeightMultipliersField() { return *GetNativePointerField<TArray<FItemMultiplier>*>(this, "UPrimalInventoryComponent.ItemClassWeightMultipliers"); }
-	float& GenerateItemSetsQualityMultiplierMinField() { return *GetNativePointerField<float*>(this, "UPrimalInventoryComponent.GenerateItemSetsQualityMultiplierMin"); }
-	float& GenerateItemSetsQualityMultiplierMaxField() { return *GetNativePointerField<float*>(this, "UPrimalInventoryComponent.GenerateItemSetsQualityMultiplierMax"); }
-	float& DefaultCraftingRequirementsMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalInventoryComponent.DefaultCraftingRequirementsMultiplier"); }
-	int& DefaultCraftingQuantityMultiplierField() { return *GetNativePointerField<int*>(this, "UPrimalInventoryComponent.DefaultCraftingQuantityMultiplier"); }
-	int& SavedForceDefaultInventoryRefreshVersionField() { return *GetNativePointerField<int*>(this, "UPrimalInventoryComponent.SavedForceDefaultInventoryRefreshVersion"); }
-	int& ForceDefaultInventoryRefreshVersionField() { return *GetNativePointerField<int*>(this, "UPrimalInventoryComponent.ForceDefaultInventoryRefreshVersion"); }
-	TArray<TSubclassOf<UPrimalItem>>& TamedDinoForceConsiderFoodTypesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalInventoryComponent.TamedDinoForceConsiderFoodTypes"); }
-	TArray<UPrimalItem *> DinoAutoHealingItemsField() { return *GetNativePointerField<TArray<UPrimalItem *>*>(this, "UPrimalInventoryComponent.DinoAutoHealingItems"); }
-	USoundBase * OverrideCraftingFinishedSoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalInventoryComponent.OverrideCraftingFinishedSound"); }
-	long double& LastAddToCraftQueueSoundTimeField() { return *GetNativePointerField<long double*>(this, "UPrimalInventoryComponent.LastAddToCraftQueueSoundTime"); }
-	FString& ForceAddToFolderField() { return *GetNativePointerField<FString*>(this, "UPrimalInventoryComponent.ForceAddToFolder"); }
-	FVector& GroundDropTraceLocationOffsetField() { return *GetNativePointerField<FVector*>(this, "UPrimalInventoryComponent.GroundDropTraceLocationOffset"); }
+	TArray<TWeakObjectPtr<AShooterPlayerController>>& RemoteViewingInventoryPlayerControllersField() { return *GetNativePointerField<TArray<TWeakObjectPtr<AShooterPlayerController>>*, API::FieldNameHash("UPrimalInventoryComponent.RemoteViewingInventoryPlayerControllers")>(this, "UPrimalInventoryComponent.RemoteViewingInventoryPlayerControllers"); }
+	TArray<UPrimalItem *> InventoryItemsField() { return *GetNativePointerField<TArray<UPrimalItem *>*, API::FieldNameHash("UPrimalInventoryComponent.InventoryItems")>(this, "UPrimalInventoryComponent.InventoryItems"); }
+	TArray<UPrimalItem *> EquippedItemsField() { return *GetNativePointerField<TArray<UPrimalItem *>*, API::FieldNameHash("UPrimalInventoryComponent.EquippedItems")>(this, "UPrimalInventoryComponent.EquippedItems"); }
+	TArray<UPrimalItem *> ItemSlotsField() { return *GetNativePointerField<TArray<UPrimalItem *>*, API::FieldNameHash("UPrimalInventoryComponent.ItemSlots")>(this, "UPrimalInventoryComponent.ItemSlots"); }
+	TArray<UPrimalItem *> ArkTributeItemsField() { return *GetNativePointerField<TArray<UPrimalItem *>*, API::FieldNameHash("UPrimalInventoryComponent.ArkTributeItems")>(this, "UPrimalInventoryComponent.ArkTributeItems"); }
+	TArray<UPrimalItem *> AllDyeColorItemsField() { return *GetNativePointerField<TArray<UPrimalItem *>*, API::FieldNameHash("UPrimalInventoryComponent.AllDyeColorItems")>(this, "UPrimalInventoryComponent.AllDyeColorItems"); }
+	TArray<FItemCraftQueueEntry>& ItemCraftQueueEntriesField() { return *GetNativePointerField<TArray<FItemCraftQueueEntry>*, API::FieldNameHash("UPrimalInventoryComponent.ItemCraftQueueEntries")>(this, "UPrimalInventoryComponent.ItemCraftQueueEntries"); }
+	int& OverrideInventoryDefaultTabField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalInventoryComponent.OverrideInventoryDefaultTab")>(this, "UPrimalInventoryComponent.OverrideInventoryDefaultTab"); }
+	TArray<TEnumAsByte<enum EPrimalEquipmentType::Type>>& EquippableItemTypesField() { return *GetNativePointerField<TArray<TEnumAsByte<enum EPrimalEquipmentType::Type>>*, API::FieldNameHash("UPrimalInventoryComponent.EquippableItemTypes")>(this, "UPrimalInventoryComponent.EquippableItemTypes"); }
+	float& CraftingItemSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalInventoryComponent.CraftingItemSpeed")>(this, "UPrimalInventoryComponent.CraftingItemSpeed"); }
+	TArray<FItemMultiplier>& ItemSpoilingTimeMultipliersField() { return *GetNativePointerField<TArray<FItemMultiplier>*, API::FieldNameHash("UPrimalInventoryComponent.ItemSpoilingTimeMultipliers")>(this, "UPrimalInventoryComponent.ItemSpoilingTimeMultipliers"); }
+	int& MaxInventoryItemsField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalInventoryComponent.MaxInventoryItems")>(this, "UPrimalInventoryComponent.MaxInventoryItems"); }
+	float& MaxInventoryWeightField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalInventoryComponent.MaxInventoryWeight")>(this, "UPrimalInventoryComponent.MaxInventoryWeight"); }
+	char& TribeGroupInventoryRankField() { return *GetNativePointerField<char*, API::FieldNameHash("UPrimalInventoryComponent.TribeGroupInventoryRank")>(this, "UPrimalInventoryComponent.TribeGroupInventoryRank"); }
+	int& NumSlotsField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalInventoryComponent.NumSlots")>(this, "UPrimalInventoryComponent.NumSlots"); }
+	int& MaxItemCraftQueueEntriesField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalInventoryComponent.MaxItemCraftQueueEntries")>(this, "UPrimalInventoryComponent.MaxItemCraftQueueEntries"); }
+	FString& RemoteInventoryDescriptionStringField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalInventoryComponent.RemoteInventoryDescriptionString")>(this, "UPrimalInventoryComponent.RemoteInventoryDescriptionString"); }
+	TSubclassOf<UPrimalItem>& EngramRequirementClassOverrideField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("UPrimalInventoryComponent.EngramRequirementClassOverride")>(this, "UPrimalInventoryComponent.EngramRequirementClassOverride"); }
+	TArray<TSubclassOf<UPrimalItem>>& RemoteAddItemOnlyAllowItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalInventoryComponent.RemoteAddItemOnlyAllowItemClasses")>(this, "UPrimalInventoryComponent.RemoteAddItemOnlyAllowItemClasses"); }
+	TArray<TSubclassOf<UPrimalItem>>& RemoteAddItemPreventItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalInventoryComponent.RemoteAddItemPreventItemClasses")>(this, "UPrimalInventoryComponent.RemoteAddItemPreventItemClasses"); }
+	//TArray<FEventItem>& EventItemsField() { return *GetNativePointerField<TArray<FEventItem>*, API::FieldNameHash("UPrimalInventoryComponent.EventItems")>(this, "UPrimalInventoryComponent.EventItems"); }
+	TArray<TSubclassOf<UPrimalItem>>& DefaultInventoryItemsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalInventoryComponent.DefaultInventoryItems")>(this, "UPrimalInventoryComponent.DefaultInventoryItems"); }
+	TArray<TSubclassOf<UPrimalItem>>& DefaultInventoryItems2Field() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalInventoryComponent.DefaultInventoryItems2")>(this, "UPrimalInventoryComponent.DefaultInventoryItems2"); }
+	TArray<TSubclassOf<UPrimalItem>>& DefaultInventoryItems3Field() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalInventoryComponent.DefaultInventoryItems3")>(this, "UPrimalInventoryComponent.DefaultInventoryItems3"); }
+	TArray<TSubclassOf<UPrimalItem>>& DefaultInventoryItems4Field() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalInventoryComponent.DefaultInventoryItems4")>(this, "UPrimalInventoryComponent.DefaultInventoryItems4"); }
+	TArray<FString>& DefaultInventoryItemsRandomCustomStringsField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("UPrimalInventoryComponent.DefaultInventoryItemsRandomCustomStrings")>(this, "UPrimalInventoryComponent.DefaultInventoryItemsRandomCustomStrings"); }
+	TArray<float>& DefaultInventoryItemsRandomCustomStringsWeightsField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("UPrimalInventoryComponent.DefaultInventoryItemsRandomCustomStringsWeights")>(this, "UPrimalInventoryComponent.DefaultInventoryItemsRandomCustomStringsWeights"); }
+	TArray<TSubclassOf<UPrimalItem>>& CheatInventoryItemsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalInventoryComponent.CheatInventoryItems")>(this, "UPrimalInventoryComponent.CheatInventoryItems"); }
+	TArray<TSubclassOf<UPrimalItem>>& DefaultEquippedItemsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalInventoryComponent.DefaultEquippedItems")>(this, "UPrimalInventoryComponent.DefaultEquippedItems"); }
+	TArray<TSubclassOf<UPrimalItem>>& DefaultEquippedItemSkinsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalInventoryComponent.DefaultEquippedItemSkins")>(this, "UPrimalInventoryComponent.DefaultEquippedItemSkins"); }
+	TArray<TSubclassOf<UPrimalItem>>& DefaultSlotItemsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalInventoryComponent.DefaultSlotItems")>(this, "UPrimalInventoryComponent.DefaultSlotItems"); }
+	TArray<FItemSpawnActorClassOverride>& ItemSpawnActorClassOverridesField() { return *GetNativePointerField<TArray<FItemSpawnActorClassOverride>*, API::FieldNameHash("UPrimalInventoryComponent.ItemSpawnActorClassOverrides")>(this, "UPrimalInventoryComponent.ItemSpawnActorClassOverrides"); }
+	TArray<TSubclassOf<UPrimalItem>>& OnlyAllowCraftingItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalInventoryComponent.OnlyAllowCraftingItemClasses")>(this, "UPrimalInventoryComponent.OnlyAllowCraftingItemClasses"); }
+	TArray<unsigned char>& DefaultEngramsField() { return *GetNativePointerField<TArray<unsigned char>*, API::FieldNameHash("UPrimalInventoryComponent.DefaultEngrams")>(this, "UPrimalInventoryComponent.DefaultEngrams"); }
+	TArray<unsigned char>& DefaultEngrams2Field() { return *GetNativePointerField<TArray<unsigned char>*, API::FieldNameHash("UPrimalInventoryComponent.DefaultEngrams2")>(this, "UPrimalInventoryComponent.DefaultEngrams2"); }
+	TArray<unsigned char>& DefaultEngrams3Field() { return *GetNativePointerField<TArray<unsigned char>*, API::FieldNameHash("UPrimalInventoryComponent.DefaultEngrams3")>(this, "UPrimalInventoryComponent.DefaultEngrams3"); }
+	TArray<unsigned char>& DefaultEngrams4Field() { return *GetNativePointerField<TArray<unsigned char>*, API::FieldNameHash("UPrimalInventoryComponent.DefaultEngrams4")>(this, "UPrimalInventoryComponent.DefaultEngrams4"); }
+	TArray<float>& DefaultInventoryQualitiesField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("UPrimalInventoryComponent.DefaultInventoryQualities")>(this, "UPrimalInventoryComponent.DefaultInventoryQualities"); }
+	FString& InventoryNameOverrideField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalInventoryComponent.InventoryNameOverride")>(this, "UPrimalInventoryComponent.InventoryNameOverride"); }
+	float& MaxRemoteInventoryViewingDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalInventoryComponent.MaxRemoteInventoryViewingDistance")>(this, "UPrimalInventoryComponent.MaxRemoteInventoryViewingDistance"); }
+	float& ActiveInventoryRefreshIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalInventoryComponent.ActiveInventoryRefreshInterval")>(this, "UPrimalInventoryComponent.ActiveInventoryRefreshInterval"); }
+	int& AbsoluteMaxInventoryItemsField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalInventoryComponent.AbsoluteMaxInventoryItems")>(this, "UPrimalInventoryComponent.AbsoluteMaxInventoryItems"); }
+	long double& LastInventoryRefreshTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimalInventoryComponent.LastInventoryRefreshTime")>(this, "UPrimalInventoryComponent.LastInventoryRefreshTime"); }
+	TSubclassOf<ADroppedItem>& DroppedItemTemplateOverrideField() { return *GetNativePointerField<TSubclassOf<ADroppedItem>*, API::FieldNameHash("UPrimalInventoryComponent.DroppedItemTemplateOverride")>(this, "UPrimalInventoryComponent.DroppedItemTemplateOverride"); }
+	TArray<TSubclassOf<UPrimalItem>>& ForceAllowItemStackingsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalInventoryComponent.ForceAllowItemStackings")>(this, "UPrimalInventoryComponent.ForceAllowItemStackings"); }
+	FRotator& DropItemRotationOffsetField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("UPrimalInventoryComponent.DropItemRotationOffset")>(this, "UPrimalInventoryComponent.DropItemRotationOffset"); }
+	TArray<FItemCraftingConsumptionReplenishment>& ItemCraftingConsumptionReplenishmentsField() { return *GetNativePointerField<TArray<FItemCraftingConsumptionReplenishment>*, API::FieldNameHash("UPrimalInventoryComponent.ItemCraftingConsumptionReplenishments")>(this, "UPrimalInventoryComponent.ItemCraftingConsumptionReplenishments"); }
+	float& MaxItemCooldownTimeClearField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalInventoryComponent.MaxItemCooldownTimeClear")>(this, "UPrimalInventoryComponent.MaxItemCooldownTimeClear"); }
+	TArray<FItemMultiplier>& MaxItemTemplateQuantitiesField() { return *GetNativePointerField<TArray<FItemMultiplier>*, API::FieldNameHash("UPrimalInventoryComponent.MaxItemTemplateQuantities")>(this, "UPrimalInventoryComponent.MaxItemTemplateQuantities"); }
+	USoundBase * ItemCraftingSoundOverrideField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalInventoryComponent.ItemCraftingSoundOverride")>(this, "UPrimalInventoryComponent.ItemCraftingSoundOverride"); }
+	TArray<FActorClassAttachmentInfo>& WeaponAsEquipmentAttachmentInfosField() { return *GetNativePointerField<TArray<FActorClassAttachmentInfo>*, API::FieldNameHash("UPrimalInventoryComponent.WeaponAsEquipmentAttachmentInfos")>(this, "UPrimalInventoryComponent.WeaponAsEquipmentAttachmentInfos"); }
+	TArray<UPrimalItem *> CraftingItemsField() { return *GetNativePointerField<TArray<UPrimalItem *>*, API::FieldNameHash("UPrimalInventoryComponent.CraftingItems")>(this, "UPrimalInventoryComponent.CraftingItems"); }
+	int& DisplayDefaultItemInventoryCountField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalInventoryComponent.DisplayDefaultItemInventoryCount")>(this, "UPrimalInventoryComponent.DisplayDefaultItemInventoryCount"); }
+	bool& bHasBeenRegisteredField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimalInventoryComponent.bHasBeenRegistered")>(this, "UPrimalInventoryComponent.bHasBeenRegistered"); }
+	TArray<TSubclassOf<UPrimalItem>>& LastUsedItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalInventoryComponent.LastUsedItemClasses")>(this, "UPrimalInventoryComponent.LastUsedItemClasses"); }
+	TArray<double>& LastUsedItemTimesField() { return *GetNativePointerField<TArray<double>*, API::FieldNameHash("UPrimalInventoryComponent.LastUsedItemTimes")>(this, "UPrimalInventoryComponent.LastUsedItemTimes"); }
+	int& InvUpdatedFrameField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalInventoryComponent.InvUpdatedFrame")>(this, "UPrimalInventoryComponent.InvUpdatedFrame"); }
+	long double& LastRefreshCheckItemTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimalInventoryComponent.LastRefreshCheckItemTime")>(this, "UPrimalInventoryComponent.LastRefreshCheckItemTime"); }
+	bool& bLastPreventUseItemSpoilingTimeMultipliersField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimalInventoryComponent.bLastPreventUseItemSpoilingTimeMultipliers")>(this, "UPrimalInventoryComponent.bLastPreventUseItemSpoilingTimeMultipliers"); }
+	FItemNetID& NextItemSpoilingIDField() { return *GetNativePointerField<FItemNetID*, API::FieldNameHash("UPrimalInventoryComponent.NextItemSpoilingID")>(this, "UPrimalInventoryComponent.NextItemSpoilingID"); }
+	FItemNetID& NextItemConsumptionIDField() { return *GetNativePointerField<FItemNetID*, API::FieldNameHash("UPrimalInventoryComponent.NextItemConsumptionID")>(this, "UPrimalInventoryComponent.NextItemConsumptionID"); }
+	float& MinItemSetsField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalInventoryComponent.MinItemSets")>(this, "UPrimalInventoryComponent.MinItemSets"); }
+	float& MaxItemSetsField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalInventoryComponent.MaxItemSets")>(this, "UPrimalInventoryComponent.MaxItemSets"); }
+	float& NumItemSetsPowerField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalInventoryComponent.NumItemSetsPower")>(this, "UPrimalInventoryComponent.NumItemSetsPower"); }
+	TArray<FSupplyCrateItemSet>& ItemSetsField() { return *GetNativePointerField<TArray<FSupplyCrateItemSet>*, API::FieldNameHash("UPrimalInventoryComponent.ItemSets")>(this, "UPrimalInventoryComponent.ItemSets"); }
+	TArray<FSupplyCrateItemSet>& AdditionalItemSetsField() { return *GetNativePointerField<TArray<FSupplyCrateItemSet>*, API::FieldNameHash("UPrimalInventoryComponent.AdditionalItemSets")>(this, "UPrimalInventoryComponent.AdditionalItemSets"); }
+	TSubclassOf<UPrimalSupplyCrateItemSets>& ItemSetsOverrideField() { return *GetNativePointerField<TSubclassOf<UPrimalSupplyCrateItemSets>*, API::FieldNameHash("UPrimalInventoryComponent.ItemSetsOverride")>(this, "UPrimalInventoryComponent.ItemSetsOverride"); }
+	TArray<float>& SetQuantityWeightsField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("UPrimalInventoryComponent.SetQuantityWeights")>(this, "UPrimalInventoryComponent.SetQuantityWeights"); }
+	TArray<float>& SetQuantityValuesField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("UPrimalInventoryComponent.SetQuantityValues")>(this, "UPrimalInventoryComponent.SetQuantityValues"); }
+	USoundBase * ItemRemovedBySoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalInventoryComponent.ItemRemovedBySound")>(this, "UPrimalInventoryComponent.ItemRemovedBySound"); }
+	USoundBase * OpenInventorySoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalInventoryComponent.OpenInventorySound")>(this, "UPrimalInventoryComponent.OpenInventorySound"); }
+	USoundBase * CloseInventorySoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalInventoryComponent.CloseInventorySound")>(this, "UPrimalInventoryComponent.CloseInventorySound"); }
+	float& MaxInventoryAccessDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalInventoryComponent.MaxInventoryAccessDistance")>(this, "UPrimalInventoryComponent.MaxInventoryAccessDistance"); }
+	TArray<FString>& ServerCustomFolderField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("UPrimalInventoryComponent.ServerCustomFolder")>(this, "UPrimalInventoryComponent.ServerCustomFolder"); }
+	TArray<TSubclassOf<UPrimalInventoryComponent>>& ForceAllowCraftingForInventoryComponentsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalInventoryComponent>>*, API::FieldNameHash("UPrimalInventoryComponent.ForceAllowCraftingForInventoryComponents")>(this, "UPrimalInventoryComponent.ForceAllowCraftingForInventoryComponents"); }
+	TArray<FItemMultiplier>& ItemClassWeightMultipliersField() { return *GetNativePointerField<TArray<FItemMultiplier>*, API::FieldNameHash("UPrimalInventoryComponent.ItemClassWeightMultipliers")>(this, "UPrimalInventoryComponent.ItemClassWeightMultipliers"); }
+	float& GenerateItemSetsQualityMultiplierMinField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalInventoryComponent.GenerateItemSetsQualityMultiplierMin")>(this, "UPrimalInventoryComponent.GenerateItemSetsQualityMultiplierMin"); }
+	float& GenerateItemSetsQualityMultiplierMaxField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalInventoryComponent.GenerateItemSetsQualityMultiplierMax")>(this, "UPrimalInventoryComponent.GenerateItemSetsQualityMultiplierMax"); }
+	float& DefaultCraftingRequirementsMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalInventoryComponent.DefaultCraftingRequirementsMultiplier")>(this, "UPrimalInventoryComponent.DefaultCraftingRequirementsMultiplier"); }
+	int& DefaultCraftingQuantityMultiplierField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalInventoryComponent.DefaultCraftingQuantityMultiplier")>(this, "UPrimalInventoryComponent.DefaultCraftingQuantityMultiplier"); }
+	int& SavedForceDefaultInventoryRefreshVersionField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalInventoryComponent.SavedForceDefaultInventoryRefreshVersion")>(this, "UPrimalInventoryComponent.SavedForceDefaultInventoryRefreshVersion"); }
+	int& ForceDefaultInventoryRefreshVersionField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalInventoryComponent.ForceDefaultInventoryRefreshVersion")>(this, "UPrimalInventoryComponent.ForceDefaultInventoryRefreshVersion"); }
+	TArray<TSubclassOf<UPrimalItem>>& TamedDinoForceConsiderFoodTypesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalInventoryComponent.TamedDinoForceConsiderFoodTypes")>(this, "UPrimalInventoryComponent.TamedDinoForceConsiderFoodTypes"); }
+	TArray<UPrimalItem *> DinoAutoHealingItemsField() { return *GetNativePointerField<TArray<UPrimalItem *>*, API::FieldNameHash("UPrimalInventoryComponent.DinoAutoHealingItems")>(this, "UPrimalInventoryComponent.DinoAutoHealingItems"); }
+	USoundBase * OverrideCraftingFinishedSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalInventoryComponent.OverrideCraftingFinishedSound")>(this, "UPrimalInventoryComponent.OverrideCraftingFinishedSound"); }
+	long double& LastAddToCraftQueueSoundTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimalInventoryComponent.LastAddToCraftQueueSoundTime")>(this, "UPrimalInventoryComponent.LastAddToCraftQueueSoundTime"); }
+	FString& ForceAddToFolderField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalInventoryComponent.ForceAddToFolder")>(this, "UPrimalInventoryComponent.ForceAddToFolder"); }
+	FVector& GroundDropTraceLocationOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UPrimalInventoryComponent.GroundDropTraceLocationOffset")>(this, "UPrimalInventoryComponent.GroundDropTraceLocationOffset"); }
 
 	// Bit fields
 
@@ -508,247 +508,247 @@ struct UPrimalInventoryComponent : UActorComponent
 
 struct UPrimalItem : UObject
 {
-	float& DinoAutoHealingThresholdPercentField() { return *GetNativePointerField<float*>(this, "UPrimalItem.DinoAutoHealingThresholdPercent"); }
-	float& DinoAutoHealingUseTimeIntervalField() { return *GetNativePointerField<float*>(this, "UPrimalItem.DinoAutoHealingUseTimeInterval"); }
-	int& ArkTributeVersionField() { return *GetNativePointerField<int*>(this, "UPrimalItem.ArkTributeVersion"); }
-	TArray<TSubclassOf<AActor>>& EquipRequiresExplicitOwnerClassesField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*>(this, "UPrimalItem.EquipRequiresExplicitOwnerClasses"); }
-	TArray<FName>& EquipRequiresExplicitOwnerTagsField() { return *GetNativePointerField<TArray<FName>*>(this, "UPrimalItem.EquipRequiresExplicitOwnerTags"); }
-	TSubclassOf<APrimalBuff>& BuffToGiveOwnerWhenEquippedField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*>(this, "UPrimalItem.BuffToGiveOwnerWhenEquipped"); }
-	FString& BuffToGiveOwnerWhenEquipped_BlueprintPathField() { return *GetNativePointerField<FString*>(this, "UPrimalItem.BuffToGiveOwnerWhenEquipped_BlueprintPath"); }
-	bool& bBuffToGiveOwnerWhenEquipped_SoftRefCachedField() { return *GetNativePointerField<bool*>(this, "UPrimalItem.bBuffToGiveOwnerWhenEquipped_SoftRefCached"); }
-	unsigned int& ExpirationTimeUTCField() { return *GetNativePointerField<unsigned int*>(this, "UPrimalItem.ExpirationTimeUTC"); }
-	int& BlueprintAllowMaxCraftingsField() { return *GetNativePointerField<int*>(this, "UPrimalItem.BlueprintAllowMaxCraftings"); }
-	FString& AbstractItemCraftingDescriptionField() { return *GetNativePointerField<FString*>(this, "UPrimalItem.AbstractItemCraftingDescription"); }
-	TArray<TSubclassOf<UPrimalItem>>& ItemSkinUseOnItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalItem.ItemSkinUseOnItemClasses"); }
-	TArray<TSubclassOf<UPrimalItem>>& ItemSkinPreventOnItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalItem.ItemSkinPreventOnItemClasses"); }
-	USoundBase * ItemBrokenSoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalItem.ItemBrokenSound"); }
-	USoundCue * UseItemSoundField() { return *GetNativePointerField<USoundCue **>(this, "UPrimalItem.UseItemSound"); }
-	USoundBase * EquipSoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalItem.EquipSound"); }
-	USoundBase * UnEquipSoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalItem.UnEquipSound"); }
-	USoundBase * UsedOnOtherItemSoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalItem.UsedOnOtherItemSound"); }
-	USoundBase * RemovedFromOtherItemSoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalItem.RemovedFromOtherItemSound"); }
-	float& RandomChanceToBeBlueprintField() { return *GetNativePointerField<float*>(this, "UPrimalItem.RandomChanceToBeBlueprint"); }
-	TArray<FActorClassAttachmentInfo>& ActorClassAttachmentInfosField() { return *GetNativePointerField<TArray<FActorClassAttachmentInfo>*>(this, "UPrimalItem.ActorClassAttachmentInfos"); }
-	TArray<FItemAttachmentInfo> * ItemAttachmentInfosField() { return *GetNativePointerField<TArray<FItemAttachmentInfo> **>(this, "UPrimalItem.ItemAttachmentInfos"); }
-	TArray<FItemAttachmentInfo>& DynamicItemAttachmentInfosField() { return *GetNativePointerField<TArray<FItemAttachmentInfo>*>(this, "UPrimalItem.DynamicItemAttachmentInfos"); }
-	TArray<FItemAttachmentInfo>& ItemSkinAddItemAttachmentsField() { return *GetNativePointerField<TArray<FItemAttachmentInfo>*>(this, "UPrimalItem.ItemSkinAddItemAttachments"); }
-	TEnumAsByte<enum EPrimalItemType::Type>& MyItemTypeField() { return *GetNativePointerField<TEnumAsByte<enum EPrimalItemType::Type>*>(this, "UPrimalItem.MyItemType"); }
-	TEnumAsByte<enum EPrimalConsumableType::Type>& MyConsumableTypeField() { return *GetNativePointerField<TEnumAsByte<enum EPrimalConsumableType::Type>*>(this, "UPrimalItem.MyConsumableType"); }
-	TEnumAsByte<enum EPrimalEquipmentType::Type>& MyEquipmentTypeField() { return *GetNativePointerField<TEnumAsByte<enum EPrimalEquipmentType::Type>*>(this, "UPrimalItem.MyEquipmentType"); }
-	int& ExtraItemCategoryFlagsField() { return *GetNativePointerField<int*>(this, "UPrimalItem.ExtraItemCategoryFlags"); }
-	FVector& BlockingShieldFPVTranslationField() { return *GetNativePointerField<FVector*>(this, "UPrimalItem.BlockingShieldFPVTranslation"); }
-	FRotator& BlockingShieldFPVRotationField() { return *GetNativePointerField<FRotator*>(this, "UPrimalItem.BlockingShieldFPVRotation"); }
-	float& ShieldBlockDamagePercentageField() { return *GetNativePointerField<float*>(this, "UPrimalItem.ShieldBlockDamagePercentage"); }
-	float& ShieldDamageToDurabilityRatioField() { return *GetNativePointerField<float*>(this, "UPrimalItem.ShieldDamageToDurabilityRatio"); }
-	UAnimMontage * PlayAnimationOnUseField() { return *GetNativePointerField<UAnimMontage **>(this, "UPrimalItem.PlayAnimationOnUse"); }
-	int& CraftingMinLevelRequirementField() { return *GetNativePointerField<int*>(this, "UPrimalItem.CraftingMinLevelRequirement"); }
-	float& CraftingCooldownIntervalField() { return *GetNativePointerField<float*>(this, "UPrimalItem.CraftingCooldownInterval"); }
-	TSubclassOf<AActor>& CraftingActorToSpawnField() { return *GetNativePointerField<TSubclassOf<AActor>*>(this, "UPrimalItem.CraftingActorToSpawn"); }
-	UTexture2D * BlueprintBackgroundOverrideTextureField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalItem.BlueprintBackgroundOverrideTexture"); }
-	FString& CraftItemButtonStringOverrideField() { return *GetNativePointerField<FString*>(this, "UPrimalItem.CraftItemButtonStringOverride"); }
-	TSubclassOf<AActor>& UseSpawnActorClassField() { return *GetNativePointerField<TSubclassOf<AActor>*>(this, "UPrimalItem.UseSpawnActorClass"); }
-	FVector& UseSpawnActorLocOffsetField() { return *GetNativePointerField<FVector*>(this, "UPrimalItem.UseSpawnActorLocOffset"); }
-	int& SlotIndexField() { return *GetNativePointerField<int*>(this, "UPrimalItem.SlotIndex"); }
-	FItemNetID& ItemIDField() { return *GetNativePointerField<FItemNetID*>(this, "UPrimalItem.ItemID"); }
-	int& ItemCustomDataField() { return *GetNativePointerField<int*>(this, "UPrimalItem.ItemCustomData"); }
-	TSubclassOf<UPrimalItem>& ItemCustomClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "UPrimalItem.ItemCustomClass"); }
-	int& ItemSkinTemplateIndexField() { return *GetNativePointerField<int*>(this, "UPrimalItem.ItemSkinTemplateIndex"); }
-	TSubclassOf<UPrimalItem>& ItemSkinTemplateField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "UPrimalItem.ItemSkinTemplate"); }
-	float& ItemRatingField() { return *GetNativePointerField<float*>(this, "UPrimalItem.ItemRating"); }
-	unsigned __int16& CraftQueueField() { return *GetNativePointerField<unsigned __int16*>(this, "UPrimalItem.CraftQueue"); }
-	float& CraftingSkillField() { return *GetNativePointerField<float*>(this, "UPrimalItem.CraftingSkill"); }
-	FString& CustomItemNameField() { return *GetNativePointerField<FString*>(this, "UPrimalItem.CustomItemName"); }
-	FString& CustomItemDescriptionField() { return *GetNativePointerField<FString*>(this, "UPrimalItem.CustomItemDescription"); }
-	TArray<FColor>& CustomColorsField() { return *GetNativePointerField<TArray<FColor>*>(this, "UPrimalItem.CustomColors"); }
-	TArray<FCraftingResourceRequirement>& CustomResourceRequirementsField() { return *GetNativePointerField<TArray<FCraftingResourceRequirement>*>(this, "UPrimalItem.CustomResourceRequirements"); }
-	long double& NextCraftCompletionTimeField() { return *GetNativePointerField<long double*>(this, "UPrimalItem.NextCraftCompletionTime"); }
-	TWeakObjectPtr<UPrimalInventoryComponent>& OwnerInventoryField() { return *GetNativePointerField<TWeakObjectPtr<UPrimalInventoryComponent>*>(this, "UPrimalItem.OwnerInventory"); }
-	char& ItemQualityIndexField() { return *GetNativePointerField<char*>(this, "UPrimalItem.ItemQualityIndex"); }
-	TSubclassOf<UPrimalItem>& SupportDragOntoItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "UPrimalItem.SupportDragOntoItemClass"); }
-	TArray<TSubclassOf<UPrimalItem>>& SupportDragOntoItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalItem.SupportDragOntoItemClasses"); }
-	TArray<TSubclassOf<AShooterWeapon>>& SkinWeaponTemplatesField() { return *GetNativePointerField<TArray<TSubclassOf<AShooterWeapon>>*>(this, "UPrimalItem.SkinWeaponTemplates"); }
-	TSubclassOf<AShooterWeapon>& AmmoSupportDragOntoWeaponItemWeaponTemplateField() { return *GetNativePointerField<TSubclassOf<AShooterWeapon>*>(this, "UPrimalItem.AmmoSupportDragOntoWeaponItemWeaponTemplate"); }
-	TArray<TSubclassOf<AShooterWeapon>>& AmmoSupportDragOntoWeaponItemWeaponTemplatesField() { return *GetNativePointerField<TArray<TSubclassOf<AShooterWeapon>>*>(this, "UPrimalItem.AmmoSupportDragOntoWeaponItemWeaponTemplates"); }
-	float& Ingredient_WeightIncreasePerQuantityField() { return *GetNativePointerField<float*>(this, "UPrimalItem.Ingredient_WeightIncreasePerQuantity"); }
-	float& Ingredient_FoodIncreasePerQuantityField() { return *GetNativePointerField<float*>(this, "UPrimalItem.Ingredient_FoodIncreasePerQuantity"); }
-	float& Ingredient_HealthIncreasePerQuantityField() { return *GetNativePointerField<float*>(this, "UPrimalItem.Ingredient_HealthIncreasePerQuantity"); }
-	float& Ingredient_WaterIncreasePerQuantityField() { return *GetNativePointerField<float*>(this, "UPrimalItem.Ingredient_WaterIncreasePerQuantity"); }
-	float& Ingredient_StaminaIncreasePerQuantityField() { return *GetNativePointerField<float*>(this, "UPrimalItem.Ingredient_StaminaIncreasePerQuantity"); }
-	FString& DescriptiveNameBaseField() { return *GetNativePointerField<FString*>(this, "UPrimalItem.DescriptiveNameBase"); }
-	FString& ItemDescriptionField() { return *GetNativePointerField<FString*>(this, "UPrimalItem.ItemDescription"); }
-	FString& DurabilityStringShortField() { return *GetNativePointerField<FString*>(this, "UPrimalItem.DurabilityStringShort"); }
-	FString& DurabilityStringField() { return *GetNativePointerField<FString*>(this, "UPrimalItem.DurabilityString"); }
-	FString& CustomRepairTextField() { return *GetNativePointerField<FString*>(this, "UPrimalItem.CustomRepairText"); }
-	float& DroppedItemLifeSpanOverrideField() { return *GetNativePointerField<float*>(this, "UPrimalItem.DroppedItemLifeSpanOverride"); }
-	UStaticMesh * DroppedMeshOverrideField() { return *GetNativePointerField<UStaticMesh **>(this, "UPrimalItem.DroppedMeshOverride"); }
-	UMaterialInterface * DroppedMeshMaterialOverrideField() { return *GetNativePointerField<UMaterialInterface **>(this, "UPrimalItem.DroppedMeshMaterialOverride"); }
-	FVector& DroppedMeshOverrideScale3DField() { return *GetNativePointerField<FVector*>(this, "UPrimalItem.DroppedMeshOverrideScale3D"); }
-	TSubclassOf<UPrimalItem>& SpoilingItemField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "UPrimalItem.SpoilingItem"); }
-	TArray<TSubclassOf<AActor>>& UseRequiresOwnerActorClassesField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*>(this, "UPrimalItem.UseRequiresOwnerActorClasses"); }
-	TSubclassOf<UPrimalItem>& PreservingItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "UPrimalItem.PreservingItemClass"); }
-	float& PreservingItemSpoilingTimeMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalItem.PreservingItemSpoilingTimeMultiplier"); }
-	float& SpoilingTimeField() { return *GetNativePointerField<float*>(this, "UPrimalItem.SpoilingTime"); }
-	int& CraftingConsumesDurabilityField() { return *GetNativePointerField<int*>(this, "UPrimalItem.CraftingConsumesDurability"); }
-	float& RepairResourceRequirementMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalItem.RepairResourceRequirementMultiplier"); }
-	float& BaseItemWeightField() { return *GetNativePointerField<float*>(this, "UPrimalItem.BaseItemWeight"); }
-	float& DurabilityIncreaseMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalItem.DurabilityIncreaseMultiplier"); }
-	float& NewItemDurabilityOverrideField() { return *GetNativePointerField<float*>(this, "UPrimalItem.NewItemDurabilityOverride"); }
-	float& DurabilityDecreaseMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalItem.DurabilityDecreaseMultiplier"); }
-	float& UseDecreaseDurabilityField() { return *GetNativePointerField<float*>(this, "UPrimalItem.UseDecreaseDurability"); }
-	float& AutoDurabilityDecreaseIntervalField() { return *GetNativePointerField<float*>(this, "UPrimalItem.AutoDurabilityDecreaseInterval"); }
-	float& AutoDecreaseMinDurabilityField() { return *GetNativePointerField<float*>(this, "UPrimalItem.AutoDecreaseMinDurability"); }
-	float& AutoDecreaseDurabilityAmountPerIntervalField() { return *GetNativePointerField<float*>(this, "UPrimalItem.AutoDecreaseDurabilityAmountPerInterval"); }
-	float& UseDecreaseDurabilityMinField() { return *GetNativePointerField<float*>(this, "UPrimalItem.UseDecreaseDurabilityMin"); }
-	float& UseMinDurabilityRequirementField() { return *GetNativePointerField<float*>(this, "UPrimalItem.UseMinDurabilityRequirement"); }
-	float& ResourceRarityField() { return *GetNativePointerField<float*>(this, "UPrimalItem.ResourceRarity"); }
-	float& BlueprintTimeToCraftField() { return *GetNativePointerField<float*>(this, "UPrimalItem.BlueprintTimeToCraft"); }
-	float& MinBlueprintTimeToCraftField() { return *GetNativePointerField<float*>(this, "UPrimalItem.MinBlueprintTimeToCraft"); }
-	float& BlueprintWeightField() { return *GetNativePointerField<float*>(this, "UPrimalItem.BlueprintWeight"); }
-	float& MinimumUseIntervalField() { return *GetNativePointerField<float*>(this, "UPrimalItem.MinimumUseInterval"); }
-	float& TimeForFullRepairField() { return *GetNativePointerField<float*>(this, "UPrimalItem.TimeForFullRepair"); }
-	float& BaseCraftingXPField() { return *GetNativePointerField<float*>(this, "UPrimalItem.BaseCraftingXP"); }
-	float& BaseRepairingXPField() { return *GetNativePointerField<float*>(this, "UPrimalItem.BaseRepairingXP"); }
-	TArray<FCraftingResourceRequirement>& BaseCraftingResourceRequirementsField() { return *GetNativePointerField<TArray<FCraftingResourceRequirement>*>(this, "UPrimalItem.BaseCraftingResourceRequirements"); }
-	TArray<FCraftingResourceRequirement>& OverrideRepairingRequirementsField() { return *GetNativePointerField<TArray<FCraftingResourceRequirement>*>(this, "UPrimalItem.OverrideRepairingRequirements"); }
+	float& DinoAutoHealingThresholdPercentField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.DinoAutoHealingThresholdPercent")>(this, "UPrimalItem.DinoAutoHealingThresholdPercent"); }
+	float& DinoAutoHealingUseTimeIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.DinoAutoHealingUseTimeInterval")>(this, "UPrimalItem.DinoAutoHealingUseTimeInterval"); }
+	int& ArkTributeVersionField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.ArkTributeVersion")>(this, "UPrimalItem.ArkTributeVersion"); }
+	TArray<TSubclassOf<AActor>>& EquipRequiresExplicitOwnerClassesField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*, API::FieldNameHash("UPrimalItem.EquipRequiresExplicitOwnerClasses")>(this, "UPrimalItem.EquipRequiresExplicitOwnerClasses"); }
+	TArray<FName>& EquipRequiresExplicitOwnerTagsField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("UPrimalItem.EquipRequiresExplicitOwnerTags")>(this, "UPrimalItem.EquipRequiresExplicitOwnerTags"); }
+	TSubclassOf<APrimalBuff>& BuffToGiveOwnerWhenEquippedField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*, API::FieldNameHash("UPrimalItem.BuffToGiveOwnerWhenEquipped")>(this, "UPrimalItem.BuffToGiveOwnerWhenEquipped"); }
+	FString& BuffToGiveOwnerWhenEquipped_BlueprintPathField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalItem.BuffToGiveOwnerWhenEquipped_BlueprintPath")>(this, "UPrimalItem.BuffToGiveOwnerWhenEquipped_BlueprintPath"); }
+	bool& bBuffToGiveOwnerWhenEquipped_SoftRefCachedField() { return *GetNativePointerField<bool*, API::FieldNameHash("UPrimalItem.bBuffToGiveOwnerWhenEquipped_SoftRefCached")>(this, "UPrimalItem.bBuffToGiveOwnerWhenEquipped_SoftRefCached"); }
+	unsigned int& ExpirationTimeUTCField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("UPrimalItem.ExpirationTimeUTC")>(this, "UPrimalItem.ExpirationTimeUTC"); }
+	int& BlueprintAllowMaxCraftingsField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.BlueprintAllowMaxCraftings")>(this, "UPrimalItem.BlueprintAllowMaxCraftings"); }
+	FString& AbstractItemCraftingDescriptionField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalItem.AbstractItemCraftingDescription")>(this, "UPrimalItem.AbstractItemCraftingDescription"); }
+	TArray<TSubclassOf<UPrimalItem>>& ItemSkinUseOnItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalItem.ItemSkinUseOnItemClasses")>(this, "UPrimalItem.ItemSkinUseOnItemClasses"); }
+	TArray<TSubclassOf<UPrimalItem>>& ItemSkinPreventOnItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalItem.ItemSkinPreventOnItemClasses")>(this, "UPrimalItem.ItemSkinPreventOnItemClasses"); }
+	USoundBase * ItemBrokenSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalItem.ItemBrokenSound")>(this, "UPrimalItem.ItemBrokenSound"); }
+	USoundCue * UseItemSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("UPrimalItem.UseItemSound")>(this, "UPrimalItem.UseItemSound"); }
+	USoundBase * EquipSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalItem.EquipSound")>(this, "UPrimalItem.EquipSound"); }
+	USoundBase * UnEquipSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalItem.UnEquipSound")>(this, "UPrimalItem.UnEquipSound"); }
+	USoundBase * UsedOnOtherItemSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalItem.UsedOnOtherItemSound")>(this, "UPrimalItem.UsedOnOtherItemSound"); }
+	USoundBase * RemovedFromOtherItemSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalItem.RemovedFromOtherItemSound")>(this, "UPrimalItem.RemovedFromOtherItemSound"); }
+	float& RandomChanceToBeBlueprintField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.RandomChanceToBeBlueprint")>(this, "UPrimalItem.RandomChanceToBeBlueprint"); }
+	TArray<FActorClassAttachmentInfo>& ActorClassAttachmentInfosField() { return *GetNativePointerField<TArray<FActorClassAttachmentInfo>*, API::FieldNameHash("UPrimalItem.ActorClassAttachmentInfos")>(this, "UPrimalItem.ActorClassAttachmentInfos"); }
+	TArray<FItemAttachmentInfo> * ItemAttachmentInfosField() { return *GetNativePointerField<TArray<FItemAttachmentInfo> **, API::FieldNameHash("UPrimalItem.ItemAttachmentInfos")>(this, "UPrimalItem.ItemAttachmentInfos"); }
+	TArray<FItemAttachmentInfo>& DynamicItemAttachmentInfosField() { return *GetNativePointerField<TArray<FItemAttachmentInfo>*, API::FieldNameHash("UPrimalItem.DynamicItemAttachmentInfos")>(this, "UPrimalItem.DynamicItemAttachmentInfos"); }
+	TArray<FItemAttachmentInfo>& ItemSkinAddItemAttachmentsField() { return *GetNativePointerField<TArray<FItemAttachmentInfo>*, API::FieldNameHash("UPrimalItem.ItemSkinAddItemAttachments")>(this, "UPrimalItem.ItemSkinAddItemAttachments"); }
+	TEnumAsByte<enum EPrimalItemType::Type>& MyItemTypeField() { return *GetNativePointerField<TEnumAsByte<enum EPrimalItemType::Type>*, API::FieldNameHash("UPrimalItem.MyItemType")>(this, "UPrimalItem.MyItemType"); }
+	TEnumAsByte<enum EPrimalConsumableType::Type>& MyConsumableTypeField() { return *GetNativePointerField<TEnumAsByte<enum EPrimalConsumableType::Type>*, API::FieldNameHash("UPrimalItem.MyConsumableType")>(this, "UPrimalItem.MyConsumableType"); }
+	TEnumAsByte<enum EPrimalEquipmentType::Type>& MyEquipmentTypeField() { return *GetNativePointerField<TEnumAsByte<enum EPrimalEquipmentType::Type>*, API::FieldNameHash("UPrimalItem.MyEquipmentType")>(this, "UPrimalItem.MyEquipmentType"); }
+	int& ExtraItemCategoryFlagsField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.ExtraItemCategoryFlags")>(this, "UPrimalItem.ExtraItemCategoryFlags"); }
+	FVector& BlockingShieldFPVTranslationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UPrimalItem.BlockingShieldFPVTranslation")>(this, "UPrimalItem.BlockingShieldFPVTranslation"); }
+	FRotator& BlockingShieldFPVRotationField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("UPrimalItem.BlockingShieldFPVRotation")>(this, "UPrimalItem.BlockingShieldFPVRotation"); }
+	float& ShieldBlockDamagePercentageField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.ShieldBlockDamagePercentage")>(this, "UPrimalItem.ShieldBlockDamagePercentage"); }
+	float& ShieldDamageToDurabilityRatioField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.ShieldDamageToDurabilityRatio")>(this, "UPrimalItem.ShieldDamageToDurabilityRatio"); }
+	UAnimMontage * PlayAnimationOnUseField() { return *GetNativePointerField<UAnimMontage **, API::FieldNameHash("UPrimalItem.PlayAnimationOnUse")>(this, "UPrimalItem.PlayAnimationOnUse"); }
+	int& CraftingMinLevelRequirementField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.CraftingMinLevelRequirement")>(this, "UPrimalItem.CraftingMinLevelRequirement"); }
+	float& CraftingCooldownIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.CraftingCooldownInterval")>(this, "UPrimalItem.CraftingCooldownInterval"); }
+	TSubclassOf<AActor>& CraftingActorToSpawnField() { return *GetNativePointerField<TSubclassOf<AActor>*, API::FieldNameHash("UPrimalItem.CraftingActorToSpawn")>(this, "UPrimalItem.CraftingActorToSpawn"); }
+	UTexture2D * BlueprintBackgroundOverrideTextureField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalItem.BlueprintBackgroundOverrideTexture")>(this, "UPrimalItem.BlueprintBackgroundOverrideTexture"); }
+	FString& CraftItemButtonStringOverrideField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalItem.CraftItemButtonStringOverride")>(this, "UPrimalItem.CraftItemButtonStringOverride"); }
+	TSubclassOf<AActor>& UseSpawnActorClassField() { return *GetNativePointerField<TSubclassOf<AActor>*, API::FieldNameHash("UPrimalItem.UseSpawnActorClass")>(this, "UPrimalItem.UseSpawnActorClass"); }
+	FVector& UseSpawnActorLocOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UPrimalItem.UseSpawnActorLocOffset")>(this, "UPrimalItem.UseSpawnActorLocOffset"); }
+	int& SlotIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.SlotIndex")>(this, "UPrimalItem.SlotIndex"); }
+	FItemNetID& ItemIDField() { return *GetNativePointerField<FItemNetID*, API::FieldNameHash("UPrimalItem.ItemID")>(this, "UPrimalItem.ItemID"); }
+	int& ItemCustomDataField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.ItemCustomData")>(this, "UPrimalItem.ItemCustomData"); }
+	TSubclassOf<UPrimalItem>& ItemCustomClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("UPrimalItem.ItemCustomClass")>(this, "UPrimalItem.ItemCustomClass"); }
+	int& ItemSkinTemplateIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.ItemSkinTemplateIndex")>(this, "UPrimalItem.ItemSkinTemplateIndex"); }
+	TSubclassOf<UPrimalItem>& ItemSkinTemplateField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("UPrimalItem.ItemSkinTemplate")>(this, "UPrimalItem.ItemSkinTemplate"); }
+	float& ItemRatingField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.ItemRating")>(this, "UPrimalItem.ItemRating"); }
+	unsigned __int16& CraftQueueField() { return *GetNativePointerField<unsigned __int16*, API::FieldNameHash("UPrimalItem.CraftQueue")>(this, "UPrimalItem.CraftQueue"); }
+	float& CraftingSkillField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.CraftingSkill")>(this, "UPrimalItem.CraftingSkill"); }
+	FString& CustomItemNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalItem.CustomItemName")>(this, "UPrimalItem.CustomItemName"); }
+	FString& CustomItemDescriptionField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalItem.CustomItemDescription")>(this, "UPrimalItem.CustomItemDescription"); }
+	TArray<FColor>& CustomColorsField() { return *GetNativePointerField<TArray<FColor>*, API::FieldNameHash("UPrimalItem.CustomColors")>(this, "UPrimalItem.CustomColors"); }
+	TArray<FCraftingResourceRequirement>& CustomResourceRequirementsField() { return *GetNativePointerField<TArray<FCraftingResourceRequirement>*, API::FieldNameHash("UPrimalItem.CustomResourceRequirements")>(this, "UPrimalItem.CustomResourceRequirements"); }
+	long double& NextCraftCompletionTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimalItem.NextCraftCompletionTime")>(this, "UPrimalItem.NextCraftCompletionTime"); }
+	TWeakObjectPtr<UPrimalInventoryComponent>& OwnerInventoryField() { return *GetNativePointerField<TWeakObjectPtr<UPrimalInventoryComponent>*, API::FieldNameHash("UPrimalItem.OwnerInventory")>(this, "UPrimalItem.OwnerInventory"); }
+	char& ItemQualityIndexField() { return *GetNativePointerField<char*, API::FieldNameHash("UPrimalItem.ItemQualityIndex")>(this, "UPrimalItem.ItemQualityIndex"); }
+	TSubclassOf<UPrimalItem>& SupportDragOntoItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("UPrimalItem.SupportDragOntoItemClass")>(this, "UPrimalItem.SupportDragOntoItemClass"); }
+	TArray<TSubclassOf<UPrimalItem>>& SupportDragOntoItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalItem.SupportDragOntoItemClasses")>(this, "UPrimalItem.SupportDragOntoItemClasses"); }
+	TArray<TSubclassOf<AShooterWeapon>>& SkinWeaponTemplatesField() { return *GetNativePointerField<TArray<TSubclassOf<AShooterWeapon>>*, API::FieldNameHash("UPrimalItem.SkinWeaponTemplates")>(this, "UPrimalItem.SkinWeaponTemplates"); }
+	TSubclassOf<AShooterWeapon>& AmmoSupportDragOntoWeaponItemWeaponTemplateField() { return *GetNativePointerField<TSubclassOf<AShooterWeapon>*, API::FieldNameHash("UPrimalItem.AmmoSupportDragOntoWeaponItemWeaponTemplate")>(this, "UPrimalItem.AmmoSupportDragOntoWeaponItemWeaponTemplate"); }
+	TArray<TSubclassOf<AShooterWeapon>>& AmmoSupportDragOntoWeaponItemWeaponTemplatesField() { return *GetNativePointerField<TArray<TSubclassOf<AShooterWeapon>>*, API::FieldNameHash("UPrimalItem.AmmoSupportDragOntoWeaponItemWeaponTemplates")>(this, "UPrimalItem.AmmoSupportDragOntoWeaponItemWeaponTemplates"); }
+	float& Ingredient_WeightIncreasePerQuantityField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.Ingredient_WeightIncreasePerQuantity")>(this, "UPrimalItem.Ingredient_WeightIncreasePerQuantity"); }
+	float& Ingredient_FoodIncreasePerQuantityField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.Ingredient_FoodIncreasePerQuantity")>(this, "UPrimalItem.Ingredient_FoodIncreasePerQuantity"); }
+	float& Ingredient_HealthIncreasePerQuantityField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.Ingredient_HealthIncreasePerQuantity")>(this, "UPrimalItem.Ingredient_HealthIncreasePerQuantity"); }
+	float& Ingredient_WaterIncreasePerQuantityField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.Ingredient_WaterIncreasePerQuantity")>(this, "UPrimalItem.Ingredient_WaterIncreasePerQuantity"); }
+	float& Ingredient_StaminaIncreasePerQuantityField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.Ingredient_StaminaIncreasePerQuantity")>(this, "UPrimalItem.Ingredient_StaminaIncreasePerQuantity"); }
+	FString& DescriptiveNameBaseField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalItem.DescriptiveNameBase")>(this, "UPrimalItem.DescriptiveNameBase"); }
+	FString& ItemDescriptionField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalItem.ItemDescription")>(this, "UPrimalItem.ItemDescription"); }
+	FString& DurabilityStringShortField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalItem.DurabilityStringShort")>(this, "UPrimalItem.DurabilityStringShort"); }
+	FString& DurabilityStringField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalItem.DurabilityString")>(this, "UPrimalItem.DurabilityString"); }
+	FString& CustomRepairTextField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalItem.CustomRepairText")>(this, "UPrimalItem.CustomRepairText"); }
+	float& DroppedItemLifeSpanOverrideField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.DroppedItemLifeSpanOverride")>(this, "UPrimalItem.DroppedItemLifeSpanOverride"); }
+	UStaticMesh * DroppedMeshOverrideField() { return *GetNativePointerField<UStaticMesh **, API::FieldNameHash("UPrimalItem.DroppedMeshOverride")>(this, "UPrimalItem.DroppedMeshOverride"); }
+	UMaterialInterface * DroppedMeshMaterialOverrideField() { return *GetNativePointerField<UMaterialInterface **, API::FieldNameHash("UPrimalItem.DroppedMeshMaterialOverride")>(this, "UPrimalItem.DroppedMeshMaterialOverride"); }
+	FVector& DroppedMeshOverrideScale3DField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UPrimalItem.DroppedMeshOverrideScale3D")>(this, "UPrimalItem.DroppedMeshOverrideScale3D"); }
+	TSubclassOf<UPrimalItem>& SpoilingItemField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("UPrimalItem.SpoilingItem")>(this, "UPrimalItem.SpoilingItem"); }
+	TArray<TSubclassOf<AActor>>& UseRequiresOwnerActorClassesField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*, API::FieldNameHash("UPrimalItem.UseRequiresOwnerActorClasses")>(this, "UPrimalItem.UseRequiresOwnerActorClasses"); }
+	TSubclassOf<UPrimalItem>& PreservingItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("UPrimalItem.PreservingItemClass")>(this, "UPrimalItem.PreservingItemClass"); }
+	float& PreservingItemSpoilingTimeMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.PreservingItemSpoilingTimeMultiplier")>(this, "UPrimalItem.PreservingItemSpoilingTimeMultiplier"); }
+	float& SpoilingTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.SpoilingTime")>(this, "UPrimalItem.SpoilingTime"); }
+	int& CraftingConsumesDurabilityField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.CraftingConsumesDurability")>(this, "UPrimalItem.CraftingConsumesDurability"); }
+	float& RepairResourceRequirementMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.RepairResourceRequirementMultiplier")>(this, "UPrimalItem.RepairResourceRequirementMultiplier"); }
+	float& BaseItemWeightField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.BaseItemWeight")>(this, "UPrimalItem.BaseItemWeight"); }
+	float& DurabilityIncreaseMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.DurabilityIncreaseMultiplier")>(this, "UPrimalItem.DurabilityIncreaseMultiplier"); }
+	float& NewItemDurabilityOverrideField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.NewItemDurabilityOverride")>(this, "UPrimalItem.NewItemDurabilityOverride"); }
+	float& DurabilityDecreaseMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.DurabilityDecreaseMultiplier")>(this, "UPrimalItem.DurabilityDecreaseMultiplier"); }
+	float& UseDecreaseDurabilityField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.UseDecreaseDurability")>(this, "UPrimalItem.UseDecreaseDurability"); }
+	float& AutoDurabilityDecreaseIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.AutoDurabilityDecreaseInterval")>(this, "UPrimalItem.AutoDurabilityDecreaseInterval"); }
+	float& AutoDecreaseMinDurabilityField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.AutoDecreaseMinDurability")>(this, "UPrimalItem.AutoDecreaseMinDurability"); }
+	float& AutoDecreaseDurabilityAmountPerIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.AutoDecreaseDurabilityAmountPerInterval")>(this, "UPrimalItem.AutoDecreaseDurabilityAmountPerInterval"); }
+	float& UseDecreaseDurabilityMinField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.UseDecreaseDurabilityMin")>(this, "UPrimalItem.UseDecreaseDurabilityMin"); }
+	float& UseMinDurabilityRequirementField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.UseMinDurabilityRequirement")>(this, "UPrimalItem.UseMinDurabilityRequirement"); }
+	float& ResourceRarityField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.ResourceRarity")>(this, "UPrimalItem.ResourceRarity"); }
+	float& BlueprintTimeToCraftField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.BlueprintTimeToCraft")>(this, "UPrimalItem.BlueprintTimeToCraft"); }
+	float& MinBlueprintTimeToCraftField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.MinBlueprintTimeToCraft")>(this, "UPrimalItem.MinBlueprintTimeToCraft"); }
+	float& BlueprintWeightField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.BlueprintWeight")>(this, "UPrimalItem.BlueprintWeight"); }
+	float& MinimumUseIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.MinimumUseInterval")>(this, "UPrimalItem.MinimumUseInterval"); }
+	float& TimeForFullRepairField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.TimeForFullRepair")>(this, "UPrimalItem.TimeForFullRepair"); }
+	float& BaseCraftingXPField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.BaseCraftingXP")>(this, "UPrimalItem.BaseCraftingXP"); }
+	float& BaseRepairingXPField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.BaseRepairingXP")>(this, "UPrimalItem.BaseRepairingXP"); }
+	TArray<FCraftingResourceRequirement>& BaseCraftingResourceRequirementsField() { return *GetNativePointerField<TArray<FCraftingResourceRequirement>*, API::FieldNameHash("UPrimalItem.BaseCraftingResourceRequirements")>(this, "UPrimalItem.BaseCraftingResourceRequirements"); }
+	TArray<FCraftingResourceRequirement>& OverrideRepairingRequirementsField() { return *GetNativePointerField<TArray<FCraftingResourceRequirement>*, API::FieldNameHash("UPrimalItem.OverrideRepairingRequirements")>(this, "UPrimalItem.OverrideRepairingRequirements"); }
 	FieldArray<FItemStatInfo, 8> ItemStatInfosField() { return { this, "UPrimalItem.ItemStatInfos" }; }
 	FieldArray<unsigned __int16, 8> ItemStatValuesField() { return { this, "UPrimalItem.ItemStatValues" }; }
-	unsigned int& WeaponClipAmmoField() { return *GetNativePointerField<unsigned int*>(this, "UPrimalItem.WeaponClipAmmo"); }
-	float& WeaponFrequencyField() { return *GetNativePointerField<float*>(this, "UPrimalItem.WeaponFrequency"); }
-	long double& LastTimeToShowInfoField() { return *GetNativePointerField<long double*>(this, "UPrimalItem.LastTimeToShowInfo"); }
-	char& ItemVersionField() { return *GetNativePointerField<char*>(this, "UPrimalItem.ItemVersion"); }
-	float& ItemDurabilityField() { return *GetNativePointerField<float*>(this, "UPrimalItem.ItemDurability"); }
-	float& MinItemDurabilityField() { return *GetNativePointerField<float*>(this, "UPrimalItem.MinItemDurability"); }
-	float& SavedDurabilityField() { return *GetNativePointerField<float*>(this, "UPrimalItem.SavedDurability"); }
-	TSubclassOf<AShooterWeapon>& WeaponTemplateField() { return *GetNativePointerField<TSubclassOf<AShooterWeapon>*>(this, "UPrimalItem.WeaponTemplate"); }
-	UTexture2D * BrokenIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalItem.BrokenIcon"); }
-	UTexture2D * ItemIconField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalItem.ItemIcon"); }
-	UTexture2D * AlternateItemIconBelowDurabilityField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalItem.AlternateItemIconBelowDurability"); }
-	float& AlternateItemIconBelowDurabilityValueField() { return *GetNativePointerField<float*>(this, "UPrimalItem.AlternateItemIconBelowDurabilityValue"); }
-	float& DurabilityNotifyThresholdValueField() { return *GetNativePointerField<float*>(this, "UPrimalItem.DurabilityNotifyThresholdValue"); }
-	UMaterialInterface * ItemIconMaterialParentField() { return *GetNativePointerField<UMaterialInterface **>(this, "UPrimalItem.ItemIconMaterialParent"); }
+	unsigned int& WeaponClipAmmoField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("UPrimalItem.WeaponClipAmmo")>(this, "UPrimalItem.WeaponClipAmmo"); }
+	float& WeaponFrequencyField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.WeaponFrequency")>(this, "UPrimalItem.WeaponFrequency"); }
+	long double& LastTimeToShowInfoField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimalItem.LastTimeToShowInfo")>(this, "UPrimalItem.LastTimeToShowInfo"); }
+	char& ItemVersionField() { return *GetNativePointerField<char*, API::FieldNameHash("UPrimalItem.ItemVersion")>(this, "UPrimalItem.ItemVersion"); }
+	float& ItemDurabilityField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.ItemDurability")>(this, "UPrimalItem.ItemDurability"); }
+	float& MinItemDurabilityField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.MinItemDurability")>(this, "UPrimalItem.MinItemDurability"); }
+	float& SavedDurabilityField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.SavedDurability")>(this, "UPrimalItem.SavedDurability"); }
+	TSubclassOf<AShooterWeapon>& WeaponTemplateField() { return *GetNativePointerField<TSubclassOf<AShooterWeapon>*, API::FieldNameHash("UPrimalItem.WeaponTemplate")>(this, "UPrimalItem.WeaponTemplate"); }
+	UTexture2D * BrokenIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalItem.BrokenIcon")>(this, "UPrimalItem.BrokenIcon"); }
+	UTexture2D * ItemIconField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalItem.ItemIcon")>(this, "UPrimalItem.ItemIcon"); }
+	UTexture2D * AlternateItemIconBelowDurabilityField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalItem.AlternateItemIconBelowDurability")>(this, "UPrimalItem.AlternateItemIconBelowDurability"); }
+	float& AlternateItemIconBelowDurabilityValueField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.AlternateItemIconBelowDurabilityValue")>(this, "UPrimalItem.AlternateItemIconBelowDurabilityValue"); }
+	float& DurabilityNotifyThresholdValueField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.DurabilityNotifyThresholdValue")>(this, "UPrimalItem.DurabilityNotifyThresholdValue"); }
+	UMaterialInterface * ItemIconMaterialParentField() { return *GetNativePointerField<UMaterialInterface **, API::FieldNameHash("UPrimalItem.ItemIconMaterialParent")>(this, "UPrimalItem.ItemIconMaterialParent"); }
 	FieldArray<__int16, 6> ItemColorIDField() { return { this, "UPrimalItem.ItemColorID" }; }
 	FieldArray<__int16, 6> PreSkinItemColorIDField() { return { this, "UPrimalItem.PreSkinItemColorID" }; }
 	FieldArray<char, 6> bUseItemColorField() { return { this, "UPrimalItem.bUseItemColor" }; }
-	int& ItemQuantityField() { return *GetNativePointerField<int*>(this, "UPrimalItem.ItemQuantity"); }
-	int& MaxItemQuantityField() { return *GetNativePointerField<int*>(this, "UPrimalItem.MaxItemQuantity"); }
-	TArray<unsigned __int64>& SteamItemUserIDsField() { return *GetNativePointerField<TArray<unsigned __int64>*>(this, "UPrimalItem.SteamItemUserIDs"); }
-	TSubclassOf<APrimalStructure>& StructureToBuildField() { return *GetNativePointerField<TSubclassOf<APrimalStructure>*>(this, "UPrimalItem.StructureToBuild"); }
-	TSubclassOf<UPrimalItem>& GiveItemWhenUsedField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "UPrimalItem.GiveItemWhenUsed"); }
-	TArray<TSubclassOf<UPrimalInventoryComponent>>& CraftingRequiresInventoryComponentField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalInventoryComponent>>*>(this, "UPrimalItem.CraftingRequiresInventoryComponent"); }
-	TSubclassOf<ADroppedItem>& DroppedItemTemplateOverrideField() { return *GetNativePointerField<TSubclassOf<ADroppedItem>*>(this, "UPrimalItem.DroppedItemTemplateOverride"); }
-	TSubclassOf<ADroppedItem>& DroppedItemTemplateForSecondryActionField() { return *GetNativePointerField<TSubclassOf<ADroppedItem>*>(this, "UPrimalItem.DroppedItemTemplateForSecondryAction"); }
-	TSubclassOf<APrimalBuff>& BuffToGiveOwnerCharacterField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*>(this, "UPrimalItem.BuffToGiveOwnerCharacter"); }
-	FRotator& PreviewCameraRotationField() { return *GetNativePointerField<FRotator*>(this, "UPrimalItem.PreviewCameraRotation"); }
-	FVector& PreviewCameraPivotOffsetField() { return *GetNativePointerField<FVector*>(this, "UPrimalItem.PreviewCameraPivotOffset"); }
-	float& PreviewCameraDistanceScaleFactorField() { return *GetNativePointerField<float*>(this, "UPrimalItem.PreviewCameraDistanceScaleFactor"); }
-	float& PreviewCameraDefaultZoomMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalItem.PreviewCameraDefaultZoomMultiplier"); }
-	float& PreviewCameraMaxZoomMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalItem.PreviewCameraMaxZoomMultiplier"); }
-	FName& PlayerMeshTextureMaskParamNameField() { return *GetNativePointerField<FName*>(this, "UPrimalItem.PlayerMeshTextureMaskParamName"); }
-	UTexture2D * PlayerMeshTextureMaskField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalItem.PlayerMeshTextureMask"); }
-	UTexture2D * PlayerMeshNoItemDefaultTextureMaskField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalItem.PlayerMeshNoItemDefaultTextureMask"); }
-	int& PlayerMeshTextureMaskMaterialIndexField() { return *GetNativePointerField<int*>(this, "UPrimalItem.PlayerMeshTextureMaskMaterialIndex"); }
-	FName& FPVHandsMeshTextureMaskParamNameField() { return *GetNativePointerField<FName*>(this, "UPrimalItem.FPVHandsMeshTextureMaskParamName"); }
-	UTexture2D * FPVHandsMeshTextureMaskField() { return *GetNativePointerField<UTexture2D **>(this, "UPrimalItem.FPVHandsMeshTextureMask"); }
-	int& FPVHandsMeshTextureMaskMaterialIndexField() { return *GetNativePointerField<int*>(this, "UPrimalItem.FPVHandsMeshTextureMaskMaterialIndex"); }
-	int& FPVHandsMeshTextureMaskMaterialIndex2Field() { return *GetNativePointerField<int*>(this, "UPrimalItem.FPVHandsMeshTextureMaskMaterialIndex2"); }
-	UPrimalItem * WeaponAmmoOverrideItemCDOField() { return *GetNativePointerField<UPrimalItem **>(this, "UPrimalItem.WeaponAmmoOverrideItemCDO"); }
-	long double& CreationTimeField() { return *GetNativePointerField<long double*>(this, "UPrimalItem.CreationTime"); }
-	long double& LastAutoDurabilityDecreaseTimeField() { return *GetNativePointerField<long double*>(this, "UPrimalItem.LastAutoDurabilityDecreaseTime"); }
-	long double& LastUseTimeField() { return *GetNativePointerField<long double*>(this, "UPrimalItem.LastUseTime"); }
-	long double& LastLocalUseTimeField() { return *GetNativePointerField<long double*>(this, "UPrimalItem.LastLocalUseTime"); }
-	int& TempSlotIndexField() { return *GetNativePointerField<int*>(this, "UPrimalItem.TempSlotIndex"); }
-	TWeakObjectPtr<AShooterWeapon>& AssociatedWeaponField() { return *GetNativePointerField<TWeakObjectPtr<AShooterWeapon>*>(this, "UPrimalItem.AssociatedWeapon"); }
-	UPrimalItem * MyItemSkinField() { return *GetNativePointerField<UPrimalItem **>(this, "UPrimalItem.MyItemSkin"); }
-	TWeakObjectPtr<AShooterCharacter>& LastOwnerPlayerField() { return *GetNativePointerField<TWeakObjectPtr<AShooterCharacter>*>(this, "UPrimalItem.LastOwnerPlayer"); }
-	float& CropGrowingFertilizerConsumptionRateField() { return *GetNativePointerField<float*>(this, "UPrimalItem.CropGrowingFertilizerConsumptionRate"); }
-	float& CropMaxFruitFertilizerConsumptionRateField() { return *GetNativePointerField<float*>(this, "UPrimalItem.CropMaxFruitFertilizerConsumptionRate"); }
-	float& CropGrowingWaterConsumptionRateField() { return *GetNativePointerField<float*>(this, "UPrimalItem.CropGrowingWaterConsumptionRate"); }
-	float& CropMaxFruitWaterConsumptionRateField() { return *GetNativePointerField<float*>(this, "UPrimalItem.CropMaxFruitWaterConsumptionRate"); }
-	int& CropMaxFruitsField() { return *GetNativePointerField<int*>(this, "UPrimalItem.CropMaxFruits"); }
-	float& CropNoFertilizerOrWaterCacheReductionRateField() { return *GetNativePointerField<float*>(this, "UPrimalItem.CropNoFertilizerOrWaterCacheReductionRate"); }
-	float& FertilizerEffectivenessMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalItem.FertilizerEffectivenessMultiplier"); }
-	float& EggAlertDinosAggroAmountField() { return *GetNativePointerField<float*>(this, "UPrimalItem.EggAlertDinosAggroAmount"); }
-	float& EggAlertDinosAggroRadiusField() { return *GetNativePointerField<float*>(this, "UPrimalItem.EggAlertDinosAggroRadius"); }
-	TArray<FName>& EggAlertDinosAggroTagsField() { return *GetNativePointerField<TArray<FName>*>(this, "UPrimalItem.EggAlertDinosAggroTags"); }
-	float& EggAlertDinosForcedAggroTimeField() { return *GetNativePointerField<float*>(this, "UPrimalItem.EggAlertDinosForcedAggroTime"); }
-	float& EggMaximumDistanceFromOriginalDropToAlertDinosField() { return *GetNativePointerField<float*>(this, "UPrimalItem.EggMaximumDistanceFromOriginalDropToAlertDinos"); }
-	TSubclassOf<UPrimalItem>& BrokenGiveItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "UPrimalItem.BrokenGiveItemClass"); }
-	float& ClearColorDurabilityThresholdField() { return *GetNativePointerField<float*>(this, "UPrimalItem.ClearColorDurabilityThreshold"); }
-	TSubclassOf<UPrimalItem>& ItemClassToUseAsInitialCustomDataField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "UPrimalItem.ItemClassToUseAsInitialCustomData"); }
-	FVector& OriginalItemDropLocationField() { return *GetNativePointerField<FVector*>(this, "UPrimalItem.OriginalItemDropLocation"); }
-	FLinearColor& DurabilityBarColorForegroundField() { return *GetNativePointerField<FLinearColor*>(this, "UPrimalItem.DurabilityBarColorForeground"); }
-	FLinearColor& DurabilityBarColorBackgroundField() { return *GetNativePointerField<FLinearColor*>(this, "UPrimalItem.DurabilityBarColorBackground"); }
-	TSubclassOf<UPrimalItem>& OverrideCooldownTimeItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "UPrimalItem.OverrideCooldownTimeItemClass"); }
-	float& MinDurabilityForCraftingResourceField() { return *GetNativePointerField<float*>(this, "UPrimalItem.MinDurabilityForCraftingResource"); }
-	float& ResourceRequirementIncreaseRatingPowerField() { return *GetNativePointerField<float*>(this, "UPrimalItem.ResourceRequirementIncreaseRatingPower"); }
-	float& ResourceRequirementRatingScaleField() { return *GetNativePointerField<float*>(this, "UPrimalItem.ResourceRequirementRatingScale"); }
-	float& ResourceRequirementRatingIncreasePercentageField() { return *GetNativePointerField<float*>(this, "UPrimalItem.ResourceRequirementRatingIncreasePercentage"); }
-	long double& NextSpoilingTimeField() { return *GetNativePointerField<long double*>(this, "UPrimalItem.NextSpoilingTime"); }
-	long double& LastSpoilingTimeField() { return *GetNativePointerField<long double*>(this, "UPrimalItem.LastSpoilingTime"); }
-	TArray<FString>& DefaultFolderPathsField() { return *GetNativePointerField<TArray<FString>*>(this, "UPrimalItem.DefaultFolderPaths"); }
-	FString& ItemRatingStringField() { return *GetNativePointerField<FString*>(this, "UPrimalItem.ItemRatingString"); }
-	FName& DefaultWeaponMeshNameField() { return *GetNativePointerField<FName*>(this, "UPrimalItem.DefaultWeaponMeshName"); }
-	int& LastCalculatedTotalAmmoInvUpdatedFrameField() { return *GetNativePointerField<int*>(this, "UPrimalItem.LastCalculatedTotalAmmoInvUpdatedFrame"); }
-	int& WeaponTotalAmmoField() { return *GetNativePointerField<int*>(this, "UPrimalItem.WeaponTotalAmmo"); }
-	TSubclassOf<UPrimalItem>& EngramRequirementItemClassOverrideField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "UPrimalItem.EngramRequirementItemClassOverride"); }
-	TArray<unsigned short>& CraftingResourceRequirementsField() { return *GetNativePointerField<TArray<unsigned short>*>(this, "UPrimalItem.CraftingResourceRequirements"); }
-	USoundBase * ExtraThrowItemSoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalItem.ExtraThrowItemSound"); }
-	FVector& SpawnOnWaterEncroachmentBoxExtentField() { return *GetNativePointerField<FVector*>(this, "UPrimalItem.SpawnOnWaterEncroachmentBoxExtent"); }
-	TArray<TSubclassOf<AActor>>& OnlyUsableOnSpecificClassesField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*>(this, "UPrimalItem.OnlyUsableOnSpecificClasses"); }
-	TArray<FSaddlePassengerSeatDefinition>& SaddlePassengerSeatsField() { return *GetNativePointerField<TArray<FSaddlePassengerSeatDefinition>*>(this, "UPrimalItem.SaddlePassengerSeats"); }
-	FName& SaddleOverrideRiderSocketNameField() { return *GetNativePointerField<FName*>(this, "UPrimalItem.SaddleOverrideRiderSocketName"); }
-	TSubclassOf<APrimalDinoCharacter>& EggDinoClassToSpawnField() { return *GetNativePointerField<TSubclassOf<APrimalDinoCharacter>*>(this, "UPrimalItem.EggDinoClassToSpawn"); }
+	int& ItemQuantityField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.ItemQuantity")>(this, "UPrimalItem.ItemQuantity"); }
+	int& MaxItemQuantityField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.MaxItemQuantity")>(this, "UPrimalItem.MaxItemQuantity"); }
+	TArray<unsigned __int64>& SteamItemUserIDsField() { return *GetNativePointerField<TArray<unsigned __int64>*, API::FieldNameHash("UPrimalItem.SteamItemUserIDs")>(this, "UPrimalItem.SteamItemUserIDs"); }
+	TSubclassOf<APrimalStructure>& StructureToBuildField() { return *GetNativePointerField<TSubclassOf<APrimalStructure>*, API::FieldNameHash("UPrimalItem.StructureToBuild")>(this, "UPrimalItem.StructureToBuild"); }
+	TSubclassOf<UPrimalItem>& GiveItemWhenUsedField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("UPrimalItem.GiveItemWhenUsed")>(this, "UPrimalItem.GiveItemWhenUsed"); }
+	TArray<TSubclassOf<UPrimalInventoryComponent>>& CraftingRequiresInventoryComponentField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalInventoryComponent>>*, API::FieldNameHash("UPrimalItem.CraftingRequiresInventoryComponent")>(this, "UPrimalItem.CraftingRequiresInventoryComponent"); }
+	TSubclassOf<ADroppedItem>& DroppedItemTemplateOverrideField() { return *GetNativePointerField<TSubclassOf<ADroppedItem>*, API::FieldNameHash("UPrimalItem.DroppedItemTemplateOverride")>(this, "UPrimalItem.DroppedItemTemplateOverride"); }
+	TSubclassOf<ADroppedItem>& DroppedItemTemplateForSecondryActionField() { return *GetNativePointerField<TSubclassOf<ADroppedItem>*, API::FieldNameHash("UPrimalItem.DroppedItemTemplateForSecondryAction")>(this, "UPrimalItem.DroppedItemTemplateForSecondryAction"); }
+	TSubclassOf<APrimalBuff>& BuffToGiveOwnerCharacterField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*, API::FieldNameHash("UPrimalItem.BuffToGiveOwnerCharacter")>(this, "UPrimalItem.BuffToGiveOwnerCharacter"); }
+	FRotator& PreviewCameraRotationField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("UPrimalItem.PreviewCameraRotation")>(this, "UPrimalItem.PreviewCameraRotation"); }
+	FVector& PreviewCameraPivotOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UPrimalItem.PreviewCameraPivotOffset")>(this, "UPrimalItem.PreviewCameraPivotOffset"); }
+	float& PreviewCameraDistanceScaleFactorField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.PreviewCameraDistanceScaleFactor")>(this, "UPrimalItem.PreviewCameraDistanceScaleFactor"); }
+	float& PreviewCameraDefaultZoomMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.PreviewCameraDefaultZoomMultiplier")>(this, "UPrimalItem.PreviewCameraDefaultZoomMultiplier"); }
+	float& PreviewCameraMaxZoomMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.PreviewCameraMaxZoomMultiplier")>(this, "UPrimalItem.PreviewCameraMaxZoomMultiplier"); }
+	FName& PlayerMeshTextureMaskParamNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("UPrimalItem.PlayerMeshTextureMaskParamName")>(this, "UPrimalItem.PlayerMeshTextureMaskParamName"); }
+	UTexture2D * PlayerMeshTextureMaskField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalItem.PlayerMeshTextureMask")>(this, "UPrimalItem.PlayerMeshTextureMask"); }
+	UTexture2D * PlayerMeshNoItemDefaultTextureMaskField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalItem.PlayerMeshNoItemDefaultTextureMask")>(this, "UPrimalItem.PlayerMeshNoItemDefaultTextureMask"); }
+	int& PlayerMeshTextureMaskMaterialIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.PlayerMeshTextureMaskMaterialIndex")>(this, "UPrimalItem.PlayerMeshTextureMaskMaterialIndex"); }
+	FName& FPVHandsMeshTextureMaskParamNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("UPrimalItem.FPVHandsMeshTextureMaskParamName")>(this, "UPrimalItem.FPVHandsMeshTextureMaskParamName"); }
+	UTexture2D * FPVHandsMeshTextureMaskField() { return *GetNativePointerField<UTexture2D **, API::FieldNameHash("UPrimalItem.FPVHandsMeshTextureMask")>(this, "UPrimalItem.FPVHandsMeshTextureMask"); }
+	int& FPVHandsMeshTextureMaskMaterialIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.FPVHandsMeshTextureMaskMaterialIndex")>(this, "UPrimalItem.FPVHandsMeshTextureMaskMaterialIndex"); }
+	int& FPVHandsMeshTextureMaskMaterialIndex2Field() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.FPVHandsMeshTextureMaskMaterialIndex2")>(this, "UPrimalItem.FPVHandsMeshTextureMaskMaterialIndex2"); }
+	UPrimalItem * WeaponAmmoOverrideItemCDOField() { return *GetNativePointerField<UPrimalItem **, API::FieldNameHash("UPrimalItem.WeaponAmmoOverrideItemCDO")>(this, "UPrimalItem.WeaponAmmoOverrideItemCDO"); }
+	long double& CreationTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimalItem.CreationTime")>(this, "UPrimalItem.CreationTime"); }
+	long double& LastAutoDurabilityDecreaseTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimalItem.LastAutoDurabilityDecreaseTime")>(this, "UPrimalItem.LastAutoDurabilityDecreaseTime"); }
+	long double& LastUseTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimalItem.LastUseTime")>(this, "UPrimalItem.LastUseTime"); }
+	long double& LastLocalUseTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimalItem.LastLocalUseTime")>(this, "UPrimalItem.LastLocalUseTime"); }
+	int& TempSlotIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.TempSlotIndex")>(this, "UPrimalItem.TempSlotIndex"); }
+	TWeakObjectPtr<AShooterWeapon>& AssociatedWeaponField() { return *GetNativePointerField<TWeakObjectPtr<AShooterWeapon>*, API::FieldNameHash("UPrimalItem.AssociatedWeapon")>(this, "UPrimalItem.AssociatedWeapon"); }
+	UPrimalItem * MyItemSkinField() { return *GetNativePointerField<UPrimalItem **, API::FieldNameHash("UPrimalItem.MyItemSkin")>(this, "UPrimalItem.MyItemSkin"); }
+	TWeakObjectPtr<AShooterCharacter>& LastOwnerPlayerField() { return *GetNativePointerField<TWeakObjectPtr<AShooterCharacter>*, API::FieldNameHash("UPrimalItem.LastOwnerPlayer")>(this, "UPrimalItem.LastOwnerPlayer"); }
+	float& CropGrowingFertilizerConsumptionRateField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.CropGrowingFertilizerConsumptionRate")>(this, "UPrimalItem.CropGrowingFertilizerConsumptionRate"); }
+	float& CropMaxFruitFertilizerConsumptionRateField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.CropMaxFruitFertilizerConsumptionRate")>(this, "UPrimalItem.CropMaxFruitFertilizerConsumptionRate"); }
+	float& CropGrowingWaterConsumptionRateField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.CropGrowingWaterConsumptionRate")>(this, "UPrimalItem.CropGrowingWaterConsumptionRate"); }
+	float& CropMaxFruitWaterConsumptionRateField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.CropMaxFruitWaterConsumptionRate")>(this, "UPrimalItem.CropMaxFruitWaterConsumptionRate"); }
+	int& CropMaxFruitsField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.CropMaxFruits")>(this, "UPrimalItem.CropMaxFruits"); }
+	float& CropNoFertilizerOrWaterCacheReductionRateField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.CropNoFertilizerOrWaterCacheReductionRate")>(this, "UPrimalItem.CropNoFertilizerOrWaterCacheReductionRate"); }
+	float& FertilizerEffectivenessMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.FertilizerEffectivenessMultiplier")>(this, "UPrimalItem.FertilizerEffectivenessMultiplier"); }
+	float& EggAlertDinosAggroAmountField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.EggAlertDinosAggroAmount")>(this, "UPrimalItem.EggAlertDinosAggroAmount"); }
+	float& EggAlertDinosAggroRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.EggAlertDinosAggroRadius")>(this, "UPrimalItem.EggAlertDinosAggroRadius"); }
+	TArray<FName>& EggAlertDinosAggroTagsField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("UPrimalItem.EggAlertDinosAggroTags")>(this, "UPrimalItem.EggAlertDinosAggroTags"); }
+	float& EggAlertDinosForcedAggroTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.EggAlertDinosForcedAggroTime")>(this, "UPrimalItem.EggAlertDinosForcedAggroTime"); }
+	float& EggMaximumDistanceFromOriginalDropToAlertDinosField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.EggMaximumDistanceFromOriginalDropToAlertDinos")>(this, "UPrimalItem.EggMaximumDistanceFromOriginalDropToAlertDinos"); }
+	TSubclassOf<UPrimalItem>& BrokenGiveItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("UPrimalItem.BrokenGiveItemClass")>(this, "UPrimalItem.BrokenGiveItemClass"); }
+	float& ClearColorDurabilityThresholdField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.ClearColorDurabilityThreshold")>(this, "UPrimalItem.ClearColorDurabilityThreshold"); }
+	TSubclassOf<UPrimalItem>& ItemClassToUseAsInitialCustomDataField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("UPrimalItem.ItemClassToUseAsInitialCustomData")>(this, "UPrimalItem.ItemClassToUseAsInitialCustomData"); }
+	FVector& OriginalItemDropLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UPrimalItem.OriginalItemDropLocation")>(this, "UPrimalItem.OriginalItemDropLocation"); }
+	FLinearColor& DurabilityBarColorForegroundField() { return *GetNativePointerField<FLinearColor*, API::FieldNameHash("UPrimalItem.DurabilityBarColorForeground")>(this, "UPrimalItem.DurabilityBarColorForeground"); }
+	FLinearColor& DurabilityBarColorBackgroundField() { return *GetNativePointerField<FLinearColor*, API::FieldNameHash("UPrimalItem.DurabilityBarColorBackground")>(this, "UPrimalItem.DurabilityBarColorBackground"); }
+	TSubclassOf<UPrimalItem>& OverrideCooldownTimeItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("UPrimalItem.OverrideCooldownTimeItemClass")>(this, "UPrimalItem.OverrideCooldownTimeItemClass"); }
+	float& MinDurabilityForCraftingResourceField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.MinDurabilityForCraftingResource")>(this, "UPrimalItem.MinDurabilityForCraftingResource"); }
+	float& ResourceRequirementIncreaseRatingPowerField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.ResourceRequirementIncreaseRatingPower")>(this, "UPrimalItem.ResourceRequirementIncreaseRatingPower"); }
+	float& ResourceRequirementRatingScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.ResourceRequirementRatingScale")>(this, "UPrimalItem.ResourceRequirementRatingScale"); }
+	float& ResourceRequirementRatingIncreasePercentageField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.ResourceRequirementRatingIncreasePercentage")>(this, "UPrimalItem.ResourceRequirementRatingIncreasePercentage"); }
+	long double& NextSpoilingTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimalItem.NextSpoilingTime")>(this, "UPrimalItem.NextSpoilingTime"); }
+	long double& LastSpoilingTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimalItem.LastSpoilingTime")>(this, "UPrimalItem.LastSpoilingTime"); }
+	TArray<FString>& DefaultFolderPathsField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("UPrimalItem.DefaultFolderPaths")>(this, "UPrimalItem.DefaultFolderPaths"); }
+	FString& ItemRatingStringField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalItem.ItemRatingString")>(this, "UPrimalItem.ItemRatingString"); }
+	FName& DefaultWeaponMeshNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("UPrimalItem.DefaultWeaponMeshName")>(this, "UPrimalItem.DefaultWeaponMeshName"); }
+	int& LastCalculatedTotalAmmoInvUpdatedFrameField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.LastCalculatedTotalAmmoInvUpdatedFrame")>(this, "UPrimalItem.LastCalculatedTotalAmmoInvUpdatedFrame"); }
+	int& WeaponTotalAmmoField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.WeaponTotalAmmo")>(this, "UPrimalItem.WeaponTotalAmmo"); }
+	TSubclassOf<UPrimalItem>& EngramRequirementItemClassOverrideField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("UPrimalItem.EngramRequirementItemClassOverride")>(this, "UPrimalItem.EngramRequirementItemClassOverride"); }
+	TArray<unsigned short>& CraftingResourceRequirementsField() { return *GetNativePointerField<TArray<unsigned short>*, API::FieldNameHash("UPrimalItem.CraftingResourceRequirements")>(this, "UPrimalItem.CraftingResourceRequirements"); }
+	USoundBase * ExtraThrowItemSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalItem.ExtraThrowItemSound")>(this, "UPrimalItem.ExtraThrowItemSound"); }
+	FVector& SpawnOnWaterEncroachmentBoxExtentField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UPrimalItem.SpawnOnWaterEncroachmentBoxExtent")>(this, "UPrimalItem.SpawnOnWaterEncroachmentBoxExtent"); }
+	TArray<TSubclassOf<AActor>>& OnlyUsableOnSpecificClassesField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*, API::FieldNameHash("UPrimalItem.OnlyUsableOnSpecificClasses")>(this, "UPrimalItem.OnlyUsableOnSpecificClasses"); }
+	TArray<FSaddlePassengerSeatDefinition>& SaddlePassengerSeatsField() { return *GetNativePointerField<TArray<FSaddlePassengerSeatDefinition>*, API::FieldNameHash("UPrimalItem.SaddlePassengerSeats")>(this, "UPrimalItem.SaddlePassengerSeats"); }
+	FName& SaddleOverrideRiderSocketNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("UPrimalItem.SaddleOverrideRiderSocketName")>(this, "UPrimalItem.SaddleOverrideRiderSocketName"); }
+	TSubclassOf<APrimalDinoCharacter>& EggDinoClassToSpawnField() { return *GetNativePointerField<TSubclassOf<APrimalDinoCharacter>*, API::FieldNameHash("UPrimalItem.EggDinoClassToSpawn")>(this, "UPrimalItem.EggDinoClassToSpawn"); }
 	FieldArray<char, 12> EggNumberOfLevelUpPointsAppliedField() { return { this, "UPrimalItem.EggNumberOfLevelUpPointsApplied" }; }
-	float& EggTamedIneffectivenessModifierField() { return *GetNativePointerField<float*>(this, "UPrimalItem.EggTamedIneffectivenessModifier"); }
+	float& EggTamedIneffectivenessModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.EggTamedIneffectivenessModifier")>(this, "UPrimalItem.EggTamedIneffectivenessModifier"); }
 	FieldArray<char, 6> EggColorSetIndicesField() { return { this, "UPrimalItem.EggColorSetIndices" }; }
-	float& EggLoseDurabilityPerSecondField() { return *GetNativePointerField<float*>(this, "UPrimalItem.EggLoseDurabilityPerSecond"); }
-	float& ExtraEggLoseDurabilityPerSecondMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalItem.ExtraEggLoseDurabilityPerSecondMultiplier"); }
-	float& EggMinTemperatureField() { return *GetNativePointerField<float*>(this, "UPrimalItem.EggMinTemperature"); }
-	float& EggMaxTemperatureField() { return *GetNativePointerField<float*>(this, "UPrimalItem.EggMaxTemperature"); }
-	float& EggDroppedInvalidTempLoseItemRatingSpeedField() { return *GetNativePointerField<float*>(this, "UPrimalItem.EggDroppedInvalidTempLoseItemRatingSpeed"); }
-	USoundBase * ShieldHitSoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalItem.ShieldHitSound"); }
-	float& RecipeCraftingSkillScaleField() { return *GetNativePointerField<float*>(this, "UPrimalItem.RecipeCraftingSkillScale"); }
-	int& CustomItemIDField() { return *GetNativePointerField<int*>(this, "UPrimalItem.CustomItemID"); }
-	float& AddDinoTargetingRangeField() { return *GetNativePointerField<float*>(this, "UPrimalItem.AddDinoTargetingRange"); }
-	float& DamageTorpidityArmorRatingField() { return *GetNativePointerField<float*>(this, "UPrimalItem.DamageTorpidityArmorRating"); }
-	float& IndirectTorpidityArmorRatingField() { return *GetNativePointerField<float*>(this, "UPrimalItem.IndirectTorpidityArmorRating"); }
-	FName& UseParticleEffectSocketNameField() { return *GetNativePointerField<FName*>(this, "UPrimalItem.UseParticleEffectSocketName"); }
-	float& UseGiveDinoTameAffinityPercentField() { return *GetNativePointerField<float*>(this, "UPrimalItem.UseGiveDinoTameAffinityPercent"); }
-	TArray<TSubclassOf<UPrimalItem>>& CraftingAdditionalItemsToGiveField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalItem.CraftingAdditionalItemsToGive"); }
-	int& LastValidItemVersionField() { return *GetNativePointerField<int*>(this, "UPrimalItem.LastValidItemVersion"); }
-	float& GlobalTameAffinityMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalItem.GlobalTameAffinityMultiplier"); }
-	int& CraftingGiveItemCountField() { return *GetNativePointerField<int*>(this, "UPrimalItem.CraftingGiveItemCount"); }
-	int& CraftingGivesItemQuantityOverrideField() { return *GetNativePointerField<int*>(this, "UPrimalItem.CraftingGivesItemQuantityOverride"); }
-	USoundBase * UseItemOnItemSoundField() { return *GetNativePointerField<USoundBase **>(this, "UPrimalItem.UseItemOnItemSound"); }
-	FName& UseUnlocksEmoteNameField() { return *GetNativePointerField<FName*>(this, "UPrimalItem.UseUnlocksEmoteName"); }
-	long double& ClusterSpoilingTimeUTCField() { return *GetNativePointerField<long double*>(this, "UPrimalItem.ClusterSpoilingTimeUTC"); }
-	TArray<FDinoAncestorsEntry>& EggDinoAncestorsField() { return *GetNativePointerField<TArray<FDinoAncestorsEntry>*>(this, "UPrimalItem.EggDinoAncestors"); }
-	TArray<FDinoAncestorsEntry>& EggDinoAncestorsMaleField() { return *GetNativePointerField<TArray<FDinoAncestorsEntry>*>(this, "UPrimalItem.EggDinoAncestorsMale"); }
-	int& EggRandomMutationsFemaleField() { return *GetNativePointerField<int*>(this, "UPrimalItem.EggRandomMutationsFemale"); }
-	int& EggRandomMutationsMaleField() { return *GetNativePointerField<int*>(this, "UPrimalItem.EggRandomMutationsMale"); }
-	TArray<TSubclassOf<UPrimalItem>>& EquippingRequiresEngramsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "UPrimalItem.EquippingRequiresEngrams"); }
-	TArray<FCustomItemData>& CustomItemDatasField() { return *GetNativePointerField<TArray<FCustomItemData>*>(this, "UPrimalItem.CustomItemDatas"); }
-	FString& OverrideUseStringField() { return *GetNativePointerField<FString*>(this, "UPrimalItem.OverrideUseString"); }
-	TSubclassOf<UPrimalItem>& SendToClientClassOverrideField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "UPrimalItem.SendToClientClassOverride"); }
-	FString& CrafterCharacterNameField() { return *GetNativePointerField<FString*>(this, "UPrimalItem.CrafterCharacterName"); }
-	FString& CrafterTribeNameField() { return *GetNativePointerField<FString*>(this, "UPrimalItem.CrafterTribeName"); }
-	float& CraftedSkillBonusField() { return *GetNativePointerField<float*>(this, "UPrimalItem.CraftedSkillBonus"); }
-	float& CraftingSkillQualityMultiplierMinField() { return *GetNativePointerField<float*>(this, "UPrimalItem.CraftingSkillQualityMultiplierMin"); }
-	float& CraftingSkillQualityMultiplierMaxField() { return *GetNativePointerField<float*>(this, "UPrimalItem.CraftingSkillQualityMultiplierMax"); }
-	float& SinglePlayerCraftingSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "UPrimalItem.SinglePlayerCraftingSpeedMultiplier"); }
-	int& NoLevelEngramSortingPriorityField() { return *GetNativePointerField<int*>(this, "UPrimalItem.NoLevelEngramSortingPriority"); }
-	int& CustomFlagsField() { return *GetNativePointerField<int*>(this, "UPrimalItem.CustomFlags"); }
-	FName& CustomTagField() { return *GetNativePointerField<FName*>(this, "UPrimalItem.CustomTag"); }
-	float& EquippedReduceDurabilityIntervalField() { return *GetNativePointerField<float*>(this, "UPrimalItem.EquippedReduceDurabilityInterval"); }
-	long double& LastEquippedReduceDurabilityTimeField() { return *GetNativePointerField<long double*>(this, "UPrimalItem.LastEquippedReduceDurabilityTime"); }
-	float& EquippedReduceDurabilityPerIntervalField() { return *GetNativePointerField<float*>(this, "UPrimalItem.EquippedReduceDurabilityPerInterval"); }
-	float& MaxDurabiltiyOverrideField() { return *GetNativePointerField<float*>(this, "UPrimalItem.MaxDurabiltiyOverride"); }
-	long double& LastItemAdditionTimeField() { return *GetNativePointerField<long double*>(this, "UPrimalItem.LastItemAdditionTime"); }
-	long double& UploadEarliestValidTimeField() { return *GetNativePointerField<long double*>(this, "UPrimalItem.UploadEarliestValidTime"); }
-	float& NextRepairPercentageField() { return *GetNativePointerField<float*>(this, "UPrimalItem.NextRepairPercentage"); }
-	UStaticMesh * NetDroppedMeshOverrideField() { return *GetNativePointerField<UStaticMesh **>(this, "UPrimalItem.NetDroppedMeshOverride"); }
-	UMaterialInterface * NetDroppedMeshMaterialOverrideField() { return *GetNativePointerField<UMaterialInterface **>(this, "UPrimalItem.NetDroppedMeshMaterialOverride"); }
-	FVector& NetDroppedMeshOverrideScale3DField() { return *GetNativePointerField<FVector*>(this, "UPrimalItem.NetDroppedMeshOverrideScale3D"); }
+	float& EggLoseDurabilityPerSecondField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.EggLoseDurabilityPerSecond")>(this, "UPrimalItem.EggLoseDurabilityPerSecond"); }
+	float& ExtraEggLoseDurabilityPerSecondMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.ExtraEggLoseDurabilityPerSecondMultiplier")>(this, "UPrimalItem.ExtraEggLoseDurabilityPerSecondMultiplier"); }
+	float& EggMinTemperatureField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.EggMinTemperature")>(this, "UPrimalItem.EggMinTemperature"); }
+	float& EggMaxTemperatureField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.EggMaxTemperature")>(this, "UPrimalItem.EggMaxTemperature"); }
+	float& EggDroppedInvalidTempLoseItemRatingSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.EggDroppedInvalidTempLoseItemRatingSpeed")>(this, "UPrimalItem.EggDroppedInvalidTempLoseItemRatingSpeed"); }
+	USoundBase * ShieldHitSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalItem.ShieldHitSound")>(this, "UPrimalItem.ShieldHitSound"); }
+	float& RecipeCraftingSkillScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.RecipeCraftingSkillScale")>(this, "UPrimalItem.RecipeCraftingSkillScale"); }
+	int& CustomItemIDField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.CustomItemID")>(this, "UPrimalItem.CustomItemID"); }
+	float& AddDinoTargetingRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.AddDinoTargetingRange")>(this, "UPrimalItem.AddDinoTargetingRange"); }
+	float& DamageTorpidityArmorRatingField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.DamageTorpidityArmorRating")>(this, "UPrimalItem.DamageTorpidityArmorRating"); }
+	float& IndirectTorpidityArmorRatingField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.IndirectTorpidityArmorRating")>(this, "UPrimalItem.IndirectTorpidityArmorRating"); }
+	FName& UseParticleEffectSocketNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("UPrimalItem.UseParticleEffectSocketName")>(this, "UPrimalItem.UseParticleEffectSocketName"); }
+	float& UseGiveDinoTameAffinityPercentField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.UseGiveDinoTameAffinityPercent")>(this, "UPrimalItem.UseGiveDinoTameAffinityPercent"); }
+	TArray<TSubclassOf<UPrimalItem>>& CraftingAdditionalItemsToGiveField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalItem.CraftingAdditionalItemsToGive")>(this, "UPrimalItem.CraftingAdditionalItemsToGive"); }
+	int& LastValidItemVersionField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.LastValidItemVersion")>(this, "UPrimalItem.LastValidItemVersion"); }
+	float& GlobalTameAffinityMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.GlobalTameAffinityMultiplier")>(this, "UPrimalItem.GlobalTameAffinityMultiplier"); }
+	int& CraftingGiveItemCountField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.CraftingGiveItemCount")>(this, "UPrimalItem.CraftingGiveItemCount"); }
+	int& CraftingGivesItemQuantityOverrideField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.CraftingGivesItemQuantityOverride")>(this, "UPrimalItem.CraftingGivesItemQuantityOverride"); }
+	USoundBase * UseItemOnItemSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("UPrimalItem.UseItemOnItemSound")>(this, "UPrimalItem.UseItemOnItemSound"); }
+	FName& UseUnlocksEmoteNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("UPrimalItem.UseUnlocksEmoteName")>(this, "UPrimalItem.UseUnlocksEmoteName"); }
+	long double& ClusterSpoilingTimeUTCField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimalItem.ClusterSpoilingTimeUTC")>(this, "UPrimalItem.ClusterSpoilingTimeUTC"); }
+	TArray<FDinoAncestorsEntry>& EggDinoAncestorsField() { return *GetNativePointerField<TArray<FDinoAncestorsEntry>*, API::FieldNameHash("UPrimalItem.EggDinoAncestors")>(this, "UPrimalItem.EggDinoAncestors"); }
+	TArray<FDinoAncestorsEntry>& EggDinoAncestorsMaleField() { return *GetNativePointerField<TArray<FDinoAncestorsEntry>*, API::FieldNameHash("UPrimalItem.EggDinoAncestorsMale")>(this, "UPrimalItem.EggDinoAncestorsMale"); }
+	int& EggRandomMutationsFemaleField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.EggRandomMutationsFemale")>(this, "UPrimalItem.EggRandomMutationsFemale"); }
+	int& EggRandomMutationsMaleField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.EggRandomMutationsMale")>(this, "UPrimalItem.EggRandomMutationsMale"); }
+	TArray<TSubclassOf<UPrimalItem>>& EquippingRequiresEngramsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("UPrimalItem.EquippingRequiresEngrams")>(this, "UPrimalItem.EquippingRequiresEngrams"); }
+	TArray<FCustomItemData>& CustomItemDatasField() { return *GetNativePointerField<TArray<FCustomItemData>*, API::FieldNameHash("UPrimalItem.CustomItemDatas")>(this, "UPrimalItem.CustomItemDatas"); }
+	FString& OverrideUseStringField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalItem.OverrideUseString")>(this, "UPrimalItem.OverrideUseString"); }
+	TSubclassOf<UPrimalItem>& SendToClientClassOverrideField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("UPrimalItem.SendToClientClassOverride")>(this, "UPrimalItem.SendToClientClassOverride"); }
+	FString& CrafterCharacterNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalItem.CrafterCharacterName")>(this, "UPrimalItem.CrafterCharacterName"); }
+	FString& CrafterTribeNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalItem.CrafterTribeName")>(this, "UPrimalItem.CrafterTribeName"); }
+	float& CraftedSkillBonusField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.CraftedSkillBonus")>(this, "UPrimalItem.CraftedSkillBonus"); }
+	float& CraftingSkillQualityMultiplierMinField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.CraftingSkillQualityMultiplierMin")>(this, "UPrimalItem.CraftingSkillQualityMultiplierMin"); }
+	float& CraftingSkillQualityMultiplierMaxField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.CraftingSkillQualityMultiplierMax")>(this, "UPrimalItem.CraftingSkillQualityMultiplierMax"); }
+	float& SinglePlayerCraftingSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.SinglePlayerCraftingSpeedMultiplier")>(this, "UPrimalItem.SinglePlayerCraftingSpeedMultiplier"); }
+	int& NoLevelEngramSortingPriorityField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.NoLevelEngramSortingPriority")>(this, "UPrimalItem.NoLevelEngramSortingPriority"); }
+	int& CustomFlagsField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalItem.CustomFlags")>(this, "UPrimalItem.CustomFlags"); }
+	FName& CustomTagField() { return *GetNativePointerField<FName*, API::FieldNameHash("UPrimalItem.CustomTag")>(this, "UPrimalItem.CustomTag"); }
+	float& EquippedReduceDurabilityIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.EquippedReduceDurabilityInterval")>(this, "UPrimalItem.EquippedReduceDurabilityInterval"); }
+	long double& LastEquippedReduceDurabilityTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimalItem.LastEquippedReduceDurabilityTime")>(this, "UPrimalItem.LastEquippedReduceDurabilityTime"); }
+	float& EquippedReduceDurabilityPerIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.EquippedReduceDurabilityPerInterval")>(this, "UPrimalItem.EquippedReduceDurabilityPerInterval"); }
+	float& MaxDurabiltiyOverrideField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.MaxDurabiltiyOverride")>(this, "UPrimalItem.MaxDurabiltiyOverride"); }
+	long double& LastItemAdditionTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimalItem.LastItemAdditionTime")>(this, "UPrimalItem.LastItemAdditionTime"); }
+	long double& UploadEarliestValidTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("UPrimalItem.UploadEarliestValidTime")>(this, "UPrimalItem.UploadEarliestValidTime"); }
+	float& NextRepairPercentageField() { return *GetNativePointerField<float*, API::FieldNameHash("UPrimalItem.NextRepairPercentage")>(this, "UPrimalItem.NextRepairPercentage"); }
+	UStaticMesh * NetDroppedMeshOverrideField() { return *GetNativePointerField<UStaticMesh **, API::FieldNameHash("UPrimalItem.NetDroppedMeshOverride")>(this, "UPrimalItem.NetDroppedMeshOverride"); }
+	UMaterialInterface * NetDroppedMeshMaterialOverrideField() { return *GetNativePointerField<UMaterialInterface **, API::FieldNameHash("UPrimalItem.NetDroppedMeshMaterialOverride")>(this, "UPrimalItem.NetDroppedMeshMaterialOverride"); }
+	FVector& NetDroppedMeshOverrideScale3DField() { return *GetNativePointerField<FVector*, API::FieldNameHash("UPrimalItem.NetDroppedMeshOverrideScale3D")>(this, "UPrimalItem.NetDroppedMeshOverrideScale3D"); }
 
 	// Bit fields
 
@@ -1074,51 +1074,51 @@ struct UPrimalItem : UObject
 
 struct FItemNetInfo
 {
-	TSubclassOf<UPrimalItem>& ItemArchetypeField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "FItemNetInfo.ItemArchetype"); }
-	FItemNetID& ItemIDField() { return *GetNativePointerField<FItemNetID*>(this, "FItemNetInfo.ItemID"); }
-	unsigned int& ExpirationTimeUTCField() { return *GetNativePointerField<unsigned int*>(this, "FItemNetInfo.ExpirationTimeUTC"); }
-	TArray<FCustomItemData>& CustomItemDatasField() { return *GetNativePointerField<TArray<FCustomItemData>*>(this, "FItemNetInfo.CustomItemDatas"); }
-	unsigned __int64& OwnerPlayerDataIdField() { return *GetNativePointerField<unsigned __int64*>(this, "FItemNetInfo.OwnerPlayerDataId"); }
-	int& SlotIndexField() { return *GetNativePointerField<int*>(this, "FItemNetInfo.SlotIndex"); }
-	unsigned int& WeaponClipAmmoField() { return *GetNativePointerField<unsigned int*>(this, "FItemNetInfo.WeaponClipAmmo"); }
-	long double& CreationTimeField() { return *GetNativePointerField<long double*>(this, "FItemNetInfo.CreationTime"); }
-	float& ItemDurabilityField() { return *GetNativePointerField<float*>(this, "FItemNetInfo.ItemDurability"); }
-	float& ItemRatingField() { return *GetNativePointerField<float*>(this, "FItemNetInfo.ItemRating"); }
-	char& ItemQualityIndexField() { return *GetNativePointerField<char*>(this, "FItemNetInfo.ItemQualityIndex"); }
-	unsigned int& ItemQuantityField() { return *GetNativePointerField<unsigned int*>(this, "FItemNetInfo.ItemQuantity"); }
-	unsigned __int16& CraftQueueField() { return *GetNativePointerField<unsigned __int16*>(this, "FItemNetInfo.CraftQueue"); }
-	long double& NextCraftCompletionTimeField() { return *GetNativePointerField<long double*>(this, "FItemNetInfo.NextCraftCompletionTime"); }
+	TSubclassOf<UPrimalItem>& ItemArchetypeField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("FItemNetInfo.ItemArchetype")>(this, "FItemNetInfo.ItemArchetype"); }
+	FItemNetID& ItemIDField() { return *GetNativePointerField<FItemNetID*, API::FieldNameHash("FItemNetInfo.ItemID")>(this, "FItemNetInfo.ItemID"); }
+	unsigned int& ExpirationTimeUTCField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("FItemNetInfo.ExpirationTimeUTC")>(this, "FItemNetInfo.ExpirationTimeUTC"); }
+	TArray<FCustomItemData>& CustomItemDatasField() { return *GetNativePointerField<TArray<FCustomItemData>*, API::FieldNameHash("FItemNetInfo.CustomItemDatas")>(this, "FItemNetInfo.CustomItemDatas"); }
+	unsigned __int64& OwnerPlayerDataIdField() { return *GetNativePointerField<unsigned __int64*, API::FieldNameHash("FItemNetInfo.OwnerPlayerDataId")>(this, "FItemNetInfo.OwnerPlayerDataId"); }
+	int& SlotIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("FItemNetInfo.SlotIndex")>(this, "FItemNetInfo.SlotIndex"); }
+	unsigned int& WeaponClipAmmoField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("FItemNetInfo.WeaponClipAmmo")>(this, "FItemNetInfo.WeaponClipAmmo"); }
+	long double& CreationTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("FItemNetInfo.CreationTime")>(this, "FItemNetInfo.CreationTime"); }
+	float& ItemDurabilityField() { return *GetNativePointerField<float*, API::FieldNameHash("FItemNetInfo.ItemDurability")>(this, "FItemNetInfo.ItemDurability"); }
+	float& ItemRatingField() { return *GetNativePointerField<float*, API::FieldNameHash("FItemNetInfo.ItemRating")>(this, "FItemNetInfo.ItemRating"); }
+	char& ItemQualityIndexField() { return *GetNativePointerField<char*, API::FieldNameHash("FItemNetInfo.ItemQualityIndex")>(this, "FItemNetInfo.ItemQualityIndex"); }
+	unsigned int& ItemQuantityField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("FItemNetInfo.ItemQuantity")>(this, "FItemNetInfo.ItemQuantity"); }
+	unsigned __int16& CraftQueueField() { return *GetNativePointerField<unsigned __int16*, API::FieldNameHash("FItemNetInfo.CraftQueue")>(this, "FItemNetInfo.CraftQueue"); }
+	long double& NextCraftCompletionTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("FItemNetInfo.NextCraftCompletionTime")>(this, "FItemNetInfo.NextCraftCompletionTime"); }
 	FieldArray<unsigned __int16, 8> ItemStatValuesField() { return { this, "FItemNetInfo.ItemStatValues" }; }
 	FieldArray<__int16, 6> ItemColorIDField() { return { this, "FItemNetInfo.ItemColorID" }; }
-	TSubclassOf<UPrimalItem>& ItemCustomClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "FItemNetInfo.ItemCustomClass"); }
-	TSubclassOf<UPrimalItem>& ItemSkinTemplateField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "FItemNetInfo.ItemSkinTemplate"); }
-	float& CraftingSkillField() { return *GetNativePointerField<float*>(this, "FItemNetInfo.CraftingSkill"); }
-	FString& CustomItemNameField() { return *GetNativePointerField<FString*>(this, "FItemNetInfo.CustomItemName"); }
-	FString& CustomItemDescriptionField() { return *GetNativePointerField<FString*>(this, "FItemNetInfo.CustomItemDescription"); }
-	TArray<FColor>& CustomItemColorsField() { return *GetNativePointerField<TArray<FColor>*>(this, "FItemNetInfo.CustomItemColors"); }
-	TArray<FCraftingResourceRequirement>& CustomResourceRequirementsField() { return *GetNativePointerField<TArray<FCraftingResourceRequirement>*>(this, "FItemNetInfo.CustomResourceRequirements"); }
-	long double& NextSpoilingTimeField() { return *GetNativePointerField<long double*>(this, "FItemNetInfo.NextSpoilingTime"); }
-	long double& LastSpoilingTimeField() { return *GetNativePointerField<long double*>(this, "FItemNetInfo.LastSpoilingTime"); }
-	long double& UploadEarliestValidTimeField() { return *GetNativePointerField<long double*>(this, "FItemNetInfo.UploadEarliestValidTime"); }
-	TWeakObjectPtr<AShooterCharacter>& LastOwnerPlayerField() { return *GetNativePointerField<TWeakObjectPtr<AShooterCharacter>*>(this, "FItemNetInfo.LastOwnerPlayer"); }
-	long double& LastAutoDurabilityDecreaseTimeField() { return *GetNativePointerField<long double*>(this, "FItemNetInfo.LastAutoDurabilityDecreaseTime"); }
-	FVector& OriginalItemDropLocationField() { return *GetNativePointerField<FVector*>(this, "FItemNetInfo.OriginalItemDropLocation"); }
+	TSubclassOf<UPrimalItem>& ItemCustomClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("FItemNetInfo.ItemCustomClass")>(this, "FItemNetInfo.ItemCustomClass"); }
+	TSubclassOf<UPrimalItem>& ItemSkinTemplateField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("FItemNetInfo.ItemSkinTemplate")>(this, "FItemNetInfo.ItemSkinTemplate"); }
+	float& CraftingSkillField() { return *GetNativePointerField<float*, API::FieldNameHash("FItemNetInfo.CraftingSkill")>(this, "FItemNetInfo.CraftingSkill"); }
+	FString& CustomItemNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("FItemNetInfo.CustomItemName")>(this, "FItemNetInfo.CustomItemName"); }
+	FString& CustomItemDescriptionField() { return *GetNativePointerField<FString*, API::FieldNameHash("FItemNetInfo.CustomItemDescription")>(this, "FItemNetInfo.CustomItemDescription"); }
+	TArray<FColor>& CustomItemColorsField() { return *GetNativePointerField<TArray<FColor>*, API::FieldNameHash("FItemNetInfo.CustomItemColors")>(this, "FItemNetInfo.CustomItemColors"); }
+	TArray<FCraftingResourceRequirement>& CustomResourceRequirementsField() { return *GetNativePointerField<TArray<FCraftingResourceRequirement>*, API::FieldNameHash("FItemNetInfo.CustomResourceRequirements")>(this, "FItemNetInfo.CustomResourceRequirements"); }
+	long double& NextSpoilingTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("FItemNetInfo.NextSpoilingTime")>(this, "FItemNetInfo.NextSpoilingTime"); }
+	long double& LastSpoilingTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("FItemNetInfo.LastSpoilingTime")>(this, "FItemNetInfo.LastSpoilingTime"); }
+	long double& UploadEarliestValidTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("FItemNetInfo.UploadEarliestValidTime")>(this, "FItemNetInfo.UploadEarliestValidTime"); }
+	TWeakObjectPtr<AShooterCharacter>& LastOwnerPlayerField() { return *GetNativePointerField<TWeakObjectPtr<AShooterCharacter>*, API::FieldNameHash("FItemNetInfo.LastOwnerPlayer")>(this, "FItemNetInfo.LastOwnerPlayer"); }
+	long double& LastAutoDurabilityDecreaseTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("FItemNetInfo.LastAutoDurabilityDecreaseTime")>(this, "FItemNetInfo.LastAutoDurabilityDecreaseTime"); }
+	FVector& OriginalItemDropLocationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("FItemNetInfo.OriginalItemDropLocation")>(this, "FItemNetInfo.OriginalItemDropLocation"); }
 	FieldArray<__int16, 6> PreSkinItemColorIDField() { return { this, "FItemNetInfo.PreSkinItemColorID" }; }
 	FieldArray<char, 12> EggNumberOfLevelUpPointsAppliedField() { return { this, "FItemNetInfo.EggNumberOfLevelUpPointsApplied" }; }
-	float& EggTamedIneffectivenessModifierField() { return *GetNativePointerField<float*>(this, "FItemNetInfo.EggTamedIneffectivenessModifier"); }
+	float& EggTamedIneffectivenessModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("FItemNetInfo.EggTamedIneffectivenessModifier")>(this, "FItemNetInfo.EggTamedIneffectivenessModifier"); }
 	FieldArray<char, 6> EggColorSetIndicesField() { return { this, "FItemNetInfo.EggColorSetIndices" }; }
-	char& ItemVersionField() { return *GetNativePointerField<char*>(this, "FItemNetInfo.ItemVersion"); }
-	int& CustomItemIDField() { return *GetNativePointerField<int*>(this, "FItemNetInfo.CustomItemID"); }
-	TArray<unsigned __int64>& SteamUserItemIDField() { return *GetNativePointerField<TArray<unsigned __int64>*>(this, "FItemNetInfo.SteamUserItemID"); }
-	long double& ClusterSpoilingTimeUTCField() { return *GetNativePointerField<long double*>(this, "FItemNetInfo.ClusterSpoilingTimeUTC"); }
-	TArray<FDinoAncestorsEntry>& EggDinoAncestorsField() { return *GetNativePointerField<TArray<FDinoAncestorsEntry>*>(this, "FItemNetInfo.EggDinoAncestors"); }
-	TArray<FDinoAncestorsEntry>& EggDinoAncestorsMaleField() { return *GetNativePointerField<TArray<FDinoAncestorsEntry>*>(this, "FItemNetInfo.EggDinoAncestorsMale"); }
-	int& EggRandomMutationsFemaleField() { return *GetNativePointerField<int*>(this, "FItemNetInfo.EggRandomMutationsFemale"); }
-	int& EggRandomMutationsMaleField() { return *GetNativePointerField<int*>(this, "FItemNetInfo.EggRandomMutationsMale"); }
-	char& ItemProfileVersionField() { return *GetNativePointerField<char*>(this, "FItemNetInfo.ItemProfileVersion"); }
-	FString& CrafterCharacterNameField() { return *GetNativePointerField<FString*>(this, "FItemNetInfo.CrafterCharacterName"); }
-	FString& CrafterTribeNameField() { return *GetNativePointerField<FString*>(this, "FItemNetInfo.CrafterTribeName"); }
-	float& CraftedSkillBonusField() { return *GetNativePointerField<float*>(this, "FItemNetInfo.CraftedSkillBonus"); }
+	char& ItemVersionField() { return *GetNativePointerField<char*, API::FieldNameHash("FItemNetInfo.ItemVersion")>(this, "FItemNetInfo.ItemVersion"); }
+	int& CustomItemIDField() { return *GetNativePointerField<int*, API::FieldNameHash("FItemNetInfo.CustomItemID")>(this, "FItemNetInfo.CustomItemID"); }
+	TArray<unsigned __int64>& SteamUserItemIDField() { return *GetNativePointerField<TArray<unsigned __int64>*, API::FieldNameHash("FItemNetInfo.SteamUserItemID")>(this, "FItemNetInfo.SteamUserItemID"); }
+	long double& ClusterSpoilingTimeUTCField() { return *GetNativePointerField<long double*, API::FieldNameHash("FItemNetInfo.ClusterSpoilingTimeUTC")>(this, "FItemNetInfo.ClusterSpoilingTimeUTC"); }
+	TArray<FDinoAncestorsEntry>& EggDinoAncestorsField() { return *GetNativePointerField<TArray<FDinoAncestorsEntry>*, API::FieldNameHash("FItemNetInfo.EggDinoAncestors")>(this, "FItemNetInfo.EggDinoAncestors"); }
+	TArray<FDinoAncestorsEntry>& EggDinoAncestorsMaleField() { return *GetNativePointerField<TArray<FDinoAncestorsEntry>*, API::FieldNameHash("FItemNetInfo.EggDinoAncestorsMale")>(this, "FItemNetInfo.EggDinoAncestorsMale"); }
+	int& EggRandomMutationsFemaleField() { return *GetNativePointerField<int*, API::FieldNameHash("FItemNetInfo.EggRandomMutationsFemale")>(this, "FItemNetInfo.EggRandomMutationsFemale"); }
+	int& EggRandomMutationsMaleField() { return *GetNativePointerField<int*, API::FieldNameHash("FItemNetInfo.EggRandomMutationsMale")>(this, "FItemNetInfo.EggRandomMutationsMale"); }
+	char& ItemProfileVersionField() { return *GetNativePointerField<char*, API::FieldNameHash("FItemNetInfo.ItemProfileVersion")>(this, "FItemNetInfo.ItemProfileVersion"); }
+	FString& CrafterCharacterNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("FItemNetInfo.CrafterCharacterName")>(this, "FItemNetInfo.CrafterCharacterName"); }
+	FString& CrafterTribeNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("FItemNetInfo.CrafterTribeName")>(this, "FItemNetInfo.CrafterTribeName"); }
+	float& CraftedSkillBonusField() { return *GetNativePointerField<float*, API::FieldNameHash("FItemNetInfo.CraftedSkillBonus")>(this, "FItemNetInfo.CraftedSkillBonus"); }
 
 	// Bit fields
 
@@ -1144,14 +1144,14 @@ struct FItemNetInfo
 
 struct FItemStatInfo
 {
-	int& DefaultModifierValueField() { return *GetNativePointerField<int*>(this, "FItemStatInfo.DefaultModifierValue"); }
-	int& RandomizerRangeOverrideField() { return *GetNativePointerField<int*>(this, "FItemStatInfo.RandomizerRangeOverride"); }
-	float& RandomizerRangeMultiplierField() { return *GetNativePointerField<float*>(this, "FItemStatInfo.RandomizerRangeMultiplier"); }
-	float& TheRandomizerPowerField() { return *GetNativePointerField<float*>(this, "FItemStatInfo.TheRandomizerPower"); }
-	float& StateModifierScaleField() { return *GetNativePointerField<float*>(this, "FItemStatInfo.StateModifierScale"); }
-	float& InitialValueConstantField() { return *GetNativePointerField<float*>(this, "FItemStatInfo.InitialValueConstant"); }
-	float& RatingValueMultiplierField() { return *GetNativePointerField<float*>(this, "FItemStatInfo.RatingValueMultiplier"); }
-	float& AbsoluteMaxValueField() { return *GetNativePointerField<float*>(this, "FItemStatInfo.AbsoluteMaxValue"); }
+	int& DefaultModifierValueField() { return *GetNativePointerField<int*, API::FieldNameHash("FItemStatInfo.DefaultModifierValue")>(this, "FItemStatInfo.DefaultModifierValue"); }
+	int& RandomizerRangeOverrideField() { return *GetNativePointerField<int*, API::FieldNameHash("FItemStatInfo.RandomizerRangeOverride")>(this, "FItemStatInfo.RandomizerRangeOverride"); }
+	float& RandomizerRangeMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("FItemStatInfo.RandomizerRangeMultiplier")>(this, "FItemStatInfo.RandomizerRangeMultiplier"); }
+	float& TheRandomizerPowerField() { return *GetNativePointerField<float*, API::FieldNameHash("FItemStatInfo.TheRandomizerPower")>(this, "FItemStatInfo.TheRandomizerPower"); }
+	float& StateModifierScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("FItemStatInfo.StateModifierScale")>(this, "FItemStatInfo.StateModifierScale"); }
+	float& InitialValueConstantField() { return *GetNativePointerField<float*, API::FieldNameHash("FItemStatInfo.InitialValueConstant")>(this, "FItemStatInfo.InitialValueConstant"); }
+	float& RatingValueMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("FItemStatInfo.RatingValueMultiplier")>(this, "FItemStatInfo.RatingValueMultiplier"); }
+	float& AbsoluteMaxValueField() { return *GetNativePointerField<float*, API::FieldNameHash("FItemStatInfo.AbsoluteMaxValue")>(this, "FItemStatInfo.AbsoluteMaxValue"); }
 
 	// Bit fields
 
@@ -2,10 +2,10 @@
 
 struct FDamageEvent
 {
-	float& ImpulseField() { return *GetNativePointerField<float*>(this, "FDamageEvent.Impulse"); }
-	float& OriginalDamageField() { return *GetNativePointerField<float*>(this, "FDamageEvent.OriginalDamage"); }
-	int& InstanceBodyIndexField() { return *GetNativePointerField<int*>(this, "FDamageEvent.InstanceBodyIndex"); }
-	TSubclassOf<UDamageType>& DamageTypeClassField() { return *GetNativePointerField<TSubclassOf<UDamageType>*>(this, "FDamageEvent.DamageTypeClass"); }
+	float& ImpulseField() { return *GetNativePointerField<float*, API::FieldNameHash("FDamageEvent.Impulse")>(this, "FDamageEvent.Impulse"); }
+	float& OriginalDamageField() { return *GetNativePointerField<float*, API::FieldNameHash("FDamageEvent.OriginalDamage")>(this, "FDamageEvent.OriginalDamage"); }
+	int& InstanceBodyIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("FDamageEvent.InstanceBodyIndex")>(this, "FDamageEvent.InstanceBodyIndex"); }
+	TSubclassOf<UDamageType>& DamageTypeClassField() { return *GetNativePointerField<TSubclassOf<UDamageType>*, API::FieldNameHash("FDamageEvent.DamageTypeClass")>(this, "FDamageEvent.DamageTypeClass"); }
 
 	// Functions
 
@@ -62,15 +62,15 @@ struct FInternetAddr
 
 struct FSocket
 {
-	ESocketType& SocketTypeField() { return *GetNativePointerField<ESocketType*>(this, "FSocket.SocketType"); }
-	FString& SocketDescriptionField() { return *GetNativePointerField<FString*>(this, "FSocket.SocketDescription"); }
+	ESocketType& SocketTypeField() { return *GetNativePointerField<ESocketType*, API::FieldNameHash("FSocket.SocketType")>(this, "FSocket.SocketType"); }
+	FString& SocketDescriptionField() { return *GetNativePointerField<FString*, API::FieldNameHash("FSocket.SocketDescription")>(this, "FSocket.SocketDescription"); }
 
 };
 
 struct FSocketBSD : FSocket
 {
-	unsigned __int64& SocketField() { return *GetNativePointerField<unsigned __int64*>(this, "FSocketBSD.Socket"); }
-	FDateTime& LastActivityTimeField() { return *GetNativePointerField<FDateTime*>(this, "FSocketBSD.LastActivityTime"); }
+	unsigned __int64& SocketField() { return *GetNativePointerField<unsigned __int64*, API::FieldNameHash("FSocketBSD.Socket")>(this, "FSocketBSD.Socket"); }
+	FDateTime& LastActivityTimeField() { return *GetNativePointerField<FDateTime*, API::FieldNameHash("FSocketBSD.LastActivityTime")>(this, "FSocketBSD.LastActivityTime"); }
 
 	// Functions
 
@@ -103,15 +103,15 @@ struct FSocketBSD : FSocket
 
 struct RCONClientConnection
 {
-	FSocket * SocketField() { return *GetNativePointerField<FSocket **>(this, "RCONClientConnection.Socket"); }
-	UShooterCheatManager * CheatManagerField() { return *GetNativePointerField<UShooterCheatManager **>(this, "RCONClientConnection.CheatManager"); }
-	bool& IsAuthenticatedField() { return *GetNativePointerField<bool*>(this, "RCONClientConnection.IsAuthenticated"); }
-	bool& IsClosedField() { return *GetNativePointerField<bool*>(this, "RCONClientConnection.IsClosed"); }
-	TArray<signed char>& DataBufferField() { return *GetNativePointerField<TArray<signed char>*>(this, "RCONClientConnection.DataBuffer"); }
-	unsigned int& CurrentPacketSizeField() { return *GetNativePointerField<unsigned int*>(this, "RCONClientConnection.CurrentPacketSize"); }
-	long double& LastReceiveTimeField() { return *GetNativePointerField<long double*>(this, "RCONClientConnection.LastReceiveTime"); }
-	long double& LastSendKeepAliveTimeField() { return *GetNativePointerField<long double*>(this, "RCONClientConnection.LastSendKeepAliveTime"); }
-	FString& ServerPasswordField() { return *GetNativePointerField<FString*>(this, "RCONClientConnection.ServerPassword"); }
+	FSocket * SocketField() { return *GetNativePointerField<FSocket **, API::FieldNameHash("RCONClientConnection.Socket")>(this, "RCONClientConnection.Socket"); }
+	UShooterCheatManager * CheatManagerField() { return *GetNativePointerField<UShooterCheatManager **, API::FieldNameHash("RCONClientConnection.CheatManager")>(this, "RCONClientConnection.CheatManager"); }
+	bool& IsAuthenticatedField() { return *GetNativePointerField<bool*, API::FieldNameHash("RCONClientConnection.IsAuthenticated")>(this, "RCONClientConnection.IsAuthenticated"); }
+	bool& IsClosedField() { return *GetNativePointerField<bool*, API::FieldNameHash("RCONClientConnection.IsClosed")>(this, "RCONClientConnection.IsClosed"); }
+	TArray<signed char>& DataBufferField() { return *GetNativePointerField<TArray<signed char>*, API::FieldNameHash("RCONClientConnection.DataBuffer")>(this, "RCONClientConnection.DataBuffer"); }
+	unsigned int& CurrentPacketSizeField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("RCONClientConnection.CurrentPacketSize")>(this, "RCONClientConnection.CurrentPacketSize"); }
+	long double& LastReceiveTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("RCONClientConnection.LastReceiveTime")>(this, "RCONClientConnection.LastReceiveTime"); }
+	long double& LastSendKeepAliveTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("RCONClientConnection.LastSendKeepAliveTime")>(this, "RCONClientConnection.LastSendKeepAliveTime"); }
+	FString& ServerPasswordField() { return *GetNativePointerField<FString*, API::FieldNameHash("RCONClientConnection.ServerPassword")>(this, "RCONClientConnection.ServerPassword"); }
 
 	// Functions
 
@@ -161,106 +161,106 @@ struct FItemMultiplier
 
 struct APrimalBuff
 {
-	float& DeactivationLifespanField() { return *GetNativePointerField<float*>(this, "APrimalBuff.DeactivationLifespan"); }
-	FName& InstigatorAttachmentSocketField() { return *GetNativePointerField<FName*>(this, "APrimalBuff.InstigatorAttachmentSocket"); }
-	float& RemoteForcedFleeDurationField() { return *GetNativePointerField<float*>(this, "APrimalBuff.RemoteForcedFleeDuration"); }
-	FVector& AoETraceToTargetsStartOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalBuff.AoETraceToTargetsStartOffset"); }
-	TWeakObjectPtr<AActor>& TargetField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*>(this, "APrimalBuff.Target"); }
-	TWeakObjectPtr<UPrimalItem>& InstigatorItemField() { return *GetNativePointerField<TWeakObjectPtr<UPrimalItem>*>(this, "APrimalBuff.InstigatorItem"); }
-	float& SlowInstigatorFallingAddZVelocityField() { return *GetNativePointerField<float*>(this, "APrimalBuff.SlowInstigatorFallingAddZVelocity"); }
-	float& SlowInstigatorFallingDampenZVelocityField() { return *GetNativePointerField<float*>(this, "APrimalBuff.SlowInstigatorFallingDampenZVelocity"); }
-	float& DeactivateAfterTimeField() { return *GetNativePointerField<float*>(this, "APrimalBuff.DeactivateAfterTime"); }
-	float& WeaponRecoilMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalBuff.WeaponRecoilMultiplier"); }
-	float& ReceiveDamageMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalBuff.ReceiveDamageMultiplier"); }
-	float& MeleeDamageMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalBuff.MeleeDamageMultiplier"); }
-	float& DepleteInstigatorItemDurabilityPerSecondField() { return *GetNativePointerField<float*>(this, "APrimalBuff.DepleteInstigatorItemDurabilityPerSecond"); }
+	float& DeactivationLifespanField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.DeactivationLifespan")>(this, "APrimalBuff.DeactivationLifespan"); }
+	FName& InstigatorAttachmentSocketField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalBuff.InstigatorAttachmentSocket")>(this, "APrimalBuff.InstigatorAttachmentSocket"); }
+	float& RemoteForcedFleeDurationField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.RemoteForcedFleeDuration")>(this, "APrimalBuff.RemoteForcedFleeDuration"); }
+	FVector& AoETraceToTargetsStartOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalBuff.AoETraceToTargetsStartOffset")>(this, "APrimalBuff.AoETraceToTargetsStartOffset"); }
+	TWeakObjectPtr<AActor>& TargetField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*, API::FieldNameHash("APrimalBuff.Target")>(this, "APrimalBuff.Target"); }
+	TWeakObjectPtr<UPrimalItem>& InstigatorItemField() { return *GetNativePointerField<TWeakObjectPtr<UPrimalItem>*, API::FieldNameHash("APrimalBuff.InstigatorItem")>(this, "APrimalBuff.InstigatorItem"); }
+	float& SlowInstigatorFallingAddZVelocityField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.SlowInstigatorFallingAddZVelocity")>(this, "APrimalBuff.SlowInstigatorFallingAddZVelocity"); }
+	float& SlowInstigatorFallingDampenZVelocityField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.SlowInstigatorFallingDampenZVelocity")>(this, "APrimalBuff.SlowInstigatorFallingDampenZVelocity"); }
+	float& DeactivateAfterTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.DeactivateAfterTime")>(this, "APrimalBuff.DeactivateAfterTime"); }
+	float& WeaponRecoilMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.WeaponRecoilMultiplier")>(this, "APrimalBuff.WeaponRecoilMultiplier"); }
+	float& ReceiveDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.ReceiveDamageMultiplier")>(this, "APrimalBuff.ReceiveDamageMultiplier"); }
+	float& MeleeDamageMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.MeleeDamageMultiplier")>(this, "APrimalBuff.MeleeDamageMultiplier"); }
+	float& DepleteInstigatorItemDurabilityPerSecondField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.DepleteInstigatorItemDurabilityPerSecond")>(this, "APrimalBuff.DepleteInstigatorItemDurabilityPerSecond"); }
 	FieldArray<float, 12> ValuesToAddPerSecondField() { return { this, "APrimalBuff.ValuesToAddPerSecond" }; }
-	float& CharacterAdd_DefaultHyperthermicInsulationField() { return *GetNativePointerField<float*>(this, "APrimalBuff.CharacterAdd_DefaultHyperthermicInsulation"); }
-	float& CharacterAdd_DefaultHypothermicInsulationField() { return *GetNativePointerField<float*>(this, "APrimalBuff.CharacterAdd_DefaultHypothermicInsulation"); }
-	float& CharacterMultiplier_ExtraWaterConsumptionMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalBuff.CharacterMultiplier_ExtraWaterConsumptionMultiplier"); }
-	float& CharacterMultiplier_ExtraFoodConsumptionMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalBuff.CharacterMultiplier_ExtraFoodConsumptionMultiplier"); }
-	float& CharacterMultiplier_SubmergedOxygenDecreaseSpeedField() { return *GetNativePointerField<float*>(this, "APrimalBuff.CharacterMultiplier_SubmergedOxygenDecreaseSpeed"); }
-	float& ViewMinExposureMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalBuff.ViewMinExposureMultiplier"); }
-	float& ViewMaxExposureMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalBuff.ViewMaxExposureMultiplier"); }
-	float& XPtoAddField() { return *GetNativePointerField<float*>(this, "APrimalBuff.XPtoAdd"); }
-	float& XPtoAddRateField() { return *GetNativePointerField<float*>(this, "APrimalBuff.XPtoAddRate"); }
-	bool& bDeactivateAfterAddingXPField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bDeactivateAfterAddingXP"); }
-	float& SubmergedMaxSpeedModifierField() { return *GetNativePointerField<float*>(this, "APrimalBuff.SubmergedMaxSpeedModifier"); }
-	float& UnsubmergedMaxSpeedModifierField() { return *GetNativePointerField<float*>(this, "APrimalBuff.UnsubmergedMaxSpeedModifier"); }
-	long double& BuffStartTimeField() { return *GetNativePointerField<long double*>(this, "APrimalBuff.BuffStartTime"); }
-	UMaterialInterface * BuffPostProcessEffectField() { return *GetNativePointerField<UMaterialInterface **>(this, "APrimalBuff.BuffPostProcessEffect"); }
-	TArray<TSubclassOf<AActor>>& PreventActorClassesTargetingField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*>(this, "APrimalBuff.PreventActorClassesTargeting"); }
-	TArray<float>& PreventActorClassesTargetingRangesField() { return *GetNativePointerField<TArray<float>*>(this, "APrimalBuff.PreventActorClassesTargetingRanges"); }
-	TSubclassOf<APrimalBuff>& AOEOtherBuffToApplyField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*>(this, "APrimalBuff.AOEOtherBuffToApply"); }
-	float& AOEBuffRangeField() { return *GetNativePointerField<float*>(this, "APrimalBuff.AOEBuffRange"); }
-	float& CharacterAOEBuffDamageField() { return *GetNativePointerField<float*>(this, "APrimalBuff.CharacterAOEBuffDamage"); }
-	float& CharacterAOEBuffResistanceField() { return *GetNativePointerField<float*>(this, "APrimalBuff.CharacterAOEBuffResistance"); }
-	float& Maximum2DVelocityForStaminaRecoveryField() { return *GetNativePointerField<float*>(this, "APrimalBuff.Maximum2DVelocityForStaminaRecovery"); }
-	TArray<UMaterialInterface *> PostprocessBlendablesToExcludeField() { return *GetNativePointerField<TArray<UMaterialInterface *>*>(this, "APrimalBuff.PostprocessBlendablesToExclude"); }
-	TArray<TWeakObjectPtr<APrimalCharacter>>& BuffedCharactersField() { return *GetNativePointerField<TArray<TWeakObjectPtr<APrimalCharacter>>*>(this, "APrimalBuff.BuffedCharacters"); }
-	long double& LastItemDurabilityDepletionTimeField() { return *GetNativePointerField<long double*>(this, "APrimalBuff.LastItemDurabilityDepletionTime"); }
-	TSubclassOf<APrimalBuff>& BuffToGiveOnDeactivationField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*>(this, "APrimalBuff.BuffToGiveOnDeactivation"); }
-	TArray<TSubclassOf<APrimalBuff>>& BuffClassesToCancelOnActivationField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalBuff>>*>(this, "APrimalBuff.BuffClassesToCancelOnActivation"); }
-	TArray<TSubclassOf<APrimalBuff>>& ActivePreventsBuffClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalBuff>>*>(this, "APrimalBuff.ActivePreventsBuffClasses"); }
-	TArray<TSubclassOf<APrimalCharacter>>& BuffRequiresOwnerClassField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalCharacter>>*>(this, "APrimalBuff.BuffRequiresOwnerClass"); }
-	TArray<TSubclassOf<APrimalCharacter>>& BuffPreventsOwnerClassField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalCharacter>>*>(this, "APrimalBuff.BuffPreventsOwnerClass"); }
-	float& XPEarningMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalBuff.XPEarningMultiplier"); }
-	bool& bUseBPSetupForInstigatorField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bUseBPSetupForInstigator"); }
-	bool& bUseBPDeactivatedField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bUseBPDeactivated"); }
-	bool& bUseBPCustomAllowAddBuffField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bUseBPCustomAllowAddBuff"); }
-	FVector& staticPathingDestinationField() { return *GetNativePointerField<FVector*>(this, "APrimalBuff.staticPathingDestination"); }
-	long double& TickingDeactivationTimeField() { return *GetNativePointerField<long double*>(this, "APrimalBuff.TickingDeactivationTime"); }
-	UPrimalBuffPersistentData * MyBuffPersistentDataField() { return *GetNativePointerField<UPrimalBuffPersistentData **>(this, "APrimalBuff.MyBuffPersistentData"); }
-	TSubclassOf<UPrimalBuffPersistentData>& BuffPersistentDataClassField() { return *GetNativePointerField<TSubclassOf<UPrimalBuffPersistentData>*>(this, "APrimalBuff.BuffPersistentDataClass"); }
-	TWeakObjectPtr<AActor>& DamageCauserField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*>(this, "APrimalBuff.DamageCauser"); }
-	USoundBase * ExtraActivationSoundToPlayField() { return *GetNativePointerField<USoundBase **>(this, "APrimalBuff.ExtraActivationSoundToPlay"); }
-	bool& bPersistentBuffSurvivesLevelUpField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bPersistentBuffSurvivesLevelUp"); }
-	float& AoEApplyDamageField() { return *GetNativePointerField<float*>(this, "APrimalBuff.AoEApplyDamage"); }
-	float& AoEApplyDamageIntervalField() { return *GetNativePointerField<float*>(this, "APrimalBuff.AoEApplyDamageInterval"); }
-	TSubclassOf<UDamageType>& AoEApplyDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*>(this, "APrimalBuff.AoEApplyDamageType"); }
-	TSubclassOf<APrimalBuff>& ForceNetworkSpatializationMaxLimitBuffTypeField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*>(this, "APrimalBuff.ForceNetworkSpatializationMaxLimitBuffType"); }
-	int& ForceNetworkSpatializationBuffMaxLimitNumField() { return *GetNativePointerField<int*>(this, "APrimalBuff.ForceNetworkSpatializationBuffMaxLimitNum"); }
-	float& ForceNetworkSpatializationBuffMaxLimitRangeField() { return *GetNativePointerField<float*>(this, "APrimalBuff.ForceNetworkSpatializationBuffMaxLimitRange"); }
-	float& InsulationRangeField() { return *GetNativePointerField<float*>(this, "APrimalBuff.InsulationRange"); }
-	float& HyperThermiaInsulationField() { return *GetNativePointerField<float*>(this, "APrimalBuff.HyperThermiaInsulation"); }
-	float& HypoThermiaInsulationField() { return *GetNativePointerField<float*>(this, "APrimalBuff.HypoThermiaInsulation"); }
-	FVector& AoEBuffLocOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalBuff.AoEBuffLocOffset"); }
-	TArray<TSubclassOf<AActor>>& AoEClassesToIncludeField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*>(this, "APrimalBuff.AoEClassesToInclude"); }
-	TArray<TSubclassOf<AActor>>& AoEClassesToExcludeField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*>(this, "APrimalBuff.AoEClassesToExclude"); }
-	bool& bUseBPExcludeAoEActorField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bUseBPExcludeAoEActor"); }
-	bool& bOverrideBuffDescriptionField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bOverrideBuffDescription"); }
-	bool& bOnlyTickWhenPossessedField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bOnlyTickWhenPossessed"); }
-	bool& bDestroyWhenUnpossessedField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bDestroyWhenUnpossessed"); }
-	long double& LastAoEApplyDamageTimeField() { return *GetNativePointerField<long double*>(this, "APrimalBuff.LastAoEApplyDamageTime"); }
-	float& OnlyForInstigatorSoundFadeInTimeField() { return *GetNativePointerField<float*>(this, "APrimalBuff.OnlyForInstigatorSoundFadeInTime"); }
-	bool& bUseBuffTickServerField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bUseBuffTickServer"); }
-	bool& bUseBuffTickClientField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bUseBuffTickClient"); }
-	float& BuffTickServerMaxTimeField() { return *GetNativePointerField<float*>(this, "APrimalBuff.BuffTickServerMaxTime"); }
-	float& BuffTickServerMinTimeField() { return *GetNativePointerField<float*>(this, "APrimalBuff.BuffTickServerMinTime"); }
-	float& BuffTickClientMaxTimeField() { return *GetNativePointerField<float*>(this, "APrimalBuff.BuffTickClientMaxTime"); }
-	float& BuffTickClientMinTimeField() { return *GetNativePointerField<float*>(this, "APrimalBuff.BuffTickClientMinTime"); }
-	long double& LastBuffTickTimeServerField() { return *GetNativePointerField<long double*>(this, "APrimalBuff.LastBuffTickTimeServer"); }
-	long double& LastBuffTickTimeClientField() { return *GetNativePointerField<long double*>(this, "APrimalBuff.LastBuffTickTimeClient"); }
-	long double& NextBuffTickTimeServerField() { return *GetNativePointerField<long double*>(this, "APrimalBuff.NextBuffTickTimeServer"); }
-	long double& NextBuffTickTimeClientField() { return *GetNativePointerField<long double*>(this, "APrimalBuff.NextBuffTickTimeClient"); }
-	bool& bTickFunctionDisabledField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bTickFunctionDisabled"); }
-	bool& bWasStasisedField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bWasStasised"); }
-	int& AddBuffMaxNumStacksField() { return *GetNativePointerField<int*>(this, "APrimalBuff.AddBuffMaxNumStacks"); }
-	USoundBase * DeactivatedSoundField() { return *GetNativePointerField<USoundBase **>(this, "APrimalBuff.DeactivatedSound"); }
-	bool& bDeactivatedSoundOnlyLocalField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bDeactivatedSoundOnlyLocal"); }
-	bool& bDisableBloomField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bDisableBloom"); }
-	bool& bBPOverrideCharacterNewFallVelocityField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bBPOverrideCharacterNewFallVelocity"); }
-	bool& bBPModifyCharacterFOVField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bBPModifyCharacterFOV"); }
-	bool& bDisableLightShaftsField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bDisableLightShafts"); }
-	float& PostProcessInterpSpeedDownField() { return *GetNativePointerField<float*>(this, "APrimalBuff.PostProcessInterpSpeedDown"); }
-	float& PostProcessInterpSpeedUpField() { return *GetNativePointerField<float*>(this, "APrimalBuff.PostProcessInterpSpeedUp"); }
-	float& TPVCameraSpeedInterpolationMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalBuff.TPVCameraSpeedInterpolationMultiplier"); }
-	bool& bIsCarryBuffField() { return *GetNativePointerField<bool*>(this, "APrimalBuff.bIsCarryBuff"); }
-	long double& TimeForNextAOECheckField() { return *GetNativePointerField<long double*>(this, "APrimalBuff.TimeForNextAOECheck"); }
-	float& AOEBuffIntervalMinField() { return *GetNativePointerField<float*>(this, "APrimalBuff.AOEBuffIntervalMin"); }
-	float& AOEBuffIntervalMaxField() { return *GetNativePointerField<float*>(this, "APrimalBuff.AOEBuffIntervalMax"); }
-	float& MaximumVelocityZForSlowingFallField() { return *GetNativePointerField<float*>(this, "APrimalBuff.MaximumVelocityZForSlowingFall"); }
-	int& FNameIntField() { return *GetNativePointerField<int*>(this, "APrimalBuff.FNameInt"); }
+	float& CharacterAdd_DefaultHyperthermicInsulationField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.CharacterAdd_DefaultHyperthermicInsulation")>(this, "APrimalBuff.CharacterAdd_DefaultHyperthermicInsulation"); }
+	float& CharacterAdd_DefaultHypothermicInsulationField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.CharacterAdd_DefaultHypothermicInsulation")>(this, "APrimalBuff.CharacterAdd_DefaultHypothermicInsulation"); }
+	float& CharacterMultiplier_ExtraWaterConsumptionMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.CharacterMultiplier_ExtraWaterConsumptionMultiplier")>(this, "APrimalBuff.CharacterMultiplier_ExtraWaterConsumptionMultiplier"); }
+	float& CharacterMultiplier_ExtraFoodConsumptionMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.CharacterMultiplier_ExtraFoodConsumptionMultiplier")>(this, "APrimalBuff.CharacterMultiplier_ExtraFoodConsumptionMultiplier"); }
+	float& CharacterMultiplier_SubmergedOxygenDecreaseSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.CharacterMultiplier_SubmergedOxygenDecreaseSpeed")>(this, "APrimalBuff.CharacterMultiplier_SubmergedOxygenDecreaseSpeed"); }
+	float& ViewMinExposureMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.ViewMinExposureMultiplier")>(this, "APrimalBuff.ViewMinExposureMultiplier"); }
+	float& ViewMaxExposureMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.ViewMaxExposureMultiplier")>(this, "APrimalBuff.ViewMaxExposureMultiplier"); }
+	float& XPtoAddField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.XPtoAdd")>(this, "APrimalBuff.XPtoAdd"); }
+	float& XPtoAddRateField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.XPtoAddRate")>(this, "APrimalBuff.XPtoAddRate"); }
+	bool& bDeactivateAfterAddingXPField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bDeactivateAfterAddingXP")>(this, "APrimalBuff.bDeactivateAfterAddingXP"); }
+	float& SubmergedMaxSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.SubmergedMaxSpeedModifier")>(this, "APrimalBuff.SubmergedMaxSpeedModifier"); }
+	float& UnsubmergedMaxSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.UnsubmergedMaxSpeedModifier")>(this, "APrimalBuff.UnsubmergedMaxSpeedModifier"); }
+	long double& BuffStartTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalBuff.BuffStartTime")>(this, "APrimalBuff.BuffStartTime"); }
+	UMaterialInterface * BuffPostProcessEffectField() { return *GetNativePointerField<UMaterialInterface **, API::FieldNameHash("APrimalBuff.BuffPostProcessEffect")>(this, "APrimalBuff.BuffPostProcessEffect"); }
+	TArray<TSubclassOf<AActor>>& PreventActorClassesTargetingField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*, API::FieldNameHash("APrimalBuff.PreventActorClassesTargeting")>(this, "APrimalBuff.PreventActorClassesTargeting"); }
+	TArray<float>& PreventActorClassesTargetingRangesField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("APrimalBuff.PreventActorClassesTargetingRanges")>(this, "APrimalBuff.PreventActorClassesTargetingRanges"); }
+	TSubclassOf<APrimalBuff>& AOEOtherBuffToApplyField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*, API::FieldNameHash("APrimalBuff.AOEOtherBuffToApply")>(this, "APrimalBuff.AOEOtherBuffToApply"); }
+	float& AOEBuffRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.AOEBuffRange")>(this, "APrimalBuff.AOEBuffRange"); }
+	float& CharacterAOEBuffDamageField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.CharacterAOEBuffDamage")>(this, "APrimalBuff.CharacterAOEBuffDamage"); }
+	float& CharacterAOEBuffResistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.CharacterAOEBuffResistance")>(this, "APrimalBuff.CharacterAOEBuffResistance"); }
+	float& Maximum2DVelocityForStaminaRecoveryField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.Maximum2DVelocityForStaminaRecovery")>(this, "APrimalBuff.Maximum2DVelocityForStaminaRecovery"); }
+	TArray<UMaterialInterface *> PostprocessBlendablesToExcludeField() { return *GetNativePointerField<TArray<UMaterialInterface *>*, API::FieldNameHash("APrimalBuff.PostprocessBlendablesToExclude")>(this, "APrimalBuff.PostprocessBlendablesToExclude"); }
+	TArray<TWeakObjectPtr<APrimalCharacter>>& BuffedCharactersField() { return *GetNativePointerField<TArray<TWeakObjectPtr<APrimalCharacter>>*, API::FieldNameHash("APrimalBuff.BuffedCharacters")>(this, "APrimalBuff.BuffedCharacters"); }
+	long double& LastItemDurabilityDepletionTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalBuff.LastItemDurabilityDepletionTime")>(this, "APrimalBuff.LastItemDurabilityDepletionTime"); }
+	TSubclassOf<APrimalBuff>& BuffToGiveOnDeactivationField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*, API::FieldNameHash("APrimalBuff.BuffToGiveOnDeactivation")>(this, "APrimalBuff.BuffToGiveOnDeactivation"); }
+	TArray<TSubclassOf<APrimalBuff>>& BuffClassesToCancelOnActivationField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalBuff>>*, API::FieldNameHash("APrimalBuff.BuffClassesToCancelOnActivation")>(this, "APrimalBuff.BuffClassesToCancelOnActivation"); }
+	TArray<TSubclassOf<APrimalBuff>>& ActivePreventsBuffClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalBuff>>*, API::FieldNameHash("APrimalBuff.ActivePreventsBuffClasses")>(this, "APrimalBuff.ActivePreventsBuffClasses"); }
+	TArray<TSubclassOf<APrimalCharacter>>& BuffRequiresOwnerClassField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalCharacter>>*, API::FieldNameHash("APrimalBuff.BuffRequiresOwnerClass")>(this, "APrimalBuff.BuffRequiresOwnerClass"); }
+	TArray<TSubclassOf<APrimalCharacter>>& BuffPreventsOwnerClassField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalCharacter>>*, API::FieldNameHash("APrimalBuff.BuffPreventsOwnerClass")>(this, "APrimalBuff.BuffPreventsOwnerClass"); }
+	float& XPEarningMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.XPEarningMultiplier")>(this, "APrimalBuff.XPEarningMultiplier"); }
+	bool& bUseBPSetupForInstigatorField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bUseBPSetupForInstigator")>(this, "APrimalBuff.bUseBPSetupForInstigator"); }
+	bool& bUseBPDeactivatedField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bUseBPDeactivated")>(this, "APrimalBuff.bUseBPDeactivated"); }
+	bool& bUseBPCustomAllowAddBuffField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bUseBPCustomAllowAddBuff")>(this, "APrimalBuff.bUseBPCustomAllowAddBuff"); }
+	FVector& staticPathingDestinationField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalBuff.staticPathingDestination")>(this, "APrimalBuff.staticPathingDestination"); }
+	long double& TickingDeactivationTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalBuff.TickingDeactivationTime")>(this, "APrimalBuff.TickingDeactivationTime"); }
+	UPrimalBuffPersistentData * MyBuffPersistentDataField() { return *GetNativePointerField<UPrimalBuffPersistentData **, API::FieldNameHash("APrimalBuff.MyBuffPersistentData")>(this, "APrimalBuff.MyBuffPersistentData"); }
+	TSubclassOf<UPrimalBuffPersistentData>& BuffPersistentDataClassField() { return *GetNativePointerField<TSubclassOf<UPrimalBuffPersistentData>*, API::FieldNameHash("APrimalBuff.BuffPersistentDataClass")>(this, "APrimalBuff.BuffPersistentDataClass"); }
+	TWeakObjectPtr<AActor>& DamageCauserField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*, API::FieldNameHash("APrimalBuff.DamageCauser")>(this, "APrimalBuff.DamageCauser"); }
+	USoundBase * ExtraActivationSoundToPlayField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("APrimalBuff.ExtraActivationSoundToPlay")>(this, "APrimalBuff.ExtraActivationSoundToPlay"); }
+	bool& bPersistentBuffSurvivesLevelUpField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bPersistentBuffSurvivesLevelUp")>(this, "APrimalBuff.bPersistentBuffSurvivesLevelUp"); }
+	float& AoEApplyDamageField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.AoEApplyDamage")>(this, "APrimalBuff.AoEApplyDamage"); }
+	float& AoEApplyDamageIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.AoEApplyDamageInterval")>(this, "APrimalBuff.AoEApplyDamageInterval"); }
+	TSubclassOf<UDamageType>& AoEApplyDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*, API::FieldNameHash("APrimalBuff.AoEApplyDamageType")>(this, "APrimalBuff.AoEApplyDamageType"); }
+	TSubclassOf<APrimalBuff>& ForceNetworkSpatializationMaxLimitBuffTypeField() { return *GetNativePointerField<TSubclassOf<APrimalBuff>*, API::FieldNameHash("APrimalBuff.ForceNetworkSpatializationMaxLimitBuffType")>(this, "APrimalBuff.ForceNetworkSpatializationMaxLimitBuffType"); }
+	int& ForceNetworkSpatializationBuffMaxLimitNumField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalBuff.ForceNetworkSpatializationBuffMaxLimitNum")>(this, "APrimalBuff.ForceNetworkSpatializationBuffMaxLimitNum"); }
+	float& ForceNetworkSpatializationBuffMaxLimitRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.ForceNetworkSpatializationBuffMaxLimitRange")>(this, "APrimalBuff.ForceNetworkSpatializationBuffMaxLimitRange"); }
+	float& InsulationRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.InsulationRange")>(this, "APrimalBuff.InsulationRange"); }
+	float& HyperThermiaInsulationField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.HyperThermiaInsulation")>(this, "APrimalBuff.HyperThermiaInsulation"); }
+	float& HypoThermiaInsulationField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.HypoThermiaInsulation")>(this, "APrimalBuff.HypoThermiaInsulation"); }
+	FVector& AoEBuffLocOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalBuff.AoEBuffLocOffset")>(this, "APrimalBuff.AoEBuffLocOffset"); }
+	TArray<TSubclassOf<AActor>>& AoEClassesToIncludeField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*, API::FieldNameHash("APrimalBuff.AoEClassesToInclude")>(this, "APrimalBuff.AoEClassesToInclude"); }
+	TArray<TSubclassOf<AActor>>& AoEClassesToExcludeField() { return *GetNativePointerField<TArray<TSubclassOf<AActor>>*, API::FieldNameHash("APrimalBuff.AoEClassesToExclude")>(this, "APrimalBuff.AoEClassesToExclude"); }
+	bool& bUseBPExcludeAoEActorField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bUseBPExcludeAoEActor")>(this, "APrimalBuff.bUseBPExcludeAoEActor"); }
+	bool& bOverrideBuffDescriptionField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bOverrideBuffDescription")>(this, "APrimalBuff.bOverrideBuffDescription"); }
+	bool& bOnlyTickWhenPossessedField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bOnlyTickWhenPossessed")>(this, "APrimalBuff.bOnlyTickWhenPossessed"); }
+	bool& bDestroyWhenUnpossessedField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bDestroyWhenUnpossessed")>(this, "APrimalBuff.bDestroyWhenUnpossessed"); }
+	long double& LastAoEApplyDamageTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalBuff.LastAoEApplyDamageTime")>(this, "APrimalBuff.LastAoEApplyDamageTime"); }
+	float& OnlyForInstigatorSoundFadeInTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.OnlyForInstigatorSoundFadeInTime")>(this, "APrimalBuff.OnlyForInstigatorSoundFadeInTime"); }
+	bool& bUseBuffTickServerField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bUseBuffTickServer")>(this, "APrimalBuff.bUseBuffTickServer"); }
+	bool& bUseBuffTickClientField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bUseBuffTickClient")>(this, "APrimalBuff.bUseBuffTickClient"); }
+	float& BuffTickServerMaxTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.BuffTickServerMaxTime")>(this, "APrimalBuff.BuffTickServerMaxTime"); }
+	float& BuffTickServerMinTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.BuffTickServerMinTime")>(this, "APrimalBuff.BuffTickServerMinTime"); }
+	float& BuffTickClientMaxTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.BuffTickClientMaxTime")>(this, "APrimalBuff.BuffTickClientMaxTime"); }
+	float& BuffTickClientMinTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.BuffTickClientMinTime")>(this, "APrimalBuff.BuffTickClientMinTime"); }
+	long double& LastBuffTickTimeServerField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalBuff.LastBuffTickTimeServer")>(this, "APrimalBuff.LastBuffTickTimeServer"); }
+	long double& LastBuffTickTimeClientField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalBuff.LastBuffTickTimeClient")>(this, "APrimalBuff.LastBuffTickTimeClient"); }
+	long double& NextBuffTickTimeServerField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalBuff.NextBuffTickTimeServer")>(this, "APrimalBuff.NextBuffTickTimeServer"); }
+	long double& NextBuffTickTimeClientField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalBuff.NextBuffTickTimeClient")>(this, "APrimalBuff.NextBuffTickTimeClient"); }
+	bool& bTickFunctionDisabledField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bTickFunctionDisabled")>(this, "APrimalBuff.bTickFunctionDisabled"); }
+	bool& bWasStasisedField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bWasStasised")>(this, "APrimalBuff.bWasStasised"); }
+	int& AddBuffMaxNumStacksField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalBuff.AddBuffMaxNumStacks")>(this, "APrimalBuff.AddBuffMaxNumStacks"); }
+	USoundBase * DeactivatedSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("APrimalBuff.DeactivatedSound")>(this, "APrimalBuff.DeactivatedSound"); }
+	bool& bDeactivatedSoundOnlyLocalField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bDeactivatedSoundOnlyLocal")>(this, "APrimalBuff.bDeactivatedSoundOnlyLocal"); }
+	bool& bDisableBloomField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bDisableBloom")>(this, "APrimalBuff.bDisableBloom"); }
+	bool& bBPOverrideCharacterNewFallVelocityField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bBPOverrideCharacterNewFallVelocity")>(this, "APrimalBuff.bBPOverrideCharacterNewFallVelocity"); }
+	bool& bBPModifyCharacterFOVField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bBPModifyCharacterFOV")>(this, "APrimalBuff.bBPModifyCharacterFOV"); }
+	bool& bDisableLightShaftsField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bDisableLightShafts")>(this, "APrimalBuff.bDisableLightShafts"); }
+	float& PostProcessInterpSpeedDownField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.PostProcessInterpSpeedDown")>(this, "APrimalBuff.PostProcessInterpSpeedDown"); }
+	float& PostProcessInterpSpeedUpField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.PostProcessInterpSpeedUp")>(this, "APrimalBuff.PostProcessInterpSpeedUp"); }
+	float& TPVCameraSpeedInterpolationMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.TPVCameraSpeedInterpolationMultiplier")>(this, "APrimalBuff.TPVCameraSpeedInterpolationMultiplier"); }
+	bool& bIsCarryBuffField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalBuff.bIsCarryBuff")>(this, "APrimalBuff.bIsCarryBuff"); }
+	long double& TimeForNextAOECheckField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalBuff.TimeForNextAOECheck")>(this, "APrimalBuff.TimeForNextAOECheck"); }
+	float& AOEBuffIntervalMinField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.AOEBuffIntervalMin")>(this, "APrimalBuff.AOEBuffIntervalMin"); }
+	float& AOEBuffIntervalMaxField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.AOEBuffIntervalMax")>(this, "APrimalBuff.AOEBuffIntervalMax"); }
+	float& MaximumVelocityZForSlowingFallField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalBuff.MaximumVelocityZForSlowingFall")>(this, "APrimalBuff.MaximumVelocityZForSlowingFall"); }
+	int& FNameIntField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalBuff.FNameInt")>(this, "APrimalBuff.FNameInt"); }
 
 	// Bit fields
 
@@ -399,13 +399,13 @@ struct APrimalBuff
 
 struct UPrimalEngramEntry : UObject
 {
-	int& RequiredCharacterLevelField() { return *GetNativePointerField<int*>(this, "UPrimalEngramEntry.RequiredCharacterLevel"); }
-	int& RequiredEngramPointsField() { return *GetNativePointerField<int*>(this, "UPrimalEngramEntry.RequiredEngramPoints"); }
-	TSubclassOf<UPrimalItem>& BluePrintEntryField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "UPrimalEngramEntry.BluePrintEntry"); }
-	FString& ExtraEngramDescriptionField() { return *GetNativePointerField<FString*>(this, "UPrimalEngramEntry.ExtraEngramDescription"); }
-	//TArray<FEngramEntries>& EngramRequirementSetsField() { return *GetNativePointerField<TArray<FEngramEntries>*>(this, "UPrimalEngramEntry.EngramRequirementSets"); }
-	int& MyEngramIndexField() { return *GetNativePointerField<int*>(this, "UPrimalEngramEntry.MyEngramIndex"); }
-	TEnumAsByte<enum EEngramGroup::Type>& EngramGroupField() { return *GetNativePointerField<TEnumAsByte<enum EEngramGroup::Type>*>(this, "UPrimalEngramEntry.EngramGroup"); }
+	int& RequiredCharacterLevelField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalEngramEntry.RequiredCharacterLevel")>(this, "UPrimalEngramEntry.RequiredCharacterLevel"); }
+	int& RequiredEngramPointsField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalEngramEntry.RequiredEngramPoints")>(this, "UPrimalEngramEntry.RequiredEngramPoints"); }
+	TSubclassOf<UPrimalItem>& BluePrintEntryField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("UPrimalEngramEntry.BluePrintEntry")>(this, "UPrimalEngramEntry.BluePrintEntry"); }
+	FString& ExtraEngramDescriptionField() { return *GetNativePointerField<FString*, API::FieldNameHash("UPrimalEngramEntry.ExtraEngramDescription")>(this, "UPrimalEngramEntry.ExtraEngramDescription"); }
+	//TArray<FEngramEntries>& EngramRequirementSetsField() { return *GetNativePointerField<TArray<FEngramEntries>*, API::FieldNameHash("UPrimalEngramEntry.EngramRequirementSets")>(this, "UPrimalEngramEntry.EngramRequirementSets"); }
+	int& MyEngramIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("UPrimalEngramEntry.MyEngramIndex")>(this, "UPrimalEngramEntry.MyEngramIndex"); }
+	TEnumAsByte<enum EEngramGroup::Type>& EngramGroupField() { return *GetNativePointerField<TEnumAsByte<enum EEngramGroup::Type>*, API::FieldNameHash("UPrimalEngramEntry.EngramGroup")>(this, "UPrimalEngramEntry.EngramGroup"); }
 
 	// Bit fields
 
@@ -572,14 +572,14 @@ struct UVictoryCore
 
 struct UDamageType
 {
-	float& ImpulseMinimumZPercentField() { return *GetNativePointerField<float*>(this, "UDamageType.ImpulseMinimumZPercent"); }
-	float& DestructibleImpulseScaleField() { return *GetNativePointerField<float*>(this, "UDamageType.DestructibleImpulseScale"); }
-	float& ImpulseRagdollScaleField() { return *GetNativePointerField<float*>(this, "UDamageType.ImpulseRagdollScale"); }
-	float& DefaultImpulseField() { return *GetNativePointerField<float*>(this, "UDamageType.DefaultImpulse"); }
-	float& PointDamageArmorEffectivenessField() { return *GetNativePointerField<float*>(this, "UDamageType.PointDamageArmorEffectiveness"); }
-	float& GeneralDamageArmorEffectivenessField() { return *GetNativePointerField<float*>(this, "UDamageType.GeneralDamageArmorEffectiveness"); }
-	float& ArmorDurabilityDegradationMultiplierField() { return *GetNativePointerField<float*>(this, "UDamageType.ArmorDurabilityDegradationMultiplier"); }
-	float& RadialPartiallyObstructedDamagePercentField() { return *GetNativePointerField<float*>(this, "UDamageType.RadialPartiallyObstructedDamagePercent"); }
+	float& ImpulseMinimumZPercentField() { return *GetNativePointerField<float*, API::FieldNameHash("UDamageType.ImpulseMinimumZPercent")>(this, "UDamageType.ImpulseMinimumZPercent"); }
+	float& DestructibleImpulseScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("UDamageType.DestructibleImpulseScale")>(this, "UDamageType.DestructibleImpulseScale"); }
+	float& ImpulseRagdollScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("UDamageType.ImpulseRagdollScale")>(this, "UDamageType.ImpulseRagdollScale"); }
+	float& DefaultImpulseField() { return *GetNativePointerField<float*, API::FieldNameHash("UDamageType.DefaultImpulse")>(this, "UDamageType.DefaultImpulse"); }
+	float& PointDamageArmorEffectivenessField() { return *GetNativePointerField<float*, API::FieldNameHash("UDamageType.PointDamageArmorEffectiveness")>(this, "UDamageType.PointDamageArmorEffectiveness"); }
+	float& GeneralDamageArmorEffectivenessField() { return *GetNativePointerField<float*, API::FieldNameHash("UDamageType.GeneralDamageArmorEffectiveness")>(this, "UDamageType.GeneralDamageArmorEffectiveness"); }
+	float& ArmorDurabilityDegradationMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("UDamageType.ArmorDurabilityDegradationMultiplier")>(this, "UDamageType.ArmorDurabilityDegradationMultiplier"); }
+	float& RadialPartiallyObstructedDamagePercentField() { return *GetNativePointerField<float*, API::FieldNameHash("UDamageType.RadialPartiallyObstructedDamagePercent")>(this, "UDamageType.RadialPartiallyObstructedDamagePercent"); }
 
 	// Bit fields
 
@@ -599,40 +599,40 @@ struct UDamageType
 
 struct FDinoAttackInfo
 {
-	FName& AttackNameField() { return *GetNativePointerField<FName*>(this, "FDinoAttackInfo.AttackName"); }
-	float& AttackWeightField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.AttackWeight"); }
-	float& AttackRangeField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.AttackRange"); }
-	float& MinAttackRangeField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.MinAttackRange"); }
-	float& ActivateAttackRangeField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.ActivateAttackRange"); }
-	float& AttackIntervalField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.AttackInterval"); }
-	TArray<int>& ChildStateIndexesField() { return *GetNativePointerField<TArray<int>*>(this, "FDinoAttackInfo.ChildStateIndexes"); }
-	float& AttackWithJumpChanceField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.AttackWithJumpChance"); }
-	long double& LastAttackTimeField() { return *GetNativePointerField<long double*>(this, "FDinoAttackInfo.LastAttackTime"); }
-	long double& RiderLastAttackTimeField() { return *GetNativePointerField<long double*>(this, "FDinoAttackInfo.RiderLastAttackTime"); }
-	float& AttackSelectionExpirationTimeField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.AttackSelectionExpirationTime"); }
-	long double& AttackSelectionTimeField() { return *GetNativePointerField<long double*>(this, "FDinoAttackInfo.AttackSelectionTime"); }
-	float& AttackRotationRangeDegreesField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.AttackRotationRangeDegrees"); }
-	float& AttackRotationGroundSpeedMultiplierField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.AttackRotationGroundSpeedMultiplier"); }
-	FRotator& AttackRotationRateField() { return *GetNativePointerField<FRotator*>(this, "FDinoAttackInfo.AttackRotationRate"); }
-	TArray<FName>& MeleeSwingSocketsField() { return *GetNativePointerField<TArray<FName>*>(this, "FDinoAttackInfo.MeleeSwingSockets"); }
-	FName& RangedSocketField() { return *GetNativePointerField<FName*>(this, "FDinoAttackInfo.RangedSocket"); }
-	int& MeleeDamageAmountField() { return *GetNativePointerField<int*>(this, "FDinoAttackInfo.MeleeDamageAmount"); }
-	float& MeleeDamageImpulseField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.MeleeDamageImpulse"); }
-	float& MeleeSwingRadiusField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.MeleeSwingRadius"); }
-	TSubclassOf<UDamageType>& MeleeDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*>(this, "FDinoAttackInfo.MeleeDamageType"); }
-	float& AttackOffsetField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.AttackOffset"); }
-	float& StaminaCostField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.StaminaCost"); }
-	float& RiderAttackIntervalField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.RiderAttackInterval"); }
-	float& DotProductCheckMinField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.DotProductCheckMin"); }
-	float& DotProductCheckMaxField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.DotProductCheckMax"); }
-	TArray<UAnimMontage *> AttackAnimationsField() { return *GetNativePointerField<TArray<UAnimMontage *>*>(this, "FDinoAttackInfo.AttackAnimations"); }
-	TArray<float>& AttackAnimationWeightsField() { return *GetNativePointerField<TArray<float>*>(this, "FDinoAttackInfo.AttackAnimationWeights"); }
-	TArray<float>& AttackAnimationsTimeFromEndToConsiderFinishedField() { return *GetNativePointerField<TArray<float>*>(this, "FDinoAttackInfo.AttackAnimationsTimeFromEndToConsiderFinished"); }
-	float& AttackRunningSpeedModifierField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.AttackRunningSpeedModifier"); }
-	float& SwimmingAttackRunningSpeedModifierField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.SwimmingAttackRunningSpeedModifier"); }
-	float& SetAttackTargetTimeField() { return *GetNativePointerField<float*>(this, "FDinoAttackInfo.SetAttackTargetTime"); }
-	TArray<FVector>& LastSocketPositionsField() { return *GetNativePointerField<TArray<FVector>*>(this, "FDinoAttackInfo.LastSocketPositions"); }
-	long double& LastProjectileSpawnTimeField() { return *GetNativePointerField<long double*>(this, "FDinoAttackInfo.LastProjectileSpawnTime"); }
+	FName& AttackNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("FDinoAttackInfo.AttackName")>(this, "FDinoAttackInfo.AttackName"); }
+	float& AttackWeightField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.AttackWeight")>(this, "FDinoAttackInfo.AttackWeight"); }
+	float& AttackRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.AttackRange")>(this, "FDinoAttackInfo.AttackRange"); }
+	float& MinAttackRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.MinAttackRange")>(this, "FDinoAttackInfo.MinAttackRange"); }
+	float& ActivateAttackRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.ActivateAttackRange")>(this, "FDinoAttackInfo.ActivateAttackRange"); }
+	float& AttackIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.AttackInterval")>(this, "FDinoAttackInfo.AttackInterval"); }
+	TArray<int>& ChildStateIndexesField() { return *GetNativePointerField<TArray<int>*, API::FieldNameHash("FDinoAttackInfo.ChildStateIndexes")>(this, "FDinoAttackInfo.ChildStateIndexes"); }
+	float& AttackWithJumpChanceField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.AttackWithJumpChance")>(this, "FDinoAttackInfo.AttackWithJumpChance"); }
+	long double& LastAttackTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("FDinoAttackInfo.LastAttackTime")>(this, "FDinoAttackInfo.LastAttackTime"); }
+	long double& RiderLastAttackTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("FDinoAttackInfo.RiderLastAttackTime")>(this, "FDinoAttackInfo.RiderLastAttackTime"); }
+	float& AttackSelectionExpirationTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.AttackSelectionExpirationTime")>(this, "FDinoAttackInfo.AttackSelectionExpirationTime"); }
+	long double& AttackSelectionTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("FDinoAttackInfo.AttackSelectionTime")>(this, "FDinoAttackInfo.AttackSelectionTime"); }
+	float& AttackRotationRangeDegreesField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.AttackRotationRangeDegrees")>(this, "FDinoAttackInfo.AttackRotationRangeDegrees"); }
+	float& AttackRotationGroundSpeedMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.AttackRotationGroundSpeedMultiplier")>(this, "FDinoAttackInfo.AttackRotationGroundSpeedMultiplier"); }
+	FRotator& AttackRotationRateField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("FDinoAttackInfo.AttackRotationRate")>(this, "FDinoAttackInfo.AttackRotationRate"); }
+	TArray<FName>& MeleeSwingSocketsField() { return *GetNativePointerField<TArray<FName>*, API::FieldNameHash("FDinoAttackInfo.MeleeSwingSockets")>(this, "FDinoAttackInfo.MeleeSwingSockets"); }
+	FName& RangedSocketField() { return *GetNativePointerField<FName*, API::FieldNameHash("FDinoAttackInfo.RangedSocket")>(this, "FDinoAttackInfo.RangedSocket"); }
+	int& MeleeDamageAmountField() { return *GetNativePointerField<int*, API::FieldNameHash("FDinoAttackInfo.MeleeDamageAmount")>(this, "FDinoAttackInfo.MeleeDamageAmount"); }
+	float& MeleeDamageImpulseField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.MeleeDamageImpulse")>(this, "FDinoAttackInfo.MeleeDamageImpulse"); }
+	float& MeleeSwingRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.MeleeSwingRadius")>(this, "FDinoAttackInfo.MeleeSwingRadius"); }
+	TSubclassOf<UDamageType>& MeleeDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*, API::FieldNameHash("FDinoAttackInfo.MeleeDamageType")>(this, "FDinoAttackInfo.MeleeDamageType"); }
+	float& AttackOffsetField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.AttackOffset")>(this, "FDinoAttackInfo.AttackOffset"); }
+	float& StaminaCostField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.StaminaCost")>(this, "FDinoAttackInfo.StaminaCost"); }
+	float& RiderAttackIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.RiderAttackInterval")>(this, "FDinoAttackInfo.RiderAttackInterval"); }
+	float& DotProductCheckMinField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.DotProductCheckMin")>(this, "FDinoAttackInfo.DotProductCheckMin"); }
+	float& DotProductCheckMaxField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.DotProductCheckMax")>(this, "FDinoAttackInfo.DotProductCheckMax"); }
+	TArray<UAnimMontage *> AttackAnimationsField() { return *GetNativePointerField<TArray<UAnimMontage *>*, API::FieldNameHash("FDinoAttackInfo.AttackAnimations")>(this, "FDinoAttackInfo.AttackAnimations"); }
+	TArray<float>& AttackAnimationWeightsField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("FDinoAttackInfo.AttackAnimationWeights")>(this, "FDinoAttackInfo.AttackAnimationWeights"); }
+	TArray<float>& AttackAnimationsTimeFromEndToConsiderFinishedField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("FDinoAttackInfo.AttackAnimationsTimeFromEndToConsiderFinished")>(this, "FDinoAttackInfo.AttackAnimationsTimeFromEndToConsiderFinished"); }
+	float& AttackRunningSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.AttackRunningSpeedModifier")>(this, "FDinoAttackInfo.AttackRunningSpeedModifier"); }
+	float& SwimmingAttackRunningSpeedModifierField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.SwimmingAttackRunningSpeedModifier")>(this, "FDinoAttackInfo.SwimmingAttackRunningSpeedModifier"); }
+	float& SetAttackTargetTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("FDinoAttackInfo.SetAttackTargetTime")>(this, "FDinoAttackInfo.SetAttackTargetTime"); }
+	TArray<FVector>& LastSocketPositionsField() { return *GetNativePointerField<TArray<FVector>*, API::FieldNameHash("FDinoAttackInfo.LastSocketPositions")>(this, "FDinoAttackInfo.LastSocketPositions"); }
+	long double& LastProjectileSpawnTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("FDinoAttackInfo.LastProjectileSpawnTime")>(this, "FDinoAttackInfo.LastProjectileSpawnTime"); }
 
 	// Functions
 
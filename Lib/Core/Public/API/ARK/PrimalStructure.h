@@ -2,29 +2,29 @@
 
 struct APrimalTargetableActor : AActor
 {
-	float& LowHealthPercentageField() { return *GetNativePointerField<float*>(this, "APrimalTargetableActor.LowHealthPercentage"); }
-	TSubclassOf<AActor>& DestructionActorTemplateField() { return *GetNativePointerField<TSubclassOf<AActor>*>(this, "APrimalTargetableActor.DestructionActorTemplate"); }
-	float& LifeSpanAfterDeathField() { return *GetNativePointerField<float*>(this, "APrimalTargetableActor.LifeSpanAfterDeath"); }
-	USoundCue * DeathSoundField() { return *GetNativePointerField<USoundCue **>(this, "APrimalTargetableActor.DeathSound"); }
-	float& PassiveDamageHealthReplicationPercentIntervalField() { return *GetNativePointerField<float*>(this, "APrimalTargetableActor.PassiveDamageHealthReplicationPercentInterval"); }
-	float& DamageNotifyTeamAggroMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalTargetableActor.DamageNotifyTeamAggroMultiplier"); }
-	float& DamageNotifyTeamAggroRangeField() { return *GetNativePointerField<float*>(this, "APrimalTargetableActor.DamageNotifyTeamAggroRange"); }
-	float& DamageNotifyTeamAggroRangeFalloffField() { return *GetNativePointerField<float*>(this, "APrimalTargetableActor.DamageNotifyTeamAggroRangeFalloff"); }
-	FVector& DestructibleMeshLocationOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalTargetableActor.DestructibleMeshLocationOffset"); }
-	FVector& DestructibleMeshScaleOverrideField() { return *GetNativePointerField<FVector*>(this, "APrimalTargetableActor.DestructibleMeshScaleOverride"); }
-	FRotator& DestructibleMeshRotationOffsetField() { return *GetNativePointerField<FRotator*>(this, "APrimalTargetableActor.DestructibleMeshRotationOffset"); }
-	FString& DescriptiveNameField() { return *GetNativePointerField<FString*>(this, "APrimalTargetableActor.DescriptiveName"); }
-	float& ReplicatedHealthField() { return *GetNativePointerField<float*>(this, "APrimalTargetableActor.ReplicatedHealth"); }
-	float& HealthField() { return *GetNativePointerField<float*>(this, "APrimalTargetableActor.Health"); }
-	float& MaxHealthField() { return *GetNativePointerField<float*>(this, "APrimalTargetableActor.MaxHealth"); }
-	float& DestructibleMeshDeathImpulseScaleField() { return *GetNativePointerField<float*>(this, "APrimalTargetableActor.DestructibleMeshDeathImpulseScale"); }
-	float& LastReplicatedHealthValueField() { return *GetNativePointerField<float*>(this, "APrimalTargetableActor.LastReplicatedHealthValue"); }
-	TEnumAsByte<enum EShooterPhysMaterialType::Type>& TargetableDamageFXDefaultPhysMaterialField() { return *GetNativePointerField<TEnumAsByte<enum EShooterPhysMaterialType::Type>*>(this, "APrimalTargetableActor.TargetableDamageFXDefaultPhysMaterial"); }
-	//UPrimalStructureSettings * MyStructureSettingsCDOField() { return *GetNativePointerField<UPrimalStructureSettings **>(this, "APrimalTargetableActor.MyStructureSettingsCDO"); }
-	float& LastHealthBeforeTakeDamageField() { return *GetNativePointerField<float*>(this, "APrimalTargetableActor.LastHealthBeforeTakeDamage"); }
-	long double& NextAllowRepairTimeField() { return *GetNativePointerField<long double*>(this, "APrimalTargetableActor.NextAllowRepairTime"); }
-	float& LastPreBlueprintAdjustmentActualDamageField() { return *GetNativePointerField<float*>(this, "APrimalTargetableActor.LastPreBlueprintAdjustmentActualDamage"); }
-	float& LastReplicatedHealthField() { return *GetNativePointerField<float*>(this, "APrimalTargetableActor.LastReplicatedHealth"); }
+	float& LowHealthPercentageField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalTargetableActor.LowHealthPercentage")>(this, "APrimalTargetableActor.LowHealthPercentage"); }
+	TSubclassOf<AActor>& DestructionActorTemplateField() { return *GetNativePointerField<TSubclassOf<AActor>*, API::FieldNameHash("APrimalTargetableActor.DestructionActorTemplate")>(this, "APrimalTargetableActor.DestructionActorTemplate"); }
+	float& LifeSpanAfterDeathField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalTargetableActor.LifeSpanAfterDeath")>(this, "APrimalTargetableActor.LifeSpanAfterDeath"); }
+	USoundCue * DeathSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("APrimalTargetableActor.DeathSound")>(this, "APrimalTargetableActor.DeathSound"); }
+	float& PassiveDamageHealthReplicationPercentIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalTargetableActor.PassiveDamageHealthReplicationPercentInterval")>(this, "APrimalTargetableActor.PassiveDamageHealthReplicationPercentInterval"); }
+	float& DamageNotifyTeamAggroMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalTargetableActor.DamageNotifyTeamAggroMultiplier")>(this, "APrimalTargetableActor.DamageNotifyTeamAggroMultiplier"); }
+	float& DamageNotifyTeamAggroRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalTargetableActor.DamageNotifyTeamAggroRange")>(this, "APrimalTargetableActor.DamageNotifyTeamAggroRange"); }
+	float& DamageNotifyTeamAggroRangeFalloffField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalTargetableActor.DamageNotifyTeamAggroRangeFalloff")>(this, "APrimalTargetableActor.DamageNotifyTeamAggroRangeFalloff"); }
+	FVector& DestructibleMeshLocationOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalTargetableActor.DestructibleMeshLocationOffset")>(this, "APrimalTargetableActor.DestructibleMeshLocationOffset"); }
+	FVector& DestructibleMeshScaleOverrideField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalTargetableActor.DestructibleMeshScaleOverride")>(this, "APrimalTargetableActor.DestructibleMeshScaleOverride"); }
+	FRotator& DestructibleMeshRotationOffsetField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalTargetableActor.DestructibleMeshRotationOffset")>(this, "APrimalTargetableActor.DestructibleMeshRotationOffset"); }
+	FString& DescriptiveNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalTargetableActor.DescriptiveName")>(this, "APrimalTargetableActor.DescriptiveName"); }
+	float& ReplicatedHealthField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalTargetableActor.ReplicatedHealth")>(this, "APrimalTargetableActor.ReplicatedHealth"); }
+	float& HealthField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalTargetableActor.Health")>(this, "APrimalTargetableActor.Health"); }
+	float& MaxHealthField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalTargetableActor.MaxHealth")>(this, "APrimalTargetableActor.MaxHealth"); }
+	float& DestructibleMeshDeathImpulseScaleField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalTargetableActor.DestructibleMeshDeathImpulseScale")>(this, "APrimalTargetableActor.DestructibleMeshDeathImpulseScale"); }
+	float& LastReplicatedHealthValueField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalTargetableActor.LastReplicatedHealthValue")>(this, "APrimalTargetableActor.LastReplicatedHealthValue"); }
+	TEnumAsByte<enum EShooterPhysMaterialType::Type>& TargetableDamageFXDefaultPhysMaterialField() { return *GetNativePointerField<TEnumAsByte<enum EShooterPhysMaterialType::Type>*, API::FieldNameHash("APrimalTargetableActor.TargetableDamageFXDefaultPhysMaterial")>(this, "APrimalTargetableActor.TargetableDamageFXDefaultPhysMaterial"); }
+	//UPrimalStructureSettings * MyStructureSettingsCDOField() { return *GetNativePointerField<UPrimalStructureSettings **, API::FieldNameHash("APrimalTargetableActor.MyStructureSettingsCDO")>(this, "APrimalTargetableActor.MyStructureSettingsCDO"); }
+	float& LastHealthBeforeTakeDamageField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalTargetableActor.LastHealthBeforeTakeDamage")>(this, "APrimalTargetableActor.LastHealthBeforeTakeDamage"); }
+	long double& NextAllowRepairTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalTargetableActor.NextAllowRepairTime")>(this, "APrimalTargetableActor.NextAllowRepairTime"); }
+	float& LastPreBlueprintAdjustmentActualDamageField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalTargetableActor.LastPreBlueprintAdjustmentActualDamage")>(this, "APrimalTargetableActor.LastPreBlueprintAdjustmentActualDamage"); }
+	float& LastReplicatedHealthField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalTargetableActor.LastReplicatedHealth")>(this, "APrimalTargetableActor.LastReplicatedHealth"); }
 
 	// Bit fields
 
@@ -89,130 +89,130 @@ struct APrimalTargetableActor : AActor
 
 struct APrimalStructure : APrimalTargetableActor
 {
-	FVector2D& OverlayTooltipPaddingField() { return *GetNativePointerField<FVector2D*>(this, "APrimalStructure.OverlayTooltipPadding"); }
-	FVector2D& OverlayTooltipScaleField() { return *GetNativePointerField<FVector2D*>(this, "APrimalStructure.OverlayTooltipScale"); }
-	TSubclassOf<UPrimalItem>& ConsumesPrimalItemField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "APrimalStructure.ConsumesPrimalItem"); }
-	float& ScaleFactorField() { return *GetNativePointerField<float*>(this, "APrimalStructure.ScaleFactor"); }
-	int& StructureSnapTypeFlagsField() { return *GetNativePointerField<int*>(this, "APrimalStructure.StructureSnapTypeFlags"); }
-	//TArray<FPrimalStructureSnapPoint>& SnapPointsField() { return *GetNativePointerField<TArray<FPrimalStructureSnapPoint>*>(this, "APrimalStructure.SnapPoints"); }
-	float& PlacementOffsetForVerticalGroundField() { return *GetNativePointerField<float*>(this, "APrimalStructure.PlacementOffsetForVerticalGround"); }
-	float& PlacementInitialTracePointOffsetForVerticalGroundField() { return *GetNativePointerField<float*>(this, "APrimalStructure.PlacementInitialTracePointOffsetForVerticalGround"); }
-	TArray<TSubclassOf<APrimalStructure>>& StructuresAllowedToBeVerticalGroundField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*>(this, "APrimalStructure.StructuresAllowedToBeVerticalGround"); }
-	float& TraceDistanceFromActorToWallVerticalGroundField() { return *GetNativePointerField<float*>(this, "APrimalStructure.TraceDistanceFromActorToWallVerticalGround"); }
-	FVector& PlacementHitLocOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalStructure.PlacementHitLocOffset"); }
-	FVector& PlacementEncroachmentCheckOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalStructure.PlacementEncroachmentCheckOffset"); }
-	FVector& PlacementEncroachmentBoxExtentField() { return *GetNativePointerField<FVector*>(this, "APrimalStructure.PlacementEncroachmentBoxExtent"); }
-	FVector& PlacementTraceScaleField() { return *GetNativePointerField<FVector*>(this, "APrimalStructure.PlacementTraceScale"); }
-	FVector& SnapAlternatePlacementTraceScaleField() { return *GetNativePointerField<FVector*>(this, "APrimalStructure.SnapAlternatePlacementTraceScale"); }
-	FRotator& PlacementRotOffsetField() { return *GetNativePointerField<FRotator*>(this, "APrimalStructure.PlacementRotOffset"); }
-	FRotator& PlacementTraceRotOffsetField() { return *GetNativePointerField<FRotator*>(this, "APrimalStructure.PlacementTraceRotOffset"); }
-	FRotator& SnappingRotationOffsetField() { return *GetNativePointerField<FRotator*>(this, "APrimalStructure.SnappingRotationOffset"); }
-	float& RepairAmountRemainingField() { return *GetNativePointerField<float*>(this, "APrimalStructure.RepairAmountRemaining"); }
-	float& RepairCheckIntervalField() { return *GetNativePointerField<float*>(this, "APrimalStructure.RepairCheckInterval"); }
-	float& PlacementFloorCheckZExtentUpField() { return *GetNativePointerField<float*>(this, "APrimalStructure.PlacementFloorCheckZExtentUp"); }
-	float& RepairPercentPerIntervalField() { return *GetNativePointerField<float*>(this, "APrimalStructure.RepairPercentPerInterval"); }
-	float& DecayDestructionPeriodField() { return *GetNativePointerField<float*>(this, "APrimalStructure.DecayDestructionPeriod"); }
-	TArray<TSubclassOf<APrimalStructure>>& PreventPlacingOnFloorClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*>(this, "APrimalStructure.PreventPlacingOnFloorClasses"); }
-	TArray<TSubclassOf<APrimalStructure>>& AllowPlacingOnFloorClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*>(this, "APrimalStructure.AllowPlacingOnFloorClasses"); }
-	TSubobjectPtr<USceneComponent>& MyRootTransformField() { return *GetNativePointerField<TSubobjectPtr<USceneComponent>*>(this, "APrimalStructure.MyRootTransform"); }
-	int& TraceIgnoreStructuresWithTypeFlagsField() { return *GetNativePointerField<int*>(this, "APrimalStructure.TraceIgnoreStructuresWithTypeFlags"); }
-	int& bTraceCheckOnlyUseStructuresWithTypeFlagsField() { return *GetNativePointerField<int*>(this, "APrimalStructure.bTraceCheckOnlyUseStructuresWithTypeFlags"); }
+	FVector2D& OverlayTooltipPaddingField() { return *GetNativePointerField<FVector2D*, API::FieldNameHash("APrimalStructure.OverlayTooltipPadding")>(this, "APrimalStructure.OverlayTooltipPadding"); }
+	FVector2D& OverlayTooltipScaleField() { return *GetNativePointerField<FVector2D*, API::FieldNameHash("APrimalStructure.OverlayTooltipScale")>(this, "APrimalStructure.OverlayTooltipScale"); }
+	TSubclassOf<UPrimalItem>& ConsumesPrimalItemField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("APrimalStructure.ConsumesPrimalItem")>(this, "APrimalStructure.ConsumesPrimalItem"); }
+	float& ScaleFactorField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.ScaleFactor")>(this, "APrimalStructure.ScaleFactor"); }
+	int& StructureSnapTypeFlagsField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructure.StructureSnapTypeFlags")>(this, "APrimalStructure.StructureSnapTypeFlags"); }
+	//TArray<FPrimalStructureSnapPoint>& SnapPointsField() { return *GetNativePointerField<TArray<FPrimalStructureSnapPoint>*, API::FieldNameHash("APrimalStructure.SnapPoints")>(this, "APrimalStructure.SnapPoints"); }
+	float& PlacementOffsetForVerticalGroundField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.PlacementOffsetForVerticalGround")>(this, "APrimalStructure.PlacementOffsetForVerticalGround"); }
+	float& PlacementInitialTracePointOffsetForVerticalGroundField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.PlacementInitialTracePointOffsetForVerticalGround")>(this, "APrimalStructure.PlacementInitialTracePointOffsetForVerticalGround"); }
+	TArray<TSubclassOf<APrimalStructure>>& StructuresAllowedToBeVerticalGroundField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*, API::FieldNameHash("APrimalStructure.StructuresAllowedToBeVerticalGround")>(this, "APrimalStructure.StructuresAllowedToBeVerticalGround"); }
+	float& TraceDistanceFromActorToWallVerticalGroundField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.TraceDistanceFromActorToWallVerticalGround")>(this, "APrimalStructure.TraceDistanceFromActorToWallVerticalGround"); }
+	FVector& PlacementHitLocOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalStructure.PlacementHitLocOffset")>(this, "APrimalStructure.PlacementHitLocOffset"); }
+	FVector& PlacementEncroachmentCheckOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalStructure.PlacementEncroachmentCheckOffset")>(this, "APrimalStructure.PlacementEncroachmentCheckOffset"); }
+	FVector& PlacementEncroachmentBoxExtentField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalStructure.PlacementEncroachmentBoxExtent")>(this, "APrimalStructure.PlacementEncroachmentBoxExtent"); }
+	FVector& PlacementTraceScaleField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalStructure.PlacementTraceScale")>(this, "APrimalStructure.PlacementTraceScale"); }
+	FVector& SnapAlternatePlacementTraceScaleField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalStructure.SnapAlternatePlacementTraceScale")>(this, "APrimalStructure.SnapAlternatePlacementTraceScale"); }
+	FRotator& PlacementRotOffsetField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalStructure.PlacementRotOffset")>(this, "APrimalStructure.PlacementRotOffset"); }
+	FRotator& PlacementTraceRotOffsetField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalStructure.PlacementTraceRotOffset")>(this, "APrimalStructure.PlacementTraceRotOffset"); }
+	FRotator& SnappingRotationOffsetField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalStructure.SnappingRotationOffset")>(this, "APrimalStructure.SnappingRotationOffset"); }
+	float& RepairAmountRemainingField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.RepairAmountRemaining")>(this, "APrimalStructure.RepairAmountRemaining"); }
+	float& RepairCheckIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.RepairCheckInterval")>(this, "APrimalStructure.RepairCheckInterval"); }
+	float& PlacementFloorCheckZExtentUpField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.PlacementFloorCheckZExtentUp")>(this, "APrimalStructure.PlacementFloorCheckZExtentUp"); }
+	float& RepairPercentPerIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.RepairPercentPerInterval")>(this, "APrimalStructure.RepairPercentPerInterval"); }
+	float& DecayDestructionPeriodField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.DecayDestructionPeriod")>(this, "APrimalStructure.DecayDestructionPeriod"); }
+	TArray<TSubclassOf<APrimalStructure>>& PreventPlacingOnFloorClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*, API::FieldNameHash("APrimalStructure.PreventPlacingOnFloorClasses")>(this, "APrimalStructure.PreventPlacingOnFloorClasses"); }
+	TArray<TSubclassOf<APrimalStructure>>& AllowPlacingOnFloorClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*, API::FieldNameHash("APrimalStructure.AllowPlacingOnFloorClasses")>(this, "APrimalStructure.AllowPlacingOnFloorClasses"); }
+	TSubobjectPtr<USceneComponent>& MyRootTransformField() { return *GetNativePointerField<TSubobjectPtr<USceneComponent>*, API::FieldNameHash("APrimalStructure.MyRootTransform")>(this, "APrimalStructure.MyRootTransform"); }
+	int& TraceIgnoreStructuresWithTypeFlagsField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructure.TraceIgnoreStructuresWithTypeFlags")>(this, "APrimalStructure.TraceIgnoreStructuresWithTypeFlags"); }
+	int& bTraceCheckOnlyUseStructuresWithTypeFlagsField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructure.bTraceCheckOnlyUseStructuresWithTypeFlags")>(this, "APrimalStructure.bTraceCheckOnlyUseStructuresWithTypeFlags"); }
 	FieldArray<char, 6> AllowStructureColorSetsField() { return { this, "APrimalStructure.AllowStructureColorSets" }; }
-	FVector& WaterVolumeCheckPointOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalStructure.WaterVolumeCheckPointOffset"); }
-	float& WaterPlacementMinimumWaterHeightField() { return *GetNativePointerField<float*>(this, "APrimalStructure.WaterPlacementMinimumWaterHeight"); }
-	float& PlacementMaxZDeltaField() { return *GetNativePointerField<float*>(this, "APrimalStructure.PlacementMaxZDelta"); }
-	float& PlacementChooseRotationMaxRangeOverrideField() { return *GetNativePointerField<float*>(this, "APrimalStructure.PlacementChooseRotationMaxRangeOverride"); }
-	float& PlacementMaxRangeField() { return *GetNativePointerField<float*>(this, "APrimalStructure.PlacementMaxRange"); }
-	float& MaxSnapLocRangeField() { return *GetNativePointerField<float*>(this, "APrimalStructure.MaxSnapLocRange"); }
-	float& SnapOverlapCheckRadiusField() { return *GetNativePointerField<float*>(this, "APrimalStructure.SnapOverlapCheckRadius"); }
-	float& MaximumFoundationSupport2DBuildDistanceField() { return *GetNativePointerField<float*>(this, "APrimalStructure.MaximumFoundationSupport2DBuildDistance"); }
-	float& PlacementFloorCheckZExtentField() { return *GetNativePointerField<float*>(this, "APrimalStructure.PlacementFloorCheckZExtent"); }
-	float& LastHealthPercentageField() { return *GetNativePointerField<float*>(this, "APrimalStructure.LastHealthPercentage"); }
-	FRotator& TakeGroundNormalRotationOffsetField() { return *GetNativePointerField<FRotator*>(this, "APrimalStructure.TakeGroundNormalRotationOffset"); }
-	float& DemolishGiveItemCraftingResourcePercentageField() { return *GetNativePointerField<float*>(this, "APrimalStructure.DemolishGiveItemCraftingResourcePercentage"); }
-	TSubclassOf<APrimalStructure>& AllowReplacementByStructureClassTypeField() { return *GetNativePointerField<TSubclassOf<APrimalStructure>*>(this, "APrimalStructure.AllowReplacementByStructureClassType"); }
-	TSubclassOf<APrimalStructure>& PreventReplacementOfStructureClassTypeField() { return *GetNativePointerField<TSubclassOf<APrimalStructure>*>(this, "APrimalStructure.PreventReplacementOfStructureClassType"); }
-	float& MaximumHeightAboveWorldGroundField() { return *GetNativePointerField<float*>(this, "APrimalStructure.MaximumHeightAboveWorldGround"); }
-	float& MaximumHeightUnderWorldMaxKillZField() { return *GetNativePointerField<float*>(this, "APrimalStructure.MaximumHeightUnderWorldMaxKillZ"); }
-	FRotator& PreviewCameraRotationField() { return *GetNativePointerField<FRotator*>(this, "APrimalStructure.PreviewCameraRotation"); }
-	FVector& PreviewCameraPivotOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalStructure.PreviewCameraPivotOffset"); }
-	float& PreviewCameraDistanceScaleFactorField() { return *GetNativePointerField<float*>(this, "APrimalStructure.PreviewCameraDistanceScaleFactor"); }
-	float& PreviewCameraDefaultZoomMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalStructure.PreviewCameraDefaultZoomMultiplier"); }
-	float& PreviewCameraMaxZoomMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalStructure.PreviewCameraMaxZoomMultiplier"); }
-	float& ReturnDamageAmountField() { return *GetNativePointerField<float*>(this, "APrimalStructure.ReturnDamageAmount"); }
-	int& StructureRangeTypeFlagField() { return *GetNativePointerField<int*>(this, "APrimalStructure.StructureRangeTypeFlag"); }
-	int& LimitMaxStructuresInRangeTypeFlagField() { return *GetNativePointerField<int*>(this, "APrimalStructure.LimitMaxStructuresInRangeTypeFlag"); }
-	float& ReturnDamageImpulseField() { return *GetNativePointerField<float*>(this, "APrimalStructure.ReturnDamageImpulse"); }
-	TSubclassOf<UDamageType>& ReturnDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*>(this, "APrimalStructure.ReturnDamageType"); }
-	TArray<TSubclassOf<UDamageType>>& ReturnDamageExcludeIncomingTypesField() { return *GetNativePointerField<TArray<TSubclassOf<UDamageType>>*>(this, "APrimalStructure.ReturnDamageExcludeIncomingTypes"); }
-	TArray<TSubclassOf<UDamageType>>& ReturnDamageOnlyForIncomingTypesField() { return *GetNativePointerField<TArray<TSubclassOf<UDamageType>>*>(this, "APrimalStructure.ReturnDamageOnlyForIncomingTypes"); }
-	int& OwningPlayerIDField() { return *GetNativePointerField<int*>(this, "APrimalStructure.OwningPlayerID"); }
-	FString& OwningPlayerNameField() { return *GetNativePointerField<FString*>(this, "APrimalStructure.OwningPlayerName"); }
-	long double& LastInAllyRangeTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructure.LastInAllyRangeTime"); }
-	float& DecayDestructionPeriodMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalStructure.DecayDestructionPeriodMultiplier"); }
-	TWeakObjectPtr<APrimalDinoCharacter>& SaddleDinoField() { return *GetNativePointerField<TWeakObjectPtr<APrimalDinoCharacter>*>(this, "APrimalStructure.SaddleDino"); }
-	TArray<APrimalDinoCharacter *> LatchedDinosField() { return *GetNativePointerField<TArray<APrimalDinoCharacter *>*>(this, "APrimalStructure.LatchedDinos"); }
-	UMaterialInterface * PreviewMaterialField() { return *GetNativePointerField<UMaterialInterface **>(this, "APrimalStructure.PreviewMaterial"); }
-	FName& PreviewMaterialColorParamNameField() { return *GetNativePointerField<FName*>(this, "APrimalStructure.PreviewMaterialColorParamName"); }
-	TArray<FVector>& PlacementTraceDirectionsField() { return *GetNativePointerField<TArray<FVector>*>(this, "APrimalStructure.PlacementTraceDirections"); }
-	TArray<APrimalStructure *> LinkedStructuresField() { return *GetNativePointerField<TArray<APrimalStructure *>*>(this, "APrimalStructure.LinkedStructures"); }
-	TArray<unsigned int>& LinkedStructuresIDField() { return *GetNativePointerField<TArray<unsigned int>*>(this, "APrimalStructure.LinkedStructuresID"); }
-	TArray<APrimalStructure *> StructuresPlacedOnFloorField() { return *GetNativePointerField<TArray<APrimalStructure *>*>(this, "APrimalStructure.StructuresPlacedOnFloor"); }
-	TArray<TSubclassOf<APrimalStructure>>& SnapToStructureTypesToExcludeField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*>(this, "APrimalStructure.SnapToStructureTypesToExclude"); }
-	TArray<TSubclassOf<APrimalStructure>>& SnapFromStructureTypesToExcludeField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*>(this, "APrimalStructure.SnapFromStructureTypesToExclude"); }
-	APrimalStructure * PlacedOnFloorStructureField() { return *GetNativePointerField<APrimalStructure **>(this, "APrimalStructure.PlacedOnFloorStructure"); }
-	APrimalStructure * PrimarySnappedStructureChildField() { return *GetNativePointerField<APrimalStructure **>(this, "APrimalStructure.PrimarySnappedStructureChild"); }
-	APrimalStructure * PrimarySnappedStructureParentField() { return *GetNativePointerField<APrimalStructure **>(this, "APrimalStructure.PrimarySnappedStructureParent"); }
-	FString& OwnerNameField() { return *GetNativePointerField<FString*>(this, "APrimalStructure.OwnerName"); }
+	FVector& WaterVolumeCheckPointOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalStructure.WaterVolumeCheckPointOffset")>(this, "APrimalStructure.WaterVolumeCheckPointOffset"); }
+	float& WaterPlacementMinimumWaterHeightField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.WaterPlacementMinimumWaterHeight")>(this, "APrimalStructure.WaterPlacementMinimumWaterHeight"); }
+	float& PlacementMaxZDeltaField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.PlacementMaxZDelta")>(this, "APrimalStructure.PlacementMaxZDelta"); }
+	float& PlacementChooseRotationMaxRangeOverrideField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.PlacementChooseRotationMaxRangeOverride")>(this, "APrimalStructure.PlacementChooseRotationMaxRangeOverride"); }
+	float& PlacementMaxRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.PlacementMaxRange")>(this, "APrimalStructure.PlacementMaxRange"); }
+	float& MaxSnapLocRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.MaxSnapLocRange")>(this, "APrimalStructure.MaxSnapLocRange"); }
+	float& SnapOverlapCheckRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.SnapOverlapCheckRadius")>(this, "APrimalStructure.SnapOverlapCheckRadius"); }
+	float& MaximumFoundationSupport2DBuildDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.MaximumFoundationSupport2DBuildDistance")>(this, "APrimalStructure.MaximumFoundationSupport2DBuildDistance"); }
+	float& PlacementFloorCheckZExtentField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.PlacementFloorCheckZExtent")>(this, "APrimalStructure.PlacementFloorCheckZExtent"); }
+	float& LastHealthPercentageField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.LastHealthPercentage")>(this, "APrimalStructure.LastHealthPercentage"); }
+	FRotator& TakeGroundNormalRotationOffsetField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalStructure.TakeGroundNormalRotationOffset")>(this, "APrimalStructure.TakeGroundNormalRotationOffset"); }
+	float& DemolishGiveItemCraftingResourcePercentageField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.DemolishGiveItemCraftingResourcePercentage")>(this, "APrimalStructure.DemolishGiveItemCraftingResourcePercentage"); }
+	TSubclassOf<APrimalStructure>& AllowReplacementByStructureClassTypeField() { return *GetNativePointerField<TSubclassOf<APrimalStructure>*, API::FieldNameHash("APrimalStructure.AllowReplacementByStructureClassType")>(this, "APrimalStructure.AllowReplacementByStructureClassType"); }
+	TSubclassOf<APrimalStructure>& PreventReplacementOfStructureClassTypeField() { return *GetNativePointerField<TSubclassOf<APrimalStructure>*, API::FieldNameHash("APrimalStructure.PreventReplacementOfStructureClassType")>(this, "APrimalStructure.PreventReplacementOfStructureClassType"); }
+	float& MaximumHeightAboveWorldGroundField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.MaximumHeightAboveWorldGround")>(this, "APrimalStructure.MaximumHeightAboveWorldGround"); }
+	float& MaximumHeightUnderWorldMaxKillZField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.MaximumHeightUnderWorldMaxKillZ")>(this, "APrimalStructure.MaximumHeightUnderWorldMaxKillZ"); }
+	FRotator& PreviewCameraRotationField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalStructure.PreviewCameraRotation")>(this, "APrimalStructure.PreviewCameraRotation"); }
+	FVector& PreviewCameraPivotOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalStructure.PreviewCameraPivotOffset")>(this, "APrimalStructure.PreviewCameraPivotOffset"); }
+	float& PreviewCameraDistanceScaleFactorField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.PreviewCameraDistanceScaleFactor")>(this, "APrimalStructure.PreviewCameraDistanceScaleFactor"); }
+	float& PreviewCameraDefaultZoomMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.PreviewCameraDefaultZoomMultiplier")>(this, "APrimalStructure.PreviewCameraDefaultZoomMultiplier"); }
+	float& PreviewCameraMaxZoomMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.PreviewCameraMaxZoomMultiplier")>(this, "APrimalStructure.PreviewCameraMaxZoomMultiplier"); }
+	float& ReturnDamageAmountField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.ReturnDamageAmount")>(this, "APrimalStructure.ReturnDamageAmount"); }
+	int& StructureRangeTypeFlagField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructure.StructureRangeTypeFlag")>(this, "APrimalStructure.StructureRangeTypeFlag"); }
+	int& LimitMaxStructuresInRangeTypeFlagField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructure.LimitMaxStructuresInRangeTypeFlag")>(this, "APrimalStructure.LimitMaxStructuresInRangeTypeFlag"); }
+	float& ReturnDamageImpulseField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.ReturnDamageImpulse")>(this, "APrimalStructure.ReturnDamageImpulse"); }
+	TSubclassOf<UDamageType>& ReturnDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*, API::FieldNameHash("APrimalStructure.ReturnDamageType")>(this, "APrimalStructure.ReturnDamageType"); }
+	TArray<TSubclassOf<UDamageType>>& ReturnDamageExcludeIncomingTypesField() { return *GetNativePointerField<TArray<TSubclassOf<UDamageType>>*, API::FieldNameHash("APrimalStructure.ReturnDamageExcludeIncomingTypes")>(this, "APrimalStructure.ReturnDamageExcludeIncomingTypes"); }
+	TArray<TSubclassOf<UDamageType>>& ReturnDamageOnlyForIncomingTypesField() { return *GetNativePointerField<TArray<TSubclassOf<UDamageType>>*, API::FieldNameHash("APrimalStructure.ReturnDamageOnlyForIncomingTypes")>(this, "APrimalStructure.ReturnDamageOnlyForIncomingTypes"); }
+	int& OwningPlayerIDField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructure.OwningPlayerID")>(this, "APrimalStructure.OwningPlayerID"); }
+	FString& OwningPlayerNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalStructure.OwningPlayerName")>(this, "APrimalStructure.OwningPlayerName"); }
+	long double& LastInAllyRangeTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructure.LastInAllyRangeTime")>(this, "APrimalStructure.LastInAllyRangeTime"); }
+	float& DecayDestructionPeriodMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.DecayDestructionPeriodMultiplier")>(this, "APrimalStructure.DecayDestructionPeriodMultiplier"); }
+	TWeakObjectPtr<APrimalDinoCharacter>& SaddleDinoField() { return *GetNativePointerField<TWeakObjectPtr<APrimalDinoCharacter>*, API::FieldNameHash("APrimalStructure.SaddleDino")>(this, "APrimalStructure.SaddleDino"); }
+	TArray<APrimalDinoCharacter *> LatchedDinosField() { return *GetNativePointerField<TArray<APrimalDinoCharacter *>*, API::FieldNameHash("APrimalStructure.LatchedDinos")>(this, "APrimalStructure.LatchedDinos"); }
+	UMaterialInterface * PreviewMaterialField() { return *GetNativePointerField<UMaterialInterface **, API::FieldNameHash("APrimalStructure.PreviewMaterial")>(this, "APrimalStructure.PreviewMaterial"); }
+	FName& PreviewMaterialColorParamNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalStructure.PreviewMaterialColorParamName")>(this, "APrimalStructure.PreviewMaterialColorParamName"); }
+	TArray<FVector>& PlacementTraceDirectionsField() { return *GetNativePointerField<TArray<FVector>*, API::FieldNameHash("APrimalStructure.PlacementTraceDirections")>(this, "APrimalStructure.PlacementTraceDirections"); }
+	TArray<APrimalStructure *> LinkedStructuresField() { return *GetNativePointerField<TArray<APrimalStructure *>*, API::FieldNameHash("APrimalStructure.LinkedStructures")>(this, "APrimalStructure.LinkedStructures"); }
+	TArray<unsigned int>& LinkedStructuresIDField() { return *GetNativePointerField<TArray<unsigned int>*, API::FieldNameHash("APrimalStructure.LinkedStructuresID")>(this, "APrimalStructure.LinkedStructuresID"); }
+	TArray<APrimalStructure *> StructuresPlacedOnFloorField() { return *GetNativePointerField<TArray<APrimalStructure *>*, API::FieldNameHash("APrimalStructure.StructuresPlacedOnFloor")>(this, "APrimalStructure.StructuresPlacedOnFloor"); }
+	TArray<TSubclassOf<APrimalStructure>>& SnapToStructureTypesToExcludeField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*, API::FieldNameHash("APrimalStructure.SnapToStructureTypesToExclude")>(this, "APrimalStructure.SnapToStructureTypesToExclude"); }
+	TArray<TSubclassOf<APrimalStructure>>& SnapFromStructureTypesToExcludeField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*, API::FieldNameHash("APrimalStructure.SnapFromStructureTypesToExclude")>(this, "APrimalStructure.SnapFromStructureTypesToExclude"); }
+	APrimalStructure * PlacedOnFloorStructureField() { return *GetNativePointerField<APrimalStructure **, API::FieldNameHash("APrimalStructure.PlacedOnFloorStructure")>(this, "APrimalStructure.PlacedOnFloorStructure"); }
+	APrimalStructure * PrimarySnappedStructureChildField() { return *GetNativePointerField<APrimalStructure **, API::FieldNameHash("APrimalStructure.PrimarySnappedStructureChild")>(this, "APrimalStructure.PrimarySnappedStructureChild"); }
+	APrimalStructure * PrimarySnappedStructureParentField() { return *GetNativePointerField<APrimalStructure **, API::FieldNameHash("APrimalStructure.PrimarySnappedStructureParent")>(this, "APrimalStructure.PrimarySnappedStructureParent"); }
+	FString& OwnerNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalStructure.OwnerName")>(this, "APrimalStructure.OwnerName"); }
 	FieldArray<__int16, 6> StructureColorsField() { return { this, "APrimalStructure.StructureColors" }; }
-	APawn * AttachedToField() { return *GetNativePointerField<APawn **>(this, "APrimalStructure.AttachedTo"); }
-	APrimalStructureExplosiveTransGPS * AttachedTransponderField() { return *GetNativePointerField<APrimalStructureExplosiveTransGPS **>(this, "APrimalStructure.AttachedTransponder"); }
-	unsigned int& StructureIDField() { return *GetNativePointerField<unsigned int*>(this, "APrimalStructure.StructureID"); }
-	unsigned int& AttachedToDinoID1Field() { return *GetNativePointerField<unsigned int*>(this, "APrimalStructure.AttachedToDinoID1"); }
-	TArray<TSubclassOf<APrimalStructure>>& OnlyAllowStructureClassesToAttachField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*>(this, "APrimalStructure.OnlyAllowStructureClassesToAttach"); }
-	TArray<TSubclassOf<APrimalStructure>>& OnlyAllowStructureClassesFromAttachField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*>(this, "APrimalStructure.OnlyAllowStructureClassesFromAttach"); }
-	unsigned int& TaggedIndexField() { return *GetNativePointerField<unsigned int*>(this, "APrimalStructure.TaggedIndex"); }
-	unsigned int& TaggedIndexTwoField() { return *GetNativePointerField<unsigned int*>(this, "APrimalStructure.TaggedIndexTwo"); }
-	unsigned int& ProcessTreeTagField() { return *GetNativePointerField<unsigned int*>(this, "APrimalStructure.ProcessTreeTag"); }
-	long double& LastStructureStasisTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructure.LastStructureStasisTime"); }
-	long double& LastColorizationTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructure.LastColorizationTime"); }
-	UMaterialInterface * StructureIconMaterialField() { return *GetNativePointerField<UMaterialInterface **>(this, "APrimalStructure.StructureIconMaterial"); }
-	FVector& SpawnEmitterLocationOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalStructure.SpawnEmitterLocationOffset"); }
-	FRotator& SpawnEmitterRotationOffsetField() { return *GetNativePointerField<FRotator*>(this, "APrimalStructure.SpawnEmitterRotationOffset"); }
-	TSubclassOf<UPrimalItem>& PickupGivesItemField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "APrimalStructure.PickupGivesItem"); }
-	float& ExcludeInStructuresRadiusField() { return *GetNativePointerField<float*>(this, "APrimalStructure.ExcludeInStructuresRadius"); }
-	TArray<TSubclassOf<APrimalStructure>>& ExcludeInStructuresRadiusClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*>(this, "APrimalStructure.ExcludeInStructuresRadiusClasses"); }
-	float& LastFadeOpacityField() { return *GetNativePointerField<float*>(this, "APrimalStructure.LastFadeOpacity"); }
-	bool& bClientAddedToStructuresArrayField() { return *GetNativePointerField<bool*>(this, "APrimalStructure.bClientAddedToStructuresArray"); }
-	long double& LastFailedPinTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructure.LastFailedPinTime"); }
-	TArray<FString>& PreventBuildStructureReasonStringOverridesField() { return *GetNativePointerField<TArray<FString>*>(this, "APrimalStructure.PreventBuildStructureReasonStringOverrides"); }
-	FVector& FloatingHudLocTextOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalStructure.FloatingHudLocTextOffset"); }
-	float& LastBumpedDamageTimeField() { return *GetNativePointerField<float*>(this, "APrimalStructure.LastBumpedDamageTime"); }
-	int& ForceLimitStructuresInRangeField() { return *GetNativePointerField<int*>(this, "APrimalStructure.ForceLimitStructuresInRange"); }
-	int& PlacementMaterialForwardDirIndexField() { return *GetNativePointerField<int*>(this, "APrimalStructure.PlacementMaterialForwardDirIndex"); }
-	float& ForcePreventPlacingInOfflineRaidStructuresRadiusField() { return *GetNativePointerField<float*>(this, "APrimalStructure.ForcePreventPlacingInOfflineRaidStructuresRadius"); }
-	FName& AttachToStaticMeshSocketNameBaseField() { return *GetNativePointerField<FName*>(this, "APrimalStructure.AttachToStaticMeshSocketNameBase"); }
-	TSubclassOf<AActor>& ItemsUseAlternateActorClassAttachmentField() { return *GetNativePointerField<TSubclassOf<AActor>*>(this, "APrimalStructure.ItemsUseAlternateActorClassAttachment"); }
-	float& UnstasisAutoDestroyAfterTimeField() { return *GetNativePointerField<float*>(this, "APrimalStructure.UnstasisAutoDestroyAfterTime"); }
-	char& TribeGroupStructureRankField() { return *GetNativePointerField<char*>(this, "APrimalStructure.TribeGroupStructureRank"); }
-	char& TribeRankHUDYOffsetField() { return *GetNativePointerField<char*>(this, "APrimalStructure.TribeRankHUDYOffset"); }
-	TArray<TSubclassOf<APrimalDinoCharacter>>& PreventSaddleDinoClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalDinoCharacter>>*>(this, "APrimalStructure.PreventSaddleDinoClasses"); }
-	TArray<TSubclassOf<APrimalDinoCharacter>>& AllowSaddleDinoClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalDinoCharacter>>*>(this, "APrimalStructure.AllowSaddleDinoClasses"); }
-	FName& PlaceOnWallUseStaticMeshTagField() { return *GetNativePointerField<FName*>(this, "APrimalStructure.PlaceOnWallUseStaticMeshTag"); }
-	TSubclassOf<APrimalStructure>& SnapStructureClassField() { return *GetNativePointerField<TSubclassOf<APrimalStructure>*>(this, "APrimalStructure.SnapStructureClass"); }
-	float& DemolishActivationTimeField() { return *GetNativePointerField<float*>(this, "APrimalStructure.DemolishActivationTime"); }
-	FVector& GroundEncroachmentCheckLocationOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalStructure.GroundEncroachmentCheckLocationOffset"); }
-	int& StructureMinAllowedVersionField() { return *GetNativePointerField<int*>(this, "APrimalStructure.StructureMinAllowedVersion"); }
-	int& SavedStructureMinAllowedVersionField() { return *GetNativePointerField<int*>(this, "APrimalStructure.SavedStructureMinAllowedVersion"); }
-	float& OverrideEnemyFoundationPreventionRadiusField() { return *GetNativePointerField<float*>(this, "APrimalStructure.OverrideEnemyFoundationPreventionRadius"); }
-	float& ExpandEnemyFoundationPreventionRadiusField() { return *GetNativePointerField<float*>(this, "APrimalStructure.ExpandEnemyFoundationPreventionRadius"); }
-	int& BedIDField() { return *GetNativePointerField<int*>(this, "APrimalStructure.BedID"); }
-	TArray<TSubclassOf<APrimalStructure>>& ForceAllowWallAttachmentClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*>(this, "APrimalStructure.ForceAllowWallAttachmentClasses"); }
-	float& LimitMaxStructuresInRangeRadiusField() { return *GetNativePointerField<float*>(this, "APrimalStructure.LimitMaxStructuresInRangeRadius"); }
-	TArray<TSubclassOf<APrimalStructure>>& FastDecayLinkedStructureClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*>(this, "APrimalStructure.FastDecayLinkedStructureClasses"); }
-	float& PlacementMaxZAbovePlayerHeightField() { return *GetNativePointerField<float*>(this, "APrimalStructure.PlacementMaxZAbovePlayerHeight"); }
-	TArray<USceneComponent *> OverrideTargetComponentsField() { return *GetNativePointerField<TArray<USceneComponent *>*>(this, "APrimalStructure.OverrideTargetComponents"); }
-	float& OverrideApproachRadiusField() { return *GetNativePointerField<float*>(this, "APrimalStructure.OverrideApproachRadius"); }
+	APawn * AttachedToField() { return *GetNativePointerField<APawn **, API::FieldNameHash("APrimalStructure.AttachedTo")>(this, "APrimalStructure.AttachedTo"); }
+	APrimalStructureExplosiveTransGPS * AttachedTransponderField() { return *GetNativePointerField<APrimalStructureExplosiveTransGPS **, API::FieldNameHash("APrimalStructure.AttachedTransponder")>(this, "APrimalStructure.AttachedTransponder"); }
+	unsigned int& StructureIDField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("APrimalStructure.StructureID")>(this, "APrimalStructure.StructureID"); }
+	unsigned int& AttachedToDinoID1Field() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("APrimalStructure.AttachedToDinoID1")>(this, "APrimalStructure.AttachedToDinoID1"); }
+	TArray<TSubclassOf<APrimalStructure>>& OnlyAllowStructureClassesToAttachField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*, API::FieldNameHash("APrimalStructure.OnlyAllowStructureClassesToAttach")>(this, "APrimalStructure.OnlyAllowStructureClassesToAttach"); }
+	TArray<TSubclassOf<APrimalStructure>>& OnlyAllowStructureClassesFromAttachField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*, API::FieldNameHash("APrimalStructure.OnlyAllowStructureClassesFromAttach")>(this, "APrimalStructure.OnlyAllowStructureClassesFromAttach"); }
+	unsigned int& TaggedIndexField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("APrimalStructure.TaggedIndex")>(this, "APrimalStructure.TaggedIndex"); }
+	unsigned int& TaggedIndexTwoField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("APrimalStructure.TaggedIndexTwo")>(this, "APrimalStructure.TaggedIndexTwo"); }
+	unsigned int& ProcessTreeTagField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("APrimalStructure.ProcessTreeTag")>(this, "APrimalStructure.ProcessTreeTag"); }
+	long double& LastStructureStasisTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructure.LastStructureStasisTime")>(this, "APrimalStructure.LastStructureStasisTime"); }
+	long double& LastColorizationTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructure.LastColorizationTime")>(this, "APrimalStructure.LastColorizationTime"); }
+	UMaterialInterface * StructureIconMaterialField() { return *GetNativePointerField<UMaterialInterface **, API::FieldNameHash("APrimalStructure.StructureIconMaterial")>(this, "APrimalStructure.StructureIconMaterial"); }
+	FVector& SpawnEmitterLocationOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalStructure.SpawnEmitterLocationOffset")>(this, "APrimalStructure.SpawnEmitterLocationOffset"); }
+	FRotator& SpawnEmitterRotationOffsetField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalStructure.SpawnEmitterRotationOffset")>(this, "APrimalStructure.SpawnEmitterRotationOffset"); }
+	TSubclassOf<UPrimalItem>& PickupGivesItemField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("APrimalStructure.PickupGivesItem")>(this, "APrimalStructure.PickupGivesItem"); }
+	float& ExcludeInStructuresRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.ExcludeInStructuresRadius")>(this, "APrimalStructure.ExcludeInStructuresRadius"); }
+	TArray<TSubclassOf<APrimalStructure>>& ExcludeInStructuresRadiusClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*, API::FieldNameHash("APrimalStructure.ExcludeInStructuresRadiusClasses")>(this, "APrimalStructure.ExcludeInStructuresRadiusClasses"); }
+	float& LastFadeOpacityField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.LastFadeOpacity")>(this, "APrimalStructure.LastFadeOpacity"); }
+	bool& bClientAddedToStructuresArrayField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalStructure.bClientAddedToStructuresArray")>(this, "APrimalStructure.bClientAddedToStructuresArray"); }
+	long double& LastFailedPinTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructure.LastFailedPinTime")>(this, "APrimalStructure.LastFailedPinTime"); }
+	TArray<FString>& PreventBuildStructureReasonStringOverridesField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("APrimalStructure.PreventBuildStructureReasonStringOverrides")>(this, "APrimalStructure.PreventBuildStructureReasonStringOverrides"); }
+	FVector& FloatingHudLocTextOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalStructure.FloatingHudLocTextOffset")>(this, "APrimalStructure.FloatingHudLocTextOffset"); }
+	float& LastBumpedDamageTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.LastBumpedDamageTime")>(this, "APrimalStructure.LastBumpedDamageTime"); }
+	int& ForceLimitStructuresInRangeField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructure.ForceLimitStructuresInRange")>(this, "APrimalStructure.ForceLimitStructuresInRange"); }
+	int& PlacementMaterialForwardDirIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructure.PlacementMaterialForwardDirIndex")>(this, "APrimalStructure.PlacementMaterialForwardDirIndex"); }
+	float& ForcePreventPlacingInOfflineRaidStructuresRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.ForcePreventPlacingInOfflineRaidStructuresRadius")>(this, "APrimalStructure.ForcePreventPlacingInOfflineRaidStructuresRadius"); }
+	FName& AttachToStaticMeshSocketNameBaseField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalStructure.AttachToStaticMeshSocketNameBase")>(this, "APrimalStructure.AttachToStaticMeshSocketNameBase"); }
+	TSubclassOf<AActor>& ItemsUseAlternateActorClassAttachmentField() { return *GetNativePointerField<TSubclassOf<AActor>*, API::FieldNameHash("APrimalStructure.ItemsUseAlternateActorClassAttachment")>(this, "APrimalStructure.ItemsUseAlternateActorClassAttachment"); }
+	float& UnstasisAutoDestroyAfterTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.UnstasisAutoDestroyAfterTime")>(this, "APrimalStructure.UnstasisAutoDestroyAfterTime"); }
+	char& TribeGroupStructureRankField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalStructure.TribeGroupStructureRank")>(this, "APrimalStructure.TribeGroupStructureRank"); }
+	char& TribeRankHUDYOffsetField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalStructure.TribeRankHUDYOffset")>(this, "APrimalStructure.TribeRankHUDYOffset"); }
+	TArray<TSubclassOf<APrimalDinoCharacter>>& PreventSaddleDinoClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalDinoCharacter>>*, API::FieldNameHash("APrimalStructure.PreventSaddleDinoClasses")>(this, "APrimalStructure.PreventSaddleDinoClasses"); }
+	TArray<TSubclassOf<APrimalDinoCharacter>>& AllowSaddleDinoClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalDinoCharacter>>*, API::FieldNameHash("APrimalStructure.AllowSaddleDinoClasses")>(this, "APrimalStructure.AllowSaddleDinoClasses"); }
+	FName& PlaceOnWallUseStaticMeshTagField() { return *GetNativePointerField<FName*, API::FieldNameHash("APrimalStructure.PlaceOnWallUseStaticMeshTag")>(this, "APrimalStructure.PlaceOnWallUseStaticMeshTag"); }
+	TSubclassOf<APrimalStructure>& SnapStructureClassField() { return *GetNativePointerField<TSubclassOf<APrimalStructure>*, API::FieldNameHash("APrimalStructure.SnapStructureClass")>(this, "APrimalStructure.SnapStructureClass"); }
+	float& DemolishActivationTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.DemolishActivationTime")>(this, "APrimalStructure.DemolishActivationTime"); }
+	FVector& GroundEncroachmentCheckLocationOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalStructure.GroundEncroachmentCheckLocationOffset")>(this, "APrimalStructure.GroundEncroachmentCheckLocationOffset"); }
+	int& StructureMinAllowedVersionField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructure.StructureMinAllowedVersion")>(this, "APrimalStructure.StructureMinAllowedVersion"); }
+	int& SavedStructureMinAllowedVersionField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructure.SavedStructureMinAllowedVersion")>(this, "APrimalStructure.SavedStructureMinAllowedVersion"); }
+	float& OverrideEnemyFoundationPreventionRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.OverrideEnemyFoundationPreventionRadius")>(this, "APrimalStructure.OverrideEnemyFoundationPreventionRadius"); }
+	float& ExpandEnemyFoundationPreventionRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.ExpandEnemyFoundationPreventionRadius")>(this, "APrimalStructure.ExpandEnemyFoundationPreventionRadius"); }
+	int& BedIDField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructure.BedID")>(this, "APrimalStructure.BedID"); }
+	TArray<TSubclassOf<APrimalStructure>>& ForceAllowWallAttachmentClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*, API::FieldNameHash("APrimalStructure.ForceAllowWallAttachmentClasses")>(this, "APrimalStructure.ForceAllowWallAttachmentClasses"); }
+	float& LimitMaxStructuresInRangeRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.LimitMaxStructuresInRangeRadius")>(this, "APrimalStructure.LimitMaxStructuresInRangeRadius"); }
+	TArray<TSubclassOf<APrimalStructure>>& FastDecayLinkedStructureClassesField() { return *GetNativePointerField<TArray<TSubclassOf<APrimalStructure>>*, API::FieldNameHash("APrimalStructure.FastDecayLinkedStructureClasses")>(this, "APrimalStructure.FastDecayLinkedStructureClasses"); }
+	float& PlacementMaxZAbovePlayerHeightField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.PlacementMaxZAbovePlayerHeight")>(this, "APrimalStructure.PlacementMaxZAbovePlayerHeight"); }
+	TArray<USceneComponent *> OverrideTargetComponentsField() { return *GetNativePointerField<TArray<USceneComponent *>*, API::FieldNameHash("APrimalStructure.OverrideTargetComponents")>(this, "APrimalStructure.OverrideTargetComponents"); }
+	float& OverrideApproachRadiusField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructure.OverrideApproachRadius")>(this, "APrimalStructure.OverrideApproachRadius"); }
 
 	// Bit fields
 
@@ -491,23 +491,23 @@ struct APrimalStructure : APrimalTargetableActor
 
 struct APrimalStructureDoor : APrimalStructure
 {
-	TSubobjectPtr<USceneComponent>& MyDoorTransformField() { return *GetNativePointerField<TSubobjectPtr<USceneComponent>*>(this, "APrimalStructureDoor.MyDoorTransform"); }
-	float& RotationSpeedField() { return *GetNativePointerField<float*>(this, "APrimalStructureDoor.RotationSpeed"); }
-	USoundCue * DoorOpenSoundField() { return *GetNativePointerField<USoundCue **>(this, "APrimalStructureDoor.DoorOpenSound"); }
-	USoundCue * DoorCloseSoundField() { return *GetNativePointerField<USoundCue **>(this, "APrimalStructureDoor.DoorCloseSound"); }
-	unsigned int& CurrentPinCodeField() { return *GetNativePointerField<unsigned int*>(this, "APrimalStructureDoor.CurrentPinCode"); }
-	float& DoorStateChangeIgnoreEncroachmentIntervalField() { return *GetNativePointerField<float*>(this, "APrimalStructureDoor.DoorStateChangeIgnoreEncroachmentInterval"); }
-	char& DoorOpenStateField() { return *GetNativePointerField<char*>(this, "APrimalStructureDoor.DoorOpenState"); }
-	char& ClientPrevDoorOpenStateField() { return *GetNativePointerField<char*>(this, "APrimalStructureDoor.ClientPrevDoorOpenState"); }
-	long double& LastLockStateChangeTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructureDoor.LastLockStateChangeTime"); }
-	FRotator& SecondDoorDefaultRotField() { return *GetNativePointerField<FRotator*>(this, "APrimalStructureDoor.SecondDoorDefaultRot"); }
-	float& CurrentDoorAngleField() { return *GetNativePointerField<float*>(this, "APrimalStructureDoor.CurrentDoorAngle"); }
-	USoundBase * UnlockDoorSoundField() { return *GetNativePointerField<USoundBase **>(this, "APrimalStructureDoor.UnlockDoorSound"); }
-	USoundBase * LockDoorSoundField() { return *GetNativePointerField<USoundBase **>(this, "APrimalStructureDoor.LockDoorSound"); }
-	USoundBase * LockedSoundField() { return *GetNativePointerField<USoundBase **>(this, "APrimalStructureDoor.LockedSound"); }
-	long double& LastPinOpenSuccessTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructureDoor.LastPinOpenSuccessTime"); }
-	long double& LastDoorStateChangeTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructureDoor.LastDoorStateChangeTime"); }
-	char& DelayedDoorStateField() { return *GetNativePointerField<char*>(this, "APrimalStructureDoor.DelayedDoorState"); }
+	TSubobjectPtr<USceneComponent>& MyDoorTransformField() { return *GetNativePointerField<TSubobjectPtr<USceneComponent>*, API::FieldNameHash("APrimalStructureDoor.MyDoorTransform")>(this, "APrimalStructureDoor.MyDoorTransform"); }
+	float& RotationSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureDoor.RotationSpeed")>(this, "APrimalStructureDoor.RotationSpeed"); }
+	USoundCue * DoorOpenSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("APrimalStructureDoor.DoorOpenSound")>(this, "APrimalStructureDoor.DoorOpenSound"); }
+	USoundCue * DoorCloseSoundField() { return *GetNativePointerField<USoundCue **, API::FieldNameHash("APrimalStructureDoor.DoorCloseSound")>(this, "APrimalStructureDoor.DoorCloseSound"); }
+	unsigned int& CurrentPinCodeField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("APrimalStructureDoor.CurrentPinCode")>(this, "APrimalStructureDoor.CurrentPinCode"); }
+	float& DoorStateChangeIgnoreEncroachmentIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureDoor.DoorStateChangeIgnoreEncroachmentInterval")>(this, "APrimalStructureDoor.DoorStateChangeIgnoreEncroachmentInterval"); }
+	char& DoorOpenStateField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalStructureDoor.DoorOpenState")>(this, "APrimalStructureDoor.DoorOpenState"); }
+	char& ClientPrevDoorOpenStateField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalStructureDoor.ClientPrevDoorOpenState")>(this, "APrimalStructureDoor.ClientPrevDoorOpenState"); }
+	long double& LastLockStateChangeTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructureDoor.LastLockStateChangeTime")>(this, "APrimalStructureDoor.LastLockStateChangeTime"); }
+	FRotator& SecondDoorDefaultRotField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalStructureDoor.SecondDoorDefaultRot")>(this, "APrimalStructureDoor.SecondDoorDefaultRot"); }
+	float& CurrentDoorAngleField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureDoor.CurrentDoorAngle")>(this, "APrimalStructureDoor.CurrentDoorAngle"); }
+	USoundBase * UnlockDoorSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("APrimalStructureDoor.UnlockDoorSound")>(this, "APrimalStructureDoor.UnlockDoorSound"); }
+	USoundBase * LockDoorSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("APrimalStructureDoor.LockDoorSound")>(this, "APrimalStructureDoor.LockDoorSound"); }
+	USoundBase * LockedSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("APrimalStructureDoor.LockedSound")>(this, "APrimalStructureDoor.LockedSound"); }
+	long double& LastPinOpenSuccessTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructureDoor.LastPinOpenSuccessTime")>(this, "APrimalStructureDoor.LastPinOpenSuccessTime"); }
+	long double& LastDoorStateChangeTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructureDoor.LastDoorStateChangeTime")>(this, "APrimalStructureDoor.LastDoorStateChangeTime"); }
+	char& DelayedDoorStateField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalStructureDoor.DelayedDoorState")>(this, "APrimalStructureDoor.DelayedDoorState"); }
 
 	// Bit fields
 
@@ -557,83 +557,83 @@ struct APrimalStructureDoor : APrimalStructure
 
 struct APrimalStructureItemContainer : APrimalStructure
 {
-	UPrimalInventoryComponent * MyInventoryComponentField() { return *GetNativePointerField<UPrimalInventoryComponent **>(this, "APrimalStructureItemContainer.MyInventoryComponent"); }
-	float& SolarRefreshIntervalMinField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.SolarRefreshIntervalMin"); }
-	float& SolarRefreshIntervalMaxField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.SolarRefreshIntervalMax"); }
-	float& SolarRefreshIntervalField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.SolarRefreshInterval"); }
-	long double& LastSolarRefreshTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructureItemContainer.LastSolarRefreshTime"); }
-	TSubclassOf<UPrimalItem>& BatteryClassOverrideField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "APrimalStructureItemContainer.BatteryClassOverride"); }
-	int& PoweredOverrideCounterField() { return *GetNativePointerField<int*>(this, "APrimalStructureItemContainer.PoweredOverrideCounter"); }
-	float& NotifyNearbyPowerGeneratorDistanceField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.NotifyNearbyPowerGeneratorDistance"); }
-	int& NotifyNearbyPowerGeneratorOctreeGroupField() { return *GetNativePointerField<int*>(this, "APrimalStructureItemContainer.NotifyNearbyPowerGeneratorOctreeGroup"); }
-	TArray<UMaterialInterface *> ActivateMaterialsField() { return *GetNativePointerField<TArray<UMaterialInterface *>*>(this, "APrimalStructureItemContainer.ActivateMaterials"); }
-	TArray<UMaterialInterface *> InActivateMaterialsField() { return *GetNativePointerField<TArray<UMaterialInterface *>*>(this, "APrimalStructureItemContainer.InActivateMaterials"); }
-	FString& BoxNameField() { return *GetNativePointerField<FString*>(this, "APrimalStructureItemContainer.BoxName"); }
-	float& InsulationRangeField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.InsulationRange"); }
-	float& HyperThermiaInsulationField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.HyperThermiaInsulation"); }
-	float& HypoThermiaInsulationField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.HypoThermiaInsulation"); }
-	float& ContainerActiveDecreaseHealthSpeedField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.ContainerActiveDecreaseHealthSpeed"); }
-	float& FuelConsumptionIntervalsMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.FuelConsumptionIntervalsMultiplier"); }
-	float& DropInventoryOnDestructionLifespanField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.DropInventoryOnDestructionLifespan"); }
-	FString& ActivateContainerStringField() { return *GetNativePointerField<FString*>(this, "APrimalStructureItemContainer.ActivateContainerString"); }
-	FString& DeactivateContainerStringField() { return *GetNativePointerField<FString*>(this, "APrimalStructureItemContainer.DeactivateContainerString"); }
-	TSubclassOf<UDamageType>& ContainerActiveHealthDecreaseDamageTypePassiveField() { return *GetNativePointerField<TSubclassOf<UDamageType>*>(this, "APrimalStructureItemContainer.ContainerActiveHealthDecreaseDamageTypePassive"); }
-	TArray<TSubclassOf<UPrimalItem>>& ActiveRequiresFuelItemsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "APrimalStructureItemContainer.ActiveRequiresFuelItems"); }
-	TArray<float>& FuelItemsConsumeIntervalField() { return *GetNativePointerField<TArray<float>*>(this, "APrimalStructureItemContainer.FuelItemsConsumeInterval"); }
-	TArray<TSubclassOf<UPrimalItem>>& FuelItemsConsumedGiveItemsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "APrimalStructureItemContainer.FuelItemsConsumedGiveItems"); }
-	long double& NetDestructionTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructureItemContainer.NetDestructionTime"); }
-	unsigned int& CurrentPinCodeField() { return *GetNativePointerField<unsigned int*>(this, "APrimalStructureItemContainer.CurrentPinCode"); }
-	long double& CurrentFuelTimeCacheField() { return *GetNativePointerField<long double*>(this, "APrimalStructureItemContainer.CurrentFuelTimeCache"); }
-	long double& LastCheckedFuelTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructureItemContainer.LastCheckedFuelTime"); }
-	int& LinkedPowerJunctionStructureIDField() { return *GetNativePointerField<int*>(this, "APrimalStructureItemContainer.LinkedPowerJunctionStructureID"); }
-	int& CurrentItemCountField() { return *GetNativePointerField<int*>(this, "APrimalStructureItemContainer.CurrentItemCount"); }
-	int& MaxItemCountField() { return *GetNativePointerField<int*>(this, "APrimalStructureItemContainer.MaxItemCount"); }
-	TWeakObjectPtr<APrimalStructure>& LinkedPowerJunctionStructureField() { return *GetNativePointerField<TWeakObjectPtr<APrimalStructure>*>(this, "APrimalStructureItemContainer.LinkedPowerJunctionStructure"); }
-	TSubclassOf<UPrimalItem>& NextConsumeFuelGiveItemTypeField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "APrimalStructureItemContainer.NextConsumeFuelGiveItemType"); }
-	long double& LastLockStateChangeTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructureItemContainer.LastLockStateChangeTime"); }
-	long double& LastActiveStateChangeTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructureItemContainer.LastActiveStateChangeTime"); }
-	int& LastPowerJunctionLinkIDField() { return *GetNativePointerField<int*>(this, "APrimalStructureItemContainer.LastPowerJunctionLinkID"); }
-	float& BasedCharacterDamageIntervalField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.BasedCharacterDamageInterval"); }
-	float& BasedCharacterDamageAmountField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.BasedCharacterDamageAmount"); }
-	TSubclassOf<UDamageType>& BasedCharacterDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*>(this, "APrimalStructureItemContainer.BasedCharacterDamageType"); }
-	TSubclassOf<UPrimalItem>& EngramRequirementClassOverrideField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "APrimalStructureItemContainer.EngramRequirementClassOverride"); }
-	AActor * LinkedBlueprintSpawnActorPointField() { return *GetNativePointerField<AActor **>(this, "APrimalStructureItemContainer.LinkedBlueprintSpawnActorPoint"); }
-	TSubclassOf<APrimalStructureItemContainer>& PoweredNearbyStructureTemplateField() { return *GetNativePointerField<TSubclassOf<APrimalStructureItemContainer>*>(this, "APrimalStructureItemContainer.PoweredNearbyStructureTemplate"); }
-	float& PoweredNearbyStructureRangeField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.PoweredNearbyStructureRange"); }
-	FString& OpenSceneActionNameField() { return *GetNativePointerField<FString*>(this, "APrimalStructureItemContainer.OpenSceneActionName"); }
-	FString& DisabledOpenSceneActionNameField() { return *GetNativePointerField<FString*>(this, "APrimalStructureItemContainer.DisabledOpenSceneActionName"); }
-	TSubclassOf<UPrimalItem>& RequiresItemForOpenSceneActionField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "APrimalStructureItemContainer.RequiresItemForOpenSceneAction"); }
-	long double& DeathCacheCreationTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructureItemContainer.DeathCacheCreationTime"); }
-	long double& LastBasedCharacterDamageTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructureItemContainer.LastBasedCharacterDamageTime"); }
-	int& LastBasedCharacterDamageFrameField() { return *GetNativePointerField<int*>(this, "APrimalStructureItemContainer.LastBasedCharacterDamageFrame"); }
-	long double& LastSignNamingTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructureItemContainer.LastSignNamingTime"); }
-	FVector& JunctionCableBeamOffsetStartField() { return *GetNativePointerField<FVector*>(this, "APrimalStructureItemContainer.JunctionCableBeamOffsetStart"); }
-	FVector& JunctionCableBeamOffsetEndField() { return *GetNativePointerField<FVector*>(this, "APrimalStructureItemContainer.JunctionCableBeamOffsetEnd"); }
-	USoundBase * ContainerActivatedSoundField() { return *GetNativePointerField<USoundBase **>(this, "APrimalStructureItemContainer.ContainerActivatedSound"); }
-	USoundBase * ContainerDeactivatedSoundField() { return *GetNativePointerField<USoundBase **>(this, "APrimalStructureItemContainer.ContainerDeactivatedSound"); }
-	TSubclassOf<APrimalStructureItemContainer>& DemolishInventoryDepositClassField() { return *GetNativePointerField<TSubclassOf<APrimalStructureItemContainer>*>(this, "APrimalStructureItemContainer.DemolishInventoryDepositClass"); }
-	TSubclassOf<UPrimalItem>& FuelItemTrueClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "APrimalStructureItemContainer.FuelItemTrueClass"); }
-	TSubclassOf<UPrimalItem>& ReplicatedFuelItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "APrimalStructureItemContainer.ReplicatedFuelItemClass"); }
-	__int16& ReplicatedFuelItemColorIndexField() { return *GetNativePointerField<__int16*>(this, "APrimalStructureItemContainer.ReplicatedFuelItemColorIndex"); }
-	USoundBase * DefaultAudioTemplateField() { return *GetNativePointerField<USoundBase **>(this, "APrimalStructureItemContainer.DefaultAudioTemplate"); }
-	TArray<TSubclassOf<UPrimalItem>>& OverrideParticleTemplateItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*>(this, "APrimalStructureItemContainer.OverrideParticleTemplateItemClasses"); }
-	TArray<USoundBase *> OverrideAudioTemplatesField() { return *GetNativePointerField<TArray<USoundBase *>*>(this, "APrimalStructureItemContainer.OverrideAudioTemplates"); }
-	float& MaxActivationDistanceField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.MaxActivationDistance"); }
-	FString& BoxNamePrefaceStringField() { return *GetNativePointerField<FString*>(this, "APrimalStructureItemContainer.BoxNamePrefaceString"); }
-	char& TribeGroupInventoryRankField() { return *GetNativePointerField<char*>(this, "APrimalStructureItemContainer.TribeGroupInventoryRank"); }
-	TArray<float>& FuelConsumeDecreaseDurabilityAmountsField() { return *GetNativePointerField<TArray<float>*>(this, "APrimalStructureItemContainer.FuelConsumeDecreaseDurabilityAmounts"); }
-	float& RandomFuelUpdateTimeMinField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.RandomFuelUpdateTimeMin"); }
-	float& RandomFuelUpdateTimeMaxField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.RandomFuelUpdateTimeMax"); }
-	long double& LastDeactivatedTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructureItemContainer.LastDeactivatedTime"); }
-	long double& LastActivatedTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructureItemContainer.LastActivatedTime"); }
-	float& ValidCraftingResourceMaxDurabilityField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.ValidCraftingResourceMaxDurability"); }
-	float& ActivationCooldownTimeField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.ActivationCooldownTime"); }
-	float& UsablePriorityField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.UsablePriority"); }
-	unsigned __int64& DeathCacheCharacterIDField() { return *GetNativePointerField<unsigned __int64*>(this, "APrimalStructureItemContainer.DeathCacheCharacterID"); }
-	float& SinglePlayerFuelConsumptionIntervalsMultiplierField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.SinglePlayerFuelConsumptionIntervalsMultiplier"); }
-	float& PoweredBatteryDurabilityToDecreasePerSecondField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.PoweredBatteryDurabilityToDecreasePerSecond"); }
-	float& DropInventoryDepositTraceDistanceField() { return *GetNativePointerField<float*>(this, "APrimalStructureItemContainer.DropInventoryDepositTraceDistance"); }
-	TArray<TWeakObjectPtr<AShooterPlayerController>>& ValidatedByPinCodePlayerControllersField() { return *GetNativePointerField<TArray<TWeakObjectPtr<AShooterPlayerController>>*>(this, "APrimalStructureItemContainer.ValidatedByPinCodePlayerControllers"); }
+	UPrimalInventoryComponent * MyInventoryComponentField() { return *GetNativePointerField<UPrimalInventoryComponent **, API::FieldNameHash("APrimalStructureItemContainer.MyInventoryComponent")>(this, "APrimalStructureItemContainer.MyInventoryComponent"); }
+	float& SolarRefreshIntervalMinField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.SolarRefreshIntervalMin")>(this, "APrimalStructureItemContainer.SolarRefreshIntervalMin"); }
+	float& SolarRefreshIntervalMaxField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.SolarRefreshIntervalMax")>(this, "APrimalStructureItemContainer.SolarRefreshIntervalMax"); }
+	float& SolarRefreshIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.SolarRefreshInterval")>(this, "APrimalStructureItemContainer.SolarRefreshInterval"); }
+	long double& LastSolarRefreshTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructureItemContainer.LastSolarRefreshTime")>(this, "APrimalStructureItemContainer.LastSolarRefreshTime"); }
+	TSubclassOf<UPrimalItem>& BatteryClassOverrideField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("APrimalStructureItemContainer.BatteryClassOverride")>(this, "APrimalStructureItemContainer.BatteryClassOverride"); }
+	int& PoweredOverrideCounterField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructureItemContainer.PoweredOverrideCounter")>(this, "APrimalStructureItemContainer.PoweredOverrideCounter"); }
+	float& NotifyNearbyPowerGeneratorDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.NotifyNearbyPowerGeneratorDistance")>(this, "APrimalStructureItemContainer.NotifyNearbyPowerGeneratorDistance"); }
+	int& NotifyNearbyPowerGeneratorOctreeGroupField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructureItemContainer.NotifyNearbyPowerGeneratorOctreeGroup")>(this, "APrimalStructureItemContainer.NotifyNearbyPowerGeneratorOctreeGroup"); }
+	TArray<UMaterialInterface *> ActivateMaterialsField() { return *GetNativePointerField<TArray<UMaterialInterface *>*, API::FieldNameHash("APrimalStructureItemContainer.ActivateMaterials")>(this, "APrimalStructureItemContainer.ActivateMaterials"); }
+	TArray<UMaterialInterface *> InActivateMaterialsField() { return *GetNativePointerField<TArray<UMaterialInterface *>*, API::FieldNameHash("APrimalStructureItemContainer.InActivateMaterials")>(this, "APrimalStructureItemContainer.InActivateMaterials"); }
+	FString& BoxNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalStructureItemContainer.BoxName")>(this, "APrimalStructureItemContainer.BoxName"); }
+	float& InsulationRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.InsulationRange")>(this, "APrimalStructureItemContainer.InsulationRange"); }
+	float& HyperThermiaInsulationField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.HyperThermiaInsulation")>(this, "APrimalStructureItemContainer.HyperThermiaInsulation"); }
+	float& HypoThermiaInsulationField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.HypoThermiaInsulation")>(this, "APrimalStructureItemContainer.HypoThermiaInsulation"); }
+	float& ContainerActiveDecreaseHealthSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.ContainerActiveDecreaseHealthSpeed")>(this, "APrimalStructureItemContainer.ContainerActiveDecreaseHealthSpeed"); }
+	float& FuelConsumptionIntervalsMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.FuelConsumptionIntervalsMultiplier")>(this, "APrimalStructureItemContainer.FuelConsumptionIntervalsMultiplier"); }
+	float& DropInventoryOnDestructionLifespanField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.DropInventoryOnDestructionLifespan")>(this, "APrimalStructureItemContainer.DropInventoryOnDestructionLifespan"); }
+	FString& ActivateContainerStringField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalStructureItemContainer.ActivateContainerString")>(this, "APrimalStructureItemContainer.ActivateContainerString"); }
+	FString& DeactivateContainerStringField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalStructureItemContainer.DeactivateContainerString")>(this, "APrimalStructureItemContainer.DeactivateContainerString"); }
+	TSubclassOf<UDamageType>& ContainerActiveHealthDecreaseDamageTypePassiveField() { return *GetNativePointerField<TSubclassOf<UDamageType>*, API::FieldNameHash("APrimalStructureItemContainer.ContainerActiveHealthDecreaseDamageTypePassive")>(this, "APrimalStructureItemContainer.ContainerActiveHealthDecreaseDamageTypePassive"); }
+	TArray<TSubclassOf<UPrimalItem>>& ActiveRequiresFuelItemsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("APrimalStructureItemContainer.ActiveRequiresFuelItems")>(this, "APrimalStructureItemContainer.ActiveRequiresFuelItems"); }
+	TArray<float>& FuelItemsConsumeIntervalField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("APrimalStructureItemContainer.FuelItemsConsumeInterval")>(this, "APrimalStructureItemContainer.FuelItemsConsumeInterval"); }
+	TArray<TSubclassOf<UPrimalItem>>& FuelItemsConsumedGiveItemsField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("APrimalStructureItemContainer.FuelItemsConsumedGiveItems")>(this, "APrimalStructureItemContainer.FuelItemsConsumedGiveItems"); }
+	long double& NetDestructionTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructureItemContainer.NetDestructionTime")>(this, "APrimalStructureItemContainer.NetDestructionTime"); }
+	unsigned int& CurrentPinCodeField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("APrimalStructureItemContainer.CurrentPinCode")>(this, "APrimalStructureItemContainer.CurrentPinCode"); }
+	long double& CurrentFuelTimeCacheField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructureItemContainer.CurrentFuelTimeCache")>(this, "APrimalStructureItemContainer.CurrentFuelTimeCache"); }
+	long double& LastCheckedFuelTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructureItemContainer.LastCheckedFuelTime")>(this, "APrimalStructureItemContainer.LastCheckedFuelTime"); }
+	int& LinkedPowerJunctionStructureIDField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructureItemContainer.LinkedPowerJunctionStructureID")>(this, "APrimalStructureItemContainer.LinkedPowerJunctionStructureID"); }
+	int& CurrentItemCountField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructureItemContainer.CurrentItemCount")>(this, "APrimalStructureItemContainer.CurrentItemCount"); }
+	int& MaxItemCountField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructureItemContainer.MaxItemCount")>(this, "APrimalStructureItemContainer.MaxItemCount"); }
+	TWeakObjectPtr<APrimalStructure>& LinkedPowerJunctionStructureField() { return *GetNativePointerField<TWeakObjectPtr<APrimalStructure>*, API::FieldNameHash("APrimalStructureItemContainer.LinkedPowerJunctionStructure")>(this, "APrimalStructureItemContainer.LinkedPowerJunctionStructure"); }
+	TSubclassOf<UPrimalItem>& NextConsumeFuelGiveItemTypeField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("APrimalStructureItemContainer.NextConsumeFuelGiveItemType")>(this, "APrimalStructureItemContainer.NextConsumeFuelGiveItemType"); }
+	long double& LastLockStateChangeTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructureItemContainer.LastLockStateChangeTime")>(this, "APrimalStructureItemContainer.LastLockStateChangeTime"); }
+	long double& LastActiveStateChangeTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructureItemContainer.LastActiveStateChangeTime")>(this, "APrimalStructureItemContainer.LastActiveStateChangeTime"); }
+	int& LastPowerJunctionLinkIDField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructureItemContainer.LastPowerJunctionLinkID")>(this, "APrimalStructureItemContainer.LastPowerJunctionLinkID"); }
+	float& BasedCharacterDamageIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.BasedCharacterDamageInterval")>(this, "APrimalStructureItemContainer.BasedCharacterDamageInterval"); }
+	float& BasedCharacterDamageAmountField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.BasedCharacterDamageAmount")>(this, "APrimalStructureItemContainer.BasedCharacterDamageAmount"); }
+	TSubclassOf<UDamageType>& BasedCharacterDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*, API::FieldNameHash("APrimalStructureItemContainer.BasedCharacterDamageType")>(this, "APrimalStructureItemContainer.BasedCharacterDamageType"); }
+	TSubclassOf<UPrimalItem>& EngramRequirementClassOverrideField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("APrimalStructureItemContainer.EngramRequirementClassOverride")>(this, "APrimalStructureItemContainer.EngramRequirementClassOverride"); }
+	AActor * LinkedBlueprintSpawnActorPointField() { return *GetNativePointerField<AActor **, API::FieldNameHash("APrimalStructureItemContainer.LinkedBlueprintSpawnActorPoint")>(this, "APrimalStructureItemContainer.LinkedBlueprintSpawnActorPoint"); }
+	TSubclassOf<APrimalStructureItemContainer>& PoweredNearbyStructureTemplateField() { return *GetNativePointerField<TSubclassOf<APrimalStructureItemContainer>*, API::FieldNameHash("APrimalStructureItemContainer.PoweredNearbyStructureTemplate")>(this, "APrimalStructureItemContainer.PoweredNearbyStructureTemplate"); }
+	float& PoweredNearbyStructureRangeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.PoweredNearbyStructureRange")>(this, "APrimalStructureItemContainer.PoweredNearbyStructureRange"); }
+	FString& OpenSceneActionNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalStructureItemContainer.OpenSceneActionName")>(this, "APrimalStructureItemContainer.OpenSceneActionName"); }
+	FString& DisabledOpenSceneActionNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalStructureItemContainer.DisabledOpenSceneActionName")>(this, "APrimalStructureItemContainer.DisabledOpenSceneActionName"); }
+	TSubclassOf<UPrimalItem>& RequiresItemForOpenSceneActionField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("APrimalStructureItemContainer.RequiresItemForOpenSceneAction")>(this, "APrimalStructureItemContainer.RequiresItemForOpenSceneAction"); }
+	long double& DeathCacheCreationTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructureItemContainer.DeathCacheCreationTime")>(this, "APrimalStructureItemContainer.DeathCacheCreationTime"); }
+	long double& LastBasedCharacterDamageTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructureItemContainer.LastBasedCharacterDamageTime")>(this, "APrimalStructureItemContainer.LastBasedCharacterDamageTime"); }
+	int& LastBasedCharacterDamageFrameField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructureItemContainer.LastBasedCharacterDamageFrame")>(this, "APrimalStructureItemContainer.LastBasedCharacterDamageFrame"); }
+	long double& LastSignNamingTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructureItemContainer.LastSignNamingTime")>(this, "APrimalStructureItemContainer.LastSignNamingTime"); }
+	FVector& JunctionCableBeamOffsetStartField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalStructureItemContainer.JunctionCableBeamOffsetStart")>(this, "APrimalStructureItemContainer.JunctionCableBeamOffsetStart"); }
+	FVector& JunctionCableBeamOffsetEndField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalStructureItemContainer.JunctionCableBeamOffsetEnd")>(this, "APrimalStructureItemContainer.JunctionCableBeamOffsetEnd"); }
+	USoundBase * ContainerActivatedSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("APrimalStructureItemContainer.ContainerActivatedSound")>(this, "APrimalStructureItemContainer.ContainerActivatedSound"); }
+	USoundBase * ContainerDeactivatedSoundField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("APrimalStructureItemContainer.ContainerDeactivatedSound")>(this, "APrimalStructureItemContainer.ContainerDeactivatedSound"); }
+	TSubclassOf<APrimalStructureItemContainer>& DemolishInventoryDepositClassField() { return *GetNativePointerField<TSubclassOf<APrimalStructureItemContainer>*, API::FieldNameHash("APrimalStructureItemContainer.DemolishInventoryDepositClass")>(this, "APrimalStructureItemContainer.DemolishInventoryDepositClass"); }
+	TSubclassOf<UPrimalItem>& FuelItemTrueClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("APrimalStructureItemContainer.FuelItemTrueClass")>(this, "APrimalStructureItemContainer.FuelItemTrueClass"); }
+	TSubclassOf<UPrimalItem>& ReplicatedFuelItemClassField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("APrimalStructureItemContainer.ReplicatedFuelItemClass")>(this, "APrimalStructureItemContainer.ReplicatedFuelItemClass"); }
+	__int16& ReplicatedFuelItemColorIndexField() { return *GetNativePointerField<__int16*, API::FieldNameHash("APrimalStructureItemContainer.ReplicatedFuelItemColorIndex")>(this, "APrimalStructureItemContainer.ReplicatedFuelItemColorIndex"); }
+	USoundBase * DefaultAudioTemplateField() { return *GetNativePointerField<USoundBase **, API::FieldNameHash("APrimalStructureItemContainer.DefaultAudioTemplate")>(this, "APrimalStructureItemContainer.DefaultAudioTemplate"); }
+	TArray<TSubclassOf<UPrimalItem>>& OverrideParticleTemplateItemClassesField() { return *GetNativePointerField<TArray<TSubclassOf<UPrimalItem>>*, API::FieldNameHash("APrimalStructureItemContainer.OverrideParticleTemplateItemClasses")>(this, "APrimalStructureItemContainer.OverrideParticleTemplateItemClasses"); }
+	TArray<USoundBase *> OverrideAudioTemplatesField() { return *GetNativePointerField<TArray<USoundBase *>*, API::FieldNameHash("APrimalStructureItemContainer.OverrideAudioTemplates")>(this, "APrimalStructureItemContainer.OverrideAudioTemplates"); }
+	float& MaxActivationDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.MaxActivationDistance")>(this, "APrimalStructureItemContainer.MaxActivationDistance"); }
+	FString& BoxNamePrefaceStringField() { return *GetNativePointerField<FString*, API::FieldNameHash("APrimalStructureItemContainer.BoxNamePrefaceString")>(this, "APrimalStructureItemContainer.BoxNamePrefaceString"); }
+	char& TribeGroupInventoryRankField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalStructureItemContainer.TribeGroupInventoryRank")>(this, "APrimalStructureItemContainer.TribeGroupInventoryRank"); }
+	TArray<float>& FuelConsumeDecreaseDurabilityAmountsField() { return *GetNativePointerField<TArray<float>*, API::FieldNameHash("APrimalStructureItemContainer.FuelConsumeDecreaseDurabilityAmounts")>(this, "APrimalStructureItemContainer.FuelConsumeDecreaseDurabilityAmounts"); }
+	float& RandomFuelUpdateTimeMinField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.RandomFuelUpdateTimeMin")>(this, "APrimalStructureItemContainer.RandomFuelUpdateTimeMin"); }
+	float& RandomFuelUpdateTimeMaxField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.RandomFuelUpdateTimeMax")>(this, "APrimalStructureItemContainer.RandomFuelUpdateTimeMax"); }
+	long double& LastDeactivatedTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructureItemContainer.LastDeactivatedTime")>(this, "APrimalStructureItemContainer.LastDeactivatedTime"); }
+	long double& LastActivatedTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructureItemContainer.LastActivatedTime")>(this, "APrimalStructureItemContainer.LastActivatedTime"); }
+	float& ValidCraftingResourceMaxDurabilityField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.ValidCraftingResourceMaxDurability")>(this, "APrimalStructureItemContainer.ValidCraftingResourceMaxDurability"); }
+	float& ActivationCooldownTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.ActivationCooldownTime")>(this, "APrimalStructureItemContainer.ActivationCooldownTime"); }
+	float& UsablePriorityField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.UsablePriority")>(this, "APrimalStructureItemContainer.UsablePriority"); }
+	unsigned __int64& DeathCacheCharacterIDField() { return *GetNativePointerField<unsigned __int64*, API::FieldNameHash("APrimalStructureItemContainer.DeathCacheCharacterID")>(this, "APrimalStructureItemContainer.DeathCacheCharacterID"); }
+	float& SinglePlayerFuelConsumptionIntervalsMultiplierField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.SinglePlayerFuelConsumptionIntervalsMultiplier")>(this, "APrimalStructureItemContainer.SinglePlayerFuelConsumptionIntervalsMultiplier"); }
+	float& PoweredBatteryDurabilityToDecreasePerSecondField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.PoweredBatteryDurabilityToDecreasePerSecond")>(this, "APrimalStructureItemContainer.PoweredBatteryDurabilityToDecreasePerSecond"); }
+	float& DropInventoryDepositTraceDistanceField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureItemContainer.DropInventoryDepositTraceDistance")>(this, "APrimalStructureItemContainer.DropInventoryDepositTraceDistance"); }
+	TArray<TWeakObjectPtr<AShooterPlayerController>>& ValidatedByPinCodePlayerControllersField() { return *GetNativePointerField<TArray<TWeakObjectPtr<AShooterPlayerController>>*, API::FieldNameHash("APrimalStructureItemContainer.ValidatedByPinCodePlayerControllers")>(this, "APrimalStructureItemContainer.ValidatedByPinCodePlayerControllers"); }
 
 	// Bit fields
 
@@ -761,34 +761,34 @@ struct APrimalStructureItemContainer : APrimalStructure
 
 struct APrimalStructureTurret : APrimalStructureItemContainer
 {
-	TWeakObjectPtr<AActor>& TargetField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*>(this, "APrimalStructureTurret.Target"); }
-	TSubclassOf<UPrimalItem>& AmmoItemTemplateField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*>(this, "APrimalStructureTurret.AmmoItemTemplate"); }
-	float& FireIntervalField() { return *GetNativePointerField<float*>(this, "APrimalStructureTurret.FireInterval"); }
-	long double& LastFireTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructureTurret.LastFireTime"); }
-	float& MaxFireYawDeltaField() { return *GetNativePointerField<float*>(this, "APrimalStructureTurret.MaxFireYawDelta"); }
-	float& MaxFirePitchDeltaField() { return *GetNativePointerField<float*>(this, "APrimalStructureTurret.MaxFirePitchDelta"); }
-	FVector& TargetingLocOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalStructureTurret.TargetingLocOffset"); }
-	float& TargetingRotationInterpSpeedField() { return *GetNativePointerField<float*>(this, "APrimalStructureTurret.TargetingRotationInterpSpeed"); }
+	TWeakObjectPtr<AActor>& TargetField() { return *GetNativePointerField<TWeakObjectPtr<AActor>*, API::FieldNameHash("APrimalStructureTurret.Target")>(this, "APrimalStructureTurret.Target"); }
+	TSubclassOf<UPrimalItem>& AmmoItemTemplateField() { return *GetNativePointerField<TSubclassOf<UPrimalItem>*, API::FieldNameHash("APrimalStructureTurret.AmmoItemTemplate")>(this, "APrimalStructureTurret.AmmoItemTemplate"); }
+	float& FireIntervalField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureTurret.FireInterval")>(this, "APrimalStructureTurret.FireInterval"); }
+	long double& LastFireTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructureTurret.LastFireTime")>(this, "APrimalStructureTurret.LastFireTime"); }
+	float& MaxFireYawDeltaField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureTurret.MaxFireYawDelta")>(this, "APrimalStructureTurret.MaxFireYawDelta"); }
+	float& MaxFirePitchDeltaField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureTurret.MaxFirePitchDelta")>(this, "APrimalStructureTurret.MaxFirePitchDelta"); }
+	FVector& TargetingLocOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalStructureTurret.TargetingLocOffset")>(this, "APrimalStructureTurret.TargetingLocOffset"); }
+	float& TargetingRotationInterpSpeedField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureTurret.TargetingRotationInterpSpeed")>(this, "APrimalStructureTurret.TargetingRotationInterpSpeed"); }
 	FieldArray<float, 3> TargetingRangesField() { return { this, "APrimalStructureTurret.TargetingRanges" }; }
-	FVector& TargetingTraceOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalStructureTurret.TargetingTraceOffset"); }
-	TSubclassOf<UDamageType>& FireDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*>(this, "APrimalStructureTurret.FireDamageType"); }
-	float& FireDamageAmountField() { return *GetNativePointerField<float*>(this, "APrimalStructureTurret.FireDamageAmount"); }
-	float& FireDamageImpulseField() { return *GetNativePointerField<float*>(this, "APrimalStructureTurret.FireDamageImpulse"); }
-	FRotator& TurretAimRotOffsetField() { return *GetNativePointerField<FRotator*>(this, "APrimalStructureTurret.TurretAimRotOffset"); }
-	FVector& AimTargetLocOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalStructureTurret.AimTargetLocOffset"); }
-	FVector& PlayerProneTargetOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalStructureTurret.PlayerProneTargetOffset"); }
-	float& AimSpreadField() { return *GetNativePointerField<float*>(this, "APrimalStructureTurret.AimSpread"); }
-	char& RangeSettingField() { return *GetNativePointerField<char*>(this, "APrimalStructureTurret.RangeSetting"); }
-	char& AISettingField() { return *GetNativePointerField<char*>(this, "APrimalStructureTurret.AISetting"); }
-	char& WarningSettingField() { return *GetNativePointerField<char*>(this, "APrimalStructureTurret.WarningSetting"); }
-	int& NumBulletsField() { return *GetNativePointerField<int*>(this, "APrimalStructureTurret.NumBullets"); }
-	int& NumBulletsPerShotField() { return *GetNativePointerField<int*>(this, "APrimalStructureTurret.NumBulletsPerShot"); }
-	float& WarningExpirationTimeField() { return *GetNativePointerField<float*>(this, "APrimalStructureTurret.WarningExpirationTime"); }
-	float& BatteryIntervalFromActivationBeforeFiringField() { return *GetNativePointerField<float*>(this, "APrimalStructureTurret.BatteryIntervalFromActivationBeforeFiring"); }
-	bool& bWarnedField() { return *GetNativePointerField<bool*>(this, "APrimalStructureTurret.bWarned"); }
-	FRotator& DefaultTurretAimRotOffsetField() { return *GetNativePointerField<FRotator*>(this, "APrimalStructureTurret.DefaultTurretAimRotOffset"); }
-	FVector& MuzzleLocOffsetField() { return *GetNativePointerField<FVector*>(this, "APrimalStructureTurret.MuzzleLocOffset"); }
-	long double& LastWarningTimeField() { return *GetNativePointerField<long double*>(this, "APrimalStructureTurret.LastWarningTime"); }
+	FVector& TargetingTraceOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalStructureTurret.TargetingTraceOffset")>(this, "APrimalStructureTurret.TargetingTraceOffset"); }
+	TSubclassOf<UDamageType>& FireDamageTypeField() { return *GetNativePointerField<TSubclassOf<UDamageType>*, API::FieldNameHash("APrimalStructureTurret.FireDamageType")>(this, "APrimalStructureTurret.FireDamageType"); }
+	float& FireDamageAmountField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureTurret.FireDamageAmount")>(this, "APrimalStructureTurret.FireDamageAmount"); }
+	float& FireDamageImpulseField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureTurret.FireDamageImpulse")>(this, "APrimalStructureTurret.FireDamageImpulse"); }
+	FRotator& TurretAimRotOffsetField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalStructureTurret.TurretAimRotOffset")>(this, "APrimalStructureTurret.TurretAimRotOffset"); }
+	FVector& AimTargetLocOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalStructureTurret.AimTargetLocOffset")>(this, "APrimalStructureTurret.AimTargetLocOffset"); }
+	FVector& PlayerProneTargetOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalStructureTurret.PlayerProneTargetOffset")>(this, "APrimalStructureTurret.PlayerProneTargetOffset"); }
+	float& AimSpreadField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureTurret.AimSpread")>(this, "APrimalStructureTurret.AimSpread"); }
+	char& RangeSettingField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalStructureTurret.RangeSetting")>(this, "APrimalStructureTurret.RangeSetting"); }
+	char& AISettingField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalStructureTurret.AISetting")>(this, "APrimalStructureTurret.AISetting"); }
+	char& WarningSettingField() { return *GetNativePointerField<char*, API::FieldNameHash("APrimalStructureTurret.WarningSetting")>(this, "APrimalStructureTurret.WarningSetting"); }
+	int& NumBulletsField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructureTurret.NumBullets")>(this, "APrimalStructureTurret.NumBullets"); }
+	int& NumBulletsPerShotField() { return *GetNativePointerField<int*, API::FieldNameHash("APrimalStructureTurret.NumBulletsPerShot")>(this, "APrimalStructureTurret.NumBulletsPerShot"); }
+	float& WarningExpirationTimeField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureTurret.WarningExpirationTime")>(this, "APrimalStructureTurret.WarningExpirationTime"); }
+	float& BatteryIntervalFromActivationBeforeFiringField() { return *GetNativePointerField<float*, API::FieldNameHash("APrimalStructureTurret.BatteryIntervalFromActivationBeforeFiring")>(this, "APrimalStructureTurret.BatteryIntervalFromActivationBeforeFiring"); }
+	bool& bWarnedField() { return *GetNativePointerField<bool*, API::FieldNameHash("APrimalStructureTurret.bWarned")>(this, "APrimalStructureTurret.bWarned"); }
+	FRotator& DefaultTurretAimRotOffsetField() { return *GetNativePointerField<FRotator*, API::FieldNameHash("APrimalStructureTurret.DefaultTurretAimRotOffset")>(this, "APrimalStructureTurret.DefaultTurretAimRotOffset"); }
+	FVector& MuzzleLocOffsetField() { return *GetNativePointerField<FVector*, API::FieldNameHash("APrimalStructureTurret.MuzzleLocOffset")>(this, "APrimalStructureTurret.MuzzleLocOffset"); }
+	long double& LastWarningTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("APrimalStructureTurret.LastWarningTime")>(this, "APrimalStructureTurret.LastWarningTime"); }
 
 	// Bit fields
 
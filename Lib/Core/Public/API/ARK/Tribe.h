@@ -20,25 +20,25 @@ struct FTribeGovernment
 
 struct FTribeData
 {
-	FString& TribeNameField() { return *GetNativePointerField<FString*>(this, "FTribeData.TribeName"); }
-	long double& LastNameChangeTimeField() { return *GetNativePointerField<long double*>(this, "FTribeData.LastNameChangeTime"); }
-	unsigned int& OwnerPlayerDataIDField() { return *GetNativePointerField<unsigned int*>(this, "FTribeData.OwnerPlayerDataID"); }
-	int& TribeIDField() { return *GetNativePointerField<int*>(this, "FTribeData.TribeID"); }
-	TArray<FString>& MembersPlayerNameField() { return *GetNativePointerField<TArray<FString>*>(this, "FTribeData.MembersPlayerName"); }
-	TArray<unsigned int>& MembersPlayerDataIDField() { return *GetNativePointerField<TArray<unsigned int>*>(this, "FTribeData.MembersPlayerDataID"); }
-	TArray<unsigned char>& MembersRankGroupsField() { return *GetNativePointerField<TArray<unsigned char>*>(this, "FTribeData.MembersRankGroups"); }
-	TArray<double>& SlotFreedTimeField() { return *GetNativePointerField<TArray<double>*>(this, "FTribeData.SlotFreedTime"); }
-	TArray<unsigned int>& TribeAdminsField() { return *GetNativePointerField<TArray<unsigned int>*>(this, "FTribeData.TribeAdmins"); }
-	TArray<FTribeAlliance>& TribeAlliancesField() { return *GetNativePointerField<TArray<FTribeAlliance>*>(this, "FTribeData.TribeAlliances"); }
-	bool& bSetGovernmentField() { return *GetNativePointerField<bool*>(this, "FTribeData.bSetGovernment"); }
-	FTribeGovernment& TribeGovernmentField() { return *GetNativePointerField<FTribeGovernment*>(this, "FTribeData.TribeGovernment"); }
-	TArray<FPrimalPlayerCharacterConfigStruct>& MembersConfigsField() { return *GetNativePointerField<TArray<FPrimalPlayerCharacterConfigStruct>*>(this, "FTribeData.MembersConfigs"); }
-	TArray<FTribeWar>& TribeWarsField() { return *GetNativePointerField<TArray<FTribeWar>*>(this, "FTribeData.TribeWars"); }
-	TArray<FString>& TribeLogField() { return *GetNativePointerField<TArray<FString>*>(this, "FTribeData.TribeLog"); }
-	int& LogIndexField() { return *GetNativePointerField<int*>(this, "FTribeData.LogIndex"); }
-	TArray<FTribeRankGroup>& TribeRankGroupsField() { return *GetNativePointerField<TArray<FTribeRankGroup>*>(this, "FTribeData.TribeRankGroups"); }
-	int& NumTribeDinosField() { return *GetNativePointerField<int*>(this, "FTribeData.NumTribeDinos"); }
-	TSet<unsigned __int64, DefaultKeyFuncs<unsigned __int64, 0>, FDefaultSetAllocator>& MembersPlayerDataIDSet_ServerField() { return *GetNativePointerField<TSet<unsigned __int64, DefaultKeyFuncs<unsigned __int64, 0>, FDefaultSetAllocator>*>(this, "FTribeData.MembersPlayerDataIDSet_Server"); }
+	FString& TribeNameField() { return *GetNativePointerField<FString*, API::FieldNameHash("FTribeData.TribeName")>(this, "FTribeData.TribeName"); }
+	long double& LastNameChangeTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("FTribeData.LastNameChangeTime")>(this, "FTribeData.LastNameChangeTime"); }
+	unsigned int& OwnerPlayerDataIDField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("FTribeData.OwnerPlayerDataID")>(this, "FTribeData.OwnerPlayerDataID"); }
+	int& TribeIDField() { return *GetNativePointerField<int*, API::FieldNameHash("FTribeData.TribeID")>(this, "FTribeData.TribeID"); }
+	TArray<FString>& MembersPlayerNameField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("FTribeData.MembersPlayerName")>(this, "FTribeData.MembersPlayerName"); }
+	TArray<unsigned int>& MembersPlayerDataIDField() { return *GetNativePointerField<TArray<unsigned int>*, API::FieldNameHash("FTribeData.MembersPlayerDataID")>(this, "FTribeData.MembersPlayerDataID"); }
+	TArray<unsigned char>& MembersRankGroupsField() { return *GetNativePointerField<TArray<unsigned char>*, API::FieldNameHash("FTribeData.MembersRankGroups")>(this, "FTribeData.MembersRankGroups"); }
+	TArray<double>& SlotFreedTimeField() { return *GetNativePointerField<TArray<double>*, API::FieldNameHash("FTribeData.SlotFreedTime")>(this, "FTribeData.SlotFreedTime"); }
+	TArray<unsigned int>& TribeAdminsField() { return *GetNativePointerField<TArray<unsigned int>*, API::FieldNameHash("FTribeData.TribeAdmins")>(this, "FTribeData.TribeAdmins"); }
+	TArray<FTribeAlliance>& TribeAlliancesField() { return *GetNativePointerField<TArray<FTribeAlliance>*, API::FieldNameHash("FTribeData.TribeAlliances")>(this, "FTribeData.TribeAlliances"); }
+	bool& bSetGovernmentField() { return *GetNativePointerField<bool*, API::FieldNameHash("FTribeData.bSetGovernment")>(this, "FTribeData.bSetGovernment"); }
+	FTribeGovernment& TribeGovernmentField() { return *GetNativePointerField<FTribeGovernment*, API::FieldNameHash("FTribeData.TribeGovernment")>(this, "FTribeData.TribeGovernment"); }
+	TArray<FPrimalPlayerCharacterConfigStruct>& MembersConfigsField() { return *GetNativePointerField<TArray<FPrimalPlayerCharacterConfigStruct>*, API::FieldNameHash("FTribeData.MembersConfigs")>(this, "FTribeData.MembersConfigs"); }
+	TArray<FTribeWar>& TribeWarsField() { return *GetNativePointerField<TArray<FTribeWar>*, API::FieldNameHash("FTribeData.TribeWars")>(this, "FTribeData.TribeWars"); }
+	TArray<FString>& TribeLogField() { return *GetNativePointerField<TArray<FString>*, API::FieldNameHash("FTribeData.TribeLog")>(this, "FTribeData.TribeLog"); }
+	int& LogIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("FTribeData.LogIndex")>(this, "FTribeData.LogIndex"); }
+	TArray<FTribeRankGroup>& TribeRankGroupsField() { return *GetNativePointerField<TArray<FTribeRankGroup>*, API::FieldNameHash("FTribeData.TribeRankGroups")>(this, "FTribeData.TribeRankGroups"); }
+	int& NumTribeDinosField() { return *GetNativePointerField<int*, API::FieldNameHash("FTribeData.NumTribeDinos")>(this, "FTribeData.NumTribeDinos"); }
+	TSet<unsigned __int64, DefaultKeyFuncs<unsigned __int64, 0>, FDefaultSetAllocator>& MembersPlayerDataIDSet_ServerField() { return *GetNativePointerField<TSet<unsigned __int64, DefaultKeyFuncs<unsigned __int64, 0>, FDefaultSetAllocator>*, API::FieldNameHash("FTribeData.MembersPlayerDataIDSet_Server")>(this, "FTribeData.MembersPlayerDataIDSet_Server"); }
 
 	// Functions
 
@@ -1,11 +1,43 @@
 #pragma once
 
 #include <Windows.h>
+#include <atomic>
 #include <string>
 #include <utility>
 
 #include "Base.h"
 
+namespace API
+{
+	/**
+	 * \brief FNV-1a hash of a field name, evaluated at compile time to give every field its own offset slot
+	 */
+	constexpr unsigned long long FieldNameHash(const char* name, unsigned long long hash = 14695981039346656037ull)
+	{
+		return *name ? FieldNameHash(name + 1, (hash ^ static_cast<unsigned char>(*name)) * 1099511628211ull) : hash;
+	}
+
+	/**
+	 * \brief Returns the offset of a field, looked up in the offsets dump on first use only
+	 *
+	 * A name that resolves to 0 is looked up again on the next call, so a read before the offsets are loaded is not kept.
+	 */
+	template <unsigned long long Hash>
+	intptr_t GetCachedFieldOffset(const char* field_name)
+	{
+		static std::atomic<intptr_t> offset{0};
+
+		intptr_t value = offset.load(std::memory_order_relaxed);
+		if (value == 0)
+		{
+			value = static_cast<intptr_t>(GetAddress(nullptr, field_name));
+			offset.store(value, std::memory_order_relaxed);
+		}
+
+		return value;
+	}
+} // namespace API
+
 template <typename RT, typename... ArgsTypes, typename... Args>
 RT NativeCall(void* _this, const std::string& func_name, Args&&... args)
 {
@@ -31,6 +63,13 @@ RT GetNativePointerField(const void* _this, const std::string& field_name)
 	return reinterpret_cast<RT>(GetAddress(_this, field_name));
 }
 
+// Used by the generated accessors, Hash is API::FieldNameHash(field_name) so a field read is a plain pointer add
+template <typename RT, unsigned long long Hash>
+RT GetNativePointerField(const void* _this, const char* field_name)
+{
+	return reinterpret_cast<RT>(reinterpret_cast<DWORD64>(_this) + API::GetCachedFieldOffset<Hash>(field_name));
+}
+
 template <typename RT>
 RT GetNativeDataPointerField(const std::string& field_name)
 {
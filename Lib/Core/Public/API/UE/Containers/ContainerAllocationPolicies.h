@@ -434,6 +434,9 @@ class FDefaultAllocator;
  * The inline allocation policy allocates up to a specified number of elements in the same allocation as the container.
  * Any allocation needed beyond that causes all data to be moved into an indirect allocation.
  * It always uses DEFAULT_ALIGNMENT.
+ *
+ * Plugins can use it for short lived or small arrays, e.g. TArray<FString, TInlineAllocator<4>>. Such arrays never cross
+ * into game or API functions, which expect the default allocator; convert with the explicit TArray<T>(Other) constructor.
  */
 template <uint32 NumInlineElements, typename SecondaryAllocator = FDefaultAllocator>
 class TInlineAllocator
@@ -535,7 +538,8 @@ public:
 
 		SIZE_T GetAllocatedSize(int32 NumAllocatedElements, SIZE_T NumBytesPerElement) const
 		{
-			return SecondaryData.GetAllocatedSize(NumAllocatedElements, NumBytesPerElement);
+			// Inline elements live in the owner, only an indirect allocation is extra memory
+			return SecondaryData.GetAllocation() ? SecondaryData.GetAllocatedSize(NumAllocatedElements, NumBytesPerElement) : 0;
 		}
 
 		bool HasAllocation()
@@ -191,11 +191,11 @@ struct FUniqueNetIdSteam : FUniqueNetId
 
 struct UObjectBase
 {
-	EObjectFlags& ObjectFlagsField() { return *GetNativePointerField<EObjectFlags*>(this, "UObjectBase.ObjectFlags"); }
-	int& InternalIndexField() { return *GetNativePointerField<int*>(this, "UObjectBase.InternalIndex"); }
-	UClass * ClassField() { return *GetNativePointerField<UClass **>(this, "UObjectBase.Class"); }
-	FName& NameField() { return *GetNativePointerField<FName*>(this, "UObjectBase.Name"); }
-	UObject * OuterField() { return *GetNativePointerField<UObject **>(this, "UObjectBase.Outer"); }
+	EObjectFlags& ObjectFlagsField() { return *GetNativePointerField<EObjectFlags*, API::FieldNameHash("UObjectBase.ObjectFlags")>(this, "UObjectBase.ObjectFlags"); }
+	int& InternalIndexField() { return *GetNativePointerField<int*, API::FieldNameHash("UObjectBase.InternalIndex")>(this, "UObjectBase.InternalIndex"); }
+	UClass * ClassField() { return *GetNativePointerField<UClass **, API::FieldNameHash("UObjectBase.Class")>(this, "UObjectBase.Class"); }
+	FName& NameField() { return *GetNativePointerField<FName*, API::FieldNameHash("UObjectBase.Name")>(this, "UObjectBase.Name"); }
+	UObject * OuterField() { return *GetNativePointerField<UObject **, API::FieldNameHash("UObjectBase.Outer")>(this, "UObjectBase.Outer"); }
 
 	// Functions
 
@@ -258,7 +258,7 @@ struct UObject : UObjectBaseUtility
 
 struct UField : UObject
 {
-	UField * NextField() { return *GetNativePointerField<UField **>(this, "UField.Next"); }
+	UField * NextField() { return *GetNativePointerField<UField **, API::FieldNameHash("UField.Next")>(this, "UField.Next"); }
 
 	// Functions
 
@@ -270,16 +270,16 @@ struct UField : UObject
 
 struct UStruct : UField
 {
-	UStruct * SuperStructField() { return *GetNativePointerField<UStruct **>(this, "UStruct.SuperStruct"); }
-	UField * ChildrenField() { return *GetNativePointerField<UField **>(this, "UStruct.Children"); }
-	int& PropertiesSizeField() { return *GetNativePointerField<int*>(this, "UStruct.PropertiesSize"); }
-	TArray<unsigned char>& ScriptField() { return *GetNativePointerField<TArray<unsigned char>*>(this, "UStruct.Script"); }
-	int& MinAlignmentField() { return *GetNativePointerField<int*>(this, "UStruct.MinAlignment"); }
-	UProperty * PropertyLinkField() { return *GetNativePointerField<UProperty **>(this, "UStruct.PropertyLink"); }
-	UProperty * RefLinkField() { return *GetNativePointerField<UProperty **>(this, "UStruct.RefLink"); }
-	UProperty * DestructorLinkField() { return *GetNativePointerField<UProperty **>(this, "UStruct.DestructorLink"); }
-	UProperty * PostConstructLinkField() { return *GetNativePointerField<UProperty **>(this, "UStruct.PostConstructLink"); }
-	TArray<UObject *> ScriptObjectReferencesField() { return *GetNativePointerField<TArray<UObject *>*>(this, "UStruct.ScriptObjectReferences"); }
+	UStruct * SuperStructField() { return *GetNativePointerField<UStruct **, API::FieldNameHash("UStruct.SuperStruct")>(this, "UStruct.SuperStruct"); }
+	UField * ChildrenField() { return *GetNativePointerField<UField **, API::FieldNameHash("UStruct.Children")>(this, "UStruct.Children"); }
+	int& PropertiesSizeField() { return *GetNativePointerField<int*, API::FieldNameHash("UStruct.PropertiesSize")>(this, "UStruct.PropertiesSize"); }
+	TArray<unsigned char>& ScriptField() { return *GetNativePointerField<TArray<unsigned char>*, API::FieldNameHash("UStruct.Script")>(this, "UStruct.Script"); }
+	int& MinAlignmentField() { return *GetNativePointerField<int*, API::FieldNameHash("UStruct.MinAlignment")>(this, "UStruct.MinAlignment"); }
+	UProperty * PropertyLinkField() { return *GetNativePointerField<UProperty **, API::FieldNameHash("UStruct.PropertyLink")>(this, "UStruct.PropertyLink"); }
+	UProperty * RefLinkField() { return *GetNativePointerField<UProperty **, API::FieldNameHash("UStruct.RefLink")>(this, "UStruct.RefLink"); }
+	UProperty * DestructorLinkField() { return *GetNativePointerField<UProperty **, API::FieldNameHash("UStruct.DestructorLink")>(this, "UStruct.DestructorLink"); }
+	UProperty * PostConstructLinkField() { return *GetNativePointerField<UProperty **, API::FieldNameHash("UStruct.PostConstructLink")>(this, "UStruct.PostConstructLink"); }
+	TArray<UObject *> ScriptObjectReferencesField() { return *GetNativePointerField<TArray<UObject *>*, API::FieldNameHash("UStruct.ScriptObjectReferences")>(this, "UStruct.ScriptObjectReferences"); }
 
 	// Functions
 
@@ -302,18 +302,18 @@ struct FNativeFunctionLookup
 
 struct UClass : UStruct
 {
-	unsigned int& ClassFlagsField() { return *GetNativePointerField<unsigned int*>(this, "UClass.ClassFlags"); }
-	unsigned __int64& ClassCastFlagsField() { return *GetNativePointerField<unsigned __int64*>(this, "UClass.ClassCastFlags"); }
-	int& ClassUniqueField() { return *GetNativePointerField<int*>(this, "UClass.ClassUnique"); }
-	UClass * ClassWithinField() { return *GetNativePointerField<UClass **>(this, "UClass.ClassWithin"); }
-	UObject * ClassGeneratedByField() { return *GetNativePointerField<UObject **>(this, "UClass.ClassGeneratedBy"); }
-	bool& bIsGameClassField() { return *GetNativePointerField<bool*>(this, "UClass.bIsGameClass"); }
-	FName& ClassConfigNameField() { return *GetNativePointerField<FName*>(this, "UClass.ClassConfigName"); }
-	TArray<UField *> NetFieldsField() { return *GetNativePointerField<TArray<UField *>*>(this, "UClass.NetFields"); }
-	UObject * ClassDefaultObjectField() { return *GetNativePointerField<UObject **>(this, "UClass.ClassDefaultObject"); }
-	bool& bCookedField() { return *GetNativePointerField<bool*>(this, "UClass.bCooked"); }
-	TMap<DWORD64, UFunction *> FuncMapField() { return *GetNativePointerField<TMap<DWORD64, UFunction *>*>(this, "UClass.FuncMap"); }
-	TArray<FNativeFunctionLookup>& NativeFunctionLookupTableField() { return *GetNativePointerField<TArray<FNativeFunctionLookup>*>(this, "UClass.NativeFunctionLookupTable"); }
+	unsigned int& ClassFlagsField() { return *GetNativePointerField<unsigned int*, API::FieldNameHash("UClass.ClassFlags")>(this, "UClass.ClassFlags"); }
+	unsigned __int64& ClassCastFlagsField() { return *GetNativePointerField<unsigned __int64*, API::FieldNameHash("UClass.ClassCastFlags")>(this, "UClass.ClassCastFlags"); }
+	int& ClassUniqueField() { return *GetNativePointerField<int*, API::FieldNameHash("UClass.ClassUnique")>(this, "UClass.ClassUnique"); }
+	UClass * ClassWithinField() { return *GetNativePointerField<UClass **, API::FieldNameHash("UClass.ClassWithin")>(this, "UClass.ClassWithin"); }
+	UObject * ClassGeneratedByField() { return *GetNativePointerField<UObject **, API::FieldNameHash("UClass.ClassGeneratedBy")>(this, "UClass.ClassGeneratedBy"); }
+	bool& bIsGameClassField() { return *GetNativePointerField<bool*, API::FieldNameHash("UClass.bIsGameClass")>(this, "UClass.bIsGameClass"); }
+	FName& ClassConfigNameField() { return *GetNativePointerField<FName*, API::FieldNameHash("UClass.ClassConfigName")>(this, "UClass.ClassConfigName"); }
+	TArray<UField *> NetFieldsField() { return *GetNativePointerField<TArray<UField *>*, API::FieldNameHash("UClass.NetFields")>(this, "UClass.NetFields"); }
+	UObject * ClassDefaultObjectField() { return *GetNativePointerField<UObject **, API::FieldNameHash("UClass.ClassDefaultObject")>(this, "UClass.ClassDefaultObject"); }
+	bool& bCookedField() { return *GetNativePointerField<bool*, API::FieldNameHash("UClass.bCooked")>(this, "UClass.bCooked"); }
+	TMap<DWORD64, UFunction *> FuncMapField() { return *GetNativePointerField<TMap<DWORD64, UFunction *>*, API::FieldNameHash("UClass.FuncMap")>(this, "UClass.FuncMap"); }
+	TArray<FNativeFunctionLookup>& NativeFunctionLookupTableField() { return *GetNativePointerField<TArray<FNativeFunctionLookup>*, API::FieldNameHash("UClass.NativeFunctionLookupTable")>(this, "UClass.NativeFunctionLookupTable"); }
 
 	// Functions
 
@@ -344,11 +344,11 @@ struct UClass : UStruct
 
 struct UBlueprintCore : UObject
 {
-	TSubclassOf<UObject>& SkeletonGeneratedClassField() { return *GetNativePointerField<TSubclassOf<UObject>*>(this, "UBlueprintCore.SkeletonGeneratedClass"); }
-	TSubclassOf<UObject>& GeneratedClassField() { return *GetNativePointerField<TSubclassOf<UObject>*>(this, "UBlueprintCore.GeneratedClass"); }
-	bool& bLegacyNeedToPurgeSkelRefsField() { return *GetNativePointerField<bool*>(this, "UBlueprintCore.bLegacyNeedToPurgeSkelRefs"); }
-	bool& bLegacyGeneratedClassIsAuthoritativeField() { return *GetNativePointerField<bool*>(this, "UBlueprintCore.bLegacyGeneratedClassIsAuthoritative"); }
-	FGuid& BlueprintGuidField() { return *GetNativePointerField<FGuid*>(this, "UBlueprintCore.BlueprintGuid"); }
+	TSubclassOf<UObject>& SkeletonGeneratedClassField() { return *GetNativePointerField<TSubclassOf<UObject>*, API::FieldNameHash("UBlueprintCore.SkeletonGeneratedClass")>(this, "UBlueprintCore.SkeletonGeneratedClass"); }
+	TSubclassOf<UObject>& GeneratedClassField() { return *GetNativePointerField<TSubclassOf<UObject>*, API::FieldNameHash("UBlueprintCore.GeneratedClass")>(this, "UBlueprintCore.GeneratedClass"); }
+	bool& bLegacyNeedToPurgeSkelRefsField() { return *GetNativePointerField<bool*, API::FieldNameHash("UBlueprintCore.bLegacyNeedToPurgeSkelRefs")>(this, "UBlueprintCore.bLegacyNeedToPurgeSkelRefs"); }
+	bool& bLegacyGeneratedClassIsAuthoritativeField() { return *GetNativePointerField<bool*, API::FieldNameHash("UBlueprintCore.bLegacyGeneratedClassIsAuthoritative")>(this, "UBlueprintCore.bLegacyGeneratedClassIsAuthoritative"); }
+	FGuid& BlueprintGuidField() { return *GetNativePointerField<FGuid*, API::FieldNameHash("UBlueprintCore.BlueprintGuid")>(this, "UBlueprintCore.BlueprintGuid"); }
 
 	// Functions
 
@@ -357,11 +357,11 @@ struct UBlueprintCore : UObject
 
 struct UBlueprint : UBlueprintCore
 {
-	TSubclassOf<UObject>& ParentClassField() { return *GetNativePointerField<TSubclassOf<UObject>*>(this, "UBlueprint.ParentClass"); }
-	UObject * PRIVATE_InnermostPreviousCDOField() { return *GetNativePointerField<UObject **>(this, "UBlueprint.PRIVATE_InnermostPreviousCDO"); }
-	TArray<UActorComponent *> ComponentTemplatesField() { return *GetNativePointerField<TArray<UActorComponent *>*>(this, "UBlueprint.ComponentTemplates"); }
-	TEnumAsByte<enum EBlueprintType>& BlueprintTypeField() { return *GetNativePointerField<TEnumAsByte<enum EBlueprintType>*>(this, "UBlueprint.BlueprintType"); }
-	int& BlueprintSystemVersionField() { return *GetNativePointerField<int*>(this, "UBlueprint.BlueprintSystemVersion"); }
+	TSubclassOf<UObject>& ParentClassField() { return *GetNativePointerField<TSubclassOf<UObject>*, API::FieldNameHash("UBlueprint.ParentClass")>(this, "UBlueprint.ParentClass"); }
+	UObject * PRIVATE_InnermostPreviousCDOField() { return *GetNativePointerField<UObject **, API::FieldNameHash("UBlueprint.PRIVATE_InnermostPreviousCDO")>(this, "UBlueprint.PRIVATE_InnermostPreviousCDO"); }
+	TArray<UActorComponent *> ComponentTemplatesField() { return *GetNativePointerField<TArray<UActorComponent *>*, API::FieldNameHash("UBlueprint.ComponentTemplates")>(this, "UBlueprint.ComponentTemplates"); }
+	TEnumAsByte<enum EBlueprintType>& BlueprintTypeField() { return *GetNativePointerField<TEnumAsByte<enum EBlueprintType>*, API::FieldNameHash("UBlueprint.BlueprintType")>(this, "UBlueprint.BlueprintType"); }
+	int& BlueprintSystemVersionField() { return *GetNativePointerField<int*, API::FieldNameHash("UBlueprint.BlueprintSystemVersion")>(this, "UBlueprint.BlueprintSystemVersion"); }
 
 	// Functions
 
@@ -373,16 +373,16 @@ struct UBlueprint : UBlueprintCore
 
 struct UProperty : UField
 {
-	int& ArrayDimField() { return *GetNativePointerField<int*>(this, "UProperty.ArrayDim"); }
-	int& ElementSizeField() { return *GetNativePointerField<int*>(this, "UProperty.ElementSize"); }
-	unsigned __int64& PropertyFlagsField() { return *GetNativePointerField<unsigned __int64*>(this, "UProperty.PropertyFlags"); }
-	unsigned __int16& RepIndexField() { return *GetNativePointerField<unsigned __int16*>(this, "UProperty.RepIndex"); }
-	FName& RepNotifyFuncField() { return *GetNativePointerField<FName*>(this, "UProperty.RepNotifyFunc"); }
-	int& Offset_InternalField() { return *GetNativePointerField<int*>(this, "UProperty.Offset_Internal"); }
-	UProperty * PropertyLinkNextField() { return *GetNativePointerField<UProperty **>(this, "UProperty.PropertyLinkNext"); }
-	UProperty * NextRefField() { return *GetNativePointerField<UProperty **>(this, "UProperty.NextRef"); }
-	UProperty * DestructorLinkNextField() { return *GetNativePointerField<UProperty **>(this, "UProperty.DestructorLinkNext"); }
-	UProperty * PostConstructLinkNextField() { return *GetNativePointerField<UProperty **>(this, "UProperty.PostConstructLinkNext"); }
+	int& ArrayDimField() { return *GetNativePointerField<int*, API::FieldNameHash("UProperty.ArrayDim")>(this, "UProperty.ArrayDim"); }
+	int& ElementSizeField() { return *GetNativePointerField<int*, API::FieldNameHash("UProperty.ElementSize")>(this, "UProperty.ElementSize"); }
+	unsigned __int64& PropertyFlagsField() { return *GetNativePointerField<unsigned __int64*, API::FieldNameHash("UProperty.PropertyFlags")>(this, "UProperty.PropertyFlags"); }
+	unsigned __int16& RepIndexField() { return *GetNativePointerField<unsigned __int16*, API::FieldNameHash("UProperty.RepIndex")>(this, "UProperty.RepIndex"); }
+	FName& RepNotifyFuncField() { return *GetNativePointerField<FName*, API::FieldNameHash("UProperty.RepNotifyFunc")>(this, "UProperty.RepNotifyFunc"); }
+	int& Offset_InternalField() { return *GetNativePointerField<int*, API::FieldNameHash("UProperty.Offset_Internal")>(this, "UProperty.Offset_Internal"); }
+	UProperty * PropertyLinkNextField() { return *GetNativePointerField<UProperty **, API::FieldNameHash("UProperty.PropertyLinkNext")>(this, "UProperty.PropertyLinkNext"); }
+	UProperty * NextRefField() { return *GetNativePointerField<UProperty **, API::FieldNameHash("UProperty.NextRef")>(this, "UProperty.NextRef"); }
+	UProperty * DestructorLinkNextField() { return *GetNativePointerField<UProperty **, API::FieldNameHash("UProperty.DestructorLinkNext")>(this, "UProperty.DestructorLinkNext"); }
+	UProperty * PostConstructLinkNextField() { return *GetNativePointerField<UProperty **, API::FieldNameHash("UProperty.PostConstructLinkNext")>(this, "UProperty.PostConstructLinkNext"); }
 
 	// Functions
 
@@ -410,10 +410,10 @@ struct UNumericProperty : UProperty
 
 struct UBoolProperty : UProperty
 {
-	char& FieldSizeField() { return *GetNativePointerField<char*>(this, "UBoolProperty.FieldSize"); }
-	char& ByteOffsetField() { return *GetNativePointerField<char*>(this, "UBoolProperty.ByteOffset"); }
-	char& ByteMaskField() { return *GetNativePointerField<char*>(this, "UBoolProperty.ByteMask"); }
-	char& FieldMaskField() { return *GetNativePointerField<char*>(this, "UBoolProperty.FieldMask"); }
+	char& FieldSizeField() { return *GetNativePointerField<char*, API::FieldNameHash("UBoolProperty.FieldSize")>(this, "UBoolProperty.FieldSize"); }
+	char& ByteOffsetField() { return *GetNativePointerField<char*, API::FieldNameHash("UBoolProperty.ByteOffset")>(this, "UBoolProperty.ByteOffset"); }
+	char& ByteMaskField() { return *GetNativePointerField<char*, API::FieldNameHash("UBoolProperty.ByteMask")>(this, "UBoolProperty.ByteMask"); }
+	char& FieldMaskField() { return *GetNativePointerField<char*, API::FieldNameHash("UBoolProperty.FieldMask")>(this, "UBoolProperty.FieldMask"); }
 
 	// Functions
 
@@ -655,16 +655,16 @@ struct FHttpRequestWinInet;
 
 struct FHttpResponseWinInet
 {
-	FHttpRequestWinInet * RequestField() { return *GetNativePointerField<FHttpRequestWinInet **>(this, "FHttpResponseWinInet.Request"); }
-	int& AsyncBytesReadField() { return *GetNativePointerField<int*>(this, "FHttpResponseWinInet.AsyncBytesRead"); }
-	int& TotalBytesReadField() { return *GetNativePointerField<int*>(this, "FHttpResponseWinInet.TotalBytesRead"); }
-	TMap<FString, FString, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, FString, 0> >& ResponseHeadersField() { return *GetNativePointerField<TMap<FString, FString, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, FString, 0> >*>(this, "FHttpResponseWinInet.ResponseHeaders"); }
-	int& ResponseCodeField() { return *GetNativePointerField<int*>(this, "FHttpResponseWinInet.ResponseCode"); }
-	int& ContentLengthField() { return *GetNativePointerField<int*>(this, "FHttpResponseWinInet.ContentLength"); }
-	TArray<unsigned char>& ResponsePayloadField() { return *GetNativePointerField<TArray<unsigned char>*>(this, "FHttpResponseWinInet.ResponsePayload"); }
-	volatile int& bIsReadyField() { return *GetNativePointerField<volatile int*>(this, "FHttpResponseWinInet.bIsReady"); }
-	volatile int& bResponseSucceededField() { return *GetNativePointerField<volatile int*>(this, "FHttpResponseWinInet.bResponseSucceeded"); }
-	int& MaxReadBufferSizeField() { return *GetNativePointerField<int*>(this, "FHttpResponseWinInet.MaxReadBufferSize"); }
+	FHttpRequestWinInet * RequestField() { return *GetNativePointerField<FHttpRequestWinInet **, API::FieldNameHash("FHttpResponseWinInet.Request")>(this, "FHttpResponseWinInet.Request"); }
+	int& AsyncBytesReadField() { return *GetNativePointerField<int*, API::FieldNameHash("FHttpResponseWinInet.AsyncBytesRead")>(this, "FHttpResponseWinInet.AsyncBytesRead"); }
+	int& TotalBytesReadField() { return *GetNativePointerField<int*, API::FieldNameHash("FHttpResponseWinInet.TotalBytesRead")>(this, "FHttpResponseWinInet.TotalBytesRead"); }
+	TMap<FString, FString, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, FString, 0> >& ResponseHeadersField() { return *GetNativePointerField<TMap<FString, FString, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, FString, 0> >*, API::FieldNameHash("FHttpResponseWinInet.ResponseHeaders")>(this, "FHttpResponseWinInet.ResponseHeaders"); }
+	int& ResponseCodeField() { return *GetNativePointerField<int*, API::FieldNameHash("FHttpResponseWinInet.ResponseCode")>(this, "FHttpResponseWinInet.ResponseCode"); }
+	int& ContentLengthField() { return *GetNativePointerField<int*, API::FieldNameHash("FHttpResponseWinInet.ContentLength")>(this, "FHttpResponseWinInet.ContentLength"); }
+	TArray<unsigned char>& ResponsePayloadField() { return *GetNativePointerField<TArray<unsigned char>*, API::FieldNameHash("FHttpResponseWinInet.ResponsePayload")>(this, "FHttpResponseWinInet.ResponsePayload"); }
+	volatile int& bIsReadyField() { return *GetNativePointerField<volatile int*, API::FieldNameHash("FHttpResponseWinInet.bIsReady")>(this, "FHttpResponseWinInet.bIsReady"); }
+	volatile int& bResponseSucceededField() { return *GetNativePointerField<volatile int*, API::FieldNameHash("FHttpResponseWinInet.bResponseSucceeded")>(this, "FHttpResponseWinInet.bResponseSucceeded"); }
+	int& MaxReadBufferSizeField() { return *GetNativePointerField<int*, API::FieldNameHash("FHttpResponseWinInet.MaxReadBufferSize")>(this, "FHttpResponseWinInet.MaxReadBufferSize"); }
 
 	// Functions
 
@@ -690,17 +690,17 @@ struct IHttpResponse : FHttpResponseWinInet
 
 struct FHttpRequestWinInet
 {
-	FString& RequestVerbField() { return *GetNativePointerField<FString*>(this, "FHttpRequestWinInet.RequestVerb"); }
-	TMap<FString, FString, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, FString, 0> >& RequestHeadersField() { return *GetNativePointerField<TMap<FString, FString, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, FString, 0> >*>(this, "FHttpRequestWinInet.RequestHeaders"); }
-	TArray<unsigned char>& RequestPayloadField() { return *GetNativePointerField<TArray<unsigned char>*>(this, "FHttpRequestWinInet.RequestPayload"); }
-	TSharedPtr<FHttpResponseWinInet, 1>& ResponseField() { return *GetNativePointerField<TSharedPtr<FHttpResponseWinInet, 1>*>(this, "FHttpRequestWinInet.Response"); }
-	EHttpRequestStatus::Type& CompletionStatusField() { return *GetNativePointerField<EHttpRequestStatus::Type*>(this, "FHttpRequestWinInet.CompletionStatus"); }
-	void * ConnectionHandleField() { return *GetNativePointerField<void **>(this, "FHttpRequestWinInet.ConnectionHandle"); }
-	void * RequestHandleField() { return *GetNativePointerField<void **>(this, "FHttpRequestWinInet.RequestHandle"); }
-	volatile int& ElapsedTimeSinceLastServerResponseField() { return *GetNativePointerField<volatile int*>(this, "FHttpRequestWinInet.ElapsedTimeSinceLastServerResponse"); }
-	int& ProgressBytesSentField() { return *GetNativePointerField<int*>(this, "FHttpRequestWinInet.ProgressBytesSent"); }
-	long double& StartRequestTimeField() { return *GetNativePointerField<long double*>(this, "FHttpRequestWinInet.StartRequestTime"); }
-	bool& bDebugVerboseField() { return *GetNativePointerField<bool*>(this, "FHttpRequestWinInet.bDebugVerbose"); }
+	FString& RequestVerbField() { return *GetNativePointerField<FString*, API::FieldNameHash("FHttpRequestWinInet.RequestVerb")>(this, "FHttpRequestWinInet.RequestVerb"); }
+	TMap<FString, FString, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, FString, 0> >& RequestHeadersField() { return *GetNativePointerField<TMap<FString, FString, FDefaultSetAllocator, TDefaultMapKeyFuncs<FString, FString, 0> >*, API::FieldNameHash("FHttpRequestWinInet.RequestHeaders")>(this, "FHttpRequestWinInet.RequestHeaders"); }
+	TArray<unsigned char>& RequestPayloadField() { return *GetNativePointerField<TArray<unsigned char>*, API::FieldNameHash("FHttpRequestWinInet.RequestPayload")>(this, "FHttpRequestWinInet.RequestPayload"); }
+	TSharedPtr<FHttpResponseWinInet, 1>& ResponseField() { return *GetNativePointerField<TSharedPtr<FHttpResponseWinInet, 1>*, API::FieldNameHash("FHttpRequestWinInet.Response")>(this, "FHttpRequestWinInet.Response"); }
+	EHttpRequestStatus::Type& CompletionStatusField() { return *GetNativePointerField<EHttpRequestStatus::Type*, API::FieldNameHash("FHttpRequestWinInet.CompletionStatus")>(this, "FHttpRequestWinInet.CompletionStatus"); }
+	void * ConnectionHandleField() { return *GetNativePointerField<void **, API::FieldNameHash("FHttpRequestWinInet.ConnectionHandle")>(this, "FHttpRequestWinInet.ConnectionHandle"); }
+	void * RequestHandleField() { return *GetNativePointerField<void **, API::FieldNameHash("FHttpRequestWinInet.RequestHandle")>(this, "FHttpRequestWinInet.RequestHandle"); }
+	volatile int& ElapsedTimeSinceLastServerResponseField() { return *GetNativePointerField<volatile int*, API::FieldNameHash("FHttpRequestWinInet.ElapsedTimeSinceLastServerResponse")>(this, "FHttpRequestWinInet.ElapsedTimeSinceLastServerResponse"); }
+	int& ProgressBytesSentField() { return *GetNativePointerField<int*, API::FieldNameHash("FHttpRequestWinInet.ProgressBytesSent")>(this, "FHttpRequestWinInet.ProgressBytesSent"); }
+	long double& StartRequestTimeField() { return *GetNativePointerField<long double*, API::FieldNameHash("FHttpRequestWinInet.StartRequestTime")>(this, "FHttpRequestWinInet.StartRequestTime"); }
+	bool& bDebugVerboseField() { return *GetNativePointerField<bool*, API::FieldNameHash("FHttpRequestWinInet.bDebugVerbose")>(this, "FHttpRequestWinInet.bDebugVerbose"); }
 
 	// Functions
 
@@ -733,14 +733,14 @@ struct IHttpRequest : FHttpRequestWinInet
 
 struct FHttpModule
 {
-	//FHttpManager * HttpManagerField() { return *GetNativePointerField<FHttpManager **>(this, "FHttpModule.HttpManager"); }
-	float& HttpTimeoutField() { return *GetNativePointerField<float*>(this, "FHttpModule.HttpTimeout"); }
-	float& HttpConnectionTimeoutField() { return *GetNativePointerField<float*>(this, "FHttpModule.HttpConnectionTimeout"); }
-	float& HttpReceiveTimeoutField() { return *GetNativePointerField<float*>(this, "FHttpModule.HttpReceiveTimeout"); }
-	float& HttpSendTimeoutField() { return *GetNativePointerField<float*>(this, "FHttpModule.HttpSendTimeout"); }
-	int& HttpMaxConnectionsPerServerField() { return *GetNativePointerField<int*>(this, "FHttpModule.HttpMaxConnectionsPerServer"); }
-	int& MaxReadBufferSizeField() { return *GetNativePointerField<int*>(this, "FHttpModule.MaxReadBufferSize"); }
-	bool& bEnableHttpField() { return *GetNativePointerField<bool*>(this, "FHttpModule.bEnableHttp"); }
+	//FHttpManager * HttpManagerField() { return *GetNativePointerField<FHttpManager **, API::FieldNameHash("FHttpModule.HttpManager")>(this, "FHttpModule.HttpManager"); }
+	float& HttpTimeoutField() { return *GetNativePointerField<float*, API::FieldNameHash("FHttpModule.HttpTimeout")>(this, "FHttpModule.HttpTimeout"); }
+	float& HttpConnectionTimeoutField() { return *GetNativePointerField<float*, API::FieldNameHash("FHttpModule.HttpConnectionTimeout")>(this, "FHttpModule.HttpConnectionTimeout"); }
+	float& HttpReceiveTimeoutField() { return *GetNativePointerField<float*, API::FieldNameHash("FHttpModule.HttpReceiveTimeout")>(this, "FHttpModule.HttpReceiveTimeout"); }
+	float& HttpSendTimeoutField() { return *GetNativePointerField<float*, API::FieldNameHash("FHttpModule.HttpSendTimeout")>(this, "FHttpModule.HttpSendTimeout"); }
+	int& HttpMaxConnectionsPerServerField() { return *GetNativePointerField<int*, API::FieldNameHash("FHttpModule.HttpMaxConnectionsPerServer")>(this, "FHttpModule.HttpMaxConnectionsPerServer"); }
+	int& MaxReadBufferSizeField() { return *GetNativePointerField<int*, API::FieldNameHash("FHttpModule.MaxReadBufferSize")>(this, "FHttpModule.MaxReadBufferSize"); }
+	bool& bEnableHttpField() { return *GetNativePointerField<bool*, API::FieldNameHash("FHttpModule.bEnableHttp")>(this, "FHttpModule.bEnableHttp"); }
 
 	// Functions
 
@@ -68,6 +68,23 @@ namespace ArkApi
 			                                                      nullptr);
 		}
 
+		/**
+		* \brief Sends an already built notification (on-screen message) to the specific player.
+		* The text is not formatted or copied, so a message kept by the caller can be sent any number of times.
+		* \param player_controller Player
+		* \param color Message color
+		* \param display_scale Size of text
+		* \param display_time Display time
+		* \param icon Message icon (optional)
+		* \param text Message, only read by the engine
+		*/
+		void SendNotification(AShooterPlayerController* player_controller, FLinearColor color, float display_scale,
+		                      float display_time, UTexture2D* icon, const FString& text) const
+		{
+			player_controller->ClientServerSOTFNotificationCustom(const_cast<FString*>(&text), color, display_scale,
+			                                                      display_time, icon, nullptr);
+		}
+
 		/**
 		 * \brief Sends chat message to the specific player. Using fmt::format.
 		 * \tparam T Either a a char or wchar_t
@@ -104,6 +104,59 @@ namespace ArkApi
 		* \return true if success, false otherwise
 		*/
 		virtual bool RemoveOnChatMessageCallback(const FString& id) = 0;
+
+		/**
+		 * \brief Added function will be called once every interval_seconds seconds
+		 * \param id Unique ID
+		 * \param interval_seconds Seconds between calls, 1 is the same as AddOnTimerCallback
+		 * \param callback Callback function
+		 */
+		virtual void AddOnTimerCallbackEvery(const FString& id, unsigned interval_seconds,
+		                                     const std::function<void()>& callback) = 0;
+
+		/**
+		 * \brief Pauses or resumes an on-tick callback without removing it
+		 * \param id Callback ID
+		 * \param enabled false to skip the callback until enabled again
+		 * \return true if success, false otherwise
+		 */
+		virtual bool SetOnTickCallbackEnabled(const FString& id, bool enabled) = 0;
+
+		/**
+		 * \brief Pauses or resumes an on-timer callback without removing it
+		 * \param id Callback ID
+		 * \param enabled false to skip the callback until enabled again
+		 * \return true if success, false otherwise
+		 */
+		virtual bool SetOnTimerCallbackEnabled(const FString& id, bool enabled) = 0;
+
+		/**
+		* \brief Same as AddOnChatMessageCallback, but the callback is only called for messages starting with prefix
+		* \param id Unique ID
+		* \param prefix Case insensitive prefix the message has to start with, e.g. a command prefix
+		* \param callback Callback function
+		*/
+		virtual void AddOnChatMessageCallbackWithPrefix(const FString& id, const FString& prefix,
+		                                                const std::function<bool(AShooterPlayerController*, FString*,
+		                                                                         EChatSendMode::Type, bool, bool)>&
+		                                                callback) = 0;
+
+		/**
+		* \brief Keeps the reply of an rcon command for later, for commands that finish on a later tick or another thread
+		* \param rcon_connection Connection the command came from
+		* \param rcon_packet Packet of the command, its id is the one replied to
+		* \return Id to pass to SendDeferredRconReply
+		*/
+		virtual uint64 DeferRconReply(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet) = 0;
+
+		/**
+		* \brief Replies to a deferred rcon command, can be called from any thread. The reply is sent on the next tick of
+		* the connection and dropped if the connection was closed in the meantime
+		* \param reply_id Id returned by DeferRconReply, every id has to be replied to exactly once
+		* \param message Reply, an empty message only releases the id
+		* \return false if the id is unknown, already replied to or its connection closed
+		*/
+		virtual bool SendDeferredRconReply(uint64 reply_id, const FString& message) = 0;
 	};
 
 	ARK_API ICommands& APIENTRY GetCommands();
@@ -2,8 +2,154 @@
 
 #include <API/Base.h>
 
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 namespace ArkApi
 {
+	/**
+	 * \brief Calls of one handler of a multiplexed hook while profiling is on, see IHooks::SetHookProfiling
+	 */
+	struct HookHandlerStats
+	{
+		uint64 calls{0};
+		// Calls that returned true and skipped the rest
+		uint64 handled{0};
+		// Calls that were timed, every sample_every-th one
+		uint64 sampled{0};
+		uint64 sampled_ns{0};
+		uint64 max_ns{0};
+
+		void Record(std::chrono::steady_clock::time_point start)
+		{
+			const auto ns = static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now() - start).count());
+
+			++sampled;
+			sampled_ns += ns;
+			max_ns = std::max(max_ns, ns);
+		}
+	};
+
+	/**
+	 * \brief Handlers of a multiplexed hook, owned by the API and shared by every plugin that adds one
+	 */
+	struct HookHandlers
+	{
+		// Trampoline to the next detour on the function, or the function itself
+		LPVOID original{nullptr};
+		std::vector<LPVOID> handlers;
+		// Parallel to handlers, only counted while sample_every is above 0
+		std::vector<HookHandlerStats> stats;
+		// The rest of the chain, detours set with SetHook after this one and the function itself
+		HookHandlerStats original_stats;
+		unsigned sample_every{0};
+	};
+
+	/**
+	 * \brief The one detour of a multiplexed function, calls every handler from a flat array
+	 *
+	 * A handler is bool(RT* result, Args...), result is nullptr for void functions. Returning true skips the
+	 * remaining handlers and the original function, the caller then gets *result.
+	 * NameHash is API::FieldNameHash of the function name, so every hooked function gets its own detour.
+	 */
+	template <unsigned long long NameHash, typename RT, typename... Args>
+	struct HookMultiplexer
+	{
+		using Handler = bool(*)(RT*, Args...);
+		using Original = RT(*)(Args...);
+
+		static inline HookHandlers* handlers{nullptr};
+
+		static RT Detour(Args... args)
+		{
+			const std::vector<LPVOID>& list = handlers->handlers;
+
+			if constexpr (std::is_void_v<RT>)
+			{
+				// By index, a handler may remove itself
+				for (size_t i = 0; i < list.size(); ++i)
+				{
+					if (handlers->sample_every != 0
+						    ? ProfileHandler(i, nullptr, args...)
+						    : reinterpret_cast<Handler>(list[i])(nullptr, args...))
+					{
+						return;
+					}
+				}
+
+				CallOriginal(args...);
+			}
+			else
+			{
+				RT result{};
+
+				for (size_t i = 0; i < list.size(); ++i)
+				{
+					if (handlers->sample_every != 0
+						    ? ProfileHandler(i, &result, args...)
+						    : reinterpret_cast<Handler>(list[i])(&result, args...))
+					{
+						return result;
+					}
+				}
+
+				return CallOriginal(args...);
+			}
+		}
+
+	private:
+		static bool ProfileHandler(size_t i, RT* result, Args... args)
+		{
+			const bool sampled = ++handlers->stats[i].calls % handlers->sample_every == 0;
+			const auto start = sampled ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+			const bool handled = reinterpret_cast<Handler>(handlers->handlers[i])(result, args...);
+
+			// Gone when the handler removed itself
+			if (i < handlers->stats.size())
+			{
+				HookHandlerStats& stats = handlers->stats[i];
+				stats.handled += handled ? 1 : 0;
+
+				if (sampled)
+				{
+					stats.Record(start);
+				}
+			}
+
+			return handled;
+		}
+
+		static RT CallOriginal(Args... args)
+		{
+			const auto original = reinterpret_cast<Original>(handlers->original);
+
+			if (handlers->sample_every == 0 || ++handlers->original_stats.calls % handlers->sample_every != 0)
+			{
+				return original(args...);
+			}
+
+			const auto start = std::chrono::steady_clock::now();
+
+			if constexpr (std::is_void_v<RT>)
+			{
+				original(args...);
+				handlers->original_stats.Record(start);
+			}
+			else
+			{
+				RT result = original(args...);
+				handlers->original_stats.Record(start);
+
+				return result;
+			}
+		}
+	};
+
 	class ARK_API IHooks
 	{
 	public:
@@ -30,10 +176,85 @@ namespace ArkApi
 		 */
 		virtual bool DisableHook(const std::string& func_name, LPVOID detour) = 0;
 
+		/**
+		* \brief Adds a handler to the multiplexed hook of a function, see HookMultiplexer.
+		* The function is detoured once however many plugins add handlers, handlers are called in the order added.
+		* \tparam NameHash API::FieldNameHash(func_name)
+		* \param func_name Function full name
+		* \param handler bool(RT* result, Args...) handler
+		* \return true if success, false otherwise
+		*/
+		template <unsigned long long NameHash, typename RT, typename... Args>
+		bool AddHookHandler(const std::string& func_name, bool (*handler)(RT*, Args...))
+		{
+			using Multiplexer = HookMultiplexer<NameHash, RT, Args...>;
+
+			return AddHookHandlerInternal(func_name, reinterpret_cast<LPVOID>(&Multiplexer::Detour),
+			                              reinterpret_cast<LPVOID>(handler), &Multiplexer::handlers);
+		}
+
 	private:
 		virtual bool SetHookInternal(const std::string& func_name, LPVOID detour,
 		                             LPVOID* original) = 0;
+
+		virtual bool AddHookHandlerInternal(const std::string& func_name, LPVOID detour, LPVOID handler,
+		                                    HookHandlers** handlers) = 0;
+
+	public:
+		/**
+		* \brief Removes a handler added with AddHookHandler, the detour goes away with the last handler
+		* \param func_name Function full name
+		* \param handler Handler function
+		* \return true if success, false otherwise
+		*/
+		virtual bool RemoveHookHandler(const std::string& func_name, LPVOID handler) = 0;
+
+		/**
+		* \brief Starts a batch, hooks set or disabled until ApplyBatch are applied together with a single thread
+		* freeze. Batches nest, only the outermost ApplyBatch applies them.
+		*/
+		virtual void BeginBatch() = 0;
+
+		/**
+		* \brief Applies the hooks queued since BeginBatch
+		* \return true if success, false otherwise
+		*/
+		virtual bool ApplyBatch() = 0;
+
+		/**
+		* \brief Counts every call of every multiplexed handler and times one in sample_every of them, 0 turns it off.
+		* Detours set with SetHook are not counted, their time shows as the original of the multiplexed hook they follow
+		*/
+		virtual void SetHookProfiling(unsigned sample_every) = 0;
+
+		/**
+		* \brief Counters of every hooked function by plugin as CSV, one row per handler or detour
+		* \param reset Starts the counters over after reading them
+		*/
+		virtual std::string GetHookProfile(bool reset) = 0;
 	};
 
 	ARK_API IHooks& APIENTRY GetHooks();
+
+	/**
+	 * \brief Batches the hook changes made during its lifetime, see IHooks::BeginBatch
+	 */
+	class HookBatch
+	{
+	public:
+		HookBatch()
+		{
+			GetHooks().BeginBatch();
+		}
+
+		~HookBatch()
+		{
+			GetHooks().ApplyBatch();
+		}
+
+		HookBatch(const HookBatch&) = delete;
+		HookBatch(HookBatch&&) = delete;
+		HookBatch& operator=(const HookBatch&) = delete;
+		HookBatch& operator=(HookBatch&&) = delete;
+	};
 } // namespace ArkApi
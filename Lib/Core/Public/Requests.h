@@ -1,10 +1,13 @@
 #pragma once
 
+#include <deque>
 #include <functional>
 #include <utility>
 
 #include "API/Base.h"
 
+struct curl_slist;
+
 namespace API
 {
 	class Requests
@@ -17,11 +20,34 @@ namespace API
 		Requests& operator=(const Requests&) = delete;
 		Requests& operator=(Requests&&) = delete;
 
+		/**
+		 * \brief Starts a GET request, the callback runs on the game thread once it completes
+		 * \param url Request url
+		 * \param callback Called with success and the response body
+		 * \param headers Extra headers, "Name: value" each
+		 * \return False when the request could not be created
+		 */
 		ARK_API bool CreateGetRequest(const std::string& url, const std::function<void(bool, std::string)>& callback,
 		                              std::vector<std::string> headers = {});
 
+		/**
+		 * \brief Starts a POST request, the callback runs on the game thread once it completes
+		 * \param url Request url
+		 * \param callback Called with success and the response body
+		 * \param post_data Request body, copied so it does not have to outlive the call
+		 * \param headers Extra headers, "Name: value" each
+		 * \return False when the request could not be created
+		 */
 		ARK_API bool CreatePostRequest(const std::string& url, const std::function<void(bool, std::string)>& callback,
 		                               const std::string& post_data, std::vector<std::string> headers = {});
+
+		/**
+		 * \brief Starts a DELETE request, the callback runs on the game thread once it completes
+		 * \param url Request url
+		 * \param callback Called with success and the response body
+		 * \param headers Extra headers, "Name: value" each
+		 * \return False when the request could not be created
+		 */
 		ARK_API bool CreateDeleteRequest(const std::string& url, const std::function<void(bool, std::string)>& callback,
 		                                 std::vector<std::string> headers = {});
 
@@ -38,16 +64,29 @@ namespace API
 
 			std::function<void(bool, std::string)> callback;
 			std::string read_buffer;
+			curl_slist* headers{};
 		};
 
+		// Requests past this wait in pending_ until a transfer finishes
+		static constexpr size_t max_in_flight_ = 16;
+		// Connections kept open per host for reuse
+		static constexpr long max_host_connections_ = 4;
+
 		Requests();
 		~Requests();
 
+		CURL* CreateRequest(const std::string& url, const std::function<void(bool, std::string)>& callback,
+		                    const std::vector<std::string>& headers);
+		bool StartRequest(CURL* handle);
+		void FinishRequest(CURL* handle, bool success);
+
 		static size_t WriteCallback(void* contents, size_t size, size_t nmemb, void* userp);
 		void Update();
 
 		CURLM* curl_;
 		int handles_count_{};
+		size_t in_flight_{};
+		std::deque<CURL*> pending_;
 		std::unordered_map<CURL*, std::unique_ptr<Request>> requests_;
 	};
 } // namespace API
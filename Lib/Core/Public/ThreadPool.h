@@ -0,0 +1,83 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include "API/Base.h"
+
+namespace API
+{
+	class ThreadPool
+	{
+	public:
+		ARK_API static ThreadPool& Get();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool(ThreadPool&&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+		ThreadPool& operator=(ThreadPool&&) = delete;
+
+		/**
+		 * \brief Runs function on one of the shared worker threads
+		 * \param owner Plugin name, its tasks are cancelled when the plugin is unloaded
+		 * \param task Task function, must not touch game objects
+		 */
+		ARK_API void Submit(const std::string& owner, const std::function<void()>& task);
+
+		/**
+		 * \brief Drops queued tasks of the owner and waits for the running ones to return
+		 * \param owner Plugin name
+		 */
+		ARK_API void Cancel(const std::string& owner);
+
+		/**
+		 * \brief Returns true while the owner is being cancelled, long running tasks should check it and return early
+		 * \param owner Plugin name
+		 */
+		ARK_API bool IsCancelled(const std::string& owner);
+
+		/**
+		 * \brief Sets the Win32 priority and affinity of the workers, each worker applies it before its next task
+		 * \param priority THREAD_PRIORITY_* value
+		 * \param affinity_mask Cores the workers may run on, 0 leaves them on all cores
+		 */
+		ARK_API void SetWorkerPriority(int priority, unsigned long long affinity_mask);
+
+	private:
+		struct Task
+		{
+			std::string owner;
+			std::function<void()> callback;
+		};
+
+		struct OwnerState
+		{
+			int running{0};
+			bool cancelled{false};
+		};
+
+		ThreadPool() = default;
+		~ThreadPool();
+
+		void StartWorkers();
+		void Run();
+
+		std::mutex mutex_;
+		std::condition_variable queue_cv_;
+		std::condition_variable idle_cv_;
+		std::deque<Task> queue_;
+		std::unordered_map<std::string, OwnerState> owners_;
+		std::vector<std::thread> workers_;
+		int priority_{0};
+		unsigned long long affinity_mask_{0};
+		// Bumped by SetWorkerPriority, a worker that saw an older one applies the settings again
+		unsigned priority_version_{0};
+		bool stop_{false};
+	};
+} // namespace API
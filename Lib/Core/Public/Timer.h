@@ -2,6 +2,11 @@
 
 #include <functional>
 #include <chrono>
+#include <array>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <string>
 
 #include "API/Base.h"
 
@@ -38,7 +43,7 @@ namespace API
 		 * \param callback Callback function
 		 * \param execution_interval Delay between executions in seconds
 		 * \param execution_counter Amount of times to execute function, -1 for unlimited
-		 * \param async If true, function will be executed in the new thread
+		 * \param async If true, function will be executed on the shared thread pool, an execution is skipped while the previous one still runs
 		 * \param args Callback arguments
 		 */
 		template <typename Func, typename... Args>
@@ -49,27 +54,51 @@ namespace API
 			                         execution_counter, async);
 		}
 
+		/**
+		 * \brief Removes every pending function of the plugin, called by the plugin manager before unloading it
+		 * \param owner Plugin name
+		 */
+		void RemoveTasks(const std::string& owner);
+
 	private:
 		struct TimerFunc
 		{
-			TimerFunc(const std::chrono::time_point<std::chrono::system_clock>& next_time,
+			TimerFunc(uint64_t expire_tick,
 			          std::function<void()> callback,
-			          bool exec_once, int execution_counter, int execution_interval)
-				: next_time(next_time),
+			          bool exec_once, int execution_counter, int execution_interval,
+			          std::string owner, bool async)
+				: expire_tick(expire_tick),
 				  callback(move(callback)),
 				  exec_once(exec_once),
 				  execution_counter(execution_counter),
-				  execution_interval(execution_interval)
+				  execution_interval(execution_interval),
+				  owner(move(owner)),
+				  async(async),
+				  busy(async ? std::make_shared<std::atomic<bool>>(false) : nullptr)
 			{
 			}
 
-			std::chrono::time_point<std::chrono::system_clock> next_time;
+			// Seconds since the timer was created
+			uint64_t expire_tick;
 			std::function<void()> callback;
 			bool exec_once;
 			int execution_counter;
 			int execution_interval;
+			// Plugin that scheduled it
+			std::string owner;
+			bool async;
+			// Set while an async execution is running on the thread pool
+			std::shared_ptr<std::atomic<bool>> busy;
 		};
 
+		using Slot = std::vector<std::unique_ptr<TimerFunc>>;
+
+		// 64 one second slots, then 64 slots of 64 seconds, then 64 slots of 4096 seconds (~3 days)
+		static constexpr unsigned wheel_bits = 6;
+		static constexpr uint64_t wheel_size = 1ull << wheel_bits;
+		static constexpr uint64_t wheel_mask = wheel_size - 1;
+		static constexpr unsigned wheel_levels = 3;
+
 		Timer();
 		~Timer();
 
@@ -79,6 +108,16 @@ namespace API
 
 		void Update();
 
-		std::vector<std::unique_ptr<TimerFunc>> timer_funcs_;
+		uint64_t GetElapsedTicks() const;
+		void Schedule(std::unique_ptr<TimerFunc> func);
+		void Cascade(unsigned level);
+		void Advance(uint64_t now_tick);
+
+		std::chrono::steady_clock::time_point start_time_;
+		uint64_t current_tick_;
+
+		std::array<std::array<Slot, wheel_size>, wheel_levels> wheels_;
+		// Further away than the last level, re-sorted every time it wraps
+		Slot overflow_;
 	};
 } // namespace API
@@ -3,6 +3,7 @@
 #include <API/Base.h>
 
 #include <string>
+#include <string_view>
 
 namespace ArkApi::Tools
 {
@@ -16,11 +17,26 @@ namespace ArkApi::Tools
 	 */
 	ARK_API std::string Utf8Encode(const std::wstring& wstr);
 
+	/**
+	 * \brief Converts a wide Unicode string to an UTF8 string in out, reusing its buffer
+	 *
+	 * ASCII text is narrowed 16 characters at a time, whatever follows the first other character takes one
+	 * WideCharToMultiByte call. Meant for callers that convert often and keep out between calls.
+	 */
+	ARK_API void Utf8Encode(std::wstring_view wstr, std::string& out);
+
 	/**
 	 * \brief Converts an UTF8 string to a wide Unicode String
 	 */
 	ARK_API std::wstring Utf8Decode(const std::string& str);
 
+	/**
+	 * \brief Converts an UTF8 string to a wide Unicode string in out, reusing its buffer
+	 *
+	 * Same as Utf8Encode(wstr, out), ASCII is widened 16 bytes at a time and the rest takes one MultiByteToWideChar call.
+	 */
+	ARK_API void Utf8Decode(std::string_view str, std::wstring& out);
+
 	/**
 	 * \brief Returns true if plugin was loaded, false otherwise
 	 */
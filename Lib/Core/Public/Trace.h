@@ -0,0 +1,95 @@
+#pragma once
+
+// Optional profiler zones. Nothing is emitted and no code is generated unless the module being built defines
+// ARK_TRACE_TRACY or ARK_TRACE_ETW.
+//
+// ARK_TRACE_TRACY opens Tracy zones. Tracy's public headers have to be on the include path. Modules other than the one
+// building TracyClient.cpp also define TRACY_IMPORTS, so that every dll reports to the same profiler.
+//
+// ARK_TRACE_ETW writes TraceLogging start/stop events that WPA shows as regions. Each module expands
+// ARK_TRACE_DEFINE_PROVIDER once in a cpp file with its own name and guid and calls API::Trace::Register on load.
+
+#if defined(ARK_TRACE_TRACY)
+
+#include <tracy/Tracy.hpp>
+
+#define ARK_TRACE_ZONE(name) ZoneScopedN(name)
+#define ARK_TRACE_DEFINE_PROVIDER(provider_name, guid)
+
+namespace API::Trace
+{
+	inline void Register()
+	{
+	}
+
+	inline void Unregister()
+	{
+	}
+} // namespace API::Trace
+
+#elif defined(ARK_TRACE_ETW)
+
+#include <windows.h>
+#include <TraceLoggingProvider.h>
+
+TRACELOGGING_DECLARE_PROVIDER(ark_trace_provider);
+
+#define ARK_TRACE_DEFINE_PROVIDER(provider_name, guid) TRACELOGGING_DEFINE_PROVIDER(ark_trace_provider, provider_name, guid)
+
+namespace API::Trace
+{
+	inline void Register()
+	{
+		TraceLoggingRegister(ark_trace_provider);
+	}
+
+	// Before the module is unloaded
+	inline void Unregister()
+	{
+		TraceLoggingUnregister(ark_trace_provider);
+	}
+
+	// Start and stop event around the enclosing scope. Without a listening session each event costs one test of the provider's enabled flag
+	class Zone
+	{
+	public:
+		explicit Zone(const char* name)
+			: name_(name)
+		{
+			TraceLoggingWrite(ark_trace_provider, "Zone", TraceLoggingOpcode(WINEVENT_OPCODE_START), TraceLoggingString(name_, "Name"));
+		}
+
+		~Zone()
+		{
+			TraceLoggingWrite(ark_trace_provider, "Zone", TraceLoggingOpcode(WINEVENT_OPCODE_STOP), TraceLoggingString(name_, "Name"));
+		}
+
+		Zone(const Zone&) = delete;
+		Zone& operator=(const Zone&) = delete;
+
+	private:
+		const char* name_;
+	};
+} // namespace API::Trace
+
+#define ARK_TRACE_JOIN_IMPL(a, b) a##b
+#define ARK_TRACE_JOIN(a, b) ARK_TRACE_JOIN_IMPL(a, b)
+#define ARK_TRACE_ZONE(name) const API::Trace::Zone ARK_TRACE_JOIN(ark_trace_zone_, __LINE__)(name)
+
+#else
+
+#define ARK_TRACE_ZONE(name)
+#define ARK_TRACE_DEFINE_PROVIDER(provider_name, guid)
+
+namespace API::Trace
+{
+	inline void Register()
+	{
+	}
+
+	inline void Unregister()
+	{
+	}
+} // namespace API::Trace
+
+#endif
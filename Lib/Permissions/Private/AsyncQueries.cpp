@@ -0,0 +1,167 @@
+#include "AsyncQueries.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace Permissions::Async
+{
+	struct Job
+	{
+		FString id;
+		std::function<void(IDatabase&)> work;
+		std::function<void()> done;
+		bool finished = false;
+		bool cancelled = false;
+	};
+
+	std::vector<std::thread> threads;
+	std::mutex mutex;
+	std::condition_variable cv;
+	// Every job not yet delivered, in queue order
+	std::deque<std::shared_ptr<Job>> jobs;
+	// Jobs no worker has picked up yet
+	std::deque<std::shared_ptr<Job>> queued;
+	bool running = false;
+	bool stop = false;
+
+	void Run()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+
+		while (true)
+		{
+			cv.wait(lock, [] { return stop || !queued.empty(); });
+
+			if (stop)
+				break;
+
+			std::shared_ptr<Job> job = queued.front();
+			queued.pop_front();
+
+			if (!job->cancelled)
+			{
+				lock.unlock();
+
+				try
+				{
+					job->work(*async_database);
+				}
+				catch (const std::exception& exception)
+				{
+					Log::GetLog()->error("({} {}) Async query failed {}", __FILE__, __FUNCTION__, exception.what());
+				}
+
+				lock.lock();
+			}
+
+			job->finished = true;
+		}
+	}
+
+	void Deliver(float)
+	{
+		std::vector<std::shared_ptr<Job>> finished;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			while (!jobs.empty() && jobs.front()->finished)
+			{
+				finished.push_back(jobs.front());
+				jobs.pop_front();
+			}
+		}
+
+		for (const auto& job : finished)
+		{
+			if (!job->cancelled && job->done)
+				job->done();
+		}
+	}
+
+	void Start(int thread_count)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		if (running || !async_database)
+			return;
+
+		running = true;
+		stop = false;
+
+		for (int i = 0; i < std::max(thread_count, 1); ++i)
+		{
+			threads.emplace_back(&Run);
+		}
+
+		ArkApi::GetCommands().AddOnTickCallback("Permissions.AsyncQueries", &Deliver);
+	}
+
+	void Stop()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			if (!running)
+				return;
+
+			running = false;
+			stop = true;
+			jobs.clear();
+			queued.clear();
+		}
+		cv.notify_all();
+
+		ArkApi::GetCommands().RemoveOnTickCallback("Permissions.AsyncQueries");
+
+		// Called from DllMain, joining here would deadlock on the loader lock
+		for (auto& thread : threads)
+		{
+			if (thread.joinable())
+				thread.detach();
+		}
+		threads.clear();
+
+		// A worker may still be inside a query, so the connection is leaked instead of destroyed under it
+		async_database.release();
+	}
+
+	void Queue(const FString& id, std::function<void(IDatabase&)> work, std::function<void()> done)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+
+			if (running)
+			{
+				auto job = std::make_shared<Job>();
+				job->id = id;
+				job->work = move(work);
+				job->done = move(done);
+
+				jobs.push_back(job);
+				queued.push_back(job);
+
+				lock.unlock();
+				cv.notify_one();
+				return;
+			}
+		}
+
+		// No worker, run it in place on the game thread connection
+		work(*database);
+		if (done)
+			done();
+	}
+
+	void Cancel(const FString& id)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		for (const auto& job : jobs)
+		{
+			if (job->id == id)
+				job->cancelled = true;
+		}
+	}
+}
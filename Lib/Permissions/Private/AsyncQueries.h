@@ -0,0 +1,17 @@
+#pragma once
+
+#include <functional>
+
+#include "Main.h"
+
+namespace Permissions::Async
+{
+	void Start(int threads);
+	void Stop();
+
+	// work runs on a worker thread with async_database, done runs on the game thread.
+	// done callbacks are called in the order the jobs were queued, even with several workers
+	void Queue(const FString& id, std::function<void(IDatabase&)> work, std::function<void()> done);
+	// Pending work for this id is skipped and its done callbacks are never called
+	void Cancel(const FString& id);
+}
@@ -6,6 +6,8 @@
 #include "../Public/AtlasPermissions.h"
 #endif
 
+#include <unordered_map>
+
 class IDatabase
 {
 public:
@@ -15,6 +17,10 @@ public:
 	virtual bool IsPlayerExists(uint64 steam_id) = 0;
 	virtual bool IsGroupExists(const FString& group) = 0;
 	virtual TArray<FString> GetPlayerGroups(uint64 steam_id) = 0;
+	// Adds the player when there is no row yet, known players cost a single query. Empty on a database error
+	virtual std::optional<TArray<FString>> UpsertPlayerAndGetGroups(uint64 steam_id) = 0;
+	virtual TMap<uint64, TArray<FString>> GetPlayersGroups(const TArray<uint64>& steam_ids) = 0;
+	virtual std::unordered_map<uint64, TArray<FString>> GetAllPlayersGroups() = 0;
 	virtual TArray<FString> GetGroupPermissions(const FString& group) = 0;
 	virtual TArray<FString> GetAllGroups() = 0;
 	virtual TArray<uint64> GetGroupMembers(const FString& group) = 0;
@@ -4,15 +4,23 @@
 
 #include "IDatabase.h"
 
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <tuple>
+
 #pragma comment(lib, "mysqlclient.lib")
 
 class MySql : public IDatabase
 {
 public:
 	explicit MySql(std::string server, std::string username, std::string password, std::string db_name,
-	               std::string table_players, std::string table_groups)
+	               std::string table_players, std::string table_groups, std::string table_player_groups,
+	               int pool_size = 1)
 		: table_players_(move(table_players)),
-		  table_groups_(move(table_groups))
+		  table_groups_(move(table_groups)),
+		  table_player_groups_(move(table_player_groups))
 	{
 		try
 		{
@@ -24,34 +32,54 @@ public:
 			options.autoreconnect = true;
 			options.timeout = 30;
 
-			bool result = db_.open(options);
-			if (!result)
+			for (int i = 0; i < std::max(pool_size, 1); ++i)
 			{
-				Log::GetLog()->critical("Failed to open connection!");
-				return;
+				auto connection = std::make_unique<daotk::mysql::connection>();
+				if (!connection->open(options))
+				{
+					Log::GetLog()->critical("Failed to open connection!");
+					break;
+				}
+
+				auto slot = std::make_unique<PoolSlot>();
+				slot->connection = move(connection);
+
+				idle_connections_.push_back(slot.get());
+				connections_.push_back(move(slot));
 			}
 
-			result = db_.query(fmt::format("CREATE TABLE IF NOT EXISTS {} ("
+			if (connections_.empty())
+				return;
+
+			BuildStatements();
+
+			bool result = Connection()->query(fmt::format("CREATE TABLE IF NOT EXISTS {} ("
 			                               "Id INT NOT NULL AUTO_INCREMENT,"
 			                               "SteamId BIGINT(11) NOT NULL,"
-			                               "PermissionGroups VARCHAR(256) NOT NULL DEFAULT 'Default,',"
+			                               "PermissionGroups VARCHAR(256) NOT NULL DEFAULT '',"
 			                               "PRIMARY KEY(Id),"
 			                               "UNIQUE INDEX SteamId_UNIQUE (SteamId ASC));", table_players_));
-			result |= db_.query(fmt::format("CREATE TABLE IF NOT EXISTS {} ("
+			result |= Connection()->query(fmt::format("CREATE TABLE IF NOT EXISTS {} ("
 			                                "Id INT NOT NULL AUTO_INCREMENT,"
 			                                "GroupName VARCHAR(128) NOT NULL,"
 			                                "Permissions VARCHAR(768) NOT NULL DEFAULT '',"
 			                                "PRIMARY KEY(Id),"
 			                                "UNIQUE INDEX GroupName_UNIQUE (GroupName ASC));", table_groups_));
+			// One row per membership, PermissionGroups is only read by the migration
+			result |= Connection()->query(fmt::format("CREATE TABLE IF NOT EXISTS {} ("
+			                                "SteamId BIGINT(11) NOT NULL,"
+			                                "GroupId INT NOT NULL,"
+			                                "PRIMARY KEY(SteamId, GroupId),"
+			                                "INDEX GroupId_SteamId (GroupId ASC, SteamId ASC));", table_player_groups_));
 
 			// Add default groups
 
-			result |= db_.query(fmt::format("INSERT INTO {} (GroupName, Permissions)"
+			result |= Connection()->query(fmt::format("INSERT INTO {} (GroupName, Permissions)"
 			                                "SELECT 'Admins', '*,'"
 			                                "WHERE NOT EXISTS(SELECT 1 FROM {} WHERE GroupName = 'Admins');",
 			                                table_groups_,
 			                                table_groups_));
-			result |= db_.query(fmt::format("INSERT INTO {} (GroupName)"
+			result |= Connection()->query(fmt::format("INSERT INTO {} (GroupName)"
 			                                "SELECT 'Default'"
 			                                "WHERE NOT EXISTS(SELECT 1 FROM {} WHERE GroupName = 'Default');",
 			                                table_groups_,
@@ -61,6 +89,8 @@ public:
 			{
 				Log::GetLog()->critical("({} {}) Failed to create table!", __FILE__, __FUNCTION__);
 			}
+
+			MigratePlayerGroups();
 		}
 		catch (const std::exception& exception)
 		{
@@ -72,7 +102,11 @@ public:
 	{
 		try
 		{
-			return db_.query(fmt::format("INSERT INTO {} (SteamId) VALUES ({});", table_players_, steam_id));
+			auto connection = Connection();
+			auto& statement = connection.Statement(StatementId::AddPlayer);
+
+			statement.bind_param(steam_id);
+			return statement.execute() && AddDefaultGroup(connection, steam_id);
 		}
 		catch (const std::exception& exception)
 		{
@@ -85,10 +119,13 @@ public:
 	{
 		try
 		{
-			const auto result = db_.query(fmt::format("SELECT count(1) FROM {} WHERE SteamId = {};", table_players_,
-			                                          steam_id))
-			                       .get_value<int>();
-			return result > 0;
+			auto connection = Connection();
+			auto& statement = connection.Statement(StatementId::IsPlayerExists);
+			int count = 0;
+
+			statement.bind_param(steam_id);
+			statement.bind_result(count);
+			return statement.execute() && statement.fetch() && count > 0;
 		}
 		catch (const std::exception& exception)
 		{
@@ -101,11 +138,15 @@ public:
 	{
 		try
 		{
-			const auto result = db_.query(fmt::format("SELECT count(1) FROM {} WHERE GroupName = '{}';", table_groups_,
-			                                          group.ToString()))
-			                       .get_value<int>();
+			auto connection = Connection();
+			auto& statement = connection.Statement(StatementId::IsGroupExists);
+			int count = 0;
 
-			return result > 0;
+			const std::string group_name = group.ToString();
+
+			statement.bind_param(group_name);
+			statement.bind_result(count);
+			return statement.execute() && statement.fetch() && count > 0;
 		}
 		catch (const std::exception& exception)
 		{
@@ -121,16 +162,19 @@ public:
 
 		try
 		{
-			const auto permission_groups = db_.query(
-				                                  fmt::format(
-					                                  "SELECT PermissionGroups FROM {} WHERE SteamId = {};",
-					                                  table_players_, steam_id))
-			                                  .get_value<daotk::mysql::optional_type<std::string>>();
+			auto connection = Connection();
+			auto& statement = connection.Statement(StatementId::GetPlayerGroups);
+			std::string group;
+
+			statement.bind_param(steam_id);
+			statement.bind_result(group);
 
-			if (permission_groups)
+			if (statement.execute())
 			{
-				FString groups_fstr(*permission_groups);
-				groups_fstr.ParseIntoArray(groups, L",", true);
+				while (statement.fetch())
+				{
+					AddGroupName(groups, group);
+				}
 			}
 		}
 		catch (const std::exception& exception)
@@ -141,6 +185,128 @@ public:
 		return groups;
 	}
 
+	std::optional<TArray<FString>> UpsertPlayerAndGetGroups(uint64 steam_id) override
+	{
+		TArray<FString> groups;
+
+		try
+		{
+			auto connection = Connection();
+
+			for (int attempt = 0; attempt < 2; ++attempt)
+			{
+				auto& select = connection.Statement(StatementId::GetPlayerGroups);
+				std::string group;
+
+				select.bind_param(steam_id);
+				select.bind_result(group);
+
+				if (!select.execute())
+					break;
+
+				// A known player has at least one row, with an empty name when it is in no group
+				bool found = false;
+				while (select.fetch())
+				{
+					found = true;
+					AddGroupName(groups, group);
+				}
+
+				if (found)
+					return groups;
+
+				if (attempt > 0)
+					break;
+
+				// Read back after the insert so the default group is what the caller gets
+				auto& insert = connection.Statement(StatementId::InsertPlayerIfMissing);
+
+				insert.bind_param(steam_id);
+				if (!insert.execute() || !AddDefaultGroup(connection, steam_id))
+					break;
+			}
+		}
+		catch (const std::exception& exception)
+		{
+			Log::GetLog()->error("({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+		}
+
+		return {};
+	}
+
+	TMap<uint64, TArray<FString>> GetPlayersGroups(const TArray<uint64>& steam_ids) override
+	{
+		TMap<uint64, TArray<FString>> players_groups;
+
+		if (steam_ids.Num() == 0)
+			return players_groups;
+
+		try
+		{
+			auto connection = Connection();
+			auto& statement = connection.Statement(StatementId::GetPlayersGroups);
+
+			// The statement takes a fixed number of ids, a short batch repeats its last id to fill the rest
+			for (int first = 0; first < steam_ids.Num(); first += static_cast<int>(players_batch_size_))
+			{
+				std::array<uint64, players_batch_size_> batch;
+				for (size_t i = 0; i < players_batch_size_; ++i)
+				{
+					batch[i] = steam_ids[std::min(first + static_cast<int>(i), steam_ids.Num() - 1)];
+				}
+
+				std::apply([&statement](const auto&... ids) { statement.bind_param(ids...); }, batch);
+
+				uint64 steam_id = 0;
+				std::string group;
+				statement.bind_result(steam_id, group);
+
+				if (!statement.execute())
+					continue;
+
+				while (statement.fetch())
+				{
+					AddGroupName(players_groups.FindOrAdd(steam_id), group);
+				}
+			}
+		}
+		catch (const std::exception& exception)
+		{
+			Log::GetLog()->error("({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+		}
+
+		return players_groups;
+	}
+
+	std::unordered_map<uint64, TArray<FString>> GetAllPlayersGroups() override
+	{
+		std::unordered_map<uint64, TArray<FString>> players_groups;
+
+		try
+		{
+			auto connection = Connection();
+			auto& statement = connection.Statement(StatementId::GetAllPlayersGroups);
+			uint64 steam_id = 0;
+			std::string group;
+
+			statement.bind_result(steam_id, group);
+
+			if (statement.execute())
+			{
+				while (statement.fetch())
+				{
+					AddGroupName(players_groups[steam_id], group);
+				}
+			}
+		}
+		catch (const std::exception& exception)
+		{
+			Log::GetLog()->error("({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+		}
+
+		return players_groups;
+	}
+
 	TArray<FString> GetGroupPermissions(const FString& group) override
 	{
 		if (group.IsEmpty())
@@ -150,13 +316,20 @@ public:
 
 		try
 		{
-			const std::string permission_groups = db_.query(fmt::format(
-				                                         "SELECT Permissions FROM {} WHERE GroupName = '{}';",
-				                                         table_groups_, group.ToString()))
-			                                         .get_value<std::string>();
+			auto connection = Connection();
+			auto& statement = connection.Statement(StatementId::GetGroupPermissions);
+			std::string permission_groups;
+
+			const std::string group_name = group.ToString();
+
+			statement.bind_param(group_name);
+			statement.bind_result(permission_groups);
 
-			FString permissions_fstr(permission_groups);
-			permissions_fstr.ParseIntoArray(permissions, L",", true);
+			if (statement.execute() && statement.fetch())
+			{
+				FString permissions_fstr(permission_groups);
+				permissions_fstr.ParseIntoArray(permissions, L",", true);
+			}
 		}
 		catch (const std::exception& exception)
 		{
@@ -172,12 +345,19 @@ public:
 
 		try
 		{
-			db_.query(fmt::format("SELECT GroupName FROM {};", table_groups_))
-			   .each([&all_groups](std::string group)
-			   {
-				   all_groups.Add(group.c_str());
-				   return true;
-			   });
+			auto connection = Connection();
+			auto& statement = connection.Statement(StatementId::GetAllGroups);
+			std::string group;
+
+			statement.bind_result(group);
+
+			if (statement.execute())
+			{
+				while (statement.fetch())
+				{
+					all_groups.Add(group.c_str());
+				}
+			}
 		}
 		catch (const std::exception& exception)
 		{
@@ -193,14 +373,22 @@ public:
 
 		try
 		{
-			db_.query(fmt::format("SELECT SteamId FROM {};", table_players_))
-			   .each([&members, &group](uint64 steam_id)
-			   {
-				   if (Permissions::IsPlayerInGroup(steam_id, group))
-					   members.Add(steam_id);
+			auto connection = Connection();
+			auto& statement = connection.Statement(StatementId::GetGroupMembers);
+			uint64 steam_id = 0;
 
-				   return true;
-			   });
+			const std::string group_name = group.ToString();
+
+			statement.bind_param(group_name);
+			statement.bind_result(steam_id);
+
+			if (statement.execute())
+			{
+				while (statement.fetch())
+				{
+					members.Add(steam_id);
+				}
+			}
 		}
 		catch (const std::exception& exception)
 		{
@@ -223,10 +411,13 @@ public:
 
 		try
 		{
-			const bool res = db_.query(fmt::format(
-				"UPDATE {} SET PermissionGroups = concat(PermissionGroups, '{},') WHERE SteamId = {};",
-				table_players_, group.ToString(), steam_id));
-			if (!res)
+			auto connection = Connection();
+			auto& statement = connection.Statement(StatementId::AddPlayerToGroup);
+
+			const std::string group_name = group.ToString();
+
+			statement.bind_param(steam_id, group_name);
+			if (!statement.execute())
 			{
 				return "Unexpected DB error";
 			}
@@ -248,21 +439,15 @@ public:
 		if (!Permissions::IsPlayerInGroup(steam_id, group))
 			return "Player is not in group";
 
-		TArray<FString> groups = GetPlayerGroups(steam_id);
-
-		FString new_groups;
-
-		for (const FString& current_group : groups)
-		{
-			if (current_group != group)
-				new_groups += current_group + ",";
-		}
-
 		try
 		{
-			const bool res = db_.query(fmt::format("UPDATE {} SET PermissionGroups = '{}' WHERE SteamId = {};",
-			                                       table_players_, new_groups.ToString(), steam_id));
-			if (!res)
+			auto connection = Connection();
+			auto& statement = connection.Statement(StatementId::RemovePlayerFromGroup);
+
+			const std::string group_name = group.ToString();
+
+			statement.bind_param(steam_id, group_name);
+			if (!statement.execute())
 			{
 				return "Unexpected DB error";
 			}
@@ -283,9 +468,13 @@ public:
 
 		try
 		{
-			const bool res = db_.query(fmt::format("INSERT INTO {} (GroupName) VALUES ('{}');", table_groups_,
-			                                       group.ToString()));
-			if (!res)
+			auto connection = Connection();
+			auto& statement = connection.Statement(StatementId::AddGroup);
+
+			const std::string group_name = group.ToString();
+
+			statement.bind_param(group_name);
+			if (!statement.execute())
 			{
 				return "Unexpected DB error";
 			}
@@ -304,21 +493,28 @@ public:
 		if (!IsGroupExists(group))
 			return "Group does not exist";
 
-		// Remove all players from this group
-
-		TArray<uint64> group_members = GetGroupMembers(group);
-		for (uint64 player : group_members)
+		try
 		{
-			RemovePlayerFromGroup(player, group);
-		}
+			auto connection = Connection();
 
-		// Delete group
+			const std::string group_name = group.ToString();
 
-		try
-		{
-			const bool res = db_.query(fmt::format("DELETE FROM {} WHERE GroupName = '{}';", table_groups_,
-			                                       group.ToString()));
-			if (!res)
+			// Remove all players from this group
+
+			auto& members = connection.Statement(StatementId::RemoveGroupMembers);
+
+			members.bind_param(group_name);
+			if (!members.execute())
+			{
+				return "Unexpected DB error";
+			}
+
+			// Delete group
+
+			auto& statement = connection.Statement(StatementId::RemoveGroup);
+
+			statement.bind_param(group_name);
+			if (!statement.execute())
 			{
 				return "Unexpected DB error";
 			}
@@ -342,10 +538,14 @@ public:
 
 		try
 		{
-			const bool res = db_.query(fmt::format(
-				"UPDATE {} SET Permissions = concat(Permissions, '{},') WHERE GroupName = '{}';",
-				table_groups_, permission.ToString(), group.ToString()));
-			if (!res)
+			auto connection = Connection();
+			auto& statement = connection.Statement(StatementId::AppendGroupPermission);
+
+			const std::string appended = permission.ToString() + ",";
+			const std::string group_name = group.ToString();
+
+			statement.bind_param(appended, group_name);
+			if (!statement.execute())
 			{
 				return "Unexpected DB error";
 			}
@@ -379,9 +579,14 @@ public:
 
 		try
 		{
-			const bool res = db_.query(fmt::format("UPDATE {} SET Permissions = '{}' WHERE GroupName = '{}';",
-			                                       table_groups_, new_permissions.ToString(), group.ToString()));
-			if (!res)
+			auto connection = Connection();
+			auto& statement = connection.Statement(StatementId::SetGroupPermissions);
+
+			const std::string permissions_text = new_permissions.ToString();
+			const std::string group_name = group.ToString();
+
+			statement.bind_param(permissions_text, group_name);
+			if (!statement.execute())
 			{
 				return "Unexpected DB error";
 			}
@@ -396,7 +601,232 @@ public:
 	}
 
 private:
-	daotk::mysql::connection db_;
+	enum class StatementId
+	{
+		AddPlayer,
+		IsPlayerExists,
+		IsGroupExists,
+		GetPlayerGroups,
+		InsertPlayerIfMissing,
+		GetPlayersGroups,
+		GetAllPlayersGroups,
+		GetGroupPermissions,
+		GetAllGroups,
+		GetGroupMembers,
+		AddPlayerToGroup,
+		AddDefaultGroup,
+		RemovePlayerFromGroup,
+		AddGroup,
+		RemoveGroupMembers,
+		RemoveGroup,
+		AppendGroupPermission,
+		SetGroupPermissions,
+		Count
+	};
+
+	static constexpr size_t statement_count_ = static_cast<size_t>(StatementId::Count);
+	// Ids bound per GetPlayersGroups round trip
+	static constexpr size_t players_batch_size_ = 32;
+
+	// Server side statements belong to a connection, so every pooled connection prepares its own on first use
+	struct PoolSlot
+	{
+		std::unique_ptr<daotk::mysql::connection> connection;
+		std::array<std::unique_ptr<daotk::mysql::prepared_stmt>, statement_count_> statements;
+	};
+
+	// Table names are identifiers and can't be bound, they are part of the text prepared once per connection
+	void BuildStatements()
+	{
+		std::string players_in;
+		for (size_t i = 0; i < players_batch_size_; ++i)
+		{
+			players_in += i == 0 ? "?" : ",?";
+		}
+
+		const auto set = [this](StatementId id, std::string sql)
+		{
+			statement_sql_[static_cast<size_t>(id)] = move(sql);
+		};
+
+		set(StatementId::AddPlayer, fmt::format("INSERT INTO {} (SteamId) VALUES (?);", table_players_));
+		set(StatementId::IsPlayerExists, fmt::format("SELECT count(1) FROM {} WHERE SteamId = ?;", table_players_));
+		set(StatementId::IsGroupExists, fmt::format("SELECT count(1) FROM {} WHERE GroupName = ?;", table_groups_));
+		// A known player in no group gets a single row with an empty name, so these also tell players that exist
+		const std::string player_groups = fmt::format("SELECT p.SteamId, COALESCE(g.GroupName, '') FROM {} p "
+		                                              "LEFT JOIN {} pg ON pg.SteamId = p.SteamId LEFT JOIN {} g ON g.Id = pg.GroupId",
+		                                              table_players_, table_player_groups_, table_groups_);
+		const std::string group_id = fmt::format("SELECT Id FROM {} WHERE GroupName = ?", table_groups_);
+
+		set(StatementId::GetPlayerGroups, fmt::format("SELECT COALESCE(g.GroupName, '') FROM {} p "
+		                                              "LEFT JOIN {} pg ON pg.SteamId = p.SteamId LEFT JOIN {} g ON g.Id = pg.GroupId "
+		                                              "WHERE p.SteamId = ?;", table_players_, table_player_groups_, table_groups_));
+		set(StatementId::InsertPlayerIfMissing, fmt::format("INSERT IGNORE INTO {} (SteamId) VALUES (?);", table_players_));
+		set(StatementId::GetPlayersGroups, fmt::format("{} WHERE p.SteamId IN ({});", player_groups, players_in));
+		set(StatementId::GetAllPlayersGroups, player_groups + ";");
+		set(StatementId::GetGroupPermissions, fmt::format("SELECT Permissions FROM {} WHERE GroupName = ?;", table_groups_));
+		set(StatementId::GetAllGroups, fmt::format("SELECT GroupName FROM {};", table_groups_));
+		set(StatementId::GetGroupMembers, fmt::format("SELECT SteamId FROM {} WHERE GroupId IN ({});", table_player_groups_, group_id));
+		set(StatementId::AddPlayerToGroup, fmt::format("INSERT IGNORE INTO {} (SteamId, GroupId) SELECT ?, Id FROM {} WHERE GroupName = ?;",
+		                                               table_player_groups_, table_groups_));
+		set(StatementId::AddDefaultGroup, fmt::format("INSERT IGNORE INTO {} (SteamId, GroupId) SELECT ?, Id FROM {} WHERE GroupName = 'Default';",
+		                                              table_player_groups_, table_groups_));
+		set(StatementId::RemovePlayerFromGroup, fmt::format("DELETE FROM {} WHERE SteamId = ? AND GroupId IN ({});", table_player_groups_, group_id));
+		set(StatementId::AddGroup, fmt::format("INSERT INTO {} (GroupName) VALUES (?);", table_groups_));
+		set(StatementId::RemoveGroupMembers, fmt::format("DELETE FROM {} WHERE GroupId IN ({});", table_player_groups_, group_id));
+		set(StatementId::RemoveGroup, fmt::format("DELETE FROM {} WHERE GroupName = ?;", table_groups_));
+		set(StatementId::AppendGroupPermission, fmt::format("UPDATE {} SET Permissions = concat(Permissions, ?) WHERE GroupName = ?;", table_groups_));
+		set(StatementId::SetGroupPermissions, fmt::format("UPDATE {} SET Permissions = ? WHERE GroupName = ?;", table_groups_));
+	}
+
+	// Borrows a pooled connection until it goes out of scope, so one MySql can be shared between threads
+	class PooledConnection
+	{
+	public:
+		PooledConnection(MySql& owner, PoolSlot* slot)
+			: owner_(owner),
+			  slot_(slot),
+			  exceptions_(std::uncaught_exceptions())
+		{
+		}
+
+		~PooledConnection()
+		{
+			// A statement that threw may belong to a connection that was reset, prepare it again on next use
+			if (used_ && std::uncaught_exceptions() > exceptions_)
+			{
+				slot_->statements[*used_].reset();
+			}
+
+			owner_.ReleaseConnection(slot_);
+		}
+
+		PooledConnection(const PooledConnection&) = delete;
+		PooledConnection& operator=(const PooledConnection&) = delete;
+
+		daotk::mysql::connection* operator->() const
+		{
+			return slot_->connection.get();
+		}
+
+		daotk::mysql::prepared_stmt& Statement(StatementId id)
+		{
+			const auto index = static_cast<size_t>(id);
+			auto& statement = slot_->statements[index];
+
+			used_ = index;
+
+			if (!statement)
+			{
+				statement = std::make_unique<daotk::mysql::prepared_stmt>(*slot_->connection, owner_.statement_sql_[index]);
+			}
+
+			return *statement;
+		}
+
+	private:
+		MySql& owner_;
+		PoolSlot* slot_;
+		int exceptions_;
+		std::optional<size_t> used_;
+	};
+
+	static void AddGroupName(TArray<FString>& groups, const std::string& group)
+	{
+		if (!group.empty())
+			groups.Add(group.c_str());
+	}
+
+	// New players start in the default group
+	bool AddDefaultGroup(PooledConnection& connection, uint64 steam_id)
+	{
+		auto& statement = connection.Statement(StatementId::AddDefaultGroup);
+
+		statement.bind_param(steam_id);
+		return statement.execute();
+	}
+
+	// Older tables keep memberships in PermissionGroups. They are moved into the membership table and the column
+	// is emptied afterwards, so a migration that stopped halfway runs again on the next start
+	void MigratePlayerGroups()
+	{
+		auto connection = Connection();
+
+		connection->query(fmt::format("ALTER TABLE {} ALTER PermissionGroups SET DEFAULT '';", table_players_));
+
+		std::vector<std::pair<uint64, std::string>> players;
+		connection->query(fmt::format("SELECT SteamId, PermissionGroups FROM {} WHERE PermissionGroups <> '';", table_players_))
+			.each([&players](uint64 steam_id, std::string permission_groups)
+			{
+				players.emplace_back(steam_id, move(permission_groups));
+				return true;
+			});
+
+		if (players.empty())
+			return;
+
+		auto& statement = connection.Statement(StatementId::AddPlayerToGroup);
+		bool result = true;
+
+		for (const auto& player : players)
+		{
+			FString groups_fstr(player.second);
+
+			TArray<FString> groups;
+			groups_fstr.ParseIntoArray(groups, L",", true);
+
+			// Names without a row in the groups table are dropped, no permission could be granted to them
+			for (const FString& group : groups)
+			{
+				const std::string group_name = group.ToString();
+
+				statement.bind_param(player.first, group_name);
+				result &= statement.execute();
+			}
+		}
+
+		if (!result)
+		{
+			Log::GetLog()->error("({} {}) Failed to move player groups into {}", __FILE__, __FUNCTION__, table_player_groups_);
+			return;
+		}
+
+		connection->query(fmt::format("UPDATE {} SET PermissionGroups = '' WHERE PermissionGroups <> '';", table_players_));
+
+		Log::GetLog()->info("Moved the groups of {} players into {}", players.size(), table_player_groups_);
+	}
+
+	PooledConnection Connection()
+	{
+		std::unique_lock<std::mutex> lock(pool_mutex_);
+
+		if (connections_.empty())
+			throw std::runtime_error("No open connection");
+
+		pool_cv_.wait(lock, [this] { return !idle_connections_.empty(); });
+
+		PoolSlot* slot = idle_connections_.back();
+		idle_connections_.pop_back();
+
+		return PooledConnection(*this, slot);
+	}
+
+	void ReleaseConnection(PoolSlot* slot)
+	{
+		{
+			std::lock_guard<std::mutex> lock(pool_mutex_);
+			idle_connections_.push_back(slot);
+		}
+		pool_cv_.notify_one();
+	}
+
+	std::vector<std::unique_ptr<PoolSlot>> connections_;
+	std::vector<PoolSlot*> idle_connections_;
+	std::mutex pool_mutex_;
+	std::condition_variable pool_cv_;
+	std::array<std::string, statement_count_> statement_sql_;
+
 	std::string table_players_;
 	std::string table_groups_;
+	std::string table_player_groups_;
 };
@@ -1,14 +1,25 @@
 #pragma once
 
 #include <SQLiteCpp/Database.h>
+#include <SQLiteCpp/Transaction.h>
+
+#include <unordered_map>
 
 #include "IDatabase.h"
 #include "../Main.h"
 
+// Pragmas of both connections, synchronous only matters for the one that writes
+struct SqlLiteOptions
+{
+	std::string synchronous = "NORMAL";
+	int cache_size_kib = 2048;
+	int64 mmap_size_mb = 0;
+};
+
 class SqlLite : public IDatabase
 {
 public:
-	explicit SqlLite(const std::string& path)
+	explicit SqlLite(const std::string& path, const SqlLiteOptions& options = {})
 		: db_(path.empty()
 			      ? Permissions::GetDbPath()
 			      : path, SQLite::OPEN_READWRITE | SQLite::OPEN_CREATE)
@@ -16,6 +27,8 @@ public:
 		try
 		{
 			db_.exec("PRAGMA journal_mode=WAL;");
+			db_.exec("PRAGMA synchronous=" + SynchronousKeyword(options.synchronous) + ";");
+			ApplyCachePragmas(db_, options);
 
 			db_.exec("create table if not exists Players ("
 				"Id integer primary key autoincrement not null,"
@@ -27,6 +40,16 @@ public:
 				"GroupName text not null COLLATE NOCASE,"
 				"Permissions text default '' COLLATE NOCASE"
 				");");
+			// One row per membership, Players.Groups is only read by the migration
+			db_.exec("create table if not exists PlayerGroups ("
+				"SteamId integer not null,"
+				"GroupId integer not null,"
+				"primary key (SteamId, GroupId)"
+				") without rowid;");
+
+			db_.exec("create index if not exists Players_SteamId on Players (SteamId);");
+			db_.exec("create index if not exists Groups_GroupName on Groups (GroupName);");
+			db_.exec("create index if not exists PlayerGroups_GroupId on PlayerGroups (GroupId, SteamId);");
 
 			// Add default groups
 
@@ -36,21 +59,52 @@ public:
 			db_.exec("INSERT INTO Groups(GroupName)"
 				"SELECT 'Default'"
 				"WHERE NOT EXISTS(SELECT 1 FROM Groups WHERE GroupName = 'Default');");
+
+			MigratePlayerGroups();
 		}
 		catch (const std::exception& exception)
 		{
 			Log::GetLog()->error("({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
 		}
+
+		// Lookups get a connection of their own once the file and tables exist. In WAL mode it reads the last commit
+		// while the write connection is inside a transaction, without either one waiting for the other
+		try
+		{
+			read_db_ = std::make_unique<SQLite::Database>(db_.getFilename(), SQLite::OPEN_READONLY);
+			ApplyCachePragmas(*read_db_, options);
+		}
+		catch (const std::exception& exception)
+		{
+			read_db_.reset();
+			Log::GetLog()->error("({} {}) Could not open the read connection, lookups share the write connection: {}", __FILE__,
+			                     __FUNCTION__, exception.what());
+		}
 	}
 
 	bool AddPlayer(uint64 steam_id) override
 	{
 		try
 		{
-			SQLite::Statement query(db_, "INSERT INTO Players (SteamId) VALUES (?);");
-			query.bind(1, static_cast<int64>(steam_id));
-			query.exec();
+			SQLite::Transaction transaction(db_);
+
+			{
+				SQLite::Statement& query = GetStatement("INSERT INTO Players (SteamId) VALUES (?);");
+				StatementReset reset(query);
+				query.bind(1, static_cast<int64>(steam_id));
+				query.exec();
+			}
+
+			// New players start in the default group
+			{
+				SQLite::Statement& query = GetStatement("INSERT OR IGNORE INTO PlayerGroups (SteamId, GroupId) "
+					"SELECT ?, Id FROM Groups WHERE GroupName = 'Default';");
+				StatementReset reset(query);
+				query.bind(1, static_cast<int64>(steam_id));
+				query.exec();
+			}
 
+			transaction.commit();
 			return true;
 		}
 		catch (const std::exception& exception)
@@ -66,7 +120,8 @@ public:
 
 		try
 		{
-			SQLite::Statement query(db_, "SELECT count(1) FROM Players WHERE SteamId = ?;");
+			SQLite::Statement& query = GetReadStatement("SELECT count(1) FROM Players WHERE SteamId = ?;");
+			StatementReset reset(query);
 			query.bind(1, static_cast<int64>(steam_id));
 			query.executeStep();
 
@@ -87,7 +142,8 @@ public:
 
 		try
 		{
-			SQLite::Statement query(db_, "SELECT count(1) FROM Groups WHERE GroupName = ?;");
+			SQLite::Statement& query = GetReadStatement("SELECT count(1) FROM Groups WHERE GroupName = ?;");
+			StatementReset reset(query);
 			query.bind(1, group.ToString());
 			query.executeStep();
 
@@ -108,15 +164,51 @@ public:
 
 		try
 		{
-			SQLite::Statement query(db_, "SELECT Groups FROM Players WHERE SteamId = ?;");
+			SQLite::Statement& query = GetReadStatement(player_groups_query_);
+			StatementReset reset(query);
 			query.bind(1, static_cast<int64>(steam_id));
-			if (query.executeStep())
+			while (query.executeStep())
 			{
-				std::string groups_str = query.getColumn(0);
+				AddGroupName(groups, query.getColumn(0));
+			}
+		}
+		catch (const std::exception& exception)
+		{
+			Log::GetLog()->error("({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+		}
 
-				FString groups_fstr(groups_str.c_str());
+		return groups;
+	}
 
-				groups_fstr.ParseIntoArray(groups, L",", true);
+	std::optional<TArray<FString>> UpsertPlayerAndGetGroups(uint64 steam_id) override
+	{
+		TArray<FString> groups;
+
+		try
+		{
+			SQLite::Statement& query = GetReadStatement(player_groups_query_);
+
+			for (int attempt = 0; attempt < 2; ++attempt)
+			{
+				{
+					StatementReset reset(query);
+					query.bind(1, static_cast<int64>(steam_id));
+
+					// A known player has at least one row, with an empty name when it is in no group
+					bool found = false;
+					while (query.executeStep())
+					{
+						found = true;
+						AddGroupName(groups, query.getColumn(0));
+					}
+
+					if (found)
+						return groups;
+				}
+
+				// Read back after the insert so the default group is what the caller gets
+				if (attempt == 0 && !AddPlayer(steam_id))
+					break;
 			}
 		}
 		catch (const std::exception& exception)
@@ -124,7 +216,62 @@ public:
 			Log::GetLog()->error("({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
 		}
 
-		return groups;
+		return {};
+	}
+
+	TMap<uint64, TArray<FString>> GetPlayersGroups(const TArray<uint64>& steam_ids) override
+	{
+		TMap<uint64, TArray<FString>> players_groups;
+
+		if (steam_ids.Num() == 0)
+			return players_groups;
+
+		std::string ids;
+		for (uint64 steam_id : steam_ids)
+		{
+			ids += (ids.empty() ? "" : ",") + std::to_string(static_cast<int64>(steam_id));
+		}
+
+		try
+		{
+			SQLite::Statement query(ReadConnection(), "SELECT DISTINCT p.SteamId, g.GroupName FROM Players p "
+				"LEFT JOIN PlayerGroups pg ON pg.SteamId = p.SteamId LEFT JOIN Groups g ON g.Id = pg.GroupId "
+				"WHERE p.SteamId IN (" + ids + ");");
+			while (query.executeStep())
+			{
+				const uint64 steam_id = static_cast<uint64>(query.getColumn(0).getInt64());
+				AddGroupName(players_groups.FindOrAdd(steam_id), query.getColumn(1));
+			}
+		}
+		catch (const std::exception& exception)
+		{
+			Log::GetLog()->error("({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+		}
+
+		return players_groups;
+	}
+
+	std::unordered_map<uint64, TArray<FString>> GetAllPlayersGroups() override
+	{
+		std::unordered_map<uint64, TArray<FString>> players_groups;
+
+		try
+		{
+			SQLite::Statement& query = GetReadStatement("SELECT DISTINCT p.SteamId, g.GroupName FROM Players p "
+				"LEFT JOIN PlayerGroups pg ON pg.SteamId = p.SteamId LEFT JOIN Groups g ON g.Id = pg.GroupId;");
+			StatementReset reset(query);
+			while (query.executeStep())
+			{
+				const uint64 steam_id = static_cast<uint64>(query.getColumn(0).getInt64());
+				AddGroupName(players_groups[steam_id], query.getColumn(1));
+			}
+		}
+		catch (const std::exception& exception)
+		{
+			Log::GetLog()->error("({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+		}
+
+		return players_groups;
 	}
 
 	TArray<FString> GetGroupPermissions(const FString& group) override
@@ -136,7 +283,8 @@ public:
 
 		try
 		{
-			SQLite::Statement query(db_, "SELECT Permissions FROM Groups WHERE GroupName = ?;");
+			SQLite::Statement& query = GetReadStatement("SELECT Permissions FROM Groups WHERE GroupName = ?;");
+			StatementReset reset(query);
 			query.bind(1, group.ToString());
 			query.executeStep();
 
@@ -160,7 +308,8 @@ public:
 
 		try
 		{
-			SQLite::Statement query(db_, "SELECT GroupName FROM Groups;");
+			SQLite::Statement& query = GetReadStatement("SELECT GroupName FROM Groups;");
+			StatementReset reset(query);
 			while (query.executeStep())
 			{
 				all_groups.Add(query.getColumn(0).getText());
@@ -180,12 +329,13 @@ public:
 
 		try
 		{
-			SQLite::Statement query(db_, "SELECT SteamId FROM Players;");
+			SQLite::Statement& query = GetReadStatement("SELECT SteamId FROM PlayerGroups "
+				"WHERE GroupId IN (SELECT Id FROM Groups WHERE GroupName = ?);");
+			StatementReset reset(query);
+			query.bind(1, group.ToString());
 			while (query.executeStep())
 			{
-				uint64 steam_id = static_cast<uint64>(query.getColumn(0).getInt64());
-				if (Permissions::IsPlayerInGroup(steam_id, group))
-					members.Add(steam_id);
+				members.Add(static_cast<uint64>(query.getColumn(0).getInt64()));
 			}
 		}
 		catch (const std::exception& exception)
@@ -209,9 +359,11 @@ public:
 
 		try
 		{
-			SQLite::Statement query(db_, "UPDATE Players SET Groups = Groups || ? || ',' WHERE SteamId = ?;");
-			query.bind(1, group.ToString());
-			query.bind(2, static_cast<int64>(steam_id));
+			SQLite::Statement& query = GetStatement("INSERT OR IGNORE INTO PlayerGroups (SteamId, GroupId) "
+				"SELECT ?, Id FROM Groups WHERE GroupName = ?;");
+			StatementReset reset(query);
+			query.bind(1, static_cast<int64>(steam_id));
+			query.bind(2, group.ToString());
 			query.exec();
 		}
 		catch (const std::exception& exception)
@@ -231,21 +383,13 @@ public:
 		if (!Permissions::IsPlayerInGroup(steam_id, group))
 			return "Player is not in group";
 
-		TArray<FString> groups = GetPlayerGroups(steam_id);
-
-		FString new_groups;
-
-		for (const FString& current_group : groups)
-		{
-			if (current_group != group)
-				new_groups += current_group + ",";
-		}
-
 		try
 		{
-			SQLite::Statement query(db_, "UPDATE Players SET Groups = ? WHERE SteamId = ?;");
-			query.bind(1, new_groups.ToString());
-			query.bind(2, static_cast<int64>(steam_id));
+			SQLite::Statement& query = GetStatement("DELETE FROM PlayerGroups "
+				"WHERE SteamId = ? AND GroupId IN (SELECT Id FROM Groups WHERE GroupName = ?);");
+			StatementReset reset(query);
+			query.bind(1, static_cast<int64>(steam_id));
+			query.bind(2, group.ToString());
 			query.exec();
 		}
 		catch (const std::exception& exception)
@@ -264,7 +408,8 @@ public:
 
 		try
 		{
-			SQLite::Statement query(db_, "INSERT INTO Groups (GroupName) VALUES (?);");
+			SQLite::Statement& query = GetStatement("INSERT INTO Groups (GroupName) VALUES (?);");
+			StatementReset reset(query);
 			query.bind(1, group.ToString());
 			query.exec();
 		}
@@ -282,21 +427,30 @@ public:
 		if (!IsGroupExists(group))
 			return "Group does not exist";
 
-		// Remove all players from this group
-
-		TArray<uint64> group_members = GetGroupMembers(group);
-		for (uint64 player : group_members)
+		try
 		{
-			RemovePlayerFromGroup(player, group);
-		}
+			SQLite::Transaction transaction(db_);
 
-		// Delete group
+			// Remove all players from this group
 
-		try
-		{
-			SQLite::Statement query(db_, "DELETE FROM Groups WHERE GroupName = ?;");
-			query.bind(1, group.ToString());
-			query.exec();
+			{
+				SQLite::Statement& query = GetStatement("DELETE FROM PlayerGroups "
+					"WHERE GroupId IN (SELECT Id FROM Groups WHERE GroupName = ?);");
+				StatementReset reset(query);
+				query.bind(1, group.ToString());
+				query.exec();
+			}
+
+			// Delete group
+
+			{
+				SQLite::Statement& query = GetStatement("DELETE FROM Groups WHERE GroupName = ?;");
+				StatementReset reset(query);
+				query.bind(1, group.ToString());
+				query.exec();
+			}
+
+			transaction.commit();
 		}
 		catch (const std::exception& exception)
 		{
@@ -317,8 +471,8 @@ public:
 
 		try
 		{
-			SQLite::Statement
-				query(db_, "UPDATE Groups SET Permissions = Permissions || ? || ',' WHERE GroupName = ?;");
+			SQLite::Statement& query = GetStatement("UPDATE Groups SET Permissions = Permissions || ? || ',' WHERE GroupName = ?;");
+			StatementReset reset(query);
 			query.bind(1, permission.ToString());
 			query.bind(2, group.ToString());
 			query.exec();
@@ -352,7 +506,8 @@ public:
 
 		try
 		{
-			SQLite::Statement query(db_, "UPDATE Groups SET Permissions = ? WHERE GroupName = ?;");
+			SQLite::Statement& query = GetStatement("UPDATE Groups SET Permissions = ? WHERE GroupName = ?;");
+			StatementReset reset(query);
 			query.bind(1, new_permissions.ToString());
 			query.bind(2, group.ToString());
 			query.exec();
@@ -367,5 +522,130 @@ public:
 	}
 
 private:
+	// Every group of one player, a known player in no group gets a single row with an empty name
+	static constexpr const char* player_groups_query_ = "SELECT DISTINCT g.GroupName FROM Players p "
+		"LEFT JOIN PlayerGroups pg ON pg.SteamId = p.SteamId LEFT JOIN Groups g ON g.Id = pg.GroupId "
+		"WHERE p.SteamId = ?;";
+
+	static void AddGroupName(TArray<FString>& groups, const SQLite::Column& column)
+	{
+		const char* name = column.getText();
+		if (*name != '\0')
+			groups.Add(name);
+	}
+
+	// Schema version 1 keeps memberships in PlayerGroups, older databases have them in Players.Groups
+	void MigratePlayerGroups()
+	{
+		if (db_.execAndGet("PRAGMA user_version;").getInt() >= 1)
+			return;
+
+		SQLite::Transaction transaction(db_);
+
+		SQLite::Statement players(db_, "SELECT SteamId, Groups FROM Players;");
+		SQLite::Statement insert(db_, "INSERT OR IGNORE INTO PlayerGroups (SteamId, GroupId) "
+			"SELECT ?, Id FROM Groups WHERE GroupName = ?;");
+
+		int players_count = 0;
+
+		while (players.executeStep())
+		{
+			const int64 steam_id = players.getColumn(0).getInt64();
+			FString groups_fstr(players.getColumn(1).getText());
+
+			TArray<FString> groups;
+			groups_fstr.ParseIntoArray(groups, L",", true);
+
+			// Names without a row in Groups are dropped, no permission could be granted to them
+			for (const FString& group : groups)
+			{
+				insert.bind(1, steam_id);
+				insert.bind(2, group.ToString());
+				insert.exec();
+				insert.reset();
+			}
+
+			++players_count;
+		}
+
+		db_.exec("PRAGMA user_version = 1;");
+		transaction.commit();
+
+		if (players_count > 0)
+			Log::GetLog()->info("Moved the groups of {} players into PlayerGroups", players_count);
+	}
+
+	// Resets a cached statement once the call is done, so it doesn't keep a read transaction open
+	struct StatementReset
+	{
+		explicit StatementReset(SQLite::Statement& statement)
+			: statement_(statement)
+		{
+		}
+
+		~StatementReset()
+		{
+			try
+			{
+				statement_.reset();
+				statement_.clearBindings();
+			}
+			catch (const std::exception&)
+			{
+			}
+		}
+
+		SQLite::Statement& statement_;
+	};
+
+	static std::string SynchronousKeyword(const std::string& value)
+	{
+		for (const char* keyword : {"OFF", "NORMAL", "FULL", "EXTRA"})
+		{
+			if (_stricmp(value.c_str(), keyword) == 0)
+				return keyword;
+		}
+
+		return "NORMAL";
+	}
+
+	static void ApplyCachePragmas(SQLite::Database& db, const SqlLiteOptions& options)
+	{
+		// Negative is KiB instead of pages
+		db.exec("PRAGMA cache_size=" + std::to_string(-std::max(0, options.cache_size_kib)) + ";");
+		db.exec("PRAGMA mmap_size=" + std::to_string(std::max<int64>(0, options.mmap_size_mb) * 1024 * 1024) + ";");
+	}
+
+	SQLite::Database& ReadConnection()
+	{
+		return read_db_ ? *read_db_ : db_;
+	}
+
+	// Prepared once per connection and reused for every call
+	SQLite::Statement& GetStatement(const std::string& sql)
+	{
+		auto& statement = statements_[sql];
+		if (!statement)
+			statement = std::make_unique<SQLite::Statement>(db_, sql);
+
+		return *statement;
+	}
+
+	// Same for the lookups, on the read connection
+	SQLite::Statement& GetReadStatement(const std::string& sql)
+	{
+		if (!read_db_)
+			return GetStatement(sql);
+
+		auto& statement = read_statements_[sql];
+		if (!statement)
+			statement = std::make_unique<SQLite::Statement>(*read_db_, sql);
+
+		return *statement;
+	}
+
 	SQLite::Database db_;
+	std::unique_ptr<SQLite::Database> read_db_;
+	std::unordered_map<std::string, std::unique_ptr<SQLite::Statement>> statements_;
+	std::unordered_map<std::string, std::unique_ptr<SQLite::Statement>> read_statements_;
 };
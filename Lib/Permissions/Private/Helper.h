@@ -1,5 +1,10 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <string_view>
+
 namespace Permissions
 {
 	inline std::string GetDbPath()
@@ -20,6 +25,59 @@ namespace Permissions
 #endif
 	}
 
+	// Pops the next space separated token off rest without copying, empty once rest runs out
+	inline std::wstring_view NextToken(std::wstring_view& rest)
+	{
+		const size_t start = std::min(rest.find_first_not_of(L' '), rest.size());
+		const size_t end = std::min(rest.find(L' ', start), rest.size());
+		const std::wstring_view token = rest.substr(start, end - start);
+		rest.remove_prefix(end);
+		return token;
+	}
+
+	// Same split as ParseIntoArray(" ", true) into views of cmd, tokens past N are ignored. Returns how many were found
+	template <size_t N>
+	size_t TokenizeCommand(const FString& cmd, std::array<std::wstring_view, N>& tokens)
+	{
+		std::wstring_view rest(*cmd, cmd.Len());
+		size_t count = 0;
+
+		for (std::wstring_view token = NextToken(rest); !token.empty() && count < N; token = NextToken(rest))
+		{
+			tokens[count++] = token;
+		}
+
+		return count;
+	}
+
+	// Digits only, returns what was wrong or nullptr when value was set
+	inline const char* ParseUInt(std::wstring_view token, uint64& value)
+	{
+		if (token.empty())
+			return "expected a number";
+
+		uint64 result = 0;
+
+		for (const wchar_t c : token)
+		{
+			if (c < L'0' || c > L'9')
+				return "expected a number";
+
+			if (result > (std::numeric_limits<uint64>::max() - (c - L'0')) / 10)
+				return "number is too large";
+
+			result = result * 10 + (c - L'0');
+		}
+
+		value = result;
+		return nullptr;
+	}
+
+	inline FString ToFString(std::wstring_view token)
+	{
+		return FString(static_cast<int32>(token.size()), token.data());
+	}
+
 	inline void SendRconReply(RCONClientConnection* rcon_connection, int packet_id, const FString& msg)
 	{
 		FString reply = msg + "\n";
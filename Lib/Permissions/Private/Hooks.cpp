@@ -2,8 +2,13 @@
 
 #include "Main.h"
 
+#include <unordered_set>
+
 namespace Permissions::Hooks
 {
+	// Game thread only. Admins whose Admins row is being written, a re-auth meanwhile doesn't queue a second one
+	std::unordered_set<uint64> pending_admins;
+
 	DECLARE_HOOK(AShooterGameMode_HandleNewPlayer, bool, AShooterGameMode*, AShooterPlayerController*,
 	UPrimalPlayerData*, AShooterCharacter*, bool);
 	DECLARE_HOOK(AShooterPlayerController_ClientNotifyAdmin, void, AShooterPlayerController*);
@@ -14,14 +19,9 @@ namespace Permissions::Hooks
 	{
 		const uint64 steam_id = ArkApi::IApiUtils::GetSteamIdFromController(new_player);
 
-		if (!database->IsPlayerExists(steam_id))
-		{
-			const bool res = database->AddPlayer(steam_id);
-			if (!res)
-			{
-				Log::GetLog()->error("({} {}) Couldn't add player", __FILE__, __FUNCTION__);
-			}
-		}
+		// Known players are already in the snapshot, new ones are added off the game thread in one round trip
+		// that plugins asking for the same player's groups during the login share
+		UpsertPlayerAndGetGroupsAsync("Permissions", steam_id, nullptr);
 
 		return AShooterGameMode_HandleNewPlayer_original(_this, new_player, player_data, player_character,
 		                                                 is_from_login);
@@ -29,10 +29,21 @@ namespace Permissions::Hooks
 
 	void Hook_AShooterPlayerController_ClientNotifyAdmin(AShooterPlayerController* player_controller)
 	{
+		static const FString admins_group = L"Admins";
+
 		const uint64 steam_id = ArkApi::IApiUtils::GetSteamIdFromController(player_controller);
 
-		if (!IsPlayerInGroup(steam_id, "Admins"))
-			database->AddPlayerToGroup(steam_id, "Admins");
+		// Answered from the snapshot like every other membership check, only a new admin is written, off the game thread
+		if (!IsPlayerInGroup(steam_id, admins_group) && pending_admins.insert(steam_id).second)
+		{
+			AddPlayerToGroupAsync("Permissions", steam_id, admins_group, [steam_id](std::optional<std::string> error)
+			{
+				pending_admins.erase(steam_id);
+
+				if (error)
+					Log::GetLog()->error("({} {}) Could not add admin {} to Admins: {}", __FILE__, __FUNCTION__, steam_id, *error);
+			});
+		}
 
 		AShooterPlayerController_ClientNotifyAdmin_original(player_controller);
 	}
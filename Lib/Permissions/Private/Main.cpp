@@ -1,12 +1,15 @@
 #define _CRT_SECURE_NO_WARNINGS
 
-#include "json.hpp"
+#include <json.hpp>
 
 #include "Database/SqlLiteDB.h"
 #include "Database/MysqlDB.h"
 
 #include "Main.h"
+#include "AsyncQueries.h"
+#include "Snapshot.h"
 
+#include <algorithm>
 #include <fstream>
 
 #ifdef PERMISSIONS_ARK
@@ -32,27 +35,20 @@ namespace Permissions
 
 	std::optional<std::string> AddPlayerToGroup(const FString& cmd)
 	{
-		TArray<FString> parsed;
-		cmd.ParseIntoArray(parsed, L" ", true);
+		std::array<std::wstring_view, 3> parsed;
 
-		if (!parsed.IsValidIndex(2))
+		if (TokenizeCommand(cmd, parsed) < 3)
 			return "Wrong syntax";
 
 		uint64 steam_id;
 
-		const FString group = *parsed[2];
-
-		try
-		{
-			steam_id = std::stoull(*parsed[1]);
-		}
-		catch (const std::exception& exception)
+		if (const char* error = ParseUInt(parsed[1], steam_id))
 		{
-			Log::GetLog()->error("({} {}) Parsing error {}", __FILE__, __FUNCTION__, exception.what());
+			Log::GetLog()->error("({} {}) Parsing error {}", __FILE__, __FUNCTION__, error);
 			return "Parsing error";
 		}
 
-		return AddPlayerToGroup(steam_id, group);
+		return AddPlayerToGroup(steam_id, ToFString(parsed[2]));
 	}
 
 	void AddPlayerToGroupCmd(APlayerController* player_controller, FString* cmd, bool)
@@ -79,27 +75,20 @@ namespace Permissions
 
 	std::optional<std::string> RemovePlayerFromGroup(const FString& cmd)
 	{
-		TArray<FString> parsed;
-		cmd.ParseIntoArray(parsed, L" ", true);
+		std::array<std::wstring_view, 3> parsed;
 
-		if (!parsed.IsValidIndex(2))
+		if (TokenizeCommand(cmd, parsed) < 3)
 			return "Wrong syntax";
 
 		uint64 steam_id;
 
-		const FString group = *parsed[2];
-
-		try
-		{
-			steam_id = std::stoull(*parsed[1]);
-		}
-		catch (const std::exception& exception)
+		if (const char* error = ParseUInt(parsed[1], steam_id))
 		{
-			Log::GetLog()->error("({} {}) Parsing error {}", __FILE__, __FUNCTION__, exception.what());
+			Log::GetLog()->error("({} {}) Parsing error {}", __FILE__, __FUNCTION__, error);
 			return "Parsing error";
 		}
 
-		return database->RemovePlayerFromGroup(steam_id, group);
+		return RemovePlayerFromGroup(steam_id, ToFString(parsed[2]));
 	}
 
 	void RemovePlayerFromGroupCmd(APlayerController* player_controller, FString* cmd, bool)
@@ -127,15 +116,12 @@ namespace Permissions
 
 	std::optional<std::string> AddGroupCommand(const FString& cmd)
 	{
-		TArray<FString> parsed;
-		cmd.ParseIntoArray(parsed, L" ", true);
+		std::array<std::wstring_view, 2> parsed;
 
-		if (!parsed.IsValidIndex(1))
+		if (TokenizeCommand(cmd, parsed) < 2)
 			return "Wrong syntax";
 
-		const FString group = *parsed[1];
-
-		return database->AddGroup(group);
+		return AddGroup(ToFString(parsed[1]));
 	}
 
 	void AddGroupCmd(APlayerController* player_controller, FString* cmd, bool)
@@ -162,15 +148,12 @@ namespace Permissions
 
 	std::optional<std::string> RemoveGroupCommand(const FString& cmd)
 	{
-		TArray<FString> parsed;
-		cmd.ParseIntoArray(parsed, L" ", true);
+		std::array<std::wstring_view, 2> parsed;
 
-		if (!parsed.IsValidIndex(1))
+		if (TokenizeCommand(cmd, parsed) < 2)
 			return "Wrong syntax";
 
-		const FString group = *parsed[1];
-
-		return database->RemoveGroup(group);
+		return RemoveGroup(ToFString(parsed[1]));
 	}
 
 	void RemoveGroupCmd(APlayerController* player_controller, FString* cmd, bool)
@@ -198,16 +181,12 @@ namespace Permissions
 
 	std::optional<std::string> GroupGrantPermission(const FString& cmd)
 	{
-		TArray<FString> parsed;
-		cmd.ParseIntoArray(parsed, L" ", true);
+		std::array<std::wstring_view, 3> parsed;
 
-		if (!parsed.IsValidIndex(2))
+		if (TokenizeCommand(cmd, parsed) < 3)
 			return "Wrong syntax";
 
-		const FString group = *parsed[1];
-		const FString permission = *parsed[2];
-
-		return database->GroupGrantPermission(group, permission);
+		return GroupGrantPermission(ToFString(parsed[1]), ToFString(parsed[2]));
 	}
 
 	void GroupGrantPermissionCmd(APlayerController* player_controller, FString* cmd, bool)
@@ -235,16 +214,12 @@ namespace Permissions
 
 	std::optional<std::string> GroupRevokePermission(const FString& cmd)
 	{
-		TArray<FString> parsed;
-		cmd.ParseIntoArray(parsed, L" ", true);
+		std::array<std::wstring_view, 3> parsed;
 
-		if (!parsed.IsValidIndex(2))
+		if (TokenizeCommand(cmd, parsed) < 3)
 			return "Wrong syntax";
 
-		const FString group = *parsed[1];
-		const FString permission = *parsed[2];
-
-		return database->GroupRevokePermission(group, permission);
+		return GroupRevokePermission(ToFString(parsed[1]), ToFString(parsed[2]));
 	}
 
 	void GroupRevokePermissionCmd(APlayerController* player_controller, FString* cmd, bool)
@@ -272,25 +247,20 @@ namespace Permissions
 
 	FString PlayerGroups(const FString& cmd)
 	{
-		TArray<FString> parsed;
-		cmd.ParseIntoArray(parsed, L" ", true);
+		std::array<std::wstring_view, 2> parsed;
 
-		if (!parsed.IsValidIndex(1))
+		if (TokenizeCommand(cmd, parsed) < 2)
 			return "";
 
 		uint64 steam_id;
 
-		try
-		{
-			steam_id = std::stoull(*parsed[1]);
-		}
-		catch (const std::exception& exception)
+		if (const char* error = ParseUInt(parsed[1], steam_id))
 		{
-			Log::GetLog()->error("({} {}) Parsing error {}", __FILE__, __FUNCTION__, exception.what());
+			Log::GetLog()->error("({} {}) Parsing error {}", __FILE__, __FUNCTION__, error);
 			return "";
 		}
 
-		TArray<FString> groups = database->GetPlayerGroups(steam_id);
+		TArray<FString> groups = GetPlayerGroups(steam_id);
 
 		FString groups_str;
 
@@ -323,15 +293,12 @@ namespace Permissions
 
 	FString GroupPermissions(const FString& cmd)
 	{
-		TArray<FString> parsed;
-		cmd.ParseIntoArray(parsed, L" ", true);
+		std::array<std::wstring_view, 2> parsed;
 
-		if (!parsed.IsValidIndex(1))
+		if (TokenizeCommand(cmd, parsed) < 2)
 			return "";
 
-		const FString group = *parsed[1];
-
-		TArray<FString> permissions = database->GetGroupPermissions(group);
+		TArray<FString> permissions = GetGroupPermissions(ToFString(parsed[1]));
 
 		FString permissions_str;
 
@@ -368,19 +335,19 @@ namespace Permissions
 
 		int i = 1;
 
-		TArray<FString> all_groups = database->GetAllGroups();
-		for (const auto& group : all_groups)
+		ForEachGroup([&groups, &i](const FString& group)
 		{
 			FString permissions;
 
-			TArray<FString> group_permissions = database->GetGroupPermissions(group);
+			TArray<FString> group_permissions = GetGroupPermissions(group);
 			for (const auto& permission : group_permissions)
 			{
 				permissions += permission + L"; ";
 			}
 
 			groups += FString::Format(L"{0}) {1} - {2}\n", i++, group.ToString(), permissions.ToString());
-		}
+			return true;
+		});
 
 		return groups;
 	}
@@ -399,13 +366,71 @@ namespace Permissions
 		SendRconReply(rcon_connection, rcon_packet->Id, *result);
 	}
 
+	// GroupMembers
+
+	// Permissions.GroupMembers <group> [after_steam_id] [limit], one page of members at a time
+	FString GroupMembers(const FString& cmd)
+	{
+		std::array<std::wstring_view, 4> parsed;
+		const size_t count = TokenizeCommand(cmd, parsed);
+
+		if (count < 2)
+			return "";
+
+		uint64 after_steam_id = 0;
+		uint64 requested_limit = 100;
+
+		const char* error = count > 2 ? ParseUInt(parsed[2], after_steam_id) : nullptr;
+		if (!error && count > 3)
+			error = ParseUInt(parsed[3], requested_limit);
+
+		if (error)
+		{
+			Log::GetLog()->error("({} {}) Parsing error {}", __FILE__, __FUNCTION__, error);
+			return "";
+		}
+
+		const int32 limit = static_cast<int32>(std::clamp<uint64>(requested_limit, 1, 1000));
+		const TArray<uint64> members = GetGroupMembersPage(ToFString(parsed[1]), after_steam_id, limit);
+
+		FString members_str;
+
+		for (uint64 steam_id : members)
+		{
+			members_str += FString(std::to_string(steam_id).c_str()) + ",";
+		}
+
+		if (!members_str.IsEmpty())
+			members_str.RemoveAt(members_str.Len() - 1);
+
+		// A full page may have more after it, the last id is the cursor for the next one
+		if (members.Num() == limit)
+			members_str += FString(("\nNext: " + std::to_string(members.Last())).c_str());
+
+		return members_str;
+	}
+
+	void GroupMembersCmd(APlayerController* player_controller, FString* cmd, bool)
+	{
+		const auto shooter_controller = static_cast<AShooterPlayerController*>(player_controller);
+
+		const FString result = GroupMembers(*cmd);
+		ArkApi::GetApiUtils().SendServerMessage(shooter_controller, FColorList::White, *result);
+	}
+
+	void GroupMembersRcon(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+	{
+		const FString result = GroupMembers(rcon_packet->Body);
+		SendRconReply(rcon_connection, rcon_packet->Id, *result);
+	}
+
 	// Chat commands
 
 	void ShowMyGroupsChat(AShooterPlayerController* player_controller, FString*, EChatSendMode::Type)
 	{
 		const uint64 steam_id = ArkApi::IApiUtils::GetSteamIdFromController(player_controller);
 
-		TArray<FString> groups = database->GetPlayerGroups(steam_id);
+		TArray<FString> groups = GetPlayerGroups(steam_id);
 
 		FString groups_str;
 
@@ -432,6 +457,28 @@ namespace Permissions
 		file.close();
 	}
 
+	std::unique_ptr<IDatabase> CreateDatabase(int pool_size)
+	{
+		if (config.value("Database", "sqlite") == "mysql")
+		{
+			return std::make_unique<MySql>(config.value("MysqlHost", ""),
+			                               config.value("MysqlUser", ""),
+			                               config.value("MysqlPass", ""),
+			                               config.value("MysqlDB", ""),
+			                               config.value("MysqlPlayersTable", "Players"),
+			                               config.value("MysqlGroupsTable", "PermissionGroups"),
+			                               config.value("MysqlPlayerGroupsTable", "PlayerGroups"),
+			                               pool_size);
+		}
+
+		SqlLiteOptions options;
+		options.synchronous = config.value("SqliteSynchronous", options.synchronous);
+		options.cache_size_kib = config.value("SqliteCacheSizeKiB", options.cache_size_kib);
+		options.mmap_size_mb = config.value("SqliteMmapSizeMB", options.mmap_size_mb);
+
+		return std::make_unique<SqlLite>(config.value("DbPathOverride", ""), options);
+	}
+
 	void Load()
 	{
 		Log::Get().Init("Permission");
@@ -446,19 +493,15 @@ namespace Permissions
 			throw;
 		}
 
-		if (config.value("Database", "sqlite") == "mysql")
-		{
-			database = std::make_unique<MySql>(config.value("MysqlHost", ""),
-			                                   config.value("MysqlUser", ""),
-			                                   config.value("MysqlPass", ""),
-			                                   config.value("MysqlDB", ""),
-			                                   config.value("MysqlPlayersTable", "Players"),
-			                                   config.value("MysqlGroupsTable", "PermissionGroups"));
-		}
-		else
-		{
-			database = std::make_unique<SqlLite>(config.value("DbPathOverride", ""));
-		}
+		// Each MySQL worker gets its own pooled connection, a SQLite connection is only used from one thread
+		const int async_workers = config.value("Database", "sqlite") == "mysql" ? config.value("MysqlPoolSize", 2) : 1;
+
+		database = CreateDatabase(1);
+		async_database = CreateDatabase(async_workers);
+
+		Snapshot::Load(std::chrono::seconds(config.value("NoGroupsCacheTtlSecs", 600)));
+
+		Async::Start(async_workers);
 
 		Hooks::Init();
 
@@ -471,6 +514,7 @@ namespace Permissions
 		ArkApi::GetCommands().AddConsoleCommand("Permissions.PlayerGroups", &PlayerGroupsCmd);
 		ArkApi::GetCommands().AddConsoleCommand("Permissions.GroupPermissions", &GroupPermissionsCmd);
 		ArkApi::GetCommands().AddConsoleCommand("Permissions.ListGroups", &ListGroupsCmd);
+		ArkApi::GetCommands().AddConsoleCommand("Permissions.GroupMembers", &GroupMembersCmd);
 
 		ArkApi::GetCommands().AddRconCommand("Permissions.Add", &AddPlayerToGroupRcon);
 		ArkApi::GetCommands().AddRconCommand("Permissions.Remove", &RemovePlayerFromGroupRcon);
@@ -481,6 +525,7 @@ namespace Permissions
 		ArkApi::GetCommands().AddRconCommand("Permissions.PlayerGroups", &PlayerGroupsRcon);
 		ArkApi::GetCommands().AddRconCommand("Permissions.GroupPermissions", &GroupPermissionsRcon);
 		ArkApi::GetCommands().AddRconCommand("Permissions.ListGroups", &ListGroupsRcon);
+		ArkApi::GetCommands().AddRconCommand("Permissions.GroupMembers", &GroupMembersRcon);
 
 		ArkApi::GetCommands().AddChatCommand("/groups", &ShowMyGroupsChat);
 	}
@@ -494,6 +539,7 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserv
 		Permissions::Load();
 		break;
 	case DLL_PROCESS_DETACH:
+		Permissions::Async::Stop();
 		break;
 	}
 	return TRUE;
@@ -5,6 +5,8 @@
 namespace Permissions
 {
 	inline std::unique_ptr<IDatabase> database;
+	// Separate connection (or pool), only used by the async workers
+	inline std::unique_ptr<IDatabase> async_database;
 
 	std::string GetDbPath();
 }
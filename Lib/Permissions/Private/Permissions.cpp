@@ -4,37 +4,306 @@
 #include "../Public/AtlasPermissions.h"
 #endif
 
+#include <queue>
+#include <unordered_map>
+
 #include "Main.h"
+#include "AsyncQueries.h"
+#include "Snapshot.h"
+
 
 namespace Permissions
 {
+	std::vector<std::pair<FString, std::function<void(uint64)>>> groups_changed_callbacks;
+	std::vector<std::pair<FString, std::function<void(const FString&)>>> group_changed_callbacks;
+
+	// Game thread only. Players with an upsert in flight, and who is waiting for its result
+	std::unordered_map<uint64, std::vector<std::pair<FString, std::function<void(TArray<FString>)>>>> pending_upserts;
+
+	void NotifyGroupsChanged(uint64 steam_id)
+	{
+		for (const auto& callback : groups_changed_callbacks)
+		{
+			callback.second(steam_id);
+		}
+	}
+
+	void NotifyGroupChanged(const FString& group)
+	{
+		for (const auto& callback : group_changed_callbacks)
+		{
+			callback.second(group);
+		}
+	}
+
 	TArray<FString> GetPlayerGroups(uint64 steam_id)
 	{
-		return database->GetPlayerGroups(steam_id);
+		const auto snapshot = Snapshot::Get();
+
+		const auto groups = Snapshot::FindPlayerGroups(*snapshot, steam_id);
+		return groups ? TArray<FString>(*groups) : TArray<FString>();
+	}
+
+	TArray<FString> UpsertPlayerAndGetGroups(uint64 steam_id)
+	{
+		const auto snapshot = Snapshot::Get();
+
+		if (const auto groups = Snapshot::FindPlayerGroups(*snapshot, steam_id))
+			return TArray<FString>(*groups);
+
+		auto groups = database->UpsertPlayerAndGetGroups(steam_id);
+		if (!groups)
+			return {};
+
+		Snapshot::SetPlayerGroups(steam_id, *groups);
+		return *groups;
+	}
+
+	void UpsertPlayerAndGetGroupsAsync(const FString& id, uint64 steam_id,
+	                                   const std::function<void(TArray<FString>)>& callback)
+	{
+		{
+			const auto snapshot = Snapshot::Get();
+
+			// Players in no group are answered here too until their entry expires
+			if (const auto groups = Snapshot::FindPlayerGroups(*snapshot, steam_id))
+			{
+				if (callback)
+					callback(TArray<FString>(*groups));
+				return;
+			}
+		}
+
+		auto& waiting = pending_upserts[steam_id];
+		const bool in_flight = !waiting.empty();
+
+		// An entry without a callback still marks the upsert as in flight
+		waiting.emplace_back(id, callback);
+
+		if (in_flight)
+			return;
+
+		auto result = std::make_shared<TArray<FString>>();
+
+		// Queued under the Permissions id, a caller that cancels only drops its own callback
+		Async::Queue("Permissions", [steam_id, result](IDatabase& db)
+		{
+			// Left out of the snapshot on a database error, so the next login tries again
+			if (auto groups = db.UpsertPlayerAndGetGroups(steam_id))
+			{
+				*result = std::move(*groups);
+				Snapshot::SetPlayerGroups(steam_id, *result);
+			}
+		}, [steam_id, result]
+		{
+			const auto iter = pending_upserts.find(steam_id);
+			if (iter == pending_upserts.end())
+				return;
+
+			const auto waiting = std::move(iter->second);
+			pending_upserts.erase(iter);
+
+			for (const auto& waiter : waiting)
+			{
+				if (waiter.second)
+					waiter.second(*result);
+			}
+		});
+	}
+
+	TMap<uint64, TArray<FString>> GetPlayersGroups(const TArray<uint64>& steam_ids)
+	{
+		const auto snapshot = Snapshot::Get();
+
+		TMap<uint64, TArray<FString>> players_groups;
+
+		for (uint64 steam_id : steam_ids)
+		{
+			if (const auto groups = Snapshot::FindPlayerGroups(*snapshot, steam_id))
+				players_groups.Add(steam_id, TArray<FString>(*groups));
+		}
+
+		return players_groups;
+	}
+
+	void GetPlayersGroupsAsync(const FString& id, const TArray<uint64>& steam_ids,
+	                           const std::function<void(TMap<uint64, TArray<FString>>)>& callback)
+	{
+		auto result = std::make_shared<TMap<uint64, TArray<FString>>>();
+
+		Async::Queue(id, [steam_ids, result](IDatabase& db)
+		{
+			*result = db.GetPlayersGroups(steam_ids);
+		}, [callback, result]
+		{
+			callback(std::move(*result));
+		});
+	}
+
+	void CancelPlayersGroupsAsync(const FString& id)
+	{
+		Async::Cancel(id);
+
+		for (auto& player : pending_upserts)
+		{
+			for (auto& waiter : player.second)
+			{
+				// Kept as an empty entry so the upsert still counts as in flight
+				if (waiter.first == id)
+					waiter.second = nullptr;
+			}
+		}
 	}
 
 	TArray<FString> GetGroupPermissions(const FString& group)
 	{
 		if (group.IsEmpty())
 			return {};
-		return database->GetGroupPermissions(group);
+
+		const auto snapshot = Snapshot::Get();
+
+		const auto found = Snapshot::FindGroup(*snapshot, group);
+		return found ? found->permissions : TArray<FString>();
 	}
 
 	TArray<FString> GetAllGroups()
 	{
-		return database->GetAllGroups();
+		const auto snapshot = Snapshot::Get();
+
+		TArray<FString> all_groups;
+		all_groups.Reserve(static_cast<int32>(snapshot->groups.size()));
+
+		for (const auto& group : snapshot->groups)
+		{
+			all_groups.Add(group.second.name);
+		}
+
+		return all_groups;
+	}
+
+	void ForEachGroup(const std::function<bool(const FString&)>& callback)
+	{
+		// Held for the whole walk, a concurrent update publishes a new copy instead of changing this one
+		const auto snapshot = Snapshot::Get();
+
+		for (const auto& group : snapshot->groups)
+		{
+			if (!callback(group.second.name))
+				return;
+		}
+	}
+
+	TArray<FString> GetGroupsPage(const FString& after_group, int32 limit)
+	{
+		if (limit <= 0)
+			return {};
+
+		const auto snapshot = Snapshot::Get();
+		const std::wstring after = Snapshot::GroupKey(after_group);
+
+		// The map is unordered, a max heap keeps the limit smallest keys past the cursor without sorting all of them
+		using Entry = const std::pair<const std::wstring, Snapshot::Group>*;
+		const auto by_key = [](Entry lhs, Entry rhs) { return lhs->first < rhs->first; };
+		std::priority_queue<Entry, std::vector<Entry>, decltype(by_key)> page(by_key);
+
+		for (const auto& group : snapshot->groups)
+		{
+			if (!after.empty() && group.first <= after)
+				continue;
+
+			if (page.size() < static_cast<size_t>(limit))
+			{
+				page.push(&group);
+			}
+			else if (group.first < page.top()->first)
+			{
+				page.pop();
+				page.push(&group);
+			}
+		}
+
+		TArray<FString> groups;
+		groups.SetNum(static_cast<int32>(page.size()));
+
+		for (int32 i = groups.Num() - 1; i >= 0; --i)
+		{
+			groups[i] = page.top()->second.name;
+			page.pop();
+		}
+
+		return groups;
 	}
 
 	TArray<uint64> GetGroupMembers(const FString& group)
 	{
-		return database->GetGroupMembers(group);
+		TArray<uint64> members;
+
+		ForEachGroupMember(group, [&members](uint64 steam_id)
+		{
+			members.Add(steam_id);
+			return true;
+		});
+
+		return members;
+	}
+
+	void ForEachGroupMember(const FString& group, const std::function<bool(uint64)>& callback)
+	{
+		const auto snapshot = Snapshot::Get();
+
+		for (const auto& player : snapshot->player_groups)
+		{
+			if (player.second.Contains(group) && !callback(player.first))
+				return;
+		}
+	}
+
+	TArray<uint64> GetGroupMembersPage(const FString& group, uint64 after_steam_id, int32 limit)
+	{
+		if (limit <= 0)
+			return {};
+
+		// Same as GetGroupsPage, one pass over the snapshot and never more than limit ids held
+		std::priority_queue<uint64> page;
+
+		ForEachGroupMember(group, [&page, after_steam_id, limit](uint64 steam_id)
+		{
+			if (steam_id <= after_steam_id)
+				return true;
+
+			if (page.size() < static_cast<size_t>(limit))
+			{
+				page.push(steam_id);
+			}
+			else if (steam_id < page.top())
+			{
+				page.pop();
+				page.push(steam_id);
+			}
+			return true;
+		});
+
+		TArray<uint64> members;
+		members.SetNum(static_cast<int32>(page.size()));
+
+		for (int32 i = members.Num() - 1; i >= 0; --i)
+		{
+			members[i] = page.top();
+			page.pop();
+		}
+
+		return members;
 	}
 
 	bool IsPlayerInGroup(uint64 steam_id, const FString& group)
 	{
-		TArray<FString> groups = GetPlayerGroups(steam_id);
+		const auto snapshot = Snapshot::Get();
+
+		const auto groups = Snapshot::FindPlayerGroups(*snapshot, steam_id);
+		if (!groups)
+			return false;
 
-		for (const auto& current_group : groups)
+		for (const auto& current_group : *groups)
 		{
 			if (current_group == group)
 				return true;
@@ -45,60 +314,181 @@ namespace Permissions
 
 	std::optional<std::string> AddPlayerToGroup(uint64 steam_id, const FString& group)
 	{
-		return database->AddPlayerToGroup(steam_id, group);
+		auto result = database->AddPlayerToGroup(steam_id, group);
+		if (!result.has_value())
+		{
+			Snapshot::Update(*database, {steam_id}, {});
+			NotifyGroupsChanged(steam_id);
+		}
+
+		return result;
 	}
 
 	std::optional<std::string> RemovePlayerFromGroup(uint64 steam_id, const FString& group)
 	{
-		return database->RemovePlayerFromGroup(steam_id, group);
+		auto result = database->RemovePlayerFromGroup(steam_id, group);
+		if (!result.has_value())
+		{
+			Snapshot::Update(*database, {steam_id}, {});
+			NotifyGroupsChanged(steam_id);
+		}
+
+		return result;
+	}
+
+	void AddPlayerToGroupAsync(const FString& id, uint64 steam_id, const FString& group,
+	                           const std::function<void(std::optional<std::string>)>& callback)
+	{
+		auto result = std::make_shared<std::optional<std::string>>();
+
+		Async::Queue(id, [steam_id, group, result](IDatabase& db)
+		{
+			*result = db.AddPlayerToGroup(steam_id, group);
+			if (!result->has_value())
+				Snapshot::Update(db, {steam_id}, {});
+		}, [steam_id, callback, result]
+		{
+			if (!result->has_value())
+				NotifyGroupsChanged(steam_id);
+
+			if (callback)
+				callback(*result);
+		});
+	}
+
+	void RemovePlayerFromGroupAsync(const FString& id, uint64 steam_id, const FString& group,
+	                                const std::function<void(std::optional<std::string>)>& callback)
+	{
+		auto result = std::make_shared<std::optional<std::string>>();
+
+		Async::Queue(id, [steam_id, group, result](IDatabase& db)
+		{
+			*result = db.RemovePlayerFromGroup(steam_id, group);
+			if (!result->has_value())
+				Snapshot::Update(db, {steam_id}, {});
+		}, [steam_id, callback, result]
+		{
+			if (!result->has_value())
+				NotifyGroupsChanged(steam_id);
+
+			if (callback)
+				callback(*result);
+		});
 	}
 
 	std::optional<std::string> AddGroup(const FString& group)
 	{
-		return database->AddGroup(group);
+		auto result = database->AddGroup(group);
+		if (!result.has_value())
+		{
+			Snapshot::Update(*database, {}, {group});
+			NotifyGroupChanged(group);
+		}
+
+		return result;
 	}
 
 	std::optional<std::string> RemoveGroup(const FString& group)
 	{
-		return database->RemoveGroup(group);
+		const TArray<uint64> group_members = GetGroupMembers(group);
+
+		auto result = database->RemoveGroup(group);
+		if (!result.has_value())
+		{
+			Snapshot::Update(*database, group_members, {group});
+
+			for (uint64 steam_id : group_members)
+			{
+				NotifyGroupsChanged(steam_id);
+			}
+
+			NotifyGroupChanged(group);
+		}
+
+		return result;
 	}
 
 	bool IsGroupHasPermission(const FString& group, const FString& permission)
 	{
-		if (!database->IsGroupExists(group))
+		const auto snapshot = Snapshot::Get();
+
+		const auto found = Snapshot::FindGroup(*snapshot, group);
+		if (!found)
 			return false;
 
-		TArray<FString> permissions = GetGroupPermissions(group);
+		return found->permissions.Contains(permission);
+	}
+
+	bool IsPlayerHasPermission(uint64 steam_id, const FString& permission)
+	{
+		// One snapshot for the whole check, so a concurrent update can't mix two versions of the groups
+		const auto snapshot = Snapshot::Get();
+
+		const auto groups = Snapshot::FindPlayerGroups(*snapshot, steam_id);
+		if (!groups)
+			return false;
 
-		for (const auto& current_perm : permissions)
+		for (const auto& current_group : *groups)
 		{
-			if (current_perm == permission)
-				return true;
+			const auto found = Snapshot::FindGroup(*snapshot, current_group);
+			if (!found)
+				continue;
+
+			for (const auto& current_permission : found->permissions)
+			{
+				if (current_permission == permission || current_permission == L"*")
+					return true;
+			}
 		}
 
 		return false;
 	}
 
-	bool IsPlayerHasPermission(uint64 steam_id, const FString& permission)
+	std::optional<std::string> GroupGrantPermission(const FString& group, const FString& permission)
 	{
-		TArray<FString> groups = GetPlayerGroups(steam_id);
+		auto result = database->GroupGrantPermission(group, permission);
+		if (!result.has_value())
+		{
+			Snapshot::Update(*database, {}, {group});
+			NotifyGroupChanged(group);
+		}
+
+		return result;
+	}
 
-		for (const auto& current_group : groups)
+	std::optional<std::string> GroupRevokePermission(const FString& group, const FString& permission)
+	{
+		auto result = database->GroupRevokePermission(group, permission);
+		if (!result.has_value())
 		{
-			if (IsGroupHasPermission(current_group, permission) || IsGroupHasPermission(current_group, "*"))
-				return true;
+			Snapshot::Update(*database, {}, {group});
+			NotifyGroupChanged(group);
 		}
 
-		return false;
+		return result;
 	}
 
-	std::optional<std::string> GroupGrantPermission(const FString& group, const FString& permission)
+	void AddGroupsChangedCallback(const FString& id, const std::function<void(uint64)>& callback)
 	{
-		return database->GroupGrantPermission(group, permission);
+		RemoveGroupsChangedCallback(id);
+		groups_changed_callbacks.emplace_back(id, callback);
 	}
 
-	std::optional<std::string> GroupRevokePermission(const FString& group, const FString& permission)
+	void RemoveGroupsChangedCallback(const FString& id)
+	{
+		groups_changed_callbacks.erase(std::remove_if(groups_changed_callbacks.begin(), groups_changed_callbacks.end(),
+			[&id](const auto& callback) { return callback.first == id; }), groups_changed_callbacks.end());
+	}
+
+	void AddGroupChangedCallback(const FString& id, const std::function<void(const FString&)>& callback)
+	{
+		RemoveGroupChangedCallback(id);
+		group_changed_callbacks.emplace_back(id, callback);
+	}
+
+	void RemoveGroupChangedCallback(const FString& id)
 	{
-		return database->GroupRevokePermission(group, permission);
+		group_changed_callbacks.erase(std::remove_if(group_changed_callbacks.begin(), group_changed_callbacks.end(),
+			[&id](const auto& callback) { return callback.first == id; }), group_changed_callbacks.end());
 	}
 }
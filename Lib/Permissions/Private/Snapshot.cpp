@@ -0,0 +1,146 @@
+#include "Snapshot.h"
+
+#include "Main.h"
+
+#include <cwctype>
+#include <mutex>
+
+namespace Permissions::Snapshot
+{
+	std::shared_ptr<const Data> current = std::make_shared<const Data>();
+	std::mutex update_mutex;
+	std::chrono::seconds no_groups_ttl{600};
+
+	uint32 NowSecs()
+	{
+		return static_cast<uint32>(std::chrono::duration_cast<std::chrono::seconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
+	// Keeps a player in exactly one of the two maps
+	template <typename Groups>
+	void AssignPlayerGroups(Data& data, uint64 steam_id, const Groups& groups)
+	{
+		if (groups.Num() == 0)
+		{
+			data.player_groups.erase(steam_id);
+			data.no_groups[steam_id] = NowSecs() + static_cast<uint32>(no_groups_ttl.count());
+		}
+		else
+		{
+			data.no_groups.erase(steam_id);
+			data.player_groups[steam_id] = groups;
+		}
+	}
+
+	void AssignGroupKey(const FString& group, std::wstring& key)
+	{
+		key.assign(*group, group.Len());
+
+		for (wchar_t& c : key)
+		{
+			c = static_cast<wchar_t>(std::towlower(c));
+		}
+	}
+
+	std::wstring GroupKey(const FString& group)
+	{
+		std::wstring key;
+		AssignGroupKey(group, key);
+
+		return key;
+	}
+
+	const PlayerGroups& EmptyGroups()
+	{
+		static const PlayerGroups empty;
+		return empty;
+	}
+
+	const PlayerGroups* FindPlayerGroups(const Data& data, uint64 steam_id)
+	{
+		const auto iter = data.player_groups.find(steam_id);
+		if (iter != data.player_groups.end())
+			return &iter->second;
+
+		// Signed difference, so the entry stays valid across a wrap of the clock
+		const auto empty = data.no_groups.find(steam_id);
+		return empty != data.no_groups.end() && static_cast<int32>(empty->second - NowSecs()) > 0 ? &EmptyGroups() : nullptr;
+	}
+
+	const Group* FindGroup(const Data& data, const FString& group)
+	{
+		// Keeps its capacity between calls, so only the first few lookups on a thread allocate
+		thread_local std::wstring key;
+		AssignGroupKey(group, key);
+
+		const auto iter = data.groups.find(key);
+		return iter != data.groups.end() ? &iter->second : nullptr;
+	}
+
+	std::shared_ptr<const Data> Get()
+	{
+		return std::atomic_load(&current);
+	}
+
+	void Load(std::chrono::seconds negative_ttl)
+	{
+		std::lock_guard<std::mutex> lock(update_mutex);
+
+		no_groups_ttl = std::max(negative_ttl, std::chrono::seconds(0));
+
+		auto data = std::make_shared<Data>();
+
+		for (const auto& player : database->GetAllPlayersGroups())
+		{
+			AssignPlayerGroups(*data, player.first, player.second);
+		}
+
+		for (const FString& group : database->GetAllGroups())
+		{
+			data->groups[GroupKey(group)] = {group, database->GetGroupPermissions(group)};
+		}
+
+		std::atomic_store(&current, std::shared_ptr<const Data>(std::move(data)));
+	}
+
+	void Update(IDatabase& db, const TArray<uint64>& steam_ids, const TArray<FString>& groups)
+	{
+		std::lock_guard<std::mutex> lock(update_mutex);
+
+		auto data = std::make_shared<Data>(*Get());
+
+		for (uint64 steam_id : steam_ids)
+		{
+			if (db.IsPlayerExists(steam_id))
+			{
+				AssignPlayerGroups(*data, steam_id, db.GetPlayerGroups(steam_id));
+			}
+			else
+			{
+				data->player_groups.erase(steam_id);
+				data->no_groups.erase(steam_id);
+			}
+		}
+
+		for (const FString& group : groups)
+		{
+			if (db.IsGroupExists(group))
+				data->groups[GroupKey(group)] = {group, db.GetGroupPermissions(group)};
+			else
+				data->groups.erase(GroupKey(group));
+		}
+
+		std::atomic_store(&current, std::shared_ptr<const Data>(std::move(data)));
+	}
+
+	void SetPlayerGroups(uint64 steam_id, const TArray<FString>& groups)
+	{
+		std::lock_guard<std::mutex> lock(update_mutex);
+
+		auto data = std::make_shared<Data>(*Get());
+		AssignPlayerGroups(*data, steam_id, groups);
+
+		std::atomic_store(&current, std::shared_ptr<const Data>(std::move(data)));
+	}
+}
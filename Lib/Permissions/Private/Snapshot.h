@@ -0,0 +1,50 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <unordered_map>
+
+#include "Database/IDatabase.h"
+
+namespace Permissions::Snapshot
+{
+	struct Group
+	{
+		FString name;
+		TArray<FString> permissions;
+	};
+
+	// Players are in a few groups at most, so their names are kept inline in the map node
+	using PlayerGroups = TArray<FString, TInlineAllocator<4>>;
+
+	// Never modified once published, readers keep the version they loaded alive
+	struct Data
+	{
+		// Only players in at least one group, most players are in none
+		std::unordered_map<uint64, PlayerGroups> player_groups;
+		// Known players in no group, with the steady clock second the entry stops being trusted.
+		// Past it the player counts as unknown again, so the next login reads the database once more
+		std::unordered_map<uint64, uint32> no_groups;
+		// Keyed by lower case name, group names are case insensitive
+		std::unordered_map<std::wstring, Group> groups;
+	};
+
+	std::wstring GroupKey(const FString& group);
+
+	// Shared by every player in no group
+	const PlayerGroups& EmptyGroups();
+
+	// Lookups for the membership checks, neither one copies the stored arrays or allocates a key.
+	// Players known to be in no group get EmptyGroups(), unknown players and expired entries nullptr
+	const PlayerGroups* FindPlayerGroups(const Data& data, uint64 steam_id);
+	const Group* FindGroup(const Data& data, const FString& group);
+
+	std::shared_ptr<const Data> Get();
+
+	// negative_ttl is how long a player read without groups is answered from the snapshot
+	void Load(std::chrono::seconds negative_ttl);
+	// Re-reads these players and groups from the database and publishes a new copy
+	void Update(IDatabase& db, const TArray<uint64>& steam_ids, const TArray<FString>& groups);
+	// Publishes groups already read for one player
+	void SetPlayerGroups(uint64 steam_id, const TArray<FString>& groups);
+}
@@ -11,13 +11,33 @@
 namespace Permissions
 {
 	ARK_API TArray<FString> GetPlayerGroups(uint64 steam_id);
+	// One query for all ids, players without a row are left out of the result
+	ARK_API TMap<uint64, TArray<FString>> GetPlayersGroups(const TArray<uint64>& steam_ids);
+	// Runs GetPlayersGroups on a background connection, callback is called on the game thread
+	ARK_API void GetPlayersGroupsAsync(const FString& id, const TArray<uint64>& steam_ids,
+	                                   const std::function<void(TMap<uint64, TArray<FString>>)>& callback);
+	// Drops every request made with this id that has not called back yet
+	ARK_API void CancelPlayersGroupsAsync(const FString& id);
 	ARK_API TArray<FString> GetGroupPermissions(const FString& group);
 	ARK_API TArray<uint64> GetGroupMembers(const FString& group);
+	// Calls callback with every member without copying them into an array, returning false stops the walk
+	ARK_API void ForEachGroupMember(const FString& group, const std::function<bool(uint64)>& callback);
+	// Up to limit members with a steam id above after_steam_id in ascending order. Pass the last id of a page to get the next one
+	ARK_API TArray<uint64> GetGroupMembersPage(const FString& group, uint64 after_steam_id, int32 limit);
+	ARK_API TArray<FString> GetAllGroups();
+	ARK_API void ForEachGroup(const std::function<bool(const FString&)>& callback);
+	// Up to limit groups ordered by lower case name after after_group, an empty after_group starts at the first one
+	ARK_API TArray<FString> GetGroupsPage(const FString& after_group, int32 limit);
 
 	ARK_API bool IsPlayerInGroup(uint64 steam_id, const FString& group);
 
 	ARK_API std::optional<std::string> AddPlayerToGroup(uint64 steam_id, const FString& group);
 	ARK_API std::optional<std::string> RemovePlayerFromGroup(uint64 steam_id, const FString& group);
+	// Async versions run on a worker, callback is called on the game thread. Cancel with CancelPlayersGroupsAsync(id)
+	ARK_API void AddPlayerToGroupAsync(const FString& id, uint64 steam_id, const FString& group,
+	                                   const std::function<void(std::optional<std::string>)>& callback);
+	ARK_API void RemovePlayerFromGroupAsync(const FString& id, uint64 steam_id, const FString& group,
+	                                        const std::function<void(std::optional<std::string>)>& callback);
 
 	ARK_API std::optional<std::string> AddGroup(const FString& group);
 	ARK_API std::optional<std::string> RemoveGroup(const FString& group);
@@ -27,4 +47,12 @@ namespace Permissions
 
 	ARK_API std::optional<std::string> GroupGrantPermission(const FString& group, const FString& permission);
 	ARK_API std::optional<std::string> GroupRevokePermission(const FString& group, const FString& permission);
+
+	// Called with the steam id of every player whose groups were changed through this API
+	ARK_API void AddGroupsChangedCallback(const FString& id, const std::function<void(uint64)>& callback);
+	ARK_API void RemoveGroupsChangedCallback(const FString& id);
+	// Called with every group that was added, removed, or granted or revoked a permission through this API. Permission checks
+	// cached for its members are stale from then on, members of a removed group also get the groups changed callback
+	ARK_API void AddGroupChangedCallback(const FString& id, const std::function<void(const FString&)>& callback);
+	ARK_API void RemoveGroupChangedCallback(const FString& id);
 }
@@ -1,18 +1,230 @@
 #include <API/ARK/Ark.h>
+#include <Logger/spdlog/async_logger.h>
 #include "NewPlayerProtection.h"
+#include "NewPlayerProtectionCapture.h"
+#include "NewPlayerProtectionAudit.h"
+#include "NewPlayerProtectionStats.h"
+#include "NewPlayerProtectionEvents.h"
+#include "NewPlayerProtectionRaidStats.h"
+#include "NewPlayerProtectionPacking.h"
+#include "NewPlayerProtectionSnapshot.h"
+#include "NewPlayerProtectionJournal.h"
 #include "NewPlayerProtectionConfig.h"
+#include "NewPlayerProtectionStructureGrid.h"
+#include "NewPlayerProtectionSharedTable.h"
+#include "NewPlayerProtectionExports.h"
+#include "NewPlayerProtectionDBWriter.h"
+#include "NewPlayerProtectionTasks.h"
+#include "NewPlayerProtectionIntegrity.h"
+#include "NewPlayerProtectionCluster.h"
+#include "NewPlayerProtectionReplica.h"
 #include "NewPlayerProtectionHooks.h"
+#include "NewPlayerProtectionReplication.h"
+#include "NewPlayerProtectionMetrics.h"
+#include "NewPlayerProtectionWebhook.h"
 #include "NewPlayerProtectionCommands.h"
+#include "NewPlayerProtectionBenchmark.h"
+#include "NewPlayerProtectionSimulation.h"
+#include "NewPlayerProtectionStress.h"
+#include "NewPlayerProtectionBackup.h"
+#include "NewPlayerProtectionTableExport.h"
+#include "NewPlayerProtectionWipe.h"
+#include "NewPlayerProtectionConfigWatcher.h"
 
 #pragma comment(lib, "ArkApi.lib")
 
-void Init()
+//only expands to anything when built with ARK_TRACE_ETW
+ARK_TRACE_DEFINE_PROVIDER("NewPlayerProtection", (0x1bd40d59, 0x990e, 0x4108, 0xaf, 0x8f, 0xc0, 0x07, 0xa8, 0x6d, 0x7f, 0x62));
+
+void InitLog()
 {
 	Log::Get().Init("NewPlayerProtection");
 
+	//same sinks and pattern as the api logger, but lines are written by spdlog's worker instead of the game thread
+	auto& sinks = GetLogSinks();
+	auto logger = std::make_shared<spdlog::async_logger>("NewPlayerProtection", begin(sinks), end(sinks), 8192,
+		spdlog::async_overflow_policy::block_retry, nullptr, std::chrono::seconds(2));
+
+	logger->set_pattern("%D %R [%n][%l] %v");
+	//info lines are flushed by the worker every 2 seconds, warnings and errors right away
+	logger->flush_on(spdlog::level::warn);
+
+	Log::GetLog() = logger;
+}
+
+void InitClusterSync()
+{
+	const auto settings = NewPlayerProtection::GetSettings();
+
+	if (!settings->ClusterSyncEnabled)
+		return;
+
+	NewPlayerProtection::ClusterOptions options;
+	options.host = settings->ClusterMysqlHost;
+	options.user = settings->ClusterMysqlUser;
+	options.password = settings->ClusterMysqlPassword;
+	options.database = settings->ClusterMysqlDatabase;
+	options.server_id = settings->ClusterServerId;
+	options.sync_interval = std::chrono::seconds(std::max(1, settings->ClusterSyncIntervalInSecs));
+
+	NewPlayerProtection::ClusterSync::Get().Start(options);
+}
+
+void InitReplication()
+{
+	const auto settings = NewPlayerProtection::GetSettings();
+
+	NewPlayerProtection::ReplicationOptions options;
+	options.nodes = settings->ClusterNodes;
+	options.node_index = settings->ClusterNodeIndex;
+	options.key = settings->ClusterReplicationKey;
+
+	NewPlayerProtection::Replication::Get().Start(options);
+}
+
+void InitSharedTable()
+{
+	const auto settings = NewPlayerProtection::GetSettings();
+
+	NewPlayerProtection::SharedProtectionTable::Get().Start(settings->SharedTableName, settings->SharedTableWriter, settings->SharedTableCapacity);
+}
+
+//game thread, first tick after the loader thread finished LoadDB
+void OnDatabaseLoaded()
+{
+	InitClusterSync();
+	InitReplication();
+	InitSharedTable();
+
+	if (NewPlayerProtection::IsReplica())
+	{
+		NewPlayerProtection::ReplicaSync::Get().Start();
+	}
+
+	NewPlayerProtection::AdminCommandQueue::Get().Start();
+	InitCommands();
+	NewPlayerProtection::EventBus::Get().Subscribe("NPPNotifications", &NotifyProtectionEvents);
+	NewPlayerProtection::EventBus::Get().Enable();
+	NewPlayerProtection::MetricsPusher::Get().Start();
+	NewPlayerProtection::WebhookSink::Get().Start();
+	NewPlayerProtection::DatabaseBackup::Get().Start();
+	NewPlayerProtection::TableExport::Get().Start();
+	NewPlayerProtection::IntegrityChecker::Get().Start();
+
+	if (const size_t connected = QueueConnectedPlayers())
+	{
+		NPP_LOG(info, "NPP picked up {} players that were already connected.", connected);
+	}
+
+	if (NewPlayerProtection::GetSettings()->WatchConfigFile)
+	{
+		NewPlayerProtection::ConfigWatcher::Get().Start(ArkApi::Tools::GetCurrentDir() + "/ArkApi/Plugins/NewPlayerProtection", "config.json", MapConfigFileName());
+	}
+
+	Log::GetLog()->info("NPP database loaded, protection is active.");
+}
+
+//called by the api right after the dll is loaded, outside the loader lock. the tables are read on dbLoader,
+//the hooks answer from BlockDamageWhileLoading until then and the rest starts in OnDatabaseLoaded
+extern "C" __declspec(dllexport) void Plugin_Init()
+{
+	InitLog();
+	API::Trace::Register();
+
 	InitConfig();
+
+	//a replica has nothing to write, every batch it would queue is dropped
+	if (!NewPlayerProtection::IsReplica())
+	{
+		NewPlayerProtection::DBWriter::Get().Start(NewPlayerProtection::GetDBPath());
+	}
+
+	NewPlayerProtection::GameTasks::Get().Start(NewPlayerProtection::GetDBPath());
 	InitHooks();
-	InitCommands();
+}
+
+//hooks, commands and timers that change the tables or read them for others. run once, by Plugin_Unload before the
+//last save so nothing is changed after it, or by DllMain when the process exits without Plugin_Unload
+void StopIntake()
+{
+	static bool stopped = false;
+
+	if (stopped)
+		return;
+
+	stopped = true;
+
+	RemoveHooks();
+	RemoveCommands();
+	NewPlayerProtection::AdminCommandQueue::Get().Stop();
+	ArkApi::GetCommands().RemoveOnTimerCallback("UpdateTimer");
+	ArkApi::GetCommands().RemoveOnTickCallback("NPPDamageTick");
+	NewPlayerProtection::ConfigWatcher::Get().Stop();
+	NewPlayerProtection::MetricsPusher::Get().Stop();
+	NewPlayerProtection::WebhookSink::Get().Stop();
+	NewPlayerProtection::Replication::Get().Stop();
+	NewPlayerProtection::SharedProtectionTable::Get().Stop();
+	NewPlayerProtection::TableExport::Get().Stop();
+	NewPlayerProtection::ReplicaSync::Get().Stop();
+}
+
+//called by the api before the dll is unloaded, the worker threads are waited for here and not under the loader lock in DllMain.
+//intake is stopped first, then the threads reading the database, then the dirty rows go to the writer as one save and
+//the writer is drained, all within UnloadTimeoutInSecs. DllMain is left with threads that are already stopped
+extern "C" __declspec(dllexport) void Plugin_Unload()
+{
+	//the loader thread may still be reading the tables the hooks below flush from
+	if (NewPlayerProtection::dbLoader.joinable())
+	{
+		NewPlayerProtection::dbLoader.join();
+	}
+
+	const auto started = std::chrono::steady_clock::now();
+	const auto deadline = started + std::chrono::seconds(std::max(1, NewPlayerProtection::GetSettings()->UnloadTimeoutInSecs));
+
+	//what is left of the budget, the readers get a few seconds of it at most so the writer keeps the rest
+	const auto remaining = [&deadline](std::chrono::milliseconds cap)
+	{
+		const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+		return std::max(std::chrono::milliseconds(0), std::min(left, cap));
+	};
+	const auto uncapped = std::chrono::milliseconds::max();
+
+	StopIntake();
+
+	//their continuations would run on ticks that do not come anymore
+	NewPlayerProtection::IntegrityChecker::Get().Stop(remaining(std::chrono::seconds(2)));
+	NewPlayerProtection::DatabaseBackup::Get().Stop(remaining(std::chrono::seconds(2)));
+	NewPlayerProtection::GameTasks::Get().Stop(remaining(std::chrono::seconds(5)));
+
+	//only the rows changed since the last SaveWorld, written in one transaction. a save right before, from the game's own
+	//shutdown save, leaves nothing dirty and this one empty
+	if (NewPlayerProtection::IsLoaded())
+	{
+		QueueProtectionSave();
+
+		//the warm start of the next instance, at the generation of the save just queued
+		if (NewPlayerProtection::GetSettings()->HotReloadHandoff)
+		{
+			WriteHandoff();
+		}
+	}
+
+	NewPlayerProtection::ClusterSync::Get().Stop(remaining(uncapped));
+	NewPlayerProtection::DBWriter::Get().Stop(remaining(uncapped));
+	//after the writer, its last commit may still compact the journal
+	NewPlayerProtection::Journal::Get().Stop(remaining(uncapped));
+
+	NPP_LOG(info, "NPP unloaded in {} ms.",
+		std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started).count());
+
+	NewPlayerProtection::BlockedDamage.Flush();
+	Log::GetLog()->flush();
+
+	//back to a sync logger, destroying the async one joins its worker
+	Log::Get().Init("NewPlayerProtection");
+
+	API::Trace::Unregister();
 }
 
 BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserved)
@@ -20,11 +232,25 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserv
 	switch (ul_reason_for_call)
 	{
 	case DLL_PROCESS_ATTACH:
-		Init();
+		//everything else waits for Plugin_Init, nothing here may wait on another thread
+		DisableThreadLibraryCalls(hModule);
 		break;
 	case DLL_PROCESS_DETACH:
-		RemoveHooks();
-		RemoveCommands();
+		//only still running when the process exits without Plugin_Unload, joining here would deadlock
+		if (NewPlayerProtection::dbLoader.joinable())
+		{
+			NewPlayerProtection::dbLoader.detach();
+		}
+
+		//after Plugin_Unload all of these are stopped already and return right away
+		StopIntake();
+		NewPlayerProtection::IntegrityChecker::Get().Stop(std::chrono::seconds(5));
+		NewPlayerProtection::DatabaseBackup::Get().Stop(std::chrono::seconds(5));
+		NewPlayerProtection::GameTasks::Get().Stop(std::chrono::seconds(5));
+		NewPlayerProtection::ClusterSync::Get().Stop(std::chrono::seconds(10));
+		NewPlayerProtection::DBWriter::Get().Stop(std::chrono::seconds(10));
+		//after the writer, its last commit may still compact the journal
+		NewPlayerProtection::Journal::Get().Stop(std::chrono::seconds(5));
 		break;
 	default:
 		return FALSE;
@@ -1,74 +1,1731 @@
 #pragma once
 
 #include <Logger/Logger.h>
+#include <Timer.h>
+#include <Trace.h>
 #include <API/UE/Containers/FString.h>
 #include "hdr/sqlite_modern_cpp.h"
-#include "json.hpp"
+#include <json.hpp>
+#include "NewPlayerProtectionMessage.h"
+#include <string_view>
+#include <map>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <queue>
+#include <memory>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
  
 namespace NewPlayerProtection
 {
-	int PlayerUpdateIntervalInMins;
-	bool IgnoreAdmins;
-	bool AllowNewPlayersToDamageEnemyStructures;
-	bool AllowPlayersToDisableOwnedTribeProtection;
-	bool AllowWildCorruptedDinoDamage;
-	bool AllowWildDinoDamage;
-
-	int NPPPlayerDecayInHours;
-	FString NPPCommandPrefix;
-	FString NPPAdminGroup;
-
-	FString NewPlayerDoingDamageMessage;
-	FString NewPlayerStructureTakingDamageMessage;
-	FString NewPlayerStructureTakingDamageFromUnknownTribemateMessage;
-
-	FString NPPRemainingMessage;
-	FString NPPInfoMessage;
-	FString NPPInvalidCommand;
-	FString NewPlayerProtectionDisableSuccess;
-	FString NotANewPlayerMessage;
-	FString NotTribeAdminMessage;
-	FString TribeIDText;
-	FString NoStructureForTribeIDText;
-	FString PVEDisablePlayerMessage;
-	FString PVEStatusMessage;
-	FString NotAStructureMessage;
-
-	FString AdminNoTribeExistsMessage;
-	FString AdminTribeProtectionRemoved;
-	FString AdminTribeNotUnderProtection;
-	FString AdminResetTribeProtectionSuccess;
-	FString AdminResetTribeProtectionLvlFailure;
-	FString AdminPVETribeAddedSuccessMessage;
-	FString AdminPVETribeAlreadyAddedMessage;
-	FString AdminPVETribeRemovedSuccessMessage;
-	FString AdminPVETribeAlreadyRemovedMessage;
-
-	int MessageIntervalInSecs;
-	float MessageTextSize;
-	float MessageDisplayDelay;
-	FLinearColor  MessageColor;
-
-	int MaxLevel;
-	int HoursOfProtection;
-
-	std::vector<std::string> StructureExemptions;
-
-	std::chrono::time_point<std::chrono::system_clock>  next_player_update;
+	//replacement fields in a log format, {{ and }} are literal braces
+	constexpr size_t CountFormatArgs(const char* format)
+	{
+		size_t count = 0;
+
+		for (; *format; ++format)
+		{
+			if (*format == '{')
+			{
+				if (format[1] == '{')
+				{
+					++format;
+					continue;
+				}
+				++count;
+			}
+		}
+		return count;
+	}
+
+	//only named in decltype, the arguments are never evaluated
+	template <typename... Args>
+	std::integral_constant<size_t, sizeof...(Args)> CountLogArgs(const Args&...);
+}
+
+//every NPP log line with arguments. the bundled fmt has no compiled formats, so the fields are counted against the
+//arguments at compile time instead, and the arguments are only evaluated, and the format only parsed, when lvl is on.
+//lvl is an spdlog::level name, info, warn or err
+#define NPP_LOG(lvl, format, ...) \
+	do \
+	{ \
+		static_assert(NewPlayerProtection::CountFormatArgs(format) == decltype(NewPlayerProtection::CountLogArgs(__VA_ARGS__))::value, \
+			"NPP log format does not match its arguments"); \
+		const auto& npp_logger = Log::GetLog(); \
+		if (npp_logger->should_log(spdlog::level::lvl)) \
+		{ \
+			npp_logger->log(spdlog::level::lvl, format, __VA_ARGS__); \
+		} \
+	} while (false)
+
+namespace NewPlayerProtection
+{
+	//blueprint paths exempt from protection, exact paths are hashed and entries ending in '*' match every path starting
+	//with the rest. prefixes are walked as a trie, so a check costs one hash and at most one pass over the path.
+	class StructureExemptionSet
+	{
+		public:
+			void Add(std::wstring path)
+			{
+				if (path.empty() || path.back() != L'*')
+				{
+					exact_.insert(std::move(path));
+					return;
+				}
+
+				path.pop_back();
+
+				if (nodes_.empty())
+				{
+					nodes_.emplace_back();
+				}
+
+				uint32 node = 0;
+
+				for (const wchar_t c : path)
+				{
+					uint32 child = Child(node, c);
+
+					if (child == 0)
+					{
+						child = static_cast<uint32>(nodes_.size());
+						nodes_[node].children.emplace_back(c, child);
+						nodes_.emplace_back();
+					}
+					node = child;
+				}
+				nodes_[node].terminal = true;
+			}
+
+			bool Matches(std::wstring_view path) const
+			{
+				if (!exact_.empty() && exact_.find(std::wstring(path)) != exact_.end())
+					return true;
+
+				if (nodes_.empty())
+					return false;
+
+				uint32 node = 0;
+
+				for (const wchar_t c : path)
+				{
+					if (nodes_[node].terminal)
+						return true;
+
+					node = Child(node, c);
+
+					if (node == 0)
+						return false;
+				}
+				return nodes_[node].terminal;
+			}
+
+			bool Empty() const
+			{
+				return exact_.empty() && nodes_.empty();
+			}
+
+		private:
+			struct Node
+			{
+				//few children per node past the shared "Blueprint'/Game/" start, a scan beats a map
+				std::vector<std::pair<wchar_t, uint32>> children;
+				bool terminal = false;
+			};
+
+			//0 when missing, the root is never a child
+			uint32 Child(uint32 node, wchar_t c) const
+			{
+				for (const auto& child : nodes_[node].children)
+				{
+					if (child.first == c)
+						return child.second;
+				}
+				return 0;
+			}
+
+			std::unordered_set<std::wstring> exact_;
+			//nodes_[0] is the root, empty without prefix entries
+			std::vector<Node> nodes_;
+	};
+
+	//everything LoadConfig reads, built once per load and never modified after it is published
+	struct Settings
+	{
+		//database file used instead of the one in the plugin folder when set
+		std::string DbPathOverride;
+		int PlayerUpdateIntervalInMins = 0;
+		//online players are re-read sooner the closer they are to NewPlayerMaxLevel or expiry, between every 10 seconds and
+		//every 4 PlayerUpdateIntervalInMins, instead of all of them once per PlayerUpdateIntervalInMins
+		bool AdaptivePlayerRefresh = false;
+		bool IgnoreAdmins = false;
+		bool AllowNewPlayersToDamageEnemyStructures = false;
+		bool AllowPlayersToDisableOwnedTribeProtection = false;
+		bool AllowWildCorruptedDinoDamage = false;
+		bool AllowWildDinoDamage = false;
+		//repeated hits on the same structure by the same causer are answered from StructureVerdicts
+		bool CacheStructureVerdicts = false;
+		//DamageRules checks every lookup against the rules it was compiled from
+		bool DamageDecisionTableTestMode = false;
+
+		int NPPPlayerDecayInHours = 0;
+		//inactive records kept in memory past this are evicted on save, 0 keeps everything
+		size_t MaxResidentPlayers = 0;
+		//records TakeDamage hits into DamageCapture.bin, kept to the last DamageCaptureMaxEvents hits
+		bool CaptureDamageEvents = false;
+		size_t DamageCaptureMaxEvents = 0;
+		//metrics are pushed only when the url is set, MetricsFormat is "prometheus" or "influx"
+		std::string MetricsPushUrl;
+		std::string MetricsFormat;
+		int MetricsSampleIntervalInSecs = 0;
+		int MetricsPushIntervalInSecs = 0;
+		//protection events are posted here as Discord style messages when the url is set, at most one post per interval
+		std::string WebhookUrl;
+		int WebhookIntervalInSecs = 0;
+		int WebhookMaxQueuedEvents = 0;
+		//players and PVE tribes shared with the other maps through MySQL, read once at startup
+		bool ClusterSyncEnabled = false;
+		std::string ClusterMysqlHost;
+		std::string ClusterMysqlUser;
+		std::string ClusterMysqlPassword;
+		std::string ClusterMysqlDatabase;
+		std::string ClusterServerId;
+		int ClusterSyncIntervalInSecs = 0;
+		//host:port of every node, same list and order on every map, replication is off while it is empty
+		std::vector<std::string> ClusterNodes;
+		size_t ClusterNodeIndex = 0;
+		std::string ClusterReplicationKey;
+		//this map only enforces what the home map writes to the shared database, it saves nothing and expires nothing itself.
+		//read once at startup
+		bool ClusterReplicaMode = false;
+		int ClusterReplicaRefreshInSecs = 0;
+		//protection is shared with the other server processes on this host through a named mapping, off while the name is empty.
+		//one map per host is the writer, read once at startup
+		std::string SharedTableName;
+		bool SharedTableWriter = false;
+		size_t SharedTableCapacity = 0;
+		//resident tables are also written to NewPlayerProtection.db.snapshot on save and read from it on startup
+		bool WriteSnapshotOnSave = false;
+		//the tables are handed to the next instance through NewPlayerProtection.db.handoff when the plugin manager reloads NPP
+		bool HotReloadHandoff = false;
+		//config.json is reloaded on its own when it changes, read once at startup
+		bool WatchConfigFile = false;
+		//structure damage is blocked instead of allowed while the database is still loading
+		bool BlockDamageWhileLoading = false;
+		//explosions resolve their instigator once for every structure in the radius, read once at startup
+		bool PrefilterRadialDamage = false;
+		//turrets and tamed dinos of other tribes never pick a protected tribe's structure as a target, read once at startup
+		bool SuppressProtectedTargeting = false;
+		//changes are appended to NewPlayerProtection.db.journal between saves, read once at startup
+		bool JournalChanges = false;
+		//rows not seen for DecayedPlayerRetentionInHours are deleted this often, never earlier than NPPPlayerDecayInHours.
+		//0 turns the purge off, PurgeDryRun only logs how many rows it would delete
+		int PurgeDecayedPlayersEveryHours = 0;
+		int DecayedPlayerRetentionInHours = 0;
+		bool PurgeDryRun = false;
+		//purged rows are moved to NewPlayerProtection_archive.db instead of deleted, read once at startup
+		bool ArchiveDecayedPlayers = false;
+		//protection changes are appended to ProtectionAudit.jsonl
+		bool AuditProtectionChanges = false;
+		//time a timer tick may spend on refreshes, notifications, expiry and the blocked damage log before leaving the rest
+		//for the next tick, logins, saves and the journal always run. 0 turns the budget off
+		int TickBudgetInMicros = 0;
+		//blocked hits are logged as one summary line per tribe pair this often
+		int BlockedDamageLogIntervalInSecs = 0;
+		//blocked hits per attacking and attacked tribe pair and minute are appended to RaidHeatmap.csv this often, 0 turns the dump off
+		int RaidStatsDumpIntervalInMins = 0;
+		//SQLite pragmas set on every connection NPP opens, PRAGMA optimize runs once every DBOptimizeEverySaves saves
+		std::string DBSynchronous;
+		int DBCacheSizeKiB = 0;
+		int64 DBMmapSizeMB = 0;
+		std::string DBTempStore;
+		int DBWalAutoCheckpointPages = 0;
+		int DBOptimizeEverySaves = 0;
+		//NewPlayerProtection.db is copied into Backups/ this often, 0 turns the schedule off and leaves NPP.Backup.
+		//BackupsToKeep newest copies are kept, 0 keeps all. read once at startup
+		int BackupEveryHours = 0;
+		size_t BackupsToKeep = 0;
+		int BackupPagesPerStep = 0;
+		int BackupStepDelayInMs = 0;
+		//the Players and Tribes tables are written to Exports/ this often as "csv" or "jsonl", 0 turns the schedule off and leaves NPP.Export
+		int ExportEveryHours = 0;
+		std::string ExportFormat;
+		//PRAGMA quick_check runs this often between IntegrityCheckStartHour and IntegrityCheckEndHour local time while at most
+		//IntegrityCheckMaxOnlinePlayers are online, 0 turns it off
+		int IntegrityCheckEveryHours = 0;
+		int IntegrityCheckStartHour = 0;
+		int IntegrityCheckEndHour = 0;
+		int IntegrityCheckMaxOnlinePlayers = 0;
+		int IntegrityCheckPauseInMs = 0;
+		//NPP's own threads run at BackgroundThreadPriority, "normal", "below_normal", "lowest" or "idle",
+		//and only on the cores in BackgroundThreadAffinityMask, 0 leaves them on all cores. read once at startup
+		std::string BackgroundThreadPriority;
+		uint64 BackgroundThreadAffinityMask = 0;
+		//Plugin_Unload waits at most this long in total for the last save and the threads to finish
+		int UnloadTimeoutInSecs = 0;
+		//online members are told this long before their tribe's protection runs out, 0 turns the warning off
+		int ExpiryWarningInMins = 0;
+		//protected tribes online are sent their !npp status this often, 0 turns the push off. StatusPushOnLogin sends it
+		//to a protected player once after login
+		int StatusPushIntervalInMins = 0;
+		bool StatusPushOnLogin = false;
+		//NPP.RemoveProtection, NPP.ResetProtection, NPP.AddProtection and NPP.SetPVE queued up are applied in batches of at most
+		//this many once a second, repeats on the same tribe merged. 0 runs every command on its own as it comes in
+		int AdminCommandsPerSec = 0;
+		//how long a statement waits for another map writing the same file before the save is retried later
+		int DBBusyTimeoutInMs = 0;
+		FString NPPCommandPrefix;
+		FString NPPAdminGroup;
+
+		MessageTemplate<0> NewPlayerDoingDamageMessage;
+		MessageTemplate<0> NewPlayerStructureTakingDamageMessage;
+		MessageTemplate<0> NewPlayerStructureTakingDamageFromUnknownTribemateMessage;
+
+		MessageTemplate<4> NPPRemainingMessage;
+		MessageTemplate<2> NPPInfoMessage;
+		MessageTemplate<0> NPPInvalidCommand;
+		MessageTemplate<0> NewPlayerProtectionDisableSuccess;
+		MessageTemplate<0> NotANewPlayerMessage;
+		MessageTemplate<0> NotTribeAdminMessage;
+		MessageTemplate<1> TribeIDText;
+		MessageTemplate<0> NoStructureForTribeIDText;
+		MessageTemplate<0> PVEDisablePlayerMessage;
+		MessageTemplate<0> PVEStatusMessage;
+		MessageTemplate<0> NotAStructureMessage;
+		MessageTemplate<1> NPPExpiringMessage;
+		MessageTemplate<0> NPPEndedMessage;
+
+		MessageTemplate<1> AdminNoTribeExistsMessage;
+		MessageTemplate<1> AdminTribeProtectionRemoved;
+		MessageTemplate<1> AdminTribeNotUnderProtection;
+		MessageTemplate<2> AdminResetTribeProtectionSuccess;
+		MessageTemplate<1> AdminResetTribeProtectionLvlFailure;
+		MessageTemplate<1> AdminPVETribeAddedSuccessMessage;
+		MessageTemplate<1> AdminPVETribeAlreadyAddedMessage;
+		MessageTemplate<1> AdminPVETribeRemovedSuccessMessage;
+		MessageTemplate<1> AdminPVETribeAlreadyRemovedMessage;
+		MessageTemplate<4> AdminBulkSummaryMessage;
+
+		int MessageIntervalInSecs = 0;
+		float MessageTextSize = 0.f;
+		float MessageDisplayDelay = 0.f;
+		FLinearColor MessageColor;
+
+		int MaxLevel = 0;
+		int HoursOfProtection = 0;
+
+		StructureExemptionSet StructureExemptions;
+	};
+
+	//swapped as a whole on reload, callers hold the returned pointer for the duration of a call
+	std::shared_ptr<const Settings> settings = std::make_shared<const Settings>();
+
+	inline std::shared_ptr<const Settings> GetSettings()
+	{
+		return std::atomic_load(&settings);
+	}
+
+	//config switches the structure damage check is specialized on
+	enum DamageCheckFlags : unsigned
+	{
+		DamageCheckHasExemptions = 1 << 0,
+		DamageCheckIgnoreAdmins = 1 << 1,
+		DamageCheckAllowNewPlayersToDamage = 1 << 2,
+		DamageCheckAllowWildDinoDamage = 1 << 3,
+		DamageCheckAllowWildCorruptedDinoDamage = 1 << 4,
+		DamageCheckStructureVerdicts = 1 << 5,
+		DamageCheckCombinations = 1 << 6
+	};
+
+	//true when TakeDamage should drop the hit, chosen for the current config on every load
+	using StructureDamageCheck = bool (*)(APrimalStructure* structure, AController* instigator, AActor* causer);
+	StructureDamageCheck structureDamageCheck = nullptr;
+	void SelectStructureDamageCheck(const Settings& settings);
+
+	//utf-8 text from the config or a command reply, converted through one buffer per thread instead of a new string each time
+	inline FString ToFString(const std::string& text)
+	{
+		thread_local std::wstring buffer;
+		ArkApi::Tools::Utf8Decode(text, buffer);
+		return FString(static_cast<int32>(buffer.size()), buffer.c_str());
+	}
+
+	//text is already rendered, so it goes through the FString overload that is not parsed as a format string again
+	inline void SendNotification(AShooterPlayerController* player, const FString& text, float display_time = -1.f)
+	{
+		const auto current = GetSettings();
+		ArkApi::GetApiUtils().SendNotification(player, current->MessageColor, current->MessageTextSize,
+			display_time < 0.f ? current->MessageDisplayDelay : display_time, nullptr, text);
+	}
+
+	//one invalidation scheme for every NPP cache: an entry keeps the counter it was built at and is stale once the counter moved,
+	//so a read is one compare and a new cache needs no clearing code of its own.
+	//protection moves on any protection, PVE, admin or online change, config on every config load, a tribe's counter whenever its
+	//aggregate changes. config loads also move protection and every tribe
+	class CacheEpochs
+	{
+		public:
+			uint32 Protection() const
+			{
+				return protection_;
+			}
+
+			uint32 Config() const
+			{
+				return config_;
+			}
+
+			//era in the high half, so a per tribe entry is checked against its tribe and the config in one compare
+			uint64 Tribe(uint64 tribe_id) const
+			{
+				const auto iter = tribes_.find(tribe_id);
+				return (static_cast<uint64>(era_) << 32) | (iter != tribes_.end() ? iter->second : 0);
+			}
+
+			void BumpProtection()
+			{
+				++protection_;
+			}
+
+			void BumpConfig()
+			{
+				++config_;
+				++protection_;
+				NextEra();
+			}
+
+			//NPP.Wipe, every cache is stale at once without a config load
+			void BumpAll()
+			{
+				++protection_;
+				NextEra();
+			}
+
+			void BumpTribe(uint64 tribe_id)
+			{
+				//values come from one clock, a tribe dropped and read in again never gets an old value back
+				tribes_[tribe_id] = ++tribe_clock_;
+
+				if (tribes_.size() > max_tribes_)
+				{
+					NextEra();
+				}
+			}
+
+			size_t MemoryBytes() const;
+
+		private:
+			//every tribe's stamp moves at once and the counters start over
+			void NextEra()
+			{
+				++era_;
+				tribes_.clear();
+			}
+
+			//tribes that changed since the era started, past this a new era is cheaper than the map
+			static constexpr size_t max_tribes_ = 65536;
+
+			uint32 protection_ = 1;
+			uint32 config_ = 1;
+			uint32 era_ = 1;
+			uint32 tribe_clock_ = 0;
+			std::unordered_map<uint64, uint32> tribes_;
+	};
+
+	CacheEpochs Epochs;
+
+	//UClass -> exempt and the config it was matched against
+	struct ExemptionCacheEntry
+	{
+		uint32 config;
+		bool exempt;
+	};
+	std::unordered_map<UClass*, ExemptionCacheEntry> StructureExemptionCache;
+
+	//UClass -> blueprint path, the path of a class never changes so this is kept across config loads
+	std::unordered_map<UClass*, FString> BlueprintPathCache;
+
+	//UClass -> corrupted dino, corrupted variants are their own classes so the name check runs once per class
+	std::unordered_map<UClass*, bool> CorruptedDinoCache;
+
+	//what TakeDamage decided from tribe and player state alone, per hit checks like wild dinos are done on top of it
+	enum class DamageDecision
+	{
+		Allow,
+		Block,
+		//protected player hitting an enemy structure
+		BlockNewPlayerAttacking,
+		//unprotected player hitting a protected structure
+		BlockProtectedTarget,
+		//attacker is unknown, tell the online members of the attacking tribe
+		BlockUnknownAttacker
+	};
+
+	//everything a decision depends on, gathered by the hook so the rules below need no game objects or TimerProt
+	struct DamageFacts
+	{
+		uint64 attacking_tribe = 0;
+		uint64 attacked_tribe = 0;
+		bool attackerIsAdmin = false;
+		bool attackerIsProtected = false;
+		bool attackingTribeProtected = false;
+		bool attackedTribeProtected = false;
+	};
+
+	//hit with a player instigator
+	inline DamageDecision ApplyPlayerDamageRules(const DamageFacts& facts, bool allowNewPlayersToDamageEnemyStructures)
+	{
+		if (facts.attackerIsAdmin)
+		{
+			return DamageDecision::Allow;
+		}
+
+		if (facts.attackerIsProtected)
+		{
+			if (!allowNewPlayersToDamageEnemyStructures && facts.attacked_tribe >= 100000 && facts.attacked_tribe != facts.attacking_tribe)
+			{
+				return DamageDecision::BlockNewPlayerAttacking;
+			}
+		}
+		else if (facts.attackedTribeProtected && facts.attacked_tribe != facts.attacking_tribe)
+		{
+			return DamageDecision::BlockProtectedTarget;
+		}
+		return DamageDecision::Allow;
+	}
+
+	//hit without an instigator, wild dino damage causers are checked by the caller
+	inline DamageDecision ApplyUnknownDamageRules(const DamageFacts& facts, bool allowNewPlayersToDamageEnemyStructures)
+	{
+		if (facts.attacked_tribe == facts.attacking_tribe)
+		{
+			return DamageDecision::Allow;
+		}
+
+		if (facts.attackedTribeProtected)
+		{
+			return DamageDecision::BlockUnknownAttacker;
+		}
+
+		if (facts.attackingTribeProtected && !allowNewPlayersToDamageEnemyStructures)
+		{
+			return DamageDecision::Block;
+		}
+		return DamageDecision::Allow;
+	}
+
+	constexpr const char* DamageDecisionNames[] =
+	{
+		"Allow",
+		"Block",
+		"BlockNewPlayerAttacking",
+		"BlockProtectedTarget",
+		"BlockUnknownAttacker"
+	};
+
+	//the facts the rules above read, as bits of the DamageDecisionTable index
+	enum DamagePredicate : unsigned
+	{
+		DamagePredicatePlayer = 1 << 0,
+		DamagePredicateSameTribe = 1 << 1,
+		//attacked_tribe >= 100000, a player tribe rather than a dino team or an unowned structure
+		DamagePredicatePlayerTribeTarget = 1 << 2,
+		DamagePredicateAttackerIsAdmin = 1 << 3,
+		DamagePredicateAttackerIsProtected = 1 << 4,
+		DamagePredicateAttackingTribeProtected = 1 << 5,
+		DamagePredicateAttackedTribeProtected = 1 << 6,
+		DamagePredicateCombinations = 1 << 7
+	};
+
+	constexpr const char* DamagePredicateNames[] =
+	{
+		"player",
+		"same_tribe",
+		"player_tribe_target",
+		"attacker_is_admin",
+		"attacker_is_protected",
+		"attacking_tribe_protected",
+		"attacked_tribe_protected"
+	};
+
+	//ApplyPlayerDamageRules and ApplyUnknownDamageRules evaluated once per combination of their predicates on every
+	//config load, so a decision that misses DamageDecisions is a mask and one load instead of the nested rules.
+	//with DamageDecisionTableTestMode every lookup is also run through the rules, a mismatch is logged and the rules win
+	class DamageDecisionTable
+	{
+		public:
+			void Compile(bool allowNewPlayersToDamageEnemyStructures, bool testMode)
+			{
+				allowNewPlayers_ = allowNewPlayersToDamageEnemyStructures;
+				testMode_ = testMode;
+
+				for (unsigned mask = 0; mask < DamagePredicateCombinations; ++mask)
+				{
+					const DamageFacts facts = FactsOf(mask);
+
+					entries_[mask] = (mask & DamagePredicatePlayer) != 0 ? ApplyPlayerDamageRules(facts, allowNewPlayers_)
+						: ApplyUnknownDamageRules(facts, allowNewPlayers_);
+				}
+			}
+
+			DamageDecision Decide(const DamageFacts& facts, bool player)
+			{
+				const DamageDecision decision = entries_[MaskOf(facts, player)];
+
+				if (testMode_)
+					return Check(facts, player, decision);
+
+				return decision;
+			}
+
+			static unsigned MaskOf(const DamageFacts& facts, bool player)
+			{
+				return (player ? DamagePredicatePlayer : 0)
+					| (facts.attacking_tribe == facts.attacked_tribe ? DamagePredicateSameTribe : 0)
+					| (facts.attacked_tribe >= 100000 ? DamagePredicatePlayerTribeTarget : 0)
+					| (facts.attackerIsAdmin ? DamagePredicateAttackerIsAdmin : 0)
+					| (facts.attackerIsProtected ? DamagePredicateAttackerIsProtected : 0)
+					| (facts.attackingTribeProtected ? DamagePredicateAttackingTribeProtected : 0)
+					| (facts.attackedTribeProtected ? DamagePredicateAttackedTribeProtected : 0);
+			}
+
+			//tribe ids that give mask back from MaskOf
+			static DamageFacts FactsOf(unsigned mask)
+			{
+				DamageFacts facts;
+				facts.attacked_tribe = (mask & DamagePredicatePlayerTribeTarget) != 0 ? 100000 : 1;
+				facts.attacking_tribe = (mask & DamagePredicateSameTribe) != 0 ? facts.attacked_tribe : facts.attacked_tribe + 1;
+				facts.attackerIsAdmin = (mask & DamagePredicateAttackerIsAdmin) != 0;
+				facts.attackerIsProtected = (mask & DamagePredicateAttackerIsProtected) != 0;
+				facts.attackingTribeProtected = (mask & DamagePredicateAttackingTribeProtected) != 0;
+				facts.attackedTribeProtected = (mask & DamagePredicateAttackedTribeProtected) != 0;
+				return facts;
+			}
+
+			DamageDecision Entry(unsigned mask) const
+			{
+				return entries_[mask];
+			}
+
+			bool TestMode() const
+			{
+				return testMode_;
+			}
+
+			uint64 Checks() const
+			{
+				return checks_;
+			}
+
+			uint64 Mismatches() const
+			{
+				return mismatches_;
+			}
+
+		private:
+			DamageDecision Check(const DamageFacts& facts, bool player, DamageDecision decision)
+			{
+				const DamageDecision expected = player ? ApplyPlayerDamageRules(facts, allowNewPlayers_) : ApplyUnknownDamageRules(facts, allowNewPlayers_);
+				++checks_;
+
+				if (expected == decision)
+					return decision;
+
+				++mismatches_;
+				NPP_LOG(warn, "NPP damage decision table gave {} for mask {} where the rules give {}, attacking tribe {} attacked tribe {}.",
+					DamageDecisionNames[static_cast<size_t>(decision)], MaskOf(facts, player), DamageDecisionNames[static_cast<size_t>(expected)],
+					facts.attacking_tribe, facts.attacked_tribe);
+				return expected;
+			}
+
+			std::array<DamageDecision, DamagePredicateCombinations> entries_{};
+			bool allowNewPlayers_ = false;
+			bool testMode_ = false;
+			uint64 checks_ = 0;
+			uint64 mismatches_ = 0;
+	};
+
+	//compiled by SelectStructureDamageCheck, game thread only
+	DamageDecisionTable DamageRules;
+
+	//attacker is the steam id for player instigators and 0 when there is no instigator
+	struct DamageDecisionKey
+	{
+		uint64 attacker;
+		uint64 attacking_tribe;
+		uint64 attacked_tribe;
+
+		bool operator==(const DamageDecisionKey& other) const
+		{
+			return attacker == other.attacker && attacking_tribe == other.attacking_tribe && attacked_tribe == other.attacked_tribe;
+		}
+	};
+
+	struct DamageDecisionKeyHash
+	{
+		size_t operator()(const DamageDecisionKey& key) const
+		{
+			size_t hash = std::hash<uint64>()(key.attacker);
+			hash = hash * 31 + std::hash<uint64>()(key.attacking_tribe);
+			return hash * 31 + std::hash<uint64>()(key.attacked_tribe);
+		}
+	};
+
+	//estimated heap bytes of an unordered container, a node per element plus the bucket array
+	template <typename Container>
+	size_t NodeContainerBytes(const Container& container)
+	{
+		return container.size() * (sizeof(typename Container::value_type) + 2 * sizeof(void*)) + container.bucket_count() * sizeof(void*);
+	}
+
+	inline size_t CacheEpochs::MemoryBytes() const
+	{
+		return NodeContainerBytes(tribes_);
+	}
+
+	//entries are stamped with Epochs.Protection() when decided, any protection change makes every older entry a miss
+	class DamageDecisionCache
+	{
+		public:
+			bool Find(const DamageDecisionKey& key, DamageDecision& decision) const
+			{
+				const auto iter = entries_.find(key);
+
+				if (iter == entries_.end() || iter->second.generation != Epochs.Protection())
+					return false;
+
+				decision = iter->second.decision;
+				return true;
+			}
+
+			void Store(const DamageDecisionKey& key, DamageDecision decision)
+			{
+				//raids only touch a handful of pairs, start over instead of growing without bound
+				if (entries_.size() >= max_entries_ && entries_.find(key) == entries_.end())
+				{
+					entries_.clear();
+				}
+				entries_[key] = { Epochs.Protection(), decision };
+			}
+
+			size_t Size() const
+			{
+				return entries_.size();
+			}
+
+			size_t MemoryBytes() const
+			{
+				return NodeContainerBytes(entries_);
+			}
+
+		private:
+			struct Entry
+			{
+				uint32 generation;
+				DamageDecision decision;
+			};
+
+			static constexpr size_t max_entries_ = 4096;
+
+			std::unordered_map<DamageDecisionKey, Entry, DamageDecisionKeyHash> entries_;
+	};
+
+	DamageDecisionCache DamageDecisions;
+
+	//decisions of the current server tick in a small direct mapped table in front of DamageDecisions. a raid tick hits the
+	//same few pairs over and over, those are answered without hashing into the map. NextTick from the tick callback
+	//empties it by moving the tick stamp, a protection change in the middle of a tick misses on the epoch stamp
+	class DamageTickMemo
+	{
+		public:
+			bool Find(const DamageDecisionKey& key, DamageDecision& decision)
+			{
+				++lookups_;
+
+				const Slot& slot = slots_[SlotOf(key)];
+
+				if (slot.tick != tick_ || slot.generation != Epochs.Protection() || !(slot.key == key))
+					return false;
+
+				++hits_;
+				decision = slot.decision;
+				return true;
+			}
+
+			void Store(const DamageDecisionKey& key, DamageDecision decision)
+			{
+				slots_[SlotOf(key)] = { key, tick_, Epochs.Protection(), decision };
+			}
+
+			//a stamp of 0 is never current, slots start out empty
+			void NextTick()
+			{
+				if (++tick_ == 0)
+				{
+					slots_.fill(Slot{});
+					tick_ = 1;
+				}
+			}
+
+			uint32 Tick() const
+			{
+				return tick_;
+			}
+
+			uint64 Lookups() const
+			{
+				return lookups_;
+			}
+
+			uint64 Hits() const
+			{
+				return hits_;
+			}
+
+			void ResetCounters()
+			{
+				lookups_ = 0;
+				hits_ = 0;
+			}
+
+			size_t MemoryBytes() const
+			{
+				return sizeof(slots_);
+			}
+
+		private:
+			struct Slot
+			{
+				DamageDecisionKey key{};
+				uint32 tick = 0;
+				uint32 generation = 0;
+				DamageDecision decision = DamageDecision::Allow;
+			};
+
+			static constexpr size_t slot_count_ = 64;
+
+			static size_t SlotOf(const DamageDecisionKey& key)
+			{
+				return DamageDecisionKeyHash()(key) & (slot_count_ - 1);
+			}
+
+			std::array<Slot, slot_count_> slots_{};
+			uint32 tick_ = 1;
+			uint64 lookups_ = 0;
+			uint64 hits_ = 0;
+	};
+
+	DamageTickMemo DamageTick;
+
+	//final answer for one structure and who hits it, player is false for hits without an instigator
+	struct StructureVerdict
+	{
+		DamageDecision decision = DamageDecision::Allow;
+		bool player = false;
+		uint64 steam_id = 0;
+	};
+
+	//verdicts of structures hit over and over by the same causer, a wall chewed by a dino or a door hacked at by a player.
+	//a repeat hit skips the instigator class and steam id reads, the exemption check and the decision lookups, only the
+	//object index and both team ids are read to notice a structure rebuilt at the same address or a change of owner.
+	//entries are stamped with Epochs.Protection() and expire after max_age_ticks_ ticks of DamageTick
+	class StructureVerdictCache
+	{
+		public:
+			struct Key
+			{
+				APrimalStructure* structure;
+				AController* instigator;
+				AActor* causer;
+				int object_index;
+				uint64 attacked_tribe;
+				uint64 attacking_tribe;
+
+				bool operator==(const Key& other) const
+				{
+					return structure == other.structure && instigator == other.instigator && causer == other.causer
+						&& object_index == other.object_index && attacked_tribe == other.attacked_tribe && attacking_tribe == other.attacking_tribe;
+				}
+			};
+
+			bool Find(const Key& key, StructureVerdict& verdict)
+			{
+				++lookups_;
+
+				const Slot& slot = slots_[SlotOf(key)];
+
+				if (slot.generation != Epochs.Protection() || DamageTick.Tick() - slot.tick > max_age_ticks_ || !(slot.key == key))
+					return false;
+
+				++hits_;
+				verdict = slot.verdict;
+				return true;
+			}
+
+			void Store(const Key& key, const StructureVerdict& verdict)
+			{
+				slots_[SlotOf(key)] = { key, DamageTick.Tick(), Epochs.Protection(), verdict };
+			}
+
+			void Clear()
+			{
+				slots_.fill(Slot{});
+			}
+
+			uint64 Lookups() const
+			{
+				return lookups_;
+			}
+
+			uint64 Hits() const
+			{
+				return hits_;
+			}
+
+			void ResetCounters()
+			{
+				lookups_ = 0;
+				hits_ = 0;
+			}
+
+			size_t MemoryBytes() const
+			{
+				return sizeof(slots_);
+			}
+
+		private:
+			struct Slot
+			{
+				Key key{};
+				uint32 tick = 0;
+				//no epoch is ever this old, slots start out empty
+				uint32 generation = std::numeric_limits<uint32>::max();
+				StructureVerdict verdict;
+			};
+
+			static constexpr size_t slot_count_ = 256;
+			//about 10 seconds at the server's 30 ticks, longer than a dino takes between two bites
+			static constexpr uint32 max_age_ticks_ = 300;
+
+			static size_t SlotOf(const Key& key)
+			{
+				//structures are at least 16 byte aligned, the low bits carry nothing
+				const size_t hash = (reinterpret_cast<size_t>(key.structure) >> 4) * 31 + (reinterpret_cast<size_t>(key.causer) >> 4);
+				return hash & (slot_count_ - 1);
+			}
+
+			std::array<Slot, slot_count_> slots_{};
+			uint64 lookups_ = 0;
+			uint64 hits_ = 0;
+	};
+
+	StructureVerdictCache StructureVerdicts;
+
+	//steam ids of the player controllers that instigated recent hits, so a raiding player is resolved with the object index
+	//read instead of the class check and the player state and net id reads of GetSteamIdFromController. only player
+	//controllers are kept, Forget on logout drops the controller before its address can be reused
+	class PlayerInstigatorCache
+	{
+		public:
+			bool Find(AController* controller, int object_index, uint64& steam_id)
+			{
+				++lookups_;
+
+				const Slot& slot = slots_[SlotOf(controller)];
+
+				if (slot.controller != controller || slot.object_index != object_index)
+					return false;
+
+				++hits_;
+				steam_id = slot.steam_id;
+				return true;
+			}
+
+			void Store(AController* controller, int object_index, uint64 steam_id)
+			{
+				slots_[SlotOf(controller)] = { controller, object_index, steam_id };
+			}
+
+			void Forget(AController* controller)
+			{
+				Slot& slot = slots_[SlotOf(controller)];
+
+				if (slot.controller == controller)
+				{
+					slot = Slot{};
+				}
+			}
+
+			uint64 Lookups() const
+			{
+				return lookups_;
+			}
+
+			uint64 Hits() const
+			{
+				return hits_;
+			}
+
+			void ResetCounters()
+			{
+				lookups_ = 0;
+				hits_ = 0;
+			}
+
+			size_t MemoryBytes() const
+			{
+				return sizeof(slots_);
+			}
+
+		private:
+			struct Slot
+			{
+				AController* controller = nullptr;
+				int object_index = -1;
+				uint64 steam_id = 0;
+			};
+
+			static constexpr size_t slot_count_ = 128;
+
+			static size_t SlotOf(AController* controller)
+			{
+				return (reinterpret_cast<size_t>(controller) >> 4) & (slot_count_ - 1);
+			}
+
+			std::array<Slot, slot_count_> slots_{};
+			uint64 lookups_ = 0;
+			uint64 hits_ = 0;
+	};
+
+	PlayerInstigatorCache PlayerInstigators;
+
+	//instigator of the radial damage call in progress, read once and shared by every structure in its radius
+	struct RadialDamageScope
+	{
+		bool active = false;
+		AController* instigator = nullptr;
+		AActor* causer = nullptr;
+		uint64 attacking_tribe = 0;
+		bool isPlayer = false;
+		uint64 steam_id = 0;
+		//neither the attacker nor any structure the StructureGrid has in the radius can be protected
+		bool allowAll = false;
+
+		//decisions per victim tribe for this explosion, a blast rarely reaches more than a few bases
+		std::array<std::pair<uint64, DamageDecision>, 8> victims;
+		size_t victimCount = 0;
+		uint32 generation = 0;
+
+		bool FindVictim(uint64 tribe_id, DamageDecision& decision) const
+		{
+			if (generation != Epochs.Protection())
+				return false;
+
+			for (size_t i = 0; i < victimCount; ++i)
+			{
+				if (victims[i].first == tribe_id)
+				{
+					decision = victims[i].second;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void AddVictim(uint64 tribe_id, DamageDecision decision)
+		{
+			//state changed during the blast, whatever was kept is stale
+			if (generation != Epochs.Protection())
+			{
+				generation = Epochs.Protection();
+				victimCount = 0;
+			}
+
+			if (victimCount < victims.size())
+			{
+				victims[victimCount++] = { tribe_id, decision };
+			}
+		}
+	};
+
+	RadialDamageScope radialDamage;
+	bool radialDamageHooked = false;
+	bool targetingHooked = false;
+
+	//raids block thousands of hits a minute, they are counted per reason and tribe pair and logged by Flush.
+	//the same entry also counts the hits of the current minute for RaidStats, so the hook pays for one lookup
+	class BlockedDamageLog
+	{
+		public:
+			void Add(DamageDecision reason, uint64 steam_id, uint64 attacking_tribe, uint64 attacked_tribe)
+			{
+				Entry& entry = entries_[std::make_tuple(reason, attacking_tribe, attacked_tribe)];
+				++entry.hits;
+				++entry.minute_hits;
+				entry.last_steam_id = steam_id;
+			}
+
+			//calls func(attacking_tribe, attacked_tribe, hits) for every pair blocked since the last call
+			template <typename Func>
+			void TakeMinute(Func&& func)
+			{
+				for (auto iter = entries_.begin(); iter != entries_.end();)
+				{
+					if (iter->second.minute_hits > 0)
+					{
+						func(std::get<1>(iter->first), std::get<2>(iter->first), iter->second.minute_hits);
+						iter->second.minute_hits = 0;
+					}
+
+					iter = iter->second.hits == 0 ? entries_.erase(iter) : std::next(iter);
+				}
+			}
+
+			bool IsDue(std::chrono::steady_clock::time_point now) const
+			{
+				return now >= next_flush_;
+			}
+
+			//called every second by the timer, logs once the interval has passed since the last flush
+			void FlushIfDue(std::chrono::steady_clock::time_point now, int interval_secs)
+			{
+				if (now < next_flush_)
+					return;
+
+				next_flush_ = now + std::chrono::seconds(std::max(1, interval_secs));
+				Flush();
+			}
+
+			void Flush()
+			{
+				for (auto& entry : entries_)
+				{
+					if (entry.second.hits == 0)
+						continue;
+
+					const uint64 attacking_tribe = std::get<1>(entry.first);
+					const uint64 attacked_tribe = std::get<2>(entry.first);
+
+					switch (std::get<0>(entry.first))
+					{
+					case DamageDecision::BlockNewPlayerAttacking:
+						NPP_LOG(info, "NPP Tribe: {} tried to damage structures of Tribe: {} {} times, last by NPP Player: {}.", attacking_tribe, attacked_tribe, entry.second.hits, entry.second.last_steam_id);
+						break;
+					case DamageDecision::BlockProtectedTarget:
+						NPP_LOG(info, "Unprotected Tribe: {} tried to damage structures of NPP Protected Tribe: {} {} times, last by Player: {}.", attacking_tribe, attacked_tribe, entry.second.hits, entry.second.last_steam_id);
+						break;
+					case DamageDecision::BlockUnknownAttacker:
+						NPP_LOG(info, "Unknown attacker of Tribe: {} tried to damage structures of NPP Protected Tribe: {} {} times.", attacking_tribe, attacked_tribe, entry.second.hits);
+						break;
+					default:
+						NPP_LOG(info, "NPP Tribe: {} was blocked from damaging structures of Tribe: {} {} times.", attacking_tribe, attacked_tribe, entry.second.hits);
+						break;
+					}
+					entry.second.hits = 0;
+				}
+
+				//pairs RaidStats still has to count stay until TakeMinute
+				for (auto iter = entries_.begin(); iter != entries_.end();)
+				{
+					iter = iter->second.minute_hits == 0 ? entries_.erase(iter) : std::next(iter);
+				}
+			}
+
+			size_t Size() const
+			{
+				return entries_.size();
+			}
+
+			size_t MemoryBytes() const
+			{
+				return NodeContainerBytes(entries_);
+			}
+
+		private:
+			struct Entry
+			{
+				uint64 hits = 0;
+				uint64 minute_hits = 0;
+				uint64 last_steam_id = 0;
+			};
+
+			using Key = std::tuple<DamageDecision, uint64, uint64>;
+
+			struct KeyHash
+			{
+				size_t operator()(const Key& key) const
+				{
+					return std::hash<uint64>()(std::get<1>(key) * 0x9E3779B97F4A7C15ull ^ std::get<2>(key)) ^ static_cast<size_t>(std::get<0>(key));
+				}
+			};
+
+			std::unordered_map<Key, Entry, KeyHash> entries_;
+			std::chrono::steady_clock::time_point next_flush_;
+	};
+
+	BlockedDamageLog BlockedDamage;
+
+	//steam id to index in the player table, open addressing with robin hood probing.
+	//every key sits close to its home slot, so login and DB load lookups touch one or two cache lines.
+	class SteamIdIndex
+	{
+		public:
+			const size_t* Find(uint64 steam_id) const
+			{
+				if (slots_.empty())
+					return nullptr;
+
+				size_t pos = Home(steam_id);
+
+				for (uint32 dist = 1;; ++dist, pos = (pos + 1) & mask_)
+				{
+					const Slot& slot = slots_[pos];
+
+					//empty, or a key closer to its home than ours would have been moved for ours
+					if (slot.dist < dist)
+						return nullptr;
+
+					if (slot.key == steam_id)
+						return &slot.value;
+				}
+			}
+
+			size_t* Find(uint64 steam_id)
+			{
+				return const_cast<size_t*>(static_cast<const SteamIdIndex*>(this)->Find(steam_id));
+			}
+
+			//inserts or overwrites
+			void Insert(uint64 steam_id, size_t value)
+			{
+				if (size_t* existing = Find(steam_id))
+				{
+					*existing = value;
+					return;
+				}
+
+				if ((size_ + 1) * 5 > slots_.size() * 4)
+				{
+					Rehash(std::max<size_t>(16, slots_.size() * 2));
+				}
+
+				Place({ steam_id, value, 1 });
+				++size_;
+			}
+
+			bool Erase(uint64 steam_id)
+			{
+				if (slots_.empty())
+					return false;
+
+				size_t pos = Home(steam_id);
+
+				for (uint32 dist = 1;; ++dist, pos = (pos + 1) & mask_)
+				{
+					if (slots_[pos].dist < dist)
+						return false;
+
+					if (slots_[pos].key == steam_id)
+						break;
+				}
+
+				//backward shift, keeps the probe sequences free of holes
+				size_t next = (pos + 1) & mask_;
+
+				while (slots_[next].dist > 1)
+				{
+					slots_[pos] = slots_[next];
+					--slots_[pos].dist;
+					pos = next;
+					next = (next + 1) & mask_;
+				}
+
+				slots_[pos] = Slot();
+				--size_;
+				return true;
+			}
+
+			void Reserve(size_t count)
+			{
+				size_t needed = 16;
+
+				while (needed * 4 < count * 5)
+				{
+					needed *= 2;
+				}
+
+				if (needed > slots_.size())
+				{
+					Rehash(needed);
+				}
+			}
+
+			size_t Size() const
+			{
+				return size_;
+			}
+
+			size_t MemoryBytes() const
+			{
+				return slots_.capacity() * sizeof(Slot);
+			}
+
+		private:
+			struct Slot
+			{
+				uint64 key = 0;
+				size_t value = 0;
+				//probe distance plus one, 0 marks an empty slot
+				uint32 dist = 0;
+			};
+
+			size_t Home(uint64 steam_id) const
+			{
+				//steam ids share their high bits, mix them before masking
+				steam_id ^= steam_id >> 33;
+				steam_id *= 0xff51afd7ed558ccdull;
+				steam_id ^= steam_id >> 33;
+				return static_cast<size_t>(steam_id) & mask_;
+			}
+
+			void Place(Slot slot)
+			{
+				for (size_t pos = Home(slot.key);; pos = (pos + 1) & mask_, ++slot.dist)
+				{
+					if (slots_[pos].dist == 0)
+					{
+						slots_[pos] = slot;
+						return;
+					}
+
+					//take the slot from a key closer to its home, then keep placing that one
+					if (slots_[pos].dist < slot.dist)
+					{
+						std::swap(slot, slots_[pos]);
+					}
+				}
+			}
+
+			void Rehash(size_t slot_count)
+			{
+				std::vector<Slot> old;
+				old.swap(slots_);
+
+				slots_.assign(slot_count, Slot());
+				mask_ = slot_count - 1;
+
+				for (Slot& slot : old)
+				{
+					if (slot.dist != 0)
+					{
+						slot.dist = 1;
+						Place(slot);
+					}
+				}
+			}
+
+			std::vector<Slot> slots_;
+			size_t mask_ = 0;
+			size_t size_ = 0;
+	};
+
+	//tribe id -> dense slot, so per tribe state sits in arrays indexed by slot instead of in maps keyed by the sparse id.
+	//the id lookup is the same open addressing index as the player table, released slots go to the next new tribe
+	class TribeSlots
+	{
+		public:
+			static constexpr uint32 npos = std::numeric_limits<uint32>::max();
+
+			uint32 Find(uint64 tribe_id) const
+			{
+				const size_t* slot = index_.Find(tribe_id);
+				return slot ? static_cast<uint32>(*slot) : npos;
+			}
+
+			//the tribe's slot, a free one when it has none yet
+			uint32 Acquire(uint64 tribe_id)
+			{
+				uint32 slot = Find(tribe_id);
+
+				if (slot != npos)
+					return slot;
+
+				if (!free_.empty())
+				{
+					slot = free_.back();
+					free_.pop_back();
+					tribe_ids_[slot] = tribe_id;
+				}
+				else
+				{
+					slot = static_cast<uint32>(tribe_ids_.size());
+					tribe_ids_.push_back(tribe_id);
+				}
+
+				index_.Insert(tribe_id, slot);
+				return slot;
+			}
+
+			void Release(uint64 tribe_id)
+			{
+				const uint32 slot = Find(tribe_id);
+
+				if (slot == npos)
+					return;
+
+				index_.Erase(tribe_id);
+				free_.push_back(slot);
+			}
+
+			uint64 TribeId(uint32 slot) const
+			{
+				return tribe_ids_[slot];
+			}
+
+			//arrays indexed by slot have to cover this many, free slots included
+			uint32 Capacity() const
+			{
+				return static_cast<uint32>(tribe_ids_.size());
+			}
+
+			size_t Size() const
+			{
+				return index_.Size();
+			}
+
+			void Clear()
+			{
+				index_ = SteamIdIndex();
+				tribe_ids_.clear();
+				free_.clear();
+			}
+
+			size_t MemoryBytes() const
+			{
+				return index_.MemoryBytes() + tribe_ids_.capacity() * sizeof(uint64) + free_.capacity() * sizeof(uint32);
+			}
+
+		private:
+			SteamIdIndex index_;
+			std::vector<uint64> tribe_ids_;
+			std::vector<uint32> free_;
+	};
+
+	//tribe -> indices into the player table, all resident members and the online ones, one entry per slot of TribeSlots.
+	//a tribe holds its slot while it has a resident member, the last one leaving or being evicted hands it back
+	class TribeIndex
+	{
+		public:
+			struct Entry
+			{
+				std::vector<size_t> members;
+				std::vector<size_t> online_members;
+				//next time a throttled message may go to the tribe, one lookup per damage hit instead of one per online member
+				std::chrono::steady_clock::time_point next_message;
+			};
+
+			//nullptr when the tribe has no resident member
+			const Entry* Find(uint64 tribe_id) const
+			{
+				const uint32 slot = slots_.Find(tribe_id);
+				return slot != TribeSlots::npos ? &entries_[slot] : nullptr;
+			}
+
+			Entry* Find(uint64 tribe_id)
+			{
+				return const_cast<Entry*>(static_cast<const TribeIndex*>(this)->Find(tribe_id));
+			}
+
+			//nullptr when no member is online, the same as an empty list
+			const std::vector<size_t>* OnlineMembers(uint64 tribe_id) const
+			{
+				const Entry* entry = Find(tribe_id);
+				return entry && !entry->online_members.empty() ? &entry->online_members : nullptr;
+			}
+
+			void Add(uint64 tribe_id, size_t index)
+			{
+				Acquire(tribe_id).members.push_back(index);
+			}
+
+			//the player has to be a member already
+			void AddOnline(uint64 tribe_id, size_t index)
+			{
+				Acquire(tribe_id).online_members.push_back(index);
+			}
+
+			void RemoveOnline(uint64 tribe_id, size_t index)
+			{
+				if (Entry* entry = Find(tribe_id))
+				{
+					Erase(entry->online_members, index);
+				}
+			}
+
+			//online members have to be taken out first
+			void Remove(uint64 tribe_id, size_t index)
+			{
+				Entry* entry = Find(tribe_id);
+
+				if (!entry)
+					return;
+
+				Erase(entry->members, index);
+
+				if (entry->members.empty())
+				{
+					Release(tribe_id);
+				}
+			}
+
+			//the whole tribe at once, eviction
+			void Release(uint64 tribe_id)
+			{
+				const uint32 slot = slots_.Find(tribe_id);
+
+				if (slot == TribeSlots::npos)
+					return;
+
+				//the lists keep their capacity for the next tribe in the slot
+				entries_[slot].members.clear();
+				entries_[slot].online_members.clear();
+				entries_[slot].next_message = std::chrono::steady_clock::time_point();
+				slots_.Release(tribe_id);
+			}
+
+			void Clear()
+			{
+				slots_.Clear();
+				entries_.clear();
+			}
+
+			//tribes with a resident member
+			size_t Size() const
+			{
+				return slots_.Size();
+			}
+
+			const TribeSlots& Slots() const
+			{
+				return slots_;
+			}
+
+			//func(tribe_id, entry) for every tribe with a resident member
+			template <typename Func>
+			void ForEach(Func&& func) const
+			{
+				for (uint32 slot = 0; slot < entries_.size(); ++slot)
+				{
+					if (!entries_[slot].members.empty())
+					{
+						func(slots_.TribeId(slot), entries_[slot]);
+					}
+				}
+			}
+
+			//after the player table was compacted, remap[old] is the new index of every record left
+			void Remap(const std::vector<size_t>& remap)
+			{
+				for (Entry& entry : entries_)
+				{
+					for (auto* indices : { &entry.members, &entry.online_members })
+					{
+						for (size_t& index : *indices)
+						{
+							index = remap[index];
+						}
+					}
+				}
+			}
+
+			size_t MemoryBytes() const
+			{
+				size_t bytes = slots_.MemoryBytes() + entries_.capacity() * sizeof(Entry);
+
+				for (const Entry& entry : entries_)
+				{
+					bytes += (entry.members.capacity() + entry.online_members.capacity()) * sizeof(size_t);
+				}
+				return bytes;
+			}
+
+			size_t OnlineMemoryBytes() const
+			{
+				size_t bytes = 0;
+
+				for (const Entry& entry : entries_)
+				{
+					bytes += entry.online_members.capacity() * sizeof(size_t);
+				}
+				return bytes;
+			}
+
+		private:
+			Entry& Acquire(uint64 tribe_id)
+			{
+				const uint32 slot = slots_.Acquire(tribe_id);
+
+				if (slot >= entries_.size())
+				{
+					entries_.resize(slot + 1);
+				}
+				return entries_[slot];
+			}
+
+			static void Erase(std::vector<size_t>& indices, size_t index)
+			{
+				indices.erase(std::remove(indices.begin(), indices.end(), index), indices.end());
+			}
+
+			TribeSlots slots_;
+			std::vector<Entry> entries_;
+	};
+
+	//blocked bloom filter over tribe ids, a key sets three bits of one 64 bit word so a lookup reads a single word.
+	//a false positive only costs the exact lookup, a tribe that was added is never reported missing
+	class TribeFilter
+	{
+		public:
+			//drops every key and sizes the filter for count of them, one word per key
+			void Reset(size_t count)
+			{
+				size_t word_count = 1;
+				while (word_count < count)
+				{
+					word_count *= 2;
+				}
+
+				words_.assign(count > 0 ? word_count : 0, 0);
+				mask_ = words_.empty() ? 0 : words_.size() - 1;
+			}
+
+			void Add(uint64 tribe_id)
+			{
+				const uint64 hash = Mix(tribe_id);
+				words_[static_cast<size_t>(hash) & mask_] |= Bits(hash);
+			}
+
+			bool MayContain(uint64 tribe_id) const
+			{
+				if (words_.empty())
+					return false;
+
+				const uint64 hash = Mix(tribe_id);
+				const uint64 bits = Bits(hash);
+				return (words_[static_cast<size_t>(hash) & mask_] & bits) == bits;
+			}
+
+			size_t MemoryBytes() const
+			{
+				return words_.capacity() * sizeof(uint64);
+			}
+
+		private:
+			//tribe ids are close together, mix them before masking
+			static uint64 Mix(uint64 tribe_id)
+			{
+				tribe_id ^= tribe_id >> 33;
+				tribe_id *= 0xff51afd7ed558ccdull;
+				tribe_id ^= tribe_id >> 33;
+				tribe_id *= 0xc4ceb9fe1a85ec53ull;
+				return tribe_id ^ (tribe_id >> 33);
+			}
+
+			//the word index comes from the low bits, the bit positions from the high ones
+			static uint64 Bits(uint64 hash)
+			{
+				return (1ull << ((hash >> 46) & 63)) | (1ull << ((hash >> 52) & 63)) | (1ull << ((hash >> 58) & 63));
+			}
+
+			std::vector<uint64> words_;
+			size_t mask_ = 0;
+	};
+
+	std::chrono::steady_clock::time_point next_player_update;
+	std::chrono::steady_clock::time_point next_purge;
 	std::chrono::time_point<std::chrono::system_clock>  next_db_update;
 
-	nlohmann::json config;
-	nlohmann::json TempConfig;
 
+	std::string GetDBPath();
+	std::string GetArchivePath();
 	sqlite::database& GetDB();
+	//archive is attached to GetDB(), so NPP.Player can fall back to it
+	bool archiveAttached = false;
 
 	std::string GetTimestamp(std::chrono::time_point<std::chrono::system_clock> datetime);
-	std::chrono::time_point<std::chrono::system_clock> GetDateTime(std::string timestamp);
+	std::chrono::time_point<std::chrono::system_clock> GetDateTime(std::string_view timestamp);
+
+	int64 ToEpochMs(std::chrono::time_point<std::chrono::system_clock> datetime);
+	std::chrono::time_point<std::chrono::system_clock> FromEpochMs(int64 epoch_ms);
+	//whole seconds clamped to what a uint32 holds, the resolution player records keep
+	uint32 ToEpochSecs(std::chrono::time_point<std::chrono::system_clock> datetime);
+	std::chrono::time_point<std::chrono::system_clock> FromEpochSecs(uint32 epoch_secs);
+
+	std::unordered_set<uint64> pveTribesList;
+	//PVE status removed since the last save
+	std::unordered_set<uint64> removedPveTribesList;
+	//PVE tribes changed since the last save
+	std::unordered_set<uint64> dirtyPveTribes;
+	//same, since the last journal write
+	std::unordered_set<uint64> journalPveTribes;
+
+	//also raises the PVE event, defined with the EventBus
+	void MarkPveDirty(uint64 tribe_id);
+
+	//LoadDB runs on this thread so the server isn't held on the loader lock while the tables are read
+	std::thread dbLoader;
+	//set by dbLoader once LoadDB is done, until then the hooks leave the player tables and PVE list alone
+	std::atomic<bool> dbLoaded{ false };
+
+	inline bool IsLoaded()
+	{
+		return dbLoaded.load(std::memory_order_acquire);
+	}
+
+	//Cluster.ReplicaMode as read at startup, before dbLoader starts
+	bool replicaMode = false;
+
+	inline bool IsReplica()
+	{
+		return replicaMode;
+	}
 
-	std::vector<uint64> pveTribesList;
-	std::vector<uint64> removedPveTribesList;
+	//THREAD_PRIORITY_* of General.BackgroundThreadPriority
+	inline int BackgroundThreadPriority(const Settings& settings)
+	{
+		if (settings.BackgroundThreadPriority == "normal")
+			return THREAD_PRIORITY_NORMAL;
+		if (settings.BackgroundThreadPriority == "lowest")
+			return THREAD_PRIORITY_LOWEST;
+		if (settings.BackgroundThreadPriority == "idle")
+			return THREAD_PRIORITY_IDLE;
+
+		return THREAD_PRIORITY_BELOW_NORMAL;
+	}
+
+	//first thing on every thread NPP starts, so none of them takes a core from the game thread
+	inline void ApplyBackgroundThreadSettings(const char* name)
+	{
+		const auto settings = GetSettings();
+
+		SetThreadPriority(GetCurrentThread(), BackgroundThreadPriority(*settings));
+
+		if (settings->BackgroundThreadAffinityMask != 0
+			&& SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(settings->BackgroundThreadAffinityMask)) == 0)
+		{
+			NPP_LOG(warn, "NPP {} thread could not be moved to affinity mask {:#x}, it runs on all cores.", name, settings->BackgroundThreadAffinityMask);
+		}
+	}
 
-	TMap<uint64, TArray<FString>>PermissionsMap;
+	//NewPlayerProtectionStats.h
+	class TickBudget;
 
 	class TimerProt
 	{
@@ -80,38 +1737,116 @@ namespace NewPlayerProtection
 			TimerProt& operator=(const TimerProt&) = delete;
 			TimerProt& operator=(TimerProt&&) = delete;
 
-			struct OnlinePlayersData
+			//hot part of a record, 24 bytes of what the sweeps, the damage hook and the tribe aggregates read. the rest is in
+			//ColdPlayerData, what only an online player needs is in online_state_
+			struct AllPlayerData
 			{
-				OnlinePlayersData(uint64 steam_id, uint64 tribe_id, std::chrono::time_point<std::chrono::system_clock> startDateTime, 
-					std::chrono::time_point<std::chrono::system_clock> lastLoginDateTime, int level,
-					int isNewPlayer, std::chrono::time_point<std::chrono::system_clock> nextMessageTime)
+				AllPlayerData(uint64 steam_id, uint64 tribe_id, std::chrono::time_point<std::chrono::system_clock> startDateTime, int level, int isNewPlayer)
 					:
-					steam_id(steam_id), tribe_id(tribe_id), startDateTime(startDateTime), lastLoginDateTime(lastLoginDateTime),
-					level(level), isNewPlayer(isNewPlayer), nextMessageTime(nextMessageTime)
+					steam_id(steam_id), tribe_id(tribe_id), startSecs(ToEpochSecs(startDateTime)),
+					level(ToLevel(level)), isNewPlayer(isNewPlayer != 0), isOnline(false), isNppAdmin(false), isDirty(false), isJournalPending(false)
 				{}
+
+				std::chrono::time_point<std::chrono::system_clock> StartDateTime() const
+				{
+					return FromEpochSecs(startSecs);
+				}
+				void SetStartDateTime(std::chrono::time_point<std::chrono::system_clock> datetime)
+				{
+					startSecs = ToEpochSecs(datetime);
+				}
+				void SetLevel(int value)
+				{
+					level = ToLevel(value);
+				}
+				static uint16 ToLevel(int value)
+				{
+					return static_cast<uint16>(std::clamp(value, 0, 0xFFFF));
+				}
+
 				uint64 steam_id;
 				uint64 tribe_id;
-				std::chrono::time_point<std::chrono::system_clock> startDateTime;
-				std::chrono::time_point<std::chrono::system_clock> lastLoginDateTime;
-				int level;
-				int isNewPlayer;
-				std::chrono::time_point<std::chrono::system_clock> nextMessageTime;
+				//seconds since the epoch
+				uint32 startSecs;
+				uint16 level;
+				uint16 isNewPlayer : 1;
+				uint16 isOnline : 1;
+				//member of NPPAdminGroup, refreshed from Permissions while online
+				uint16 isNppAdmin : 1;
+				//changed since the last save
+				uint16 isDirty : 1;
+				//changed since the last journal write
+				uint16 isJournalPending : 1;
 			};
+			static_assert(sizeof(AllPlayerData) == 24, "AllPlayerData grew past 24 bytes");
 
-			struct AllPlayerData
+			//same index as the record in all_players_, only read on login, saves and eviction
+			struct ColdPlayerData
+			{
+				//seconds since the epoch
+				uint32 lastLoginSecs;
+			};
+
+			//a whole record, hot and cold part, as saves, the journal and cluster sync copy it
+			struct PlayerRecord
 			{
-				AllPlayerData(uint64 steam_id, uint64 tribe_id, std::chrono::time_point<std::chrono::system_clock> startDateTime, 
+				PlayerRecord(uint64 steam_id, uint64 tribe_id, std::chrono::time_point<std::chrono::system_clock> startDateTime,
 					std::chrono::time_point<std::chrono::system_clock> lastLoginDateTime, int level, int isNewPlayer)
-					: 
-					steam_id(steam_id), tribe_id(tribe_id), startDateTime(startDateTime), lastLoginDateTime(lastLoginDateTime), 
-					level(level), isNewPlayer(isNewPlayer)
+					:
+					steam_id(steam_id), tribe_id(tribe_id), startSecs(ToEpochSecs(startDateTime)), lastLoginSecs(ToEpochSecs(lastLoginDateTime)),
+					level(AllPlayerData::ToLevel(level)), isNewPlayer(isNewPlayer != 0)
+				{}
+
+				PlayerRecord(const AllPlayerData& data, const ColdPlayerData& cold)
+					:
+					steam_id(data.steam_id), tribe_id(data.tribe_id), startSecs(data.startSecs), lastLoginSecs(cold.lastLoginSecs),
+					level(data.level), isNewPlayer(data.isNewPlayer)
 				{}
+
+				std::chrono::time_point<std::chrono::system_clock> StartDateTime() const
+				{
+					return FromEpochSecs(startSecs);
+				}
+				std::chrono::time_point<std::chrono::system_clock> LastLoginDateTime() const
+				{
+					return FromEpochSecs(lastLoginSecs);
+				}
+
 				uint64 steam_id;
 				uint64 tribe_id;
-				std::chrono::time_point<std::chrono::system_clock> startDateTime;
-				std::chrono::time_point<std::chrono::system_clock> lastLoginDateTime;
-				int level;
-				int isNewPlayer;
+				uint32 startSecs;
+				uint32 lastLoginSecs;
+				uint16 level;
+				uint16 isNewPlayer;
+			};
+
+			//kept apart from AllPlayerData, only online players have one
+			struct OnlineState
+			{
+				std::chrono::steady_clock::time_point nextMessageTime;
+				//set on login and cleared on logout, before the engine destroys the controller
+				AShooterPlayerController* controller = nullptr;
+				//position in online_players_, so a logout doesn't search it
+				size_t onlinePos = 0;
+				//due time of the player's live refresh_queue_ entry
+				std::chrono::steady_clock::time_point nextRefresh;
+			};
+
+			//aggregate over the resident members of a tribe, admins only count towards memberCount
+			struct TribeData
+			{
+				std::chrono::time_point<std::chrono::system_clock> oldestStartDateTime = std::chrono::time_point<std::chrono::system_clock>::max();
+				int maxLevel = 0;
+				bool isProtected = false;
+				bool isPVE = false;
+				size_t memberCount = 0;
+
+				bool operator==(const TribeData& other) const
+				{
+					return oldestStartDateTime == other.oldestStartDateTime && maxLevel == other.maxLevel && isProtected == other.isProtected
+						&& isPVE == other.isPVE && memberCount == other.memberCount;
+				}
+				bool operator!=(const TribeData& other) const { return !(*this == other); }
 			};
 
 			TimerProt();
@@ -119,23 +1854,360 @@ namespace NewPlayerProtection
 
 			void UpdateTimer();
 
+			//read once per tick by UpdateTimer, so hooks and commands don't each ask the OS.
+			//the wall clock is for protection dates, the monotonic one for intervals and throttling
+			std::chrono::time_point<std::chrono::system_clock> Now() const
+			{
+				return now_;
+			}
+			std::chrono::steady_clock::time_point SteadyNow() const
+			{
+				return steady_now_;
+			}
+			void AdvanceClock();
+			//added to both clocks from the next AdvanceClock on, only NPP.Simulate moves it
+			void SetClockOffset(std::chrono::seconds offset)
+			{
+				clock_offset_ = offset;
+			}
+			//runs the expiry wake-up when its deadline has passed on Now(), for clocks moved faster than API::Timer
+			void RunDueExpiry();
+			//hands the DB writer a purge of decayed rows every PurgeDecayedPlayersEveryHours
+			void QueueDecayedPlayerPurge();
+			//raises ExpiryImminent for tribes whose warning time passed
+			void PublishExpiryWarnings();
+			//NewPlayerProtectionCommands.h, the !npp status reply to protected tribes online every StatusPushIntervalInMins
+			//and to protected players a little after they logged in
+			void PushStatus();
+
+			//(due, steam_id) of logins still waiting for their status, in login order
+			std::deque<std::pair<std::chrono::steady_clock::time_point, uint64>> login_status_;
+			std::chrono::steady_clock::time_point next_status_push_;
+
 			int player_update_interval_;
 
-			std::vector<std::shared_ptr<OnlinePlayersData>> online_players_;
-			std::vector<std::shared_ptr<AllPlayerData>> all_players_;
+			//position in online_players_ of the refresh pass in progress, npos when idle
+			size_t refresh_cursor_ = std::string::npos;
+			//players refreshed per tick so a pass finishes within one interval
+			size_t refresh_slice_ = 1;
+
+			//min-heap of (due, steam_id) while AdaptivePlayerRefresh is on, entries not matching OnlineState::nextRefresh are stale
+			using RefreshEntry = std::pair<std::chrono::steady_clock::time_point, uint64>;
+			std::priority_queue<RefreshEntry, std::vector<RefreshEntry>, std::greater<RefreshEntry>> refresh_queue_;
+			//online players have an entry in refresh_queue_
+			bool adaptive_refresh_ = false;
+
+			//dense player table, online players are indices into it
+			std::vector<AllPlayerData> all_players_;
+			//cold part of every record, kept parallel to all_players_
+			std::vector<ColdPlayerData> player_cold_;
+			SteamIdIndex player_index_;
+			std::vector<size_t> online_players_;
+			//steam_id -> state of an online player
+			std::unordered_map<uint64, OnlineState> online_state_;
+			//nodes of players that went offline, the next login takes one instead of allocating. server hopping only moves
+			//nodes between the two, so there are never more than at the highest online count
+			std::vector<std::unordered_map<uint64, OnlineState>::node_type> spare_online_states_;
+
+			//tribe_id -> aggregate, kept in sync with all_players_ so the damage hook and commands are a single lookup
+			std::unordered_map<uint64, TribeData> tribes_;
+			//entries of tribes_ with isProtected set
+			size_t protected_tribes_ = 0;
+			//(oldestStartDateTime, tribe_id) of the same tribes, in expiry order whatever HoursOfProtection is. NPP.Expiring
+			//reads a time range of it instead of going through every tribe
+			std::set<std::pair<std::chrono::time_point<std::chrono::system_clock>, uint64>> expiry_index_;
+			//tribes whose aggregate changed since the last save, written to the Tribes table
+			std::unordered_set<uint64> dirty_tribes_;
+
+			//rendered !npp status reply per tribe, stale once Epochs.Tribe moved or the minutes shown change
+			struct StatusCacheEntry
+			{
+				std::chrono::time_point<std::chrono::system_clock> expires;
+				uint64 epoch;
+				FString message;
+			};
+			std::unordered_map<uint64, StatusCacheEntry> status_cache_;
+
+			//tribe_id -> indices into all_players_, all resident and online members
+			TribeIndex tribe_index_;
+
+			//min-heap of (startDateTime + HoursOfProtection, steam_id), stale entries are skipped when popped
+			using ExpiryEntry = std::pair<std::chrono::time_point<std::chrono::system_clock>, uint64>;
+			std::priority_queue<ExpiryEntry, std::vector<ExpiryEntry>, std::greater<ExpiryEntry>> expiry_queue_;
+			//same entries ExpiryWarningInMins earlier, only filled while the warning is on
+			std::priority_queue<ExpiryEntry, std::vector<ExpiryEntry>, std::greater<ExpiryEntry>> warning_queue_;
+
+			//tribes to re-check on the next timer tick
+			std::unordered_set<uint64> pending_tribes_;
+
+			//players whose level or tribe changed, re-read on the next timer tick
+			std::unordered_set<uint64> queued_refresh_;
 
-			void AddOnlinePlayer(uint64 steam_id, uint64 team_id);
+			//tribes whose records in the decay window are all in all_players_, others are read from the database on first use
+			std::unordered_set<uint64> resident_tribes_;
+
+			//indices of records to write on the next save
+			std::vector<size_t> dirty_players_;
+			//indices of records to append to the journal at the end of the tick
+			std::vector<size_t> journal_players_;
+
+			//(steam_id, message) sent on the next tick, at most one per player per MessageIntervalInSecs
+			std::vector<std::pair<uint64, FString>> pending_notifications_;
+			//(tribe_id, message) for every online member of the tribe, the text is rendered and stored once however big the tribe is
+			std::vector<std::pair<uint64, FString>> pending_tribe_notifications_;
+
+			//logins since the last tick, resolved together by ProcessPendingLogins
+			struct PendingLogin
+			{
+				uint64 steam_id;
+				uint64 team_id;
+				AShooterPlayerController* controller;
+			};
+			std::vector<PendingLogin> pending_logins_;
+
+			//records the login for the next tick, so a login storm costs one query instead of several per player
+			void QueueLogin(uint64 steam_id, uint64 team_id, AShooterPlayerController* controller);
+			//a logout before the login batch ran
+			void CancelLogin(uint64 steam_id);
+			void ProcessPendingLogins();
+			//reads the missing records and tribes of a login batch in one transaction, may move every record
+			void LoadLoginRows(const std::unordered_set<uint64>& steam_ids, std::unordered_set<uint64> tribe_ids);
+			void AddOnlinePlayer(uint64 steam_id, uint64 team_id, AShooterPlayerController* controller);
 			void AddNewPlayer(uint64 steam_id, uint64 tribe_id);
-			void AddPlayerFromDB(uint64 steam_id, uint64 tribe_id, std::chrono::time_point<std::chrono::system_clock> startDateTime, std::chrono::time_point<std::chrono::system_clock> lastLoginDateTime, int level, int isNewPlayer);
+			//false when the player is already resident
+			bool AddPlayerFromDB(uint64 steam_id, uint64 tribe_id, std::chrono::time_point<std::chrono::system_clock> startDateTime, std::chrono::time_point<std::chrono::system_clock> lastLoginDateTime, int level, int isNewPlayer);
+			//may move every record, so call before taking references into all_players_
+			void EnsureTribeResident(uint64 tribe_id);
+			void LoadAllPlayers();
+			//least recently seen offline records of unprotected tribes, only safe while no save is pending
+			size_t EvictInactivePlayers(size_t max_resident);
 			void RemovePlayer(uint64 steam_id);
-			bool IsNextMessageReady(uint64 steam_id);
+			//for mass disconnects, each affected tribe is updated once instead of once per player
+			void RemovePlayers(const std::vector<uint64>& steam_ids);
+			//false when the player already got a message this interval
+			bool QueueNotification(AllPlayerData& data, const MessageTemplate<0>& message);
+			bool QueueNotification(uint64 steam_id, const MessageTemplate<0>& message);
+			//every online member, at most one message to the tribe per MessageIntervalInSecs. false when throttled
+			bool QueueTribeNotification(uint64 tribe_id, const MessageTemplate<0>& message);
+			//every online member, without the message interval
+			void NotifyTribe(uint64 tribe_id, const FString& text);
+			//sends right away to every online member that is alive, returns how many got it
+			size_t SendNotificationToTribe(uint64 tribe_id, const FString& text);
+			void FlushNotifications(TickBudget& budget);
+
+			void UpdateLevelAndTribe(AllPlayerData& data);
+			//the part of UpdateLevelAndTribe after the controller was read
+			void ApplyLevelAndTribe(AllPlayerData& data, uint64 tribe_id, int level);
+			//tribe hooks, the record moves to the new tribe right away and only the two tribes are recomputed
+			void MovePlayerTribe(uint64 steam_id, uint64 tribe_id);
+			//every member of the old tribe, offline ones included, goes to the new one
+			void MergeTribe(uint64 old_tribe_id, uint64 new_tribe_id);
+			void QueuePlayerRefresh(uint64 steam_id);
+			void QueueTribeRefresh(uint64 tribe_id);
+			void RefreshQueuedPlayers(TickBudget& budget);
+			//AdaptivePlayerRefresh, how long the player can go without a refresh given their distance to the thresholds
+			std::chrono::seconds AdaptiveRefreshInterval(const AllPlayerData& data);
+			void ScheduleRefresh(const AllPlayerData& data, OnlineState& state);
+			void RefreshDuePlayers(TickBudget& budget);
+			//reads the admin group from the Permissions cache, costs no query
+			void UpdatePlayerAdmin(AllPlayerData& data);
+			void FetchLoginGroups(uint64 steam_id);
+			void RefreshPlayerGroups();
+
+			//recomputes the aggregate from tribe_index_, call after any member, level, start date or PVE change
+			void UpdateTribe(uint64 tribe_id);
+			bool IsTribeProtected(uint64 tribe_id) const;
+			bool HasProtectedTribes() const
+			{
+				return protected_tribes_ > 0;
+			}
+			//nullptr when no member is resident
+			const TribeData* GetTribe(uint64 tribe_id) const;
+			//publishes a new ProtectionState when anything DamageDecisions tracks changed since the last one
+			void PublishProtectionState();
+			//false only for tribes that are neither protected nor PVE, rebuilds the filter after any state change
+			bool MayBeProtected(uint64 tribe_id);
+
+			void RebuildIndexes();
+			void SetPlayerTribe(size_t index, uint64 tribe_id);
+			//pushes the player's deadline and re-arms the expiry wake-up when it is the earliest
+			void ScheduleExpiry(const AllPlayerData& data);
+			void ScheduleTribeExpiry(uint64 tribe_id);
+			void MarkTribeForExpiry(uint64 tribe_id);
+			void ExpireTribe(uint64 tribe_id, std::chrono::time_point<std::chrono::system_clock> expireTime);
+			//the decision pass is split across short-lived worker threads once the table is large enough, changes are applied here
+			void ExpireAllTribes();
+			//tribes marked for a re-check, deadlines from expiry_queue_ are handled by the wake-up
+			void ProcessExpiredProtection(TickBudget& budget);
+
+			//bytes held for player records, per record the table, index and tribe lists cost beyond the row itself
+			struct MemoryUsage
+			{
+				size_t records = 0;
+				size_t online = 0;
+				size_t offline_record_bytes = 0;
+				size_t online_record_bytes = 0;
+				//including spare capacity
+				size_t total_bytes = 0;
+				//part of total_bytes only online players need
+				size_t online_bytes = 0;
+				//tribes_ aggregates and the tribes to save
+				size_t tribes = 0;
+				size_t tribe_bytes = 0;
+				//expiry, warning and refresh queues, tribes and players waiting for the next tick, notifications and logins
+				size_t queue_bytes = 0;
+				//!npp status replies, resident_tribes_, the protected filter and the tribe message throttle
+				size_t cache_bytes = 0;
+			};
+			MemoryUsage GetMemoryUsage() const;
+
+			//returned by reference, callers must not add or remove players while iterating
+			std::vector<AllPlayerData>& GetAllPlayers();
+			//data has to be a record of the table
+			PlayerRecord GetRecord(const AllPlayerData& data) const;
+			std::chrono::time_point<std::chrono::system_clock> LastLoginDateTime(const AllPlayerData& data) const;
+			void SetLastLoginDateTime(const AllPlayerData& data, std::chrono::time_point<std::chrono::system_clock> datetime);
+			//room for count more records without the table growing
+			void ReservePlayers(size_t count);
+			//resident members through tribe_index_, pointers are invalidated when a player is added
+			std::vector<AllPlayerData*> GetTribeMembers(uint64 tribe_id);
+
+			size_t OnlineCount() const
+			{
+				return online_players_.size();
+			}
+
+			template <typename Func>
+			void ForEachOnlinePlayer(Func&& func)
+			{
+				for (const size_t index : online_players_)
+				{
+					func(all_players_[index]);
+				}
+			}
+
+			template <typename Func>
+			void ForEachOnlineTribeMember(uint64 tribe_id, Func&& func)
+			{
+				const auto members = tribe_index_.OnlineMembers(tribe_id);
+
+				if (!members)
+					return;
+
+				for (const size_t index : *members)
+				{
+					func(all_players_[index]);
+				}
+			}
+
+			void MarkDirty(AllPlayerData& data);
+			//appends every record and PVE flag changed since the last call, a crash loses at most one tick
+			void FlushJournal();
+			//NPP.Wipe, every table, queue and cache starts over empty and online players come back as new players.
+			//returns how many records were dropped
+			size_t Wipe();
+
+			//calls func(record) for every changed record and clears the dirty list
+			template <typename Func>
+			size_t FlushDirtyPlayers(Func&& func)
+			{
+				const size_t count = dirty_players_.size();
+
+				for (const size_t index : dirty_players_)
+				{
+					all_players_[index].isDirty = false;
+					func(PlayerRecord(all_players_[index], player_cold_[index]));
+				}
+				dirty_players_.clear();
+
+				return count;
+			}
+
+			//calls func(tribe_id, data) for every changed tribe, memberCount is 0 for tribes that no longer exist
+			template <typename Func>
+			size_t FlushDirtyTribes(Func&& func)
+			{
+				const size_t count = dirty_tribes_.size();
+
+				for (const uint64 tribe_id : dirty_tribes_)
+				{
+					const auto iter = tribes_.find(tribe_id);
+					func(tribe_id, iter != tribes_.end() ? iter->second : TribeData());
+				}
+				dirty_tribes_.clear();
+
+				return count;
+			}
+
+			//nullptr when not found, pointers are invalidated when a player is added
+			AllPlayerData* FindPlayer(uint64 steam_id);
+			AllPlayerData* FindOnlinePlayer(uint64 steam_id);
+			OnlineState* FindOnlineState(uint64 steam_id);
+			//a fresh state for a player that is not online yet, in a spare node when there is one
+			OnlineState& AcquireOnlineState(uint64 steam_id);
+
+		private:
+			//takes the player out of the online lists, 0 when they weren't online
+			uint64 TakeOffline(uint64 steam_id);
+
+			bool PushExpiry(const AllPlayerData& data);
+			//one API::Timer wake-up for the top of expiry_queue_, game thread only so the loader thread never arms one
+			void ArmExpiryWakeup();
+			void OnExpiryWakeup(std::chrono::time_point<std::chrono::system_clock> deadline);
+			//deadline the pending wake-up was armed for, max when none is
+			std::chrono::time_point<std::chrono::system_clock> expiry_wakeup_ = std::chrono::time_point<std::chrono::system_clock>::max();
+
+			//one expired, max level or unprotected member removes protection for the whole tribe, admins are ignored
+			static bool ExpiresTribe(const AllPlayerData& data, uint32 expireSecs, int maxLevel, bool ignoreAdmins);
+			//tribes with a member that ExpiresTribe, only reads the records so the chunks can run off the game thread
+			std::unordered_set<uint64> FindExpiredTribes(uint32 expireSecs);
+			void ApplyTribeExpiry(uint64 tribe_id, const std::vector<size_t>& members, bool expired);
+
+			//below this many records starting the workers costs more than the scan itself
+			static constexpr size_t parallel_scan_min_records_ = 65536;
+			static constexpr size_t parallel_scan_chunk_ = 16384;
+
+			std::chrono::time_point<std::chrono::system_clock> now_ = std::chrono::system_clock::now();
+			std::chrono::steady_clock::time_point steady_now_ = std::chrono::steady_clock::now();
+			std::chrono::seconds clock_offset_{ 0 };
+
+			//the first tick that sees IsLoaded starts everything that needs the tables
+			bool loaded_ = false;
+
+			//Epochs.Protection() the published state was built at
+			uint32 published_generation_ = ~0u;
+
+			//protected and PVE tribes, built at protected_filter_generation_
+			TribeFilter protected_filter_;
+			uint32 protected_filter_generation_ = ~0u;
+	};
 
-			void UpdateLevelAndTribe(std::shared_ptr <OnlinePlayersData> data);
+	//copy of the protection state for threads other than the game thread, never modified once published.
+	//the game thread is the only writer, readers hold the returned pointer and the last one to drop a version frees it
+	struct ProtectionState
+	{
+		uint64 version = 0;
+		//tribe_id -> aggregate over the resident members
+		std::unordered_map<uint64, TimerProt::TribeData> tribes;
+		std::unordered_set<uint64> pveTribes;
+		//online members of NPPAdminGroup
+		std::unordered_set<uint64> admins;
 
-			std::vector<std::shared_ptr<OnlinePlayersData>> GetOnlinePlayers();
-			std::vector<std::shared_ptr<AllPlayerData>> GetAllPlayers();
+		bool IsTribeProtected(uint64 tribe_id) const
+		{
+			const auto iter = tribes.find(tribe_id);
+			return iter != tribes.end() && iter->second.isProtected;
+		}
 	};
 
+	std::shared_ptr<const ProtectionState> protection_state = std::make_shared<const ProtectionState>();
+
+	//safe from any thread
+	inline std::shared_ptr<const ProtectionState> GetProtectionState()
+	{
+		return std::atomic_load(&protection_state);
+	}
+
 	FString GetBlueprint(UObjectBase* object)
 	{
 
@@ -159,6 +2231,25 @@ namespace NewPlayerProtection
 		return FString("");
 	}
 
+	//GetBlueprint builds the full object name every call, this builds it once per class
+	const FString& GetCachedBlueprint(UObjectBase* object)
+	{
+		static const FString empty;
+
+		if (object == nullptr || object->ClassField() == nullptr)
+			return empty;
+
+		UClass* object_class = object->ClassField();
+		const auto iter = BlueprintPathCache.find(object_class);
+
+		if (iter != BlueprintPathCache.end())
+		{
+			return iter->second;
+		}
+
+		return BlueprintPathCache.emplace(object_class, GetBlueprint(object)).first->second;
+	}
+
 }
 
 
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+
+//exported by NewPlayerProtection.dll for other plugins, so they can ask about protection without opening the database.
+//link against NewPlayerProtection.lib or resolve the functions with GetProcAddress, NPP_GetApiVersion first.
+//the layout of NPP_TribeState only grows, callers set size to sizeof(NPP_TribeState) of the header they built with.
+#ifdef NPP_API_EXPORT
+#define NPP_API extern "C" __declspec(dllexport)
+#else
+#define NPP_API extern "C" __declspec(dllimport)
+#endif
+
+#define NPP_API_VERSION 1
+
+#define NPP_TRIBE_PROTECTED 1u
+#define NPP_TRIBE_PVE 2u
+
+struct NPP_TribeState
+{
+	uint32_t size;
+	//NPP_TRIBE_ flags
+	uint32_t flags;
+	//ms since epoch of the oldest member's start, 0 when only admins are in the tribe
+	int64_t oldest_start_ms;
+	int32_t max_level;
+	uint32_t member_count;
+};
+
+//flags before and after, called on the game thread once per tick for every tribe whose flags changed
+typedef void (*NPP_TribeChangedCallback)(uint64_t tribe_id, uint32_t old_flags, uint32_t new_flags, void* user);
+
+NPP_API uint32_t NPP_GetApiVersion();
+//0 until the database is loaded, every query answers "not protected" until then
+NPP_API int NPP_IsLoaded();
+//game thread, answers like the damage hooks do, PVE tribes count as protected
+NPP_API int NPP_IsTribeProtected(uint64_t tribe_id);
+//any thread, from the state published at the end of the last tick. 0 when the tribe has no resident members and isn't PVE
+NPP_API int NPP_GetTribeState(uint64_t tribe_id, NPP_TribeState* state);
+//returns 0 when callback is null, unsubscribe before the subscribing plugin unloads
+NPP_API uint64_t NPP_Subscribe(NPP_TribeChangedCallback callback, void* user);
+NPP_API void NPP_Unsubscribe(uint64_t handle);
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <fstream>
+
+namespace NewPlayerProtection
+{
+	//one protection change as read back from the audit file
+	struct AuditEvent
+	{
+		int64 timestamp_ms = 0;
+		std::string action;
+		uint64 tribe_id = 0;
+		//steam id, "Console", "Rcon" or "Timer"
+		std::string by;
+		int64 hours = 0;
+	};
+
+	//append only JSONL stream of protection changes, one object per line so log shippers need no parsing of the text log.
+	//events are rare, every line is flushed when written so the file is complete up to the last change.
+	class AuditLog
+	{
+		public:
+			static AuditLog& Get();
+
+			AuditLog(const AuditLog&) = delete;
+			AuditLog(AuditLog&&) = delete;
+			AuditLog& operator=(const AuditLog&) = delete;
+			AuditLog& operator=(AuditLog&&) = delete;
+
+			//called on every config load
+			void Configure(bool enabled, const std::string& path);
+
+			void Record(const char* action, uint64 tribe_id, const std::string& by, int64 hours = 0);
+
+			//reader side, fills events oldest first, lines cut off by a crash are skipped
+			static bool Read(const std::string& path, std::vector<AuditEvent>& events);
+
+			const std::string& GetPath() const
+			{
+				return path_;
+			}
+
+		private:
+			AuditLog() = default;
+			~AuditLog() = default;
+
+			bool enabled_ = false;
+			std::string path_;
+			std::ofstream file_;
+	};
+}
+
+NewPlayerProtection::AuditLog& NewPlayerProtection::AuditLog::Get()
+{
+	static AuditLog instance;
+	return instance;
+}
+
+void NewPlayerProtection::AuditLog::Configure(bool enabled, const std::string& path)
+{
+	if (enabled && enabled_ && path == path_)
+		return;
+
+	if (file_.is_open())
+	{
+		file_.close();
+	}
+
+	enabled_ = false;
+	path_ = path;
+
+	if (!enabled)
+		return;
+
+	file_.open(path_, std::ios::out | std::ios::app);
+
+	if (!file_.is_open())
+	{
+		NPP_LOG(err, "({} {}) Could not open audit file {}", __FILE__, __FUNCTION__, path_);
+		return;
+	}
+	enabled_ = true;
+}
+
+void NewPlayerProtection::AuditLog::Record(const char* action, uint64 tribe_id, const std::string& by, int64 hours)
+{
+	if (!enabled_)
+		return;
+
+	nlohmann::json line;
+	line["ts"] = NewPlayerProtection::ToEpochMs(std::chrono::system_clock::now());
+	line["action"] = action;
+	line["tribe"] = tribe_id;
+	line["by"] = by;
+
+	if (hours != 0)
+	{
+		line["hours"] = hours;
+	}
+
+	file_ << line.dump() << '\n';
+	file_.flush();
+
+	if (!file_)
+	{
+		NPP_LOG(err, "({} {}) Could not write audit file {}, audit stopped", __FILE__, __FUNCTION__, path_);
+		file_.close();
+		enabled_ = false;
+	}
+}
+
+bool NewPlayerProtection::AuditLog::Read(const std::string& path, std::vector<AuditEvent>& events)
+{
+	std::ifstream file(path);
+
+	if (!file.is_open())
+		return false;
+
+	std::string text;
+
+	while (std::getline(file, text))
+	{
+		try
+		{
+			const auto line = nlohmann::json::parse(text);
+
+			AuditEvent event;
+			event.timestamp_ms = line.value("ts", int64(0));
+			event.action = line.value("action", "");
+			event.tribe_id = line.value("tribe", uint64(0));
+			event.by = line.value("by", "");
+			event.hours = line.value("hours", int64(0));
+			events.push_back(std::move(event));
+		}
+		catch (const std::exception&)
+		{
+			continue;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,357 @@
+#pragma once
+
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+namespace NewPlayerProtection
+{
+	//consistent copies of NewPlayerProtection.db in Backups/ next to it, made with SQLite's online backup API on a thread
+	//of its own. every step copies BackupPagesPerStep pages under a short read lock and sleeps BackupStepDelayInMs after,
+	//so the writer thread and other maps keep writing meanwhile. a write between two steps restarts the copy from the
+	//first page, which is why the steps are small and the copy goes into a .tmp file renamed once it is complete.
+	class DatabaseBackup
+	{
+		public:
+			static DatabaseBackup& Get();
+
+			DatabaseBackup(const DatabaseBackup&) = delete;
+			DatabaseBackup(DatabaseBackup&&) = delete;
+			DatabaseBackup& operator=(const DatabaseBackup&) = delete;
+			DatabaseBackup& operator=(DatabaseBackup&&) = delete;
+
+			void Start();
+			void Stop(std::chrono::milliseconds timeout);
+
+			//game thread, false while the last backup is still being written. done(result) runs on the game thread
+			bool Request(std::function<void(const std::string& result)> done);
+
+		private:
+			DatabaseBackup() = default;
+			~DatabaseBackup() = default;
+
+			struct Job
+			{
+				std::string source_path;
+				std::string target_path;
+				//file names of this database's backups start with it
+				std::string prefix;
+				int pages_per_step;
+				std::chrono::milliseconds step_delay;
+				int busy_timeout_ms;
+				size_t keep;
+				std::function<void(const std::string& result)> done;
+			};
+
+			void Run();
+			//game thread, once a second, starts the scheduled backups
+			void Tick();
+			std::string Copy(const Job& job);
+			static void Prune(const std::filesystem::path& target, const std::string& prefix, size_t keep);
+
+			std::thread thread_;
+			std::mutex mutex_;
+			std::condition_variable queue_cv_;
+			std::condition_variable drained_cv_;
+			std::unique_ptr<Job> job_;
+			//read between the steps without the lock, a stop abandons the copy
+			std::atomic<bool> stop_{ false };
+			std::chrono::steady_clock::time_point next_scheduled_;
+			bool running_ = false;
+			bool busy_ = false;
+	};
+}
+
+NewPlayerProtection::DatabaseBackup& NewPlayerProtection::DatabaseBackup::Get()
+{
+	static DatabaseBackup instance;
+	return instance;
+}
+
+void NewPlayerProtection::DatabaseBackup::Start()
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	if (running_)
+		return;
+
+	running_ = true;
+	stop_ = false;
+	next_scheduled_ = std::chrono::steady_clock::now() + std::chrono::hours(std::max(1, NewPlayerProtection::GetSettings()->BackupEveryHours));
+	thread_ = std::thread(&DatabaseBackup::Run, this);
+
+	ArkApi::GetCommands().AddOnTimerCallback("NPPBackup", std::bind(&NewPlayerProtection::DatabaseBackup::Tick, this));
+}
+
+void NewPlayerProtection::DatabaseBackup::Stop(std::chrono::milliseconds timeout)
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+
+	if (!running_)
+		return;
+
+	stop_ = true;
+	queue_cv_.notify_one();
+
+	//called from DllMain like GameTasks::Stop, a copy in progress stops at its next step and leaves only the .tmp file
+	if (!drained_cv_.wait_for(lock, timeout, [this] { return !busy_; }))
+	{
+		Log::GetLog()->warn("NPP backup thread did not finish in time.");
+	}
+
+	running_ = false;
+	job_.reset();
+	lock.unlock();
+
+	ArkApi::GetCommands().RemoveOnTimerCallback("NPPBackup");
+
+	if (thread_.joinable())
+	{
+		thread_.detach();
+	}
+}
+
+bool NewPlayerProtection::DatabaseBackup::Request(std::function<void(const std::string& result)> done)
+{
+	const auto settings = NewPlayerProtection::GetSettings();
+	const std::filesystem::path source(NewPlayerProtection::GetDBPath());
+
+	//local time, so the names sort oldest first and tell the admin when they were taken
+	const auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+	char stamp[32];
+	strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", localtime(&now));
+
+	auto job = std::make_unique<Job>();
+	job->source_path = source.string();
+	job->prefix = source.stem().string() + "-";
+	job->target_path = (source.parent_path() / "Backups" / (job->prefix + stamp + source.extension().string())).string();
+	job->pages_per_step = std::max(1, settings->BackupPagesPerStep);
+	job->step_delay = std::chrono::milliseconds(std::max(0, settings->BackupStepDelayInMs));
+	job->busy_timeout_ms = std::max(0, settings->DBBusyTimeoutInMs);
+	job->keep = settings->BackupsToKeep;
+	job->done = std::move(done);
+
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	if (!running_ || busy_ || job_)
+		return false;
+
+	job_ = std::move(job);
+	queue_cv_.notify_one();
+	return true;
+}
+
+void NewPlayerProtection::DatabaseBackup::Tick()
+{
+	const int every_hours = NewPlayerProtection::GetSettings()->BackupEveryHours;
+	const auto now = std::chrono::steady_clock::now();
+
+	if (every_hours <= 0 || now < next_scheduled_)
+		return;
+
+	next_scheduled_ = now + std::chrono::hours(every_hours);
+
+	//a backup still running from NPP.Backup counts as this one
+	Request([](const std::string& result)
+	{
+		NPP_LOG(info, "{}", result);
+	});
+}
+
+void NewPlayerProtection::DatabaseBackup::Run()
+{
+	NewPlayerProtection::ApplyBackgroundThreadSettings("backup");
+
+	std::unique_lock<std::mutex> lock(mutex_);
+
+	while (true)
+	{
+		queue_cv_.wait(lock, [this] { return stop_ || job_; });
+
+		if (stop_)
+		{
+			drained_cv_.notify_all();
+			break;
+		}
+
+		std::unique_ptr<Job> job = std::move(job_);
+		busy_ = true;
+		lock.unlock();
+
+		const std::string result = Copy(*job);
+
+		if (!stop_)
+		{
+			NewPlayerProtection::GameTasks::Get().Post([done = job->done, result]()
+			{
+				done(result);
+			});
+		}
+
+		lock.lock();
+		busy_ = false;
+		drained_cv_.notify_all();
+	}
+}
+
+std::string NewPlayerProtection::DatabaseBackup::Copy(const Job& job)
+{
+	const auto started = std::chrono::steady_clock::now();
+	const std::string temp_path = job.target_path + ".tmp";
+
+	std::error_code error;
+	std::filesystem::create_directories(std::filesystem::path(job.target_path).parent_path(), error);
+	std::filesystem::remove(temp_path, error);
+
+	sqlite3* source = nullptr;
+	sqlite3* target = nullptr;
+	std::string failure;
+	int pages = 0;
+	int restarts = 0;
+
+	if (sqlite3_open_v2(job.source_path.c_str(), &source, SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK)
+	{
+		failure = "could not open " + job.source_path + ": " + sqlite3_errmsg(source);
+	}
+	else if (sqlite3_open_v2(temp_path.c_str(), &target, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr) != SQLITE_OK)
+	{
+		failure = "could not create " + temp_path + ": " + sqlite3_errmsg(target);
+	}
+	else
+	{
+		//a step waits out a writer holding the lock instead of failing right away
+		sqlite3_busy_timeout(source, job.busy_timeout_ms);
+
+		sqlite3_backup* backup = sqlite3_backup_init(target, "main", source, "main");
+
+		if (!backup)
+		{
+			failure = std::string("could not start the backup: ") + sqlite3_errmsg(target);
+		}
+		else
+		{
+			int remaining = -1;
+
+			while (true)
+			{
+				const int rc = sqlite3_backup_step(backup, job.pages_per_step);
+
+				if (rc == SQLITE_DONE)
+					break;
+
+				if (rc != SQLITE_OK && rc != SQLITE_BUSY && rc != SQLITE_LOCKED)
+				{
+					failure = std::string("step failed: ") + sqlite3_errstr(rc);
+					break;
+				}
+
+				if (stop_)
+				{
+					failure = "stopped before it finished";
+					break;
+				}
+
+				//more pages left than after the last step, a write restarted the copy
+				const int now_remaining = sqlite3_backup_remaining(backup);
+				restarts += remaining >= 0 && now_remaining > remaining ? 1 : 0;
+				remaining = now_remaining;
+
+				std::this_thread::sleep_for(job.step_delay);
+			}
+
+			pages = sqlite3_backup_pagecount(backup);
+
+			const int rc = sqlite3_backup_finish(backup);
+
+			if (failure.empty() && rc != SQLITE_OK)
+			{
+				failure = std::string("finish failed: ") + sqlite3_errstr(rc);
+			}
+		}
+	}
+
+	sqlite3_close(target);
+	sqlite3_close(source);
+
+	if (failure.empty())
+	{
+		std::filesystem::rename(temp_path, job.target_path, error);
+
+		if (error)
+		{
+			failure = "could not rename " + temp_path + ": " + error.message();
+		}
+	}
+
+	if (!failure.empty())
+	{
+		std::filesystem::remove(temp_path, error);
+		NPP_LOG(err, "({} {}) NPP backup {}", __FILE__, __FUNCTION__, failure);
+		return "NPP backup failed, " + failure;
+	}
+
+	Prune(job.target_path, job.prefix, job.keep);
+
+	const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started).count();
+
+	return "NPP backup of " + std::to_string(pages) + " pages written to " + job.target_path + " in " + std::to_string(ms)
+		+ " ms, restarted " + std::to_string(restarts) + " time(s).";
+}
+
+//keeps the newest keep backups of the same database, 0 keeps all of them
+void NewPlayerProtection::DatabaseBackup::Prune(const std::filesystem::path& target, const std::string& prefix, size_t keep)
+{
+	if (keep == 0)
+		return;
+
+	std::vector<std::filesystem::path> backups;
+	std::error_code error;
+
+	for (std::filesystem::directory_iterator iter(target.parent_path(), error), end; !error && iter != end; iter.increment(error))
+	{
+		const auto& path = iter->path();
+
+		if (path.extension() == target.extension() && path.filename().string().compare(0, prefix.size(), prefix) == 0)
+		{
+			backups.push_back(path);
+		}
+	}
+
+	if (backups.size() <= keep)
+		return;
+
+	std::sort(backups.begin(), backups.end());
+
+	for (size_t i = 0; i < backups.size() - keep; ++i)
+	{
+		std::filesystem::remove(backups[i], error);
+	}
+}
+
+//"NPP.Backup", writes a copy of the database now. the reply comes once the copy is complete
+inline void BackupCommand(const FString& body, const std::string& by, const CommandReply& reply)
+{
+	NPP_LOG(info, "{} started an NPP backup.", by);
+
+	const bool started = NewPlayerProtection::DatabaseBackup::Get().Request([reply](const std::string& result)
+	{
+		NPP_LOG(info, "{}", result);
+		reply(NewPlayerProtection::ToFString(result));
+	});
+
+	if (!started)
+	{
+		reply(FString("NPP backup is already running."));
+	}
+}
+
+inline void ConsoleBackup(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleAsyncTribeCommand(player_controller, *cmd, &BackupCommand);
+}
+
+inline void RconBackup(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconAsyncTribeCommand(rcon_connection, rcon_packet, &BackupCommand);
+}
@@ -0,0 +1,334 @@
+#pragma once
+
+#include <fstream>
+
+namespace NewPlayerProtection
+{
+	//NPP.Benchmark times the save, load, expiry, status and admin command paths against whatever database the server
+	//loaded, on a test server that is a generated one from NPPDbGen. results go to Benchmark.json, with the ratio to
+	//BenchmarkBaseline.json when there is one, so two builds can be compared on the same file before deploying.
+	//the save is written to a scratch Benchmark.db and the load read back from it, the live database is only read.
+	struct BenchmarkCase
+	{
+		std::string name;
+		LatencyHistogram latency;
+		uint64 total_ns = 0;
+	};
+
+	inline std::string GetBenchmarkPath(const char* file)
+	{
+		return ArkApi::Tools::GetCurrentDir() + "/ArkApi/Plugins/NewPlayerProtection/" + file;
+	}
+
+	//one sample per call of func(i)
+	template <typename Func>
+	void MeasureBenchmarkCase(std::vector<BenchmarkCase>& cases, const char* name, size_t samples, Func&& func)
+	{
+		BenchmarkCase result;
+		result.name = name;
+
+		for (size_t i = 0; i < samples; ++i)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			func(i);
+			const uint64 ns = static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+			result.latency.Record(ns);
+			result.total_ns += ns;
+		}
+		cases.push_back(std::move(result));
+	}
+
+	//up to count keys spread evenly over the sorted keys, the same sample every run against the same database
+	inline std::vector<uint64> SampleBenchmarkKeys(std::vector<uint64> keys, size_t count)
+	{
+		std::sort(keys.begin(), keys.end());
+
+		if (keys.size() <= count)
+			return keys;
+
+		std::vector<uint64> sample;
+		sample.reserve(count);
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			sample.push_back(keys[i * keys.size() / count]);
+		}
+		return sample;
+	}
+
+	//the Players rows as the loader reads them
+	struct BenchmarkRow
+	{
+		uint64 steam_id;
+		uint64 tribe_id;
+		int64 start_ms;
+		int64 last_login_ms;
+		int level;
+		int is_new_player;
+	};
+}
+
+//"NPP.Benchmark [runs] [baseline]", runs (default 5) of every whole table case and up to 1000 keys for the per tribe and
+//per player cases. baseline also keeps the results as BenchmarkBaseline.json for the next build to be compared against.
+//everything runs on the game thread while the server waits, only for test servers
+inline FString BenchmarkCommand(const FString& body, const std::string& by)
+{
+	const auto parsed = TokenizeCommand(body);
+	uint64 runs = 5;
+	bool save_baseline = false;
+
+	for (size_t i = 1; i < parsed.size(); ++i)
+	{
+		if (parsed[i] == L"baseline")
+		{
+			save_baseline = true;
+		}
+		else if (!ParseUInt(parsed[i], runs, __FUNCTION__))
+		{
+			return FString();
+		}
+	}
+
+	if (!NewPlayerProtection::IsLoaded())
+		return FString("NPP database is not loaded yet.");
+
+	runs = std::max<uint64>(1, std::min<uint64>(runs, 1000));
+	const size_t key_count = 1000;
+
+	NPP_LOG(info, "{} started NPP benchmark with {} runs.", by, runs);
+
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	std::vector<NewPlayerProtection::BenchmarkCase> cases;
+
+	std::vector<uint64> steam_ids;
+	steam_ids.reserve(timer.GetAllPlayers().size());
+
+	for (const auto& player : timer.GetAllPlayers())
+	{
+		steam_ids.push_back(player.steam_id);
+	}
+
+	std::vector<uint64> tribe_ids;
+	tribe_ids.reserve(timer.tribes_.size());
+
+	for (const auto& tribe : timer.tribes_)
+	{
+		tribe_ids.push_back(tribe.first);
+	}
+
+	//save, the batch a full save would queue and its rows written the way the writer thread does
+	NewPlayerProtection::SaveBatch batch;
+
+	MeasureBenchmarkCase(cases, "save_collect", runs, [&batch, &timer](size_t)
+	{
+		batch.Clear();
+		for (const auto& data : timer.GetAllPlayers())
+		{
+			batch.players.push_back(timer.GetRecord(data));
+		}
+
+		for (const auto& tribe : timer.tribes_)
+		{
+			batch.tribes.emplace_back(tribe.first, tribe.second);
+		}
+
+		for (const auto& tribe_id : NewPlayerProtection::pveTribesList)
+		{
+			batch.pveTribes.emplace_back(tribe_id, true);
+		}
+	});
+
+	const std::string scratch_path = NewPlayerProtection::GetBenchmarkPath("Benchmark.db");
+	std::vector<NewPlayerProtection::BenchmarkRow> rows;
+
+	try
+	{
+		std::error_code error;
+		std::filesystem::remove(scratch_path, error);
+
+		sqlite::database scratch(scratch_path);
+		CreateBaseTables(scratch);
+		ApplyConnectionProfile(scratch, *NewPlayerProtection::GetSettings());
+		MigrateSchema(scratch);
+
+		{
+			NewPlayerProtection::SaveStatements statements(scratch);
+
+			MeasureBenchmarkCase(cases, "save_write", runs, [&scratch, &statements, &batch](size_t)
+			{
+				scratch << "BEGIN IMMEDIATE TRANSACTION;";
+
+				for (const auto& data : batch.players)
+				{
+					UpdatePlayerDB(statements, data);
+				}
+
+				for (const auto& tribe : batch.pveTribes)
+				{
+					UpdatePVETribeDB(statements, tribe.first, tribe.second);
+				}
+
+				for (const auto& tribe : batch.tribes)
+				{
+					UpdateTribeDB(statements, tribe.first, tribe.second);
+				}
+
+				scratch << "END TRANSACTION;";
+				scratch << "PRAGMA wal_checkpoint(PASSIVE);";
+			});
+		}
+
+		//load, the loader's select over the rows just saved
+		const int64 decay_ms = NewPlayerProtection::ToEpochMs(std::chrono::system_clock::now() - std::chrono::hours(NewPlayerProtection::GetSettings()->NPPPlayerDecayInHours));
+
+		MeasureBenchmarkCase(cases, "load_rows", runs, [&scratch, &rows, decay_ms](size_t)
+		{
+			rows.clear();
+
+			scratch << "SELECT SteamId, TribeId, Start_DateTime, Last_Login_DateTime, Level, Is_New_Player FROM Players where Last_Login_DateTime > ?;"
+				<< decay_ms
+				>> [&rows](uint64 steamid, uint64 tribeid, int64 startdate, int64 lastlogindate, int level, int isnewplayer)
+			{
+				rows.push_back({ steamid, tribeid, startdate, lastlogindate, level, isnewplayer });
+			};
+		});
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+	}
+
+	for (const char* suffix : { "", "-wal", "-shm" })
+	{
+		std::error_code error;
+		std::filesystem::remove(scratch_path + suffix, error);
+	}
+
+	//expiry, nothing is left to expire after the first run, so later runs time the scan alone
+	MeasureBenchmarkCase(cases, "expiry_sweep", runs, [](size_t)
+	{
+		RemoveExpiredTribesProtection();
+	});
+
+	//status, rendered once with the tribe's cached reply dropped and once from the cache
+	const auto status_tribes = NewPlayerProtection::SampleBenchmarkKeys(tribe_ids, key_count);
+
+	MeasureBenchmarkCase(cases, "status_render", status_tribes.size(), [&timer, &status_tribes](size_t i)
+	{
+		timer.status_cache_.erase(status_tribes[i]);
+		StatusReply(status_tribes[i]);
+	});
+
+	MeasureBenchmarkCase(cases, "status_cached", status_tribes.size(), [&status_tribes](size_t i)
+	{
+		StatusReply(status_tribes[i]);
+	});
+
+	//admin commands, only resident players so NPP.Player reads nothing in
+	const auto player_ids = NewPlayerProtection::SampleBenchmarkKeys(steam_ids, key_count);
+
+	MeasureBenchmarkCase(cases, "admin_player", player_ids.size(), [&player_ids](size_t i)
+	{
+		PlayerCommand(FString(("NPP.Player " + std::to_string(player_ids[i])).c_str()), std::string());
+	});
+
+	//the tokens are views into the text
+	const FString filter_text(("NPP.Query maxlevel:" + std::to_string(NewPlayerProtection::GetSettings()->MaxLevel)).c_str());
+	const auto filter = TokenizeCommand(filter_text);
+
+	MeasureBenchmarkCase(cases, "admin_filter", runs, [&filter](size_t)
+	{
+		std::vector<uint64> matched;
+		ResolveTribeTargets(filter, 1, matched);
+	});
+
+	nlohmann::json results;
+	results["version"] = 1;
+	results["timestamp_ms"] = NewPlayerProtection::ToEpochMs(std::chrono::system_clock::now());
+	results["records"] = steam_ids.size();
+	results["tribes"] = tribe_ids.size();
+	results["loaded_rows"] = rows.size();
+	results["runs"] = runs;
+	//the LoadDB of this start, which reads the whole database once
+	results["startup_load_db_ns"] = NewPlayerProtection::GetStat(NewPlayerProtection::Stat::LoadDB).Max();
+
+	for (const auto& result : cases)
+	{
+		auto& entry = results["cases"][result.name];
+		entry["samples"] = result.latency.Count();
+		entry["mean_ns"] = result.latency.Count() > 0 ? result.total_ns / result.latency.Count() : 0;
+		entry["p50_ns"] = result.latency.Percentile(0.5);
+		entry["p99_ns"] = result.latency.Percentile(0.99);
+		entry["max_ns"] = result.latency.Max();
+	}
+
+	nlohmann::json baseline;
+	std::ifstream baseline_file(NewPlayerProtection::GetBenchmarkPath("BenchmarkBaseline.json"));
+
+	if (baseline_file.is_open())
+	{
+		baseline = nlohmann::json::parse(baseline_file, nullptr, false);
+	}
+
+	std::string reply = "case,samples,p50_ns,p99_ns,max_ns,p50_vs_baseline";
+
+	for (const auto& result : cases)
+	{
+		std::string ratio;
+
+		const auto before_cases = baseline.is_object() ? baseline.find("cases") : baseline.end();
+
+		if (before_cases != baseline.end() && before_cases->is_object() && before_cases->count(result.name) > 0)
+		{
+			const auto& before = (*before_cases)[result.name];
+			auto& compared = results["baseline"][result.name];
+
+			for (const char* field : { "p50_ns", "p99_ns" })
+			{
+				const uint64 before_ns = before.value(field, uint64(0));
+				compared[std::string(field) + "_ratio"] = before_ns > 0 ? static_cast<double>(results["cases"][result.name][field].get<uint64>()) / before_ns : 0.0;
+			}
+			ratio = std::to_string(compared["p50_ns_ratio"].get<double>());
+		}
+
+		reply += "\n" + result.name
+			+ "," + std::to_string(result.latency.Count())
+			+ "," + std::to_string(result.latency.Percentile(0.5))
+			+ "," + std::to_string(result.latency.Percentile(0.99))
+			+ "," + std::to_string(result.latency.Max())
+			+ "," + ratio;
+	}
+
+	const auto write_results = [&results](const char* file)
+	{
+		std::ofstream out(NewPlayerProtection::GetBenchmarkPath(file));
+
+		if (!out.is_open())
+		{
+			NPP_LOG(err, "({} {}) Could not write benchmark file {}", __FILE__, __FUNCTION__, file);
+			return;
+		}
+		out << results.dump(2);
+	};
+
+	write_results("Benchmark.json");
+
+	if (save_baseline)
+	{
+		write_results("BenchmarkBaseline.json");
+	}
+
+	NPP_LOG(info, "NPP benchmark of {} records finished.", steam_ids.size());
+	return NewPlayerProtection::ToFString(reply);
+}
+
+inline void ConsoleBenchmark(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleTribeCommand(player_controller, *cmd, &BenchmarkCommand);
+}
+
+inline void RconBenchmark(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconTribeCommand(rcon_connection, rcon_packet, &BenchmarkCommand);
+}
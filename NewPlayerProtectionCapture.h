@@ -0,0 +1,266 @@
+#pragma once
+
+#include <fstream>
+#include <cstddef>
+
+namespace NewPlayerProtection
+{
+	enum class InstigatorKind : uint8
+	{
+		NoCauser,
+		NoInstigator,
+		Player,
+		Other
+	};
+
+#pragma pack(push, 1)
+	//one hit as stored in the capture file, the file is the header followed by a plain array of these
+	struct DamageEventRecord
+	{
+		//ms since the capture was started
+		uint32 tick;
+		//fnv-1a of the structure's blueprint path, unlike the UClass pointer it is the same across restarts
+		uint32 structure_class;
+		uint64 attacked_tribe;
+		uint64 attacking_tribe;
+		uint8 instigator_kind;
+	};
+
+	struct DamageCaptureHeader
+	{
+		char magic[8];
+		uint32 version;
+		uint32 capacity;
+		//records ever written, once the file has wrapped the oldest one is at total % capacity
+		uint64 total;
+	};
+#pragma pack(pop)
+
+	//ring buffered capture of TakeDamage hits for replaying raid traffic offline.
+	//hits are batched in memory and written when the batch fills up, on world save and on unload.
+	class DamageCapture
+	{
+		public:
+			static DamageCapture& Get();
+
+			DamageCapture(const DamageCapture&) = delete;
+			DamageCapture(DamageCapture&&) = delete;
+			DamageCapture& operator=(const DamageCapture&) = delete;
+			DamageCapture& operator=(DamageCapture&&) = delete;
+
+			//called on every config load, an existing file with the same capacity is continued
+			void Configure(bool enabled, size_t capacity, const std::string& path);
+
+			bool IsEnabled() const
+			{
+				return enabled_;
+			}
+
+			void Record(UObjectBase* structure, uint64 attacked_tribe, uint64 attacking_tribe, InstigatorKind kind);
+			void Flush();
+
+			//replay side, fills records oldest first, false when the file is missing or not a capture
+			static bool Read(const std::string& path, std::vector<DamageEventRecord>& records);
+
+		private:
+			DamageCapture() = default;
+			~DamageCapture() = default;
+
+			bool Open();
+			void Close();
+			uint32 GetClassHash(UObjectBase* structure);
+
+			static constexpr char magic_[8] = { 'N', 'P', 'P', 'D', 'M', 'G', 0, 0 };
+			static constexpr uint32 version_ = 1;
+			//hits kept in memory before they are written
+			static constexpr size_t flush_size_ = 4096;
+
+			bool enabled_ = false;
+			std::string path_;
+			uint32 capacity_ = 0;
+			uint64 total_ = 0;
+			std::fstream file_;
+			std::vector<DamageEventRecord> pending_;
+			std::unordered_map<UClass*, uint32> class_hashes_;
+			std::chrono::steady_clock::time_point started_;
+	};
+}
+
+NewPlayerProtection::DamageCapture& NewPlayerProtection::DamageCapture::Get()
+{
+	static DamageCapture instance;
+	return instance;
+}
+
+void NewPlayerProtection::DamageCapture::Configure(bool enabled, size_t capacity, const std::string& path)
+{
+	const uint32 new_capacity = static_cast<uint32>(std::min<size_t>(std::max<size_t>(capacity, 1), std::numeric_limits<uint32>::max()));
+
+	if (enabled && enabled_ && path == path_ && new_capacity == capacity_)
+		return;
+
+	Close();
+
+	if (!enabled)
+		return;
+
+	path_ = path;
+	capacity_ = new_capacity;
+	enabled_ = Open();
+}
+
+bool NewPlayerProtection::DamageCapture::Open()
+{
+	DamageCaptureHeader header{};
+	total_ = 0;
+
+	{
+		std::ifstream existing(path_, std::ios::binary);
+
+		if (existing.read(reinterpret_cast<char*>(&header), sizeof(header))
+			&& std::equal(std::begin(magic_), std::end(magic_), header.magic) && header.version == version_ && header.capacity == capacity_)
+		{
+			total_ = header.total;
+		}
+	}
+
+	if (total_ == 0)
+	{
+		//new file, or one written with another layout or capacity
+		std::ofstream created(path_, std::ios::binary | std::ios::trunc);
+
+		std::copy(std::begin(magic_), std::end(magic_), header.magic);
+		header.version = version_;
+		header.capacity = capacity_;
+		header.total = 0;
+
+		if (!created.write(reinterpret_cast<const char*>(&header), sizeof(header)))
+		{
+			NPP_LOG(err, "({} {}) Could not create damage capture file {}", __FILE__, __FUNCTION__, path_);
+			return false;
+		}
+	}
+
+	file_.open(path_, std::ios::binary | std::ios::in | std::ios::out);
+
+	if (!file_.is_open())
+	{
+		NPP_LOG(err, "({} {}) Could not open damage capture file {}", __FILE__, __FUNCTION__, path_);
+		return false;
+	}
+
+	started_ = std::chrono::steady_clock::now();
+	pending_.reserve(flush_size_);
+
+	NPP_LOG(info, "NPP damage capture started, {} records of {} already in {}.", std::min<uint64>(total_, capacity_), capacity_, path_);
+	return true;
+}
+
+void NewPlayerProtection::DamageCapture::Close()
+{
+	if (!enabled_)
+		return;
+
+	Flush();
+	file_.close();
+	enabled_ = false;
+}
+
+uint32 NewPlayerProtection::DamageCapture::GetClassHash(UObjectBase* structure)
+{
+	UClass* structure_class = structure->ClassField();
+	const auto iter = class_hashes_.find(structure_class);
+
+	if (iter != class_hashes_.end())
+	{
+		return iter->second;
+	}
+
+	uint32 hash = 2166136261u;
+
+	for (const wchar_t c : std::wstring(*GetCachedBlueprint(structure)))
+	{
+		hash ^= static_cast<uint32>(c);
+		hash *= 16777619u;
+	}
+
+	class_hashes_.emplace(structure_class, hash);
+	return hash;
+}
+
+void NewPlayerProtection::DamageCapture::Record(UObjectBase* structure, uint64 attacked_tribe, uint64 attacking_tribe, InstigatorKind kind)
+{
+	DamageEventRecord record;
+	record.tick = static_cast<uint32>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started_).count());
+	record.structure_class = GetClassHash(structure);
+	record.attacked_tribe = attacked_tribe;
+	record.attacking_tribe = attacking_tribe;
+	record.instigator_kind = static_cast<uint8>(kind);
+
+	pending_.push_back(record);
+
+	if (pending_.size() >= flush_size_)
+	{
+		Flush();
+	}
+}
+
+void NewPlayerProtection::DamageCapture::Flush()
+{
+	if (!enabled_ || pending_.empty())
+		return;
+
+	//write in runs that stop at the end of the ring, then the header so a reader sees whole records only
+	for (size_t written = 0; written < pending_.size();)
+	{
+		const size_t slot = static_cast<size_t>(total_ % capacity_);
+		const size_t run = std::min(pending_.size() - written, capacity_ - slot);
+
+		file_.seekp(sizeof(DamageCaptureHeader) + slot * sizeof(DamageEventRecord));
+		file_.write(reinterpret_cast<const char*>(pending_.data() + written), run * sizeof(DamageEventRecord));
+
+		written += run;
+		total_ += run;
+	}
+
+	file_.seekp(offsetof(DamageCaptureHeader, total));
+	file_.write(reinterpret_cast<const char*>(&total_), sizeof(total_));
+	file_.flush();
+
+	if (!file_)
+	{
+		NPP_LOG(err, "({} {}) Could not write damage capture file {}, capture stopped", __FILE__, __FUNCTION__, path_);
+		file_.close();
+		enabled_ = false;
+	}
+
+	pending_.clear();
+}
+
+bool NewPlayerProtection::DamageCapture::Read(const std::string& path, std::vector<DamageEventRecord>& records)
+{
+	std::ifstream file(path, std::ios::binary);
+	DamageCaptureHeader header{};
+
+	if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))
+		|| !std::equal(std::begin(magic_), std::end(magic_), header.magic) || header.version != version_ || header.capacity == 0)
+	{
+		return false;
+	}
+
+	const size_t count = static_cast<size_t>(std::min<uint64>(header.total, header.capacity));
+	records.resize(count);
+
+	if (!file.read(reinterpret_cast<char*>(records.data()), count * sizeof(DamageEventRecord)))
+	{
+		records.clear();
+		return false;
+	}
+
+	//a wrapped ring starts with the slot the next write would have gone to
+	if (header.total > header.capacity)
+	{
+		std::rotate(records.begin(), records.begin() + static_cast<size_t>(header.total % header.capacity), records.end());
+	}
+	return true;
+}
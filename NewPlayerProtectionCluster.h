@@ -0,0 +1,592 @@
+#pragma once
+
+#include <Database/Mysql.h>
+
+namespace NewPlayerProtection
+{
+	struct ClusterOptions
+	{
+		std::string host;
+		std::string user;
+		std::string password;
+		std::string database;
+		//name of this map in the ServerId column, rows written by it are not read back
+		std::string server_id;
+		std::chrono::seconds sync_interval;
+	};
+
+	//every resident member of a tribe whose player uploaded a character, as the uploading map had them
+	struct ClusterTransfer
+	{
+		uint64 tribe_id;
+		std::vector<PlayerRow> members;
+	};
+
+	//rows the other maps changed since the last poll
+	struct ClusterChanges
+	{
+		std::vector<TimerProt::PlayerRecord> players;
+		std::vector<std::pair<uint64, bool>> pveTribes;
+		std::vector<ClusterTransfer> transfers;
+	};
+
+	//optional MySQL copy of the Players and PVE tribes shared by every map of a cluster. each map pushes the rows it saves
+	//and polls for rows changed by the others, memory and the local SQLite file stay the cache every lookup is served from.
+	class ClusterSync
+	{
+		public:
+			static ClusterSync& Get();
+
+			ClusterSync(const ClusterSync&) = delete;
+			ClusterSync(ClusterSync&&) = delete;
+			ClusterSync& operator=(const ClusterSync&) = delete;
+			ClusterSync& operator=(ClusterSync&&) = delete;
+
+			void Start(const ClusterOptions& options);
+			void Stop(std::chrono::milliseconds timeout);
+
+			//copy of a world save, written to MySQL by the sync thread
+			void Push(const SaveBatch& batch);
+			//game thread, on a character upload. the members go out ahead of the next save and every other map makes the
+			//tribe resident from its next poll, so the player arriving there is found in memory
+			void PushTransfer(uint64 tribe_id, std::vector<TimerProt::PlayerRecord> members);
+			//game thread, applies what the last polls read
+			void ApplyChanges();
+
+		private:
+			ClusterSync() = default;
+			~ClusterSync() = default;
+
+			bool CreateTables(daotk::mysql::connection& connection);
+			void Run(std::shared_ptr<daotk::mysql::connection> connection);
+			void Write(daotk::mysql::connection& connection, const SaveBatch& batch);
+			void Poll(daotk::mysql::connection& connection, ClusterChanges& changes);
+			static std::string EncodeMembers(const std::vector<TimerProt::PlayerRecord>& members);
+			static std::vector<PlayerRow> DecodeMembers(const std::string& text);
+
+			static constexpr size_t rows_per_statement_ = 500;
+			static constexpr size_t rows_per_poll_ = 5000;
+			//a save committed late can carry ChangedAt values just behind the cursor, this much is read again
+			static constexpr int64 overlap_ms_ = 5000;
+			//an upload is only adopted this long after it, older transfers are removed
+			static constexpr int64 transfer_window_ms_ = 10 * 60 * 1000;
+
+			ClusterOptions options_;
+			std::thread thread_;
+			std::mutex mutex_;
+			std::condition_variable queue_cv_;
+			std::condition_variable drained_cv_;
+			std::deque<SaveBatch> outgoing_;
+			std::deque<std::pair<uint64, std::vector<TimerProt::PlayerRecord>>> outgoing_transfers_;
+			ClusterChanges incoming_;
+			bool running_ = false;
+			bool stop_ = false;
+			bool busy_ = false;
+
+			//sync thread only, (ChangedAt, SteamId) of the last player row read and whether that poll filled its page
+			int64 player_cursor_at_ = 0;
+			uint64 player_cursor_id_ = 0;
+			bool player_page_full_ = false;
+			int64 pve_cursor_at_ = 0;
+			int64 transfer_cursor_at_ = 0;
+			//ChangedAt already read per row, so the overlap is not applied twice
+			std::unordered_map<uint64, int64> seen_players_;
+			std::unordered_map<uint64, int64> seen_pve_;
+			std::unordered_map<uint64, int64> seen_transfers_;
+	};
+}
+
+NewPlayerProtection::ClusterSync& NewPlayerProtection::ClusterSync::Get()
+{
+	static ClusterSync instance;
+	return instance;
+}
+
+void NewPlayerProtection::ClusterSync::Start(const ClusterOptions& options)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	if (running_)
+		return;
+
+	//the value is quoted into every statement, keep it to a plain name
+	if (options.server_id.empty() || options.server_id.size() > 64
+		|| !std::all_of(options.server_id.begin(), options.server_id.end(), [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '-'; }))
+	{
+		NPP_LOG(err, "({} {}) Cluster ServerId must be 1 to 64 letters, digits, '_' or '-', cluster sync disabled", __FILE__, __FUNCTION__);
+		return;
+	}
+
+	try
+	{
+		daotk::mysql::connect_options connect;
+		connect.server = options.host;
+		connect.username = options.user;
+		connect.password = options.password;
+		connect.dbname = options.database;
+		connect.autoreconnect = true;
+		connect.timeout = 30;
+
+		auto connection = std::make_shared<daotk::mysql::connection>();
+
+		if (!connection->open(connect) || !CreateTables(*connection))
+		{
+			NPP_LOG(err, "({} {}) Could not open cluster database {}, cluster sync disabled", __FILE__, __FUNCTION__, options.host);
+			return;
+		}
+
+		options_ = options;
+		running_ = true;
+		stop_ = false;
+		thread_ = std::thread(&ClusterSync::Run, this, connection);
+	}
+	catch (const std::exception& exception)
+	{
+		NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+	}
+}
+
+void NewPlayerProtection::ClusterSync::Stop(std::chrono::milliseconds timeout)
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+
+	if (!running_)
+		return;
+
+	stop_ = true;
+	queue_cv_.notify_one();
+
+	//same as the DBWriter, called from DllMain so the last saves are waited for instead of joining under the loader lock
+	if (!drained_cv_.wait_for(lock, timeout, [this] { return outgoing_.empty() && outgoing_transfers_.empty() && !busy_; }))
+	{
+		NPP_LOG(warn, "NPP cluster sync did not finish in time, {} saves were not pushed.", outgoing_.size());
+	}
+
+	running_ = false;
+	lock.unlock();
+
+	if (thread_.joinable())
+	{
+		thread_.detach();
+	}
+}
+
+bool NewPlayerProtection::ClusterSync::CreateTables(daotk::mysql::connection& connection)
+{
+	bool result = connection.query("CREATE TABLE IF NOT EXISTS NPP_Players ("
+		"SteamId BIGINT UNSIGNED NOT NULL,"
+		"TribeId BIGINT UNSIGNED NOT NULL,"
+		"Start_DateTime BIGINT NOT NULL,"
+		"Last_Login_DateTime BIGINT NOT NULL,"
+		"Level INT NOT NULL,"
+		"Is_New_Player INT NOT NULL,"
+		"ServerId VARCHAR(64) NOT NULL,"
+		"ChangedAt BIGINT NOT NULL,"
+		"PRIMARY KEY(SteamId),"
+		"INDEX ChangedAt_INDEX (ChangedAt, SteamId));");
+	result = result && connection.query("CREATE TABLE IF NOT EXISTS NPP_PVE_Tribes ("
+		"TribeId BIGINT UNSIGNED NOT NULL,"
+		"Is_PVE TINYINT NOT NULL,"
+		"ServerId VARCHAR(64) NOT NULL,"
+		"ChangedAt BIGINT NOT NULL,"
+		"PRIMARY KEY(TribeId),"
+		"INDEX ChangedAt_INDEX (ChangedAt));");
+	result = result && connection.query("CREATE TABLE IF NOT EXISTS NPP_Transfers ("
+		"TribeId BIGINT UNSIGNED NOT NULL,"
+		"Members MEDIUMTEXT NOT NULL,"
+		"ServerId VARCHAR(64) NOT NULL,"
+		"ChangedAt BIGINT NOT NULL,"
+		"PRIMARY KEY(TribeId),"
+		"INDEX ChangedAt_INDEX (ChangedAt));");
+	return result;
+}
+
+void NewPlayerProtection::ClusterSync::Push(const SaveBatch& batch)
+{
+	if (batch.players.empty() && batch.pveTribes.empty())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		if (!running_)
+			return;
+
+		//tribe aggregates are rebuilt by every map from the players, they are not shared
+		SaveBatch copy;
+		copy.players = batch.players;
+		copy.pveTribes = batch.pveTribes;
+		outgoing_.push_back(std::move(copy));
+	}
+	queue_cv_.notify_one();
+}
+
+void NewPlayerProtection::ClusterSync::PushTransfer(uint64 tribe_id, std::vector<TimerProt::PlayerRecord> members)
+{
+	if (members.empty())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		if (!running_)
+			return;
+
+		//the rows themselves too, the other maps' databases then agree with what they adopt
+		SaveBatch copy;
+		copy.players = members;
+		outgoing_.push_back(std::move(copy));
+		outgoing_transfers_.emplace_back(tribe_id, std::move(members));
+	}
+	queue_cv_.notify_one();
+}
+
+//"steam,tribe,start_ms,last_login_ms,level,is_new;" per member, only digits so it can be quoted into the statement
+std::string NewPlayerProtection::ClusterSync::EncodeMembers(const std::vector<TimerProt::PlayerRecord>& members)
+{
+	std::string text;
+
+	for (const auto& data : members)
+	{
+		text += fmt::format("{},{},{},{},{},{};", data.steam_id, data.tribe_id, NewPlayerProtection::ToEpochMs(data.StartDateTime()),
+			NewPlayerProtection::ToEpochMs(data.LastLoginDateTime()), static_cast<int>(data.level), static_cast<int>(data.isNewPlayer));
+	}
+	return text;
+}
+
+std::vector<NewPlayerProtection::PlayerRow> NewPlayerProtection::ClusterSync::DecodeMembers(const std::string& text)
+{
+	std::vector<PlayerRow> members;
+
+	for (size_t first = 0; first < text.size();)
+	{
+		const size_t end = std::min(text.find(';', first), text.size());
+		PlayerRow row{};
+
+		if (sscanf(text.substr(first, end - first).c_str(), "%llu,%llu,%lld,%lld,%d,%d", &row.steam_id, &row.tribe_id, &row.start_ms,
+			&row.last_login_ms, &row.level, &row.is_new_player) == 6)
+		{
+			members.push_back(row);
+		}
+		first = end + 1;
+	}
+	return members;
+}
+
+void NewPlayerProtection::ClusterSync::Run(std::shared_ptr<daotk::mysql::connection> connection)
+{
+	NewPlayerProtection::ApplyBackgroundThreadSettings("cluster sync");
+
+	std::unique_lock<std::mutex> lock(mutex_);
+
+	while (true)
+	{
+		queue_cv_.wait_for(lock, options_.sync_interval, [this] { return stop_ || !outgoing_.empty(); });
+
+		if (stop_ && outgoing_.empty() && outgoing_transfers_.empty())
+		{
+			drained_cv_.notify_all();
+			break;
+		}
+
+		std::deque<SaveBatch> batches;
+		batches.swap(outgoing_);
+		std::deque<std::pair<uint64, std::vector<TimerProt::PlayerRecord>>> transfers;
+		transfers.swap(outgoing_transfers_);
+		const bool stopping = stop_;
+		busy_ = true;
+		lock.unlock();
+
+		for (const auto& batch : batches)
+		{
+			Write(*connection, batch);
+		}
+
+		//after the rows, a map reading the transfer already finds them in NPP_Players
+		try
+		{
+			for (const auto& transfer : transfers)
+			{
+				connection->query(fmt::format("INSERT INTO NPP_Transfers (TribeId, Members, ServerId, ChangedAt) VALUES ({},'{}','{}',ROUND(UNIX_TIMESTAMP(NOW(3)) * 1000)) "
+					"ON DUPLICATE KEY UPDATE Members = VALUES(Members), ServerId = VALUES(ServerId), ChangedAt = VALUES(ChangedAt);",
+					transfer.first, EncodeMembers(transfer.second), options_.server_id));
+			}
+
+			if (!transfers.empty())
+			{
+				connection->query(fmt::format("DELETE FROM NPP_Transfers WHERE ChangedAt < ROUND(UNIX_TIMESTAMP(NOW(3)) * 1000) - {};", transfer_window_ms_));
+			}
+		}
+		catch (const std::exception& exception)
+		{
+			NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+		}
+
+		ClusterChanges changes;
+
+		if (!stopping)
+		{
+			Poll(*connection, changes);
+		}
+
+		lock.lock();
+		busy_ = false;
+
+		incoming_.players.insert(incoming_.players.end(), changes.players.begin(), changes.players.end());
+		incoming_.pveTribes.insert(incoming_.pveTribes.end(), changes.pveTribes.begin(), changes.pveTribes.end());
+		incoming_.transfers.insert(incoming_.transfers.end(), std::make_move_iterator(changes.transfers.begin()), std::make_move_iterator(changes.transfers.end()));
+
+		if (outgoing_.empty() && outgoing_transfers_.empty())
+		{
+			drained_cv_.notify_all();
+		}
+	}
+}
+
+void NewPlayerProtection::ClusterSync::Write(daotk::mysql::connection& connection, const SaveBatch& batch)
+{
+	//server side clock, so maps with drifting clocks still agree on the order of changes
+	const char* changed_at = "ROUND(UNIX_TIMESTAMP(NOW(3)) * 1000)";
+
+	try
+	{
+		for (size_t first = 0; first < batch.players.size(); first += rows_per_statement_)
+		{
+			std::string values;
+
+			for (size_t i = first; i < std::min(first + rows_per_statement_, batch.players.size()); ++i)
+			{
+				const auto& data = batch.players[i];
+
+				values += fmt::format("{}({},{},{},{},{},{},'{}',{})", values.empty() ? "" : ",", data.steam_id, data.tribe_id,
+					NewPlayerProtection::ToEpochMs(data.StartDateTime()), NewPlayerProtection::ToEpochMs(data.LastLoginDateTime()),
+					static_cast<int>(data.level), static_cast<int>(data.isNewPlayer), options_.server_id, changed_at);
+			}
+
+			connection.query(fmt::format("INSERT INTO NPP_Players (SteamId, TribeId, Start_DateTime, Last_Login_DateTime, Level, Is_New_Player, ServerId, ChangedAt) VALUES {} "
+				"ON DUPLICATE KEY UPDATE TribeId = VALUES(TribeId), Start_DateTime = VALUES(Start_DateTime), Last_Login_DateTime = VALUES(Last_Login_DateTime), "
+				"Level = VALUES(Level), Is_New_Player = VALUES(Is_New_Player), ServerId = VALUES(ServerId), ChangedAt = VALUES(ChangedAt);", values));
+		}
+
+		for (size_t first = 0; first < batch.pveTribes.size(); first += rows_per_statement_)
+		{
+			std::string values;
+
+			for (size_t i = first; i < std::min(first + rows_per_statement_, batch.pveTribes.size()); ++i)
+			{
+				values += fmt::format("{}({},{},'{}',{})", values.empty() ? "" : ",", batch.pveTribes[i].first, batch.pveTribes[i].second ? 1 : 0,
+					options_.server_id, changed_at);
+			}
+
+			connection.query(fmt::format("INSERT INTO NPP_PVE_Tribes (TribeId, Is_PVE, ServerId, ChangedAt) VALUES {} "
+				"ON DUPLICATE KEY UPDATE Is_PVE = VALUES(Is_PVE), ServerId = VALUES(ServerId), ChangedAt = VALUES(ChangedAt);", values));
+		}
+	}
+	catch (const std::exception& exception)
+	{
+		NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+	}
+}
+
+void NewPlayerProtection::ClusterSync::Poll(daotk::mysql::connection& connection, ClusterChanges& changes)
+{
+	try
+	{
+		//keyset paging, a full page continues exactly where it stopped, otherwise the overlap is read again
+		const int64 since_at = player_page_full_ ? player_cursor_at_ : std::max<int64>(0, player_cursor_at_ - overlap_ms_);
+		const uint64 since_id = player_page_full_ ? player_cursor_id_ : 0;
+		size_t rows = 0;
+
+		connection.query(fmt::format("SELECT SteamId, TribeId, Start_DateTime, Last_Login_DateTime, Level, Is_New_Player, ChangedAt FROM NPP_Players "
+			"WHERE (ChangedAt > {0} OR (ChangedAt = {0} AND SteamId > {1})) AND ServerId <> '{2}' ORDER BY ChangedAt, SteamId LIMIT {3};",
+			since_at, since_id, options_.server_id, rows_per_poll_))
+			.each([this, &changes, &rows](uint64 steam_id, uint64 tribe_id, int64 start, int64 last_login, int level, int is_new_player, int64 changed_at)
+			{
+				++rows;
+
+				if (changed_at > player_cursor_at_ || (changed_at == player_cursor_at_ && steam_id > player_cursor_id_))
+				{
+					player_cursor_at_ = changed_at;
+					player_cursor_id_ = steam_id;
+				}
+
+				int64& seen = seen_players_[steam_id];
+
+				if (seen == changed_at)
+					return true;
+
+				seen = changed_at;
+				changes.players.emplace_back(steam_id, tribe_id, NewPlayerProtection::FromEpochMs(start), NewPlayerProtection::FromEpochMs(last_login), level, is_new_player);
+				return true;
+			});
+
+		player_page_full_ = rows == rows_per_poll_;
+
+		const int64 pve_since = std::max<int64>(0, pve_cursor_at_ - overlap_ms_);
+
+		connection.query(fmt::format("SELECT TribeId, Is_PVE, ChangedAt FROM NPP_PVE_Tribes WHERE ChangedAt >= {} AND ServerId <> '{}';", pve_since, options_.server_id))
+			.each([this, &changes](uint64 tribe_id, int is_pve, int64 changed_at)
+			{
+				pve_cursor_at_ = std::max(pve_cursor_at_, changed_at);
+
+				int64& seen = seen_pve_[tribe_id];
+
+				if (seen == changed_at)
+					return true;
+
+				seen = changed_at;
+				changes.pveTribes.emplace_back(tribe_id, is_pve != 0);
+				return true;
+			});
+
+		//uploads from before this map started, or that nobody picked up in time, are not adopted anymore
+		const int64 transfer_since = std::max<int64>(0, transfer_cursor_at_ - overlap_ms_);
+
+		connection.query(fmt::format("SELECT TribeId, Members, ChangedAt FROM NPP_Transfers WHERE ChangedAt >= GREATEST({}, ROUND(UNIX_TIMESTAMP(NOW(3)) * 1000) - {}) AND ServerId <> '{}';",
+			transfer_since, transfer_window_ms_, options_.server_id))
+			.each([this, &changes](uint64 tribe_id, std::string members, int64 changed_at)
+			{
+				transfer_cursor_at_ = std::max(transfer_cursor_at_, changed_at);
+
+				int64& seen = seen_transfers_[tribe_id];
+
+				if (seen == changed_at)
+					return true;
+
+				seen = changed_at;
+				changes.transfers.push_back({ tribe_id, DecodeMembers(members) });
+				return true;
+			});
+	}
+	catch (const std::exception& exception)
+	{
+		NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+		return;
+	}
+
+	//rows behind the overlap can't be read again
+	const auto prune = [](std::unordered_map<uint64, int64>& seen, int64 before)
+	{
+		for (auto iter = seen.begin(); iter != seen.end();)
+		{
+			iter = iter->second < before ? seen.erase(iter) : std::next(iter);
+		}
+	};
+
+	if (!player_page_full_)
+	{
+		prune(seen_players_, player_cursor_at_ - overlap_ms_);
+	}
+	prune(seen_pve_, pve_cursor_at_ - overlap_ms_);
+	prune(seen_transfers_, transfer_cursor_at_ - overlap_ms_);
+}
+
+void NewPlayerProtection::ClusterSync::ApplyChanges()
+{
+	ClusterChanges changes;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		if (incoming_.players.empty() && incoming_.pveTribes.empty() && incoming_.transfers.empty())
+			return;
+
+		std::swap(changes, incoming_);
+	}
+
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	std::unordered_set<uint64> touched_tribes;
+
+	//written to the local database only, pushing them back would echo every change around the cluster
+	SaveBatch local = DBWriter::Get().AcquireBatch();
+
+	for (const auto& row : changes.players)
+	{
+		auto* data = timer.FindPlayer(row.steam_id);
+
+		if (data)
+		{
+			//a player can only be online on one map, the row is an older copy of what this map already has
+			if (data->isOnline)
+				continue;
+
+			if (data->tribe_id == row.tribe_id && data->startSecs == row.startSecs && data->level == row.level && data->isNewPlayer == row.isNewPlayer)
+				continue;
+
+			touched_tribes.insert(data->tribe_id);
+
+			if (data->tribe_id != row.tribe_id)
+			{
+				timer.SetPlayerTribe(*timer.player_index_.Find(row.steam_id), row.tribe_id);
+			}
+
+			data->startSecs = row.startSecs;
+			timer.SetLastLoginDateTime(*data, std::max(timer.LastLoginDateTime(*data), row.LastLoginDateTime()));
+			data->level = row.level;
+			data->isNewPlayer = row.isNewPlayer;
+			timer.ScheduleExpiry(*data);
+
+			touched_tribes.insert(row.tribe_id);
+		}
+		else if (timer.GetTribe(row.tribe_id))
+		{
+			//the tribe is resident, so its aggregate has to count the new member
+			timer.AddPlayerFromDB(row.steam_id, row.tribe_id, row.StartDateTime(), row.LastLoginDateTime(), row.level, row.isNewPlayer);
+			touched_tribes.insert(row.tribe_id);
+		}
+
+		local.players.push_back(row);
+	}
+
+	for (const auto& tribe : changes.pveTribes)
+	{
+		const bool isPve = NewPlayerProtection::pveTribesList.count(tribe.first) > 0;
+
+		if (isPve == tribe.second)
+			continue;
+
+		if (tribe.second)
+		{
+			NewPlayerProtection::pveTribesList.insert(tribe.first);
+			NewPlayerProtection::removedPveTribesList.erase(tribe.first);
+		}
+		else
+		{
+			NewPlayerProtection::pveTribesList.erase(tribe.first);
+			NewPlayerProtection::removedPveTribesList.insert(tribe.first);
+		}
+
+		//not MarkPveDirty, the row came from the cluster and is saved by the map that changed it
+		NewPlayerProtection::EventBus::Get().Publish(tribe.second ? NewPlayerProtection::ProtectionEventType::PveEnabled
+			: NewPlayerProtection::ProtectionEventType::PveDisabled, tribe.first);
+		touched_tribes.insert(tribe.first);
+		local.pveTribes.push_back(tribe);
+	}
+
+	for (const uint64 tribe_id : touched_tribes)
+	{
+		timer.UpdateTribe(tribe_id);
+	}
+
+	//a resident tribe already took the rows above, the others are read in whole from the transfer instead of on arrival
+	size_t adopted = 0;
+
+	for (const auto& transfer : changes.transfers)
+	{
+		if (timer.resident_tribes_.count(transfer.tribe_id) == 0)
+		{
+			AdoptTribeRows(transfer.tribe_id, transfer.members);
+			++adopted;
+		}
+	}
+
+	if (adopted > 0)
+	{
+		NPP_LOG(info, "NPP cluster sync made {} tribes resident that uploaded characters on other maps.", adopted);
+	}
+
+	if (local.players.empty() && local.pveTribes.empty())
+		return;
+
+	NPP_LOG(info, "NPP cluster sync applied {} player and {} PVE tribe changes from other maps.", local.players.size(), local.pveTribes.size());
+	NewPlayerProtection::DBWriter::Get().Enqueue(std::move(local));
+}
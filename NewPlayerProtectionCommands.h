@@ -2,13 +2,12 @@
 
 inline void Info(AShooterPlayerController* player)
 {
-		ArkApi::GetApiUtils().SendNotification(player, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-			*NewPlayerProtection::NPPInfoMessage, NewPlayerProtection::HoursOfProtection, NewPlayerProtection::MaxLevel);
+		NewPlayerProtection::SendNotification(player, NewPlayerProtection::GetSettings()->NPPInfoMessage.Render(NewPlayerProtection::GetSettings()->HoursOfProtection, NewPlayerProtection::GetSettings()->MaxLevel));
 }
 
 inline void Disable(AShooterPlayerController* player)
 {
-	if (!player || !player->PlayerStateField() || ArkApi::IApiUtils::IsPlayerDead(player) || !NewPlayerProtection::AllowPlayersToDisableOwnedTribeProtection)
+	if (!player || !player->PlayerStateField() || ArkApi::IApiUtils::IsPlayerDead(player) || !NewPlayerProtection::GetSettings()->AllowPlayersToDisableOwnedTribeProtection)
 		return;
 
 	// if not PVE player
@@ -26,50 +25,82 @@ inline void Disable(AShooterPlayerController* player)
 				uint64 tribe_id = player->TargetingTeamField();
 				uint64 steam_id = ArkApi::IApiUtils::GetSteamIdFromController(player);
 
-				auto all_players_ = NewPlayerProtection::TimerProt::Get().GetAllPlayers();
-				auto online_players_ = NewPlayerProtection::TimerProt::Get().GetOnlinePlayers();
+				const auto tribe_members = NewPlayerProtection::TimerProt::Get().GetTribeMembers(tribe_id);
 
-				for (const auto& allData : all_players_)
+				for (auto* allData : tribe_members)
 				{
-					if (allData->tribe_id == tribe_id)
-					{
-						allData->isNewPlayer = 0;
-					}
+					allData->isNewPlayer = 0;
+					NewPlayerProtection::TimerProt::Get().MarkDirty(*allData);
 				}
+				NewPlayerProtection::TimerProt::Get().UpdateTribe(tribe_id);
 
-				for (const auto& onlineData : online_players_)
-				{
-					if (onlineData->tribe_id == tribe_id)
-					{
-						onlineData->isNewPlayer = 0;
-					}
-				}
 				//display protection removed message
-				ArkApi::GetApiUtils().SendNotification(player, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-					*NewPlayerProtection::NewPlayerProtectionDisableSuccess);
+				NewPlayerProtection::SendNotification(player, NewPlayerProtection::GetSettings()->NewPlayerProtectionDisableSuccess.Text());
 
-				Log::GetLog()->info("Player: {} of Tribe: {} disabled own tribes NPP Protection.", steam_id, tribe_id);
+				NPP_LOG(info, "Player: {} of Tribe: {} disabled own tribes NPP Protection.", steam_id, tribe_id);
+				NewPlayerProtection::AuditLog::Get().Record("protection_disabled_by_tribe", tribe_id, std::to_string(steam_id));
+				NewPlayerProtection::Replication::Get().PublishTribe(tribe_id);
 			}
 			else //else not tribe admin
 			{
 				//display not tribe admin message
-				ArkApi::GetApiUtils().SendNotification(player, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-					*NewPlayerProtection::NotTribeAdminMessage);
+				NewPlayerProtection::SendNotification(player, NewPlayerProtection::GetSettings()->NotTribeAdminMessage.Text());
 			}
 		}
 		else //else not new player
 		{
 			//display not under protection message
-			ArkApi::GetApiUtils().SendNotification(player, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-				*NewPlayerProtection::NotANewPlayerMessage);
+			NewPlayerProtection::SendNotification(player, NewPlayerProtection::GetSettings()->NotANewPlayerMessage.Text());
 		}
 	}
 	else // else PVE player 
 	{
 		//display PVE protection message
-		ArkApi::GetApiUtils().SendNotification(player, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-			*NewPlayerProtection::PVEDisablePlayerMessage);
+		NewPlayerProtection::SendNotification(player, NewPlayerProtection::GetSettings()->PVEDisablePlayerMessage.Text());
+	}
+}
+
+//!npp status reply of a protected tribe, the same for the whole tribe until the minutes shown change, the tribe changes
+//or the config is reloaded
+inline const FString& StatusReply(uint64 tribe_id)
+{
+	auto now = NewPlayerProtection::TimerProt::Get().Now();
+	const auto settings = NewPlayerProtection::GetSettings();
+	auto& status_cache = NewPlayerProtection::TimerProt::Get().status_cache_;
+	const uint64 epoch = NewPlayerProtection::Epochs.Tribe(tribe_id);
+	auto cached = status_cache.find(tribe_id);
+
+	if (cached == status_cache.end() || cached->second.expires <= now || cached->second.epoch != epoch)
+	{
+		//oldest start date and highest level of the tribe, admins are left out
+		std::chrono::time_point<std::chrono::system_clock> oldestDate = now + std::chrono::hours(999999);
+		int highestLevel = 0;
+
+		if (const auto tribe = NewPlayerProtection::TimerProt::Get().GetTribe(tribe_id))
+		{
+			oldestDate = std::min(oldestDate, tribe->oldestStartDateTime);
+			highestLevel = tribe->maxLevel;
+		}
+
+		//calulate time
+		auto protectionInHours = std::chrono::hours(settings->HoursOfProtection);
+		auto expireTime = now - protectionInHours;
+		auto remaining = oldestDate - expireTime;
+		auto expireTimeinMin = std::chrono::duration_cast<std::chrono::minutes>(remaining);
+		auto daysLeft = expireTimeinMin / 1440;
+		auto hoursLeft = ((expireTimeinMin - (1440 * daysLeft)) / 60);
+		auto minutesLeft =  (expireTimeinMin - ((1440 * daysLeft) + (60 * hoursLeft)));
+
+		//calculate level
+		int levelsLeft = settings->MaxLevel - highestLevel;
+
+		//the shown minutes tick over once the sub-minute part of remaining has passed
+		const auto expires = remaining > remaining.zero() ? now + (remaining - expireTimeinMin) : now + std::chrono::minutes(1);
+
+		cached = status_cache.insert_or_assign(tribe_id, NewPlayerProtection::TimerProt::StatusCacheEntry{ expires, epoch,
+			settings->NPPRemainingMessage.Render(daysLeft.count(), hoursLeft.count(), minutesLeft.count(), levelsLeft) }).first;
 	}
+	return cached->second.message;
 }
 
 inline void Status(AShooterPlayerController* player)
@@ -85,87 +116,105 @@ inline void Status(AShooterPlayerController* player)
 		//if new player or admin
 		if (IsPlayerProtected(player) || IsAdmin(steam_id))
 		{
-			//loop through tribe member
-			uint64 tribe_id = player->TargetingTeamField();
-			std::chrono::time_point<std::chrono::system_clock> oldestDate = std::chrono::system_clock::now() + std::chrono::hours(999999);
-			int highestLevel = 0;
+			//display time/level remaining message
+			NewPlayerProtection::SendNotification(player, StatusReply(player->TargetingTeamField()));
+		}
+		else//else not new player
+		{
+			//display not under protection message
+			NewPlayerProtection::SendNotification(player, NewPlayerProtection::GetSettings()->NotANewPlayerMessage.Text());
+		}
+	}
+	else // is pve tribe
+	{
+		// pve status notification
+		NewPlayerProtection::SendNotification(player, NewPlayerProtection::GetSettings()->PVEStatusMessage.Text());
+	}
+}
+
+void NewPlayerProtection::TimerProt::PushStatus()
+{
+	const auto settings = NewPlayerProtection::GetSettings();
+	const auto now_time = SteadyNow();
 
-			auto all_players_ = NewPlayerProtection::TimerProt::Get().GetAllPlayers();
+	//same reply as !npp status, one render per tribe from its aggregate however many members are online
+	const auto is_protected = [this](uint64 tribe_id)
+	{
+		const auto tribe = GetTribe(tribe_id);
+		return tribe && tribe->isProtected && !IsPVETribe(tribe_id);
+	};
 
-			//Loop through tribe
-			for (const auto& allData : all_players_)
-			{
-				if (IsAdmin(allData->steam_id))
-				{
-					continue;
-				}
+	while (!login_status_.empty() && login_status_.front().first <= now_time)
+	{
+		const auto data = FindOnlinePlayer(login_status_.front().second);
 
-				if (allData->tribe_id == tribe_id)
-				{
-					//get oldest date started
-					if (allData->startDateTime < oldestDate)
-					{
-						oldestDate = allData->startDateTime;
-					}
+		if (data && is_protected(data->tribe_id))
+		{
+			pending_notifications_.emplace_back(data->steam_id, StatusReply(data->tribe_id));
+		}
+		login_status_.pop_front();
+	}
 
-					//get highest level player
-					if (allData->level > highestLevel)
-					{
-						highestLevel = allData->level;
-					}
-				}
-			}
+	if (settings->StatusPushIntervalInMins <= 0 || now_time < next_status_push_)
+		return;
 
-			//calulate time
-			auto protectionInHours = std::chrono::hours(NewPlayerProtection::HoursOfProtection);
-			auto now = std::chrono::system_clock::now();
-			auto expireTime = now - protectionInHours;
-			auto expireTimeinMin = std::chrono::duration_cast<std::chrono::minutes>(oldestDate - expireTime);
-			auto daysLeft = expireTimeinMin / 1440;
-			auto hoursLeft = ((expireTimeinMin - (1440 * daysLeft)) / 60);
-			auto minutesLeft =  (expireTimeinMin - ((1440 * daysLeft) + (60 * hoursLeft)));
+	next_status_push_ = now_time + std::chrono::minutes(settings->StatusPushIntervalInMins);
 
-			//calculate level
-			int levelsLeft = NewPlayerProtection::MaxLevel - highestLevel;
+	std::unordered_set<uint64> tribe_ids;
 
-			//display time/level remaining message
-			ArkApi::GetApiUtils().SendNotification(player, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-				*NewPlayerProtection::NPPRemainingMessage, daysLeft.count(), hoursLeft.count(),  minutesLeft.count(), levelsLeft);
-		}
-		else//else not new player
+	for (const size_t index : online_players_)
+	{
+		tribe_ids.insert(all_players_[index].tribe_id);
+	}
+
+	size_t pushed = 0;
+
+	for (const uint64 tribe_id : tribe_ids)
+	{
+		if (is_protected(tribe_id))
 		{
-			//display not under protection message
-			ArkApi::GetApiUtils().SendNotification(player, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-				*NewPlayerProtection::NotANewPlayerMessage);
+			NotifyTribe(tribe_id, StatusReply(tribe_id));
+			++pushed;
 		}
 	}
-	else // is pve tribe
+
+	if (pushed > 0)
 	{
-		// pve status notification
-		ArkApi::GetApiUtils().SendNotification(player, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-			*NewPlayerProtection::PVEStatusMessage);
+		NPP_LOG(info, "NPP pushed the protection status to {} online tribes.", pushed);
 	}
 }
 
-inline void GetTribeID(AShooterPlayerController* player)
+//one trace per command, nullptr when the player can't aim or isn't looking at a structure
+inline APrimalStructure* GetAimedStructure(AShooterPlayerController* player)
 {
 	if (!player || !player->PlayerStateField() || ArkApi::IApiUtils::IsPlayerDead(player))
-		return;
+		return nullptr;
 
 	AActor* Actor = player->GetPlayerCharacter()->GetAimedActor(ECC_GameTraceChannel2, nullptr, 0.0, 0.0, nullptr, nullptr,
 		false, false);
 
 	if (Actor && Actor->IsA(APrimalStructure::GetPrivateStaticClass()))
 	{
-		APrimalStructure* Structure = static_cast<APrimalStructure*>(Actor);
+		return static_cast<APrimalStructure*>(Actor);
+	}
+	return nullptr;
+}
+
+inline void GetTribeID(AShooterPlayerController* player)
+{
+	if (!player || !player->PlayerStateField() || ArkApi::IApiUtils::IsPlayerDead(player))
+		return;
+
+	APrimalStructure* Structure = GetAimedStructure(player);
+
+	if (Structure)
+	{
 		const int teamId = Structure->TargetingTeamField();
-		ArkApi::GetApiUtils().SendNotification(player, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, 20.0f, nullptr,
-			*NewPlayerProtection::TribeIDText, teamId);	
+		NewPlayerProtection::SendNotification(player, NewPlayerProtection::GetSettings()->TribeIDText.Render(teamId), 20.0f);	
 	}
 	else
 	{
-		ArkApi::GetApiUtils().SendNotification(player, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-			*NewPlayerProtection::NoStructureForTribeIDText);
+		NewPlayerProtection::SendNotification(player, NewPlayerProtection::GetSettings()->NoStructureForTribeIDText.Text());
 	}
 }
 
@@ -178,1000 +227,1680 @@ inline void GetTargetPath(AShooterPlayerController* player)
 	if (!player || !player->PlayerStateField() || ArkApi::IApiUtils::IsPlayerDead(player))
 		return;
 
-	//get aimed target
-	AActor* Actor = player->GetPlayerCharacter()->GetAimedActor(ECC_GameTraceChannel2, nullptr, 0.0, 0.0, nullptr, nullptr,
-		false, false);
+	//check if target is a structure
+	APrimalStructure* Structure = GetAimedStructure(player);
 
-	//check if target is a dino or structure
-	if (Actor && Actor->IsA(APrimalStructure::GetPrivateStaticClass()))
+	if (Structure)
 	{
+		//built once per class, sent as is instead of through "{}"
+		const FString& path = NewPlayerProtection::GetCachedBlueprint(Structure);
 
-		ArkApi::GetApiUtils().SendNotification(player, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, 20.0f, nullptr,
-			"{}", NewPlayerProtection::GetBlueprint(Actor).ToString());
-		Log::GetLog()->info("Blueprint Path From Command: {}", NewPlayerProtection::GetBlueprint(Actor).ToString());
+		NewPlayerProtection::SendNotification(player, path, 20.0f);
+		NPP_LOG(info, "Blueprint Path From Command: {}", path.ToString());
 	}
-	//target not a dino or structure
+	//target not a structure
 	else
 	{
-		ArkApi::GetApiUtils().SendNotification(player, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-			*NewPlayerProtection::NotAStructureMessage);
+		NewPlayerProtection::SendNotification(player, NewPlayerProtection::GetSettings()->NotAStructureMessage.Text());
 	}
 }
 
-inline void ChatCommand(AShooterPlayerController* player, FString* message, int mode)
+//pops the next space separated token off rest without copying, empty once rest runs out
+inline std::wstring_view NextToken(std::wstring_view& rest)
 {
-	TArray<FString> parsed;
-	message->ParseIntoArray(parsed, L" ", true);
+	const size_t start = std::min(rest.find_first_not_of(L' '), rest.size());
+	const size_t end = std::min(rest.find(L' ', start), rest.size());
+	const std::wstring_view token = rest.substr(start, end - start);
+	rest.remove_prefix(end);
+	return token;
+}
 
-	if (parsed.IsValidIndex(1))
-	{
-		FString input = parsed[1];
-		if (input.Compare("info") == 0)
-		{
-			Info(player);
-		}
-		else if (input.Compare("status") == 0)
-		{
-			Status(player);
-		}
-		else if (input.Compare("disable") == 0)
+//same split as ParseIntoArray(" ", true) without the TArray, the views point into text so it has to outlive them.
+//commands have a handful of tokens, only a long space separated id list spills to the heap
+class CommandTokens
+{
+	public:
+		explicit CommandTokens(const FString& text)
 		{
-			Disable(player);
+			std::wstring_view rest(*text, text.Len());
+
+			for (std::wstring_view token = NextToken(rest); !token.empty(); token = NextToken(rest))
+			{
+				if (size_ < inline_capacity_)
+				{
+					inline_[size_] = token;
+				}
+				else
+				{
+					overflow_.push_back(token);
+				}
+				++size_;
+			}
 		}
-		else if (input.Compare("tribeid") == 0)
+
+		size_t size() const
 		{
-			GetTribeID(player);
+			return size_;
 		}
-		else if (input.Compare("path") == 0)
+
+		bool empty() const
 		{
-			GetTargetPath(player);
+			return size_ == 0;
 		}
-		else
+
+		std::wstring_view operator[](size_t i) const
 		{
-			ArkApi::GetApiUtils().SendNotification(player, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-				*NewPlayerProtection::NPPInvalidCommand);
+			return i < inline_capacity_ ? inline_[i] : overflow_[i - inline_capacity_];
 		}
-	}
-	else
-	{
-		ArkApi::GetApiUtils().SendNotification(player, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-			*NewPlayerProtection::NPPInvalidCommand);
-	}
+
+	private:
+		static constexpr size_t inline_capacity_ = 16;
+
+		std::array<std::wstring_view, inline_capacity_> inline_;
+		std::vector<std::wstring_view> overflow_;
+		size_t size_ = 0;
+};
+
+inline CommandTokens TokenizeCommand(const FString& text)
+{
+	return CommandTokens(text);
 }
 
-inline void ConsoleRemoveProtection(APlayerController* player_controller, FString* cmd, bool)
+//digits only, returns what was wrong or nullptr when value was set
+inline const char* ParseUInt(std::wstring_view token, uint64& value)
 {
-	const auto shooter_controller = static_cast<AShooterPlayerController*>(player_controller);
+	if (token.empty())
+		return "expected a number";
 
-	//if Admin
-	if (!shooter_controller || !shooter_controller->PlayerStateField() || !shooter_controller->bIsAdmin().Get())
-		return;
+	uint64 result = 0;
+
+	for (const wchar_t c : token)
+	{
+		if (c < L'0' || c > L'9')
+			return "expected a number";
+
+		if (result > (std::numeric_limits<uint64>::max() - (c - L'0')) / 10)
+			return "number is too large";
 
-	uint64 steam_id = ArkApi::IApiUtils::GetSteamIdFromController(shooter_controller);
+		result = result * 10 + (c - L'0');
+	}
 
-	bool found = false;
-	bool isProtected = false;
+	value = result;
+	return nullptr;
+}
 
-	//parse command
-	TArray<FString> parsed;
-	cmd->ParseIntoArray(parsed, L" ", true);
+//ParseUInt that logs the error for the calling command
+inline bool ParseUInt(std::wstring_view token, uint64& value, const char* function)
+{
+	const char* error = ParseUInt(token, value);
 
-	if (parsed.IsValidIndex(1))
+	if (error)
 	{
-		uint64 tribe_id = 0;
+		NPP_LOG(warn, "({} {}) Parsing error {}", __FILE__, function, error);
+		return false;
+	}
+	return true;
+}
 
-		try
-		{
-			tribe_id = std::stoull(*parsed[1]);
-		}
-		catch (const std::exception& exception)
+struct ChatSubcommand
+{
+	std::wstring_view name;
+	void (*handler)(AShooterPlayerController*);
+};
+
+inline const ChatSubcommand ChatSubcommands[] =
+{
+	{ L"info", &Info },
+	{ L"status", &Status },
+	{ L"disable", &Disable },
+	{ L"tribeid", &GetTribeID },
+	{ L"path", &GetTargetPath }
+};
+
+//collision free table over ChatSubcommands, a lookup is one hash and one compare
+struct ChatDispatchTable
+{
+	uint32 seed = 0;
+	std::vector<const ChatSubcommand*> slots;
+
+	size_t Slot(std::wstring_view name) const
+	{
+		//fnv-1a, seeded so a table size without collisions can be searched for
+		uint32 hash = seed;
+		for (const wchar_t c : name)
 		{
-			Log::GetLog()->warn("({} {}) Parsing error {}", __FILE__, __FUNCTION__, exception.what());
-			return;
+			hash ^= static_cast<uint32>(c);
+			hash *= 16777619u;
 		}
+		return hash & (slots.size() - 1);
+	}
+
+	const ChatSubcommand* Find(std::wstring_view name) const
+	{
+		if (slots.empty())
+			return nullptr;
+
+		const ChatSubcommand* subcommand = slots[Slot(name)];
+		return subcommand && subcommand->name == name ? subcommand : nullptr;
+	}
+};
 
-		auto all_players_ = NewPlayerProtection::TimerProt::Get().GetAllPlayers();
+inline ChatDispatchTable chat_dispatch_;
 
-		//look for tribe
-		for (const auto& allData : all_players_)
+inline void BuildChatDispatch()
+{
+	//smallest power of two table that has a seed putting every subcommand in its own slot
+	for (size_t size = 8;; size *= 2)
+	{
+		for (uint32 seed = 2166136261u; seed != 2166136261u + 256; ++seed)
 		{
-			if (allData->tribe_id == tribe_id)
+			chat_dispatch_.seed = seed;
+			chat_dispatch_.slots.assign(size, nullptr);
+
+			bool collision = false;
+
+			for (const auto& subcommand : ChatSubcommands)
 			{
-				found = true;
-				if (allData->isNewPlayer == 1)
+				auto& slot = chat_dispatch_.slots[chat_dispatch_.Slot(subcommand.name)];
+
+				if (slot)
 				{
-					isProtected = true;
+					collision = true;
 					break;
 				}
+				slot = &subcommand;
 			}
+
+			if (!collision)
+				return;
 		}
-		//if tribe found
-		if (found)
-		{
-			//if tribe is protected
-			if (isProtected)
-			{
-				auto online_players_ = NewPlayerProtection::TimerProt::Get().GetOnlinePlayers();
+	}
+}
 
-				//loop through tribe members
-				for (const auto& allData : all_players_)
-				{
-					//remove protection
-					if (allData->tribe_id == tribe_id)
-					{
-						allData->isNewPlayer = 0;
-					}
-				}
+inline void ChatCommand(AShooterPlayerController* player, FString* message, int mode)
+{
+	ARK_TRACE_ZONE("NPP::ChatCommand");
 
-				for (const auto& onlineData : online_players_)
-				{
-					//remove protection
-					if (onlineData->tribe_id == tribe_id)
-					{
-						onlineData->isNewPlayer = 0;
-					}
-				}
+	std::wstring_view rest(**message, message->Len());
 
-				//display protection removed message
-				ArkApi::GetApiUtils().SendNotification(shooter_controller, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-					*NewPlayerProtection::AdminTribeProtectionRemoved, tribe_id);
+	//skip the command name itself
+	NextToken(rest);
 
-				Log::GetLog()->info("Admin: {} removed NPP Protection of Tribe: {}.", steam_id, tribe_id);
-			}
-			else //tribe not protected
-			{
-				//display tribe not under protection
-				ArkApi::GetApiUtils().SendNotification(shooter_controller, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-					*NewPlayerProtection::AdminTribeNotUnderProtection, tribe_id);
-			}
-		}
-		else // tribe not found
-		{
-			//display tribe not found
-			ArkApi::GetApiUtils().SendNotification(shooter_controller, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-				*NewPlayerProtection::AdminNoTribeExistsMessage, tribe_id);
-		}
+	const ChatSubcommand* subcommand = chat_dispatch_.Find(NextToken(rest));
+
+	if (subcommand)
+	{
+		subcommand->handler(player);
+	}
+	else
+	{
+		NewPlayerProtection::SendNotification(player, NewPlayerProtection::GetSettings()->NPPInvalidCommand.Text());
 	}
 }
 
-inline void ConsoleResetProtection(APlayerController* player, FString* cmd, bool boolean)
+//parses the numeric arguments after the command name, false when any is missing or not a number
+template <size_t N>
+inline bool ParseCommandArgs(const CommandTokens& parsed, uint64 (&args)[N])
 {
-	const auto shooter_controller = static_cast<AShooterPlayerController*>(player);
-
-	//if Admin
-	if (!shooter_controller || !shooter_controller->PlayerStateField() || !shooter_controller->bIsAdmin().Get())
-		return;
+	if (parsed.size() <= N)
+		return false;
 
-	uint64 steam_id = ArkApi::IApiUtils::GetSteamIdFromController(shooter_controller);
+	for (size_t i = 0; i < N; ++i)
+	{
+		if (!ParseUInt(parsed[i + 1], args[i], __FUNCTION__))
+			return false;
+	}
+	return true;
+}
 
-	bool found = false;
-	bool underMaxLevel = true;
+template <size_t N>
+inline bool ParseCommandArgs(const FString& body, uint64 (&args)[N])
+{
+	return ParseCommandArgs(TokenizeCommand(body), args);
+}
 
-	//parse command
-	TArray<FString> parsed;
-	cmd->ParseIntoArray(parsed, L" ", true);
+//admin tribe operations, console and RCON both end up here so replies and logs are the same for either
+enum class TribeOutcome
+{
+	Changed,
+	Unchanged,
+	NotFound
+};
 
-	if (parsed.IsValidIndex(1))
-	{
-		uint64 tribe_id = 0;
+struct TribeResult
+{
+	TribeOutcome outcome;
+	FString reply;
+};
 
-		try
-		{
-			tribe_id = std::stoull(*parsed[1]);
-		}
-		catch (const std::exception& exception)
-		{
-			Log::GetLog()->warn("({} {}) Parsing error {}", __FILE__, __FUNCTION__, exception.what());
-			return;
-		}
+//by names who ran the command in the log
+inline TribeResult RemoveTribeProtection(uint64 tribe_id, const std::string& by)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	const auto settings = NewPlayerProtection::GetSettings();
 
-		auto all_players_ = NewPlayerProtection::TimerProt::Get().GetAllPlayers();
+	timer.EnsureTribeResident(tribe_id);
+	const auto tribe = timer.GetTribe(tribe_id);
 
-		//look for tribe
-		for (const auto& allData : all_players_)
-		{
-			if (allData->tribe_id == tribe_id)
-			{
+	if (!tribe)
+	{
+		return { TribeOutcome::NotFound, settings->AdminNoTribeExistsMessage.Render(tribe_id) };
+	}
 
-				if (IsAdmin(allData->steam_id))
-				{
-					continue;
-				}
+	if (!tribe->isProtected)
+	{
+		return { TribeOutcome::Unchanged, settings->AdminTribeNotUnderProtection.Render(tribe_id) };
+	}
 
-				found = true;
-				if (allData->level >= NewPlayerProtection::MaxLevel)
-				{
-					underMaxLevel = false;
-					break;
-				}
-			}
-		}
-		//if tribe found
-		if (found)
-		{
-			//if tribe is under max level
-			if (underMaxLevel)
-			{
-				auto online_players_ = NewPlayerProtection::TimerProt::Get().GetOnlinePlayers();
-				auto now = std::chrono::system_clock::now();
+	for (auto* allData : timer.GetTribeMembers(tribe_id))
+	{
+		allData->isNewPlayer = 0;
+		timer.MarkDirty(*allData);
+	}
 
-				//loop through tribe members
-				for (const auto& allData : all_players_)
-				{
-					
-					if (IsAdmin(allData->steam_id))
-					{
-						continue;
-					}
+	timer.UpdateTribe(tribe_id);
 
-					//add protection & increase start date
-					if (allData->tribe_id == tribe_id)
-					{
-						allData->isNewPlayer = 1;
-						allData->startDateTime = now;
-					}
-				}
+	NPP_LOG(info, "{} removed NPP Protection of Tribe: {}.", by, tribe_id);
+	NewPlayerProtection::AuditLog::Get().Record("protection_removed", tribe_id, by);
+	NewPlayerProtection::Replication::Get().PublishTribe(tribe_id);
+	return { TribeOutcome::Changed, settings->AdminTribeProtectionRemoved.Render(tribe_id) };
+}
 
-				for (const auto& onlineData : online_players_)
-				{
+//protects every non admin member from start, hours is only used for the reply
+inline TribeResult ProtectTribe(uint64 tribe_id, std::chrono::time_point<std::chrono::system_clock> start, int64 hours)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	const auto settings = NewPlayerProtection::GetSettings();
 
-					if (IsAdmin(onlineData->steam_id))
-					{
-						continue;
-					}
+	timer.EnsureTribeResident(tribe_id);
+	const auto tribe = timer.GetTribe(tribe_id);
 
-					//add protection & increase start date
-					if (onlineData->tribe_id == tribe_id)
-					{
-						onlineData->isNewPlayer = 1;
-						onlineData->startDateTime = now;
-					}
-				}
+	//admins only tribes have no start date
+	if (!tribe || tribe->oldestStartDateTime == std::chrono::time_point<std::chrono::system_clock>::max())
+	{
+		return { TribeOutcome::NotFound, settings->AdminNoTribeExistsMessage.Render(tribe_id) };
+	}
 
-				//display protection added message
-				ArkApi::GetApiUtils().SendNotification(shooter_controller, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-					*NewPlayerProtection::AdminResetTribeProtectionSuccess, NewPlayerProtection::HoursOfProtection, tribe_id);
+	if (tribe->maxLevel >= settings->MaxLevel)
+	{
+		return { TribeOutcome::Unchanged, settings->AdminResetTribeProtectionLvlFailure.Render(tribe_id) };
+	}
 
-				Log::GetLog()->info("Admin: {} reset the NPP Protection of Tribe: {}.", steam_id, tribe_id);
-			}
-			else //tribe not under max level
-			{
-				//display tribe under max level message
-				ArkApi::GetApiUtils().SendNotification(shooter_controller, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-					*NewPlayerProtection::AdminResetTribeProtectionLvlFailure, tribe_id);
-			}
-		}
-		else // tribe not found
+	for (auto* allData : timer.GetTribeMembers(tribe_id))
+	{
+		if (IsAdmin(*allData))
 		{
-			//display tribe not found
-			ArkApi::GetApiUtils().SendNotification(shooter_controller, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-				*NewPlayerProtection::AdminNoTribeExistsMessage, tribe_id);
+			continue;
 		}
+
+		allData->isNewPlayer = 1;
+		allData->SetStartDateTime(start);
+		timer.MarkDirty(*allData);
 	}
+
+	timer.ScheduleTribeExpiry(tribe_id);
+	timer.UpdateTribe(tribe_id);
+
+	return { TribeOutcome::Changed, settings->AdminResetTribeProtectionSuccess.Render(hours, tribe_id) };
 }
 
-inline void ConsoleAddProtection(APlayerController* player, FString* cmd, bool boolean)
+inline TribeResult ResetTribeProtection(uint64 tribe_id, const std::string& by)
 {
-	const auto shooter_controller = static_cast<AShooterPlayerController*>(player);
+	const int64 hours = NewPlayerProtection::GetSettings()->HoursOfProtection;
+	TribeResult result = ProtectTribe(tribe_id, NewPlayerProtection::TimerProt::Get().Now(), hours);
 
-	//if Admin
-	if (!shooter_controller || !shooter_controller->PlayerStateField() || !shooter_controller->bIsAdmin().Get())
-		return;
+	if (result.outcome == TribeOutcome::Changed)
+	{
+		NPP_LOG(info, "{} reset the NPP Protection of Tribe: {}.", by, tribe_id);
+		NewPlayerProtection::AuditLog::Get().Record("protection_reset", tribe_id, by, hours);
+		NewPlayerProtection::Replication::Get().PublishTribe(tribe_id);
+	}
+	return result;
+}
 
-	uint64 steam_id = ArkApi::IApiUtils::GetSteamIdFromController(shooter_controller);
+inline TribeResult AddTribeProtection(uint64 tribe_id, int64 hours, const std::string& by)
+{
+	//start date that leaves exactly hours of protection
+	const auto start = NewPlayerProtection::TimerProt::Get().Now() + std::chrono::hours(hours - NewPlayerProtection::GetSettings()->HoursOfProtection);
+	TribeResult result = ProtectTribe(tribe_id, start, hours);
 
+	if (result.outcome == TribeOutcome::Changed)
+	{
+		NPP_LOG(info, "{} added {} hours of NPP Protection to Tribe: {}.", by, hours, tribe_id);
+		NewPlayerProtection::AuditLog::Get().Record("protection_added", tribe_id, by, hours);
+		NewPlayerProtection::Replication::Get().PublishTribe(tribe_id);
+	}
+	return result;
+}
 
-	bool found = false;
-	bool underMaxLevel = true;
+inline TribeResult SetTribePVE(uint64 tribe_id, bool setToPve, const std::string& by)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	const auto settings = NewPlayerProtection::GetSettings();
 
-	//parse command
-	TArray<FString> parsed;
-	cmd->ParseIntoArray(parsed, L" ", true);
+	timer.EnsureTribeResident(tribe_id);
+	const auto tribe = timer.GetTribe(tribe_id);
+	const bool isPve = NewPlayerProtection::pveTribesList.count(tribe_id) > 0;
 
-	if (parsed.IsValidIndex(1) && parsed.IsValidIndex(2))
+	//PVE status can still be changed once the last player has left the tribe
+	if ((!tribe || tribe->oldestStartDateTime == std::chrono::time_point<std::chrono::system_clock>::max())
+		&& !isPve && NewPlayerProtection::removedPveTribesList.count(tribe_id) == 0)
 	{
-		uint64 tribe_id = 0;
-		uint64 hours = 0;
-
-		try
-		{
-			tribe_id = std::stoull(*parsed[1]);
-			hours = std::stoull(*parsed[2]);
-			if (hours < 0)
-			{
-				Log::GetLog()->warn("({} {}) Parsing error: Hours cannot be negative.", __FILE__, __FUNCTION__);
-				return;
-			}
-		}
-		catch (const std::exception& exception)
-		{
-			Log::GetLog()->warn("({} {}) Parsing error {}", __FILE__, __FUNCTION__, exception.what());
-			return;
-		}
+		return { TribeOutcome::NotFound, settings->AdminNoTribeExistsMessage.Render(tribe_id) };
+	}
 
-		auto all_players_ = NewPlayerProtection::TimerProt::Get().GetAllPlayers();
+	if (setToPve == isPve)
+	{
+		return { TribeOutcome::Unchanged, setToPve ? settings->AdminPVETribeAlreadyAddedMessage.Render(tribe_id) : settings->AdminPVETribeAlreadyRemovedMessage.Render(tribe_id) };
+	}
 
-		//look for tribe
-		for (const auto& allData : all_players_)
-		{
-			if (allData->tribe_id == tribe_id)
-			{
+	if (setToPve)
+	{
+		NewPlayerProtection::pveTribesList.insert(tribe_id);
+		NewPlayerProtection::removedPveTribesList.erase(tribe_id);
+	}
+	else
+	{
+		NewPlayerProtection::pveTribesList.erase(tribe_id);
+		NewPlayerProtection::removedPveTribesList.insert(tribe_id);
+	}
 
-				if (IsAdmin(allData->steam_id))
-				{
-					continue;
-				}
+	NewPlayerProtection::MarkPveDirty(tribe_id);
+	timer.UpdateTribe(tribe_id);
 
-				found = true;
-				if (allData->level >= NewPlayerProtection::MaxLevel)
-				{
-					underMaxLevel = false;
-					break;
-				}
+	NPP_LOG(info, "{} {} PVE status of Tribe: {}.", by, setToPve ? "enabled" : "disabled", tribe_id);
+	NewPlayerProtection::AuditLog::Get().Record(setToPve ? "pve_enabled" : "pve_disabled", tribe_id, by);
+	NewPlayerProtection::Replication::Get().PublishTribe(tribe_id);
+	return { TribeOutcome::Changed, setToPve ? settings->AdminPVETribeAddedSuccessMessage.Render(tribe_id) : settings->AdminPVETribeRemovedSuccessMessage.Render(tribe_id) };
+}
+
+//command body -> reply, empty when the arguments did not parse
+using TribeCommand = FString(*)(const FString& body, const std::string& by);
+
+//same, but the reply may come on a later tick once the database was read off the game thread. called exactly once,
+//with an empty reply when the arguments did not parse
+using CommandReply = std::function<void(const FString& reply)>;
+using AsyncTribeCommand = void(*)(const FString& body, const std::string& by, const CommandReply& reply);
+
+namespace NewPlayerProtection
+{
+	//NPP.RemoveProtection, NPP.ResetProtection, NPP.AddProtection and NPP.SetPVE are queued and applied together once a second,
+	//at most AdminCommandsPerSec of them. the same command queued again for a tribe before it ran, a bot retrying during lag,
+	//is applied once and every caller gets its reply. the tribes that are not resident are read for the whole batch in one
+	//transaction, and the changes go to the next save together like any others
+	class AdminCommandQueue
+	{
+		public:
+			enum class Op
+			{
+				RemoveProtection,
+				ResetProtection,
+				AddProtection,
+				SetPve
+			};
+
+			static AdminCommandQueue& Get();
+
+			AdminCommandQueue(const AdminCommandQueue&) = delete;
+			AdminCommandQueue(AdminCommandQueue&&) = delete;
+			AdminCommandQueue& operator=(const AdminCommandQueue&) = delete;
+			AdminCommandQueue& operator=(AdminCommandQueue&&) = delete;
+
+			void Start();
+			//applies what is still queued right away, so none of it misses the last save
+			void Stop();
+
+			//game thread, arg is the hours of AddProtection and 1 or 0 for SetPve
+			void Push(Op op, uint64 tribe_id, int64 arg, const std::string& by, const CommandReply& reply);
+
+		private:
+			AdminCommandQueue() = default;
+			~AdminCommandQueue() = default;
+
+			struct Pending
+			{
+				Op op;
+				uint64 tribe_id;
+				int64 arg;
+				std::string by;
+				std::vector<CommandReply> replies;
+			};
+
+			//game thread, once a second
+			void Tick();
+			static TribeResult Apply(const Pending& pending);
+			static void Finish(const std::vector<Pending>& batch);
+
+			std::deque<Pending> queue_;
+			//push sequence of the newest queued command per tribe, only that one may absorb another
+			std::unordered_map<uint64, uint64> newest_;
+			//sequence of queue_.front()
+			uint64 front_sequence_ = 0;
+			//waiting for its tribes to be read in
+			std::vector<Pending> batch_;
+			size_t coalesced_ = 0;
+			bool running_ = false;
+			bool in_flight_ = false;
+	};
+}
+
+NewPlayerProtection::AdminCommandQueue& NewPlayerProtection::AdminCommandQueue::Get()
+{
+	static AdminCommandQueue instance;
+	return instance;
+}
+
+void NewPlayerProtection::AdminCommandQueue::Start()
+{
+	if (running_)
+		return;
+
+	running_ = true;
+	ArkApi::GetCommands().AddOnTimerCallback("NPPAdminQueue", std::bind(&NewPlayerProtection::AdminCommandQueue::Tick, this));
+}
+
+void NewPlayerProtection::AdminCommandQueue::Stop()
+{
+	if (!running_)
+		return;
+
+	running_ = false;
+	ArkApi::GetCommands().RemoveOnTimerCallback("NPPAdminQueue");
+
+	//Apply reads a tribe that is not resident on the game thread, the task thread is about to stop.
+	//a batch still being read in came first
+	std::vector<Pending> rest = std::move(batch_);
+	rest.insert(rest.end(), std::make_move_iterator(queue_.begin()), std::make_move_iterator(queue_.end()));
+
+	queue_.clear();
+	newest_.clear();
+	batch_.clear();
+	in_flight_ = false;
+
+	Finish(rest);
+}
+
+void NewPlayerProtection::AdminCommandQueue::Push(Op op, uint64 tribe_id, int64 arg, const std::string& by, const CommandReply& reply)
+{
+	//off, or not yet started, the command runs as soon as its tribe is resident
+	if (!running_ || NewPlayerProtection::GetSettings()->AdminCommandsPerSec <= 0)
+	{
+		WithResidentTribe(tribe_id, [pending = Pending{ op, tribe_id, arg, by, { reply } }]()
+		{
+			Finish({ pending });
+		});
+		return;
+	}
+
+	const auto newest = newest_.find(tribe_id);
+
+	if (newest != newest_.end())
+	{
+		auto& last = queue_[static_cast<size_t>(newest->second - front_sequence_)];
+
+		if (last.op == op && last.arg == arg && last.by == by)
+		{
+			last.replies.push_back(reply);
+			++coalesced_;
+			return;
+		}
+	}
+
+	newest_[tribe_id] = front_sequence_ + queue_.size();
+	queue_.push_back({ op, tribe_id, arg, by, { reply } });
+}
+
+void NewPlayerProtection::AdminCommandQueue::Tick()
+{
+	//commands on the same tribe stay in order, so one batch at a time
+	if (in_flight_ || queue_.empty())
+		return;
+
+	const size_t count = std::min(queue_.size(), static_cast<size_t>(std::max(1, NewPlayerProtection::GetSettings()->AdminCommandsPerSec)));
+	std::vector<uint64> tribe_ids;
+
+	tribe_ids.reserve(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		Pending& pending = queue_.front();
+		const auto newest = newest_.find(pending.tribe_id);
+
+		if (newest != newest_.end() && newest->second == front_sequence_)
+		{
+			newest_.erase(newest);
+		}
+
+		tribe_ids.push_back(pending.tribe_id);
+		batch_.push_back(std::move(pending));
+		queue_.pop_front();
+		++front_sequence_;
+	}
+
+	if (coalesced_ > 0)
+	{
+		NPP_LOG(info, "NPP admin queue merged {} repeated commands.", coalesced_);
+		coalesced_ = 0;
+	}
+
+	std::sort(tribe_ids.begin(), tribe_ids.end());
+	tribe_ids.erase(std::unique(tribe_ids.begin(), tribe_ids.end()), tribe_ids.end());
+
+	in_flight_ = true;
+
+	WithResidentTribes(tribe_ids, []()
+	{
+		auto& queue = NewPlayerProtection::AdminCommandQueue::Get();
+
+		//Stop applied the batch already
+		if (!queue.in_flight_)
+			return;
+
+		const std::vector<Pending> batch = std::move(queue.batch_);
+		queue.batch_.clear();
+		queue.in_flight_ = false;
+
+		Finish(batch);
+	});
+}
+
+TribeResult NewPlayerProtection::AdminCommandQueue::Apply(const Pending& pending)
+{
+	switch (pending.op)
+	{
+		case Op::RemoveProtection: return RemoveTribeProtection(pending.tribe_id, pending.by);
+		case Op::ResetProtection: return ResetTribeProtection(pending.tribe_id, pending.by);
+		case Op::AddProtection: return AddTribeProtection(pending.tribe_id, pending.arg, pending.by);
+		case Op::SetPve: break;
+	}
+	return SetTribePVE(pending.tribe_id, pending.arg == 1, pending.by);
+}
+
+void NewPlayerProtection::AdminCommandQueue::Finish(const std::vector<Pending>& batch)
+{
+	for (const auto& pending : batch)
+	{
+		const FString reply = Apply(pending).reply;
+
+		for (const auto& send : pending.replies)
+		{
+			send(reply);
+		}
+	}
+}
+
+inline void RemoveProtectionCommand(const FString& body, const std::string& by, const CommandReply& reply)
+{
+	uint64 args[1];
+
+	if (!ParseCommandArgs(body, args))
+		return reply(FString());
+
+	NewPlayerProtection::AdminCommandQueue::Get().Push(NewPlayerProtection::AdminCommandQueue::Op::RemoveProtection, args[0], 0, by, reply);
+}
+
+inline void ResetProtectionCommand(const FString& body, const std::string& by, const CommandReply& reply)
+{
+	uint64 args[1];
+
+	if (!ParseCommandArgs(body, args))
+		return reply(FString());
+
+	NewPlayerProtection::AdminCommandQueue::Get().Push(NewPlayerProtection::AdminCommandQueue::Op::ResetProtection, args[0], 0, by, reply);
+}
+
+inline void AddProtectionCommand(const FString& body, const std::string& by, const CommandReply& reply)
+{
+	uint64 args[2];
+
+	if (!ParseCommandArgs(body, args))
+		return reply(FString());
+
+	NewPlayerProtection::AdminCommandQueue::Get().Push(NewPlayerProtection::AdminCommandQueue::Op::AddProtection, args[0], static_cast<int64>(args[1]), by, reply);
+}
+
+//false for anything but 0 or 1
+inline bool ParsePVEArg(uint64 value)
+{
+	if (value > 1)
+	{
+		NPP_LOG(warn, "({} {}) Parsing error: setToPve can only be a 1 or 0.", __FILE__, __FUNCTION__);
+		return false;
+	}
+	return true;
+}
+
+inline void SetPVECommand(const FString& body, const std::string& by, const CommandReply& reply)
+{
+	uint64 args[2];
+
+	if (!ParseCommandArgs(body, args) || !ParsePVEArg(args[1]))
+		return reply(FString());
+
+	NewPlayerProtection::AdminCommandQueue::Get().Push(NewPlayerProtection::AdminCommandQueue::Op::SetPve, args[0], static_cast<int64>(args[1]), by, reply);
+}
+
+//bulk targets from parsed[first] on: tribe ids separated by spaces or commas, and the filters maxlevel:N (highest level below N)
+//and since:YYYY-MM-DD (oldest member started on or after that day). Filters are combined, resident tribes are matched in memory
+//and the rest from the Tribes table as of the last save.
+struct TribeTargets
+{
+	std::vector<uint64> tribe_ids;
+	std::unordered_set<uint64> seen;
+	bool has_filter = false;
+	int max_level = std::numeric_limits<int>::max();
+	int64 since_ms = 0;
+};
+
+inline bool ParseTribeTargets(const CommandTokens& parsed, size_t first, TribeTargets& targets)
+{
+	for (size_t i = first; i < parsed.size(); ++i)
+	{
+		const std::wstring_view token = parsed[i];
+
+		if (token.substr(0, 9) == L"maxlevel:")
+		{
+			uint64 level = 0;
+
+			if (!ParseUInt(token.substr(9), level, __FUNCTION__))
+				return false;
+
+			targets.max_level = static_cast<int>(std::min<uint64>(level, std::numeric_limits<int>::max()));
+			targets.has_filter = true;
+		}
+		else if (token.substr(0, 6) == L"since:")
+		{
+			//views are not null terminated, swscanf needs its own copy
+			const std::wstring date_text(token.substr(6));
+			int yyyy, mm, dd;
+
+			if (swscanf(date_text.c_str(), L"%4d-%2d-%2d", &yyyy, &mm, &dd) != 3)
+			{
+				NPP_LOG(warn, "({} {}) Parsing error since: expects YYYY-MM-DD", __FILE__, __FUNCTION__);
+				return false;
 			}
+
+			const std::string date(date_text.begin(), date_text.end());
+			targets.since_ms = NewPlayerProtection::ToEpochMs(NewPlayerProtection::GetDateTime(date + " 00:00:00.000"));
+			targets.has_filter = true;
 		}
-		//if tribe found
-		if (found)
+		else
 		{
-			//if tribe is under max level
-			if (underMaxLevel)
+			for (size_t start = 0; start < token.size();)
 			{
-				auto online_players_ = NewPlayerProtection::TimerProt::Get().GetOnlinePlayers();
-				auto now = std::chrono::system_clock::now();
+				const size_t end = std::min(token.find(L',', start), token.size());
 
-				//loop through tribe members
-				for (const auto& allData : all_players_)
+				if (end > start)
 				{
-					
-					if (IsAdmin(allData->steam_id))
-					{
-						continue;
-					}
+					uint64 tribe_id = 0;
 
-					//add protection & increase start date
-					if (allData->tribe_id == tribe_id)
+					if (!ParseUInt(token.substr(start, end - start), tribe_id, __FUNCTION__))
+						return false;
+
+					if (targets.seen.insert(tribe_id).second)
 					{
-						allData->isNewPlayer = 1;
-						allData->startDateTime = now += std::chrono::hours(hours - NewPlayerProtection::HoursOfProtection);
+						targets.tribe_ids.push_back(tribe_id);
 					}
 				}
+				start = end + 1;
+			}
+		}
+	}
 
-				for (const auto& onlineData : online_players_)
-				{
+	if (!targets.has_filter && targets.tribe_ids.empty())
+	{
+		NPP_LOG(warn, "({} {}) Parsing error: no tribe ids or filters given.", __FILE__, __FUNCTION__);
+		return false;
+	}
+	return true;
+}
 
-					if (IsAdmin(onlineData->steam_id))
-					{
-						continue;
-					}
+inline void MatchResidentTribeTargets(TribeTargets& targets)
+{
+	for (const auto& tribe : NewPlayerProtection::TimerProt::Get().tribes_)
+	{
+		//admins only tribes have no start date and never match
+		const auto& data = tribe.second;
 
-					//add protection & increase start date
-					if (onlineData->tribe_id == tribe_id)
-					{
-						onlineData->isNewPlayer = 1;
-						onlineData->startDateTime = now += std::chrono::hours(hours - NewPlayerProtection::HoursOfProtection);
-					}
-				}
+		if (data.oldestStartDateTime != std::chrono::time_point<std::chrono::system_clock>::max() && data.maxLevel < targets.max_level
+			&& NewPlayerProtection::ToEpochMs(data.oldestStartDateTime) >= targets.since_ms && targets.seen.insert(tribe.first).second)
+		{
+			targets.tribe_ids.push_back(tribe.first);
+		}
+	}
+}
 
-				//display protection added message
-				ArkApi::GetApiUtils().SendNotification(shooter_controller, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-					*NewPlayerProtection::AdminResetTribeProtectionSuccess, hours, tribe_id);
+//any thread, the stored tribes matching the filters. throws on DB errors
+inline std::vector<uint64> SelectStoredTribeTargets(sqlite::database& db, int max_level, int64 since_ms)
+{
+	std::vector<uint64> tribe_ids;
 
-				Log::GetLog()->info("Admin: {} added {} hours of NPP Protection to Tribe: {}.", steam_id, hours, tribe_id);
-			}
-			else //tribe not under max level
+	db << "SELECT TribeId FROM Tribes WHERE Max_Level < ? AND Oldest_Start_DateTime >= ? AND Oldest_Start_DateTime > 0;"
+		<< max_level << since_ms
+		>> [&tribe_ids](uint64 tribe_id)
+	{
+		tribe_ids.push_back(tribe_id);
+	};
+	return tribe_ids;
+}
+
+//stored rows of resident tribes are older than memory, those were matched already
+inline void AddStoredTribeTargets(TribeTargets& targets, const std::vector<uint64>& stored)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+
+	for (const uint64 tribe_id : stored)
+	{
+		if (!timer.GetTribe(tribe_id) && targets.seen.insert(tribe_id).second)
+		{
+			targets.tribe_ids.push_back(tribe_id);
+		}
+	}
+}
+
+//on the game thread, for callers that cannot wait a tick
+inline bool ResolveTribeTargets(const CommandTokens& parsed, size_t first, std::vector<uint64>& tribe_ids)
+{
+	TribeTargets targets;
+
+	if (!ParseTribeTargets(parsed, first, targets))
+		return false;
+
+	try
+	{
+		if (targets.has_filter)
+		{
+			MatchResidentTribeTargets(targets);
+			AddStoredTribeTargets(targets, SelectStoredTribeTargets(NewPlayerProtection::GetDB(), targets.max_level, targets.since_ms));
+		}
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+		return false;
+	}
+
+	tribe_ids = std::move(targets.tribe_ids);
+	return true;
+}
+
+//same with the Tribes table read on the task thread, then(tribe_ids) on the game thread. tribe_ids is empty when the
+//arguments did not parse or the read failed. the tokens are only used before this returns
+template <typename Then>
+void ResolveTribeTargetsAsync(const CommandTokens& parsed, size_t first, Then&& then)
+{
+	TribeTargets targets;
+
+	if (!ParseTribeTargets(parsed, first, targets))
+		return then(std::optional<std::vector<uint64>>());
+
+	if (!targets.has_filter)
+		return then(std::make_optional(std::move(targets.tribe_ids)));
+
+	const int max_level = targets.max_level;
+	const int64 since_ms = targets.since_ms;
+
+	NewPlayerProtection::GameTasks::Get().Query<std::optional<std::vector<uint64>>>([max_level, since_ms](sqlite::database& db)
+	{
+		return std::make_optional(SelectStoredTribeTargets(db, max_level, since_ms));
+	},
+	[targets = std::move(targets), then = std::forward<Then>(then)](const std::optional<std::vector<uint64>>& stored)
+	{
+		if (!stored)
+			return then(std::optional<std::vector<uint64>>());
+
+		//memory is matched once the stored rows are back, tribes read in meanwhile are then matched from memory
+		TribeTargets matched = targets;
+		MatchResidentTribeTargets(matched);
+		AddStoredTribeTargets(matched, *stored);
+		then(std::make_optional(std::move(matched.tribe_ids)));
+	});
+}
+
+//runs op for every target once they are all resident, those that are not are read in together on the task thread
+template <typename Op>
+inline void RunBulkTribeCommand(const char* name, const FString& body, size_t first, const CommandReply& reply, Op&& op)
+{
+	ResolveTribeTargetsAsync(TokenizeCommand(body), first, [name, reply, op = std::forward<Op>(op)](const std::optional<std::vector<uint64>>& tribe_ids)
+	{
+		if (!tribe_ids)
+			return reply(FString());
+
+		WithResidentTribes(*tribe_ids, [name, reply, op, tribe_ids = *tribe_ids]()
+		{
+			size_t changed = 0;
+			size_t unchanged = 0;
+			size_t not_found = 0;
+
+			for (const uint64 tribe_id : tribe_ids)
 			{
-				//display tribe under max level message
-				ArkApi::GetApiUtils().SendNotification(shooter_controller, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-					*NewPlayerProtection::AdminResetTribeProtectionLvlFailure, tribe_id);
+				switch (op(tribe_id).outcome)
+				{
+					case TribeOutcome::Changed: ++changed; break;
+					case TribeOutcome::Unchanged: ++unchanged; break;
+					case TribeOutcome::NotFound: ++not_found; break;
+				}
 			}
+
+			NPP_LOG(info, "Bulk {}: {} tribes changed, {} unchanged, {} not found.", name, changed, unchanged, not_found);
+			reply(NewPlayerProtection::GetSettings()->AdminBulkSummaryMessage.Render(name, changed, unchanged, not_found));
+		});
+	});
+}
+
+inline void BulkRemoveProtectionCommand(const FString& body, const std::string& by, const CommandReply& reply)
+{
+	RunBulkTribeCommand("RemoveProtection", body, 1, reply, [by](uint64 tribe_id) { return RemoveTribeProtection(tribe_id, by); });
+}
+
+inline void BulkResetProtectionCommand(const FString& body, const std::string& by, const CommandReply& reply)
+{
+	RunBulkTribeCommand("ResetProtection", body, 1, reply, [by](uint64 tribe_id) { return ResetTribeProtection(tribe_id, by); });
+}
+
+inline void BulkAddProtectionCommand(const FString& body, const std::string& by, const CommandReply& reply)
+{
+	uint64 args[1];
+
+	if (!ParseCommandArgs(body, args))
+		return reply(FString());
+
+	const int64 hours = static_cast<int64>(args[0]);
+	RunBulkTribeCommand("AddProtection", body, 2, reply, [by, hours](uint64 tribe_id) { return AddTribeProtection(tribe_id, hours, by); });
+}
+
+inline void BulkSetPVECommand(const FString& body, const std::string& by, const CommandReply& reply)
+{
+	uint64 args[1];
+
+	if (!ParseCommandArgs(body, args) || !ParsePVEArg(args[0]))
+		return reply(FString());
+
+	const bool setToPve = args[0] == 1;
+	RunBulkTribeCommand("SetPVE", body, 2, reply, [by, setToPve](uint64 tribe_id) { return SetTribePVE(tribe_id, setToPve, by); });
+}
+
+inline void RunConsoleTribeCommand(APlayerController* player_controller, const FString& cmd, TribeCommand command)
+{
+	ARK_TRACE_ZONE("NPP::ConsoleCommand");
+	NewPlayerProtection::ScopedLatency latency(NewPlayerProtection::Stat::Command);
+
+	const auto shooter_controller = static_cast<AShooterPlayerController*>(player_controller);
+
+	//if Admin
+	if (!shooter_controller || !shooter_controller->PlayerStateField() || !shooter_controller->bIsAdmin().Get())
+		return;
+
+	const FString reply = command(cmd, "Admin: " + std::to_string(ArkApi::IApiUtils::GetSteamIdFromController(shooter_controller)));
+
+	if (!reply.IsEmpty())
+	{
+		NewPlayerProtection::SendNotification(shooter_controller, reply);
+	}
+}
+
+inline void RunRconTribeCommand(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, TribeCommand command)
+{
+	ARK_TRACE_ZONE("NPP::RconCommand");
+	NewPlayerProtection::ScopedLatency latency(NewPlayerProtection::Stat::Command);
+
+	FString reply = command(rcon_packet->Body, "RCON");
+
+	if (!reply.IsEmpty())
+	{
+		rcon_connection->SendMessageW(rcon_packet->Id, 0, &reply);
+	}
+}
+
+//the admin may have left by the time the reply is ready
+inline void RunConsoleAsyncTribeCommand(APlayerController* player_controller, const FString& cmd, AsyncTribeCommand command)
+{
+	ARK_TRACE_ZONE("NPP::ConsoleCommand");
+	NewPlayerProtection::ScopedLatency latency(NewPlayerProtection::Stat::Command);
+
+	const auto shooter_controller = static_cast<AShooterPlayerController*>(player_controller);
+
+	//if Admin
+	if (!shooter_controller || !shooter_controller->PlayerStateField() || !shooter_controller->bIsAdmin().Get())
+		return;
+
+	const uint64 steam_id = ArkApi::IApiUtils::GetSteamIdFromController(shooter_controller);
+
+	command(cmd, "Admin: " + std::to_string(steam_id), [steam_id](const FString& reply)
+	{
+		AShooterPlayerController* admin = ArkApi::GetApiUtils().FindPlayerFromSteamId(steam_id);
+
+		if (admin && !reply.IsEmpty())
+		{
+			NewPlayerProtection::SendNotification(admin, reply);
 		}
-		else // tribe not found
+	});
+}
+
+//a reply for a closed connection is dropped
+inline void RunRconAsyncTribeCommand(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, AsyncTribeCommand command)
+{
+	ARK_TRACE_ZONE("NPP::RconCommand");
+	NewPlayerProtection::ScopedLatency latency(NewPlayerProtection::Stat::Command);
+
+	const int packet_id = rcon_packet->Id;
+
+	command(rcon_packet->Body, "RCON", [rcon_connection, packet_id](const FString& reply)
+	{
+		if (!reply.IsEmpty() && !rcon_connection->IsClosedField())
 		{
-			//display tribe not found
-			ArkApi::GetApiUtils().SendNotification(shooter_controller, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-				*NewPlayerProtection::AdminNoTribeExistsMessage, tribe_id);
+			FString message = reply;
+			rcon_connection->SendMessageW(packet_id, 0, &message);
 		}
-	}
+	});
+}
+
+inline void ConsoleRemoveProtection(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleAsyncTribeCommand(player_controller, *cmd, &RemoveProtectionCommand);
+}
+
+inline void ConsoleResetProtection(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleAsyncTribeCommand(player_controller, *cmd, &ResetProtectionCommand);
+}
+
+inline void ConsoleAddProtection(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleAsyncTribeCommand(player_controller, *cmd, &AddProtectionCommand);
+}
+
+inline void ConsoleSetPVE(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleAsyncTribeCommand(player_controller, *cmd, &SetPVECommand);
 }
 
 inline void RconRemoveProtection(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
 {
-	FString reply;
+	RunRconAsyncTribeCommand(rcon_connection, rcon_packet, &RemoveProtectionCommand);
+}
+
+inline void RconResetProtection(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconAsyncTribeCommand(rcon_connection, rcon_packet, &ResetProtectionCommand);
+}
+
+inline void RconAddProtection(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconAsyncTribeCommand(rcon_connection, rcon_packet, &AddProtectionCommand);
+}
+
+inline void RconSetPVE(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconAsyncTribeCommand(rcon_connection, rcon_packet, &SetPVECommand);
+}
+
+inline void ConsoleBulkRemoveProtection(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleAsyncTribeCommand(player_controller, *cmd, &BulkRemoveProtectionCommand);
+}
+
+inline void ConsoleBulkResetProtection(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleAsyncTribeCommand(player_controller, *cmd, &BulkResetProtectionCommand);
+}
+
+inline void ConsoleBulkAddProtection(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleAsyncTribeCommand(player_controller, *cmd, &BulkAddProtectionCommand);
+}
+
+inline void ConsoleBulkSetPVE(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleAsyncTribeCommand(player_controller, *cmd, &BulkSetPVECommand);
+}
+
+inline void RconBulkRemoveProtection(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconAsyncTribeCommand(rcon_connection, rcon_packet, &BulkRemoveProtectionCommand);
+}
+
+inline void RconBulkResetProtection(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconAsyncTribeCommand(rcon_connection, rcon_packet, &BulkResetProtectionCommand);
+}
+
+inline void RconBulkAddProtection(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconAsyncTribeCommand(rcon_connection, rcon_packet, &BulkAddProtectionCommand);
+}
+
+inline void RconBulkSetPVE(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconAsyncTribeCommand(rcon_connection, rcon_packet, &BulkSetPVECommand);
+}
 
-	bool found = false;
-	bool isProtected = false;
+//rows per reply, keeps a page well under the 4096 byte RCON packet limit
+constexpr size_t QueryPageSize = 50;
 
-	//parse command
-	TArray<FString> parsed;
-	rcon_packet->Body.ParseIntoArray(parsed, L" ", true);
+//"NPP.Query [page:N] [tribe ids]", all protected tribes when no ids are given
+//replies with a "page,pages,tribes" header line and one "tribe_id,protected,remaining_hours,max_level,pve" line per tribe, ordered by id
+inline FString QueryReply(std::vector<uint64> tribe_ids, size_t page)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
 
-	if (parsed.IsValidIndex(1))
+	std::sort(tribe_ids.begin(), tribe_ids.end());
+
+	const size_t pages = std::max<size_t>(1, (tribe_ids.size() + QueryPageSize - 1) / QueryPageSize);
+	const size_t first = std::min((page - 1) * QueryPageSize, tribe_ids.size());
+	const size_t last = std::min(first + QueryPageSize, tribe_ids.size());
+
+	const auto now = timer.Now();
+	const auto protection = std::chrono::hours(NewPlayerProtection::GetSettings()->HoursOfProtection);
+
+	std::string reply = std::to_string(page) + "," + std::to_string(pages) + "," + std::to_string(tribe_ids.size());
+
+	for (size_t i = first; i < last; ++i)
 	{
-		uint64 tribe_id = 0;
+		const uint64 tribe_id = tribe_ids[i];
+		const auto tribe = timer.GetTribe(tribe_id);
+
+		int64 remaining_hours = 0;
 
-		try
+		if (tribe && tribe->isProtected)
 		{
-			tribe_id = std::stoull(*parsed[1]);
+			remaining_hours = std::max<int64>(0, std::chrono::duration_cast<std::chrono::hours>(tribe->oldestStartDateTime + protection - now).count());
 		}
-		catch (const std::exception& exception)
+
+		reply += "\n" + std::to_string(tribe_id)
+			+ "," + std::to_string(tribe && tribe->isProtected ? 1 : 0)
+			+ "," + std::to_string(remaining_hours)
+			+ "," + std::to_string(tribe ? tribe->maxLevel : 0)
+			+ "," + std::to_string(IsPVETribe(tribe_id) ? 1 : 0);
+	}
+
+	return NewPlayerProtection::ToFString(reply);
+}
+
+inline void QueryCommand(const FString& body, const std::string&, const CommandReply& reply)
+{
+	const auto parsed = TokenizeCommand(body);
+
+	size_t page = 1;
+	size_t first_target = 1;
+
+	if (parsed.size() > 1 && parsed[1].substr(0, 5) == L"page:")
+	{
+		uint64 value = 0;
+
+		if (!ParseUInt(parsed[1].substr(5), value, __FUNCTION__))
+			return reply(FString());
+
+		page = std::max<size_t>(1, static_cast<size_t>(value));
+		first_target = 2;
+	}
+
+	if (parsed.size() > first_target)
+	{
+		//named tribes are read in once, later polls are served from memory
+		ResolveTribeTargetsAsync(parsed, first_target, [page, reply](const std::optional<std::vector<uint64>>& tribe_ids)
 		{
-			Log::GetLog()->warn("({} {}) Parsing error {}", __FILE__, __FUNCTION__, exception.what());
-			return;
+			if (!tribe_ids)
+				return reply(FString());
+
+			WithResidentTribes(*tribe_ids, [page, reply, tribe_ids = *tribe_ids]() { reply(QueryReply(tribe_ids, page)); });
+		});
+		return;
+	}
+
+	std::vector<uint64> tribe_ids;
+
+	for (const auto& tribe : NewPlayerProtection::TimerProt::Get().tribes_)
+	{
+		if (tribe.second.isProtected)
+		{
+			tribe_ids.push_back(tribe.first);
 		}
+	}
+
+	reply(QueryReply(std::move(tribe_ids), page));
+}
+
+inline void RconQuery(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconAsyncTribeCommand(rcon_connection, rcon_packet, &QueryCommand);
+}
+
+//"NPP.Stats [reset|baseline]", one "name,calls,p50_ns,p99_ns,max_ns" line per instrumented path since load or the last reset,
+//followed by the work the tick budget deferred, the resident memory of the player table and the 10 most attacked and attacking tribes.
+//baseline saves the histograms to StatsBaseline.json, while there is one every reply compares p50 and p99 of each path to it
+inline FString StatsCommand(const FString& body, const std::string& by)
+{
+	const auto parsed = TokenizeCommand(body);
+	const bool reset = parsed.size() > 1 && parsed[1] == L"reset";
 
-		auto all_players_ = NewPlayerProtection::TimerProt::Get().GetAllPlayers();
+	if (parsed.size() > 1 && parsed[1] == L"baseline")
+	{
+		nlohmann::json baseline;
+		baseline["version"] = 1;
+		baseline["timestamp_ms"] = NewPlayerProtection::ToEpochMs(std::chrono::system_clock::now());
 
-		//look for tribe
-		for (const auto& allData : all_players_)
+		for (size_t i = 0; i < static_cast<size_t>(NewPlayerProtection::Stat::Count); ++i)
 		{
-			if (allData->tribe_id == tribe_id)
-			{
-				found = true;
-				if (allData->isNewPlayer == 1)
-				{
-					isProtected = true;
-					break;
-				}
-			}
+			baseline["stats"][NewPlayerProtection::StatNames[i]] = NewPlayerProtection::GetStat(static_cast<NewPlayerProtection::Stat>(i)).ToJson();
 		}
-		//if tribe found
-		if (found)
+
+		std::ofstream out(NewPlayerProtection::GetStatsBaselinePath(), std::ios::trunc);
+
+		if (!out.is_open() || !(out << baseline.dump()))
 		{
-			//if tribe is protected
-			if (isProtected)
-			{
-				auto online_players_ = NewPlayerProtection::TimerProt::Get().GetOnlinePlayers();
+			NPP_LOG(err, "({} {}) Could not write stats baseline {}", __FILE__, __FUNCTION__, NewPlayerProtection::GetStatsBaselinePath());
+			return FString("NPP stats baseline could not be written.");
+		}
 
-				//loop through tribe members
-				for (const auto& allData : all_players_)
-				{
-					//remove protection
-					if (allData->tribe_id == tribe_id)
-					{
-						allData->isNewPlayer = 0;
-					}
-				}
+		NPP_LOG(info, "{} saved the NPP stats baseline.", by);
+		return FString("NPP stats baseline saved, NPP.Stats compares against it from now on.");
+	}
 
-				for (const auto& onlineData : online_players_)
-				{
-					//remove protection
-					if (onlineData->tribe_id == tribe_id)
-					{
-						onlineData->isNewPlayer = 0;
-					}
-				}
+	std::string reply = "name,calls,p50_ns,p99_ns,max_ns";
+
+	for (size_t i = 0; i < static_cast<size_t>(NewPlayerProtection::Stat::Count); ++i)
+	{
+		auto& stat = NewPlayerProtection::GetStat(static_cast<NewPlayerProtection::Stat>(i));
+
+		reply += "\n" + std::string(NewPlayerProtection::StatNames[i])
+			+ "," + std::to_string(stat.Count())
+			+ "," + std::to_string(stat.Percentile(0.50))
+			+ "," + std::to_string(stat.Percentile(0.99))
+			+ "," + std::to_string(stat.Max());
+	}
+
+	nlohmann::json baseline;
+	std::ifstream baseline_file(NewPlayerProtection::GetStatsBaselinePath());
+
+	if (baseline_file.is_open())
+	{
+		baseline = nlohmann::json::parse(baseline_file, nullptr, false);
+	}
+
+	const auto baseline_stats = baseline.is_object() ? baseline.find("stats") : baseline.end();
+
+	if (baseline_stats != baseline.end() && baseline_stats->is_object())
+	{
+		//+ is slower than the baseline. empty while either side has no samples
+		const auto delta_percent = [](uint64 now_ns, uint64 before_ns, uint64 samples)
+		{
+			return samples == 0 || before_ns == 0 ? std::string()
+				: std::to_string((static_cast<int64>(now_ns) - static_cast<int64>(before_ns)) * 100 / static_cast<int64>(before_ns));
+		};
+
+		reply += "\n\nvs_baseline_" + std::to_string(baseline.value("timestamp_ms", int64(0)))
+			+ ",base_calls,base_p50_ns,base_p99_ns,p50_delta_percent,p99_delta_percent";
+
+		for (size_t i = 0; i < static_cast<size_t>(NewPlayerProtection::Stat::Count); ++i)
+		{
+			const auto& stat = NewPlayerProtection::GetStat(static_cast<NewPlayerProtection::Stat>(i));
+			const auto before_json = baseline_stats->find(NewPlayerProtection::StatNames[i]);
+			NewPlayerProtection::LatencyHistogram before;
 
-				//display protection removed message
-				rcon_connection->SendMessageW(rcon_packet->Id, 0, &FString::Format(*NewPlayerProtection::AdminTribeProtectionRemoved, tribe_id));
+			//a path added after the baseline was saved
+			if (before_json == baseline_stats->end() || !before.FromJson(*before_json))
+				continue;
 
-				Log::GetLog()->info("RCON removed NPP Protection of Tribe: {}.", tribe_id);
-			}
-			else //tribe not protected
-			{
-				//display tribe not under protection
-				rcon_connection->SendMessageW(rcon_packet->Id, 0, &FString::Format(*NewPlayerProtection::AdminTribeNotUnderProtection, tribe_id));
-			}
+			const uint64 p50 = before.Percentile(0.50);
+			const uint64 p99 = before.Percentile(0.99);
+
+			reply += "\n" + std::string(NewPlayerProtection::StatNames[i])
+				+ "," + std::to_string(before.Count())
+				+ "," + std::to_string(p50)
+				+ "," + std::to_string(p99)
+				+ "," + delta_percent(stat.Percentile(0.50), p50, stat.Count())
+				+ "," + delta_percent(stat.Percentile(0.99), p99, stat.Count());
 		}
-		else // tribe not found
+	}
+
+	if (reset)
+	{
+		for (size_t i = 0; i < static_cast<size_t>(NewPlayerProtection::Stat::Count); ++i)
 		{
-			//display tribe not found
-			rcon_connection->SendMessageW(rcon_packet->Id, 0, &FString::Format(*NewPlayerProtection::AdminNoTribeExistsMessage, tribe_id));
+			NewPlayerProtection::GetStat(static_cast<NewPlayerProtection::Stat>(i)).Reset();
 		}
 	}
-}
-
-inline void RconResetProtection(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
-{
-	FString reply;
 
-	bool found = false;
-	bool underMaxLevel = true;
+	auto& deferred = NewPlayerProtection::GetDeferredCounts();
 
-	//parse command
-	TArray<FString> parsed;
-	rcon_packet->Body.ParseIntoArray(parsed, L" ", true);
+	reply += "\n\ndeferred,items";
 
-	if (parsed.IsValidIndex(1))
+	for (size_t i = 0; i < deferred.size(); ++i)
 	{
-		uint64 tribe_id = 0;
+		reply += "\n" + std::string(NewPlayerProtection::DeferrableNames[i]) + "," + std::to_string(deferred[i]);
+	}
 
-		try
-		{
-			tribe_id = std::stoull(*parsed[1]);
-		}
-		catch (const std::exception& exception)
-		{
-			Log::GetLog()->warn("({} {}) Parsing error {}", __FILE__, __FUNCTION__, exception.what());
-			return;
-		}
+	if (reset)
+	{
+		deferred.fill(0);
+	}
 
-		auto all_players_ = NewPlayerProtection::TimerProt::Get().GetAllPlayers();
+	//share of damage checks answered by the tick memo without reaching DamageDecisions
+	const auto& memo = NewPlayerProtection::DamageTick;
 
-		//look for tribe
-		for (const auto& allData : all_players_)
-		{
+	reply += "\n\ndamage_memo,lookups,hits,reuse_percent\ntick," + std::to_string(memo.Lookups())
+		+ "," + std::to_string(memo.Hits())
+		+ "," + std::to_string(memo.Lookups() > 0 ? memo.Hits() * 100 / memo.Lookups() : 0);
 
-			if (IsAdmin(allData->steam_id))
-			{
-				continue;
-			}
+	//repeated hits on one structure answered without any of the checks
+	const auto& verdicts = NewPlayerProtection::StructureVerdicts;
 
-			if (allData->tribe_id == tribe_id)
-			{
-				found = true;
-				if (allData->level >= NewPlayerProtection::MaxLevel)
-				{
-					underMaxLevel = false;
-					break;
-				}
-			}
-		}
-		//if tribe found
-		if (found)
-		{
-			//if tribe is under max level
-			if (underMaxLevel)
-			{
-				auto online_players_ = NewPlayerProtection::TimerProt::Get().GetOnlinePlayers();
-				auto now = std::chrono::system_clock::now();
+	reply += "\nstructure," + std::to_string(verdicts.Lookups())
+		+ "," + std::to_string(verdicts.Hits())
+		+ "," + std::to_string(verdicts.Lookups() > 0 ? verdicts.Hits() * 100 / verdicts.Lookups() : 0);
 
-				//loop through tribe members
-				for (const auto& allData : all_players_)
-				{
+	const auto& instigators = NewPlayerProtection::PlayerInstigators;
 
-					if (IsAdmin(allData->steam_id))
-					{
-						continue;
-					}
+	reply += "\ninstigator," + std::to_string(instigators.Lookups())
+		+ "," + std::to_string(instigators.Hits())
+		+ "," + std::to_string(instigators.Lookups() > 0 ? instigators.Hits() * 100 / instigators.Lookups() : 0);
 
-					//add protection & increase start date
-					if (allData->tribe_id == tribe_id)
-					{
-						allData->isNewPlayer = 1;
-						allData->startDateTime = now;
-					}
-				}
+	if (reset)
+	{
+		NewPlayerProtection::DamageTick.ResetCounters();
+		NewPlayerProtection::StructureVerdicts.ResetCounters();
+		NewPlayerProtection::PlayerInstigators.ResetCounters();
+	}
 
-				for (const auto& onlineData : online_players_)
-				{
+	const auto memory = NewPlayerProtection::TimerProt::Get().GetMemoryUsage();
 
-					if (IsAdmin(onlineData->steam_id))
-					{
-						continue;
-					}
+	reply += "\n\nrecords,online,offline_record_bytes,online_record_bytes,total_bytes\n" + std::to_string(memory.records)
+		+ "," + std::to_string(memory.online)
+		+ "," + std::to_string(memory.offline_record_bytes)
+		+ "," + std::to_string(memory.online_record_bytes)
+		+ "," + std::to_string(memory.total_bytes);
 
-					//add protection & increase start date
-					if (onlineData->tribe_id == tribe_id)
-					{
-						onlineData->isNewPlayer = 1;
-						onlineData->startDateTime = now;
-					}
-				}
+	reply += "\n\n" + NewPlayerProtection::RaidStats::Get().Format(10);
 
-				//display protection added message
-				rcon_connection->SendMessageW(rcon_packet->Id, 0, &FString::Format(*NewPlayerProtection::AdminResetTribeProtectionSuccess, NewPlayerProtection::HoursOfProtection, tribe_id));
-				Log::GetLog()->info("RCON reset NPP Protection of Tribe: {}.", tribe_id);
-			}
-			else //tribe not under max level
-			{
-				//display tribe under max level message
-				rcon_connection->SendMessageW(rcon_packet->Id, 0, &FString::Format(*NewPlayerProtection::AdminResetTribeProtectionLvlFailure, tribe_id));
-			}
-		}
-		else // tribe not found
-		{
-			//display tribe not found
-			rcon_connection->SendMessageW(rcon_packet->Id, 0, &FString::Format(*NewPlayerProtection::AdminNoTribeExistsMessage, tribe_id));
-		}
+	if (reset)
+	{
+		NewPlayerProtection::RaidStats::Get().Reset();
+		NPP_LOG(info, "{} reset NPP stats.", by);
 	}
+	return NewPlayerProtection::ToFString(reply);
 }
 
-inline void RconAddProtection(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+inline void ConsoleStats(APlayerController* player_controller, FString* cmd, bool)
 {
-	FString reply;
+	RunConsoleTribeCommand(player_controller, *cmd, &StatsCommand);
+}
+
+inline void RconStats(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconTribeCommand(rcon_connection, rcon_packet, &StatsCommand);
+}
+
+//"NPP.DecisionTable", the compiled damage rules as one "mask,<predicates>,decision" line per combination of predicates,
+//0 or 1 for each predicate, followed by the lookups and mismatches DamageDecisionTableTestMode counted since load
+inline FString DecisionTableCommand(const FString&, const std::string&)
+{
+	const auto& table = NewPlayerProtection::DamageRules;
 
-	bool found = false;
-	bool underMaxLevel = true;
+	std::string reply = "mask";
 
-	//parse command
-	TArray<FString> parsed;
-	rcon_packet->Body.ParseIntoArray(parsed, L" ", true);
+	for (const char* name : NewPlayerProtection::DamagePredicateNames)
+	{
+		reply += ",";
+		reply += name;
+	}
+	reply += ",decision";
 
-	if (parsed.IsValidIndex(1) && parsed.IsValidIndex(2))
+	for (unsigned mask = 0; mask < NewPlayerProtection::DamagePredicateCombinations; ++mask)
 	{
-		uint64 tribe_id = 0;
-		uint64 hours = 0;
+		reply += "\n" + std::to_string(mask);
 
-		try
-		{
-			tribe_id = std::stoull(*parsed[1]);
-			hours = std::stoull(*parsed[2]);
-			if (hours < 0)
-			{
-				Log::GetLog()->warn("({} {}) Parsing error: Hours cannot be negative.", __FILE__, __FUNCTION__);
-				return;
-			}
-		}
-		catch (const std::exception& exception)
+		for (size_t bit = 0; bit < std::size(NewPlayerProtection::DamagePredicateNames); ++bit)
 		{
-			Log::GetLog()->warn("({} {}) Parsing error {}", __FILE__, __FUNCTION__, exception.what());
-			return;
+			reply += (mask & (1u << bit)) != 0 ? ",1" : ",0";
 		}
 
-		auto all_players_ = NewPlayerProtection::TimerProt::Get().GetAllPlayers();
+		reply += ",";
+		reply += NewPlayerProtection::DamageDecisionNames[static_cast<size_t>(table.Entry(mask))];
+	}
 
-		//look for tribe
-		for (const auto& allData : all_players_)
-		{
-			if (allData->tribe_id == tribe_id)
-			{
+	reply += "\n\ntest_mode,checks,mismatches\n" + std::to_string(table.TestMode() ? 1 : 0)
+		+ "," + std::to_string(table.Checks())
+		+ "," + std::to_string(table.Mismatches());
 
-				if (IsAdmin(allData->steam_id))
-				{
-					continue;
-				}
+	return NewPlayerProtection::ToFString(reply);
+}
 
-				found = true;
-				if (allData->level >= NewPlayerProtection::MaxLevel)
-				{
-					underMaxLevel = false;
-					break;
-				}
-			}
-		}
-		//if tribe found
-		if (found)
-		{
-			//if tribe is under max level
-			if (underMaxLevel)
-			{
-				auto online_players_ = NewPlayerProtection::TimerProt::Get().GetOnlinePlayers();
-				auto now = std::chrono::system_clock::now();
+inline void ConsoleDecisionTable(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleTribeCommand(player_controller, *cmd, &DecisionTableCommand);
+}
 
-				//loop through tribe members
-				for (const auto& allData : all_players_)
-				{
+inline void RconDecisionTable(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconTribeCommand(rcon_connection, rcon_packet, &DecisionTableCommand);
+}
 
-					if (IsAdmin(allData->steam_id))
-					{
-						continue;
-					}
+//"NPP.Memory", one "component,entries,bytes" line per NPP data structure. bytes are estimated from sizes and capacities,
+//node containers count a node per entry plus their buckets. the sqlite rows are the page cache, schema and prepared statements
+//of the game thread connection. sqlite3.props builds without memory statistics, so there is no process wide SQLite figure
+inline FString MemoryCommand(const FString&, const std::string&)
+{
+	const auto memory = NewPlayerProtection::TimerProt::Get().GetMemoryUsage();
+	std::string reply = "component,entries,bytes";
 
-					//add protection & increase start date
-					if (allData->tribe_id == tribe_id)
-					{
-						allData->isNewPlayer = 1;
-						allData->startDateTime = now += std::chrono::hours(hours - NewPlayerProtection::HoursOfProtection);
-					}
-				}
+	const auto add = [&reply](const char* component, size_t entries, uint64 bytes)
+	{
+		reply += "\n" + std::string(component) + "," + std::to_string(entries) + "," + std::to_string(bytes);
+	};
+
+	add("player_table", memory.records, memory.total_bytes - memory.online_bytes);
+	add("online_players", memory.online, memory.online_bytes);
+	add("tribe_aggregates", memory.tribes, memory.tribe_bytes);
+	add("timer_caches", 0, memory.cache_bytes);
+	add("queues", 0, memory.queue_bytes);
+	add("damage_decisions", NewPlayerProtection::DamageDecisions.Size(), NewPlayerProtection::DamageDecisions.MemoryBytes());
+	add("damage_tick_memo", 0, NewPlayerProtection::DamageTick.MemoryBytes());
+	add("structure_verdicts", 0, NewPlayerProtection::StructureVerdicts.MemoryBytes());
+	add("player_instigators", 0, NewPlayerProtection::PlayerInstigators.MemoryBytes());
+	add("cache_epochs", 0, NewPlayerProtection::Epochs.MemoryBytes());
+	add("blocked_damage_log", NewPlayerProtection::BlockedDamage.Size(), NewPlayerProtection::BlockedDamage.MemoryBytes());
+
+	size_t class_bytes = NewPlayerProtection::NodeContainerBytes(NewPlayerProtection::StructureExemptionCache)
+		+ NewPlayerProtection::NodeContainerBytes(NewPlayerProtection::BlueprintPathCache)
+		+ NewPlayerProtection::NodeContainerBytes(NewPlayerProtection::CorruptedDinoCache);
+
+	for (const auto& path : NewPlayerProtection::BlueprintPathCache)
+	{
+		class_bytes += path.second.Len() * sizeof(TCHAR);
+	}
+	add("class_caches", NewPlayerProtection::StructureExemptionCache.size() + NewPlayerProtection::BlueprintPathCache.size()
+		+ NewPlayerProtection::CorruptedDinoCache.size(), class_bytes);
 
-				for (const auto& onlineData : online_players_)
-				{
+	//the copy other threads read, admins is the NPPAdminGroup membership taken from the Permissions cache
+	const auto state = NewPlayerProtection::GetProtectionState();
+	add("published_state", state->tribes.size() + state->pveTribes.size() + state->admins.size(), NewPlayerProtection::NodeContainerBytes(state->tribes)
+		+ NewPlayerProtection::NodeContainerBytes(state->pveTribes) + NewPlayerProtection::NodeContainerBytes(state->admins));
+	add("pve_tribes", NewPlayerProtection::pveTribesList.size(), NewPlayerProtection::NodeContainerBytes(NewPlayerProtection::pveTribesList));
 
-					if (IsAdmin(onlineData->steam_id))
-					{
-						continue;
-					}
+	const auto connection = NewPlayerProtection::GetDB().connection();
 
-					//add protection & increase start date
-					if (onlineData->tribe_id == tribe_id)
-					{
-						onlineData->isNewPlayer = 1;
-						onlineData->startDateTime = now += std::chrono::hours(hours - NewPlayerProtection::HoursOfProtection);
-					}
-				}
+	const auto add_db_status = [&add, &connection](const char* component, int status)
+	{
+		int used = 0, highwater = 0;
+		sqlite3_db_status(connection.get(), status, &used, &highwater, 0);
+		add(component, 0, static_cast<uint64>(used));
+	};
 
-				//display protection added message
-				rcon_connection->SendMessageW(rcon_packet->Id, 0, &FString::Format(*NewPlayerProtection::AdminResetTribeProtectionSuccess, hours, tribe_id));
+	add_db_status("sqlite_page_cache", SQLITE_DBSTATUS_CACHE_USED);
+	add_db_status("sqlite_schema", SQLITE_DBSTATUS_SCHEMA_USED);
+	add_db_status("sqlite_statements", SQLITE_DBSTATUS_STMT_USED);
 
-				Log::GetLog()->info("RCON added {} hours of NPP Protection to Tribe: {}.", hours, tribe_id);
-			}
-			else //tribe not under max level
-			{
-				//display tribe under max level message
-				rcon_connection->SendMessageW(rcon_packet->Id, 0, &FString::Format(*NewPlayerProtection::AdminResetTribeProtectionLvlFailure, tribe_id));
-			}
-		}
-		else // tribe not found
-		{
-			//display tribe not found
-			rcon_connection->SendMessageW(rcon_packet->Id, 0, &FString::Format(*NewPlayerProtection::AdminNoTribeExistsMessage, tribe_id));
-		}
-	}
+	return NewPlayerProtection::ToFString(reply);
 }
 
-inline void ConsoleSetPVE(APlayerController* player, FString* cmd, bool boolean)
+inline void ConsoleMemory(APlayerController* player_controller, FString* cmd, bool)
 {
-	const auto shooter_controller = static_cast<AShooterPlayerController*>(player);
+	RunConsoleTribeCommand(player_controller, *cmd, &MemoryCommand);
+}
 
-	//if Admin
-	if (!shooter_controller || !shooter_controller->PlayerStateField() || !shooter_controller->bIsAdmin().Get())
-		return;
+inline void RconMemory(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconTribeCommand(rcon_connection, rcon_packet, &MemoryCommand);
+}
 
-	uint64 steam_id = ArkApi::IApiUtils::GetSteamIdFromController(player);
+//"NPP.Audit <tribe_id> [count]", the last count (default 20) audit events of the tribe as "timestamp_ms,action,by,hours" lines
+inline FString AuditCommand(const FString& body, const std::string& by)
+{
+	const auto parsed = TokenizeCommand(body);
+	uint64 tribe_id = 0;
+	uint64 count = 20;
 
-	bool found = false;
+	if (parsed.size() < 2 || !ParseUInt(parsed[1], tribe_id, __FUNCTION__)
+		|| (parsed.size() > 2 && !ParseUInt(parsed[2], count, __FUNCTION__)))
+	{
+		return FString();
+	}
 
-	//parse command
-	TArray<FString> parsed;
-	cmd->ParseIntoArray(parsed, L" ", true);
+	std::vector<NewPlayerProtection::AuditEvent> events;
+	NewPlayerProtection::AuditLog::Read(NewPlayerProtection::AuditLog::Get().GetPath(), events);
 
-	if (parsed.IsValidIndex(1) && parsed.IsValidIndex(2))
-	{
-		uint64 tribe_id = 0;
-		int setToPve = 0;
+	std::vector<const NewPlayerProtection::AuditEvent*> matching;
 
-		try
-		{
-			tribe_id = std::stoull(*parsed[1]);
-			setToPve = std::stoull(*parsed[2]);
-			if (setToPve < 0 || setToPve > 1)
-			{
-				Log::GetLog()->warn("({} {}) Parsing error: setToPve can only be a 1 or 0.", __FILE__, __FUNCTION__);
-				return;
-			}
-		}
-		catch (const std::exception& exception)
+	for (const auto& event : events)
+	{
+		if (event.tribe_id == tribe_id)
 		{
-			Log::GetLog()->warn("({} {}) Parsing error {}", __FILE__, __FUNCTION__, exception.what());
-			return;
+			matching.push_back(&event);
 		}
+	}
 
-		auto all_players_ = NewPlayerProtection::TimerProt::Get().GetAllPlayers();
+	std::string reply = "timestamp_ms,action,by,hours";
 
-		//look for tribe
-		for (const auto& allData : all_players_)
-		{
-			if (allData->tribe_id == tribe_id)
-			{
+	for (size_t i = matching.size() - static_cast<size_t>(std::min<uint64>(count, matching.size())); i < matching.size(); ++i)
+	{
+		reply += "\n" + std::to_string(matching[i]->timestamp_ms)
+			+ "," + matching[i]->action
+			+ "," + matching[i]->by
+			+ "," + std::to_string(matching[i]->hours);
+	}
+	return NewPlayerProtection::ToFString(reply);
+}
 
-				if (IsAdmin(allData->steam_id))
-				{
-					continue;
-				}
+inline void ConsoleAudit(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleTribeCommand(player_controller, *cmd, &AuditCommand);
+}
 
-				found = true;
-			}
-		}
-		//if tribe found
-		if (found)
-		{
-			if (setToPve == 1)
-			{
-				if (std::count(NewPlayerProtection::pveTribesList.begin(), NewPlayerProtection::pveTribesList.end(), tribe_id) < 1)
-				{
-					NewPlayerProtection::pveTribesList.push_back(tribe_id);
+inline void RconAudit(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconTribeCommand(rcon_connection, rcon_packet, &AuditCommand);
+}
 
-					if (std::count(NewPlayerProtection::removedPveTribesList.begin(), NewPlayerProtection::removedPveTribesList.end(), tribe_id) > 0)
-					{
-						const auto iter = std::find_if(
-							NewPlayerProtection::removedPveTribesList.begin(), NewPlayerProtection::removedPveTribesList.end(),
-							[tribe_id](const uint64 data)
-							{
-								return data == tribe_id;
-							});
-
-						if (iter != NewPlayerProtection::removedPveTribesList.end())
-						{
-							NewPlayerProtection::removedPveTribesList.erase(std::remove(NewPlayerProtection::removedPveTribesList.begin(), NewPlayerProtection::removedPveTribesList.end(), *iter), NewPlayerProtection::removedPveTribesList.end());
-						}
-					}
+//"NPP.Expiring <hours> [page:N]", the protected tribes whose time runs out within hours as "tribe_id,expires_ms,remaining_mins"
+//lines, soonest first after the same "page,pages,total" header as NPP.Query. a level over MaxLevel ends protection too but
+//cannot be forecast, only the time is
+inline FString ExpiringCommand(const FString& body, const std::string&)
+{
+	const auto parsed = TokenizeCommand(body);
+	uint64 hours = 0;
+	uint64 page = 1;
 
-					//display pve tribe added message
-					ArkApi::GetApiUtils().SendNotification(shooter_controller, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-						*NewPlayerProtection::AdminPVETribeAddedSuccessMessage, tribe_id);
+	if (parsed.size() < 2 || !ParseUInt(parsed[1], hours, __FUNCTION__))
+		return FString();
 
-					Log::GetLog()->info("Admin: {} enabled PVE status of Tribe: {}.", steam_id, tribe_id);
+	if (parsed.size() > 2)
+	{
+		if (parsed[2].substr(0, 5) != L"page:" || !ParseUInt(parsed[2].substr(5), page, __FUNCTION__))
+			return FString();
 
-				}
-				else
-				{
-					//display pve tribe already set message
-					ArkApi::GetApiUtils().SendNotification(shooter_controller, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-						*NewPlayerProtection::AdminPVETribeAlreadyAddedMessage, tribe_id);
-				}
-			}
-			else
-			{
-				if (std::count(NewPlayerProtection::removedPveTribesList.begin(), NewPlayerProtection::removedPveTribesList.end(), tribe_id) < 1)
-				{
-					NewPlayerProtection::removedPveTribesList.push_back(tribe_id);
+		page = std::max<uint64>(1, page);
+	}
 
-					if (std::count(NewPlayerProtection::pveTribesList.begin(), NewPlayerProtection::pveTribesList.end(), tribe_id) > 0)
-					{
-						const auto iter = std::find_if(
-							NewPlayerProtection::pveTribesList.begin(), NewPlayerProtection::pveTribesList.end(),
-							[tribe_id](const uint64 data)
-							{
-								return data == tribe_id;
-							});
-
-						if (iter != NewPlayerProtection::pveTribesList.end())
-						{
-							NewPlayerProtection::pveTribesList.erase(std::remove(NewPlayerProtection::pveTribesList.begin(), NewPlayerProtection::pveTribesList.end(), *iter), NewPlayerProtection::pveTribesList.end());
-						}
-					}
+	const auto& timer = NewPlayerProtection::TimerProt::Get();
+	const auto& index = timer.expiry_index_;
+	const auto now = timer.Now();
+	const auto protection = std::chrono::hours(NewPlayerProtection::GetSettings()->HoursOfProtection);
 
-					//display tribe removed message
-					ArkApi::GetApiUtils().SendNotification(shooter_controller, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-						*NewPlayerProtection::AdminPVETribeRemovedSuccessMessage, tribe_id);
+	//a tribe expires protection after its oldest start, so the window is a range of start times.
+	//a year is plenty and keeps the time point from overflowing
+	const auto from = index.lower_bound({ now - protection, 0 });
+	const auto to = index.lower_bound({ now - protection + std::chrono::hours(std::min<uint64>(hours, 24 * 366)), 0 });
 
-					Log::GetLog()->info("Admin: {} disabled PVE status of Tribe: {}.", steam_id, tribe_id);
-				}
-				else
-				{
-					//display tribe already removed message
-					ArkApi::GetApiUtils().SendNotification(shooter_controller, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-						*NewPlayerProtection::AdminPVETribeAlreadyRemovedMessage, tribe_id);
-				}
-			}
-		}
-		else // tribe not found
-		{
-			//display tribe not found
-			ArkApi::GetApiUtils().SendNotification(shooter_controller, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr,
-				*NewPlayerProtection::AdminNoTribeExistsMessage, tribe_id);
-		}
+	const size_t total = static_cast<size_t>(std::distance(from, to));
+	const size_t pages = std::max<size_t>(1, (total + QueryPageSize - 1) / QueryPageSize);
+	const size_t first = std::min(static_cast<size_t>(page - 1) * QueryPageSize, total);
+
+	std::string reply = std::to_string(page) + "," + std::to_string(pages) + "," + std::to_string(total);
+
+	auto iter = std::next(from, first);
+
+	for (size_t i = 0; i < QueryPageSize && iter != to; ++i, ++iter)
+	{
+		const auto expires = iter->first + protection;
+
+		reply += "\n" + std::to_string(iter->second)
+			+ "," + std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(expires.time_since_epoch()).count())
+			+ "," + std::to_string(std::chrono::duration_cast<std::chrono::minutes>(expires - now).count());
 	}
+	return NewPlayerProtection::ToFString(reply);
+}
 
+inline void ConsoleExpiring(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleTribeCommand(player_controller, *cmd, &ExpiringCommand);
 }
 
-inline void RconSetPVE(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+inline void RconExpiring(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
 {
-	FString reply;
+	RunRconTribeCommand(rcon_connection, rcon_packet, &ExpiringCommand);
+}
+
+//"NPP.Player <steam_id>", one "steam_id,tribe_id,level,new_player,last_login_ms,source" line, source is resident, archive or none.
+//players not in the main table are looked up in the archive, so a returning player's old record is still found
+inline FString PlayerCommand(const FString& body, const std::string&)
+{
+	const auto parsed = TokenizeCommand(body);
+	uint64 steam_id = 0;
 
-	bool found = false;
+	if (parsed.size() < 2 || !ParseUInt(parsed[1], steam_id, __FUNCTION__))
+		return FString();
 
-	//parse command
-	TArray<FString> parsed;
-	rcon_packet->Body.ParseIntoArray(parsed, L" ", true);
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	std::string reply = "steam_id,tribe_id,level,new_player,last_login_ms,source\n" + std::to_string(steam_id);
 
-	if (parsed.IsValidIndex(1) && parsed.IsValidIndex(2))
+	try
 	{
-		uint64 tribe_id = 0;
-		int setToPve = 0;
-
-		try
-		{
-			tribe_id = std::stoull(*parsed[1]);
-			setToPve = std::stoull(*parsed[2]);
-			if (setToPve != 0 && setToPve != 1)
-			{
-				Log::GetLog()->warn("({} {}) Parsing error: setToPve can only be a 1 or 0.", __FILE__, __FUNCTION__);
-				return;
-			}
-		}
-		catch (const std::exception& exception)
+		if (!timer.FindPlayer(steam_id) && LoadPlayerRows("SteamId = ?", steam_id) > 0)
 		{
-			Log::GetLog()->warn("({} {}) Parsing error {}", __FILE__, __FUNCTION__, exception.what());
-			return;
+			//the rest of the tribe too, its aggregate has to cover every member
+			timer.EnsureTribeResident(timer.FindPlayer(steam_id)->tribe_id);
 		}
 
-		auto all_players_ = NewPlayerProtection::TimerProt::Get().GetAllPlayers();
-
-		//look for tribe
-		for (const auto& allData : all_players_)
+		if (const auto data = timer.FindPlayer(steam_id))
 		{
-			if (allData->tribe_id == tribe_id)
-			{
-
-				if (IsAdmin(allData->steam_id))
-				{
-					continue;
-				}
-
-				found = true;
-			}
+			reply += "," + std::to_string(data->tribe_id)
+				+ "," + std::to_string(data->level)
+				+ "," + std::to_string(data->isNewPlayer)
+				+ "," + std::to_string(NewPlayerProtection::ToEpochMs(timer.LastLoginDateTime(*data)))
+				+ ",resident";
+			return NewPlayerProtection::ToFString(reply);
 		}
-		//if tribe found
-		if (found || std::count(NewPlayerProtection::pveTribesList.begin(), NewPlayerProtection::pveTribesList.end(), tribe_id) > 0 
-			|| std::count(NewPlayerProtection::removedPveTribesList.begin(), NewPlayerProtection::removedPveTribesList.end(), tribe_id) > 0)
+
+		if (NewPlayerProtection::archiveAttached)
 		{
+			bool found = false;
 
-			if (setToPve == 1)
+			NewPlayerProtection::GetDB() << "SELECT TribeId, Level, Is_New_Player, Last_Login_DateTime FROM archive.Players WHERE SteamId = ?;" << steam_id
+				>> [&reply, &found](uint64 tribe_id, int level, int is_new_player, int64 last_login_ms)
 			{
-				if (std::count(NewPlayerProtection::pveTribesList.begin(), NewPlayerProtection::pveTribesList.end(), tribe_id) < 1)
-				{
-					NewPlayerProtection::pveTribesList.push_back(tribe_id);
+				reply += "," + std::to_string(tribe_id)
+					+ "," + std::to_string(level)
+					+ "," + std::to_string(is_new_player)
+					+ "," + std::to_string(last_login_ms)
+					+ ",archive";
+				found = true;
+			};
 
-					if (std::count(NewPlayerProtection::removedPveTribesList.begin(), NewPlayerProtection::removedPveTribesList.end(), tribe_id) > 0)
-					{
-						const auto iter = std::find_if(
-							NewPlayerProtection::removedPveTribesList.begin(), NewPlayerProtection::removedPveTribesList.end(),
-							[tribe_id](const uint64 data)
-						{
-							return data == tribe_id;
-						});
-
-						if (iter != NewPlayerProtection::removedPveTribesList.end())
-						{
-							NewPlayerProtection::removedPveTribesList.erase(std::remove(NewPlayerProtection::removedPveTribesList.begin(), NewPlayerProtection::removedPveTribesList.end(), *iter), NewPlayerProtection::removedPveTribesList.end());
-						}
-					}
+			if (found)
+				return NewPlayerProtection::ToFString(reply);
+		}
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+	}
 
-					//display pve tribe added message
-					rcon_connection->SendMessageW(rcon_packet->Id, 0, &FString::Format(*NewPlayerProtection::AdminPVETribeAddedSuccessMessage, tribe_id));
+	reply += ",0,0,0,0,none";
+	return NewPlayerProtection::ToFString(reply);
+}
 
-					Log::GetLog()->info("RCON enabled PVE status of Tribe: {}.", tribe_id);
-				}
-				else
-				{
-					//display pve tribe already set message
-					rcon_connection->SendMessageW(rcon_packet->Id, 0, &FString::Format(*NewPlayerProtection::AdminPVETribeAlreadyAddedMessage, tribe_id));
-				}
-			}
-			else
-			{
-				if (std::count(NewPlayerProtection::removedPveTribesList.begin(), NewPlayerProtection::removedPveTribesList.end(), tribe_id) < 1)
-				{
-					NewPlayerProtection::removedPveTribesList.push_back(tribe_id);
+inline void ConsolePlayer(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleTribeCommand(player_controller, *cmd, &PlayerCommand);
+}
 
-					if (std::count(NewPlayerProtection::pveTribesList.begin(), NewPlayerProtection::pveTribesList.end(), tribe_id) > 0)
-					{
-						const auto iter = std::find_if(
-							NewPlayerProtection::pveTribesList.begin(), NewPlayerProtection::pveTribesList.end(),
-							[tribe_id](const uint64 data)
-						{
-							return data == tribe_id;
-						});
-
-						if (iter != NewPlayerProtection::pveTribesList.end())
-						{
-							NewPlayerProtection::pveTribesList.erase(std::remove(NewPlayerProtection::pveTribesList.begin(), NewPlayerProtection::pveTribesList.end(), *iter), NewPlayerProtection::pveTribesList.end());
-						}
-
-						//display tribe removed message
-						rcon_connection->SendMessageW(rcon_packet->Id, 0, &FString::Format(*NewPlayerProtection::AdminPVETribeRemovedSuccessMessage, tribe_id));
-
-						Log::GetLog()->info("RCON disabled PVE status of Tribe: {}.", tribe_id);
-					}
-					else
-					{
-						//display tribe already removed message
-						rcon_connection->SendMessageW(rcon_packet->Id, 0, &FString::Format(*NewPlayerProtection::AdminPVETribeAlreadyRemovedMessage, tribe_id));
-					}
-				}
-			}
-		}
-		else // tribe not found
-		{
-			//display tribe not found
-			rcon_connection->SendMessageW(rcon_packet->Id, 0, &FString::Format(*NewPlayerProtection::AdminNoTribeExistsMessage, tribe_id));
-		}
-	}
+inline void RconPlayer(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconTribeCommand(rcon_connection, rcon_packet, &PlayerCommand);
 }
 
+//NewPlayerProtectionBenchmark.h, NewPlayerProtectionSimulation.h, NewPlayerProtectionStress.h, NewPlayerProtectionBackup.h,
+//NewPlayerProtectionTableExport.h and NewPlayerProtectionWipe.h
+inline void ConsoleBenchmark(APlayerController* player_controller, FString* cmd, bool);
+inline void RconBenchmark(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*);
+inline void ConsoleSimulate(APlayerController* player_controller, FString* cmd, bool);
+inline void RconSimulate(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*);
+inline void ConsoleStress(APlayerController* player_controller, FString* cmd, bool);
+inline void RconStress(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*);
+inline void ConsoleBackup(APlayerController* player_controller, FString* cmd, bool);
+inline void RconBackup(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*);
+inline void ConsoleExport(APlayerController* player_controller, FString* cmd, bool);
+inline void RconExport(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*);
+inline void ConsoleWipe(APlayerController* player_controller, FString* cmd, bool);
+inline void RconWipe(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*);
+
 inline void InitChatCommands()
 {
-	FString cmd1 = NewPlayerProtection::NPPCommandPrefix;
+	FString cmd1 = NewPlayerProtection::GetSettings()->NPPCommandPrefix;
 	cmd1 = cmd1.Append("npp");
+	BuildChatDispatch();
 	ArkApi::GetCommands().AddChatCommand(cmd1, &ChatCommand);
 }
 
-inline void RemoveChatCommands()
+inline void RemoveChatCommands(const FString& prefix = NewPlayerProtection::GetSettings()->NPPCommandPrefix)
 {
-	FString cmd1 = NewPlayerProtection::NPPCommandPrefix;
+	FString cmd1 = prefix;
 	cmd1 = cmd1.Append("npp");
 	ArkApi::GetCommands().RemoveChatCommand(cmd1);
 }
 
 inline void ResetPlayerProtection()
 {
-	auto all_players_ = NewPlayerProtection::TimerProt::Get().GetAllPlayers();
-	auto all_online_players_ = NewPlayerProtection::TimerProt::Get().GetOnlinePlayers();
+	//evicted records are reset too, the next save evicts whatever is left unprotected
+	NewPlayerProtection::TimerProt::Get().LoadAllPlayers();
+
+	auto& all_players_ = NewPlayerProtection::TimerProt::Get().GetAllPlayers();
 
 	//set all players to protected
-	for (const auto& allData : all_players_)
+	for (auto& allData : all_players_)
 	{
-		allData->isNewPlayer = 1;
+		allData.isNewPlayer = 1;
+		NewPlayerProtection::TimerProt::Get().MarkDirty(allData);
+	}
+
+	RemoveExpiredTribesProtection();
+}
+
+//only redo the work for the keys that changed, messages and flags are picked up by LoadConfig alone.
+//loaded is a snapshot already read by the config watcher, the file is read here without one
+inline void ReloadConfig(std::shared_ptr<NewPlayerProtection::Settings> loaded = nullptr)
+{
+	const auto old = NewPlayerProtection::GetSettings();
+
+	if (loaded)
+	{
+		PublishSettings(std::move(loaded));
+	}
+	else
+	{
+		LoadConfig();
 	}
 
-	for (const auto& Data : all_online_players_)
+	const auto current = NewPlayerProtection::GetSettings();
+
+	if (current->NPPCommandPrefix != old->NPPCommandPrefix)
 	{
-		Data->isNewPlayer = 1;
+		RemoveChatCommands(old->NPPCommandPrefix);
+		InitChatCommands();
 	}
 
-	RemoveExpiredTribesProtection();
+	if (current->NPPAdminGroup != old->NPPAdminGroup)
+	{
+		NewPlayerProtection::TimerProt::Get().RefreshPlayerGroups();
+	}
+
+	if (current->HoursOfProtection != old->HoursOfProtection || current->MaxLevel != old->MaxLevel || current->IgnoreAdmins != old->IgnoreAdmins)
+	{
+		ResetPlayerProtection();
+	}
+
+	Log::GetLog()->info("NPP config reloaded.");
 }
 
 inline void ConsoleReloadConfig(APlayerController* player, FString* cmd, bool boolean)
@@ -1181,18 +1910,12 @@ inline void ConsoleReloadConfig(APlayerController* player, FString* cmd, bool bo
 	//if not Admin
 	if (!shooter_controller || !shooter_controller->PlayerStateField() || !shooter_controller->bIsAdmin().Get())
 		return;
-	RemoveChatCommands();
-	LoadConfig();
-	InitChatCommands();
-	ResetPlayerProtection();
+	ReloadConfig();
 }
 
 inline void RconReloadConfig(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
 {
-	RemoveChatCommands();
-	LoadConfig();
-	InitChatCommands();
-	ResetPlayerProtection();
+	ReloadConfig();
 }
 
 inline void InitCommands()
@@ -1208,6 +1931,39 @@ inline void InitCommands()
 	ArkApi::GetCommands().AddRconCommand("NPP.ReloadConfig",		&RconReloadConfig);
 	ArkApi::GetCommands().AddConsoleCommand("NPP.SetPVE",			&ConsoleSetPVE);
 	ArkApi::GetCommands().AddRconCommand("NPP.SetPVE",				&RconSetPVE);
+	ArkApi::GetCommands().AddConsoleCommand("NPP.BulkRemoveProtection",	&ConsoleBulkRemoveProtection);
+	ArkApi::GetCommands().AddRconCommand("NPP.BulkRemoveProtection",	&RconBulkRemoveProtection);
+	ArkApi::GetCommands().AddConsoleCommand("NPP.BulkResetProtection",	&ConsoleBulkResetProtection);
+	ArkApi::GetCommands().AddRconCommand("NPP.BulkResetProtection",		&RconBulkResetProtection);
+	ArkApi::GetCommands().AddConsoleCommand("NPP.BulkAddProtection",	&ConsoleBulkAddProtection);
+	ArkApi::GetCommands().AddRconCommand("NPP.BulkAddProtection",		&RconBulkAddProtection);
+	ArkApi::GetCommands().AddConsoleCommand("NPP.BulkSetPVE",			&ConsoleBulkSetPVE);
+	ArkApi::GetCommands().AddRconCommand("NPP.BulkSetPVE",				&RconBulkSetPVE);
+	ArkApi::GetCommands().AddRconCommand("NPP.Query",					&RconQuery);
+	ArkApi::GetCommands().AddConsoleCommand("NPP.Stats",				&ConsoleStats);
+	ArkApi::GetCommands().AddRconCommand("NPP.Stats",					&RconStats);
+	ArkApi::GetCommands().AddConsoleCommand("NPP.DecisionTable",		&ConsoleDecisionTable);
+	ArkApi::GetCommands().AddRconCommand("NPP.DecisionTable",			&RconDecisionTable);
+	ArkApi::GetCommands().AddConsoleCommand("NPP.Memory",				&ConsoleMemory);
+	ArkApi::GetCommands().AddRconCommand("NPP.Memory",					&RconMemory);
+	ArkApi::GetCommands().AddConsoleCommand("NPP.Audit",				&ConsoleAudit);
+	ArkApi::GetCommands().AddRconCommand("NPP.Audit",					&RconAudit);
+	ArkApi::GetCommands().AddConsoleCommand("NPP.Expiring",				&ConsoleExpiring);
+	ArkApi::GetCommands().AddRconCommand("NPP.Expiring",				&RconExpiring);
+	ArkApi::GetCommands().AddConsoleCommand("NPP.Player",				&ConsolePlayer);
+	ArkApi::GetCommands().AddRconCommand("NPP.Player",					&RconPlayer);
+	ArkApi::GetCommands().AddConsoleCommand("NPP.Benchmark",			&ConsoleBenchmark);
+	ArkApi::GetCommands().AddRconCommand("NPP.Benchmark",				&RconBenchmark);
+	ArkApi::GetCommands().AddConsoleCommand("NPP.Simulate",				&ConsoleSimulate);
+	ArkApi::GetCommands().AddRconCommand("NPP.Simulate",				&RconSimulate);
+	ArkApi::GetCommands().AddConsoleCommand("NPP.Stress",				&ConsoleStress);
+	ArkApi::GetCommands().AddRconCommand("NPP.Stress",					&RconStress);
+	ArkApi::GetCommands().AddConsoleCommand("NPP.Backup",				&ConsoleBackup);
+	ArkApi::GetCommands().AddRconCommand("NPP.Backup",					&RconBackup);
+	ArkApi::GetCommands().AddConsoleCommand("NPP.Export",				&ConsoleExport);
+	ArkApi::GetCommands().AddRconCommand("NPP.Export",					&RconExport);
+	ArkApi::GetCommands().AddConsoleCommand("NPP.Wipe",					&ConsoleWipe);
+	ArkApi::GetCommands().AddRconCommand("NPP.Wipe",					&RconWipe);
 }
 
 inline void RemoveCommands()
@@ -1222,5 +1978,39 @@ inline void RemoveCommands()
 	ArkApi::GetCommands().RemoveRconCommand("NPP.ReloadConfig");
 	ArkApi::GetCommands().RemoveConsoleCommand("NPP.SetPVE");
 	ArkApi::GetCommands().RemoveRconCommand("NPP.SetPVE");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.AddProtection");
+	ArkApi::GetCommands().RemoveConsoleCommand("NPP.BulkRemoveProtection");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.BulkRemoveProtection");
+	ArkApi::GetCommands().RemoveConsoleCommand("NPP.BulkResetProtection");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.BulkResetProtection");
+	ArkApi::GetCommands().RemoveConsoleCommand("NPP.BulkAddProtection");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.BulkAddProtection");
+	ArkApi::GetCommands().RemoveConsoleCommand("NPP.BulkSetPVE");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.BulkSetPVE");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.Query");
+	ArkApi::GetCommands().RemoveConsoleCommand("NPP.Stats");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.Stats");
+	ArkApi::GetCommands().RemoveConsoleCommand("NPP.DecisionTable");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.DecisionTable");
+	ArkApi::GetCommands().RemoveConsoleCommand("NPP.Memory");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.Memory");
+	ArkApi::GetCommands().RemoveConsoleCommand("NPP.Audit");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.Audit");
+	ArkApi::GetCommands().RemoveConsoleCommand("NPP.Expiring");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.Expiring");
+	ArkApi::GetCommands().RemoveConsoleCommand("NPP.Player");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.Player");
+	ArkApi::GetCommands().RemoveConsoleCommand("NPP.Benchmark");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.Benchmark");
+	ArkApi::GetCommands().RemoveConsoleCommand("NPP.Simulate");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.Simulate");
+	ArkApi::GetCommands().RemoveConsoleCommand("NPP.Stress");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.Stress");
+	ArkApi::GetCommands().RemoveConsoleCommand("NPP.Backup");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.Backup");
+	ArkApi::GetCommands().RemoveConsoleCommand("NPP.Export");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.Export");
+	ArkApi::GetCommands().RemoveConsoleCommand("NPP.Wipe");
+	ArkApi::GetCommands().RemoveRconCommand("NPP.Wipe");
 }
 
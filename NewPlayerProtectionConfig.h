@@ -1,5 +1,8 @@
 #pragma once
+#include <filesystem>
 #include <fstream>
+#include <future>
+#include <type_traits>
 #include <Permissions.h>
 
 std::string NewPlayerProtection::GetTimestamp(std::chrono::time_point<std::chrono::system_clock> datetime)
@@ -23,8 +26,14 @@ std::string NewPlayerProtection::GetTimestamp(std::chrono::time_point<std::chron
 	return result;
 }
 
-std::chrono::time_point<std::chrono::system_clock> NewPlayerProtection::GetDateTime(std::string timestamp)
+std::chrono::time_point<std::chrono::system_clock> NewPlayerProtection::GetDateTime(std::string_view timestamp)
 {
+	//sscanf needs the terminator a view does not have, the format is never longer than this
+	char text[32];
+	const size_t length = std::min(timestamp.size(), sizeof(text) - 1);
+	memcpy(text, timestamp.data(), length);
+	text[length] = '\0';
+
 	int yyyy;
 	int mm;
 	int dd;
@@ -35,7 +44,7 @@ std::chrono::time_point<std::chrono::system_clock> NewPlayerProtection::GetDateT
 
 	char scanf_format[] = "%4d-%2d-%2d %2d:%2d:%2d.%3d";
 
-	sscanf(timestamp.c_str(), scanf_format, &yyyy, &mm, &dd, &HH, &MM, &SS, &fff);
+	sscanf(text, scanf_format, &yyyy, &mm, &dd, &HH, &MM, &SS, &fff);
 
 	tm ttm = tm();
 	ttm.tm_year = yyyy - 1900; // Year since 1900
@@ -54,161 +63,995 @@ std::chrono::time_point<std::chrono::system_clock> NewPlayerProtection::GetDateT
 	return time_point_result;
 }
 
-sqlite::database& NewPlayerProtection::GetDB()
+int64 NewPlayerProtection::ToEpochMs(std::chrono::time_point<std::chrono::system_clock> datetime)
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(datetime.time_since_epoch()).count();
+}
+
+std::chrono::time_point<std::chrono::system_clock> NewPlayerProtection::FromEpochMs(int64 epoch_ms)
+{
+	return std::chrono::time_point<std::chrono::system_clock>(std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::milliseconds(epoch_ms)));
+}
+
+uint32 NewPlayerProtection::ToEpochSecs(std::chrono::time_point<std::chrono::system_clock> datetime)
+{
+	const int64 secs = std::chrono::duration_cast<std::chrono::seconds>(datetime.time_since_epoch()).count();
+	return static_cast<uint32>(std::clamp<int64>(secs, 0, std::numeric_limits<uint32>::max()));
+}
+
+std::chrono::time_point<std::chrono::system_clock> NewPlayerProtection::FromEpochSecs(uint32 epoch_secs)
 {
-	static sqlite::database db(config["General"].value("DbPathOverride", "").empty()
+	return std::chrono::time_point<std::chrono::system_clock>(std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::seconds(epoch_secs)));
+}
+
+std::string NewPlayerProtection::GetDBPath()
+{
+	const std::string path_override = GetSettings()->DbPathOverride;
+
+	return path_override.empty()
 		? ArkApi::Tools::GetCurrentDir() + "/ArkApi/Plugins/NewPlayerProtection/NewPlayerProtection.db"
-		: config["General"]["DbPathOverride"]);
+		: path_override;
+}
+
+//next to the main file, NewPlayerProtection.db becomes NewPlayerProtection_archive.db
+std::string NewPlayerProtection::GetArchivePath()
+{
+	std::filesystem::path path(GetDBPath());
+	path.replace_filename(path.stem().string() + "_archive" + path.extension().string());
+	return path.string();
+}
+
+sqlite::database& NewPlayerProtection::GetDB()
+{
+	static sqlite::database db(GetDBPath());
 	return db;
 }
 
-void LoadDB()
+//pragma values are pasted into the statement, anything not in the list falls back to the default
+std::string PragmaKeyword(const std::string& value, std::initializer_list<const char*> allowed, const char* fallback)
 {
-	auto& db = NewPlayerProtection::GetDB();
+	std::string upper = value;
+	std::transform(upper.begin(), upper.end(), upper.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+
+	for (const char* keyword : allowed)
+	{
+		if (upper == keyword)
+			return upper;
+	}
 
+	NPP_LOG(warn, "NPP config value {} is not one of the SQLite keywords, using {}.", value, fallback);
+	return fallback;
+}
+
+//attached as "archive" to the connection, false when it could not be opened
+bool AttachArchive(sqlite::database& db)
+{
 	try
 	{
-		// create players table
-		db << "create table if not exists Players ("
+		db << "ATTACH DATABASE ? AS archive;" << NewPlayerProtection::GetArchivePath();
+		db << "PRAGMA archive.journal_mode = WAL;";
+
+		db << "create table if not exists archive.Players ("
 			"SteamId integer primary key not null,"
 			"TribeId integer default 0,"
-			"Start_DateTime text default '',"
-			"Last_Login_DateTime text default '',"
+			"Start_DateTime integer default 0,"
+			"Last_Login_DateTime integer default 0,"
 			"Level integer default 0,"
-			"Is_New_Player integer default 0"
-			");";
-
-		// create pve_tribes table
-		db << "create table if not exists PVE_Tribes ("
-			"TribeId integer primary key not null,"
-			"Is_Protected integer default 0"
+			"Is_New_Player integer default 0,"
+			"Archived_DateTime integer default 0"
 			");";
+		return true;
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		NPP_LOG(err, "({} {}) Could not attach archive database: {}", __FILE__, __FUNCTION__, exception.what());
+		return false;
+	}
+}
 
-		// set pragmas for db
+//most pragmas only last for the connection, so both the game thread and the writer connection run this when opened
+void ApplyConnectionProfile(sqlite::database& db, const NewPlayerProtection::Settings& settings)
+{
+	try
+	{
+		//first, switching to WAL needs the lock too when another map has the file open
+		db << "PRAGMA busy_timeout = " + std::to_string(std::max(0, settings.DBBusyTimeoutInMs)) + ";";
 		db << "PRAGMA journal_mode = WAL;";
-		//db << "PRAGMA synchronous = OFF;";
+		//NORMAL in WAL mode only syncs on checkpoints, a power cut may lose the last save but never corrupts the file
+		db << "PRAGMA synchronous = " + PragmaKeyword(settings.DBSynchronous, { "OFF", "NORMAL", "FULL", "EXTRA" }, "NORMAL") + ";";
+		//negative is KiB instead of pages
+		db << "PRAGMA cache_size = " + std::to_string(-std::max(0, settings.DBCacheSizeKiB)) + ";";
+		db << "PRAGMA mmap_size = " + std::to_string(std::max<int64>(0, settings.DBMmapSizeMB) * 1024 * 1024) + ";";
+		db << "PRAGMA temp_store = " + PragmaKeyword(settings.DBTempStore, { "DEFAULT", "FILE", "MEMORY" }, "MEMORY") + ";";
+		db << "PRAGMA wal_autocheckpoint = " + std::to_string(std::max(0, settings.DBWalAutoCheckpointPages)) + ";";
 	}
 	catch (const sqlite::sqlite_exception& exception)
 	{
-		Log::GetLog()->error("({} {}) Unexpected DB error creating database: {}", __FILE__, __FUNCTION__, exception.what());
+		NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
 	}
-	
+}
+
+// older databases stored the dates as local time text, convert them to epoch ms once
+void MigratePlayerTimestamps(sqlite::database& db)
+{
+	std::string column_type;
+
+	db << "SELECT type FROM pragma_table_info('Players') WHERE name = 'Start_DateTime';" >> column_type;
+
+	if (column_type != "text")
+	{
+		return;
+	}
+
+	Log::GetLog()->info("Converting Players table dates to epoch milliseconds.");
+
+	db << "create table Players_Migrated ("
+		"SteamId integer primary key not null,"
+		"TribeId integer default 0,"
+		"Start_DateTime integer default 0,"
+		"Last_Login_DateTime integer default 0,"
+		"Level integer default 0,"
+		"Is_New_Player integer default 0"
+		");";
+
+	auto insert = db << "INSERT INTO Players_Migrated(SteamId, TribeId, Start_DateTime, Last_Login_DateTime, Level, Is_New_Player) VALUES(?,?,?,?,?,?);";
+	insert.used(true);
+
+	//the dates are parsed straight out of the row
+	db << "SELECT SteamId, TribeId, Start_DateTime, Last_Login_DateTime, Level, Is_New_Player FROM Players;"
+		>> [&insert](uint64 steamid, uint64 tribeid, std::string_view startdate, std::string_view lastlogindate, int level, int isnewplayer)
+	{
+		insert << steamid << tribeid << NewPlayerProtection::ToEpochMs(NewPlayerProtection::GetDateTime(startdate))
+			<< NewPlayerProtection::ToEpochMs(NewPlayerProtection::GetDateTime(lastlogindate)) << level << isnewplayer;
+		insert.execute();
+	};
+
+	db << "DROP TABLE Players;";
+	db << "ALTER TABLE Players_Migrated RENAME TO Players;";
+}
+
+// tribe reads also filter on the last login, so it is part of the tribe index
+void CreatePlayerIndexes(sqlite::database& db)
+{
+	db << "CREATE INDEX IF NOT EXISTS Players_TribeId ON Players(TribeId, Last_Login_DateTime);";
+	db << "CREATE INDEX IF NOT EXISTS Players_Last_Login_DateTime ON Players(Last_Login_DateTime);";
+}
+
+// aggregate per tribe kept by the plugin, seeded from the rows already there
+void CreateTribesTable(sqlite::database& db)
+{
+	db << "create table if not exists Tribes ("
+		"TribeId integer primary key not null,"
+		"Oldest_Start_DateTime integer default 0,"
+		"Max_Level integer default 0,"
+		"Is_Protected integer default 0,"
+		"Is_PVE integer default 0,"
+		"Member_Count integer default 0"
+		");";
+
+	db << "INSERT OR REPLACE INTO Tribes(TribeId, Oldest_Start_DateTime, Max_Level, Is_Protected, Is_PVE, Member_Count) "
+		"SELECT TribeId, MIN(Start_DateTime), MAX(Level), MAX(Is_New_Player), "
+		"EXISTS(SELECT 1 FROM PVE_Tribes WHERE PVE_Tribes.TribeId = Players.TribeId AND PVE_Tribes.Is_Protected = 1), COUNT(*) "
+		"FROM Players GROUP BY TribeId;";
+}
+
+// generation of the snapshot file the rows were last written with, 0 when the last write had none
+void CreateSnapshotState(sqlite::database& db)
+{
+	db << "create table if not exists Snapshot_State ("
+		"Id integer primary key not null,"
+		"Generation integer default 0"
+		");";
+
+	db << "INSERT OR IGNORE INTO Snapshot_State(Id, Generation) VALUES(1, 0);";
+}
+
+struct SchemaMigration
+{
+	int version;
+	const char* description;
+	void (*apply)(sqlite::database& db);
+};
+
+// append only, a step must never change once released. Version 0 is the schema created by LoadDB.
+const SchemaMigration SchemaMigrations[] =
+{
+	{ 1, "epoch timestamps and lookup indexes", [](sqlite::database& db) { MigratePlayerTimestamps(db); CreatePlayerIndexes(db); } },
+	{ 2, "tribes table", CreateTribesTable },
+	{ 3, "snapshot state", CreateSnapshotState },
+};
+
+// every step runs in its own transaction together with its user_version bump, a failed step is rolled back and stops the run
+void MigrateSchema(sqlite::database& db)
+{
+	int version = 0;
+
+	db << "PRAGMA user_version;" >> version;
+
+	for (const auto& migration : SchemaMigrations)
+	{
+		if (migration.version <= version)
+		{
+			continue;
+		}
+
+		NPP_LOG(info, "Updating NPP database schema to version {}: {}.", migration.version, migration.description);
+
+		db << "BEGIN TRANSACTION;";
+
+		try
+		{
+			migration.apply(db);
+			db << "PRAGMA user_version = " + std::to_string(migration.version) + ";";
+			db << "COMMIT;";
+		}
+		catch (const sqlite::sqlite_exception&)
+		{
+			db << "ROLLBACK;";
+			throw;
+		}
+
+		version = migration.version;
+	}
+}
+
+//number of rows LoadPlayerRows would read for the same where, lets a bulk load size the player table once
+template <typename... Values>
+size_t CountPlayerRows(const std::string& where, const Values&... values)
+{
+	const int64 decay_ms = NewPlayerProtection::ToEpochMs(std::chrono::system_clock::now() - std::chrono::hours(NewPlayerProtection::GetSettings()->NPPPlayerDecayInHours));
+	int64 count = 0;
+
+	auto res = NewPlayerProtection::GetDB() << "SELECT COUNT(*) FROM Players where Last_Login_DateTime > ? AND (" + where + ");"
+		<< decay_ms;
+	(res << ... << values);
+	res >> count;
+
+	return static_cast<size_t>(count);
+}
+
+namespace NewPlayerProtection
+{
+	//a Players row as read, for readers that add it to the tables later
+	struct PlayerRow
+	{
+		uint64 steam_id;
+		uint64 tribe_id;
+		int64 start_ms;
+		int64 last_login_ms;
+		int level;
+		int is_new_player;
+	};
+}
+
+//func(row) for every row in the decay window that also matches where, on any connection
+template <typename Func, typename... Values>
+void ReadPlayerRows(sqlite::database& db, const std::string& where, Func&& func, const Values&... values)
+{
+	const int64 decay_ms = NewPlayerProtection::ToEpochMs(std::chrono::system_clock::now() - std::chrono::hours(NewPlayerProtection::GetSettings()->NPPPlayerDecayInHours));
+
+	auto res = db << "SELECT SteamId, TribeId, Start_DateTime, Last_Login_DateTime, Level, Is_New_Player FROM Players where Last_Login_DateTime > ? AND (" + where + ");"
+		<< decay_ms;
+	(res << ... << values);
+
+	res >> [&func](uint64 steamid, uint64 tribeid, int64 startdate, int64 lastlogindate, int level, int isnewplayer)
+	{
+		func(NewPlayerProtection::PlayerRow{ steamid, tribeid, startdate, lastlogindate, level, isnewplayer });
+	};
+}
+
+//reads the rows in the decay window that also match where, players already resident keep their in-memory record
+template <typename... Values>
+size_t LoadPlayerRows(const std::string& where, const Values&... values)
+{
+	size_t count = 0;
+
+	ReadPlayerRows(NewPlayerProtection::GetDB(), where, [&count](const NewPlayerProtection::PlayerRow& row)
+	{
+		if (NewPlayerProtection::TimerProt::Get().AddPlayerFromDB(row.steam_id, row.tribe_id, NewPlayerProtection::FromEpochMs(row.start_ms), NewPlayerProtection::FromEpochMs(row.last_login_ms), row.level, row.is_new_player))
+		{
+			++count;
+		}
+	}, values...);
+
+	return count;
+}
+
+//runs one startup stage and logs how long it took
+template <typename Func>
+auto TimeStartupStage(const char* name, Func&& func)
+{
+	const auto start = std::chrono::steady_clock::now();
+	const auto log_time = [name, start]()
+	{
+		NPP_LOG(info, "NPP startup stage {} took {} ms.", name,
+			std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+	};
+
+	if constexpr (std::is_void_v<decltype(func())>)
+	{
+		func();
+		log_time();
+	}
+	else
+	{
+		auto result = func();
+		log_time();
+		return result;
+	}
+}
+
+//tables of schema version 0, MigrateSchema builds the rest on top
+void CreateBaseTables(sqlite::database& db)
+{
+	//only takes effect on a new file, existing databases keep their mode until they are vacuumed once
+	db << "PRAGMA auto_vacuum = INCREMENTAL;";
+
+	// create players table
+	db << "create table if not exists Players ("
+		"SteamId integer primary key not null,"
+		"TribeId integer default 0,"
+		"Start_DateTime integer default 0,"
+		"Last_Login_DateTime integer default 0,"
+		"Level integer default 0,"
+		"Is_New_Player integer default 0"
+		");";
+
+	// create pve_tribes table
+	db << "create table if not exists PVE_Tribes ("
+		"TribeId integer primary key not null,"
+		"Is_Protected integer default 0"
+		");";
+}
+
+void CreateSchema(sqlite::database& db)
+{
+	try
+	{
+		CreateBaseTables(db);
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		NPP_LOG(err, "({} {}) Unexpected DB error creating database: {}", __FILE__, __FUNCTION__, exception.what());
+	}
+
+	ApplyConnectionProfile(db, *NewPlayerProtection::GetSettings());
+
+	if (NewPlayerProtection::GetSettings()->ArchiveDecayedPlayers)
+	{
+		NewPlayerProtection::archiveAttached = AttachArchive(db);
+	}
+
 	try
 	{
-		std::string hours = "SELECT * FROM Players where Last_Login_DateTime > date('now', '-";
-		hours.append(std::to_string(NewPlayerProtection::NPPPlayerDecayInHours));
-		hours.append(" hour');");
+		MigrateSchema(db);
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		NPP_LOG(err, "({} {}) Unexpected DB error updating database schema: {}", __FILE__, __FUNCTION__, exception.what());
+	}
+}
+
+//own connection, so it runs alongside the player load on GetDB
+std::vector<uint64> ReadPveTribes()
+{
+	std::vector<uint64> tribes;
 
-		auto res = db << hours;
+	try
+	{
+		sqlite::database db(NewPlayerProtection::GetDBPath());
 
-		res >> [](uint64 steamid, uint64 tribeid, std::string startdate, std::string lastlogindate, int level, int isnewplayer)
+		db << "SELECT TribeId FROM PVE_Tribes where Is_Protected = 1;" >> [&tribes](uint64 tribeid)
 		{
-			NewPlayerProtection::TimerProt::Get().AddPlayerFromDB(steamid, tribeid, NewPlayerProtection::GetDateTime(startdate), NewPlayerProtection::GetDateTime(lastlogindate), level, isnewplayer);
+			tribes.push_back(tribeid);
 		};
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		NPP_LOG(err, "({} {}) Unexpected DB error loading pve_tribes table: {}", __FILE__, __FUNCTION__, exception.what());
+	}
 
-		//auto players = NewPlayerProtection::TimerProt::Get().GetAllPlayers();
-		//Log::GetLog()->info("hours: {} .", hours);
-		//Log::GetLog()->info("Players table data loaded. Count: {} records.", players.size());
+	return tribes;
+}
+
+void LoadResidentPlayers()
+{
+	try
+	{
+		const int64 decay_ms = NewPlayerProtection::ToEpochMs(std::chrono::system_clock::now() - std::chrono::hours(NewPlayerProtection::GetSettings()->NPPPlayerDecayInHours));
+
+		//only protected tribes are kept resident, everyone else is read in on login or when an admin command names their tribe
+		const std::string resident_where = "TribeId IN (SELECT TribeId FROM Players WHERE Is_New_Player = 1 AND Last_Login_DateTime > ?)";
+
+		//sized once, the rows are then appended without the table or index growing on the way
+		const size_t expected = CountPlayerRows(resident_where, decay_ms);
+		auto& timer = NewPlayerProtection::TimerProt::Get();
+		timer.ReservePlayers(expected);
+		timer.player_index_.Reserve(timer.player_index_.Size() + expected);
+
+		const size_t count = LoadPlayerRows(resident_where, decay_ms);
+
+		for (const auto& player : timer.GetAllPlayers())
+		{
+			timer.resident_tribes_.insert(player.tribe_id);
+		}
+
+		NPP_LOG(info, "Players table data loaded. {} records of protected tribes resident.", count);
 	}
 	catch (const sqlite::sqlite_exception& exception)
 	{
-		Log::GetLog()->error("({} {}) Unexpected DB error loading players table: {}", __FILE__, __FUNCTION__, exception.what());
+		NPP_LOG(err, "({} {}) Unexpected DB error loading players table: {}", __FILE__, __FUNCTION__, exception.what());
 	}
+}
+
+//schema first, then the PVE list is read on its own connection while the snapshot is read and the players are loaded.
+//both only meet in the tribe aggregates at the end, admin status needs no prefetch since it comes from the Permissions cache
+void LoadDB()
+{
+	NewPlayerProtection::ScopedLatency latency(NewPlayerProtection::Stat::LoadDB);
+	ARK_TRACE_ZONE("NPP::LoadDB");
+
+	auto& db = NewPlayerProtection::GetDB();
+
+	TimeStartupStage("schema", [&db]()
+	{
+		CreateSchema(db);
+	});
+	
+	int64 generation = 0;
 
 	try
 	{
-		auto res = db << "SELECT TribeId FROM PVE_Tribes where Is_Protected = 1;";
+		db << "SELECT Generation FROM Snapshot_State WHERE Id = 1;" >> generation;
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+	}
+
+	NewPlayerProtection::lastSnapshotGeneration = generation;
+
+	auto pve_tribes = std::async(std::launch::async, []()
+	{
+		return TimeStartupStage("PVE tribes", &ReadPveTribes);
+	});
+
+	//the snapshot holds exactly what the tables would load, without a query per tribe.
+	//after a hot reload the previous instance's handoff is newer still
+	std::shared_ptr<NewPlayerProtection::Snapshot> snapshot;
+
+	if (NewPlayerProtection::GetSettings()->HotReloadHandoff)
+	{
+		snapshot = TimeStartupStage("handoff", [generation]()
+		{
+			return ReadHandoff(generation);
+		});
+	}
+
+	if (!snapshot && NewPlayerProtection::GetSettings()->WriteSnapshotOnSave)
+	{
+		snapshot = TimeStartupStage("snapshot", [generation]()
+		{
+			return ReadSnapshot(generation);
+		});
+	}
+
+	TimeStartupStage("players", [&snapshot]()
+	{
+		if (snapshot)
+		{
+			ApplySnapshot(*snapshot);
+		}
+		else
+		{
+			LoadResidentPlayers();
+		}
+
+		NewPlayerProtection::TimerProt::Get().ExpireAllTribes();
+	});
+
+	const std::vector<uint64> pve_list = pve_tribes.get();
+	NewPlayerProtection::pveTribesList.insert(pve_list.begin(), pve_list.end());
+
+	//the snapshot adds its own PVE tribes, so every entry of the merged list is updated
+	for (const uint64 tribeid : NewPlayerProtection::pveTribesList)
+	{
+		NewPlayerProtection::TimerProt::Get().UpdateTribe(tribeid);
+	}
+
+	NPP_LOG(info, "PVE_Tribes table data loaded, {} tribes.", pve_list.size());
+
+	//whatever changed after the last committed save, replayed even when journaling is now off
+	const uint64 next_segment = TimeStartupStage("journal", []()
+	{
+		return ReplayJournal(NewPlayerProtection::GetJournalPath());
+	});
+
+	//a replica changes nothing that would have to be replayed
+	if (NewPlayerProtection::GetSettings()->JournalChanges && !NewPlayerProtection::IsReplica())
+	{
+		NewPlayerProtection::Journal::Get().Start(NewPlayerProtection::GetJournalPath(), next_segment);
+	}
+}
+
+//SAX handler that hands every scalar to the field bound to its path ("General.IgnoreAdmins"), no DOM is built.
+//array elements go to the array's binding with their index, unbound strings are kept for the messages, anything else is skipped.
+class ConfigReader : public nlohmann::json_sax<nlohmann::json>
+{
+	public:
+		using Setter = std::function<void(const nlohmann::json& value, size_t index)>;
+
+		//field takes fallback now and the file's value if the key is there
+		template <typename T, typename U = T>
+		void Bind(const std::string& path, T& field, U fallback = U())
+		{
+			field = T(fallback);
+			setters_[path] = [&field](const nlohmann::json& value, size_t)
+			{
+				field = value.get<T>();
+			};
+		}
+
+		void Bind(const std::string& path, Setter setter)
+		{
+			setters_[path] = std::move(setter);
+		}
+
+		//array whose elements go to setter, clear runs where a file starts the array so an override replaces the base's list
+		void Bind(const std::string& path, Setter setter, std::function<void()> clear)
+		{
+			setters_[path] = std::move(setter);
+			clears_[path] = std::move(clear);
+		}
+
+		//nullptr when the file has no string at path
+		const std::string* FindString(const std::string& path) const
+		{
+			const auto iter = strings_.find(path);
+			return iter != strings_.end() ? &iter->second : nullptr;
+		}
 
-		res >> [](uint64 tribeid)
+		const std::string& GetError() const
 		{
-			NewPlayerProtection::pveTribesList.push_back(tribeid);
+			return error_;
+		}
+
+		bool null() override
+		{
+			return true;
+		}
+		bool boolean(bool val) override
+		{
+			return Value(nlohmann::json(val));
+		}
+		bool number_integer(number_integer_t val) override
+		{
+			return Value(nlohmann::json(val));
+		}
+		bool number_unsigned(number_unsigned_t val) override
+		{
+			return Value(nlohmann::json(val));
+		}
+		bool number_float(number_float_t val, const string_t&) override
+		{
+			return Value(nlohmann::json(val));
+		}
+		bool string(string_t& val) override
+		{
+			size_t index;
+			const std::string path = NextPath(index);
+			const auto iter = setters_.find(path);
+
+			if (iter != setters_.end())
+			{
+				iter->second(nlohmann::json(val), index);
+			}
+			else
+			{
+				strings_[path] = std::move(val);
+			}
+			return true;
+		}
+		bool start_object(std::size_t) override
+		{
+			return Push(false);
+		}
+		bool key(string_t& val) override
+		{
+			key_ = std::move(val);
+			return true;
+		}
+		bool end_object() override
+		{
+			frames_.pop_back();
+			return true;
+		}
+		bool start_array(std::size_t) override
+		{
+			if (!Push(true))
+				return false;
+
+			const auto iter = clears_.find(frames_.back().path);
+
+			if (iter != clears_.end())
+			{
+				iter->second();
+			}
+			return true;
+		}
+		bool end_array() override
+		{
+			frames_.pop_back();
+			return true;
+		}
+		bool parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception& ex) override
+		{
+			error_ = ex.what();
+			return false;
+		}
+
+	private:
+		struct Frame
+		{
+			std::string path;
+			bool array;
+			size_t index;
 		};
 
-		Log::GetLog()->info("PVE_Tribes table data loaded.");
+		//path of the value being read, index is its position when it is an array element
+		std::string NextPath(size_t& index)
+		{
+			index = 0;
+
+			if (frames_.empty())
+				return std::string();
+
+			Frame& frame = frames_.back();
+
+			if (frame.array)
+			{
+				index = frame.index++;
+				return frame.path;
+			}
+			return frame.path.empty() ? key_ : frame.path + "." + key_;
+		}
+
+		bool Push(bool array)
+		{
+			size_t index;
+			std::string path = NextPath(index);
+
+			//elements of nested containers are not bound, an unused path keeps them away from the parent's setter
+			if (!frames_.empty() && frames_.back().array)
+			{
+				path += "[]";
+			}
+
+			frames_.push_back({ std::move(path), array, 0 });
+			return true;
+		}
+
+		bool Value(const nlohmann::json& value)
+		{
+			size_t index;
+			const auto iter = setters_.find(NextPath(index));
+
+			if (iter != setters_.end())
+			{
+				iter->second(value, index);
+			}
+			return true;
+		}
 
+		std::unordered_map<std::string, Setter> setters_;
+		std::unordered_map<std::string, std::function<void()>> clears_;
+		std::unordered_map<std::string, std::string> strings_;
+		std::vector<Frame> frames_;
+		std::string key_;
+		std::string error_;
+};
+
+//invalid messages are reported here and sent as written, never fail when sent
+//fallback is used when the key is missing, for messages added after configs were already deployed
+template <size_t N>
+inline void LoadMessage(NewPlayerProtection::MessageTemplate<N>& message, const ConfigReader& reader, const std::string& key, const char* fallback = nullptr)
+{
+	std::string error;
+	const std::string* found = reader.FindString("General." + key);
+
+	if (!found && !fallback)
+	{
+		NPP_LOG(err, "NPP config message {} is missing", key);
 	}
-	catch (const sqlite::sqlite_exception& exception)
+
+	const std::string text = found ? *found : fallback ? fallback : "";
+
+	if (!message.Compile(NewPlayerProtection::ToFString(text), error))
 	{
-		Log::GetLog()->error("({} {}) Unexpected DB error loading pve_tribes table: {}", __FILE__, __FUNCTION__, exception.what());
+		NPP_LOG(err, "NPP config message {} is invalid, it will be sent as written: {}", key, error);
 	}
 }
 
-inline void LoadConfig()
+//config.json is shared by every map, config.<Map>.json next to it overrides any of its keys for the map named first on
+//the server's command line ("TheIsland?listen?..."). empty when the command line names no map
+inline std::string MapConfigFileName()
+{
+	const std::wstring command_line = GetCommandLineW();
+	size_t first = 0;
+
+	//the executable, quoted when its path has spaces
+	if (!command_line.empty() && command_line[0] == L'"')
+	{
+		first = command_line.find(L'"', 1);
+		first = first == std::wstring::npos ? command_line.size() : first + 1;
+	}
+	else
+	{
+		first = std::min(command_line.find(L' '), command_line.size());
+	}
+
+	first = command_line.find_first_not_of(L' ', first);
+
+	if (first == std::wstring::npos || command_line[first] == L'-')
+		return std::string();
+
+	const size_t last = command_line.find_first_of(L"? ", first);
+	const std::wstring map = command_line.substr(first, last == std::wstring::npos ? std::wstring::npos : last - first);
+
+	return map.empty() ? std::string() : "config." + ArkApi::Tools::Utf8Encode(map) + ".json";
+}
+
+//parses config.json, then the keys of override_path over it, into a new snapshot without publishing it. a missing override
+//is skipped, nullptr when either file can't be parsed or the base can't be read. the merge happens here once, the hot paths
+//still read a single field of the snapshot
+inline std::shared_ptr<NewPlayerProtection::Settings> ReadSettings(const std::string& path, const std::string& override_path = std::string())
 {
-	std::ifstream file(ArkApi::Tools::GetCurrentDir() + "/ArkApi/Plugins/NewPlayerProtection/config.json");
+	std::ifstream file(path);
 
 	if (!file.is_open())
 	{
-		return;
+		return nullptr;
 	}
 
-	file >> NewPlayerProtection::config;
-	file.close();
+	auto loaded = std::make_shared<NewPlayerProtection::Settings>();
+	ConfigReader reader;
 
-	NewPlayerProtection::next_player_update = std::chrono::system_clock::now();
+	reader.Bind("General.DbPathOverride", loaded->DbPathOverride);
+	reader.Bind("General.PlayerUpdateIntervalInMins", loaded->PlayerUpdateIntervalInMins);
+	reader.Bind("General.AdaptivePlayerRefresh", loaded->AdaptivePlayerRefresh, false);
+	reader.Bind("General.IgnoreAdmins", loaded->IgnoreAdmins);
+	reader.Bind("General.AllowNewPlayersToDamageEnemyStructures", loaded->AllowNewPlayersToDamageEnemyStructures);
+	reader.Bind("General.AllowPlayersToDisableOwnedTribeProtection", loaded->AllowPlayersToDisableOwnedTribeProtection);
+	reader.Bind("General.AllowWildCorruptedDinoDamage", loaded->AllowWildCorruptedDinoDamage);
+	reader.Bind("General.AllowWildDinoDamage", loaded->AllowWildDinoDamage);
+	reader.Bind("General.CacheStructureVerdicts", loaded->CacheStructureVerdicts, true);
+	reader.Bind("General.DamageDecisionTableTestMode", loaded->DamageDecisionTableTestMode);
 
-	NewPlayerProtection::PlayerUpdateIntervalInMins = NewPlayerProtection::config["General"]["PlayerUpdateIntervalInMins"];
-	NewPlayerProtection::IgnoreAdmins = NewPlayerProtection::config["General"]["IgnoreAdmins"];
-	NewPlayerProtection::AllowNewPlayersToDamageEnemyStructures = NewPlayerProtection::config["General"]["AllowNewPlayersToDamageEnemyStructures"];
-	NewPlayerProtection::AllowPlayersToDisableOwnedTribeProtection = NewPlayerProtection::config["General"]["AllowPlayersToDisableOwnedTribeProtection"];
-	NewPlayerProtection::AllowWildCorruptedDinoDamage = NewPlayerProtection::config["General"]["AllowWildCorruptedDinoDamage"];
-	NewPlayerProtection::AllowWildDinoDamage = NewPlayerProtection::config["General"]["AllowWildDinoDamage"];
-	
-	NewPlayerProtection::NPPPlayerDecayInHours = NewPlayerProtection::config["General"]["NPPPlayerDecayInHours"];
-	NewPlayerProtection::NPPCommandPrefix = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["NPPCommandPrefix"]).c_str());
-	NewPlayerProtection::NPPAdminGroup = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["NPPAdminGroup"]).c_str());
-
-	NewPlayerProtection::NewPlayerDoingDamageMessage = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["NewPlayerDoingDamageMessage"]).c_str());
-	NewPlayerProtection::NewPlayerStructureTakingDamageMessage = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["NewPlayerStructureTakingDamageMessage"]).c_str());
-	NewPlayerProtection::NewPlayerStructureTakingDamageFromUnknownTribemateMessage = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["NewPlayerStructureTakingDamageFromUnknownTribemateMessage"]).c_str());
-
-	NewPlayerProtection::NPPRemainingMessage = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["NPPRemainingMessage"]).c_str());
-	NewPlayerProtection::NPPInfoMessage = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["NPPInfoMessage"]).c_str());
-	NewPlayerProtection::NPPInvalidCommand = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["NPPInvalidCommand"]).c_str());
-	NewPlayerProtection::NewPlayerProtectionDisableSuccess = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["NewPlayerProtectionDisableSuccess"]).c_str());
-	NewPlayerProtection::NotANewPlayerMessage = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["NotANewPlayerMessage"]).c_str());
-	NewPlayerProtection::NotTribeAdminMessage = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["NotTribeAdminMessage"]).c_str());
-	NewPlayerProtection::TribeIDText = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["TribeIDText"]).c_str());
-	NewPlayerProtection::NoStructureForTribeIDText = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["NoStructureForTribeIDText"]).c_str());
-	NewPlayerProtection::PVEDisablePlayerMessage = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["PVEDisablePlayerMessage"]).c_str());
-	NewPlayerProtection::PVEStatusMessage = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["PVEStatusMessage"]).c_str());
-	NewPlayerProtection::NotAStructureMessage = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["NotAStructureMessage"]).c_str());
-	
-	NewPlayerProtection::AdminNoTribeExistsMessage = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["AdminNoTribeExistsMessage"]).c_str());
-	NewPlayerProtection::AdminTribeProtectionRemoved = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["AdminTribeProtectionRemoved"]).c_str());
-	NewPlayerProtection::AdminTribeNotUnderProtection = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["AdminTribeNotUnderProtection"]).c_str());
-	NewPlayerProtection::AdminResetTribeProtectionSuccess = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["AdminResetTribeProtectionSuccess"]).c_str());
-	NewPlayerProtection::AdminResetTribeProtectionLvlFailure = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["AdminResetTribeProtectionLvlFailure"]).c_str());
-	NewPlayerProtection::AdminPVETribeAddedSuccessMessage = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["AdminPVETribeAddedSuccessMessage"]).c_str());
-	NewPlayerProtection::AdminPVETribeAlreadyAddedMessage = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["AdminPVETribeAlreadyAddedMessage"]).c_str());
-	NewPlayerProtection::AdminPVETribeRemovedSuccessMessage = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["AdminPVETribeRemovedSuccessMessage"]).c_str());
-	NewPlayerProtection::AdminPVETribeAlreadyRemovedMessage = FString(ArkApi::Tools::Utf8Decode(NewPlayerProtection::config["General"]["AdminPVETribeAlreadyRemovedMessage"]).c_str());
-
-	NewPlayerProtection::MessageIntervalInSecs = NewPlayerProtection::config["General"]["MessageIntervalInSecs"];
-	NewPlayerProtection::MessageTextSize = NewPlayerProtection::config["General"]["MessageTextSize"];
-	NewPlayerProtection::MessageDisplayDelay = NewPlayerProtection::config["General"]["MessageDisplayDelay"];
-	NewPlayerProtection::TempConfig = NewPlayerProtection::config["General"]["MessageColor"];
-	NewPlayerProtection::MessageColor = FLinearColor(NewPlayerProtection::TempConfig[0], NewPlayerProtection::TempConfig[1], NewPlayerProtection::TempConfig[2], NewPlayerProtection::TempConfig[3]);
-
-	NewPlayerProtection::MaxLevel = NewPlayerProtection::config["General"]["NewPlayerProtection"]["NewPlayerMaxLevel"];
-	NewPlayerProtection::HoursOfProtection = NewPlayerProtection::config["General"]["NewPlayerProtection"]["HoursOfProtection"];
-
-	//Clear vector so that config reload is clean
-	NewPlayerProtection::StructureExemptions.clear();
+	reader.Bind("General.NPPPlayerDecayInHours", loaded->NPPPlayerDecayInHours);
+	reader.Bind("General.MaxResidentPlayers", loaded->MaxResidentPlayers, 20000);
+	reader.Bind("General.CaptureDamageEvents", loaded->CaptureDamageEvents, false);
+	reader.Bind("General.DamageCaptureMaxEvents", loaded->DamageCaptureMaxEvents, 1000000);
+	reader.Bind("General.MetricsPushUrl", loaded->MetricsPushUrl, "");
+	reader.Bind("General.MetricsFormat", loaded->MetricsFormat, "prometheus");
+	reader.Bind("General.MetricsSampleIntervalInSecs", loaded->MetricsSampleIntervalInSecs, 10);
+	reader.Bind("General.MetricsPushIntervalInSecs", loaded->MetricsPushIntervalInSecs, 60);
+	reader.Bind("General.WebhookUrl", loaded->WebhookUrl, "");
+	reader.Bind("General.WebhookIntervalInSecs", loaded->WebhookIntervalInSecs, 10);
+	reader.Bind("General.WebhookMaxQueuedEvents", loaded->WebhookMaxQueuedEvents, 500);
+	reader.Bind("General.AuditProtectionChanges", loaded->AuditProtectionChanges, true);
+	reader.Bind("General.WriteSnapshotOnSave", loaded->WriteSnapshotOnSave, true);
+	reader.Bind("General.HotReloadHandoff", loaded->HotReloadHandoff, true);
+	reader.Bind("General.WatchConfigFile", loaded->WatchConfigFile, false);
+	reader.Bind("General.BlockDamageWhileLoading", loaded->BlockDamageWhileLoading, false);
+	reader.Bind("General.PrefilterRadialDamage", loaded->PrefilterRadialDamage, true);
+	reader.Bind("General.SuppressProtectedTargeting", loaded->SuppressProtectedTargeting, false);
+	reader.Bind("General.JournalChanges", loaded->JournalChanges, true);
+	reader.Bind("General.PurgeDecayedPlayersEveryHours", loaded->PurgeDecayedPlayersEveryHours, 24);
+	reader.Bind("General.DecayedPlayerRetentionInHours", loaded->DecayedPlayerRetentionInHours, 0);
+	reader.Bind("General.PurgeDryRun", loaded->PurgeDryRun, false);
+	reader.Bind("General.ArchiveDecayedPlayers", loaded->ArchiveDecayedPlayers, false);
+
+	reader.Bind("Cluster.Enabled", loaded->ClusterSyncEnabled, false);
+	reader.Bind("Cluster.MysqlHost", loaded->ClusterMysqlHost, "");
+	reader.Bind("Cluster.MysqlUser", loaded->ClusterMysqlUser, "");
+	reader.Bind("Cluster.MysqlPass", loaded->ClusterMysqlPassword, "");
+	reader.Bind("Cluster.MysqlDB", loaded->ClusterMysqlDatabase, "");
+	reader.Bind("Cluster.ServerId", loaded->ClusterServerId, "");
+	reader.Bind("Cluster.SyncIntervalInSecs", loaded->ClusterSyncIntervalInSecs, 10);
+	reader.Bind("Cluster.Nodes", [&loaded](const nlohmann::json& value, size_t)
+	{
+		loaded->ClusterNodes.push_back(value.get<std::string>());
+	},
+	[&loaded]()
+	{
+		loaded->ClusterNodes.clear();
+	});
+	reader.Bind("Cluster.NodeIndex", loaded->ClusterNodeIndex, 0);
+	reader.Bind("Cluster.ReplicationKey", loaded->ClusterReplicationKey, "");
+	reader.Bind("Cluster.ReplicaMode", loaded->ClusterReplicaMode, false);
+	reader.Bind("Cluster.ReplicaRefreshInSecs", loaded->ClusterReplicaRefreshInSecs, 30);
+	reader.Bind("Cluster.SharedTableName", loaded->SharedTableName, "");
+	reader.Bind("Cluster.SharedTableWriter", loaded->SharedTableWriter, false);
+	reader.Bind("Cluster.SharedTableCapacity", loaded->SharedTableCapacity, 65536);
+
+	reader.Bind("General.TickBudgetInMicros", loaded->TickBudgetInMicros, 2000);
+	reader.Bind("General.BlockedDamageLogIntervalInSecs", loaded->BlockedDamageLogIntervalInSecs, 60);
+	reader.Bind("General.RaidStatsDumpIntervalInMins", loaded->RaidStatsDumpIntervalInMins, 10);
+	reader.Bind("General.DBSynchronous", loaded->DBSynchronous, "NORMAL");
+	reader.Bind("General.DBCacheSizeKiB", loaded->DBCacheSizeKiB, 8192);
+	reader.Bind("General.DBMmapSizeMB", loaded->DBMmapSizeMB, 64);
+	reader.Bind("General.DBTempStore", loaded->DBTempStore, "MEMORY");
+	reader.Bind("General.DBWalAutoCheckpointPages", loaded->DBWalAutoCheckpointPages, 1000);
+	reader.Bind("General.DBOptimizeEverySaves", loaded->DBOptimizeEverySaves, 24);
+	reader.Bind("General.BackupEveryHours", loaded->BackupEveryHours, 6);
+	reader.Bind("General.BackupsToKeep", loaded->BackupsToKeep, 8);
+	reader.Bind("General.BackupPagesPerStep", loaded->BackupPagesPerStep, 256);
+	reader.Bind("General.BackupStepDelayInMs", loaded->BackupStepDelayInMs, 10);
+	reader.Bind("General.ExportEveryHours", loaded->ExportEveryHours, 0);
+	reader.Bind("General.ExportFormat", loaded->ExportFormat, "csv");
+	reader.Bind("General.IntegrityCheckEveryHours", loaded->IntegrityCheckEveryHours, 24);
+	reader.Bind("General.IntegrityCheckStartHour", loaded->IntegrityCheckStartHour, 4);
+	reader.Bind("General.IntegrityCheckEndHour", loaded->IntegrityCheckEndHour, 8);
+	reader.Bind("General.IntegrityCheckMaxOnlinePlayers", loaded->IntegrityCheckMaxOnlinePlayers, 5);
+	reader.Bind("General.IntegrityCheckPauseInMs", loaded->IntegrityCheckPauseInMs, 2);
+	reader.Bind("General.BackgroundThreadPriority", loaded->BackgroundThreadPriority, "below_normal");
+	reader.Bind("General.BackgroundThreadAffinityMask", loaded->BackgroundThreadAffinityMask, 0);
+	reader.Bind("General.UnloadTimeoutInSecs", loaded->UnloadTimeoutInSecs, 15);
+	reader.Bind("General.ExpiryWarningInMins", loaded->ExpiryWarningInMins, 60);
+	reader.Bind("General.StatusPushIntervalInMins", loaded->StatusPushIntervalInMins, 0);
+	reader.Bind("General.StatusPushOnLogin", loaded->StatusPushOnLogin, false);
+	reader.Bind("General.DBBusyTimeoutInMs", loaded->DBBusyTimeoutInMs, 5000);
+	reader.Bind("General.AdminCommandsPerSec", loaded->AdminCommandsPerSec, 200);
+	reader.Bind("General.NPPCommandPrefix", [&loaded](const nlohmann::json& value, size_t)
+	{
+		loaded->NPPCommandPrefix = NewPlayerProtection::ToFString(value.get<std::string>());
+	});
+	reader.Bind("General.NPPAdminGroup", [&loaded](const nlohmann::json& value, size_t)
+	{
+		loaded->NPPAdminGroup = NewPlayerProtection::ToFString(value.get<std::string>());
+	});
+
+	reader.Bind("General.MessageIntervalInSecs", loaded->MessageIntervalInSecs);
+	reader.Bind("General.MessageTextSize", loaded->MessageTextSize);
+	reader.Bind("General.MessageDisplayDelay", loaded->MessageDisplayDelay);
+	reader.Bind("General.MessageColor", [&loaded](const nlohmann::json& value, size_t index)
+	{
+		float* channels[] = { &loaded->MessageColor.R, &loaded->MessageColor.G, &loaded->MessageColor.B, &loaded->MessageColor.A };
+
+		if (index < 4)
+		{
+			*channels[index] = value.get<float>();
+		}
+	});
+
+	reader.Bind("General.NewPlayerProtection.NewPlayerMaxLevel", loaded->MaxLevel);
+	reader.Bind("General.NewPlayerProtection.HoursOfProtection", loaded->HoursOfProtection);
 
 	//Load exception structures from config
-	NewPlayerProtection::TempConfig = NewPlayerProtection::config["General"]["StructureExemptions"];
+	reader.Bind("General.StructureExemptions", [&loaded](const nlohmann::json& value, size_t)
+	{
+		loaded->StructureExemptions.Add(ArkApi::Tools::Utf8Decode(value.get<std::string>()));
+	},
+	[&loaded]()
+	{
+		loaded->StructureExemptions = NewPlayerProtection::StructureExemptionSet();
+	});
+
+	if (!nlohmann::json::sax_parse(file, &reader))
+	{
+		NPP_LOG(err, "({} {}) Could not parse {}: {}", __FILE__, __FUNCTION__, path, reader.GetError());
+		return nullptr;
+	}
+
+	//same bindings, so a key the override sets replaces the base's value and the messages it has replace the base's text
+	if (!override_path.empty())
+	{
+		std::ifstream override_file(override_path);
+
+		if (override_file.is_open() && !nlohmann::json::sax_parse(override_file, &reader))
+		{
+			NPP_LOG(err, "({} {}) Could not parse {}: {}", __FILE__, __FUNCTION__, override_path, reader.GetError());
+			return nullptr;
+		}
+	}
+
+	LoadMessage(loaded->NewPlayerDoingDamageMessage, reader, "NewPlayerDoingDamageMessage");
+	LoadMessage(loaded->NewPlayerStructureTakingDamageMessage, reader, "NewPlayerStructureTakingDamageMessage");
+	LoadMessage(loaded->NewPlayerStructureTakingDamageFromUnknownTribemateMessage, reader, "NewPlayerStructureTakingDamageFromUnknownTribemateMessage");
+
+	LoadMessage(loaded->NPPRemainingMessage, reader, "NPPRemainingMessage");
+	LoadMessage(loaded->NPPInfoMessage, reader, "NPPInfoMessage");
+	LoadMessage(loaded->NPPInvalidCommand, reader, "NPPInvalidCommand");
+	LoadMessage(loaded->NewPlayerProtectionDisableSuccess, reader, "NewPlayerProtectionDisableSuccess");
+	LoadMessage(loaded->NotANewPlayerMessage, reader, "NotANewPlayerMessage");
+	LoadMessage(loaded->NotTribeAdminMessage, reader, "NotTribeAdminMessage");
+	LoadMessage(loaded->TribeIDText, reader, "TribeIDText");
+	LoadMessage(loaded->NoStructureForTribeIDText, reader, "NoStructureForTribeIDText");
+	LoadMessage(loaded->PVEDisablePlayerMessage, reader, "PVEDisablePlayerMessage");
+	LoadMessage(loaded->PVEStatusMessage, reader, "PVEStatusMessage");
+	LoadMessage(loaded->NotAStructureMessage, reader, "NotAStructureMessage");
+	LoadMessage(loaded->NPPExpiringMessage, reader, "NPPExpiringMessage", "Your tribe's New Player Protection ends in {} minute(s)!");
+	LoadMessage(loaded->NPPEndedMessage, reader, "NPPEndedMessage", "Your tribe is no longer under New Player Protection!");
+	
+	LoadMessage(loaded->AdminNoTribeExistsMessage, reader, "AdminNoTribeExistsMessage");
+	LoadMessage(loaded->AdminTribeProtectionRemoved, reader, "AdminTribeProtectionRemoved");
+	LoadMessage(loaded->AdminTribeNotUnderProtection, reader, "AdminTribeNotUnderProtection");
+	LoadMessage(loaded->AdminResetTribeProtectionSuccess, reader, "AdminResetTribeProtectionSuccess");
+	LoadMessage(loaded->AdminResetTribeProtectionLvlFailure, reader, "AdminResetTribeProtectionLvlFailure");
+	LoadMessage(loaded->AdminPVETribeAddedSuccessMessage, reader, "AdminPVETribeAddedSuccessMessage");
+	LoadMessage(loaded->AdminPVETribeAlreadyAddedMessage, reader, "AdminPVETribeAlreadyAddedMessage");
+	LoadMessage(loaded->AdminPVETribeRemovedSuccessMessage, reader, "AdminPVETribeRemovedSuccessMessage");
+	LoadMessage(loaded->AdminPVETribeAlreadyRemovedMessage, reader, "AdminPVETribeAlreadyRemovedMessage");
+	LoadMessage(loaded->AdminBulkSummaryMessage, reader, "AdminBulkSummaryMessage", "{}: {} tribe(s) changed, {} unchanged, {} not found");
 
-	for (nlohmann::json x : NewPlayerProtection::TempConfig)
+	return loaded;
+}
+
+//values the plugin can't run with, only checked before a watched reload swaps a snapshot in
+inline bool ValidateSettings(const NewPlayerProtection::Settings& loaded, std::string& error)
+{
+	if (loaded.PlayerUpdateIntervalInMins < 1)
+		error = "PlayerUpdateIntervalInMins must be at least 1";
+	else if (loaded.NPPPlayerDecayInHours < 1)
+		error = "NPPPlayerDecayInHours must be at least 1";
+	else if (loaded.MaxLevel < 1)
+		error = "NewPlayerMaxLevel must be at least 1";
+	else if (loaded.HoursOfProtection < 0)
+		error = "HoursOfProtection can't be negative";
+	else if (loaded.MessageIntervalInSecs < 0)
+		error = "MessageIntervalInSecs can't be negative";
+	else if (loaded.TickBudgetInMicros < 0)
+		error = "TickBudgetInMicros can't be negative";
+	else if (loaded.NPPCommandPrefix.IsEmpty())
+		error = "NPPCommandPrefix is empty";
+
+	return error.empty();
+}
+
+inline void PublishSettings(std::shared_ptr<NewPlayerProtection::Settings> loaded)
+{
+	NewPlayerProtection::next_player_update = std::chrono::steady_clock::now();
+
+	//published whole, nothing reads a half loaded config
+	std::atomic_store(&NewPlayerProtection::settings, std::shared_ptr<const NewPlayerProtection::Settings>(std::move(loaded)));
+	NewPlayerProtection::Epochs.BumpConfig();
+
+	const auto current = NewPlayerProtection::GetSettings();
+	NewPlayerProtection::SelectStructureDamageCheck(*current);
+	NewPlayerProtection::DamageCapture::Get().Configure(current->CaptureDamageEvents, current->DamageCaptureMaxEvents,
+		ArkApi::Tools::GetCurrentDir() + "/ArkApi/Plugins/NewPlayerProtection/DamageCapture.bin");
+	NewPlayerProtection::AuditLog::Get().Configure(current->AuditProtectionChanges,
+		ArkApi::Tools::GetCurrentDir() + "/ArkApi/Plugins/NewPlayerProtection/ProtectionAudit.jsonl");
+}
+
+inline void LoadConfig()
+{
+	const std::string directory = ArkApi::Tools::GetCurrentDir() + "/ArkApi/Plugins/NewPlayerProtection/";
+	const std::string map_config = MapConfigFileName();
+
+	auto loaded = ReadSettings(directory + "config.json", map_config.empty() ? std::string() : directory + map_config);
+
+	if (loaded)
 	{
-		NewPlayerProtection::StructureExemptions.push_back(FString(ArkApi::Tools::Utf8Decode(x).c_str()).ToString());
+		PublishSettings(std::move(loaded));
 	}
 }
 
 inline void InitConfig()
 {
 	LoadConfig();
-	LoadDB();
+
+	NewPlayerProtection::replicaMode = NewPlayerProtection::GetSettings()->ClusterReplicaMode;
+
+	//its constructor registers the timer callback, which has to happen here and not on the loader thread
+	NewPlayerProtection::TimerProt::Get();
+
+	NewPlayerProtection::dbLoader = std::thread([]
+	{
+		NewPlayerProtection::ApplyBackgroundThreadSettings("loader");
+		LoadDB();
+		NewPlayerProtection::dbLoaded.store(true, std::memory_order_release);
+	});
 }
 
 
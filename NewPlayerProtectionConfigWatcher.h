@@ -0,0 +1,227 @@
+#pragma once
+
+#include <mutex>
+#include <thread>
+
+namespace NewPlayerProtection
+{
+	//watches the plugin folder for writes to config.json or the map's override and reloads both without NPP.ReloadConfig.
+	//the file is parsed on the watcher thread once it has been quiet for debounce_, the game thread only swaps
+	//in a snapshot that parsed and validated, so a half saved or broken file never replaces the running config.
+	class ConfigWatcher
+	{
+		public:
+			static ConfigWatcher& Get();
+
+			ConfigWatcher(const ConfigWatcher&) = delete;
+			ConfigWatcher(ConfigWatcher&&) = delete;
+			ConfigWatcher& operator=(const ConfigWatcher&) = delete;
+			ConfigWatcher& operator=(ConfigWatcher&&) = delete;
+
+			//override_name may be empty
+			void Start(const std::string& directory, const std::string& file_name, const std::string& override_name);
+			void Stop();
+
+		private:
+			ConfigWatcher() = default;
+			~ConfigWatcher() = default;
+
+			void Run(HANDLE directory, HANDLE stop_event);
+			//true when a notification buffer names a watched file, an overflowed buffer counts as a change
+			bool NamesWatchedFile(const char* buffer, DWORD bytes) const;
+			void ReadPending();
+			void Tick();
+
+			static constexpr std::chrono::milliseconds debounce_{ 500 };
+
+			std::string path_;
+			std::string override_path_;
+			std::vector<std::wstring> file_names_;
+			HANDLE stop_event_ = nullptr;
+			std::thread thread_;
+			bool running_ = false;
+
+			std::mutex mutex_;
+			//parsed and validated on the watcher thread, applied on the next tick
+			std::shared_ptr<Settings> pending_;
+	};
+}
+
+NewPlayerProtection::ConfigWatcher& NewPlayerProtection::ConfigWatcher::Get()
+{
+	static ConfigWatcher instance;
+	return instance;
+}
+
+void NewPlayerProtection::ConfigWatcher::Start(const std::string& directory, const std::string& file_name, const std::string& override_name)
+{
+	if (running_)
+		return;
+
+	const HANDLE handle = CreateFileW(ArkApi::Tools::Utf8Decode(directory).c_str(), FILE_LIST_DIRECTORY,
+		FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+
+	if (handle == INVALID_HANDLE_VALUE)
+	{
+		NPP_LOG(err, "({} {}) Could not watch {}, error {}", __FILE__, __FUNCTION__, directory, GetLastError());
+		return;
+	}
+
+	path_ = directory + "/" + file_name;
+	override_path_ = override_name.empty() ? std::string() : directory + "/" + override_name;
+	file_names_ = { ArkApi::Tools::Utf8Decode(file_name) };
+
+	if (!override_name.empty())
+	{
+		file_names_.push_back(ArkApi::Tools::Utf8Decode(override_name));
+	}
+	stop_event_ = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+	running_ = true;
+
+	//the thread owns both handles and closes them when it exits
+	thread_ = std::thread(&ConfigWatcher::Run, this, handle, stop_event_);
+	ArkApi::GetCommands().AddOnTimerCallback("NPPConfigWatcher", std::bind(&NewPlayerProtection::ConfigWatcher::Tick, this));
+
+	NPP_LOG(info, "NPP is watching {} for changes.", path_);
+}
+
+void NewPlayerProtection::ConfigWatcher::Stop()
+{
+	if (!running_)
+		return;
+
+	running_ = false;
+	ArkApi::GetCommands().RemoveOnTimerCallback("NPPConfigWatcher");
+
+	//the thread cancels its read and exits on its own, joining here could hang under the loader lock
+	SetEvent(stop_event_);
+	stop_event_ = nullptr;
+
+	if (thread_.joinable())
+	{
+		thread_.detach();
+	}
+}
+
+void NewPlayerProtection::ConfigWatcher::Run(HANDLE directory, HANDLE stop_event)
+{
+	NewPlayerProtection::ApplyBackgroundThreadSettings("config watcher");
+
+	OVERLAPPED overlapped{};
+	overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+
+	alignas(DWORD) char buffer[16 * 1024];
+	bool read_pending = false;
+	bool changed = false;
+
+	while (true)
+	{
+		if (!read_pending)
+		{
+			ResetEvent(overlapped.hEvent);
+
+			if (!ReadDirectoryChangesW(directory, buffer, sizeof(buffer), FALSE,
+				FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE, nullptr, &overlapped, nullptr))
+			{
+				NPP_LOG(err, "({} {}) Could not watch for config changes, error {}", __FILE__, __FUNCTION__, GetLastError());
+				break;
+			}
+			read_pending = true;
+		}
+
+		//editors write a file in several steps, so wait until it has been quiet before reading it
+		const HANDLE handles[] = { stop_event, overlapped.hEvent };
+		const DWORD wait = WaitForMultipleObjects(2, handles, FALSE, changed ? static_cast<DWORD>(debounce_.count()) : INFINITE);
+
+		if (wait == WAIT_OBJECT_0 + 1)
+		{
+			DWORD bytes = 0;
+			read_pending = false;
+
+			if (GetOverlappedResult(directory, &overlapped, &bytes, FALSE) && NamesWatchedFile(buffer, bytes))
+			{
+				changed = true;
+			}
+		}
+		else if (wait == WAIT_TIMEOUT)
+		{
+			changed = false;
+			ReadPending();
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if (read_pending)
+	{
+		CancelIoEx(directory, &overlapped);
+
+		DWORD bytes = 0;
+		GetOverlappedResult(directory, &overlapped, &bytes, TRUE);
+	}
+
+	CloseHandle(overlapped.hEvent);
+	CloseHandle(directory);
+	CloseHandle(stop_event);
+}
+
+bool NewPlayerProtection::ConfigWatcher::NamesWatchedFile(const char* buffer, DWORD bytes) const
+{
+	if (bytes == 0)
+		return true;
+
+	for (DWORD offset = 0;;)
+	{
+		const auto* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(buffer + offset);
+		const std::wstring_view name(info->FileName, info->FileNameLength / sizeof(WCHAR));
+
+		for (const auto& file_name : file_names_)
+		{
+			if (name.size() == file_name.size() && _wcsnicmp(name.data(), file_name.c_str(), name.size()) == 0)
+				return true;
+		}
+
+		if (info->NextEntryOffset == 0)
+			return false;
+
+		offset += info->NextEntryOffset;
+	}
+}
+
+void NewPlayerProtection::ConfigWatcher::ReadPending()
+{
+	auto loaded = ReadSettings(path_, override_path_);
+
+	if (!loaded)
+	{
+		NPP_LOG(warn, "NPP config {} changed but could not be read, keeping the current config.", path_);
+		return;
+	}
+
+	std::string error;
+
+	if (!ValidateSettings(*loaded, error))
+	{
+		NPP_LOG(warn, "NPP config {} changed but is not valid, keeping the current config: {}", path_, error);
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	pending_ = std::move(loaded);
+}
+
+void NewPlayerProtection::ConfigWatcher::Tick()
+{
+	std::shared_ptr<Settings> loaded;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		loaded = std::move(pending_);
+	}
+
+	if (loaded)
+	{
+		ReloadConfig(std::move(loaded));
+	}
+}
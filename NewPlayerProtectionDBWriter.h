@@ -0,0 +1,694 @@
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <random>
+
+namespace NewPlayerProtection
+{
+	//statements prepared once per connection, rebound for every row
+	struct SaveStatements
+	{
+		explicit SaveStatements(sqlite::database& db)
+			:
+			upsert_player(db << "INSERT OR REPLACE INTO Players(SteamId, TribeId, Start_DateTime, Last_Login_DateTime, Level, Is_New_Player) VALUES(?,?,?,?,?,?);"),
+			upsert_pve_tribe(db << "INSERT OR REPLACE INTO PVE_Tribes(TribeId, Is_Protected) VALUES(?,?);"),
+			upsert_tribe(db << "INSERT OR REPLACE INTO Tribes(TribeId, Oldest_Start_DateTime, Max_Level, Is_Protected, Is_PVE, Member_Count) VALUES(?,?,?,?,?,?);"),
+			delete_tribe(db << "DELETE FROM Tribes WHERE TribeId = ?;")
+		{
+			//nothing bound yet, keep the destructor from executing them
+			upsert_player.used(true);
+			upsert_pve_tribe.used(true);
+			upsert_tribe.used(true);
+			delete_tribe.used(true);
+		}
+		sqlite::database_binder upsert_player;
+		sqlite::database_binder upsert_pve_tribe;
+		sqlite::database_binder upsert_tribe;
+		sqlite::database_binder delete_tribe;
+	};
+}
+
+//another map writing the same file, the whole batch is rolled back and written again instead of skipping the row
+bool IsLockError(const sqlite::sqlite_exception& exception)
+{
+	return exception.get_code() == SQLITE_BUSY || exception.get_code() == SQLITE_LOCKED;
+}
+
+void UpdatePlayerDB(NewPlayerProtection::SaveStatements& statements, const NewPlayerProtection::TimerProt::PlayerRecord& data)
+{
+	try
+	{
+		statements.upsert_player << data.steam_id << data.tribe_id << NewPlayerProtection::ToEpochMs(data.StartDateTime()) << NewPlayerProtection::ToEpochMs(data.LastLoginDateTime()) << static_cast<int>(data.level) << static_cast<int>(data.isNewPlayer);
+		statements.upsert_player.execute();
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		if (IsLockError(exception))
+			throw;
+
+		NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+	}
+}
+
+void UpdatePVETribeDB(NewPlayerProtection::SaveStatements& statements, uint64 tribe_id, bool stillProtected)
+{
+	try
+	{
+		statements.upsert_pve_tribe << tribe_id << stillProtected;
+		statements.upsert_pve_tribe.execute();
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		if (IsLockError(exception))
+			throw;
+
+		NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+	}
+}
+
+void UpdateTribeDB(NewPlayerProtection::SaveStatements& statements, uint64 tribe_id, const NewPlayerProtection::TimerProt::TribeData& data)
+{
+	try
+	{
+		//no members left
+		if (data.memberCount == 0)
+		{
+			statements.delete_tribe << tribe_id;
+			statements.delete_tribe.execute();
+			return;
+		}
+
+		//admin only tribes have no start date
+		const int64 oldest_start = data.oldestStartDateTime == std::chrono::time_point<std::chrono::system_clock>::max() ? 0 : NewPlayerProtection::ToEpochMs(data.oldestStartDateTime);
+
+		statements.upsert_tribe << tribe_id << oldest_start << data.maxLevel << data.isProtected << data.isPVE << static_cast<int64>(data.memberCount);
+		statements.upsert_tribe.execute();
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		if (IsLockError(exception))
+			throw;
+
+		NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+	}
+}
+
+namespace NewPlayerProtection
+{
+	//snapshot of everything one save needs to write, owned by the writer once queued
+	struct SaveBatch
+	{
+		std::vector<TimerProt::PlayerRecord> players;
+		std::vector<std::pair<uint64, bool>> pveTribes;
+		std::vector<std::pair<uint64, TimerProt::TribeData>> tribes;
+		//written once the rows are committed, batches without one mark the last snapshot as stale
+		std::shared_ptr<const Snapshot> snapshot;
+		//journal segments up to this one only hold rows of this batch or an earlier one, 0 for none
+		uint64 journalSegment = 0;
+		//holds rows of several saves, Coalesce keeps the newest per key
+		bool merged = false;
+		//NPP.Wipe, the tables are emptied in the same transaction before the rows are written
+		bool wipe = false;
+
+		//keeps the capacity, a recycled batch fills without allocating
+		void Clear()
+		{
+			players.clear();
+			pveTribes.clear();
+			tribes.clear();
+			snapshot.reset();
+			journalSegment = 0;
+			merged = false;
+			wipe = false;
+		}
+
+		//appends a later save, its rows win over the ones already here
+		void Merge(SaveBatch&& later)
+		{
+			//rows saved before a wipe would only be deleted again
+			if (later.wipe)
+			{
+				players.clear();
+				pveTribes.clear();
+				tribes.clear();
+				wipe = true;
+			}
+
+			players.insert(players.end(), later.players.begin(), later.players.end());
+			pveTribes.insert(pveTribes.end(), later.pveTribes.begin(), later.pveTribes.end());
+			tribes.insert(tribes.end(), later.tribes.begin(), later.tribes.end());
+			snapshot = std::move(later.snapshot);
+			journalSegment = later.journalSegment;
+			merged = true;
+		}
+
+		//drops every row a later one of the same key replaces, keeps the order of the rest
+		void Coalesce();
+	};
+
+	class DBWriter
+	{
+		public:
+			static DBWriter& Get();
+
+			DBWriter(const DBWriter&) = delete;
+			DBWriter(DBWriter&&) = delete;
+			DBWriter& operator=(const DBWriter&) = delete;
+			DBWriter& operator=(DBWriter&&) = delete;
+
+			void Start(const std::string& db_path);
+			void Stop(std::chrono::milliseconds timeout);
+
+			//an empty batch, reusing the buffers of one already written when there is one
+			SaveBatch AcquireBatch();
+			void Enqueue(SaveBatch&& batch);
+			size_t GetQueueDepth();
+			//a wipe batch was queued and is not committed yet, the tables may still hold the rows it deletes
+			bool IsWipePending() const
+			{
+				return wipe_pending_.load(std::memory_order_acquire);
+			}
+			//deletes rows last seen at or before cutoff_ms once the queued saves are written, dry_run only counts them
+			void QueuePurge(int64 cutoff_ms, bool dry_run);
+
+		private:
+			DBWriter() = default;
+			~DBWriter() = default;
+
+			//Locked when another connection held the lock past busy_timeout, Locked and Failed leave nothing of the batch written
+			enum class WriteResult
+			{
+				Written,
+				Locked,
+				Failed
+			};
+
+			void Run(sqlite::database db);
+			WriteResult WriteBatch(sqlite::database& db, SaveStatements& statements, const SaveBatch& batch);
+			void PurgeDecayedPlayers(sqlite::database& db, int64 cutoff_ms, bool dry_run);
+			//caller holds mutex_
+			void Recycle(SaveBatch&& batch);
+
+			//queued batches are merged into the last one past this, nothing is dropped
+			static constexpr size_t max_queued_batches_ = 8;
+			//written batches kept for reuse, one per save in flight is enough
+			static constexpr size_t max_spare_batches_ = 2;
+			//wait before writing a locked batch again, doubled up to the max on every failed attempt
+			static constexpr std::chrono::milliseconds min_retry_delay_{ 250 };
+			static constexpr std::chrono::milliseconds max_retry_delay_{ 8000 };
+
+			std::thread thread_;
+			std::mutex mutex_;
+			std::condition_variable queue_cv_;
+			std::condition_variable drained_cv_;
+			std::deque<SaveBatch> queue_;
+			std::vector<SaveBatch> spare_;
+			bool running_ = false;
+			bool stop_ = false;
+			bool busy_ = false;
+			//only touched by whichever thread writes the batch
+			int saves_since_optimize_ = 0;
+
+			//rows per transaction, a save queued during a purge waits for one chunk at most
+			static constexpr int purge_chunk_rows_ = 1000;
+			bool purge_pending_ = false;
+			std::atomic<bool> wipe_pending_{ false };
+			int64 purge_cutoff_ms_ = 0;
+			bool purge_dry_run_ = false;
+			//set in Start, purged rows are copied to archive.Players first
+			bool archive_ = false;
+	};
+}
+
+template <typename Row, typename Key>
+void CoalesceRows(std::vector<Row>& rows, Key&& key)
+{
+	std::unordered_set<uint64> seen;
+	seen.reserve(rows.size());
+
+	//newest first, so the first row of a key is the one to keep
+	auto kept = rows.rend();
+
+	for (auto iter = rows.rbegin(); iter != rows.rend(); ++iter)
+	{
+		if (seen.insert(key(*iter)).second)
+		{
+			*--kept = std::move(*iter);
+		}
+	}
+
+	rows.erase(rows.begin(), kept.base());
+}
+
+void NewPlayerProtection::SaveBatch::Coalesce()
+{
+	if (!merged)
+		return;
+
+	CoalesceRows(players, [](const TimerProt::PlayerRecord& data) { return data.steam_id; });
+	CoalesceRows(pveTribes, [](const std::pair<uint64, bool>& tribe) { return tribe.first; });
+	CoalesceRows(tribes, [](const std::pair<uint64, TimerProt::TribeData>& tribe) { return tribe.first; });
+	merged = false;
+}
+
+NewPlayerProtection::DBWriter& NewPlayerProtection::DBWriter::Get()
+{
+	static DBWriter instance;
+	return instance;
+}
+
+void NewPlayerProtection::DBWriter::Start(const std::string& db_path)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	if (running_)
+		return;
+
+	try
+	{
+		//own connection, the game thread keeps using GetDB() for reads
+		sqlite::database db(db_path);
+		ApplyConnectionProfile(db, *NewPlayerProtection::GetSettings());
+		archive_ = NewPlayerProtection::GetSettings()->ArchiveDecayedPlayers && AttachArchive(db);
+
+		running_ = true;
+		stop_ = false;
+		thread_ = std::thread(&DBWriter::Run, this, db);
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		NPP_LOG(err, "({} {}) Could not open writer connection, saving on the game thread: {}", __FILE__, __FUNCTION__, exception.what());
+	}
+}
+
+void NewPlayerProtection::DBWriter::Stop(std::chrono::milliseconds timeout)
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+
+	if (!running_)
+		return;
+
+	stop_ = true;
+	queue_cv_.notify_one();
+
+	//called from DllMain, so wait for the queue to drain instead of joining under the loader lock
+	if (!drained_cv_.wait_for(lock, timeout, [this] { return queue_.empty() && !busy_; }))
+	{
+		NPP_LOG(warn, "NPP database writer did not finish in time, {} batches were not written.", queue_.size());
+	}
+
+	running_ = false;
+	lock.unlock();
+
+	if (thread_.joinable())
+	{
+		thread_.detach();
+	}
+}
+
+NewPlayerProtection::SaveBatch NewPlayerProtection::DBWriter::AcquireBatch()
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	if (spare_.empty())
+		return SaveBatch();
+
+	SaveBatch batch = std::move(spare_.back());
+	spare_.pop_back();
+	return batch;
+}
+
+void NewPlayerProtection::DBWriter::Recycle(SaveBatch&& batch)
+{
+	if (spare_.size() >= max_spare_batches_)
+		return;
+
+	batch.Clear();
+	spare_.push_back(std::move(batch));
+}
+
+void NewPlayerProtection::DBWriter::Enqueue(SaveBatch&& batch)
+{
+	//the home map writes for the whole cluster, cluster rows and NPP.Wipe included, a replica only changes its memory
+	if (NewPlayerProtection::IsReplica())
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Recycle(std::move(batch));
+		return;
+	}
+
+	if (batch.wipe)
+	{
+		wipe_pending_.store(true, std::memory_order_release);
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+
+		if (!running_)
+		{
+			lock.unlock();
+
+			try
+			{
+				static SaveStatements statements(NewPlayerProtection::GetDB());
+				batch.Coalesce();
+
+				if (WriteBatch(NewPlayerProtection::GetDB(), statements, batch) != WriteResult::Locked && batch.wipe)
+				{
+					wipe_pending_.store(false, std::memory_order_release);
+				}
+			}
+			catch (const sqlite::sqlite_exception& exception)
+			{
+				NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+			}
+
+			lock.lock();
+			Recycle(std::move(batch));
+			return;
+		}
+
+		if (queue_.size() >= max_queued_batches_)
+		{
+			//writer is behind, fold into the newest batch, the writer keeps the newest row of each key
+			queue_.back().Merge(std::move(batch));
+			Recycle(std::move(batch));
+		}
+		else
+		{
+			queue_.push_back(std::move(batch));
+		}
+	}
+	queue_cv_.notify_one();
+}
+
+size_t NewPlayerProtection::DBWriter::GetQueueDepth()
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return queue_.size() + (busy_ ? 1 : 0);
+}
+
+void NewPlayerProtection::DBWriter::QueuePurge(int64 cutoff_ms, bool dry_run)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		//never on the game thread, a large purge takes seconds
+		if (!running_)
+			return;
+
+		purge_pending_ = true;
+		purge_cutoff_ms_ = cutoff_ms;
+		purge_dry_run_ = dry_run;
+	}
+	queue_cv_.notify_one();
+}
+
+void NewPlayerProtection::DBWriter::PurgeDecayedPlayers(sqlite::database& db, int64 cutoff_ms, bool dry_run)
+{
+	const auto started = std::chrono::steady_clock::now();
+
+	try
+	{
+		if (dry_run)
+		{
+			int64 count = 0;
+			db << "SELECT COUNT(*) FROM Players WHERE Last_Login_DateTime <= ?;" << cutoff_ms >> count;
+
+			NPP_LOG(info, "NPP purge dry run, {} decayed player rows would be {}.", count, archive_ ? "archived" : "deleted");
+			return;
+		}
+
+		//the ids of one chunk, so the archive copy and the delete see the same rows
+		db << "CREATE TEMP TABLE IF NOT EXISTS PurgeChunk(SteamId integer primary key);";
+
+		const int64 archived_ms = NewPlayerProtection::ToEpochMs(std::chrono::system_clock::now());
+		size_t total = 0;
+
+		while (true)
+		{
+			db << "BEGIN TRANSACTION;";
+			db << "DELETE FROM PurgeChunk;";
+			db << "INSERT INTO PurgeChunk SELECT SteamId FROM main.Players WHERE Last_Login_DateTime <= ? LIMIT ?;"
+				<< cutoff_ms << purge_chunk_rows_;
+
+			//copied before the delete, a crash between the two databases leaves a row in both rather than in neither
+			if (archive_)
+			{
+				db << "INSERT OR REPLACE INTO archive.Players(SteamId, TribeId, Start_DateTime, Last_Login_DateTime, Level, Is_New_Player, Archived_DateTime) "
+					"SELECT SteamId, TribeId, Start_DateTime, Last_Login_DateTime, Level, Is_New_Player, ? FROM main.Players WHERE SteamId IN PurgeChunk;"
+					<< archived_ms;
+			}
+
+			db << "DELETE FROM main.Players WHERE SteamId IN PurgeChunk;";
+			const int deleted = sqlite3_changes(db.connection().get());
+			db << "END TRANSACTION;";
+
+			total += static_cast<size_t>(deleted);
+
+			if (deleted < purge_chunk_rows_)
+				break;
+
+			//a save or unload queued in the meantime goes first, the rest is purged next time
+			std::lock_guard<std::mutex> lock(mutex_);
+
+			if (stop_ || !queue_.empty())
+			{
+				purge_pending_ = true;
+				break;
+			}
+		}
+
+		//only returns the freed pages to the file system when the database was created with auto_vacuum = INCREMENTAL
+		int auto_vacuum = 0;
+		db << "PRAGMA auto_vacuum;" >> auto_vacuum;
+
+		if (total > 0 && auto_vacuum == 2)
+		{
+			db << "PRAGMA main.incremental_vacuum;";
+		}
+
+		NPP_LOG(info, "NPP {} {} decayed player rows in {} ms.", archive_ ? "archived" : "purged", total,
+			std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started).count());
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+
+		try
+		{
+			db << "ROLLBACK;";
+		}
+		catch (const sqlite::sqlite_exception&)
+		{
+		}
+	}
+}
+
+NewPlayerProtection::DBWriter::WriteResult NewPlayerProtection::DBWriter::WriteBatch(sqlite::database& db, SaveStatements& statements, const SaveBatch& batch)
+{
+	const auto started = std::chrono::steady_clock::now();
+	bool committed = false;
+
+	//whatever BEGIN left open is undone, past the commit there is nothing to roll back
+	const auto rollback = [&db, &committed]()
+	{
+		if (committed)
+			return;
+
+		try
+		{
+			db << "ROLLBACK;";
+		}
+		catch (const sqlite::sqlite_exception&)
+		{
+		}
+	};
+
+	try
+	{
+		//takes the write lock up front, a deferred transaction could fail on its first write without waiting for busy_timeout
+		db << "BEGIN IMMEDIATE TRANSACTION;";
+
+		//without a WHERE sqlite drops the pages of the tables instead of deleting row by row
+		if (batch.wipe)
+		{
+			db << "DELETE FROM Players;";
+			db << "DELETE FROM Tribes;";
+			db << "DELETE FROM PVE_Tribes;";
+		}
+
+		for (const auto& data : batch.players)
+		{
+			UpdatePlayerDB(statements, data);
+		}
+
+		for (const auto& tribe : batch.pveTribes)
+		{
+			UpdatePVETribeDB(statements, tribe.first, tribe.second);
+		}
+
+		for (const auto& tribe : batch.tribes)
+		{
+			UpdateTribeDB(statements, tribe.first, tribe.second);
+		}
+
+		try
+		{
+			db << "UPDATE Snapshot_State SET Generation = ? WHERE Id = 1;" << (batch.snapshot ? batch.snapshot->generation : 0);
+		}
+		catch (const sqlite::sqlite_exception& exception)
+		{
+			NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+		}
+
+		db << "END TRANSACTION;";
+		committed = true;
+
+		//the rows are in the table now, their journal segments can go
+		if (batch.journalSegment != 0)
+		{
+			NewPlayerProtection::Journal::Get().Compact(batch.journalSegment);
+		}
+
+		//passive never waits for the game thread's readers, whatever it can't copy now goes with the next save
+		db << "PRAGMA wal_checkpoint(PASSIVE);";
+
+		if (++saves_since_optimize_ >= std::max(1, NewPlayerProtection::GetSettings()->DBOptimizeEverySaves))
+		{
+			saves_since_optimize_ = 0;
+			db << "PRAGMA optimize;";
+		}
+
+		if (batch.snapshot)
+		{
+			WriteSnapshot(*batch.snapshot);
+		}
+
+		NewPlayerProtection::GetCounters().lastSaveDurationMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started).count();
+
+		if (batch.wipe)
+		{
+			Log::GetLog()->info("NPP database wiped.");
+		}
+
+		NPP_LOG(info, "NPP database updated during world save. {} player records written.", batch.players.size());
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		rollback();
+
+		if (!committed && IsLockError(exception))
+			return WriteResult::Locked;
+
+		NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+	}
+	catch (const std::exception& exception)
+	{
+		rollback();
+		NPP_LOG(err, "({} {}) Unexpected error {}", __FILE__, __FUNCTION__, exception.what());
+	}
+	return committed ? WriteResult::Written : WriteResult::Failed;
+}
+
+void NewPlayerProtection::DBWriter::Run(sqlite::database db)
+{
+	NewPlayerProtection::ApplyBackgroundThreadSettings("writer");
+
+	std::unique_ptr<SaveStatements> statements;
+
+	try
+	{
+		statements = std::make_unique<SaveStatements>(db);
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+	}
+
+	std::unique_lock<std::mutex> lock(mutex_);
+	std::minstd_rand jitter(static_cast<uint32>(std::hash<std::thread::id>()(std::this_thread::get_id())));
+	std::chrono::milliseconds retry_delay{ 0 };
+
+	while (true)
+	{
+		queue_cv_.wait(lock, [this] { return stop_ || !queue_.empty() || purge_pending_; });
+
+		//saves first, a purge only runs once they are written
+		if (queue_.empty() && purge_pending_ && !stop_)
+		{
+			purge_pending_ = false;
+			const int64 cutoff_ms = purge_cutoff_ms_;
+			const bool dry_run = purge_dry_run_;
+			busy_ = true;
+			lock.unlock();
+
+			if (statements)
+			{
+				PurgeDecayedPlayers(db, cutoff_ms, dry_run);
+			}
+
+			lock.lock();
+			busy_ = false;
+			continue;
+		}
+
+		if (queue_.empty())
+		{
+			drained_cv_.notify_all();
+			break;
+		}
+
+		SaveBatch batch = std::move(queue_.front());
+		queue_.pop_front();
+
+		//saves that queued up behind this one go out in the same transaction
+		while (!queue_.empty())
+		{
+			batch.Merge(std::move(queue_.front()));
+			Recycle(std::move(queue_.front()));
+			queue_.pop_front();
+		}
+
+		busy_ = true;
+		lock.unlock();
+
+		batch.Coalesce();
+		const WriteResult written = statements ? WriteBatch(db, *statements, batch) : WriteResult::Failed;
+
+		lock.lock();
+		busy_ = false;
+
+		if (written == WriteResult::Locked)
+		{
+			//another map holds the file, wait a little longer every time. the jitter keeps maps that collided from retrying in step
+			retry_delay = std::min(max_retry_delay_, std::max(min_retry_delay_, retry_delay * 2));
+			const auto delay = retry_delay + std::chrono::milliseconds(jitter() % (retry_delay.count() / 2 + 1));
+
+			NPP_LOG(warn, "NPP database is locked by another connection, writing {} player records again in {} ms.", batch.players.size(), delay.count());
+
+			queue_.push_front(std::move(batch));
+			queue_cv_.wait_for(lock, delay, [this] { return stop_; });
+			continue;
+		}
+
+		retry_delay = std::chrono::milliseconds(0);
+
+		//a wipe that failed with anything but a lock is logged by WriteBatch, logins are not held back for it
+		if (batch.wipe)
+		{
+			wipe_pending_.store(false, std::memory_order_release);
+		}
+
+		Recycle(std::move(batch));
+
+		if (queue_.empty())
+		{
+			drained_cv_.notify_all();
+		}
+	}
+}
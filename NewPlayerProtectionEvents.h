@@ -0,0 +1,139 @@
+#pragma once
+
+#include <functional>
+
+namespace NewPlayerProtection
+{
+	enum class ProtectionEventType
+	{
+		ProtectionGained,
+		ProtectionLost,
+		PveEnabled,
+		PveDisabled,
+		//ExpiryWarningInMins before the oldest member's protection runs out
+		ExpiryImminent,
+		//quick_check of the database reported problems, tribe_id is 0 and the details are in the log
+		IntegrityCheckFailed,
+		Count
+	};
+
+	constexpr const char* ProtectionEventNames[] =
+	{
+		"protection_gained",
+		"protection_lost",
+		"pve_enabled",
+		"pve_disabled",
+		"expiry_imminent",
+		"integrity_check_failed"
+	};
+
+	constexpr uint32 TribeFlagProtected = 1;
+	constexpr uint32 TribeFlagPve = 2;
+
+	struct ProtectionEvent
+	{
+		ProtectionEventType type;
+		uint64 tribe_id;
+		//TribeFlag bits of the tribe right after the change
+		uint32 flags;
+		int64 timestamp_ms;
+		//ExpiryImminent only, when the protection runs out
+		int64 expires_ms;
+	};
+
+	//protection changes of the tick, delivered together to every subscriber at the end of UpdateTimer.
+	//game thread only, events raised while the database loads are dropped since they only replay what was saved
+	class EventBus
+	{
+		public:
+			using Handler = std::function<void(const std::vector<ProtectionEvent>& events)>;
+
+			static EventBus& Get();
+
+			EventBus(const EventBus&) = delete;
+			EventBus(EventBus&&) = delete;
+			EventBus& operator=(const EventBus&) = delete;
+			EventBus& operator=(EventBus&&) = delete;
+
+			//replaces a subscriber of the same name
+			void Subscribe(const std::string& name, Handler handler);
+			void Unsubscribe(const std::string& name);
+
+			void Enable()
+			{
+				enabled_ = true;
+			}
+
+			void Publish(ProtectionEventType type, uint64 tribe_id, int64 expires_ms = 0);
+			void Deliver();
+
+			static uint32 FlagsOf(uint64 tribe_id);
+
+		private:
+			EventBus() = default;
+			~EventBus() = default;
+
+			std::vector<std::pair<std::string, Handler>> subscribers_;
+			std::vector<ProtectionEvent> pending_;
+			bool enabled_ = false;
+	};
+}
+
+NewPlayerProtection::EventBus& NewPlayerProtection::EventBus::Get()
+{
+	static EventBus instance;
+	return instance;
+}
+
+void NewPlayerProtection::EventBus::Subscribe(const std::string& name, Handler handler)
+{
+	Unsubscribe(name);
+	subscribers_.emplace_back(name, std::move(handler));
+}
+
+void NewPlayerProtection::EventBus::Unsubscribe(const std::string& name)
+{
+	subscribers_.erase(std::remove_if(subscribers_.begin(), subscribers_.end(), [&name](const std::pair<std::string, Handler>& subscriber)
+	{
+		return subscriber.first == name;
+	}), subscribers_.end());
+}
+
+uint32 NewPlayerProtection::EventBus::FlagsOf(uint64 tribe_id)
+{
+	return (NewPlayerProtection::TimerProt::Get().IsTribeProtected(tribe_id) ? TribeFlagProtected : 0)
+		| (NewPlayerProtection::pveTribesList.count(tribe_id) > 0 ? TribeFlagPve : 0);
+}
+
+void NewPlayerProtection::EventBus::Publish(ProtectionEventType type, uint64 tribe_id, int64 expires_ms)
+{
+	if (!enabled_ || subscribers_.empty())
+		return;
+
+	pending_.push_back({ type, tribe_id, FlagsOf(tribe_id), NewPlayerProtection::ToEpochMs(std::chrono::system_clock::now()), expires_ms });
+}
+
+void NewPlayerProtection::EventBus::Deliver()
+{
+	if (pending_.empty())
+		return;
+
+	//a handler may publish or subscribe, both apply from the next tick
+	const auto events = std::move(pending_);
+	const auto subscribers = subscribers_;
+	pending_.clear();
+
+	for (const auto& subscriber : subscribers)
+	{
+		subscriber.second(events);
+	}
+}
+
+//declared with pveTribesList, every runtime PVE change goes through it
+void NewPlayerProtection::MarkPveDirty(uint64 tribe_id)
+{
+	dirtyPveTribes.insert(tribe_id);
+	journalPveTribes.insert(tribe_id);
+
+	EventBus::Get().Publish(pveTribesList.count(tribe_id) > 0 ? ProtectionEventType::PveEnabled : ProtectionEventType::PveDisabled, tribe_id);
+}
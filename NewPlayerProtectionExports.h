@@ -0,0 +1,175 @@
+#pragma once
+
+#define NPP_API_EXPORT
+#include "NewPlayerProtectionApi.h"
+
+static_assert(NPP_TRIBE_PROTECTED == NewPlayerProtection::TribeFlagProtected && NPP_TRIBE_PVE == NewPlayerProtection::TribeFlagPve,
+	"the exported flags are the EventBus flags");
+
+//defined with the hooks
+bool IsTribeProtected(uint64 tribeid);
+
+namespace NewPlayerProtection
+{
+	//callbacks of other plugins, fed from the EventBus while there is at least one
+	class ApiSubscribers
+	{
+		public:
+			static ApiSubscribers& Get();
+
+			ApiSubscribers(const ApiSubscribers&) = delete;
+			ApiSubscribers(ApiSubscribers&&) = delete;
+			ApiSubscribers& operator=(const ApiSubscribers&) = delete;
+			ApiSubscribers& operator=(ApiSubscribers&&) = delete;
+
+			uint64 Add(NPP_TribeChangedCallback callback, void* user);
+			void Remove(uint64 handle);
+
+			//game thread, every protected and PVE flag change of the tick
+			void Notify(const std::vector<ProtectionEvent>& events);
+
+			static uint32 FlagsOf(const ProtectionState& state, uint64 tribe_id);
+
+		private:
+			ApiSubscribers() = default;
+			~ApiSubscribers() = default;
+
+			struct Subscriber
+			{
+				uint64 handle;
+				NPP_TribeChangedCallback callback;
+				void* user;
+			};
+
+			std::vector<Subscriber> subscribers_;
+			uint64 next_handle_ = 1;
+	};
+}
+
+NewPlayerProtection::ApiSubscribers& NewPlayerProtection::ApiSubscribers::Get()
+{
+	static ApiSubscribers instance;
+	return instance;
+}
+
+uint64 NewPlayerProtection::ApiSubscribers::Add(NPP_TribeChangedCallback callback, void* user)
+{
+	if (!callback)
+		return 0;
+
+	if (subscribers_.empty())
+	{
+		NewPlayerProtection::EventBus::Get().Subscribe("NPPApi", std::bind(&NewPlayerProtection::ApiSubscribers::Notify, this, std::placeholders::_1));
+	}
+
+	subscribers_.push_back({ next_handle_, callback, user });
+	return next_handle_++;
+}
+
+void NewPlayerProtection::ApiSubscribers::Remove(uint64 handle)
+{
+	subscribers_.erase(std::remove_if(subscribers_.begin(), subscribers_.end(), [handle](const Subscriber& subscriber)
+	{
+		return subscriber.handle == handle;
+	}), subscribers_.end());
+
+	if (subscribers_.empty())
+	{
+		NewPlayerProtection::EventBus::Get().Unsubscribe("NPPApi");
+	}
+}
+
+uint32 NewPlayerProtection::ApiSubscribers::FlagsOf(const ProtectionState& state, uint64 tribe_id)
+{
+	return (state.IsTribeProtected(tribe_id) ? NPP_TRIBE_PROTECTED : 0) | (state.pveTribes.count(tribe_id) > 0 ? NPP_TRIBE_PVE : 0);
+}
+
+void NewPlayerProtection::ApiSubscribers::Notify(const std::vector<ProtectionEvent>& events)
+{
+	//a callback may unsubscribe itself
+	const auto subscribers = subscribers_;
+
+	for (const auto& event : events)
+	{
+		uint32 changed = 0;
+
+		switch (event.type)
+		{
+			case ProtectionEventType::ProtectionGained:
+			case ProtectionEventType::ProtectionLost:
+				changed = NPP_TRIBE_PROTECTED;
+				break;
+			case ProtectionEventType::PveEnabled:
+			case ProtectionEventType::PveDisabled:
+				changed = NPP_TRIBE_PVE;
+				break;
+			default:
+				continue;
+		}
+
+		for (const auto& subscriber : subscribers)
+		{
+			subscriber.callback(event.tribe_id, event.flags ^ changed, event.flags, subscriber.user);
+		}
+	}
+}
+
+NPP_API uint32_t NPP_GetApiVersion()
+{
+	return NPP_API_VERSION;
+}
+
+NPP_API int NPP_IsLoaded()
+{
+	return NewPlayerProtection::IsLoaded() ? 1 : 0;
+}
+
+NPP_API int NPP_IsTribeProtected(uint64_t tribe_id)
+{
+	if (!NewPlayerProtection::IsLoaded())
+		return 0;
+
+	return IsTribeProtected(tribe_id) ? 1 : 0;
+}
+
+NPP_API int NPP_GetTribeState(uint64_t tribe_id, NPP_TribeState* state)
+{
+	if (!state || state->size < sizeof(NPP_TribeState) || !NewPlayerProtection::IsLoaded())
+		return 0;
+
+	const auto current = NewPlayerProtection::GetProtectionState();
+	const auto iter = current->tribes.find(tribe_id);
+	const uint32 flags = NewPlayerProtection::ApiSubscribers::FlagsOf(*current, tribe_id);
+
+	if (iter == current->tribes.end() && flags == 0)
+		return 0;
+
+	state->size = sizeof(NPP_TribeState);
+	state->flags = flags;
+	state->oldest_start_ms = 0;
+	state->max_level = 0;
+	state->member_count = 0;
+
+	if (iter != current->tribes.end())
+	{
+		const auto& tribe = iter->second;
+
+		if (tribe.oldestStartDateTime != std::chrono::time_point<std::chrono::system_clock>::max())
+		{
+			state->oldest_start_ms = NewPlayerProtection::ToEpochMs(tribe.oldestStartDateTime);
+		}
+		state->max_level = tribe.maxLevel;
+		state->member_count = static_cast<uint32_t>(tribe.memberCount);
+	}
+	return 1;
+}
+
+NPP_API uint64_t NPP_Subscribe(NPP_TribeChangedCallback callback, void* user)
+{
+	return NewPlayerProtection::ApiSubscribers::Get().Add(callback, user);
+}
+
+NPP_API void NPP_Unsubscribe(uint64_t handle)
+{
+	NewPlayerProtection::ApiSubscribers::Get().Remove(handle);
+}
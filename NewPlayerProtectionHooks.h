@@ -4,13 +4,55 @@ DECLARE_HOOK(AShooterGameMode_HandleNewPlayer, bool, AShooterGameMode*, AShooter
 DECLARE_HOOK(AShooterGameMode_Logout, void, AShooterGameMode*, AController*);
 DECLARE_HOOK(AShooterGameMode_SaveWorld, bool, AShooterGameMode*);
 DECLARE_HOOK(APrimalStructure_TakeDamage, float, APrimalStructure*, float, FDamageEvent*, AController*, AActor*);
+DECLARE_HOOK(UPrimalCharacterStatusComponent_ServerApplyLevelUp, void, UPrimalCharacterStatusComponent*, EPrimalCharacterStatusValue::Type, AShooterPlayerController*);
+DECLARE_HOOK(AShooterPlayerState_AddToTribe, bool, AShooterPlayerState*, FTribeData*, bool, bool, bool, APlayerController*);
+DECLARE_HOOK(AShooterPlayerState_ServerRequestLeaveTribe, void, AShooterPlayerState*);
+DECLARE_HOOK(AShooterPlayerState_ServerRequestCreateNewTribe, void, AShooterPlayerState*, FString*, FTribeGovernment);
+DECLARE_HOOK(AShooterGameMode_RemovePlayerFromTribe, void, AShooterGameMode*, uint64, uint64, bool);
+DECLARE_HOOK(AShooterPlayerController_ServerUploadCurrentCharacterAndItems_Implementation, void, AShooterPlayerController*, UPrimalInventoryComponent*);
+DECLARE_HOOK(APrimalStructureTurret_SetTarget, void, APrimalStructureTurret*, AActor*);
+DECLARE_HOOK(APrimalDinoAIController_GetTargetingDesire, float, APrimalDinoAIController*, AActor*);
+DECLARE_HOOK(APrimalStructure_BeginPlay, void, APrimalStructure*);
+DECLARE_HOOK(APrimalStructure_Destroyed, void, APrimalStructure*);
+DECLARE_HOOK(UGameplayStatics_ApplyRadialDamageWithFalloff, bool, UObject*, float, float, FVector*, float, float, float, TSubclassOf<UDamageType>, TArray<AActor*>*, AActor*, AController*, ECollisionChannel, float, TArray<AActor*>*, int);
+
+void OnPlayerGroupsChanged(uint64 steam_id);
+void OnDatabaseLoaded();
 
 void InitHooks()
 {
+	//a config that failed to load leaves the defaults in place, which still need a damage check
+	NewPlayerProtection::SelectStructureDamageCheck(*NewPlayerProtection::GetSettings());
+
 	ArkApi::GetHooks().SetHook("AShooterGameMode.HandleNewPlayer_Implementation", &Hook_AShooterGameMode_HandleNewPlayer, &AShooterGameMode_HandleNewPlayer_original);
 	ArkApi::GetHooks().SetHook("AShooterGameMode.Logout", &Hook_AShooterGameMode_Logout, &AShooterGameMode_Logout_original);
 	ArkApi::GetHooks().SetHook("AShooterGameMode.SaveWorld", &Hook_AShooterGameMode_SaveWorld, &AShooterGameMode_SaveWorld_original);
 	ArkApi::GetHooks().SetHook("APrimalStructure.TakeDamage", &Hook_APrimalStructure_TakeDamage, &APrimalStructure_TakeDamage_original);
+	ArkApi::GetHooks().SetHook("UPrimalCharacterStatusComponent.ServerApplyLevelUp", &Hook_UPrimalCharacterStatusComponent_ServerApplyLevelUp, &UPrimalCharacterStatusComponent_ServerApplyLevelUp_original);
+	ArkApi::GetHooks().SetHook("AShooterPlayerState.AddToTribe", &Hook_AShooterPlayerState_AddToTribe, &AShooterPlayerState_AddToTribe_original);
+	ArkApi::GetHooks().SetHook("AShooterPlayerState.ServerRequestLeaveTribe_Implementation", &Hook_AShooterPlayerState_ServerRequestLeaveTribe, &AShooterPlayerState_ServerRequestLeaveTribe_original);
+	ArkApi::GetHooks().SetHook("AShooterPlayerState.ServerRequestCreateNewTribe_Implementation", &Hook_AShooterPlayerState_ServerRequestCreateNewTribe, &AShooterPlayerState_ServerRequestCreateNewTribe_original);
+	ArkApi::GetHooks().SetHook("AShooterGameMode.RemovePlayerFromTribe", &Hook_AShooterGameMode_RemovePlayerFromTribe, &AShooterGameMode_RemovePlayerFromTribe_original);
+	ArkApi::GetHooks().SetHook("AShooterPlayerController.ServerUploadCurrentCharacterAndItems_Implementation", &Hook_AShooterPlayerController_ServerUploadCurrentCharacterAndItems_Implementation,
+		&AShooterPlayerController_ServerUploadCurrentCharacterAndItems_Implementation_original);
+	Permissions::AddGroupsChangedCallback("NewPlayerProtection", &OnPlayerGroupsChanged);
+
+	//ApplyRadialDamage and ApplyRadialDamageIgnoreDamageActors both end up here
+	if (NewPlayerProtection::GetSettings()->PrefilterRadialDamage)
+	{
+		ArkApi::GetHooks().SetHook("UGameplayStatics.ApplyRadialDamageWithFalloff", &Hook_UGameplayStatics_ApplyRadialDamageWithFalloff, &UGameplayStatics_ApplyRadialDamageWithFalloff_original);
+		//keep the structure grid the radial check reads current
+		ArkApi::GetHooks().SetHook("APrimalStructure.BeginPlay", &Hook_APrimalStructure_BeginPlay, &APrimalStructure_BeginPlay_original);
+		ArkApi::GetHooks().SetHook("APrimalStructure.Destroyed", &Hook_APrimalStructure_Destroyed, &APrimalStructure_Destroyed_original);
+		NewPlayerProtection::radialDamageHooked = true;
+	}
+
+	if (NewPlayerProtection::GetSettings()->SuppressProtectedTargeting)
+	{
+		ArkApi::GetHooks().SetHook("APrimalStructureTurret.SetTarget", &Hook_APrimalStructureTurret_SetTarget, &APrimalStructureTurret_SetTarget_original);
+		ArkApi::GetHooks().SetHook("APrimalDinoAIController.GetTargetingDesire", &Hook_APrimalDinoAIController_GetTargetingDesire, &APrimalDinoAIController_GetTargetingDesire_original);
+		NewPlayerProtection::targetingHooked = true;
+	}
 }
 
 void RemoveHooks()
@@ -19,618 +61,2465 @@ void RemoveHooks()
 	ArkApi::GetHooks().DisableHook("AShooterGameMode.Logout", &Hook_AShooterGameMode_Logout);
 	ArkApi::GetHooks().DisableHook("AShooterGameMode.SaveWorld", &Hook_AShooterGameMode_SaveWorld);
 	ArkApi::GetHooks().DisableHook("APrimalStructure.TakeDamage", &Hook_APrimalStructure_TakeDamage);
-}
-
-bool IsAdmin(uint64 steam_id)
-{
-	if (NewPlayerProtection::IgnoreAdmins)
+	ArkApi::GetHooks().DisableHook("UPrimalCharacterStatusComponent.ServerApplyLevelUp", &Hook_UPrimalCharacterStatusComponent_ServerApplyLevelUp);
+	ArkApi::GetHooks().DisableHook("AShooterPlayerState.AddToTribe", &Hook_AShooterPlayerState_AddToTribe);
+	ArkApi::GetHooks().DisableHook("AShooterPlayerState.ServerRequestLeaveTribe_Implementation", &Hook_AShooterPlayerState_ServerRequestLeaveTribe);
+	ArkApi::GetHooks().DisableHook("AShooterPlayerState.ServerRequestCreateNewTribe_Implementation", &Hook_AShooterPlayerState_ServerRequestCreateNewTribe);
+	ArkApi::GetHooks().DisableHook("AShooterGameMode.RemovePlayerFromTribe", &Hook_AShooterGameMode_RemovePlayerFromTribe);
+	ArkApi::GetHooks().DisableHook("AShooterPlayerController.ServerUploadCurrentCharacterAndItems_Implementation", &Hook_AShooterPlayerController_ServerUploadCurrentCharacterAndItems_Implementation);
+
+	if (NewPlayerProtection::radialDamageHooked)
 	{
-		bool isadmin = false;
-
-		if (NewPlayerProtection::PermissionsMap.Find(steam_id))
-		{
-			isadmin = NewPlayerProtection::PermissionsMap[steam_id].Contains(NewPlayerProtection::NPPAdminGroup);
-		}
-
-		return isadmin;
+		ArkApi::GetHooks().DisableHook("UGameplayStatics.ApplyRadialDamageWithFalloff", &Hook_UGameplayStatics_ApplyRadialDamageWithFalloff);
+		ArkApi::GetHooks().DisableHook("APrimalStructure.BeginPlay", &Hook_APrimalStructure_BeginPlay);
+		ArkApi::GetHooks().DisableHook("APrimalStructure.Destroyed", &Hook_APrimalStructure_Destroyed);
+		NewPlayerProtection::StructureGrid::Get().Clear();
+		NewPlayerProtection::radialDamageHooked = false;
 	}
-	else
+
+	if (NewPlayerProtection::targetingHooked)
 	{
-		return false;
+		ArkApi::GetHooks().DisableHook("APrimalStructureTurret.SetTarget", &Hook_APrimalStructureTurret_SetTarget);
+		ArkApi::GetHooks().DisableHook("APrimalDinoAIController.GetTargetingDesire", &Hook_APrimalDinoAIController_GetTargetingDesire);
+		NewPlayerProtection::targetingHooked = false;
 	}
+	Permissions::RemoveGroupsChangedCallback("NewPlayerProtection");
+	Permissions::CancelPlayersGroupsAsync("NewPlayerProtection");
+	NewPlayerProtection::DamageCapture::Get().Flush();
 }
 
-bool IsPlayerExists(uint64 steam_id)
+bool IsAdmin(const NewPlayerProtection::TimerProt::AllPlayerData& data)
 {
-	int exists = 0;
-	auto all_players_ = NewPlayerProtection::TimerProt::Get().GetAllPlayers();
+	return NewPlayerProtection::GetSettings()->IgnoreAdmins && data.isNppAdmin;
+}
 
-	const auto iter = std::find_if(
-		all_players_.begin(), all_players_.end(),
-		[steam_id](const std::shared_ptr<NewPlayerProtection::TimerProt::AllPlayerData>& data)
-		{
-			return data->steam_id == steam_id;
-		});
+bool IsAdmin(uint64 steam_id)
+{
+	const auto data = NewPlayerProtection::TimerProt::Get().FindPlayer(steam_id);
+	return data && IsAdmin(*data);
+}
 
-	if (iter != all_players_.end())
-	{
-		exists = 1;
-	}
-	return exists;
+bool IsPlayerExists(uint64 steam_id)
+{
+	return NewPlayerProtection::TimerProt::Get().FindPlayer(steam_id) != nullptr;
 }
 
 bool IsPVETribe(uint64 tribeid)
 {
-	int isPve = 0;
-
-	if (std::count(NewPlayerProtection::pveTribesList.begin(), NewPlayerProtection::pveTribesList.end(), tribeid) > 0)
-	{
-		isPve = 1;
-		return isPve;
-	}
-	return isPve;
+	return NewPlayerProtection::pveTribesList.count(tribeid) > 0;
 }
 
 bool IsTribeProtected(uint64 tribeid)
 {
-	bool isProtected = 0;
 	if (tribeid > 100000)
 	{
-		if (!IsPVETribe(tribeid))
+		//almost every hit on a settled server is between unprotected tribes, the filter answers those from one word
+		if (!NewPlayerProtection::TimerProt::Get().MayBeProtected(tribeid))
 		{
-			//potentially check a vector of tribes that lists whether they are protected or not
-
-			auto all_players_ = NewPlayerProtection::TimerProt::Get().GetAllPlayers();
-			const auto iter = std::find_if(
-				all_players_.begin(), all_players_.end(),
-				[tribeid](const std::shared_ptr<NewPlayerProtection::TimerProt::AllPlayerData>& data)
-				{
-					if (!IsAdmin(data->steam_id))
-					{
-						return (data->tribe_id == tribeid && data->isNewPlayer == 1);
-					}
-				});
-
-			if (iter != all_players_.end())
-			{
-				isProtected = 1;
-				return isProtected;
-			}
+			//protected on the map that writes the shared table
+			return NewPlayerProtection::SharedProtectionTable::Get().IsReader() && NewPlayerProtection::SharedProtectionTable::Get().IsProtected(tribeid);
 		}
-		else
+
+		if (IsPVETribe(tribeid))
 		{
-			isProtected = 1;
-			return isProtected;
+			return true;
 		}
+
+		return NewPlayerProtection::TimerProt::Get().IsTribeProtected(tribeid)
+			|| (NewPlayerProtection::SharedProtectionTable::Get().IsReader() && NewPlayerProtection::SharedProtectionTable::Get().IsProtected(tribeid));
 	}
-	return isProtected;
+	return false;
 }
 
 bool IsExemptStructure(AActor* actor)
 {
-	if (NewPlayerProtection::StructureExemptions.size() > 0)
+	const auto settings = NewPlayerProtection::GetSettings();
+
+	if (!settings->StructureExemptions.Empty())
 	{
 		APrimalStructure* structure = static_cast<APrimalStructure*>(actor);
-		FString stuctPath;
-		stuctPath = NewPlayerProtection::GetBlueprint(structure);
+		UClass* structureClass = structure->ClassField();
 
-		if (std::count(NewPlayerProtection::StructureExemptions.begin(), NewPlayerProtection::StructureExemptions.end(), stuctPath.ToString()))
+		if (structureClass == nullptr)
+			return false;
+
+		auto& cached = NewPlayerProtection::StructureExemptionCache[structureClass];
+
+		if (cached.config == NewPlayerProtection::Epochs.Config())
 		{
-			return true;
+			return cached.exempt;
 		}
+
+		const FString& stuctPath = NewPlayerProtection::GetCachedBlueprint(structure);
+
+		const bool isExempt = settings->StructureExemptions.Matches(*stuctPath);
+		cached = { NewPlayerProtection::Epochs.Config(), isExempt };
+
+		return isExempt;
 	}
 
 	return false;
 }
 
-void RemoveExpiredTribesProtection()
+//instance names are built from the class name, so checking the class gives the same answer without a string per hit
+bool IsCorruptedDino(UObjectBase* dino)
 {
-	auto protectionInHours = std::chrono::hours(NewPlayerProtection::HoursOfProtection);
-	auto now = std::chrono::system_clock::now();
-	auto expireTime = now - protectionInHours;
-	auto all_players_ = NewPlayerProtection::TimerProt::Get().GetAllPlayers();
-	auto online_players_ = NewPlayerProtection::TimerProt::Get().GetOnlinePlayers();
+	UClass* dinoClass = dino->ClassField();
+
+	if (dinoClass == nullptr)
+		return false;
+
+	const auto iter = NewPlayerProtection::CorruptedDinoCache.find(dinoClass);
 
-	for (const auto& allData : all_players_)
+	if (iter != NewPlayerProtection::CorruptedDinoCache.end())
 	{
-		//check all players for expired protection
-		auto diff = std::chrono::duration_cast<std::chrono::seconds>(allData->startDateTime - expireTime);
+		return iter->second;
+	}
 
+	FString className;
+	dinoClass->NameField().ToString(&className);
 
-		//if (IsPVETribe(allData->tribe_id))
-		//{
-		//	continue;
-		//}
+	const bool isCorrupted = className.Contains("Corrupt");
+	NewPlayerProtection::CorruptedDinoCache.emplace(dinoClass, isCorrupted);
 
-		if (diff.count() <= 0 || allData->level >= NewPlayerProtection::MaxLevel || allData->isNewPlayer == 0)
-		{
-			//if not an admin
-			if (!IsAdmin(allData->steam_id))
-			{
-				allData->isNewPlayer = 0;
-
-				//update all_players protection with same tribe id
-				for (const auto& moreAllData : all_players_)
-				{
-					if (allData->tribe_id == moreAllData->tribe_id)
-					{
-						if (!IsAdmin(moreAllData->steam_id))
-						{
-							moreAllData->isNewPlayer = 0;
-						}
-					}
-				}
-
-				//update online players with same steam id and tribe id
-				for (const auto& onlineData : online_players_)
-				{
-					if (allData->steam_id == onlineData->steam_id || allData->tribe_id == onlineData->tribe_id)
-					{
-						if (!IsAdmin(onlineData->steam_id))
-						{
-							onlineData->isNewPlayer = 0;
-						}
-					}
-				}
-			}
-		}
-	}
+	return isCorrupted;
 }
 
-bool IsPlayerProtected(APlayerController * PC)
+//full sweep, used after loading and on config reload. The timer only processes what changed.
+void RemoveExpiredTribesProtection()
 {
-	const uint64 steam_id = ArkApi::IApiUtils::GetSteamIdFromController(PC);
-	int isProtected = 0;
-	auto online_players_ = NewPlayerProtection::TimerProt::Get().GetOnlinePlayers();
+	NewPlayerProtection::ScopedLatency latency(NewPlayerProtection::Stat::RemoveExpiredTribesProtection);
+	ARK_TRACE_ZONE("NPP::RemoveExpiredTribesProtection");
 
-	for (const auto& data : online_players_)
-	{
-		if (data->steam_id == steam_id)
-		{
-			if (!IsAdmin(data->steam_id))
-			{
-				return data->isNewPlayer;
-			}
-		}
-	}
-	return isProtected;
+	NewPlayerProtection::TimerProt::Get().RebuildIndexes();
+	NewPlayerProtection::TimerProt::Get().ExpireAllTribes();
 }
 
-void UpdatePlayerDB(std::shared_ptr<NewPlayerProtection::TimerProt::AllPlayerData> data)
+bool IsPlayerProtected(APlayerController * PC)
 {
-	auto& db = NewPlayerProtection::GetDB();
-
-	try
-	{
-		db << "INSERT OR REPLACE INTO Players(SteamId, TribeId, Start_DateTime, Last_Login_DateTime, Level, Is_New_Player) VALUES(?,?,?,?,?,?);"
-			<< data->steam_id << data->tribe_id << NewPlayerProtection::GetTimestamp(data->startDateTime) << NewPlayerProtection::GetTimestamp(data->lastLoginDateTime) << data->level << data->isNewPlayer;
+	const uint64 steam_id = ArkApi::IApiUtils::GetSteamIdFromController(PC);
+	const auto data = NewPlayerProtection::TimerProt::Get().FindOnlinePlayer(steam_id);
 
-	}
-	catch (const sqlite::sqlite_exception& exception)
+	if (data && !IsAdmin(*data))
 	{
-		Log::GetLog()->error("({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+		return data->isNewPlayer;
 	}
+	return false;
 }
 
-void UpdatePVETribeDB(uint64 tribe_id, bool stillProtected)
+//players without a tribe are their own team, the id the engine gave their player data. before it has one the steam id
+//stands in, it is far above any id the engine hands out so a provisional team never lands in another player's tribe
+uint64 GetLoginTeamId(AShooterPlayerController* player_controller)
 {
-	auto& db = NewPlayerProtection::GetDB();
+	AShooterPlayerState* ASPS = static_cast<AShooterPlayerState*>(player_controller->PlayerStateField());
 
-	try
+	if (ASPS->TargetingTeamField() != 0)
 	{
-		db << "INSERT OR REPLACE INTO PVE_Tribes(TribeId, Is_Protected) VALUES(?,?);"
-			<< tribe_id << stillProtected;
-
-		if (!stillProtected)
-		{
-			NewPlayerProtection::removedPveTribesList.clear();
-			NewPlayerProtection::pveTribesList.clear();
-
-			try
-			{
-				auto res = db << "SELECT TribeId FROM PVE_Tribes where Is_Protected = 1;";
-
-				res >> [](uint64 tribeid)
-				{
-					NewPlayerProtection::pveTribesList.push_back(tribeid);
-				};
-			}
-			catch (const sqlite::sqlite_exception& exception)
-			{
-				Log::GetLog()->error("({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
-			}
-		}
+		return ASPS->TargetingTeamField();
 	}
-	catch (const sqlite::sqlite_exception& exception)
+
+	if (player_controller->LinkedPlayerIDField() > 0)
 	{
-		Log::GetLog()->error("({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+		return static_cast<uint64>(player_controller->LinkedPlayerIDField());
 	}
+	return ArkApi::IApiUtils::GetSteamIdFromController(player_controller);
 }
 
 bool Hook_AShooterGameMode_HandleNewPlayer(AShooterGameMode* _this, AShooterPlayerController* new_player, UPrimalPlayerData* player_data, AShooterCharacter* player_character, bool is_from_login)
 {
 	const uint64 steam_id = ArkApi::IApiUtils::GetSteamIdFromController(new_player);
+	const uint64 team_id = GetLoginTeamId(new_player);
+
+	//records, tribe and groups are resolved on the next tick together with every other login since the last one
+	NewPlayerProtection::TimerProt::Get().QueueLogin(steam_id, team_id, new_player);
 
-	std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
-	srand(std::chrono::system_clock::to_time_t(now));
+	return AShooterGameMode_HandleNewPlayer_original(_this, new_player, player_data, player_character, is_from_login);
+}
 
-	uint64 team_id = rand() % 10000 + 11100000;
+//HandleNewPlayer doesn't run again for players that were already on when NPP is loaded, after a hot reload that is everyone
+size_t QueueConnectedPlayers()
+{
+	UWorld* world = ArkApi::GetApiUtils().GetWorld();
 
-	AShooterPlayerState* ASPS = static_cast<AShooterPlayerState*>(new_player->PlayerStateField());
+	if (!world)
+		return 0;
 
-	if (ASPS->TargetingTeamField() != 0)
-	{
-		team_id = ASPS->TargetingTeamField();
-	}
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	size_t queued = 0;
 
-	if (!IsPlayerExists(steam_id))
+	for (auto& weak_controller : world->PlayerControllerListField())
 	{
-		NewPlayerProtection::TimerProt::Get().AddNewPlayer(steam_id, team_id);
-	}
+		AShooterPlayerController* player_controller = static_cast<AShooterPlayerController*>(weak_controller.Get());
 
-	NewPlayerProtection::TimerProt::Get().AddOnlinePlayer(steam_id, team_id);
+		if (!player_controller || !player_controller->PlayerStateField())
+			continue;
 
-	//Add the player groups into cache
-	NewPlayerProtection::PermissionsMap.Add(steam_id, Permissions::GetPlayerGroups(steam_id));
+		const uint64 steam_id = ArkApi::IApiUtils::GetSteamIdFromController(player_controller);
 
-	return AShooterGameMode_HandleNewPlayer_original(_this, new_player, player_data, player_character, is_from_login);
+		if (steam_id == 0)
+			continue;
+
+		timer.QueueLogin(steam_id, GetLoginTeamId(player_controller), player_controller);
+		++queued;
+	}
+	return queued;
+}
+
+//groups only change through Permissions, so the cache is refreshed here instead of on the timer
+void OnPlayerGroupsChanged(uint64 steam_id)
+{
+	if (!NewPlayerProtection::IsLoaded())
+		return;
+
+	//called once Permissions has published the change, so its cache already holds the new groups
+	if (const auto data = NewPlayerProtection::TimerProt::Get().FindOnlinePlayer(steam_id))
+	{
+		NewPlayerProtection::TimerProt::Get().UpdatePlayerAdmin(*data);
+	}
 }
 
 void Hook_AShooterGameMode_Logout(AShooterGameMode* _this, AController* exiting)
 {
+	//the controller is destroyed after this, another one may get its address
+	NewPlayerProtection::PlayerInstigators.Forget(exiting);
+
 	// Remove player from the online list
 	const uint64 steam_id = ArkApi::IApiUtils::GetSteamIdFromController(exiting);
-	NewPlayerProtection::TimerProt::TimerProt::Get().RemovePlayer(steam_id);
-	//Remove the player from cache
-	NewPlayerProtection::PermissionsMap.Remove(steam_id);
+
+	if (NewPlayerProtection::IsLoaded())
+	{
+		NewPlayerProtection::TimerProt::TimerProt::Get().RemovePlayer(steam_id);
+	}
+	else
+	{
+		NewPlayerProtection::TimerProt::Get().CancelLogin(steam_id);
+	}
 	AShooterGameMode_Logout_original(_this, exiting);
 }
 
-bool Hook_AShooterGameMode_SaveWorld(AShooterGameMode* GameMode) {
-	bool result = AShooterGameMode_SaveWorld_original(GameMode);
+//level and tribe only change through these, so they are re-read here instead of polled
+void Hook_UPrimalCharacterStatusComponent_ServerApplyLevelUp(UPrimalCharacterStatusComponent* _this, EPrimalCharacterStatusValue::Type LevelUpValueType, AShooterPlayerController* ByPC)
+{
+	UPrimalCharacterStatusComponent_ServerApplyLevelUp_original(_this, LevelUpValueType, ByPC);
 
-	auto all_players_ = NewPlayerProtection::TimerProt::Get().GetAllPlayers();
-	auto& db = NewPlayerProtection::GetDB();
+	//players are refreshed once their queued login is processed
+	if (!NewPlayerProtection::IsLoaded())
+		return;
 
-	db << "BEGIN TRANSACTION;";
+	//also called for tamed dinos, re-reading the player is cheap either way
+	NewPlayerProtection::TimerProt::Get().QueuePlayerRefresh(ArkApi::IApiUtils::GetSteamIdFromController(ByPC));
+}
 
-	for (const auto& data : all_players_)
-	{
-		UpdatePlayerDB(data);
-	}
+bool Hook_AShooterPlayerState_AddToTribe(AShooterPlayerState* _this, FTribeData* MyNewTribe, bool bMergeTribe, bool bForce, bool bIsFromInvite, APlayerController* InviterPC)
+{
+	const uint64 old_tribe_id = _this->TargetingTeamField();
+	const bool result = AShooterPlayerState_AddToTribe_original(_this, MyNewTribe, bMergeTribe, bForce, bIsFromInvite, InviterPC);
 
-	for (const auto& tribe_id : NewPlayerProtection::pveTribesList)
-	{
-		UpdatePVETribeDB(tribe_id, 1);
-	}
+	if (!NewPlayerProtection::IsLoaded())
+		return result;
 
-	for (const auto& tribe_id : NewPlayerProtection::removedPveTribesList)
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	const uint64 tribe_id = _this->TargetingTeamField();
+
+	//a merge moves everyone in the old tribe
+	if (bMergeTribe)
 	{
-		UpdatePVETribeDB(tribe_id, 0);
+		timer.MergeTribe(old_tribe_id, tribe_id);
 	}
 
-	db << "END TRANSACTION;";
-	db << "PRAGMA optimize;";
-
-	Log::GetLog()->info("NPP database updated during world save.");
+	timer.MovePlayerTribe(ArkApi::IApiUtils::GetSteamIdFromController(static_cast<AController*>(_this->OwnerField())), tribe_id);
 
 	return result;
 }
 
-float Hook_APrimalStructure_TakeDamage(APrimalStructure* _this, float Damage, FDamageEvent* DamageEvent, AController* EventInstigator, AActor* DamageCauser)
+void Hook_AShooterPlayerState_ServerRequestLeaveTribe(AShooterPlayerState* _this)
 {
-	if (_this) // APrimalStructure != NULL
-	{
-		if (!IsExemptStructure(_this))
-		{
-			uint64 attacked_tribeid = _this->TargetingTeamField();
+	AShooterPlayerState_ServerRequestLeaveTribe_original(_this);
 
-			if (DamageCauser) //DamageCauser != NULL
-			{
-				uint64 attacking_tribeid = DamageCauser->TargetingTeamField();
-
-				if (EventInstigator)
-				{
-					if (EventInstigator->IsA(APrimalDinoCharacter::GetPrivateStaticClass()))
-					{
-						if (NewPlayerProtection::AllowWildCorruptedDinoDamage && EventInstigator->TargetingTeamField() < 10000)
-						{
-							FString dinoName;
-							EventInstigator->NameField().ToString(&dinoName);
-								if (dinoName.Contains("Corrupt"))
-								{
-									return APrimalStructure_TakeDamage_original(_this, Damage, DamageEvent, EventInstigator, DamageCauser);
-								}
-						}
-
-						if (NewPlayerProtection::AllowWildDinoDamage && EventInstigator->TargetingTeamField() < 10000)
-						{
-							return APrimalStructure_TakeDamage_original(_this, Damage, DamageEvent, EventInstigator, DamageCauser);
-						}
-					}
-					
-
-					if (EventInstigator->IsA(AShooterPlayerController::GetPrivateStaticClass())) //EventInstigator != NULL
-					{
-						uint64 steam_id = ArkApi::IApiUtils::GetSteamIdFromController(EventInstigator);
-						AShooterPlayerController* player = ArkApi::GetApiUtils().FindPlayerFromSteamId(steam_id);
-
-						if (IsAdmin(steam_id))
-						{
-							return APrimalStructure_TakeDamage_original(_this, Damage, DamageEvent, EventInstigator, DamageCauser);
-						}
-
-
-						if (IsPlayerProtected(player))
-						{
-							if (!NewPlayerProtection::AllowNewPlayersToDamageEnemyStructures)
-							{
-								if (attacked_tribeid < 100000 || attacked_tribeid == attacking_tribeid)
-								{
-									return APrimalStructure_TakeDamage_original(_this, Damage, DamageEvent, EventInstigator, DamageCauser);
-								}
-								if (NewPlayerProtection::TimerProt::Get().IsNextMessageReady(steam_id))
-								{
-									ArkApi::GetApiUtils().SendNotification(player, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr, *NewPlayerProtection::NewPlayerDoingDamageMessage);
-
-									Log::GetLog()->info("NPP Player / Tribe: {} / {} tried to damage a structure of Tribe: {}.", steam_id, attacking_tribeid, attacked_tribeid);
-								}
-								return 0;
-							}
-						}
-						else
-						{
-							if (IsTribeProtected(attacked_tribeid) && attacked_tribeid != attacking_tribeid)
-							{
-								if (NewPlayerProtection::TimerProt::Get().IsNextMessageReady(steam_id))
-								{
-									ArkApi::GetApiUtils().SendNotification(player, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr, *NewPlayerProtection::NewPlayerStructureTakingDamageMessage);
-									Log::GetLog()->info("Unprotected Player / Tribe: {} / {} tried to damage a structure of NPP Protected Tribe: {}.", steam_id, attacking_tribeid, attacked_tribeid);
-								}
-								return 0;
-							}
-						}
-					}
-				}
-				else //EventInstigator == NULL
-				{
-					if (attacked_tribeid == attacking_tribeid)
-					{
-						return APrimalStructure_TakeDamage_original(_this, Damage, DamageEvent, EventInstigator, DamageCauser);
-					}
-					if (IsTribeProtected(attacked_tribeid))
-					{
-						if (DamageCauser->IsA(APrimalDinoCharacter::GetPrivateStaticClass()))
-						{
-							if (NewPlayerProtection::AllowWildCorruptedDinoDamage && DamageCauser->TargetingTeamField() < 10000)
-							{
-								FString dinoName;
-								DamageCauser->NameField().ToString(&dinoName);
-								if (dinoName.Contains("Corrupt"))
-								{
-									return APrimalStructure_TakeDamage_original(_this, Damage, DamageEvent, EventInstigator, DamageCauser);
-								}
-							}
-
-							if (NewPlayerProtection::AllowWildDinoDamage && DamageCauser->TargetingTeamField() < 10000)
-							{
-								return APrimalStructure_TakeDamage_original(_this, Damage, DamageEvent, EventInstigator, DamageCauser);
-							}
-						}
-
-						auto online_players_ = NewPlayerProtection::TimerProt::Get().GetOnlinePlayers();
-
-						for (const auto& onlineData : online_players_)
-						{
-							if (onlineData->tribe_id == attacking_tribeid && NewPlayerProtection::TimerProt::Get().IsNextMessageReady(onlineData->steam_id))
-							{
-								auto tribe_player = ArkApi::GetApiUtils().FindPlayerFromSteamId(onlineData->steam_id);
-								if (!ArkApi::IApiUtils::IsPlayerDead(tribe_player))
-								{
-									ArkApi::GetApiUtils().SendNotification(tribe_player, NewPlayerProtection::MessageColor, NewPlayerProtection::MessageTextSize, NewPlayerProtection::MessageDisplayDelay, nullptr, *NewPlayerProtection::NewPlayerStructureTakingDamageFromUnknownTribemateMessage);
-								}
-							}
-						}
-						return 0;
-					}
-					if (IsTribeProtected(attacking_tribeid) && !NewPlayerProtection::AllowNewPlayersToDamageEnemyStructures)
-					{
-						return 0;
-					}
-				}
-			}
-			else //DamageCauser == NULL
-			{
-				if (IsTribeProtected(attacked_tribeid))
-				{
-					return 0;
-				}
-			}
-		}
-	}	
-	return APrimalStructure_TakeDamage_original(_this, Damage, DamageEvent, EventInstigator, DamageCauser);
-}
+	if (!NewPlayerProtection::IsLoaded())
+		return;
 
-NewPlayerProtection::TimerProt::TimerProt()
-{
-	player_update_interval_ = NewPlayerProtection::PlayerUpdateIntervalInMins;
-	ArkApi::GetCommands().AddOnTimerCallback("UpdateTimer", std::bind(&NewPlayerProtection::TimerProt::UpdateTimer, this));
+	NewPlayerProtection::TimerProt::Get().MovePlayerTribe(ArkApi::IApiUtils::GetSteamIdFromController(static_cast<AController*>(_this->OwnerField())), _this->TargetingTeamField());
 }
 
-NewPlayerProtection::TimerProt& NewPlayerProtection::TimerProt::Get()
+void Hook_AShooterPlayerState_ServerRequestCreateNewTribe(AShooterPlayerState* _this, FString* TribeName, FTribeGovernment TribeGovernment)
 {
-	static TimerProt instance;
-	return instance;
+	AShooterPlayerState_ServerRequestCreateNewTribe_original(_this, TribeName, TribeGovernment);
+
+	if (!NewPlayerProtection::IsLoaded())
+		return;
+
+	NewPlayerProtection::TimerProt::Get().MovePlayerTribe(ArkApi::IApiUtils::GetSteamIdFromController(static_cast<AController*>(_this->OwnerField())), _this->TargetingTeamField());
 }
 
-void NewPlayerProtection::TimerProt::AddPlayerFromDB(uint64 steam_id, uint64 tribe_id, std::chrono::time_point<std::chrono::system_clock> startDateTime, 
-	std::chrono::time_point<std::chrono::system_clock> lastLoginDateTime, int level, int isNewPlayer)
+void Hook_AShooterGameMode_RemovePlayerFromTribe(AShooterGameMode* _this, uint64 TribeID, uint64 PlayerDataID, bool bDontUpdatePlayerState)
 {
+	AShooterGameMode_RemovePlayerFromTribe_original(_this, TribeID, PlayerDataID, bDontUpdatePlayerState);
 
-	const auto iter = std::find_if(
-		all_players_.begin(), all_players_.end(),
-		[steam_id](const std::shared_ptr<AllPlayerData>& data)
-		{
-			return data->steam_id == steam_id;
-		});
-
-	if (iter != all_players_.end())
+	if (!NewPlayerProtection::IsLoaded())
 		return;
 
-	all_players_.push_back(std::make_shared<AllPlayerData>(steam_id, tribe_id, startDateTime, lastLoginDateTime, level, isNewPlayer));
+	//kicks only give the player data id and may not have updated the player state yet, re-read the online members of the tribe
+	NewPlayerProtection::TimerProt::Get().QueueTribeRefresh(TribeID);
 }
 
-void NewPlayerProtection::TimerProt::AddNewPlayer(uint64 steam_id, uint64 tribe_id)
+//a character upload is the start of a transfer, the tribe goes to the other maps of the cluster before the player does
+void Hook_AShooterPlayerController_ServerUploadCurrentCharacterAndItems_Implementation(AShooterPlayerController* _this, UPrimalInventoryComponent* inventoryComp)
 {
-	const auto iter = std::find_if(
-		all_players_.begin(), all_players_.end(),
-		[steam_id](const std::shared_ptr<AllPlayerData>& data)
-		{ 
-			return data->steam_id == steam_id;
-		});
+	AShooterPlayerController_ServerUploadCurrentCharacterAndItems_Implementation_original(_this, inventoryComp);
+
+	if (!NewPlayerProtection::IsLoaded())
+		return;
+
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	const auto data = timer.FindPlayer(ArkApi::IApiUtils::GetSteamIdFromController(_this));
 
-	if (iter != all_players_.end())
+	if (!data)
 		return;
-	all_players_.push_back(std::make_shared<AllPlayerData>(steam_id, tribe_id, std::chrono::system_clock::now(), std::chrono::system_clock::now(), 1, 1));
+
+	//the uploader is online, so the tribe is resident and these are all of its members
+	std::vector<NewPlayerProtection::TimerProt::PlayerRecord> members;
+
+	for (const auto* member : timer.GetTribeMembers(data->tribe_id))
+	{
+		members.push_back(timer.GetRecord(*member));
+	}
+
+	NewPlayerProtection::ClusterSync::Get().PushTransfer(data->tribe_id, std::move(members));
 }
 
-void NewPlayerProtection::TimerProt::AddOnlinePlayer(uint64 steam_id, uint64 team_id)
+//game thread part of a save, copies what changed and hands it to the writer thread
+void QueueProtectionSave()
 {
-	const auto iter = std::find_if(
-		online_players_.begin(), online_players_.end(),
-		[steam_id](const std::shared_ptr<OnlinePlayersData>& data)
-		{ 
-			return data->steam_id == steam_id; 
-		});
+	NewPlayerProtection::ScopedLatency latency(NewPlayerProtection::Stat::SaveWorld);
+	ARK_TRACE_ZONE("NPP::QueueProtectionSave");
+
+	NewPlayerProtection::DamageCapture::Get().Flush();
 
-	if (iter != online_players_.end())
+	//the rows are the home map's, what changed here is only dropped so it doesn't pile up until the next save
+	if (NewPlayerProtection::IsReplica())
+	{
+		NewPlayerProtection::TimerProt::Get().FlushDirtyTribes([](uint64, const NewPlayerProtection::TimerProt::TribeData&) {});
+		NewPlayerProtection::dirtyPveTribes.clear();
+		NewPlayerProtection::journalPveTribes.clear();
+		NewPlayerProtection::removedPveTribesList.clear();
 		return;
+	}
 
-	std::chrono::time_point<std::chrono::system_clock> startDateTime = std::chrono::system_clock::now();
-	std::chrono::time_point<std::chrono::system_clock> lastLoginDateTime = std::chrono::system_clock::now();
-	int level = 1;
-	int isNewPlayer = 1;
-	std::chrono::time_point<std::chrono::system_clock> nextMessageTime = std::chrono::system_clock::now();
+	//everything changed so far goes to the segment this save makes redundant
+	NewPlayerProtection::TimerProt::Get().FlushJournal();
+	const uint64 journal_segment = NewPlayerProtection::Journal::Get().Rotate();
 
-	for (const auto& alldata : all_players_)
+	//evicted records are read back from the database, so only evict once every earlier save has been written
+	if (NewPlayerProtection::DBWriter::Get().GetQueueDepth() == 0)
 	{
-		if (alldata->steam_id == steam_id)
+		const size_t evicted = NewPlayerProtection::TimerProt::Get().EvictInactivePlayers(NewPlayerProtection::GetSettings()->MaxResidentPlayers);
+
+		if (evicted > 0)
 		{
-			team_id = alldata->tribe_id;
-			startDateTime = alldata->startDateTime;
-			alldata->lastLoginDateTime = lastLoginDateTime;
-			level = alldata->level;
-			isNewPlayer = alldata->isNewPlayer;
-			break;
+			NPP_LOG(info, "NPP evicted {} inactive player records, {} resident.", evicted, NewPlayerProtection::TimerProt::Get().GetAllPlayers().size());
 		}
 	}
 
-	online_players_.push_back(std::make_shared<OnlinePlayersData>(steam_id, team_id, startDateTime, lastLoginDateTime, level, isNewPlayer, nextMessageTime));
-}
+	//snapshot the changed rows, the writer thread does the SQLite work
+	NewPlayerProtection::SaveBatch batch = NewPlayerProtection::DBWriter::Get().AcquireBatch();
 
-void NewPlayerProtection::TimerProt::RemovePlayer(uint64 steam_id)
-{
-	const auto iter = std::find_if(
-		online_players_.begin(), online_players_.end(),
-		[steam_id](const std::shared_ptr<OnlinePlayersData>& data)
-		{ 
-			return data->steam_id == steam_id; 
-		});
+	NewPlayerProtection::TimerProt::Get().FlushDirtyPlayers([&batch](const NewPlayerProtection::TimerProt::PlayerRecord& record)
+	{
+		batch.players.push_back(record);
+	});
+
+	NewPlayerProtection::TimerProt::Get().FlushDirtyTribes([&batch](uint64 tribe_id, const NewPlayerProtection::TimerProt::TribeData& data)
+	{
+		batch.tribes.emplace_back(tribe_id, data);
+	});
 
-	if (iter != online_players_.end())
+	for (const auto& tribe_id : NewPlayerProtection::dirtyPveTribes)
 	{
-		online_players_.erase(std::remove(online_players_.begin(), online_players_.end(), *iter), online_players_.end());
+		batch.pveTribes.emplace_back(tribe_id, IsPVETribe(tribe_id));
 	}
-}
 
-bool NewPlayerProtection::TimerProt::IsNextMessageReady(uint64 steam_id)
-{
-	for (const auto& data : online_players_)
+	NewPlayerProtection::dirtyPveTribes.clear();
+	NewPlayerProtection::removedPveTribesList.clear();
+
+	if (NewPlayerProtection::GetSettings()->WriteSnapshotOnSave)
 	{
-		if (data->steam_id == steam_id)
-		{
-			const auto now_time = std::chrono::system_clock::now();
-			auto diff = std::chrono::duration_cast<std::chrono::seconds>(data->nextMessageTime - now_time);
+		batch.snapshot = BuildSnapshot();
+	}
 
-			if (diff.count() <= 0)
-			{
-				data->nextMessageTime = now_time + std::chrono::seconds(NewPlayerProtection::MessageIntervalInSecs);
-				return true;
-			}
-			else
-			{
-				return false;
-			}
-		}
+	batch.journalSegment = journal_segment;
+
+	NewPlayerProtection::ClusterSync::Get().Push(batch);
+	NewPlayerProtection::DBWriter::Get().Enqueue(std::move(batch));
+
+	const size_t queue_depth = NewPlayerProtection::DBWriter::Get().GetQueueDepth();
+	if (queue_depth > 1)
+	{
+		NPP_LOG(warn, "NPP database writer is behind, {} saves pending.", queue_depth);
 	}
-	return true;
 }
 
-void NewPlayerProtection::TimerProt::UpdateLevelAndTribe(std::shared_ptr<OnlinePlayersData> data)
+bool Hook_AShooterGameMode_SaveWorld(AShooterGameMode* GameMode) {
+	//queued before the game's own save, so the writer thread commits it while the world is written.
+	//nothing has changed before the tables are loaded
+	if (NewPlayerProtection::IsLoaded())
+	{
+		QueueProtectionSave();
+	}
+
+	return AShooterGameMode_SaveWorld_original(GameMode);
+}
+
+//tribe and player state part of a player hit, the result is cached in DamageDecisions
+template <unsigned Flags>
+NewPlayerProtection::DamageDecision DecidePlayerDamage(uint64 steam_id, uint64 attacking_tribeid, uint64 attacked_tribeid)
 {
-	AShooterPlayerController* player = ArkApi::GetApiUtils().FindPlayerFromSteamId(data->steam_id);
+	const auto data = NewPlayerProtection::TimerProt::Get().FindOnlinePlayer(steam_id);
 
-	if (ArkApi::IApiUtils::IsPlayerDead(player))
+	NewPlayerProtection::DamageFacts facts;
+	facts.attacking_tribe = attacking_tribeid;
+	facts.attacked_tribe = attacked_tribeid;
+	facts.attackerIsAdmin = (Flags & NewPlayerProtection::DamageCheckIgnoreAdmins) != 0 && data && data->isNppAdmin;
+	facts.attackerIsProtected = !facts.attackerIsAdmin && data && data->isNewPlayer;
+	facts.attackedTribeProtected = IsTribeProtected(attacked_tribeid);
+
+	return NewPlayerProtection::DamageRules.Decide(facts, true);
+}
+
+//same for hits without an instigator
+template <unsigned Flags>
+NewPlayerProtection::DamageDecision DecideUnknownDamage(uint64 attacking_tribeid, uint64 attacked_tribeid)
+{
+	NewPlayerProtection::DamageFacts facts;
+	facts.attacking_tribe = attacking_tribeid;
+	facts.attacked_tribe = attacked_tribeid;
+	facts.attackingTribeProtected = IsTribeProtected(attacking_tribeid);
+	facts.attackedTribeProtected = IsTribeProtected(attacked_tribeid);
+
+	return NewPlayerProtection::DamageRules.Decide(facts, false);
+}
+
+//raids repeat the same pair, so the steady state is one lookup in the tick memo per hit
+template <unsigned Flags>
+NewPlayerProtection::DamageDecision CachedPlayerDamage(uint64 steam_id, uint64 attacking_tribeid, uint64 attacked_tribeid)
+{
+	const NewPlayerProtection::DamageDecisionKey key{ steam_id, attacking_tribeid, attacked_tribeid };
+	NewPlayerProtection::DamageDecision decision;
+
+	if (NewPlayerProtection::DamageTick.Find(key, decision))
+		return decision;
+
+	if (!NewPlayerProtection::DamageDecisions.Find(key, decision))
 	{
-		return;
+		decision = DecidePlayerDamage<Flags>(steam_id, attacking_tribeid, attacked_tribeid);
+		NewPlayerProtection::DamageDecisions.Store(key, decision);
 	}
+	NewPlayerProtection::DamageTick.Store(key, decision);
+	return decision;
+}
 
-	APlayerState* player_state = player->PlayerStateField();
-	AShooterPlayerState* shooter_player_state = static_cast<AShooterPlayerState*>(player_state);
-	uint64 tribe_id = shooter_player_state->TargetingTeamField();
-	int level = shooter_player_state->MyPlayerDataStructField()->MyPersistentCharacterStatsField()->CharacterStatusComponent_HighestExtraCharacterLevelField() + 1;
+//tells the attacker and logs the hit when the decision blocks it
+bool ReportPlayerDamage(NewPlayerProtection::DamageDecision decision, uint64 steam_id, uint64 attacking_tribeid, uint64 attacked_tribeid)
+{
+	if (decision == NewPlayerProtection::DamageDecision::BlockNewPlayerAttacking)
+	{
+		NewPlayerProtection::TimerProt::Get().QueueNotification(steam_id, NewPlayerProtection::GetSettings()->NewPlayerDoingDamageMessage);
+		NewPlayerProtection::BlockedDamage.Add(decision, steam_id, attacking_tribeid, attacked_tribeid);
+		return true;
+	}
 
-	data->level = level;
-	data->tribe_id = tribe_id;
+	if (decision == NewPlayerProtection::DamageDecision::BlockProtectedTarget)
+	{
+		NewPlayerProtection::TimerProt::Get().QueueNotification(steam_id, NewPlayerProtection::GetSettings()->NewPlayerStructureTakingDamageMessage);
+		NewPlayerProtection::BlockedDamage.Add(decision, steam_id, attacking_tribeid, attacked_tribeid);
+		return true;
+	}
+	return false;
+}
 
+//true while any tribe is protected or PVE, otherwise no hit can be blocked
+bool IsAnyTribeProtected()
+{
+	return NewPlayerProtection::TimerProt::Get().HasProtectedTribes() || !NewPlayerProtection::pveTribesList.empty();
+}
+
+//every hit is recorded, including the ones the bypass lets through, so a replay sees the full traffic
+void CaptureDamageEvent(APrimalStructure* structure, AController* EventInstigator, AActor* DamageCauser)
+{
+	NewPlayerProtection::InstigatorKind kind = NewPlayerProtection::InstigatorKind::Other;
 
-	for (const auto& alldata : all_players_)
+	if (!DamageCauser)
 	{
-		if (alldata->steam_id == data->steam_id)
-		{
-			alldata->level = level;
-			alldata->tribe_id = tribe_id;
-			break;
-		}
+		kind = NewPlayerProtection::InstigatorKind::NoCauser;
+	}
+	else if (!EventInstigator)
+	{
+		kind = NewPlayerProtection::InstigatorKind::NoInstigator;
+	}
+	else if (EventInstigator->IsA(AShooterPlayerController::GetPrivateStaticClass()))
+	{
+		kind = NewPlayerProtection::InstigatorKind::Player;
 	}
+
+	NewPlayerProtection::DamageCapture::Get().Record(structure, structure->TargetingTeamField(), DamageCauser ? DamageCauser->TargetingTeamField() : 0, kind);
 }
 
-std::vector<std::shared_ptr<NewPlayerProtection::TimerProt::OnlinePlayersData>> NewPlayerProtection::TimerProt::GetOnlinePlayers()
+//true with the player's steam id when instigator is a player controller, repeat instigators come from PlayerInstigators
+bool ResolvePlayerInstigator(AController* instigator, uint64& steam_id)
 {
-	return online_players_;
+	const int object_index = instigator->InternalIndexField();
+
+	if (NewPlayerProtection::PlayerInstigators.Find(instigator, object_index, steam_id))
+		return true;
+
+	if (!instigator->IsA(AShooterPlayerController::GetPrivateStaticClass()))
+		return false;
+
+	steam_id = ArkApi::IApiUtils::GetSteamIdFromController(instigator);
+	NewPlayerProtection::PlayerInstigators.Store(instigator, object_index, steam_id);
+	return true;
 }
 
-std::vector<std::shared_ptr<NewPlayerProtection::TimerProt::AllPlayerData>> NewPlayerProtection::TimerProt::GetAllPlayers()
+//tells the attacking tribe, or the attacker through ReportPlayerDamage, and logs the hit when the verdict blocks it
+bool ApplyStructureVerdict(const NewPlayerProtection::StructureVerdict& verdict, uint64 attacking_tribeid, uint64 attacked_tribeid)
 {
-	return all_players_;
+	if (verdict.player)
+	{
+		return ReportPlayerDamage(verdict.decision, verdict.steam_id, attacking_tribeid, attacked_tribeid);
+	}
+
+	if (verdict.decision == NewPlayerProtection::DamageDecision::BlockUnknownAttacker)
+	{
+		NewPlayerProtection::TimerProt::Get().QueueTribeNotification(attacking_tribeid, NewPlayerProtection::GetSettings()->NewPlayerStructureTakingDamageFromUnknownTribemateMessage);
+		NewPlayerProtection::BlockedDamage.Add(verdict.decision, 0, attacking_tribeid, attacked_tribeid);
+		return true;
+	}
+
+	if (verdict.decision == NewPlayerProtection::DamageDecision::Block)
+	{
+		NewPlayerProtection::BlockedDamage.Add(verdict.decision, 0, attacking_tribeid, attacked_tribeid);
+		return true;
+	}
+	return false;
 }
 
-void NewPlayerProtection::TimerProt::UpdateTimer()
+//steps 3 to 6 of IsStructureDamageBlocked for a hit with a causer, without telling anyone
+template <unsigned Flags>
+NewPlayerProtection::StructureVerdict JudgeStructureDamage(APrimalStructure* _this, AController* EventInstigator, AActor* DamageCauser, bool inRadial,
+	uint64 attacking_tribeid, uint64 attacked_tribeid)
 {
-	const auto now_time = std::chrono::system_clock::now();
+	constexpr bool hasExemptions = (Flags & NewPlayerProtection::DamageCheckHasExemptions) != 0;
+	constexpr bool allowWildDinoDamage = (Flags & NewPlayerProtection::DamageCheckAllowWildDinoDamage) != 0;
+	constexpr bool allowWildCorruptedDinoDamage = (Flags & NewPlayerProtection::DamageCheckAllowWildCorruptedDinoDamage) != 0;
 
-	auto diff = std::chrono::duration_cast<std::chrono::seconds>(NewPlayerProtection::next_player_update - now_time);
+	auto& radial = NewPlayerProtection::radialDamage;
+	NewPlayerProtection::StructureVerdict verdict;
 
-	if (diff.count() <= 0)
+	if (attacked_tribeid == attacking_tribeid || (EventInstigator && attacked_tribeid < 100000))
 	{
-		auto player_interval = std::chrono::minutes(player_update_interval_);
-		NewPlayerProtection::next_player_update = now_time + player_interval;
+		return verdict;
+	}
 
-		for (const auto& data : online_players_)
+	//wild and tamed dino instigators end up allowed whatever their wild dino settings, only players are ever blocked
+	if (EventInstigator)
+	{
+		if (!(inRadial ? radial.isPlayer : ResolvePlayerInstigator(EventInstigator, verdict.steam_id)))
 		{
-			NewPlayerProtection::TimerProt::UpdateLevelAndTribe(data);
-			
-			//Update Permissions Cache
-			uint64 SteamID = data->steam_id;
-
-			if (NewPlayerProtection::PermissionsMap.Find(SteamID))
-			{
-				NewPlayerProtection::PermissionsMap[SteamID] = Permissions::GetPlayerGroups(SteamID);
-			}
+			return verdict;
+		}
 
+		//resolved once when the explosion went off
+		if (inRadial)
+		{
+			verdict.steam_id = radial.steam_id;
 		}
-		RemoveExpiredTribesProtection();
+	}
 
-		Log::GetLog()->info("PlayerUpdateIntervalInMins timer called: NPP Protections updated.");
+	if constexpr (hasExemptions)
+	{
+		if (IsExemptStructure(_this))
+		{
+			return verdict;
+		}
 	}
-}
\ No newline at end of file
+
+	if (EventInstigator)
+	{
+		verdict.player = true;
+
+		if (!(inRadial && radial.FindVictim(attacked_tribeid, verdict.decision)))
+		{
+			verdict.decision = CachedPlayerDamage<Flags>(verdict.steam_id, attacking_tribeid, attacked_tribeid);
+
+			if (inRadial)
+			{
+				radial.AddVictim(attacked_tribeid, verdict.decision);
+			}
+		}
+
+		return verdict;
+	}
+
+	//EventInstigator == NULL
+	const NewPlayerProtection::DamageDecisionKey key{ 0, attacking_tribeid, attacked_tribeid };
+
+	if (!(inRadial && radial.FindVictim(attacked_tribeid, verdict.decision)))
+	{
+		if (!NewPlayerProtection::DamageTick.Find(key, verdict.decision))
+		{
+			if (!NewPlayerProtection::DamageDecisions.Find(key, verdict.decision))
+			{
+				verdict.decision = DecideUnknownDamage<Flags>(attacking_tribeid, attacked_tribeid);
+				NewPlayerProtection::DamageDecisions.Store(key, verdict.decision);
+			}
+			NewPlayerProtection::DamageTick.Store(key, verdict.decision);
+		}
+
+		if (inRadial)
+		{
+			radial.AddVictim(attacked_tribeid, verdict.decision);
+		}
+	}
+
+	if constexpr (allowWildDinoDamage || allowWildCorruptedDinoDamage)
+	{
+		if (verdict.decision == NewPlayerProtection::DamageDecision::BlockUnknownAttacker
+			&& DamageCauser->IsA(APrimalDinoCharacter::GetPrivateStaticClass()) && attacking_tribeid < 10000)
+		{
+			if (allowWildDinoDamage || IsCorruptedDino(DamageCauser))
+			{
+				verdict.decision = NewPlayerProtection::DamageDecision::Allow;
+			}
+		}
+	}
+
+	return verdict;
+}
+
+//true when TakeDamage should drop the hit. Cheap checks first, each step either decides the hit or falls through to the next:
+//1. nothing on the server is protected or PVE
+//2. no damage causer, only the target tribe matters
+//3. integer checks: own structures, and instigated hits on unowned structures or by anything but a player
+//4. exempt structures, a class cache lookup
+//5. the tribe/player decision, cached per attacker and target in DamageDecisions
+//6. per hit wild dino allowances before an unknown attacker is blocked
+//with CacheStructureVerdicts a structure hit again by the same causer gets the verdict of 3 to 6 from StructureVerdicts.
+//Flags are the config switches the checks depend on, so each instantiation has them folded in and only reads the
+//settings to send a message once a hit is blocked. SelectStructureDamageCheck picks the instantiation on load.
+template <unsigned Flags>
+bool IsStructureDamageBlocked(APrimalStructure* _this, AController* EventInstigator, AActor* DamageCauser)
+{
+	constexpr bool hasExemptions = (Flags & NewPlayerProtection::DamageCheckHasExemptions) != 0;
+	constexpr bool cacheVerdicts = (Flags & NewPlayerProtection::DamageCheckStructureVerdicts) != 0;
+
+	if (!_this || !IsAnyTribeProtected())
+	{
+		return false;
+	}
+
+	const uint64 attacked_tribeid = _this->TargetingTeamField();
+
+	if (!DamageCauser)
+	{
+		return IsTribeProtected(attacked_tribeid) && !(hasExemptions && IsExemptStructure(_this));
+	}
+
+	//every structure an explosion reaches shares its instigator, so its facts were read once when it went off
+	auto& radial = NewPlayerProtection::radialDamage;
+	const bool inRadial = radial.active && radial.instigator == EventInstigator && radial.causer == DamageCauser;
+
+	//the grid found no protected base in the blast and the attacker can't be blocked, the filter check still runs per structure
+	//so a box gone stale can only cost the full check, never let a protected hit through
+	if (inRadial && radial.allowAll && !NewPlayerProtection::TimerProt::Get().MayBeProtected(attacked_tribeid))
+	{
+		return false;
+	}
+
+	const uint64 attacking_tribeid = inRadial ? radial.attacking_tribe : DamageCauser->TargetingTeamField();
+
+	//an explosion reaches every structure once, only single hits repeat on the same structure
+	if constexpr (cacheVerdicts)
+	{
+		if (!inRadial)
+		{
+			const NewPlayerProtection::StructureVerdictCache::Key key{ _this, EventInstigator, DamageCauser, _this->InternalIndexField(), attacked_tribeid, attacking_tribeid };
+			NewPlayerProtection::StructureVerdict verdict;
+
+			if (!NewPlayerProtection::StructureVerdicts.Find(key, verdict))
+			{
+				verdict = JudgeStructureDamage<Flags>(_this, EventInstigator, DamageCauser, false, attacking_tribeid, attacked_tribeid);
+				NewPlayerProtection::StructureVerdicts.Store(key, verdict);
+			}
+
+			return ApplyStructureVerdict(verdict, attacking_tribeid, attacked_tribeid);
+		}
+	}
+
+	return ApplyStructureVerdict(JudgeStructureDamage<Flags>(_this, EventInstigator, DamageCauser, inRadial, attacking_tribeid, attacked_tribeid),
+		attacking_tribeid, attacked_tribeid);
+}
+
+template <size_t... Flags>
+constexpr std::array<NewPlayerProtection::StructureDamageCheck, sizeof...(Flags)> MakeStructureDamageChecks(std::index_sequence<Flags...>)
+{
+	return { { &IsStructureDamageBlocked<static_cast<unsigned>(Flags)>... } };
+}
+
+void NewPlayerProtection::SelectStructureDamageCheck(const Settings& settings)
+{
+	//one instantiation per combination of the DamageCheck flags
+	static constexpr auto checks = MakeStructureDamageChecks(std::make_index_sequence<DamageCheckCombinations>());
+
+	unsigned flags = 0;
+	flags |= settings.StructureExemptions.Empty() ? 0 : DamageCheckHasExemptions;
+	flags |= settings.IgnoreAdmins ? DamageCheckIgnoreAdmins : 0;
+	flags |= settings.AllowNewPlayersToDamageEnemyStructures ? DamageCheckAllowNewPlayersToDamage : 0;
+	flags |= settings.AllowWildDinoDamage ? DamageCheckAllowWildDinoDamage : 0;
+	flags |= settings.AllowWildCorruptedDinoDamage ? DamageCheckAllowWildCorruptedDinoDamage : 0;
+	flags |= settings.CacheStructureVerdicts ? DamageCheckStructureVerdicts : 0;
+
+	DamageRules.Compile(settings.AllowNewPlayersToDamageEnemyStructures, settings.DamageDecisionTableTestMode);
+
+	//verdicts were reached under the old exemptions and allowances
+	StructureVerdicts.Clear();
+	structureDamageCheck = checks[flags];
+}
+
+//true when attacker belongs to another tribe and target is a structure of a protected or PVE tribe.
+//wild dinos are left alone
+bool IsProtectedTargetForEnemy(AActor* attacker, AActor* target)
+{
+	if (!attacker || !target || !NewPlayerProtection::IsLoaded())
+	{
+		return false;
+	}
+
+	const uint64 attacking_tribeid = attacker->TargetingTeamField();
+	const uint64 attacked_tribeid = target->TargetingTeamField();
+
+	//team ids first, most candidates are characters or own structures and never reach the class check
+	return attacking_tribeid >= 10000 && attacking_tribeid != attacked_tribeid && IsTribeProtected(attacked_tribeid)
+		&& target->IsA(APrimalStructure::GetPrivateStaticClass());
+}
+
+//turrets don't pick structures on their own, this covers targets set by other plugins and mods
+void Hook_APrimalStructureTurret_SetTarget(APrimalStructureTurret* _this, AActor* aTarget)
+{
+	APrimalStructureTurret_SetTarget_original(_this, IsProtectedTargetForEnemy(_this, aTarget) ? nullptr : aTarget);
+}
+
+//FindTarget keeps the candidate with the highest desire above 0, so a protected structure is never chosen
+float Hook_APrimalDinoAIController_GetTargetingDesire(APrimalDinoAIController* _this, AActor* InTarget)
+{
+	if (IsProtectedTargetForEnemy(_this->PawnField(), InTarget))
+	{
+		return 0.f;
+	}
+
+	return APrimalDinoAIController_GetTargetingDesire_original(_this, InTarget);
+}
+
+void Hook_APrimalStructure_BeginPlay(APrimalStructure* _this)
+{
+	APrimalStructure_BeginPlay_original(_this);
+	NewPlayerProtection::StructureGrid::Get().Add(_this);
+}
+
+void Hook_APrimalStructure_Destroyed(APrimalStructure* _this)
+{
+	NewPlayerProtection::StructureGrid::Get().Remove(_this);
+	APrimalStructure_Destroyed_original(_this);
+}
+
+//the engine calls TakeDamage once per actor in the radius from inside this, the scope holds for all of them
+bool Hook_UGameplayStatics_ApplyRadialDamageWithFalloff(UObject* WorldContextObject, float BaseDamage, float MinimumDamage, FVector* Origin, float DamageInnerRadius,
+	float DamageOuterRadius, float DamageFalloff, TSubclassOf<UDamageType> DamageTypeClass, TArray<AActor*>* IgnoreActors, AActor* DamageCauser,
+	AController* InstigatedByController, ECollisionChannel DamagePreventionChannel, float Impulse, TArray<AActor*>* IgnoreDamageActors, int NumAdditionalAttempts)
+{
+	if (!NewPlayerProtection::IsLoaded() || !DamageCauser || !IsAnyTribeProtected())
+	{
+		return UGameplayStatics_ApplyRadialDamageWithFalloff_original(WorldContextObject, BaseDamage, MinimumDamage, Origin, DamageInnerRadius, DamageOuterRadius,
+			DamageFalloff, DamageTypeClass, IgnoreActors, DamageCauser, InstigatedByController, DamagePreventionChannel, Impulse, IgnoreDamageActors, NumAdditionalAttempts);
+	}
+
+	//a structure destroyed by the blast can set off another explosion inside this one
+	const NewPlayerProtection::RadialDamageScope outer = NewPlayerProtection::radialDamage;
+	auto& radial = NewPlayerProtection::radialDamage;
+
+	radial = NewPlayerProtection::RadialDamageScope();
+	radial.active = true;
+	radial.instigator = InstigatedByController;
+	radial.causer = DamageCauser;
+	radial.attacking_tribe = DamageCauser->TargetingTeamField();
+	radial.generation = NewPlayerProtection::Epochs.Protection();
+
+	if (InstigatedByController)
+	{
+		radial.isPlayer = ResolvePlayerInstigator(InstigatedByController, radial.steam_id);
+	}
+
+	//only a protected attacker or a protected target can get a hit blocked
+	bool attackerMayBeBlocked = NewPlayerProtection::TimerProt::Get().MayBeProtected(radial.attacking_tribe);
+
+	if (!attackerMayBeBlocked && radial.isPlayer)
+	{
+		const auto data = NewPlayerProtection::TimerProt::Get().FindOnlinePlayer(radial.steam_id);
+		attackerMayBeBlocked = data && data->isNewPlayer;
+	}
+
+	radial.allowAll = Origin && !attackerMayBeBlocked && !NewPlayerProtection::StructureGrid::Get().OverlapsProtected(*Origin, DamageOuterRadius);
+
+	const bool result = UGameplayStatics_ApplyRadialDamageWithFalloff_original(WorldContextObject, BaseDamage, MinimumDamage, Origin, DamageInnerRadius, DamageOuterRadius,
+		DamageFalloff, DamageTypeClass, IgnoreActors, DamageCauser, InstigatedByController, DamagePreventionChannel, Impulse, IgnoreDamageActors, NumAdditionalAttempts);
+
+	radial = outer;
+	return result;
+}
+
+float Hook_APrimalStructure_TakeDamage(APrimalStructure* _this, float Damage, FDamageEvent* DamageEvent, AController* EventInstigator, AActor* DamageCauser)
+{
+	//no tribe is known to be protected yet, so every hit gets the same answer
+	if (!NewPlayerProtection::IsLoaded())
+	{
+		return NewPlayerProtection::GetSettings()->BlockDamageWhileLoading ? 0 : APrimalStructure_TakeDamage_original(_this, Damage, DamageEvent, EventInstigator, DamageCauser);
+	}
+
+	if (_this && NewPlayerProtection::DamageCapture::Get().IsEnabled())
+	{
+		CaptureDamageEvent(_this, EventInstigator, DamageCauser);
+	}
+
+	bool blocked;
+	{
+		//only the decision is timed, not the game's own damage handling
+		NewPlayerProtection::ScopedLatency latency(NewPlayerProtection::Stat::TakeDamage);
+		ARK_TRACE_ZONE("NPP::TakeDamage");
+		blocked = NewPlayerProtection::structureDamageCheck(_this, EventInstigator, DamageCauser);
+	}
+
+	auto& counters = NewPlayerProtection::GetCounters();
+	++(blocked ? counters.blockedHits : counters.allowedHits);
+
+	return blocked ? 0 : APrimalStructure_TakeDamage_original(_this, Damage, DamageEvent, EventInstigator, DamageCauser);
+}
+
+NewPlayerProtection::TimerProt::TimerProt()
+{
+	player_update_interval_ = NewPlayerProtection::GetSettings()->PlayerUpdateIntervalInMins;
+	ArkApi::GetCommands().AddOnTimerCallback("UpdateTimer", std::bind(&NewPlayerProtection::TimerProt::UpdateTimer, this));
+	ArkApi::GetCommands().AddOnTickCallback("NPPDamageTick", [](float)
+	{
+		NewPlayerProtection::DamageTick.NextTick();
+	});
+}
+
+NewPlayerProtection::TimerProt& NewPlayerProtection::TimerProt::Get()
+{
+	static TimerProt instance;
+	return instance;
+}
+
+bool NewPlayerProtection::TimerProt::AddPlayerFromDB(uint64 steam_id, uint64 tribe_id, std::chrono::time_point<std::chrono::system_clock> startDateTime,
+	std::chrono::time_point<std::chrono::system_clock> lastLoginDateTime, int level, int isNewPlayer)
+{
+	//the resident record is newer than the saved row
+	if (FindPlayer(steam_id))
+		return false;
+
+	const size_t index = all_players_.size();
+	player_index_.Insert(steam_id, index);
+	all_players_.emplace_back(steam_id, tribe_id, startDateTime, level, isNewPlayer);
+	player_cold_.push_back({ ToEpochSecs(lastLoginDateTime) });
+	tribe_index_.Add(tribe_id, index);
+	ScheduleExpiry(all_players_[index]);
+	return true;
+}
+
+void NewPlayerProtection::TimerProt::EnsureTribeResident(uint64 tribe_id)
+{
+	if (!resident_tribes_.insert(tribe_id).second)
+		return;
+
+	try
+	{
+		//an unprotected member read back in can still expire the tribe
+		if (LoadPlayerRows("TribeId = ?", tribe_id) > 0)
+		{
+			UpdateTribe(tribe_id);
+			MarkTribeForExpiry(tribe_id);
+		}
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		resident_tribes_.erase(tribe_id);
+		NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+	}
+}
+
+void NewPlayerProtection::TimerProt::LoadAllPlayers()
+{
+	try
+	{
+		LoadPlayerRows("1");
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+		return;
+	}
+
+	tribe_index_.ForEach([this](uint64 tribe_id, const TribeIndex::Entry&)
+	{
+		resident_tribes_.insert(tribe_id);
+	});
+}
+
+size_t NewPlayerProtection::TimerProt::EvictInactivePlayers(size_t max_resident)
+{
+	if (max_resident == 0 || all_players_.size() <= max_resident)
+		return 0;
+
+	//whole tribes only, so the aggregate of a resident tribe always covers every member
+	struct Candidate
+	{
+		uint64 tribe_id;
+		std::chrono::time_point<std::chrono::system_clock> lastLoginDateTime;
+		size_t memberCount;
+	};
+	std::vector<Candidate> candidates;
+
+	tribe_index_.ForEach([this, &candidates](uint64 tribe_id, const TribeIndex::Entry& tribe)
+	{
+		//saved and not protecting anyone, so the rows in the database are all there is to know
+		if (IsTribeProtected(tribe_id) || dirty_tribes_.count(tribe_id) > 0)
+			return;
+
+		Candidate candidate{ tribe_id, std::chrono::time_point<std::chrono::system_clock>::min(), tribe.members.size() };
+
+		for (const size_t index : tribe.members)
+		{
+			const auto& data = all_players_[index];
+
+			if (data.isOnline || data.isDirty)
+				return;
+
+			candidate.lastLoginDateTime = std::max(candidate.lastLoginDateTime, FromEpochSecs(player_cold_[index].lastLoginSecs));
+		}
+
+		candidates.push_back(candidate);
+	});
+
+	//least recently seen tribes first
+	std::sort(candidates.begin(), candidates.end(), [](const Candidate& lhs, const Candidate& rhs)
+	{
+		return lhs.lastLoginDateTime < rhs.lastLoginDateTime;
+	});
+
+	const size_t excess = all_players_.size() - max_resident;
+	std::vector<bool> evicted(all_players_.size(), false);
+	size_t count = 0;
+
+	for (const auto& candidate : candidates)
+	{
+		if (count >= excess)
+			break;
+
+		for (const size_t index : tribe_index_.Find(candidate.tribe_id)->members)
+		{
+			evicted[index] = true;
+			player_index_.Erase(all_players_[index].steam_id);
+		}
+
+		count += candidate.memberCount;
+		tribe_index_.Release(candidate.tribe_id);
+		tribes_.erase(candidate.tribe_id);
+		resident_tribes_.erase(candidate.tribe_id);
+		status_cache_.erase(candidate.tribe_id);
+	}
+
+	if (count == 0)
+		return 0;
+
+	//compact in place, remap[old] is the new index of every record that stays
+	std::vector<size_t> remap(all_players_.size());
+	size_t next = 0;
+
+	for (size_t index = 0; index < all_players_.size(); ++index)
+	{
+		if (evicted[index])
+			continue;
+
+		if (index != next)
+		{
+			all_players_[next] = std::move(all_players_[index]);
+			player_cold_[next] = player_cold_[index];
+			player_index_.Insert(all_players_[next].steam_id, next);
+		}
+		remap[index] = next++;
+	}
+	all_players_.erase(all_players_.begin() + next, all_players_.end());
+	player_cold_.erase(player_cold_.begin() + next, player_cold_.end());
+
+	for (size_t& index : online_players_)
+	{
+		index = remap[index];
+	}
+
+	for (auto* indices : { &dirty_players_, &journal_players_ })
+	{
+		for (size_t& index : *indices)
+		{
+			index = remap[index];
+		}
+	}
+
+	tribe_index_.Remap(remap);
+
+	return count;
+}
+
+void NewPlayerProtection::TimerProt::QueueLogin(uint64 steam_id, uint64 team_id, AShooterPlayerController* controller)
+{
+	//a reconnect before the batch ran only replaces the controller
+	for (auto& login : pending_logins_)
+	{
+		if (login.steam_id == steam_id)
+		{
+			login = { steam_id, team_id, controller };
+			return;
+		}
+	}
+
+	pending_logins_.push_back({ steam_id, team_id, controller });
+}
+
+void NewPlayerProtection::TimerProt::CancelLogin(uint64 steam_id)
+{
+	pending_logins_.erase(std::remove_if(pending_logins_.begin(), pending_logins_.end(), [steam_id](const PendingLogin& login)
+	{
+		return login.steam_id == steam_id;
+	}), pending_logins_.end());
+}
+
+void NewPlayerProtection::TimerProt::ProcessPendingLogins()
+{
+	//until the wipe is committed the tables still hold the records it drops, the logins wait for it
+	if (pending_logins_.empty() || NewPlayerProtection::DBWriter::Get().IsWipePending())
+		return;
+
+	std::vector<PendingLogin> logins;
+	logins.swap(pending_logins_);
+
+	//their tribe may have been evicted while nobody in it was online
+	std::unordered_set<uint64> steam_ids;
+	std::unordered_set<uint64> tribe_ids;
+
+	for (const auto& login : logins)
+	{
+		if (!FindPlayer(login.steam_id))
+		{
+			steam_ids.insert(login.steam_id);
+		}
+
+		if (resident_tribes_.count(login.team_id) == 0)
+		{
+			tribe_ids.insert(login.team_id);
+		}
+	}
+
+	LoadLoginRows(steam_ids, std::move(tribe_ids));
+
+	for (const auto& login : logins)
+	{
+		if (!FindPlayer(login.steam_id))
+		{
+			AddNewPlayer(login.steam_id, login.team_id);
+		}
+
+		AddOnlinePlayer(login.steam_id, login.team_id, login.controller);
+
+		if (NewPlayerProtection::GetSettings()->StatusPushOnLogin)
+		{
+			//the character is spawned and its level read by then
+			login_status_.emplace_back(SteadyNow() + std::chrono::seconds(30), login.steam_id);
+		}
+
+		//admin status comes from the same round trip Permissions uses to add the player, known players are answered from its cache
+		FetchLoginGroups(login.steam_id);
+		//level is read once the character is spawned
+		QueuePlayerRefresh(login.steam_id);
+	}
+}
+
+void NewPlayerProtection::TimerProt::LoadLoginRows(const std::unordered_set<uint64>& steam_ids, std::unordered_set<uint64> tribe_ids)
+{
+	if (steam_ids.empty() && tribe_ids.empty())
+		return;
+
+	//ids are integers, so they go into the statement as a literal list instead of one bound parameter each
+	const auto in_list = [](const char* column, const std::unordered_set<uint64>& ids)
+	{
+		std::string where = std::string(column) + " IN (";
+
+		for (const uint64 id : ids)
+		{
+			where += std::to_string(id);
+			where += ',';
+		}
+		where.back() = ')';
+
+		return where;
+	};
+
+	std::string where;
+
+	if (!steam_ids.empty())
+	{
+		where = in_list("SteamId", steam_ids);
+	}
+
+	if (!tribe_ids.empty())
+	{
+		where += (where.empty() ? "" : " OR ") + in_list("TribeId", tribe_ids);
+	}
+
+	auto& db = NewPlayerProtection::GetDB();
+	bool in_transaction = false;
+
+	try
+	{
+		db << "BEGIN TRANSACTION;";
+		in_transaction = true;
+
+		LoadPlayerRows(where);
+
+		//a returning player's record may name another tribe than the one they logged in with
+		std::unordered_set<uint64> record_tribes;
+
+		for (const uint64 steam_id : steam_ids)
+		{
+			const auto data = FindPlayer(steam_id);
+
+			if (data && resident_tribes_.count(data->tribe_id) == 0 && tribe_ids.count(data->tribe_id) == 0)
+			{
+				record_tribes.insert(data->tribe_id);
+			}
+		}
+
+		if (!record_tribes.empty())
+		{
+			LoadPlayerRows(in_list("TribeId", record_tribes));
+			tribe_ids.insert(record_tribes.begin(), record_tribes.end());
+		}
+
+		db << "COMMIT;";
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+
+		if (in_transaction)
+		{
+			try
+			{
+				db << "ROLLBACK;";
+			}
+			catch (const sqlite::sqlite_exception&)
+			{
+			}
+		}
+
+		//not marked resident, so the tribes are read again on their next use
+		return;
+	}
+
+	//an unprotected member read back in can still expire the tribe
+	for (const uint64 tribe_id : tribe_ids)
+	{
+		resident_tribes_.insert(tribe_id);
+		UpdateTribe(tribe_id);
+		MarkTribeForExpiry(tribe_id);
+	}
+}
+
+void NewPlayerProtection::TimerProt::AddNewPlayer(uint64 steam_id, uint64 tribe_id)
+{
+	if (FindPlayer(steam_id))
+		return;
+
+	const auto now = Now();
+
+	const size_t index = all_players_.size();
+	player_index_.Insert(steam_id, index);
+	all_players_.emplace_back(steam_id, tribe_id, now, 1, 1);
+	player_cold_.push_back({ ToEpochSecs(now) });
+	tribe_index_.Add(tribe_id, index);
+	MarkDirty(all_players_[index]);
+	ScheduleExpiry(all_players_[index]);
+	UpdateTribe(tribe_id);
+}
+
+void NewPlayerProtection::TimerProt::AddOnlinePlayer(uint64 steam_id, uint64 team_id, AShooterPlayerController* controller)
+{
+	if (const auto state = FindOnlineState(steam_id))
+	{
+		state->controller = controller;
+		return;
+	}
+
+	//every online player has a record in the table
+	if (!FindPlayer(steam_id))
+	{
+		AddNewPlayer(steam_id, team_id);
+	}
+
+	const size_t index = *player_index_.Find(steam_id);
+	AllPlayerData& data = all_players_[index];
+
+	player_cold_[index].lastLoginSecs = ToEpochSecs(Now());
+	data.isOnline = true;
+	OnlineState& state = AcquireOnlineState(steam_id);
+	state = { SteadyNow(), controller, online_players_.size() };
+	MarkDirty(data);
+
+	if (adaptive_refresh_)
+	{
+		ScheduleRefresh(data, state);
+	}
+
+	online_players_.push_back(index);
+	tribe_index_.AddOnline(data.tribe_id, index);
+
+	//only online players count as protected attackers
+	NewPlayerProtection::Epochs.BumpProtection();
+}
+
+uint64 NewPlayerProtection::TimerProt::TakeOffline(uint64 steam_id)
+{
+	CancelLogin(steam_id);
+
+	const auto state = online_state_.find(steam_id);
+
+	if (state == online_state_.end())
+		return 0;
+
+	//order of online_players_ doesn't matter, the last player takes the gap
+	const size_t pos = state->second.onlinePos;
+	const size_t index = online_players_[pos];
+
+	if (pos + 1 != online_players_.size())
+	{
+		online_players_[pos] = online_players_.back();
+		online_state_[all_players_[online_players_[pos]].steam_id].onlinePos = pos;
+	}
+	online_players_.pop_back();
+	spare_online_states_.push_back(online_state_.extract(state));
+
+	AllPlayerData& data = all_players_[index];
+	data.isOnline = false;
+	data.isNppAdmin = false;
+	tribe_index_.RemoveOnline(data.tribe_id, index);
+
+	return data.tribe_id;
+}
+
+void NewPlayerProtection::TimerProt::RemovePlayer(uint64 steam_id)
+{
+	const uint64 tribe_id = TakeOffline(steam_id);
+
+	//admin status only applies while online, so their tribe may change state
+	if (tribe_id != 0)
+	{
+		UpdateTribe(tribe_id);
+		MarkTribeForExpiry(tribe_id);
+	}
+}
+
+void NewPlayerProtection::TimerProt::RemovePlayers(const std::vector<uint64>& steam_ids)
+{
+	std::unordered_set<uint64> tribes;
+
+	for (const uint64 steam_id : steam_ids)
+	{
+		if (const uint64 tribe_id = TakeOffline(steam_id))
+		{
+			tribes.insert(tribe_id);
+		}
+	}
+
+	for (const uint64 tribe_id : tribes)
+	{
+		UpdateTribe(tribe_id);
+		MarkTribeForExpiry(tribe_id);
+	}
+}
+
+bool NewPlayerProtection::TimerProt::QueueNotification(AllPlayerData& data, const MessageTemplate<0>& message)
+{
+	const auto now_time = SteadyNow();
+	OnlineState* state = FindOnlineState(data.steam_id);
+
+	if (!state || state->nextMessageTime > now_time)
+	{
+		return false;
+	}
+
+	state->nextMessageTime = now_time + std::chrono::seconds(NewPlayerProtection::GetSettings()->MessageIntervalInSecs);
+	pending_notifications_.emplace_back(data.steam_id, message.Text());
+	return true;
+}
+
+bool NewPlayerProtection::TimerProt::QueueNotification(uint64 steam_id, const MessageTemplate<0>& message)
+{
+	const auto data = FindOnlinePlayer(steam_id);
+	return data && QueueNotification(*data, message);
+}
+
+bool NewPlayerProtection::TimerProt::QueueTribeNotification(uint64 tribe_id, const MessageTemplate<0>& message)
+{
+	const auto tribe = tribe_index_.Find(tribe_id);
+
+	if (!tribe || tribe->online_members.empty())
+		return false;
+
+	const auto now_time = SteadyNow();
+	auto& next_time = tribe->next_message;
+
+	if (next_time > now_time)
+		return false;
+
+	next_time = now_time + std::chrono::seconds(NewPlayerProtection::GetSettings()->MessageIntervalInSecs);
+	pending_tribe_notifications_.emplace_back(tribe_id, message.Text());
+	return true;
+}
+
+void NewPlayerProtection::TimerProt::NotifyTribe(uint64 tribe_id, const FString& text)
+{
+	if (tribe_index_.OnlineMembers(tribe_id))
+	{
+		pending_tribe_notifications_.emplace_back(tribe_id, text);
+	}
+}
+
+size_t NewPlayerProtection::TimerProt::SendNotificationToTribe(uint64 tribe_id, const FString& text)
+{
+	const auto members = tribe_index_.OnlineMembers(tribe_id);
+
+	if (!members)
+		return 0;
+
+	size_t sent = 0;
+
+	for (const size_t index : *members)
+	{
+		const auto state = FindOnlineState(all_players_[index].steam_id);
+
+		if (state && !ArkApi::IApiUtils::IsPlayerDead(state->controller))
+		{
+			NewPlayerProtection::SendNotification(state->controller, text);
+			++sent;
+		}
+	}
+
+	NewPlayerProtection::GetCounters().notificationsSent += sent;
+	return sent;
+}
+
+//EventBus subscriber, tells the online members of a tribe that their protection is about to end or has ended
+void NotifyProtectionEvents(const std::vector<NewPlayerProtection::ProtectionEvent>& events)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	const auto settings = NewPlayerProtection::GetSettings();
+	const int64 now_ms = NewPlayerProtection::ToEpochMs(timer.Now());
+
+	for (const auto& event : events)
+	{
+		if (event.type == NewPlayerProtection::ProtectionEventType::ExpiryImminent)
+		{
+			timer.NotifyTribe(event.tribe_id, settings->NPPExpiringMessage.Render((std::max<int64>(0, event.expires_ms - now_ms) + 59999) / 60000));
+		}
+		else if (event.type == NewPlayerProtection::ProtectionEventType::ProtectionLost && event.flags == 0)
+		{
+			timer.NotifyTribe(event.tribe_id, settings->NPPEndedMessage.Text());
+		}
+	}
+}
+
+void NewPlayerProtection::TimerProt::FlushNotifications(TickBudget& budget)
+{
+	size_t sent = 0;
+
+	for (; sent < pending_notifications_.size() && !budget.Spent(); ++sent)
+	{
+		const auto& notification = pending_notifications_[sent];
+		//may have logged out since it was queued
+		const auto state = FindOnlineState(notification.first);
+
+		if (state && !ArkApi::IApiUtils::IsPlayerDead(state->controller))
+		{
+			NewPlayerProtection::SendNotification(state->controller, notification.second);
+			++NewPlayerProtection::GetCounters().notificationsSent;
+		}
+	}
+
+	size_t tribes_sent = 0;
+
+	//each entry reaches the members online now, so ones who logged in after it was queued get it too
+	for (; tribes_sent < pending_tribe_notifications_.size() && !budget.Spent(); ++tribes_sent)
+	{
+		const auto& notification = pending_tribe_notifications_[tribes_sent];
+		SendNotificationToTribe(notification.first, notification.second);
+	}
+
+	const size_t left = pending_notifications_.size() - sent + pending_tribe_notifications_.size() - tribes_sent;
+
+	if (left > 0)
+	{
+		TickBudget::Defer(Deferrable::Notifications, left);
+	}
+	pending_notifications_.erase(pending_notifications_.begin(), pending_notifications_.begin() + sent);
+	pending_tribe_notifications_.erase(pending_tribe_notifications_.begin(), pending_tribe_notifications_.begin() + tribes_sent);
+}
+
+void NewPlayerProtection::TimerProt::UpdateLevelAndTribe(AllPlayerData& data)
+{
+	const OnlineState* state = FindOnlineState(data.steam_id);
+	AShooterPlayerController* player = state ? state->controller : nullptr;
+
+	if (ArkApi::IApiUtils::IsPlayerDead(player))
+	{
+		return;
+	}
+
+	APlayerState* player_state = player->PlayerStateField();
+	AShooterPlayerState* shooter_player_state = static_cast<AShooterPlayerState*>(player_state);
+	uint64 tribe_id = shooter_player_state->TargetingTeamField();
+	int level = shooter_player_state->MyPlayerDataStructField()->MyPersistentCharacterStatsField()->CharacterStatusComponent_HighestExtraCharacterLevelField() + 1;
+
+	ApplyLevelAndTribe(data, tribe_id, level);
+}
+
+void NewPlayerProtection::TimerProt::ApplyLevelAndTribe(AllPlayerData& data, uint64 tribe_id, int level)
+{
+	const uint64 old_tribe_id = data.tribe_id;
+	const bool level_changed = data.level != level;
+
+	if (level_changed || old_tribe_id != tribe_id)
+	{
+		MarkDirty(data);
+	}
+
+	data.SetLevel(level);
+
+	//membership changed, both tribes may change state
+	if (old_tribe_id != tribe_id)
+	{
+		const uint64 steam_id = data.steam_id;
+
+		//data is not used past this, reading the tribe in may move it
+		EnsureTribeResident(tribe_id);
+		SetPlayerTribe(*player_index_.Find(steam_id), tribe_id);
+		UpdateTribe(old_tribe_id);
+		UpdateTribe(tribe_id);
+		MarkTribeForExpiry(tribe_id);
+	}
+	else
+	{
+		if (level_changed)
+		{
+			UpdateTribe(tribe_id);
+		}
+
+		if (level >= NewPlayerProtection::GetSettings()->MaxLevel && data.isNewPlayer == 1)
+		{
+			MarkTribeForExpiry(tribe_id);
+		}
+	}
+}
+
+void NewPlayerProtection::TimerProt::MovePlayerTribe(uint64 steam_id, uint64 tribe_id)
+{
+	const auto data = FindOnlinePlayer(steam_id);
+
+	//logins still queued read the tribe when they are processed
+	if (!data || data->tribe_id == tribe_id)
+		return;
+
+	ApplyLevelAndTribe(*data, tribe_id, data->level);
+}
+
+void NewPlayerProtection::TimerProt::MergeTribe(uint64 old_tribe_id, uint64 new_tribe_id)
+{
+	if (old_tribe_id == new_tribe_id)
+		return;
+
+	//offline members are not re-read until they log in, so both tribes are read in before the records move
+	EnsureTribeResident(old_tribe_id);
+	EnsureTribeResident(new_tribe_id);
+
+	const auto tribe = tribe_index_.Find(old_tribe_id);
+
+	if (!tribe)
+		return;
+
+	//SetPlayerTribe edits the list
+	const std::vector<size_t> members = tribe->members;
+
+	for (const size_t index : members)
+	{
+		MarkDirty(all_players_[index]);
+		SetPlayerTribe(index, new_tribe_id);
+	}
+
+	UpdateTribe(old_tribe_id);
+	UpdateTribe(new_tribe_id);
+	MarkTribeForExpiry(new_tribe_id);
+}
+
+void NewPlayerProtection::TimerProt::QueuePlayerRefresh(uint64 steam_id)
+{
+	if (steam_id != 0)
+	{
+		queued_refresh_.insert(steam_id);
+	}
+}
+
+void NewPlayerProtection::TimerProt::QueueTribeRefresh(uint64 tribe_id)
+{
+	ForEachOnlineTribeMember(tribe_id, [this](const AllPlayerData& data)
+	{
+		queued_refresh_.insert(data.steam_id);
+	});
+}
+
+void NewPlayerProtection::TimerProt::RefreshQueuedPlayers(TickBudget& budget)
+{
+	for (auto iter = queued_refresh_.begin(); iter != queued_refresh_.end(); iter = queued_refresh_.erase(iter))
+	{
+		if (budget.Spent())
+		{
+			TickBudget::Defer(Deferrable::PlayerRefresh, queued_refresh_.size());
+			return;
+		}
+
+		const auto data = FindOnlinePlayer(*iter);
+
+		if (data)
+		{
+			UpdateLevelAndTribe(*data);
+		}
+	}
+}
+
+std::chrono::seconds NewPlayerProtection::TimerProt::AdaptiveRefreshInterval(const AllPlayerData& data)
+{
+	const auto settings = NewPlayerProtection::GetSettings();
+	const std::chrono::seconds longest = std::chrono::minutes(settings->PlayerUpdateIntervalInMins) * 4;
+	const std::chrono::seconds shortest(10);
+
+	//no threshold left to cross, only a tribe change outside the hooks is worth catching
+	if (data.isNewPlayer == 0 || IsAdmin(data))
+	{
+		return longest;
+	}
+
+	//nobody levels faster than two levels a minute, and a tribe change close to expiry matters more than one days away
+	const auto levels_left = std::chrono::seconds(30) * std::max(0, settings->MaxLevel - data.level);
+	const auto time_left = std::chrono::duration_cast<std::chrono::seconds>(data.StartDateTime() + std::chrono::hours(settings->HoursOfProtection) - Now()) / 4;
+
+	return std::clamp(std::min(levels_left, time_left), shortest, longest);
+}
+
+void NewPlayerProtection::TimerProt::ScheduleRefresh(const AllPlayerData& data, OnlineState& state)
+{
+	state.nextRefresh = SteadyNow() + AdaptiveRefreshInterval(data);
+	refresh_queue_.emplace(state.nextRefresh, data.steam_id);
+}
+
+void NewPlayerProtection::TimerProt::RefreshDuePlayers(TickBudget& budget)
+{
+	if (!adaptive_refresh_)
+	{
+		adaptive_refresh_ = true;
+		refresh_cursor_ = std::string::npos;
+
+		for (const size_t index : online_players_)
+		{
+			ScheduleRefresh(all_players_[index], *FindOnlineState(all_players_[index].steam_id));
+		}
+	}
+
+	const auto now = SteadyNow();
+
+	while (!refresh_queue_.empty() && refresh_queue_.top().first <= now)
+	{
+		const auto entry = refresh_queue_.top();
+		const auto state = FindOnlineState(entry.second);
+
+		//logged out, or logged back in with a newer entry
+		if (!state || state->nextRefresh != entry.first)
+		{
+			refresh_queue_.pop();
+			continue;
+		}
+
+		if (budget.Spent())
+		{
+			TickBudget::Defer(Deferrable::PlayerRefresh, 1);
+			return;
+		}
+
+		refresh_queue_.pop();
+		UpdateLevelAndTribe(*FindOnlinePlayer(entry.second));
+
+		//the refresh may have loaded a tribe and moved the records
+		if (const auto data = FindOnlinePlayer(entry.second))
+		{
+			ScheduleRefresh(*data, *FindOnlineState(entry.second));
+		}
+	}
+}
+
+void NewPlayerProtection::TimerProt::UpdatePlayerAdmin(AllPlayerData& data)
+{
+	const bool isNppAdmin = Permissions::IsPlayerInGroup(data.steam_id, NewPlayerProtection::GetSettings()->NPPAdminGroup);
+
+	if (data.isNppAdmin == isNppAdmin)
+		return;
+
+	data.isNppAdmin = isNppAdmin;
+
+	//admin status changed, so their tribe may change state
+	UpdateTribe(data.tribe_id);
+	MarkTribeForExpiry(data.tribe_id);
+}
+
+void NewPlayerProtection::TimerProt::FetchLoginGroups(uint64 steam_id)
+{
+	//players stay non-admin until an unknown player's row lands on a later tick, known players are answered right away.
+	//the cache is read again instead of using the result, a group change made while the row was loading is already in it
+	Permissions::UpsertPlayerAndGetGroupsAsync("NewPlayerProtection", steam_id, [steam_id](TArray<FString>)
+	{
+		if (const auto data = NewPlayerProtection::TimerProt::Get().FindOnlinePlayer(steam_id))
+		{
+			NewPlayerProtection::TimerProt::Get().UpdatePlayerAdmin(*data);
+		}
+	});
+}
+
+void NewPlayerProtection::TimerProt::RefreshPlayerGroups()
+{
+	for (const size_t index : online_players_)
+	{
+		UpdatePlayerAdmin(all_players_[index]);
+	}
+}
+
+void NewPlayerProtection::TimerProt::UpdateTribe(uint64 tribe_id)
+{
+	//member state can change without the aggregate changing, so any call may change a damage decision
+	NewPlayerProtection::Epochs.BumpProtection();
+
+	const auto members = tribe_index_.Find(tribe_id);
+
+	if (!members)
+	{
+		const auto tribe_iter = tribes_.find(tribe_id);
+
+		if (tribe_iter != tribes_.end())
+		{
+			const bool wasProtected = tribe_iter->second.isProtected;
+
+			if (wasProtected)
+			{
+				--protected_tribes_;
+				expiry_index_.erase({ tribe_iter->second.oldestStartDateTime, tribe_id });
+			}
+			tribes_.erase(tribe_iter);
+			dirty_tribes_.insert(tribe_id);
+			status_cache_.erase(tribe_id);
+
+			if (wasProtected)
+			{
+				NewPlayerProtection::EventBus::Get().Publish(NewPlayerProtection::ProtectionEventType::ProtectionLost, tribe_id);
+			}
+		}
+		return;
+	}
+
+	TribeData tribe;
+	tribe.isPVE = NewPlayerProtection::pveTribesList.count(tribe_id) > 0;
+	tribe.memberCount = members->members.size();
+
+	for (const size_t index : members->members)
+	{
+		const auto& alldata = all_players_[index];
+
+		if (IsAdmin(alldata))
+		{
+			continue;
+		}
+
+		tribe.oldestStartDateTime = std::min(tribe.oldestStartDateTime, alldata.StartDateTime());
+		tribe.maxLevel = std::max<int>(tribe.maxLevel, alldata.level);
+
+		if (alldata.isNewPlayer == 1)
+		{
+			tribe.isProtected = true;
+		}
+	}
+
+	TribeData& current = tribes_[tribe_id];
+
+	if (current != tribe)
+	{
+		const bool wasProtected = current.isProtected;
+
+		if (tribe.isProtected && !wasProtected)
+		{
+			++protected_tribes_;
+		}
+		else if (!tribe.isProtected && wasProtected)
+		{
+			--protected_tribes_;
+		}
+
+		if (wasProtected)
+		{
+			expiry_index_.erase({ current.oldestStartDateTime, tribe_id });
+		}
+
+		if (tribe.isProtected)
+		{
+			expiry_index_.insert({ tribe.oldestStartDateTime, tribe_id });
+		}
+		current = tribe;
+		dirty_tribes_.insert(tribe_id);
+		NewPlayerProtection::Epochs.BumpTribe(tribe_id);
+
+		if (tribe.isProtected != wasProtected)
+		{
+			NewPlayerProtection::EventBus::Get().Publish(tribe.isProtected ? NewPlayerProtection::ProtectionEventType::ProtectionGained
+				: NewPlayerProtection::ProtectionEventType::ProtectionLost, tribe_id);
+		}
+	}
+}
+
+bool NewPlayerProtection::TimerProt::IsTribeProtected(uint64 tribe_id) const
+{
+	const auto tribe = GetTribe(tribe_id);
+	return tribe && tribe->isProtected;
+}
+
+const NewPlayerProtection::TimerProt::TribeData* NewPlayerProtection::TimerProt::GetTribe(uint64 tribe_id) const
+{
+	const auto iter = tribes_.find(tribe_id);
+	return iter != tribes_.end() ? &iter->second : nullptr;
+}
+
+bool NewPlayerProtection::TimerProt::MayBeProtected(uint64 tribe_id)
+{
+	const uint32 generation = NewPlayerProtection::Epochs.Protection();
+
+	if (generation != protected_filter_generation_)
+	{
+		protected_filter_generation_ = generation;
+		protected_filter_.Reset(protected_tribes_ + NewPlayerProtection::pveTribesList.size());
+
+		for (const auto& tribe : tribes_)
+		{
+			if (tribe.second.isProtected)
+			{
+				protected_filter_.Add(tribe.first);
+			}
+		}
+
+		for (const uint64 pve_tribe : NewPlayerProtection::pveTribesList)
+		{
+			protected_filter_.Add(pve_tribe);
+		}
+	}
+
+	return protected_filter_.MayContain(tribe_id);
+}
+
+void NewPlayerProtection::TimerProt::PublishProtectionState()
+{
+	//changes within one tick are published together, readers see at most a second old state
+	const uint32 generation = NewPlayerProtection::Epochs.Protection();
+
+	if (generation == published_generation_)
+		return;
+
+	published_generation_ = generation;
+
+	auto state = std::make_shared<NewPlayerProtection::ProtectionState>();
+	state->version = NewPlayerProtection::GetProtectionState()->version + 1;
+	state->tribes = tribes_;
+	state->pveTribes = NewPlayerProtection::pveTribesList;
+
+	for (const size_t index : online_players_)
+	{
+		if (all_players_[index].isNppAdmin)
+		{
+			state->admins.insert(all_players_[index].steam_id);
+		}
+	}
+
+	NewPlayerProtection::SharedProtectionTable::Get().Publish(*state);
+	std::atomic_store(&NewPlayerProtection::protection_state, std::shared_ptr<const NewPlayerProtection::ProtectionState>(std::move(state)));
+}
+
+void NewPlayerProtection::TimerProt::RebuildIndexes()
+{
+	tribe_index_.Clear();
+	expiry_queue_ = decltype(expiry_queue_)();
+	warning_queue_ = decltype(warning_queue_)();
+	pending_tribes_.clear();
+
+	for (size_t index = 0; index < all_players_.size(); ++index)
+	{
+		tribe_index_.Add(all_players_[index].tribe_id, index);
+		PushExpiry(all_players_[index]);
+	}
+	ArmExpiryWakeup();
+
+	for (const size_t index : online_players_)
+	{
+		tribe_index_.AddOnline(all_players_[index].tribe_id, index);
+	}
+}
+
+void NewPlayerProtection::TimerProt::SetPlayerTribe(size_t index, uint64 tribe_id)
+{
+	AllPlayerData& data = all_players_[index];
+
+	//online first, the old tribe's slot goes with its last member
+	if (data.isOnline)
+	{
+		tribe_index_.RemoveOnline(data.tribe_id, index);
+	}
+	tribe_index_.Remove(data.tribe_id, index);
+
+	tribe_index_.Add(tribe_id, index);
+
+	if (data.isOnline)
+	{
+		tribe_index_.AddOnline(tribe_id, index);
+	}
+
+	data.tribe_id = tribe_id;
+}
+
+bool NewPlayerProtection::TimerProt::PushExpiry(const AllPlayerData& data)
+{
+	//a replica waits for the home map to write the expiry, so it needs neither deadlines nor warnings
+	if (data.isNewPlayer != 1 || NewPlayerProtection::IsReplica())
+		return false;
+
+	const auto settings = NewPlayerProtection::GetSettings();
+	const auto deadline = data.StartDateTime() + std::chrono::hours(settings->HoursOfProtection);
+
+	expiry_queue_.emplace(deadline, data.steam_id);
+
+	if (settings->ExpiryWarningInMins > 0)
+	{
+		warning_queue_.emplace(deadline - std::chrono::minutes(settings->ExpiryWarningInMins), data.steam_id);
+	}
+	return true;
+}
+
+void NewPlayerProtection::TimerProt::ScheduleExpiry(const AllPlayerData& data)
+{
+	if (PushExpiry(data))
+	{
+		ArmExpiryWakeup();
+	}
+}
+
+void NewPlayerProtection::TimerProt::ArmExpiryWakeup()
+{
+	//the first tick after loading arms it for whatever the loader queued
+	if (!loaded_ || expiry_queue_.empty())
+		return;
+
+	//a wake-up can't be cancelled, a later one still armed finds nothing due and returns
+	const auto deadline = expiry_queue_.top().first;
+
+	if (deadline >= expiry_wakeup_)
+		return;
+
+	expiry_wakeup_ = deadline;
+
+	//the same clock the deadlines were queued and are checked against, so a shifted test clock fires on time
+	const auto delay = std::chrono::ceil<std::chrono::seconds>(deadline - Now()).count();
+	API::Timer::Get().DelayExecute(&NewPlayerProtection::TimerProt::OnExpiryWakeup,
+		static_cast<int>(std::clamp<int64>(delay, 0, std::numeric_limits<int>::max())), this, deadline);
+}
+
+void NewPlayerProtection::TimerProt::OnExpiryWakeup(std::chrono::time_point<std::chrono::system_clock> deadline)
+{
+	if (deadline != expiry_wakeup_)
+		return;
+
+	expiry_wakeup_ = std::chrono::time_point<std::chrono::system_clock>::max();
+
+	//may run before this second's UpdateTimer
+	AdvanceClock();
+
+	const auto now = Now();
+	const auto protectionInHours = std::chrono::hours(NewPlayerProtection::GetSettings()->HoursOfProtection);
+	std::unordered_set<uint64> expired_tribes;
+
+	while (!expiry_queue_.empty() && expiry_queue_.top().first <= now)
+	{
+		const uint64 steam_id = expiry_queue_.top().second;
+		expiry_queue_.pop();
+
+		const auto data = FindPlayer(steam_id);
+
+		if (!data || data->isNewPlayer == 0)
+		{
+			continue;
+		}
+
+		//start date was moved forward by an admin command, wait for the new expiry
+		if (data->StartDateTime() + protectionInHours > now)
+		{
+			PushExpiry(*data);
+			continue;
+		}
+
+		expired_tribes.insert(data->tribe_id);
+	}
+
+	//deadlines are exact, so these don't wait for the tick budget
+	for (const uint64 tribe_id : expired_tribes)
+	{
+		pending_tribes_.erase(tribe_id);
+		ExpireTribe(tribe_id, now - protectionInHours);
+	}
+
+	ArmExpiryWakeup();
+}
+
+void NewPlayerProtection::TimerProt::PublishExpiryWarnings()
+{
+	const auto now = Now();
+	const auto settings = NewPlayerProtection::GetSettings();
+	const auto protectionInHours = std::chrono::hours(settings->HoursOfProtection);
+	const auto warning = std::chrono::minutes(settings->ExpiryWarningInMins);
+	std::unordered_set<uint64> warned;
+
+	while (!warning_queue_.empty() && warning_queue_.top().first <= now)
+	{
+		const auto [warn_time, steam_id] = warning_queue_.top();
+		warning_queue_.pop();
+
+		const auto data = FindPlayer(steam_id);
+
+		//moved start dates and changed settings pushed a new entry of their own
+		if (!data || data->isNewPlayer != 1 || data->StartDateTime() + protectionInHours - warning != warn_time)
+			continue;
+
+		const auto deadline = data->StartDateTime() + protectionInHours;
+		const auto tribe = GetTribe(data->tribe_id);
+
+		//only the oldest member's deadline ends the tribe's protection
+		if (deadline <= now || !tribe || !tribe->isProtected || tribe->oldestStartDateTime != data->StartDateTime()
+			|| !warned.insert(data->tribe_id).second)
+			continue;
+
+		NewPlayerProtection::EventBus::Get().Publish(NewPlayerProtection::ProtectionEventType::ExpiryImminent, data->tribe_id,
+			NewPlayerProtection::ToEpochMs(deadline));
+	}
+}
+
+void NewPlayerProtection::TimerProt::ScheduleTribeExpiry(uint64 tribe_id)
+{
+	const auto tribe = tribe_index_.Find(tribe_id);
+
+	if (tribe)
+	{
+		for (const size_t index : tribe->members)
+		{
+			ScheduleExpiry(all_players_[index]);
+		}
+	}
+}
+
+void NewPlayerProtection::TimerProt::MarkTribeForExpiry(uint64 tribe_id)
+{
+	pending_tribes_.insert(tribe_id);
+}
+
+bool NewPlayerProtection::TimerProt::ExpiresTribe(const AllPlayerData& data, uint32 expireSecs, int maxLevel, bool ignoreAdmins)
+{
+	if (ignoreAdmins && data.isNppAdmin)
+	{
+		return false;
+	}
+
+	return data.startSecs <= expireSecs || data.level >= maxLevel || data.isNewPlayer == 0;
+}
+
+void NewPlayerProtection::TimerProt::ExpireTribe(uint64 tribe_id, std::chrono::time_point<std::chrono::system_clock> expireTime)
+{
+	const auto tribe = tribe_index_.Find(tribe_id);
+
+	if (!tribe)
+	{
+		return;
+	}
+
+	//only the aggregate is rebuilt, whether the tribe expired comes with the home map's rows
+	if (NewPlayerProtection::IsReplica())
+	{
+		UpdateTribe(tribe_id);
+		return;
+	}
+
+	const auto settings = NewPlayerProtection::GetSettings();
+	const uint32 expireSecs = ToEpochSecs(expireTime);
+	bool expired = false;
+
+	for (const size_t index : tribe->members)
+	{
+		if (ExpiresTribe(all_players_[index], expireSecs, settings->MaxLevel, settings->IgnoreAdmins))
+		{
+			expired = true;
+			break;
+		}
+	}
+
+	ApplyTribeExpiry(tribe_id, tribe->members, expired);
+}
+
+void NewPlayerProtection::TimerProt::ApplyTribeExpiry(uint64 tribe_id, const std::vector<size_t>& members, bool expired)
+{
+	if (expired)
+	{
+		bool changed = false;
+
+		for (const size_t index : members)
+		{
+			auto& data = all_players_[index];
+
+			if (data.isNewPlayer != 0 && !IsAdmin(data))
+			{
+				data.isNewPlayer = 0;
+				MarkDirty(data);
+				changed = true;
+			}
+		}
+
+		if (changed)
+		{
+			NewPlayerProtection::AuditLog::Get().Record("protection_expired", tribe_id, "Timer");
+		}
+	}
+
+	UpdateTribe(tribe_id);
+}
+
+std::unordered_set<uint64> NewPlayerProtection::TimerProt::FindExpiredTribes(uint32 expireSecs)
+{
+	const auto settings = NewPlayerProtection::GetSettings();
+	const int maxLevel = settings->MaxLevel;
+	const bool ignoreAdmins = settings->IgnoreAdmins;
+	const AllPlayerData* records = all_players_.data();
+	const size_t count = all_players_.size();
+
+	const auto scan = [=](size_t begin, size_t end, std::unordered_set<uint64>& expired)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			if (ExpiresTribe(records[i], expireSecs, maxLevel, ignoreAdmins))
+			{
+				expired.insert(records[i].tribe_id);
+			}
+		}
+	};
+
+	std::unordered_set<uint64> expired;
+
+	if (count < parallel_scan_min_records_)
+	{
+		scan(0, count, expired);
+		return expired;
+	}
+
+	//chunks are claimed from a counter, so the game thread works through them too. the workers are joined
+	//before returning, every chunk is scanned by then
+	const size_t chunks = (count + parallel_scan_chunk_ - 1) / parallel_scan_chunk_;
+	std::atomic<size_t> next{ 0 };
+	std::vector<std::unordered_set<uint64>> partials(chunks);
+
+	const auto work = [&]()
+	{
+		for (size_t chunk; (chunk = next.fetch_add(1)) < chunks;)
+		{
+			const size_t begin = chunk * parallel_scan_chunk_;
+			scan(begin, std::min(begin + parallel_scan_chunk_, count), partials[chunk]);
+		}
+	};
+
+	const size_t workers = std::min<size_t>(chunks - 1, std::max(1u, std::thread::hardware_concurrency()) - 1);
+	std::vector<std::thread> threads;
+	threads.reserve(workers);
+
+	for (size_t i = 0; i < workers; ++i)
+	{
+		threads.emplace_back(work);
+	}
+
+	work();
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	for (auto& partial : partials)
+	{
+		if (expired.empty())
+		{
+			expired = std::move(partial);
+		}
+		else
+		{
+			expired.insert(partial.begin(), partial.end());
+		}
+	}
+	return expired;
+}
+
+void NewPlayerProtection::TimerProt::ExpireAllTribes()
+{
+	const auto expireTime = Now() - std::chrono::hours(NewPlayerProtection::GetSettings()->HoursOfProtection);
+	const auto expired = NewPlayerProtection::IsReplica() ? std::unordered_set<uint64>() : FindExpiredTribes(ToEpochSecs(expireTime));
+
+	tribes_.reserve(tribe_index_.Size());
+
+	tribe_index_.ForEach([this, &expired](uint64 tribe_id, const TribeIndex::Entry& tribe)
+	{
+		ApplyTribeExpiry(tribe_id, tribe.members, expired.count(tribe_id) > 0);
+	});
+}
+
+void NewPlayerProtection::TimerProt::ProcessExpiredProtection(TickBudget& budget)
+{
+	const auto now = Now();
+	const auto protectionInHours = std::chrono::hours(NewPlayerProtection::GetSettings()->HoursOfProtection);
+
+	//tribes left over stay marked, the next tick expires them against its own clock
+	for (auto iter = pending_tribes_.begin(); iter != pending_tribes_.end(); iter = pending_tribes_.erase(iter))
+	{
+		if (budget.Spent())
+		{
+			TickBudget::Defer(Deferrable::ProtectionExpiry, pending_tribes_.size());
+			return;
+		}
+
+		ExpireTribe(*iter, now - protectionInHours);
+	}
+}
+
+void NewPlayerProtection::TimerProt::MarkDirty(AllPlayerData& data)
+{
+	//neither saved nor journaled, and clean records can be evicted right away
+	if (NewPlayerProtection::IsReplica())
+		return;
+
+	if (!data.isDirty)
+	{
+		data.isDirty = true;
+		dirty_players_.push_back(static_cast<size_t>(&data - all_players_.data()));
+	}
+
+	//the journal gets the row as it is at the end of the tick, however often it changes until then
+	if (!data.isJournalPending)
+	{
+		data.isJournalPending = true;
+		journal_players_.push_back(static_cast<size_t>(&data - all_players_.data()));
+	}
+}
+
+void NewPlayerProtection::TimerProt::FlushJournal()
+{
+	if (journal_players_.empty() && NewPlayerProtection::journalPveTribes.empty())
+		return;
+
+	std::vector<NewPlayerProtection::JournalRecord> records;
+	records.reserve(journal_players_.size() + NewPlayerProtection::journalPveTribes.size());
+
+	for (const size_t index : journal_players_)
+	{
+		all_players_[index].isJournalPending = false;
+		records.push_back(MakeJournalRecord(PlayerRecord(all_players_[index], player_cold_[index])));
+	}
+	journal_players_.clear();
+
+	for (const uint64 tribe_id : NewPlayerProtection::journalPveTribes)
+	{
+		records.push_back(MakeJournalRecord(tribe_id, NewPlayerProtection::pveTribesList.count(tribe_id) > 0));
+	}
+	NewPlayerProtection::journalPveTribes.clear();
+
+	NewPlayerProtection::Journal::Get().Append(std::move(records));
+}
+
+NewPlayerProtection::TimerProt::MemoryUsage NewPlayerProtection::TimerProt::GetMemoryUsage() const
+{
+	MemoryUsage usage;
+	usage.records = all_players_.size();
+	usage.online = online_players_.size();
+
+	//row, its share of the index slots and its entry in the tribe index, online adds online_players_, the online members and its online_state_ entry
+	const size_t index_bytes = player_index_.Size() > 0 ? player_index_.MemoryBytes() / player_index_.Size() : 0;
+	usage.offline_record_bytes = sizeof(AllPlayerData) + sizeof(ColdPlayerData) + index_bytes + sizeof(size_t);
+	//a node per online_state_ entry, its key and the bucket pointer
+	const size_t state_bytes = sizeof(std::pair<const uint64, OnlineState>) + 2 * sizeof(void*);
+	usage.online_record_bytes = usage.offline_record_bytes + 2 * sizeof(size_t) + state_bytes;
+
+	usage.total_bytes = all_players_.capacity() * sizeof(AllPlayerData) + player_cold_.capacity() * sizeof(ColdPlayerData) + player_index_.MemoryBytes() + online_players_.capacity() * sizeof(size_t)
+		+ online_state_.size() * state_bytes;
+	//spare nodes stay allocated for the next logins
+	usage.total_bytes += spare_online_states_.size() * state_bytes + spare_online_states_.capacity() * sizeof(decltype(spare_online_states_)::value_type);
+
+	usage.total_bytes += tribe_index_.MemoryBytes();
+	usage.online_bytes = online_players_.capacity() * sizeof(size_t) + online_state_.size() * state_bytes + tribe_index_.OnlineMemoryBytes();
+
+	usage.tribes = tribes_.size();
+	usage.tribe_bytes = NodeContainerBytes(tribes_) + NodeContainerBytes(dirty_tribes_);
+
+	//a heap only exposes its size, spare capacity is not counted
+	usage.queue_bytes = (expiry_queue_.size() + warning_queue_.size()) * sizeof(ExpiryEntry) + refresh_queue_.size() * sizeof(RefreshEntry)
+		+ NodeContainerBytes(pending_tribes_) + NodeContainerBytes(queued_refresh_)
+		+ (dirty_players_.capacity() + journal_players_.capacity()) * sizeof(size_t)
+		+ pending_logins_.capacity() * sizeof(PendingLogin);
+
+	for (const auto* notifications : { &pending_notifications_, &pending_tribe_notifications_ })
+	{
+		usage.queue_bytes += notifications->capacity() * sizeof(std::pair<uint64, FString>);
+
+		for (const auto& notification : *notifications)
+		{
+			usage.queue_bytes += notification.second.Len() * sizeof(TCHAR);
+		}
+	}
+
+	usage.cache_bytes = NodeContainerBytes(status_cache_) + NodeContainerBytes(resident_tribes_)
+		+ protected_filter_.MemoryBytes();
+
+	for (const auto& status : status_cache_)
+	{
+		usage.cache_bytes += status.second.message.Len() * sizeof(TCHAR);
+	}
+	return usage;
+}
+
+std::vector<NewPlayerProtection::TimerProt::AllPlayerData>& NewPlayerProtection::TimerProt::GetAllPlayers()
+{
+	return all_players_;
+}
+
+NewPlayerProtection::TimerProt::PlayerRecord NewPlayerProtection::TimerProt::GetRecord(const AllPlayerData& data) const
+{
+	return PlayerRecord(data, player_cold_[static_cast<size_t>(&data - all_players_.data())]);
+}
+
+std::chrono::time_point<std::chrono::system_clock> NewPlayerProtection::TimerProt::LastLoginDateTime(const AllPlayerData& data) const
+{
+	return FromEpochSecs(player_cold_[static_cast<size_t>(&data - all_players_.data())].lastLoginSecs);
+}
+
+void NewPlayerProtection::TimerProt::SetLastLoginDateTime(const AllPlayerData& data, std::chrono::time_point<std::chrono::system_clock> datetime)
+{
+	player_cold_[static_cast<size_t>(&data - all_players_.data())].lastLoginSecs = ToEpochSecs(datetime);
+}
+
+void NewPlayerProtection::TimerProt::ReservePlayers(size_t count)
+{
+	all_players_.reserve(all_players_.size() + count);
+	player_cold_.reserve(player_cold_.size() + count);
+}
+
+std::vector<NewPlayerProtection::TimerProt::AllPlayerData*> NewPlayerProtection::TimerProt::GetTribeMembers(uint64 tribe_id)
+{
+	std::vector<AllPlayerData*> members;
+	const auto tribe = tribe_index_.Find(tribe_id);
+
+	if (tribe)
+	{
+		members.reserve(tribe->members.size());
+
+		for (const size_t index : tribe->members)
+		{
+			members.push_back(&all_players_[index]);
+		}
+	}
+	return members;
+}
+
+NewPlayerProtection::TimerProt::AllPlayerData* NewPlayerProtection::TimerProt::FindPlayer(uint64 steam_id)
+{
+	const size_t* index = player_index_.Find(steam_id);
+	return index ? &all_players_[*index] : nullptr;
+}
+
+NewPlayerProtection::TimerProt::AllPlayerData* NewPlayerProtection::TimerProt::FindOnlinePlayer(uint64 steam_id)
+{
+	const auto data = FindPlayer(steam_id);
+	return data && data->isOnline ? data : nullptr;
+}
+
+NewPlayerProtection::TimerProt::OnlineState* NewPlayerProtection::TimerProt::FindOnlineState(uint64 steam_id)
+{
+	const auto iter = online_state_.find(steam_id);
+	return iter != online_state_.end() ? &iter->second : nullptr;
+}
+
+NewPlayerProtection::TimerProt::OnlineState& NewPlayerProtection::TimerProt::AcquireOnlineState(uint64 steam_id)
+{
+	if (spare_online_states_.empty())
+	{
+		return online_state_[steam_id] = OnlineState();
+	}
+
+	auto node = std::move(spare_online_states_.back());
+	spare_online_states_.pop_back();
+
+	node.key() = steam_id;
+	node.mapped() = OnlineState();
+	return online_state_.insert(std::move(node)).position->second;
+}
+
+void NewPlayerProtection::TimerProt::AdvanceClock()
+{
+	now_ = std::chrono::system_clock::now() + clock_offset_;
+	steady_now_ = std::chrono::steady_clock::now() + clock_offset_;
+}
+
+void NewPlayerProtection::TimerProt::RunDueExpiry()
+{
+	if (expiry_wakeup_ <= Now())
+	{
+		OnExpiryWakeup(expiry_wakeup_);
+	}
+}
+
+void NewPlayerProtection::TimerProt::QueueDecayedPlayerPurge()
+{
+	const auto settings = NewPlayerProtection::GetSettings();
+
+	if (settings->PurgeDecayedPlayersEveryHours <= 0 || SteadyNow() < NewPlayerProtection::next_purge || NewPlayerProtection::IsReplica())
+		return;
+
+	NewPlayerProtection::next_purge = SteadyNow() + std::chrono::hours(settings->PurgeDecayedPlayersEveryHours);
+
+	//rows inside the decay window are still read on login, so they are never purged
+	const int retention_hours = std::max(settings->NPPPlayerDecayInHours, settings->DecayedPlayerRetentionInHours);
+	NewPlayerProtection::DBWriter::Get().QueuePurge(NewPlayerProtection::ToEpochMs(Now() - std::chrono::hours(retention_hours)), settings->PurgeDryRun);
+}
+
+void NewPlayerProtection::TimerProt::UpdateTimer()
+{
+	NewPlayerProtection::ScopedLatency latency(NewPlayerProtection::Stat::UpdateTimer);
+	ARK_TRACE_ZONE("NPP::UpdateTimer");
+
+	AdvanceClock();
+
+	//logins queued while the loader thread runs wait here until it is done
+	if (!loaded_)
+	{
+		if (!NewPlayerProtection::IsLoaded())
+			return;
+
+		loaded_ = true;
+		//first purge a little after startup, servers restarted daily would otherwise never get one
+		NewPlayerProtection::next_purge = SteadyNow() + std::chrono::minutes(10);
+		ArmExpiryWakeup();
+		OnDatabaseLoaded();
+	}
+
+	//logins, cluster changes, saves and the journal are not deferred, the budget only holds back work that is safe to finish later
+	TickBudget budget(NewPlayerProtection::GetSettings()->TickBudgetInMicros);
+
+	ProcessPendingLogins();
+	NewPlayerProtection::ClusterSync::Get().ApplyChanges();
+	RefreshQueuedPlayers(budget);
+	PushStatus();
+	FlushNotifications(budget);
+
+	if (!budget.Spent())
+	{
+		NewPlayerProtection::BlockedDamage.FlushIfDue(SteadyNow(), NewPlayerProtection::GetSettings()->BlockedDamageLogIntervalInSecs);
+		NewPlayerProtection::RaidStats::Get().Tick(SteadyNow());
+	}
+	else if (NewPlayerProtection::BlockedDamage.IsDue(SteadyNow()))
+	{
+		TickBudget::Defer(Deferrable::BlockedDamageLog, 1);
+	}
+	QueueDecayedPlayerPurge();
+
+	//level cap and admin changes, time expiry runs from its own wake-up
+	ProcessExpiredProtection(budget);
+	PublishExpiryWarnings();
+	//refresh slice changes below go out with the next tick
+	PublishProtectionState();
+	NewPlayerProtection::EventBus::Get().Deliver();
+	FlushJournal();
+
+	if (NewPlayerProtection::GetSettings()->AdaptivePlayerRefresh)
+	{
+		RefreshDuePlayers(budget);
+		return;
+	}
+
+	if (adaptive_refresh_)
+	{
+		adaptive_refresh_ = false;
+		refresh_queue_ = {};
+	}
+
+	const auto now_time = SteadyNow();
+
+	auto diff = std::chrono::duration_cast<std::chrono::seconds>(NewPlayerProtection::next_player_update - now_time);
+
+	if (diff.count() <= 0)
+	{
+		auto player_interval = std::chrono::minutes(player_update_interval_);
+		NewPlayerProtection::next_player_update = now_time + player_interval;
+
+		//safety net for changes made outside the hooked paths, spread over the interval, the timer ticks once a second
+		const size_t ticks = std::max<size_t>(1, std::chrono::duration_cast<std::chrono::seconds>(player_interval).count());
+		refresh_slice_ = std::max<size_t>(1, (online_players_.size() + ticks - 1) / ticks);
+		refresh_cursor_ = 0;
+	}
+
+	if (refresh_cursor_ == std::string::npos)
+		return;
+
+	//a logout moves the last online player into its place, that player may be skipped until the next pass
+	const size_t end = std::min(refresh_cursor_ + refresh_slice_, online_players_.size());
+
+	for (; refresh_cursor_ < end; ++refresh_cursor_)
+	{
+		//the rest of the slice is picked up next tick, the pass just finishes a little later
+		if (budget.Spent())
+		{
+			TickBudget::Defer(Deferrable::PlayerRefresh, end - refresh_cursor_);
+			break;
+		}
+
+		UpdateLevelAndTribe(all_players_[online_players_[refresh_cursor_]]);
+	}
+
+	if (refresh_cursor_ >= online_players_.size())
+	{
+		refresh_cursor_ = std::string::npos;
+
+		Log::GetLog()->info("PlayerUpdateIntervalInMins timer called: NPP Protections updated.");
+	}
+}
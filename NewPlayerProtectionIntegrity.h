@@ -0,0 +1,279 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace NewPlayerProtection
+{
+	//PRAGMA quick_check of NewPlayerProtection.db every IntegrityCheckEveryHours, on a thread and connection of its own and
+	//only between IntegrityCheckStartHour and IntegrityCheckEndHour local time while at most IntegrityCheckMaxOnlinePlayers
+	//are online. the check sleeps IntegrityCheckPauseInMs every few thousand steps so the disk stays free for the writer,
+	//and is interrupted when the window closes or players come on, to be run again in the next window.
+	//problems are logged and published as IntegrityCheckFailed.
+	class IntegrityChecker
+	{
+		public:
+			static IntegrityChecker& Get();
+
+			IntegrityChecker(const IntegrityChecker&) = delete;
+			IntegrityChecker(IntegrityChecker&&) = delete;
+			IntegrityChecker& operator=(const IntegrityChecker&) = delete;
+			IntegrityChecker& operator=(IntegrityChecker&&) = delete;
+
+			void Start();
+			void Stop(std::chrono::milliseconds timeout);
+
+		private:
+			IntegrityChecker() = default;
+			~IntegrityChecker() = default;
+
+			struct Job
+			{
+				std::string path;
+				int busy_timeout_ms;
+				std::chrono::milliseconds pause;
+			};
+
+			struct Result
+			{
+				bool finished = false;
+				std::vector<std::string> issues;
+				int64 duration_ms = 0;
+			};
+
+			//game thread, once a second
+			void Tick();
+			bool InWindow(const Settings& settings) const;
+			void Run();
+			Result Check(const Job& job);
+			//game thread
+			void OnResult(const Result& result);
+			static int Progress(void* checker);
+
+			//virtual machine steps between two pauses
+			static constexpr int progress_steps_ = 20000;
+			//rows quick_check reports before it stops looking
+			static constexpr int max_issues_ = 100;
+
+			std::thread thread_;
+			std::mutex mutex_;
+			std::condition_variable queue_cv_;
+			std::condition_variable drained_cv_;
+			std::unique_ptr<Job> job_;
+			std::chrono::milliseconds pause_{ 0 };
+			//read by the progress handler, either one interrupts the check
+			std::atomic<bool> stop_{ false };
+			std::atomic<bool> abort_{ false };
+			std::chrono::steady_clock::time_point next_due_;
+			bool running_ = false;
+			//game thread, from the request until its result was handled
+			bool in_flight_ = false;
+			bool busy_ = false;
+	};
+}
+
+NewPlayerProtection::IntegrityChecker& NewPlayerProtection::IntegrityChecker::Get()
+{
+	static IntegrityChecker instance;
+	return instance;
+}
+
+void NewPlayerProtection::IntegrityChecker::Start()
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	if (running_)
+		return;
+
+	running_ = true;
+	stop_ = false;
+	//the first window after startup, a crash is the likeliest cause of corruption
+	next_due_ = std::chrono::steady_clock::now();
+	thread_ = std::thread(&IntegrityChecker::Run, this);
+
+	ArkApi::GetCommands().AddOnTimerCallback("NPPIntegrity", std::bind(&NewPlayerProtection::IntegrityChecker::Tick, this));
+}
+
+void NewPlayerProtection::IntegrityChecker::Stop(std::chrono::milliseconds timeout)
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+
+	if (!running_)
+		return;
+
+	stop_ = true;
+	queue_cv_.notify_one();
+
+	//called from DllMain, the progress handler interrupts a check in progress within a few thousand steps
+	if (!drained_cv_.wait_for(lock, timeout, [this] { return !busy_; }))
+	{
+		Log::GetLog()->warn("NPP integrity check thread did not finish in time.");
+	}
+
+	running_ = false;
+	job_.reset();
+	lock.unlock();
+
+	ArkApi::GetCommands().RemoveOnTimerCallback("NPPIntegrity");
+
+	if (thread_.joinable())
+	{
+		thread_.detach();
+	}
+}
+
+bool NewPlayerProtection::IntegrityChecker::InWindow(const Settings& settings) const
+{
+	if (NewPlayerProtection::TimerProt::Get().OnlineCount() > static_cast<size_t>(std::max(0, settings.IntegrityCheckMaxOnlinePlayers)))
+		return false;
+
+	const auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+	const int hour = localtime(&now)->tm_hour;
+
+	//a window past midnight, 22 to 4
+	return settings.IntegrityCheckStartHour <= settings.IntegrityCheckEndHour
+		? hour >= settings.IntegrityCheckStartHour && hour < settings.IntegrityCheckEndHour
+		: hour >= settings.IntegrityCheckStartHour || hour < settings.IntegrityCheckEndHour;
+}
+
+void NewPlayerProtection::IntegrityChecker::Tick()
+{
+	const auto settings = NewPlayerProtection::GetSettings();
+
+	if (in_flight_)
+	{
+		if (!InWindow(*settings))
+		{
+			abort_ = true;
+		}
+		return;
+	}
+
+	if (settings->IntegrityCheckEveryHours <= 0 || std::chrono::steady_clock::now() < next_due_ || !InWindow(*settings))
+		return;
+
+	auto job = std::make_unique<Job>();
+	job->path = NewPlayerProtection::GetDBPath();
+	job->busy_timeout_ms = std::max(0, settings->DBBusyTimeoutInMs);
+	job->pause = std::chrono::milliseconds(std::max(0, settings->IntegrityCheckPauseInMs));
+
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	abort_ = false;
+	in_flight_ = true;
+	job_ = std::move(job);
+	queue_cv_.notify_one();
+}
+
+void NewPlayerProtection::IntegrityChecker::Run()
+{
+	NewPlayerProtection::ApplyBackgroundThreadSettings("integrity check");
+
+	std::unique_lock<std::mutex> lock(mutex_);
+
+	while (true)
+	{
+		queue_cv_.wait(lock, [this] { return stop_ || job_; });
+
+		if (stop_)
+		{
+			drained_cv_.notify_all();
+			break;
+		}
+
+		std::unique_ptr<Job> job = std::move(job_);
+		busy_ = true;
+		lock.unlock();
+
+		const Result result = Check(*job);
+
+		if (!stop_)
+		{
+			NewPlayerProtection::GameTasks::Get().Post([this, result]()
+			{
+				OnResult(result);
+			});
+		}
+
+		lock.lock();
+		busy_ = false;
+		drained_cv_.notify_all();
+	}
+}
+
+int NewPlayerProtection::IntegrityChecker::Progress(void* checker)
+{
+	auto* self = static_cast<IntegrityChecker*>(checker);
+
+	if (self->stop_ || self->abort_)
+		return 1;
+
+	std::this_thread::sleep_for(self->pause_);
+	return 0;
+}
+
+NewPlayerProtection::IntegrityChecker::Result NewPlayerProtection::IntegrityChecker::Check(const Job& job)
+{
+	const auto started = std::chrono::steady_clock::now();
+	Result result;
+
+	pause_ = job.pause;
+
+	try
+	{
+		sqlite::database db(job.path);
+		db << "PRAGMA busy_timeout = " + std::to_string(job.busy_timeout_ms) + ";";
+
+		sqlite3_progress_handler(db.connection().get(), progress_steps_, &IntegrityChecker::Progress, this);
+
+		db << "PRAGMA quick_check(" + std::to_string(max_issues_) + ");"
+			>> [&result](const std::string& line)
+		{
+			if (line != "ok")
+			{
+				result.issues.push_back(line);
+			}
+		};
+
+		result.finished = true;
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		//interrupted by the progress handler, it is run again in the next window
+		if (!stop_ && !abort_)
+		{
+			result.finished = true;
+			result.issues.push_back(std::string("quick_check failed: ") + exception.what());
+		}
+	}
+
+	result.duration_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started).count();
+	return result;
+}
+
+void NewPlayerProtection::IntegrityChecker::OnResult(const Result& result)
+{
+	in_flight_ = false;
+
+	if (!result.finished)
+	{
+		NPP_LOG(info, "NPP integrity check was interrupted after {} ms, it runs again in the next quiet window.", result.duration_ms);
+		return;
+	}
+
+	next_due_ = std::chrono::steady_clock::now() + std::chrono::hours(std::max(1, NewPlayerProtection::GetSettings()->IntegrityCheckEveryHours));
+
+	if (result.issues.empty())
+	{
+		NPP_LOG(info, "NPP integrity check found no problems in {} ms.", result.duration_ms);
+		return;
+	}
+
+	for (const auto& issue : result.issues)
+	{
+		NPP_LOG(err, "({} {}) NPP integrity check: {}", __FILE__, __FUNCTION__, issue);
+	}
+
+	NewPlayerProtection::EventBus::Get().Publish(NewPlayerProtection::ProtectionEventType::IntegrityCheckFailed, 0);
+}
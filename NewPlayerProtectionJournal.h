@@ -0,0 +1,435 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+namespace NewPlayerProtection
+{
+	enum class JournalKind : uint32
+	{
+		Player = 1,
+		PveTribe = 2
+	};
+
+#pragma pack(push, 1)
+	//one changed player row or PVE flag, fixed size so a record cut short by a crash is simply dropped on replay
+	struct JournalRecord
+	{
+		uint32 kind;
+		//FNV-1a of the bytes after it, a record only partly on disk doesn't match
+		uint32 check;
+		//0 for PVE tribes
+		uint64 steam_id;
+		uint64 tribe_id;
+		int64 start_ms;
+		int64 last_login_ms;
+		int32 level;
+		//Is_New_Player for players, Is_Protected for PVE tribes
+		int32 value;
+	};
+#pragma pack(pop)
+
+	inline uint32 JournalCheck(const JournalRecord& record)
+	{
+		const auto* bytes = reinterpret_cast<const unsigned char*>(&record.steam_id);
+		const size_t size = sizeof(JournalRecord) - offsetof(JournalRecord, steam_id);
+		uint32 hash = 2166136261u;
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash ^= bytes[i];
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+
+	//changes between saves, appended to NewPlayerProtection.db.journal.<segment> on its own thread.
+	//every save starts a new segment and the ones before it are deleted once the save is committed,
+	//so replaying what is left over on startup restores everything a crash would have lost.
+	class Journal
+	{
+		public:
+			static Journal& Get();
+
+			Journal(const Journal&) = delete;
+			Journal(Journal&&) = delete;
+			Journal& operator=(const Journal&) = delete;
+			Journal& operator=(Journal&&) = delete;
+
+			void Start(const std::string& base_path, uint64 first_segment);
+			void Stop(std::chrono::milliseconds timeout);
+
+			//game thread, once per tick, the records are written together in one write
+			void Append(std::vector<JournalRecord>&& records);
+			//game thread, on save, later records go to a new segment. returns the last one the save covers, 0 when not running
+			uint64 Rotate();
+			//writer thread, once every row up to segment is committed
+			void Compact(uint64 segment);
+
+			static std::string SegmentPath(const std::string& base_path, uint64 segment);
+			//segment ids on disk, oldest first
+			static std::vector<uint64> ListSegments(const std::string& base_path);
+
+		private:
+			Journal() = default;
+			~Journal() = default;
+
+			void Run();
+			void RemoveSegments(uint64 up_to);
+
+			struct Chunk
+			{
+				uint64 segment;
+				std::vector<JournalRecord> records;
+			};
+
+			std::string base_path_;
+			std::thread thread_;
+			std::mutex mutex_;
+			std::condition_variable queue_cv_;
+			std::condition_variable drained_cv_;
+			std::deque<Chunk> pending_;
+			uint64 segment_ = 0;
+			uint64 compact_up_to_ = 0;
+			uint64 compacted_ = 0;
+			bool running_ = false;
+			bool stop_ = false;
+			bool busy_ = false;
+	};
+
+	std::string GetJournalPath();
+}
+
+std::string NewPlayerProtection::GetJournalPath()
+{
+	return NewPlayerProtection::GetDBPath() + ".journal";
+}
+
+NewPlayerProtection::Journal& NewPlayerProtection::Journal::Get()
+{
+	static Journal instance;
+	return instance;
+}
+
+std::string NewPlayerProtection::Journal::SegmentPath(const std::string& base_path, uint64 segment)
+{
+	return base_path + "." + std::to_string(segment);
+}
+
+std::vector<uint64> NewPlayerProtection::Journal::ListSegments(const std::string& base_path)
+{
+	const std::filesystem::path base(base_path);
+	const std::string prefix = base.filename().string() + ".";
+	std::vector<uint64> segments;
+	std::error_code error;
+
+	for (const auto& entry : std::filesystem::directory_iterator(base.parent_path(), error))
+	{
+		const std::string name = entry.path().filename().string();
+
+		if (name.size() <= prefix.size() || name.compare(0, prefix.size(), prefix) != 0)
+			continue;
+
+		const std::string suffix = name.substr(prefix.size());
+
+		if (std::all_of(suffix.begin(), suffix.end(), [](unsigned char c) { return std::isdigit(c) != 0; }))
+		{
+			segments.push_back(std::stoull(suffix));
+		}
+	}
+
+	std::sort(segments.begin(), segments.end());
+	return segments;
+}
+
+void NewPlayerProtection::Journal::Start(const std::string& base_path, uint64 first_segment)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	if (running_)
+		return;
+
+	base_path_ = base_path;
+	segment_ = std::max<uint64>(1, first_segment);
+	running_ = true;
+	stop_ = false;
+	thread_ = std::thread(&Journal::Run, this);
+}
+
+void NewPlayerProtection::Journal::Stop(std::chrono::milliseconds timeout)
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+
+	if (!running_)
+		return;
+
+	stop_ = true;
+	queue_cv_.notify_one();
+
+	//same as the database writer, called from DllMain so nothing is joined
+	if (!drained_cv_.wait_for(lock, timeout, [this] { return pending_.empty() && !busy_; }))
+	{
+		NPP_LOG(warn, "NPP journal did not finish in time, {} writes were not made.", pending_.size());
+	}
+
+	running_ = false;
+	lock.unlock();
+
+	if (thread_.joinable())
+	{
+		thread_.detach();
+	}
+}
+
+void NewPlayerProtection::Journal::Append(std::vector<JournalRecord>&& records)
+{
+	if (records.empty())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		if (!running_)
+			return;
+
+		if (!pending_.empty() && pending_.back().segment == segment_)
+		{
+			auto& last = pending_.back().records;
+			last.insert(last.end(), records.begin(), records.end());
+		}
+		else
+		{
+			pending_.push_back({ segment_, std::move(records) });
+		}
+	}
+	queue_cv_.notify_one();
+}
+
+uint64 NewPlayerProtection::Journal::Rotate()
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	if (!running_)
+		return 0;
+
+	return segment_++;
+}
+
+void NewPlayerProtection::Journal::Compact(uint64 segment)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		if (!running_ || segment <= compact_up_to_)
+			return;
+
+		compact_up_to_ = segment;
+	}
+	queue_cv_.notify_one();
+}
+
+void NewPlayerProtection::Journal::RemoveSegments(uint64 up_to)
+{
+	for (const uint64 segment : ListSegments(base_path_))
+	{
+		if (segment > up_to)
+			break;
+
+		std::error_code error;
+		std::filesystem::remove(SegmentPath(base_path_, segment), error);
+
+		if (error)
+		{
+			NPP_LOG(err, "({} {}) Could not remove journal segment {}: {}", __FILE__, __FUNCTION__, segment, error.message());
+		}
+	}
+}
+
+void NewPlayerProtection::Journal::Run()
+{
+	NewPlayerProtection::ApplyBackgroundThreadSettings("journal");
+
+	std::ofstream file;
+	uint64 file_segment = 0;
+
+	std::unique_lock<std::mutex> lock(mutex_);
+
+	while (true)
+	{
+		queue_cv_.wait(lock, [this] { return stop_ || !pending_.empty() || compact_up_to_ > compacted_; });
+
+		//everything queued since the last wake goes out in one write and one flush
+		std::deque<Chunk> chunks;
+		chunks.swap(pending_);
+		const uint64 compact_up_to = compact_up_to_;
+		const bool compact = compact_up_to > compacted_;
+		busy_ = true;
+		lock.unlock();
+
+		for (const auto& chunk : chunks)
+		{
+			if (!file.is_open() || file_segment != chunk.segment)
+			{
+				file.close();
+				file.clear();
+				file.open(SegmentPath(base_path_, chunk.segment), std::ios::binary | std::ios::app);
+				file_segment = chunk.segment;
+			}
+
+			file.write(reinterpret_cast<const char*>(chunk.records.data()), chunk.records.size() * sizeof(JournalRecord));
+		}
+
+		if (!chunks.empty())
+		{
+			file.flush();
+
+			if (!file)
+			{
+				NPP_LOG(err, "({} {}) Could not write journal segment {}", __FILE__, __FUNCTION__, file_segment);
+				file.close();
+				file.clear();
+			}
+		}
+
+		if (compact)
+		{
+			if (file.is_open() && file_segment <= compact_up_to)
+			{
+				file.close();
+			}
+			RemoveSegments(compact_up_to);
+		}
+
+		lock.lock();
+		busy_ = false;
+
+		if (compact)
+		{
+			compacted_ = compact_up_to;
+		}
+
+		if (pending_.empty())
+		{
+			drained_cv_.notify_all();
+
+			if (stop_)
+				break;
+		}
+	}
+}
+
+NewPlayerProtection::JournalRecord MakeJournalRecord(const NewPlayerProtection::TimerProt::PlayerRecord& data)
+{
+	NewPlayerProtection::JournalRecord record{};
+	record.kind = static_cast<uint32>(NewPlayerProtection::JournalKind::Player);
+	record.steam_id = data.steam_id;
+	record.tribe_id = data.tribe_id;
+	record.start_ms = NewPlayerProtection::ToEpochMs(data.StartDateTime());
+	record.last_login_ms = NewPlayerProtection::ToEpochMs(data.LastLoginDateTime());
+	record.level = data.level;
+	record.value = data.isNewPlayer;
+	record.check = NewPlayerProtection::JournalCheck(record);
+	return record;
+}
+
+NewPlayerProtection::JournalRecord MakeJournalRecord(uint64 tribe_id, bool isPve)
+{
+	NewPlayerProtection::JournalRecord record{};
+	record.kind = static_cast<uint32>(NewPlayerProtection::JournalKind::PveTribe);
+	record.tribe_id = tribe_id;
+	record.value = isPve ? 1 : 0;
+	record.check = NewPlayerProtection::JournalCheck(record);
+	return record;
+}
+
+//loader thread, after the tables or the snapshot are loaded. returns the id the next segment starts at,
+//the segments read stay on disk until the first save after this one is committed
+uint64 ReplayJournal(const std::string& base_path)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	const auto segments = NewPlayerProtection::Journal::ListSegments(base_path);
+	std::unordered_set<uint64> tribes;
+	size_t replayed = 0;
+
+	for (const uint64 segment : segments)
+	{
+		std::ifstream file(NewPlayerProtection::Journal::SegmentPath(base_path, segment), std::ios::binary);
+		NewPlayerProtection::JournalRecord record;
+
+		while (file.read(reinterpret_cast<char*>(&record), sizeof(record)))
+		{
+			if (record.check != NewPlayerProtection::JournalCheck(record))
+			{
+				NPP_LOG(warn, "NPP journal segment {} has a damaged record, the rest of it is skipped.", segment);
+				break;
+			}
+
+			if (record.kind == static_cast<uint32>(NewPlayerProtection::JournalKind::PveTribe))
+			{
+				if (record.value != 0)
+				{
+					NewPlayerProtection::pveTribesList.insert(record.tribe_id);
+				}
+				else
+				{
+					NewPlayerProtection::pveTribesList.erase(record.tribe_id);
+				}
+
+				NewPlayerProtection::MarkPveDirty(record.tribe_id);
+				tribes.insert(record.tribe_id);
+				++replayed;
+				continue;
+			}
+
+			if (record.kind != static_cast<uint32>(NewPlayerProtection::JournalKind::Player))
+				continue;
+
+			//the aggregate has to cover every member, so the tribes involved are read in first
+			timer.EnsureTribeResident(record.tribe_id);
+
+			if (auto data = timer.FindPlayer(record.steam_id))
+			{
+				if (data->tribe_id != record.tribe_id)
+				{
+					timer.EnsureTribeResident(data->tribe_id);
+					data = timer.FindPlayer(record.steam_id);
+					tribes.insert(data->tribe_id);
+					timer.SetPlayerTribe(static_cast<size_t>(data - timer.GetAllPlayers().data()), record.tribe_id);
+				}
+
+				data->SetStartDateTime(NewPlayerProtection::FromEpochMs(record.start_ms));
+				timer.SetLastLoginDateTime(*data, NewPlayerProtection::FromEpochMs(record.last_login_ms));
+				data->SetLevel(record.level);
+				data->isNewPlayer = record.value != 0;
+			}
+			else
+			{
+				timer.AddPlayerFromDB(record.steam_id, record.tribe_id, NewPlayerProtection::FromEpochMs(record.start_ms),
+					NewPlayerProtection::FromEpochMs(record.last_login_ms), record.level, record.value);
+			}
+
+			const auto data = timer.FindPlayer(record.steam_id);
+			timer.MarkDirty(*data);
+			timer.ScheduleExpiry(*data);
+			tribes.insert(record.tribe_id);
+			++replayed;
+		}
+	}
+
+	for (const uint64 tribe_id : tribes)
+	{
+		timer.UpdateTribe(tribe_id);
+		timer.MarkTribeForExpiry(tribe_id);
+	}
+
+	if (replayed > 0)
+	{
+		NPP_LOG(info, "NPP journal replayed, {} changes from {} segments.", replayed, segments.size());
+	}
+
+	return segments.empty() ? 1 : segments.back() + 1;
+}
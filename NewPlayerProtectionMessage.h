@@ -0,0 +1,186 @@
+#pragma once
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace NewPlayerProtection
+{
+	//configured message split into text and argument slots once at config load, N is the number of arguments callers pass
+	template <size_t N>
+	class MessageTemplate
+	{
+		public:
+			//on error the template is left as the literal text and false is returned
+			bool Compile(const FString& text, std::string& error)
+			{
+				const std::wstring source = *text;
+
+				segments_.clear();
+				length_ = 0;
+
+				std::wstring literal;
+				size_t auto_index = 0;
+				bool has_auto = false;
+				bool has_manual = false;
+
+				for (size_t i = 0; i < source.size(); ++i)
+				{
+					const wchar_t c = source[i];
+
+					if (c == L'}')
+					{
+						if (i + 1 < source.size() && source[i + 1] == L'}')
+						{
+							literal += L'}';
+							++i;
+							continue;
+						}
+						return Fail(source, "unmatched '}'", error);
+					}
+
+					if (c != L'{')
+					{
+						literal += c;
+						continue;
+					}
+
+					if (i + 1 < source.size() && source[i + 1] == L'{')
+					{
+						literal += L'{';
+						++i;
+						continue;
+					}
+
+					const size_t close = source.find(L'}', i + 1);
+					if (close == std::wstring::npos)
+					{
+						return Fail(source, "unmatched '{'", error);
+					}
+
+					const std::wstring field = source.substr(i + 1, close - i - 1);
+					size_t index;
+
+					if (field.empty())
+					{
+						has_auto = true;
+						index = auto_index++;
+					}
+					else if (field.find_first_not_of(L"0123456789") == std::wstring::npos)
+					{
+						has_manual = true;
+						index = std::stoul(field);
+					}
+					else
+					{
+						return Fail(source, "only {} and {N} placeholders are supported", error);
+					}
+
+					if (has_auto && has_manual)
+					{
+						return Fail(source, "cannot mix {} and {N} placeholders", error);
+					}
+
+					if (index >= N)
+					{
+						return Fail(source, "placeholder " + std::to_string(index) + " is out of range, the message takes " + std::to_string(N) + " argument(s)", error);
+					}
+
+					AddLiteral(literal);
+					segments_.push_back({ std::wstring(), static_cast<int>(index) });
+					i = close;
+				}
+
+				AddLiteral(literal);
+				Prerender();
+				return true;
+			}
+
+			//messages without arguments are rendered once at load, sending one copies no strings
+			const FString& Text() const
+			{
+				static_assert(N == 0, "message takes arguments, use Render");
+				return text_;
+			}
+
+			template <typename... Args>
+			FString Render(const Args&... args) const
+			{
+				static_assert(sizeof...(Args) == N, "message argument count does not match its template");
+
+				//arguments are converted once, slots may repeat them
+				const std::wstring values[N + 1] = { ToWide(args)... };
+
+				std::wstring result;
+				result.reserve(length_ + N * 8);
+
+				for (const auto& segment : segments_)
+				{
+					if (segment.arg < 0)
+					{
+						result += segment.text;
+					}
+					else
+					{
+						result += values[segment.arg];
+					}
+				}
+
+				return FString(result.c_str());
+			}
+
+		private:
+			struct Segment
+			{
+				std::wstring text;
+				//-1 for literal text
+				int arg;
+			};
+
+			void AddLiteral(std::wstring& literal)
+			{
+				if (!literal.empty())
+				{
+					length_ += literal.size();
+					segments_.push_back({ std::move(literal), -1 });
+					literal.clear();
+				}
+			}
+
+			bool Fail(const std::wstring& source, const std::string& reason, std::string& error)
+			{
+				segments_.clear();
+				length_ = source.size();
+				segments_.push_back({ source, -1 });
+				error = reason;
+				Prerender();
+				return false;
+			}
+
+			void Prerender()
+			{
+				if constexpr (N == 0)
+				{
+					text_ = Render();
+				}
+			}
+
+			template <typename T>
+			static std::wstring ToWide(const T& value)
+			{
+				if constexpr (std::is_arithmetic_v<T>)
+				{
+					return std::to_wstring(value);
+				}
+				else
+				{
+					return *FString(value);
+				}
+			}
+
+			std::vector<Segment> segments_;
+			size_t length_ = 0;
+			//N == 0 only
+			FString text_;
+	};
+}
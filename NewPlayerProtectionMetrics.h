@@ -0,0 +1,223 @@
+#pragma once
+
+#include <Requests.h>
+
+namespace NewPlayerProtection
+{
+	//pushes the Counters and a few gauges to MetricsPushUrl as Prometheus text or InfluxDB line protocol.
+	//samples are taken every MetricsSampleIntervalInSecs and posted together every MetricsPushIntervalInSecs,
+	//the request runs on ArkApi's curl multi handle so the game thread never waits for the endpoint.
+	class MetricsPusher
+	{
+		public:
+			static MetricsPusher& Get();
+
+			MetricsPusher(const MetricsPusher&) = delete;
+			MetricsPusher(MetricsPusher&&) = delete;
+			MetricsPusher& operator=(const MetricsPusher&) = delete;
+			MetricsPusher& operator=(MetricsPusher&&) = delete;
+
+			void Start();
+			void Stop();
+
+		private:
+			MetricsPusher() = default;
+			~MetricsPusher() = default;
+
+			static constexpr size_t metric_count_ = 8;
+
+			struct Sample
+			{
+				int64 timestamp_ms;
+				std::array<int64, metric_count_> values;
+			};
+
+			void Tick();
+			void TakeSample();
+			void Push(const Settings& settings);
+			std::string FormatPrometheus() const;
+			std::string FormatInflux() const;
+
+			static constexpr const char* metric_names_[metric_count_] =
+			{
+				"npp_blocked_hits_total",
+				"npp_allowed_hits_total",
+				"npp_notifications_sent_total",
+				"npp_protection_gained_total",
+				"npp_protection_lost_total",
+				"npp_save_duration_ms",
+				"npp_db_queue_depth",
+				"npp_resident_players"
+			};
+			static constexpr const char* metric_types_[metric_count_] = { "counter", "counter", "counter", "counter", "counter", "gauge", "gauge", "gauge" };
+
+			//samples kept while the endpoint is down or slow, the oldest are dropped past this
+			static constexpr size_t max_samples_ = 1024;
+
+			std::vector<Sample> samples_;
+			std::chrono::steady_clock::time_point next_sample_;
+			std::chrono::steady_clock::time_point next_push_;
+			//only one request at a time, a slow endpoint makes the next batch bigger instead of piling up requests
+			std::shared_ptr<bool> in_flight_ = std::make_shared<bool>(false);
+			bool running_ = false;
+	};
+}
+
+NewPlayerProtection::MetricsPusher& NewPlayerProtection::MetricsPusher::Get()
+{
+	static MetricsPusher instance;
+	return instance;
+}
+
+void NewPlayerProtection::MetricsPusher::Start()
+{
+	if (running_)
+		return;
+
+	running_ = true;
+	next_sample_ = std::chrono::steady_clock::now();
+	next_push_ = next_sample_;
+	ArkApi::GetCommands().AddOnTimerCallback("NPPMetrics", std::bind(&NewPlayerProtection::MetricsPusher::Tick, this));
+
+	NewPlayerProtection::EventBus::Get().Subscribe("NPPMetrics", [](const std::vector<ProtectionEvent>& events)
+	{
+		auto& counters = NewPlayerProtection::GetCounters();
+
+		for (const auto& event : events)
+		{
+			counters.protectionGained += event.type == ProtectionEventType::ProtectionGained ? 1 : 0;
+			counters.protectionLost += event.type == ProtectionEventType::ProtectionLost ? 1 : 0;
+		}
+	});
+}
+
+void NewPlayerProtection::MetricsPusher::Stop()
+{
+	if (!running_)
+		return;
+
+	running_ = false;
+	ArkApi::GetCommands().RemoveOnTimerCallback("NPPMetrics");
+	NewPlayerProtection::EventBus::Get().Unsubscribe("NPPMetrics");
+}
+
+void NewPlayerProtection::MetricsPusher::Tick()
+{
+	const auto settings = NewPlayerProtection::GetSettings();
+
+	if (settings->MetricsPushUrl.empty())
+	{
+		samples_.clear();
+		return;
+	}
+
+	const auto now = std::chrono::steady_clock::now();
+
+	if (now >= next_sample_)
+	{
+		next_sample_ = now + std::chrono::seconds(std::max(1, settings->MetricsSampleIntervalInSecs));
+		TakeSample();
+	}
+
+	if (now >= next_push_ && !*in_flight_ && !samples_.empty())
+	{
+		next_push_ = now + std::chrono::seconds(std::max(1, settings->MetricsPushIntervalInSecs));
+		Push(*settings);
+	}
+}
+
+void NewPlayerProtection::MetricsPusher::TakeSample()
+{
+	const auto& counters = NewPlayerProtection::GetCounters();
+
+	Sample sample;
+	sample.timestamp_ms = NewPlayerProtection::ToEpochMs(std::chrono::system_clock::now());
+	sample.values = {
+		static_cast<int64>(counters.blockedHits),
+		static_cast<int64>(counters.allowedHits),
+		static_cast<int64>(counters.notificationsSent),
+		static_cast<int64>(counters.protectionGained),
+		static_cast<int64>(counters.protectionLost),
+		counters.lastSaveDurationMs.load(),
+		static_cast<int64>(NewPlayerProtection::DBWriter::Get().GetQueueDepth()),
+		static_cast<int64>(NewPlayerProtection::TimerProt::Get().GetAllPlayers().size())
+	};
+
+	if (samples_.size() >= max_samples_)
+	{
+		samples_.erase(samples_.begin());
+	}
+	samples_.push_back(sample);
+}
+
+void NewPlayerProtection::MetricsPusher::Push(const Settings& settings)
+{
+	const bool influx = settings.MetricsFormat == "influx";
+
+	//older ArkApi builds hand curl a pointer to the body instead of a copy, so the callback owns it until the request is done
+	auto body = std::make_shared<std::string>(influx ? FormatInflux() : FormatPrometheus());
+	const size_t count = samples_.size();
+
+	std::vector<std::string> headers = { influx ? "Content-Type: text/plain; charset=utf-8" : "Content-Type: text/plain; version=0.0.4" };
+
+	*in_flight_ = true;
+
+	//the flag is shared so the callback stays valid whatever happens to the pusher
+	auto in_flight = in_flight_;
+	const bool started = API::Requests::Get().CreatePostRequest(settings.MetricsPushUrl, [in_flight, body, count](bool success, std::string response)
+	{
+		*in_flight = false;
+
+		if (!success)
+		{
+			NPP_LOG(warn, "NPP metrics push of {} samples failed: {}", count, response);
+		}
+	}, *body, std::move(headers));
+
+	if (!started)
+	{
+		//left queued for the next push
+		*in_flight_ = false;
+		NPP_LOG(warn, "NPP metrics push could not be started, {} samples kept.", count);
+		return;
+	}
+
+	samples_.clear();
+}
+
+std::string NewPlayerProtection::MetricsPusher::FormatPrometheus() const
+{
+	std::string text;
+
+	//every sample of a metric has to follow its TYPE line
+	for (size_t metric = 0; metric < metric_count_; ++metric)
+	{
+		text += std::string("# TYPE ") + metric_names_[metric] + " " + metric_types_[metric] + "\n";
+
+		for (const auto& sample : samples_)
+		{
+			text += std::string(metric_names_[metric]) + " " + std::to_string(sample.values[metric]) + " " + std::to_string(sample.timestamp_ms) + "\n";
+		}
+	}
+	return text;
+}
+
+std::string NewPlayerProtection::MetricsPusher::FormatInflux() const
+{
+	std::string text;
+
+	for (const auto& sample : samples_)
+	{
+		text += "npp ";
+
+		for (size_t metric = 0; metric < metric_count_; ++metric)
+		{
+			//field names without the npp_ prefix, the measurement already says it
+			text += std::string(metric ? "," : "") + (metric_names_[metric] + 4) + "=" + std::to_string(sample.values[metric]) + "i";
+		}
+
+		//line protocol defaults to ns precision
+		text += " " + std::to_string(sample.timestamp_ms) + "000000\n";
+	}
+	return text;
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+namespace NewPlayerProtection
+{
+	//LEB128 varints, signed values zigzagged first. the snapshot and the replication datagrams store ids and timestamps
+	//as differences to the previous entry with these, which takes most of them from 8 bytes down to 1 to 3
+	class PackWriter
+	{
+		public:
+			explicit PackWriter(std::string& out)
+				: out_(out)
+			{}
+
+			void Unsigned(uint64 value)
+			{
+				while (value >= 0x80)
+				{
+					out_.push_back(static_cast<char>(value | 0x80));
+					value >>= 7;
+				}
+				out_.push_back(static_cast<char>(value));
+			}
+
+			void Signed(int64 value)
+			{
+				Unsigned((static_cast<uint64>(value) << 1) ^ static_cast<uint64>(value >> 63));
+			}
+
+			//difference of two unrelated ids, wraps around instead of overflowing
+			void Delta(uint64 value, uint64 previous)
+			{
+				Signed(static_cast<int64>(value - previous));
+			}
+
+		private:
+			std::string& out_;
+	};
+
+	//reads what PackWriter wrote, every read is false once the input ran out or a varint is longer than 64 bits
+	class PackReader
+	{
+		public:
+			PackReader(const char* data, size_t size)
+				: cursor_(reinterpret_cast<const uint8*>(data)), end_(reinterpret_cast<const uint8*>(data) + size)
+			{}
+
+			bool Unsigned(uint64& value)
+			{
+				value = 0;
+
+				for (unsigned shift = 0; shift < 64 && cursor_ < end_; shift += 7)
+				{
+					const uint8 byte = *cursor_++;
+					value |= static_cast<uint64>(byte & 0x7F) << shift;
+
+					if ((byte & 0x80) == 0)
+						return true;
+				}
+				return false;
+			}
+
+			bool Signed(int64& value)
+			{
+				uint64 raw;
+
+				if (!Unsigned(raw))
+					return false;
+
+				value = static_cast<int64>(raw >> 1) ^ -static_cast<int64>(raw & 1);
+				return true;
+			}
+
+			bool Delta(uint64& value, uint64 previous)
+			{
+				int64 delta;
+
+				if (!Signed(delta))
+					return false;
+
+				value = previous + static_cast<uint64>(delta);
+				return true;
+			}
+
+			bool AtEnd() const
+			{
+				return cursor_ == end_;
+			}
+
+			const char* Position() const
+			{
+				return reinterpret_cast<const char*>(cursor_);
+			}
+
+		private:
+			const uint8* cursor_;
+			const uint8* end_;
+	};
+
+	//FNV-1a, catches a packed section that was cut short or damaged before any of it is decoded into the tables
+	inline uint64 HashBytes(const char* data, size_t size)
+	{
+		uint64 hash = 14695981039346656037ull;
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash ^= static_cast<uint8>(data[i]);
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+}
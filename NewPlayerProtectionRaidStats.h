@@ -0,0 +1,191 @@
+#pragma once
+
+#include <fstream>
+
+namespace NewPlayerProtection
+{
+	//which protected tribes are being probed and by whom. the damage hook only bumps BlockedDamageLog, once a minute
+	//its per pair counts are folded into running totals per attacked and attacking tribe and kept as heatmap rows,
+	//which are appended to RaidHeatmap.csv every RaidStatsDumpIntervalInMins.
+	class RaidStats
+	{
+		public:
+			static RaidStats& Get();
+
+			RaidStats(const RaidStats&) = delete;
+			RaidStats(RaidStats&&) = delete;
+			RaidStats& operator=(const RaidStats&) = delete;
+			RaidStats& operator=(RaidStats&&) = delete;
+
+			//game thread, every timer tick
+			void Tick(std::chrono::steady_clock::time_point now);
+
+			//"attacked,tribe_id,hits,last_minute_hits" and "attacking,..." lines of the count tribes with the most blocked hits
+			std::string Format(size_t count) const;
+			void Reset();
+
+			std::string GetPath() const
+			{
+				return ArkApi::Tools::GetCurrentDir() + "/ArkApi/Plugins/NewPlayerProtection/RaidHeatmap.csv";
+			}
+
+		private:
+			RaidStats() = default;
+			~RaidStats() = default;
+
+			struct Totals
+			{
+				uint64 hits = 0;
+				//hits in the last minute the tribe was seen in
+				uint64 last_minute_hits = 0;
+				int64 last_minute_ms = 0;
+			};
+
+			struct Row
+			{
+				int64 minute_ms;
+				uint64 attacking_tribe;
+				uint64 attacked_tribe;
+				uint64 hits;
+			};
+
+			void Roll(int64 minute_ms);
+			void Dump();
+			static void AppendTop(std::string& text, const char* label, const std::unordered_map<uint64, Totals>& totals, size_t count);
+
+			//rows kept for the file while the dump is off or can't write, the oldest are dropped past this
+			static constexpr size_t max_rows_ = 100000;
+
+			std::unordered_map<uint64, Totals> attacked_;
+			std::unordered_map<uint64, Totals> attacking_;
+			std::vector<Row> rows_;
+			std::chrono::steady_clock::time_point next_roll_;
+			std::chrono::steady_clock::time_point next_dump_;
+			bool started_ = false;
+	};
+}
+
+NewPlayerProtection::RaidStats& NewPlayerProtection::RaidStats::Get()
+{
+	static RaidStats instance;
+	return instance;
+}
+
+void NewPlayerProtection::RaidStats::Tick(std::chrono::steady_clock::time_point now)
+{
+	const int dump_mins = NewPlayerProtection::GetSettings()->RaidStatsDumpIntervalInMins;
+
+	if (!started_)
+	{
+		started_ = true;
+		next_roll_ = now + std::chrono::minutes(1);
+		next_dump_ = now + std::chrono::minutes(std::max(1, dump_mins));
+		return;
+	}
+
+	if (now >= next_roll_)
+	{
+		next_roll_ = now + std::chrono::minutes(1);
+
+		const int64 now_ms = NewPlayerProtection::ToEpochMs(std::chrono::system_clock::now());
+		Roll(now_ms - now_ms % 60000);
+	}
+
+	if (now >= next_dump_)
+	{
+		next_dump_ = now + std::chrono::minutes(std::max(1, dump_mins));
+
+		if (dump_mins > 0)
+		{
+			Dump();
+		}
+	}
+}
+
+void NewPlayerProtection::RaidStats::Roll(int64 minute_ms)
+{
+	NewPlayerProtection::BlockedDamage.TakeMinute([this, minute_ms](uint64 attacking_tribe, uint64 attacked_tribe, uint64 hits)
+	{
+		for (auto* totals : { &attacked_[attacked_tribe], &attacking_[attacking_tribe] })
+		{
+			totals->hits += hits;
+			totals->last_minute_hits = totals->last_minute_ms == minute_ms ? totals->last_minute_hits + hits : hits;
+			totals->last_minute_ms = minute_ms;
+		}
+
+		if (rows_.size() >= max_rows_)
+		{
+			rows_.erase(rows_.begin(), rows_.begin() + max_rows_ / 10);
+		}
+		rows_.push_back({ minute_ms, attacking_tribe, attacked_tribe, hits });
+	});
+}
+
+void NewPlayerProtection::RaidStats::Dump()
+{
+	if (rows_.empty())
+		return;
+
+	const std::string path = GetPath();
+	const bool exists = std::ifstream(path).good();
+	std::ofstream file(path, std::ios::out | std::ios::app);
+
+	if (!file.is_open())
+	{
+		NPP_LOG(err, "({} {}) Could not open raid heatmap file {}", __FILE__, __FUNCTION__, path);
+		return;
+	}
+
+	if (!exists)
+	{
+		file << "minute_ms,attacking_tribe,attacked_tribe,blocked_hits\n";
+	}
+
+	for (const auto& row : rows_)
+	{
+		file << row.minute_ms << ',' << row.attacking_tribe << ',' << row.attacked_tribe << ',' << row.hits << '\n';
+	}
+
+	if (file)
+	{
+		rows_.clear();
+	}
+}
+
+void NewPlayerProtection::RaidStats::AppendTop(std::string& text, const char* label, const std::unordered_map<uint64, Totals>& totals, size_t count)
+{
+	std::vector<std::pair<uint64, const Totals*>> sorted;
+	sorted.reserve(totals.size());
+
+	for (const auto& tribe : totals)
+	{
+		sorted.emplace_back(tribe.first, &tribe.second);
+	}
+
+	count = std::min(count, sorted.size());
+	std::partial_sort(sorted.begin(), sorted.begin() + count, sorted.end(), [](const auto& a, const auto& b)
+	{
+		return a.second->hits > b.second->hits;
+	});
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		text += "\n" + std::string(label) + "," + std::to_string(sorted[i].first) + "," + std::to_string(sorted[i].second->hits)
+			+ "," + std::to_string(sorted[i].second->last_minute_hits);
+	}
+}
+
+std::string NewPlayerProtection::RaidStats::Format(size_t count) const
+{
+	std::string text = "side,tribe_id,blocked_hits,last_minute_hits";
+
+	AppendTop(text, "attacked", attacked_, count);
+	AppendTop(text, "attacking", attacking_, count);
+	return text;
+}
+
+void NewPlayerProtection::RaidStats::Reset()
+{
+	attacked_.clear();
+	attacking_.clear();
+}
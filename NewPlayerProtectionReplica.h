@@ -0,0 +1,262 @@
+#pragma once
+
+namespace NewPlayerProtection
+{
+	//Cluster.ReplicaMode, a secondary map sharing the home map's database file only enforces what the home map wrote.
+	//it saves nothing and decides no expiry, instead it reads the Players rows of its resident tribes and the PVE tribes
+	//back every Cluster.ReplicaRefreshInSecs on the task thread, and only when PRAGMA data_version shows another connection committed.
+	class ReplicaSync
+	{
+		public:
+			static ReplicaSync& Get();
+
+			ReplicaSync(const ReplicaSync&) = delete;
+			ReplicaSync(ReplicaSync&&) = delete;
+			ReplicaSync& operator=(const ReplicaSync&) = delete;
+			ReplicaSync& operator=(ReplicaSync&&) = delete;
+
+			void Start();
+			void Stop();
+
+		private:
+			ReplicaSync() = default;
+			~ReplicaSync() = default;
+
+			struct Refresh
+			{
+				//false when data_version did not move or the read failed
+				bool read = false;
+				int64 data_version = 0;
+				std::vector<PlayerRow> players;
+				std::unordered_set<uint64> pveTribes;
+			};
+
+			//game thread, once a second
+			void Tick();
+			//task thread
+			static Refresh Read(sqlite::database& db, const std::vector<uint64>& tribe_ids, int64 data_version);
+			//game thread
+			void Apply(const Refresh& refresh);
+
+			std::chrono::steady_clock::time_point next_refresh_;
+			//of the connection that reads, it only moves when another connection committed
+			int64 data_version_ = -1;
+			bool running_ = false;
+			bool in_flight_ = false;
+	};
+}
+
+NewPlayerProtection::ReplicaSync& NewPlayerProtection::ReplicaSync::Get()
+{
+	static ReplicaSync instance;
+	return instance;
+}
+
+void NewPlayerProtection::ReplicaSync::Start()
+{
+	if (running_)
+		return;
+
+	running_ = true;
+	//the loader just read everything, there is nothing newer yet
+	next_refresh_ = std::chrono::steady_clock::now() + std::chrono::seconds(std::max(1, NewPlayerProtection::GetSettings()->ClusterReplicaRefreshInSecs));
+	ArkApi::GetCommands().AddOnTimerCallback("NPPReplica", std::bind(&NewPlayerProtection::ReplicaSync::Tick, this));
+
+	Log::GetLog()->info("NPP runs as a replica, protection is read from the home map's database.");
+}
+
+void NewPlayerProtection::ReplicaSync::Stop()
+{
+	if (!running_)
+		return;
+
+	running_ = false;
+	ArkApi::GetCommands().RemoveOnTimerCallback("NPPReplica");
+}
+
+void NewPlayerProtection::ReplicaSync::Tick()
+{
+	const auto now = std::chrono::steady_clock::now();
+
+	if (in_flight_ || now < next_refresh_)
+		return;
+
+	next_refresh_ = now + std::chrono::seconds(std::max(1, NewPlayerProtection::GetSettings()->ClusterReplicaRefreshInSecs));
+
+	const auto& resident = NewPlayerProtection::TimerProt::Get().resident_tribes_;
+	std::vector<uint64> tribe_ids(resident.begin(), resident.end());
+
+	in_flight_ = true;
+
+	NewPlayerProtection::GameTasks::Get().Query<Refresh>([tribe_ids = std::move(tribe_ids), data_version = data_version_](sqlite::database& db)
+	{
+		return Read(db, tribe_ids, data_version);
+	},
+	[](const Refresh& refresh)
+	{
+		auto& replica = NewPlayerProtection::ReplicaSync::Get();
+		replica.in_flight_ = false;
+
+		if (refresh.read && replica.running_)
+		{
+			replica.data_version_ = refresh.data_version;
+			replica.Apply(refresh);
+		}
+	});
+}
+
+NewPlayerProtection::ReplicaSync::Refresh NewPlayerProtection::ReplicaSync::Read(sqlite::database& db, const std::vector<uint64>& tribe_ids, int64 data_version)
+{
+	Refresh refresh;
+
+	db << "PRAGMA data_version;" >> refresh.data_version;
+
+	if (refresh.data_version == data_version)
+		return refresh;
+
+	//same literal lists as WithResidentTribes, in one read transaction so the rows all come from the same save
+	const size_t chunk_size = 500;
+
+	db << "BEGIN TRANSACTION;";
+
+	try
+	{
+		for (size_t first = 0; first < tribe_ids.size(); first += chunk_size)
+		{
+			std::string where = "TribeId IN (";
+
+			for (size_t i = first; i < std::min(first + chunk_size, tribe_ids.size()); ++i)
+			{
+				where += std::to_string(tribe_ids[i]);
+				where += ',';
+			}
+			where.back() = ')';
+
+			ReadPlayerRows(db, where, [&refresh](const NewPlayerProtection::PlayerRow& row)
+			{
+				refresh.players.push_back(row);
+			});
+		}
+
+		db << "SELECT TribeId FROM PVE_Tribes where Is_Protected = 1;" >> [&refresh](uint64 tribeid)
+		{
+			refresh.pveTribes.insert(tribeid);
+		};
+	}
+	catch (const sqlite::sqlite_exception&)
+	{
+		db << "ROLLBACK;";
+		throw;
+	}
+
+	db << "COMMIT;";
+
+	refresh.read = true;
+	return refresh;
+}
+
+void NewPlayerProtection::ReplicaSync::Apply(const Refresh& refresh)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	std::unordered_set<uint64> touched_tribes;
+	size_t players = 0;
+
+	for (const auto& row : refresh.players)
+	{
+		auto* data = timer.FindPlayer(row.steam_id);
+		const uint32 startSecs = NewPlayerProtection::ToEpochSecs(NewPlayerProtection::FromEpochMs(row.start_ms));
+
+		if (!data)
+		{
+			//the tribe is resident, so its aggregate has to count the new member
+			if (timer.GetTribe(row.tribe_id) && timer.AddPlayerFromDB(row.steam_id, row.tribe_id, NewPlayerProtection::FromEpochMs(row.start_ms),
+				NewPlayerProtection::FromEpochMs(row.last_login_ms), row.level, row.is_new_player))
+			{
+				touched_tribes.insert(row.tribe_id);
+				++players;
+			}
+			continue;
+		}
+
+		//tribe and level of a player online here are newer than what the home map last saw, the protection itself is the home map's
+		const bool local = data->isOnline;
+
+		if (data->startSecs == startSecs && data->isNewPlayer == (row.is_new_player != 0)
+			&& (local || (data->tribe_id == row.tribe_id && data->level == NewPlayerProtection::TimerProt::AllPlayerData::ToLevel(row.level))))
+			continue;
+
+		touched_tribes.insert(data->tribe_id);
+
+		if (!local)
+		{
+			if (data->tribe_id != row.tribe_id)
+			{
+				timer.SetPlayerTribe(*timer.player_index_.Find(row.steam_id), row.tribe_id);
+			}
+
+			data->SetLevel(row.level);
+			timer.SetLastLoginDateTime(*data, std::max(timer.LastLoginDateTime(*data), NewPlayerProtection::FromEpochMs(row.last_login_ms)));
+		}
+
+		data->startSecs = startSecs;
+		data->isNewPlayer = row.is_new_player != 0;
+
+		touched_tribes.insert(data->tribe_id);
+		++players;
+	}
+
+	size_t pve_tribes = 0;
+
+	const auto set_pve = [&touched_tribes, &pve_tribes](uint64 tribe_id, bool isPve)
+	{
+		if (isPve)
+		{
+			NewPlayerProtection::pveTribesList.insert(tribe_id);
+			NewPlayerProtection::removedPveTribesList.erase(tribe_id);
+		}
+		else
+		{
+			NewPlayerProtection::pveTribesList.erase(tribe_id);
+			NewPlayerProtection::removedPveTribesList.insert(tribe_id);
+		}
+
+		//not MarkPveDirty, a replica writes nothing back
+		NewPlayerProtection::EventBus::Get().Publish(isPve ? NewPlayerProtection::ProtectionEventType::PveEnabled
+			: NewPlayerProtection::ProtectionEventType::PveDisabled, tribe_id);
+		touched_tribes.insert(tribe_id);
+		++pve_tribes;
+	};
+
+	std::vector<uint64> removed;
+
+	for (const uint64 tribe_id : NewPlayerProtection::pveTribesList)
+	{
+		if (refresh.pveTribes.count(tribe_id) == 0)
+		{
+			removed.push_back(tribe_id);
+		}
+	}
+
+	for (const uint64 tribe_id : removed)
+	{
+		set_pve(tribe_id, false);
+	}
+
+	for (const uint64 tribe_id : refresh.pveTribes)
+	{
+		if (NewPlayerProtection::pveTribesList.count(tribe_id) == 0)
+		{
+			set_pve(tribe_id, true);
+		}
+	}
+
+	for (const uint64 tribe_id : touched_tribes)
+	{
+		timer.UpdateTribe(tribe_id);
+	}
+
+	if (players > 0 || pve_tribes > 0)
+	{
+		NPP_LOG(info, "NPP replica applied {} player and {} PVE tribe changes from the home map.", players, pve_tribes);
+	}
+}
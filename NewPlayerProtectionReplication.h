@@ -0,0 +1,561 @@
+#pragma once
+
+#pragma comment(lib, "Ws2_32.lib")
+
+namespace NewPlayerProtection
+{
+	struct ReplicationOptions
+	{
+		//host:port of every node in the same order on every map, this map is nodes[node_index]
+		std::vector<std::string> nodes;
+		size_t node_index = 0;
+		//shared by the cluster, keeps stray datagrams out, it is not an authentication
+		std::string key;
+	};
+
+	//what admin commands change on a tribe, expiry is left out since every node computes it from the same start dates
+	struct TribeReplica
+	{
+		//ms since epoch the protection runs from, 0 when unprotected
+		int64 protection_start_ms = 0;
+		bool isPVE = false;
+		//node that wrote this state, breaks ties between concurrent changes
+		uint16 writer = 0;
+		//per node ms of its last change to the tribe, wall clock so it keeps growing across restarts
+		std::vector<int64> version;
+	};
+
+#pragma pack(push, 1)
+	struct DeltaHeader
+	{
+		char magic[4];
+		uint16 protocol;
+		uint16 node_count;
+		uint16 delta_count;
+		uint64 key_hash;
+	};
+
+#pragma pack(pop)
+
+	//the header is followed by delta_count records sorted by tribe id, packed with PackWriter as differences to the record
+	//before: tribe id, protection start, writer << 1 | isPVE, then the node_count version entries each to the one before it
+
+	//publishes tribe protection deltas to the other nodes over UDP and applies theirs to TimerProt.
+	//every delta carries a version vector, a delta older than the local state is dropped, concurrent ones pick the same winner
+	//on every node, so nodes agree without any shared database and without remote lookups from the damage hook.
+	class Replication
+	{
+		public:
+			static Replication& Get();
+
+			Replication(const Replication&) = delete;
+			Replication(Replication&&) = delete;
+			Replication& operator=(const Replication&) = delete;
+			Replication& operator=(Replication&&) = delete;
+
+			void Start(const ReplicationOptions& options);
+			void Stop();
+
+			//game thread, after a local admin change of the tribe
+			void PublishTribe(uint64 tribe_id);
+
+		private:
+			Replication() = default;
+			~Replication() = default;
+
+			struct Delta
+			{
+				uint64 tribe_id;
+				TribeReplica replica;
+			};
+
+			void Receive();
+			void Tick();
+			void Apply(const Delta& delta);
+			void ApplyToTribe(uint64 tribe_id, const TribeReplica& replica);
+			void Send(std::vector<uint64> tribe_ids);
+			//previous holds the record packed before it, the first one of a datagram is packed against an empty record
+			static void PackDelta(PackWriter& writer, const Delta& delta, const Delta& previous);
+			static bool UnpackDelta(PackReader& reader, size_t node_count, Delta& delta);
+
+			static uint64 HashKey(const std::string& key);
+			static bool Dominates(const std::vector<int64>& a, const std::vector<int64>& b);
+
+			static constexpr char magic_[4] = { 'N', 'P', 'P', 'R' };
+			static constexpr uint16 protocol_ = 2;
+			//stays under the usual 1500 byte mtu
+			static constexpr size_t max_datagram_ = 1400;
+			//udp drops datagrams, each delta is sent again this long after it was published
+			static constexpr std::chrono::seconds resend_after_[2] = { std::chrono::seconds(2), std::chrono::seconds(10) };
+
+			ReplicationOptions options_;
+			uint64 key_hash_ = 0;
+			std::vector<sockaddr_in> peers_;
+			SOCKET socket_ = INVALID_SOCKET;
+			std::thread thread_;
+			std::atomic<bool> running_{ false };
+
+			//received by the socket thread, applied on the next tick
+			std::mutex mutex_;
+			std::vector<Delta> incoming_;
+
+			//game thread only
+			std::unordered_map<uint64, TribeReplica> replicas_;
+			//(next send, tribe_id, resends done)
+			std::vector<std::tuple<std::chrono::steady_clock::time_point, uint64, size_t>> resends_;
+	};
+}
+
+NewPlayerProtection::Replication& NewPlayerProtection::Replication::Get()
+{
+	static Replication instance;
+	return instance;
+}
+
+uint64 NewPlayerProtection::Replication::HashKey(const std::string& key)
+{
+	uint64 hash = 14695981039346656037ull;
+
+	for (const char c : key)
+	{
+		hash ^= static_cast<uint8>(c);
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+bool NewPlayerProtection::Replication::Dominates(const std::vector<int64>& a, const std::vector<int64>& b)
+{
+	for (size_t i = 0; i < a.size(); ++i)
+	{
+		if (a[i] < b[i])
+			return false;
+	}
+	return true;
+}
+
+void NewPlayerProtection::Replication::Start(const ReplicationOptions& options)
+{
+	if (running_ || options.nodes.empty())
+		return;
+
+	if (options.node_index >= options.nodes.size())
+	{
+		NPP_LOG(err, "({} {}) Cluster NodeIndex {} is not in Nodes, replication disabled", __FILE__, __FUNCTION__, options.node_index);
+		return;
+	}
+
+	std::vector<sockaddr_in> addresses;
+
+	for (const auto& node : options.nodes)
+	{
+		const size_t colon = node.rfind(':');
+		sockaddr_in address{};
+		address.sin_family = AF_INET;
+
+		try
+		{
+			if (colon == std::string::npos)
+				throw std::invalid_argument("missing port");
+
+			address.sin_port = htons(static_cast<uint16>(std::stoul(node.substr(colon + 1))));
+		}
+		catch (const std::exception& exception)
+		{
+			NPP_LOG(warn, "({} {}) Parsing error {}", __FILE__, __FUNCTION__, exception.what());
+			return;
+		}
+
+		const std::string host = node.substr(0, colon);
+		address.sin_addr.s_addr = inet_addr(host.c_str());
+
+		if (address.sin_addr.s_addr == INADDR_NONE)
+		{
+			const hostent* entry = gethostbyname(host.c_str());
+
+			if (!entry || entry->h_addrtype != AF_INET)
+			{
+				NPP_LOG(err, "({} {}) Could not resolve cluster node {}, replication disabled", __FILE__, __FUNCTION__, node);
+				return;
+			}
+			address.sin_addr.s_addr = *reinterpret_cast<const uint32*>(entry->h_addr_list[0]);
+		}
+		addresses.push_back(address);
+	}
+
+	WSADATA wsa_data;
+
+	if (WSAStartup(MAKEWORD(2, 2), &wsa_data) != 0)
+	{
+		NPP_LOG(err, "({} {}) Could not start winsock, replication disabled", __FILE__, __FUNCTION__);
+		return;
+	}
+
+	socket_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+	sockaddr_in local{};
+	local.sin_family = AF_INET;
+	local.sin_port = addresses[options.node_index].sin_port;
+	local.sin_addr.s_addr = htonl(INADDR_ANY);
+
+	if (socket_ == INVALID_SOCKET || bind(socket_, reinterpret_cast<const sockaddr*>(&local), sizeof(local)) == SOCKET_ERROR)
+	{
+		NPP_LOG(err, "({} {}) Could not bind replication port {}, error {}", __FILE__, __FUNCTION__, ntohs(local.sin_port), WSAGetLastError());
+
+		if (socket_ != INVALID_SOCKET)
+		{
+			closesocket(socket_);
+			socket_ = INVALID_SOCKET;
+		}
+		WSACleanup();
+		return;
+	}
+
+	options_ = options;
+	key_hash_ = HashKey(options.key);
+	peers_.clear();
+
+	for (size_t i = 0; i < addresses.size(); ++i)
+	{
+		if (i != options.node_index)
+		{
+			peers_.push_back(addresses[i]);
+		}
+	}
+
+	running_ = true;
+	thread_ = std::thread(&Replication::Receive, this);
+	ArkApi::GetCommands().AddOnTimerCallback("NPPReplication", std::bind(&NewPlayerProtection::Replication::Tick, this));
+
+	NPP_LOG(info, "NPP replication started as node {} of {}.", options.node_index, options.nodes.size());
+}
+
+void NewPlayerProtection::Replication::Stop()
+{
+	if (!running_)
+		return;
+
+	running_ = false;
+	ArkApi::GetCommands().RemoveOnTimerCallback("NPPReplication");
+
+	//closing the socket fails the pending recvfrom, the thread exits on its own, joining here could hang under the loader lock
+	closesocket(socket_);
+	socket_ = INVALID_SOCKET;
+
+	if (thread_.joinable())
+	{
+		thread_.detach();
+	}
+	WSACleanup();
+}
+
+void NewPlayerProtection::Replication::Receive()
+{
+	NewPlayerProtection::ApplyBackgroundThreadSettings("replication");
+
+	std::vector<char> buffer(max_datagram_);
+	const SOCKET socket = socket_;
+
+	while (true)
+	{
+		sockaddr_in from{};
+		int from_len = sizeof(from);
+		const int received = recvfrom(socket, buffer.data(), static_cast<int>(buffer.size()), 0, reinterpret_cast<sockaddr*>(&from), &from_len);
+
+		if (received == SOCKET_ERROR)
+		{
+			//closed by Stop
+			if (!running_)
+				return;
+			continue;
+		}
+
+		if (static_cast<size_t>(received) < sizeof(DeltaHeader))
+			continue;
+
+		DeltaHeader header;
+		std::memcpy(&header, buffer.data(), sizeof(header));
+
+		if (!std::equal(std::begin(magic_), std::end(magic_), header.magic) || header.protocol != protocol_ || header.key_hash != key_hash_
+			|| header.node_count != options_.nodes.size())
+		{
+			continue;
+		}
+
+		std::vector<Delta> deltas(header.delta_count);
+		PackReader reader(buffer.data() + sizeof(DeltaHeader), static_cast<size_t>(received) - sizeof(DeltaHeader));
+		bool whole = true;
+		Delta previous{};
+
+		for (auto& delta : deltas)
+		{
+			delta = previous;
+
+			if (!UnpackDelta(reader, header.node_count, delta))
+			{
+				whole = false;
+				break;
+			}
+			previous = delta;
+		}
+
+		//a datagram that doesn't end with its last record is dropped whole
+		if (!whole || !reader.AtEnd())
+			continue;
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		incoming_.insert(incoming_.end(), deltas.begin(), deltas.end());
+	}
+}
+
+void NewPlayerProtection::Replication::PublishTribe(uint64 tribe_id)
+{
+	if (!running_)
+		return;
+
+	const auto tribe = NewPlayerProtection::TimerProt::Get().GetTribe(tribe_id);
+
+	auto& replica = replicas_[tribe_id];
+	replica.version.resize(options_.nodes.size());
+	replica.protection_start_ms = tribe && tribe->isProtected ? NewPlayerProtection::ToEpochMs(tribe->oldestStartDateTime) : 0;
+	replica.isPVE = NewPlayerProtection::pveTribesList.count(tribe_id) > 0;
+	replica.writer = static_cast<uint16>(options_.node_index);
+
+	//two changes within a millisecond still get distinct versions
+	int64& own = replica.version[options_.node_index];
+	own = std::max(own + 1, NewPlayerProtection::ToEpochMs(std::chrono::system_clock::now()));
+
+	Send({ tribe_id });
+	resends_.emplace_back(std::chrono::steady_clock::now() + resend_after_[0], tribe_id, 0);
+}
+
+void NewPlayerProtection::Replication::PackDelta(PackWriter& writer, const Delta& delta, const Delta& previous)
+{
+	writer.Unsigned(delta.tribe_id - previous.tribe_id);
+	writer.Signed(delta.replica.protection_start_ms - previous.replica.protection_start_ms);
+	writer.Unsigned(static_cast<uint64>(delta.replica.writer) << 1 | (delta.replica.isPVE ? 1 : 0));
+
+	int64 before = previous.replica.version.empty() ? 0 : previous.replica.version.front();
+
+	for (const int64 version : delta.replica.version)
+	{
+		writer.Signed(version - before);
+		before = version;
+	}
+}
+
+bool NewPlayerProtection::Replication::UnpackDelta(PackReader& reader, size_t node_count, Delta& delta)
+{
+	uint64 tribe_delta, writer_and_flag;
+	int64 start_delta;
+
+	if (!reader.Unsigned(tribe_delta) || !reader.Signed(start_delta) || !reader.Unsigned(writer_and_flag) || writer_and_flag >> 1 > 0xFFFF)
+		return false;
+
+	delta.tribe_id += tribe_delta;
+	delta.replica.protection_start_ms += start_delta;
+	delta.replica.writer = static_cast<uint16>(writer_and_flag >> 1);
+	delta.replica.isPVE = (writer_and_flag & 1) != 0;
+
+	int64 before = delta.replica.version.empty() ? 0 : delta.replica.version.front();
+	delta.replica.version.resize(node_count);
+
+	for (auto& version : delta.replica.version)
+	{
+		int64 version_delta;
+
+		if (!reader.Signed(version_delta))
+			return false;
+
+		version = before += version_delta;
+	}
+	return true;
+}
+
+void NewPlayerProtection::Replication::Send(std::vector<uint64> tribe_ids)
+{
+	//sorted so the tribe ids are packed as small steps
+	std::sort(tribe_ids.begin(), tribe_ids.end());
+	tribe_ids.erase(std::unique(tribe_ids.begin(), tribe_ids.end()), tribe_ids.end());
+
+	DeltaHeader header;
+	std::copy(std::begin(magic_), std::end(magic_), header.magic);
+	header.protocol = protocol_;
+	header.node_count = static_cast<uint16>(options_.nodes.size());
+	header.key_hash = key_hash_;
+
+	std::string buffer(sizeof(header), '\0');
+	std::string record;
+	uint16 count = 0;
+	Delta previous{};
+
+	const auto flush = [this, &header, &buffer, &count, &previous]()
+	{
+		header.delta_count = count;
+		std::memcpy(&buffer[0], &header, sizeof(header));
+
+		for (const auto& peer : peers_)
+		{
+			sendto(socket_, buffer.data(), static_cast<int>(buffer.size()), 0, reinterpret_cast<const sockaddr*>(&peer), sizeof(peer));
+		}
+
+		buffer.resize(sizeof(header));
+		count = 0;
+		previous = Delta{};
+	};
+
+	for (const uint64 tribe_id : tribe_ids)
+	{
+		const Delta delta{ tribe_id, replicas_[tribe_id] };
+
+		record.clear();
+		PackWriter writer(record);
+		PackDelta(writer, delta, previous);
+
+		//a record that doesn't fit goes first in the next datagram, packed against nothing
+		if (count > 0 && buffer.size() + record.size() > max_datagram_)
+		{
+			flush();
+			record.clear();
+			PackDelta(writer, delta, previous);
+		}
+
+		buffer += record;
+		++count;
+		previous = delta;
+	}
+
+	if (count > 0)
+	{
+		flush();
+	}
+}
+
+void NewPlayerProtection::Replication::Tick()
+{
+	std::vector<Delta> deltas;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		deltas.swap(incoming_);
+	}
+
+	for (const auto& delta : deltas)
+	{
+		Apply(delta);
+	}
+
+	const auto now = std::chrono::steady_clock::now();
+	std::vector<uint64> due;
+
+	for (auto iter = resends_.begin(); iter != resends_.end();)
+	{
+		if (std::get<0>(*iter) > now)
+		{
+			++iter;
+			continue;
+		}
+
+		due.push_back(std::get<1>(*iter));
+		const size_t done = ++std::get<2>(*iter);
+
+		if (done < std::size(resend_after_))
+		{
+			std::get<0>(*iter) += resend_after_[done] - resend_after_[done - 1];
+			++iter;
+		}
+		else
+		{
+			iter = resends_.erase(iter);
+		}
+	}
+
+	if (!due.empty())
+	{
+		Send(std::move(due));
+	}
+}
+
+void NewPlayerProtection::Replication::Apply(const Delta& delta)
+{
+	auto& local = replicas_[delta.tribe_id];
+	local.version.resize(options_.nodes.size());
+
+	const auto& incoming = delta.replica;
+
+	if (Dominates(local.version, incoming.version))
+		return;
+
+	bool take = Dominates(incoming.version, local.version);
+
+	if (!take)
+	{
+		//concurrent changes, every node compares the same two states and keeps the same one
+		int64 local_sum = 0;
+		int64 incoming_sum = 0;
+
+		for (size_t i = 0; i < local.version.size(); ++i)
+		{
+			local_sum += local.version[i];
+			incoming_sum += incoming.version[i];
+		}
+		take = incoming_sum > local_sum || (incoming_sum == local_sum && incoming.writer > local.writer);
+	}
+
+	for (size_t i = 0; i < local.version.size(); ++i)
+	{
+		local.version[i] = std::max(local.version[i], incoming.version[i]);
+	}
+
+	if (!take)
+		return;
+
+	local.protection_start_ms = incoming.protection_start_ms;
+	local.isPVE = incoming.isPVE;
+	local.writer = incoming.writer;
+
+	ApplyToTribe(delta.tribe_id, local);
+}
+
+void NewPlayerProtection::Replication::ApplyToTribe(uint64 tribe_id, const TribeReplica& replica)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	timer.EnsureTribeResident(tribe_id);
+
+	for (auto* data : timer.GetTribeMembers(tribe_id))
+	{
+		if (replica.protection_start_ms == 0)
+		{
+			if (data->isNewPlayer != 0)
+			{
+				data->isNewPlayer = 0;
+				timer.MarkDirty(*data);
+			}
+		}
+		else if (!IsAdmin(*data))
+		{
+			data->isNewPlayer = 1;
+			data->SetStartDateTime(NewPlayerProtection::FromEpochMs(replica.protection_start_ms));
+			timer.MarkDirty(*data);
+		}
+	}
+
+	if (replica.isPVE != (NewPlayerProtection::pveTribesList.count(tribe_id) > 0))
+	{
+		if (replica.isPVE)
+		{
+			NewPlayerProtection::pveTribesList.insert(tribe_id);
+			NewPlayerProtection::removedPveTribesList.erase(tribe_id);
+		}
+		else
+		{
+			NewPlayerProtection::pveTribesList.erase(tribe_id);
+			NewPlayerProtection::removedPveTribesList.insert(tribe_id);
+		}
+		NewPlayerProtection::MarkPveDirty(tribe_id);
+	}
+
+	timer.ScheduleTribeExpiry(tribe_id);
+	timer.UpdateTribe(tribe_id);
+
+	NPP_LOG(info, "NPP replication applied a change to Tribe: {} from node {}.", tribe_id, replica.writer);
+}
@@ -0,0 +1,369 @@
+#pragma once
+
+#include <atomic>
+
+namespace NewPlayerProtection
+{
+	//header of the named mapping, followed by two tables of capacity entries each. the writer fills the table readers
+	//are not looking at and then flips active, a reader that raced a second flip sees the sequence move and reads again
+	struct SharedTableHeader
+	{
+		char magic[8];
+		uint32 version;
+		uint32 capacity;
+		uint64 writer_pid;
+		//ms since epoch, bumped every tick so readers can tell a writer that is gone
+		std::atomic<int64> heartbeat_ms;
+		//bumped on every publish, readers drop their cached decisions when it moves
+		std::atomic<uint64> generation;
+		std::atomic<uint32> active;
+		uint32 pad;
+		//odd while the table is being written
+		std::atomic<uint64> sequence[2];
+		uint64 count[2];
+	};
+
+	struct SharedTribeEntry
+	{
+		//0 marks an empty slot
+		uint64 tribe_id;
+		uint32 flags;
+		uint32 pad;
+	};
+
+	//tribe protection of one map process, shared with the other server processes on the host through a named mapping.
+	//one process writes what it publishes to ProtectionState, the others answer IsTribeProtected from it for tribes
+	//their own tables don't protect, so a change on the writer applies on every map of the host on the next tick
+	class SharedProtectionTable
+	{
+		public:
+			static SharedProtectionTable& Get();
+
+			SharedProtectionTable(const SharedProtectionTable&) = delete;
+			SharedProtectionTable(SharedProtectionTable&&) = delete;
+			SharedProtectionTable& operator=(const SharedProtectionTable&) = delete;
+			SharedProtectionTable& operator=(SharedProtectionTable&&) = delete;
+
+			//capacity is rounded up to a power of two, readers that start before the writer keep trying to open the mapping
+			void Start(const std::string& name, bool writer, size_t capacity);
+			void Stop();
+
+			bool IsReader() const
+			{
+				return running_ && !writer_;
+			}
+
+			//writer, game thread
+			void Publish(const ProtectionState& state);
+
+			//reader, any thread. false while the mapping is not open or the writer stopped ticking
+			bool IsProtected(uint64 tribe_id) const;
+
+		private:
+			SharedProtectionTable() = default;
+			~SharedProtectionTable() = default;
+
+			static constexpr char magic_[8] = { 'N', 'P', 'P', 'S', 'H', 'M', 'T', 0 };
+			static constexpr uint32 version_ = 1;
+			static constexpr uint32 flag_protected_ = 1;
+			static constexpr uint32 flag_pve_ = 2;
+			//a writer that missed this many seconds of heartbeats is treated as gone
+			static constexpr int64 stale_ms_ = 30000;
+			static constexpr int read_attempts_ = 4;
+
+			bool Open();
+			void Close();
+			void Tick();
+
+			size_t Slot(uint64 tribe_id) const;
+			SharedTribeEntry* Table(uint32 index) const;
+			//false when the table is full, the tribe is then only protected on the writer
+			bool Insert(SharedTribeEntry* table, uint64 tribe_id, uint32 flags) const;
+
+			std::wstring name_;
+			bool writer_ = false;
+			bool running_ = false;
+			uint32 capacity_ = 0;
+			int shift_ = 0;
+
+			HANDLE mapping_ = nullptr;
+			SharedTableHeader* header_ = nullptr;
+			//reader, generation the cached decisions were made against
+			uint64 seen_generation_ = 0;
+			bool warned_full_ = false;
+	};
+}
+
+NewPlayerProtection::SharedProtectionTable& NewPlayerProtection::SharedProtectionTable::Get()
+{
+	static SharedProtectionTable instance;
+	return instance;
+}
+
+void NewPlayerProtection::SharedProtectionTable::Start(const std::string& name, bool writer, size_t capacity)
+{
+	if (running_ || name.empty())
+		return;
+
+	uint32 rounded = 1024;
+	shift_ = 54;
+
+	while (rounded < capacity && rounded < (1u << 24))
+	{
+		rounded <<= 1;
+		--shift_;
+	}
+
+	name_ = L"Local\\" + ArkApi::Tools::Utf8Decode(name);
+	writer_ = writer;
+	capacity_ = rounded;
+	running_ = true;
+
+	if (writer_ && !Open())
+	{
+		running_ = false;
+		return;
+	}
+
+	if (writer_)
+	{
+		//later changes are written by PublishProtectionState, the state loaded before Start is written here
+		Publish(*NewPlayerProtection::GetProtectionState());
+		Tick();
+	}
+	else
+	{
+		Open();
+	}
+
+	ArkApi::GetCommands().AddOnTimerCallback("NPPSharedTable", std::bind(&NewPlayerProtection::SharedProtectionTable::Tick, this));
+
+	NPP_LOG(info, "NPP shared protection table {} started as {}, {} tribes.", name, writer_ ? "writer" : "reader", capacity_);
+}
+
+void NewPlayerProtection::SharedProtectionTable::Stop()
+{
+	if (!running_)
+		return;
+
+	running_ = false;
+	ArkApi::GetCommands().RemoveOnTimerCallback("NPPSharedTable");
+
+	if (writer_ && header_)
+	{
+		//readers fall back to their own tables right away instead of after stale_ms_
+		header_->heartbeat_ms.store(0, std::memory_order_release);
+	}
+	Close();
+}
+
+bool NewPlayerProtection::SharedProtectionTable::Open()
+{
+	const uint64 size = sizeof(SharedTableHeader) + 2ull * capacity_ * sizeof(SharedTribeEntry);
+
+	if (writer_)
+	{
+		mapping_ = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, static_cast<DWORD>(size >> 32),
+			static_cast<DWORD>(size), name_.c_str());
+	}
+	else
+	{
+		mapping_ = OpenFileMappingW(FILE_MAP_READ, FALSE, name_.c_str());
+	}
+
+	if (!mapping_)
+	{
+		if (writer_)
+		{
+			NPP_LOG(err, "({} {}) Could not create the shared protection table, error {}", __FILE__, __FUNCTION__, GetLastError());
+		}
+		return false;
+	}
+
+	//a mapping that outlived the previous writer because readers still hold it is reused as long as its layout matches
+	const bool existed = writer_ && GetLastError() == ERROR_ALREADY_EXISTS;
+
+	header_ = static_cast<SharedTableHeader*>(MapViewOfFile(mapping_, writer_ ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0));
+
+	if (!header_)
+	{
+		NPP_LOG(err, "({} {}) Could not map the shared protection table, error {}", __FILE__, __FUNCTION__, GetLastError());
+		Close();
+		return false;
+	}
+
+	if (writer_ && !existed)
+	{
+		std::copy(std::begin(magic_), std::end(magic_), header_->magic);
+		header_->version = version_;
+		header_->capacity = capacity_;
+	}
+
+	if (!std::equal(std::begin(magic_), std::end(magic_), header_->magic) || header_->version != version_ || header_->capacity != capacity_)
+	{
+		NPP_LOG(err, "({} {}) Shared protection table has another layout or capacity, check SharedTableCapacity on every map",
+			__FILE__, __FUNCTION__);
+		Close();
+		return false;
+	}
+
+	if (writer_)
+	{
+		header_->writer_pid = GetCurrentProcessId();
+	}
+	return true;
+}
+
+void NewPlayerProtection::SharedProtectionTable::Close()
+{
+	if (header_)
+	{
+		UnmapViewOfFile(header_);
+		header_ = nullptr;
+	}
+
+	if (mapping_)
+	{
+		CloseHandle(mapping_);
+		mapping_ = nullptr;
+	}
+}
+
+void NewPlayerProtection::SharedProtectionTable::Tick()
+{
+	if (writer_)
+	{
+		header_->heartbeat_ms.store(NewPlayerProtection::ToEpochMs(std::chrono::system_clock::now()), std::memory_order_release);
+		return;
+	}
+
+	if (!header_)
+	{
+		if (!Open())
+			return;
+
+		NPP_LOG(info, "NPP shared protection table opened, writer is process {}.", header_->writer_pid);
+	}
+
+	//decisions cached from the last table would outlive its changes
+	const uint64 generation = header_->generation.load(std::memory_order_acquire);
+
+	if (generation != seen_generation_)
+	{
+		seen_generation_ = generation;
+		NewPlayerProtection::Epochs.BumpProtection();
+	}
+}
+
+size_t NewPlayerProtection::SharedProtectionTable::Slot(uint64 tribe_id) const
+{
+	return static_cast<size_t>((tribe_id * 0x9E3779B97F4A7C15ull) >> shift_);
+}
+
+NewPlayerProtection::SharedTribeEntry* NewPlayerProtection::SharedProtectionTable::Table(uint32 index) const
+{
+	return reinterpret_cast<SharedTribeEntry*>(header_ + 1) + static_cast<size_t>(index) * capacity_;
+}
+
+bool NewPlayerProtection::SharedProtectionTable::Insert(SharedTribeEntry* table, uint64 tribe_id, uint32 flags) const
+{
+	const size_t mask = capacity_ - 1;
+
+	for (size_t slot = Slot(tribe_id), probes = 0; probes < capacity_; slot = (slot + 1) & mask, ++probes)
+	{
+		if (table[slot].tribe_id == 0 || table[slot].tribe_id == tribe_id)
+		{
+			table[slot].tribe_id = tribe_id;
+			table[slot].flags |= flags;
+			return true;
+		}
+	}
+	return false;
+}
+
+void NewPlayerProtection::SharedProtectionTable::Publish(const ProtectionState& state)
+{
+	if (!running_ || !writer_)
+		return;
+
+	const uint32 target = header_->active.load(std::memory_order_relaxed) ^ 1;
+	SharedTribeEntry* table = Table(target);
+	auto& sequence = header_->sequence[target];
+
+	sequence.fetch_add(1, std::memory_order_acq_rel);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	std::fill(table, table + capacity_, SharedTribeEntry{});
+
+	//only tribes that block damage are stored, kept under half full so lookups stay short
+	uint64 count = 0;
+	bool full = false;
+
+	for (const auto& [tribe_id, tribe] : state.tribes)
+	{
+		if (tribe.isProtected)
+		{
+			full |= count >= capacity_ / 2 || !Insert(table, tribe_id, flag_protected_);
+			count += full ? 0 : 1;
+		}
+	}
+
+	for (const uint64 tribe_id : state.pveTribes)
+	{
+		full |= count >= capacity_ / 2 || !Insert(table, tribe_id, flag_pve_);
+		count += full ? 0 : 1;
+	}
+
+	header_->count[target] = count;
+	sequence.fetch_add(1, std::memory_order_release);
+	header_->active.store(target, std::memory_order_release);
+	header_->generation.fetch_add(1, std::memory_order_release);
+
+	if (full && !warned_full_)
+	{
+		warned_full_ = true;
+		NPP_LOG(warn, "NPP shared protection table is full, raise SharedTableCapacity above {}.", capacity_);
+	}
+}
+
+bool NewPlayerProtection::SharedProtectionTable::IsProtected(uint64 tribe_id) const
+{
+	const SharedTableHeader* header = header_;
+
+	if (!header || NewPlayerProtection::ToEpochMs(std::chrono::system_clock::now()) - header->heartbeat_ms.load(std::memory_order_acquire) > stale_ms_)
+		return false;
+
+	const size_t mask = capacity_ - 1;
+
+	for (int attempt = 0; attempt < read_attempts_; ++attempt)
+	{
+		const uint32 index = header->active.load(std::memory_order_acquire);
+		const uint64 before = header->sequence[index].load(std::memory_order_acquire);
+
+		if (before & 1)
+			continue;
+
+		const SharedTribeEntry* table = Table(index);
+		bool found = false;
+
+		for (size_t slot = Slot(tribe_id), probes = 0; probes < capacity_; slot = (slot + 1) & mask, ++probes)
+		{
+			const uint64 id = table[slot].tribe_id;
+
+			if (id == 0)
+				break;
+
+			if (id == tribe_id)
+			{
+				found = table[slot].flags != 0;
+				break;
+			}
+		}
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		if (header->sequence[index].load(std::memory_order_relaxed) == before)
+			return found;
+	}
+	return false;
+}
@@ -0,0 +1,431 @@
+#pragma once
+
+#include <random>
+
+namespace NewPlayerProtection
+{
+	enum class SimScenario
+	{
+		LoginStorm,
+		RaidNight,
+		WipeDay
+	};
+
+	//NPP.Simulate feeds a scripted workload of made up players through the bodies of the login, logout, level up, structure
+	//damage and save hooks and the timer tick, one simulated second per tick with TimerProt's clock moved along, and
+	//reports how long NPP's part of each tick and each entry point took. without actors the hooks are entered where they
+	//have resolved their steam id and tribes, simulated players have no controller so nothing is sent to them.
+	//the players are ordinary records once added and are saved like any other, it is meant for test servers.
+	class Simulation
+	{
+		public:
+			static Simulation& Get();
+
+			Simulation(const Simulation&) = delete;
+			Simulation(Simulation&&) = delete;
+			Simulation& operator=(const Simulation&) = delete;
+			Simulation& operator=(Simulation&&) = delete;
+
+			struct Options
+			{
+				SimScenario scenario = SimScenario::LoginStorm;
+				size_t players = 1000;
+				//simulated seconds, 0 for the scenario's own length
+				int64 seconds = 0;
+				uint64 seed = 1;
+			};
+
+			//runs the whole workload before returning, "entry,calls,p50_ns,p99_ns,max_ns,total_ms" lines
+			std::string Run(const Options& options);
+
+			static bool ParseScenario(std::wstring_view name, SimScenario& scenario);
+
+		private:
+			Simulation() = default;
+			~Simulation() = default;
+
+			enum Entry
+			{
+				EntryTick,
+				EntryTimer,
+				EntryLogin,
+				EntryLogout,
+				EntryLevelUp,
+				EntryTakeDamage,
+				EntrySaveWorld,
+				EntryCount
+			};
+
+			static constexpr const char* entry_names_[EntryCount] = { "tick", "timer", "login", "logout", "level_up", "take_damage", "save_world" };
+
+			struct Player
+			{
+				uint64 steam_id;
+				uint64 tribe_id;
+				int level = 1;
+				bool online = false;
+				//simulated second of the next login or logout, the next level up while online
+				int64 next_change = 0;
+				int64 next_level = 0;
+				//raid night attackers, they join already past the level cap
+				bool veteran = false;
+			};
+
+			void Setup(const Options& options);
+			void Step(int64 second);
+			void Login(Player& player, int64 second);
+			void Logout(Player& player, int64 second);
+			void LevelUp(Player& player, int64 second);
+			void Hit(const Player& attacker, uint64 attacked_tribe);
+
+			template <typename Func>
+			void Time(Entry entry, Func&& func)
+			{
+				const auto start = std::chrono::steady_clock::now();
+				func();
+				const uint64 ns = static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+				latency_[entry].Record(ns);
+				total_ns_[entry] += ns;
+			}
+
+			//below real steam ids and above real tribe ids, so made up players never share a record or tribe with real ones
+			static constexpr uint64 first_steam_id_ = 76561190000000000ull;
+			static constexpr uint64 first_tribe_id_ = 1900000000ull;
+			//ark's autosave default
+			static constexpr int64 save_interval_secs_ = 900;
+
+			SimScenario scenario_ = SimScenario::LoginStorm;
+			int64 seconds_ = 0;
+			std::mt19937_64 rng_;
+			std::vector<Player> players_;
+			std::vector<uint64> tribes_;
+			std::array<LatencyHistogram, EntryCount> latency_;
+			std::array<uint64, EntryCount> total_ns_{};
+			uint64 blocked_hits_ = 0;
+			uint64 over_budget_ticks_ = 0;
+	};
+}
+
+NewPlayerProtection::Simulation& NewPlayerProtection::Simulation::Get()
+{
+	static Simulation instance;
+	return instance;
+}
+
+bool NewPlayerProtection::Simulation::ParseScenario(std::wstring_view name, SimScenario& scenario)
+{
+	if (name == L"login_storm")
+		scenario = SimScenario::LoginStorm;
+	else if (name == L"raid_night")
+		scenario = SimScenario::RaidNight;
+	else if (name == L"wipe_day")
+		scenario = SimScenario::WipeDay;
+	else
+		return false;
+
+	return true;
+}
+
+void NewPlayerProtection::Simulation::Setup(const Options& options)
+{
+	scenario_ = options.scenario;
+	rng_.seed(options.seed);
+
+	switch (scenario_)
+	{
+		case SimScenario::LoginStorm:
+			seconds_ = 600;
+			break;
+		case SimScenario::RaidNight:
+			seconds_ = 3600;
+			break;
+		case SimScenario::WipeDay:
+			seconds_ = 86400;
+			break;
+	}
+
+	if (options.seconds > 0)
+	{
+		seconds_ = options.seconds;
+	}
+
+	//solo players up to groups of six, about three per tribe
+	const size_t tribe_count = std::max<size_t>(1, options.players / 3);
+	std::uniform_int_distribution<size_t> pick_tribe(0, tribe_count - 1);
+
+	tribes_.clear();
+	for (size_t i = 0; i < tribe_count; ++i)
+	{
+		tribes_.push_back(first_tribe_id_ + i);
+	}
+
+	players_.clear();
+	players_.reserve(options.players);
+
+	for (size_t i = 0; i < options.players; ++i)
+	{
+		Player player;
+		player.steam_id = first_steam_id_ + i;
+		player.tribe_id = tribes_[i < tribe_count ? i : pick_tribe(rng_)];
+
+		switch (scenario_)
+		{
+			case SimScenario::LoginStorm:
+				//everyone in the first tenth, the server just came up
+				player.next_change = std::uniform_int_distribution<int64>(0, std::max<int64>(1, seconds_ / 10))(rng_);
+				break;
+			case SimScenario::RaidNight:
+				//the first minute, then they stay. the second half of the tribes raids the first
+				player.next_change = std::uniform_int_distribution<int64>(0, 60)(rng_);
+				player.veteran = player.tribe_id >= first_tribe_id_ + tribe_count / 2;
+				break;
+			case SimScenario::WipeDay:
+				//arrivals all day long, front loaded
+				player.next_change = std::min<int64>(seconds_ - 1, static_cast<int64>(std::exponential_distribution<double>(4.0 / seconds_)(rng_)));
+				break;
+		}
+		players_.push_back(player);
+	}
+
+	latency_.fill(LatencyHistogram());
+	total_ns_.fill(0);
+	blocked_hits_ = 0;
+	over_budget_ticks_ = 0;
+}
+
+void NewPlayerProtection::Simulation::Login(Player& player, int64 second)
+{
+	//HandleNewPlayer, the records and tribe are resolved by the next timer tick
+	Time(EntryLogin, [&player]()
+	{
+		NewPlayerProtection::TimerProt::Get().QueueLogin(player.steam_id, player.tribe_id, nullptr);
+	});
+
+	player.online = true;
+	//wipe day sessions are about 45 minutes, the other scenarios keep everyone on
+	player.next_change = scenario_ == SimScenario::WipeDay ? second + 1 + static_cast<int64>(std::exponential_distribution<double>(1.0 / 2700)(rng_)) : seconds_;
+	player.next_level = second + 5;
+}
+
+void NewPlayerProtection::Simulation::Logout(Player& player, int64 second)
+{
+	Time(EntryLogout, [&player]()
+	{
+		NewPlayerProtection::TimerProt::Get().RemovePlayer(player.steam_id);
+	});
+
+	player.online = false;
+	//back after a few hours
+	player.next_change = second + 1 + static_cast<int64>(std::exponential_distribution<double>(1.0 / 14400)(rng_));
+}
+
+void NewPlayerProtection::Simulation::LevelUp(Player& player, int64 second)
+{
+	const int max_level = NewPlayerProtection::GetSettings()->MaxLevel;
+
+	//raid night attackers are past the cap on their first refresh, everyone else levels every couple of minutes early on and slower later
+	player.level = player.veteran ? max_level + 10 : player.level + 1;
+	player.next_level = second + 1 + static_cast<int64>(std::exponential_distribution<double>(1.0 / (60.0 + player.level * 10.0))(rng_));
+
+	//ServerApplyLevelUp, what UpdateLevelAndTribe does once it read the controller
+	Time(EntryLevelUp, [&player]()
+	{
+		auto& timer = NewPlayerProtection::TimerProt::Get();
+
+		if (const auto data = timer.FindOnlinePlayer(player.steam_id))
+		{
+			timer.ApplyLevelAndTribe(*data, player.tribe_id, player.level);
+		}
+	});
+}
+
+void NewPlayerProtection::Simulation::Hit(const Player& attacker, uint64 attacked_tribe)
+{
+	if (attacked_tribe == attacker.tribe_id)
+		return;
+
+	const auto settings = NewPlayerProtection::GetSettings();
+	const bool ignore_admins = settings->IgnoreAdmins;
+	const bool allow_new_players = settings->AllowNewPlayersToDamageEnemyStructures;
+
+	//TakeDamage of a player hit once the instigator and both tribes are read
+	Time(EntryTakeDamage, [this, &attacker, attacked_tribe, ignore_admins, allow_new_players]()
+	{
+		if (!IsAnyTribeProtected())
+			return;
+
+		NewPlayerProtection::DamageDecision decision;
+
+		if (ignore_admins)
+		{
+			decision = allow_new_players
+				? CachedPlayerDamage<DamageCheckIgnoreAdmins | DamageCheckAllowNewPlayersToDamage>(attacker.steam_id, attacker.tribe_id, attacked_tribe)
+				: CachedPlayerDamage<DamageCheckIgnoreAdmins>(attacker.steam_id, attacker.tribe_id, attacked_tribe);
+		}
+		else
+		{
+			decision = allow_new_players
+				? CachedPlayerDamage<DamageCheckAllowNewPlayersToDamage>(attacker.steam_id, attacker.tribe_id, attacked_tribe)
+				: CachedPlayerDamage<0>(attacker.steam_id, attacker.tribe_id, attacked_tribe);
+		}
+
+		if (ReportPlayerDamage(decision, attacker.steam_id, attacker.tribe_id, attacked_tribe))
+		{
+			++blocked_hits_;
+		}
+	});
+}
+
+void NewPlayerProtection::Simulation::Step(int64 second)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	timer.SetClockOffset(std::chrono::seconds(second));
+
+	std::uniform_real_distribution<double> unit(0.0, 1.0);
+	const size_t victim_tribes = scenario_ == SimScenario::RaidNight ? std::max<size_t>(1, tribes_.size() / 2) : tribes_.size();
+	std::uniform_int_distribution<size_t> pick_victim(0, victim_tribes - 1);
+
+	const auto start = std::chrono::steady_clock::now();
+
+	for (auto& player : players_)
+	{
+		if (second >= player.next_change)
+		{
+			if (player.online)
+				Logout(player, second);
+			else
+				Login(player, second);
+		}
+
+		if (!player.online)
+			continue;
+
+		if (second >= player.next_level)
+		{
+			LevelUp(player, second);
+		}
+
+		//raid night veterans hit every couple of seconds with a few structures per explosion, wipe day has the odd skirmish
+		const double hit_chance = scenario_ == SimScenario::RaidNight ? (player.veteran ? 0.5 : 0.0) : (scenario_ == SimScenario::WipeDay ? 0.01 : 0.0);
+
+		if (hit_chance > 0.0 && unit(rng_) < hit_chance)
+		{
+			const uint64 victim = tribes_[pick_victim(rng_)];
+
+			for (int structures = std::uniform_int_distribution<int>(1, 5)(rng_); structures > 0; --structures)
+			{
+				Hit(player, victim);
+			}
+		}
+	}
+
+	if (second > 0 && second % save_interval_secs_ == 0)
+	{
+		Time(EntrySaveWorld, []()
+		{
+			QueueProtectionSave();
+		});
+	}
+
+	Time(EntryTimer, [&timer]()
+	{
+		timer.UpdateTimer();
+		timer.RunDueExpiry();
+	});
+
+	const uint64 ns = static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+	latency_[EntryTick].Record(ns);
+	total_ns_[EntryTick] += ns;
+
+	if (ns > static_cast<uint64>(std::max(0, NewPlayerProtection::GetSettings()->TickBudgetInMicros)) * 1000)
+	{
+		++over_budget_ticks_;
+	}
+}
+
+std::string NewPlayerProtection::Simulation::Run(const Options& options)
+{
+	Setup(options);
+
+	for (int64 second = 0; second < seconds_; ++second)
+	{
+		Step(second);
+	}
+
+	//everyone leaves, then the clock is put back
+	for (auto& player : players_)
+	{
+		if (player.online)
+		{
+			NewPlayerProtection::TimerProt::Get().RemovePlayer(player.steam_id);
+			player.online = false;
+		}
+	}
+
+	NewPlayerProtection::TimerProt::Get().SetClockOffset(std::chrono::seconds(0));
+	NewPlayerProtection::TimerProt::Get().AdvanceClock();
+
+	std::string reply = "entry,calls,p50_ns,p99_ns,max_ns,total_ms";
+
+	for (size_t i = 0; i < EntryCount; ++i)
+	{
+		reply += "\n" + std::string(entry_names_[i])
+			+ "," + std::to_string(latency_[i].Count())
+			+ "," + std::to_string(latency_[i].Percentile(0.5))
+			+ "," + std::to_string(latency_[i].Percentile(0.99))
+			+ "," + std::to_string(latency_[i].Max())
+			+ "," + std::to_string(total_ns_[i] / 1000000);
+	}
+
+	reply += "\n\nseconds,players,blocked_hits,ticks_over_budget\n" + std::to_string(seconds_)
+		+ "," + std::to_string(players_.size())
+		+ "," + std::to_string(blocked_hits_)
+		+ "," + std::to_string(over_budget_ticks_);
+
+	return reply;
+}
+
+//"NPP.Simulate <login_storm|raid_night|wipe_day> [players] [seconds] [seed]", see Simulation. seconds defaults to 600, 3600
+//and 86400, at most a week. the game thread is held for the whole run and records touched by it are dated up to the simulated
+//length ahead, only for test servers
+inline FString SimulateCommand(const FString& body, const std::string& by)
+{
+	const auto parsed = TokenizeCommand(body);
+	NewPlayerProtection::Simulation::Options options;
+
+	if (parsed.size() < 2 || !NewPlayerProtection::Simulation::ParseScenario(parsed[1], options.scenario))
+		return FString("Usage: NPP.Simulate <login_storm|raid_night|wipe_day> [players] [seconds] [seed]");
+
+	uint64 players = options.players, seconds = 0, seed = options.seed;
+
+	if ((parsed.size() > 2 && !ParseUInt(parsed[2], players, __FUNCTION__))
+		|| (parsed.size() > 3 && !ParseUInt(parsed[3], seconds, __FUNCTION__))
+		|| (parsed.size() > 4 && !ParseUInt(parsed[4], seed, __FUNCTION__)))
+		return FString();
+
+	if (!NewPlayerProtection::IsLoaded())
+		return FString("NPP database is not loaded yet.");
+
+	options.players = static_cast<size_t>(std::max<uint64>(1, std::min<uint64>(players, 1000000)));
+	options.seconds = static_cast<int64>(std::min<uint64>(seconds, 7 * 86400));
+	options.seed = seed;
+
+	const std::string scenario(parsed[1].begin(), parsed[1].end());
+	NPP_LOG(info, "{} started NPP simulation {} with {} players.", by, scenario, options.players);
+
+	const std::string reply = NewPlayerProtection::Simulation::Get().Run(options);
+
+	NPP_LOG(info, "NPP simulation finished:\n{}", reply);
+	return NewPlayerProtection::ToFString(reply);
+}
+
+inline void ConsoleSimulate(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleTribeCommand(player_controller, *cmd, &SimulateCommand);
+}
+
+inline void RconSimulate(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconTribeCommand(rcon_connection, rcon_packet, &SimulateCommand);
+}
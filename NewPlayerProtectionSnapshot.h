@@ -0,0 +1,442 @@
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+
+namespace NewPlayerProtection
+{
+#pragma pack(push, 1)
+	struct SnapshotHeader
+	{
+		char magic[8];
+		uint32 version;
+		uint32 record_size;
+		//matches Snapshot_State.Generation when the database holds nothing newer than the file
+		int64 generation;
+		int64 written_ms;
+		uint64 player_count;
+		uint64 pve_count;
+		uint64 resident_count;
+		//of the packed sections that follow the header
+		uint64 packed_bytes;
+		uint64 packed_hash;
+	};
+
+	//one record as collected, packed as differences to the record before it. the header is followed by the pve_count and
+	//resident_count tribe ids and then player_count records, all sorted and stored as PackWriter varints
+	struct SnapshotPlayer
+	{
+		uint64 steam_id;
+		uint64 tribe_id;
+		int64 start_ms;
+		int64 last_login_ms;
+		int32 level;
+		int32 isNewPlayer;
+	};
+
+	//NewPlayerProtection.db.handoff, written on Plugin_Unload for the instance the plugin manager loads next.
+	//same sections as the snapshot, only adopted by the process that wrote it
+	struct HandoffHeader
+	{
+		SnapshotHeader snapshot;
+		uint32 process_id;
+		uint32 reserved;
+	};
+#pragma pack(pop)
+
+	//copy of the in-memory tables taken on world save, written by the DBWriter after the rows it matches are committed
+	struct Snapshot
+	{
+		std::string path;
+		int64 generation = 0;
+		//collected records, read snapshots leave them packed for ApplySnapshot to decode straight into the tables
+		std::vector<SnapshotPlayer> players;
+		std::vector<uint64> pveTribes;
+		std::vector<uint64> residentTribes;
+		std::string packed;
+		size_t playersOffset = 0;
+		size_t playerCount = 0;
+	};
+
+	constexpr char SnapshotMagic[8] = { 'N', 'P', 'P', 'S', 'N', 'A', 'P', 0 };
+	constexpr uint32 SnapshotVersion = 2;
+	constexpr char HandoffMagic[8] = { 'N', 'P', 'P', 'H', 'A', 'N', 'D', 0 };
+	//a reload comes right after the unload, anything older was left behind by a reload that failed
+	constexpr int64 HandoffMaxAgeInMs = 300000;
+
+	//generation of the last snapshot handed to the writer, read back from the database on load
+	int64 lastSnapshotGeneration = 0;
+
+	std::string GetSnapshotPath();
+	std::string GetHandoffPath();
+}
+
+std::string NewPlayerProtection::GetSnapshotPath()
+{
+	return NewPlayerProtection::GetDBPath() + ".snapshot";
+}
+
+std::string NewPlayerProtection::GetHandoffPath()
+{
+	return NewPlayerProtection::GetDBPath() + ".handoff";
+}
+
+//game thread, one pass over the resident records
+void CollectSnapshot(NewPlayerProtection::Snapshot& snapshot)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+
+	snapshot.players.reserve(timer.GetAllPlayers().size());
+
+	for (const auto& data : timer.GetAllPlayers())
+	{
+		snapshot.players.push_back({ data.steam_id, data.tribe_id, NewPlayerProtection::ToEpochMs(data.StartDateTime()),
+			NewPlayerProtection::ToEpochMs(timer.LastLoginDateTime(data)), data.level, data.isNewPlayer });
+	}
+
+	snapshot.pveTribes.assign(NewPlayerProtection::pveTribesList.begin(), NewPlayerProtection::pveTribesList.end());
+	snapshot.residentTribes.assign(timer.resident_tribes_.begin(), timer.resident_tribes_.end());
+}
+
+std::shared_ptr<const NewPlayerProtection::Snapshot> BuildSnapshot()
+{
+	auto snapshot = std::make_shared<NewPlayerProtection::Snapshot>();
+
+	snapshot->path = NewPlayerProtection::GetSnapshotPath();
+	snapshot->generation = ++NewPlayerProtection::lastSnapshotGeneration;
+	CollectSnapshot(*snapshot);
+	return snapshot;
+}
+
+//the records only keep seconds, so the dates are packed as seconds too
+void PackSnapshotPlayer(NewPlayerProtection::PackWriter& writer, const NewPlayerProtection::SnapshotPlayer& player, const NewPlayerProtection::SnapshotPlayer& previous)
+{
+	writer.Unsigned(player.steam_id - previous.steam_id);
+	writer.Delta(player.tribe_id, previous.tribe_id);
+	writer.Signed(player.start_ms / 1000 - previous.start_ms / 1000);
+	writer.Signed(player.last_login_ms / 1000 - previous.last_login_ms / 1000);
+	writer.Unsigned(static_cast<uint64>(std::max(0, player.level)) << 1 | (player.isNewPlayer != 0 ? 1 : 0));
+}
+
+//player holds the previous record on the way in and the next one on the way out
+bool UnpackSnapshotPlayer(NewPlayerProtection::PackReader& reader, NewPlayerProtection::SnapshotPlayer& player)
+{
+	uint64 steam_delta, level_and_flag;
+	int64 start_delta, last_login_delta;
+
+	if (!reader.Unsigned(steam_delta) || !reader.Delta(player.tribe_id, player.tribe_id) || !reader.Signed(start_delta)
+		|| !reader.Signed(last_login_delta) || !reader.Unsigned(level_and_flag))
+		return false;
+
+	player.steam_id += steam_delta;
+	player.start_ms = (player.start_ms / 1000 + start_delta) * 1000;
+	player.last_login_ms = (player.last_login_ms / 1000 + last_login_delta) * 1000;
+	player.level = static_cast<int32>(std::min<uint64>(level_and_flag >> 1, std::numeric_limits<int32>::max()));
+	player.isNewPlayer = static_cast<int32>(level_and_flag & 1);
+	return true;
+}
+
+void PackTribeIds(NewPlayerProtection::PackWriter& writer, std::vector<uint64> tribe_ids)
+{
+	std::sort(tribe_ids.begin(), tribe_ids.end());
+	uint64 previous = 0;
+
+	for (const uint64 tribe_id : tribe_ids)
+	{
+		writer.Unsigned(tribe_id - previous);
+		previous = tribe_id;
+	}
+}
+
+bool UnpackTribeIds(NewPlayerProtection::PackReader& reader, uint64 count, std::vector<uint64>& tribe_ids)
+{
+	tribe_ids.resize(static_cast<size_t>(count));
+	uint64 previous = 0;
+
+	for (auto& tribe_id : tribe_ids)
+	{
+		uint64 delta;
+
+		if (!reader.Unsigned(delta))
+			return false;
+
+		tribe_id = previous += delta;
+	}
+	return true;
+}
+
+//writer thread, the records are sorted by steam id so neighbouring ids and dates differ by little
+std::string PackSnapshot(const NewPlayerProtection::Snapshot& snapshot)
+{
+	std::string packed;
+	packed.reserve(snapshot.players.size() * 12 + (snapshot.pveTribes.size() + snapshot.residentTribes.size()) * 4);
+
+	NewPlayerProtection::PackWriter writer(packed);
+	PackTribeIds(writer, snapshot.pveTribes);
+	PackTribeIds(writer, snapshot.residentTribes);
+
+	std::vector<const NewPlayerProtection::SnapshotPlayer*> sorted;
+	sorted.reserve(snapshot.players.size());
+
+	for (const auto& player : snapshot.players)
+	{
+		sorted.push_back(&player);
+	}
+
+	std::sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) { return a->steam_id < b->steam_id; });
+
+	NewPlayerProtection::SnapshotPlayer previous{};
+
+	for (const auto* player : sorted)
+	{
+		PackSnapshotPlayer(writer, *player, previous);
+		previous = *player;
+	}
+	return packed;
+}
+
+NewPlayerProtection::SnapshotHeader MakeSnapshotHeader(const NewPlayerProtection::Snapshot& snapshot, const std::string& packed, const char (&magic)[8])
+{
+	NewPlayerProtection::SnapshotHeader header;
+	std::copy(std::begin(magic), std::end(magic), header.magic);
+	header.version = NewPlayerProtection::SnapshotVersion;
+	header.record_size = sizeof(NewPlayerProtection::SnapshotPlayer);
+	header.generation = snapshot.generation;
+	header.written_ms = NewPlayerProtection::ToEpochMs(std::chrono::system_clock::now());
+	header.player_count = snapshot.players.size();
+	header.pve_count = snapshot.pveTribes.size();
+	header.resident_count = snapshot.residentTribes.size();
+	header.packed_bytes = packed.size();
+	header.packed_hash = NewPlayerProtection::HashBytes(packed.data(), packed.size());
+	return header;
+}
+
+//packed_hash only covers the sections, so the counts of the header are checked against the bytes that follow it before
+//anything is sized from them. every tribe id packs to at least one byte and every record to one byte per varint
+bool AreSnapshotCountsValid(std::ifstream& file, const NewPlayerProtection::SnapshotHeader& header)
+{
+	constexpr uint64 min_player_bytes = 5;
+
+	const std::streamoff position = file.tellg();
+	file.seekg(0, std::ios::end);
+	const std::streamoff end = file.tellg();
+	file.seekg(position);
+
+	if (position < 0 || end < position || header.packed_bytes > static_cast<uint64>(end - position))
+		return false;
+
+	if (header.pve_count > header.packed_bytes || header.resident_count > header.packed_bytes - header.pve_count)
+		return false;
+
+	return header.player_count <= (header.packed_bytes - header.pve_count - header.resident_count) / min_player_bytes;
+}
+
+//the tribe ids are unpacked here, the records are left packed for ApplySnapshot
+bool ReadSnapshotSections(std::ifstream& file, const NewPlayerProtection::SnapshotHeader& header, NewPlayerProtection::Snapshot& snapshot)
+{
+	if (!AreSnapshotCountsValid(file, header))
+		return false;
+
+	snapshot.generation = header.generation;
+	snapshot.packed.resize(static_cast<size_t>(header.packed_bytes));
+
+	if (!file.read(&snapshot.packed[0], snapshot.packed.size())
+		|| NewPlayerProtection::HashBytes(snapshot.packed.data(), snapshot.packed.size()) != header.packed_hash)
+		return false;
+
+	NewPlayerProtection::PackReader reader(snapshot.packed.data(), snapshot.packed.size());
+
+	if (!UnpackTribeIds(reader, header.pve_count, snapshot.pveTribes) || !UnpackTribeIds(reader, header.resident_count, snapshot.residentTribes))
+		return false;
+
+	snapshot.playersOffset = static_cast<size_t>(reader.Position() - snapshot.packed.data());
+	snapshot.playerCount = static_cast<size_t>(header.player_count);
+	return true;
+}
+
+bool IsSnapshotLayout(const NewPlayerProtection::SnapshotHeader& header, const char (&magic)[8])
+{
+	return std::equal(std::begin(magic), std::end(magic), header.magic)
+		&& header.version == NewPlayerProtection::SnapshotVersion && header.record_size == sizeof(NewPlayerProtection::SnapshotPlayer);
+}
+
+//writer thread, replaces the file only once the new one is complete
+void WriteSnapshot(const NewPlayerProtection::Snapshot& snapshot)
+{
+	const std::string temp_path = snapshot.path + ".tmp";
+	const std::string packed = PackSnapshot(snapshot);
+	const NewPlayerProtection::SnapshotHeader header = MakeSnapshotHeader(snapshot, packed, NewPlayerProtection::SnapshotMagic);
+
+	{
+		std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(packed.data(), packed.size());
+
+		if (!file)
+		{
+			NPP_LOG(err, "({} {}) Could not write snapshot file {}", __FILE__, __FUNCTION__, temp_path);
+			return;
+		}
+	}
+
+	std::error_code error;
+	std::filesystem::rename(temp_path, snapshot.path, error);
+
+	if (error)
+	{
+		NPP_LOG(err, "({} {}) Could not replace snapshot file {}: {}", __FILE__, __FUNCTION__, snapshot.path, error.message());
+	}
+}
+
+//game thread, Plugin_Unload. the tables as they are in memory, at the generation of the save queued just before
+void WriteHandoff()
+{
+	NewPlayerProtection::Snapshot snapshot;
+	snapshot.path = NewPlayerProtection::GetHandoffPath();
+	snapshot.generation = NewPlayerProtection::lastSnapshotGeneration;
+	CollectSnapshot(snapshot);
+
+	const std::string packed = PackSnapshot(snapshot);
+
+	NewPlayerProtection::HandoffHeader header;
+	header.snapshot = MakeSnapshotHeader(snapshot, packed, NewPlayerProtection::HandoffMagic);
+	header.process_id = GetCurrentProcessId();
+	header.reserved = 0;
+
+	const std::string temp_path = snapshot.path + ".tmp";
+
+	{
+		std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(packed.data(), packed.size());
+
+		if (!file)
+		{
+			NPP_LOG(err, "({} {}) Could not write handoff file {}", __FILE__, __FUNCTION__, temp_path);
+			return;
+		}
+	}
+
+	std::error_code error;
+	std::filesystem::rename(temp_path, snapshot.path, error);
+
+	if (error)
+	{
+		NPP_LOG(err, "({} {}) Could not replace handoff file {}: {}", __FILE__, __FUNCTION__, snapshot.path, error.message());
+		return;
+	}
+
+	NPP_LOG(info, "NPP handoff written, {} player records in {} bytes.", snapshot.players.size(), packed.size());
+}
+
+//nullptr unless the instance unloaded just before in this process left the file and its save was committed.
+//the file is removed either way, a handoff is read at most once
+std::shared_ptr<NewPlayerProtection::Snapshot> ReadHandoff(int64 generation)
+{
+	const std::string path = NewPlayerProtection::GetHandoffPath();
+	std::shared_ptr<NewPlayerProtection::Snapshot> snapshot;
+
+	{
+		std::ifstream file(path, std::ios::binary);
+		NewPlayerProtection::HandoffHeader header{};
+
+		if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+			return nullptr;
+
+		const int64 age_ms = NewPlayerProtection::ToEpochMs(std::chrono::system_clock::now()) - header.snapshot.written_ms;
+
+		if (!IsSnapshotLayout(header.snapshot, NewPlayerProtection::HandoffMagic) || header.process_id != GetCurrentProcessId()
+			|| age_ms < 0 || age_ms > NewPlayerProtection::HandoffMaxAgeInMs)
+		{
+			NPP_LOG(info, "NPP handoff {} is from another run, loading from the database.", path);
+		}
+		else if (header.snapshot.generation != generation)
+		{
+			Log::GetLog()->warn("NPP handoff is newer than the database, the last save was not written. Loading from the database.");
+		}
+		else
+		{
+			snapshot = std::make_shared<NewPlayerProtection::Snapshot>();
+			snapshot->path = path;
+
+			if (!ReadSnapshotSections(file, header.snapshot, *snapshot))
+			{
+				NPP_LOG(warn, "NPP handoff {} is truncated or damaged, loading from the database.", path);
+				snapshot.reset();
+			}
+		}
+	}
+
+	std::error_code error;
+	std::filesystem::remove(path, error);
+	return snapshot;
+}
+
+//nullptr when the file is missing, of another layout or older than the database, LoadDB then reads the tables instead.
+//only reads the file, so it can run while other startup stages do
+std::shared_ptr<NewPlayerProtection::Snapshot> ReadSnapshot(int64 generation)
+{
+	const std::string path = NewPlayerProtection::GetSnapshotPath();
+	std::ifstream file(path, std::ios::binary);
+	NewPlayerProtection::SnapshotHeader header{};
+
+	if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+		return nullptr;
+
+	if (!IsSnapshotLayout(header, NewPlayerProtection::SnapshotMagic))
+	{
+		NPP_LOG(warn, "NPP snapshot {} has another layout, loading from the database.", path);
+		return nullptr;
+	}
+
+	if (generation == 0 || header.generation != generation)
+	{
+		Log::GetLog()->info("NPP snapshot is older than the database, loading from the database.");
+		return nullptr;
+	}
+
+	auto snapshot = std::make_shared<NewPlayerProtection::Snapshot>();
+	snapshot->path = path;
+
+	if (!ReadSnapshotSections(file, header, *snapshot))
+	{
+		NPP_LOG(warn, "NPP snapshot {} is truncated or damaged, loading from the database.", path);
+		return nullptr;
+	}
+
+	return snapshot;
+}
+
+void ApplySnapshot(const NewPlayerProtection::Snapshot& snapshot)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	const int64 decay_ms = NewPlayerProtection::ToEpochMs(std::chrono::system_clock::now() - std::chrono::hours(NewPlayerProtection::GetSettings()->NPPPlayerDecayInHours));
+
+	timer.ReservePlayers(snapshot.playerCount);
+	timer.player_index_.Reserve(snapshot.playerCount);
+
+	//decoded one record at a time into the tables, the hash was checked on read so the records are whole
+	NewPlayerProtection::PackReader reader(snapshot.packed.data() + snapshot.playersOffset, snapshot.packed.size() - snapshot.playersOffset);
+	NewPlayerProtection::SnapshotPlayer player{};
+
+	for (size_t i = 0; i < snapshot.playerCount && UnpackSnapshotPlayer(reader, player); ++i)
+	{
+		//same decay window LoadPlayerRows applies
+		if (player.last_login_ms > decay_ms)
+		{
+			timer.AddPlayerFromDB(player.steam_id, player.tribe_id, NewPlayerProtection::FromEpochMs(player.start_ms),
+				NewPlayerProtection::FromEpochMs(player.last_login_ms), player.level, player.isNewPlayer);
+		}
+	}
+
+	timer.resident_tribes_.insert(snapshot.residentTribes.begin(), snapshot.residentTribes.end());
+	NewPlayerProtection::pveTribesList.insert(snapshot.pveTribes.begin(), snapshot.pveTribes.end());
+	NewPlayerProtection::lastSnapshotGeneration = snapshot.generation;
+
+	//PVE tribes are added without UpdateTribe, so cached decisions and the protected filter are stale
+	NewPlayerProtection::Epochs.BumpProtection();
+
+	NPP_LOG(info, "NPP snapshot loaded, {} player records and {} PVE tribes.", timer.GetAllPlayers().size(), snapshot.pveTribes.size());
+}
@@ -0,0 +1,260 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+
+namespace NewPlayerProtection
+{
+	//log-linear latency histogram in ns, 8 sub buckets per power of two keeps percentiles within 12.5% of the real value.
+	//everything recorded here runs on the game thread, so the counters are plain integers. LoadDB is recorded on the
+	//loader thread, but before dbLoaded is set and so before anything reads it.
+	class LatencyHistogram
+	{
+		public:
+			void Record(uint64 ns)
+			{
+				++counts_[BucketOf(ns)];
+				++count_;
+				max_ = std::max(max_, ns);
+			}
+
+			uint64 Count() const
+			{
+				return count_;
+			}
+
+			uint64 Max() const
+			{
+				return max_;
+			}
+
+			//upper bound of the bucket holding the p-th fraction of samples, 0 when empty
+			uint64 Percentile(double p) const
+			{
+				if (count_ == 0)
+					return 0;
+
+				const uint64 rank = std::max<uint64>(1, static_cast<uint64>(p * static_cast<double>(count_) + 0.5));
+				uint64 seen = 0;
+
+				for (size_t i = 0; i < counts_.size(); ++i)
+				{
+					seen += counts_[i];
+
+					if (seen >= rank)
+					{
+						return std::min(UpperBoundOf(i), max_);
+					}
+				}
+				return max_;
+			}
+
+			void Reset()
+			{
+				counts_.fill(0);
+				count_ = 0;
+				max_ = 0;
+			}
+
+			//the non-empty buckets as [bucket, count] pairs and the max, so a saved histogram gives the same percentiles back
+			nlohmann::json ToJson() const
+			{
+				nlohmann::json buckets = nlohmann::json::array();
+
+				for (size_t i = 0; i < counts_.size(); ++i)
+				{
+					if (counts_[i] > 0)
+					{
+						buckets.push_back({ i, counts_[i] });
+					}
+				}
+				return { { "max_ns", max_ }, { "buckets", buckets } };
+			}
+
+			//false and empty when json is not what ToJson wrote
+			bool FromJson(const nlohmann::json& json)
+			{
+				Reset();
+
+				const auto buckets = json.is_object() ? json.find("buckets") : json.end();
+
+				if (buckets == json.end() || !buckets->is_array())
+					return false;
+
+				for (const auto& bucket : *buckets)
+				{
+					if (!bucket.is_array() || bucket.size() != 2 || !bucket[0].is_number_unsigned() || !bucket[1].is_number_unsigned()
+						|| bucket[0].get<uint64>() >= counts_.size())
+					{
+						Reset();
+						return false;
+					}
+
+					counts_[bucket[0].get<size_t>()] += bucket[1].get<uint64>();
+					count_ += bucket[1].get<uint64>();
+				}
+
+				max_ = json.value("max_ns", uint64(0));
+				return true;
+			}
+
+		private:
+			static constexpr int sub_bits_ = 3;
+			static constexpr uint64 sub_count_ = 1ull << sub_bits_;
+
+			static size_t BucketOf(uint64 ns)
+			{
+				if (ns < sub_count_)
+					return static_cast<size_t>(ns);
+
+				int msb = 0;
+				for (uint64 v = ns; v >>= 1;)
+				{
+					++msb;
+				}
+
+				const int shift = msb - sub_bits_;
+				return static_cast<size_t>((shift + 1) * sub_count_ + ((ns >> shift) & (sub_count_ - 1)));
+			}
+
+			static uint64 UpperBoundOf(size_t bucket)
+			{
+				if (bucket < sub_count_)
+					return bucket;
+
+				const int shift = static_cast<int>(bucket / sub_count_) - 1;
+				const uint64 lower = (sub_count_ + bucket % sub_count_) << shift;
+				return lower + (1ull << shift) - 1;
+			}
+
+			std::array<uint64, (64 - sub_bits_ + 1) * sub_count_> counts_{};
+			uint64 count_ = 0;
+			uint64 max_ = 0;
+	};
+
+	//running totals for MetricsPusher, only touched on the game thread except the save duration which the writer sets
+	struct Counters
+	{
+		uint64 blockedHits = 0;
+		uint64 allowedHits = 0;
+		uint64 notificationsSent = 0;
+		uint64 protectionGained = 0;
+		uint64 protectionLost = 0;
+		std::atomic<int64> lastSaveDurationMs{ 0 };
+	};
+
+	inline Counters& GetCounters()
+	{
+		static Counters counters;
+		return counters;
+	}
+
+	enum class Stat
+	{
+		TakeDamage,
+		UpdateTimer,
+		RemoveExpiredTribesProtection,
+		SaveWorld,
+		LoadDB,
+		//the game thread part of an admin command, async commands reply later
+		Command,
+		Count
+	};
+
+	constexpr const char* StatNames[] =
+	{
+		"TakeDamage",
+		"UpdateTimer",
+		"RemoveExpiredTribesProtection",
+		"SaveWorld",
+		"LoadDB",
+		"Command"
+	};
+
+	inline LatencyHistogram& GetStat(Stat stat)
+	{
+		static std::array<LatencyHistogram, static_cast<size_t>(Stat::Count)> stats;
+		return stats[static_cast<size_t>(stat)];
+	}
+
+	//written by NPP.Stats baseline, kept across restarts and upgrades so NPP.Stats can show what got slower
+	inline std::string GetStatsBaselinePath()
+	{
+		return ArkApi::Tools::GetCurrentDir() + "/ArkApi/Plugins/NewPlayerProtection/StatsBaseline.json";
+	}
+
+	//UpdateTimer work that can wait for a later tick once the tick budget is spent
+	enum class Deferrable
+	{
+		PlayerRefresh,
+		Notifications,
+		ProtectionExpiry,
+		BlockedDamageLog,
+		Count
+	};
+
+	constexpr const char* DeferrableNames[] =
+	{
+		"PlayerRefresh",
+		"Notifications",
+		"ProtectionExpiry",
+		"BlockedDamageLog"
+	};
+
+	//items left for a later tick since load or the last reset
+	inline std::array<uint64, static_cast<size_t>(Deferrable::Count)>& GetDeferredCounts()
+	{
+		static std::array<uint64, static_cast<size_t>(Deferrable::Count)> counts{};
+		return counts;
+	}
+
+	//wall time one UpdateTimer tick may spend on deferrable work, 0 never runs out.
+	//steady_clock is QueryPerformanceCounter on MSVC, so checking it per item costs tens of ns
+	class TickBudget
+	{
+		public:
+			explicit TickBudget(int micros)
+				:
+				deadline_(micros > 0 ? std::chrono::steady_clock::now() + std::chrono::microseconds(micros) : std::chrono::steady_clock::time_point::max())
+			{
+			}
+
+			bool Spent() const
+			{
+				return deadline_ != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() >= deadline_;
+			}
+
+			//records items of task as left for the next tick
+			static void Defer(Deferrable task, uint64 items)
+			{
+				GetDeferredCounts()[static_cast<size_t>(task)] += items;
+			}
+
+		private:
+			std::chrono::steady_clock::time_point deadline_;
+	};
+
+	//times the enclosing scope into a histogram, early returns included
+	class ScopedLatency
+	{
+		public:
+			explicit ScopedLatency(Stat stat)
+				:
+				stat_(stat),
+				start_(std::chrono::steady_clock::now())
+			{
+			}
+
+			~ScopedLatency()
+			{
+				GetStat(stat_).Record(static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count()));
+			}
+
+			ScopedLatency(const ScopedLatency&) = delete;
+			ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+		private:
+			Stat stat_;
+			std::chrono::steady_clock::time_point start_;
+	};
+}
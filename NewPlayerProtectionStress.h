@@ -0,0 +1,391 @@
+#pragma once
+
+#include <random>
+#include <thread>
+
+namespace NewPlayerProtection
+{
+	//NPP.Stress runs the game thread side in a tight loop for a few seconds: logins, level ups, tribe moves and logouts of made
+	//up players, timer ticks that publish ProtectionState and saves handed to the writer thread. meanwhile reader threads
+	//keep loading the published state the way other plugins and the shared table do. readers check that versions only go
+	//up, that a published state never changes and that aggregates are sane, the end checks the writer saved what the
+	//game thread last had. any race in the handoffs shows up as a violation, or in a race detecting build as a report.
+	//the players are real records once added, it is meant for test servers.
+	class StressTest
+	{
+		public:
+			static StressTest& Get();
+
+			StressTest(const StressTest&) = delete;
+			StressTest(StressTest&&) = delete;
+			StressTest& operator=(const StressTest&) = delete;
+			StressTest& operator=(StressTest&&) = delete;
+
+			//runs the whole test before returning
+			std::string Run(std::chrono::seconds duration, size_t reader_count, size_t player_count);
+
+		private:
+			StressTest() = default;
+			~StressTest() = default;
+
+			struct Player
+			{
+				uint64 steam_id;
+				uint64 tribe_id;
+				int level = 1;
+				bool online = false;
+			};
+
+			void Read();
+			void Mutate(Player& player);
+			bool WaitForWriter(std::chrono::milliseconds timeout);
+			void CheckSavedRows();
+			//thread safe, the first few are kept for the reply
+			void Violation(const std::string& what);
+			//hash over everything a reader can see in the state
+			static uint64 Checksum(const ProtectionState& state);
+
+			//below the simulation's range, the two never share records
+			static constexpr uint64 first_steam_id_ = 76561180000000000ull;
+			static constexpr uint64 first_tribe_id_ = 1800000000ull;
+			static constexpr size_t mutations_per_tick_ = 64;
+			static constexpr size_t ticks_per_save_ = 100;
+			static constexpr size_t max_reported_violations_ = 10;
+
+			std::vector<Player> players_;
+			size_t tribe_count_ = 1;
+			std::mt19937_64 rng_;
+
+			std::atomic<bool> stop_{ false };
+			std::atomic<uint64> reads_{ 0 };
+			std::atomic<uint64> violations_{ 0 };
+			std::mutex violations_mutex_;
+			std::vector<std::string> reported_violations_;
+
+			uint64 mutations_ = 0;
+			uint64 ticks_ = 0;
+			uint64 saves_ = 0;
+			size_t max_queue_depth_ = 0;
+	};
+}
+
+NewPlayerProtection::StressTest& NewPlayerProtection::StressTest::Get()
+{
+	static StressTest instance;
+	return instance;
+}
+
+void NewPlayerProtection::StressTest::Violation(const std::string& what)
+{
+	++violations_;
+
+	std::lock_guard<std::mutex> lock(violations_mutex_);
+
+	if (reported_violations_.size() < max_reported_violations_)
+	{
+		reported_violations_.push_back(what);
+	}
+}
+
+uint64 NewPlayerProtection::StressTest::Checksum(const ProtectionState& state)
+{
+	//order independent, the sets are unordered
+	uint64 sum = state.version;
+
+	for (const auto& tribe : state.tribes)
+	{
+		const auto& data = tribe.second;
+		sum += std::hash<uint64>()(tribe.first ^ (static_cast<uint64>(data.maxLevel) << 32) ^ (static_cast<uint64>(data.memberCount) << 48)
+			^ (static_cast<uint64>(data.isProtected) << 1) ^ static_cast<uint64>(data.isPVE) ^ static_cast<uint64>(data.oldestStartDateTime.time_since_epoch().count()));
+	}
+
+	for (const uint64 tribe_id : state.pveTribes)
+	{
+		sum += std::hash<uint64>()(~tribe_id);
+	}
+
+	for (const uint64 steam_id : state.admins)
+	{
+		sum += std::hash<uint64>()(steam_id * 31);
+	}
+	return sum;
+}
+
+void NewPlayerProtection::StressTest::Read()
+{
+	uint64 last_version = 0;
+	std::shared_ptr<const ProtectionState> held;
+	uint64 held_checksum = 0;
+	uint64 reads = 0;
+
+	while (!stop_.load(std::memory_order_relaxed))
+	{
+		const auto state = NewPlayerProtection::GetProtectionState();
+		++reads;
+
+		if (!state)
+		{
+			Violation("null protection state");
+			continue;
+		}
+
+		if (state->version < last_version)
+		{
+			Violation("protection state version went back from " + std::to_string(last_version) + " to " + std::to_string(state->version));
+		}
+		last_version = state->version;
+
+		//a held version must still read the same after the game thread published newer ones
+		if (held && (reads % 64) == 0)
+		{
+			if (Checksum(*held) != held_checksum)
+			{
+				Violation("published protection state " + std::to_string(held->version) + " changed after it was published");
+			}
+			held.reset();
+		}
+
+		if (held)
+			continue;
+
+		held = state;
+		held_checksum = Checksum(*held);
+
+		//UpdateTribe drops tribes without members, and IsTribeProtected answers from the same aggregate
+		for (const auto& tribe : held->tribes)
+		{
+			if (tribe.second.memberCount == 0)
+			{
+				Violation("tribe " + std::to_string(tribe.first) + " has no members in state " + std::to_string(held->version));
+			}
+
+			if (held->IsTribeProtected(tribe.first) != tribe.second.isProtected)
+			{
+				Violation("IsTribeProtected disagrees with the aggregate of tribe " + std::to_string(tribe.first));
+			}
+		}
+	}
+
+	reads_ += reads;
+}
+
+void NewPlayerProtection::StressTest::Mutate(Player& player)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	++mutations_;
+
+	if (!player.online)
+	{
+		//HandleNewPlayer, resolved on the next tick
+		timer.QueueLogin(player.steam_id, player.tribe_id, nullptr);
+		player.online = true;
+		return;
+	}
+
+	const auto data = timer.FindOnlinePlayer(player.steam_id);
+
+	//still queued
+	if (!data)
+		return;
+
+	switch (std::uniform_int_distribution<int>(0, 9)(rng_))
+	{
+		case 0:
+			timer.RemovePlayer(player.steam_id);
+			player.online = false;
+			break;
+		case 1:
+			//joins another tribe, both aggregates change
+			player.tribe_id = first_tribe_id_ + std::uniform_int_distribution<size_t>(0, tribe_count_ - 1)(rng_);
+			timer.ApplyLevelAndTribe(*data, player.tribe_id, player.level);
+			break;
+		default:
+			player.level = player.level % (NewPlayerProtection::GetSettings()->MaxLevel + 5) + 1;
+			timer.ApplyLevelAndTribe(*data, player.tribe_id, player.level);
+			break;
+	}
+}
+
+bool NewPlayerProtection::StressTest::WaitForWriter(std::chrono::milliseconds timeout)
+{
+	const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+	while (NewPlayerProtection::DBWriter::Get().GetQueueDepth() > 0)
+	{
+		if (std::chrono::steady_clock::now() >= deadline)
+			return false;
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	return true;
+}
+
+void NewPlayerProtection::StressTest::CheckSavedRows()
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	size_t checked = 0;
+
+	try
+	{
+		NewPlayerProtection::GetDB() << "SELECT SteamId, TribeId, Level FROM Players WHERE SteamId >= ? AND SteamId < ?;"
+			<< first_steam_id_ << first_steam_id_ + players_.size()
+			>> [this, &timer, &checked](uint64 steam_id, uint64 tribe_id, int level)
+		{
+			//evicted by a save, nothing left to compare against
+			const auto data = timer.FindPlayer(steam_id);
+
+			if (!data)
+				return;
+
+			++checked;
+
+			if (data->tribe_id != tribe_id || static_cast<int>(data->level) != level)
+			{
+				Violation("saved row of " + std::to_string(steam_id) + " is tribe " + std::to_string(tribe_id) + " level " + std::to_string(level)
+					+ ", the game thread has tribe " + std::to_string(data->tribe_id) + " level " + std::to_string(data->level));
+			}
+		};
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		Violation(std::string("reading the saved rows failed: ") + exception.what());
+	}
+
+	if (checked == 0 && !players_.empty())
+	{
+		Violation("no saved rows of the test players were found");
+	}
+}
+
+std::string NewPlayerProtection::StressTest::Run(std::chrono::seconds duration, size_t reader_count, size_t player_count)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+
+	rng_.seed(std::chrono::steady_clock::now().time_since_epoch().count());
+	tribe_count_ = std::max<size_t>(1, player_count / 3);
+	players_.clear();
+
+	for (size_t i = 0; i < player_count; ++i)
+	{
+		players_.push_back({ first_steam_id_ + i, first_tribe_id_ + i % tribe_count_ });
+	}
+
+	stop_ = false;
+	reads_ = 0;
+	violations_ = 0;
+	reported_violations_.clear();
+	mutations_ = ticks_ = saves_ = 0;
+	max_queue_depth_ = 0;
+
+	std::vector<std::thread> readers;
+
+	for (size_t i = 0; i < reader_count; ++i)
+	{
+		readers.emplace_back(&StressTest::Read, this);
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+	std::uniform_int_distribution<size_t> pick(0, players_.size() - 1);
+
+	while (std::chrono::steady_clock::now() - start < duration)
+	{
+		for (size_t i = 0; i < mutations_per_tick_; ++i)
+		{
+			Mutate(players_[pick(rng_)]);
+		}
+
+		timer.UpdateTimer();
+		++ticks_;
+
+		if (ticks_ % ticks_per_save_ == 0)
+		{
+			QueueProtectionSave();
+			++saves_;
+			max_queue_depth_ = std::max(max_queue_depth_, NewPlayerProtection::DBWriter::Get().GetQueueDepth());
+		}
+	}
+
+	const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	stop_ = true;
+
+	for (auto& reader : readers)
+	{
+		reader.join();
+	}
+
+	//the last state goes out with one more save, then the table has to match memory
+	QueueProtectionSave();
+	++saves_;
+
+	if (WaitForWriter(std::chrono::seconds(30)))
+	{
+		CheckSavedRows();
+	}
+	else
+	{
+		Violation("the writer did not catch up within 30 seconds");
+	}
+
+	for (auto& player : players_)
+	{
+		if (player.online)
+		{
+			timer.RemovePlayer(player.steam_id);
+			player.online = false;
+		}
+	}
+
+	std::string reply = "seconds,readers,reads_per_sec,mutations_per_sec,ticks,saves,max_writer_queue,violations\n"
+		+ std::to_string(elapsed)
+		+ "," + std::to_string(reader_count)
+		+ "," + std::to_string(static_cast<uint64>(reads_ / elapsed))
+		+ "," + std::to_string(static_cast<uint64>(mutations_ / elapsed))
+		+ "," + std::to_string(ticks_)
+		+ "," + std::to_string(saves_)
+		+ "," + std::to_string(max_queue_depth_)
+		+ "," + std::to_string(violations_.load());
+
+	for (const auto& violation : reported_violations_)
+	{
+		reply += "\n" + violation;
+	}
+	return reply;
+}
+
+//"NPP.Stress [seconds] [readers] [players]", defaults 10 seconds, 4 reader threads and 2000 players, see StressTest.
+//the game thread is held for the whole run, only for test servers
+inline FString StressCommand(const FString& body, const std::string& by)
+{
+	const auto parsed = TokenizeCommand(body);
+	uint64 seconds = 10, readers = 4, players = 2000;
+
+	if ((parsed.size() > 1 && !ParseUInt(parsed[1], seconds, __FUNCTION__))
+		|| (parsed.size() > 2 && !ParseUInt(parsed[2], readers, __FUNCTION__))
+		|| (parsed.size() > 3 && !ParseUInt(parsed[3], players, __FUNCTION__)))
+		return FString();
+
+	if (!NewPlayerProtection::IsLoaded())
+		return FString("NPP database is not loaded yet.");
+
+	seconds = std::max<uint64>(1, std::min<uint64>(seconds, 600));
+	readers = std::max<uint64>(1, std::min<uint64>(readers, 64));
+	players = std::max<uint64>(1, std::min<uint64>(players, 1000000));
+
+	NPP_LOG(info, "{} started NPP stress test for {} seconds with {} readers.", by, seconds, readers);
+
+	const std::string reply = NewPlayerProtection::StressTest::Get().Run(std::chrono::seconds(seconds), static_cast<size_t>(readers), static_cast<size_t>(players));
+
+	NPP_LOG(info, "NPP stress test finished:\n{}", reply);
+	return NewPlayerProtection::ToFString(reply);
+}
+
+inline void ConsoleStress(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleTribeCommand(player_controller, *cmd, &StressCommand);
+}
+
+inline void RconStress(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconTribeCommand(rcon_connection, rcon_packet, &StressCommand);
+}
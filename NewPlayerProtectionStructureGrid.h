@@ -0,0 +1,252 @@
+#pragma once
+
+namespace NewPlayerProtection
+{
+	//uniform grid over the bounds of placed structures, so an area can be checked for protected bases without walking actors.
+	//structures are filed by box and their tribe is read when queried, so claims and protection changes need no update.
+	//structures on a saddle or raft move with it, they are kept apart and checked at their current bounds
+	class StructureGrid
+	{
+		public:
+			static StructureGrid& Get();
+
+			StructureGrid(const StructureGrid&) = delete;
+			StructureGrid(StructureGrid&&) = delete;
+			StructureGrid& operator=(const StructureGrid&) = delete;
+			StructureGrid& operator=(StructureGrid&&) = delete;
+
+			bool IsBuilt() const
+			{
+				return built_;
+			}
+
+			//scans the level once, the BeginPlay and Destroyed hooks keep it current afterwards
+			void Build();
+			void Clear();
+			//ignored until the grid is built, Build picks the structure up with the rest
+			void Add(APrimalStructure* structure);
+			void Remove(APrimalStructure* structure);
+
+			//true when a structure of a tribe that may be protected or PVE has bounds within radius of center, builds the grid on first use
+			bool OverlapsProtected(const FVector& center, float radius);
+			//every tribe that may be protected or PVE with a structure within radius of center
+			void CollectProtectedTribes(const FVector& center, float radius, std::unordered_set<uint64>& tribes);
+
+			size_t Size() const
+			{
+				return bounds_.size() + movable_.size();
+			}
+
+		private:
+			StructureGrid() = default;
+			~StructureGrid() = default;
+
+			struct Bounds
+			{
+				float min_x, min_y, min_z;
+				float max_x, max_y, max_z;
+			};
+
+			static Bounds BoundsOf(APrimalStructure* structure);
+			static bool IsMovable(APrimalStructure* structure);
+			static bool Intersects(const Bounds& bounds, const FVector& center, float radius);
+			static int32 CellOf(float value);
+			static uint64 CellKey(int32 x, int32 y);
+
+			//calls func for every structure whose bounds reach into the sphere until it returns true, a structure
+			//spanning several cells may be visited once per cell
+			template <typename Func>
+			bool Query(const FVector& center, float radius, Func&& func);
+
+			//about 41 m, a base of foundations spans a handful of cells and a C4 radius one or four
+			static constexpr float cell_size_ = 4096.f;
+
+			std::unordered_map<uint64, std::vector<APrimalStructure*>> cells_;
+			std::unordered_map<APrimalStructure*, Bounds> bounds_;
+			std::unordered_set<APrimalStructure*> movable_;
+			bool built_ = false;
+	};
+}
+
+NewPlayerProtection::StructureGrid& NewPlayerProtection::StructureGrid::Get()
+{
+	static StructureGrid instance;
+	return instance;
+}
+
+NewPlayerProtection::StructureGrid::Bounds NewPlayerProtection::StructureGrid::BoundsOf(APrimalStructure* structure)
+{
+	FVector origin{};
+	FVector extent{};
+	structure->GetActorBounds(false, &origin, &extent);
+
+	return { origin.X - extent.X, origin.Y - extent.Y, origin.Z - extent.Z, origin.X + extent.X, origin.Y + extent.Y, origin.Z + extent.Z };
+}
+
+bool NewPlayerProtection::StructureGrid::IsMovable(APrimalStructure* structure)
+{
+	return structure->SaddleDinoField().Get() != nullptr || structure->AttachedToField() != nullptr;
+}
+
+bool NewPlayerProtection::StructureGrid::Intersects(const Bounds& bounds, const FVector& center, float radius)
+{
+	//distance from the center to the closest point of the box
+	const float dx = std::max({ bounds.min_x - center.X, 0.f, center.X - bounds.max_x });
+	const float dy = std::max({ bounds.min_y - center.Y, 0.f, center.Y - bounds.max_y });
+	const float dz = std::max({ bounds.min_z - center.Z, 0.f, center.Z - bounds.max_z });
+
+	return dx * dx + dy * dy + dz * dz <= radius * radius;
+}
+
+int32 NewPlayerProtection::StructureGrid::CellOf(float value)
+{
+	return static_cast<int32>(std::floor(value / cell_size_));
+}
+
+uint64 NewPlayerProtection::StructureGrid::CellKey(int32 x, int32 y)
+{
+	return (static_cast<uint64>(static_cast<uint32>(x)) << 32) | static_cast<uint32>(y);
+}
+
+void NewPlayerProtection::StructureGrid::Build()
+{
+	Clear();
+	built_ = true;
+
+	TArray<AActor*> structures;
+	UGameplayStatics::GetAllActorsOfClass(ArkApi::GetApiUtils().GetWorld(), APrimalStructure::GetPrivateStaticClass(), &structures);
+
+	for (AActor* actor : structures)
+	{
+		Add(static_cast<APrimalStructure*>(actor));
+	}
+
+	NPP_LOG(info, "NPP structure grid built, {} structures in {} cells.", Size(), cells_.size());
+}
+
+void NewPlayerProtection::StructureGrid::Clear()
+{
+	cells_.clear();
+	bounds_.clear();
+	movable_.clear();
+	built_ = false;
+}
+
+void NewPlayerProtection::StructureGrid::Add(APrimalStructure* structure)
+{
+	if (!built_ || !structure)
+		return;
+
+	if (IsMovable(structure))
+	{
+		movable_.insert(structure);
+		return;
+	}
+
+	const Bounds bounds = BoundsOf(structure);
+
+	if (!bounds_.emplace(structure, bounds).second)
+		return;
+
+	for (int32 x = CellOf(bounds.min_x); x <= CellOf(bounds.max_x); ++x)
+	{
+		for (int32 y = CellOf(bounds.min_y); y <= CellOf(bounds.max_y); ++y)
+		{
+			cells_[CellKey(x, y)].push_back(structure);
+		}
+	}
+}
+
+void NewPlayerProtection::StructureGrid::Remove(APrimalStructure* structure)
+{
+	if (!built_)
+		return;
+
+	movable_.erase(structure);
+
+	const auto iter = bounds_.find(structure);
+
+	if (iter == bounds_.end())
+		return;
+
+	const Bounds bounds = iter->second;
+	bounds_.erase(iter);
+
+	for (int32 x = CellOf(bounds.min_x); x <= CellOf(bounds.max_x); ++x)
+	{
+		for (int32 y = CellOf(bounds.min_y); y <= CellOf(bounds.max_y); ++y)
+		{
+			const auto cell = cells_.find(CellKey(x, y));
+
+			if (cell == cells_.end())
+				continue;
+
+			auto& entries = cell->second;
+			entries.erase(std::remove(entries.begin(), entries.end(), structure), entries.end());
+
+			if (entries.empty())
+			{
+				cells_.erase(cell);
+			}
+		}
+	}
+}
+
+template <typename Func>
+bool NewPlayerProtection::StructureGrid::Query(const FVector& center, float radius, Func&& func)
+{
+	if (!built_)
+	{
+		Build();
+	}
+
+	for (int32 x = CellOf(center.X - radius); x <= CellOf(center.X + radius); ++x)
+	{
+		for (int32 y = CellOf(center.Y - radius); y <= CellOf(center.Y + radius); ++y)
+		{
+			const auto cell = cells_.find(CellKey(x, y));
+
+			if (cell == cells_.end())
+				continue;
+
+			for (APrimalStructure* structure : cell->second)
+			{
+				if (Intersects(bounds_.at(structure), center, radius) && func(structure))
+					return true;
+			}
+		}
+	}
+
+	for (APrimalStructure* structure : movable_)
+	{
+		if (Intersects(BoundsOf(structure), center, radius) && func(structure))
+			return true;
+	}
+	return false;
+}
+
+bool NewPlayerProtection::StructureGrid::OverlapsProtected(const FVector& center, float radius)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+
+	return Query(center, radius, [&timer](APrimalStructure* structure)
+	{
+		return timer.MayBeProtected(structure->TargetingTeamField());
+	});
+}
+
+void NewPlayerProtection::StructureGrid::CollectProtectedTribes(const FVector& center, float radius, std::unordered_set<uint64>& tribes)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+
+	Query(center, radius, [&timer, &tribes](APrimalStructure* structure)
+	{
+		const uint64 tribe_id = structure->TargetingTeamField();
+
+		if (timer.MayBeProtected(tribe_id))
+		{
+			tribes.insert(tribe_id);
+		}
+		return false;
+	});
+}
@@ -0,0 +1,306 @@
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+
+namespace NewPlayerProtection
+{
+	//appends rows into a fixed size buffer and writes it out whenever the next row would not fit,
+	//so a table of any size is streamed with one allocation and a write per chunk
+	class ChunkedFileWriter
+	{
+		public:
+			explicit ChunkedFileWriter(const std::string& path)
+				: out_(path, std::ios::binary | std::ios::trunc)
+			{
+				buffer_.reserve(chunk_size_);
+			}
+
+			bool IsOpen() const
+			{
+				return out_.is_open();
+			}
+
+			void Append(const std::string& text)
+			{
+				if (buffer_.size() + text.size() > chunk_size_)
+				{
+					Flush();
+				}
+				buffer_ += text;
+			}
+
+			//false when a chunk could not be written
+			bool Flush()
+			{
+				if (!buffer_.empty())
+				{
+					out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+					buffer_.clear();
+				}
+				return out_.good();
+			}
+
+			//writes what is left, false when any of the file could not be written
+			bool Close()
+			{
+				const bool written = Flush();
+				out_.close();
+				return written && !out_.fail();
+			}
+
+			uint64 Rows() const
+			{
+				return rows_;
+			}
+
+			void CountRow()
+			{
+				++rows_;
+			}
+
+		private:
+			static constexpr size_t chunk_size_ = 64 * 1024;
+
+			std::ofstream out_;
+			std::string buffer_;
+			uint64 rows_ = 0;
+	};
+
+	//NPP.Export and ExportEveryHours, the Players and Tribes tables as of the last save written to Exports/ as CSV or JSONL.
+	//both are read in one read transaction on the task thread, so the two files always agree and the game thread only
+	//starts the export and logs the result. files are written as .tmp and renamed once complete.
+	class TableExport
+	{
+		public:
+			static TableExport& Get();
+
+			TableExport(const TableExport&) = delete;
+			TableExport(TableExport&&) = delete;
+			TableExport& operator=(const TableExport&) = delete;
+			TableExport& operator=(TableExport&&) = delete;
+
+			void Start();
+			void Stop();
+
+			//game thread, false while the last export is still being written. done(result) runs on the game thread
+			bool Request(bool jsonl, std::function<void(const std::string& result)> done);
+
+		private:
+			TableExport() = default;
+			~TableExport() = default;
+
+			//game thread, once a second, starts the scheduled exports
+			void Tick();
+			//task thread, the reply for the admin
+			static std::string Write(sqlite::database& db, const std::string& directory, const std::string& stamp, bool jsonl);
+
+			std::chrono::steady_clock::time_point next_scheduled_;
+			bool running_ = false;
+			bool in_flight_ = false;
+	};
+}
+
+NewPlayerProtection::TableExport& NewPlayerProtection::TableExport::Get()
+{
+	static TableExport instance;
+	return instance;
+}
+
+void NewPlayerProtection::TableExport::Start()
+{
+	if (running_)
+		return;
+
+	running_ = true;
+	next_scheduled_ = std::chrono::steady_clock::now() + std::chrono::hours(std::max(1, NewPlayerProtection::GetSettings()->ExportEveryHours));
+	ArkApi::GetCommands().AddOnTimerCallback("NPPTableExport", std::bind(&NewPlayerProtection::TableExport::Tick, this));
+}
+
+void NewPlayerProtection::TableExport::Stop()
+{
+	if (!running_)
+		return;
+
+	running_ = false;
+	ArkApi::GetCommands().RemoveOnTimerCallback("NPPTableExport");
+}
+
+bool NewPlayerProtection::TableExport::Request(bool jsonl, std::function<void(const std::string& result)> done)
+{
+	if (in_flight_)
+		return false;
+
+	const auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+	char stamp[32];
+	strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", localtime(&now));
+
+	const std::string directory = (std::filesystem::path(NewPlayerProtection::GetDBPath()).parent_path() / "Exports").string();
+
+	in_flight_ = true;
+
+	NewPlayerProtection::GameTasks::Get().Query<std::string>([directory, stamp = std::string(stamp), jsonl](sqlite::database& db)
+	{
+		return Write(db, directory, stamp, jsonl);
+	},
+	[done](const std::string& result)
+	{
+		NewPlayerProtection::TableExport::Get().in_flight_ = false;
+
+		//empty when the read failed, the error is already logged
+		done(result.empty() ? std::string("NPP export failed, see the log.") : result);
+	});
+	return true;
+}
+
+void NewPlayerProtection::TableExport::Tick()
+{
+	const auto settings = NewPlayerProtection::GetSettings();
+	const auto now = std::chrono::steady_clock::now();
+
+	if (settings->ExportEveryHours <= 0 || now < next_scheduled_)
+		return;
+
+	next_scheduled_ = now + std::chrono::hours(settings->ExportEveryHours);
+
+	Request(settings->ExportFormat == "jsonl", [](const std::string& result)
+	{
+		NPP_LOG(info, "{}", result);
+	});
+}
+
+std::string NewPlayerProtection::TableExport::Write(sqlite::database& db, const std::string& directory, const std::string& stamp, bool jsonl)
+{
+	const std::string extension = jsonl ? ".jsonl" : ".csv";
+	const std::string players_path = directory + "/Players-" + stamp + extension;
+	const std::string tribes_path = directory + "/Tribes-" + stamp + extension;
+
+	std::error_code error;
+	std::filesystem::create_directories(directory, error);
+
+	ChunkedFileWriter players(players_path + ".tmp");
+	ChunkedFileWriter tribes(tribes_path + ".tmp");
+
+	const auto remove_files = [&players_path, &tribes_path]()
+	{
+		std::error_code error;
+		std::filesystem::remove(players_path + ".tmp", error);
+		std::filesystem::remove(tribes_path + ".tmp", error);
+	};
+
+	if (!players.IsOpen() || !tribes.IsOpen())
+	{
+		players.Close();
+		tribes.Close();
+		remove_files();
+		NPP_LOG(err, "({} {}) Could not create export files in {}", __FILE__, __FUNCTION__, directory);
+		return "NPP export could not create its files in " + directory + ".";
+	}
+
+	if (!jsonl)
+	{
+		players.Append("steam_id,tribe_id,start_ms,last_login_ms,level,is_new_player\n");
+		tribes.Append("tribe_id,oldest_start_ms,max_level,is_protected,is_pve,member_count\n");
+	}
+
+	//one snapshot of both tables, the writer thread keeps committing meanwhile
+	db << "BEGIN TRANSACTION;";
+
+	try
+	{
+		db << "SELECT SteamId, TribeId, Start_DateTime, Last_Login_DateTime, Level, Is_New_Player FROM Players;"
+			>> [&players, jsonl](uint64 steamid, uint64 tribeid, int64 startdate, int64 lastlogindate, int level, int isnewplayer)
+		{
+			players.Append(jsonl
+				? "{\"steam_id\":" + std::to_string(steamid) + ",\"tribe_id\":" + std::to_string(tribeid) + ",\"start_ms\":" + std::to_string(startdate)
+					+ ",\"last_login_ms\":" + std::to_string(lastlogindate) + ",\"level\":" + std::to_string(level) + ",\"is_new_player\":" + std::to_string(isnewplayer) + "}\n"
+				: std::to_string(steamid) + "," + std::to_string(tribeid) + "," + std::to_string(startdate)
+					+ "," + std::to_string(lastlogindate) + "," + std::to_string(level) + "," + std::to_string(isnewplayer) + "\n");
+			players.CountRow();
+		};
+
+		db << "SELECT TribeId, Oldest_Start_DateTime, Max_Level, Is_Protected, Is_PVE, Member_Count FROM Tribes;"
+			>> [&tribes, jsonl](uint64 tribeid, int64 oldest, int maxlevel, int isprotected, int ispve, int members)
+		{
+			tribes.Append(jsonl
+				? "{\"tribe_id\":" + std::to_string(tribeid) + ",\"oldest_start_ms\":" + std::to_string(oldest) + ",\"max_level\":" + std::to_string(maxlevel)
+					+ ",\"is_protected\":" + std::to_string(isprotected) + ",\"is_pve\":" + std::to_string(ispve) + ",\"member_count\":" + std::to_string(members) + "}\n"
+				: std::to_string(tribeid) + "," + std::to_string(oldest) + "," + std::to_string(maxlevel)
+					+ "," + std::to_string(isprotected) + "," + std::to_string(ispve) + "," + std::to_string(members) + "\n");
+			tribes.CountRow();
+		};
+	}
+	catch (const sqlite::sqlite_exception&)
+	{
+		db << "ROLLBACK;";
+		players.Close();
+		tribes.Close();
+		remove_files();
+		throw;
+	}
+
+	db << "COMMIT;";
+
+	//both closed before the rename
+	const bool players_written = players.Close();
+	const bool written = tribes.Close() && players_written;
+
+	if (written)
+	{
+		std::filesystem::rename(players_path + ".tmp", players_path, error);
+
+		if (!error)
+		{
+			std::filesystem::rename(tribes_path + ".tmp", tribes_path, error);
+		}
+	}
+
+	if (!written || error)
+	{
+		remove_files();
+		NPP_LOG(err, "({} {}) Could not write export files in {}", __FILE__, __FUNCTION__, directory);
+		return "NPP export could not write its files in " + directory + ".";
+	}
+
+	return "NPP export of " + std::to_string(players.Rows()) + " players and " + std::to_string(tribes.Rows()) + " tribes written to "
+		+ players_path + " and " + tribes_path + ".";
+}
+
+//"NPP.Export [csv|jsonl]", the tables as of the last save, ExportFormat when no format is given
+inline void ExportCommand(const FString& body, const std::string& by, const CommandReply& reply)
+{
+	const auto parsed = TokenizeCommand(body);
+	bool jsonl = NewPlayerProtection::GetSettings()->ExportFormat == "jsonl";
+
+	if (parsed.size() > 1)
+	{
+		if (parsed[1] != L"csv" && parsed[1] != L"jsonl")
+		{
+			reply(FString());
+			return;
+		}
+		jsonl = parsed[1] == L"jsonl";
+	}
+
+	if (!NewPlayerProtection::TableExport::Get().Request(jsonl, [reply](const std::string& result)
+	{
+		NPP_LOG(info, "{}", result);
+		reply(NewPlayerProtection::ToFString(result));
+	}))
+	{
+		reply(FString("NPP export is already running."));
+		return;
+	}
+
+	NPP_LOG(info, "{} started an NPP export.", by);
+}
+
+inline void ConsoleExport(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleAsyncTribeCommand(player_controller, *cmd, &ExportCommand);
+}
+
+inline void RconExport(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconAsyncTribeCommand(rcon_connection, rcon_packet, &ExportCommand);
+}
@@ -0,0 +1,358 @@
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+namespace NewPlayerProtection
+{
+	//database work of the admin commands, run on a thread with its own connection. the continuation runs on the game thread
+	//on the next tick with the result, so a command that has to read from the database never holds up the tick and still
+	//mutates the tables and replies from the game thread. the toolset has no coroutines, work and continuation are two lambdas.
+	class GameTasks
+	{
+		public:
+			static GameTasks& Get();
+
+			GameTasks(const GameTasks&) = delete;
+			GameTasks(GameTasks&&) = delete;
+			GameTasks& operator=(const GameTasks&) = delete;
+			GameTasks& operator=(GameTasks&&) = delete;
+
+			void Start(const std::string& db_path);
+			void Stop(std::chrono::milliseconds timeout);
+
+			//work(db) on the task thread, then(result) on the game thread. a failed query hands then a default result.
+			//while the thread is not running both run right away on the game thread and GetDB()
+			template <typename Result, typename Work, typename Then>
+			void Query(Work&& work, Then&& then);
+
+			//any thread, func runs on the game thread on the next tick
+			void Post(std::function<void()> func);
+
+			//queries not finished yet and continuations not run yet
+			size_t GetPending();
+
+		private:
+			GameTasks() = default;
+			~GameTasks() = default;
+
+			void Run(sqlite::database db);
+			//game thread, every tick
+			void Tick(float);
+
+			std::thread thread_;
+			std::mutex mutex_;
+			std::condition_variable queue_cv_;
+			std::condition_variable drained_cv_;
+			std::deque<std::function<void(sqlite::database&)>> queue_;
+			std::vector<std::function<void()>> completions_;
+			//lets the tick skip the lock while nothing finished
+			std::atomic<bool> has_completions_{ false };
+			bool running_ = false;
+			bool stop_ = false;
+			bool busy_ = false;
+	};
+}
+
+NewPlayerProtection::GameTasks& NewPlayerProtection::GameTasks::Get()
+{
+	static GameTasks instance;
+	return instance;
+}
+
+void NewPlayerProtection::GameTasks::Start(const std::string& db_path)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	if (running_)
+		return;
+
+	try
+	{
+		sqlite::database db(db_path);
+		ApplyConnectionProfile(db, *NewPlayerProtection::GetSettings());
+
+		running_ = true;
+		stop_ = false;
+		thread_ = std::thread(&GameTasks::Run, this, db);
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		NPP_LOG(err, "({} {}) Could not open task connection, admin commands read on the game thread: {}", __FILE__, __FUNCTION__, exception.what());
+		return;
+	}
+
+	ArkApi::GetCommands().AddOnTickCallback("NPPGameTasks", std::bind(&NewPlayerProtection::GameTasks::Tick, this, std::placeholders::_1));
+}
+
+void NewPlayerProtection::GameTasks::Stop(std::chrono::milliseconds timeout)
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+
+	if (!running_)
+		return;
+
+	stop_ = true;
+	queue_cv_.notify_one();
+
+	//called from DllMain like DBWriter::Stop, the continuations of whatever is left are dropped
+	if (!drained_cv_.wait_for(lock, timeout, [this] { return queue_.empty() && !busy_; }))
+	{
+		NPP_LOG(warn, "NPP task thread did not finish in time, {} queries were dropped.", queue_.size());
+	}
+
+	running_ = false;
+	completions_.clear();
+	lock.unlock();
+
+	ArkApi::GetCommands().RemoveOnTickCallback("NPPGameTasks");
+
+	if (thread_.joinable())
+	{
+		thread_.detach();
+	}
+}
+
+template <typename Result, typename Work, typename Then>
+void NewPlayerProtection::GameTasks::Query(Work&& work, Then&& then)
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+
+	if (!running_)
+	{
+		lock.unlock();
+
+		Result result{};
+
+		try
+		{
+			result = work(NewPlayerProtection::GetDB());
+		}
+		catch (const sqlite::sqlite_exception& exception)
+		{
+			NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+		}
+
+		then(result);
+		return;
+	}
+
+	queue_.push_back([this, work = std::forward<Work>(work), then = std::forward<Then>(then)](sqlite::database& db)
+	{
+		auto result = std::make_shared<Result>();
+
+		try
+		{
+			*result = work(db);
+		}
+		catch (const sqlite::sqlite_exception& exception)
+		{
+			NPP_LOG(err, "({} {}) Unexpected DB error {}", __FILE__, __FUNCTION__, exception.what());
+		}
+
+		Post([then, result]()
+		{
+			then(*result);
+		});
+	});
+
+	lock.unlock();
+	queue_cv_.notify_one();
+}
+
+void NewPlayerProtection::GameTasks::Post(std::function<void()> func)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	completions_.push_back(std::move(func));
+	has_completions_.store(true, std::memory_order_release);
+}
+
+size_t NewPlayerProtection::GameTasks::GetPending()
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return queue_.size() + (busy_ ? 1 : 0) + completions_.size();
+}
+
+void NewPlayerProtection::GameTasks::Tick(float)
+{
+	if (!has_completions_.load(std::memory_order_acquire))
+		return;
+
+	std::vector<std::function<void()>> completions;
+
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		completions.swap(completions_);
+		has_completions_.store(false, std::memory_order_relaxed);
+	}
+
+	//a continuation may queue the next query, it finishes on a later tick
+	for (const auto& completion : completions)
+	{
+		completion();
+	}
+}
+
+void NewPlayerProtection::GameTasks::Run(sqlite::database db)
+{
+	NewPlayerProtection::ApplyBackgroundThreadSettings("task");
+
+	std::unique_lock<std::mutex> lock(mutex_);
+
+	while (true)
+	{
+		queue_cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+
+		if (queue_.empty())
+		{
+			drained_cv_.notify_all();
+			break;
+		}
+
+		auto task = std::move(queue_.front());
+		queue_.pop_front();
+		busy_ = true;
+		lock.unlock();
+
+		task(db);
+
+		lock.lock();
+		busy_ = false;
+
+		if (queue_.empty())
+		{
+			drained_cv_.notify_all();
+		}
+	}
+}
+
+//game thread, rows of a tribe read by the task thread. players that became resident meanwhile keep their in-memory record
+inline void AdoptTribeRows(uint64 tribe_id, const std::vector<NewPlayerProtection::PlayerRow>& rows)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+
+	if (!timer.resident_tribes_.insert(tribe_id).second)
+		return;
+
+	size_t added = 0;
+
+	for (const auto& row : rows)
+	{
+		if (timer.AddPlayerFromDB(row.steam_id, row.tribe_id, NewPlayerProtection::FromEpochMs(row.start_ms),
+			NewPlayerProtection::FromEpochMs(row.last_login_ms), row.level, row.is_new_player))
+		{
+			++added;
+		}
+	}
+
+	//same as EnsureTribeResident, an unprotected member read back in can still expire the tribe
+	if (added > 0)
+	{
+		timer.UpdateTribe(tribe_id);
+		timer.MarkTribeForExpiry(tribe_id);
+	}
+}
+
+//then() on the game thread once the tribe's records are resident, right away when they already are
+template <typename Then>
+void WithResidentTribe(uint64 tribe_id, Then&& then)
+{
+	if (NewPlayerProtection::TimerProt::Get().resident_tribes_.count(tribe_id) > 0)
+	{
+		then();
+		return;
+	}
+
+	//empty when the query failed, the tribe is then left to the next command to read
+	NewPlayerProtection::GameTasks::Get().Query<std::optional<std::vector<NewPlayerProtection::PlayerRow>>>([tribe_id](sqlite::database& db)
+	{
+		std::vector<NewPlayerProtection::PlayerRow> rows;
+
+		ReadPlayerRows(db, "TribeId = ?", [&rows](const NewPlayerProtection::PlayerRow& row)
+		{
+			rows.push_back(row);
+		}, tribe_id);
+
+		return std::make_optional(std::move(rows));
+	},
+	[tribe_id, then = std::forward<Then>(then)](const std::optional<std::vector<NewPlayerProtection::PlayerRow>>& rows)
+	{
+		if (rows)
+		{
+			AdoptTribeRows(tribe_id, *rows);
+		}
+		then();
+	});
+}
+
+//same for several tribes, the ones not resident are read together and then() runs once they all are
+template <typename Then>
+void WithResidentTribes(const std::vector<uint64>& tribe_ids, Then&& then)
+{
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+	std::vector<uint64> missing;
+
+	for (const uint64 tribe_id : tribe_ids)
+	{
+		if (timer.resident_tribes_.count(tribe_id) == 0)
+		{
+			missing.push_back(tribe_id);
+		}
+	}
+
+	if (missing.empty())
+	{
+		then();
+		return;
+	}
+
+	using TribeRows = std::unordered_map<uint64, std::vector<NewPlayerProtection::PlayerRow>>;
+
+	NewPlayerProtection::GameTasks::Get().Query<std::optional<TribeRows>>([missing](sqlite::database& db)
+	{
+		//ids are integers, so they go into the statement as literal lists, a few hundred at a time
+		const size_t chunk_size = 500;
+		TribeRows rows;
+
+		db << "BEGIN TRANSACTION;";
+
+		for (size_t first = 0; first < missing.size(); first += chunk_size)
+		{
+			std::string where = "TribeId IN (";
+
+			for (size_t i = first; i < std::min(first + chunk_size, missing.size()); ++i)
+			{
+				where += std::to_string(missing[i]);
+				where += ',';
+			}
+			where.back() = ')';
+
+			ReadPlayerRows(db, where, [&rows](const NewPlayerProtection::PlayerRow& row)
+			{
+				rows[row.tribe_id].push_back(row);
+			});
+		}
+
+		db << "COMMIT;";
+		return std::make_optional(std::move(rows));
+	},
+	[missing, then = std::forward<Then>(then)](const std::optional<TribeRows>& rows)
+	{
+		if (rows)
+		{
+			static const std::vector<NewPlayerProtection::PlayerRow> no_rows;
+
+			//tribes without rows are resident too, there is nothing left to read for them
+			for (const uint64 tribe_id : missing)
+			{
+				const auto iter = rows->find(tribe_id);
+				AdoptTribeRows(tribe_id, iter != rows->end() ? iter->second : no_rows);
+			}
+		}
+		then();
+	});
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <Requests.h>
+
+namespace NewPlayerProtection
+{
+	//posts protection events from the EventBus to WebhookUrl as a Discord style {"content": ...} message.
+	//events are collected and sent together at most once every WebhookIntervalInSecs, one request at a time.
+	//while the endpoint is down the queue is capped at WebhookMaxQueuedEvents, the oldest events are dropped and
+	//only counted, the next post says how many were lost. nothing here ever waits on the request.
+	class WebhookSink
+	{
+		public:
+			static WebhookSink& Get();
+
+			WebhookSink(const WebhookSink&) = delete;
+			WebhookSink(WebhookSink&&) = delete;
+			WebhookSink& operator=(const WebhookSink&) = delete;
+			WebhookSink& operator=(WebhookSink&&) = delete;
+
+			void Start();
+			void Stop();
+
+		private:
+			WebhookSink() = default;
+			~WebhookSink() = default;
+
+			void OnEvents(const std::vector<ProtectionEvent>& events);
+			void Tick();
+			void Post(const Settings& settings);
+			static std::string Describe(const ProtectionEvent& event);
+
+			//Discord rejects content over 2000 characters, the rest waits for the next post
+			static constexpr size_t max_content_length_ = 1900;
+
+			std::deque<ProtectionEvent> queue_;
+			//dropped since the last post
+			uint64 dropped_ = 0;
+			std::chrono::steady_clock::time_point next_post_;
+			//shared with the request callback, which may outlive a Stop
+			std::shared_ptr<bool> in_flight_ = std::make_shared<bool>(false);
+			bool running_ = false;
+	};
+}
+
+NewPlayerProtection::WebhookSink& NewPlayerProtection::WebhookSink::Get()
+{
+	static WebhookSink instance;
+	return instance;
+}
+
+void NewPlayerProtection::WebhookSink::Start()
+{
+	if (running_)
+		return;
+
+	running_ = true;
+	next_post_ = std::chrono::steady_clock::now();
+	NewPlayerProtection::EventBus::Get().Subscribe("NPPWebhook", std::bind(&NewPlayerProtection::WebhookSink::OnEvents, this, std::placeholders::_1));
+	ArkApi::GetCommands().AddOnTimerCallback("NPPWebhook", std::bind(&NewPlayerProtection::WebhookSink::Tick, this));
+}
+
+void NewPlayerProtection::WebhookSink::Stop()
+{
+	if (!running_)
+		return;
+
+	running_ = false;
+	NewPlayerProtection::EventBus::Get().Unsubscribe("NPPWebhook");
+	ArkApi::GetCommands().RemoveOnTimerCallback("NPPWebhook");
+	queue_.clear();
+}
+
+void NewPlayerProtection::WebhookSink::OnEvents(const std::vector<ProtectionEvent>& events)
+{
+	const auto settings = NewPlayerProtection::GetSettings();
+
+	if (settings->WebhookUrl.empty())
+		return;
+
+	const size_t limit = static_cast<size_t>(std::max(1, settings->WebhookMaxQueuedEvents));
+
+	for (const auto& event : events)
+	{
+		if (queue_.size() >= limit)
+		{
+			queue_.pop_front();
+			++dropped_;
+		}
+		queue_.push_back(event);
+	}
+}
+
+std::string NewPlayerProtection::WebhookSink::Describe(const ProtectionEvent& event)
+{
+	const std::string tribe = "Tribe " + std::to_string(event.tribe_id);
+
+	switch (event.type)
+	{
+		case ProtectionEventType::ProtectionGained:
+			return tribe + " is now under New Player Protection";
+		case ProtectionEventType::ProtectionLost:
+			return tribe + " is no longer under New Player Protection";
+		case ProtectionEventType::PveEnabled:
+			return tribe + " was made a PVE tribe";
+		case ProtectionEventType::PveDisabled:
+			return tribe + " is no longer a PVE tribe";
+		case ProtectionEventType::ExpiryImminent:
+			return tribe + "'s protection ends in " + std::to_string(std::max<int64>(0, event.expires_ms - event.timestamp_ms + 59999) / 60000) + " minute(s)";
+		case ProtectionEventType::IntegrityCheckFailed:
+			return "The NPP database integrity check found problems, see the server log";
+		default:
+			return tribe + " " + ProtectionEventNames[static_cast<size_t>(event.type)];
+	}
+}
+
+void NewPlayerProtection::WebhookSink::Tick()
+{
+	const auto settings = NewPlayerProtection::GetSettings();
+
+	if (settings->WebhookUrl.empty())
+	{
+		queue_.clear();
+		dropped_ = 0;
+		return;
+	}
+
+	const auto now = std::chrono::steady_clock::now();
+
+	if (now < next_post_ || *in_flight_ || (queue_.empty() && dropped_ == 0))
+		return;
+
+	next_post_ = now + std::chrono::seconds(std::max(1, settings->WebhookIntervalInSecs));
+	Post(*settings);
+}
+
+void NewPlayerProtection::WebhookSink::Post(const Settings& settings)
+{
+	std::string content;
+
+	if (dropped_ > 0)
+	{
+		content = std::to_string(dropped_) + " older protection event(s) were dropped while the webhook was unavailable\n";
+	}
+
+	size_t count = 0;
+
+	for (; count < queue_.size(); ++count)
+	{
+		const std::string line = Describe(queue_[count]) + "\n";
+
+		if (count > 0 && content.size() + line.size() > max_content_length_)
+			break;
+
+		content += line;
+	}
+
+	nlohmann::json message;
+	message["content"] = content;
+
+	//older ArkApi builds hand curl a pointer to the body instead of a copy, so the callback owns it until the request is done
+	auto body = std::make_shared<std::string>(message.dump());
+	std::vector<std::string> headers = { "Content-Type: application/json" };
+
+	*in_flight_ = true;
+
+	auto in_flight = in_flight_;
+	const bool started = API::Requests::Get().CreatePostRequest(settings.WebhookUrl, [in_flight, body, count](bool success, std::string response)
+	{
+		*in_flight = false;
+
+		if (!success)
+		{
+			NPP_LOG(warn, "NPP webhook post of {} events failed: {}", count, response);
+		}
+	}, *body, std::move(headers));
+
+	if (!started)
+	{
+		//kept for the next post
+		*in_flight_ = false;
+		return;
+	}
+
+	//a failed post is not retried, the endpoint being down must not grow the queue past its cap
+	queue_.erase(queue_.begin(), queue_.begin() + count);
+	dropped_ = 0;
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+namespace NewPlayerProtection
+{
+	//what a wipe takes out of TimerProt, freed on a thread of its own so the game thread only swaps containers
+	struct WipedTables
+	{
+		decltype(TimerProt::all_players_) all_players;
+		decltype(TimerProt::player_cold_) player_cold;
+		decltype(TimerProt::player_index_) player_index;
+		decltype(TimerProt::online_players_) online_players;
+		decltype(TimerProt::tribes_) tribes;
+		decltype(TimerProt::dirty_tribes_) dirty_tribes;
+		decltype(TimerProt::status_cache_) status_cache;
+		decltype(TimerProt::tribe_index_) tribe_index;
+		decltype(TimerProt::expiry_queue_) expiry_queue;
+		decltype(TimerProt::expiry_index_) expiry_index;
+		decltype(TimerProt::warning_queue_) warning_queue;
+		decltype(TimerProt::refresh_queue_) refresh_queue;
+		decltype(TimerProt::pending_tribes_) pending_tribes;
+		decltype(TimerProt::queued_refresh_) queued_refresh;
+		decltype(TimerProt::resident_tribes_) resident_tribes;
+		decltype(TimerProt::dirty_players_) dirty_players;
+		decltype(TimerProt::journal_players_) journal_players;
+		decltype(TimerProt::pending_notifications_) pending_notifications;
+		decltype(TimerProt::pending_tribe_notifications_) pending_tribe_notifications;
+		std::unordered_set<uint64> pve_tribes;
+	};
+}
+
+size_t NewPlayerProtection::TimerProt::Wipe()
+{
+	struct OnlinePlayer
+	{
+		uint64 steam_id;
+		uint64 tribe_id;
+		AShooterPlayerController* controller;
+	};
+
+	std::vector<OnlinePlayer> online;
+	online.reserve(online_players_.size());
+
+	for (const size_t index : online_players_)
+	{
+		const AllPlayerData& data = all_players_[index];
+		const OnlineState* state = FindOnlineState(data.steam_id);
+		online.push_back({ data.steam_id, data.tribe_id, state ? state->controller : nullptr });
+	}
+
+	const size_t records = all_players_.size();
+	auto wiped = std::make_unique<WipedTables>();
+
+	std::swap(wiped->all_players, all_players_);
+	std::swap(wiped->player_cold, player_cold_);
+	std::swap(wiped->player_index, player_index_);
+	std::swap(wiped->online_players, online_players_);
+	std::swap(wiped->tribes, tribes_);
+	std::swap(wiped->dirty_tribes, dirty_tribes_);
+	std::swap(wiped->status_cache, status_cache_);
+	std::swap(wiped->tribe_index, tribe_index_);
+	std::swap(wiped->expiry_queue, expiry_queue_);
+	std::swap(wiped->expiry_index, expiry_index_);
+	std::swap(wiped->warning_queue, warning_queue_);
+	std::swap(wiped->refresh_queue, refresh_queue_);
+	std::swap(wiped->pending_tribes, pending_tribes_);
+	std::swap(wiped->queued_refresh, queued_refresh_);
+	std::swap(wiped->resident_tribes, resident_tribes_);
+	std::swap(wiped->dirty_players, dirty_players_);
+	std::swap(wiped->journal_players, journal_players_);
+	std::swap(wiped->pending_notifications, pending_notifications_);
+	std::swap(wiped->pending_tribe_notifications, pending_tribe_notifications_);
+	std::swap(wiped->pve_tribes, NewPlayerProtection::pveTribesList);
+
+	//the states of the online players go to the spares, their logins below take them back
+	while (!online_state_.empty())
+	{
+		spare_online_states_.push_back(online_state_.extract(online_state_.begin()));
+	}
+
+	protected_tribes_ = 0;
+	refresh_cursor_ = std::string::npos;
+	//the armed wake-up no longer matches and is ignored when it fires
+	expiry_wakeup_ = std::chrono::time_point<std::chrono::system_clock>::max();
+	protected_filter_generation_ = ~0u;
+
+	//the thread owns the only pointer, however soon it runs
+	std::thread([old_tables = wiped.release()]()
+	{
+		NewPlayerProtection::ApplyBackgroundThreadSettings("wipe");
+		delete old_tables;
+	}).detach();
+
+	NewPlayerProtection::Epochs.BumpAll();
+	NewPlayerProtection::StructureVerdicts.Clear();
+
+	//the tables are emptied, so the tribes of the players brought back have nothing left to read
+	for (const auto& player : online)
+	{
+		resident_tribes_.insert(player.tribe_id);
+		AddOnlinePlayer(player.steam_id, player.tribe_id, player.controller);
+		FetchLoginGroups(player.steam_id);
+		QueuePlayerRefresh(player.steam_id);
+	}
+
+	PublishProtectionState();
+	return records;
+}
+
+//"NPP.Wipe confirm", drops every record in memory and empties the tables in one transaction on the writer thread.
+//players online now start over as new players. logins wait until the wipe is committed, a few seconds at most
+inline FString WipeCommand(const FString& body, const std::string& by)
+{
+	const auto parsed = TokenizeCommand(body);
+
+	if (parsed.size() != 2 || parsed[1] != L"confirm")
+		return FString("Usage: NPP.Wipe confirm");
+
+	if (!NewPlayerProtection::IsLoaded())
+		return FString("NPP database is not loaded yet.");
+
+	auto& timer = NewPlayerProtection::TimerProt::Get();
+
+	const auto started = std::chrono::steady_clock::now();
+	const size_t records = timer.Wipe();
+
+	//covers every journal segment written before the wipe, they are removed once it is committed
+	auto batch = NewPlayerProtection::DBWriter::Get().AcquireBatch();
+	batch.wipe = true;
+	batch.journalSegment = NewPlayerProtection::Journal::Get().Rotate();
+	NewPlayerProtection::DBWriter::Get().Enqueue(std::move(batch));
+
+	const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started).count();
+
+	NPP_LOG(warn, "{} wiped NPP, {} records dropped and {} online players protected again in {} ms.", by, records, timer.OnlineCount(), ms);
+
+	return NewPlayerProtection::ToFString("NPP wiped, " + std::to_string(records) + " records dropped and " + std::to_string(timer.OnlineCount())
+		+ " online players protected again. The tables are emptied on the writer thread.");
+}
+
+inline void ConsoleWipe(APlayerController* player_controller, FString* cmd, bool)
+{
+	RunConsoleTribeCommand(player_controller, *cmd, &WipeCommand);
+}
+
+inline void RconWipe(RCONClientConnection* rcon_connection, RCONPacket* rcon_packet, UWorld*)
+{
+	RunRconTribeCommand(rcon_connection, rcon_packet, &WipeCommand);
+}
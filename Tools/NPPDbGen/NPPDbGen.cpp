@@ -0,0 +1,221 @@
+//writes a NewPlayerProtection.db full of made up players for load and save benchmarks.
+//the tables are the ones CreateSchema makes at schema version 1, the plugin runs the later migrations itself on the first
+//load, so the Tribes aggregates and snapshot state come from the same code as on a real upgrade.
+//
+//NPPDbGen <output.db> [--players N] [--tribes M] [--seed S] [--days D] [--pve-fraction F] [--protection-hours H]
+//         [--max-level L] [--decay-hours X]
+
+#include "../../hdr/sqlite_modern_cpp.h"
+
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+	struct Options
+	{
+		std::string path;
+		uint64_t players = 100000;
+		uint64_t tribes = 40000;
+		uint64_t seed = 1;
+		//start dates are spread over this many days before now
+		int days = 90;
+		double pve_fraction = 0.01;
+		//same meaning and defaults as HoursOfProtection, NewPlayerMaxLevel and NPPPlayerDecayInHours in config.json
+		int protection_hours = 72;
+		int max_level = 60;
+		int decay_hours = 384;
+	};
+
+	bool ParseOptions(int argc, char** argv, Options& options)
+	{
+		if (argc < 2)
+			return false;
+
+		options.path = argv[1];
+
+		for (int i = 2; i + 1 < argc; i += 2)
+		{
+			const std::string name = argv[i];
+			const char* value = argv[i + 1];
+
+			if (name == "--players")
+				options.players = std::strtoull(value, nullptr, 10);
+			else if (name == "--tribes")
+				options.tribes = std::strtoull(value, nullptr, 10);
+			else if (name == "--seed")
+				options.seed = std::strtoull(value, nullptr, 10);
+			else if (name == "--days")
+				options.days = std::atoi(value);
+			else if (name == "--pve-fraction")
+				options.pve_fraction = std::atof(value);
+			else if (name == "--protection-hours")
+				options.protection_hours = std::atoi(value);
+			else if (name == "--max-level")
+				options.max_level = std::atoi(value);
+			else if (name == "--decay-hours")
+				options.decay_hours = std::atoi(value);
+			else
+				return false;
+		}
+
+		return (argc % 2) == 0 && options.players > 0 && options.tribes > 0 && options.days > 0;
+	}
+
+	int64_t NowMs()
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+	}
+
+	//tribe of every player. sizes follow a zipf like curve, most tribes are one or two players and a few are large.
+	//every tribe gets at least one member while there are players left for it
+	std::vector<uint64_t> AssignTribes(const Options& options, std::mt19937_64& rng)
+	{
+		//ark tribe ids are large and close together
+		const uint64_t first_tribe_id = 1000000000;
+
+		std::vector<double> weights(options.tribes);
+
+		for (uint64_t i = 0; i < options.tribes; ++i)
+		{
+			weights[i] = 1.0 / std::pow(static_cast<double>(i + 1), 0.8);
+		}
+
+		std::discrete_distribution<uint64_t> pick(weights.begin(), weights.end());
+		std::vector<uint64_t> tribes(options.players);
+
+		for (uint64_t i = 0; i < options.players; ++i)
+		{
+			tribes[i] = first_tribe_id + (i < options.tribes ? i : pick(rng));
+		}
+
+		std::shuffle(tribes.begin(), tribes.end(), rng);
+		return tribes;
+	}
+
+	void CreateTables(sqlite::database& db)
+	{
+		db << "PRAGMA auto_vacuum = INCREMENTAL;";
+
+		db << "create table if not exists Players ("
+			"SteamId integer primary key not null,"
+			"TribeId integer default 0,"
+			"Start_DateTime integer default 0,"
+			"Last_Login_DateTime integer default 0,"
+			"Level integer default 0,"
+			"Is_New_Player integer default 0"
+			");";
+
+		db << "create table if not exists PVE_Tribes ("
+			"TribeId integer primary key not null,"
+			"Is_Protected integer default 0"
+			");";
+
+		db << "CREATE INDEX IF NOT EXISTS Players_TribeId ON Players(TribeId, Last_Login_DateTime);";
+		db << "CREATE INDEX IF NOT EXISTS Players_Last_Login_DateTime ON Players(Last_Login_DateTime);";
+
+		//epoch timestamps and lookup indexes, the rest is migrated by the plugin
+		db << "PRAGMA user_version = 1;";
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Options options;
+
+	if (!ParseOptions(argc, argv, options))
+	{
+		std::cerr << "usage: NPPDbGen <output.db> [--players N] [--tribes M] [--seed S] [--days D] [--pve-fraction F]"
+			" [--protection-hours H] [--max-level L] [--decay-hours X]\n";
+		return 1;
+	}
+
+	if (std::remove(options.path.c_str()) == 0)
+	{
+		std::cout << "Replaced " << options.path << "\n";
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+
+	try
+	{
+		sqlite::database db(options.path);
+
+		//nothing to protect while the file is being built, the plugin sets its own journal mode on load
+		db << "PRAGMA journal_mode = OFF;";
+		db << "PRAGMA synchronous = OFF;";
+
+		CreateTables(db);
+
+		std::mt19937_64 rng(options.seed);
+		std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+		const int64_t now_ms = NowMs();
+		const int64_t hour_ms = 3600000;
+		const int64_t window_ms = static_cast<int64_t>(options.days) * 24 * hour_ms;
+
+		//servers see a steady stream of new players on top of an older base, so start ages are exponential
+		std::exponential_distribution<double> start_age(3.0 / static_cast<double>(window_ms));
+		//most players were on in the last days, a long tail drifts past the decay window
+		std::exponential_distribution<double> login_age(1.0 / (static_cast<double>(options.decay_hours) * hour_ms / 3.0));
+		//levels per hour played, players level fast early on
+		std::lognormal_distribution<double> level_rate(0.0, 0.6);
+
+		const std::vector<uint64_t> tribes = AssignTribes(options, rng);
+
+		db << "BEGIN TRANSACTION;";
+
+		{
+			auto insert = db << "INSERT INTO Players(SteamId, TribeId, Start_DateTime, Last_Login_DateTime, Level, Is_New_Player) VALUES(?,?,?,?,?,?);";
+			insert.used(true);
+
+			for (uint64_t i = 0; i < options.players; ++i)
+			{
+				const int64_t start_ms = now_ms - std::min(window_ms, static_cast<int64_t>(start_age(rng)));
+				const int64_t last_login_ms = std::max(start_ms, now_ms - static_cast<int64_t>(login_age(rng)));
+
+				//about an hour of play per day between start and last login, with a session or two on the first day
+				const double played_hours = static_cast<double>(last_login_ms - start_ms) / hour_ms / 24.0 + unit(rng) * 4.0;
+				const int level = std::min(options.max_level + 45, 1 + static_cast<int>(played_hours * level_rate(rng) * 2.0));
+
+				const bool new_player = last_login_ms - start_ms < options.protection_hours * hour_ms && level < options.max_level;
+
+				insert << static_cast<int64_t>(76561197960265728ull + i) << static_cast<int64_t>(tribes[i]) << start_ms << last_login_ms
+					<< level << (new_player ? 1 : 0);
+				insert.execute();
+			}
+		}
+
+		{
+			auto insert = db << "INSERT OR IGNORE INTO PVE_Tribes(TribeId, Is_Protected) VALUES(?,1);";
+			insert.used(true);
+
+			const uint64_t pve_tribes = static_cast<uint64_t>(static_cast<double>(options.tribes) * std::max(0.0, std::min(1.0, options.pve_fraction)));
+			std::uniform_int_distribution<uint64_t> pick(0, options.players - 1);
+
+			for (uint64_t i = 0; i < pve_tribes; ++i)
+			{
+				insert << static_cast<int64_t>(tribes[pick(rng)]);
+				insert.execute();
+			}
+		}
+
+		db << "COMMIT;";
+	}
+	catch (const sqlite::sqlite_exception& exception)
+	{
+		std::cerr << "Unexpected DB error " << exception.what() << " (" << exception.get_sql() << ")\n";
+		return 1;
+	}
+
+	std::cout << "Wrote " << options.players << " players in " << options.tribes << " tribes to " << options.path << " in "
+		<< std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count() << " ms\n";
+	return 0;
+}
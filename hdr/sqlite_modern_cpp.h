@@ -27,10 +27,20 @@
 #endif
 #endif
 
+#ifdef __has_include
+#if (__cplusplus > 201402 || (defined(_MSVC_LANG) && _MSVC_LANG > 201402)) && __has_include(<string_view>)
+#define MODERN_SQLITE_STRING_VIEW_SUPPORT
+#endif
+#endif
+
 #ifdef MODERN_SQLITE_STD_OPTIONAL_SUPPORT
 #include <optional>
 #endif
 
+#ifdef MODERN_SQLITE_STRING_VIEW_SUPPORT
+#include <string_view>
+#endif
+
 #ifdef MODERN_SQLITE_EXPERIMENTAL_OPTIONAL_SUPPORT
 #include <experimental/optional>
 #define MODERN_SQLITE_STD_OPTIONAL_SUPPORT
@@ -66,6 +76,15 @@ namespace sqlite {
 	class database;
 	class database_binder;
 
+#ifdef MODERN_SQLITE_STRING_VIEW_SUPPORT
+	// Bytes of a blob column without a copy. Like a std::string_view column it points into the current row
+	// and is only valid inside the callback, until the statement steps again.
+	struct blob_view {
+		void const* data = nullptr;
+		std::size_t size = 0;
+	};
+#endif
+
 	template<std::size_t> class binder;
 
 	typedef std::shared_ptr<sqlite3> connection_type;
@@ -254,6 +273,10 @@ namespace sqlite {
 		friend database_binder& operator <<(database_binder& db, const std::string& txt);
 		friend void get_col_from_db(database_binder& db, int inx, std::u16string & w);
 		friend database_binder& operator <<(database_binder& db, const std::u16string& txt);
+#ifdef MODERN_SQLITE_STRING_VIEW_SUPPORT
+		friend void get_col_from_db(database_binder& db, int inx, std::string_view & s);
+		friend void get_col_from_db(database_binder& db, int inx, blob_view & b);
+#endif
 
 
 #ifdef MODERN_SQLITE_STD_OPTIONAL_SUPPORT
@@ -739,6 +762,29 @@ namespace sqlite {
 		}
 	}
 
+#ifdef MODERN_SQLITE_STRING_VIEW_SUPPORT
+	// std::string_view, only for the `operator>>` callbacks, the view is valid until the statement steps again
+	 inline void get_col_from_db(database_binder& db, int inx, std::string_view & s) {
+		if(sqlite3_column_type(db._stmt.get(), inx) == SQLITE_NULL) {
+			s = std::string_view();
+		} else {
+			// text first, bytes after, so the length is that of the converted text
+			char const* text = reinterpret_cast<char const *>(sqlite3_column_text(db._stmt.get(), inx));
+			s = std::string_view(text, sqlite3_column_bytes(db._stmt.get(), inx));
+		}
+	}
+
+	// blob_view
+	 inline void get_col_from_db(database_binder& db, int inx, blob_view & b) {
+		if(sqlite3_column_type(db._stmt.get(), inx) == SQLITE_NULL) {
+			b = blob_view();
+		} else {
+			b.data = sqlite3_column_blob(db._stmt.get(), inx);
+			b.size = static_cast<std::size_t>(sqlite3_column_bytes(db._stmt.get(), inx));
+		}
+	}
+#endif
+
 	// Convert char* to string to trigger op<<(..., const std::string )
 	template<std::size_t N> inline database_binder& operator <<(database_binder& db, const char(&STR)[N]) { return db << std::string(STR); }
 	template<std::size_t N> inline database_binder& operator <<(database_binder& db, const char16_t(&STR)[N]) { return db << std::u16string(STR); }